@@ -209,6 +209,9 @@ EGLAPI EGLBoolean EGLAPIENTRY eglReleaseDeviceANGLE(EGLDeviceEXT device);
 #define EGL_PROGRAM_CACHE_RESIZE_ANGLE 0x3457
 #define EGL_PROGRAM_CACHE_TRIM_ANGLE 0x3458
 #define EGL_CONTEXT_PROGRAM_BINARY_CACHE_ENABLED_ANGLE 0x3459
+#define EGL_PROGRAM_CACHE_HIT_COUNT_ANGLE 0x34DA
+#define EGL_PROGRAM_CACHE_MISS_COUNT_ANGLE 0x34DB
+#define EGL_PROGRAM_CACHE_EVICTION_COUNT_ANGLE 0x34DC
 typedef EGLint (EGLAPIENTRYP PFNEGLPROGRAMCACHEGETATTRIBANGLEPROC) (EGLDisplay dpy, EGLenum attrib);
 typedef void (EGLAPIENTRYP PFNEGLPROGRAMCACHEQUERYANGLEPROC) (EGLDisplay dpy, EGLint index, void *key, EGLint *keysize, void *binary, EGLint *binarysize);
 typedef void (EGLAPIENTRYP PFNEGLPROGRAMCACHEPOPULATEANGLEPROC) (EGLDisplay dpy, const void *key, EGLint keysize, const void *binary, EGLint binarysize);
@@ -398,6 +401,17 @@ EGLAPI EGLBoolean EGLAPIENTRY eglPrepareSwapBuffersANGLE(EGLDisplay dpy, EGLSurf
 typedef EGLBoolean (EGLAPIENTRYP PFNEGLEXPORTVKIMAGEANGLEPROC)(EGLDisplay dpy, EGLImage image, void* vk_image, void* vk_image_create_info);
 #endif /* EGL_ANGLE_vulkan_image */
 
+#ifndef EGL_ANGLE_low_latency_present
+#define EGL_ANGLE_low_latency_present
+#define EGL_LOW_LATENCY_PRESENT_ANGLE 0x34D8
+#define EGL_PRESENT_LATENCY_ANGLE 0x34D9
+#endif /* EGL_ANGLE_low_latency_present */
+
+#ifndef EGL_ANGLE_frame_latency_waitable_object
+#define EGL_ANGLE_frame_latency_waitable_object
+#define EGL_FRAME_LATENCY_WAITABLE_OBJECT_ANGLE 0x34DD
+#endif /* EGL_ANGLE_frame_latency_waitable_object */
+
 // clang-format on
 
 #endif  // INCLUDE_EGL_EGLEXT_ANGLE_
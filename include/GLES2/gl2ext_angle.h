@@ -562,6 +562,28 @@ GL_APICALL void GL_APIENTRY glReleaseTexturesANGLE(GLuint numTexture, const GLui
 #endif
 #endif /* GL_ANGLE_vulkan_image */
 
+#ifndef GL_ANGLE_command_stream
+#define GL_ANGLE_command_stream 1
+typedef void(GL_APIENTRYP PFNGLBEGINCOMMANDSTREAMANGLEPROC)(GLuint stream);
+typedef void(GL_APIENTRYP PFNGLENDCOMMANDSTREAMANGLEPROC)(void);
+typedef void(GL_APIENTRYP PFNGLCALLCOMMANDSTREAMANGLEPROC)(GLuint stream);
+typedef void(GL_APIENTRYP PFNGLDELETECOMMANDSTREAMANGLEPROC)(GLuint stream);
+#ifdef GL_GLEXT_PROTOTYPES
+GL_APICALL void GL_APIENTRY glBeginCommandStreamANGLE(GLuint stream);
+GL_APICALL void GL_APIENTRY glEndCommandStreamANGLE(void);
+GL_APICALL void GL_APIENTRY glCallCommandStreamANGLE(GLuint stream);
+GL_APICALL void GL_APIENTRY glDeleteCommandStreamANGLE(GLuint stream);
+#endif
+#endif /* GL_ANGLE_command_stream */
+
+#ifndef GL_ANGLE_draw_warm_up
+#define GL_ANGLE_draw_warm_up 1
+typedef void(GL_APIENTRYP PFNGLWARMUPDRAWANGLEPROC)(GLenum mode);
+#ifdef GL_GLEXT_PROTOTYPES
+GL_APICALL void GL_APIENTRY glWarmUpDrawANGLE(GLenum mode);
+#endif
+#endif /* GL_ANGLE_draw_warm_up */
+
 #ifndef GL_CHROMIUM_texture_filtering_hint
 #define GL_CHROMIUM_texture_filtering_hint
 #define GL_TEXTURE_FILTERING_HINT_CHROMIUM 0x8AF0
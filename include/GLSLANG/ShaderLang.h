@@ -26,7 +26,7 @@
 
 // Version number for shader translation API.
 // It is incremented every time the API changes.
-#define ANGLE_SH_VERSION 277
+#define ANGLE_SH_VERSION 280
 
 enum ShShaderSpec
 {
@@ -353,6 +353,15 @@ const ShCompileOptions SH_ADD_EXPLICIT_BOOL_CASTS = UINT64_C(1) << 59;
 // ceil()ed instead.
 const ShCompileOptions SH_ROUND_OUTPUT_AFTER_DITHERING = UINT64_C(1) << 60;
 
+// Append the time spent in each phase of the compilation (parsing, AST checks and simplification,
+// output generation) and in each AST simplification pass to the info log.  Meant for profiling
+// the translator.
+const ShCompileOptions SH_REPORT_AST_PASS_TIMES = UINT64_C(1) << 61;
+
+// Fully unroll for loops with constant bounds and few iterations, and fold the expressions of the
+// loop index in each iteration.  This works around drivers that don't unroll such loops well.
+const ShCompileOptions SH_UNROLL_CONSTANT_LOOPS = UINT64_C(1) << 62;
+
 // The 64 bits hash function. The first parameter is the input string; the
 // second parameter is the string length.
 using ShHashFunction64 = khronos_uint64_t (*)(const char *, size_t);
@@ -616,12 +625,14 @@ namespace sh
 using BinaryBlob = std::vector<uint32_t>;
 
 //
-// Driver must call this first, once, before doing any other compiler operations.
+// Driver must call this first before doing any other compiler operations.  It can be called from
+// multiple threads, and must be balanced by a call to Finalize().
 // If the function succeeds, the return value is true, else false.
 //
 bool Initialize();
 //
-// Driver should call this at shutdown.
+// Driver should call this at shutdown.  The compiler is finalized when every call to Initialize()
+// has been balanced by a call to Finalize().
 // If the function succeeds, the return value is true, else false.
 //
 bool Finalize();
@@ -674,6 +685,13 @@ bool Compile(const ShHandle handle,
 // Clears the results from the previous compilation.
 void ClearResults(const ShHandle handle);
 
+// Sets the functions called at the beginning and end of each phase of the compilation and of each
+// AST pass, for example to emit trace events.  The phase names are string literals.  Shaders may
+// be compiled on multiple threads, so the callbacks must be thread-safe.  Pass nullptr to remove
+// them.
+using CompilePhaseCallback = void (*)(const char *phaseName);
+void SetCompilePhaseCallbacks(CompilePhaseCallback beginPhase, CompilePhaseCallback endPhase);
+
 // Return the version of the shader language.
 int GetShaderVersion(const ShHandle handle);
 
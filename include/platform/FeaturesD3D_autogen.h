@@ -164,6 +164,78 @@ struct FeaturesD3D : FeatureSetBase
         "Allow ES3 on 10.0 devices",
         &members,
     };
+
+    FeatureInfo cacheCompiledShaderBinaries = {
+        "cacheCompiledShaderBinaries",
+        FeatureCategory::D3DWorkarounds,
+        "Cache the output of D3DCompile in the blob cache, keyed by the HLSL source and the "
+        "compile flags, so shader variants are reused across programs and sessions",
+        &members,
+    };
+
+    FeatureInfo recordCommandsInDeferredContext = {
+        "recordCommandsInDeferredContext",
+        FeatureCategory::D3DWorkarounds,
+        "Record rendering commands in a deferred context and execute them on the immediate "
+        "context when they are flushed",
+        &members,
+    };
+
+    FeatureInfo combineBufferBindFlags = {
+        "combineBufferBindFlags",
+        FeatureCategory::D3DWorkarounds,
+        "Create a single buffer with the vertex, index and shader resource bind flags instead "
+        "of one copy of the buffer per usage",
+        &members,
+    };
+
+    FeatureInfo uploadDefaultUniformsThroughConstantBufferRing = {
+        "uploadDefaultUniformsThroughConstantBufferRing",
+        FeatureCategory::D3DWorkarounds,
+        "Upload the default uniform blocks by appending them to a dynamic constant buffer mapped "
+        "with MAP_WRITE_NO_OVERWRITE and binding them with constant buffer offsets",
+        &members,
+    };
+
+    FeatureInfo warmUpInputLayoutCache = {
+        "warmUpInputLayoutCache",
+        FeatureCategory::D3DWorkarounds,
+        "Keep a list of the input layouts created in the blob cache, and create them again when "
+        "a context is first made current so that the first draws that use them don't have to",
+        &members,
+    };
+
+    FeatureInfo convertStaticBuffersWithComputeShaders = {
+        "convertStaticBuffersWithComputeShaders",
+        FeatureCategory::D3DWorkarounds,
+        "Convert index and vertex buffers that are not natively supported into their static copies "
+        "with a compute shader instead of reading them back and converting them on the CPU",
+        &members,
+    };
+
+    FeatureInfo precreateRenderStates = {
+        "precreateRenderStates",
+        FeatureCategory::D3DWorkarounds,
+        "Save the blend, rasterizer, depth stencil and sampler states created in the blob cache, and "
+        "create them again on a worker thread when a context is first made current",
+        &members,
+    };
+
+    FeatureInfo expandPointSpritesWithVertexId = {
+        "expandPointSpritesWithVertexId",
+        FeatureCategory::D3DWorkarounds,
+        "Expand point sprites into instanced quads indexed by SV_VertexID on Feature Level 10+, "
+        "instead of using a geometry shader",
+        &members,
+    };
+
+    FeatureInfo useFlipDiscardSwapChain = {
+        "useFlipDiscardSwapChain",
+        FeatureCategory::D3DWorkarounds,
+        "Create window surfaces with a flip-discard swap chain that has a frame latency waitable "
+        "object, and allow tearing with a zero swap interval",
+        &members,
+    };
 };
 
 inline FeaturesD3D::FeaturesD3D()  = default;
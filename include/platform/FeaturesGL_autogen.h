@@ -449,6 +449,31 @@ struct FeaturesGL : FeatureSetBase
         "alwaysUnbindFramebufferTexture2D", FeatureCategory::OpenGLWorkarounds,
         "Force unbind framebufferTexture2D before binding renderbuffer to work around driver bug.",
         &members, "https://anglebug.com/5536"};
+
+    FeatureInfo usePersistentMappedStreamingBuffers = {
+        "usePersistentMappedStreamingBuffers",
+        FeatureCategory::OpenGLWorkarounds,
+        "Stream client-side vertex and index data through a persistently mapped ring buffer "
+        "instead of uploading it with glBufferSubData, which can stall on the previous draw.",
+        &members,
+    };
+
+    FeatureInfo cacheNativeProgramBinaries = {
+        "cacheNativeProgramBinaries",
+        FeatureCategory::OpenGLWorkarounds,
+        "Cache native program binaries keyed on the translated shaders, and load them with "
+        "glProgramBinary when an identical program is linked again",
+        &members,
+    };
+
+    FeatureInfo streamTextureUploadsThroughPixelUnpackBuffer = {
+        "streamTextureUploadsThroughPixelUnpackBuffer",
+        FeatureCategory::OpenGLWorkarounds,
+        "Copy client data of texture sub-image uploads into a persistently mapped pixel unpack "
+        "buffer, so that the driver uploads from the buffer instead of copying the client data "
+        "synchronously",
+        &members,
+    };
 };
 
 inline FeaturesGL::FeaturesGL()  = default;
@@ -222,6 +222,38 @@ struct FeaturesMtl : FeatureSetBase
         "limitMaxColorTargetBitsForTesting", FeatureCategory::MetalFeatures,
         "Metal iOS has a limit on the number of color target bits per pixel.", &members,
         "http://anglebug.com/7280"};
+
+    FeatureInfo encodeRenderPassesInParallel = {
+        "encodeRenderPassesInParallel",
+        FeatureCategory::MetalFeatures,
+        "Split render passes with many draws into chunks that are encoded concurrently "
+        "through a parallel render command encoder",
+        &members,
+    };
+
+    FeatureInfo useBinaryArchiveForRenderPipelines = {
+        "useBinaryArchiveForRenderPipelines",
+        FeatureCategory::MetalFeatures,
+        "Record the render pipelines in a MTLBinaryArchive persisted in the blob cache, so that "
+        "they don't need to be compiled again on the next launch",
+        &members,
+    };
+
+    FeatureInfo createRenderPipelinesAsynchronously = {
+        "createRenderPipelinesAsynchronously",
+        FeatureCategory::MetalFeatures,
+        "Create render pipelines in parallel through the asynchronous Metal API when several "
+        "of them are needed at once",
+        &members,
+    };
+
+    FeatureInfo useMemorylessTransientAttachments = {
+        "useMemorylessTransientAttachments",
+        FeatureCategory::MetalFeatures,
+        "Allocate the depth, stencil and multisample color buffers of surfaces in tile memory, "
+        "until a render pass needs to load or store them",
+        &members,
+    };
 };
 
 inline FeaturesMtl::FeaturesMtl()  = default;
@@ -645,6 +645,188 @@ struct FeaturesVk : FeatureSetBase
         "Prefer to use VK_FILTER_LINEAR for VkSamplerYcbcrConversion",
         &members,
     };
+
+    FeatureInfo asyncGraphicsPipelineCreation = {
+        "asyncGraphicsPipelineCreation",
+        FeatureCategory::VulkanFeatures,
+        "On a pipeline cache miss, draw with a pipeline created without optimizations and "
+        "create the optimized pipeline on a worker thread",
+        &members,
+    };
+
+    FeatureInfo warmUpGraphicsPipelinesOnProgramLoad = {
+        "warmUpGraphicsPipelinesOnProgramLoad",
+        FeatureCategory::VulkanFeatures,
+        "Save the graphics pipelines used by a program in its binary, and create them "
+        "when the program binary is loaded",
+        &members,
+    };
+
+    FeatureInfo replayRenderPassCommandsInParallel = {
+        "replayRenderPassCommandsInParallel",
+        FeatureCategory::VulkanFeatures,
+        "Replay render passes with many draw calls into Vulkan secondary command buffers "
+        "on worker threads",
+        &members,
+    };
+
+    FeatureInfo supportsDescriptorUpdateTemplate = {
+        "supportsDescriptorUpdateTemplate",
+        FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_KHR_descriptor_update_template extension",
+        &members,
+    };
+
+    FeatureInfo supportsTimelineSemaphore = {
+        "supportsTimelineSemaphore",
+        FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_KHR_timeline_semaphore extension",
+        &members,
+    };
+
+    FeatureInfo useTimelineSemaphoreForQueueSerials = {
+        "useTimelineSemaphoreForQueueSerials",
+        FeatureCategory::VulkanFeatures,
+        "Track the completion of queue serials with a timeline semaphore per queue priority "
+        "instead of a fence per submission",
+        &members,
+    };
+
+    FeatureInfo convertRgbTextureUploadsWithCompute = {
+        "convertRgbTextureUploadsWithCompute",
+        FeatureCategory::VulkanFeatures,
+        "Expand large uploads of RGB texture data to RGBA with a compute shader "
+        "instead of on the CPU when RGBA is used as fallback for RGB",
+        &members,
+    };
+
+    FeatureInfo supportsMemoryBudget = {
+        "supportsMemoryBudget",
+        FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_EXT_memory_budget extension",
+        &members,
+    };
+
+    FeatureInfo deferImmutableTextureLevelAllocation = {
+        "deferImmutableTextureLevelAllocation",
+        FeatureCategory::VulkanFeatures,
+        "Allocate only the uploaded levels of immutable textures until the rest of the "
+        "mip chain is needed; textureSize() of the levels that are not allocated yet is unreliable",
+        &members,
+    };
+
+    FeatureInfo cacheTransformedSpirv = {
+        "cacheTransformedSpirv",
+        FeatureCategory::VulkanFeatures,
+        "Look up transformed SPIR-V in the blob cache, keyed by the input SPIR-V and the transform "
+        "options, instead of transforming it for every program variant",
+        &members,
+    };
+
+    FeatureInfo useDynamicPrimitiveTopology = {
+        "useDynamicPrimitiveTopology",
+        FeatureCategory::VulkanFeatures,
+        "Set the primitive topology with vkCmdSetPrimitiveTopologyEXT so that draws with "
+        "different topologies of the same class share a pipeline",
+        &members,
+    };
+
+    FeatureInfo reuseImportedExternalImages = {
+        "reuseImportedExternalImages",
+        FeatureCategory::VulkanFeatures,
+        "Keep the images imported from AHardwareBuffers and dma-bufs after their EGL images "
+        "are destroyed, so that a buffer the application cycles through is imported once",
+        &members,
+    };
+
+    FeatureInfo supportsPresentWait = {
+        "supportsPresentWait",
+        FeatureCategory::VulkanFeatures,
+        "VkDevice supports the VK_KHR_present_id and VK_KHR_present_wait extensions",
+        &members,
+    };
+
+    FeatureInfo asyncPresent = {
+        "asyncPresent",
+        FeatureCategory::VulkanFeatures,
+        "Call vkQueuePresentKHR from a dedicated thread on its own queue, so that a present "
+        "blocking on the presentation engine doesn't delay the submission of the next frame",
+        &members,
+    };
+
+    FeatureInfo optimizeSpirv = {
+        "optimizeSpirv",
+        FeatureCategory::VulkanFeatures,
+        "Run dead code elimination, inlining and load/store elimination on the SPIR-V of "
+        "program shaders before creating their shader modules, for drivers with weak "
+        "shader compilers",
+        &members,
+    };
+
+    FeatureInfo unrollConstantLoops = {
+        "unrollConstantLoops",
+        FeatureCategory::VulkanFeatures,
+        "Fully unroll loops with constant bounds and few iterations in the translator, for drivers "
+        "that unroll them poorly",
+        &members,
+    };
+
+    FeatureInfo promoteDefaultUniformsToPushConstants = {
+        "promoteDefaultUniformsToPushConstants",
+        FeatureCategory::VulkanFeatures,
+        "Pass the default uniforms of a program in push constants instead of a uniform buffer when "
+        "they fit in the minimum push constant size, which saves descriptor set updates and dynamic "
+        "offsets on draws that change uniforms",
+        &members,
+    };
+
+    FeatureInfo loadTextureDataInParallel = {
+        "loadTextureDataInParallel",
+        FeatureCategory::VulkanFeatures,
+        "Convert large texture uploads and filter large CPU mipmap levels in bands on "
+        "worker threads",
+        &members,
+    };
+
+    FeatureInfo supportsImagelessFramebuffer = {
+        "supportsImagelessFramebuffer",
+        FeatureCategory::VulkanFeatures,
+        "VkDevice supports VK_KHR_imageless_framebuffer, with which framebuffers only depend on "
+        "the properties of their attachments and are reused when an attachment is reallocated",
+        &members,
+    };
+
+    FeatureInfo supportsHostImageCopy = {
+        "supportsHostImageCopy",
+        FeatureCategory::VulkanFeatures,
+        "VkDevice supports VK_EXT_host_image_copy, with which texture uploads are copied "
+        "straight from client memory to idle images on the CPU",
+        &members,
+    };
+
+    FeatureInfo useTransferQueueForUploads = {
+        "useTransferQueueForUploads",
+        FeatureCategory::VulkanFeatures,
+        "Copy large buffer and texture uploads on a queue of a transfer-only queue family, so "
+        "that they overlap with rendering",
+        &members,
+    };
+
+    FeatureInfo useHostAllocationCallbacks = {
+        "useHostAllocationCallbacks",
+        FeatureCategory::VulkanFeatures,
+        "Give the driver VkAllocationCallbacks for the device, which serve command scope host "
+        "allocations from per-thread arenas and report host memory in memory report stats",
+        &members,
+    };
+
+    FeatureInfo supportsCalibratedTimestamps = {
+        "supportsCalibratedTimestamps",
+        FeatureCategory::VulkanFeatures,
+        "VkDevice supports VK_EXT_calibrated_timestamps with the device time domain, which is "
+        "used to correlate GPU trace events with CPU time",
+        &members,
+    };
 };
 
 inline FeaturesVk::FeaturesVk()  = default;
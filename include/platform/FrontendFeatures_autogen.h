@@ -86,6 +86,20 @@ struct FrontendFeatures : FeatureSetBase
         "enableProgramBinaryForCapture", FeatureCategory::FrontendFeatures,
         "Even if FrameCapture is enabled, enable GL_OES_get_program_binary", &members,
         "http://anglebug.com/5658"};
+
+    FeatureInfo cacheCompiledShader = {
+        "cacheCompiledShader",
+        FeatureCategory::FrontendFeatures,
+        "Enable to cache compiled shaders",
+        &members,
+    };
+
+    FeatureInfo enableCompressingProgramCacheInThreadPool = {
+        "enableCompressingProgramCacheInThreadPool",
+        FeatureCategory::FrontendFeatures,
+        "Compress program binaries in a worker thread before storing them in the blob cache",
+        &members,
+    };
 };
 
 inline FrontendFeatures::FrontendFeatures()  = default;
@@ -178,6 +178,7 @@ assert INCLUDE_REGEX.match(b'\n#include "foo"')
 IGNORED_INCLUDES = {
     b'absl/container/flat_hash_map.h',
     b'absl/container/flat_hash_set.h',
+    b'absl/container/node_hash_map.h',
     b'compiler/translator/TranslatorESSL.h',
     b'compiler/translator/TranslatorGLSL.h',
     b'compiler/translator/TranslatorHLSL.h',
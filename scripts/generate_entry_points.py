@@ -173,7 +173,7 @@ void GL_APIENTRY GL_{name}({params})
 
     if ({valid_context_check})
     {{{packed_gl_enum_conversions}
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = {context_lock}(context);
         bool isCallValid = (context->skipValidation() || Validate{name}({validate_params}));
         if (isCallValid)
         {{
@@ -197,7 +197,7 @@ TEMPLATE_GLES_ENTRY_POINT_WITH_RETURN = """\
     {return_type} returnValue;
     if ({valid_context_check})
     {{{packed_gl_enum_conversions}
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = {context_lock}(context);
         bool isCallValid = (context->skipValidation() || Validate{name}({validate_params}));
         if (isCallValid)
         {{
@@ -1592,6 +1592,8 @@ def format_entry_point_def(api, command_node, cmd_name, proto, params, cmd_packe
             get_egl_entry_point_labeled_object(ep_to_object, cmd_name, params, packed_enums),
         "entry_point_locks":
             get_locks(api, cmd_name, params),
+        "context_lock":
+            get_context_lock(params),
         "preamble":
             get_preamble(api, cmd_name, params)
     }
@@ -2545,6 +2547,15 @@ def get_locks(api, cmd_name, params):
     return ordered_lock_statements(LOCK_GLOBAL)
 
 
+def get_context_lock(params):
+    # EGLImages are shared outside the share group of the context they are bound in.
+    for param in params:
+        if just_the_type(param) == "GLeglImageOES":
+            return "GetContextLockForEGLImage"
+
+    return "GetContextLock"
+
+
 def get_prepare_swap_buffers_call(api, cmd_name, params):
     if cmd_name not in [
             "eglSwapBuffers", "eglSwapBuffersWithDamageKHR", "eglSwapBuffersWithFrameTokenANGLE"
@@ -41,8 +41,10 @@ angle_toggleable_extensions = [
 angle_requestable_extensions = [
     "GL_ANGLE_base_vertex_base_instance",
     "GL_ANGLE_base_vertex_base_instance_shader_builtin",
+    "GL_ANGLE_command_stream",
     "GL_ANGLE_compressed_texture_etc",
     "GL_ANGLE_copy_texture_3d",
+    "GL_ANGLE_draw_warm_up",
     "GL_ANGLE_framebuffer_multisample",
     "GL_ANGLE_get_image",
     "GL_ANGLE_get_tex_level_parameter",
@@ -0,0 +1,147 @@
+//
+// Copyright 2022 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MPSCQueue.h:
+//   A bounded, lock-free queue with multiple producers and a single consumer.
+//
+
+#ifndef COMMON_MPSCQUEUE_H_
+#define COMMON_MPSCQUEUE_H_
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace angle
+{
+// Based on Dmitry Vyukov's bounded MPMC queue.  Every slot holds a sequence number that tells
+// whether the slot is ready to be written by a producer or read by the consumer, so producers only
+// contend on the enqueue position and never block the consumer.
+//
+// T must be default constructible and move assignable.  Elements popped from the queue are moved
+// out, so T's moved-from state is what remains in the slot until it is reused.
+template <class T>
+class BoundedMPSCQueue final : angle::NonCopyable
+{
+  public:
+    // |capacity| must be a power of two.
+    explicit BoundedMPSCQueue(size_t capacity);
+    ~BoundedMPSCQueue();
+
+    // May be called from any thread.  Returns false without touching |value| if the queue is full.
+    bool tryPush(T &&value);
+
+    // May only be called from the consumer thread.  Returns false if the queue is empty.
+    bool tryPop(T *valueOut);
+
+    // Returns whether tryPop() would fail.  Other threads must synchronize with the consumer thread
+    // for the result to be accurate.  Pushes in progress are not visible until they complete.
+    bool empty() const;
+
+    size_t capacity() const { return mMask + 1; }
+
+  private:
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    // Keep the producer and consumer positions on separate cache lines.
+    static constexpr size_t kCacheLineSize = 64;
+
+    std::unique_ptr<Slot[]> mSlots;
+    const size_t mMask;
+    alignas(kCacheLineSize) std::atomic<size_t> mEnqueuePosition;
+    alignas(kCacheLineSize) std::atomic<size_t> mDequeuePosition;
+};
+
+template <class T>
+BoundedMPSCQueue<T>::BoundedMPSCQueue(size_t capacity)
+    : mSlots(new Slot[capacity]), mMask(capacity - 1), mEnqueuePosition(0), mDequeuePosition(0)
+{
+    ASSERT(capacity > 1 && gl::isPow2(capacity));
+    for (size_t index = 0; index < capacity; ++index)
+    {
+        mSlots[index].sequence.store(index, std::memory_order_relaxed);
+    }
+}
+
+template <class T>
+BoundedMPSCQueue<T>::~BoundedMPSCQueue() = default;
+
+template <class T>
+bool BoundedMPSCQueue<T>::tryPush(T &&value)
+{
+    size_t position = mEnqueuePosition.load(std::memory_order_relaxed);
+    Slot *slot      = nullptr;
+    while (true)
+    {
+        slot = &mSlots[position & mMask];
+
+        const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        const intptr_t difference =
+            static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+        if (difference == 0)
+        {
+            // The slot is free, try to claim it.
+            if (mEnqueuePosition.compare_exchange_weak(position, position + 1,
+                                                       std::memory_order_relaxed))
+            {
+                break;
+            }
+        }
+        else if (difference < 0)
+        {
+            // The consumer has not yet popped the element from the previous lap.
+            return false;
+        }
+        else
+        {
+            // Another producer claimed the slot.
+            position = mEnqueuePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->value = std::move(value);
+
+    // Publish the element.  This is sequentially consistent so that a consumer that is about to
+    // sleep either sees the element in empty(), or the producer sees that the consumer is asleep.
+    slot->sequence.store(position + 1, std::memory_order_seq_cst);
+    return true;
+}
+
+template <class T>
+bool BoundedMPSCQueue<T>::tryPop(T *valueOut)
+{
+    const size_t position = mDequeuePosition.load(std::memory_order_relaxed);
+    Slot &slot            = mSlots[position & mMask];
+
+    if (slot.sequence.load(std::memory_order_acquire) != position + 1)
+    {
+        return false;
+    }
+
+    *valueOut = std::move(slot.value);
+
+    // Make the slot available to producers for the next lap.
+    slot.sequence.store(position + mMask + 1, std::memory_order_release);
+    mDequeuePosition.store(position + 1, std::memory_order_relaxed);
+    return true;
+}
+
+template <class T>
+bool BoundedMPSCQueue<T>::empty() const
+{
+    const size_t position = mDequeuePosition.load(std::memory_order_relaxed);
+    return mSlots[position & mMask].sequence.load(std::memory_order_seq_cst) != position + 1;
+}
+}  // namespace angle
+
+#endif  // COMMON_MPSCQUEUE_H_
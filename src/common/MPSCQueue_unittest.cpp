@@ -0,0 +1,123 @@
+//
+// Copyright 2022 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MPSCQueue_unittest:
+//   Tests of the BoundedMPSCQueue class
+//
+
+#include <gtest/gtest.h>
+
+#include "common/MPSCQueue.h"
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace angle
+{
+// Make sure elements are popped in the order they were pushed, and that a full queue rejects
+// pushes.
+TEST(BoundedMPSCQueue, PushAndPop)
+{
+    BoundedMPSCQueue<int> queue(4);
+    EXPECT_EQ(4u, queue.capacity());
+    EXPECT_TRUE(queue.empty());
+
+    int value = 0;
+    EXPECT_FALSE(queue.tryPop(&value));
+
+    // Go around the ring buffer a few times.
+    for (int lap = 0; lap < 3; ++lap)
+    {
+        for (int index = 0; index < 4; ++index)
+        {
+            int pushed = lap * 4 + index;
+            EXPECT_TRUE(queue.tryPush(std::move(pushed)));
+        }
+
+        int extra = -1;
+        EXPECT_FALSE(queue.tryPush(std::move(extra)));
+        EXPECT_FALSE(queue.empty());
+
+        for (int index = 0; index < 4; ++index)
+        {
+            EXPECT_TRUE(queue.tryPop(&value));
+            EXPECT_EQ(lap * 4 + index, value);
+        }
+        EXPECT_TRUE(queue.empty());
+    }
+}
+
+// Make sure move-only types are moved in and out of the queue.
+TEST(BoundedMPSCQueue, MoveOnly)
+{
+    BoundedMPSCQueue<std::unique_ptr<int>> queue(2);
+
+    std::unique_ptr<int> pushed(new int(5));
+    EXPECT_TRUE(queue.tryPush(std::move(pushed)));
+    EXPECT_EQ(nullptr, pushed);
+
+    // A failed push leaves the value untouched.
+    EXPECT_TRUE(queue.tryPush(std::unique_ptr<int>(new int(6))));
+    std::unique_ptr<int> rejected(new int(7));
+    EXPECT_FALSE(queue.tryPush(std::move(rejected)));
+    ASSERT_NE(nullptr, rejected);
+    EXPECT_EQ(7, *rejected);
+
+    std::unique_ptr<int> popped;
+    EXPECT_TRUE(queue.tryPop(&popped));
+    ASSERT_NE(nullptr, popped);
+    EXPECT_EQ(5, *popped);
+}
+
+// Make sure all elements from multiple producers are received, in order per producer.
+TEST(BoundedMPSCQueue, MultipleProducers)
+{
+    constexpr int kProducerCount     = 4;
+    constexpr int kValuesPerProducer = 10000;
+
+    BoundedMPSCQueue<int> queue(16);
+
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < kProducerCount; ++producer)
+    {
+        producers.emplace_back([&queue, producer]() {
+            for (int index = 0; index < kValuesPerProducer; ++index)
+            {
+                int value = producer * kValuesPerProducer + index;
+                while (!queue.tryPush(std::move(value)))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::vector<int> nextIndex(kProducerCount, 0);
+    int poppedCount = 0;
+    while (poppedCount < kProducerCount * kValuesPerProducer)
+    {
+        int value = 0;
+        if (!queue.tryPop(&value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const int producer = value / kValuesPerProducer;
+        ASSERT_LT(producer, kProducerCount);
+        EXPECT_EQ(nextIndex[producer], value % kValuesPerProducer);
+        ++nextIndex[producer];
+        ++poppedCount;
+    }
+
+    for (std::thread &producer : producers)
+    {
+        producer.join();
+    }
+
+    EXPECT_TRUE(queue.empty());
+}
+}  // namespace angle
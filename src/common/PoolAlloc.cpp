@@ -13,6 +13,9 @@
 #include <stdint.h>
 #include <stdio.h>
 
+#include <mutex>
+
+#include "anglebase/no_destructor.h"
 #include "common/angleutils.h"
 #include "common/debug.h"
 #include "common/mathutil.h"
@@ -149,6 +152,64 @@ class PageHeader
     Allocation *lastAllocation;
 #    endif
 };
+
+namespace
+{
+// Pages of the default size that are freed when a pool allocator is destroyed are kept in a
+// process-wide cache, so that allocators created later (such as those of new compiler instances)
+// can reuse them instead of going back to the system allocator.  The cache is only accessed when
+// an allocator runs out of its own free pages, which keeps the lock uncontended.
+class PageCache final : angle::NonCopyable
+{
+  public:
+    PageHeader *acquire()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        PageHeader *page = mFreePages;
+        if (page != nullptr)
+        {
+            mFreePages = page->nextPage;
+            --mPageCount;
+        }
+        return page;
+    }
+
+    bool release(PageHeader *page)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mPageCount >= kMaxPageCount)
+        {
+            return false;
+        }
+        page->nextPage = mFreePages;
+        mFreePages     = page;
+        ++mPageCount;
+        return true;
+    }
+
+  private:
+    static constexpr size_t kMaxPageCount = 128;
+
+    std::mutex mMutex;
+    PageHeader *mFreePages = nullptr;
+    size_t mPageCount      = 0;
+};
+
+PageCache *GetPageCache()
+{
+    static angle::base::NoDestructor<PageCache> pageCache;
+    return pageCache.get();
+}
+
+void FreePage(PageHeader *page, size_t pageSize)
+{
+    if (page->pageCount > 1 || pageSize != PoolAllocator::kDefaultPageSize ||
+        !GetPageCache()->release(page))
+    {
+        delete[] reinterpret_cast<char *>(page);
+    }
+}
+}  // anonymous namespace
 #endif
 
 //
@@ -163,6 +224,8 @@ PoolAllocator::PoolAllocator(int growthIncrement, int allocationAlignment)
       mInUseList(nullptr),
       mNumCalls(0),
       mTotalBytes(0),
+      mInUsePageBytes(0),
+      mPeakInUsePageBytes(0),
 #endif
       mLocked(false)
 {
@@ -218,7 +281,7 @@ PoolAllocator::~PoolAllocator()
     {
         PageHeader *next = mInUseList->nextPage;
         mInUseList->~PageHeader();
-        delete[] reinterpret_cast<char *>(mInUseList);
+        FreePage(mInUseList, mPageSize);
         mInUseList = next;
     }
     // We should not check the guard blocks
@@ -228,7 +291,7 @@ PoolAllocator::~PoolAllocator()
     while (mFreeList)
     {
         PageHeader *next = mFreeList->nextPage;
-        delete[] reinterpret_cast<char *>(mFreeList);
+        FreePage(mFreeList, mPageSize);
         mFreeList = next;
     }
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
@@ -302,6 +365,7 @@ void PoolAllocator::pop()
         mInUseList->~PageHeader();
 
         PageHeader *nextInUse = mInUseList->nextPage;
+        mInUsePageBytes -= mInUseList->pageCount * mPageSize;
         if (mInUseList->pageCount > 1)
         {
             delete[] reinterpret_cast<char *>(mInUseList);
@@ -388,6 +452,7 @@ void *PoolAllocator::allocate(size_t numBytes)
         // Use placement-new to initialize header
         new (memory) PageHeader(mInUseList, (numBytesToAlloc + mPageSize - 1) / mPageSize);
         mInUseList = memory;
+        onPageInUse(memory);
 
         // Make next allocation come from a new page
         mCurrentPageOffset = mPageSize;
@@ -417,14 +482,19 @@ void *PoolAllocator::allocate(size_t numBytes)
 uint8_t *PoolAllocator::allocateNewPage(size_t numBytes)
 {
     // Need a simple page to allocate from.  Pick a page from the free list, if any.  Otherwise need
-    // to make the allocation.
-    PageHeader *memory;
+    // to make the allocation, unless another allocator left a page of the right size behind.
+    PageHeader *memory = nullptr;
     if (mFreeList)
     {
         memory    = mFreeList;
         mFreeList = mFreeList->nextPage;
     }
-    else
+    else if (mPageSize == kDefaultPageSize)
+    {
+        memory = GetPageCache()->acquire();
+    }
+
+    if (memory == nullptr)
     {
         memory = reinterpret_cast<PageHeader *>(::new char[mPageSize]);
         if (memory == nullptr)
@@ -435,6 +505,7 @@ uint8_t *PoolAllocator::allocateNewPage(size_t numBytes)
     // Use placement-new to initialize header
     new (memory) PageHeader(mInUseList, 1);
     mInUseList = memory;
+    onPageInUse(memory);
 
     // Leave room for the page header.
     mCurrentPageOffset      = mPageHeaderSkip;
@@ -450,6 +521,15 @@ uint8_t *PoolAllocator::allocateNewPage(size_t numBytes)
     return reinterpret_cast<uint8_t *>(mInUseList) + mPageHeaderSkip + preAllocationPadding;
 }
 
+void PoolAllocator::onPageInUse(PageHeader *page)
+{
+    mInUsePageBytes += page->pageCount * mPageSize;
+    if (mInUsePageBytes > mPeakInUsePageBytes)
+    {
+        mPeakInUsePageBytes = mInUsePageBytes;
+    }
+}
+
 void *PoolAllocator::initializeAllocation(uint8_t *memory, size_t numBytes)
 {
 #    if defined(ANGLE_POOL_ALLOC_GUARD_BLOCKS)
@@ -461,6 +541,15 @@ void *PoolAllocator::initializeAllocation(uint8_t *memory, size_t numBytes)
 }
 #endif
 
+size_t PoolAllocator::getPeakPageBytes() const
+{
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+    return mPeakInUsePageBytes;
+#else
+    return 0;
+#endif
+}
+
 void PoolAllocator::lock()
 {
     ASSERT(!mLocked);
@@ -57,11 +57,13 @@ class PoolAllocator : angle::NonCopyable
 {
   public:
     static const int kDefaultAlignment = sizeof(void *);
+    static const int kDefaultPageSize  = 8 * 1024;
     //
     // Create PoolAllocator. If alignment is set to 1 byte then fastAllocate()
     //  function can be used to make allocations with less overhead.
     //
-    PoolAllocator(int growthIncrement = 8 * 1024, int allocationAlignment = kDefaultAlignment);
+    PoolAllocator(int growthIncrement     = kDefaultPageSize,
+                  int allocationAlignment = kDefaultAlignment);
 
     //
     // Don't call the destructor just to free up the memory, call pop()
@@ -127,6 +129,12 @@ class PoolAllocator : angle::NonCopyable
     // user of it, as the model of use is to simultaneously deallocate everything at once by calling
     // pop(), and to not have to solve memory leak problems.
 
+    //
+    // Returns the largest amount of memory the pool has held in pages at the same time, as a
+    // measure of how much memory the users of the pool need.
+    //
+    size_t getPeakPageBytes() const;
+
     // Catch unwanted allocations.
     // TODO(jmadill): Remove this when we remove the global allocator.
     void lock();
@@ -145,6 +153,9 @@ class PoolAllocator : angle::NonCopyable
 
     // Slow path of allocation when we have to get a new page.
     uint8_t *allocateNewPage(size_t numBytes);
+    // Accounts for a page that was added to mInUseList.
+    void onPageInUse(PageHeader *page);
+
     // Track allocations if and only if we're using guard blocks
     void *initializeAllocation(uint8_t *memory, size_t numBytes);
 
@@ -169,6 +180,10 @@ class PoolAllocator : angle::NonCopyable
     int mNumCalls;       // just an interesting statistic
     size_t mTotalBytes;  // just an interesting statistic
 
+    // Memory in the pages of mInUseList, and the most it has been.
+    size_t mInUsePageBytes;
+    size_t mPeakInUsePageBytes;
+
 #else  // !defined(ANGLE_DISABLE_POOL_ALLOC)
     std::vector<std::vector<void *>> mStack;
 #endif
@@ -77,4 +77,49 @@ INSTANTIATE_TEST_SUITE_P(,
                          testing::Values(2, 4, 8, 16, 32, 64, 128),
                          testing::PrintToStringParamName());
 #endif
+
+#if !defined(ANGLE_DISABLE_POOL_ALLOC)
+// Verify that the peak page usage is tracked, and that popped pages are reused
+TEST(PoolAllocatorTest, PeakPageBytes)
+{
+    constexpr size_t kPageSize = PoolAllocator::kDefaultPageSize;
+
+    PoolAllocator poolAllocator;
+    EXPECT_EQ(0u, poolAllocator.getPeakPageBytes());
+
+    // Each of these allocations needs a page of its own.
+    poolAllocator.push();
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        EXPECT_NE(nullptr, poolAllocator.allocate(kPageSize / 2));
+    }
+    poolAllocator.pop();
+
+    const size_t peakPageBytes = poolAllocator.getPeakPageBytes();
+    EXPECT_EQ(4 * kPageSize, peakPageBytes);
+
+    // Making the same allocations again reuses the popped pages.
+    poolAllocator.push();
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        EXPECT_NE(nullptr, poolAllocator.allocate(kPageSize / 2));
+    }
+    poolAllocator.pop();
+    EXPECT_EQ(peakPageBytes, poolAllocator.getPeakPageBytes());
+}
+
+// Verify that the pages of a destroyed allocator are reused by the next one
+TEST(PoolAllocatorTest, PagesAreReusedAcrossAllocators)
+{
+    void *firstAllocation = nullptr;
+    {
+        PoolAllocator poolAllocator;
+        firstAllocation = poolAllocator.allocate(16);
+        EXPECT_NE(nullptr, firstAllocation);
+    }
+
+    PoolAllocator poolAllocator;
+    EXPECT_EQ(firstAllocation, poolAllocator.allocate(16));
+}
+#endif
 }  // namespace angle
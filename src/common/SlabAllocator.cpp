@@ -0,0 +1,387 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SlabAllocator.cpp:
+//   Implements the size classes, the depot and the per-thread magazines of the slab allocator.
+//
+
+#include "common/SlabAllocator.h"
+
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+#include "common/debug.h"
+#include "common/platform.h"
+#include "common/tls.h"
+
+#if defined(ANGLE_WITH_ASAN) || defined(ANGLE_WITH_MSAN) || defined(ANGLE_WITH_TSAN)
+#    define ANGLE_SLAB_ALLOCATOR_USES_GLOBAL_HEAP 1
+#endif
+
+namespace angle
+{
+#if !defined(ANGLE_SLAB_ALLOCATOR_USES_GLOBAL_HEAP)
+namespace
+{
+// The size classes are 16 bytes apart up to 512 bytes, then 128 bytes apart.
+constexpr size_t kSmallSizeClassStep  = kSlabAllocationAlignment;
+constexpr size_t kMaxSmallSize        = 512;
+constexpr size_t kLargeSizeClassStep  = 128;
+constexpr size_t kSmallSizeClassCount = kMaxSmallSize / kSmallSizeClassStep;
+constexpr size_t kSizeClassCount =
+    kSmallSizeClassCount + (kMaxSlabAllocationSize - kMaxSmallSize) / kLargeSizeClassStep;
+
+constexpr size_t kMagazineCapacity = 32;
+constexpr size_t kSlabSize         = 64 * 1024;
+
+static_assert(kSlabSize % kMaxSlabAllocationSize == 0, "Slabs must hold whole objects");
+
+size_t GetSizeClass(size_t size)
+{
+    ASSERT(size <= kMaxSlabAllocationSize);
+    if (size <= kMaxSmallSize)
+    {
+        return size == 0 ? 0 : (size - 1) / kSmallSizeClassStep;
+    }
+    return kSmallSizeClassCount + (size - kMaxSmallSize - 1) / kLargeSizeClassStep;
+}
+
+size_t GetSizeClassObjectSize(size_t sizeClass)
+{
+    if (sizeClass < kSmallSizeClassCount)
+    {
+        return (sizeClass + 1) * kSmallSizeClassStep;
+    }
+    return kMaxSmallSize + (sizeClass - kSmallSizeClassCount + 1) * kLargeSizeClassStep;
+}
+
+struct Magazine
+{
+    Magazine *next = nullptr;
+    size_t count   = 0;
+    void *objects[kMagazineCapacity];
+};
+
+// Objects on the free list of the depot hold the pointer to the next one.
+struct FreeObject
+{
+    FreeObject *next;
+};
+
+// The objects of a size class that aren't cached by a thread.  Full magazines are handed to the
+// threads that run out of objects, and empty ones to the threads that filled theirs.
+class SizeClassDepot final : NonCopyable
+{
+  public:
+    void init(size_t objectSize) { mObjectSize = objectSize; }
+
+    // Used when the thread has no cache, i.e. while it is exiting.
+    void *allocate()
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return allocateLocked();
+    }
+
+    void free(void *ptr)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        freeLocked(ptr);
+    }
+
+    // Takes the empty magazine of a thread, if any, and returns one with at least one object.
+    Magazine *exchangeForFull(Magazine *empty)
+    {
+        ASSERT(empty == nullptr || empty->count == 0);
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        Magazine *full = mFullMagazines;
+        if (full != nullptr)
+        {
+            mFullMagazines = full->next;
+            pushEmptyLocked(empty);
+            return full;
+        }
+
+        full = empty != nullptr ? empty : popEmptyLocked();
+        while (full->count < kMagazineCapacity)
+        {
+            full->objects[full->count++] = allocateLocked();
+        }
+        return full;
+    }
+
+    // Takes the full magazine of a thread, and returns an empty one.
+    Magazine *exchangeForEmpty(Magazine *full)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        Magazine *empty = popEmptyLocked();
+        pushFullLocked(full);
+        return empty;
+    }
+
+    // Takes back the magazines of an exiting thread.
+    void returnMagazine(Magazine *magazine)
+    {
+        if (magazine == nullptr)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (magazine->count > 0)
+        {
+            pushFullLocked(magazine);
+        }
+        else
+        {
+            pushEmptyLocked(magazine);
+        }
+    }
+
+  private:
+    void *allocateLocked()
+    {
+        if (mFreeObjects != nullptr)
+        {
+            FreeObject *object = mFreeObjects;
+            mFreeObjects       = object->next;
+            return object;
+        }
+
+        if (mSlabCursor == mSlabEnd)
+        {
+            // The slabs are never freed, as objects of any slab may be cached by any thread.
+            mSlabCursor = static_cast<uint8_t *>(
+                ::operator new(kSlabSize, std::align_val_t(kSlabAllocationAlignment)));
+            mSlabEnd = mSlabCursor + kSlabSize - kSlabSize % mObjectSize;
+        }
+
+        void *object = mSlabCursor;
+        mSlabCursor += mObjectSize;
+        return object;
+    }
+
+    void freeLocked(void *ptr)
+    {
+        FreeObject *object = static_cast<FreeObject *>(ptr);
+        object->next       = mFreeObjects;
+        mFreeObjects       = object;
+    }
+
+    Magazine *popEmptyLocked()
+    {
+        Magazine *empty = mEmptyMagazines;
+        if (empty == nullptr)
+        {
+            return new Magazine;
+        }
+        mEmptyMagazines = empty->next;
+        return empty;
+    }
+
+    void pushEmptyLocked(Magazine *empty)
+    {
+        if (empty != nullptr)
+        {
+            empty->next     = mEmptyMagazines;
+            mEmptyMagazines = empty;
+        }
+    }
+
+    void pushFullLocked(Magazine *full)
+    {
+        full->next     = mFullMagazines;
+        mFullMagazines = full;
+    }
+
+    std::mutex mMutex;
+    size_t mObjectSize        = 0;
+    Magazine *mFullMagazines  = nullptr;
+    Magazine *mEmptyMagazines = nullptr;
+    FreeObject *mFreeObjects  = nullptr;
+    uint8_t *mSlabCursor      = nullptr;
+    uint8_t *mSlabEnd         = nullptr;
+};
+
+SizeClassDepot *GetDepots()
+{
+    // Never destroyed, since objects may be freed by the destructors of other globals.
+    static SizeClassDepot *depots = []() {
+        SizeClassDepot *newDepots = new SizeClassDepot[kSizeClassCount];
+        for (size_t sizeClass = 0; sizeClass < kSizeClassCount; ++sizeClass)
+        {
+            newDepots[sizeClass].init(GetSizeClassObjectSize(sizeClass));
+        }
+        return newDepots;
+    }();
+    return depots;
+}
+
+// The magazines of a thread.  The loaded magazine is used first, and swapped with the previous one
+// when it runs out or fills up, so the depot is only visited after a full magazine of allocations
+// or frees.
+struct ThreadCache
+{
+    ~ThreadCache()
+    {
+        SizeClassDepot *depots = GetDepots();
+        for (size_t sizeClass = 0; sizeClass < kSizeClassCount; ++sizeClass)
+        {
+            depots[sizeClass].returnMagazine(loaded[sizeClass]);
+            depots[sizeClass].returnMagazine(previous[sizeClass]);
+        }
+    }
+
+    Magazine *loaded[kSizeClassCount]   = {};
+    Magazine *previous[kSizeClassCount] = {};
+};
+
+#    if defined(ANGLE_PLATFORM_APPLE)
+// TODO(angleproject:6479): Due to a bug in Apple's dyld loader, `thread_local` will cause
+// excessive memory use.  Use pthread's thread local storage instead.
+void DestroyThreadCache(void *cache)
+{
+    delete static_cast<ThreadCache *>(cache);
+}
+
+ThreadCache *GetThreadCache()
+{
+    static TLSIndex threadCacheIndex = CreateTLSIndex(DestroyThreadCache);
+    if (threadCacheIndex == TLS_INVALID_INDEX)
+    {
+        return nullptr;
+    }
+
+    ThreadCache *cache = static_cast<ThreadCache *>(GetTLSValue(threadCacheIndex));
+    if (cache == nullptr)
+    {
+        cache = new ThreadCache;
+        SetTLSValue(threadCacheIndex, cache);
+    }
+    return cache;
+}
+#    else
+struct ThreadCacheHolder
+{
+    ~ThreadCacheHolder()
+    {
+        delete cache;
+        cache     = nullptr;
+        destroyed = true;
+    }
+
+    ThreadCache *cache = nullptr;
+    bool destroyed     = false;
+};
+thread_local ThreadCacheHolder gThreadCacheHolder;
+
+ThreadCache *GetThreadCache()
+{
+    // Objects freed by the destructors of other thread locals go straight to the depot.
+    if (ANGLE_UNLIKELY(gThreadCacheHolder.cache == nullptr))
+    {
+        if (gThreadCacheHolder.destroyed)
+        {
+            return nullptr;
+        }
+        gThreadCacheHolder.cache = new ThreadCache;
+    }
+    return gThreadCacheHolder.cache;
+}
+#    endif
+}  // anonymous namespace
+#endif  // !defined(ANGLE_SLAB_ALLOCATOR_USES_GLOBAL_HEAP)
+
+void *SlabAllocate(size_t size)
+{
+#if defined(ANGLE_SLAB_ALLOCATOR_USES_GLOBAL_HEAP)
+    return ::operator new(size);
+#else
+    if (size > kMaxSlabAllocationSize)
+    {
+        return ::operator new(size);
+    }
+
+    size_t sizeClass   = GetSizeClass(size);
+    ThreadCache *cache = GetThreadCache();
+    if (ANGLE_UNLIKELY(cache == nullptr))
+    {
+        return GetDepots()[sizeClass].allocate();
+    }
+
+    Magazine *&loaded = cache->loaded[sizeClass];
+    if (ANGLE_UNLIKELY(loaded == nullptr || loaded->count == 0))
+    {
+        Magazine *&previous = cache->previous[sizeClass];
+        if (previous != nullptr && previous->count > 0)
+        {
+            std::swap(loaded, previous);
+        }
+        else
+        {
+            // Both magazines are empty.  Keep the previous one empty, so that frees that follow
+            // have room.
+            Magazine *full = GetDepots()[sizeClass].exchangeForFull(previous);
+            previous       = loaded;
+            loaded         = full;
+        }
+    }
+
+    return loaded->objects[--loaded->count];
+#endif
+}
+
+void SlabFree(void *ptr, size_t size)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+#if defined(ANGLE_SLAB_ALLOCATOR_USES_GLOBAL_HEAP)
+    ::operator delete(ptr);
+#else
+    if (size > kMaxSlabAllocationSize)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    size_t sizeClass   = GetSizeClass(size);
+    ThreadCache *cache = GetThreadCache();
+    if (ANGLE_UNLIKELY(cache == nullptr))
+    {
+        GetDepots()[sizeClass].free(ptr);
+        return;
+    }
+
+    Magazine *&loaded = cache->loaded[sizeClass];
+    if (ANGLE_UNLIKELY(loaded == nullptr || loaded->count == kMagazineCapacity))
+    {
+        Magazine *&previous = cache->previous[sizeClass];
+        if (previous == nullptr || previous->count < kMagazineCapacity)
+        {
+            std::swap(loaded, previous);
+        }
+        else
+        {
+            // Both magazines are full.  Keep the previous one full, so that allocations that
+            // follow find objects.
+            Magazine *empty = GetDepots()[sizeClass].exchangeForEmpty(previous);
+            previous        = loaded;
+            loaded          = empty;
+        }
+
+        if (loaded == nullptr)
+        {
+            loaded = new Magazine;
+        }
+    }
+
+    loaded->objects[loaded->count++] = ptr;
+#endif
+}
+}  // namespace angle
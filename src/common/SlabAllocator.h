@@ -0,0 +1,50 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SlabAllocator.h:
+//   A thread-safe size class allocator for the objects that are created and destroyed often, such
+//   as buffers and textures.  Objects of a size class are carved out of large slabs, so they don't
+//   fragment the heap of long-running processes.  Each thread caches freed objects in magazines,
+//   so that most allocations and frees take no lock.  The magazines are exchanged with a shared
+//   depot when a thread runs out of objects or frees more than it allocates.
+//
+//   Memory given to a size class is kept for the lifetime of the process, and reused by objects of
+//   the same size class only.  Under the sanitizers, every allocation goes to the global heap so
+//   that use after free and leaks are still caught.
+//
+
+#ifndef COMMON_SLABALLOCATOR_H_
+#define COMMON_SLABALLOCATOR_H_
+
+#include <cstddef>
+#include <new>
+
+namespace angle
+{
+// Objects larger than this are allocated from the global heap.
+constexpr size_t kMaxSlabAllocationSize = 4096;
+// Alignment of all slab allocations.
+constexpr size_t kSlabAllocationAlignment = 16;
+
+void *SlabAllocate(size_t size);
+// The size must be the one the object was allocated with.
+void SlabFree(void *ptr, size_t size);
+
+// Deriving from this class allocates the objects of a class with the slab allocator.  Objects that
+// are deleted through a pointer to a base class must have a virtual destructor, so that the size
+// of the most derived class is given back.
+class SlabAllocated
+{
+  public:
+    static void *operator new(size_t size) { return SlabAllocate(size); }
+    static void operator delete(void *ptr, size_t size) { SlabFree(ptr, size); }
+
+    // Placement new isn't found once operator new is declared in the class.
+    static void *operator new(size_t size, void *ptr) noexcept { return ptr; }
+    static void operator delete(void *ptr, void *place) noexcept {}
+};
+}  // namespace angle
+
+#endif  // COMMON_SLABALLOCATOR_H_
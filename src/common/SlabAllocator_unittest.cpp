@@ -0,0 +1,104 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SlabAllocator_unittest:
+//   Tests of the slab allocator.
+//
+
+#include "common/SlabAllocator.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace angle;
+
+namespace
+{
+struct SlabObject : public SlabAllocated
+{
+    uint8_t bytes[200];
+};
+
+// Tests that allocations of all sizes are aligned, don't overlap and can be written.
+TEST(SlabAllocatorTest, Sizes)
+{
+    for (size_t size : {size_t(1), size_t(16), size_t(17), size_t(512), size_t(513),
+                        kMaxSlabAllocationSize, kMaxSlabAllocationSize + 1})
+    {
+        std::vector<uint8_t *> allocations;
+        for (size_t index = 0; index < 100; ++index)
+        {
+            uint8_t *ptr = static_cast<uint8_t *>(SlabAllocate(size));
+            ASSERT_NE(ptr, nullptr);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % kSlabAllocationAlignment, 0u);
+            memset(ptr, static_cast<int>(index), size);
+            allocations.push_back(ptr);
+        }
+
+        for (size_t index = 0; index < allocations.size(); ++index)
+        {
+            for (size_t byte = 0; byte < size; ++byte)
+            {
+                ASSERT_EQ(allocations[index][byte], static_cast<uint8_t>(index));
+            }
+            SlabFree(allocations[index], size);
+        }
+    }
+}
+
+// Tests that objects deriving from SlabAllocated can be created and destroyed on many threads,
+// including objects freed on another thread than the one that allocated them.
+TEST(SlabAllocatorTest, Threads)
+{
+    constexpr size_t kThreadCount = 8;
+    constexpr size_t kObjectCount = 1000;
+
+    std::vector<std::vector<std::unique_ptr<SlabObject>>> objects(kThreadCount);
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&objects, threadIndex]() {
+            for (size_t index = 0; index < kObjectCount; ++index)
+            {
+                std::unique_ptr<SlabObject> object = std::make_unique<SlabObject>();
+                memset(object->bytes, static_cast<int>(threadIndex), sizeof(object->bytes));
+                objects[threadIndex].push_back(std::move(object));
+            }
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+    threads.clear();
+
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        for (const std::unique_ptr<SlabObject> &object : objects[threadIndex])
+        {
+            for (uint8_t byte : object->bytes)
+            {
+                ASSERT_EQ(byte, static_cast<uint8_t>(threadIndex));
+            }
+        }
+    }
+
+    // Free the objects of each thread on another thread.
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([&objects, threadIndex]() {
+            objects[(threadIndex + 1) % kThreadCount].clear();
+        });
+    }
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+}
+}  // anonymous namespace
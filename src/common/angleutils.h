@@ -14,6 +14,7 @@
 #if defined(ANGLE_USE_ABSEIL)
 #    include "absl/container/flat_hash_map.h"
 #    include "absl/container/flat_hash_set.h"
+#    include "absl/container/node_hash_map.h"
 #endif  // defined(ANGLE_USE_ABSEIL)
 
 #if defined(ANGLE_WITH_LSAN)
@@ -45,11 +46,17 @@ template <typename Key, typename T, class Hash = absl::container_internal::hash_
 using HashMap = absl::flat_hash_map<Key, T, Hash>;
 template <typename Key, class Hash = absl::container_internal::hash_default_hash<Key>>
 using HashSet = absl::flat_hash_set<Key, Hash>;
+// Like HashMap, but the elements are not moved when the table grows, so pointers to them stay
+// valid.  The lookups still probe the flat table of hashes, and only dereference the candidates.
+template <typename Key, typename T, class Hash = absl::container_internal::hash_default_hash<Key>>
+using NodeHashMap = absl::node_hash_map<Key, T, Hash>;
 #else
 template <typename Key, typename T, class Hash = std::hash<Key>>
 using HashMap = std::unordered_map<Key, T, Hash>;
 template <typename Key, class Hash = std::hash<Key>>
 using HashSet = std::unordered_set<Key, Hash>;
+template <typename Key, typename T, class Hash = std::hash<Key>>
+using NodeHashMap = std::unordered_map<Key, T, Hash>;
 #endif  // defined(ANGLE_USE_ABSEIL)
 
 class NonCopyable
@@ -136,6 +143,7 @@ struct PerfMonitorTriplet
     FN(vkQueueSubmitCallsTotal)                    \
     FN(vkQueueSubmitCallsPerFrame)                 \
     FN(renderPasses)                               \
+    FN(resumedRenderPasses)                        \
     FN(writeDescriptorSets)                        \
     FN(flushedOutsideRenderPassCommandBuffers)     \
     FN(swapchainResolveInSubpass)                  \
@@ -170,9 +178,12 @@ struct PerfMonitorTriplet
     FN(pipelineCreationCacheMisses)                \
     FN(pipelineCreationTotalCacheHitsDurationNs)   \
     FN(pipelineCreationTotalCacheMissesDurationNs) \
+    FN(graphicsPipelineCacheMissesPerFrame)        \
+    FN(graphicsPipelineCacheStallsPerFrame)        \
     FN(descriptorSetAllocations)                   \
     FN(descriptorSetCacheTotalSize)                \
     FN(descriptorSetCacheKeySizeBytes)             \
+    FN(descriptorPoolCount)                        \
     FN(uniformsAndXfbDescriptorSetCacheHits)       \
     FN(uniformsAndXfbDescriptorSetCacheMisses)     \
     FN(uniformsAndXfbDescriptorSetCacheTotalSize)  \
@@ -183,10 +194,16 @@ struct PerfMonitorTriplet
     FN(shaderResourcesDescriptorSetCacheMisses)    \
     FN(shaderResourcesDescriptorSetCacheTotalSize) \
     FN(buffersGhosted)                             \
+    FN(bufferDirectUpdates)                        \
+    FN(bufferStagedUpdates)                        \
+    FN(bufferAcquireAndUpdates)                    \
     FN(vertexArraySyncStateCalls)                  \
     FN(allocateNewBufferBlockCalls)                \
     FN(dynamicBufferAllocations)                   \
-    FN(framebufferCacheSize)
+    FN(framebufferCacheSize)                       \
+    FN(commandProcessorSubmitLatencyP50Ns)         \
+    FN(commandProcessorSubmitLatencyP90Ns)         \
+    FN(commandProcessorSubmitLatencyP99Ns)
 
 #define ANGLE_DECLARE_PERF_COUNTER(COUNTER) uint64_t COUNTER;
 
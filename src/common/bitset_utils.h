@@ -162,6 +162,11 @@ class BitSetT final
     constexpr ParamT first() const;
     constexpr ParamT last() const;
 
+    // Writes the indices of the set bits to |indicesOut| in increasing order, and returns how many
+    // were written.  |indicesOut| must have room for count() indices.  This is cheaper than the
+    // iterator for loops that don't change the bits while iterating.
+    std::size_t gatherSetBits(ParamT *indicesOut) const;
+
     // Produces a mask of ones up to the "x"th bit.
     constexpr static BitsT Mask(std::size_t x) { return BitMask<BitsT>(static_cast<ParamT>(x)); }
 
@@ -400,6 +405,17 @@ constexpr ParamT BitSetT<N, BitsT, ParamT>::last() const
     return static_cast<ParamT>(gl::ScanReverse(mBits));
 }
 
+template <size_t N, typename BitsT, typename ParamT>
+ANGLE_INLINE std::size_t BitSetT<N, BitsT, ParamT>::gatherSetBits(ParamT *indicesOut) const
+{
+    std::size_t count = 0;
+    for (BitsT bits = mBits; bits != 0; bits &= bits - 1)
+    {
+        indicesOut[count++] = static_cast<ParamT>(gl::ScanForward(bits));
+    }
+    return count;
+}
+
 template <size_t N, typename BitsT, typename ParamT>
 BitSetT<N, BitsT, ParamT>::Iterator::Iterator(const BitSetT &bits) : mBitsCopy(bits), mCurrentBit(0)
 {
@@ -414,7 +430,9 @@ ANGLE_INLINE typename BitSetT<N, BitsT, ParamT>::Iterator &
 BitSetT<N, BitsT, ParamT>::Iterator::operator++()
 {
     ASSERT(mBitsCopy.any());
-    mBitsCopy.reset(static_cast<ParamT>(mCurrentBit));
+    ASSERT(gl::ScanForward(mBitsCopy.mBits) == mCurrentBit);
+    // The current bit is always the lowest set bit, which is cleared without building its mask.
+    mBitsCopy.mBits &= mBitsCopy.mBits - 1;
     mCurrentBit = getNextBit();
     return *this;
 }
@@ -683,6 +701,9 @@ class BitSetArray final
     constexpr param_type first() const;
     constexpr param_type last() const;
 
+    // See BitSetT::gatherSetBits.  Words with no bits set are skipped.
+    std::size_t gatherSetBits(param_type *indicesOut) const;
+
     constexpr value_type bits(size_t index) const;
 
   private:
@@ -1054,6 +1075,21 @@ constexpr typename BitSetArray<N>::param_type BitSetArray<N>::last() const
     return 0;
 }
 
+template <std::size_t N>
+std::size_t BitSetArray<N>::gatherSetBits(param_type *indicesOut) const
+{
+    std::size_t count = 0;
+    for (size_t arrayIndex = 0; arrayIndex < kArraySize; ++arrayIndex)
+    {
+        const param_type offset = arrayIndex * priv::kDefaultBitSetSize;
+        for (value_type bits = mBaseBitSetArray[arrayIndex].bits(); bits != 0; bits &= bits - 1)
+        {
+            indicesOut[count++] = offset + gl::ScanForward(bits);
+        }
+    }
+    return count;
+}
+
 template <std::size_t N>
 constexpr typename BitSetArray<N>::value_type BitSetArray<N>::bits(size_t index) const
 {
@@ -8,6 +8,7 @@
 //
 
 #include <array>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -241,6 +242,28 @@ TYPED_TEST(BitSetIteratorTest, IterationOrder)
     EXPECT_EQ(fetchOrder.size(), mStateBits.count());
 }
 
+// Tests that gathering the set bits matches the iteration order.
+TYPED_TEST(BitSetIteratorTest, GatherSetBits)
+{
+    TypeParam mStateBits                    = this->mStateBits;
+    const std::array<size_t, 8> writeOrder  = {20, 25, 16, 31, 10, 14, 36, 19};
+    const std::array<size_t, 8> gatherOrder = {10, 14, 16, 19, 20, 25, 31, 36};
+
+    std::array<size_t, 40> indices;
+    EXPECT_EQ(mStateBits.gatherSetBits(indices.data()), 0u);
+
+    for (size_t value : writeOrder)
+    {
+        mStateBits.set(value);
+    }
+
+    ASSERT_EQ(mStateBits.gatherSetBits(indices.data()), gatherOrder.size());
+    for (size_t i = 0; i < gatherOrder.size(); ++i)
+    {
+        EXPECT_EQ(gatherOrder[i], indices[i]);
+    }
+}
+
 // Test an empty iterator.
 TYPED_TEST(BitSetIteratorTest, EmptySet)
 {
@@ -630,6 +653,34 @@ TYPED_TEST(BitSetArrayTest, IterationWithGaps)
     mBits.reset();
 }
 
+// Tests that gathering the set bits skips the gaps and matches the iteration order.
+TYPED_TEST(BitSetArrayTest, GatherSetBits)
+{
+    TypeParam &mBits = this->mBitSet;
+
+    std::vector<size_t> indices(mBits.size());
+    EXPECT_EQ(mBits.gatherSetBits(indices.data()), 0u);
+
+    const std::vector<size_t> bitsToBeSet = {0, 1, mBits.size() / 2, mBits.size() - 1};
+    for (size_t bit : bitsToBeSet)
+    {
+        mBits.set(bit);
+    }
+
+    ASSERT_EQ(mBits.gatherSetBits(indices.data()), bitsToBeSet.size());
+    indices.resize(bitsToBeSet.size());
+    EXPECT_EQ(bitsToBeSet, indices);
+
+    mBits.set();
+    indices.resize(mBits.size());
+    ASSERT_EQ(mBits.gatherSetBits(indices.data()), mBits.size());
+    for (size_t i = 0; i < mBits.size(); ++i)
+    {
+        EXPECT_EQ(indices[i], i);
+    }
+    mBits.reset();
+}
+
 // Unit test for angle::Bit
 TEST(Bit, Test)
 {
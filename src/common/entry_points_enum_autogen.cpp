@@ -486,6 +486,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glAttachShader";
         case EntryPoint::GLBegin:
             return "glBegin";
+        case EntryPoint::GLBeginCommandStreamANGLE:
+            return "glBeginCommandStreamANGLE";
         case EntryPoint::GLBeginConditionalRender:
             return "glBeginConditionalRender";
         case EntryPoint::GLBeginPerfMonitorAMD:
@@ -616,6 +618,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glBufferStorageMemEXT";
         case EntryPoint::GLBufferSubData:
             return "glBufferSubData";
+        case EntryPoint::GLCallCommandStreamANGLE:
+            return "glCallCommandStreamANGLE";
         case EntryPoint::GLCallList:
             return "glCallList";
         case EntryPoint::GLCallLists:
@@ -894,6 +898,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glDebugMessageInsertKHR";
         case EntryPoint::GLDeleteBuffers:
             return "glDeleteBuffers";
+        case EntryPoint::GLDeleteCommandStreamANGLE:
+            return "glDeleteCommandStreamANGLE";
         case EntryPoint::GLDeleteFencesNV:
             return "glDeleteFencesNV";
         case EntryPoint::GLDeleteFramebuffers:
@@ -1086,6 +1092,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glEnableiOES";
         case EntryPoint::GLEnd:
             return "glEnd";
+        case EntryPoint::GLEndCommandStreamANGLE:
+            return "glEndCommandStreamANGLE";
         case EntryPoint::GLEndConditionalRender:
             return "glEndConditionalRender";
         case EntryPoint::GLEndList:
@@ -3340,6 +3348,8 @@ const char *GetEntryPointName(EntryPoint ep)
             return "glWaitSemaphoreEXT";
         case EntryPoint::GLWaitSync:
             return "glWaitSync";
+        case EntryPoint::GLWarmUpDrawANGLE:
+            return "glWarmUpDrawANGLE";
         case EntryPoint::GLWeightPointerOES:
             return "glWeightPointerOES";
         case EntryPoint::GLWindowPos2d:
@@ -249,6 +249,7 @@ enum class EntryPoint
     GLArrayElement,
     GLAttachShader,
     GLBegin,
+    GLBeginCommandStreamANGLE,
     GLBeginConditionalRender,
     GLBeginPerfMonitorAMD,
     GLBeginQuery,
@@ -314,6 +315,7 @@ enum class EntryPoint
     GLBufferStorageExternalEXT,
     GLBufferStorageMemEXT,
     GLBufferSubData,
+    GLCallCommandStreamANGLE,
     GLCallList,
     GLCallLists,
     GLCheckFramebufferStatus,
@@ -453,6 +455,7 @@ enum class EntryPoint
     GLDebugMessageInsert,
     GLDebugMessageInsertKHR,
     GLDeleteBuffers,
+    GLDeleteCommandStreamANGLE,
     GLDeleteFencesNV,
     GLDeleteFramebuffers,
     GLDeleteFramebuffersOES,
@@ -549,6 +552,7 @@ enum class EntryPoint
     GLEnableiEXT,
     GLEnableiOES,
     GLEnd,
+    GLEndCommandStreamANGLE,
     GLEndConditionalRender,
     GLEndList,
     GLEndPerfMonitorAMD,
@@ -1676,6 +1680,7 @@ enum class EntryPoint
     GLViewportIndexedfv,
     GLWaitSemaphoreEXT,
     GLWaitSync,
+    GLWarmUpDrawANGLE,
     GLWeightPointerOES,
     GLWindowPos2d,
     GLWindowPos2dv,
@@ -34,6 +34,22 @@ std::size_t ComputeGenericHash(const T &key)
     static_assert(sizeof(key) % 4 == 0, "ComputeGenericHash requires aligned types");
     return ComputeGenericHash(&key, sizeof(key));
 }
+
+// Hashes a word of a key with its position in the key.  The hash of the key is the sum of the
+// hashes of its words, so that it can be updated as words change instead of hashing the whole key
+// again.  Zero words hash to zero, so that keys that grow with zeros keep their hash.
+inline uint64_t ComputeWordHashForSum(uint64_t word, size_t position)
+{
+    // Multiplying by an odd number that depends on the position, and then applying the finalizer
+    // of MurmurHash3, both map zero to zero.
+    uint64_t hash = word * ((static_cast<uint64_t>(position) << 1 | 1) * 0x9E3779B97F4A7C15ull);
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDull;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
 }  // namespace angle
 
 #endif  // COMMON_HASHUTILS_H_
@@ -28,4 +28,28 @@ TEST(HashUtilsTest, ComputeGenericHash)
 
     EXPECT_NE(aHash, bHash);
 }
+
+// Tests that the word hashes sum to a hash that can be updated as words change.
+TEST(HashUtilsTest, ComputeWordHashForSum)
+{
+    constexpr uint64_t kWords[] = {0x12345678, 0, 0xFFFFFFFF00000000ull, 0x12345678};
+
+    uint64_t hash = 0;
+    for (size_t position = 0; position < 4; ++position)
+    {
+        hash += ComputeWordHashForSum(kWords[position], position);
+    }
+
+    // The same word hashes differently at different positions.
+    EXPECT_NE(ComputeWordHashForSum(kWords[0], 0), ComputeWordHashForSum(kWords[3], 3));
+    EXPECT_EQ(ComputeWordHashForSum(0, 1), 0u);
+
+    // Updating a word updates the hash like hashing the updated key.
+    uint64_t updatedHash = hash - ComputeWordHashForSum(kWords[2], 2) + ComputeWordHashForSum(7, 2);
+    uint64_t expectedHash = ComputeWordHashForSum(kWords[0], 0) +
+                            ComputeWordHashForSum(kWords[1], 1) + ComputeWordHashForSum(7, 2) +
+                            ComputeWordHashForSum(kWords[3], 3);
+    EXPECT_EQ(updatedHash, expectedHash);
+    EXPECT_NE(updatedHash, hash);
+}
 }  // anonymous namespace
@@ -0,0 +1,180 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// hot_trace.cpp:
+//   Implements the ring buffer recorder of the hot trace events.
+//
+
+#include "common/hot_trace.h"
+
+#include <algorithm>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "common/debug.h"
+#include "common/string_utils.h"
+#include "common/system_utils.h"
+
+namespace angle
+{
+namespace priv
+{
+std::atomic<bool> gHotTraceCategoryEnabled[kHotTraceCategoryCount];
+}  // namespace priv
+
+namespace
+{
+constexpr char kCategoriesEnvironmentVar[] = "ANGLE_HOT_TRACE_CATEGORIES";
+constexpr char kCategoriesPropertyName[]   = "debug.angle.hot_trace.categories";
+constexpr char kFileEnvironmentVar[]       = "ANGLE_HOT_TRACE_FILE";
+constexpr char kFilePropertyName[]         = "debug.angle.hot_trace.file";
+// 1.5MB with 24 byte events, which holds about a second of draws of a heavy application.
+constexpr size_t kRingBufferEventCount     = 1 << 16;
+
+constexpr const char *kCategoryNames[] = {
+    "draw",
+    "dispatch",
+    "flush",
+};
+static_assert(ArraySize(kCategoryNames) == kHotTraceCategoryCount, "Update kCategoryNames");
+
+struct HotTraceEvent
+{
+    double timestampSeconds;
+    const char *name;
+    uint32_t threadId;
+    HotTraceCategory category;
+    char phase;
+};
+
+// Allocated when a category is first enabled, and never freed since other threads may be
+// recording.
+std::atomic<HotTraceEvent *> gRingBuffer;
+std::atomic<uint64_t> gNextEventIndex;
+
+std::mutex &GetRingBufferMutex()
+{
+    static std::mutex *ringBufferMutex = new std::mutex;
+    return *ringBufferMutex;
+}
+}  // anonymous namespace
+
+void InitializeHotTrace()
+{
+    std::vector<std::string> categories = GetStringsFromEnvironmentVarOrAndroidProperty(
+        kCategoriesEnvironmentVar, kCategoriesPropertyName, ",");
+    for (const std::string &categoryName : categories)
+    {
+        bool found = false;
+        for (size_t category = 0; category < kHotTraceCategoryCount; ++category)
+        {
+            if (categoryName == "all" || categoryName == kCategoryNames[category])
+            {
+                SetHotTraceCategoryEnabled(static_cast<HotTraceCategory>(category), true);
+                found = true;
+            }
+        }
+
+        if (!found)
+        {
+            WARN() << "Unknown hot trace category: " << categoryName;
+        }
+    }
+}
+
+void SetHotTraceCategoryEnabled(HotTraceCategory category, bool enabled)
+{
+    if (enabled && gRingBuffer.load(std::memory_order_acquire) == nullptr)
+    {
+        std::lock_guard<std::mutex> lock(GetRingBufferMutex());
+        if (gRingBuffer.load(std::memory_order_relaxed) == nullptr)
+        {
+            gRingBuffer.store(new HotTraceEvent[kRingBufferEventCount](),
+                              std::memory_order_release);
+        }
+    }
+
+    priv::gHotTraceCategoryEnabled[static_cast<size_t>(category)].store(enabled,
+                                                                        std::memory_order_relaxed);
+}
+
+void RecordHotTraceEvent(HotTraceCategory category, char phase, const char *name)
+{
+    HotTraceEvent *ringBuffer = gRingBuffer.load(std::memory_order_acquire);
+    if (ringBuffer == nullptr)
+    {
+        return;
+    }
+
+    uint32_t threadId =
+        static_cast<uint32_t>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    uint64_t eventIndex  = gNextEventIndex.fetch_add(1, std::memory_order_relaxed);
+    HotTraceEvent &event = ringBuffer[eventIndex % kRingBufferEventCount];
+
+    event.timestampSeconds = GetCurrentSystemTime();
+    event.name             = name;
+    event.threadId         = threadId;
+    event.category         = category;
+    event.phase            = phase;
+}
+
+void WriteHotTraceEvents()
+{
+    std::string fileName =
+        GetEnvironmentVarOrUnCachedAndroidProperty(kFileEnvironmentVar, kFilePropertyName);
+    if (!fileName.empty())
+    {
+        WriteHotTraceEvents(fileName.c_str());
+    }
+}
+
+bool WriteHotTraceEvents(const char *fileName)
+{
+    HotTraceEvent *ringBuffer = gRingBuffer.load(std::memory_order_acquire);
+    if (ringBuffer == nullptr)
+    {
+        return true;
+    }
+
+    std::ofstream outFile(fileName);
+    if (!outFile)
+    {
+        WARN() << "Could not open " << fileName << " to write the hot trace events.";
+        return false;
+    }
+
+    // Once the ring buffer wrapped around, the oldest events are those after the next one.
+    uint64_t endIndex   = gNextEventIndex.load(std::memory_order_relaxed);
+    uint64_t eventCount = std::min<uint64_t>(endIndex, kRingBufferEventCount);
+
+    outFile << "{\"traceEvents\":[";
+    const char *separator = "\n";
+    for (uint64_t eventIndex = endIndex - eventCount; eventIndex < endIndex; ++eventIndex)
+    {
+        const HotTraceEvent &event = ringBuffer[eventIndex % kRingBufferEventCount];
+        if (event.name == nullptr)
+        {
+            continue;
+        }
+
+        // The names are string literals of ANGLE, so they don't need escaping.
+        outFile << separator << "{\"name\":\"" << event.name << "\",\"cat\":\""
+                << kCategoryNames[static_cast<size_t>(event.category)] << "\",\"ph\":\""
+                << event.phase << "\",\"ts\":" << std::fixed << event.timestampSeconds * 1e6
+                << ",\"pid\":0,\"tid\":" << event.threadId;
+        if (event.phase == 'I')
+        {
+            outFile << ",\"s\":\"t\"";
+        }
+        outFile << "}";
+        separator = ",\n";
+    }
+    outFile << "\n]}\n";
+
+    return true;
+}
+}  // namespace angle
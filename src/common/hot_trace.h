@@ -0,0 +1,116 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// hot_trace.h:
+//   Trace events cheap enough for the hot paths of ANGLE, such as every draw call.  Unlike the
+//   events of trace_event.h, they are not sent to the platform.  They are recorded in a ring buffer
+//   owned by ANGLE, that is written out as a Chrome trace when the display terminates.
+//
+//   The categories are enabled with the ANGLE_HOT_TRACE_CATEGORIES environment variable, or the
+//   debug.angle.hot_trace.categories Android property, as a comma separated list of category names
+//   or "all".  They are read when a display initializes.  The trace is written to the file named by
+//   ANGLE_HOT_TRACE_FILE or debug.angle.hot_trace.file.
+//
+
+#ifndef COMMON_HOT_TRACE_H_
+#define COMMON_HOT_TRACE_H_
+
+#include <atomic>
+#include <cstdint>
+
+#include "common/angleutils.h"
+#include "common/platform.h"
+
+namespace angle
+{
+enum class HotTraceCategory : uint8_t
+{
+    Draw,
+    Dispatch,
+    Flush,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+constexpr size_t kHotTraceCategoryCount = static_cast<size_t>(HotTraceCategory::EnumCount);
+
+namespace priv
+{
+// Zero initialized, so that nothing but a load is done while the categories are disabled.
+extern std::atomic<bool> gHotTraceCategoryEnabled[kHotTraceCategoryCount];
+}  // namespace priv
+
+ANGLE_INLINE bool IsHotTraceCategoryEnabled(HotTraceCategory category)
+{
+    return priv::gHotTraceCategoryEnabled[static_cast<size_t>(category)].load(
+        std::memory_order_relaxed);
+}
+
+// Enables the categories given in the environment.  Categories can't be disabled this way, since
+// another display may have enabled them.
+void InitializeHotTrace();
+void SetHotTraceCategoryEnabled(HotTraceCategory category, bool enabled);
+
+// The name must be a string literal, since only the pointer is recorded.
+void RecordHotTraceEvent(HotTraceCategory category, char phase, const char *name);
+
+// Writes the events in the ring buffer to the file given in the environment, if any.
+void WriteHotTraceEvents();
+// Writes the events in the ring buffer as a Chrome trace, which can be loaded in chrome://tracing
+// or Perfetto.  Events recorded while writing may be torn.  Returns false if the file can't be
+// written.
+bool WriteHotTraceEvents(const char *fileName);
+
+ANGLE_INLINE void RecordHotTraceInstantEvent(HotTraceCategory category, const char *name)
+{
+    if (ANGLE_UNLIKELY(IsHotTraceCategoryEnabled(category)))
+    {
+        RecordHotTraceEvent(category, 'I', name);
+    }
+}
+
+class ScopedHotTraceEvent final : angle::NonCopyable
+{
+  public:
+    ANGLE_INLINE ScopedHotTraceEvent(HotTraceCategory category, const char *name)
+        : mCategory(category), mName(nullptr)
+    {
+        if (ANGLE_UNLIKELY(IsHotTraceCategoryEnabled(category)))
+        {
+            mName = name;
+            RecordHotTraceEvent(category, 'B', name);
+        }
+    }
+
+    ANGLE_INLINE ~ScopedHotTraceEvent()
+    {
+        // The end is recorded even if the category was disabled in between, so that the events
+        // stay balanced.
+        if (ANGLE_UNLIKELY(mName != nullptr))
+        {
+            RecordHotTraceEvent(mCategory, 'E', mName);
+        }
+    }
+
+  private:
+    HotTraceCategory mCategory;
+    const char *mName;
+};
+}  // namespace angle
+
+#define ANGLE_HOT_TRACE_UID3(A, B) A##B
+#define ANGLE_HOT_TRACE_UID2(A, B) ANGLE_HOT_TRACE_UID3(A, B)
+#define ANGLE_HOT_TRACE_UID(NAME) ANGLE_HOT_TRACE_UID2(NAME, __LINE__)
+
+// Records the beginning and the end of the enclosing scope.
+#define ANGLE_HOT_TRACE_EVENT(CATEGORY, NAME)                          \
+    angle::ScopedHotTraceEvent ANGLE_HOT_TRACE_UID(hotTraceEventScope)( \
+        angle::HotTraceCategory::CATEGORY, NAME)
+
+#define ANGLE_HOT_TRACE_EVENT_INSTANT(CATEGORY, NAME) \
+    angle::RecordHotTraceInstantEvent(angle::HotTraceCategory::CATEGORY, NAME)
+
+#endif  // COMMON_HOT_TRACE_H_
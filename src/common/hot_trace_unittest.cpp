@@ -0,0 +1,63 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// hot_trace_unittest:
+//   Tests of the hot trace event recorder.
+//
+
+#include "common/hot_trace.h"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <sstream>
+
+#include "util/test_utils.h"
+
+using namespace angle;
+
+namespace
+{
+std::string ReadFile(const char *fileName)
+{
+    std::ifstream inFile(fileName);
+    std::stringstream contents;
+    contents << inFile.rdbuf();
+    return contents.str();
+}
+
+// Tests that events are only recorded while their category is enabled.
+TEST(HotTraceTest, RecordsEnabledCategories)
+{
+    char fileName[2048];
+    ASSERT_TRUE(CreateTemporaryFile(fileName, sizeof(fileName)));
+
+    SetHotTraceCategoryEnabled(HotTraceCategory::Draw, true);
+    EXPECT_TRUE(IsHotTraceCategoryEnabled(HotTraceCategory::Draw));
+    EXPECT_FALSE(IsHotTraceCategoryEnabled(HotTraceCategory::Dispatch));
+
+    {
+        ANGLE_HOT_TRACE_EVENT(Draw, "HotTraceTestDraw");
+        ANGLE_HOT_TRACE_EVENT(Dispatch, "HotTraceTestDispatch");
+    }
+    ANGLE_HOT_TRACE_EVENT_INSTANT(Draw, "HotTraceTestInstant");
+
+    SetHotTraceCategoryEnabled(HotTraceCategory::Draw, false);
+    EXPECT_FALSE(IsHotTraceCategoryEnabled(HotTraceCategory::Draw));
+    ANGLE_HOT_TRACE_EVENT_INSTANT(Draw, "HotTraceTestDisabled");
+
+    ASSERT_TRUE(WriteHotTraceEvents(fileName));
+    std::string trace = ReadFile(fileName);
+    EXPECT_TRUE(DeleteSystemFile(fileName));
+
+    EXPECT_NE(trace.find("{\"name\":\"HotTraceTestDraw\",\"cat\":\"draw\",\"ph\":\"B\""),
+              std::string::npos);
+    EXPECT_NE(trace.find("{\"name\":\"HotTraceTestDraw\",\"cat\":\"draw\",\"ph\":\"E\""),
+              std::string::npos);
+    EXPECT_NE(trace.find("\"HotTraceTestInstant\""), std::string::npos);
+    EXPECT_EQ(trace.find("\"HotTraceTestDispatch\""), std::string::npos);
+    EXPECT_EQ(trace.find("\"HotTraceTestDisabled\""), std::string::npos);
+}
+}  // anonymous namespace
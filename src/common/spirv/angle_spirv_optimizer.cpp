@@ -0,0 +1,55 @@
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// angle_spirv_optimizer.cpp:
+//   Runs a lightweight set of SPIR-V optimizations through spirv-opt.
+
+#include "common/spirv/angle_spirv_optimizer.h"
+
+#include <spirv-tools/optimizer.hpp>
+
+#include "common/debug.h"
+
+namespace angle
+{
+namespace spirv
+{
+namespace
+{
+void OptimizerMessage(spv_message_level_t level,
+                      const char *source,
+                      const spv_position_t &position,
+                      const char *message)
+{
+    if (level <= SPV_MSG_ERROR)
+    {
+        WARN() << "SPIR-V optimizer error: " << message;
+    }
+}
+}  // anonymous namespace
+
+bool Optimize(const Blob &blob, Blob *optimizedOut)
+{
+    spvtools::Optimizer optimizer(SPV_ENV_VULKAN_1_1);
+    optimizer.SetMessageConsumer(OptimizerMessage);
+
+    // The passes spirv-opt runs with -O that pay off the most for code generated by ANGLE, which
+    // leaves function calls, local variables and constant conditions for the driver to clean up.
+    optimizer.RegisterPass(spvtools::CreateInlineExhaustivePass())
+        .RegisterPass(spvtools::CreateLocalSingleBlockLoadStoreElimPass())
+        .RegisterPass(spvtools::CreateLocalSingleStoreElimPass())
+        .RegisterPass(spvtools::CreateSSARewritePass())
+        .RegisterPass(spvtools::CreateCCPPass())
+        .RegisterPass(spvtools::CreateDeadBranchElimPass())
+        .RegisterPass(spvtools::CreateAggressiveDCEPass());
+
+    // The input is validated when it's generated in debug builds, and the passes above preserve
+    // validity.
+    spvtools::OptimizerOptions options;
+    options.set_run_validator(false);
+
+    return optimizer.Run(blob.data(), blob.size(), optimizedOut, options);
+}
+}  // namespace spirv
+}  // namespace angle
@@ -0,0 +1,25 @@
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// angle_spirv_optimizer.h:
+//   Runs a lightweight set of SPIR-V optimizations through spirv-opt.
+
+#ifndef COMMON_SPIRV_ANGLESPIRVOPTIMIZER_H_
+#define COMMON_SPIRV_ANGLESPIRVOPTIMIZER_H_
+
+#include "common/spirv/spirv_types.h"
+
+namespace angle
+{
+namespace spirv
+{
+// Inlines functions, eliminates loads and stores of function-local variables, propagates
+// constants and removes dead code and branches.  Specialization constants are left as is, as
+// their values are only known when the pipeline is created.  Returns false if the optimizer
+// failed, in which case |optimizedOut| should not be used.
+bool Optimize(const Blob &blob, Blob *optimizedOut);
+}  // namespace spirv
+}  // namespace angle
+
+#endif  // COMMON_SPIRV_ANGLESPIRVOPTIMIZER_H_
@@ -171,6 +171,29 @@ bool UnprotectMemory(uintptr_t start, size_t size);
 
 size_t GetPageSize();
 
+// An advisory lock on a file, which blocks the other processes, or other FileLock objects of the
+// same process, that lock the same file.  Satisfies BasicLockable, so it can be used with
+// std::lock_guard.
+class FileLock final : angle::NonCopyable
+{
+  public:
+    FileLock();
+    ~FileLock();
+
+    // Opens the file at |path| to lock, creating it if needed.
+    bool open(const char *path);
+    void close();
+    bool isOpen() const { return mHandle != kInvalidHandle; }
+
+    // Blocks until the lock is acquired.  Does nothing if the file isn't open.
+    void lock();
+    void unlock();
+
+  private:
+    static constexpr intptr_t kInvalidHandle = -1;
+    intptr_t mHandle;
+};
+
 // Return type of the PageFaultCallback
 enum class PageFaultHandlerRangeType
 {
@@ -13,11 +13,14 @@
 #include <iostream>
 
 #include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <grp.h>
 #include <inttypes.h>
 #include <pwd.h>
 #include <signal.h>
 #include <string.h>
+#include <sys/file.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -437,4 +440,46 @@ uint64_t GetProcessMemoryUsageKB()
 
     return kb;
 }
+
+FileLock::FileLock() : mHandle(kInvalidHandle) {}
+
+FileLock::~FileLock()
+{
+    close();
+}
+
+bool FileLock::open(const char *path)
+{
+    close();
+    mHandle = ::open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    return isOpen();
+}
+
+void FileLock::close()
+{
+    if (isOpen())
+    {
+        ::close(static_cast<int>(mHandle));
+        mHandle = kInvalidHandle;
+    }
+}
+
+void FileLock::lock()
+{
+    if (isOpen())
+    {
+        // Wait again if a signal interrupted the wait.
+        while (flock(static_cast<int>(mHandle), LOCK_EX) != 0 && errno == EINTR)
+        {
+        }
+    }
+}
+
+void FileLock::unlock()
+{
+    if (isOpen())
+    {
+        flock(static_cast<int>(mHandle), LOCK_UN);
+    }
+}
 }  // namespace angle
@@ -232,4 +232,49 @@ uint64_t GetProcessMemoryUsageKB()
                            sizeof(pmc));
     return static_cast<uint64_t>(pmc.PrivateUsage) / 1024ull;
 }
+
+FileLock::FileLock() : mHandle(kInvalidHandle) {}
+
+FileLock::~FileLock()
+{
+    close();
+}
+
+bool FileLock::open(const char *path)
+{
+    close();
+    HANDLE handle = CreateFileW(Widen(path).c_str(), GENERIC_READ | GENERIC_WRITE,
+                                FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    mHandle       = reinterpret_cast<intptr_t>(handle);
+    return handle != INVALID_HANDLE_VALUE;
+}
+
+void FileLock::close()
+{
+    if (isOpen())
+    {
+        CloseHandle(reinterpret_cast<HANDLE>(mHandle));
+        mHandle = kInvalidHandle;
+    }
+}
+
+void FileLock::lock()
+{
+    if (isOpen())
+    {
+        OVERLAPPED overlapped = {};
+        LockFileEx(reinterpret_cast<HANDLE>(mHandle), LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD,
+                   MAXDWORD, &overlapped);
+    }
+}
+
+void FileLock::unlock()
+{
+    if (isOpen())
+    {
+        OVERLAPPED overlapped = {};
+        UnlockFileEx(reinterpret_cast<HANDLE>(mHandle), 0, MAXDWORD, MAXDWORD, &overlapped);
+    }
+}
 }  // namespace angle
@@ -114,4 +114,23 @@ uint64_t GetProcessMemoryUsageKB()
     // Not available on UWP.
     return 0;
 }
+
+FileLock::FileLock() : mHandle(kInvalidHandle) {}
+
+FileLock::~FileLock()
+{
+    close();
+}
+
+bool FileLock::open(const char *path)
+{
+    // Not supported for UWP
+    return false;
+}
+
+void FileLock::close() {}
+
+void FileLock::lock() {}
+
+void FileLock::unlock() {}
 }  // namespace angle
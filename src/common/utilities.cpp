@@ -12,8 +12,17 @@
 #include "common/platform.h"
 #include "common/string_utils.h"
 
+#include <cstring>
 #include <set>
 
+#if defined(ANGLE_USE_SSE) && (defined(__SSE2__) || defined(_M_X64) || \
+                               (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#    define ANGLE_INDEX_RANGE_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_INDEX_RANGE_NEON
+#endif
+
 #if defined(ANGLE_ENABLE_WINDOWS_UWP)
 #    include <windows.applicationmodel.core.h>
 #    include <windows.graphics.display.h>
@@ -24,6 +33,212 @@
 namespace
 {
 
+// Each specialization of IndexRangeOps wraps the SIMD instructions used for one index type.
+template <class IndexType>
+struct IndexRangeOps;
+
+#if defined(ANGLE_INDEX_RANGE_SSE2)
+template <>
+struct IndexRangeOps<GLubyte>
+{
+    static __m128i Bias(__m128i value) { return value; }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epu8(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epu8(a, b); }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi8(a, b); }
+};
+
+// SSE2 only compares 16-bit and 32-bit integers as signed, so the values are biased by flipping
+// their top bit.
+template <>
+struct IndexRangeOps<GLushort>
+{
+    static __m128i Bias(__m128i value)
+    {
+        return _mm_xor_si128(value, _mm_set1_epi16(static_cast<int16_t>(0x8000)));
+    }
+    static __m128i Min(__m128i a, __m128i b) { return _mm_min_epi16(a, b); }
+    static __m128i Max(__m128i a, __m128i b) { return _mm_max_epi16(a, b); }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi16(a, b); }
+};
+
+template <>
+struct IndexRangeOps<GLuint>
+{
+    static __m128i Bias(__m128i value)
+    {
+        return _mm_xor_si128(value, _mm_set1_epi32(static_cast<int32_t>(0x80000000)));
+    }
+    static __m128i Min(__m128i a, __m128i b)
+    {
+        __m128i aIsGreater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(aIsGreater, b), _mm_andnot_si128(aIsGreater, a));
+    }
+    static __m128i Max(__m128i a, __m128i b)
+    {
+        __m128i aIsGreater = _mm_cmpgt_epi32(a, b);
+        return _mm_or_si128(_mm_and_si128(aIsGreater, a), _mm_andnot_si128(aIsGreater, b));
+    }
+    static __m128i Equal(__m128i a, __m128i b) { return _mm_cmpeq_epi32(a, b); }
+};
+
+// Computes the range of as many indices as fill whole SIMD registers, and returns how many that
+// is.  The primitive restart index is the largest value of its type, so it only needs to be
+// excluded from the maximum.
+template <class IndexType>
+size_t ComputeIndexRangeSIMD(const IndexType *indices,
+                             size_t count,
+                             bool primitiveRestartEnabled,
+                             IndexType *minIndexInOut,
+                             IndexType *maxIndexInOut,
+                             size_t *primitiveRestartIndicesInOut)
+{
+    using Ops                   = IndexRangeOps<IndexType>;
+    constexpr size_t kLaneCount = sizeof(__m128i) / sizeof(IndexType);
+    const size_t simdCount      = count - (count % kLaneCount);
+    if (simdCount == 0)
+    {
+        return 0;
+    }
+
+    const __m128i allOnes    = _mm_set1_epi32(-1);
+    const __m128i biasedZero = Ops::Bias(_mm_setzero_si128());
+    __m128i minValues        = Ops::Bias(allOnes);
+    __m128i maxValues        = biasedZero;
+    size_t restartByteCount  = 0;
+
+    for (size_t i = 0; i < simdCount; i += kLaneCount)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(indices + i));
+        __m128i biased = Ops::Bias(values);
+        minValues      = Ops::Min(minValues, biased);
+
+        if (primitiveRestartEnabled)
+        {
+            __m128i isRestart = Ops::Equal(values, allOnes);
+            restartByteCount += gl::BitCount(static_cast<uint32_t>(_mm_movemask_epi8(isRestart)));
+            biased = _mm_or_si128(_mm_andnot_si128(isRestart, biased),
+                                  _mm_and_si128(isRestart, biasedZero));
+        }
+        maxValues = Ops::Max(maxValues, biased);
+    }
+
+    alignas(16) IndexType minLanes[kLaneCount];
+    alignas(16) IndexType maxLanes[kLaneCount];
+    _mm_store_si128(reinterpret_cast<__m128i *>(minLanes), Ops::Bias(minValues));
+    _mm_store_si128(reinterpret_cast<__m128i *>(maxLanes), Ops::Bias(maxValues));
+
+    for (size_t lane = 0; lane < kLaneCount; ++lane)
+    {
+        *minIndexInOut = std::min(*minIndexInOut, minLanes[lane]);
+        *maxIndexInOut = std::max(*maxIndexInOut, maxLanes[lane]);
+    }
+    *primitiveRestartIndicesInOut += restartByteCount / sizeof(IndexType);
+
+    return simdCount;
+}
+#elif defined(ANGLE_INDEX_RANGE_NEON)
+template <>
+struct IndexRangeOps<GLubyte>
+{
+    using Vector = uint8x16_t;
+    static Vector Load(const GLubyte *indices) { return vld1q_u8(indices); }
+    static Vector Splat(GLubyte value) { return vdupq_n_u8(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u8(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u8(a, b); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u8(a, b); }
+    static Vector Clear(Vector value, Vector mask) { return vbicq_u8(value, mask); }
+    static size_t CountSet(Vector mask) { return vaddvq_u8(vshrq_n_u8(mask, 7)); }
+    static GLubyte MinAcross(Vector value) { return vminvq_u8(value); }
+    static GLubyte MaxAcross(Vector value) { return vmaxvq_u8(value); }
+};
+
+template <>
+struct IndexRangeOps<GLushort>
+{
+    using Vector = uint16x8_t;
+    static Vector Load(const GLushort *indices) { return vld1q_u16(indices); }
+    static Vector Splat(GLushort value) { return vdupq_n_u16(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u16(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u16(a, b); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u16(a, b); }
+    static Vector Clear(Vector value, Vector mask) { return vbicq_u16(value, mask); }
+    static size_t CountSet(Vector mask) { return vaddvq_u16(vshrq_n_u16(mask, 15)); }
+    static GLushort MinAcross(Vector value) { return vminvq_u16(value); }
+    static GLushort MaxAcross(Vector value) { return vmaxvq_u16(value); }
+};
+
+template <>
+struct IndexRangeOps<GLuint>
+{
+    using Vector = uint32x4_t;
+    static Vector Load(const GLuint *indices) { return vld1q_u32(indices); }
+    static Vector Splat(GLuint value) { return vdupq_n_u32(value); }
+    static Vector Min(Vector a, Vector b) { return vminq_u32(a, b); }
+    static Vector Max(Vector a, Vector b) { return vmaxq_u32(a, b); }
+    static Vector Equal(Vector a, Vector b) { return vceqq_u32(a, b); }
+    static Vector Clear(Vector value, Vector mask) { return vbicq_u32(value, mask); }
+    static size_t CountSet(Vector mask) { return vaddvq_u32(vshrq_n_u32(mask, 31)); }
+    static GLuint MinAcross(Vector value) { return vminvq_u32(value); }
+    static GLuint MaxAcross(Vector value) { return vmaxvq_u32(value); }
+};
+
+// Computes the range of as many indices as fill whole SIMD registers, and returns how many that
+// is.  The primitive restart index is the largest value of its type, so it only needs to be
+// excluded from the maximum.
+template <class IndexType>
+size_t ComputeIndexRangeSIMD(const IndexType *indices,
+                             size_t count,
+                             bool primitiveRestartEnabled,
+                             IndexType *minIndexInOut,
+                             IndexType *maxIndexInOut,
+                             size_t *primitiveRestartIndicesInOut)
+{
+    using Ops                   = IndexRangeOps<IndexType>;
+    constexpr size_t kLaneCount = 16 / sizeof(IndexType);
+    const size_t simdCount      = count - (count % kLaneCount);
+    if (simdCount == 0)
+    {
+        return 0;
+    }
+
+    const typename Ops::Vector allOnes = Ops::Splat(std::numeric_limits<IndexType>::max());
+    typename Ops::Vector minValues     = allOnes;
+    typename Ops::Vector maxValues     = Ops::Splat(0);
+    size_t restartCount                = 0;
+
+    for (size_t i = 0; i < simdCount; i += kLaneCount)
+    {
+        typename Ops::Vector values = Ops::Load(indices + i);
+        minValues                   = Ops::Min(minValues, values);
+
+        if (primitiveRestartEnabled)
+        {
+            typename Ops::Vector isRestart = Ops::Equal(values, allOnes);
+            restartCount += Ops::CountSet(isRestart);
+            values = Ops::Clear(values, isRestart);
+        }
+        maxValues = Ops::Max(maxValues, values);
+    }
+
+    *minIndexInOut = std::min(*minIndexInOut, Ops::MinAcross(minValues));
+    *maxIndexInOut = std::max(*maxIndexInOut, Ops::MaxAcross(maxValues));
+    *primitiveRestartIndicesInOut += restartCount;
+
+    return simdCount;
+}
+#else
+template <class IndexType>
+size_t ComputeIndexRangeSIMD(const IndexType *indices,
+                             size_t count,
+                             bool primitiveRestartEnabled,
+                             IndexType *minIndexInOut,
+                             IndexType *maxIndexInOut,
+                             size_t *primitiveRestartIndicesInOut)
+{
+    return 0;
+}
+#endif
+
 template <class IndexType>
 gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                                       size_t count,
@@ -31,64 +246,151 @@ gl::IndexRange ComputeTypedIndexRange(const IndexType *indices,
                                       GLuint primitiveRestartIndex)
 {
     ASSERT(count > 0);
+    ASSERT(primitiveRestartIndex == std::numeric_limits<IndexType>::max());
 
-    IndexType minIndex                = 0;
-    IndexType maxIndex                = 0;
-    size_t nonPrimitiveRestartIndices = 0;
+    IndexType minIndex             = std::numeric_limits<IndexType>::max();
+    IndexType maxIndex             = 0;
+    size_t primitiveRestartIndices = 0;
 
-    if (primitiveRestartEnabled)
+    size_t i = ComputeIndexRangeSIMD(indices, count, primitiveRestartEnabled, &minIndex, &maxIndex,
+                                     &primitiveRestartIndices);
+    for (; i < count; i++)
     {
-        // Find the first non-primitive restart index to initialize the min and max values
-        size_t i = 0;
-        for (; i < count; i++)
+        if (primitiveRestartEnabled && indices[i] == primitiveRestartIndex)
         {
-            if (indices[i] != primitiveRestartIndex)
-            {
-                minIndex = indices[i];
-                maxIndex = indices[i];
-                nonPrimitiveRestartIndices++;
-                break;
-            }
+            primitiveRestartIndices++;
+            continue;
         }
+        minIndex = std::min(minIndex, indices[i]);
+        maxIndex = std::max(maxIndex, indices[i]);
+    }
+
+    size_t nonPrimitiveRestartIndices = count - primitiveRestartIndices;
+    if (nonPrimitiveRestartIndices == 0)
+    {
+        minIndex = 0;
+        maxIndex = 0;
+    }
+
+    return gl::IndexRange(static_cast<size_t>(minIndex), static_cast<size_t>(maxIndex),
+                          nonPrimitiveRestartIndices);
+}
+
+// Widen as many indices as fill whole SIMD registers, and return how many that is.  The primitive
+// restart index is the largest value of its type, so it's converted by filling the upper half of
+// the widened index with ones: the indices are interleaved with either zeros or the mask of the
+// restart indices.
+#if defined(ANGLE_INDEX_RANGE_SSE2)
+size_t WidenIndicesSIMD(const GLubyte *input,
+                        size_t count,
+                        bool primitiveRestartEnabled,
+                        GLushort *output)
+{
+    const __m128i restartIndex = _mm_set1_epi8(-1);
+    size_t i                   = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+        __m128i upper  = primitiveRestartEnabled ? _mm_cmpeq_epi8(values, restartIndex)
+                                                 : _mm_setzero_si128();
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i), _mm_unpacklo_epi8(values, upper));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i + 8),
+                         _mm_unpackhi_epi8(values, upper));
+    }
+    return i;
+}
+
+size_t WidenIndicesSIMD(const GLushort *input,
+                        size_t count,
+                        bool primitiveRestartEnabled,
+                        GLuint *output)
+{
+    const __m128i restartIndex = _mm_set1_epi16(-1);
+    size_t i                   = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i));
+        __m128i upper  = primitiveRestartEnabled ? _mm_cmpeq_epi16(values, restartIndex)
+                                                 : _mm_setzero_si128();
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i),
+                         _mm_unpacklo_epi16(values, upper));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output + i + 4),
+                         _mm_unpackhi_epi16(values, upper));
+    }
+    return i;
+}
+#elif defined(ANGLE_INDEX_RANGE_NEON)
+size_t WidenIndicesSIMD(const GLubyte *input,
+                        size_t count,
+                        bool primitiveRestartEnabled,
+                        GLushort *output)
+{
+    const uint8x16_t restartIndex = vdupq_n_u8(0xFF);
+    size_t i                      = 0;
+    for (; i + 16 <= count; i += 16)
+    {
+        uint8x16x2_t widened;
+        widened.val[0] = vld1q_u8(input + i);
+        widened.val[1] = primitiveRestartEnabled ? vceqq_u8(widened.val[0], restartIndex)
+                                                 : vdupq_n_u8(0);
+        vst2q_u8(reinterpret_cast<uint8_t *>(output + i), widened);
+    }
+    return i;
+}
+
+size_t WidenIndicesSIMD(const GLushort *input,
+                        size_t count,
+                        bool primitiveRestartEnabled,
+                        GLuint *output)
+{
+    const uint16x8_t restartIndex = vdupq_n_u16(0xFFFF);
+    size_t i                      = 0;
+    for (; i + 8 <= count; i += 8)
+    {
+        uint16x8x2_t widened;
+        widened.val[0] = vld1q_u16(input + i);
+        widened.val[1] = primitiveRestartEnabled ? vceqq_u16(widened.val[0], restartIndex)
+                                                 : vdupq_n_u16(0);
+        vst2q_u16(reinterpret_cast<uint16_t *>(output + i), widened);
+    }
+    return i;
+}
+#else
+template <class SourceType, class DestType>
+size_t WidenIndicesSIMD(const SourceType *input,
+                        size_t count,
+                        bool primitiveRestartEnabled,
+                        DestType *output)
+{
+    return 0;
+}
+#endif
+
+template <class SourceType, class DestType>
+void WidenTypedIndices(const SourceType *input,
+                       size_t count,
+                       bool primitiveRestartEnabled,
+                       DestType *output)
+{
+    constexpr SourceType kSourceRestartIndex = std::numeric_limits<SourceType>::max();
+    constexpr DestType kDestRestartIndex     = std::numeric_limits<DestType>::max();
 
-        // Loop over the rest of the indices
+    size_t i = WidenIndicesSIMD(input, count, primitiveRestartEnabled, output);
+    if (primitiveRestartEnabled)
+    {
         for (; i < count; i++)
         {
-            if (indices[i] != primitiveRestartIndex)
-            {
-                if (minIndex > indices[i])
-                {
-                    minIndex = indices[i];
-                }
-                if (maxIndex < indices[i])
-                {
-                    maxIndex = indices[i];
-                }
-                nonPrimitiveRestartIndices++;
-            }
+            output[i] = input[i] == kSourceRestartIndex ? kDestRestartIndex
+                                                        : static_cast<DestType>(input[i]);
         }
     }
     else
     {
-        minIndex                   = indices[0];
-        maxIndex                   = indices[0];
-        nonPrimitiveRestartIndices = count;
-
-        for (size_t i = 1; i < count; i++)
+        for (; i < count; i++)
         {
-            if (minIndex > indices[i])
-            {
-                minIndex = indices[i];
-            }
-            if (maxIndex < indices[i])
-            {
-                maxIndex = indices[i];
-            }
+            output[i] = static_cast<DestType>(input[i]);
         }
     }
-
-    return gl::IndexRange(static_cast<size_t>(minIndex), static_cast<size_t>(maxIndex),
-                          nonPrimitiveRestartIndices);
 }
 
 }  // anonymous namespace
@@ -719,6 +1021,35 @@ IndexRange ComputeIndexRange(DrawElementsType indexType,
     }
 }
 
+void ConvertIndices(DrawElementsType sourceType,
+                    DrawElementsType destinationType,
+                    const void *input,
+                    size_t count,
+                    void *output,
+                    bool primitiveRestartEnabled)
+{
+    if (sourceType == destinationType)
+    {
+        // The size of an index type is 1 << type.
+        memcpy(output, input, count << static_cast<size_t>(destinationType));
+        return;
+    }
+
+    if (sourceType == DrawElementsType::UnsignedByte)
+    {
+        ASSERT(destinationType == DrawElementsType::UnsignedShort);
+        WidenTypedIndices(static_cast<const GLubyte *>(input), count, primitiveRestartEnabled,
+                          static_cast<GLushort *>(output));
+    }
+    else
+    {
+        ASSERT(sourceType == DrawElementsType::UnsignedShort &&
+               destinationType == DrawElementsType::UnsignedInt);
+        WidenTypedIndices(static_cast<const GLushort *>(input), count, primitiveRestartEnabled,
+                          static_cast<GLuint *>(output));
+    }
+}
+
 GLuint GetPrimitiveRestartIndex(DrawElementsType indexType)
 {
     switch (indexType)
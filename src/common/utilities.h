@@ -83,6 +83,16 @@ IndexRange ComputeIndexRange(DrawElementsType indexType,
 // Get the primitive restart index value for the given index type.
 GLuint GetPrimitiveRestartIndex(DrawElementsType indexType);
 
+// Copy indices, widening them if the destination type is the next larger index type.  If
+// |primitiveRestartEnabled|, the primitive restart index of the source type is converted to that
+// of the destination type.
+void ConvertIndices(DrawElementsType sourceType,
+                    DrawElementsType destinationType,
+                    const void *input,
+                    size_t count,
+                    void *output,
+                    bool primitiveRestartEnabled);
+
 // Get the primitive restart index value with the given C++ type.
 template <typename T>
 constexpr T GetPrimitiveRestartIndexFromType()
@@ -177,4 +177,158 @@ TEST(ParseArrayIndex, ArrayIndexOutOfRange)
     EXPECT_EQ(15u, nameLengthWithoutArrayIndex);
 }
 
+template <typename IndexType>
+gl::IndexRange ComputeReferenceIndexRange(const std::vector<IndexType> &indices,
+                                          size_t offset,
+                                          size_t count,
+                                          bool primitiveRestartEnabled)
+{
+    size_t minIndex         = std::numeric_limits<size_t>::max();
+    size_t maxIndex         = 0;
+    size_t vertexIndexCount = 0;
+    for (size_t i = offset; i < offset + count; ++i)
+    {
+        if (primitiveRestartEnabled && indices[i] == std::numeric_limits<IndexType>::max())
+        {
+            continue;
+        }
+        minIndex = std::min<size_t>(minIndex, indices[i]);
+        maxIndex = std::max<size_t>(maxIndex, indices[i]);
+        vertexIndexCount++;
+    }
+    if (vertexIndexCount == 0)
+    {
+        return gl::IndexRange(0, 0, 0);
+    }
+    return gl::IndexRange(minIndex, maxIndex, vertexIndexCount);
+}
+
+template <typename IndexType>
+void CheckComputeIndexRange(gl::DrawElementsType type)
+{
+    // Cover counts and offsets that don't fill whole SIMD registers, and valid indices that are
+    // larger than the primitive restart index of the smaller types.
+    std::vector<IndexType> indices(300);
+    uint32_t value = 12345;
+    for (IndexType &index : indices)
+    {
+        value = value * 1103515245u + 12345u;
+        index = static_cast<IndexType>(value >> 8);
+    }
+    indices[17]  = std::numeric_limits<IndexType>::max();
+    indices[18]  = 0;
+    indices[100] = std::numeric_limits<IndexType>::max();
+    indices[101] = std::numeric_limits<IndexType>::max() - 1;
+
+    for (size_t offset : {0, 1, 3, 17})
+    {
+        for (size_t count : {1, 2, 7, 16, 33, 64, 200, 283})
+        {
+            for (bool primitiveRestartEnabled : {false, true})
+            {
+                gl::IndexRange expected = ComputeReferenceIndexRange(indices, offset, count,
+                                                                     primitiveRestartEnabled);
+                gl::IndexRange actual   = gl::ComputeIndexRange(type, indices.data() + offset,
+                                                              count, primitiveRestartEnabled);
+                EXPECT_EQ(expected.start, actual.start);
+                EXPECT_EQ(expected.end, actual.end);
+                EXPECT_EQ(expected.vertexIndexCount, actual.vertexIndexCount);
+            }
+        }
+    }
+
+    // Only primitive restart indices.
+    std::vector<IndexType> restartIndices(40, std::numeric_limits<IndexType>::max());
+    gl::IndexRange range =
+        gl::ComputeIndexRange(type, restartIndices.data(), restartIndices.size(), true);
+    EXPECT_EQ(0u, range.start);
+    EXPECT_EQ(0u, range.end);
+    EXPECT_EQ(0u, range.vertexIndexCount);
+
+    range = gl::ComputeIndexRange(type, restartIndices.data(), restartIndices.size(), false);
+    EXPECT_EQ(std::numeric_limits<IndexType>::max(), range.start);
+    EXPECT_EQ(std::numeric_limits<IndexType>::max(), range.end);
+    EXPECT_EQ(restartIndices.size(), range.vertexIndexCount);
+}
+
+// Test the index range of unsigned byte indices.
+TEST(ComputeIndexRange, UnsignedByte)
+{
+    CheckComputeIndexRange<GLubyte>(gl::DrawElementsType::UnsignedByte);
+}
+
+// Test the index range of unsigned short indices.
+TEST(ComputeIndexRange, UnsignedShort)
+{
+    CheckComputeIndexRange<GLushort>(gl::DrawElementsType::UnsignedShort);
+}
+
+// Test the index range of unsigned int indices.
+TEST(ComputeIndexRange, UnsignedInt)
+{
+    CheckComputeIndexRange<GLuint>(gl::DrawElementsType::UnsignedInt);
+}
+
+template <typename SourceType, typename DestType>
+void CheckConvertIndices(gl::DrawElementsType sourceType, gl::DrawElementsType destinationType)
+{
+    std::vector<SourceType> indices(300);
+    uint32_t value = 54321;
+    for (SourceType &index : indices)
+    {
+        value = value * 1103515245u + 12345u;
+        index = static_cast<SourceType>(value >> 8);
+    }
+    indices[5]   = std::numeric_limits<SourceType>::max();
+    indices[6]   = std::numeric_limits<SourceType>::max();
+    indices[40]  = std::numeric_limits<SourceType>::max();
+    indices[41]  = std::numeric_limits<SourceType>::max() - 1;
+    indices[299] = std::numeric_limits<SourceType>::max();
+
+    for (size_t offset : {0, 1, 3, 17})
+    {
+        for (size_t count : {1, 2, 7, 16, 33, 64, 200, 283})
+        {
+            for (bool primitiveRestartEnabled : {false, true})
+            {
+                std::vector<DestType> converted(count);
+                gl::ConvertIndices(sourceType, destinationType, indices.data() + offset, count,
+                                   converted.data(), primitiveRestartEnabled);
+
+                for (size_t i = 0; i < count; i++)
+                {
+                    SourceType index  = indices[offset + i];
+                    DestType expected = static_cast<DestType>(index);
+                    if (primitiveRestartEnabled && index == std::numeric_limits<SourceType>::max())
+                    {
+                        expected = std::numeric_limits<DestType>::max();
+                    }
+                    EXPECT_EQ(expected, converted[i]);
+                }
+            }
+        }
+    }
+}
+
+// Test widening unsigned byte indices to unsigned short.
+TEST(ConvertIndices, UnsignedByteToUnsignedShort)
+{
+    CheckConvertIndices<GLubyte, GLushort>(gl::DrawElementsType::UnsignedByte,
+                                           gl::DrawElementsType::UnsignedShort);
+}
+
+// Test widening unsigned short indices to unsigned int.
+TEST(ConvertIndices, UnsignedShortToUnsignedInt)
+{
+    CheckConvertIndices<GLushort, GLuint>(gl::DrawElementsType::UnsignedShort,
+                                          gl::DrawElementsType::UnsignedInt);
+}
+
+// Test copying indices of the same type.
+TEST(ConvertIndices, SameType)
+{
+    CheckConvertIndices<GLuint, GLuint>(gl::DrawElementsType::UnsignedInt,
+                                        gl::DrawElementsType::UnsignedInt);
+}
+
 }  // anonymous namespace
@@ -46,6 +46,104 @@ typedef struct VkMultisampledRenderToSingleSampledInfoEXT
 } VkMultisampledRenderToSingleSampledInfoEXT;
 #endif /* VK_EXT_multisampled_render_to_single_sampled */
 
+// For VK_EXT_host_image_copy, which is newer than the headers.
+#if !defined(VK_EXT_host_image_copy)
+#    define VK_EXT_host_image_copy 1
+#    define VK_EXT_HOST_IMAGE_COPY_SPEC_VERSION 1
+#    define VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME "VK_EXT_host_image_copy"
+
+#    define VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_FEATURES_EXT \
+        ((VkStructureType)(1000270000))
+#    define VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES_EXT \
+        ((VkStructureType)(1000270001))
+#    define VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY_EXT ((VkStructureType)(1000270002))
+#    define VK_STRUCTURE_TYPE_COPY_MEMORY_TO_IMAGE_INFO_EXT ((VkStructureType)(1000270005))
+#    define VK_STRUCTURE_TYPE_HOST_IMAGE_LAYOUT_TRANSITION_INFO_EXT \
+        ((VkStructureType)(1000270006))
+#    define VK_STRUCTURE_TYPE_HOST_IMAGE_COPY_DEVICE_PERFORMANCE_QUERY_EXT \
+        ((VkStructureType)(1000270009))
+
+#    define VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT ((VkImageUsageFlagBits)(0x00400000))
+
+typedef VkFlags VkHostImageCopyFlagsEXT;
+
+typedef struct VkPhysicalDeviceHostImageCopyFeaturesEXT
+{
+    VkStructureType sType;
+    void *pNext;
+    VkBool32 hostImageCopy;
+} VkPhysicalDeviceHostImageCopyFeaturesEXT;
+
+typedef struct VkPhysicalDeviceHostImageCopyPropertiesEXT
+{
+    VkStructureType sType;
+    void *pNext;
+    uint32_t copySrcLayoutCount;
+    VkImageLayout *pCopySrcLayouts;
+    uint32_t copyDstLayoutCount;
+    VkImageLayout *pCopyDstLayouts;
+    uint8_t optimalTilingLayoutUUID[VK_UUID_SIZE];
+    VkBool32 identicalMemoryTypeRequirements;
+} VkPhysicalDeviceHostImageCopyPropertiesEXT;
+
+typedef struct VkMemoryToImageCopyEXT
+{
+    VkStructureType sType;
+    const void *pNext;
+    const void *pHostPointer;
+    uint32_t memoryRowLength;
+    uint32_t memoryImageHeight;
+    VkImageSubresourceLayers imageSubresource;
+    VkOffset3D imageOffset;
+    VkExtent3D imageExtent;
+} VkMemoryToImageCopyEXT;
+
+typedef struct VkCopyMemoryToImageInfoEXT
+{
+    VkStructureType sType;
+    const void *pNext;
+    VkHostImageCopyFlagsEXT flags;
+    VkImage dstImage;
+    VkImageLayout dstImageLayout;
+    uint32_t regionCount;
+    const VkMemoryToImageCopyEXT *pRegions;
+} VkCopyMemoryToImageInfoEXT;
+
+typedef struct VkHostImageLayoutTransitionInfoEXT
+{
+    VkStructureType sType;
+    const void *pNext;
+    VkImage image;
+    VkImageLayout oldLayout;
+    VkImageLayout newLayout;
+    VkImageSubresourceRange subresourceRange;
+} VkHostImageLayoutTransitionInfoEXT;
+
+typedef struct VkHostImageCopyDevicePerformanceQueryEXT
+{
+    VkStructureType sType;
+    void *pNext;
+    VkBool32 optimalDeviceAccess;
+    VkBool32 identicalMemoryLayout;
+} VkHostImageCopyDevicePerformanceQueryEXT;
+
+typedef VkResult(VKAPI_PTR *PFN_vkCopyMemoryToImageEXT)(
+    VkDevice device,
+    const VkCopyMemoryToImageInfoEXT *pCopyMemoryToImageInfo);
+typedef VkResult(VKAPI_PTR *PFN_vkTransitionImageLayoutEXT)(
+    VkDevice device,
+    uint32_t transitionCount,
+    const VkHostImageLayoutTransitionInfoEXT *pTransitions);
+#endif /* VK_EXT_host_image_copy */
+
+namespace rx
+{
+// VK_EXT_host_image_copy is not loaded by volk, so its entry points are loaded by ANGLE with
+// either loader.
+extern PFN_vkCopyMemoryToImageEXT vkCopyMemoryToImageEXT;
+extern PFN_vkTransitionImageLayoutEXT vkTransitionImageLayoutEXT;
+}  // namespace rx
+
 #if !defined(ANGLE_SHARED_LIBVULKAN)
 
 namespace rx
@@ -153,6 +251,23 @@ extern PFN_vkCmdSetRasterizerDiscardEnableEXT vkCmdSetRasterizerDiscardEnableEXT
 extern PFN_vkGetPhysicalDeviceFragmentShadingRatesKHR vkGetPhysicalDeviceFragmentShadingRatesKHR;
 extern PFN_vkCmdSetFragmentShadingRateKHR vkCmdSetFragmentShadingRateKHR;
 
+// VK_KHR_descriptor_update_template
+extern PFN_vkCreateDescriptorUpdateTemplateKHR vkCreateDescriptorUpdateTemplateKHR;
+extern PFN_vkDestroyDescriptorUpdateTemplateKHR vkDestroyDescriptorUpdateTemplateKHR;
+extern PFN_vkUpdateDescriptorSetWithTemplateKHR vkUpdateDescriptorSetWithTemplateKHR;
+
+// VK_KHR_timeline_semaphore
+extern PFN_vkGetSemaphoreCounterValueKHR vkGetSemaphoreCounterValueKHR;
+extern PFN_vkWaitSemaphoresKHR vkWaitSemaphoresKHR;
+
+// VK_KHR_present_wait
+extern PFN_vkWaitForPresentKHR vkWaitForPresentKHR;
+
+// VK_EXT_calibrated_timestamps
+extern PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT
+    vkGetPhysicalDeviceCalibrateableTimeDomainsEXT;
+extern PFN_vkGetCalibratedTimestampsEXT vkGetCalibratedTimestampsEXT;
+
 }  // namespace rx
 
 #endif  // ANGLE_SHARED_LIBVULKAN
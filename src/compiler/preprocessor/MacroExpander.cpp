@@ -44,13 +44,14 @@ class TokenLexer : public Lexer
         }
         else
         {
-            *token = *mIter++;
+            // Each token is only lexed once, so it can be moved out of the list.
+            *token = std::move(*mIter++);
         }
     }
 
   private:
     TokenVector mTokens;
-    TokenVector::const_iterator mIter;
+    TokenVector::iterator mIter;
 };
 
 }  // anonymous namespace
@@ -93,6 +94,7 @@ MacroExpander::MacroExpander(Lexer *lexer,
       mMacroSet(macroSet),
       mDiagnostics(diagnostics),
       mParseDefined(parseDefined),
+      mHasReserveToken(false),
       mTotalTokensInContexts(0),
       mSettings(settings),
       mDeferReenablingMacros(false)
@@ -105,6 +107,10 @@ MacroExpander::~MacroExpander()
     {
         delete context;
     }
+    for (MacroContext *context : mFreeContexts)
+    {
+        delete context;
+    }
 }
 
 void MacroExpander::lex(Token *token)
@@ -193,10 +199,10 @@ void MacroExpander::lex(Token *token)
 
 void MacroExpander::getToken(Token *token)
 {
-    if (mReserveToken.get())
+    if (mHasReserveToken)
     {
-        *token = *mReserveToken;
-        mReserveToken.reset();
+        *token           = std::move(mReserveToken);
+        mHasReserveToken = false;
         return;
     }
 
@@ -227,8 +233,9 @@ void MacroExpander::ungetToken(const Token &token)
     }
     else
     {
-        ASSERT(!mReserveToken.get());
-        mReserveToken.reset(new Token(token));
+        ASSERT(!mHasReserveToken);
+        mReserveToken    = token;
+        mHasReserveToken = true;
     }
 }
 
@@ -250,16 +257,17 @@ bool MacroExpander::pushMacro(std::shared_ptr<Macro> macro, const Token &identif
     ASSERT(identifier.type == Token::IDENTIFIER);
     ASSERT(identifier.text == macro->name);
 
-    std::vector<Token> replacements;
-    if (!expandMacro(*macro, identifier, &replacements))
+    MacroContext *context = allocateContext();
+    if (!expandMacro(*macro, identifier, &context->replacements))
+    {
+        recycleContext(context);
         return false;
+    }
 
     // Macro is disabled for expansion until it is popped off the stack.
     macro->disabled = true;
 
-    MacroContext *context = new MacroContext;
-    context->macro        = macro;
-    context->replacements.swap(replacements);
+    context->macro = macro;
     mContextStack.push_back(context);
     mTotalTokensInContexts += context->replacements.size();
     return true;
@@ -285,7 +293,27 @@ void MacroExpander::popMacro()
     }
     context->macro->expansionCount--;
     mTotalTokensInContexts -= context->replacements.size();
-    delete context;
+    recycleContext(context);
+}
+
+MacroExpander::MacroContext *MacroExpander::allocateContext()
+{
+    if (mFreeContexts.empty())
+    {
+        return new MacroContext;
+    }
+
+    MacroContext *context = mFreeContexts.back();
+    mFreeContexts.pop_back();
+    return context;
+}
+
+void MacroExpander::recycleContext(MacroContext *context)
+{
+    context->macro.reset();
+    context->index = 0;
+    context->replacements.clear();
+    mFreeContexts.push_back(context);
 }
 
 bool MacroExpander::expandMacro(const Macro &macro,
@@ -13,6 +13,7 @@
 #include "compiler/preprocessor/Lexer.h"
 #include "compiler/preprocessor/Macro.h"
 #include "compiler/preprocessor/Preprocessor.h"
+#include "compiler/preprocessor/Token.h"
 
 namespace angle
 {
@@ -67,13 +68,20 @@ class MacroExpander : public Lexer
         std::vector<Token> replacements;
     };
 
+    MacroContext *allocateContext();
+    void recycleContext(MacroContext *context);
+
     Lexer *mLexer;
     MacroSet *mMacroSet;
     Diagnostics *mDiagnostics;
     bool mParseDefined;
 
-    std::unique_ptr<Token> mReserveToken;
+    Token mReserveToken;
+    bool mHasReserveToken;
     std::vector<MacroContext *> mContextStack;
+    // Contexts of the macros that were popped.  They are reused, along with the memory of their
+    // replacement lists, by the next expansions.
+    std::vector<MacroContext *> mFreeContexts;
     size_t mTotalTokensInContexts;
 
     PreprocessorSettings mSettings;
@@ -6,6 +6,8 @@
 
 #include "compiler/translator/Compiler.h"
 
+#include <atomic>
+#include <chrono>
 #include <sstream>
 
 #include "angle_gl.h"
@@ -43,6 +45,7 @@
 #include "compiler/translator/tree_ops/SeparateDeclarations.h"
 #include "compiler/translator/tree_ops/SimplifyLoopConditions.h"
 #include "compiler/translator/tree_ops/SplitSequenceOperator.h"
+#include "compiler/translator/tree_ops/UnrollConstantLoops.h"
 #include "compiler/translator/tree_ops/apple/AddAndTrueToLoopCondition.h"
 #include "compiler/translator/tree_ops/apple/RewriteDoWhile.h"
 #include "compiler/translator/tree_ops/apple/UnfoldShortCircuitAST.h"
@@ -52,6 +55,7 @@
 #include "compiler/translator/tree_ops/gl/UseInterfaceBlockFields.h"
 #include "compiler/translator/tree_ops/vulkan/EarlyFragmentTestsOptimization.h"
 #include "compiler/translator/tree_util/BuiltIn.h"
+#include "compiler/translator/tree_util/FindSimplifiableNodes.h"
 #include "compiler/translator/tree_util/IntermNodePatternMatcher.h"
 #include "compiler/translator/tree_util/ReplaceShadowingVariables.h"
 #include "compiler/translator/util.h"
@@ -106,7 +110,7 @@ void DumpFuzzerCase(char const *const *shaderStrings,
                     uint32_t output,
                     uint64_t options)
 {
-    static int fileIndex = 0;
+    static std::atomic<int> fileIndex(0);
 
     std::ostringstream o = sh::InitializeStream<std::ostringstream>();
     o << "corpus/" << fileIndex++ << ".sample";
@@ -205,6 +209,56 @@ int GetMaxUniformVectorsForShaderType(GLenum shaderType, const ShBuiltInResource
 
 namespace
 {
+std::atomic<CompilePhaseCallback> gBeginCompilePhase(nullptr);
+std::atomic<CompilePhaseCallback> gEndCompilePhase(nullptr);
+
+// Marks a phase of the compilation for the callbacks set with SetCompilePhaseCallbacks and, if
+// SH_REPORT_AST_PASS_TIMES is set, appends the time it took to the info log.
+class ANGLE_NO_DISCARD ScopedCompilePhase : angle::NonCopyable
+{
+  public:
+    ScopedCompilePhase(const char *logPrefix,
+                       const char *name,
+                       ShCompileOptions compileOptions,
+                       TInfoSinkBase *infoLog)
+        : mLogPrefix(logPrefix),
+          mName(name),
+          mInfoLog((compileOptions & SH_REPORT_AST_PASS_TIMES) != 0 ? infoLog : nullptr)
+    {
+        CompilePhaseCallback beginPhase = gBeginCompilePhase.load(std::memory_order_relaxed);
+        if (beginPhase != nullptr)
+        {
+            beginPhase(mName);
+        }
+        if (mInfoLog != nullptr)
+        {
+            mStartTime = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedCompilePhase()
+    {
+        if (mInfoLog != nullptr)
+        {
+            const auto duration = std::chrono::steady_clock::now() - mStartTime;
+            *mInfoLog << mLogPrefix << mName << ": "
+                      << std::chrono::duration_cast<std::chrono::microseconds>(duration).count()
+                      << "us\n";
+        }
+
+        CompilePhaseCallback endPhase = gEndCompilePhase.load(std::memory_order_relaxed);
+        if (endPhase != nullptr)
+        {
+            endPhase(mName);
+        }
+    }
+
+  private:
+    const char *mLogPrefix;
+    const char *mName;
+    TInfoSinkBase *mInfoLog;
+    std::chrono::steady_clock::time_point mStartTime;
+};
 
 class ANGLE_NO_DISCARD TScopedPoolAllocator
 {
@@ -389,6 +443,14 @@ bool TCompiler::Init(const ShBuiltInResources &resources)
     return true;
 }
 
+// static
+void TCompiler::SetCompilePhaseCallbacks(CompilePhaseCallback beginPhase,
+                                         CompilePhaseCallback endPhase)
+{
+    gBeginCompilePhase.store(beginPhase, std::memory_order_relaxed);
+    gEndCompilePhase.store(endPhase, std::memory_order_relaxed);
+}
+
 TIntermBlock *TCompiler::compileTreeForTesting(const char *const shaderStrings[],
                                                size_t numStrings,
                                                ShCompileOptions compileOptions)
@@ -454,16 +516,20 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     TScopedSymbolTableLevel globalLevel(&mSymbolTable);
     ASSERT(mSymbolTable.atGlobalLevel());
 
-    // Parse shader.
-    if (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
-                       &parseContext) != 0)
+    // Parse shader.  The preprocessor runs as the parser consumes the tokens, so this includes
+    // preprocessing too.
     {
-        return nullptr;
-    }
+        ScopedCompilePhase phase("Compile phase ", "Parse", compileOptions, &mInfoSink.info);
+        if (PaParseStrings(numStrings - firstSource, &shaderStrings[firstSource], nullptr,
+                           &parseContext) != 0)
+        {
+            return nullptr;
+        }
 
-    if (!postParseChecks(parseContext))
-    {
-        return nullptr;
+        if (!postParseChecks(parseContext))
+        {
+            return nullptr;
+        }
     }
 
     setASTMetadata(parseContext);
@@ -474,6 +540,8 @@ TIntermBlock *TCompiler::compileTreeImpl(const char *const shaderStrings[],
     }
 
     TIntermBlock *root = parseContext.getTreeRoot();
+    ScopedCompilePhase phase("Compile phase ", "CheckAndSimplifyAST", compileOptions,
+                             &mInfoSink.info);
     if (!checkAndSimplifyAST(root, parseContext, compileOptions))
     {
         return nullptr;
@@ -654,6 +722,13 @@ void TCompiler::enableValidateNoMoreTransformations()
     mValidateASTOptions.validateNoMoreTransformations = true;
 }
 
+template <typename PassT>
+bool TCompiler::runASTPass(const char *passName, PassT &&pass)
+{
+    ScopedCompilePhase phase("AST pass ", passName, mCompileOptions, &mInfoSink.info);
+    return pass();
+}
+
 bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
                                     const TParseContext &parseContext,
                                     ShCompileOptions compileOptions)
@@ -690,9 +765,18 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
         return false;
     }
 
+    // Unroll constant loops before folding, which folds the expressions of the loop index in each
+    // iteration.
+    if ((compileOptions & SH_UNROLL_CONSTANT_LOOPS) != 0 &&
+        !runASTPass("UnrollConstantLoops",
+                    [&] { return UnrollConstantLoops(this, root, &getSymbolTable()); }))
+    {
+        return false;
+    }
+
     // Fold expressions that could not be folded before validation that was done as a part of
     // parsing.
-    if (!FoldExpressions(this, root, &mDiagnostics))
+    if (!runASTPass("FoldExpressions", [&] { return FoldExpressions(this, root, &mDiagnostics); }))
     {
         return false;
     }
@@ -713,7 +797,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     //      invalid ESSL.
     //   3. Any unreachable statement after a discard, return, break or continue.
     // After this empty declarations are not allowed in the AST.
-    if (!PruneNoOps(this, root, &mSymbolTable))
+    if (!runASTPass("PruneNoOps", [&] { return PruneNoOps(this, root, &mSymbolTable); }))
     {
         return false;
     }
@@ -775,7 +859,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if (IsSpecWithFunctionBodyNewScope(mShaderSpec, mShaderVersion))
     {
-        if (!ReplaceShadowingVariables(this, root, &mSymbolTable))
+        if (!runASTPass("ReplaceShadowingVariables",
+                        [&] { return ReplaceShadowingVariables(this, root, &mSymbolTable); }))
         {
             return false;
         }
@@ -804,7 +889,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // Clamping uniform array bounds needs to happen after validateLimitations pass.
     if ((compileOptions & SH_CLAMP_INDIRECT_ARRAY_BOUNDS) != 0)
     {
-        if (!ClampIndirectIndices(this, root, &mSymbolTable))
+        if (!runASTPass("ClampIndirectIndices",
+                        [&] { return ClampIndirectIndices(this, root, &mSymbolTable); }))
         {
             return false;
         }
@@ -825,7 +911,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // This pass might emit short circuits so keep it before the short circuit unfolding
     if ((compileOptions & SH_REWRITE_DO_WHILE_LOOPS) != 0)
     {
-        if (!RewriteDoWhile(this, root, &mSymbolTable))
+        if (!runASTPass("RewriteDoWhile",
+                        [&] { return RewriteDoWhile(this, root, &mSymbolTable); }))
         {
             return false;
         }
@@ -833,7 +920,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if ((compileOptions & SH_ADD_AND_TRUE_TO_LOOP_CONDITION) != 0)
     {
-        if (!AddAndTrueToLoopCondition(this, root))
+        if (!runASTPass("AddAndTrueToLoopCondition",
+                        [&] { return AddAndTrueToLoopCondition(this, root); }))
         {
             return false;
         }
@@ -841,7 +929,7 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if ((compileOptions & SH_UNFOLD_SHORT_CIRCUIT) != 0)
     {
-        if (!UnfoldShortCircuitAST(this, root))
+        if (!runASTPass("UnfoldShortCircuitAST", [&] { return UnfoldShortCircuitAST(this, root); }))
         {
             return false;
         }
@@ -849,7 +937,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if ((compileOptions & SH_REGENERATE_STRUCT_NAMES) != 0)
     {
-        if (!RegenerateStructNames(this, root, &mSymbolTable))
+        if (!runASTPass("RegenerateStructNames",
+                        [&] { return RegenerateStructNames(this, root, &mSymbolTable); }))
         {
             return false;
         }
@@ -898,39 +987,59 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
                                  ? IntermNodePatternMatcher::kScalarizedVecOrMatConstructor
                                  : 0;
 
+    // The following passes only operate on a few kinds of nodes which most shaders don't have.
+    // Find them all in a single traversal, and skip the passes that would have nothing to do.
+    // None of the passes below create the kinds of nodes that the passes after them look for.
+    SimplifiableNodes simplifiableNodes;
+    if (!runASTPass("FindSimplifiableNodes", [&] {
+            simplifiableNodes = FindSimplifiableNodes(root);
+            return true;
+        }))
+    {
+        return false;
+    }
+
     // Split multi declarations and remove calls to array length().
     // Note that SimplifyLoopConditions needs to be run before any other AST transformations
     // that may need to generate new statements from loop conditions or loop expressions.
-    if (!SimplifyLoopConditions(this, root,
-                                IntermNodePatternMatcher::kMultiDeclaration |
-                                    IntermNodePatternMatcher::kArrayLengthMethod |
-                                    simplifyScalarized,
-                                &getSymbolTable()))
+    if (simplifiableNodes.loops && !runASTPass("SimplifyLoopConditions", [&] {
+            return SimplifyLoopConditions(this, root,
+                                          IntermNodePatternMatcher::kMultiDeclaration |
+                                              IntermNodePatternMatcher::kArrayLengthMethod |
+                                              simplifyScalarized,
+                                          &getSymbolTable());
+        }))
     {
         return false;
     }
 
     // Note that separate declarations need to be run before other AST transformations that
     // generate new statements from expressions.
-    if (!SeparateDeclarations(this, root, &getSymbolTable()))
+    if (simplifiableNodes.multiDeclarations &&
+        !runASTPass("SeparateDeclarations",
+                    [&] { return SeparateDeclarations(this, root, &getSymbolTable()); }))
     {
         return false;
     }
     mValidateASTOptions.validateMultiDeclarations = true;
 
-    if (!SplitSequenceOperator(this, root,
-                               IntermNodePatternMatcher::kArrayLengthMethod | simplifyScalarized,
-                               &getSymbolTable()))
+    if (simplifiableNodes.sequenceOperators && !runASTPass("SplitSequenceOperator", [&] {
+            return SplitSequenceOperator(
+                this, root, IntermNodePatternMatcher::kArrayLengthMethod | simplifyScalarized,
+                &getSymbolTable());
+        }))
     {
         return false;
     }
 
-    if (!RemoveArrayLengthMethod(this, root))
+    if (simplifiableNodes.arrayLengthMethods &&
+        !runASTPass("RemoveArrayLengthMethod", [&] { return RemoveArrayLengthMethod(this, root); }))
     {
         return false;
     }
 
-    if (!RemoveUnreferencedVariables(this, root, &mSymbolTable))
+    if (!runASTPass("RemoveUnreferencedVariables",
+                    [&] { return RemoveUnreferencedVariables(this, root, &mSymbolTable); }))
     {
         return false;
     }
@@ -941,7 +1050,8 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
     // left switch statements that only contained an empty declaration inside the final case in an
     // invalid state. Relies on that PruneNoOps and RemoveUnreferencedVariables have already been
     // run.
-    if (!PruneEmptyCases(this, root))
+    if (simplifiableNodes.switchStatements &&
+        !runASTPass("PruneEmptyCases", [&] { return PruneEmptyCases(this, root); }))
     {
         return false;
     }
@@ -954,7 +1064,9 @@ bool TCompiler::checkAndSimplifyAST(TIntermBlock *root,
 
     if ((compileOptions & SH_SCALARIZE_VEC_AND_MAT_CONSTRUCTOR_ARGS) != 0)
     {
-        if (!ScalarizeVecAndMatConstructorArgs(this, root, &mSymbolTable))
+        if (!runASTPass("ScalarizeVecAndMatConstructorArgs", [&] {
+                return ScalarizeVecAndMatConstructorArgs(this, root, &mSymbolTable);
+            }))
         {
             return false;
         }
@@ -1168,6 +1280,8 @@ bool TCompiler::compile(const char *const shaderStrings[],
         if ((compileOptions & SH_OBJECT_CODE) != 0)
         {
             PerformanceDiagnostics perfDiagnostics(&mDiagnostics);
+            ScopedCompilePhase phase("Compile phase ", "Translate", compileOptions,
+                                     &mInfoSink.info);
             if (!translate(root, compileOptions, &perfDiagnostics))
             {
                 return false;
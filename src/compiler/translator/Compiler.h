@@ -107,6 +107,12 @@ class TCompiler : public TShHandleBase
                  size_t numStrings,
                  ShCompileOptions compileOptions);
 
+    static void SetCompilePhaseCallbacks(CompilePhaseCallback beginPhase,
+                                         CompilePhaseCallback endPhase);
+
+    // The most memory the compiler's pool allocator has held at once over all compilations.
+    size_t getPeakPoolAllocatorBytes() const { return allocator.getPeakPageBytes(); }
+
     // Get results of the last compilation.
     int getShaderVersion() const { return mShaderVersion; }
     TInfoSink &getInfoSink() { return mInfoSink; }
@@ -293,6 +299,10 @@ class TCompiler : public TShHandleBase
 
     bool postParseChecks(const TParseContext &parseContext);
 
+    // Runs an AST pass as a phase of the compilation, see ScopedCompilePhase.
+    template <typename PassT>
+    bool runASTPass(const char *passName, PassT &&pass);
+
     sh::GLenum mShaderType;
     ShShaderSpec mShaderSpec;
     ShShaderOutput mOutputType;
@@ -991,6 +991,10 @@ void OutputHLSL::header(TInfoSinkBase &out,
                 out << "    uint dx_VertexID : packoffset(c4.y);\n";
             }
 
+            // dx_PointSpriteScale is only used by the point sprites that the D3D11 backend expands
+            // from the vertex ID. D3DCompiler removes it from the other shaders.
+            out << "    float dx_PointSpriteScale : packoffset(c4.z);\n";
+
             out << "};\n"
                    "\n";
         }
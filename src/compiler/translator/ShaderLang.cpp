@@ -11,6 +11,9 @@
 
 #include "GLSLANG/ShaderLang.h"
 
+#include <mutex>
+
+#include "anglebase/no_destructor.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeDll.h"
 #include "compiler/translator/glslang_wrapper.h"
@@ -27,7 +30,16 @@ namespace sh
 namespace
 {
 
-bool isInitialized = false;
+// Initialize() and Finalize() can be called from any thread, such as when contexts are created and
+// destroyed on several threads at the same time.  The compiles themselves don't need the lock: the
+// built-in symbol tables are immutable and every thread compiles with its own pool allocator.
+std::mutex &GetInitializeMutex()
+{
+    static angle::base::NoDestructor<std::mutex> initializeMutex;
+    return *initializeMutex;
+}
+
+size_t initializeRefCount = 0;
 
 // glslang can only be initialized/finalized once per process. Otherwise, the following EGL commands
 // will call GlslangFinalize() without ever being able to GlslangInitialize() again, leading to
@@ -147,27 +159,29 @@ GLenum GetTessellationShaderTypeEnum(sh::TLayoutTessEvaluationType type)
 }  // anonymous namespace
 
 //
-// Driver must call this first, once, before doing any other compiler operations.
-// Subsequent calls to this function are no-op.
+// Driver must call this first before doing any other compiler operations.  The calls are reference
+// counted, only the first one initializes the compiler.
 //
 bool Initialize()
 {
-    if (!isInitialized)
+    std::lock_guard<std::mutex> lock(GetInitializeMutex());
+    if (initializeRefCount == 0 && !InitProcess())
     {
-        isInitialized = InitProcess();
+        return false;
     }
-    return isInitialized;
+    ++initializeRefCount;
+    return true;
 }
 
 //
-// Cleanup symbol tables
+// Cleanup symbol tables, once every call to Initialize() is balanced by a call to Finalize().
 //
 bool Finalize()
 {
-    if (isInitialized)
+    std::lock_guard<std::mutex> lock(GetInitializeMutex());
+    if (initializeRefCount > 0 && --initializeRefCount == 0)
     {
         DetachProcess();
-        isInitialized = false;
     }
     return true;
 }
@@ -409,6 +423,11 @@ bool Compile(const ShHandle handle,
     return compiler->compile(shaderStrings, numStrings, compileOptions);
 }
 
+void SetCompilePhaseCallbacks(CompilePhaseCallback beginPhase, CompilePhaseCallback endPhase)
+{
+    TCompiler::SetCompilePhaseCallbacks(beginPhase, endPhase);
+}
+
 void ClearResults(const ShHandle handle)
 {
     TCompiler *compiler = GetCompilerFromHandle(handle);
@@ -936,6 +955,7 @@ uint32_t GetAdvancedBlendEquations(const ShHandle handle)
 
 void InitializeGlslang()
 {
+    std::lock_guard<std::mutex> lock(GetInitializeMutex());
     if (initializeGlslangRefCount == 0)
     {
         GlslangInitialize();
@@ -946,6 +966,7 @@ void InitializeGlslang()
 
 void FinalizeGlslang()
 {
+    std::lock_guard<std::mutex> lock(GetInitializeMutex());
     --initializeGlslangRefCount;
     ASSERT(initializeGlslangRefCount >= 0);
     if (initializeGlslangRefCount == 0)
@@ -302,6 +302,37 @@ TIntermTyped *Add(TIntermTyped *left, TIntermTyped *right)
     return left ? right ? new TIntermBinary(EOpAdd, left, right) : left : right;
 }
 
+// Whether a load of |type| can be written as a single Load/LoadN of the buffer.  Booleans need a
+// conversion after the load and rows of row-major matrices are not contiguous, so those still go
+// through the wrapper functions.
+bool CanInlineLoad(const TType &type, bool isRowMajorMatrix)
+{
+    if (type.isArray() || type.isMatrix() || type.getStruct() != nullptr || isRowMajorMatrix)
+    {
+        return false;
+    }
+
+    TBasicType basicType = type.getBasicType();
+    return (type.isScalar() || type.isVector()) &&
+           (basicType == EbtFloat || basicType == EbtInt || basicType == EbtUInt);
+}
+
+const char *GetLoadConvertString(TBasicType basicType)
+{
+    switch (basicType)
+    {
+        case EbtFloat:
+            return "asfloat(";
+        case EbtInt:
+            return "asint(";
+        case EbtUInt:
+            return "asuint(";
+        default:
+            UNREACHABLE();
+            return "";
+    }
+}
+
 }  // anonymous namespace
 
 ShaderStorageBlockOutputHLSL::ShaderStorageBlockOutputHLSL(
@@ -494,10 +525,31 @@ void ShaderStorageBlockOutputHLSL::traverseSSBOAccess(TIntermTyped *node, SSBOMe
     bool isRowMajorMatrix = false;
     int matrixStride      = getMatrixStride(node, storage, rowMajor, &isRowMajorMatrix);
 
+    TInfoSinkBase &out = mOutputHLSL->getInfoSink();
+
+    // Loads of scalars and vectors that are laid out contiguously map to a single buffer load, so
+    // emit it in place instead of going through a wrapper function.  The closing parenthesis of
+    // the bit cast is written by the caller, like the one of a function call.
+    if (method == SSBOMethod::LOAD && CanInlineLoad(node->getType(), isRowMajorMatrix) &&
+        node->getAsSwizzleNode() == nullptr)
+    {
+        out << GetLoadConvertString(node->getBasicType());
+        BlockMemberInfo blockMemberInfo;
+        TIntermNode *loc = traverseNode(out, node, &blockMemberInfo);
+        out << ".Load";
+        if (node->getType().isVector())
+        {
+            out << static_cast<uint32_t>(node->getType().getNominalSize());
+        }
+        out << "(";
+        loc->traverse(mOutputHLSL);
+        out << ")";
+        return;
+    }
+
     const TString &functionName = mSSBOFunctionHLSL->registerShaderStorageBlockFunction(
         node->getType(), method, storage, isRowMajorMatrix, matrixStride, unsizedArrayStride,
         node->getAsSwizzleNode());
-    TInfoSinkBase &out = mOutputHLSL->getInfoSink();
     out << functionName;
     out << "(";
     BlockMemberInfo blockMemberInfo;
@@ -13,7 +13,11 @@
 
 #include "compiler/translator/SymbolTable.h"
 
+#include <mutex>
+
 #include "angle_gl.h"
+#include "anglebase/no_destructor.h"
+#include "common/hash_utils.h"
 #include "compiler/translator/ImmutableString.h"
 #include "compiler/translator/IntermNode.h"
 #include "compiler/translator/StaticType.h"
@@ -56,6 +60,30 @@ bool CheckExtension(uint32_t extensionIndex, const ShBuiltInResources &resources
     const int *resourcePtr = reinterpret_cast<const int *>(&resources);
     return resourcePtr[extensionIndex] > 0;
 }
+
+struct SharedBuiltInVariables : angle::NonCopyable
+{
+    sh::GLenum shaderType;
+    ShShaderSpec spec;
+    ShBuiltInResources resources;
+    size_t resourcesHash;
+
+    // Holds the memory of the variables, which outlive the compiler that created them.
+    angle::PoolAllocator allocator;
+    TSymbolTableBase variables;
+};
+
+struct SharedBuiltInVariablesCache
+{
+    std::mutex mutex;
+    std::vector<std::unique_ptr<SharedBuiltInVariables>> entries;
+};
+
+SharedBuiltInVariablesCache &GetSharedBuiltInVariablesCache()
+{
+    static angle::base::NoDestructor<SharedBuiltInVariablesCache> cache;
+    return *cache;
+}
 }  // namespace
 
 class TSymbolTable::TSymbolTableLevel
@@ -449,8 +477,58 @@ void TSymbolTable::initializeBuiltIns(sh::GLenum type,
 
     setDefaultPrecision(EbtAtomicCounter, EbpHigh);
 
-    initializeBuiltInVariables(type, spec, resources);
-    mUniqueIdCounter = kLastBuiltInId + 1;
+    static_cast<TSymbolTableBase &>(*this) = GetSharedBuiltInVariables(type, spec, resources);
+    mUniqueIdCounter                         = kLastBuiltInId + 1;
+}
+
+// static
+const TSymbolTableBase &TSymbolTable::GetSharedBuiltInVariables(sh::GLenum shaderType,
+                                                                ShShaderSpec spec,
+                                                                const ShBuiltInResources &resources)
+{
+    SharedBuiltInVariablesCache &cache = GetSharedBuiltInVariablesCache();
+    const size_t resourcesHash         = angle::ComputeGenericHash(resources);
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    for (const std::unique_ptr<SharedBuiltInVariables> &entry : cache.entries)
+    {
+        // The resources are memset before they are filled in, so they can be compared directly.
+        if (entry->shaderType == shaderType && entry->spec == spec &&
+            entry->resourcesHash == resourcesHash &&
+            memcmp(&entry->resources, &resources, sizeof(resources)) == 0)
+        {
+            return entry->variables;
+        }
+    }
+
+    auto entry           = std::make_unique<SharedBuiltInVariables>();
+    entry->shaderType    = shaderType;
+    entry->spec          = spec;
+    entry->resources     = resources;
+    entry->resourcesHash = resourcesHash;
+
+    // The types of the variables are realized as they are created, so nothing is lazily allocated
+    // from the pool of the compilers that use them afterwards.
+    angle::PoolAllocator *compilerAllocator = GetGlobalPoolAllocator();
+    SetGlobalPoolAllocator(&entry->allocator);
+    {
+        TSymbolTable builder;
+        builder.initializeBuiltInVariables(shaderType, spec, resources);
+        entry->variables = static_cast<const TSymbolTableBase &>(builder);
+    }
+    SetGlobalPoolAllocator(compilerAllocator);
+
+    cache.entries.push_back(std::move(entry));
+    return cache.entries.back()->variables;
+}
+
+// static
+void TSymbolTable::FreeSharedBuiltInVariables()
+{
+    SharedBuiltInVariablesCache &cache = GetSharedBuiltInVariablesCache();
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    cache.entries.clear();
 }
 
 void TSymbolTable::initSamplerDefaultPrecision(TBasicType samplerType)
@@ -325,6 +325,10 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
                             const ShBuiltInResources &resources);
     void clearCompilationResults();
 
+    // Frees the built-in variables that are shared between symbol tables.  No symbol table that
+    // was initialized before the call may be used afterwards.
+    static void FreeSharedBuiltInVariables();
+
     int getDefaultUniformsBindingIndex() const { return mResources.DefaultUniformsBindingIndex; }
     int getDriverUniformsBindingIndex() const { return mResources.DriverUniformsBindingIndex; }
     int getUBOArgumentBufferBindingIndex() const
@@ -353,6 +357,13 @@ class TSymbolTable : angle::NonCopyable, TSymbolTableBase
                                     ShShaderSpec spec,
                                     const ShBuiltInResources &resources);
 
+    // The built-in variables that depend on the shader type, spec and resources are only created
+    // the first time a symbol table is initialized with them, and are then shared by all symbol
+    // tables in the process.  They are never modified once created.
+    static const TSymbolTableBase &GetSharedBuiltInVariables(sh::GLenum shaderType,
+                                                             ShShaderSpec spec,
+                                                             const ShBuiltInResources &resources);
+
     VariableMetadata *getOrCreateVariableMetadata(const TVariable &variable);
 
     std::vector<std::unique_ptr<TSymbolTableLevel>> mTable;
@@ -4,6 +4,7 @@
 // found in the LICENSE file.
 //
 
+#include <atomic>
 #include <cctype>
 #include <map>
 
@@ -2473,7 +2474,8 @@ bool GenMetalTraverser::visitBranch(Visit, TIntermBranch *branchNode)
     return false;
 }
 
-static size_t emitMetalCallCount = 0;
+// Shaders can be translated on several threads at the same time.
+static std::atomic<size_t> emitMetalCallCount(0);
 
 bool sh::EmitMetal(TCompiler &compiler,
                    TIntermBlock &root,
@@ -2486,7 +2488,7 @@ bool sh::EmitMetal(TCompiler &compiler,
     TInfoSinkBase &out = compiler.getInfoSink().obj;
 
     {
-        ++emitMetalCallCount;
+        const size_t callIndex    = ++emitMetalCallCount;
         std::string filenameProto = angle::GetEnvironmentVar("GMD_FIXED_EMIT");
         if (!filenameProto.empty())
         {
@@ -2494,7 +2496,7 @@ bool sh::EmitMetal(TCompiler &compiler,
             {
                 auto tryOpen = [&](char const *ext) {
                     auto filename = filenameProto;
-                    filename += std::to_string(emitMetalCallCount);
+                    filename += std::to_string(callIndex);
                     filename += ".";
                     filename += ext;
                     return fopen(filename.c_str(), "rb");
@@ -0,0 +1,438 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// UnrollConstantLoops.cpp: Fully unroll for loops with constant bounds.  A loop is unrolled if:
+//  1. Its init statement declares a single int or uint index initialized with a constant.
+//  2. Its condition compares the index with a constant.
+//  3. Its expression increments or decrements the index by a constant.
+//  4. Its body doesn't modify the index, doesn't break out of or continue the loop, and doesn't
+//     declare structs.
+//  5. It terminates within a small number of iterations.
+// Each iteration is replaced with a block holding a copy of the body where the index is replaced
+// with its value and the variables the body declares are duplicated.  Loops nested in an unrolled
+// loop are unrolled in a subsequent traversal, until the size limit is reached.
+
+#include "compiler/translator/tree_ops/UnrollConstantLoops.h"
+
+#include <limits>
+
+#include "compiler/translator/Compiler.h"
+#include "compiler/translator/IntermNode.h"
+#include "compiler/translator/tree_util/IntermNode_util.h"
+#include "compiler/translator/tree_util/IntermTraverse.h"
+#include "compiler/translator/tree_util/ReplaceVariable.h"
+
+namespace sh
+{
+
+namespace
+{
+
+// Unrolling stops paying off once the shader grows significantly, so the number of iterations of
+// a loop and the number of nodes added to the whole shader are limited.
+constexpr size_t kMaxUnrolledIterations = 32;
+constexpr size_t kMaxUnrolledNodeCount  = 4096;
+
+struct LoopBounds
+{
+    const TVariable *index = nullptr;
+    std::vector<int64_t> values;
+};
+
+bool GetScalarConstant(TIntermTyped *node, TBasicType basicType, int64_t *valueOut)
+{
+    const TIntermConstantUnion *constant = node->getAsConstantUnion();
+    if (constant == nullptr || !constant->getType().isScalar() ||
+        constant->getType().getBasicType() != basicType)
+    {
+        return false;
+    }
+
+    const TConstantUnion *value = constant->getConstantValue();
+    *valueOut = basicType == EbtInt ? value->getIConst() : value->getUConst();
+    return true;
+}
+
+bool IsIndexSymbol(TIntermTyped *node, const TVariable *index)
+{
+    const TIntermSymbol *symbol = node->getAsSymbolNode();
+    return symbol != nullptr && &symbol->variable() == index;
+}
+
+bool EvaluateCondition(TOperator op, int64_t value, int64_t limit)
+{
+    switch (op)
+    {
+        case EOpLessThan:
+            return value < limit;
+        case EOpLessThanEqual:
+            return value <= limit;
+        case EOpGreaterThan:
+            return value > limit;
+        case EOpGreaterThanEqual:
+            return value >= limit;
+        case EOpNotEqual:
+            return value != limit;
+        default:
+            UNREACHABLE();
+            return false;
+    }
+}
+
+bool GetLoopBounds(TIntermLoop *loop, LoopBounds *boundsOut)
+{
+    if (loop->getType() != ELoopFor || loop->getInit() == nullptr ||
+        loop->getCondition() == nullptr || loop->getExpression() == nullptr)
+    {
+        return false;
+    }
+
+    // The init statement must be "int i = C" or "uint i = C".
+    TIntermDeclaration *init = loop->getInit()->getAsDeclarationNode();
+    if (init == nullptr || init->getSequence()->size() != 1)
+    {
+        return false;
+    }
+
+    TIntermBinary *initializer = init->getSequence()->front()->getAsBinaryNode();
+    if (initializer == nullptr || initializer->getOp() != EOpInitialize)
+    {
+        return false;
+    }
+
+    const TIntermSymbol *indexSymbol = initializer->getLeft()->getAsSymbolNode();
+    if (indexSymbol == nullptr || !indexSymbol->getType().isScalarInt() ||
+        indexSymbol->getType().getQualifier() != EvqTemporary)
+    {
+        return false;
+    }
+
+    const TVariable *index     = &indexSymbol->variable();
+    const TBasicType basicType = indexSymbol->getType().getBasicType();
+
+    int64_t initialValue = 0;
+    if (!GetScalarConstant(initializer->getRight(), basicType, &initialValue))
+    {
+        return false;
+    }
+
+    // The condition must compare the index with a constant.
+    TIntermBinary *condition = loop->getCondition()->getAsBinaryNode();
+    int64_t limit            = 0;
+    if (condition == nullptr || !IsIndexSymbol(condition->getLeft(), index) ||
+        !GetScalarConstant(condition->getRight(), basicType, &limit))
+    {
+        return false;
+    }
+
+    switch (condition->getOp())
+    {
+        case EOpLessThan:
+        case EOpLessThanEqual:
+        case EOpGreaterThan:
+        case EOpGreaterThanEqual:
+        case EOpNotEqual:
+            break;
+        default:
+            return false;
+    }
+
+    // The expression must increment or decrement the index by a constant.
+    int64_t step = 0;
+    if (TIntermUnary *unary = loop->getExpression()->getAsUnaryNode())
+    {
+        if (!IsIndexSymbol(unary->getOperand(), index))
+        {
+            return false;
+        }
+
+        switch (unary->getOp())
+        {
+            case EOpPostIncrement:
+            case EOpPreIncrement:
+                step = 1;
+                break;
+            case EOpPostDecrement:
+            case EOpPreDecrement:
+                step = -1;
+                break;
+            default:
+                return false;
+        }
+    }
+    else if (TIntermBinary *binary = loop->getExpression()->getAsBinaryNode())
+    {
+        if (!IsIndexSymbol(binary->getLeft(), index) ||
+            !GetScalarConstant(binary->getRight(), basicType, &step))
+        {
+            return false;
+        }
+
+        switch (binary->getOp())
+        {
+            case EOpAddAssign:
+                break;
+            case EOpSubAssign:
+                step = -step;
+                break;
+            default:
+                return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    // Run the loop.  Loops that run for too long, or whose index would overflow, are left alone.
+    const int64_t minValue = basicType == EbtInt ? std::numeric_limits<int32_t>::min() : 0;
+    const int64_t maxValue = basicType == EbtInt ? std::numeric_limits<int32_t>::max()
+                                                 : std::numeric_limits<uint32_t>::max();
+
+    boundsOut->index = index;
+    for (int64_t value = initialValue; EvaluateCondition(condition->getOp(), value, limit);
+         value += step)
+    {
+        if (boundsOut->values.size() == kMaxUnrolledIterations || value + step < minValue ||
+            value + step > maxValue)
+        {
+            return false;
+        }
+        boundsOut->values.push_back(value);
+    }
+
+    return true;
+}
+
+// Checks that the body of the loop can be duplicated, and counts its nodes.
+class LoopBodyTraverser : public TIntermTraverser
+{
+  public:
+    LoopBodyTraverser(const TVariable *index)
+        : TIntermTraverser(true, false, true), mIndex(index)
+    {}
+
+    bool canUnroll() const { return mCanUnroll; }
+    size_t getNodeCount() const { return mNodeCount; }
+
+    void visitSymbol(TIntermSymbol *node) override { ++mNodeCount; }
+    void visitConstantUnion(TIntermConstantUnion *node) override { ++mNodeCount; }
+
+    bool visitSwizzle(Visit visit, TIntermSwizzle *node) override
+    {
+        mNodeCount += visit == PreVisit ? 1 : 0;
+        return true;
+    }
+
+    bool visitTernary(Visit visit, TIntermTernary *node) override
+    {
+        mNodeCount += visit == PreVisit ? 1 : 0;
+        return true;
+    }
+
+    bool visitIfElse(Visit visit, TIntermIfElse *node) override
+    {
+        mNodeCount += visit == PreVisit ? 1 : 0;
+        return true;
+    }
+
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        if (visit == PreVisit)
+        {
+            ++mNodeCount;
+            if (IsAssignment(node->getOp()) && IsIndexSymbol(node->getLeft(), mIndex))
+            {
+                mCanUnroll = false;
+            }
+        }
+        return mCanUnroll;
+    }
+
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        if (visit == PreVisit)
+        {
+            ++mNodeCount;
+            if (IsAssignment(node->getOp()) && IsIndexSymbol(node->getOperand(), mIndex))
+            {
+                mCanUnroll = false;
+            }
+        }
+        return mCanUnroll;
+    }
+
+    bool visitAggregate(Visit visit, TIntermAggregate *node) override
+    {
+        if (visit != PreVisit)
+        {
+            return true;
+        }
+
+        ++mNodeCount;
+
+        // The index can't be passed as an out or inout parameter.
+        const TFunction *function = node->getFunction();
+        if (function != nullptr)
+        {
+            const TIntermSequence &arguments = *node->getSequence();
+            for (size_t argIndex = 0; argIndex < arguments.size(); ++argIndex)
+            {
+                const TQualifier qualifier =
+                    function->getParam(argIndex)->getType().getQualifier();
+                if ((qualifier == EvqParamOut || qualifier == EvqParamInOut) &&
+                    IsIndexSymbol(arguments[argIndex]->getAsTyped(), mIndex))
+                {
+                    mCanUnroll = false;
+                }
+            }
+        }
+        return mCanUnroll;
+    }
+
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        if (visit == PreVisit)
+        {
+            // Duplicating a struct declaration would define the struct multiple times.
+            const TIntermTyped *declarator = node->getSequence()->front()->getAsTyped();
+            if (declarator->getType().isStructSpecifier())
+            {
+                mCanUnroll = false;
+            }
+        }
+        return mCanUnroll;
+    }
+
+    bool visitLoop(Visit visit, TIntermLoop *node) override
+    {
+        mLoopDepth += visit == PreVisit ? 1 : visit == PostVisit ? -1 : 0;
+        mNodeCount += visit == PreVisit ? 1 : 0;
+        return mCanUnroll;
+    }
+
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override
+    {
+        mSwitchDepth += visit == PreVisit ? 1 : visit == PostVisit ? -1 : 0;
+        mNodeCount += visit == PreVisit ? 1 : 0;
+        return mCanUnroll;
+    }
+
+    bool visitBranch(Visit visit, TIntermBranch *node) override
+    {
+        if (visit == PreVisit)
+        {
+            ++mNodeCount;
+
+            // break and continue can't be expressed once the loop is gone.
+            if ((node->getFlowOp() == EOpBreak && mLoopDepth == 0 && mSwitchDepth == 0) ||
+                (node->getFlowOp() == EOpContinue && mLoopDepth == 0))
+            {
+                mCanUnroll = false;
+            }
+        }
+        return mCanUnroll;
+    }
+
+  private:
+    const TVariable *mIndex;
+    bool mCanUnroll   = true;
+    size_t mNodeCount = 0;
+    int mLoopDepth    = 0;
+    int mSwitchDepth  = 0;
+};
+
+class UnrollConstantLoopsTraverser : public TIntermTraverser
+{
+  public:
+    UnrollConstantLoopsTraverser(TCompiler *compiler,
+                                 TSymbolTable *symbolTable,
+                                 size_t *remainingNodeCount)
+        : TIntermTraverser(true, false, false, symbolTable),
+          mCompiler(compiler),
+          mRemainingNodeCount(remainingNodeCount)
+    {}
+
+    bool isValid() const { return mIsValid; }
+    bool didUnroll() const { return mDidUnroll; }
+
+    bool visitLoop(Visit visit, TIntermLoop *node) override
+    {
+        LoopBounds bounds;
+        if (node->getBody() == nullptr || !GetLoopBounds(node, &bounds))
+        {
+            return true;
+        }
+
+        LoopBodyTraverser bodyTraverser(bounds.index);
+        node->getBody()->traverse(&bodyTraverser);
+
+        const size_t unrolledNodeCount = bodyTraverser.getNodeCount() * bounds.values.size();
+        if (!bodyTraverser.canUnroll() || unrolledNodeCount > *mRemainingNodeCount)
+        {
+            return true;
+        }
+        *mRemainingNodeCount -= unrolledNodeCount;
+
+        TIntermBlock *unrolled = new TIntermBlock;
+        for (int64_t value : bounds.values)
+        {
+            TIntermTyped *indexValue =
+                bounds.index->getType().getBasicType() == EbtInt
+                    ? static_cast<TIntermTyped *>(CreateIndexNode(static_cast<int>(value)))
+                    : CreateUIntNode(static_cast<unsigned int>(value));
+
+            VariableReplacementMap variableMap;
+            variableMap[bounds.index] = indexValue;
+
+            TIntermBlock *iteration = node->getBody()->deepCopy();
+            GetDeclaratorReplacements(mSymbolTable, iteration, &variableMap);
+            mIsValid = ReplaceVariables(mCompiler, iteration, variableMap) && mIsValid;
+
+            unrolled->appendStatement(iteration);
+        }
+
+        queueReplacement(unrolled, OriginalNode::IS_DROPPED);
+        mDidUnroll = true;
+
+        // Loops nested in this one are handled in the next traversal, on the unrolled copies.
+        return false;
+    }
+
+  private:
+    TCompiler *mCompiler;
+    size_t *mRemainingNodeCount;
+    bool mIsValid   = true;
+    bool mDidUnroll = false;
+};
+
+}  // anonymous namespace
+
+bool UnrollConstantLoops(TCompiler *compiler, TIntermBlock *root, TSymbolTable *symbolTable)
+{
+    size_t remainingNodeCount = kMaxUnrolledNodeCount;
+    while (true)
+    {
+        UnrollConstantLoopsTraverser traverser(compiler, symbolTable, &remainingNodeCount);
+        root->traverse(&traverser);
+
+        if (!traverser.isValid())
+        {
+            return false;
+        }
+        if (!traverser.didUnroll())
+        {
+            break;
+        }
+        if (!traverser.updateTree(compiler, root))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}  // namespace sh
@@ -0,0 +1,29 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// UnrollConstantLoops.h: Fully unroll for loops with constant bounds and a small number of
+// iterations, substituting the loop index with its value in each copy of the body.  The
+// expressions that become constant are then folded by FoldExpressions, which needs to run after
+// this pass.
+
+#ifndef COMPILER_TRANSLATOR_TREEOPS_UNROLLCONSTANTLOOPS_H_
+#define COMPILER_TRANSLATOR_TREEOPS_UNROLLCONSTANTLOOPS_H_
+
+#include "common/angleutils.h"
+
+namespace sh
+{
+
+class TCompiler;
+class TIntermBlock;
+class TSymbolTable;
+
+ANGLE_NO_DISCARD bool UnrollConstantLoops(TCompiler *compiler,
+                                          TIntermBlock *root,
+                                          TSymbolTable *symbolTable);
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEOPS_UNROLLCONSTANTLOOPS_H_
@@ -0,0 +1,70 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FindSimplifiableNodes.cpp:
+//     Finds the kinds of nodes that the AST simplification passes of TCompiler operate on, so
+//     passes that would have nothing to do can be skipped without traversing the tree.
+
+#include "compiler/translator/tree_util/FindSimplifiableNodes.h"
+
+#include "compiler/translator/tree_util/IntermTraverse.h"
+
+namespace sh
+{
+
+namespace
+{
+
+class SimplifiableNodesFinder : public TIntermTraverser
+{
+  public:
+    SimplifiableNodesFinder() : TIntermTraverser(true, false, false) {}
+
+    bool visitLoop(Visit visit, TIntermLoop *node) override
+    {
+        mNodes.loops = true;
+        return true;
+    }
+
+    bool visitDeclaration(Visit visit, TIntermDeclaration *node) override
+    {
+        mNodes.multiDeclarations |= node->getSequence()->size() > 1;
+        return true;
+    }
+
+    bool visitBinary(Visit visit, TIntermBinary *node) override
+    {
+        mNodes.sequenceOperators |= node->getOp() == EOpComma;
+        return true;
+    }
+
+    bool visitUnary(Visit visit, TIntermUnary *node) override
+    {
+        mNodes.arrayLengthMethods |= node->getOp() == EOpArrayLength;
+        return true;
+    }
+
+    bool visitSwitch(Visit visit, TIntermSwitch *node) override
+    {
+        mNodes.switchStatements = true;
+        return true;
+    }
+
+    const SimplifiableNodes &getNodes() const { return mNodes; }
+
+  private:
+    SimplifiableNodes mNodes;
+};
+
+}  // anonymous namespace
+
+SimplifiableNodes FindSimplifiableNodes(TIntermNode *root)
+{
+    SimplifiableNodesFinder finder;
+    root->traverse(&finder);
+    return finder.getNodes();
+}
+
+}  // namespace sh
@@ -0,0 +1,31 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// FindSimplifiableNodes.h:
+//     Finds the kinds of nodes that the AST simplification passes of TCompiler operate on, so
+//     passes that would have nothing to do can be skipped without traversing the tree.
+
+#ifndef COMPILER_TRANSLATOR_TREEUTIL_FINDSIMPLIFIABLENODES_H_
+#define COMPILER_TRANSLATOR_TREEUTIL_FINDSIMPLIFIABLENODES_H_
+
+namespace sh
+{
+
+class TIntermNode;
+
+struct SimplifiableNodes
+{
+    bool loops              = false;
+    bool multiDeclarations  = false;
+    bool sequenceOperators  = false;
+    bool arrayLengthMethods = false;
+    bool switchStatements   = false;
+};
+
+SimplifiableNodes FindSimplifiableNodes(TIntermNode *root);
+
+}  // namespace sh
+
+#endif  // COMPILER_TRANSLATOR_TREEUTIL_FINDSIMPLIFIABLENODES_H_
@@ -12,8 +12,210 @@
 #include "common/platform.h"
 #include "image_util/imageformats.h"
 
+// SSE2 is part of x86-64 and NEON of arm64, so these paths need no runtime check.
+#if defined(ANGLE_USE_SSE) && (defined(__SSE2__) || defined(_M_X64) || \
+                               (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#    define ANGLE_LOAD_IMAGE_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_LOAD_IMAGE_NEON
+#endif
+
 namespace angle
 {
+namespace
+{
+// The vectorized row loaders convert as many pixels of the row as they can, and return how many
+// they converted.  The remaining pixels are left to the scalar loop of the caller.
+size_t LoadL8ToRGBA8Row(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_LOAD_IMAGE_SSE2)
+    const __m128i opaque = _mm_set1_epi8(-1);
+    for (; x + 15 < width; x += 16)
+    {
+        __m128i l = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+        // Pairs of LL and L1, which interleave to LLL1.
+        __m128i llLo = _mm_unpacklo_epi8(l, l);
+        __m128i llHi = _mm_unpackhi_epi8(l, l);
+        __m128i laLo = _mm_unpacklo_epi8(l, opaque);
+        __m128i laHi = _mm_unpackhi_epi8(l, opaque);
+        __m128i *out = reinterpret_cast<__m128i *>(&dest[4 * x]);
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(llLo, laLo));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(llLo, laLo));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(llHi, laHi));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(llHi, laHi));
+    }
+#elif defined(ANGLE_LOAD_IMAGE_NEON)
+    const uint8x16_t opaque = vdupq_n_u8(0xFF);
+    for (; x + 15 < width; x += 16)
+    {
+        uint8x16_t l      = vld1q_u8(&source[x]);
+        uint8x16x4_t rgba = {{l, l, l, opaque}};
+        vst4q_u8(&dest[4 * x], rgba);
+    }
+#endif
+    return x;
+}
+
+size_t LoadLA8ToRGBA8Row(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_LOAD_IMAGE_SSE2)
+    const __m128i lMask = _mm_set1_epi16(0x00FF);
+    for (; x + 7 < width; x += 8)
+    {
+        __m128i la = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[2 * x]));
+        // Pairs of LL and LA, which interleave to LLLA.
+        __m128i l    = _mm_and_si128(la, lMask);
+        __m128i ll   = _mm_or_si128(l, _mm_slli_epi16(l, 8));
+        __m128i *out = reinterpret_cast<__m128i *>(&dest[4 * x]);
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(ll, la));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(ll, la));
+    }
+#elif defined(ANGLE_LOAD_IMAGE_NEON)
+    for (; x + 15 < width; x += 16)
+    {
+        uint8x16x2_t la   = vld2q_u8(&source[2 * x]);
+        uint8x16x4_t rgba = {{la.val[0], la.val[0], la.val[0], la.val[1]}};
+        vst4q_u8(&dest[4 * x], rgba);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRGB8ToBGRX8Row(const uint8_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+    // SSE2 has no byte shuffle to unpack the three byte pixels with.
+#if defined(ANGLE_LOAD_IMAGE_NEON)
+    const uint8x16_t opaque = vdupq_n_u8(0xFF);
+    for (; x + 15 < width; x += 16)
+    {
+        uint8x16x3_t rgb  = vld3q_u8(&source[3 * x]);
+        uint8x16x4_t bgrx = {{rgb.val[2], rgb.val[1], rgb.val[0], opaque}};
+        vst4q_u8(&dest[4 * x], bgrx);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRGBA8ToBGRA8Row(const uint32_t *source, uint32_t *dest, size_t width)
+{
+    size_t x = 0;
+#if defined(ANGLE_LOAD_IMAGE_SSE2)
+    const __m128i brMask = _mm_set1_epi32(0x00ff00ff);
+    for (; x + 3 < width; x += 4)
+    {
+        __m128i sourceData = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+        // Mask out g and a, which don't change
+        __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
+        // Mask out b and r
+        __m128i brComponents = _mm_and_si128(sourceData, brMask);
+        // Swap b and r
+        __m128i brSwapped = _mm_shufflehi_epi16(
+            _mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+        __m128i result = _mm_or_si128(gaComponents, brSwapped);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[x]), result);
+    }
+#elif defined(ANGLE_LOAD_IMAGE_NEON)
+    for (; x + 15 < width; x += 16)
+    {
+        uint8x16x4_t rgba = vld4q_u8(reinterpret_cast<const uint8_t *>(&source[x]));
+        uint8x16x4_t bgra = {{rgba.val[2], rgba.val[1], rgba.val[0], rgba.val[3]}};
+        vst4q_u8(reinterpret_cast<uint8_t *>(&dest[x]), bgra);
+    }
+#endif
+    return x;
+}
+
+size_t LoadRGBA4ToRGBA8Row(const uint16_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+    // Each nibble n widens to the byte n * 0x11.  With the pixel split into its BR and AG nibbles,
+    // the widened channels are regrouped into RG and BA pairs, which interleave to RGBA.
+#if defined(ANGLE_LOAD_IMAGE_SSE2)
+    const __m128i nibbleMask = _mm_set1_epi16(0x0F0F);
+    const __m128i lowMask    = _mm_set1_epi16(0x00FF);
+    for (; x + 7 < width; x += 8)
+    {
+        __m128i rgba = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+        __m128i br   = _mm_and_si128(_mm_srli_epi16(rgba, 4), nibbleMask);
+        __m128i ag   = _mm_and_si128(rgba, nibbleMask);
+        br           = _mm_or_si128(br, _mm_slli_epi16(br, 4));
+        ag           = _mm_or_si128(ag, _mm_slli_epi16(ag, 4));
+        __m128i rg   = _mm_or_si128(_mm_srli_epi16(br, 8), _mm_andnot_si128(lowMask, ag));
+        __m128i ba   = _mm_or_si128(_mm_and_si128(br, lowMask), _mm_slli_epi16(ag, 8));
+        __m128i *out = reinterpret_cast<__m128i *>(&dest[4 * x]);
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(rg, ba));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(rg, ba));
+    }
+#elif defined(ANGLE_LOAD_IMAGE_NEON)
+    const uint16x8_t nibbleMask = vdupq_n_u16(0x0F0F);
+    const uint16x8_t lowMask    = vdupq_n_u16(0x00FF);
+    for (; x + 7 < width; x += 8)
+    {
+        uint16x8_t rgba = vld1q_u16(&source[x]);
+        uint16x8_t br   = vandq_u16(vshrq_n_u16(rgba, 4), nibbleMask);
+        uint16x8_t ag   = vandq_u16(rgba, nibbleMask);
+        br              = vorrq_u16(br, vshlq_n_u16(br, 4));
+        ag              = vorrq_u16(ag, vshlq_n_u16(ag, 4));
+        uint16x8x2_t rgAndBa;
+        rgAndBa.val[0] = vorrq_u16(vshrq_n_u16(br, 8), vbicq_u16(ag, lowMask));
+        rgAndBa.val[1] = vorrq_u16(vandq_u16(br, lowMask), vshlq_n_u16(ag, 8));
+        vst2q_u16(reinterpret_cast<uint16_t *>(&dest[4 * x]), rgAndBa);
+    }
+#endif
+    return x;
+}
+
+size_t LoadR5G6B5ToRGBA8Row(const uint16_t *source, uint8_t *dest, size_t width)
+{
+    size_t x = 0;
+    // Each channel widens by repeating its top bits below it.  The widened channels are grouped
+    // into RG and BA pairs, which interleave to RGBA.
+#if defined(ANGLE_LOAD_IMAGE_SSE2)
+    const __m128i mask5  = _mm_set1_epi16(0x1F);
+    const __m128i mask6  = _mm_set1_epi16(0x3F);
+    const __m128i opaque = _mm_set1_epi16(static_cast<short>(0xFF00));
+    for (; x + 7 < width; x += 8)
+    {
+        __m128i rgb  = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
+        __m128i r    = _mm_srli_epi16(rgb, 11);
+        __m128i g    = _mm_and_si128(_mm_srli_epi16(rgb, 5), mask6);
+        __m128i b    = _mm_and_si128(rgb, mask5);
+        r            = _mm_or_si128(_mm_slli_epi16(r, 3), _mm_srli_epi16(r, 2));
+        g            = _mm_or_si128(_mm_slli_epi16(g, 2), _mm_srli_epi16(g, 4));
+        b            = _mm_or_si128(_mm_slli_epi16(b, 3), _mm_srli_epi16(b, 2));
+        __m128i rg   = _mm_or_si128(r, _mm_slli_epi16(g, 8));
+        __m128i ba   = _mm_or_si128(b, opaque);
+        __m128i *out = reinterpret_cast<__m128i *>(&dest[4 * x]);
+        _mm_storeu_si128(out + 0, _mm_unpacklo_epi16(rg, ba));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(rg, ba));
+    }
+#elif defined(ANGLE_LOAD_IMAGE_NEON)
+    const uint16x8_t mask5  = vdupq_n_u16(0x1F);
+    const uint16x8_t mask6  = vdupq_n_u16(0x3F);
+    const uint16x8_t opaque = vdupq_n_u16(0xFF00);
+    for (; x + 7 < width; x += 8)
+    {
+        uint16x8_t rgb = vld1q_u16(&source[x]);
+        uint16x8_t r   = vshrq_n_u16(rgb, 11);
+        uint16x8_t g   = vandq_u16(vshrq_n_u16(rgb, 5), mask6);
+        uint16x8_t b   = vandq_u16(rgb, mask5);
+        r              = vorrq_u16(vshlq_n_u16(r, 3), vshrq_n_u16(r, 2));
+        g              = vorrq_u16(vshlq_n_u16(g, 2), vshrq_n_u16(g, 4));
+        b              = vorrq_u16(vshlq_n_u16(b, 3), vshrq_n_u16(b, 2));
+        uint16x8x2_t rgAndBa;
+        rgAndBa.val[0] = vorrq_u16(r, vshlq_n_u16(g, 8));
+        rgAndBa.val[1] = vorrq_u16(b, opaque);
+        vst2q_u16(reinterpret_cast<uint16_t *>(&dest[4 * x]), rgAndBa);
+    }
+#endif
+    return x;
+}
+}  // anonymous namespace
+
 
 void LoadA8ToRGBA8(size_t width,
                    size_t height,
@@ -180,7 +382,7 @@ void LoadL8ToRGBA8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadL8ToRGBA8Row(source, dest, width); x < width; x++)
             {
                 uint8_t sourceVal = source[x];
                 dest[4 * x + 0]   = sourceVal;
@@ -283,7 +485,7 @@ void LoadLA8ToRGBA8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadLA8ToRGBA8Row(source, dest, width); x < width; x++)
             {
                 dest[4 * x + 0] = source[2 * x + 0];
                 dest[4 * x + 1] = source[2 * x + 0];
@@ -449,7 +651,7 @@ void LoadRGB8ToBGRX8(size_t width,
                 priv::OffsetDataPointer<uint8_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRGB8ToBGRX8Row(source, dest, width); x < width; x++)
             {
                 dest[4 * x + 0] = source[x * 3 + 2];
                 dest[4 * x + 1] = source[x * 3 + 1];
@@ -569,7 +771,7 @@ void LoadR5G6B5ToRGBA8(size_t width,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadR5G6B5ToRGBA8Row(source, dest, width); x < width; x++)
             {
                 uint16_t rgb = source[x];
                 dest[4 * x + 0] =
@@ -594,58 +796,6 @@ void LoadRGBA8ToBGRA8(size_t width,
                       size_t outputRowPitch,
                       size_t outputDepthPitch)
 {
-#if defined(ANGLE_USE_SSE)
-    if (gl::supportsSSE2())
-    {
-        __m128i brMask = _mm_set1_epi32(0x00ff00ff);
-
-        for (size_t z = 0; z < depth; z++)
-        {
-            for (size_t y = 0; y < height; y++)
-            {
-                const uint32_t *source =
-                    priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
-                uint32_t *dest = priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch,
-                                                                   outputDepthPitch);
-
-                size_t x = 0;
-
-                // Make output writes aligned
-                for (; ((reinterpret_cast<intptr_t>(&dest[x]) & 15) != 0) && x < width; x++)
-                {
-                    uint32_t rgba = source[x];
-                    dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-                }
-
-                for (; x + 3 < width; x += 4)
-                {
-                    __m128i sourceData =
-                        _mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[x]));
-                    // Mask out g and a, which don't change
-                    __m128i gaComponents = _mm_andnot_si128(brMask, sourceData);
-                    // Mask out b and r
-                    __m128i brComponents = _mm_and_si128(sourceData, brMask);
-                    // Swap b and r
-                    __m128i brSwapped = _mm_shufflehi_epi16(
-                        _mm_shufflelo_epi16(brComponents, _MM_SHUFFLE(2, 3, 0, 1)),
-                        _MM_SHUFFLE(2, 3, 0, 1));
-                    __m128i result = _mm_or_si128(gaComponents, brSwapped);
-                    _mm_store_si128(reinterpret_cast<__m128i *>(&dest[x]), result);
-                }
-
-                // Perform leftover writes
-                for (; x < width; x++)
-                {
-                    uint32_t rgba = source[x];
-                    dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
-                }
-            }
-        }
-
-        return;
-    }
-#endif
-
     for (size_t z = 0; z < depth; z++)
     {
         for (size_t y = 0; y < height; y++)
@@ -654,7 +804,7 @@ void LoadRGBA8ToBGRA8(size_t width,
                 priv::OffsetDataPointer<uint32_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint32_t *dest =
                 priv::OffsetDataPointer<uint32_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRGBA8ToBGRA8Row(source, dest, width); x < width; x++)
             {
                 uint32_t rgba = source[x];
                 dest[x]       = (ANGLE_ROTL(rgba, 16) & 0x00ff00ff) | (rgba & 0xff00ff00);
@@ -803,7 +953,7 @@ void LoadRGBA4ToRGBA8(size_t width,
                 priv::OffsetDataPointer<uint16_t>(input, y, z, inputRowPitch, inputDepthPitch);
             uint8_t *dest =
                 priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
-            for (size_t x = 0; x < width; x++)
+            for (size_t x = LoadRGBA4ToRGBA8Row(source, dest, width); x < width; x++)
             {
                 uint16_t rgba = source[x];
                 dest[4 * x + 0] =
@@ -639,6 +639,42 @@ inline void LoadCompressedToNative(size_t width,
                                    size_t outputRowPitch,
                                    size_t outputDepthPitch);
 
+// Decodes ASTC LDR blocks of any 2D footprint to RGBA8.
+void LoadASTCToRGBA8Inner(size_t width,
+                          size_t height,
+                          size_t depth,
+                          uint32_t blockWidth,
+                          uint32_t blockHeight,
+                          bool isSRGB,
+                          const uint8_t *input,
+                          size_t inputRowPitch,
+                          size_t inputDepthPitch,
+                          uint8_t *output,
+                          size_t outputRowPitch,
+                          size_t outputDepthPitch);
+
+template <uint32_t blockWidth, uint32_t blockHeight>
+inline void LoadASTCToRGBA8(size_t width,
+                            size_t height,
+                            size_t depth,
+                            const uint8_t *input,
+                            size_t inputRowPitch,
+                            size_t inputDepthPitch,
+                            uint8_t *output,
+                            size_t outputRowPitch,
+                            size_t outputDepthPitch);
+
+template <uint32_t blockWidth, uint32_t blockHeight>
+inline void LoadASTCSRGBToRGBA8(size_t width,
+                                size_t height,
+                                size_t depth,
+                                const uint8_t *input,
+                                size_t inputRowPitch,
+                                size_t inputDepthPitch,
+                                uint8_t *output,
+                                size_t outputRowPitch,
+                                size_t outputDepthPitch);
+
 void LoadR32ToR16(size_t width,
                   size_t height,
                   size_t depth,
@@ -0,0 +1,1023 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// loadimage_astc.cpp: Decodes ASTC LDR encoded textures, for when the formats are not supported
+// by the hardware.  The decoding follows the ASTC section of the Khronos Data Format
+// Specification, with the decode_unorm8 precision.
+
+#include "image_util/loadimage.h"
+
+#include <string.h>
+#include <algorithm>
+
+#include "common/debug.h"
+
+namespace angle
+{
+namespace
+{
+constexpr size_t kASTCBlockSize        = 16;
+constexpr uint32_t kMaxBlockTexels     = 12 * 12;
+constexpr uint32_t kMaxWeightCount     = 64;
+constexpr uint32_t kMinWeightBits      = 24;
+constexpr uint32_t kMaxWeightBits      = 96;
+constexpr uint32_t kMaxColorValueCount = 18;
+
+// Texels of blocks that are invalid, or that use features outside the LDR profile, take the error
+// color.
+constexpr uint8_t kErrorColor[4] = {0xFF, 0x00, 0xFF, 0xFF};
+
+// A quantization range, in the form used by the integer sequence encoding: a value is made of a
+// trit or a quint (or neither), followed by |bits| bits.
+struct QuantizationRange
+{
+    uint32_t trits;
+    uint32_t quints;
+    uint32_t bits;
+};
+
+// The ranges of the color endpoint values, in increasing order.
+// clang-format off
+constexpr QuantizationRange kColorRanges[] = {
+    {0, 0, 1}, {1, 0, 0}, {0, 0, 2}, {0, 1, 0}, {1, 0, 1}, {0, 0, 3}, {0, 1, 1},
+    {1, 0, 2}, {0, 0, 4}, {0, 1, 2}, {1, 0, 3}, {0, 0, 5}, {0, 1, 3}, {1, 0, 4},
+    {0, 0, 6}, {0, 1, 4}, {1, 0, 5}, {0, 0, 7}, {0, 1, 5}, {1, 0, 6}, {0, 0, 8},
+};
+// clang-format on
+
+// Color endpoints need at least 6 levels (i.e. the 0..5 range).
+constexpr size_t kMinColorRangeIndex = 4;
+
+// The ranges of the weights, indexed by the precision bit and the range bits of the block mode.
+// Range bits below 2 are reserved.
+// clang-format off
+constexpr QuantizationRange kWeightRanges[2][8] = {
+    {{0, 0, 0}, {0, 0, 0}, {0, 0, 1}, {1, 0, 0}, {0, 0, 2}, {0, 1, 0}, {1, 0, 1}, {0, 0, 3}},
+    {{0, 0, 0}, {0, 0, 0}, {0, 1, 1}, {1, 0, 2}, {0, 0, 4}, {0, 1, 2}, {1, 0, 3}, {0, 0, 5}},
+};
+// clang-format on
+
+uint32_t GetBits(const uint8_t *data, uint32_t start, uint32_t count)
+{
+    uint32_t value = 0;
+    for (uint32_t bit = 0; bit < count; ++bit)
+    {
+        const uint32_t position = start + bit;
+        value |= ((data[position / 8] >> (position % 8)) & 1) << bit;
+    }
+    return value;
+}
+
+uint8_t ReverseBits(uint8_t value)
+{
+    uint8_t reversed = 0;
+    for (uint32_t bit = 0; bit < 8; ++bit)
+    {
+        reversed |= ((value >> bit) & 1) << (7 - bit);
+    }
+    return reversed;
+}
+
+// Reads consecutive bits of a block.  Bits past the end read as zero, as the last values of an
+// integer sequence may be truncated.
+class BitReader final
+{
+  public:
+    BitReader(const uint8_t *data, uint32_t start, uint32_t end)
+        : mData(data), mPosition(start), mEnd(end)
+    {}
+
+    uint32_t read(uint32_t count)
+    {
+        const uint32_t available = mPosition < mEnd ? std::min(count, mEnd - mPosition) : 0;
+        const uint32_t value     = GetBits(mData, mPosition, available);
+        mPosition += count;
+        return value;
+    }
+
+  private:
+    const uint8_t *mData;
+    uint32_t mPosition;
+    uint32_t mEnd;
+};
+
+uint32_t GetSequenceBitCount(const QuantizationRange &range, uint32_t count)
+{
+    uint32_t bitCount = range.bits * count;
+    if (range.trits)
+    {
+        bitCount += (8 * count + 4) / 5;
+    }
+    if (range.quints)
+    {
+        bitCount += (7 * count + 2) / 3;
+    }
+    return bitCount;
+}
+
+uint32_t Bit(uint32_t value, uint32_t bit)
+{
+    return (value >> bit) & 1;
+}
+
+void DecodeTrits(uint32_t packed, uint32_t *trits)
+{
+    uint32_t c;
+    if (((packed >> 2) & 7) == 7)
+    {
+        c        = (((packed >> 5) & 7) << 2) | (packed & 3);
+        trits[4] = 2;
+        trits[3] = 2;
+    }
+    else
+    {
+        c = packed & 0x1F;
+        if (((packed >> 5) & 3) == 3)
+        {
+            trits[4] = 2;
+            trits[3] = Bit(packed, 7);
+        }
+        else
+        {
+            trits[4] = Bit(packed, 7);
+            trits[3] = (packed >> 5) & 3;
+        }
+    }
+
+    if ((c & 3) == 3)
+    {
+        trits[2] = 2;
+        trits[1] = Bit(c, 4);
+        trits[0] = (Bit(c, 3) << 1) | (Bit(c, 2) & ~Bit(c, 3) & 1);
+    }
+    else if (((c >> 2) & 3) == 3)
+    {
+        trits[2] = 2;
+        trits[1] = 2;
+        trits[0] = c & 3;
+    }
+    else
+    {
+        trits[2] = Bit(c, 4);
+        trits[1] = (c >> 2) & 3;
+        trits[0] = (Bit(c, 1) << 1) | (Bit(c, 0) & ~Bit(c, 1) & 1);
+    }
+}
+
+void DecodeQuints(uint32_t packed, uint32_t *quints)
+{
+    if (((packed >> 1) & 3) == 3 && ((packed >> 5) & 3) == 0)
+    {
+        const uint32_t notQ0 = ~Bit(packed, 0) & 1;
+
+        quints[2] = (Bit(packed, 0) << 2) | ((Bit(packed, 4) & notQ0) << 1) |
+                    (Bit(packed, 3) & notQ0);
+        quints[1] = 4;
+        quints[0] = 4;
+        return;
+    }
+
+    uint32_t c;
+    if (((packed >> 1) & 3) == 3)
+    {
+        quints[2] = 4;
+        c         = (((packed >> 3) & 3) << 3) | ((~(packed >> 5) & 3) << 1) | Bit(packed, 0);
+    }
+    else
+    {
+        quints[2] = (packed >> 5) & 3;
+        c         = packed & 0x1F;
+    }
+
+    if ((c & 7) == 5)
+    {
+        quints[1] = 4;
+        quints[0] = (c >> 3) & 3;
+    }
+    else
+    {
+        quints[1] = (c >> 3) & 3;
+        quints[0] = c & 7;
+    }
+}
+
+// Decodes |count| values encoded with the bounded integer sequence encoding.
+void DecodeIntegerSequence(BitReader *reader,
+                           const QuantizationRange &range,
+                           uint32_t count,
+                           uint32_t *valuesOut)
+{
+    const uint32_t bits = range.bits;
+    uint32_t index      = 0;
+    while (index < count)
+    {
+        if (range.trits)
+        {
+            // The bits of the packed trits are interleaved with the bits of the values.
+            constexpr uint32_t kPackedBitCounts[5]  = {2, 2, 1, 2, 1};
+            constexpr uint32_t kPackedBitOffsets[5] = {0, 2, 4, 5, 7};
+
+            uint32_t lowBits[5];
+            uint32_t packed = 0;
+            for (uint32_t i = 0; i < 5; ++i)
+            {
+                lowBits[i] = reader->read(bits);
+                packed |= reader->read(kPackedBitCounts[i]) << kPackedBitOffsets[i];
+            }
+
+            uint32_t trits[5];
+            DecodeTrits(packed, trits);
+            for (uint32_t i = 0; i < 5 && index < count; ++i)
+            {
+                valuesOut[index++] = (trits[i] << bits) | lowBits[i];
+            }
+        }
+        else if (range.quints)
+        {
+            constexpr uint32_t kPackedBitCounts[3]  = {3, 2, 2};
+            constexpr uint32_t kPackedBitOffsets[3] = {0, 3, 5};
+
+            uint32_t lowBits[3];
+            uint32_t packed = 0;
+            for (uint32_t i = 0; i < 3; ++i)
+            {
+                lowBits[i] = reader->read(bits);
+                packed |= reader->read(kPackedBitCounts[i]) << kPackedBitOffsets[i];
+            }
+
+            uint32_t quints[3];
+            DecodeQuints(packed, quints);
+            for (uint32_t i = 0; i < 3 && index < count; ++i)
+            {
+                valuesOut[index++] = (quints[i] << bits) | lowBits[i];
+            }
+        }
+        else
+        {
+            valuesOut[index++] = reader->read(bits);
+        }
+    }
+}
+
+uint32_t ReplicateBits(uint32_t value, uint32_t fromBits, uint32_t toBits)
+{
+    ASSERT(fromBits > 0);
+    uint32_t result = 0;
+    int shift       = static_cast<int>(toBits);
+    while (shift > 0)
+    {
+        shift -= static_cast<int>(fromBits);
+        result |= shift >= 0 ? value << shift : value >> -shift;
+    }
+    return result & ((1u << toBits) - 1);
+}
+
+// Unquantizes a color endpoint value to 0..255.
+uint32_t UnquantizeColor(const QuantizationRange &range, uint32_t value)
+{
+    const uint32_t bits = range.bits;
+    if (range.trits == 0 && range.quints == 0)
+    {
+        return ReplicateBits(value, bits, 8);
+    }
+
+    const uint32_t lowBits = value & ((1u << bits) - 1);
+    const uint32_t digit   = value >> bits;
+    const uint32_t a       = (lowBits & 1) ? 0x1FF : 0;
+    const uint32_t b       = lowBits >> 1;
+    uint32_t scrambled     = 0;
+    uint32_t scale         = 0;
+
+    if (range.trits)
+    {
+        switch (bits)
+        {
+            case 1:
+                scale = 204;
+                break;
+            case 2:
+                scrambled = (b << 8) | (b << 4) | (b << 2) | (b << 1);
+                scale     = 93;
+                break;
+            case 3:
+                scrambled = (b << 7) | (b << 2) | b;
+                scale     = 44;
+                break;
+            case 4:
+                scrambled = (b << 6) | b;
+                scale     = 22;
+                break;
+            case 5:
+                scrambled = (b << 5) | (b >> 2);
+                scale     = 11;
+                break;
+            case 6:
+                scrambled = (b << 4) | (b >> 4);
+                scale     = 5;
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+    }
+    else
+    {
+        switch (bits)
+        {
+            case 1:
+                scale = 113;
+                break;
+            case 2:
+                scrambled = (b << 8) | (b << 3) | (b << 2);
+                scale     = 54;
+                break;
+            case 3:
+                scrambled = (b << 7) | (b << 1) | (b >> 1);
+                scale     = 26;
+                break;
+            case 4:
+                scrambled = (b << 6) | (b >> 1);
+                scale     = 13;
+                break;
+            case 5:
+                scrambled = (b << 5) | (b >> 3);
+                scale     = 6;
+                break;
+            default:
+                UNREACHABLE();
+                break;
+        }
+    }
+
+    const uint32_t unquantized = (digit * scale + scrambled) ^ a;
+    return (a & 0x80) | (unquantized >> 2);
+}
+
+// Unquantizes a weight to 0..64.
+uint32_t UnquantizeWeight(const QuantizationRange &range, uint32_t value)
+{
+    const uint32_t bits = range.bits;
+    uint32_t result     = 0;
+
+    if (range.trits == 0 && range.quints == 0)
+    {
+        result = ReplicateBits(value, bits, 6);
+    }
+    else if (bits == 0)
+    {
+        constexpr uint32_t kTritWeights[3]  = {0, 32, 63};
+        constexpr uint32_t kQuintWeights[5] = {0, 16, 32, 47, 63};
+        result = range.trits ? kTritWeights[value] : kQuintWeights[value];
+    }
+    else
+    {
+        const uint32_t lowBits = value & ((1u << bits) - 1);
+        const uint32_t digit   = value >> bits;
+        const uint32_t a       = (lowBits & 1) ? 0x7F : 0;
+        const uint32_t b       = lowBits >> 1;
+        uint32_t scrambled     = 0;
+        uint32_t scale         = 0;
+
+        if (range.trits)
+        {
+            switch (bits)
+            {
+                case 1:
+                    scale = 50;
+                    break;
+                case 2:
+                    scrambled = (b << 6) | (b << 2) | b;
+                    scale     = 23;
+                    break;
+                case 3:
+                    scrambled = (b << 5) | b;
+                    scale     = 11;
+                    break;
+                default:
+                    UNREACHABLE();
+                    break;
+            }
+        }
+        else
+        {
+            switch (bits)
+            {
+                case 1:
+                    scale = 28;
+                    break;
+                case 2:
+                    scrambled = (b << 6) | (b << 1);
+                    scale     = 13;
+                    break;
+                default:
+                    UNREACHABLE();
+                    break;
+            }
+        }
+
+        const uint32_t unquantized = (digit * scale + scrambled) ^ a;
+        result                     = (a & 0x20) | (unquantized >> 2);
+    }
+
+    return result > 32 ? result + 1 : result;
+}
+
+struct BlockMode
+{
+    uint32_t gridWidth;
+    uint32_t gridHeight;
+    bool dualPlane;
+    QuantizationRange weightRange;
+};
+
+bool DecodeBlockMode(uint32_t mode, BlockMode *blockModeOut)
+{
+    uint32_t range       = 0;
+    uint32_t precision   = Bit(mode, 9);
+    bool dualPlane       = Bit(mode, 10) != 0;
+    const uint32_t a     = (mode >> 5) & 3;
+    uint32_t b           = (mode >> 7) & 3;
+    uint32_t &gridWidth  = blockModeOut->gridWidth;
+    uint32_t &gridHeight = blockModeOut->gridHeight;
+
+    if ((mode & 3) != 0)
+    {
+        range = Bit(mode, 4) | ((mode & 3) << 1);
+        switch ((mode >> 2) & 3)
+        {
+            case 0:
+                gridWidth  = b + 4;
+                gridHeight = a + 2;
+                break;
+            case 1:
+                gridWidth  = b + 8;
+                gridHeight = a + 2;
+                break;
+            case 2:
+                gridWidth  = a + 2;
+                gridHeight = b + 8;
+                break;
+            default:
+                b &= 1;
+                if (Bit(mode, 8))
+                {
+                    gridWidth  = b + 2;
+                    gridHeight = a + 2;
+                }
+                else
+                {
+                    gridWidth  = a + 2;
+                    gridHeight = b + 6;
+                }
+                break;
+        }
+    }
+    else
+    {
+        range = Bit(mode, 4) | (((mode >> 2) & 3) << 1);
+        switch ((mode >> 7) & 3)
+        {
+            case 0:
+                gridWidth  = 12;
+                gridHeight = a + 2;
+                break;
+            case 1:
+                gridWidth  = a + 2;
+                gridHeight = 12;
+                break;
+            case 2:
+                gridWidth  = a + 6;
+                gridHeight = ((mode >> 9) & 3) + 6;
+                precision  = 0;
+                dualPlane  = false;
+                break;
+            default:
+                switch (a)
+                {
+                    case 0:
+                        gridWidth  = 6;
+                        gridHeight = 10;
+                        break;
+                    case 1:
+                        gridWidth  = 10;
+                        gridHeight = 6;
+                        break;
+                    default:
+                        return false;
+                }
+                break;
+        }
+    }
+
+    if (range < 2)
+    {
+        return false;
+    }
+
+    blockModeOut->dualPlane   = dualPlane;
+    blockModeOut->weightRange = kWeightRanges[precision][range];
+    return true;
+}
+
+uint32_t Hash52(uint32_t p)
+{
+    p ^= p >> 15;
+    p -= p << 17;
+    p += p << 7;
+    p += p << 4;
+    p ^= p >> 5;
+    p += p << 16;
+    p ^= p >> 7;
+    p ^= p >> 3;
+    p ^= p << 6;
+    p ^= p >> 17;
+    return p;
+}
+
+uint32_t SelectPartition(uint32_t seed,
+                         uint32_t x,
+                         uint32_t y,
+                         uint32_t partitionCount,
+                         bool smallBlock)
+{
+    if (smallBlock)
+    {
+        x <<= 1;
+        y <<= 1;
+    }
+
+    seed += (partitionCount - 1) * 1024;
+    const uint32_t rnum = Hash52(seed);
+
+    uint32_t seeds[8];
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        seeds[i] = (rnum >> (i * 4)) & 0xF;
+        seeds[i] *= seeds[i];
+    }
+
+    uint32_t shift1;
+    uint32_t shift2;
+    if (seed & 1)
+    {
+        shift1 = (seed & 2) ? 4 : 5;
+        shift2 = (partitionCount == 3) ? 6 : 5;
+    }
+    else
+    {
+        shift1 = (partitionCount == 3) ? 6 : 5;
+        shift2 = (seed & 2) ? 4 : 5;
+    }
+
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        seeds[i] >>= (i % 2 == 0) ? shift1 : shift2;
+    }
+
+    // The z coordinate is always zero for 2D blocks, so the seeds that multiply it are not needed.
+    uint32_t a = (seeds[0] * x + seeds[1] * y + (rnum >> 14)) & 0x3F;
+    uint32_t b = (seeds[2] * x + seeds[3] * y + (rnum >> 10)) & 0x3F;
+    uint32_t c = (seeds[4] * x + seeds[5] * y + (rnum >> 6)) & 0x3F;
+    uint32_t d = (seeds[6] * x + seeds[7] * y + (rnum >> 2)) & 0x3F;
+
+    if (partitionCount < 4)
+    {
+        d = 0;
+    }
+    if (partitionCount < 3)
+    {
+        c = 0;
+    }
+
+    if (a >= b && a >= c && a >= d)
+    {
+        return 0;
+    }
+    if (b >= c && b >= d)
+    {
+        return 1;
+    }
+    if (c >= d)
+    {
+        return 2;
+    }
+    return 3;
+}
+
+bool IsHDREndpointMode(uint32_t mode)
+{
+    return mode == 2 || mode == 3 || mode == 7 || mode == 11 || mode == 14 || mode == 15;
+}
+
+void BitTransferSigned(int *a, int *b)
+{
+    *b >>= 1;
+    *b |= *a & 0x80;
+    *a >>= 1;
+    *a &= 0x3F;
+    if ((*a & 0x20) != 0)
+    {
+        *a -= 0x40;
+    }
+}
+
+void SetEndpoint(int *endpoint, int r, int g, int b, int a)
+{
+    endpoint[0] = r;
+    endpoint[1] = g;
+    endpoint[2] = b;
+    endpoint[3] = a;
+}
+
+void SetBlueContractedEndpoint(int *endpoint, int r, int g, int b, int a)
+{
+    SetEndpoint(endpoint, (r + b) >> 1, (g + b) >> 1, b, a);
+}
+
+// Decodes the two RGBA endpoints of an LDR endpoint mode from its unquantized values.
+void DecodeEndpoints(uint32_t mode, const uint32_t *values, int *endpoint0, int *endpoint1)
+{
+    int v[8];
+    for (uint32_t i = 0; i < ((mode >> 2) + 1) * 2; ++i)
+    {
+        v[i] = static_cast<int>(values[i]);
+    }
+
+    switch (mode)
+    {
+        case 0:
+            // Luminance, direct.
+            SetEndpoint(endpoint0, v[0], v[0], v[0], 0xFF);
+            SetEndpoint(endpoint1, v[1], v[1], v[1], 0xFF);
+            break;
+        case 1:
+        {
+            // Luminance, base + offset.
+            const int l0 = (v[0] >> 2) | (v[1] & 0xC0);
+            const int l1 = l0 + (v[1] & 0x3F);
+            SetEndpoint(endpoint0, l0, l0, l0, 0xFF);
+            SetEndpoint(endpoint1, l1, l1, l1, 0xFF);
+            break;
+        }
+        case 4:
+            // Luminance-alpha, direct.
+            SetEndpoint(endpoint0, v[0], v[0], v[0], v[2]);
+            SetEndpoint(endpoint1, v[1], v[1], v[1], v[3]);
+            break;
+        case 5:
+            // Luminance-alpha, base + offset.
+            BitTransferSigned(&v[1], &v[0]);
+            BitTransferSigned(&v[3], &v[2]);
+            SetEndpoint(endpoint0, v[0], v[0], v[0], v[2]);
+            SetEndpoint(endpoint1, v[0] + v[1], v[0] + v[1], v[0] + v[1], v[2] + v[3]);
+            break;
+        case 6:
+            // RGB, base + scale.
+            SetEndpoint(endpoint0, (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8, (v[2] * v[3]) >> 8,
+                        0xFF);
+            SetEndpoint(endpoint1, v[0], v[1], v[2], 0xFF);
+            break;
+        case 8:
+        case 12:
+        {
+            // RGB(A), direct.
+            const int a0 = mode == 12 ? v[6] : 0xFF;
+            const int a1 = mode == 12 ? v[7] : 0xFF;
+            if (v[1] + v[3] + v[5] >= v[0] + v[2] + v[4])
+            {
+                SetEndpoint(endpoint0, v[0], v[2], v[4], a0);
+                SetEndpoint(endpoint1, v[1], v[3], v[5], a1);
+            }
+            else
+            {
+                SetBlueContractedEndpoint(endpoint0, v[1], v[3], v[5], a1);
+                SetBlueContractedEndpoint(endpoint1, v[0], v[2], v[4], a0);
+            }
+            break;
+        }
+        case 9:
+        case 13:
+        {
+            // RGB(A), base + offset.
+            BitTransferSigned(&v[1], &v[0]);
+            BitTransferSigned(&v[3], &v[2]);
+            BitTransferSigned(&v[5], &v[4]);
+            int a0 = 0xFF;
+            int a1 = 0xFF;
+            if (mode == 13)
+            {
+                BitTransferSigned(&v[7], &v[6]);
+                a0 = v[6];
+                a1 = v[6] + v[7];
+            }
+            if (v[1] + v[3] + v[5] >= 0)
+            {
+                SetEndpoint(endpoint0, v[0], v[2], v[4], a0);
+                SetEndpoint(endpoint1, v[0] + v[1], v[2] + v[3], v[4] + v[5], a1);
+            }
+            else
+            {
+                SetBlueContractedEndpoint(endpoint0, v[0] + v[1], v[2] + v[3], v[4] + v[5], a1);
+                SetBlueContractedEndpoint(endpoint1, v[0], v[2], v[4], a0);
+            }
+            break;
+        }
+        case 10:
+            // RGB, base + scale, plus two alphas.
+            SetEndpoint(endpoint0, (v[0] * v[3]) >> 8, (v[1] * v[3]) >> 8, (v[2] * v[3]) >> 8,
+                        v[4]);
+            SetEndpoint(endpoint1, v[0], v[1], v[2], v[5]);
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+
+    for (uint32_t channel = 0; channel < 4; ++channel)
+    {
+        endpoint0[channel] = std::clamp(endpoint0[channel], 0, 0xFF);
+        endpoint1[channel] = std::clamp(endpoint1[channel], 0, 0xFF);
+    }
+}
+
+void FillBlock(const uint8_t *color, uint32_t texelCount, uint8_t *texelsOut)
+{
+    for (uint32_t texel = 0; texel < texelCount; ++texel)
+    {
+        memcpy(texelsOut + texel * 4, color, 4);
+    }
+}
+
+// Decodes a block to |blockWidth| x |blockHeight| RGBA8 texels.
+void DecodeBlock(const uint8_t *block,
+                 uint32_t blockWidth,
+                 uint32_t blockHeight,
+                 bool isSRGB,
+                 uint8_t *texelsOut)
+{
+    const uint32_t texelCount = blockWidth * blockHeight;
+    const uint32_t mode       = GetBits(block, 0, 11);
+
+    // Void-extent blocks have a single color, given as UNORM16 values.
+    if ((mode & 0x1FF) == 0x1FC)
+    {
+        if (Bit(mode, 9))
+        {
+            // HDR void-extent blocks are not part of the LDR profile.
+            FillBlock(kErrorColor, texelCount, texelsOut);
+            return;
+        }
+
+        uint8_t color[4];
+        for (uint32_t channel = 0; channel < 4; ++channel)
+        {
+            color[channel] = static_cast<uint8_t>(GetBits(block, 64 + channel * 16, 16) >> 8);
+        }
+        FillBlock(color, texelCount, texelsOut);
+        return;
+    }
+
+    BlockMode blockMode;
+    if (!DecodeBlockMode(mode, &blockMode) || blockMode.gridWidth > blockWidth ||
+        blockMode.gridHeight > blockHeight)
+    {
+        FillBlock(kErrorColor, texelCount, texelsOut);
+        return;
+    }
+
+    const uint32_t partitionCount = GetBits(block, 11, 2) + 1;
+    const uint32_t planeCount     = blockMode.dualPlane ? 2 : 1;
+    const uint32_t weightCount    = blockMode.gridWidth * blockMode.gridHeight * planeCount;
+    const uint32_t weightBits     = GetSequenceBitCount(blockMode.weightRange, weightCount);
+    if (weightCount > kMaxWeightCount || weightBits < kMinWeightBits ||
+        weightBits > kMaxWeightBits || (partitionCount == 4 && blockMode.dualPlane))
+    {
+        FillBlock(kErrorColor, texelCount, texelsOut);
+        return;
+    }
+
+    // Decode the endpoint modes.  With multiple partitions, the modes either share the same value,
+    // or are encoded relative to a base class, with the high bits of the encoding stored right
+    // below the weights.
+    uint32_t endpointModes[4];
+    uint32_t partitionSeed        = 0;
+    uint32_t colorStart           = 17;
+    uint32_t belowWeightsPosition = 128 - weightBits;
+    if (partitionCount == 1)
+    {
+        endpointModes[0] = GetBits(block, 13, 4);
+    }
+    else
+    {
+        partitionSeed        = GetBits(block, 13, 10);
+        colorStart           = 29;
+        const uint32_t field = GetBits(block, 23, 6);
+        if ((field & 3) == 0)
+        {
+            std::fill(endpointModes, endpointModes + partitionCount, field >> 2);
+        }
+        else
+        {
+            const uint32_t extraBits = 3 * partitionCount - 4;
+            belowWeightsPosition -= extraBits;
+            const uint32_t encoded =
+                (field >> 2) | (GetBits(block, belowWeightsPosition, extraBits) << 4);
+            const uint32_t baseClass = (field & 3) - 1;
+            for (uint32_t partition = 0; partition < partitionCount; ++partition)
+            {
+                const uint32_t endpointClass = baseClass + Bit(encoded, partition);
+                const uint32_t modeBits      = (encoded >> (partitionCount + 2 * partition)) & 3;
+                endpointModes[partition]     = (endpointClass << 2) | modeBits;
+            }
+        }
+    }
+
+    // The component that uses the second plane of weights is stored below the rest.
+    uint32_t secondPlaneComponent = 0;
+    if (blockMode.dualPlane)
+    {
+        belowWeightsPosition -= 2;
+        secondPlaneComponent = GetBits(block, belowWeightsPosition, 2);
+    }
+
+    uint32_t colorValueCount = 0;
+    for (uint32_t partition = 0; partition < partitionCount; ++partition)
+    {
+        if (IsHDREndpointMode(endpointModes[partition]))
+        {
+            FillBlock(kErrorColor, texelCount, texelsOut);
+            return;
+        }
+        colorValueCount += ((endpointModes[partition] >> 2) + 1) * 2;
+    }
+
+    if (colorValueCount > kMaxColorValueCount || belowWeightsPosition < colorStart)
+    {
+        FillBlock(kErrorColor, texelCount, texelsOut);
+        return;
+    }
+
+    // The color endpoints use the largest range that fits in the remaining bits.
+    const uint32_t colorBits = belowWeightsPosition - colorStart;
+    size_t colorRangeIndex   = ArraySize(kColorRanges);
+    while (colorRangeIndex > kMinColorRangeIndex &&
+           GetSequenceBitCount(kColorRanges[colorRangeIndex - 1], colorValueCount) > colorBits)
+    {
+        --colorRangeIndex;
+    }
+    if (colorRangeIndex == kMinColorRangeIndex)
+    {
+        FillBlock(kErrorColor, texelCount, texelsOut);
+        return;
+    }
+    const QuantizationRange &colorRange = kColorRanges[colorRangeIndex - 1];
+
+    uint32_t colorValues[kMaxColorValueCount];
+    BitReader colorReader(block, colorStart,
+                          colorStart + GetSequenceBitCount(colorRange, colorValueCount));
+    DecodeIntegerSequence(&colorReader, colorRange, colorValueCount, colorValues);
+    for (uint32_t i = 0; i < colorValueCount; ++i)
+    {
+        colorValues[i] = UnquantizeColor(colorRange, colorValues[i]);
+    }
+
+    int endpoints[4][2][4];
+    const uint32_t *partitionValues = colorValues;
+    for (uint32_t partition = 0; partition < partitionCount; ++partition)
+    {
+        const uint32_t endpointMode = endpointModes[partition];
+        DecodeEndpoints(endpointMode, partitionValues, endpoints[partition][0],
+                        endpoints[partition][1]);
+        partitionValues += ((endpointMode >> 2) + 1) * 2;
+    }
+
+    // The weights are stored from the top of the block, with their bits reversed.
+    uint8_t reversedBlock[kASTCBlockSize];
+    for (size_t i = 0; i < kASTCBlockSize; ++i)
+    {
+        reversedBlock[i] = ReverseBits(block[kASTCBlockSize - 1 - i]);
+    }
+
+    uint32_t weights[kMaxWeightCount];
+    BitReader weightReader(reversedBlock, 0, weightBits);
+    DecodeIntegerSequence(&weightReader, blockMode.weightRange, weightCount, weights);
+    for (uint32_t i = 0; i < weightCount; ++i)
+    {
+        weights[i] = UnquantizeWeight(blockMode.weightRange, weights[i]);
+    }
+
+    // Infill the weights of the grid to the texels, and interpolate the endpoints.
+    const uint32_t gridWidth  = blockMode.gridWidth;
+    const uint32_t gridHeight = blockMode.gridHeight;
+    const uint32_t scaleX     = (1024 + blockWidth / 2) / (blockWidth - 1);
+    const uint32_t scaleY     = (1024 + blockHeight / 2) / (blockHeight - 1);
+
+    for (uint32_t t = 0; t < blockHeight; ++t)
+    {
+        for (uint32_t s = 0; s < blockWidth; ++s)
+        {
+            const uint32_t gridS = (scaleX * s * (gridWidth - 1) + 32) >> 6;
+            const uint32_t gridT = (scaleY * t * (gridHeight - 1) + 32) >> 6;
+            const uint32_t js    = gridS >> 4;
+            const uint32_t fs    = gridS & 0xF;
+            const uint32_t jt    = gridT >> 4;
+            const uint32_t ft    = gridT & 0xF;
+
+            const uint32_t w11 = (fs * ft + 8) >> 4;
+            const uint32_t w10 = ft - w11;
+            const uint32_t w01 = fs - w11;
+            const uint32_t w00 = 16 - fs - ft + w11;
+
+            // Grid points past the edges have a zero factor, so clamp their indices.
+            const uint32_t x0 = js;
+            const uint32_t x1 = std::min(js + 1, gridWidth - 1);
+            const uint32_t y0 = jt;
+            const uint32_t y1 = std::min(jt + 1, gridHeight - 1);
+
+            uint32_t texelWeights[2];
+            for (uint32_t plane = 0; plane < planeCount; ++plane)
+            {
+                auto gridWeight = [&](uint32_t x, uint32_t y) {
+                    return weights[(y * gridWidth + x) * planeCount + plane];
+                };
+                texelWeights[plane] = (gridWeight(x0, y0) * w00 + gridWeight(x1, y0) * w01 +
+                                       gridWeight(x0, y1) * w10 + gridWeight(x1, y1) * w11 + 8) >>
+                                      4;
+            }
+
+            const uint32_t partition =
+                partitionCount > 1 ? SelectPartition(partitionSeed, s, t, partitionCount,
+                                                     texelCount < 31)
+                                   : 0;
+            const int(&endpoint0)[4] = endpoints[partition][0];
+            const int(&endpoint1)[4] = endpoints[partition][1];
+
+            uint8_t *texel = texelsOut + (t * blockWidth + s) * 4;
+            for (uint32_t channel = 0; channel < 4; ++channel)
+            {
+                const uint32_t weight = (blockMode.dualPlane && channel == secondPlaneComponent)
+                                            ? texelWeights[1]
+                                            : texelWeights[0];
+
+                // The endpoints are expanded to 16 bits.  With sRGB, color channels are expanded
+                // by appending 0x80 instead of replicating the bits.
+                const uint32_t c0        = static_cast<uint32_t>(endpoint0[channel]);
+                const uint32_t c1        = static_cast<uint32_t>(endpoint1[channel]);
+                const bool srgbChannel   = isSRGB && channel < 3;
+                const uint32_t expanded0 = (c0 << 8) | (srgbChannel ? 0x80 : c0);
+                const uint32_t expanded1 = (c1 << 8) | (srgbChannel ? 0x80 : c1);
+
+                const uint32_t value = (expanded0 * (64 - weight) + expanded1 * weight + 32) >> 6;
+                texel[channel]       = static_cast<uint8_t>(value >> 8);
+            }
+        }
+    }
+}
+}  // anonymous namespace
+
+void LoadASTCToRGBA8Inner(size_t width,
+                          size_t height,
+                          size_t depth,
+                          uint32_t blockWidth,
+                          uint32_t blockHeight,
+                          bool isSRGB,
+                          const uint8_t *input,
+                          size_t inputRowPitch,
+                          size_t inputDepthPitch,
+                          uint8_t *output,
+                          size_t outputRowPitch,
+                          size_t outputDepthPitch)
+{
+    ASSERT(blockWidth * blockHeight <= kMaxBlockTexels);
+    uint8_t texels[kMaxBlockTexels * 4];
+
+    for (size_t z = 0; z < depth; z++)
+    {
+        for (size_t y = 0; y < height; y += blockHeight)
+        {
+            const uint8_t *sourceRow = priv::OffsetDataPointer<uint8_t>(
+                input, y / blockHeight, z, inputRowPitch, inputDepthPitch);
+            uint8_t *destRow =
+                priv::OffsetDataPointer<uint8_t>(output, y, z, outputRowPitch, outputDepthPitch);
+            const size_t rowCount = std::min<size_t>(blockHeight, height - y);
+
+            for (size_t x = 0; x < width; x += blockWidth)
+            {
+                DecodeBlock(sourceRow + (x / blockWidth) * kASTCBlockSize, blockWidth, blockHeight,
+                            isSRGB, texels);
+
+                const size_t columnCount = std::min<size_t>(blockWidth, width - x);
+                for (size_t row = 0; row < rowCount; ++row)
+                {
+                    memcpy(destRow + row * outputRowPitch + x * 4, texels + row * blockWidth * 4,
+                           columnCount * 4);
+                }
+            }
+        }
+    }
+}
+
+}  // namespace angle
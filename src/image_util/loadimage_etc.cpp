@@ -64,20 +64,24 @@ struct ETC2Block
                                    size_t destRowPitch,
                                    bool isSigned) const
     {
+        // A single channel block only decodes to eight distinct values.
+        const int *modifiers = getSingleChannelModifiers();
+        const int codeword   = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
+        uint8_t decodedValues[8];
+        for (size_t index = 0; index < 8; index++)
+        {
+            const int value = codeword + modifiers[index] * u.scblk.multiplier;
+            decodedValues[index] =
+                isSigned ? static_cast<uint8_t>(clampSByte(value)) : clampByte(value);
+        }
+
+        const uint64_t indexBits = getSingleChannelIndexBits();
         for (size_t j = 0; j < 4 && (y + j) < h; j++)
         {
             uint8_t *row = dest + (j * destRowPitch);
             for (size_t i = 0; i < 4 && (x + i) < w; i++)
             {
-                uint8_t *pixel = row + (i * destPixelStride);
-                if (isSigned)
-                {
-                    *pixel = clampSByte(getSingleETC2Channel(i, j, isSigned));
-                }
-                else
-                {
-                    *pixel = clampByte(getSingleETC2Channel(i, j, isSigned));
-                }
+                row[i * destPixelStride] = decodedValues[GetSingleChannelIndex(indexBits, i, j)];
             }
         }
     }
@@ -93,27 +97,37 @@ struct ETC2Block
                                   bool isSigned,
                                   bool isFloat) const
     {
+        // A single channel block only decodes to eight distinct values, so the renormalization
+        // and float conversion are done once per value instead of once per pixel.
+        const int *modifiers = getSingleChannelModifiers();
+        const int codeword   = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
+        const int multiplier = (u.scblk.multiplier == 0) ? 1 : u.scblk.multiplier * 8;
+        uint16_t decodedValues[8];
+        for (size_t index = 0; index < 8; index++)
+        {
+            const int value = codeword * 8 + 4 + modifiers[index] * multiplier;
+            if (isSigned)
+            {
+                int16_t tempPixel    = renormalizeEAC<int16_t>(value);
+                decodedValues[index] =
+                    isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
+            }
+            else
+            {
+                uint16_t tempPixel   = renormalizeEAC<uint16_t>(value);
+                decodedValues[index] =
+                    isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
+            }
+        }
+
+        const uint64_t indexBits = getSingleChannelIndexBits();
         for (size_t j = 0; j < 4 && (y + j) < h; j++)
         {
             uint16_t *row = reinterpret_cast<uint16_t *>(reinterpret_cast<uint8_t *>(dest) +
                                                          (j * destRowPitch));
             for (size_t i = 0; i < 4 && (x + i) < w; i++)
             {
-                uint16_t *pixel = row + (i * destPixelStride);
-                if (isSigned)
-                {
-                    int16_t tempPixel =
-                        renormalizeEAC<int16_t>(getSingleEACChannel(i, j, isSigned));
-                    *pixel =
-                        isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
-                }
-                else
-                {
-                    uint16_t tempPixel =
-                        renormalizeEAC<uint16_t>(getSingleEACChannel(i, j, isSigned));
-                    *pixel =
-                        isFloat ? gl::float32ToFloat16(float(gl::normalize(tempPixel))) : tempPixel;
-                }
+                row[i * destPixelStride] = decodedValues[GetSingleChannelIndex(indexBits, i, j)];
             }
         }
     }
@@ -1334,48 +1348,28 @@ struct ETC2Block
     }
 
     // Single channel utility functions
-    int getSingleEACChannel(size_t x, size_t y, bool isSigned) const
-    {
-        int codeword   = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
-        int multiplier = (u.scblk.multiplier == 0) ? 1 : u.scblk.multiplier * 8;
-        return codeword * 8 + 4 + getSingleChannelModifier(x, y) * multiplier;
-    }
-
-    int getSingleETC2Channel(size_t x, size_t y, bool isSigned) const
+    // Returns the 48 bits of 3-bit modifier indices of a single channel block.  They are stored
+    // big-endian after the base codeword and table index, starting with pixel (0, 0) and going
+    // down each column.
+    uint64_t getSingleChannelIndexBits() const
     {
-        int codeword = isSigned ? u.scblk.base_codeword.s : u.scblk.base_codeword.us;
-        return codeword + getSingleChannelModifier(x, y) * u.scblk.multiplier;
+        const uint8_t *indexBytes = reinterpret_cast<const uint8_t *>(&u.scblk) + 2;
+        uint64_t indexBits        = 0;
+        for (size_t byteIndex = 0; byteIndex < 6; byteIndex++)
+        {
+            indexBits = (indexBits << 8) | indexBytes[byteIndex];
+        }
+        return indexBits;
     }
 
-    int getSingleChannelIndex(size_t x, size_t y) const
+    static size_t GetSingleChannelIndex(uint64_t indexBits, size_t x, size_t y)
     {
         ASSERT(x < 4 && y < 4);
-
-        // clang-format off
-        switch (x * 4 + y)
-        {
-            case 0: return u.scblk.ma;
-            case 1: return u.scblk.mb;
-            case 2: return u.scblk.mc1 << 1 | u.scblk.mc2;
-            case 3: return u.scblk.md;
-            case 4: return u.scblk.me;
-            case 5: return u.scblk.mf1 << 2 | u.scblk.mf2;
-            case 6: return u.scblk.mg;
-            case 7: return u.scblk.mh;
-            case 8: return u.scblk.mi;
-            case 9: return u.scblk.mj;
-            case 10: return u.scblk.mk1 << 1 | u.scblk.mk2;
-            case 11: return u.scblk.ml;
-            case 12: return u.scblk.mm;
-            case 13: return u.scblk.mn1 << 2 | u.scblk.mn2;
-            case 14: return u.scblk.mo;
-            case 15: return u.scblk.mp;
-            default: UNREACHABLE(); return 0;
-        }
-        // clang-format on
+        return static_cast<size_t>(indexBits >> (45 - (x * 4 + y) * 3)) & 7;
     }
 
-    int getSingleChannelModifier(size_t x, size_t y) const
+    // Returns the eight modifiers selected by the table index of a single channel block.
+    const int *getSingleChannelModifiers() const
     {
         // clang-format off
         static const int modifierTable[16][8] =
@@ -1399,7 +1393,7 @@ struct ETC2Block
         };
         // clang-format on
 
-        return modifierTable[u.scblk.table_index][getSingleChannelIndex(x, y)];
+        return modifierTable[u.scblk.table_index];
     }
 };
 
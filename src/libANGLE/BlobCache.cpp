@@ -8,10 +8,16 @@
 // disk.  MemoryProgramCache uses this to handle caching of compiled programs.
 
 #include "libANGLE/BlobCache.h"
+
+#include <algorithm>
+
 #include "common/utilities.h"
+#include "libANGLE/BlobCacheFileStore.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/histogram_macros.h"
+#include "libANGLE/trace.h"
 #include "platform/PlatformMethods.h"
 
 #define USE_SYSTEM_ZLIB
@@ -30,6 +36,46 @@ enum CacheResult
     kCacheResultMax,
 };
 
+// The share of the internal cache that the protected segment can take.
+constexpr size_t kProtectedSegmentPercent = 80;
+
+size_t GetProtectedSegmentSize(size_t maxCacheSizeBytes)
+{
+    return maxCacheSizeBytes / 100 * kProtectedSegmentPercent +
+           maxCacheSizeBytes % 100 * kProtectedSegmentPercent / 100;
+}
+
+class CompressAndPutBlobTask : public angle::Closure
+{
+  public:
+    CompressAndPutBlobTask(BlobCache *blobCache,
+                           std::mutex *cacheMutex,
+                           const BlobCache::Key &key,
+                           angle::MemoryBuffer &&value)
+        : mBlobCache(blobCache), mCacheMutex(cacheMutex), mKey(key), mValue(std::move(value))
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "CompressAndPutBlob");
+
+        angle::MemoryBuffer compressedData;
+        if (!CompressBlobCacheData(mValue.size(), mValue.data(), &compressedData))
+        {
+            ERR() << "Error compressing blob cache data.";
+            return;
+        }
+
+        std::lock_guard<std::mutex> cacheLock(*mCacheMutex);
+        mBlobCache->put(mKey, std::move(compressedData));
+    }
+
+  private:
+    BlobCache *mBlobCache;
+    std::mutex *mCacheMutex;
+    BlobCache::Key mKey;
+    angle::MemoryBuffer mValue;
+};
 }  // anonymous namespace
 
 // In oder to store more cache in blob cache, compress cacheData to compressedData
@@ -101,10 +147,19 @@ bool DecompressBlobCacheData(const uint8_t *compressedData,
 }
 
 BlobCache::BlobCache(size_t maxCacheSizeBytes)
-    : mBlobCache(maxCacheSizeBytes), mSetBlobFunc(nullptr), mGetBlobFunc(nullptr)
+    : mProbationaryCache(maxCacheSizeBytes),
+      mProtectedCache(GetProtectedSegmentSize(maxCacheSizeBytes)),
+      mHitCount(0),
+      mMissCount(0),
+      mEvictionCount(0),
+      mSetBlobFunc(nullptr),
+      mGetBlobFunc(nullptr)
 {}
 
-BlobCache::~BlobCache() {}
+BlobCache::~BlobCache()
+{
+    waitForPendingPuts();
+}
 
 void BlobCache::put(const BlobCache::Key &key, angle::MemoryBuffer &&value)
 {
@@ -119,6 +174,44 @@ void BlobCache::put(const BlobCache::Key &key, angle::MemoryBuffer &&value)
     }
 }
 
+void BlobCache::putCompressedAsync(std::shared_ptr<angle::WorkerThreadPool> workerThreadPool,
+                                   std::mutex *cacheMutex,
+                                   const BlobCache::Key &key,
+                                   angle::MemoryBuffer &&value)
+{
+    // The task takes |cacheMutex|, which the caller is likely holding.
+    ASSERT(workerThreadPool->isAsync());
+
+    auto task = std::make_shared<CompressAndPutBlobTask>(this, cacheMutex, key, std::move(value));
+    std::shared_ptr<angle::WaitableEvent> event = angle::WorkerThreadPool::PostWorkerTask(
+        workerThreadPool, task, angle::WorkerTaskPriority::Low);
+
+    std::lock_guard<std::mutex> lock(mPendingPutsMutex);
+
+    // Forget about the tasks that have already finished.
+    mPendingPuts.erase(std::remove_if(mPendingPuts.begin(), mPendingPuts.end(),
+                                      [](const std::shared_ptr<angle::WaitableEvent> &pending) {
+                                          return pending->isReady();
+                                      }),
+                       mPendingPuts.end());
+    mPendingPuts.push_back(std::move(event));
+}
+
+void BlobCache::waitForPendingPuts()
+{
+    std::vector<std::shared_ptr<angle::WaitableEvent>> pendingPuts;
+    {
+        std::lock_guard<std::mutex> lock(mPendingPutsMutex);
+        pendingPuts = std::move(mPendingPuts);
+        mPendingPuts.clear();
+    }
+
+    for (std::shared_ptr<angle::WaitableEvent> &event : pendingPuts)
+    {
+        event->wait();
+    }
+}
+
 void BlobCache::putApplication(const BlobCache::Key &key, const angle::MemoryBuffer &value)
 {
     std::lock_guard<std::mutex> lock(mBlobCacheMutex);
@@ -134,8 +227,72 @@ void BlobCache::populate(const BlobCache::Key &key, angle::MemoryBuffer &&value,
     newEntry.first  = std::move(value);
     newEntry.second = source;
 
+    const size_t entrySize = newEntry.first.size();
+    if (entrySize > maxSize())
+    {
+        return;
+    }
+
+    mProbationaryCache.eraseByKey(key);
+    mProtectedCache.eraseByKey(key);
+
     // Cache it inside blob cache only if caching inside the application is not possible.
-    mBlobCache.put(key, std::move(newEntry), newEntry.first.size());
+    evictToSize(maxSize() - entrySize);
+    const CacheEntry *entry = mProbationaryCache.put(key, std::move(newEntry), entrySize);
+
+    // The entries that come from disk are already stored in the file, or are stored by the
+    // application.
+    if (mFileStore && source == CacheSource::Memory && entry != nullptr)
+    {
+        storeInFile(key, entry->first);
+    }
+}
+
+void BlobCache::storeInFile(const BlobCache::Key &key, const angle::MemoryBuffer &value)
+{
+    if (mFileStore->append(key, value.data(), value.size()))
+    {
+        return;
+    }
+
+    // The file is full.  Rewrite it with the entries that are still in the cache, the new one
+    // included, which drops the entries that were replaced, removed or evicted since.
+    std::vector<BlobCacheFileStore::EntryPointer> entries;
+    entries.reserve(entryCount());
+    for (size_t index = 0; index < entryCount(); ++index)
+    {
+        const BlobCache::Key *entryKey = nullptr;
+        BlobCache::Value entryValue;
+        if (getAt(index, &entryKey, &entryValue))
+        {
+            entries.emplace_back(entryKey, entryValue);
+        }
+    }
+    mFileStore->rewrite(entries);
+}
+
+void BlobCache::resize(size_t maxCacheSizeBytes)
+{
+    mProbationaryCache.resize(maxCacheSizeBytes);
+    mProtectedCache.resize(GetProtectedSegmentSize(maxCacheSizeBytes));
+}
+
+size_t BlobCache::trim(size_t limit)
+{
+    const size_t initialSize = size();
+    evictToSize(limit);
+    return initialSize - size();
+}
+
+void BlobCache::evictToSize(size_t limit)
+{
+    const size_t initialEntryCount = entryCount();
+
+    const size_t protectedSize = mProtectedCache.size();
+    mProbationaryCache.shrinkToSize(limit > protectedSize ? limit - protectedSize : 0);
+    mProtectedCache.shrinkToSize(limit - mProbationaryCache.size());
+
+    mEvictionCount += initialEntryCount - entryCount();
 }
 
 bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
@@ -149,6 +306,7 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
         EGLsizeiANDROID valueSize = mGetBlobFunc(key.data(), key.size(), nullptr, 0);
         if (valueSize <= 0)
         {
+            mMissCount++;
             return false;
         }
 
@@ -176,15 +334,22 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
 
         *valueOut      = BlobCache::Value(scratchMemory->data(), scratchMemory->size());
         *bufferSizeOut = valueSize;
+        mHitCount++;
         return true;
     }
 
-    // Otherwise we are doing caching internally, so try to find it there
-    const CacheEntry *entry;
-    bool result = mBlobCache.get(key, &entry);
+    // Otherwise we are doing caching internally, so try to find it there.  Other processes that
+    // share the file store may have stored the entry since the file was last read.
+    const CacheEntry *entry = findEntry(key);
+    if (entry == nullptr && mFileStore && loadNewEntriesFromFileStore())
+    {
+        entry = findEntry(key);
+    }
 
-    if (result)
+    if (entry != nullptr)
     {
+        mHitCount++;
+
         if (entry->second == CacheSource::Memory)
         {
             ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheHitMemory,
@@ -201,17 +366,62 @@ bool BlobCache::get(angle::ScratchBuffer *scratchBuffer,
     }
     else
     {
+        mMissCount++;
         ANGLE_HISTOGRAM_ENUMERATION("GPU.ANGLE.ProgramCache.CacheResult", kCacheMiss,
                                     kCacheResultMax);
     }
 
-    return result;
+    return entry != nullptr;
+}
+
+const BlobCache::CacheEntry *BlobCache::findEntry(const BlobCache::Key &key)
+{
+    const CacheEntry *entry = nullptr;
+    bool result             = mProtectedCache.get(key, &entry);
+
+    CacheEntry probationaryEntry;
+    size_t entrySize = 0;
+    if (!result && mProbationaryCache.take(key, &probationaryEntry, &entrySize))
+    {
+        // Promote the entry to the protected segment, making room for it by moving the least
+        // recently used protected entries back to the probationary segment.  The total size of
+        // the cache doesn't change, so nothing is evicted.  Entries that are too large for the
+        // protected segment stay where they are.
+        if (entrySize <= mProtectedCache.maxSize())
+        {
+            while (mProtectedCache.size() + entrySize > mProtectedCache.maxSize())
+            {
+                BlobCache::Key demotedKey;
+                CacheEntry demotedEntry;
+                size_t demotedSize = 0;
+                bool demoted =
+                    mProtectedCache.takeLeastRecentlyUsed(&demotedKey, &demotedEntry, &demotedSize);
+                ASSERT(demoted);
+                mProbationaryCache.put(demotedKey, std::move(demotedEntry), demotedSize);
+            }
+            entry = mProtectedCache.put(key, std::move(probationaryEntry), entrySize);
+        }
+        else
+        {
+            entry = mProbationaryCache.put(key, std::move(probationaryEntry), entrySize);
+        }
+
+        // The memory buffer moved along with the entry, so its data is still where it was.
+        ASSERT(entry != nullptr);
+    }
+
+    return entry;
 }
 
 bool BlobCache::getAt(size_t index, const BlobCache::Key **keyOut, BlobCache::Value *valueOut)
 {
+    // Enumerate the protected entries first, as they are the most likely to be useful.
     const CacheEntry *valueBuf;
-    bool result = mBlobCache.getAt(index, keyOut, &valueBuf);
+    const size_t protectedCount = mProtectedCache.entryCount();
+    bool result =
+        index < protectedCount
+            ? mProtectedCache.getAt(index, keyOut, &valueBuf)
+            : mProbationaryCache.getAt(index - protectedCount, keyOut, &valueBuf);
     if (result)
     {
         *valueOut = BlobCache::Value(valueBuf->first.data(), valueBuf->first.size());
@@ -221,7 +431,52 @@ bool BlobCache::getAt(size_t index, const BlobCache::Key **keyOut, BlobCache::Va
 
 void BlobCache::remove(const BlobCache::Key &key)
 {
-    mBlobCache.eraseByKey(key);
+    mProbationaryCache.eraseByKey(key);
+    mProtectedCache.eraseByKey(key);
+
+    if (mFileStore)
+    {
+        mFileStore->appendRemoval(key);
+    }
+}
+
+bool BlobCache::openFileStore(const std::string &path, size_t maxFileSizeBytes)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "BlobCache::openFileStore");
+
+    mFileStore = std::make_unique<BlobCacheFileStore>();
+
+    std::vector<BlobCacheFileStore::Entry> entries;
+    if (!mFileStore->open(path, maxFileSizeBytes, &entries))
+    {
+        mFileStore.reset();
+        return false;
+    }
+
+    for (BlobCacheFileStore::Entry &entry : entries)
+    {
+        populate(entry.first, std::move(entry.second), CacheSource::Disk);
+    }
+
+    return true;
+}
+
+bool BlobCache::loadNewEntriesFromFileStore()
+{
+    std::vector<BlobCacheFileStore::Entry> entries;
+    mFileStore->readNewEntries(&entries);
+
+    for (BlobCacheFileStore::Entry &entry : entries)
+    {
+        populate(entry.first, std::move(entry.second), CacheSource::Disk);
+    }
+
+    return !entries.empty();
+}
+
+bool BlobCache::isFileStoreOpen() const
+{
+    return mFileStore != nullptr;
 }
 
 void BlobCache::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
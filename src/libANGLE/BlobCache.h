@@ -12,6 +12,10 @@
 
 #include <array>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
 
 #include <anglebase/sha1.h>
 #include "common/MemoryBuffer.h"
@@ -19,6 +23,12 @@
 #include "libANGLE/Error.h"
 #include "libANGLE/SizedMRUCache.h"
 
+namespace angle
+{
+class WaitableEvent;
+class WorkerThreadPool;
+}  // namespace angle
+
 namespace gl
 {
 class Context;
@@ -26,6 +36,8 @@ class Context;
 
 namespace egl
 {
+class BlobCacheFileStore;
+
 // 160-bit SHA-1 hash key used for hasing a program.  BlobCache opts in using fixed keys for
 // simplicity and efficiency.
 static constexpr size_t kBlobCacheKeyLength = angle::base::kSHA1Length;
@@ -96,6 +108,17 @@ class BlobCache final : angle::NonCopyable
     // will be used.  Otherwise the value is cached in this object.
     void put(const BlobCache::Key &key, angle::MemoryBuffer &&value);
 
+    // Compress |value| and store the result in the cache like put(), in a task posted to
+    // |workerThreadPool|, which must be asynchronous.  |cacheMutex| is the mutex the users of the
+    // cache hold while they access it, and is taken by the task before storing the result.
+    void putCompressedAsync(std::shared_ptr<angle::WorkerThreadPool> workerThreadPool,
+                            std::mutex *cacheMutex,
+                            const BlobCache::Key &key,
+                            angle::MemoryBuffer &&value);
+
+    // Wait for the tasks posted by putCompressedAsync() to finish.
+    void waitForPendingPuts();
+
     // Store a key-blob pair in the application cache, only if application callbacks are set.
     void putApplication(const BlobCache::Key &key, const angle::MemoryBuffer &value);
 
@@ -121,25 +144,45 @@ class BlobCache final : angle::NonCopyable
     void remove(const BlobCache::Key &key);
 
     // Empty the cache.
-    void clear() { mBlobCache.clear(); }
+    void clear()
+    {
+        mProbationaryCache.clear();
+        mProtectedCache.clear();
+    }
 
     // Resize the cache. Discards current contents.
-    void resize(size_t maxCacheSizeBytes) { mBlobCache.resize(maxCacheSizeBytes); }
+    void resize(size_t maxCacheSizeBytes);
 
     // Returns the number of entries in the cache.
-    size_t entryCount() const { return mBlobCache.entryCount(); }
+    size_t entryCount() const
+    {
+        return mProbationaryCache.entryCount() + mProtectedCache.entryCount();
+    }
 
     // Reduces the current cache size and returns the number of bytes freed.
-    size_t trim(size_t limit) { return mBlobCache.shrinkToSize(limit); }
+    size_t trim(size_t limit);
 
     // Returns the current cache size in bytes.
-    size_t size() const { return mBlobCache.size(); }
+    size_t size() const { return mProbationaryCache.size() + mProtectedCache.size(); }
 
     // Returns whether the cache is empty
-    bool empty() const { return mBlobCache.empty(); }
+    bool empty() const { return mProbationaryCache.empty() && mProtectedCache.empty(); }
 
     // Returns the maximum cache size in bytes.
-    size_t maxSize() const { return mBlobCache.maxSize(); }
+    size_t maxSize() const { return mProbationaryCache.maxSize(); }
+
+    // Statistics about the lookups in the cache and the entries evicted from this object's cache,
+    // since the cache was created.
+    size_t hitCount() const { return mHitCount; }
+    size_t missCount() const { return mMissCount; }
+    size_t evictionCount() const { return mEvictionCount; }
+
+    // Loads the entries stored in the file at |path| into this object's cache, and from then on
+    // keeps the file up to date with the entries put in the cache.  The file is not used while
+    // application callbacks are set.  The file can be shared with other processes, whose entries
+    // are loaded when a lookup misses.
+    bool openFileStore(const std::string &path, size_t maxFileSizeBytes);
+    bool isFileStoreOpen() const;
 
     void setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get);
 
@@ -148,14 +191,43 @@ class BlobCache final : angle::NonCopyable
     bool isCachingEnabled() const { return areBlobCacheFuncsSet() || maxSize() > 0; }
 
   private:
-    // This internal cache is used only if the application is not providing caching callbacks
     using CacheEntry = std::pair<angle::MemoryBuffer, CacheSource>;
 
+    // Evicts entries from the probationary segment first, then from the protected segment, until
+    // the cache size is at most |limit|.
+    void evictToSize(size_t limit);
+
+    // Looks up an entry in this object's cache, promoting it to the protected segment if found.
+    const CacheEntry *findEntry(const BlobCache::Key &key);
+
+    // Appends a new entry to the file store, rewriting the file when it's full.
+    void storeInFile(const BlobCache::Key &key, const angle::MemoryBuffer &value);
+    // Populates the cache with the entries other processes stored in the file store since it was
+    // last read.  Returns whether there were any.
+    bool loadNewEntriesFromFileStore();
+
     std::mutex mBlobCacheMutex;
-    angle::SizedMRUCache<BlobCache::Key, CacheEntry> mBlobCache;
+
+    // This internal cache is used only if the application is not providing caching callbacks.  It
+    // is a segmented LRU cache: new entries go to the probationary segment, and are promoted to the
+    // protected segment when they are looked up again.  Entries are evicted from the probationary
+    // segment first, so a large blob that is put once can't push out the small entries that are
+    // hit repeatedly.  Entries that don't fit in the protected segment anymore are moved back to
+    // the probationary segment.
+    angle::SizedMRUCache<BlobCache::Key, CacheEntry> mProbationaryCache;
+    angle::SizedMRUCache<BlobCache::Key, CacheEntry> mProtectedCache;
+
+    size_t mHitCount;
+    size_t mMissCount;
+    size_t mEvictionCount;
+
+    std::unique_ptr<BlobCacheFileStore> mFileStore;
 
     EGLSetBlobFuncANDROID mSetBlobFunc;
     EGLGetBlobFuncANDROID mGetBlobFunc;
+
+    std::mutex mPendingPutsMutex;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mPendingPuts;
 };
 
 }  // namespace egl
@@ -0,0 +1,421 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheFileStore: Persists the contents of the BlobCache in a file when the application
+//   doesn't provide EGL_ANDROID_blob_cache callbacks, so the cache survives restarts.  The file
+//   can be shared by several processes.
+
+#include "libANGLE/BlobCacheFileStore.h"
+
+#include <cstring>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+
+#include "common/debug.h"
+#include "common/third_party/xxhash/xxhash.h"
+
+namespace egl
+{
+namespace
+{
+constexpr char kFileMagic[8]     = {'A', 'N', 'G', 'L', 'E', 'B', 'C', '\0'};
+constexpr uint32_t kFileVersion  = 2;
+constexpr uint32_t kRecordMagic  = 0x52424C42;  // "BLBR"
+constexpr uint32_t kRemovalMagic = 0x44424C42;  // "BLBD"
+constexpr uint64_t kChecksumSeed = 0x414E474C45424331;
+
+struct FileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t keyLength;
+    // Changes every time the file is rewritten.
+    uint64_t fileId;
+};
+static_assert(sizeof(FileHeader) == 24, "Unexpected padding in the file header");
+
+struct RecordHeader
+{
+    uint32_t magic;
+    uint32_t valueSize;
+    uint64_t checksum;
+    BlobCache::Key key;
+    uint8_t padding[4];
+};
+static_assert(sizeof(RecordHeader) == 40, "Unexpected padding in the record header");
+
+uint64_t ComputeRecordChecksum(uint32_t magic,
+                               const BlobCache::Key &key,
+                               const uint8_t *data,
+                               size_t size)
+{
+    uint64_t checksum = XXH64(key.data(), key.size(), kChecksumSeed ^ magic);
+    return XXH64(data, size, checksum);
+}
+
+FileHeader MakeFileHeader(uint64_t fileId)
+{
+    FileHeader header = {};
+    memcpy(header.magic, kFileMagic, sizeof(kFileMagic));
+    header.version   = kFileVersion;
+    header.keyLength = static_cast<uint32_t>(BlobCache::kKeyLength);
+    header.fileId    = fileId;
+    return header;
+}
+
+bool IsFileHeaderValid(const FileHeader &header)
+{
+    const FileHeader expectedHeader = MakeFileHeader(header.fileId);
+    return memcmp(&header, &expectedHeader, sizeof(FileHeader)) == 0;
+}
+
+uint64_t GenerateFileId()
+{
+    std::random_device randomDevice;
+    return (static_cast<uint64_t>(randomDevice()) << 32) ^ randomDevice();
+}
+
+// Reads the header of the file at |path| and its contents after |offset|, which is adjusted to the
+// end of the header if the file was rewritten since |fileId|.  If |fileId| is null, the file is
+// read from the start.
+bool ReadCacheFile(const std::string &path,
+                   const uint64_t *fileId,
+                   size_t *offset,
+                   FileHeader *headerOut,
+                   std::vector<uint8_t> *contentsOut)
+{
+    FILE *file = fopen(path.c_str(), "rb");
+    if (file == nullptr)
+    {
+        return false;
+    }
+
+    bool result =
+        fread(headerOut, sizeof(FileHeader), 1, file) == 1 && IsFileHeaderValid(*headerOut);
+    if (result && (fileId == nullptr || *fileId != headerOut->fileId))
+    {
+        *offset = sizeof(FileHeader);
+    }
+
+    result    = result && fseek(file, 0, SEEK_END) == 0;
+    long size = result ? ftell(file) : -1;
+    result    = size >= 0 && static_cast<size_t>(size) >= *offset;
+    result    = result && fseek(file, static_cast<long>(*offset), SEEK_SET) == 0;
+    if (result)
+    {
+        contentsOut->resize(static_cast<size_t>(size) - *offset);
+        result = fread(contentsOut->data(), 1, contentsOut->size(), file) == contentsOut->size();
+    }
+
+    fclose(file);
+    return result;
+}
+
+// Parses the records in |contents| and returns the size of the part of it that is valid.
+size_t ParseRecords(const std::vector<uint8_t> &contents,
+                    std::unordered_map<BlobCache::Key, angle::MemoryBuffer> *entriesOut)
+{
+    size_t offset = 0;
+    while (contents.size() - offset >= sizeof(RecordHeader))
+    {
+        RecordHeader header;
+        memcpy(&header, contents.data() + offset, sizeof(RecordHeader));
+
+        const size_t valueOffset = offset + sizeof(RecordHeader);
+        if ((header.magic != kRecordMagic && header.magic != kRemovalMagic) ||
+            header.valueSize > contents.size() - valueOffset)
+        {
+            break;
+        }
+
+        const uint8_t *value = contents.data() + valueOffset;
+        if (ComputeRecordChecksum(header.magic, header.key, value, header.valueSize) !=
+            header.checksum)
+        {
+            break;
+        }
+
+        if (header.magic == kRemovalMagic)
+        {
+            entriesOut->erase(header.key);
+        }
+        else
+        {
+            angle::MemoryBuffer &buffer = (*entriesOut)[header.key];
+            if (!buffer.resize(header.valueSize))
+            {
+                entriesOut->erase(header.key);
+                break;
+            }
+            memcpy(buffer.data(), value, header.valueSize);
+        }
+
+        offset = valueOffset + header.valueSize;
+    }
+
+    return offset;
+}
+}  // anonymous namespace
+
+BlobCacheFileStore::BlobCacheFileStore()
+    : mFile(nullptr), mFileId(0), mFileSize(0), mMaxFileSize(0), mReadOffset(0)
+{}
+
+BlobCacheFileStore::~BlobCacheFileStore()
+{
+    close();
+}
+
+bool BlobCacheFileStore::open(const std::string &path,
+                              size_t maxFileSizeBytes,
+                              std::vector<Entry> *entriesOut)
+{
+    close();
+
+    mPath        = path;
+    mMaxFileSize = maxFileSizeBytes;
+
+    if (!mFileLock.open((mPath + ".lock").c_str()))
+    {
+        WARN() << "Failed to open the lock of the blob cache file " << mPath;
+        return false;
+    }
+    std::lock_guard<angle::FileLock> lock(mFileLock);
+
+    size_t offset = 0;
+    FileHeader header;
+    std::vector<uint8_t> contents;
+    std::unordered_map<BlobCache::Key, angle::MemoryBuffer> entries;
+    const bool isRead = ReadCacheFile(mPath, nullptr, &offset, &header, &contents);
+    size_t validSize  = isRead ? sizeof(FileHeader) + ParseRecords(contents, &entries) : 0;
+
+    entriesOut->reserve(entries.size());
+    for (auto &entry : entries)
+    {
+        entriesOut->emplace_back(entry.first, std::move(entry.second));
+    }
+
+    if (isRead && validSize == sizeof(FileHeader) + contents.size() && validSize <= mMaxFileSize)
+    {
+        mFile       = fopen(mPath.c_str(), "ab");
+        mFileId     = header.fileId;
+        mFileSize   = validSize;
+        mReadOffset = validSize;
+    }
+    else
+    {
+        // The file is missing, from another version, too large or was cut short by a crash.  Start
+        // over with the entries that could be recovered from it.
+        std::vector<EntryPointer> recovered;
+        for (Entry &entry : *entriesOut)
+        {
+            recovered.emplace_back(&entry.first,
+                                   BlobCache::Value(entry.second.data(), entry.second.size()));
+        }
+        rewriteLocked(recovered);
+    }
+
+    if (mFile == nullptr)
+    {
+        WARN() << "Failed to open the blob cache file " << mPath;
+        return false;
+    }
+
+    return true;
+}
+
+void BlobCacheFileStore::close()
+{
+    closeFile();
+    mFileLock.close();
+}
+
+void BlobCacheFileStore::closeFile()
+{
+    if (mFile != nullptr)
+    {
+        fclose(mFile);
+        mFile = nullptr;
+    }
+    mFileSize = 0;
+}
+
+size_t BlobCacheFileStore::getFileSizeLocked()
+{
+    ASSERT(mFile != nullptr);
+    long size = fseek(mFile, 0, SEEK_END) == 0 ? ftell(mFile) : -1;
+    return size >= 0 ? static_cast<size_t>(size) : mFileSize;
+}
+
+bool BlobCacheFileStore::append(const BlobCache::Key &key, const uint8_t *data, size_t size)
+{
+    if (mFile == nullptr)
+    {
+        return true;
+    }
+
+    if (size > std::numeric_limits<uint32_t>::max())
+    {
+        return true;
+    }
+
+    std::lock_guard<angle::FileLock> lock(mFileLock);
+
+    const size_t fileSize = getFileSizeLocked();
+    if (fileSize + sizeof(RecordHeader) + size > mMaxFileSize)
+    {
+        return false;
+    }
+
+    if (!writeRecord(mFile, kRecordMagic, key, data, size) || fflush(mFile) != 0)
+    {
+        // Stop writing to the file, it would otherwise be cut at the failed record on the next
+        // load anyway.
+        WARN() << "Failed to write to the blob cache file " << mPath;
+        closeFile();
+        return true;
+    }
+
+    mFileSize = fileSize + sizeof(RecordHeader) + size;
+    if (mReadOffset == fileSize)
+    {
+        // No other process appended to the file, so there is nothing new to read before this.
+        mReadOffset = mFileSize;
+    }
+    return true;
+}
+
+void BlobCacheFileStore::appendRemoval(const BlobCache::Key &key)
+{
+    if (mFile == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<angle::FileLock> lock(mFileLock);
+
+    const size_t fileSize = getFileSizeLocked();
+    if (fileSize + sizeof(RecordHeader) > mMaxFileSize)
+    {
+        return;
+    }
+
+    if (!writeRecord(mFile, kRemovalMagic, key, nullptr, 0) || fflush(mFile) != 0)
+    {
+        WARN() << "Failed to write to the blob cache file " << mPath;
+        closeFile();
+        return;
+    }
+
+    mFileSize = fileSize + sizeof(RecordHeader);
+    if (mReadOffset == fileSize)
+    {
+        mReadOffset = mFileSize;
+    }
+}
+
+void BlobCacheFileStore::rewrite(const std::vector<EntryPointer> &entries)
+{
+    std::lock_guard<angle::FileLock> lock(mFileLock);
+    rewriteLocked(entries);
+}
+
+void BlobCacheFileStore::rewriteLocked(const std::vector<EntryPointer> &entries)
+{
+    closeFile();
+
+    // The file is rewritten in place, as other processes may have it open.  A crash in the middle
+    // of the rewrite leaves a file that is cut short, of which the valid records are kept on the
+    // next load.
+    FILE *file = fopen(mPath.c_str(), "wb");
+    if (file == nullptr)
+    {
+        return;
+    }
+
+    const uint64_t fileId       = GenerateFileId();
+    const FileHeader fileHeader = MakeFileHeader(fileId);
+    bool result                 = fwrite(&fileHeader, sizeof(fileHeader), 1, file) == 1;
+    size_t fileSize             = sizeof(fileHeader);
+
+    for (const EntryPointer &entry : entries)
+    {
+        BlobCache::Value value  = entry.second;
+        const size_t recordSize = sizeof(RecordHeader) + value.size();
+        if (!result || fileSize + recordSize > mMaxFileSize)
+        {
+            continue;
+        }
+
+        result = writeRecord(file, kRecordMagic, *entry.first, value.data(), value.size());
+        fileSize += recordSize;
+    }
+
+    result = fclose(file) == 0 && result;
+    if (!result)
+    {
+        WARN() << "Failed to write the blob cache file " << mPath;
+        std::remove(mPath.c_str());
+        return;
+    }
+
+    mFile       = fopen(mPath.c_str(), "ab");
+    mFileId     = fileId;
+    mFileSize   = fileSize;
+    mReadOffset = fileSize;
+}
+
+void BlobCacheFileStore::readNewEntries(std::vector<Entry> *entriesOut)
+{
+    if (mFile == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<angle::FileLock> lock(mFileLock);
+
+    if (getFileSizeLocked() == mReadOffset)
+    {
+        return;
+    }
+
+    // If another process rewrote the file, it's read again from the start.
+    size_t offset = mReadOffset;
+    FileHeader header;
+    std::vector<uint8_t> contents;
+    if (!ReadCacheFile(mPath, &mFileId, &offset, &header, &contents))
+    {
+        return;
+    }
+
+    std::unordered_map<BlobCache::Key, angle::MemoryBuffer> entries;
+    mFileId     = header.fileId;
+    mReadOffset = offset + ParseRecords(contents, &entries);
+
+    entriesOut->reserve(entriesOut->size() + entries.size());
+    for (auto &entry : entries)
+    {
+        entriesOut->emplace_back(entry.first, std::move(entry.second));
+    }
+}
+
+bool BlobCacheFileStore::writeRecord(FILE *file,
+                                     uint32_t magic,
+                                     const BlobCache::Key &key,
+                                     const uint8_t *data,
+                                     size_t size)
+{
+    RecordHeader header = {};
+    header.magic        = magic;
+    header.valueSize    = static_cast<uint32_t>(size);
+    header.key          = key;
+    header.checksum     = ComputeRecordChecksum(magic, key, data, size);
+
+    return fwrite(&header, sizeof(header), 1, file) == 1 &&
+           (size == 0 || fwrite(data, size, 1, file) == 1);
+}
+}  // namespace egl
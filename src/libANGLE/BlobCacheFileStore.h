@@ -0,0 +1,86 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// BlobCacheFileStore: Persists the contents of the BlobCache in a file when the application
+//   doesn't provide EGL_ANDROID_blob_cache callbacks, so the cache survives restarts.  The file
+//   can be shared by several processes, so programs and pipelines compiled in one are found by
+//   the others.
+
+#ifndef LIBANGLE_BLOB_CACHE_FILE_STORE_H_
+#define LIBANGLE_BLOB_CACHE_FILE_STORE_H_
+
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "common/MemoryBuffer.h"
+#include "common/angleutils.h"
+#include "common/system_utils.h"
+#include "libANGLE/BlobCache.h"
+
+namespace egl
+{
+// The file is a header followed by an append-only log of records.  Each record holds a key, the
+// size of its value, a checksum of both and the value itself.  Removing a key appends a record
+// without a value.  When the file is loaded, the last record of each key wins, and the log is cut
+// at the first record that is truncated or fails its checksum, which is what a crash in the middle
+// of an append leaves behind.  When the file would grow past its maximum size, it is rewritten
+// with the entries the caller still holds.
+//
+// The processes that share the file take a lock on a file next to it while they access it.  The
+// file is rewritten in place, with a new identifier in its header, so the other processes keep
+// appending to it and know to read it again from the start.
+class BlobCacheFileStore final : angle::NonCopyable
+{
+  public:
+    using Entry        = std::pair<BlobCache::Key, angle::MemoryBuffer>;
+    using EntryPointer = std::pair<const BlobCache::Key *, BlobCache::Value>;
+
+    BlobCacheFileStore();
+    ~BlobCacheFileStore();
+
+    // Opens or creates the file at |path| and returns the entries stored in it in |entriesOut|.
+    bool open(const std::string &path, size_t maxFileSizeBytes, std::vector<Entry> *entriesOut);
+    void close();
+    bool isOpen() const { return mFile != nullptr; }
+
+    // Appends a record to the file.  Returns false if the file would grow past its maximum size,
+    // in which case the caller is expected to rewrite() it.
+    ANGLE_NO_DISCARD bool append(const BlobCache::Key &key, const uint8_t *data, size_t size);
+    void appendRemoval(const BlobCache::Key &key);
+
+    // Replaces the contents of the file with |entries|, dropping the ones that don't fit.
+    void rewrite(const std::vector<EntryPointer> &entries);
+
+    // Returns in |entriesOut| the entries that other processes stored in the file since it was
+    // last read.
+    void readNewEntries(std::vector<Entry> *entriesOut);
+
+    size_t fileSize() const { return mFileSize; }
+
+  private:
+    void closeFile();
+    void rewriteLocked(const std::vector<EntryPointer> &entries);
+    // Returns the size of the file, records appended by other processes included.
+    size_t getFileSizeLocked();
+    bool writeRecord(FILE *file,
+                     uint32_t magic,
+                     const BlobCache::Key &key,
+                     const uint8_t *data,
+                     size_t size);
+
+    std::string mPath;
+    angle::FileLock mFileLock;
+    FILE *mFile;
+    uint64_t mFileId;
+    size_t mFileSize;
+    size_t mMaxFileSize;
+    // The end of the records that were read from the file, or appended by this object after them.
+    size_t mReadOffset;
+};
+}  // namespace egl
+
+#endif  // LIBANGLE_BLOB_CACHE_FILE_STORE_H_
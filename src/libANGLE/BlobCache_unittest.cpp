@@ -7,6 +7,8 @@
 
 #include <gtest/gtest.h>
 
+#include <cstdio>
+
 #include "libANGLE/BlobCache.h"
 
 namespace egl
@@ -131,4 +133,182 @@ TEST(BlobCacheTest, OversizeValue)
     EXPECT_FALSE(blobCache.get(nullptr, MakeKey(5), &qvalue, &blobSize));
 }
 
+// Tests that a large value that is put once doesn't evict the small values that are being used.
+TEST(BlobCacheTest, LargeValueDoesNotEvictHotValues)
+{
+    constexpr size_t kSize = 100;
+    BlobCache blobCache(kSize);
+
+    Blob qvalue;
+    size_t blobSize;
+
+    // Put a few small values and use them, which protects them.
+    for (uint8_t value = 0; value < 4; ++value)
+    {
+        blobCache.populate(MakeKey(value), MakeBlob(10, value));
+        EXPECT_TRUE(blobCache.get(nullptr, MakeKey(value), &qvalue, &blobSize));
+    }
+
+    // Put a few small values that are never used.
+    for (uint8_t value = 4; value < 8; ++value)
+    {
+        blobCache.populate(MakeKey(value), MakeBlob(10, value));
+    }
+    EXPECT_EQ(80u, blobCache.size());
+    EXPECT_EQ(0u, blobCache.evictionCount());
+
+    // Putting a large value evicts the values that were never used, starting with the oldest.
+    blobCache.populate(MakeKey(100), MakeBlob(50, 100));
+    EXPECT_EQ(100u, blobCache.size());
+    EXPECT_EQ(3u, blobCache.evictionCount());
+
+    for (uint8_t value = 0; value < 4; ++value)
+    {
+        EXPECT_TRUE(blobCache.get(nullptr, MakeKey(value), &qvalue, &blobSize));
+        EXPECT_EQ(10u, blobSize);
+        EXPECT_EQ(value, qvalue[0]);
+    }
+    for (uint8_t value = 4; value < 7; ++value)
+    {
+        EXPECT_FALSE(blobCache.get(nullptr, MakeKey(value), &qvalue, &blobSize));
+    }
+    EXPECT_TRUE(blobCache.get(nullptr, MakeKey(7), &qvalue, &blobSize));
+
+    // Using the large value protects it too, which moves the least recently used protected values
+    // back to the probationary segment.
+    EXPECT_TRUE(blobCache.get(nullptr, MakeKey(100), &qvalue, &blobSize));
+    EXPECT_EQ(50u, blobSize);
+    EXPECT_EQ(100u, qvalue[0]);
+    EXPECT_EQ(100u, blobCache.size());
+
+    EXPECT_EQ(10u, blobCache.hitCount());
+    EXPECT_EQ(3u, blobCache.missCount());
+
+    // Trimming the cache evicts the probationary values first.
+    EXPECT_EQ(30u, blobCache.trim(70));
+    EXPECT_EQ(70u, blobCache.size());
+    EXPECT_EQ(3u, blobCache.entryCount());
+    EXPECT_EQ(6u, blobCache.evictionCount());
+    EXPECT_FALSE(blobCache.get(nullptr, MakeKey(0), &qvalue, &blobSize));
+    EXPECT_FALSE(blobCache.get(nullptr, MakeKey(1), &qvalue, &blobSize));
+    EXPECT_FALSE(blobCache.get(nullptr, MakeKey(2), &qvalue, &blobSize));
+    EXPECT_TRUE(blobCache.get(nullptr, MakeKey(3), &qvalue, &blobSize));
+    EXPECT_TRUE(blobCache.get(nullptr, MakeKey(100), &qvalue, &blobSize));
+}
+
+// Test that the entries put in the cache are loaded back from the file store, and that a record
+// that was cut short is ignored.
+TEST(BlobCacheTest, FileStore)
+{
+    const std::string path = ::testing::TempDir() + "BlobCacheTest_FileStore.bin";
+    std::remove(path.c_str());
+
+    {
+        BlobCache blobCache(100);
+        ASSERT_TRUE(blobCache.openFileStore(path, 1000));
+        blobCache.put(MakeKey(0), MakeBlob(10, 0));
+        blobCache.put(MakeKey(1), MakeBlob(10, 1));
+        blobCache.put(MakeKey(2), MakeBlob(10, 2));
+        blobCache.remove(MakeKey(1));
+    }
+
+    // Leave a partial record behind, like a crash in the middle of an append would.
+    FILE *file = fopen(path.c_str(), "ab");
+    ASSERT_NE(nullptr, file);
+    const uint8_t partialRecord[7] = {};
+    EXPECT_EQ(1u, fwrite(partialRecord, sizeof(partialRecord), 1, file));
+    fclose(file);
+
+    {
+        BlobCache blobCache(100);
+        ASSERT_TRUE(blobCache.openFileStore(path, 1000));
+        EXPECT_EQ(2u, blobCache.entryCount());
+
+        Blob blob;
+        size_t blobSize;
+        EXPECT_TRUE(blobCache.get(nullptr, MakeKey(0), &blob, &blobSize));
+        EXPECT_EQ(10u, blobSize);
+        EXPECT_EQ(0u, blob[0]);
+        EXPECT_FALSE(blobCache.get(nullptr, MakeKey(1), &blob, &blobSize));
+        EXPECT_TRUE(blobCache.get(nullptr, MakeKey(2), &blob, &blobSize));
+        EXPECT_EQ(2u, blob[0]);
+    }
+
+    std::remove(path.c_str());
+    std::remove((path + ".lock").c_str());
+}
+
+// Test that a full file store is rewritten with the entries still in the cache.
+TEST(BlobCacheTest, FileStoreRewrite)
+{
+    const std::string path = ::testing::TempDir() + "BlobCacheTest_FileStoreRewrite.bin";
+    std::remove(path.c_str());
+
+    // The file header takes 24 bytes, and every record 40 bytes plus its value.
+    constexpr size_t kFileSize = 24 + 3 * (40 + 10);
+
+    {
+        // The cache holds two entries and the file three, so adding a fourth entry rewrites the
+        // file with the last two.
+        BlobCache blobCache(20);
+        ASSERT_TRUE(blobCache.openFileStore(path, kFileSize));
+        for (uint8_t key = 0; key < 4; ++key)
+        {
+            blobCache.put(MakeKey(key), MakeBlob(10, key));
+        }
+    }
+
+    BlobCache blobCache(100);
+    ASSERT_TRUE(blobCache.openFileStore(path, kFileSize));
+    EXPECT_EQ(2u, blobCache.entryCount());
+
+    Blob blob;
+    size_t blobSize;
+    EXPECT_FALSE(blobCache.get(nullptr, MakeKey(1), &blob, &blobSize));
+    EXPECT_TRUE(blobCache.get(nullptr, MakeKey(2), &blob, &blobSize));
+    EXPECT_TRUE(blobCache.get(nullptr, MakeKey(3), &blob, &blobSize));
+
+    std::remove(path.c_str());
+    std::remove((path + ".lock").c_str());
+}
+
+// Test that entries stored in a shared file store by another cache are found, including after the
+// other cache rewrote the file.
+TEST(BlobCacheTest, FileStoreShared)
+{
+    const std::string path = ::testing::TempDir() + "BlobCacheTest_FileStoreShared.bin";
+    std::remove(path.c_str());
+
+    constexpr size_t kFileSize = 24 + 3 * (40 + 10);
+
+    BlobCache writer(20);
+    BlobCache reader(100);
+    ASSERT_TRUE(writer.openFileStore(path, kFileSize));
+    ASSERT_TRUE(reader.openFileStore(path, kFileSize));
+
+    Blob blob;
+    size_t blobSize;
+    writer.put(MakeKey(0), MakeBlob(10, 0));
+    EXPECT_TRUE(reader.get(nullptr, MakeKey(0), &blob, &blobSize));
+    EXPECT_EQ(10u, blobSize);
+    EXPECT_EQ(0u, blob[0]);
+
+    // The fourth entry makes the writer rewrite the file with the two entries it holds.
+    for (uint8_t key = 1; key < 4; ++key)
+    {
+        writer.put(MakeKey(key), MakeBlob(10, key));
+    }
+    EXPECT_TRUE(reader.get(nullptr, MakeKey(3), &blob, &blobSize));
+    EXPECT_EQ(3u, blob[0]);
+    EXPECT_FALSE(reader.get(nullptr, MakeKey(4), &blob, &blobSize));
+
+    // Entries put by the reader are found by the writer too.
+    reader.put(MakeKey(4), MakeBlob(10, 4));
+    EXPECT_TRUE(writer.get(nullptr, MakeKey(4), &blob, &blobSize));
+    EXPECT_EQ(4u, blob[0]);
+
+    std::remove(path.c_str());
+    std::remove((path + ".lock").c_str());
+}
+
 }  // namespace egl
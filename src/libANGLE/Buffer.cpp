@@ -11,6 +11,7 @@
 #include "libANGLE/Buffer.h"
 
 #include "libANGLE/Context.h"
+#include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/BufferImpl.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 
@@ -345,14 +346,103 @@ angle::Result Buffer::getIndexRange(const gl::Context *context,
         return angle::Result::Continue;
     }
 
-    ANGLE_TRY(
-        mImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled, outRange));
+    // Only draws that cover whole chunks benefit from their ranges being cached.
+    if (count * GetDrawElementsTypeSize(type) >= IndexRangeCache::kChunkSize * 2)
+    {
+        ANGLE_TRY(getChunkedIndexRange(context, type, offset, count, primitiveRestartEnabled,
+                                       outRange));
+    }
+    else
+    {
+        ANGLE_TRY(
+            mImpl->getIndexRange(context, type, offset, count, primitiveRestartEnabled, outRange));
+    }
 
     mIndexRangeCache.addRange(type, offset, count, primitiveRestartEnabled, *outRange);
 
     return angle::Result::Continue;
 }
 
+angle::Result Buffer::getChunkedIndexRange(const gl::Context *context,
+                                           DrawElementsType type,
+                                           size_t offset,
+                                           size_t count,
+                                           bool primitiveRestartEnabled,
+                                           IndexRange *outRange) const
+{
+    constexpr size_t kChunkSize  = IndexRangeCache::kChunkSize;
+    const size_t typeSize        = GetDrawElementsTypeSize(type);
+    const size_t chunkIndexCount = kChunkSize / typeSize;
+    const size_t end             = offset + count * typeSize;
+    const size_t firstChunk      = rx::roundUp(offset, kChunkSize) / kChunkSize;
+    const size_t lastChunk       = end / kChunkSize;
+    ASSERT(offset % typeSize == 0 && firstChunk < lastChunk);
+
+    size_t minIndex         = std::numeric_limits<size_t>::max();
+    size_t maxIndex         = 0;
+    size_t vertexIndexCount = 0;
+    auto addRange           = [&](const IndexRange &range) {
+        if (range.vertexIndexCount > 0)
+        {
+            minIndex = std::min(minIndex, range.start);
+            maxIndex = std::max(maxIndex, range.end);
+            vertexIndexCount += range.vertexIndexCount;
+        }
+    };
+
+    IndexRange range;
+    if (offset < firstChunk * kChunkSize)
+    {
+        ANGLE_TRY(mImpl->getIndexRange(context, type, offset,
+                                       (firstChunk * kChunkSize - offset) / typeSize,
+                                       primitiveRestartEnabled, &range));
+        addRange(range);
+    }
+
+    // Scan the consecutive chunks that aren't cached at once.
+    std::vector<IndexRange> chunkRanges;
+    size_t chunk = firstChunk;
+    while (chunk < lastChunk)
+    {
+        if (mIndexRangeCache.findChunkRange(type, chunk, primitiveRestartEnabled, &range))
+        {
+            addRange(range);
+            ++chunk;
+            continue;
+        }
+
+        size_t missingChunkCount = 1;
+        while (chunk + missingChunkCount < lastChunk &&
+               !mIndexRangeCache.findChunkRange(type, chunk + missingChunkCount,
+                                                primitiveRestartEnabled, &range))
+        {
+            ++missingChunkCount;
+        }
+
+        chunkRanges.resize(missingChunkCount);
+        ANGLE_TRY(mImpl->getIndexRanges(context, type, chunk * kChunkSize, chunkIndexCount,
+                                        missingChunkCount, primitiveRestartEnabled,
+                                        chunkRanges.data()));
+        for (const IndexRange &chunkRange : chunkRanges)
+        {
+            mIndexRangeCache.addChunkRange(type, chunk++, primitiveRestartEnabled, chunkRange);
+            addRange(chunkRange);
+        }
+    }
+
+    if (lastChunk * kChunkSize < end)
+    {
+        ANGLE_TRY(mImpl->getIndexRange(context, type, lastChunk * kChunkSize,
+                                       (end - lastChunk * kChunkSize) / typeSize,
+                                       primitiveRestartEnabled, &range));
+        addRange(range);
+    }
+
+    *outRange = vertexIndexCount > 0 ? IndexRange(minIndex, maxIndex, vertexIndexCount)
+                                     : IndexRange(0, 0, 0);
+    return angle::Result::Continue;
+}
+
 GLint64 Buffer::getMemorySize() const
 {
     GLint64 implSize = mImpl->getMemorySize();
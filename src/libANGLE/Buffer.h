@@ -12,6 +12,7 @@
 #define LIBANGLE_BUFFER_H_
 
 #include "common/PackedEnums.h"
+#include "common/SlabAllocator.h"
 #include "common/angleutils.h"
 #include "libANGLE/Debug.h"
 #include "libANGLE/Error.h"
@@ -84,7 +85,8 @@ ANGLE_INLINE bool operator==(const ContentsObserver &lhs, const ContentsObserver
 class Buffer final : public RefCountObject<BufferID>,
                      public LabeledObject,
                      public angle::ObserverInterface,
-                     public angle::Subject
+                     public angle::Subject,
+                     public angle::SlabAllocated
 {
   public:
     Buffer(rx::GLImplFactory *factory, BufferID id);
@@ -202,6 +204,13 @@ class Buffer final : public RefCountObject<BufferID>,
                                          GLsizeiptr size,
                                          GLbitfield flags);
 
+    angle::Result getChunkedIndexRange(const gl::Context *context,
+                                       DrawElementsType type,
+                                       size_t offset,
+                                       size_t count,
+                                       bool primitiveRestartEnabled,
+                                       IndexRange *outRange) const;
+
     void onContentsChange();
     size_t getContentsObserverIndex(VertexArray *vertexArray, uint32_t bufferIndex) const;
 
@@ -152,6 +152,9 @@ struct Limitations
     // ETC1 texture support is emulated.
     bool emulatedEtc1 = false;
 
+    // ASTC LDR texture support is emulated.
+    bool emulatedAstc = false;
+
     // No compressed TEXTURE_3D support.
     bool noCompressedTexture3D = false;
 
@@ -647,6 +650,12 @@ struct DisplayExtensions
     // EGL_ANGLE_vulkan_image
     bool vulkanImageANGLE = false;
 
+    // EGL_ANGLE_low_latency_present
+    bool lowLatencyPresentANGLE = false;
+
+    // EGL_ANGLE_frame_latency_waitable_object
+    bool frameLatencyWaitableObjectANGLE = false;
+
     // EGL_ANGLE_metal_create_context_ownership_identity
     bool metalCreateContextOwnershipIdentityANGLE = false;
 
@@ -0,0 +1,495 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CommandStream.cpp: Implements the gl::CommandStream class.
+
+#include "libANGLE/CommandStream.h"
+
+#include <cstring>
+
+#include "common/mathutil.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/Context.inl.h"
+#include "libANGLE/validationES.h"
+#include "libANGLE/validationES2.h"
+
+namespace gl
+{
+namespace
+{
+struct ActiveTextureParams
+{
+    GLenum texture;
+};
+
+struct BindBufferParams
+{
+    BufferBinding target;
+    BufferID buffer;
+};
+
+struct BindTextureParams
+{
+    TextureType target;
+    TextureID texture;
+};
+
+struct BindVertexArrayParams
+{
+    VertexArrayID array;
+};
+
+struct BlendFuncParams
+{
+    GLenum sfactor;
+    GLenum dfactor;
+};
+
+struct CapParams
+{
+    GLenum cap;
+};
+
+struct DrawArraysParams
+{
+    PrimitiveMode mode;
+    GLint first;
+    GLsizei count;
+};
+
+struct DrawElementsParams
+{
+    PrimitiveMode mode;
+    DrawElementsType type;
+    GLsizei count;
+    // Offset into the element array buffer.  Draws that source indices from client memory are not
+    // recorded.
+    uintptr_t offset;
+};
+
+struct RectParams
+{
+    GLint x;
+    GLint y;
+    GLsizei width;
+    GLsizei height;
+};
+
+struct Uniform1fParams
+{
+    UniformLocation location;
+    GLfloat v0;
+};
+
+struct Uniform1iParams
+{
+    UniformLocation location;
+    GLint v0;
+};
+
+struct Uniform4fParams
+{
+    UniformLocation location;
+    GLfloat v[4];
+};
+
+// Followed by the uniform data.
+struct UniformfvParams
+{
+    UniformLocation location;
+    GLsizei count;
+    GLboolean transpose;
+};
+
+struct UseProgramParams
+{
+    ShaderProgramID program;
+};
+
+template <typename ParamsT>
+const ParamsT *GetParams(const uint8_t *header)
+{
+    return reinterpret_cast<const ParamsT *>(header + sizeof(uint64_t));
+}
+
+const GLfloat *GetUniformData(const UniformfvParams *params)
+{
+    return reinterpret_cast<const GLfloat *>(params + 1);
+}
+}  // anonymous namespace
+
+CommandStream::CommandStream() = default;
+
+CommandStream::~CommandStream() = default;
+
+void CommandStream::reset()
+{
+    mCommands.clear();
+}
+
+template <typename ParamsT>
+ParamsT *CommandStream::allocateCommand(CommandStreamOp op, size_t extraSize)
+{
+    static_assert(sizeof(CommandHeader) == sizeof(uint64_t), "Unexpected command header size");
+
+    // Keep every command 8-byte aligned, as required by the draw parameters.
+    const size_t commandSize =
+        rx::roundUpPow2(sizeof(CommandHeader) + sizeof(ParamsT) + extraSize, sizeof(uint64_t));
+    ASSERT(commandSize <= std::numeric_limits<uint32_t>::max());
+
+    const size_t offset = mCommands.size();
+    mCommands.resize(offset + commandSize);
+
+    CommandHeader *header = reinterpret_cast<CommandHeader *>(mCommands.data() + offset);
+    header->op            = op;
+    header->size          = static_cast<uint32_t>(commandSize);
+
+    return reinterpret_cast<ParamsT *>(header + 1);
+}
+
+void CommandStream::activeTexture(GLenum texture)
+{
+    ActiveTextureParams *params =
+        allocateCommand<ActiveTextureParams>(CommandStreamOp::ActiveTexture, 0);
+    params->texture = texture;
+}
+
+void CommandStream::bindBuffer(BufferBinding target, BufferID buffer)
+{
+    BindBufferParams *params = allocateCommand<BindBufferParams>(CommandStreamOp::BindBuffer, 0);
+    params->target           = target;
+    params->buffer           = buffer;
+}
+
+void CommandStream::bindTexture(TextureType target, TextureID texture)
+{
+    BindTextureParams *params =
+        allocateCommand<BindTextureParams>(CommandStreamOp::BindTexture, 0);
+    params->target  = target;
+    params->texture = texture;
+}
+
+void CommandStream::bindVertexArray(VertexArrayID array)
+{
+    BindVertexArrayParams *params =
+        allocateCommand<BindVertexArrayParams>(CommandStreamOp::BindVertexArray, 0);
+    params->array = array;
+}
+
+void CommandStream::blendFunc(GLenum sfactor, GLenum dfactor)
+{
+    BlendFuncParams *params = allocateCommand<BlendFuncParams>(CommandStreamOp::BlendFunc, 0);
+    params->sfactor         = sfactor;
+    params->dfactor         = dfactor;
+}
+
+void CommandStream::disable(GLenum cap)
+{
+    allocateCommand<CapParams>(CommandStreamOp::Disable, 0)->cap = cap;
+}
+
+void CommandStream::drawArrays(PrimitiveMode mode, GLint first, GLsizei count)
+{
+    DrawArraysParams *params = allocateCommand<DrawArraysParams>(CommandStreamOp::DrawArrays, 0);
+    params->mode             = mode;
+    params->first            = first;
+    params->count            = count;
+}
+
+void CommandStream::drawElements(PrimitiveMode mode,
+                                 GLsizei count,
+                                 DrawElementsType type,
+                                 const void *indices)
+{
+    DrawElementsParams *params =
+        allocateCommand<DrawElementsParams>(CommandStreamOp::DrawElements, 0);
+    params->mode   = mode;
+    params->type   = type;
+    params->count  = count;
+    params->offset = reinterpret_cast<uintptr_t>(indices);
+}
+
+void CommandStream::enable(GLenum cap)
+{
+    allocateCommand<CapParams>(CommandStreamOp::Enable, 0)->cap = cap;
+}
+
+void CommandStream::scissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    RectParams *params = allocateCommand<RectParams>(CommandStreamOp::Scissor, 0);
+    *params            = {x, y, width, height};
+}
+
+void CommandStream::uniform1f(UniformLocation location, GLfloat v0)
+{
+    Uniform1fParams *params = allocateCommand<Uniform1fParams>(CommandStreamOp::Uniform1f, 0);
+    params->location        = location;
+    params->v0              = v0;
+}
+
+void CommandStream::uniform1i(UniformLocation location, GLint v0)
+{
+    Uniform1iParams *params = allocateCommand<Uniform1iParams>(CommandStreamOp::Uniform1i, 0);
+    params->location        = location;
+    params->v0              = v0;
+}
+
+void CommandStream::uniform4f(UniformLocation location,
+                              GLfloat v0,
+                              GLfloat v1,
+                              GLfloat v2,
+                              GLfloat v3)
+{
+    Uniform4fParams *params = allocateCommand<Uniform4fParams>(CommandStreamOp::Uniform4f, 0);
+    params->location        = location;
+    params->v[0]            = v0;
+    params->v[1]            = v1;
+    params->v[2]            = v2;
+    params->v[3]            = v3;
+}
+
+void CommandStream::uniform4fv(UniformLocation location, GLsizei count, const GLfloat *value)
+{
+    const size_t dataSize = sizeof(GLfloat) * 4 * count;
+    UniformfvParams *params =
+        allocateCommand<UniformfvParams>(CommandStreamOp::Uniform4fv, dataSize);
+    params->location  = location;
+    params->count     = count;
+    params->transpose = GL_FALSE;
+    memcpy(params + 1, value, dataSize);
+}
+
+void CommandStream::uniformMatrix4fv(UniformLocation location,
+                                     GLsizei count,
+                                     GLboolean transpose,
+                                     const GLfloat *value)
+{
+    const size_t dataSize = sizeof(GLfloat) * 16 * count;
+    UniformfvParams *params =
+        allocateCommand<UniformfvParams>(CommandStreamOp::UniformMatrix4fv, dataSize);
+    params->location  = location;
+    params->count     = count;
+    params->transpose = transpose;
+    memcpy(params + 1, value, dataSize);
+}
+
+void CommandStream::useProgram(ShaderProgramID program)
+{
+    allocateCommand<UseProgramParams>(CommandStreamOp::UseProgram, 0)->program = program;
+}
+
+void CommandStream::viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    RectParams *params = allocateCommand<RectParams>(CommandStreamOp::Viewport, 0);
+    *params            = {x, y, width, height};
+}
+
+void CommandStream::execute(Context *context) const
+{
+    const bool validate = !context->skipValidation();
+
+    const uint8_t *command = mCommands.data();
+    const uint8_t *end     = command + mCommands.size();
+    while (command < end)
+    {
+        const CommandHeader *header = reinterpret_cast<const CommandHeader *>(command);
+        switch (header->op)
+        {
+            case CommandStreamOp::ActiveTexture:
+            {
+                const ActiveTextureParams *params = GetParams<ActiveTextureParams>(command);
+                if (!validate || ValidateActiveTexture(context, angle::EntryPoint::GLActiveTexture,
+                                                       params->texture))
+                {
+                    context->activeTexture(params->texture);
+                }
+                break;
+            }
+            case CommandStreamOp::BindBuffer:
+            {
+                const BindBufferParams *params = GetParams<BindBufferParams>(command);
+                if (!validate || ValidateBindBuffer(context, angle::EntryPoint::GLBindBuffer,
+                                                    params->target, params->buffer))
+                {
+                    context->bindBuffer(params->target, params->buffer);
+                }
+                break;
+            }
+            case CommandStreamOp::BindTexture:
+            {
+                const BindTextureParams *params = GetParams<BindTextureParams>(command);
+                if (!validate || ValidateBindTexture(context, angle::EntryPoint::GLBindTexture,
+                                                     params->target, params->texture))
+                {
+                    context->bindTexture(params->target, params->texture);
+                }
+                break;
+            }
+            case CommandStreamOp::BindVertexArray:
+            {
+                const BindVertexArrayParams *params = GetParams<BindVertexArrayParams>(command);
+                const angle::EntryPoint entryPoint  = context->getClientMajorVersion() < 3
+                                                          ? angle::EntryPoint::GLBindVertexArrayOES
+                                                          : angle::EntryPoint::GLBindVertexArray;
+                if (!validate || ValidateBindVertexArrayBase(context, entryPoint, params->array))
+                {
+                    context->bindVertexArray(params->array);
+                }
+                break;
+            }
+            case CommandStreamOp::BlendFunc:
+            {
+                const BlendFuncParams *params = GetParams<BlendFuncParams>(command);
+                if (!validate || ValidateBlendFunc(context, angle::EntryPoint::GLBlendFunc,
+                                                   params->sfactor, params->dfactor))
+                {
+                    context->blendFunc(params->sfactor, params->dfactor);
+                }
+                break;
+            }
+            case CommandStreamOp::Disable:
+            {
+                const CapParams *params = GetParams<CapParams>(command);
+                if (!validate ||
+                    ValidateDisable(context, angle::EntryPoint::GLDisable, params->cap))
+                {
+                    context->disable(params->cap);
+                }
+                break;
+            }
+            case CommandStreamOp::DrawArrays:
+            {
+                const DrawArraysParams *params = GetParams<DrawArraysParams>(command);
+                if (!validate || ValidateDrawArrays(context, angle::EntryPoint::GLDrawArrays,
+                                                    params->mode, params->first, params->count))
+                {
+                    context->drawArrays(params->mode, params->first, params->count);
+                }
+                break;
+            }
+            case CommandStreamOp::DrawElements:
+            {
+                const DrawElementsParams *params = GetParams<DrawElementsParams>(command);
+                const void *indices              = reinterpret_cast<const void *>(params->offset);
+                if (!validate ||
+                    ValidateDrawElements(context, angle::EntryPoint::GLDrawElements, params->mode,
+                                         params->count, params->type, indices))
+                {
+                    context->drawElements(params->mode, params->count, params->type, indices);
+                }
+                break;
+            }
+            case CommandStreamOp::Enable:
+            {
+                const CapParams *params = GetParams<CapParams>(command);
+                if (!validate || ValidateEnable(context, angle::EntryPoint::GLEnable, params->cap))
+                {
+                    context->enable(params->cap);
+                }
+                break;
+            }
+            case CommandStreamOp::Scissor:
+            {
+                const RectParams *params = GetParams<RectParams>(command);
+                if (!validate ||
+                    ValidateScissor(context, angle::EntryPoint::GLScissor, params->x, params->y,
+                                    params->width, params->height))
+                {
+                    context->scissor(params->x, params->y, params->width, params->height);
+                }
+                break;
+            }
+            case CommandStreamOp::Uniform1f:
+            {
+                const Uniform1fParams *params = GetParams<Uniform1fParams>(command);
+                if (!validate || ValidateUniform1f(context, angle::EntryPoint::GLUniform1f,
+                                                   params->location, params->v0))
+                {
+                    context->uniform1f(params->location, params->v0);
+                }
+                break;
+            }
+            case CommandStreamOp::Uniform1i:
+            {
+                const Uniform1iParams *params = GetParams<Uniform1iParams>(command);
+                if (!validate || ValidateUniform1i(context, angle::EntryPoint::GLUniform1i,
+                                                   params->location, params->v0))
+                {
+                    context->uniform1i(params->location, params->v0);
+                }
+                break;
+            }
+            case CommandStreamOp::Uniform4f:
+            {
+                const Uniform4fParams *params = GetParams<Uniform4fParams>(command);
+                if (!validate ||
+                    ValidateUniform4f(context, angle::EntryPoint::GLUniform4f, params->location,
+                                      params->v[0], params->v[1], params->v[2], params->v[3]))
+                {
+                    context->uniform4f(params->location, params->v[0], params->v[1], params->v[2],
+                                       params->v[3]);
+                }
+                break;
+            }
+            case CommandStreamOp::Uniform4fv:
+            {
+                const UniformfvParams *params = GetParams<UniformfvParams>(command);
+                const GLfloat *value          = GetUniformData(params);
+                if (!validate || ValidateUniform4fv(context, angle::EntryPoint::GLUniform4fv,
+                                                    params->location, params->count, value))
+                {
+                    context->uniform4fv(params->location, params->count, value);
+                }
+                break;
+            }
+            case CommandStreamOp::UniformMatrix4fv:
+            {
+                const UniformfvParams *params = GetParams<UniformfvParams>(command);
+                const GLfloat *value          = GetUniformData(params);
+                if (!validate ||
+                    ValidateUniformMatrix4fv(context, angle::EntryPoint::GLUniformMatrix4fv,
+                                             params->location, params->count, params->transpose,
+                                             value))
+                {
+                    context->uniformMatrix4fv(params->location, params->count, params->transpose,
+                                              value);
+                }
+                break;
+            }
+            case CommandStreamOp::UseProgram:
+            {
+                const UseProgramParams *params = GetParams<UseProgramParams>(command);
+                if (!validate ||
+                    ValidateUseProgram(context, angle::EntryPoint::GLUseProgram, params->program))
+                {
+                    context->useProgram(params->program);
+                }
+                break;
+            }
+            case CommandStreamOp::Viewport:
+            {
+                const RectParams *params = GetParams<RectParams>(command);
+                if (!validate ||
+                    ValidateViewport(context, angle::EntryPoint::GLViewport, params->x, params->y,
+                                     params->width, params->height))
+                {
+                    context->viewport(params->x, params->y, params->width, params->height);
+                }
+                break;
+            }
+            default:
+                UNREACHABLE();
+                return;
+        }
+
+        if (context->isContextLost())
+        {
+            return;
+        }
+
+        command += header->size;
+    }
+}
+}  // namespace gl
@@ -0,0 +1,103 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// CommandStream.h: Defines the gl::CommandStream class, which records a subset of GL calls for
+// GL_ANGLE_command_stream so they can be replayed with a single call.
+
+#ifndef LIBANGLE_COMMANDSTREAM_H_
+#define LIBANGLE_COMMANDSTREAM_H_
+
+#include <vector>
+
+#include "angle_gl.h"
+#include "common/PackedEnums.h"
+#include "common/angleutils.h"
+#include "libANGLE/angletypes.h"
+
+namespace gl
+{
+class Context;
+
+enum class CommandStreamOp : uint16_t
+{
+    ActiveTexture,
+    BindBuffer,
+    BindTexture,
+    BindVertexArray,
+    BlendFunc,
+    Disable,
+    DrawArrays,
+    DrawElements,
+    Enable,
+    Scissor,
+    Uniform1f,
+    Uniform1i,
+    Uniform4f,
+    Uniform4fv,
+    UniformMatrix4fv,
+    UseProgram,
+    Viewport,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+// The commands are stored back to back in a single allocation.  Every command starts with a
+// header that holds its op and the total size of the command, followed by the op's parameters
+// and, for the uniform array ops, the uniform data.  Parameters are recorded after the entry point
+// has validated and packed them, and are revalidated against the current state when the stream is
+// replayed unless validation is skipped for the context.
+class CommandStream final : angle::NonCopyable
+{
+  public:
+    CommandStream();
+    ~CommandStream();
+
+    void reset();
+    bool empty() const { return mCommands.empty(); }
+
+    void activeTexture(GLenum texture);
+    void bindBuffer(BufferBinding target, BufferID buffer);
+    void bindTexture(TextureType target, TextureID texture);
+    void bindVertexArray(VertexArrayID array);
+    void blendFunc(GLenum sfactor, GLenum dfactor);
+    void disable(GLenum cap);
+    void drawArrays(PrimitiveMode mode, GLint first, GLsizei count);
+    void drawElements(PrimitiveMode mode,
+                      GLsizei count,
+                      DrawElementsType type,
+                      const void *indices);
+    void enable(GLenum cap);
+    void scissor(GLint x, GLint y, GLsizei width, GLsizei height);
+    void uniform1f(UniformLocation location, GLfloat v0);
+    void uniform1i(UniformLocation location, GLint v0);
+    void uniform4f(UniformLocation location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3);
+    void uniform4fv(UniformLocation location, GLsizei count, const GLfloat *value);
+    void uniformMatrix4fv(UniformLocation location,
+                          GLsizei count,
+                          GLboolean transpose,
+                          const GLfloat *value);
+    void useProgram(ShaderProgramID program);
+    void viewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+    // Replays the recorded commands.  A command that fails validation generates its error as if it
+    // was called directly and is skipped; the rest of the stream is still executed.
+    void execute(Context *context) const;
+
+  private:
+    struct alignas(8) CommandHeader
+    {
+        CommandStreamOp op;
+        uint32_t size;
+    };
+
+    template <typename ParamsT>
+    ParamsT *allocateCommand(CommandStreamOp op, size_t extraSize);
+
+    std::vector<uint8_t> mCommands;
+};
+}  // namespace gl
+
+#endif  // LIBANGLE_COMMANDSTREAM_H_
@@ -10,10 +10,10 @@
 
 #include "common/debug.h"
 #include "libANGLE/Context.h"
-#include "libANGLE/Display.h"
 #include "libANGLE/State.h"
 #include "libANGLE/renderer/CompilerImpl.h"
 #include "libANGLE/renderer/GLImplFactory.h"
+#include "libANGLE/trace.h"
 
 namespace gl
 {
@@ -21,9 +21,6 @@ namespace gl
 namespace
 {
 
-// To know when to call sh::Initialize and sh::Finalize.
-size_t gActiveCompilers = 0;
-
 ShShaderSpec SelectShaderSpec(GLint majorVersion,
                               GLint minorVersion,
                               bool isWebGL,
@@ -60,9 +57,21 @@ ShShaderSpec SelectShaderSpec(GLint majorVersion,
     return isWebGL ? SH_WEBGL_SPEC : SH_GLES2_SPEC;
 }
 
+// Emit the phases of the shader compilations as trace events, so the time spent in the translator
+// can be attributed.
+void BeginCompilePhase(const char *phaseName)
+{
+    ANGLE_TRACE_EVENT_BEGIN0("gpu.angle", phaseName);
+}
+
+void EndCompilePhase(const char *phaseName)
+{
+    ANGLE_TRACE_EVENT_END0("gpu.angle", phaseName);
+}
+
 }  // anonymous namespace
 
-Compiler::Compiler(rx::GLImplFactory *implFactory, const State &state, egl::Display *display)
+Compiler::Compiler(rx::GLImplFactory *implFactory, const State &state)
     : mImplementation(implFactory->createCompiler()),
       mSpec(SelectShaderSpec(state.getClientMajorVersion(),
                              state.getClientMinorVersion(),
@@ -78,14 +87,9 @@ Compiler::Compiler(rx::GLImplFactory *implFactory, const State &state, egl::Disp
     const gl::Caps &caps             = state.getCaps();
     const gl::Extensions &extensions = state.getExtensions();
 
-    {
-        std::lock_guard<std::mutex> lock(display->getDisplayGlobalMutex());
-        if (gActiveCompilers == 0)
-        {
-            sh::Initialize();
-        }
-        ++gActiveCompilers;
-    }
+    // The translator reference counts these calls itself.
+    sh::Initialize();
+    sh::SetCompilePhaseCallbacks(BeginCompilePhase, EndCompilePhase);
 
     sh::InitBuiltInResources(&mResources);
     mResources.MaxVertexAttribs             = caps.maxVertexAttributes;
@@ -300,7 +304,6 @@ Compiler::~Compiler() = default;
 
 void Compiler::onDestroy(const Context *context)
 {
-    std::lock_guard<std::mutex> lock(context->getDisplay()->getDisplayGlobalMutex());
     for (auto &pool : mPools)
     {
         for (ShCompilerInstance &instance : pool)
@@ -308,11 +311,7 @@ void Compiler::onDestroy(const Context *context)
             instance.destroy();
         }
     }
-    --gActiveCompilers;
-    if (gActiveCompilers == 0)
-    {
-        sh::Finalize();
-    }
+    sh::Finalize();
 }
 
 ShCompilerInstance Compiler::getInstance(ShaderType type)
@@ -395,6 +395,40 @@ bool CanSupportAEP(const gl::Version &version, const gl::Extensions &extensions)
             extensions.textureBorderClampEXT && extensions.textureBufferEXT &&
             extensions.textureCubeMapArrayEXT && extensions.textureSRGBDecodeEXT);
 }
+
+// The draw state checks that the different kinds of state changes can affect.
+constexpr DrawStatesCheckMask kAllDrawStatesChecks{
+    DrawStatesCheck::VertexArrayBuffers, DrawStatesCheck::Framebuffer,
+    DrawStatesCheck::ClientAttribs, DrawStatesCheck::Program};
+constexpr DrawStatesCheckMask kVertexArrayDrawStatesChecks{
+    DrawStatesCheck::VertexArrayBuffers, DrawStatesCheck::ClientAttribs, DrawStatesCheck::Program};
+constexpr DrawStatesCheckMask kFramebufferDrawStatesChecks{DrawStatesCheck::Framebuffer,
+                                                           DrawStatesCheck::Program};
+// The enabled client attribs are not updated while there is no program.
+constexpr DrawStatesCheckMask kProgramDrawStatesChecks{DrawStatesCheck::ClientAttribs,
+                                                       DrawStatesCheck::Program};
+// Blend and stencil state that is not validated against the program.
+constexpr DrawStatesCheckMask kBlendAndStencilDrawStatesChecks{DrawStatesCheck::Framebuffer};
+// State that is only validated against the program, such as textures and buffer bindings.
+constexpr DrawStatesCheckMask kBoundObjectDrawStatesChecks{DrawStatesCheck::Program};
+
+const char *ValidateDrawStatesCheck(const Context *context, DrawStatesCheck check)
+{
+    switch (check)
+    {
+        case DrawStatesCheck::VertexArrayBuffers:
+            return ValidateDrawVertexArrayBufferStates(context);
+        case DrawStatesCheck::Framebuffer:
+            return ValidateDrawFramebufferStates(context);
+        case DrawStatesCheck::ClientAttribs:
+            return ValidateDrawClientAttribStates(context);
+        case DrawStatesCheck::Program:
+            return ValidateDrawProgramStates(context);
+        default:
+            UNREACHABLE();
+            return nullptr;
+    }
+}
 }  // anonymous namespace
 
 #if defined(ANGLE_PLATFORM_APPLE)
@@ -461,6 +495,7 @@ Context::Context(egl::Display *display,
       mLabel(nullptr),
       mCompiler(),
       mConfig(config),
+      mRecordingCommandStream(nullptr),
       mHasBeenCurrent(false),
       mContextLost(false),
       mResetStatus(GraphicsResetStatus::NoError),
@@ -475,6 +510,7 @@ Context::Context(egl::Display *display,
       mBufferAccessValidationEnabled(false),
       mExtensionsEnabled(GetExtensionsEnabled(attribs, mWebGLContext)),
       mMemoryProgramCache(memoryProgramCache),
+      mMemoryShaderCache(memoryProgramCache ? display->getMemoryShaderCache() : nullptr),
       mVertexArrayObserverBinding(this, kVertexArraySubjectIndex),
       mDrawFramebufferObserverBinding(this, kDrawFramebufferSubjectIndex),
       mReadFramebufferObserverBinding(this, kReadFramebufferSubjectIndex),
@@ -1280,6 +1316,11 @@ GLboolean Context::isSampler(SamplerID samplerName) const
 
 void Context::bindTexture(TextureType target, TextureID handle)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->bindTexture(target, handle);
+    }
+
     // Some apps enable KHR_create_context_no_error but pass in an invalid texture type.
     // Workaround this by silently returning in such situations.
     if (target == TextureType::InvalidEnum)
@@ -1328,6 +1369,11 @@ void Context::bindDrawFramebuffer(FramebufferID framebufferHandle)
 
 void Context::bindVertexArray(VertexArrayID vertexArrayHandle)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->bindVertexArray(vertexArrayHandle);
+    }
+
     VertexArray *vertexArray = checkVertexArrayAllocation(vertexArrayHandle);
     mState.setVertexArrayBinding(this, vertexArray);
     mVertexArrayObserverBinding.bind(vertexArray);
@@ -1377,6 +1423,11 @@ void Context::bindImageTexture(GLuint unit,
 
 void Context::useProgram(ShaderProgramID program)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->useProgram(program);
+    }
+
     ANGLE_CONTEXT_TRY(mState.setProgram(this, getProgramResolveLink(program)));
     mStateCache.onProgramExecutableChange(this);
 }
@@ -1609,7 +1660,7 @@ Compiler *Context::getCompiler() const
 {
     if (mCompiler.get() == nullptr)
     {
-        mCompiler.set(this, new Compiler(mImplementation.get(), mState, mDisplay));
+        mCompiler.set(this, new Compiler(mImplementation.get(), mState));
     }
     return mCompiler.get();
 }
@@ -2632,6 +2683,8 @@ void Context::drawArraysInstanced(PrimitiveMode mode,
                                   GLsizei count,
                                   GLsizei instanceCount)
 {
+    ANGLE_HOT_TRACE_EVENT(Draw, "gl::Context::drawArraysInstanced");
+
     // No-op if count draws no primitives for given mode
     if (noopDrawInstanced(mode, count, instanceCount))
     {
@@ -2652,6 +2705,8 @@ void Context::drawElementsInstanced(PrimitiveMode mode,
                                     const void *indices,
                                     GLsizei instances)
 {
+    ANGLE_HOT_TRACE_EVENT(Draw, "gl::Context::drawElementsInstanced");
+
     // No-op if count draws no primitives for given mode
     if (noopDrawInstanced(mode, count, instances))
     {
@@ -2761,11 +2816,13 @@ void Context::drawElementsIndirect(PrimitiveMode mode, DrawElementsType type, co
 
 void Context::flush()
 {
+    ANGLE_HOT_TRACE_EVENT(Flush, "gl::Context::flush");
     ANGLE_CONTEXT_TRY(mImplementation->flush(this));
 }
 
 void Context::finish()
 {
+    ANGLE_HOT_TRACE_EVENT(Flush, "gl::Context::finish");
     ANGLE_CONTEXT_TRY(mImplementation->finish(this));
 }
 
@@ -2942,7 +2999,11 @@ void Context::setContextLost()
 
     // Stop skipping validation, since many implementation entrypoint assume they can't
     // be called when lost, or with null object arguments, etc.
-    mSkipValidation = false;
+    if (mSkipValidation)
+    {
+        mSkipValidation = false;
+        mStateCache.onValidationEnabled(this);
+    }
 
     // Make sure we update TLS.
 #if defined(ANGLE_PLATFORM_APPLE)
@@ -3717,6 +3778,8 @@ Extensions Context::generateSupportedExtensions() const
     supportedExtensions.clientArraysANGLE             = true;
     supportedExtensions.requestExtensionANGLE         = true;
     supportedExtensions.multiDrawANGLE                = true;
+    supportedExtensions.commandStreamANGLE            = getClientVersion() >= ES_2_0;
+    supportedExtensions.drawWarmUpANGLE               = getClientVersion() >= ES_2_0;
 
     // Enable the no error extension if the context was created with the flag.
     supportedExtensions.noErrorKHR = mSkipValidation;
@@ -4017,6 +4080,13 @@ void Context::initCaps()
         mSupportedExtensions.compressedETC1RGB8TextureOES = false;
     }
 
+    // Hide emulated ASTC extension from WebGL contexts, as the decoded textures use four times the
+    // memory or more.
+    if (mWebGLContext && getLimitations().emulatedAstc)
+    {
+        mSupportedExtensions.textureCompressionAstcLdrKHR = false;
+    }
+
     // If we're capturing application calls for replay, apply some feature limits to increase
     // portability of the trace.
     if (getShareGroup()->getFrameCaptureShared()->enabled() ||
@@ -4076,6 +4146,10 @@ void Context::initCaps()
                   "supported on some native drivers";
         mState.mExtensions.shaderNoperspectiveInterpolationNV = false;
 
+        INFO() << "Disabling GL_ANGLE_command_stream during capture, as replayed commands are not "
+                  "visible to the capture";
+        mState.mExtensions.commandStreamANGLE = false;
+
         // NVIDIA's Vulkan driver only supports 4 draw buffers
         constexpr GLint maxDrawBuffers = 4;
         INFO() << "Limiting draw buffer count to " << maxDrawBuffers;
@@ -4234,6 +4308,13 @@ void Context::updateCaps()
         mMemoryProgramCache = nullptr;
     }
 
+    // The shader cache shares its storage and controls with the program cache.
+    if (mMemoryProgramCache == nullptr ||
+        !mDisplay->getFrontendFeatures().cacheCompiledShader.enabled)
+    {
+        mMemoryShaderCache = nullptr;
+    }
+
     // Compute which buffer types are allowed
     mValidBufferBindings.reset();
     mValidBufferBindings.set(BufferBinding::ElementArray);
@@ -5603,6 +5684,11 @@ void Context::activeShaderProgram(ProgramPipelineID pipeline, ShaderProgramID pr
 
 void Context::activeTexture(GLenum texture)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->activeTexture(texture);
+    }
+
     mState.setActiveSampler(texture - GL_TEXTURE0);
 }
 
@@ -5642,6 +5728,11 @@ void Context::blendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum modeAlph
 
 void Context::blendFunc(GLenum sfactor, GLenum dfactor)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->blendFunc(sfactor, dfactor);
+    }
+
     mState.setBlendFactors(sfactor, dfactor, sfactor, dfactor);
 }
 
@@ -5730,6 +5821,11 @@ void Context::clipControl(GLenum origin, GLenum depth)
 
 void Context::disable(GLenum cap)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->disable(cap);
+    }
+
     mState.setEnableFeature(cap, false);
     mStateCache.onContextCapChange(this);
 }
@@ -5748,6 +5844,11 @@ void Context::disableVertexAttribArray(GLuint index)
 
 void Context::enable(GLenum cap)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->enable(cap);
+    }
+
     mState.setEnableFeature(cap, true);
     mStateCache.onContextCapChange(this);
 }
@@ -5880,6 +5981,11 @@ void Context::sampleMaski(GLuint maskNumber, GLbitfield mask)
 
 void Context::scissor(GLint x, GLint y, GLsizei width, GLsizei height)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->scissor(x, y, width, height);
+    }
+
     mState.setScissorParams(x, y, width, height);
 }
 
@@ -6033,6 +6139,11 @@ void Context::vertexBindingDivisor(GLuint bindingIndex, GLuint divisor)
 
 void Context::viewport(GLint x, GLint y, GLsizei width, GLsizei height)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->viewport(x, y, width, height);
+    }
+
     mState.setViewportParams(x, y, width, height);
 }
 
@@ -6602,6 +6713,8 @@ bool Context::getZeroFilledBuffer(size_t requstedSizeBytes,
 
 void Context::dispatchCompute(GLuint numGroupsX, GLuint numGroupsY, GLuint numGroupsZ)
 {
+    ANGLE_HOT_TRACE_EVENT(Dispatch, "gl::Context::dispatchCompute");
+
     if (numGroupsX == 0u || numGroupsY == 0u || numGroupsZ == 0u)
     {
         return;
@@ -6624,6 +6737,7 @@ void Context::dispatchCompute(GLuint numGroupsX, GLuint numGroupsY, GLuint numGr
 
 void Context::dispatchComputeIndirect(GLintptr indirect)
 {
+    ANGLE_HOT_TRACE_EVENT(Dispatch, "gl::Context::dispatchComputeIndirect");
     ANGLE_CONTEXT_TRY(prepareForDispatch());
     ANGLE_CONTEXT_TRY(mImplementation->dispatchComputeIndirect(this, indirect));
 
@@ -6894,10 +7008,7 @@ void Context::detachShader(ShaderProgramID program, ShaderProgramID shader)
 
 void Context::genBuffers(GLsizei n, BufferID *buffers)
 {
-    for (int i = 0; i < n; i++)
-    {
-        buffers[i] = createBuffer();
-    }
+    mState.mBufferManager->createBuffers(n, buffers);
 }
 
 void Context::genFramebuffers(GLsizei n, FramebufferID *framebuffers)
@@ -6910,18 +7021,12 @@ void Context::genFramebuffers(GLsizei n, FramebufferID *framebuffers)
 
 void Context::genRenderbuffers(GLsizei n, RenderbufferID *renderbuffers)
 {
-    for (int i = 0; i < n; i++)
-    {
-        renderbuffers[i] = createRenderbuffer();
-    }
+    mState.mRenderbufferManager->createRenderbuffers(n, renderbuffers);
 }
 
 void Context::genTextures(GLsizei n, TextureID *textures)
 {
-    for (int i = 0; i < n; i++)
-    {
-        textures[i] = createTexture();
-    }
+    mState.mTextureManager->createTextures(n, textures);
 }
 
 void Context::getActiveAttrib(ShaderProgramID program,
@@ -7427,6 +7532,11 @@ Program *Context::getActiveLinkedProgram() const
 
 void Context::uniform1f(UniformLocation location, GLfloat x)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->uniform1f(location, x);
+    }
+
     Program *program = getActiveLinkedProgram();
     program->setUniform1fv(location, 1, &x);
 }
@@ -7453,6 +7563,11 @@ void Context::onSamplerUniformChange(size_t textureUnitIndex)
 
 void Context::uniform1i(UniformLocation location, GLint x)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->uniform1i(location, x);
+    }
+
     Program *program = getActiveLinkedProgram();
     setUniform1iImpl(program, location, 1, &x);
 }
@@ -7517,6 +7632,11 @@ void Context::uniform3iv(UniformLocation location, GLsizei count, const GLint *v
 
 void Context::uniform4f(UniformLocation location, GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->uniform4f(location, x, y, z, w);
+    }
+
     GLfloat xyzw[4]  = {x, y, z, w};
     Program *program = getActiveLinkedProgram();
     program->setUniform4fv(location, 1, xyzw);
@@ -7524,6 +7644,11 @@ void Context::uniform4f(UniformLocation location, GLfloat x, GLfloat y, GLfloat
 
 void Context::uniform4fv(UniformLocation location, GLsizei count, const GLfloat *v)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->uniform4fv(location, count, v);
+    }
+
     Program *program = getActiveLinkedProgram();
     program->setUniform4fv(location, count, v);
 }
@@ -7564,6 +7689,11 @@ void Context::uniformMatrix4fv(UniformLocation location,
                                GLboolean transpose,
                                const GLfloat *value)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->uniformMatrix4fv(location, count, transpose, value);
+    }
+
     Program *program = getActiveLinkedProgram();
     program->setUniformMatrix4fv(location, count, transpose, value);
 }
@@ -8087,10 +8217,7 @@ void Context::getBufferParameteri64vRobust(BufferBinding target,
 
 void Context::genSamplers(GLsizei count, SamplerID *samplers)
 {
-    for (int i = 0; i < count; i++)
-    {
-        samplers[i] = mState.mSamplerManager->createSampler();
-    }
+    mState.mSamplerManager->createSamplers(count, samplers);
 }
 
 void Context::deleteSamplers(GLsizei count, const SamplerID *samplers)
@@ -8903,6 +9030,57 @@ void Context::releaseTextures(GLuint numTextures, const TextureID *textureIds, G
     }
 }
 
+void Context::beginCommandStream(GLuint stream)
+{
+    ASSERT(mRecordingCommandStream == nullptr);
+
+    std::unique_ptr<CommandStream> &commandStream = mCommandStreams[stream];
+    if (commandStream)
+    {
+        commandStream->reset();
+    }
+    else
+    {
+        commandStream = std::make_unique<CommandStream>();
+    }
+    mRecordingCommandStream = commandStream.get();
+}
+
+void Context::endCommandStream()
+{
+    ASSERT(mRecordingCommandStream != nullptr);
+    mRecordingCommandStream = nullptr;
+}
+
+void Context::callCommandStream(GLuint stream)
+{
+    ASSERT(mRecordingCommandStream == nullptr);
+
+    auto iter = mCommandStreams.find(stream);
+    if (iter != mCommandStreams.end())
+    {
+        iter->second->execute(this);
+    }
+}
+
+void Context::deleteCommandStream(GLuint stream)
+{
+    ASSERT(mRecordingCommandStream == nullptr);
+    mCommandStreams.erase(stream);
+}
+
+void Context::warmUpDraw(PrimitiveMode modePacked)
+{
+    // Like a draw, this does nothing without a vertex shader.
+    if (!mStateCache.getCanDraw())
+    {
+        return;
+    }
+
+    ANGLE_CONTEXT_TRY(prepareForDraw(modePacked));
+    ANGLE_CONTEXT_TRY(mImplementation->warmUpDraw(this, modePacked));
+}
+
 void Context::waitSemaphore(SemaphoreID semaphoreHandle,
                             GLuint numBufferBarriers,
                             const BufferID *buffers,
@@ -9739,18 +9917,21 @@ StateCache::StateCache()
       mCachedNonInstancedVertexElementLimit(0),
       mCachedInstancedVertexElementLimit(0),
       mCachedBasicDrawStatesError(kInvalidPointer),
+      mDirtyDrawStatesChecks(kAllDrawStatesChecks),
       mCachedBasicDrawElementsError(kInvalidPointer),
       mCachedTransformFeedbackActiveUnpaused(false),
       mCachedCanDraw(false)
 {
     mCachedValidDrawModes.fill(false);
+    mCachedDrawStatesCheckErrors.fill(nullptr);
 }
 
 StateCache::~StateCache() = default;
 
 ANGLE_INLINE void StateCache::updateVertexElementLimits(Context *context)
 {
-    if (context->isBufferAccessValidationEnabled())
+    // The limits are only used by validation.
+    if (context->isBufferAccessValidationEnabled() && !context->skipValidation())
     {
         updateVertexElementLimitsImpl(context);
     }
@@ -9761,12 +9942,21 @@ void StateCache::initialize(Context *context)
     updateValidDrawModes(context);
     updateValidBindTextureTypes(context);
     updateValidDrawElementsTypes(context);
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kAllDrawStatesChecks);
     updateBasicDrawElementsError();
     updateVertexAttribTypesValidation(context);
     updateCanDraw(context);
 }
 
+void StateCache::onValidationEnabled(Context *context)
+{
+    // Caches that only validation uses are not kept up to date while validation is skipped.
+    updateValidDrawModes(context);
+    updateVertexElementLimits(context);
+    updateBasicDrawStatesError(kAllDrawStatesChecks);
+    updateBasicDrawElementsError();
+}
+
 void StateCache::updateActiveAttribsMask(Context *context)
 {
     bool isGLES1         = context->isGLES1();
@@ -9813,33 +10003,14 @@ void StateCache::updateVertexElementLimitsImpl(Context *context)
         return;
     }
 
-    const auto &vertexAttribs  = vao->getVertexAttributes();
-    const auto &vertexBindings = vao->getVertexBindings();
-
-    for (size_t attributeIndex : mCachedActiveBufferedAttribsMask)
-    {
-        const VertexAttribute &attrib = vertexAttribs[attributeIndex];
-
-        const VertexBinding &binding = vertexBindings[attrib.bindingIndex];
-        ASSERT(context->isGLES1() ||
-               context->getState().getProgramExecutable()->isAttribLocationActive(attributeIndex));
-
-        GLint64 limit = attrib.getCachedElementLimit();
-        if (binding.getDivisor() > 0)
-        {
-            mCachedInstancedVertexElementLimit =
-                std::min(mCachedInstancedVertexElementLimit, limit);
-        }
-        else
-        {
-            mCachedNonInstancedVertexElementLimit =
-                std::min(mCachedNonInstancedVertexElementLimit, limit);
-        }
-    }
+    vao->getVertexElementLimits(mCachedActiveBufferedAttribsMask,
+                                &mCachedNonInstancedVertexElementLimit,
+                                &mCachedInstancedVertexElementLimit);
 }
 
-void StateCache::updateBasicDrawStatesError()
+void StateCache::updateBasicDrawStatesError(DrawStatesCheckMask checks)
 {
+    mDirtyDrawStatesChecks |= checks;
     mCachedBasicDrawStatesError = kInvalidPointer;
 }
 
@@ -9851,7 +10022,26 @@ void StateCache::updateBasicDrawElementsError()
 intptr_t StateCache::getBasicDrawStatesErrorImpl(const Context *context) const
 {
     ASSERT(mCachedBasicDrawStatesError == kInvalidPointer);
-    mCachedBasicDrawStatesError = reinterpret_cast<intptr_t>(ValidateDrawStates(context));
+
+    // Redo the invalidated checks in validation order, stopping at the first error.  Checks after
+    // a failing one are left invalidated, as they may assume the earlier checks pass.
+    const char *errorMsg = nullptr;
+    for (DrawStatesCheck check : angle::AllEnums<DrawStatesCheck>())
+    {
+        if (mDirtyDrawStatesChecks.test(check))
+        {
+            mCachedDrawStatesCheckErrors[check] = ValidateDrawStatesCheck(context, check);
+            mDirtyDrawStatesChecks.reset(check);
+        }
+
+        errorMsg = mCachedDrawStatesCheckErrors[check];
+        if (errorMsg)
+        {
+            break;
+        }
+    }
+
+    mCachedBasicDrawStatesError = reinterpret_cast<intptr_t>(errorMsg);
     return mCachedBasicDrawStatesError;
 }
 
@@ -9866,7 +10056,7 @@ void StateCache::onVertexArrayBindingChange(Context *context)
 {
     updateActiveAttribsMask(context);
     updateVertexElementLimits(context);
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kVertexArrayDrawStatesChecks);
     updateBasicDrawElementsError();
 }
 
@@ -9874,7 +10064,7 @@ void StateCache::onProgramExecutableChange(Context *context)
 {
     updateActiveAttribsMask(context);
     updateVertexElementLimits(context);
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kProgramDrawStatesChecks);
     updateValidDrawModes(context);
     updateActiveShaderStorageBufferIndices(context);
     updateActiveImageUnitIndices(context);
@@ -9889,20 +10079,20 @@ void StateCache::onVertexArrayFormatChange(Context *context)
 void StateCache::onVertexArrayBufferContentsChange(Context *context)
 {
     updateVertexElementLimits(context);
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kVertexArrayDrawStatesChecks);
 }
 
 void StateCache::onVertexArrayStateChange(Context *context)
 {
     updateActiveAttribsMask(context);
     updateVertexElementLimits(context);
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kVertexArrayDrawStatesChecks);
     updateBasicDrawElementsError();
 }
 
 void StateCache::onVertexArrayBufferStateChange(Context *context)
 {
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kVertexArrayDrawStatesChecks);
     updateBasicDrawElementsError();
 }
 
@@ -9913,70 +10103,70 @@ void StateCache::onGLES1ClientStateChange(Context *context)
 
 void StateCache::onDrawFramebufferChange(Context *context)
 {
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kFramebufferDrawStatesChecks);
 }
 
 void StateCache::onContextCapChange(Context *context)
 {
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kFramebufferDrawStatesChecks);
 }
 
 void StateCache::onStencilStateChange(Context *context)
 {
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kBlendAndStencilDrawStatesChecks);
 }
 
 void StateCache::onDefaultVertexAttributeChange(Context *context)
 {
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kBoundObjectDrawStatesChecks);
 }
 
 void StateCache::onActiveTextureChange(Context *context)
 {
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kBoundObjectDrawStatesChecks);
 }
 
 void StateCache::onQueryChange(Context *context)
 {
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kBoundObjectDrawStatesChecks);
 }
 
 void StateCache::onActiveTransformFeedbackChange(Context *context)
 {
     updateTransformFeedbackActiveUnpaused(context);
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kBoundObjectDrawStatesChecks);
     updateBasicDrawElementsError();
     updateValidDrawModes(context);
 }
 
 void StateCache::onUniformBufferStateChange(Context *context)
 {
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kBoundObjectDrawStatesChecks);
 }
 
 void StateCache::onAtomicCounterBufferStateChange(Context *context)
 {
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kBoundObjectDrawStatesChecks);
 }
 
 void StateCache::onShaderStorageBufferStateChange(Context *context)
 {
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kBoundObjectDrawStatesChecks);
 }
 
 void StateCache::onColorMaskChange(Context *context)
 {
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kFramebufferDrawStatesChecks);
 }
 
 void StateCache::onBlendFuncIndexedChange(Context *context)
 {
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kBlendAndStencilDrawStatesChecks);
 }
 
 void StateCache::onBlendEquationChange(Context *context)
 {
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(kFramebufferDrawStatesChecks);
 }
 
 void StateCache::setValidDrawModes(bool pointsOK,
@@ -10002,6 +10192,11 @@ void StateCache::setValidDrawModes(bool pointsOK,
 
 void StateCache::updateValidDrawModes(Context *context)
 {
+    if (context->skipValidation())
+    {
+        return;
+    }
+
     const State &state = context->getState();
 
     const ProgramExecutable *programExecutable = context->getState().getProgramExecutable();
@@ -19,6 +19,7 @@
 #include "common/PackedEnums.h"
 #include "common/angleutils.h"
 #include "libANGLE/Caps.h"
+#include "libANGLE/CommandStream.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Context_gl_1_autogen.h"
 #include "libANGLE/Context_gl_2_autogen.h"
@@ -69,6 +70,7 @@ class FenceNV;
 class Framebuffer;
 class GLES1Renderer;
 class MemoryProgramCache;
+class MemoryShaderCache;
 class MemoryObject;
 class Program;
 class ProgramPipeline;
@@ -113,6 +115,24 @@ enum class VertexAttribTypeCase
     ValidSize3or4  = 3,
 };
 
+// The parts ValidateDrawStates is made of, in the order they are validated.
+enum class DrawStatesCheck : uint8_t
+{
+    // Mapped buffers bound to the vertex array.
+    VertexArrayBuffers,
+    // Framebuffer completeness and its interaction with stencil and blend state.
+    Framebuffer,
+    // Enabled client side vertex arrays.
+    ClientAttribs,
+    // The program or program pipeline, and state it interacts with.
+    Program,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+using DrawStatesCheckMask = angle::PackedEnumBitSet<DrawStatesCheck, uint8_t>;
+
 // Helper class for managing cache variables and state changes.
 class StateCache final : angle::NonCopyable
 {
@@ -139,6 +159,8 @@ class StateCache final : angle::NonCopyable
     // 3. onVertexArrayFormatChange.
     // 4. onVertexArrayBufferChange.
     // 5. onVertexArrayStateChange.
+    // 6. onValidationEnabled.
+    // Not updated while validation is skipped.
     GLint64 getNonInstancedVertexElementLimit() const
     {
         return mCachedNonInstancedVertexElementLimit;
@@ -162,6 +184,8 @@ class StateCache final : angle::NonCopyable
     // 14. onColorMaskChange.
     // 15. onBufferBindingChange.
     // 16. onBlendFuncIndexedChange.
+    // Each of these only invalidates the DrawStatesChecks the state change can affect, and only
+    // those are redone on the next draw.
     bool hasBasicDrawStatesError(Context *context) const
     {
         if (mCachedBasicDrawStatesError == 0)
@@ -204,6 +228,8 @@ class StateCache final : angle::NonCopyable
     // Places that can trigger updateValidDrawModes:
     // 1. onProgramExecutableChange.
     // 2. onActiveTransformFeedbackChange.
+    // 3. onValidationEnabled.
+    // Not updated while validation is skipped.
     bool isValidDrawMode(PrimitiveMode primitiveMode) const
     {
         return mCachedValidDrawModes[primitiveMode];
@@ -277,6 +303,9 @@ class StateCache final : angle::NonCopyable
     void onBlendFuncIndexedChange(Context *context);
     void onBlendEquationChange(Context *context);
 
+    // Called when a context that skipped validation (GL_KHR_no_error) starts validating calls.
+    void onValidationEnabled(Context *context);
+
   private:
     // Cache update functions.
     void updateActiveAttribsMask(Context *context);
@@ -285,7 +314,7 @@ class StateCache final : angle::NonCopyable
     void updateValidDrawModes(Context *context);
     void updateValidBindTextureTypes(Context *context);
     void updateValidDrawElementsTypes(Context *context);
-    void updateBasicDrawStatesError();
+    void updateBasicDrawStatesError(DrawStatesCheckMask checks);
     void updateBasicDrawElementsError();
     void updateTransformFeedbackActiveUnpaused(Context *context);
     void updateVertexAttribTypesValidation(Context *context);
@@ -312,6 +341,8 @@ class StateCache final : angle::NonCopyable
     GLint64 mCachedNonInstancedVertexElementLimit;
     GLint64 mCachedInstancedVertexElementLimit;
     mutable intptr_t mCachedBasicDrawStatesError;
+    mutable DrawStatesCheckMask mDirtyDrawStatesChecks;
+    mutable angle::PackedEnumMap<DrawStatesCheck, const char *> mCachedDrawStatesCheckErrors;
     mutable intptr_t mCachedBasicDrawElementsError;
     bool mCachedTransformFeedbackActiveUnpaused;
     StorageBuffersMask mCachedActiveShaderStorageBufferIndices;
@@ -499,6 +530,7 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     angle::Result prepareForInvalidate(GLenum target);
 
     MemoryProgramCache *getMemoryProgramCache() const { return mMemoryProgramCache; }
+    MemoryShaderCache *getMemoryShaderCache() const { return mMemoryShaderCache; }
     std::mutex &getProgramCacheMutex() const;
 
     bool hasBeenCurrent() const { return mHasBeenCurrent; }
@@ -537,6 +569,8 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
         return mSkipValidation;
     }
 
+    bool isRecordingCommandStream() const { return mRecordingCommandStream != nullptr; }
+
     // Specific methods needed for validation.
     bool getQueryParameterInfo(GLenum pname, GLenum *type, unsigned int *numParams) const;
     bool getIndexedQueryParameterInfo(GLenum target, GLenum *type, unsigned int *numParams) const;
@@ -759,6 +793,11 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     // GLES1 renderer state
     std::unique_ptr<GLES1Renderer> mGLES1Renderer;
 
+    // GL_ANGLE_command_stream.  While a stream is being recorded, the recordable commands are
+    // appended to it in addition to being executed.
+    angle::HashMap<GLuint, std::unique_ptr<CommandStream>> mCommandStreams;
+    CommandStream *mRecordingCommandStream;
+
     // Current/lost context flags
     bool mHasBeenCurrent;
     bool mContextLost;  // Set with setContextLost so that we also set mSkipValidation=false.
@@ -774,6 +813,7 @@ class Context final : public egl::LabeledObject, angle::NonCopyable, public angl
     bool mBufferAccessValidationEnabled;
     const bool mExtensionsEnabled;
     MemoryProgramCache *mMemoryProgramCache;
+    MemoryShaderCache *mMemoryShaderCache;
 
     State::DirtyObjects mDrawDirtyObjects;
 
@@ -11,6 +11,7 @@
 #ifndef LIBANGLE_CONTEXT_INL_H_
 #define LIBANGLE_CONTEXT_INL_H_
 
+#include "common/hot_trace.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/GLES1Renderer.h"
 #include "libANGLE/renderer/ContextImpl.h"
@@ -122,6 +123,14 @@ ANGLE_INLINE angle::Result Context::prepareForDraw(PrimitiveMode mode)
 
 ANGLE_INLINE void Context::drawArrays(PrimitiveMode mode, GLint first, GLsizei count)
 {
+    ANGLE_HOT_TRACE_EVENT(Draw, "gl::Context::drawArrays");
+
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr) &&
+        !mStateCache.hasAnyEnabledClientAttrib())
+    {
+        mRecordingCommandStream->drawArrays(mode, first, count);
+    }
+
     // No-op if count draws no primitives for given mode
     if (noopDraw(mode, count))
     {
@@ -139,6 +148,15 @@ ANGLE_INLINE void Context::drawElements(PrimitiveMode mode,
                                         DrawElementsType type,
                                         const void *indices)
 {
+    ANGLE_HOT_TRACE_EVENT(Draw, "gl::Context::drawElements");
+
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr) &&
+        !mStateCache.hasAnyEnabledClientAttrib() &&
+        mState.getVertexArray()->getElementArrayBuffer() != nullptr)
+    {
+        mRecordingCommandStream->drawElements(mode, count, type, indices);
+    }
+
     // No-op if count draws no primitives for given mode
     if (noopDraw(mode, count))
     {
@@ -152,12 +170,17 @@ ANGLE_INLINE void Context::drawElements(PrimitiveMode mode,
 
 ANGLE_INLINE void StateCache::onBufferBindingChange(Context *context)
 {
-    updateBasicDrawStatesError();
+    updateBasicDrawStatesError(DrawStatesCheckMask{DrawStatesCheck::Program});
     updateBasicDrawElementsError();
 }
 
 ANGLE_INLINE void Context::bindBuffer(BufferBinding target, BufferID buffer)
 {
+    if (ANGLE_UNLIKELY(mRecordingCommandStream != nullptr))
+    {
+        mRecordingCommandStream->bindBuffer(target, buffer);
+    }
+
     Buffer *bufferObject =
         mState.mBufferManager->checkBufferAllocation(mImplementation.get(), buffer);
 
@@ -339,6 +339,11 @@
         const GLuint *baseInstances, GLsizei drawcount);                                           \
     /* GL_ANGLE_base_vertex_base_instance_shader_builtin */                                        \
     /* GL_ANGLE_client_arrays */                                                                   \
+    /* GL_ANGLE_command_stream */                                                                  \
+    void beginCommandStream(GLuint stream);                                                        \
+    void endCommandStream();                                                                       \
+    void callCommandStream(GLuint stream);                                                         \
+    void deleteCommandStream(GLuint stream);                                                       \
     /* GL_ANGLE_compressed_texture_etc */                                                          \
     /* GL_ANGLE_copy_texture_3d */                                                                 \
     void copyTexture3D(TextureID sourceIdPacked, GLint sourceLevel,                                \
@@ -350,6 +355,8 @@
                           GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLint z,  \
                           GLint width, GLint height, GLint depth, GLboolean unpackFlipY,           \
                           GLboolean unpackPremultiplyAlpha, GLboolean unpackUnmultiplyAlpha);      \
+    /* GL_ANGLE_draw_warm_up */                                                                    \
+    void warmUpDraw(PrimitiveMode modePacked);                                                     \
     /* GL_ANGLE_framebuffer_multisample */                                                         \
     /* GL_ANGLE_get_image */                                                                       \
     void getTexImage(TextureTarget targetPacked, GLint level, GLenum format, GLenum type,          \
@@ -22,6 +22,7 @@
 #include "anglebase/no_destructor.h"
 #include "common/android_util.h"
 #include "common/debug.h"
+#include "common/hot_trace.h"
 #include "common/mathutil.h"
 #include "common/platform.h"
 #include "common/string_utils.h"
@@ -589,13 +590,30 @@ void UpdateAttribsFromEnvironment(AttributeMap &attribMap)
 
 static constexpr uint32_t kScratchBufferLifetime = 64u;
 
+// The blob cache file used when the application doesn't provide EGL_ANDROID_blob_cache callbacks
+// is set with ANGLE_BLOB_CACHE_FILE, and its maximum size in bytes with ANGLE_BLOB_CACHE_FILE_SIZE.
+constexpr size_t kDefaultBlobCacheFileSizeBytes = 64 * 1024 * 1024;
+
+size_t GetBlobCacheFileSizeFromEnvironment()
+{
+    std::string sizeEnv = angle::GetEnvironmentVar("ANGLE_BLOB_CACHE_FILE_SIZE");
+    if (sizeEnv.empty())
+    {
+        return kDefaultBlobCacheFileSizeBytes;
+    }
+    return static_cast<size_t>(strtoull(sizeEnv.c_str(), nullptr, 10));
+}
+
 }  // anonymous namespace
 
 // ShareGroup
 ShareGroup::ShareGroup(rx::EGLImplFactory *factory)
     : mRefCount(1),
       mImplementation(factory->createShareGroup()),
-      mFrameCaptureShared(new angle::FrameCaptureShared)
+      mFrameCaptureShared(new angle::FrameCaptureShared),
+      mMutexOwner(std::thread::id()),
+      mMutexLevel(0),
+      mUsesEGLImages(false)
 {}
 
 void ShareGroup::finishAllContexts()
@@ -621,9 +639,35 @@ void ShareGroup::removeSharedContext(gl::Context *context)
 
 ShareGroup::~ShareGroup()
 {
+    ASSERT(mMutexLevel == 0);
     SafeDelete(mImplementation);
 }
 
+void ShareGroup::lockMutex()
+{
+    if (isMutexOwnedByCurrentThread())
+    {
+        ++mMutexLevel;
+        return;
+    }
+
+    mMutex.lock();
+    mMutexOwner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    mMutexLevel = 1;
+}
+
+void ShareGroup::unlockMutex()
+{
+    ASSERT(isMutexOwnedByCurrentThread() && mMutexLevel > 0);
+    if (--mMutexLevel > 0)
+    {
+        return;
+    }
+
+    mMutexOwner.store(std::thread::id(), std::memory_order_relaxed);
+    mMutex.unlock();
+}
+
 void ShareGroup::addRef()
 {
     // This is protected by global lock, so no atomic is required
@@ -740,9 +784,9 @@ Display *Display::GetDisplayFromNativeDisplay(EGLenum platform,
             return nullptr;
         }
 
-#if defined(ANGLE_PLATFORM_ANDROID)
+#if defined(ANGLE_PLATFORM_ANDROID) && !defined(ANGLE_ANDROID_ALWAYS_USE_GL_TLS_SLOT)
         angle::gUseAndroidOpenGLTlsSlot = displayType == EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE;
-#endif  // defined(ANGLE_PLATFORM_ANDROID)
+#endif  // defined(ANGLE_PLATFORM_ANDROID) && !defined(ANGLE_ANDROID_ALWAYS_USE_GL_TLS_SLOT)
 
         display->setupDisplayPlatform(impl);
     }
@@ -860,6 +904,7 @@ Display::Display(EGLenum platform, EGLNativeDisplayType displayId, Device *eglDe
       mSemaphoreManager(nullptr),
       mBlobCache(gl::kDefaultMaxProgramCacheMemoryBytes),
       mMemoryProgramCache(mBlobCache),
+      mMemoryShaderCache(mBlobCache),
       mGlobalTextureShareGroupUsers(0),
       mGlobalSemaphoreShareGroupUsers(0),
       mIsTerminated(false)
@@ -973,10 +1018,28 @@ Error Display::initialize()
         mBlobCache.resize(1024 * 1024);
     }
 
+    // Warm up the cache from the blob cache file, if there is one.  The cache is cleared when the
+    // display is terminated, so the file is loaded again every time the display is initialized.
+    // Processes that use the same file share the programs and pipeline caches each of them stores.
+    std::string blobCacheFilePath = angle::GetEnvironmentVar("ANGLE_BLOB_CACHE_FILE");
+    if (!blobCacheFilePath.empty())
+    {
+        size_t blobCacheFileSize = GetBlobCacheFileSizeFromEnvironment();
+        if (mBlobCache.maxSize() < blobCacheFileSize)
+        {
+            mBlobCache.resize(blobCacheFileSize);
+        }
+        mBlobCache.openFileStore(blobCacheFilePath, blobCacheFileSize);
+    }
+
     setGlobalDebugAnnotator();
 
     gl::InitializeDebugMutexIfNeeded();
 
+    // Read again on every initialization, so that an Android property set while the application
+    // runs takes effect.
+    angle::InitializeHotTrace();
+
     SCOPED_ANGLE_HISTOGRAM_TIMER("GPU.ANGLE.DisplayInitializeMS");
     ANGLE_TRACE_EVENT0("gpu.angle", "egl::Display::initialize");
 
@@ -1162,6 +1225,8 @@ Error Display::terminate(Thread *thread, TerminateReason terminateReason)
         ANGLE_TRY(releaseContext(context, thread));
     }
 
+    // Let the cache entries that are still being compressed land before clearing the cache.
+    mBlobCache.waitForPendingPuts();
     mMemoryProgramCache.clear();
     mBlobCache.setBlobCacheFuncs(nullptr, nullptr);
 
@@ -1190,6 +1255,8 @@ Error Display::terminate(Thread *thread, TerminateReason terminateReason)
 
     gl::UninitializeDebugAnnotations();
 
+    angle::WriteHotTraceEvents();
+
     // TODO(jmadill): Store Platform in Display and deinit here.
     ANGLEResetDisplayPlatform(this);
 
@@ -1340,7 +1407,7 @@ Error Display::createPixmapSurface(const Config *configuration,
     return NoError();
 }
 
-Error Display::createImage(const gl::Context *context,
+Error Display::createImage(gl::Context *context,
                            EGLenum target,
                            EGLClientBuffer buffer,
                            const AttributeMap &attribs,
@@ -1385,6 +1452,13 @@ Error Display::createImage(const gl::Context *context,
     image->addRef();
     mImageSet.insert(image);
 
+    // The source sibling is now shared with the contexts that the image is bound to.
+    if (context != nullptr)
+    {
+        context->setShared();
+        context->getShareGroup()->onEGLImageUsed();
+    }
+
     return NoError();
 }
 
@@ -1804,6 +1878,8 @@ void Display::notifyDeviceLost()
 
 void Display::setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get)
 {
+    // Entries that are still being compressed go to the cache they were put in.
+    mBlobCache.waitForPendingPuts();
     mBlobCache.setBlobCacheFuncs(set, get);
     mImplementation->setBlobCacheFuncs(set, get);
 }
@@ -2201,6 +2277,17 @@ EGLint Display::programCacheGetAttrib(EGLenum attrib) const
         case EGL_PROGRAM_CACHE_SIZE_ANGLE:
             return static_cast<EGLint>(mMemoryProgramCache.entryCount());
 
+        // The counters are cumulative for the lifetime of the display and saturate at the largest
+        // value an EGLint can hold.
+        case EGL_PROGRAM_CACHE_HIT_COUNT_ANGLE:
+            return gl::clampCast<EGLint>(mBlobCache.hitCount());
+
+        case EGL_PROGRAM_CACHE_MISS_COUNT_ANGLE:
+            return gl::clampCast<EGLint>(mBlobCache.missCount());
+
+        case EGL_PROGRAM_CACHE_EVICTION_COUNT_ANGLE:
+            return gl::clampCast<EGLint>(mBlobCache.evictionCount());
+
         default:
             UNREACHABLE();
             return 0;
@@ -11,8 +11,10 @@
 #ifndef LIBANGLE_DISPLAY_H_
 #define LIBANGLE_DISPLAY_H_
 
+#include <atomic>
 #include <mutex>
 #include <set>
+#include <thread>
 #include <vector>
 
 #include "libANGLE/AttributeMap.h"
@@ -24,6 +26,7 @@
 #include "libANGLE/Error.h"
 #include "libANGLE/LoggingAnnotator.h"
 #include "libANGLE/MemoryProgramCache.h"
+#include "libANGLE/MemoryShaderCache.h"
 #include "libANGLE/Observer.h"
 #include "libANGLE/Version.h"
 #include "platform/Feature.h"
@@ -97,6 +100,22 @@ class ShareGroup final : angle::NonCopyable
 
     size_t getShareGroupContextCount() const { return mContexts.size(); }
 
+    // Locked by GL entry points of the contexts in the share group.  See gl::ScopedContextLock.
+    // The mutex is recursive, so that GL calls made from a callback of a GL call, such as a debug
+    // message callback, can lock it again.
+    void lockMutex();
+    void unlockMutex();
+    bool isMutexOwnedByCurrentThread() const
+    {
+        return mMutexOwner.load(std::memory_order_relaxed) == std::this_thread::get_id();
+    }
+
+    // EGLImage siblings are shared with contexts outside the share group, so once a sibling of
+    // the share group is the source or target of an EGLImage, entry points lock the global mutex
+    // exclusively.  Set with the global mutex locked exclusively.
+    void onEGLImageUsed() { mUsesEGLImages.store(true, std::memory_order_relaxed); }
+    bool usesEGLImages() const { return mUsesEGLImages.load(std::memory_order_relaxed); }
+
   protected:
     ~ShareGroup();
 
@@ -110,6 +129,12 @@ class ShareGroup final : angle::NonCopyable
 
     // The list of contexts within the share group
     ContextSet mContexts;
+
+    std::mutex mMutex;
+    std::atomic<std::thread::id> mMutexOwner;
+    uint32_t mMutexLevel;
+
+    std::atomic<bool> mUsesEGLImages;
 };
 
 // Constant coded here as a reasonable limit.
@@ -181,7 +206,7 @@ class Display final : public LabeledObject,
                               const AttributeMap &attribs,
                               Surface **outSurface);
 
-    Error createImage(const gl::Context *context,
+    Error createImage(gl::Context *context,
                       EGLenum target,
                       EGLClientBuffer buffer,
                       const AttributeMap &attribs,
@@ -245,6 +270,7 @@ class Display final : public LabeledObject,
     void setBlobCacheFuncs(EGLSetBlobFuncANDROID set, EGLGetBlobFuncANDROID get);
     bool areBlobCacheFuncsSet() const { return mBlobCache.areBlobCacheFuncsSet(); }
     BlobCache &getBlobCache() { return mBlobCache; }
+    gl::MemoryShaderCache *getMemoryShaderCache() { return &mMemoryShaderCache; }
 
     static EGLClientBuffer GetNativeClientBuffer(const struct AHardwareBuffer *buffer);
     static Error CreateNativeClientBuffer(const egl::AttributeMap &attribMap,
@@ -392,6 +418,7 @@ class Display final : public LabeledObject,
     gl::SemaphoreManager *mSemaphoreManager;
     BlobCache mBlobCache;
     gl::MemoryProgramCache mMemoryProgramCache;
+    gl::MemoryShaderCache mMemoryShaderCache;
     size_t mGlobalTextureShareGroupUsers;
     size_t mGlobalSemaphoreShareGroupUsers;
 
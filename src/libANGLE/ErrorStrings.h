@@ -72,6 +72,10 @@ MSG kClientBufferInvalid = "Size must not exceed the size of clientbuffer";
 MSG kClientDataInVertexArray = "Client data cannot be used with a non-default vertex array object.";
 MSG kColorNumberGreaterThanMaxDrawBuffers = "Color number for primary color greater than or equal to MAX_DRAW_BUFFERS";
 MSG kColorNumberGreaterThanMaxDualSourceDrawBuffers = "Color number for secondary color greater than or equal to MAX_DUAL_SOURCE_DRAW_BUFFERS";
+MSG kCommandStreamClientMemory = "Draw calls recorded in a command stream cannot source vertex or index data from client memory.";
+MSG kCommandStreamNotRecording = "No command stream is being recorded.";
+MSG kCommandStreamRecording = "A command stream is being recorded.";
+MSG kCommandStreamZero = "Command stream 0 is reserved.";
 MSG kCompressedDataSizeTooSmall = "dataSize is too small";
 MSG kCompressedMismatch = "Compressed data is valid if-and-only-if the texture is compressed.";
 MSG kCompressedTextureDimensionsMustMatchData = "Compressed texture dimensions must exactly match the dimensions of the data passed in.";
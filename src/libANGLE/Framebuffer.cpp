@@ -323,6 +323,47 @@ bool AttachmentOverlapsWithTexture(const FramebufferAttachment &attachment,
     return attachmentLevel >= textureEffectiveBaseLevel && attachmentLevel <= textureMaxLevel;
 }
 
+void UpdateAttachmentCompletenessKey(const Context *context,
+                                     const FramebufferAttachment &attachment,
+                                     FramebufferAttachmentCompletenessKey *keyOut)
+{
+    *keyOut = {};
+    if (!attachment.isAttached())
+    {
+        return;
+    }
+
+    keyOut->resource               = attachment.getResource();
+    keyOut->format                 = attachment.getFormat().info;
+    keyOut->size                   = attachment.getSize();
+    keyOut->type                   = attachment.type();
+    keyOut->samples                = attachment.getSamples();
+    keyOut->renderToTextureSamples = attachment.getRenderToTextureSamples();
+    keyOut->numViews               = attachment.getNumViews();
+    keyOut->baseViewIndex          = attachment.getBaseViewIndex();
+    keyOut->isMultiview            = attachment.isMultiview();
+    keyOut->renderable             = attachment.isRenderable(context);
+
+    if (attachment.type() == GL_TEXTURE)
+    {
+        const Texture *texture = attachment.getTexture();
+        ASSERT(texture);
+        keyOut->imageIndex = attachment.getTextureImageIndex();
+        keyOut->fixedSampleLocations =
+            texture->getAttachmentFixedSampleLocations(keyOut->imageIndex);
+        keyOut->cubeComplete = texture->getType() == TextureType::CubeMap &&
+                               texture->getTextureState().isCubeComplete();
+
+        // The mip levels only matter to the completeness of mutable textures.
+        keyOut->immutableFormat = texture->getImmutableFormat();
+        if (!keyOut->immutableFormat)
+        {
+            keyOut->baseLevel      = texture->getBaseLevel();
+            keyOut->mipmapMaxLevel = texture->getMipmapMaxLevel();
+            keyOut->mipmapComplete = texture->isMipmapComplete();
+        }
+    }
+}
 }  // anonymous namespace
 
 bool FramebufferStatus::isComplete() const
@@ -348,6 +389,30 @@ FramebufferStatus FramebufferStatus::Incomplete(GLenum status, const char *reaso
     return result;
 }
 
+bool FramebufferAttachmentCompletenessKey::operator==(
+    const FramebufferAttachmentCompletenessKey &other) const
+{
+    return resource == other.resource && format == other.format &&
+           imageIndex == other.imageIndex && size == other.size && type == other.type &&
+           samples == other.samples && renderToTextureSamples == other.renderToTextureSamples &&
+           numViews == other.numViews && baseViewIndex == other.baseViewIndex &&
+           baseLevel == other.baseLevel && mipmapMaxLevel == other.mipmapMaxLevel &&
+           isMultiview == other.isMultiview && renderable == other.renderable &&
+           fixedSampleLocations == other.fixedSampleLocations &&
+           immutableFormat == other.immutableFormat && cubeComplete == other.cubeComplete &&
+           mipmapComplete == other.mipmapComplete;
+}
+
+bool FramebufferCompletenessKey::operator==(const FramebufferCompletenessKey &other) const
+{
+    return attachments == other.attachments && drawBufferStates == other.drawBufferStates &&
+           readBufferState == other.readBufferState && defaultWidth == other.defaultWidth &&
+           defaultHeight == other.defaultHeight && defaultSamples == other.defaultSamples &&
+           defaultLayers == other.defaultLayers &&
+           defaultFixedSampleLocations == other.defaultFixedSampleLocations &&
+           webGLDepthStencilConsistent == other.webGLDepthStencilConsistent;
+}
+
 // This constructor is only used for default framebuffers.
 FramebufferState::FramebufferState(rx::Serial serial)
     : mId(Framebuffer::kDefaultDrawFramebufferHandle),
@@ -1186,11 +1251,26 @@ void Framebuffer::invalidateCompletenessCache()
     onStateChange(angle::SubjectMessage::DirtyBitsFlagged);
 }
 
+void Framebuffer::invalidateCompleteConfigurations()
+{
+    mCompleteConfigurationCount = 0;
+    mNextCompleteConfiguration  = 0;
+    invalidateCompletenessCache();
+}
+
 const FramebufferStatus &Framebuffer::checkStatusImpl(const Context *context) const
 {
     ASSERT(!isDefault());
     ASSERT(hasAnyDirtyBit() || !mCachedStatus.valid());
 
+    // Going back to attachments the framebuffer was complete with doesn't need the checks.
+    updateCompletenessKey(context);
+    if (isCompleteConfiguration())
+    {
+        mCachedStatus = FramebufferStatus::Complete();
+        return mCachedStatus.value();
+    }
+
     mCachedStatus = checkStatusWithGLFrontEnd(context);
 
     if (mCachedStatus.value().isComplete())
@@ -1210,11 +1290,63 @@ const FramebufferStatus &Framebuffer::checkStatusImpl(const Context *context) co
         }
 
         mCachedStatus = mImpl->checkStatus(context);
+        if (mCachedStatus.value().isComplete())
+        {
+            addCompleteConfiguration();
+        }
     }
 
     return mCachedStatus.value();
 }
 
+void Framebuffer::updateCompletenessKey(const Context *context) const
+{
+    const size_t colorAttachmentCount = mState.mColorAttachments.size();
+    mCompletenessKey.attachments.resize(colorAttachmentCount + 3);
+    for (size_t index = 0; index < colorAttachmentCount; ++index)
+    {
+        UpdateAttachmentCompletenessKey(context, mState.mColorAttachments[index],
+                                        &mCompletenessKey.attachments[index]);
+    }
+    UpdateAttachmentCompletenessKey(context, mState.mDepthAttachment,
+                                    &mCompletenessKey.attachments[colorAttachmentCount]);
+    UpdateAttachmentCompletenessKey(context, mState.mStencilAttachment,
+                                    &mCompletenessKey.attachments[colorAttachmentCount + 1]);
+    UpdateAttachmentCompletenessKey(context, mState.mWebGLDepthStencilAttachment,
+                                    &mCompletenessKey.attachments[colorAttachmentCount + 2]);
+
+    mCompletenessKey.drawBufferStates            = mState.mDrawBufferStates;
+    mCompletenessKey.readBufferState             = mState.mReadBufferState;
+    mCompletenessKey.defaultWidth                = mState.mDefaultWidth;
+    mCompletenessKey.defaultHeight               = mState.mDefaultHeight;
+    mCompletenessKey.defaultSamples              = mState.mDefaultSamples;
+    mCompletenessKey.defaultLayers               = mState.mDefaultLayers;
+    mCompletenessKey.defaultFixedSampleLocations = mState.mDefaultFixedSampleLocations;
+    mCompletenessKey.webGLDepthStencilConsistent = mState.mWebGLDepthStencilConsistent;
+}
+
+bool Framebuffer::isCompleteConfiguration() const
+{
+    for (size_t index = 0; index < mCompleteConfigurationCount; ++index)
+    {
+        if (mCompleteConfigurations[index] == mCompletenessKey)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void Framebuffer::addCompleteConfiguration() const
+{
+    // The oldest configuration is replaced once the cache is full.  Copying into the entry reuses
+    // the memory of its vectors.
+    mCompleteConfigurations[mNextCompleteConfiguration] = mCompletenessKey;
+    mNextCompleteConfiguration = (mNextCompleteConfiguration + 1) % kCompleteConfigurationCacheSize;
+    mCompleteConfigurationCount =
+        std::min(mCompleteConfigurationCount + 1, kCompleteConfigurationCacheSize);
+}
+
 FramebufferStatus Framebuffer::checkStatusWithGLFrontEnd(const Context *context) const
 {
     const State &state = context->getState();
@@ -2077,7 +2209,15 @@ void Framebuffer::onSubjectStateChange(angle::SubjectIndex index, angle::Subject
         // This can be triggered by SubImage calls for Textures.
         if (message == angle::SubjectMessage::ContentsChanged)
         {
-            mDirtyBits.set(DIRTY_BIT_COLOR_BUFFER_CONTENTS_0 + index);
+            // Streaming updates to an attachment send this message on every call.  The context
+            // only needs to be notified of the first one before the framebuffer is synced; if the
+            // framebuffer is bound later, the binding picks up its dirty bits.
+            const size_t dirtyBit = DIRTY_BIT_COLOR_BUFFER_CONTENTS_0 + index;
+            if (mDirtyBits.test(dirtyBit))
+            {
+                return;
+            }
+            mDirtyBits.set(dirtyBit);
             onStateChange(angle::SubjectMessage::DirtyBitsFlagged);
             return;
         }
@@ -2095,7 +2235,7 @@ void Framebuffer::onSubjectStateChange(angle::SubjectIndex index, angle::Subject
         if (message == angle::SubjectMessage::StorageReleased)
         {
             mDirtyBits.set(index);
-            invalidateCompletenessCache();
+            invalidateCompleteConfigurations();
             return;
         }
 
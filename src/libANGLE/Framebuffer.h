@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_FRAMEBUFFER_H_
 #define LIBANGLE_FRAMEBUFFER_H_
 
+#include <array>
 #include <vector>
 
 #include "common/FixedVector.h"
@@ -59,6 +60,48 @@ struct FramebufferStatus
     const char *reason = nullptr;
 };
 
+// The properties of an attachment that its completeness depends on.  The resource is part of the
+// key, so that checks of attachments being the same image have the same verdict.
+struct FramebufferAttachmentCompletenessKey
+{
+    bool operator==(const FramebufferAttachmentCompletenessKey &other) const;
+
+    const FramebufferAttachmentObject *resource = nullptr;
+    const InternalFormat *format                = nullptr;
+    ImageIndex imageIndex;
+    Extents size;
+    GLenum type                    = GL_NONE;
+    GLsizei samples                = 0;
+    GLsizei renderToTextureSamples = 0;
+    GLsizei numViews               = 0;
+    GLint baseViewIndex            = 0;
+    GLuint baseLevel               = 0;
+    GLuint mipmapMaxLevel          = 0;
+    bool isMultiview               = false;
+    bool renderable                = false;
+    bool fixedSampleLocations      = false;
+    bool immutableFormat           = false;
+    bool cubeComplete              = false;
+    bool mipmapComplete            = false;
+};
+
+// The state of a framebuffer that its completeness depends on.
+struct FramebufferCompletenessKey
+{
+    bool operator==(const FramebufferCompletenessKey &other) const;
+
+    // The color attachments, followed by the depth, stencil and WebGL depth/stencil attachments.
+    std::vector<FramebufferAttachmentCompletenessKey> attachments;
+    std::vector<GLenum> drawBufferStates;
+    GLenum readBufferState           = GL_NONE;
+    GLint defaultWidth               = 0;
+    GLint defaultHeight              = 0;
+    GLint defaultSamples             = 0;
+    GLint defaultLayers              = 0;
+    bool defaultFixedSampleLocations = false;
+    bool webGLDepthStencilConsistent = false;
+};
+
 class FramebufferState final : angle::NonCopyable
 {
   public:
@@ -306,6 +349,9 @@ class Framebuffer final : public angle::ObserverInterface,
     void setFlipY(bool flipY);
 
     void invalidateCompletenessCache();
+    // Also forgets the attachment configurations that were found complete, for when the
+    // completeness of the same configuration may change, e.g. when formats become renderable.
+    void invalidateCompleteConfigurations();
     ANGLE_INLINE bool cachedStatusValid() { return mCachedStatus.valid(); }
 
     ANGLE_INLINE const FramebufferStatus &checkStatus(const Context *context) const
@@ -447,6 +493,9 @@ class Framebuffer final : public angle::ObserverInterface,
                                   GLuint matchId);
     FramebufferStatus checkStatusWithGLFrontEnd(const Context *context) const;
     const FramebufferStatus &checkStatusImpl(const Context *context) const;
+    void updateCompletenessKey(const Context *context) const;
+    bool isCompleteConfiguration() const;
+    void addCompleteConfiguration() const;
     void setAttachment(const Context *context,
                        GLenum type,
                        GLenum binding,
@@ -507,6 +556,17 @@ class Framebuffer final : public angle::ObserverInterface,
     rx::FramebufferImpl *mImpl;
 
     mutable Optional<FramebufferStatus> mCachedStatus;
+
+    // The last attachment configurations the framebuffer was found complete with, so that
+    // attaching them again, e.g. when ping-ponging between textures, skips the completeness
+    // checks and the back-end query.
+    static constexpr size_t kCompleteConfigurationCacheSize = 4;
+    mutable FramebufferCompletenessKey mCompletenessKey;
+    mutable std::array<FramebufferCompletenessKey, kCompleteConfigurationCacheSize>
+        mCompleteConfigurations;
+    mutable size_t mCompleteConfigurationCount = 0;
+    mutable size_t mNextCompleteConfiguration  = 0;
+
     std::vector<angle::ObserverBinding> mDirtyColorAttachmentBindings;
     angle::ObserverBinding mDirtyDepthAttachmentBinding;
     angle::ObserverBinding mDirtyStencilAttachmentBinding;
@@ -35,6 +35,11 @@ GLES1ShaderState::GLES1ShaderState(const GLES1ShaderState &other)
 {
     memcpy(this, &other, sizeof(GLES1ShaderState));
 }
+GLES1ShaderState &GLES1ShaderState::operator=(const GLES1ShaderState &other)
+{
+    memcpy(this, &other, sizeof(GLES1ShaderState));
+    return *this;
+}
 
 bool operator==(const GLES1ShaderState &a, const GLES1ShaderState &b)
 {
@@ -50,6 +55,75 @@ size_t GLES1ShaderState::hash() const
     return angle::ComputeGenericHash(*this);
 }
 
+namespace
+{
+struct ShaderStateEnable
+{
+    GLES1StateEnables state;
+    const char *name;
+};
+
+constexpr ShaderStateEnable kVertexShaderStateEnables[] = {
+    {GLES1StateEnables::DrawTexture, "enable_draw_texture"},
+    {GLES1StateEnables::PointRasterization, "point_rasterization"},
+    {GLES1StateEnables::RescaleNormal, "enable_rescale_normal"},
+    {GLES1StateEnables::Normalize, "enable_normalize"},
+};
+
+constexpr ShaderStateEnable kFragmentShaderStateEnables[] = {
+    {GLES1StateEnables::Lighting, "enable_lighting"},
+    {GLES1StateEnables::Fog, "enable_fog"},
+    {GLES1StateEnables::ClipPlanes, "enable_clip_planes"},
+    {GLES1StateEnables::DrawTexture, "enable_draw_texture"},
+    {GLES1StateEnables::PointRasterization, "point_rasterization"},
+    {GLES1StateEnables::PointSprite, "point_sprite_enabled"},
+    {GLES1StateEnables::AlphaTest, "enable_alpha_test"},
+    {GLES1StateEnables::ShadeModelFlat, "shade_model_flat"},
+    {GLES1StateEnables::ColorMaterial, "enable_color_material"},
+    {GLES1StateEnables::LightModelTwoSided, "light_model_two_sided"},
+};
+
+struct ShaderStateTexEnable
+{
+    const char *name;
+    GLES1ShaderState::BoolTexArray GLES1ShaderState::*value;
+};
+
+constexpr ShaderStateTexEnable kFragmentShaderStateTexEnables[] = {
+    {"enable_texture_2d", &GLES1ShaderState::tex2DEnables},
+    {"enable_texture_cube_map", &GLES1ShaderState::texCubeEnables},
+    {"point_sprite_coord_replace", &GLES1ShaderState::pointSpriteCoordReplaces},
+};
+
+struct ShaderStateTexParameter
+{
+    const char *name;
+    GLES1ShaderState::IntTexArray GLES1ShaderState::*value;
+};
+
+constexpr ShaderStateTexParameter kFragmentShaderStateTexParameters[] = {
+    {"texture_format", &GLES1ShaderState::tex2DFormats},
+    {"texture_env_mode", &GLES1ShaderState::texEnvModes},
+    {"combine_rgb", &GLES1ShaderState::texCombineRgbs},
+    {"combine_alpha", &GLES1ShaderState::texCombineAlphas},
+    {"src0_rgb", &GLES1ShaderState::texCombineSrc0Rgbs},
+    {"src0_alpha", &GLES1ShaderState::texCombineSrc0Alphas},
+    {"src1_rgb", &GLES1ShaderState::texCombineSrc1Rgbs},
+    {"src1_alpha", &GLES1ShaderState::texCombineSrc1Alphas},
+    {"src2_rgb", &GLES1ShaderState::texCombineSrc2Rgbs},
+    {"src2_alpha", &GLES1ShaderState::texCombineSrc2Alphas},
+    {"op0_rgb", &GLES1ShaderState::texCombineOp0Rgbs},
+    {"op0_alpha", &GLES1ShaderState::texCombineOp0Alphas},
+    {"op1_rgb", &GLES1ShaderState::texCombineOp1Rgbs},
+    {"op1_alpha", &GLES1ShaderState::texCombineOp1Alphas},
+    {"op2_rgb", &GLES1ShaderState::texCombineOp2Rgbs},
+    {"op2_alpha", &GLES1ShaderState::texCombineOp2Alphas},
+};
+
+// The generic program takes the per texture unit state as vectors.
+static_assert(kTexUnitCount == 4, "The generic program assumes 4 texture units");
+}  // anonymous namespace
+
 GLES1Renderer::GLES1Renderer() : mRendererProgramInitialized(false) {}
 
 void GLES1Renderer::onDestroy(Context *context, State *state)
@@ -62,10 +136,20 @@ void GLES1Renderer::onDestroy(Context *context, State *state)
         {
             const GLES1UberShaderState &UberShaderState = iter.second;
             mShaderPrograms->deleteProgram(context, {UberShaderState.programState.program});
+            mShaderPrograms->deleteShader(context, UberShaderState.pendingVertexShader);
+            mShaderPrograms->deleteShader(context, UberShaderState.pendingFragmentShader);
+        }
+        if (mGenericProgramInitialized)
+        {
+            mShaderPrograms->deleteProgram(context,
+                                           {mGenericUberShaderState.programState.program});
         }
+        mUberShaderState.clear();
+        mCurrentUberShaderState = nullptr;
         mShaderPrograms->release(context);
         mShaderPrograms             = nullptr;
         mRendererProgramInitialized = false;
+        mGenericProgramInitialized  = false;
     }
 }
 
@@ -74,6 +158,8 @@ GLES1Renderer::~GLES1Renderer() = default;
 angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context, State *glState)
 {
     GLES1State &gles1State = glState->gles1();
+    // Reading through the non-const accessors of the state would mark it dirty.
+    const GLES1State &constGLES1State = gles1State;
 
     GLES1ShaderState::BoolTexArray &tex2DEnables   = mShaderState.tex2DEnables;
     GLES1ShaderState::BoolTexArray &texCubeEnables = mShaderState.texCubeEnables;
@@ -131,7 +217,7 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     {
         for (int i = 0; i < kTexUnitCount; i++)
         {
-            const auto &env         = gles1State.textureEnvironment(i);
+            const auto &env         = constGLES1State.textureEnvironment(i);
             texEnvModes[i]          = ToGLenum(env.mode);
             texCombineRgbs[i]       = ToGLenum(env.combineRgb);
             texCombineAlphas[i]     = ToGLenum(env.combineAlpha);
@@ -185,7 +271,7 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
         mShaderState.pointSpriteCoordReplaces;
     for (int i = 0; i < kTexUnitCount; i++)
     {
-        const auto &env             = gles1State.textureEnvironment(i);
+        const auto &env             = constGLES1State.textureEnvironment(i);
         pointSpriteCoordReplaces[i] = env.pointSpriteCoordReplace;
     }
 
@@ -197,54 +283,32 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     }
 
     mShaderState.alphaTestFunc = gles1State.mAlphaTestFunc;
-    mShaderState.fogMode       = gles1State.fogParameters().mode;
+    mShaderState.fogMode       = constGLES1State.fogParameters().mode;
 
     // All the states set before this spot affect ubershader creation
 
     ANGLE_TRY(initializeRendererProgram(context, glState));
 
-    GLES1UberShaderState UberShaderState = getUberShaderState();
+    GLES1UberShaderState &UberShaderState = getUberShaderState();
 
     const GLES1ProgramState &programState = UberShaderState.programState;
-    GLES1UniformBuffers &uniformBuffers   = UberShaderState.uniformBuffers;
+    GLES1UniformBuffers &uniformBuffers   = mUniformBuffers;
 
     Program *programObject = getProgram(programState.program);
 
-    // If anything is dirty in gles1 or the common parts of gles1/2, just redo these parts
-    // completely for now.
+    // Each group of state is packed in one uniform array, which is only updated if the group is
+    // dirty in gles1 or the common parts of gles1/2.
 
     // Feature enables
-
-    // Texture unit enables and format info
-    std::array<Vec4Uniform, kTexUnitCount> texCropRects;
-    Vec4Uniform *cropRectBuffer = texCropRects.data();
-    for (int i = 0; i < kTexUnitCount; i++)
+    if (&UberShaderState == &mGenericUberShaderState)
     {
-        Texture *curr2DTexture = glState->getSamplerTexture(i, TextureType::_2D);
-        if (curr2DTexture)
-        {
-            const gl::Rectangle &cropRect = curr2DTexture->getCrop();
-
-            GLfloat textureWidth =
-                static_cast<GLfloat>(curr2DTexture->getWidth(TextureTarget::_2D, 0));
-            GLfloat textureHeight =
-                static_cast<GLfloat>(curr2DTexture->getHeight(TextureTarget::_2D, 0));
-
-            if (textureWidth > 0.0f && textureHeight > 0.0f)
-            {
-                cropRectBuffer[i][0] = cropRect.x / textureWidth;
-                cropRectBuffer[i][1] = cropRect.y / textureHeight;
-                cropRectBuffer[i][2] = cropRect.width / textureWidth;
-                cropRectBuffer[i][3] = cropRect.height / textureHeight;
-            }
-        }
+        setGenericProgramShaderState(context, programObject);
     }
-    setUniform4fv(programObject, programState.drawTextureNormalizedCropRectLoc, kTexUnitCount,
-                  reinterpret_cast<GLfloat *>(cropRectBuffer));
 
     // Client state / current vector enables
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_CLIENT_STATE_ENABLE) ||
-        gles1State.isDirty(GLES1State::DIRTY_GLES1_CURRENT_VECTOR))
+        gles1State.isDirty(GLES1State::DIRTY_GLES1_CURRENT_VECTOR) ||
+        gles1State.isDirty(GLES1State::DIRTY_GLES1_POINT_PARAMETERS))
     {
         if (!gles1State.isClientStateEnabled(ClientVertexArrayType::Normal))
         {
@@ -279,50 +343,46 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     // Matrices
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_MATRICES))
     {
-        angle::Mat4 proj = gles1State.mProjectionMatrices.back();
-        setUniformMatrix4fv(programObject, programState.projMatrixLoc, 1, GL_FALSE, proj.data());
-
-        angle::Mat4 modelview = gles1State.mModelviewMatrices.back();
-        setUniformMatrix4fv(programObject, programState.modelviewMatrixLoc, 1, GL_FALSE,
-                            modelview.data());
-
-        angle::Mat4 modelviewInvTr = modelview.transpose().inverse();
-        setUniformMatrix4fv(programObject, programState.modelviewInvTrLoc, 1, GL_FALSE,
-                            modelviewInvTr.data());
-
-        Mat4Uniform *textureMatrixBuffer = uniformBuffers.textureMatrices.data();
+        Mat4Uniform *matrixBuffer = uniformBuffers.matrices.data();
 
         for (int i = 0; i < kTexUnitCount; i++)
         {
             angle::Mat4 textureMatrix = gles1State.mTextureMatrices[i].back();
-            memcpy(textureMatrixBuffer + i, textureMatrix.data(), sizeof(Mat4Uniform));
+            memcpy(matrixBuffer + i, textureMatrix.data(), sizeof(Mat4Uniform));
         }
 
-        setUniformMatrix4fv(programObject, programState.textureMatrixLoc, kTexUnitCount, GL_FALSE,
-                            reinterpret_cast<float *>(uniformBuffers.textureMatrices.data()));
+        angle::Mat4 proj = gles1State.mProjectionMatrices.back();
+        memcpy(matrixBuffer + kTexUnitCount, proj.data(), sizeof(Mat4Uniform));
+
+        angle::Mat4 modelview = gles1State.mModelviewMatrices.back();
+        memcpy(matrixBuffer + kTexUnitCount + 1, modelview.data(), sizeof(Mat4Uniform));
+
+        angle::Mat4 modelviewInvTr = modelview.transpose().inverse();
+        memcpy(matrixBuffer + kTexUnitCount + 2, modelviewInvTr.data(), sizeof(Mat4Uniform));
+
+        setUniformMatrix4fv(programObject, programState.matricesLoc, kMatrixUniformCount,
+                            GL_FALSE, reinterpret_cast<float *>(matrixBuffer));
     }
 
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_TEXTURE_ENVIRONMENT))
     {
+        Vec4Uniform *textureEnvBuffer = uniformBuffers.textureEnv.data();
+
         for (int i = 0; i < kTexUnitCount; i++)
         {
-            const auto &env = gles1State.textureEnvironment(i);
+            const auto &env = constGLES1State.textureEnvironment(i);
 
-            uniformBuffers.texEnvColors[i][0] = env.color.red;
-            uniformBuffers.texEnvColors[i][1] = env.color.green;
-            uniformBuffers.texEnvColors[i][2] = env.color.blue;
-            uniformBuffers.texEnvColors[i][3] = env.color.alpha;
+            textureEnvBuffer[i][0] = env.color.red;
+            textureEnvBuffer[i][1] = env.color.green;
+            textureEnvBuffer[i][2] = env.color.blue;
+            textureEnvBuffer[i][3] = env.color.alpha;
 
-            uniformBuffers.texEnvRgbScales[i]   = env.rgbScale;
-            uniformBuffers.texEnvAlphaScales[i] = env.alphaScale;
+            textureEnvBuffer[kTexUnitCount + i][0] = env.rgbScale;
+            textureEnvBuffer[kTexUnitCount + i][1] = env.alphaScale;
         }
 
-        setUniform4fv(programObject, programState.textureEnvColorLoc, kTexUnitCount,
-                      reinterpret_cast<float *>(uniformBuffers.texEnvColors.data()));
-        setUniform1fv(programObject, programState.rgbScaleLoc, kTexUnitCount,
-                      uniformBuffers.texEnvRgbScales.data());
-        setUniform1fv(programObject, programState.alphaScaleLoc, kTexUnitCount,
-                      uniformBuffers.texEnvAlphaScales.data());
+        setUniform4fv(programObject, programState.textureEnvLoc, kTextureEnvUniformCount,
+                      reinterpret_cast<float *>(textureEnvBuffer));
     }
 
     // Alpha test
@@ -334,72 +394,60 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     // Shading, materials, and lighting
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_MATERIAL))
     {
-        const auto &material = gles1State.mMaterial;
-
-        setUniform4fv(programObject, programState.materialAmbientLoc, 1, material.ambient.data());
-        setUniform4fv(programObject, programState.materialDiffuseLoc, 1, material.diffuse.data());
-        setUniform4fv(programObject, programState.materialSpecularLoc, 1, material.specular.data());
-        setUniform4fv(programObject, programState.materialEmissiveLoc, 1, material.emissive.data());
-        setUniform1f(programObject, programState.materialSpecularExponentLoc,
-                     material.specularExponent);
+        const auto &material        = gles1State.mMaterial;
+        Vec4Uniform *materialBuffer = uniformBuffers.material.data();
+
+        memcpy(materialBuffer + 0, material.ambient.data(), sizeof(Vec4Uniform));
+        memcpy(materialBuffer + 1, material.diffuse.data(), sizeof(Vec4Uniform));
+        memcpy(materialBuffer + 2, material.specular.data(), sizeof(Vec4Uniform));
+        memcpy(materialBuffer + 3, material.emissive.data(), sizeof(Vec4Uniform));
+        materialBuffer[4][0] = material.specularExponent;
+
+        setUniform4fv(programObject, programState.materialLoc, kMaterialUniformCount,
+                      reinterpret_cast<float *>(materialBuffer));
     }
 
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_LIGHTS))
     {
-        const auto &lightModel = gles1State.mLightModel;
-
-        setUniform4fv(programObject, programState.lightModelSceneAmbientLoc, 1,
-                      lightModel.color.data());
+        const auto &lightModel   = gles1State.mLightModel;
+        Vec4Uniform *lightBuffer = uniformBuffers.lights.data();
 
         for (int i = 0; i < kLightCount; i++)
         {
-            const auto &light = gles1State.mLights[i];
-            memcpy(uniformBuffers.lightAmbients.data() + i, light.ambient.data(),
-                   sizeof(Vec4Uniform));
-            memcpy(uniformBuffers.lightDiffuses.data() + i, light.diffuse.data(),
-                   sizeof(Vec4Uniform));
-            memcpy(uniformBuffers.lightSpeculars.data() + i, light.specular.data(),
-                   sizeof(Vec4Uniform));
-            memcpy(uniformBuffers.lightPositions.data() + i, light.position.data(),
-                   sizeof(Vec4Uniform));
-            memcpy(uniformBuffers.lightDirections.data() + i, light.direction.data(),
-                   sizeof(Vec3Uniform));
-            uniformBuffers.spotlightExponents[i]    = light.spotlightExponent;
-            uniformBuffers.spotlightCutoffAngles[i] = light.spotlightCutoffAngle;
-            uniformBuffers.attenuationConsts[i]     = light.attenuationConst;
-            uniformBuffers.attenuationLinears[i]    = light.attenuationLinear;
-            uniformBuffers.attenuationQuadratics[i] = light.attenuationQuadratic;
+            const auto &light       = gles1State.mLights[i];
+            Vec4Uniform *lightEntry = lightBuffer + i * kUniformsPerLight;
+
+            memcpy(lightEntry + 0, light.ambient.data(), sizeof(Vec4Uniform));
+            memcpy(lightEntry + 1, light.diffuse.data(), sizeof(Vec4Uniform));
+            memcpy(lightEntry + 2, light.specular.data(), sizeof(Vec4Uniform));
+            memcpy(lightEntry + 3, light.position.data(), sizeof(Vec4Uniform));
+            memcpy(lightEntry + 4, light.direction.data(), sizeof(Vec3Uniform));
+            lightEntry[4][3] = light.spotlightExponent;
+            lightEntry[5][0] = light.spotlightCutoffAngle;
+            lightEntry[5][1] = light.attenuationConst;
+            lightEntry[5][2] = light.attenuationLinear;
+            lightEntry[5][3] = light.attenuationQuadratic;
         }
 
-        setUniform4fv(programObject, programState.lightAmbientsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.lightAmbients.data()));
-        setUniform4fv(programObject, programState.lightDiffusesLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.lightDiffuses.data()));
-        setUniform4fv(programObject, programState.lightSpecularsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.lightSpeculars.data()));
-        setUniform4fv(programObject, programState.lightPositionsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.lightPositions.data()));
-        setUniform3fv(programObject, programState.lightDirectionsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.lightDirections.data()));
-        setUniform1fv(programObject, programState.lightSpotlightExponentsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.spotlightExponents.data()));
-        setUniform1fv(programObject, programState.lightSpotlightCutoffAnglesLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.spotlightCutoffAngles.data()));
-        setUniform1fv(programObject, programState.lightAttenuationConstsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.attenuationConsts.data()));
-        setUniform1fv(programObject, programState.lightAttenuationLinearsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.attenuationLinears.data()));
-        setUniform1fv(programObject, programState.lightAttenuationQuadraticsLoc, kLightCount,
-                      reinterpret_cast<float *>(uniformBuffers.attenuationQuadratics.data()));
+        memcpy(lightBuffer + kLightCount * kUniformsPerLight, lightModel.color.data(),
+               sizeof(Vec4Uniform));
+
+        setUniform4fv(programObject, programState.lightsLoc, kLightUniformCount,
+                      reinterpret_cast<float *>(lightBuffer));
     }
 
     if (gles1State.isDirty(GLES1State::DIRTY_GLES1_FOG))
     {
-        const FogParameters &fog = gles1State.fogParameters();
-        setUniform1f(programObject, programState.fogDensityLoc, fog.density);
-        setUniform1f(programObject, programState.fogStartLoc, fog.start);
-        setUniform1f(programObject, programState.fogEndLoc, fog.end);
-        setUniform4fv(programObject, programState.fogColorLoc, 1, fog.color.data());
+        const FogParameters &fog = constGLES1State.fogParameters();
+        Vec4Uniform *fogBuffer   = uniformBuffers.fog.data();
+
+        fogBuffer[0][0] = fog.density;
+        fogBuffer[0][1] = fog.start;
+        fogBuffer[0][2] = fog.end;
+        memcpy(fogBuffer + 1, fog.color.data(), sizeof(Vec4Uniform));
+
+        setUniform4fv(programObject, programState.fogLoc, kFogUniformCount,
+                      reinterpret_cast<float *>(fogBuffer));
     }
 
     // Clip planes
@@ -416,19 +464,53 @@ angle::Result GLES1Renderer::prepareForDraw(PrimitiveMode mode, Context *context
     }
 
     // Point rasterization
+    if (gles1State.isDirty(GLES1State::DIRTY_GLES1_POINT_PARAMETERS))
     {
         const PointParameters &pointParams = gles1State.mPointParameters;
+        Vec4Uniform *pointBuffer           = uniformBuffers.pointParameters.data();
+
+        pointBuffer[0][0] = pointParams.pointSizeMin;
+        pointBuffer[0][1] = pointParams.pointSizeMax;
+        memcpy(pointBuffer + 1, pointParams.pointDistanceAttenuation.data(), sizeof(Vec3Uniform));
 
-        setUniform1f(programObject, programState.pointSizeMinLoc, pointParams.pointSizeMin);
-        setUniform1f(programObject, programState.pointSizeMaxLoc, pointParams.pointSizeMax);
-        setUniform3fv(programObject, programState.pointDistanceAttenuationLoc, 1,
-                      pointParams.pointDistanceAttenuation.data());
+        setUniform4fv(programObject, programState.pointParametersLoc, kPointParameterUniformCount,
+                      reinterpret_cast<float *>(pointBuffer));
     }
 
     // Draw texture
+    if (mDrawTextureEnabled)
     {
-        setUniform4fv(programObject, programState.drawTextureCoordsLoc, 1, mDrawTextureCoords);
-        setUniform2fv(programObject, programState.drawTextureDimsLoc, 1, mDrawTextureDims);
+        Vec4Uniform *drawTextureBuffer = uniformBuffers.drawTexture.data();
+
+        // Texture crop rectangles
+        for (int i = 0; i < kTexUnitCount; i++)
+        {
+            Texture *curr2DTexture = glState->getSamplerTexture(i, TextureType::_2D);
+            if (curr2DTexture)
+            {
+                const gl::Rectangle &cropRect = curr2DTexture->getCrop();
+
+                GLfloat textureWidth =
+                    static_cast<GLfloat>(curr2DTexture->getWidth(TextureTarget::_2D, 0));
+                GLfloat textureHeight =
+                    static_cast<GLfloat>(curr2DTexture->getHeight(TextureTarget::_2D, 0));
+
+                if (textureWidth > 0.0f && textureHeight > 0.0f)
+                {
+                    drawTextureBuffer[i][0] = cropRect.x / textureWidth;
+                    drawTextureBuffer[i][1] = cropRect.y / textureHeight;
+                    drawTextureBuffer[i][2] = cropRect.width / textureWidth;
+                    drawTextureBuffer[i][3] = cropRect.height / textureHeight;
+                }
+            }
+        }
+
+        memcpy(drawTextureBuffer + kTexUnitCount, mDrawTextureCoords, sizeof(Vec4Uniform));
+        drawTextureBuffer[kTexUnitCount + 1][0] = mDrawTextureDims[0];
+        drawTextureBuffer[kTexUnitCount + 1][1] = mDrawTextureDims[1];
+
+        setUniform4fv(programObject, programState.drawTextureLoc, kDrawTextureUniformCount,
+                      reinterpret_cast<float *>(drawTextureBuffer));
     }
 
     gles1State.clearDirty();
@@ -546,6 +628,15 @@ angle::Result GLES1Renderer::compileShader(Context *context,
                                            ShaderType shaderType,
                                            const char *src,
                                            ShaderProgramID *shaderOut)
+{
+    ANGLE_TRY(startShaderCompile(context, shaderType, src, shaderOut));
+    return checkShaderCompiled(context, *shaderOut);
+}
+
+angle::Result GLES1Renderer::startShaderCompile(Context *context,
+                                                ShaderType shaderType,
+                                                const char *src,
+                                                ShaderProgramID *shaderOut)
 {
     rx::ContextImpl *implementation = context->getImplementation();
     const Limitations &limitations  = implementation->getNativeLimitations();
@@ -555,10 +646,18 @@ angle::Result GLES1Renderer::compileShader(Context *context,
     Shader *shaderObject = getShader(shader);
     ANGLE_CHECK(context, shaderObject, "Missing shader object", GL_INVALID_OPERATION);
 
+    // The translation runs on the worker threads of the context if there are any.
     shaderObject->setSource(1, &src, nullptr);
     shaderObject->compile(context);
 
     *shaderOut = shader;
+    return angle::Result::Continue;
+}
+
+angle::Result GLES1Renderer::checkShaderCompiled(Context *context, ShaderProgramID shader)
+{
+    Shader *shaderObject = getShader(shader);
+    ANGLE_CHECK(context, shaderObject, "Missing shader object", GL_INVALID_OPERATION);
 
     if (!shaderObject->isCompiled())
     {
@@ -719,37 +818,30 @@ void GLES1Renderer::addShaderBoolClipPlaneArray(std::stringstream &outStream,
 
 void GLES1Renderer::addVertexShaderDefs(std::stringstream &outStream)
 {
-    addShaderDefine(outStream, GLES1StateEnables::DrawTexture, "enable_draw_texture");
-    addShaderDefine(outStream, GLES1StateEnables::PointRasterization, "point_rasterization");
-    addShaderDefine(outStream, GLES1StateEnables::RescaleNormal, "enable_rescale_normal");
-    addShaderDefine(outStream, GLES1StateEnables::Normalize, "enable_normalize");
+    for (const ShaderStateEnable &enable : kVertexShaderStateEnables)
+    {
+        addShaderDefine(outStream, enable.state, enable.name);
+    }
 }
 
 void GLES1Renderer::addFragmentShaderDefs(std::stringstream &outStream)
 {
-    addShaderDefine(outStream, GLES1StateEnables::Lighting, "enable_lighting");
-    addShaderDefine(outStream, GLES1StateEnables::Fog, "enable_fog");
-    addShaderDefine(outStream, GLES1StateEnables::ClipPlanes, "enable_clip_planes");
-    addShaderDefine(outStream, GLES1StateEnables::DrawTexture, "enable_draw_texture");
-    addShaderDefine(outStream, GLES1StateEnables::PointRasterization, "point_rasterization");
-    addShaderDefine(outStream, GLES1StateEnables::PointSprite, "point_sprite_enabled");
-    addShaderDefine(outStream, GLES1StateEnables::AlphaTest, "enable_alpha_test");
-    addShaderDefine(outStream, GLES1StateEnables::ShadeModelFlat, "shade_model_flat");
-    addShaderDefine(outStream, GLES1StateEnables::ColorMaterial, "enable_color_material");
-    addShaderDefine(outStream, GLES1StateEnables::LightModelTwoSided, "light_model_two_sided");
+    for (const ShaderStateEnable &enable : kFragmentShaderStateEnables)
+    {
+        addShaderDefine(outStream, enable.state, enable.name);
+    }
 
     // bool enable_texture_2d[kMaxTexUnits] = bool[kMaxTexUnits](...);
-    addShaderBoolTexArray(outStream, "enable_texture_2d", mShaderState.tex2DEnables);
-
-    // bool enable_texture_cube_map[kMaxTexUnits] = bool[kMaxTexUnits](...);
-    addShaderBoolTexArray(outStream, "enable_texture_cube_map", mShaderState.texCubeEnables);
-
-    // int texture_format[kMaxTexUnits] = int[kMaxTexUnits](...);
-    addShaderIntTexArray(outStream, "texture_format", mShaderState.tex2DFormats);
+    for (const ShaderStateTexEnable &texEnable : kFragmentShaderStateTexEnables)
+    {
+        addShaderBoolTexArray(outStream, texEnable.name, mShaderState.*texEnable.value);
+    }
 
-    // bool point_sprite_coord_replace[kMaxTexUnits] = bool[kMaxTexUnits](...);
-    addShaderBoolTexArray(outStream, "point_sprite_coord_replace",
-                          mShaderState.pointSpriteCoordReplaces);
+    // const int texture_format[kMaxTexUnits] = int[kMaxTexUnits](...);
+    for (const ShaderStateTexParameter &texParameter : kFragmentShaderStateTexParameters)
+    {
+        addShaderIntTexArray(outStream, texParameter.name, mShaderState.*texParameter.value);
+    }
 
     // bool light_enables[kMaxLights] = bool[kMaxLights](...);
     addShaderBoolLightArray(outStream, "light_enables", mShaderState.lightEnables);
@@ -757,51 +849,6 @@ void GLES1Renderer::addFragmentShaderDefs(std::stringstream &outStream)
     // bool clip_plane_enables[kMaxClipPlanes] = bool[kMaxClipPlanes](...);
     addShaderBoolClipPlaneArray(outStream, "clip_plane_enables", mShaderState.clipPlaneEnables);
 
-    // int texture_format[kMaxTexUnits] = int[kMaxTexUnits](...);
-    addShaderIntTexArray(outStream, "texture_env_mode", mShaderState.texEnvModes);
-
-    // int combine_rgb[kMaxTexUnits];
-    addShaderIntTexArray(outStream, "combine_rgb", mShaderState.texCombineRgbs);
-
-    // int combine_alpha[kMaxTexUnits];
-    addShaderIntTexArray(outStream, "combine_alpha", mShaderState.texCombineAlphas);
-
-    // int src0_rgb[kMaxTexUnits];
-    addShaderIntTexArray(outStream, "src0_rgb", mShaderState.texCombineSrc0Rgbs);
-
-    // int src0_alpha[kMaxTexUnits];
-    addShaderIntTexArray(outStream, "src0_alpha", mShaderState.texCombineSrc0Alphas);
-
-    // int src1_rgb[kMaxTexUnits];
-    addShaderIntTexArray(outStream, "src1_rgb", mShaderState.texCombineSrc1Rgbs);
-
-    // int src1_alpha[kMaxTexUnits];
-    addShaderIntTexArray(outStream, "src1_alpha", mShaderState.texCombineSrc1Alphas);
-
-    // int src2_rgb[kMaxTexUnits];
-    addShaderIntTexArray(outStream, "src2_rgb", mShaderState.texCombineSrc2Rgbs);
-
-    // int src2_alpha[kMaxTexUnits];
-    addShaderIntTexArray(outStream, "src2_alpha", mShaderState.texCombineSrc2Alphas);
-
-    // int op0_rgb[kMaxTexUnits];
-    addShaderIntTexArray(outStream, "op0_rgb", mShaderState.texCombineOp0Rgbs);
-
-    // int op0_alpha[kMaxTexUnits];
-    addShaderIntTexArray(outStream, "op0_alpha", mShaderState.texCombineOp0Alphas);
-
-    // int op1_rgb[kMaxTexUnits];
-    addShaderIntTexArray(outStream, "op1_rgb", mShaderState.texCombineOp1Rgbs);
-
-    // int op1_alpha[kMaxTexUnits];
-    addShaderIntTexArray(outStream, "op1_alpha", mShaderState.texCombineOp1Alphas);
-
-    // int op2_rgb[kMaxTexUnits];
-    addShaderIntTexArray(outStream, "op2_rgb", mShaderState.texCombineOp2Rgbs);
-
-    // int op2_alpha[kMaxTexUnits];
-    addShaderIntTexArray(outStream, "op2_alpha", mShaderState.texCombineOp2Alphas);
-
     // int alpha_func;
     addShaderInt(outStream, "alpha_func", ToGLenum(mShaderState.alphaTestFunc));
 
@@ -809,48 +856,76 @@ void GLES1Renderer::addFragmentShaderDefs(std::stringstream &outStream)
     addShaderInt(outStream, "fog_mode", ToGLenum(mShaderState.fogMode));
 }
 
-angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *glState)
+void GLES1Renderer::addGenericVertexShaderDefs(std::stringstream &outStream)
 {
-    // See if we have the shader for this combination of states
-    if (mUberShaderState.find(mShaderState) != mUberShaderState.end())
+    for (const ShaderStateEnable &enable : kVertexShaderStateEnables)
     {
-        Program *programObject = getProgram(getUberShaderState().programState.program);
-
-        // If this is different than the current program, we need to sync everything
-        // TODO: This could be optimized to only dirty state that differs between the two programs
-        if (glState->getProgram()->id() != programObject->id())
-        {
-            glState->gles1().setAllDirty();
-        }
+        outStream << "\n";
+        outStream << "uniform bool " << enable.name << ";";
+    }
+}
 
-        ANGLE_TRY(glState->setProgram(context, programObject));
-        return angle::Result::Continue;
+void GLES1Renderer::addGenericFragmentShaderDefs(std::stringstream &outStream)
+{
+    for (const ShaderStateEnable &enable : kFragmentShaderStateEnables)
+    {
+        outStream << "\n";
+        outStream << "uniform bool " << enable.name << ";";
     }
 
-    if (!mRendererProgramInitialized)
+    // The per texture unit state is indexed like the arrays of the specialized programs, but
+    // vectors take less uniform space.
+    for (const ShaderStateTexEnable &texEnable : kFragmentShaderStateTexEnables)
     {
-        mShaderPrograms = new ShaderProgramManager();
+        outStream << "\n";
+        outStream << "uniform bvec4 " << texEnable.name << ";";
     }
 
-    // If we get here, we don't have a shader for this state, need to create it
-    GLES1ProgramState &programState = mUberShaderState[mShaderState].programState;
+    for (const ShaderStateTexParameter &texParameter : kFragmentShaderStateTexParameters)
+    {
+        outStream << "\n";
+        outStream << "uniform highp ivec4 " << texParameter.name << ";";
+    }
 
-    ShaderProgramID vertexShader;
-    ShaderProgramID fragmentShader;
+    outStream << "\n";
+    outStream << "uniform bool light_enables[kMaxLights];";
+    outStream << "\n";
+    outStream << "uniform bool clip_plane_enables[kMaxClipPlanes];";
+    outStream << "\n";
+    outStream << "uniform highp int alpha_func;";
+    outStream << "\n";
+    outStream << "uniform highp int fog_mode;";
+}
 
+void GLES1Renderer::generateShaderSources(bool generic,
+                                          std::string *vertexOut,
+                                          std::string *fragmentOut)
+{
     std::stringstream GLES1DrawVShaderStateDefs;
-    addVertexShaderDefs(GLES1DrawVShaderStateDefs);
+    if (generic)
+    {
+        addGenericVertexShaderDefs(GLES1DrawVShaderStateDefs);
+    }
+    else
+    {
+        addVertexShaderDefs(GLES1DrawVShaderStateDefs);
+    }
 
     std::stringstream vertexStream;
     vertexStream << kGLES1DrawVShaderHeader;
     vertexStream << GLES1DrawVShaderStateDefs.str();
     vertexStream << kGLES1DrawVShader;
-
-    ANGLE_TRY(
-        compileShader(context, ShaderType::Vertex, vertexStream.str().c_str(), &vertexShader));
+    *vertexOut = vertexStream.str();
 
     std::stringstream GLES1DrawFShaderStateDefs;
-    addFragmentShaderDefs(GLES1DrawFShaderStateDefs);
+    if (generic)
+    {
+        addGenericFragmentShaderDefs(GLES1DrawFShaderStateDefs);
+    }
+    else
+    {
+        addFragmentShaderDefs(GLES1DrawFShaderStateDefs);
+    }
 
     std::stringstream fragmentStream;
     fragmentStream << kGLES1DrawFShaderHeader;
@@ -859,9 +934,143 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *
     fragmentStream << kGLES1DrawFShaderFunctions;
     fragmentStream << kGLES1DrawFShaderMultitexturing;
     fragmentStream << kGLES1DrawFShaderMain;
+    *fragmentOut = fragmentStream.str();
+}
+
+angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *glState)
+{
+    if (!mRendererProgramInitialized)
+    {
+        mShaderPrograms             = new ShaderProgramManager();
+        mRendererProgramInitialized = true;
+    }
+
+    // Most draws don't change the shader state, in which case the program of the previous draw is
+    // used without hashing the state.
+    if (mCurrentUberShaderState == nullptr || mShaderState != mCurrentShaderState)
+    {
+        // See if we have the shader for this combination of states
+        auto iter = mUberShaderState.find(mShaderState);
+        if (iter == mUberShaderState.end())
+        {
+            // If we get here, we don't have a shader for this state, need to create it.  The
+            // shaders are translated on the worker threads of the context if it has any, and the
+            // generic program is used in the meantime.
+            iter = mUberShaderState.emplace(mShaderState, GLES1UberShaderState()).first;
+            GLES1UberShaderState &newUberShaderState = iter->second;
+
+            std::string vertexSource;
+            std::string fragmentSource;
+            generateShaderSources(false, &vertexSource, &fragmentSource);
+
+            ANGLE_TRY(startShaderCompile(context, ShaderType::Vertex, vertexSource.c_str(),
+                                         &newUberShaderState.pendingVertexShader));
+            ANGLE_TRY(startShaderCompile(context, ShaderType::Fragment, fragmentSource.c_str(),
+                                         &newUberShaderState.pendingFragmentShader));
+        }
 
-    ANGLE_TRY(compileShader(context, ShaderType::Fragment, fragmentStream.str().c_str(),
-                            &fragmentShader));
+        // The map may have been rehashed by the insertion above, so this is always updated.
+        mCurrentShaderState     = mShaderState;
+        mCurrentUberShaderState = &iter->second;
+    }
+
+    GLES1UberShaderState &uberShaderState = *mCurrentUberShaderState;
+    if (uberShaderState.programState.program.value == 0)
+    {
+        ShaderProgramID vertexShader   = uberShaderState.pendingVertexShader;
+        ShaderProgramID fragmentShader = uberShaderState.pendingFragmentShader;
+        if (getShader(vertexShader)->isCompleted() && getShader(fragmentShader)->isCompleted())
+        {
+            ANGLE_TRY(linkRendererProgram(context, glState, vertexShader, fragmentShader,
+                                          &uberShaderState.programState));
+            uberShaderState.pendingVertexShader   = {};
+            uberShaderState.pendingFragmentShader = {};
+        }
+        else
+        {
+            ANGLE_TRY(initializeGenericProgram(context, glState));
+        }
+    }
+
+    Program *programObject = getProgram(getUberShaderState().programState.program);
+
+    // If this is different than the current program, we need to sync everything
+    // TODO: This could be optimized to only dirty state that differs between the two programs
+    if (glState->getProgram() != programObject)
+    {
+        glState->gles1().setAllDirty();
+        ANGLE_TRY(glState->setProgram(context, programObject));
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result GLES1Renderer::initializeGenericProgram(Context *context, State *glState)
+{
+    if (mGenericProgramInitialized)
+    {
+        return angle::Result::Continue;
+    }
+
+    std::string vertexSource;
+    std::string fragmentSource;
+    generateShaderSources(true, &vertexSource, &fragmentSource);
+
+    ShaderProgramID vertexShader;
+    ShaderProgramID fragmentShader;
+    ANGLE_TRY(compileShader(context, ShaderType::Vertex, vertexSource.c_str(), &vertexShader));
+    ANGLE_TRY(
+        compileShader(context, ShaderType::Fragment, fragmentSource.c_str(), &fragmentShader));
+
+    GLES1ProgramState &programState = mGenericUberShaderState.programState;
+    ANGLE_TRY(linkRendererProgram(context, glState, vertexShader, fragmentShader, &programState));
+
+    Program *programObject = getProgram(programState.program);
+
+    static_assert(ArraySize(kFragmentShaderStateTexEnables) == kTexEnableUniformCount,
+                  "Mismatched texture enable uniform count");
+    static_assert(ArraySize(kFragmentShaderStateTexParameters) == kTexParameterUniformCount,
+                  "Mismatched texture parameter uniform count");
+
+    GLES1StateUniformLocations &locations = mGenericStateUniformLocs;
+    for (const ShaderStateEnable &enable : kVertexShaderStateEnables)
+    {
+        locations.enableLocs[enable.state] = programObject->getUniformLocation(enable.name);
+    }
+    for (const ShaderStateEnable &enable : kFragmentShaderStateEnables)
+    {
+        locations.enableLocs[enable.state] = programObject->getUniformLocation(enable.name);
+    }
+    for (size_t index = 0; index < kTexEnableUniformCount; ++index)
+    {
+        locations.texEnableLocs[index] =
+            programObject->getUniformLocation(kFragmentShaderStateTexEnables[index].name);
+    }
+    for (size_t index = 0; index < kTexParameterUniformCount; ++index)
+    {
+        locations.texParameterLocs[index] =
+            programObject->getUniformLocation(kFragmentShaderStateTexParameters[index].name);
+    }
+    locations.lightEnablesLoc     = programObject->getUniformLocation("light_enables");
+    locations.clipPlaneEnablesLoc = programObject->getUniformLocation("clip_plane_enables");
+    locations.alphaFuncLoc        = programObject->getUniformLocation("alpha_func");
+    locations.fogModeLoc          = programObject->getUniformLocation("fog_mode");
+
+    mGenericProgramInitialized      = true;
+    mGenericProgramShaderStateDirty = true;
+    return angle::Result::Continue;
+}
+
+angle::Result GLES1Renderer::linkRendererProgram(Context *context,
+                                                 State *glState,
+                                                 ShaderProgramID vertexShader,
+                                                 ShaderProgramID fragmentShader,
+                                                 GLES1ProgramState *programStateOut)
+{
+    GLES1ProgramState &programState = *programStateOut;
+
+    ANGLE_TRY(checkShaderCompiled(context, vertexShader));
+    ANGLE_TRY(checkShaderCompiled(context, fragmentShader));
 
     angle::HashMap<GLint, std::string> attribLocs;
 
@@ -885,10 +1094,7 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *
 
     Program *programObject = getProgram(programState.program);
 
-    programState.projMatrixLoc      = programObject->getUniformLocation("projection");
-    programState.modelviewMatrixLoc = programObject->getUniformLocation("modelview");
-    programState.textureMatrixLoc   = programObject->getUniformLocation("texture_matrix");
-    programState.modelviewInvTrLoc  = programObject->getUniformLocation("modelview_invtr");
+    programState.matricesLoc = programObject->getUniformLocation("matrices");
 
     for (int i = 0; i < kTexUnitCount; i++)
     {
@@ -903,54 +1109,20 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *
             programObject->getUniformLocation(sscube.str().c_str());
     }
 
-    programState.textureEnvColorLoc = programObject->getUniformLocation("texture_env_color");
-    programState.rgbScaleLoc        = programObject->getUniformLocation("texture_env_rgb_scale");
-    programState.alphaScaleLoc      = programObject->getUniformLocation("texture_env_alpha_scale");
+    programState.textureEnvLoc = programObject->getUniformLocation("texture_env_parameters");
 
     programState.alphaTestRefLoc = programObject->getUniformLocation("alpha_test_ref");
 
-    programState.materialAmbientLoc  = programObject->getUniformLocation("material_ambient");
-    programState.materialDiffuseLoc  = programObject->getUniformLocation("material_diffuse");
-    programState.materialSpecularLoc = programObject->getUniformLocation("material_specular");
-    programState.materialEmissiveLoc = programObject->getUniformLocation("material_emissive");
-    programState.materialSpecularExponentLoc =
-        programObject->getUniformLocation("material_specular_exponent");
-
-    programState.lightModelSceneAmbientLoc =
-        programObject->getUniformLocation("light_model_scene_ambient");
-
-    programState.lightAmbientsLoc   = programObject->getUniformLocation("light_ambients");
-    programState.lightDiffusesLoc   = programObject->getUniformLocation("light_diffuses");
-    programState.lightSpecularsLoc  = programObject->getUniformLocation("light_speculars");
-    programState.lightPositionsLoc  = programObject->getUniformLocation("light_positions");
-    programState.lightDirectionsLoc = programObject->getUniformLocation("light_directions");
-    programState.lightSpotlightExponentsLoc =
-        programObject->getUniformLocation("light_spotlight_exponents");
-    programState.lightSpotlightCutoffAnglesLoc =
-        programObject->getUniformLocation("light_spotlight_cutoff_angles");
-    programState.lightAttenuationConstsLoc =
-        programObject->getUniformLocation("light_attenuation_consts");
-    programState.lightAttenuationLinearsLoc =
-        programObject->getUniformLocation("light_attenuation_linears");
-    programState.lightAttenuationQuadraticsLoc =
-        programObject->getUniformLocation("light_attenuation_quadratics");
-
-    programState.fogDensityLoc = programObject->getUniformLocation("fog_density");
-    programState.fogStartLoc   = programObject->getUniformLocation("fog_start");
-    programState.fogEndLoc     = programObject->getUniformLocation("fog_end");
-    programState.fogColorLoc   = programObject->getUniformLocation("fog_color");
+    programState.materialLoc = programObject->getUniformLocation("material_parameters");
+    programState.lightsLoc   = programObject->getUniformLocation("light_parameters");
+
+    programState.fogLoc = programObject->getUniformLocation("fog_parameters");
 
     programState.clipPlanesLoc = programObject->getUniformLocation("clip_planes");
 
-    programState.pointSizeMinLoc = programObject->getUniformLocation("point_size_min");
-    programState.pointSizeMaxLoc = programObject->getUniformLocation("point_size_max");
-    programState.pointDistanceAttenuationLoc =
-        programObject->getUniformLocation("point_distance_attenuation");
+    programState.pointParametersLoc = programObject->getUniformLocation("point_parameters");
 
-    programState.drawTextureCoordsLoc = programObject->getUniformLocation("draw_texture_coords");
-    programState.drawTextureDimsLoc   = programObject->getUniformLocation("draw_texture_dims");
-    programState.drawTextureNormalizedCropRectLoc =
-        programObject->getUniformLocation("draw_texture_normalized_crop_rect");
+    programState.drawTextureLoc = programObject->getUniformLocation("draw_texture_parameters");
 
     ANGLE_TRY(glState->setProgram(context, programObject));
 
@@ -964,10 +1136,57 @@ angle::Result GLES1Renderer::initializeRendererProgram(Context *context, State *
     // We just created a new program, we need to sync everything
     glState->gles1().setAllDirty();
 
-    mRendererProgramInitialized = true;
     return angle::Result::Continue;
 }
 
+void GLES1Renderer::setGenericProgramShaderState(Context *context, Program *programObject)
+{
+    if (!mGenericProgramShaderStateDirty && mShaderState == mGenericProgramShaderState)
+    {
+        return;
+    }
+    mGenericProgramShaderState      = mShaderState;
+    mGenericProgramShaderStateDirty = false;
+
+    const GLES1StateUniformLocations &locations = mGenericStateUniformLocs;
+
+    for (GLES1StateEnables state : angle::AllEnums<GLES1StateEnables>())
+    {
+        setUniform1i(context, programObject, locations.enableLocs[state],
+                     mShaderState.mGLES1StateEnabled.test(state));
+    }
+
+    for (size_t index = 0; index < kTexEnableUniformCount; ++index)
+    {
+        const GLES1ShaderState::BoolTexArray &texEnables =
+            mShaderState.*kFragmentShaderStateTexEnables[index].value;
+        GLint values[kTexUnitCount];
+        std::copy(std::begin(texEnables), std::end(texEnables), values);
+        setUniform4iv(programObject, locations.texEnableLocs[index], 1, values);
+    }
+
+    for (size_t index = 0; index < kTexParameterUniformCount; ++index)
+    {
+        setUniform4iv(programObject, locations.texParameterLocs[index], 1,
+                      mShaderState.*kFragmentShaderStateTexParameters[index].value);
+    }
+
+    GLint lightEnables[kLightCount];
+    std::copy(std::begin(mShaderState.lightEnables), std::end(mShaderState.lightEnables),
+              lightEnables);
+    setUniform1iv(context, programObject, locations.lightEnablesLoc, kLightCount, lightEnables);
+
+    GLint clipPlaneEnables[kClipPlaneCount];
+    std::copy(std::begin(mShaderState.clipPlaneEnables), std::end(mShaderState.clipPlaneEnables),
+              clipPlaneEnables);
+    setUniform1iv(context, programObject, locations.clipPlaneEnablesLoc, kClipPlaneCount,
+                  clipPlaneEnables);
+
+    setUniform1i(context, programObject, locations.alphaFuncLoc,
+                 ToGLenum(mShaderState.alphaTestFunc));
+    setUniform1i(context, programObject, locations.fogModeLoc, ToGLenum(mShaderState.fogMode));
+}
+
 void GLES1Renderer::setUniform1i(Context *context,
                                  Program *programObject,
                                  UniformLocation location,
@@ -1000,34 +1219,24 @@ void GLES1Renderer::setUniformMatrix4fv(Program *programObject,
     programObject->setUniformMatrix4fv(location, count, transpose, value);
 }
 
-void GLES1Renderer::setUniform4fv(Program *programObject,
+void GLES1Renderer::setUniform4iv(Program *programObject,
                                   UniformLocation location,
                                   GLint count,
-                                  const GLfloat *value)
-{
-    if (location.value == -1)
-        return;
-    programObject->setUniform4fv(location, count, value);
-}
-
-void GLES1Renderer::setUniform3fv(Program *programObject,
-                                  UniformLocation location,
-                                  GLint count,
-                                  const GLfloat *value)
+                                  const GLint *value)
 {
     if (location.value == -1)
         return;
-    programObject->setUniform3fv(location, count, value);
+    programObject->setUniform4iv(location, count, value);
 }
 
-void GLES1Renderer::setUniform2fv(Program *programObject,
+void GLES1Renderer::setUniform4fv(Program *programObject,
                                   UniformLocation location,
                                   GLint count,
                                   const GLfloat *value)
 {
     if (location.value == -1)
         return;
-    programObject->setUniform2fv(location, count, value);
+    programObject->setUniform4fv(location, count, value);
 }
 
 void GLES1Renderer::setUniform1f(Program *programObject, UniformLocation location, GLfloat value)
@@ -1037,16 +1246,6 @@ void GLES1Renderer::setUniform1f(Program *programObject, UniformLocation locatio
     programObject->setUniform1fv(location, 1, &value);
 }
 
-void GLES1Renderer::setUniform1fv(Program *programObject,
-                                  UniformLocation location,
-                                  GLint count,
-                                  const GLfloat *value)
-{
-    if (location.value == -1)
-        return;
-    programObject->setUniform1fv(location, count, value);
-}
-
 void GLES1Renderer::setAttributesEnabled(Context *context, State *glState, AttributesMask mask)
 {
     GLES1State &gles1 = glState->gles1();
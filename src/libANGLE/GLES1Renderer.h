@@ -58,6 +58,7 @@ struct GLES1ShaderState
     GLES1ShaderState();
     ~GLES1ShaderState();
     GLES1ShaderState(const GLES1ShaderState &other);
+    GLES1ShaderState &operator=(const GLES1ShaderState &other);
 
     size_t hash() const;
 
@@ -144,6 +145,16 @@ class GLES1Renderer final : angle::NonCopyable
     using Vec4Uniform = float[4];
     using Vec3Uniform = float[3];
 
+    // Sizes of the uniform arrays that hold each group of state, see GLES1Shaders.inc.
+    static constexpr int kMatrixUniformCount         = kTexUnitCount + 3;
+    static constexpr int kTextureEnvUniformCount     = kTexUnitCount * 2;
+    static constexpr int kMaterialUniformCount       = 5;
+    static constexpr int kUniformsPerLight           = 6;
+    static constexpr int kLightUniformCount          = kLightCount * kUniformsPerLight + 1;
+    static constexpr int kFogUniformCount            = 2;
+    static constexpr int kPointParameterUniformCount = 2;
+    static constexpr int kDrawTextureUniformCount    = kTexUnitCount + 2;
+
     Shader *getShader(ShaderProgramID handle) const;
     Program *getProgram(ShaderProgramID handle) const;
 
@@ -157,7 +168,14 @@ class GLES1Renderer final : angle::NonCopyable
                               ShaderProgramID fshader,
                               const angle::HashMap<GLint, std::string> &attribLocs,
                               ShaderProgramID *programOut);
+    angle::Result startShaderCompile(Context *context,
+                                     ShaderType shaderType,
+                                     const char *src,
+                                     ShaderProgramID *shaderOut);
+    angle::Result checkShaderCompiled(Context *context, ShaderProgramID shader);
     angle::Result initializeRendererProgram(Context *context, State *glState);
+    angle::Result initializeGenericProgram(Context *context, State *glState);
+    void setGenericProgramShaderState(Context *context, Program *programObject);
 
     void setUniform1i(Context *context,
                       Program *programObject,
@@ -173,23 +191,15 @@ class GLES1Renderer final : angle::NonCopyable
                              GLint count,
                              GLboolean transpose,
                              const GLfloat *value);
-    void setUniform4fv(Program *programObject,
-                       UniformLocation location,
-                       GLint count,
-                       const GLfloat *value);
-    void setUniform3fv(Program *programObject,
+    void setUniform4iv(Program *programObject,
                        UniformLocation location,
                        GLint count,
-                       const GLfloat *value);
-    void setUniform2fv(Program *programObject,
+                       const GLint *value);
+    void setUniform4fv(Program *programObject,
                        UniformLocation location,
                        GLint count,
                        const GLfloat *value);
     void setUniform1f(Program *programObject, UniformLocation location, GLfloat value);
-    void setUniform1fv(Program *programObject,
-                       UniformLocation location,
-                       GLint count,
-                       const GLfloat *value);
 
     void setAttributesEnabled(Context *context, State *glState, AttributesMask mask);
 
@@ -223,108 +233,124 @@ class GLES1Renderer final : angle::NonCopyable
                                      GLES1ShaderState::BoolClipPlaneArray &value);
     void addVertexShaderDefs(std::stringstream &outStream);
     void addFragmentShaderDefs(std::stringstream &outStream);
+    void addGenericVertexShaderDefs(std::stringstream &outStream);
+    void addGenericFragmentShaderDefs(std::stringstream &outStream);
+    void generateShaderSources(bool generic, std::string *vertexOut, std::string *fragmentOut);
 
     struct GLES1ProgramState
     {
         ShaderProgramID program;
 
-        UniformLocation projMatrixLoc;
-        UniformLocation modelviewMatrixLoc;
-        UniformLocation textureMatrixLoc;
-        UniformLocation modelviewInvTrLoc;
+        UniformLocation matricesLoc;
 
         // Texturing
         std::array<UniformLocation, kTexUnitCount> tex2DSamplerLocs;
         std::array<UniformLocation, kTexUnitCount> texCubeSamplerLocs;
 
-        UniformLocation textureEnvColorLoc;
-        UniformLocation rgbScaleLoc;
-        UniformLocation alphaScaleLoc;
+        UniformLocation textureEnvLoc;
 
         // Alpha test
         UniformLocation alphaTestRefLoc;
 
         // Shading, materials, and lighting
-        UniformLocation materialAmbientLoc;
-        UniformLocation materialDiffuseLoc;
-        UniformLocation materialSpecularLoc;
-        UniformLocation materialEmissiveLoc;
-        UniformLocation materialSpecularExponentLoc;
-
-        UniformLocation lightModelSceneAmbientLoc;
-
-        UniformLocation lightAmbientsLoc;
-        UniformLocation lightDiffusesLoc;
-        UniformLocation lightSpecularsLoc;
-        UniformLocation lightPositionsLoc;
-        UniformLocation lightDirectionsLoc;
-        UniformLocation lightSpotlightExponentsLoc;
-        UniformLocation lightSpotlightCutoffAnglesLoc;
-        UniformLocation lightAttenuationConstsLoc;
-        UniformLocation lightAttenuationLinearsLoc;
-        UniformLocation lightAttenuationQuadraticsLoc;
+        UniformLocation materialLoc;
+        UniformLocation lightsLoc;
 
         // Fog
-        UniformLocation fogDensityLoc;
-        UniformLocation fogStartLoc;
-        UniformLocation fogEndLoc;
-        UniformLocation fogColorLoc;
+        UniformLocation fogLoc;
 
         // Clip planes
         UniformLocation clipPlanesLoc;
 
         // Point rasterization
-        UniformLocation pointSizeMinLoc;
-        UniformLocation pointSizeMaxLoc;
-        UniformLocation pointDistanceAttenuationLoc;
+        UniformLocation pointParametersLoc;
 
         // Draw texture
-        UniformLocation drawTextureCoordsLoc;
-        UniformLocation drawTextureDimsLoc;
-        UniformLocation drawTextureNormalizedCropRectLoc;
+        UniformLocation drawTextureLoc;
     };
 
+    // The values of the uniform arrays, laid out as in GLES1Shaders.inc.  Each array is updated
+    // and uploaded only when its group of state is dirty.
     struct GLES1UniformBuffers
     {
-        std::array<Mat4Uniform, kTexUnitCount> textureMatrices;
+        std::array<Mat4Uniform, kMatrixUniformCount> matrices;
 
-        std::array<Vec4Uniform, kTexUnitCount> texEnvColors;
-        std::array<GLfloat, kTexUnitCount> texEnvRgbScales;
-        std::array<GLfloat, kTexUnitCount> texEnvAlphaScales;
+        std::array<Vec4Uniform, kTextureEnvUniformCount> textureEnv;
 
         // Lighting
-        std::array<Vec4Uniform, kLightCount> lightAmbients;
-        std::array<Vec4Uniform, kLightCount> lightDiffuses;
-        std::array<Vec4Uniform, kLightCount> lightSpeculars;
-        std::array<Vec4Uniform, kLightCount> lightPositions;
-        std::array<Vec3Uniform, kLightCount> lightDirections;
-        std::array<GLfloat, kLightCount> spotlightExponents;
-        std::array<GLfloat, kLightCount> spotlightCutoffAngles;
-        std::array<GLfloat, kLightCount> attenuationConsts;
-        std::array<GLfloat, kLightCount> attenuationLinears;
-        std::array<GLfloat, kLightCount> attenuationQuadratics;
+        std::array<Vec4Uniform, kMaterialUniformCount> material;
+        std::array<Vec4Uniform, kLightUniformCount> lights;
+
+        std::array<Vec4Uniform, kFogUniformCount> fog;
 
         // Clip planes
         std::array<Vec4Uniform, kClipPlaneCount> clipPlanes;
 
-        // Texture crop rectangles
-        std::array<Vec4Uniform, kTexUnitCount> texCropRects;
+        std::array<Vec4Uniform, kPointParameterUniformCount> pointParameters;
+
+        // Draw texture coordinates, dimensions and texture crop rectangles
+        std::array<Vec4Uniform, kDrawTextureUniformCount> drawTexture;
     };
 
     struct GLES1UberShaderState
     {
-        GLES1UniformBuffers uniformBuffers;
         GLES1ProgramState programState;
+
+        // The shaders of a program that is still compiling in the background.  The generic
+        // program is used until they are compiled.
+        ShaderProgramID pendingVertexShader   = {};
+        ShaderProgramID pendingFragmentShader = {};
+    };
+
+    // Locations of the uniforms that replace the shader state in the generic program.
+    static constexpr size_t kTexEnableUniformCount    = 3;
+    static constexpr size_t kTexParameterUniformCount = 16;
+    struct GLES1StateUniformLocations
+    {
+        angle::PackedEnumMap<GLES1StateEnables, UniformLocation> enableLocs;
+        std::array<UniformLocation, kTexEnableUniformCount> texEnableLocs;
+        std::array<UniformLocation, kTexParameterUniformCount> texParameterLocs;
+        UniformLocation lightEnablesLoc;
+        UniformLocation clipPlaneEnablesLoc;
+        UniformLocation alphaFuncLoc;
+        UniformLocation fogModeLoc;
     };
 
+    angle::Result linkRendererProgram(Context *context,
+                                      State *glState,
+                                      ShaderProgramID vertexShader,
+                                      ShaderProgramID fragmentShader,
+                                      GLES1ProgramState *programStateOut);
+
+    // The program of the current state, or the generic program while that one is compiling.
     GLES1UberShaderState &getUberShaderState()
     {
-        ASSERT(mUberShaderState.find(mShaderState) != mUberShaderState.end());
-        return mUberShaderState[mShaderState];
+        ASSERT(mCurrentUberShaderState != nullptr);
+        if (mCurrentUberShaderState->programState.program.value == 0)
+        {
+            ASSERT(mGenericProgramInitialized);
+            return mGenericUberShaderState;
+        }
+        return *mCurrentUberShaderState;
     }
 
     angle::HashMap<GLES1ShaderState, GLES1UberShaderState> mUberShaderState;
 
+    GLES1UniformBuffers mUniformBuffers = {};
+
+    // The state of the last draw and its program, so that draws that don't change the shader
+    // state skip the hash lookup.
+    GLES1ShaderState mCurrentShaderState          = {};
+    GLES1UberShaderState *mCurrentUberShaderState = nullptr;
+
+    // A program that takes the shader state through uniforms.  It is used for the states whose
+    // programs are compiling in the background, so that new states don't stall the draw.
+    bool mGenericProgramInitialized = false;
+    GLES1UberShaderState mGenericUberShaderState;
+    GLES1StateUniformLocations mGenericStateUniformLocs;
+    GLES1ShaderState mGenericProgramShaderState = {};
+    bool mGenericProgramShaderStateDirty        = true;
+
     bool mDrawTextureEnabled      = false;
     GLfloat mDrawTextureCoords[4] = {0.0f, 0.0f, 0.0f, 0.0f};
     GLfloat mDrawTextureDims[2]   = {0.0f, 0.0f};
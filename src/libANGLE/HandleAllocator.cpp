@@ -84,6 +84,47 @@ GLuint HandleAllocator::allocate()
     return freeListHandle;
 }
 
+GLuint HandleAllocator::allocateRange(GLuint count, GLuint *allocatedCountOut)
+{
+    ASSERT(count > 0);
+
+    // Released handles are not kept in ranges, so reuse them one at a time.
+    if (!mReleasedList.empty() || count == 1)
+    {
+        *allocatedCountOut = 1;
+        return allocate();
+    }
+
+    ASSERT(!mUnallocatedList.empty());
+
+    // Allocate from the beginning of the first unallocated range, constant time.
+    auto listIt = mUnallocatedList.begin();
+
+    GLuint freeListHandle = listIt->begin;
+    ASSERT(freeListHandle > 0);
+
+    const GLuint rangeSize = listIt->end - listIt->begin;
+    if (rangeSize < count)
+    {
+        // Note that rangeSize is one less than the number of handles in the range.
+        *allocatedCountOut = rangeSize + 1;
+        mUnallocatedList.erase(listIt);
+    }
+    else
+    {
+        *allocatedCountOut = count;
+        listIt->begin += count;
+    }
+
+    if (mLoggingEnabled)
+    {
+        WARN() << "HandleAllocator::allocateRange allocating " << *allocatedCountOut
+               << " handles from " << freeListHandle << std::endl;
+    }
+
+    return freeListHandle;
+}
+
 void HandleAllocator::release(GLuint handle)
 {
     if (mLoggingEnabled)
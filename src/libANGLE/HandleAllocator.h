@@ -30,6 +30,10 @@ class HandleAllocator final : angle::NonCopyable
     void setBaseHandle(GLuint value);
 
     GLuint allocate();
+    // Allocates up to |count| handles with consecutive values and returns the first one.  Fewer
+    // handles are allocated if the handle that allocate() would return is not followed by enough
+    // free handles.  The number of allocated handles is returned in |allocatedCountOut|.
+    GLuint allocateRange(GLuint count, GLuint *allocatedCountOut);
     void release(GLuint handle);
     void reserve(GLuint handle);
     void reset();
@@ -214,4 +214,47 @@ TEST(HandleAllocatorTest, ConsolidateRangeDuringRelease)
     EXPECT_NE(handle, static_cast<GLuint>(-1));
 }
 
+// Tests allocating ranges of handles, interleaved with released and reserved handles.
+TEST(HandleAllocatorTest, AllocateRange)
+{
+    gl::HandleAllocator allocator;
+
+    GLuint count = 0;
+    EXPECT_EQ(1u, allocator.allocateRange(10, &count));
+    EXPECT_EQ(10u, count);
+
+    // Released handles are reused one at a time.
+    allocator.release(5);
+    allocator.release(3);
+    EXPECT_EQ(3u, allocator.allocateRange(10, &count));
+    EXPECT_EQ(1u, count);
+    EXPECT_EQ(5u, allocator.allocateRange(10, &count));
+    EXPECT_EQ(1u, count);
+
+    // A range stops at a reserved handle.
+    allocator.reserve(15);
+    EXPECT_EQ(11u, allocator.allocateRange(10, &count));
+    EXPECT_EQ(4u, count);
+    EXPECT_EQ(16u, allocator.allocateRange(10, &count));
+    EXPECT_EQ(10u, count);
+    EXPECT_EQ(26u, allocator.allocate());
+}
+
+// Tests that allocating a range doesn't go beyond the maximum handle.
+TEST(HandleAllocatorTest, AllocateRangeUntilMaximum)
+{
+    constexpr GLuint kMaxHandle = 20;
+    gl::HandleAllocator allocator(kMaxHandle);
+
+    GLuint count = 0;
+    EXPECT_EQ(1u, allocator.allocateRange(15, &count));
+    EXPECT_EQ(15u, count);
+    EXPECT_EQ(16u, allocator.allocateRange(15, &count));
+    EXPECT_EQ(5u, count);
+
+    allocator.release(7);
+    EXPECT_EQ(7u, allocator.allocateRange(15, &count));
+    EXPECT_EQ(1u, count);
+}
+
 }  // anonymous namespace
@@ -53,6 +53,29 @@ bool IndexRangeCache::findRange(DrawElementsType type,
     }
 }
 
+void IndexRangeCache::addChunkRange(DrawElementsType type,
+                                    size_t chunkIndex,
+                                    bool primitiveRestartEnabled,
+                                    const IndexRange &range)
+{
+    mChunkRangeCache[ChunkKey(chunkIndex, type, primitiveRestartEnabled)] = range;
+}
+
+bool IndexRangeCache::findChunkRange(DrawElementsType type,
+                                     size_t chunkIndex,
+                                     bool primitiveRestartEnabled,
+                                     IndexRange *outRange) const
+{
+    auto i = mChunkRangeCache.find(ChunkKey(chunkIndex, type, primitiveRestartEnabled));
+    if (i == mChunkRangeCache.end())
+    {
+        return false;
+    }
+
+    *outRange = i->second;
+    return true;
+}
+
 void IndexRangeCache::invalidateRange(size_t offset, size_t size)
 {
     size_t invalidateStart = offset;
@@ -74,11 +97,26 @@ void IndexRangeCache::invalidateRange(size_t offset, size_t size)
             mIndexRangeCache.erase(i++);
         }
     }
+
+    if (mChunkRangeCache.empty())
+    {
+        return;
+    }
+
+    size_t firstChunk = invalidateStart / kChunkSize;
+    size_t lastChunk  = (invalidateEnd + kChunkSize - 1) / kChunkSize;
+    auto chunk =
+        mChunkRangeCache.lower_bound(ChunkKey(firstChunk, DrawElementsType::UnsignedByte, false));
+    while (chunk != mChunkRangeCache.end() && chunk->first.chunkIndex < lastChunk)
+    {
+        chunk = mChunkRangeCache.erase(chunk);
+    }
 }
 
 void IndexRangeCache::clear()
 {
     mIndexRangeCache.clear();
+    mChunkRangeCache.clear();
 }
 
 IndexRangeCache::IndexRangeKey::IndexRangeKey()
@@ -113,4 +151,23 @@ bool IndexRangeCache::IndexRangeKey::operator<(const IndexRangeKey &rhs) const
     return false;
 }
 
+IndexRangeCache::ChunkKey::ChunkKey(size_t chunkIndex_,
+                                    DrawElementsType type_,
+                                    bool primitiveRestartEnabled_)
+    : chunkIndex(chunkIndex_), type(type_), primitiveRestartEnabled(primitiveRestartEnabled_)
+{}
+
+bool IndexRangeCache::ChunkKey::operator<(const ChunkKey &rhs) const
+{
+    if (chunkIndex != rhs.chunkIndex)
+    {
+        return chunkIndex < rhs.chunkIndex;
+    }
+    if (type != rhs.type)
+    {
+        return type < rhs.type;
+    }
+    return !primitiveRestartEnabled && rhs.primitiveRestartEnabled;
+}
+
 }  // namespace gl
@@ -37,6 +37,20 @@ class IndexRangeCache
                    bool primitiveRestartEnabled,
                    IndexRange *outRange) const;
 
+    // The ranges of large draws are put together from the ranges of the fixed-size chunks of the
+    // buffer they cover, which are cached separately.  A buffer update then only invalidates the
+    // chunks it touches, and the next large draw only scans those again.
+    static constexpr size_t kChunkSize = 64 * 1024;
+
+    void addChunkRange(DrawElementsType type,
+                       size_t chunkIndex,
+                       bool primitiveRestartEnabled,
+                       const IndexRange &range);
+    bool findChunkRange(DrawElementsType type,
+                        size_t chunkIndex,
+                        bool primitiveRestartEnabled,
+                        IndexRange *outRange) const;
+
     void invalidateRange(size_t offset, size_t size);
     void clear();
 
@@ -56,6 +70,21 @@ class IndexRangeCache
 
     typedef std::map<IndexRangeKey, IndexRange> IndexRangeMap;
     IndexRangeMap mIndexRangeCache;
+
+    // Ordered by chunk first, so the chunks touched by an update are next to each other.
+    struct ChunkKey
+    {
+        ChunkKey(size_t chunkIndex, DrawElementsType type, bool primitiveRestart);
+
+        bool operator<(const ChunkKey &rhs) const;
+
+        size_t chunkIndex;
+        DrawElementsType type;
+        bool primitiveRestartEnabled;
+    };
+
+    typedef std::map<ChunkKey, IndexRange> ChunkRangeMap;
+    ChunkRangeMap mChunkRangeCache;
 };
 
 }  // namespace gl
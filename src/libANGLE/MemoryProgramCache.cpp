@@ -21,6 +21,7 @@
 #include "libANGLE/BinaryStream.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Uniform.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/capture/FrameCapture.h"
 #include "libANGLE/histogram_macros.h"
 #include "libANGLE/renderer/ProgramImpl.h"
@@ -217,6 +218,19 @@ angle::Result MemoryProgramCache::putProgram(const egl::BlobCache::Key &programH
     angle::MemoryBuffer serializedProgram;
     ANGLE_TRY(program->serialize(context, &serializedProgram));
 
+    // Compressing the binary is a large part of the cost of caching it, so it's optionally done in
+    // a worker thread to take it off the thread that linked the program.  The platform's
+    // cacheProgram callback is not called in that case, as it's not expected to be thread-safe
+    // and is superseded by EGL_ANDROID_blob_cache.
+    std::shared_ptr<angle::WorkerThreadPool> workerThreadPool = context->getWorkerThreadPool();
+    if (context->getFrontendFeatures().enableCompressingProgramCacheInThreadPool.enabled &&
+        workerThreadPool && workerThreadPool->isAsync())
+    {
+        mBlobCache.putCompressedAsync(workerThreadPool, &context->getProgramCacheMutex(),
+                                      programHash, std::move(serializedProgram));
+        return angle::Result::Continue;
+    }
+
     angle::MemoryBuffer compressedData;
     if (!egl::CompressBlobCacheData(serializedProgram.size(), serializedProgram.data(),
                                     &compressedData))
@@ -0,0 +1,151 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryShaderCache: Stores translated shaders in memory so they don't always have to be
+//   re-translated. Shares the blob cache with MemoryProgramCache, so it can be used in
+//   conjunction with the platform layer to warm up the cache from disk.
+
+#include "libANGLE/MemoryShaderCache.h"
+
+#include <anglebase/sha1.h>
+
+#include <sstream>
+
+#include "common/angle_version_info.h"
+#include "libANGLE/BinaryStream.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/Shader.h"
+#include "libANGLE/histogram_macros.h"
+
+namespace gl
+{
+
+namespace
+{
+constexpr unsigned int kWarningLimit = 3;
+constexpr char kSeparator            = ':';
+}  // anonymous namespace
+
+MemoryShaderCache::MemoryShaderCache(egl::BlobCache &blobCache)
+    : mBlobCache(blobCache), mIssuedWarnings(0)
+{}
+
+MemoryShaderCache::~MemoryShaderCache() {}
+
+void MemoryShaderCache::ComputeHash(const Context *context,
+                                    const Shader *shader,
+                                    ShCompileOptions compileOptions,
+                                    const std::string &builtinResourcesString,
+                                    egl::BlobCache::Key *hashOut)
+{
+    std::ostringstream hashStream;
+
+    // A tag so that shader and program entries in the shared blob cache can never collide.
+    hashStream << "shader" << kSeparator << GetShaderTypeString(shader->getType()) << kSeparator;
+
+    hashStream << shader->getSourceString() << kSeparator << shader->getSourceString().length()
+               << kSeparator << compileOptions << kSeparator << builtinResourcesString
+               << kSeparator;
+
+    // Add some ANGLE metadata and Context properties, such as version and back-end.  The compute
+    // limits are checked after translation, so they affect the outcome of the compilation too.
+    hashStream << angle::GetANGLECommitHash() << kSeparator << context->getClientMajorVersion()
+               << kSeparator << context->getClientMinorVersion() << kSeparator
+               << context->isWebGL() << kSeparator << context->getString(GL_RENDERER)
+               << kSeparator << context->getCaps().maxComputeWorkGroupInvocations << kSeparator
+               << context->getCaps().maxComputeSharedMemorySize;
+
+    // Call the secure SHA hashing function.
+    const std::string &shaderKey = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(shaderKey.c_str()),
+                               shaderKey.length(), hashOut->data());
+}
+
+bool MemoryShaderCache::getShader(const Context *context,
+                                  Shader *shader,
+                                  ShCompileOptions compileOptions,
+                                  const std::string &builtinResourcesString,
+                                  egl::BlobCache::Key *hashOut)
+{
+    // If caching is effectively disabled, don't bother calculating the hash.
+    if (!mBlobCache.isCachingEnabled())
+    {
+        return false;
+    }
+
+    ComputeHash(context, shader, compileOptions, builtinResourcesString, hashOut);
+
+    egl::BlobCache::Value cachedShader;
+    size_t shaderSize = 0;
+    if (!mBlobCache.get(context->getScratchBuffer(), *hashOut, &cachedShader, &shaderSize))
+    {
+        return false;
+    }
+
+    angle::MemoryBuffer uncompressedData;
+    if (!egl::DecompressBlobCacheData(cachedShader.data(), shaderSize, &uncompressedData))
+    {
+        ERR() << "Error decompressing shader cache data.";
+        return false;
+    }
+
+    BinaryInputStream stream(uncompressedData.data(), uncompressedData.size());
+    const bool loaded = shader->deserialize(&stream);
+    ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.ShaderCache.LoadShaderSuccess", loaded);
+
+    if (loaded)
+    {
+        return true;
+    }
+
+    // Cache load failed, evict.
+    if (mIssuedWarnings++ < kWarningLimit)
+    {
+        WARN() << "Failed to load shader from cache.";
+
+        if (mIssuedWarnings == kWarningLimit)
+        {
+            WARN() << "Reaching warning limit for cache load failures, silencing "
+                      "subsequent warnings.";
+        }
+    }
+    remove(*hashOut);
+    return false;
+}
+
+angle::Result MemoryShaderCache::putShader(const egl::BlobCache::Key &shaderHash,
+                                           const Shader *shader)
+{
+    // If caching is effectively disabled, don't bother serializing the shader.
+    if (!mBlobCache.isCachingEnabled())
+    {
+        return angle::Result::Incomplete;
+    }
+
+    BinaryOutputStream stream;
+    shader->serialize(&stream);
+
+    angle::MemoryBuffer compressedData;
+    if (!egl::CompressBlobCacheData(stream.length(),
+                                    reinterpret_cast<const uint8_t *>(stream.data()),
+                                    &compressedData))
+    {
+        ERR() << "Error compressing shader cache data.";
+        return angle::Result::Incomplete;
+    }
+
+    ANGLE_HISTOGRAM_COUNTS("GPU.ANGLE.ShaderCache.ShaderBinarySizeBytes",
+                           static_cast<int>(compressedData.size()));
+
+    mBlobCache.put(shaderHash, std::move(compressedData));
+    return angle::Result::Continue;
+}
+
+void MemoryShaderCache::remove(const egl::BlobCache::Key &shaderHash)
+{
+    mBlobCache.remove(shaderHash);
+}
+
+}  // namespace gl
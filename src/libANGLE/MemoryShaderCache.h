@@ -0,0 +1,58 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MemoryShaderCache: Stores translated shaders in memory so they don't always have to be
+//   re-translated. Shares the blob cache with MemoryProgramCache, so it can be used in
+//   conjunction with the platform layer to warm up the cache from disk.
+
+#ifndef LIBANGLE_MEMORY_SHADER_CACHE_H_
+#define LIBANGLE_MEMORY_SHADER_CACHE_H_
+
+#include <GLSLANG/ShaderLang.h>
+
+#include "libANGLE/BlobCache.h"
+#include "libANGLE/Error.h"
+
+namespace gl
+{
+class Context;
+class Shader;
+
+class MemoryShaderCache final : angle::NonCopyable
+{
+  public:
+    explicit MemoryShaderCache(egl::BlobCache &blobCache);
+    ~MemoryShaderCache();
+
+    // The hash includes the shader source, the complete set of options passed to the translator
+    // and the translator's built-in resources.
+    static void ComputeHash(const Context *context,
+                            const Shader *shader,
+                            ShCompileOptions compileOptions,
+                            const std::string &builtinResourcesString,
+                            egl::BlobCache::Key *hashOut);
+
+    // Check the cache, and deserialize the translated shader into |shader| if found. Evict existing
+    // hash if load fails.  Returns true if the shader was loaded from the cache.
+    bool getShader(const Context *context,
+                   Shader *shader,
+                   ShCompileOptions compileOptions,
+                   const std::string &builtinResourcesString,
+                   egl::BlobCache::Key *hashOut);
+
+    // Helper method that serializes a successfully compiled shader.
+    angle::Result putShader(const egl::BlobCache::Key &shaderHash, const Shader *shader);
+
+    // Evict a shader from the cache.
+    void remove(const egl::BlobCache::Key &shaderHash);
+
+  private:
+    egl::BlobCache &mBlobCache;
+    unsigned int mIssuedWarnings;
+};
+
+}  // namespace gl
+
+#endif  // LIBANGLE_MEMORY_SHADER_CACHE_H_
@@ -32,7 +32,11 @@ OverlayState::OverlayState() : mEnabledWidgetCount(0), mOverlayWidgets{} {}
 OverlayState::~OverlayState() = default;
 
 Overlay::Overlay(rx::GLImplFactory *factory)
-    : mLastPerSecondUpdate(0), mImplementation(factory->createOverlay(mState))
+    : mLastPerSecondUpdate(0),
+      mTracksCpuTimePhases(false),
+      mCpuTimePhase(CpuTimePhase::InvalidEnum),
+      mCpuTimePhaseStartTime(0),
+      mImplementation(factory->createOverlay(mState))
 {}
 Overlay::~Overlay() = default;
 
@@ -68,6 +72,27 @@ void Overlay::enableOverlayWidgetsFromEnvironment()
             ++mState.mEnabledWidgetCount;
         }
     }
+
+    mTracksCpuTimePhases =
+        isEnabled() && mState.mOverlayWidgets[WidgetId::VulkanFrameCPUTime]->enabled;
+}
+
+CpuTimePhase Overlay::switchCpuTimePhase(CpuTimePhase phase) const
+{
+    const double currentTime = angle::GetCurrentSystemTime();
+    if (mCpuTimePhase != CpuTimePhase::InvalidEnum)
+    {
+        const uint64_t elapsedNs =
+            static_cast<uint64_t>((currentTime - mCpuTimePhaseStartTime) * 1'000'000'000.0);
+        getWidgetAs<overlay::RunningStackedGraph, WidgetType::RunningStackedGraph>(
+            WidgetId::VulkanFrameCPUTime)
+            ->add(static_cast<size_t>(mCpuTimePhase), elapsedNs);
+    }
+
+    const CpuTimePhase previousPhase = mCpuTimePhase;
+    mCpuTimePhase                    = phase;
+    mCpuTimePhaseStartTime           = currentTime;
+    return previousPhase;
 }
 
 void Overlay::onSwap() const
@@ -75,6 +100,13 @@ void Overlay::onSwap() const
     // Increment FPS counter.
     getPerSecondWidget(WidgetId::FPS)->add(1);
 
+    if (mTracksCpuTimePhases)
+    {
+        getWidgetAs<overlay::RunningStackedGraph, WidgetType::RunningStackedGraph>(
+            WidgetId::VulkanFrameCPUTime)
+            ->next();
+    }
+
     // Update per second values every second.
     double currentTime = angle::GetCurrentSystemTime();
     double timeDiff    = currentTime - mLastPerSecondUpdate;
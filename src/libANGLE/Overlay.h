@@ -26,6 +26,20 @@ namespace gl
 {
 class Context;
 
+// The phases the CPU time of a frame is broken down in by the VulkanFrameCPUTime widget, which are
+// its layers from the bottom.
+enum class CpuTimePhase : uint8_t
+{
+    Validation,
+    SyncState,
+    DescriptorUpdate,
+    CommandRecording,
+    Submission,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
 class OverlayState : angle::NonCopyable
 {
   public:
@@ -85,6 +99,17 @@ class Overlay : angle::NonCopyable
         return getWidgetAs<overlay::RunningHistogram, WidgetType::RunningHistogram>(id);
     }
 
+    // Attributes the CPU time from now on to the given phase, and returns the previous one.
+    // Use ScopedCpuTimePhase instead.
+    CpuTimePhase setCpuTimePhase(CpuTimePhase phase) const
+    {
+        if (ANGLE_LIKELY(!mTracksCpuTimePhases))
+        {
+            return CpuTimePhase::InvalidEnum;
+        }
+        return switchCpuTimePhase(phase);
+    }
+
     rx::OverlayImpl *getImplementation() const { return mImplementation.get(); }
 
     bool isEnabled() const
@@ -102,10 +127,16 @@ class Overlay : angle::NonCopyable
     }
     void initOverlayWidgets();
     void enableOverlayWidgetsFromEnvironment();
+    CpuTimePhase switchCpuTimePhase(CpuTimePhase phase) const;
 
     // Time tracking for PerSecond items.
     mutable double mLastPerSecondUpdate;
 
+    // Time tracking for the VulkanFrameCPUTime widget, only done while it's enabled.
+    bool mTracksCpuTimePhases;
+    mutable CpuTimePhase mCpuTimePhase;
+    mutable double mCpuTimePhaseStartTime;
+
     OverlayState mState;
     std::unique_ptr<rx::OverlayImpl> mImplementation;
 };
@@ -127,6 +158,8 @@ class MockOverlay
     const overlay::Mock *getRunningGraphWidget(WidgetId id) const { return &mMock; }
     const overlay::Mock *getRunningHistogramWidget(WidgetId id) const { return &mMock; }
 
+    CpuTimePhase setCpuTimePhase(CpuTimePhase phase) const { return CpuTimePhase::InvalidEnum; }
+
     bool isEnabled() const { return false; }
 
   private:
@@ -149,6 +182,21 @@ using RunningHistogramWidget = const overlay::Mock;
 using TextWidget             = const overlay::Mock;
 #endif  // ANGLE_ENABLE_OVERLAY
 
+// Attributes the CPU time of the scope to a phase.  The time of a nested scope is only attributed
+// to its own phase.
+class ScopedCpuTimePhase final : angle::NonCopyable
+{
+  public:
+    ScopedCpuTimePhase(const OverlayType *overlay, CpuTimePhase phase)
+        : mOverlay(overlay), mPreviousPhase(overlay->setCpuTimePhase(phase))
+    {}
+    ~ScopedCpuTimePhase() { mOverlay->setCpuTimePhase(mPreviousPhase); }
+
+  private:
+    const OverlayType *mOverlay;
+    CpuTimePhase mPreviousPhase;
+};
+
 }  // namespace gl
 
 #endif  // LIBANGLE_OVERLAY_H_
@@ -35,6 +35,7 @@ constexpr angle::PackedEnumMap<WidgetType, WidgetInternalType> kWidgetTypeToInte
     {WidgetType::PerSecond, WidgetInternalType::Text},
     {WidgetType::RunningGraph, WidgetInternalType::Graph},
     {WidgetType::RunningHistogram, WidgetInternalType::Graph},
+    {WidgetType::RunningStackedGraph, WidgetInternalType::Graph},
 };
 
 // Structures and limits matching uniform buffers in vulkan/shaders/src/OverlayDraw.comp.  The size
@@ -219,6 +220,15 @@ class AppendWidgetDataHelper
                                              OverlayWidgetCounts *widgetCounts,
                                              FormatHistogramTitleFunc formatFunc);
 
+    using FormatStackedGraphTitleFunc =
+        std::function<std::string(const std::vector<uint64_t> &curLayerValues)>;
+    static void AppendRunningStackedGraphCommon(const overlay::Widget *widget,
+                                                const gl::Extents &imageExtent,
+                                                TextWidgetData *textWidget,
+                                                GraphWidgetData *graphWidget,
+                                                OverlayWidgetCounts *widgetCounts,
+                                                FormatStackedGraphTitleFunc formatFunc);
+
     static void AppendGraphCommon(const overlay::Widget *widget,
                                   const gl::Extents &imageExtent,
                                   const std::vector<uint64_t> runningValues,
@@ -335,6 +345,66 @@ void AppendWidgetDataHelper::AppendRunningHistogramCommon(const overlay::Widget
     }
 }
 
+// static
+void AppendWidgetDataHelper::AppendRunningStackedGraphCommon(const overlay::Widget *widget,
+                                                             const gl::Extents &imageExtent,
+                                                             TextWidgetData *textWidget,
+                                                             GraphWidgetData *graphWidget,
+                                                             OverlayWidgetCounts *widgetCounts,
+                                                             FormatStackedGraphTitleFunc formatFunc)
+{
+    const overlay::RunningStackedGraph *graph =
+        static_cast<const overlay::RunningStackedGraph *>(widget);
+    ASSERT(graph->layerColors.size() == graph->layerValues.size());
+
+    const uint64_t maxValue = std::max<uint64_t>(
+        *std::max_element(graph->runningValues.begin(), graph->runningValues.end()), 1);
+    const int32_t graphHeight = std::abs(widget->coords[3] - widget->coords[1]);
+    const float graphScale    = static_cast<float>(graphHeight) / maxValue;
+
+    const size_t graphSize  = graph->runningValues.size();
+    const size_t currentIdx = (graphSize + graph->lastValueIndex - 1) % graphSize;
+
+    // The shader draws every graph widget as bars of a single color, so every layer is drawn as
+    // the sum of the layers up to it, from the top layer down.  Each graph is drawn over the
+    // previous ones, leaving the top of the previous bars visible.
+    std::vector<std::vector<uint64_t>> stackedValues(graph->layerValues.size());
+    std::vector<uint64_t> curLayerValues(graph->layerValues.size());
+    for (size_t layer = 0; layer < graph->layerValues.size(); ++layer)
+    {
+        stackedValues[layer] = graph->layerValues[layer];
+        if (layer > 0)
+        {
+            for (size_t index = 0; index < graphSize; ++index)
+            {
+                stackedValues[layer][index] += stackedValues[layer - 1][index];
+            }
+        }
+        curLayerValues[layer] = graph->layerValues[layer][currentIdx];
+    }
+
+    for (size_t layer = stackedValues.size(); layer > 0; --layer)
+    {
+        if ((*widgetCounts)[WidgetInternalType::Graph] >=
+            kWidgetInternalTypeMaxWidgets[WidgetInternalType::Graph])
+        {
+            break;
+        }
+
+        AppendGraphCommon(widget, imageExtent, stackedValues[layer - 1], graph->lastValueIndex + 1,
+                          graphScale, graphWidget, widgetCounts);
+        GetWidgetColor(graph->layerColors[layer - 1].data(), graphWidget->color);
+        ++graphWidget;
+    }
+
+    if ((*widgetCounts)[WidgetInternalType::Text] <
+        kWidgetInternalTypeMaxWidgets[WidgetInternalType::Text])
+    {
+        std::string text = formatFunc(curLayerValues);
+        AppendTextCommon(&graph->description, imageExtent, text, textWidget, widgetCounts);
+    }
+}
+
 void AppendWidgetDataHelper::AppendFPS(const overlay::Widget *widget,
                                        const gl::Extents &imageExtent,
                                        TextWidgetData *textWidget,
@@ -577,6 +647,27 @@ void AppendWidgetDataHelper::AppendVulkanActualSubmissions(const overlay::Widget
     AppendRunningGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts, format);
 }
 
+void AppendWidgetDataHelper::AppendVulkanFrameCPUTime(const overlay::Widget *widget,
+                                                      const gl::Extents &imageExtent,
+                                                      TextWidgetData *textWidget,
+                                                      GraphWidgetData *graphWidget,
+                                                      OverlayWidgetCounts *widgetCounts)
+{
+    auto format = [](const std::vector<uint64_t> &curLayerValues) {
+        std::ostringstream text;
+        text << "CPU ms (validate/sync/descriptors/record/submit):";
+        for (size_t layer = 0; layer < curLayerValues.size(); ++layer)
+        {
+            text << (layer == 0 ? " " : "/") << std::fixed << std::setprecision(2)
+                 << static_cast<double>(curLayerValues[layer]) / 1'000'000.0;
+        }
+        return text.str();
+    };
+
+    AppendRunningStackedGraphCommon(widget, imageExtent, textWidget, graphWidget, widgetCounts,
+                                    format);
+}
+
 std::ostream &AppendWidgetDataHelper::OutputPerSecond(std::ostream &out,
                                                       const overlay::PerSecond *perSecond)
 {
@@ -607,6 +698,11 @@ namespace overlay
 {
 RunningGraph::RunningGraph(size_t n) : runningValues(n, 0) {}
 RunningGraph::~RunningGraph() = default;
+
+RunningStackedGraph::RunningStackedGraph(size_t n, size_t layerCount)
+    : RunningGraph(n), layerValues(layerCount, std::vector<uint64_t>(n, 0))
+{}
+RunningStackedGraph::~RunningStackedGraph() = default;
 }  // namespace overlay
 
 size_t OverlayState::getWidgetCoordinatesBufferSize() const
@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_OVERLAYWIDGETS_H_
 #define LIBANGLE_OVERLAYWIDGETS_H_
 
+#include <array>
+
 #include "common/angleutils.h"
 #include "libANGLE/Overlay_autogen.h"
 
@@ -40,6 +42,8 @@ enum class WidgetType
     RunningGraph,
     // A histogram of the last N values (values between 0 and 1).
     RunningHistogram,
+    // A graph of the last N values, each split in layers that are drawn stacked.
+    RunningStackedGraph,
 
     InvalidEnum,
     EnumCount = InvalidEnum,
@@ -168,6 +172,44 @@ class RunningHistogram : public RunningGraph
     }
 };
 
+class RunningStackedGraph : public RunningGraph
+{
+  public:
+    // Out of line constructor to satisfy chromium-style.
+    RunningStackedGraph(size_t n, size_t layerCount);
+    ~RunningStackedGraph() override;
+
+    void add(size_t layer, uint64_t n)
+    {
+        if (!ignoreFirstValue)
+        {
+            layerValues[layer][lastValueIndex] += n;
+            runningValues[lastValueIndex] += n;
+        }
+    }
+
+    void next()
+    {
+        const bool advances = !ignoreFirstValue;
+        RunningGraph::next();
+        if (advances)
+        {
+            for (std::vector<uint64_t> &values : layerValues)
+            {
+                values[lastValueIndex] = 0;
+            }
+        }
+    }
+
+  protected:
+    // The values of each layer, from the bottom one.  runningValues holds their sum.
+    std::vector<std::vector<uint64_t>> layerValues;
+    std::vector<std::array<float, 4>> layerColors;
+
+    friend class gl::Overlay;
+    friend class overlay_impl::AppendWidgetDataHelper;
+};
+
 // If overlay is disabled, all the above classes would be replaced with Mock, turning them into
 // noop.
 class Mock
@@ -672,6 +672,60 @@ void Overlay::initOverlayWidgets()
             widget->description.matchToWidget = nullptr;
         }
     }
+
+    {
+        RunningStackedGraph *widget = new RunningStackedGraph(60, 5);
+        {
+            const int32_t fontSize = GetFontSize(0, kLargeFont);
+            const int32_t offsetX  = 10;
+            const int32_t offsetY  = -50;
+            const int32_t width    = 5 * static_cast<uint32_t>(widget->runningValues.size());
+            const int32_t height   = 100;
+
+            widget->type          = WidgetType::RunningStackedGraph;
+            widget->fontSize      = fontSize;
+            widget->coords[0]     = offsetX;
+            widget->coords[1]     = offsetY - height;
+            widget->coords[2]     = offsetX + width;
+            widget->coords[3]     = offsetY;
+            widget->color[0]      = 1.0f;
+            widget->color[1]      = 1.0f;
+            widget->color[2]      = 1.0f;
+            widget->color[3]      = 0.7843137254901961f;
+            widget->matchToWidget = nullptr;
+        }
+        widget->layerColors.push_back(
+            {1.0f, 0.29411764705882354f, 0.29411764705882354f, 0.7843137254901961f});
+        widget->layerColors.push_back(
+            {1.0f, 0.7843137254901961f, 0.29411764705882354f, 0.7843137254901961f});
+        widget->layerColors.push_back(
+            {0.29411764705882354f, 0.7843137254901961f, 0.0f, 0.7843137254901961f});
+        widget->layerColors.push_back({0.0f, 0.7843137254901961f, 1.0f, 0.7843137254901961f});
+        widget->layerColors.push_back(
+            {0.7843137254901961f, 0.29411764705882354f, 1.0f, 0.7843137254901961f});
+        mState.mOverlayWidgets[WidgetId::VulkanFrameCPUTime].reset(widget);
+        {
+            const int32_t fontSize = GetFontSize(kFontMipSmall, kLargeFont);
+            const int32_t offsetX =
+                mState.mOverlayWidgets[WidgetId::VulkanFrameCPUTime]->coords[0];
+            const int32_t offsetY =
+                mState.mOverlayWidgets[WidgetId::VulkanFrameCPUTime]->coords[1];
+            const int32_t width  = 80 * (kFontGlyphWidth >> fontSize);
+            const int32_t height = (kFontGlyphHeight >> fontSize);
+
+            widget->description.type          = WidgetType::Text;
+            widget->description.fontSize      = fontSize;
+            widget->description.coords[0]     = offsetX;
+            widget->description.coords[1]     = offsetY - height;
+            widget->description.coords[2]     = offsetX + width;
+            widget->description.coords[3]     = offsetY;
+            widget->description.color[0]      = 1.0f;
+            widget->description.color[1]      = 1.0f;
+            widget->description.color[2]      = 1.0f;
+            widget->description.color[3]      = 1.0f;
+            widget->description.matchToWidget = nullptr;
+        }
+    }
 }
 
 }  // namespace gl
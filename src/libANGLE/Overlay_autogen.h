@@ -44,6 +44,8 @@ enum class WidgetId
     VulkanAttemptedSubmissions,
     // Number of times the Vulkan backend actually submitted commands
     VulkanActualSubmissions,
+    // CPU time of a frame spent in each CpuTimePhase (Nanoseconds).
+    VulkanFrameCPUTime,
 
     InvalidEnum,
     EnumCount = InvalidEnum,
@@ -66,6 +68,7 @@ enum class WidgetId
     PROC(VulkanUniformDescriptorCacheSize)      \
     PROC(VulkanDescriptorCacheKeySize)          \
     PROC(VulkanAttemptedSubmissions)            \
-    PROC(VulkanActualSubmissions)
+    PROC(VulkanActualSubmissions)               \
+    PROC(VulkanFrameCPUTime)
 
 }  // namespace gl
@@ -303,6 +303,67 @@ void InitShaderStorageBlockLinker(const ProgramState &state, ShaderStorageBlockL
         }
     }
 }
+
+// Bumped whenever the layout of the program binary changes.  Binaries produced by a different
+// ANGLE commit are already rejected, this catches local builds that share a commit hash.
+constexpr uint32_t kProgramBinaryFormatVersion = 1;
+
+// After its header, the program binary is made of the following sections, in order.  The header
+// holds the offset and size of every section, so sections that are not needed to use the program
+// can be skipped at load time, or kept aside and parsed when first needed.
+enum class ProgramBinarySection : uint8_t
+{
+    // The executable and the rest of the program state needed to use the program.
+    Executable,
+    // The buffer variables, only needed by program interface queries.
+    BufferVariables,
+    // The shader sources, only present when frame capture is enabled.
+    CaptureSources,
+    // The backend's data, which must come last.
+    Backend,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+struct ProgramBinarySectionRange
+{
+    uint32_t offset = 0;
+    uint32_t size   = 0;
+};
+
+using ProgramBinarySectionTable =
+    angle::PackedEnumMap<ProgramBinarySection, ProgramBinarySectionRange>;
+
+void WriteProgramBinaryHeader(BinaryOutputStream *stream,
+                              const gl::Version &clientVersion,
+                              const ProgramBinarySectionTable &sections)
+{
+    stream->writeBytes(reinterpret_cast<const unsigned char *>(angle::GetANGLECommitHash()),
+                       angle::GetANGLECommitHashSize());
+    stream->writeInt(kProgramBinaryFormatVersion);
+    stream->writeInt(clientVersion.major);
+    stream->writeInt(clientVersion.minor);
+
+    for (const ProgramBinarySectionRange &section : sections)
+    {
+        stream->writeInt(section.offset);
+        stream->writeInt(section.size);
+    }
+}
+
+// Skips to |section|, which must not be before the current position of |stream|.
+bool SeekToProgramBinarySection(BinaryInputStream *stream,
+                                const ProgramBinarySectionRange &section)
+{
+    if (section.offset < stream->offset())
+    {
+        return false;
+    }
+
+    stream->skip(section.offset - stream->offset());
+    return !stream->error() && stream->remainingSize() >= section.size;
+}
 }  // anonymous namespace
 
 const char *GetLinkMismatchErrorString(LinkMismatchError linkError)
@@ -948,9 +1009,31 @@ GLuint ProgramState::getUniformIndexFromName(const std::string &name) const
     return GetResourceIndexFromName(mExecutable->mUniforms, name);
 }
 
+const std::vector<BufferVariable> &ProgramState::getBufferVariables() const
+{
+    if (!mSerializedBufferVariables.empty())
+    {
+        BinaryInputStream stream(mSerializedBufferVariables.data(),
+                                 mSerializedBufferVariables.size());
+
+        ASSERT(mBufferVariables.empty());
+        mBufferVariables.resize(stream.readInt<size_t>());
+        for (BufferVariable &bufferVariable : mBufferVariables)
+        {
+            LoadBufferVariable(&stream, &bufferVariable);
+        }
+
+        // The section's size was validated when the binary was loaded.
+        ASSERT(!stream.error() && stream.endOfStream());
+        mSerializedBufferVariables.clear();
+    }
+
+    return mBufferVariables;
+}
+
 GLuint ProgramState::getBufferVariableIndexFromName(const std::string &name) const
 {
-    return GetResourceIndexFromName(mBufferVariables, name);
+    return GetResourceIndexFromName(getBufferVariables(), name);
 }
 
 GLuint ProgramState::getUniformIndexFromLocation(UniformLocation location) const
@@ -1528,6 +1611,7 @@ void Program::unlink()
 
     mState.mUniformLocations.clear();
     mState.mBufferVariables.clear();
+    mState.mSerializedBufferVariables.clear();
     mState.mComputeShaderLocalSize.fill(1);
     mState.mNumViews             = -1;
     mState.mDrawIDLocation       = -1;
@@ -2065,8 +2149,9 @@ void Program::getBufferVariableResourceName(GLuint index,
                                             GLchar *name) const
 {
     ASSERT(!mLinkingState);
-    ASSERT(index < mState.mBufferVariables.size());
-    getResourceName(mState.mBufferVariables[index].name, bufSize, length, name);
+    const std::vector<BufferVariable> &bufferVariables = mState.getBufferVariables();
+    ASSERT(index < bufferVariables.size());
+    getResourceName(bufferVariables[index].name, bufSize, length, name);
 }
 
 const std::string Program::getResourceName(const sh::ShaderVariable &resource) const
@@ -2218,7 +2303,7 @@ GLint Program::getActiveUniformCount() const
 size_t Program::getActiveBufferVariableCount() const
 {
     ASSERT(!mLinkingState);
-    return mLinked ? mState.mBufferVariables.size() : 0;
+    return mLinked ? mState.getBufferVariables().size() : 0;
 }
 
 GLint Program::getActiveUniformMaxLength() const
@@ -2273,8 +2358,9 @@ const VariableLocation &Program::getUniformLocation(UniformLocation location) co
 const BufferVariable &Program::getBufferVariableByIndex(GLuint index) const
 {
     ASSERT(!mLinkingState);
-    ASSERT(index < static_cast<size_t>(mState.mBufferVariables.size()));
-    return mState.mBufferVariables[index];
+    const std::vector<BufferVariable> &bufferVariables = mState.getBufferVariables();
+    ASSERT(index < static_cast<size_t>(bufferVariables.size()));
+    return bufferVariables[index];
 }
 
 UniformLocation Program::getUniformLocation(const std::string &name) const
@@ -3580,22 +3666,9 @@ angle::Result Program::syncState(const Context *context)
 
 angle::Result Program::serialize(const Context *context, angle::MemoryBuffer *binaryOut) const
 {
-    BinaryOutputStream stream;
+    angle::PackedEnumMap<ProgramBinarySection, BinaryOutputStream> sectionStreams;
 
-    stream.writeBytes(reinterpret_cast<const unsigned char *>(angle::GetANGLECommitHash()),
-                      angle::GetANGLECommitHashSize());
-
-    // nullptr context is supported when computing binary length.
-    if (context)
-    {
-        stream.writeInt(context->getClientVersion().major);
-        stream.writeInt(context->getClientVersion().minor);
-    }
-    else
-    {
-        stream.writeInt(2);
-        stream.writeInt(0);
-    }
+    BinaryOutputStream &stream = sectionStreams[ProgramBinarySection::Executable];
 
     // Must be before mExecutable->save(), since it uses the value.
     stream.writeBool(mState.mSeparable);
@@ -3619,10 +3692,13 @@ angle::Result Program::serialize(const Context *context, angle::MemoryBuffer *bi
         stream.writeBool(variable.ignored);
     }
 
-    stream.writeInt(mState.getBufferVariables().size());
-    for (const BufferVariable &bufferVariable : mState.getBufferVariables())
+    BinaryOutputStream &bufferVariablesStream =
+        sectionStreams[ProgramBinarySection::BufferVariables];
+    const std::vector<BufferVariable> &bufferVariables = mState.getBufferVariables();
+    bufferVariablesStream.writeInt(bufferVariables.size());
+    for (const BufferVariable &bufferVariable : bufferVariables)
     {
-        WriteBufferVariable(&stream, bufferVariable);
+        WriteBufferVariable(&bufferVariablesStream, bufferVariable);
     }
 
     // Warn the app layer if saving a binary with unsupported transform feedback.
@@ -3635,13 +3711,15 @@ angle::Result Program::serialize(const Context *context, angle::MemoryBuffer *bi
 
     if (context->getShareGroup()->getFrameCaptureShared()->enabled())
     {
+        BinaryOutputStream &sourcesStream = sectionStreams[ProgramBinarySection::CaptureSources];
+
         // Serialize the source for each stage for re-use during capture
         for (ShaderType shaderType : mState.mExecutable->getLinkedShaderStages())
         {
             gl::Shader *shader = getAttachedShader(shaderType);
             if (shader)
             {
-                stream.writeString(shader->getSourceString());
+                sourcesStream.writeString(shader->getSourceString());
             }
             else
             {
@@ -3651,21 +3729,57 @@ angle::Result Program::serialize(const Context *context, angle::MemoryBuffer *bi
                     context->getShareGroup()->getFrameCaptureShared()->getProgramSources(id());
                 const std::string &cachedSourceString = cachedLinkedSources[shaderType];
                 ASSERT(!cachedSourceString.empty());
-                stream.writeString(cachedSourceString.c_str());
+                sourcesStream.writeString(cachedSourceString.c_str());
             }
         }
     }
 
-    mProgram->save(context, &stream);
+    mProgram->save(context, &sectionStreams[ProgramBinarySection::Backend]);
+
+    // nullptr context is supported when computing binary length.
+    const Version clientVersion = context ? context->getClientVersion() : Version(2, 0);
+
+    // The header has a fixed size, so write an empty one to find where the sections start.
+    ProgramBinarySectionTable sections;
+    BinaryOutputStream emptyHeader;
+    WriteProgramBinaryHeader(&emptyHeader, clientVersion, sections);
+
+    size_t offset = emptyHeader.length();
+    for (ProgramBinarySection section : angle::AllEnums<ProgramBinarySection>())
+    {
+        const size_t sectionSize = sectionStreams[section].length();
+        if (!angle::IsValueInRangeForNumericType<uint32_t>(offset + sectionSize))
+        {
+            WARN() << "Program binary exceeds the maximum supported size.";
+            return angle::Result::Incomplete;
+        }
+
+        sections[section].offset = static_cast<uint32_t>(offset);
+        sections[section].size   = static_cast<uint32_t>(sectionSize);
+        offset += sectionSize;
+    }
+
+    BinaryOutputStream header;
+    WriteProgramBinaryHeader(&header, clientVersion, sections);
+    ASSERT(header.length() == emptyHeader.length());
 
     ASSERT(binaryOut);
-    if (!binaryOut->resize(stream.length()))
+    if (!binaryOut->resize(offset))
     {
-        WARN() << "Failed to allocate enough memory to serialize a program. (" << stream.length()
+        WARN() << "Failed to allocate enough memory to serialize a program. (" << offset
                << " bytes )";
         return angle::Result::Incomplete;
     }
-    memcpy(binaryOut->data(), stream.data(), stream.length());
+
+    memcpy(binaryOut->data(), header.data(), header.length());
+    for (ProgramBinarySection section : angle::AllEnums<ProgramBinarySection>())
+    {
+        if (sections[section].size > 0)
+        {
+            memcpy(binaryOut->data() + sections[section].offset, sectionStreams[section].data(),
+                   sections[section].size);
+        }
+    }
     return angle::Result::Continue;
 }
 
@@ -3675,7 +3789,8 @@ angle::Result Program::deserialize(const Context *context,
 {
     std::vector<uint8_t> commitString(angle::GetANGLECommitHashSize(), 0);
     stream.readBytes(commitString.data(), commitString.size());
-    if (memcmp(commitString.data(), angle::GetANGLECommitHash(), commitString.size()) != 0)
+    if (memcmp(commitString.data(), angle::GetANGLECommitHash(), commitString.size()) != 0 ||
+        stream.readInt<uint32_t>() != kProgramBinaryFormatVersion)
     {
         infoLog << "Invalid program binary version.";
         return angle::Result::Stop;
@@ -3690,6 +3805,19 @@ angle::Result Program::deserialize(const Context *context,
         return angle::Result::Stop;
     }
 
+    ProgramBinarySectionTable sections;
+    for (ProgramBinarySectionRange &section : sections)
+    {
+        section.offset = stream.readInt<uint32_t>();
+        section.size   = stream.readInt<uint32_t>();
+    }
+
+    if (!SeekToProgramBinarySection(&stream, sections[ProgramBinarySection::Executable]))
+    {
+        infoLog << "Invalid program binary.";
+        return angle::Result::Stop;
+    }
+
     // Must be before mExecutable->load(), since it uses the value.
     mState.mSeparable = stream.readBool();
 
@@ -3716,15 +3844,23 @@ angle::Result Program::deserialize(const Context *context,
         mState.mUniformLocations.push_back(variable);
     }
 
-    size_t bufferVariableCount = stream.readInt<size_t>();
-    ASSERT(mState.mBufferVariables.empty());
-    for (size_t bufferVarIndex = 0; bufferVarIndex < bufferVariableCount; ++bufferVarIndex)
+    // Keep the buffer variables aside, they are parsed when first queried.  Validate their
+    // section now though, so the binary is rejected as a whole if it's corrupt.
+    const ProgramBinarySectionRange &bufferVariablesSection =
+        sections[ProgramBinarySection::BufferVariables];
+    if (stream.error() || stream.offset() != bufferVariablesSection.offset ||
+        !SeekToProgramBinarySection(&stream, bufferVariablesSection))
     {
-        BufferVariable bufferVariable;
-        LoadBufferVariable(&stream, &bufferVariable);
-        mState.mBufferVariables.push_back(bufferVariable);
+        infoLog << "Invalid program binary.";
+        return angle::Result::Stop;
     }
 
+    ASSERT(mState.mBufferVariables.empty());
+    const uint8_t *bufferVariablesData = stream.data() + stream.offset();
+    mState.mSerializedBufferVariables.assign(bufferVariablesData,
+                                             bufferVariablesData + bufferVariablesSection.size);
+    stream.skip(bufferVariablesSection.size);
+
     static_assert(static_cast<unsigned long>(ShaderType::EnumCount) <= sizeof(unsigned long) * 8,
                   "Too many shader types");
 
@@ -3746,6 +3882,12 @@ angle::Result Program::deserialize(const Context *context,
 
     if (context->getShareGroup()->getFrameCaptureShared()->enabled())
     {
+        if (!SeekToProgramBinarySection(&stream, sections[ProgramBinarySection::CaptureSources]))
+        {
+            infoLog << "Invalid program binary.";
+            return angle::Result::Stop;
+        }
+
         // Extract the source for each stage from the program binary
         angle::ProgramSources sources;
 
@@ -3761,6 +3903,15 @@ angle::Result Program::deserialize(const Context *context,
                                                                              std::move(sources));
     }
 
+    // Leave the stream at the backend's data, which is loaded next.
+    const ProgramBinarySectionRange &backendSection = sections[ProgramBinarySection::Backend];
+    if (!SeekToProgramBinarySection(&stream, backendSection) ||
+        stream.remainingSize() != backendSection.size)
+    {
+        infoLog << "Invalid program binary.";
+        return angle::Result::Stop;
+    }
+
     return angle::Result::Continue;
 }
 
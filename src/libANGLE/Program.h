@@ -274,7 +274,7 @@ class ProgramState final : angle::NonCopyable
     {
         return mExecutable->getShaderStorageBlocks();
     }
-    const std::vector<BufferVariable> &getBufferVariables() const { return mBufferVariables; }
+    const std::vector<BufferVariable> &getBufferVariables() const;
     const std::vector<SamplerBinding> &getSamplerBindings() const
     {
         return mExecutable->getSamplerBindings();
@@ -386,7 +386,12 @@ class ProgramState final : angle::NonCopyable
     std::vector<std::string> mTransformFeedbackVaryingNames;
 
     std::vector<VariableLocation> mUniformLocations;
-    std::vector<BufferVariable> mBufferVariables;
+
+    // Buffer variables are only needed for program interface queries.  When the program is loaded
+    // from a binary, their serialized form is kept in mSerializedBufferVariables and only parsed
+    // when they are first queried.
+    mutable std::vector<BufferVariable> mBufferVariables;
+    mutable std::vector<uint8_t> mSerializedBufferVariables;
 
     bool mBinaryRetrieveableHint;
     bool mSeparable;
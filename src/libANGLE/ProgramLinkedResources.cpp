@@ -563,7 +563,10 @@ class InterfaceBlockInfo final : angle::NonCopyable
         : mCustomEncoderFactory(customEncoderFactory)
     {}
 
-    void getShaderBlockInfo(const std::vector<sh::InterfaceBlock> &interfaceBlocks);
+    // The layout of the blocks is taken from |layoutCache| if the shader was linked before, and
+    // stored there otherwise.
+    void getShaderBlockInfo(const std::vector<sh::InterfaceBlock> &interfaceBlocks,
+                            InterfaceBlockLayoutMap *layoutCache);
 
     bool getBlockSize(const std::string &name, const std::string &mappedName, size_t *sizeOut);
     bool getBlockMemberInfo(const std::string &name,
@@ -571,31 +574,39 @@ class InterfaceBlockInfo final : angle::NonCopyable
                             sh::BlockMemberInfo *infoOut);
 
   private:
-    size_t getBlockInfo(const sh::InterfaceBlock &interfaceBlock);
+    void getBlockInfo(const sh::InterfaceBlock &interfaceBlock, InterfaceBlockLayout *layoutOut);
 
-    std::map<std::string, size_t> mBlockSizes;
-    sh::BlockLayoutMap mBlockLayout;
+    // The layouts are owned by the shaders' caches, which outlive the link.
+    std::map<std::string, const InterfaceBlockLayout *> mBlockLayouts;
     // Based on the interface block layout, the std140 or std430 encoders are used.  On some
     // platforms (currently only D3D), there could be another non-standard encoder used.
     CustomBlockLayoutEncoderFactory *mCustomEncoderFactory;
 };
 
-void InterfaceBlockInfo::getShaderBlockInfo(const std::vector<sh::InterfaceBlock> &interfaceBlocks)
+void InterfaceBlockInfo::getShaderBlockInfo(const std::vector<sh::InterfaceBlock> &interfaceBlocks,
+                                            InterfaceBlockLayoutMap *layoutCache)
 {
     for (const sh::InterfaceBlock &interfaceBlock : interfaceBlocks)
     {
         if (!IsActiveInterfaceBlock(interfaceBlock))
             continue;
 
-        if (mBlockSizes.count(interfaceBlock.name) > 0)
+        if (mBlockLayouts.count(interfaceBlock.name) > 0)
             continue;
 
-        size_t dataSize                  = getBlockInfo(interfaceBlock);
-        mBlockSizes[interfaceBlock.name] = dataSize;
+        auto layoutIter = layoutCache->find(interfaceBlock.name);
+        if (layoutIter == layoutCache->end())
+        {
+            layoutIter = layoutCache->emplace(interfaceBlock.name, InterfaceBlockLayout()).first;
+            getBlockInfo(interfaceBlock, &layoutIter->second);
+        }
+
+        mBlockLayouts[interfaceBlock.name] = &layoutIter->second;
     }
 }
 
-size_t InterfaceBlockInfo::getBlockInfo(const sh::InterfaceBlock &interfaceBlock)
+void InterfaceBlockInfo::getBlockInfo(const sh::InterfaceBlock &interfaceBlock,
+                                      InterfaceBlockLayout *layoutOut)
 {
     ASSERT(IsActiveInterfaceBlock(interfaceBlock));
 
@@ -620,17 +631,16 @@ size_t InterfaceBlockInfo::getBlockInfo(const sh::InterfaceBlock &interfaceBlock
     else
     {
         UNREACHABLE();
-        return 0;
+        layoutOut->dataSize = 0;
+        return;
     }
 
     sh::GetInterfaceBlockInfo(interfaceBlock.fields, interfaceBlock.fieldPrefix(), encoder,
-                              &mBlockLayout);
+                              &layoutOut->memberLayout);
 
-    size_t offset = encoder->getCurrentOffset();
+    layoutOut->dataSize = encoder->getCurrentOffset();
 
     SafeDelete(customEncoder);
-
-    return offset;
 }
 
 bool InterfaceBlockInfo::getBlockSize(const std::string &name,
@@ -640,14 +650,14 @@ bool InterfaceBlockInfo::getBlockSize(const std::string &name,
     size_t nameLengthWithoutArrayIndex;
     ParseArrayIndex(name, &nameLengthWithoutArrayIndex);
     std::string baseName = name.substr(0u, nameLengthWithoutArrayIndex);
-    auto sizeIter        = mBlockSizes.find(baseName);
-    if (sizeIter == mBlockSizes.end())
+    auto layoutIter      = mBlockLayouts.find(baseName);
+    if (layoutIter == mBlockLayouts.end())
     {
         *sizeOut = 0;
         return false;
     }
 
-    *sizeOut = sizeIter->second;
+    *sizeOut = layoutIter->second->dataSize;
     return true;
 }
 
@@ -655,15 +665,21 @@ bool InterfaceBlockInfo::getBlockMemberInfo(const std::string &name,
                                             const std::string &mappedName,
                                             sh::BlockMemberInfo *infoOut)
 {
-    auto infoIter = mBlockLayout.find(name);
-    if (infoIter == mBlockLayout.end())
+    // The name of the members of blocks without an instance name doesn't identify the block, so
+    // every block is searched.  Programs have few of them.
+    for (const auto &blockLayout : mBlockLayouts)
     {
-        *infoOut = sh::kDefaultBlockMemberInfo;
-        return false;
+        const sh::BlockLayoutMap &memberLayout = blockLayout.second->memberLayout;
+        auto infoIter                          = memberLayout.find(name);
+        if (infoIter != memberLayout.end())
+        {
+            *infoOut = infoIter->second;
+            return true;
+        }
     }
 
-    *infoOut = infoIter->second;
-    return true;
+    *infoOut = sh::kDefaultBlockMemberInfo;
+    return false;
 }
 
 void GetFilteredVaryings(const std::vector<sh::ShaderVariable> &varyings,
@@ -1567,7 +1583,8 @@ void ProgramLinkedResourcesLinker::linkResources(const ProgramState &programStat
         Shader *shader = programState.getAttachedShader(shaderType);
         if (shader)
         {
-            uniformBlockInfo.getShaderBlockInfo(shader->getUniformBlocks());
+            uniformBlockInfo.getShaderBlockInfo(shader->getUniformBlocks(),
+                                                shader->getUniformBlockLayoutCache());
         }
     }
 
@@ -1592,7 +1609,8 @@ void ProgramLinkedResourcesLinker::linkResources(const ProgramState &programStat
         Shader *shader = programState.getAttachedShader(shaderType);
         if (shader)
         {
-            shaderStorageBlockInfo.getShaderBlockInfo(shader->getShaderStorageBlocks());
+            shaderStorageBlockInfo.getShaderBlockInfo(shader->getShaderStorageBlocks(),
+                                                      shader->getShaderStorageBlockLayoutCache());
         }
     }
     auto getShaderStorageBlockSize = [&shaderStorageBlockInfo](const std::string &name,
@@ -38,6 +38,29 @@ IDType AllocateEmptyObject(HandleAllocator *handleAllocator,
     return handle;
 }
 
+// Allocates handles in consecutive runs where possible, which are assigned to the map at once.
+template <typename ResourceType, typename IDType>
+void AllocateEmptyObjects(HandleAllocator *handleAllocator,
+                          ResourceMap<ResourceType, IDType> *objectMap,
+                          GLsizei count,
+                          IDType *handlesOut)
+{
+    GLuint remaining = static_cast<GLuint>(count);
+    while (remaining > 0)
+    {
+        GLuint allocatedCount = 0;
+        GLuint firstHandle    = handleAllocator->allocateRange(remaining, &allocatedCount);
+        ASSERT(allocatedCount > 0 && allocatedCount <= remaining);
+
+        objectMap->assignRange(PackParam<IDType>(firstHandle), allocatedCount, nullptr);
+        for (GLuint index = 0; index < allocatedCount; ++index)
+        {
+            *handlesOut++ = PackParam<IDType>(firstHandle + index);
+        }
+        remaining -= allocatedCount;
+    }
+}
+
 }  // anonymous namespace
 
 ResourceManagerBase::ResourceManagerBase() : mRefCount(1) {}
@@ -127,6 +150,11 @@ BufferID BufferManager::createBuffer()
     return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
 }
 
+void BufferManager::createBuffers(GLsizei count, BufferID *buffersOut)
+{
+    AllocateEmptyObjects(&mHandleAllocator, &mObjectMap, count, buffersOut);
+}
+
 Buffer *BufferManager::getBuffer(BufferID handle) const
 {
     return mObjectMap.query(handle);
@@ -236,6 +264,11 @@ TextureID TextureManager::createTexture()
     return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
 }
 
+void TextureManager::createTextures(GLsizei count, TextureID *texturesOut)
+{
+    AllocateEmptyObjects(&mHandleAllocator, &mObjectMap, count, texturesOut);
+}
+
 void TextureManager::signalAllTexturesDirty() const
 {
     for (const auto &texture : mObjectMap)
@@ -278,6 +311,11 @@ RenderbufferID RenderbufferManager::createRenderbuffer()
     return {AllocateEmptyObject(&mHandleAllocator, &mObjectMap)};
 }
 
+void RenderbufferManager::createRenderbuffers(GLsizei count, RenderbufferID *renderbuffersOut)
+{
+    AllocateEmptyObjects(&mHandleAllocator, &mObjectMap, count, renderbuffersOut);
+}
+
 Renderbuffer *RenderbufferManager::getRenderbuffer(RenderbufferID handle) const
 {
     return mObjectMap.query(handle);
@@ -306,6 +344,11 @@ SamplerID SamplerManager::createSampler()
     return AllocateEmptyObject(&mHandleAllocator, &mObjectMap);
 }
 
+void SamplerManager::createSamplers(GLsizei count, SamplerID *samplersOut)
+{
+    AllocateEmptyObjects(&mHandleAllocator, &mObjectMap, count, samplersOut);
+}
+
 Sampler *SamplerManager::getSampler(SamplerID handle) const
 {
     return mObjectMap.query(handle);
@@ -389,7 +432,7 @@ void FramebufferManager::invalidateFramebufferCompletenessCache() const
     {
         if (framebuffer.second)
         {
-            framebuffer.second->invalidateCompletenessCache();
+            framebuffer.second->invalidateCompleteConfigurations();
         }
     }
 }
@@ -130,6 +130,7 @@ class BufferManager : public TypedResourceManager<Buffer, BufferManager, BufferI
 {
   public:
     BufferID createBuffer();
+    void createBuffers(GLsizei count, BufferID *buffersOut);
     Buffer *getBuffer(BufferID handle) const;
 
     ANGLE_INLINE Buffer *checkBufferAllocation(rx::GLImplFactory *factory, BufferID handle)
@@ -190,6 +191,7 @@ class TextureManager : public TypedResourceManager<Texture, TextureManager, Text
 {
   public:
     TextureID createTexture();
+    void createTextures(GLsizei count, TextureID *texturesOut);
     ANGLE_INLINE Texture *getTexture(TextureID handle) const
     {
         ASSERT(mObjectMap.query({0}) == nullptr);
@@ -221,6 +223,7 @@ class RenderbufferManager
 {
   public:
     RenderbufferID createRenderbuffer();
+    void createRenderbuffers(GLsizei count, RenderbufferID *renderbuffersOut);
     Renderbuffer *getRenderbuffer(RenderbufferID handle) const;
 
     Renderbuffer *checkRenderbufferAllocation(rx::GLImplFactory *factory, RenderbufferID handle)
@@ -239,6 +242,7 @@ class SamplerManager : public TypedResourceManager<Sampler, SamplerManager, Samp
 {
   public:
     SamplerID createSampler();
+    void createSamplers(GLsizei count, SamplerID *samplersOut);
     Sampler *getSampler(SamplerID handle) const;
     bool isSampler(SamplerID sampler) const;
 
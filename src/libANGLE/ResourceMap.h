@@ -7,12 +7,19 @@
 //   An optimized resource map which packs the first set of allocated objects into a
 //   flat array, and then falls back to an unordered map for the higher handle values.
 //
+//   Lookups in the flat array are wait-free and may be done concurrently with modifications of
+//   the map from another thread, such as those of a share group shared by multiple contexts.
+//
 
 #ifndef LIBANGLE_RESOURCE_MAP_H_
 #define LIBANGLE_RESOURCE_MAP_H_
 
 #include "libANGLE/angletypes.h"
 
+#include <atomic>
+#include <memory>
+#include <vector>
+
 namespace gl
 {
 
@@ -26,9 +33,11 @@ class ResourceMap final : angle::NonCopyable
     ANGLE_INLINE ResourceType *query(IDType id) const
     {
         GLuint handle = GetIDValue(id);
-        if (handle < mFlatResourcesSize)
+        // The size is loaded before the array, so the array is at least as large.  See assign().
+        if (handle < mFlatResourcesSize.load(std::memory_order_acquire))
         {
-            ResourceType *value = mFlatResources[handle];
+            const FlatResource *flatResources = mFlatResources.load(std::memory_order_acquire);
+            ResourceType *value = flatResources[handle].load(std::memory_order_acquire);
             return (value == InvalidPointer() ? nullptr : value);
         }
         auto it = mHashedResources.find(handle);
@@ -42,6 +51,8 @@ class ResourceMap final : angle::NonCopyable
     bool erase(IDType id, ResourceType **resourceOut);
 
     void assign(IDType id, ResourceType *resource);
+    // Assigns |resource| to |count| consecutive handles starting with |firstId|.
+    void assignRange(IDType firstId, GLuint count, ResourceType *resource);
 
     // Clears the map.
     void clear();
@@ -87,6 +98,29 @@ class ResourceMap final : angle::NonCopyable
   private:
     friend class Iterator;
 
+    using FlatResource = std::atomic<ResourceType *>;
+
+    // Accessors for the flat array in the thread that modifies the map.
+    size_t getFlatResourcesSize() const
+    {
+        return mFlatResourcesSize.load(std::memory_order_relaxed);
+    }
+    FlatResource *getFlatResources() const
+    {
+        return mFlatResources.load(std::memory_order_relaxed);
+    }
+    ResourceType *getFlatResource(size_t index) const
+    {
+        return getFlatResources()[index].load(std::memory_order_relaxed);
+    }
+    void setFlatResource(size_t index, ResourceType *resource)
+    {
+        getFlatResources()[index].store(resource, std::memory_order_release);
+    }
+
+    // Makes sure the flat array can hold |handle|.
+    void growFlatResources(GLuint handle);
+
     GLuint nextResource(size_t flatIndex, bool skipNulls) const;
 
     // constexpr methods cannot contain reinterpret_cast, so we need a static method.
@@ -99,11 +133,13 @@ class ResourceMap final : angle::NonCopyable
     // Experimental testing suggests that 16k is a reasonable upper limit.
     static constexpr size_t kFlatResourcesLimit = 0x4000;
 
-    // Size of one map element.
-    static constexpr size_t kElementSize = sizeof(ResourceType *);
-
-    size_t mFlatResourcesSize;
-    ResourceType **mFlatResources;
+    // When the flat array grows, the new array is published before its size, so that a concurrent
+    // query() never indexes an array beyond its bounds.  The old array is retired instead of being
+    // deleted, as concurrent readers may still be accessing it.  Retired arrays, which are smaller
+    // than the current one, are freed along with the map.
+    std::atomic<size_t> mFlatResourcesSize;
+    std::atomic<FlatResource *> mFlatResources;
+    std::vector<std::unique_ptr<FlatResource[]>> mRetiredFlatResources;
 
     // A map of GL objects indexed by object ID.
     HashMap mHashedResources;
@@ -112,25 +148,28 @@ class ResourceMap final : angle::NonCopyable
 template <typename ResourceType, typename IDType>
 ResourceMap<ResourceType, IDType>::ResourceMap()
     : mFlatResourcesSize(kInitialFlatResourcesSize),
-      mFlatResources(new ResourceType *[kInitialFlatResourcesSize])
+      mFlatResources(new FlatResource[kInitialFlatResourcesSize])
 {
-    memset(mFlatResources, kInvalidPointer, mFlatResourcesSize * kElementSize);
+    for (size_t index = 0; index < kInitialFlatResourcesSize; ++index)
+    {
+        setFlatResource(index, InvalidPointer());
+    }
 }
 
 template <typename ResourceType, typename IDType>
 ResourceMap<ResourceType, IDType>::~ResourceMap()
 {
     ASSERT(empty());
-    delete[] mFlatResources;
+    delete[] getFlatResources();
 }
 
 template <typename ResourceType, typename IDType>
 ANGLE_INLINE bool ResourceMap<ResourceType, IDType>::contains(IDType id) const
 {
     GLuint handle = GetIDValue(id);
-    if (handle < mFlatResourcesSize)
+    if (handle < getFlatResourcesSize())
     {
-        return (mFlatResources[handle] != InvalidPointer());
+        return (getFlatResource(handle) != InvalidPointer());
     }
     return (mHashedResources.find(handle) != mHashedResources.end());
 }
@@ -139,15 +178,15 @@ template <typename ResourceType, typename IDType>
 bool ResourceMap<ResourceType, IDType>::erase(IDType id, ResourceType **resourceOut)
 {
     GLuint handle = GetIDValue(id);
-    if (handle < mFlatResourcesSize)
+    if (handle < getFlatResourcesSize())
     {
-        auto &value = mFlatResources[handle];
+        ResourceType *value = getFlatResource(handle);
         if (value == InvalidPointer())
         {
             return false;
         }
         *resourceOut = value;
-        value        = InvalidPointer();
+        setFlatResource(handle, InvalidPointer());
     }
     else
     {
@@ -168,26 +207,8 @@ void ResourceMap<ResourceType, IDType>::assign(IDType id, ResourceType *resource
     GLuint handle = GetIDValue(id);
     if (handle < kFlatResourcesLimit)
     {
-        if (handle >= mFlatResourcesSize)
-        {
-            // Use power-of-two.
-            size_t newSize = mFlatResourcesSize;
-            while (newSize <= handle)
-            {
-                newSize *= 2;
-            }
-
-            ResourceType **oldResources = mFlatResources;
-
-            mFlatResources = new ResourceType *[newSize];
-            memset(&mFlatResources[mFlatResourcesSize], kInvalidPointer,
-                   (newSize - mFlatResourcesSize) * kElementSize);
-            memcpy(mFlatResources, oldResources, mFlatResourcesSize * kElementSize);
-            mFlatResourcesSize = newSize;
-            delete[] oldResources;
-        }
-        ASSERT(mFlatResourcesSize > handle);
-        mFlatResources[handle] = resource;
+        growFlatResources(handle);
+        setFlatResource(handle, resource);
     }
     else
     {
@@ -195,6 +216,74 @@ void ResourceMap<ResourceType, IDType>::assign(IDType id, ResourceType *resource
     }
 }
 
+template <typename ResourceType, typename IDType>
+void ResourceMap<ResourceType, IDType>::assignRange(IDType firstId,
+                                                    GLuint count,
+                                                    ResourceType *resource)
+{
+    ASSERT(count > 0);
+    const GLuint firstHandle = GetIDValue(firstId);
+    const GLuint lastHandle  = firstHandle + count - 1;
+    ASSERT(lastHandle >= firstHandle);
+
+    // Grow the flat array once for the whole range.
+    const GLuint lastFlatHandle =
+        std::min(lastHandle, static_cast<GLuint>(kFlatResourcesLimit - 1));
+    GLuint handle = firstHandle;
+    if (handle <= lastFlatHandle)
+    {
+        growFlatResources(lastFlatHandle);
+        for (; handle <= lastFlatHandle; ++handle)
+        {
+            setFlatResource(handle, resource);
+        }
+    }
+
+    if (handle <= lastHandle)
+    {
+        mHashedResources.reserve(mHashedResources.size() + (lastHandle - handle + 1));
+        for (; handle <= lastHandle; ++handle)
+        {
+            mHashedResources[handle] = resource;
+        }
+    }
+}
+
+template <typename ResourceType, typename IDType>
+void ResourceMap<ResourceType, IDType>::growFlatResources(GLuint handle)
+{
+    ASSERT(handle < kFlatResourcesLimit);
+
+    const size_t oldSize = getFlatResourcesSize();
+    if (handle < oldSize)
+    {
+        return;
+    }
+
+    // Use power-of-two.
+    size_t newSize = oldSize;
+    while (newSize <= handle)
+    {
+        newSize *= 2;
+    }
+
+    FlatResource *oldResources = getFlatResources();
+    FlatResource *newResources = new FlatResource[newSize];
+    for (size_t index = 0; index < oldSize; ++index)
+    {
+        newResources[index].store(oldResources[index].load(std::memory_order_relaxed),
+                                  std::memory_order_relaxed);
+    }
+    for (size_t index = oldSize; index < newSize; ++index)
+    {
+        newResources[index].store(InvalidPointer(), std::memory_order_relaxed);
+    }
+
+    mFlatResources.store(newResources, std::memory_order_release);
+    mFlatResourcesSize.store(newSize, std::memory_order_release);
+    mRetiredFlatResources.emplace_back(oldResources);
+}
+
 template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, IDType>::begin()
     const
@@ -205,7 +294,8 @@ typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, I
 template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, IDType>::end() const
 {
-    return Iterator(*this, static_cast<GLuint>(mFlatResourcesSize), mHashedResources.end(), true);
+    return Iterator(*this, static_cast<GLuint>(getFlatResourcesSize()), mHashedResources.end(),
+                    true);
 }
 
 template <typename ResourceType, typename IDType>
@@ -219,16 +309,17 @@ template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator
 ResourceMap<ResourceType, IDType>::endWithNull() const
 {
-    return Iterator(*this, static_cast<GLuint>(mFlatResourcesSize), mHashedResources.end(), false);
+    return Iterator(*this, static_cast<GLuint>(getFlatResourcesSize()), mHashedResources.end(),
+                    false);
 }
 
 template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator ResourceMap<ResourceType, IDType>::find(
     IDType handle) const
 {
-    if (handle < mFlatResourcesSize)
+    if (handle < getFlatResourcesSize())
     {
-        return (mFlatResources[handle] != InvalidPointer()
+        return (getFlatResource(handle) != InvalidPointer()
                     ? Iterator(handle, mHashedResources.begin())
                     : end());
     }
@@ -247,23 +338,28 @@ bool ResourceMap<ResourceType, IDType>::empty() const
 template <typename ResourceType, typename IDType>
 void ResourceMap<ResourceType, IDType>::clear()
 {
-    memset(mFlatResources, kInvalidPointer, kInitialFlatResourcesSize * kElementSize);
-    mFlatResourcesSize = kInitialFlatResourcesSize;
+    // The array is kept, but only its initial part is used from now on.
+    for (size_t index = 0; index < kInitialFlatResourcesSize; ++index)
+    {
+        setFlatResource(index, InvalidPointer());
+    }
+    mFlatResourcesSize.store(kInitialFlatResourcesSize, std::memory_order_release);
     mHashedResources.clear();
 }
 
 template <typename ResourceType, typename IDType>
 GLuint ResourceMap<ResourceType, IDType>::nextResource(size_t flatIndex, bool skipNulls) const
 {
-    for (size_t index = flatIndex; index < mFlatResourcesSize; index++)
+    const size_t flatResourcesSize = getFlatResourcesSize();
+    for (size_t index = flatIndex; index < flatResourcesSize; index++)
     {
-        if ((mFlatResources[index] != nullptr || !skipNulls) &&
-            mFlatResources[index] != InvalidPointer())
+        ResourceType *value = getFlatResource(index);
+        if ((value != nullptr || !skipNulls) && value != InvalidPointer())
         {
             return static_cast<GLuint>(index);
         }
     }
-    return static_cast<GLuint>(mFlatResourcesSize);
+    return static_cast<GLuint>(flatResourcesSize);
 }
 
 template <typename ResourceType, typename IDType>
@@ -300,7 +396,7 @@ template <typename ResourceType, typename IDType>
 typename ResourceMap<ResourceType, IDType>::Iterator &
 ResourceMap<ResourceType, IDType>::Iterator::operator++()
 {
-    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResourcesSize))
+    if (mFlatIndex < static_cast<GLuint>(mOrigin.getFlatResourcesSize()))
     {
         mFlatIndex = mOrigin.nextResource(mFlatIndex + 1, mSkipNulls);
     }
@@ -329,10 +425,10 @@ ResourceMap<ResourceType, IDType>::Iterator::operator*() const
 template <typename ResourceType, typename IDType>
 void ResourceMap<ResourceType, IDType>::Iterator::updateValue()
 {
-    if (mFlatIndex < static_cast<GLuint>(mOrigin.mFlatResourcesSize))
+    if (mFlatIndex < static_cast<GLuint>(mOrigin.getFlatResourcesSize()))
     {
         mValue.first  = mFlatIndex;
-        mValue.second = mOrigin.mFlatResources[mFlatIndex];
+        mValue.second = mOrigin.getFlatResource(mFlatIndex);
     }
     else if (mHashIndex != mOrigin.mHashedResources.end())
     {
@@ -9,6 +9,9 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
+
 #include "libANGLE/ResourceMap.h"
 
 using namespace gl;
@@ -133,4 +136,71 @@ TEST(ResourceMapTest, QueryUnassigned)
     ASSERT_FALSE(resourceMap.contains(100));
     ASSERT_EQ(nullptr, resourceMap.query(100));
 }
+
+// Tests assigning ranges of handles, including one that crosses into the hashed part of the map.
+TEST(ResourceMapTest, AssignRange)
+{
+    ResourceMap<size_t, GLuint> resourceMap;
+    size_t object = 1;
+
+    resourceMap.assignRange(1, 100, &object);
+    resourceMap.assignRange(0x3FF0, 0x20, nullptr);
+
+    for (GLuint handle = 1; handle <= 100; ++handle)
+    {
+        EXPECT_EQ(&object, resourceMap.query(handle));
+    }
+    EXPECT_FALSE(resourceMap.contains(101));
+
+    for (GLuint handle = 0x3FF0; handle < 0x4010; ++handle)
+    {
+        EXPECT_TRUE(resourceMap.contains(handle));
+        EXPECT_EQ(nullptr, resourceMap.query(handle));
+    }
+    EXPECT_FALSE(resourceMap.contains(0x3FEF));
+    EXPECT_FALSE(resourceMap.contains(0x4010));
+
+    resourceMap.clear();
+    ASSERT_TRUE(resourceMap.empty());
+}
+
+// Tests querying the flat part of the map from one thread while another thread grows it.
+TEST(ResourceMapTest, ConcurrentQueryWhileGrowing)
+{
+    constexpr size_t kSize = 0x2000;
+
+    ResourceMap<size_t, GLuint> resourceMap;
+    std::vector<size_t> objects(kSize);
+
+    std::atomic<size_t> assignedCount(0);
+    std::thread writer([&]() {
+        for (size_t index = 0; index < kSize; ++index)
+        {
+            objects[index] = index;
+            resourceMap.assign(static_cast<GLuint>(index), &objects[index]);
+            assignedCount.store(index + 1, std::memory_order_release);
+        }
+    });
+
+    // Every handle that is known to be assigned must be found.
+    size_t checkedCount = 0;
+    while (checkedCount < kSize)
+    {
+        const size_t count = assignedCount.load(std::memory_order_acquire);
+        for (size_t index = checkedCount; index < count; ++index)
+        {
+            EXPECT_EQ(&objects[index], resourceMap.query(static_cast<GLuint>(index)));
+        }
+        checkedCount = count;
+    }
+
+    writer.join();
+
+    for (size_t index = 0; index < kSize; ++index)
+    {
+        size_t *found = nullptr;
+        ASSERT_TRUE(resourceMap.erase(static_cast<GLuint>(index), &found));
+    }
+    ASSERT_TRUE(resourceMap.empty());
+}
 }  // anonymous namespace
@@ -15,10 +15,13 @@
 
 #include "GLSLANG/ShaderLang.h"
 #include "common/utilities.h"
+#include "libANGLE/BinaryStream.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Compiler.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/MemoryShaderCache.h"
+#include "libANGLE/Program.h"
 #include "libANGLE/ResourceManager.h"
 #include "libANGLE/renderer/GLImplFactory.h"
 #include "libANGLE/renderer/ShaderImpl.h"
@@ -52,6 +55,64 @@ const std::vector<VarT> &GetShaderVariables(const std::vector<VarT> *variableLis
     return *variableList;
 }
 
+void WriteShaderVariables(BinaryOutputStream *stream,
+                          const std::vector<sh::ShaderVariable> &variables)
+{
+    stream->writeInt(variables.size());
+    for (const sh::ShaderVariable &variable : variables)
+    {
+        WriteShaderVar(stream, variable);
+    }
+}
+
+void LoadShaderVariables(BinaryInputStream *stream, std::vector<sh::ShaderVariable> *variables)
+{
+    variables->resize(stream->readInt<size_t>());
+    for (sh::ShaderVariable &variable : *variables)
+    {
+        LoadShaderVar(stream, &variable);
+    }
+}
+
+void WriteShInterfaceBlocks(BinaryOutputStream *stream,
+                            const std::vector<sh::InterfaceBlock> &blocks)
+{
+    stream->writeInt(blocks.size());
+    for (const sh::InterfaceBlock &block : blocks)
+    {
+        WriteShInterfaceBlock(stream, block);
+    }
+}
+
+void LoadShInterfaceBlocks(BinaryInputStream *stream, std::vector<sh::InterfaceBlock> *blocks)
+{
+    blocks->resize(stream->readInt<size_t>());
+    for (sh::InterfaceBlock &block : *blocks)
+    {
+        LoadShInterfaceBlock(stream, &block);
+    }
+}
+
+template <typename T>
+void WriteOptional(BinaryOutputStream *stream, const Optional<T> &value)
+{
+    stream->writeBool(value.valid());
+    if (value.valid())
+    {
+        stream->writeInt(static_cast<int>(value.value()));
+    }
+}
+
+template <typename T>
+void LoadOptional(BinaryInputStream *stream, Optional<T> *value)
+{
+    value->reset();
+    if (stream->readBool())
+    {
+        *value = static_cast<T>(stream->readInt<int>());
+    }
+}
+
 }  // anonymous namespace
 
 // true if varying x has a higher priority in packing than y
@@ -118,6 +179,11 @@ struct Shader::CompilingState
 {
     std::shared_ptr<rx::WaitableCompileEvent> compileEvent;
     ShCompilerInstance shCompilerInstance;
+
+    // Where to store the results of the compilation, if the shader cache is enabled.
+    MemoryShaderCache *shaderCache = nullptr;
+    std::mutex *shaderCacheMutex   = nullptr;
+    egl::BlobCache::Key shaderHash = {};
 };
 
 ShaderState::ShaderState(ShaderType shaderType)
@@ -311,10 +377,8 @@ void Shader::getTranslatedSourceWithDebugInfo(GLsizei bufSize, GLsizei *length,
     GetSourceImpl(debugInfo, bufSize, length, buffer);
 }
 
-void Shader::compile(const Context *context)
+void Shader::resetCompiledState()
 {
-    resolveCompile();
-
     mState.mTranslatedSource.clear();
     mState.mCompiledBinary.clear();
     mInfoLog.clear();
@@ -324,6 +388,8 @@ void Shader::compile(const Context *context)
     mState.mUniforms.clear();
     mState.mUniformBlocks.clear();
     mState.mShaderStorageBlocks.clear();
+    mUniformBlockLayoutCache.clear();
+    mShaderStorageBlockLayoutCache.clear();
     mState.mActiveAttributes.clear();
     mState.mActiveOutputVariables.clear();
     mState.mNumViews = -1;
@@ -339,6 +405,13 @@ void Shader::compile(const Context *context)
     mState.mAdvancedBlendEquations.reset();
     mState.mEnablesPerSampleShading = false;
     mState.mSpecConstUsageBits.reset();
+}
+
+void Shader::compile(const Context *context)
+{
+    resolveCompile();
+
+    resetCompiledState();
 
     mState.mCompileStatus = CompileStatus::COMPILE_REQUESTED;
     mBoundCompiler.set(context, context->getCompiler());
@@ -392,8 +465,33 @@ void Shader::compile(const Context *context)
     ASSERT(compilerHandle);
     mCompilerResourcesString = compilerInstance.getBuiltinResourcesString();
 
+    // Skip the translator altogether if the same shader was translated before with the same
+    // options.
+    egl::BlobCache::Key shaderHash = {0};
+    MemoryShaderCache *shaderCache = context->getMemoryShaderCache();
+    if (shaderCache != nullptr)
+    {
+        const ShCompileOptions translatorOptions =
+            mImplementation->getTranslatorCompileOptions(context, options);
+
+        std::lock_guard<std::mutex> cacheLock(context->getProgramCacheMutex());
+        if (shaderCache->getShader(context, this, translatorOptions, mCompilerResourcesString,
+                                   &shaderHash))
+        {
+            mBoundCompiler->putInstance(std::move(compilerInstance));
+            mState.mCompileStatus = CompileStatus::COMPILED;
+            return;
+        }
+    }
+
     mCompilingState.reset(new CompilingState());
     mCompilingState->shCompilerInstance = std::move(compilerInstance);
+    if (shaderCache != nullptr)
+    {
+        mCompilingState->shaderCache      = shaderCache;
+        mCompilingState->shaderCacheMutex = &context->getProgramCacheMutex();
+        mCompilingState->shaderHash       = shaderHash;
+    }
     mCompilingState->compileEvent =
         mImplementation->compile(context, &(mCompilingState->shCompilerInstance), options);
 }
@@ -601,6 +699,102 @@ void Shader::resolveCompile()
 
     bool success          = mCompilingState->compileEvent->postTranslate(&mInfoLog);
     mState.mCompileStatus = success ? CompileStatus::COMPILED : CompileStatus::NOT_COMPILED;
+
+    if (success && mCompilingState->shaderCache != nullptr)
+    {
+        std::lock_guard<std::mutex> cacheLock(*mCompilingState->shaderCacheMutex);
+        // Failing to cache the shader is not an error.
+        ANGLE_UNUSED_VARIABLE(
+            mCompilingState->shaderCache->putShader(mCompilingState->shaderHash, this));
+    }
+}
+
+void Shader::serialize(BinaryOutputStream *stream) const
+{
+    ASSERT(mState.mCompileStatus == CompileStatus::COMPILED);
+
+    stream->writeString(mInfoLog);
+    stream->writeInt(mState.mShaderVersion);
+    stream->writeString(mState.mTranslatedSource);
+    stream->writeIntVector(mState.mCompiledBinary);
+
+    for (size_t index = 0; index < mState.mLocalSize.size(); ++index)
+    {
+        stream->writeInt(mState.mLocalSize[index]);
+    }
+
+    WriteShaderVariables(stream, mState.mInputVaryings);
+    WriteShaderVariables(stream, mState.mOutputVaryings);
+    WriteShaderVariables(stream, mState.mUniforms);
+    WriteShInterfaceBlocks(stream, mState.mUniformBlocks);
+    WriteShInterfaceBlocks(stream, mState.mShaderStorageBlocks);
+    WriteShaderVariables(stream, mState.mAllAttributes);
+    WriteShaderVariables(stream, mState.mActiveAttributes);
+    WriteShaderVariables(stream, mState.mActiveOutputVariables);
+
+    stream->writeBool(mState.mEnablesPerSampleShading);
+    stream->writeInt(mState.mAdvancedBlendEquations.bits());
+    stream->writeInt(mState.mSpecConstUsageBits.bits());
+    stream->writeInt(mState.mNumViews);
+
+    WriteOptional(stream, mState.mGeometryShaderInputPrimitiveType);
+    WriteOptional(stream, mState.mGeometryShaderOutputPrimitiveType);
+    WriteOptional(stream, mState.mGeometryShaderMaxVertices);
+    stream->writeInt(mState.mGeometryShaderInvocations);
+
+    stream->writeInt(mState.mTessControlShaderVertices);
+    stream->writeInt(mState.mTessGenMode);
+    stream->writeInt(mState.mTessGenSpacing);
+    stream->writeInt(mState.mTessGenVertexOrder);
+    stream->writeInt(mState.mTessGenPointMode);
+}
+
+bool Shader::deserialize(BinaryInputStream *stream)
+{
+    stream->readString(&mInfoLog);
+    mState.mShaderVersion = stream->readInt<int>();
+    stream->readString(&mState.mTranslatedSource);
+    stream->readIntVector<uint32_t>(&mState.mCompiledBinary);
+
+    for (size_t index = 0; index < mState.mLocalSize.size(); ++index)
+    {
+        mState.mLocalSize[index] = stream->readInt<int>();
+    }
+
+    LoadShaderVariables(stream, &mState.mInputVaryings);
+    LoadShaderVariables(stream, &mState.mOutputVaryings);
+    LoadShaderVariables(stream, &mState.mUniforms);
+    LoadShInterfaceBlocks(stream, &mState.mUniformBlocks);
+    LoadShInterfaceBlocks(stream, &mState.mShaderStorageBlocks);
+    LoadShaderVariables(stream, &mState.mAllAttributes);
+    LoadShaderVariables(stream, &mState.mActiveAttributes);
+    LoadShaderVariables(stream, &mState.mActiveOutputVariables);
+
+    mState.mEnablesPerSampleShading = stream->readBool();
+    mState.mAdvancedBlendEquations =
+        BlendEquationBitSet(stream->readInt<BlendEquationBitSet::value_type>());
+    mState.mSpecConstUsageBits =
+        rx::SpecConstUsageBits(stream->readInt<rx::SpecConstUsageBits::value_type>());
+    mState.mNumViews = stream->readInt<int>();
+
+    LoadOptional(stream, &mState.mGeometryShaderInputPrimitiveType);
+    LoadOptional(stream, &mState.mGeometryShaderOutputPrimitiveType);
+    LoadOptional(stream, &mState.mGeometryShaderMaxVertices);
+    mState.mGeometryShaderInvocations = stream->readInt<int>();
+
+    mState.mTessControlShaderVertices = stream->readInt<int>();
+    mState.mTessGenMode               = stream->readInt<GLenum>();
+    mState.mTessGenSpacing            = stream->readInt<GLenum>();
+    mState.mTessGenVertexOrder        = stream->readInt<GLenum>();
+    mState.mTessGenPointMode          = stream->readInt<GLenum>();
+
+    if (stream->error() || !stream->endOfStream())
+    {
+        resetCompiledState();
+        return false;
+    }
+
+    return true;
 }
 
 void Shader::addRef()
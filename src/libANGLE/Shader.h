@@ -13,6 +13,7 @@
 #define LIBANGLE_SHADER_H_
 
 #include <list>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -22,6 +23,7 @@
 
 #include "common/Optional.h"
 #include "common/angleutils.h"
+#include "compiler/translator/blocklayout.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Compiler.h"
 #include "libANGLE/Debug.h"
@@ -43,6 +45,8 @@ class WorkerThreadPool;
 
 namespace gl
 {
+class BinaryInputStream;
+class BinaryOutputStream;
 class CompileTask;
 class Context;
 class ShaderProgramManager;
@@ -158,6 +162,14 @@ class ShaderState final : angle::NonCopyable
     CompileStatus mCompileStatus;
 };
 
+// The layout of an interface block, as computed by the block layout encoder of the backend.
+struct InterfaceBlockLayout
+{
+    size_t dataSize;
+    sh::BlockLayoutMap memberLayout;
+};
+using InterfaceBlockLayoutMap = std::map<std::string, InterfaceBlockLayout>;
+
 class Shader final : angle::NonCopyable, public LabeledObject
 {
   public:
@@ -215,6 +227,15 @@ class Shader final : angle::NonCopyable, public LabeledObject
     const std::vector<sh::ShaderVariable> &getAllAttributes();
     const std::vector<sh::ShaderVariable> &getActiveOutputVariables();
 
+    // The layout of the interface blocks, keyed by block name, is filled by the linker the first
+    // time the shader is linked.  It only depends on the declaration of the blocks and on the
+    // backend, so it's reused by every program the shader is linked in until it's recompiled.
+    InterfaceBlockLayoutMap *getUniformBlockLayoutCache() { return &mUniformBlockLayoutCache; }
+    InterfaceBlockLayoutMap *getShaderStorageBlockLayoutCache()
+    {
+        return &mShaderStorageBlockLayoutCache;
+    }
+
     // Returns mapped name of a transform feedback varying. The original name may contain array
     // brackets with an index inside, which will get copied to the mapped name. The varying must be
     // known to be declared in the shader.
@@ -249,9 +270,17 @@ class Shader final : angle::NonCopyable, public LabeledObject
     void resolveCompile();
 
   private:
+    friend class MemoryShaderCache;
     struct CompilingState;
 
     ~Shader() override;
+
+    void resetCompiledState();
+
+    // Saves and restores the results of a successful compilation, for the shader cache.
+    void serialize(BinaryOutputStream *stream) const;
+    bool deserialize(BinaryInputStream *stream);
+
     static void GetSourceImpl(const std::string &source,
                               GLsizei bufSize,
                               GLsizei *length,
@@ -271,6 +300,9 @@ class Shader final : angle::NonCopyable, public LabeledObject
     std::unique_ptr<CompilingState> mCompilingState;
     std::string mCompilerResourcesString;
 
+    InterfaceBlockLayoutMap mUniformBlockLayoutCache;
+    InterfaceBlockLayoutMap mShaderStorageBlockLayoutCache;
+
     ShaderProgramManager *mResourceManager;
 
     GLuint mCurrentMaxComputeWorkGroupInvocations;
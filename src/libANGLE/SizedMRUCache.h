@@ -67,6 +67,37 @@ class SizedMRUCache final : angle::NonCopyable
         return false;
     }
 
+    // Removes the entry for |key| from the cache, moving its value to |valueOut|.
+    bool take(const Key &key, Value *valueOut, size_t *sizeOut)
+    {
+        auto existing = mStore.Peek(key);
+        if (existing == mStore.end())
+        {
+            return false;
+        }
+        *valueOut = std::move(existing->second.value);
+        *sizeOut  = existing->second.size;
+        mCurrentSize -= existing->second.size;
+        mStore.Erase(existing);
+        return true;
+    }
+
+    // Removes the least recently used entry from the cache, moving it to the out parameters.
+    bool takeLeastRecentlyUsed(Key *keyOut, Value *valueOut, size_t *sizeOut)
+    {
+        if (mStore.empty())
+        {
+            return false;
+        }
+        auto iter = mStore.rbegin();
+        *keyOut   = iter->first;
+        *valueOut = std::move(iter->second.value);
+        *sizeOut  = iter->second.size;
+        mCurrentSize -= iter->second.size;
+        mStore.Erase(iter);
+        return true;
+    }
+
     bool empty() const { return mStore.empty(); }
 
     void clear()
@@ -107,4 +107,41 @@ TEST(SizedMRUCacheTest, OversizeValue)
     EXPECT_FALSE(sizedCache.put(5, 5, 100));
 }
 
+// Tests taking elements out of the cache.
+TEST(SizedMRUCacheTest, Take)
+{
+    constexpr size_t kSize = 32;
+    SizedMRUCache<size_t, size_t> sizedCache(kSize);
+
+    for (size_t value = 0; value < 4; ++value)
+    {
+        size_t valueCopy = value;
+        EXPECT_TRUE(sizedCache.put(value, std::move(valueCopy), value + 1));
+    }
+    EXPECT_EQ(10u, sizedCache.size());
+
+    size_t taken     = 0;
+    size_t takenSize = 0;
+    EXPECT_TRUE(sizedCache.take(2, &taken, &takenSize));
+    EXPECT_EQ(2u, taken);
+    EXPECT_EQ(3u, takenSize);
+    EXPECT_EQ(7u, sizedCache.size());
+    EXPECT_FALSE(sizedCache.take(2, &taken, &takenSize));
+
+    // Refresh 0, so 1 becomes the least recently used element.
+    const size_t *result = nullptr;
+    EXPECT_TRUE(sizedCache.get(0, &result));
+
+    size_t takenKey = 0;
+    EXPECT_TRUE(sizedCache.takeLeastRecentlyUsed(&takenKey, &taken, &takenSize));
+    EXPECT_EQ(1u, takenKey);
+    EXPECT_EQ(1u, taken);
+    EXPECT_EQ(2u, takenSize);
+    EXPECT_EQ(5u, sizedCache.size());
+    EXPECT_EQ(2u, sizedCache.entryCount());
+
+    sizedCache.clear();
+    EXPECT_FALSE(sizedCache.takeLeastRecentlyUsed(&takenKey, &taken, &takenSize));
+}
+
 }  // namespace angle
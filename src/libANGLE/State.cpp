@@ -656,6 +656,7 @@ ANGLE_INLINE void State::unsetActiveTextures(const ActiveTextureMask &textureMas
         mActiveTexturesCache.reset(textureIndex);
         mCompleteTextureBindings[textureIndex].reset();
     }
+    mDirtyTextureBindingUnits |= textureMask;
 }
 
 ANGLE_INLINE void State::updateActiveTextureStateOnSync(const Context *context,
@@ -673,6 +674,7 @@ ANGLE_INLINE void State::updateActiveTextureStateOnSync(const Context *context,
     }
 
     mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+    mDirtyTextureBindingUnits.set(textureIndex);
 }
 
 ANGLE_INLINE void State::setActiveTextureDirty(size_t textureIndex, Texture *texture)
@@ -727,6 +729,7 @@ ANGLE_INLINE void State::updateTextureBinding(const Context *context,
 {
     mCompleteTextureBindings[textureIndex].bind(texture);
     mActiveTexturesCache.reset(textureIndex);
+    mDirtyTextureBindingUnits.set(textureIndex);
     setActiveTextureDirty(textureIndex, texture);
 }
 
@@ -1722,6 +1725,7 @@ void State::initializeZeroTextures(const Context *context, const TextureMap &zer
 void State::invalidateTextureBindings(TextureType type)
 {
     mDirtyBits.set(DIRTY_BIT_TEXTURE_BINDINGS);
+    mDirtyTextureBindingUnits.set();
 }
 
 void State::setSamplerBinding(const Context *context, GLuint textureUnit, Sampler *sampler)
@@ -3748,6 +3752,13 @@ AttributesMask State::getAndResetDirtyCurrentValues() const
     return retVal;
 }
 
+ActiveTextureMask State::getAndResetDirtyTextureBindingUnits() const
+{
+    ActiveTextureMask retVal = mDirtyTextureBindingUnits;
+    mDirtyTextureBindingUnits.reset();
+    return retVal;
+}
+
 State::ExtendedDirtyBits State::getAndResetExtendedDirtyBits() const
 {
     ExtendedDirtyBits retVal = mExtendedDirtyBits;
@@ -722,6 +722,7 @@ class State : angle::NonCopyable
     {
         mDirtyBits.set();
         mDirtyCurrentValues.set();
+        mDirtyTextureBindingUnits.set();
     }
 
     using ExtendedDirtyBits = angle::BitSet32<EXTENDED_DIRTY_BIT_MAX>;
@@ -757,6 +758,10 @@ class State : angle::NonCopyable
     // TODO(jmadill): Pass mutable dirty bits into Impl.
     AttributesMask getAndResetDirtyCurrentValues() const;
 
+    // Returns the texture units whose entry in the active textures cache may have changed since
+    // the last call, and clears them.  DIRTY_BIT_TEXTURE_BINDINGS is set whenever a unit is added.
+    ActiveTextureMask getAndResetDirtyTextureBindingUnits() const;
+
     void setImageUnit(const Context *context,
                       size_t unit,
                       Texture *texture,
@@ -1135,6 +1140,7 @@ class State : angle::NonCopyable
     mutable ExtendedDirtyBits mExtendedDirtyBits;
     DirtyObjects mDirtyObjects;
     mutable AttributesMask mDirtyCurrentValues;
+    mutable ActiveTextureMask mDirtyTextureBindingUnits;
     ActiveTextureMask mDirtyActiveTextures;
     ActiveTextureMask mDirtyTextures;
     ActiveTextureMask mDirtySamplers;
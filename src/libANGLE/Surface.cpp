@@ -648,6 +648,11 @@ Error Surface::getBufferAge(const gl::Context *context, EGLint *age)
     return err;
 }
 
+EGLint Surface::getPresentLatency() const
+{
+    return mImplementation->getPresentLatency();
+}
+
 gl::InitState Surface::initState(GLenum binding, const gl::ImageIndex & /*imageIndex*/) const
 {
     switch (binding)
@@ -865,6 +870,7 @@ WindowSurface::WindowSurface(rx::EGLImplFactory *implFactory,
 
 void Surface::setDamageRegion(const EGLint *rects, EGLint n_rects)
 {
+    mImplementation->setDamageRegion(rects, n_rects);
     mIsDamageRegionSet = true;
 }
 
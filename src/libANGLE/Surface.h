@@ -206,6 +206,9 @@ class Surface : public LabeledObject, public gl::FramebufferAttachmentObject
 
     Error getBufferAge(const gl::Context *context, EGLint *age);
 
+    // EGL_ANGLE_low_latency_present
+    EGLint getPresentLatency() const;
+
     Error setRenderBuffer(EGLint renderBuffer);
 
     bool bufferAgeQueriedSinceLastSwap() const { return mBufferAgeQueriedSinceLastSwap; }
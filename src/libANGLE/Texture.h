@@ -14,6 +14,7 @@
 
 #include "angle_gl.h"
 #include "common/Optional.h"
+#include "common/SlabAllocator.h"
 #include "common/debug.h"
 #include "common/utilities.h"
 #include "libANGLE/Caps.h"
@@ -260,7 +261,8 @@ bool operator!=(const TextureState &a, const TextureState &b);
 
 class Texture final : public RefCountObject<TextureID>,
                       public egl::ImageSibling,
-                      public LabeledObject
+                      public LabeledObject,
+                      public angle::SlabAllocated
 {
   public:
     Texture(rx::GLImplFactory *factory, TextureID id, TextureType type);
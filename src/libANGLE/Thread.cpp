@@ -15,7 +15,9 @@
 
 namespace angle
 {
+#if !defined(ANGLE_ANDROID_ALWAYS_USE_GL_TLS_SLOT)
 bool gUseAndroidOpenGLTlsSlot;
+#endif
 std::atomic_int gProcessCleanupRefCount(0);
 
 void ProcessCleanupCallback(void *ptr)
@@ -17,7 +17,11 @@
 
 namespace angle
 {
+#if defined(ANGLE_ANDROID_ALWAYS_USE_GL_TLS_SLOT)
+constexpr bool gUseAndroidOpenGLTlsSlot = true;
+#else
 extern bool gUseAndroidOpenGLTlsSlot;
+#endif
 extern std::atomic_int gProcessCleanupRefCount;
 
 void ProcessCleanupCallback(void *ptr);
@@ -450,6 +450,51 @@ bool VaryingPacking::packVaryingIntoRegisterMap(PackMode packMode,
     return false;
 }
 
+// Packs a vec2 into the upper half of a row whose lower half holds another vec2 that is
+// interpolated the same way, so that both share a single location.  Returns false if the varying is
+// not a single vec2 outside of a struct, or there is no such row.
+bool VaryingPacking::packVec2IntoSharedRegister(const PackedVarying &packedVarying)
+{
+    const sh::ShaderVariable &varying = packedVarying.varying();
+    ASSERT(!varying.isStruct());
+
+    auto isSingleVec2 = [](const PackedVarying &candidate) {
+        const sh::ShaderVariable &candidateVarying = candidate.varying();
+        return !candidate.isStructField() && !gl::IsMatrixType(candidateVarying.type) &&
+               gl::VariableColumnCount(candidateVarying.type) == 2 &&
+               (candidate.isTransformFeedbackArrayElement() ||
+                candidate.getBasicTypeElementCount() == 1);
+    };
+
+    if (!isSingleVec2(packedVarying))
+    {
+        return false;
+    }
+
+    const GLenum componentType = gl::VariableComponentType(varying.type);
+
+    for (const PackedVaryingRegister &registerInfo : mRegisterList)
+    {
+        const unsigned int row = registerInfo.registerRow;
+        if (registerInfo.registerColumn != 0 || !isRegisterRangeFree(row, 2, 1, 2))
+        {
+            continue;
+        }
+
+        const PackedVarying &occupant = *registerInfo.packedVarying;
+        if (!isSingleVec2(occupant) || occupant.interpolation != packedVarying.interpolation ||
+            gl::VariableComponentType(occupant.varying().type) != componentType)
+        {
+            continue;
+        }
+
+        insertVaryingIntoRegisterMap(row, 2, 2, packedVarying);
+        return true;
+    }
+
+    return false;
+}
+
 bool VaryingPacking::isRegisterRangeFree(unsigned int registerRow,
                                          unsigned int registerColumn,
                                          unsigned int varyingRows,
@@ -861,8 +906,15 @@ bool VaryingPacking::collectAndPackUserVaryings(gl::InfoLog &infoLog,
         // When separable programs are linked, varyings at the separable program's boundary are
         // treated as active. See section 7.4.1 in
         // https://www.khronos.org/registry/OpenGL/specs/es/3.2/es_spec_3.2.pdf
-        bool matchedInputOutputStaticUse = (input && output && output->staticUse);
-        bool activeBuiltIn               = (isActiveBuiltInInput || isActiveBuiltInOutput);
+        //
+        // Varyings that the front stage declares but never writes don't need to be passed between
+        // stages either.  They are left inactive, and the back stage reads them as zero, which is
+        // what the front stage would have written if it initialized its outputs.
+        bool unwrittenVarying = (input && output && !input->staticUse && !input->isBuiltIn() &&
+                                 !input->isShaderIOBlock && !isSeparableProgram);
+        bool matchedInputOutputStaticUse =
+            (input && output && output->staticUse && !unwrittenVarying);
+        bool activeBuiltIn = (isActiveBuiltInInput || isActiveBuiltInOutput);
 
         // Output variable in TCS can be read as input in another invocation by barrier.
         // See section 11.2.1.2.4 Tessellation Control Shader Execution Order in OpenGL ES 3.2.
@@ -941,6 +993,55 @@ bool VaryingPacking::packUserVaryings(gl::InfoLog &infoLog,
                                       GLint maxVaryingVectors,
                                       PackMode packMode,
                                       const std::vector<PackedVarying> &packedVaryings)
+{
+    const PackedVarying *failedVarying =
+        packAllUserVaryings(maxVaryingVectors, packMode, false, packedVaryings);
+    if (failedVarying != nullptr)
+    {
+        ShaderType eitherStage = failedVarying->frontVarying.varying
+                                     ? failedVarying->frontVarying.stage
+                                     : failedVarying->backVarying.stage;
+        infoLog << "Could not pack varying " << failedVarying->fullName(eitherStage);
+
+        // TODO(jmadill): Implement more sophisticated component packing in D3D9.
+        if (packMode == PackMode::ANGLE_NON_CONFORMANT_D3D9)
+        {
+            infoLog << "Note: Additional non-conformant packing restrictions are enforced on "
+                       "D3D9.";
+        }
+
+        return false;
+    }
+
+    // The packing algorithm above decides whether the varyings fit, but it starts every vec2 on a
+    // new row while there are free rows, leaving the upper half of those locations unused.  Try
+    // again with vec2s sharing rows, which reduces the number of locations the backends declare
+    // and interpolate.  If that doesn't fit, e.g. because float arrays needed the free columns,
+    // keep the original packing.
+    if (packMode != PackMode::ANGLE_NON_CONFORMANT_D3D9)
+    {
+        std::vector<Register> registerMap               = mRegisterMap;
+        std::vector<PackedVaryingRegister> registerList = std::move(mRegisterList);
+        mRegisterList.clear();
+
+        if (packAllUserVaryings(maxVaryingVectors, packMode, true, packedVaryings) != nullptr)
+        {
+            mRegisterMap  = std::move(registerMap);
+            mRegisterList = std::move(registerList);
+        }
+    }
+
+    // Sort the packed register list
+    std::sort(mRegisterList.begin(), mRegisterList.end());
+
+    return true;
+}
+
+const PackedVarying *VaryingPacking::packAllUserVaryings(
+    GLint maxVaryingVectors,
+    PackMode packMode,
+    bool shareVec2Registers,
+    const std::vector<PackedVarying> &packedVaryings)
 {
     clearRegisterMap();
     mRegisterMap.resize(maxVaryingVectors);
@@ -949,28 +1050,18 @@ bool VaryingPacking::packUserVaryings(gl::InfoLog &infoLog,
     // subrectangle. No splitting of variables is permitted."
     for (const PackedVarying &packedVarying : packedVaryings)
     {
-        if (!packVaryingIntoRegisterMap(packMode, packedVarying))
+        if (shareVec2Registers && packVec2IntoSharedRegister(packedVarying))
         {
-            ShaderType eitherStage = packedVarying.frontVarying.varying
-                                         ? packedVarying.frontVarying.stage
-                                         : packedVarying.backVarying.stage;
-            infoLog << "Could not pack varying " << packedVarying.fullName(eitherStage);
-
-            // TODO(jmadill): Implement more sophisticated component packing in D3D9.
-            if (packMode == PackMode::ANGLE_NON_CONFORMANT_D3D9)
-            {
-                infoLog << "Note: Additional non-conformant packing restrictions are enforced on "
-                           "D3D9.";
-            }
+            continue;
+        }
 
-            return false;
+        if (!packVaryingIntoRegisterMap(packMode, packedVarying))
+        {
+            return &packedVarying;
         }
     }
 
-    // Sort the packed register list
-    std::sort(mRegisterList.begin(), mRegisterList.end());
-
-    return true;
+    return nullptr;
 }
 
 // ProgramVaryingPacking implementation.
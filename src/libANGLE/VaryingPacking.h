@@ -259,7 +259,13 @@ class VaryingPacking final : angle::NonCopyable
                           GLint maxVaryingVectors,
                           PackMode packMode,
                           const std::vector<PackedVarying> &packedVaryings);
+    // Returns the varying that failed to pack, or nullptr if all varyings were packed.
+    const PackedVarying *packAllUserVaryings(GLint maxVaryingVectors,
+                                             PackMode packMode,
+                                             bool shareVec2Registers,
+                                             const std::vector<PackedVarying> &packedVaryings);
     bool packVaryingIntoRegisterMap(PackMode packMode, const PackedVarying &packedVarying);
+    bool packVec2IntoSharedRegister(const PackedVarying &packedVarying);
     bool isRegisterRangeFree(unsigned int registerRow,
                              unsigned int registerColumn,
                              unsigned int varyingRows,
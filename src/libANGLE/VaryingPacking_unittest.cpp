@@ -170,6 +170,71 @@ TEST_P(VaryingPackingTest, MaxPlusOneMat2VaryingsFailsWebGL)
     ASSERT_FALSE(packVaryingsStrict(kMaxVaryings, varyings));
 }
 
+// Varyings that the vertex shader doesn't write are not packed, and are left inactive in both
+// shaders.
+TEST_P(VaryingPackingTest, UnwrittenVaryingsAreNotPacked)
+{
+    std::vector<sh::ShaderVariable> outputs = MakeVaryings(GL_FLOAT_VEC4, kMaxVaryings + 1, 0);
+    std::vector<sh::ShaderVariable> inputs  = outputs;
+    for (size_t index = 1; index < outputs.size(); ++index)
+    {
+        outputs[index].staticUse = false;
+    }
+
+    ProgramMergedVaryings mergedVaryings;
+    for (size_t index = 0; index < outputs.size(); ++index)
+    {
+        ProgramVaryingRef ref;
+        ref.frontShader      = &outputs[index];
+        ref.backShader       = &inputs[index];
+        ref.frontShaderStage = ShaderType::Vertex;
+        ref.backShaderStage  = ShaderType::Fragment;
+        mergedVaryings.push_back(ref);
+    }
+
+    InfoLog infoLog;
+    VaryingPacking varyingPacking;
+    ASSERT_TRUE(varyingPacking.collectAndPackUserVaryings(
+        infoLog, kMaxVaryings, PackMode::ANGLE_RELAXED, ShaderType::Vertex, ShaderType::Fragment,
+        mergedVaryings, {}, false));
+
+    EXPECT_EQ(1u, varyingPacking.getRegisterList().size());
+    EXPECT_EQ(outputs.size() - 1,
+              varyingPacking.getInactiveVaryingMappedNames()[ShaderType::Vertex].size());
+    EXPECT_EQ(inputs.size() - 1,
+              varyingPacking.getInactiveVaryingMappedNames()[ShaderType::Fragment].size());
+}
+
+// Vec2 varyings with the same interpolation share locations, even while free rows remain.
+TEST_P(VaryingPackingTest, Vec2VaryingsShareRegisters)
+{
+    std::vector<sh::ShaderVariable> varyings = MakeVaryings(GL_FLOAT_VEC2, kMaxVaryings, 0);
+
+    ProgramMergedVaryings mergedVaryings;
+    for (const sh::ShaderVariable &varying : varyings)
+    {
+        ProgramVaryingRef ref;
+        ref.frontShader      = &varying;
+        ref.backShader       = &varying;
+        ref.frontShaderStage = ShaderType::Vertex;
+        ref.backShaderStage  = ShaderType::Fragment;
+        mergedVaryings.push_back(ref);
+    }
+
+    InfoLog infoLog;
+    VaryingPacking varyingPacking;
+    ASSERT_TRUE(varyingPacking.collectAndPackUserVaryings(
+        infoLog, kMaxVaryings, PackMode::ANGLE_RELAXED, ShaderType::Vertex, ShaderType::Fragment,
+        mergedVaryings, {}, false));
+
+    const std::vector<PackedVaryingRegister> &registers = varyingPacking.getRegisterList();
+    ASSERT_EQ(varyings.size(), registers.size());
+    for (const PackedVaryingRegister &registerInfo : registers)
+    {
+        EXPECT_LT(registerInfo.registerRow, (varyings.size() + 1) / 2);
+    }
+}
+
 // Makes separate tests for different values of kMaxVaryings.
 INSTANTIATE_TEST_SUITE_P(, VaryingPackingTest, ::testing::Values(1, 4, 8));
 
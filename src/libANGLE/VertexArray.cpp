@@ -274,6 +274,7 @@ ANGLE_INLINE void VertexArray::updateCachedBufferBindingSize(VertexBinding *bind
     if (!mBufferAccessValidationEnabled)
         return;
 
+    mVertexElementLimitsCache.invalidate();
     for (size_t boundAttribute : binding->getBoundAttributesMask())
     {
         mState.mVertexAttributes[boundAttribute].updateCachedElementLimit(*binding);
@@ -424,6 +425,7 @@ void VertexArray::setVertexAttribBinding(const Context *context,
     ASSERT(context->getClientVersion() >= ES_3_1);
 
     mState.setAttribBinding(context, attribIndex, bindingIndex);
+    mVertexElementLimitsCache.invalidate();
 
     setDirtyAttribBit(attribIndex, DIRTY_ATTRIB_BINDING);
 
@@ -447,6 +449,7 @@ void VertexArray::setVertexBindingDivisor(const Context *context,
 
     binding.setDivisor(divisor);
     setDirtyBindingBit(bindingIndex, DIRTY_BINDING_DIVISOR);
+    mVertexElementLimitsCache.invalidate();
 
     // Trigger updates in all bound attributes.
     if (context->isBufferAccessValidationEnabled())
@@ -495,6 +498,7 @@ void VertexArray::setVertexAttribFormat(size_t attribIndex,
     }
 
     attrib.updateCachedElementLimit(mState.mVertexBindings[attrib.bindingIndex]);
+    mVertexElementLimitsCache.invalidate();
 }
 
 void VertexArray::setVertexAttribDivisor(const Context *context, size_t attribIndex, GLuint divisor)
@@ -556,6 +560,10 @@ ANGLE_INLINE void VertexArray::setVertexAttribPointerImpl(const Context *context
     SetComponentTypeMask(componentType, attribIndex, &mState.mVertexAttributesTypeMask);
 
     bool attribDirty = setVertexAttribFormatImpl(&attrib, size, type, normalized, pureInteger, 0);
+    if (attribDirty)
+    {
+        mVertexElementLimitsCache.invalidate();
+    }
 
     if (attrib.bindingIndex != attribIndex)
     {
@@ -728,6 +736,15 @@ void VertexArray::setDependentDirtyBit(bool contentsChanged, angle::SubjectIndex
 {
     DirtyBitType dirtyBit = getDirtyBitFromIndex(contentsChanged, index);
     ASSERT(!mDirtyBitsGuard.valid() || mDirtyBitsGuard.value().test(dirtyBit));
+
+    // Repeated updates to a buffer's contents don't affect the context's cached state, so only the
+    // first one before the vertex array is synced needs to be forwarded.  Other changes may alter
+    // the buffer size and must always be forwarded.
+    if (contentsChanged && mDirtyBits.test(dirtyBit))
+    {
+        return;
+    }
+
     mDirtyBits.set(dirtyBit);
     onStateChange(angle::SubjectMessage::ContentsChanged);
 }
@@ -778,6 +795,37 @@ angle::Result VertexArray::getIndexRangeImpl(const Context *context,
     return angle::Result::Continue;
 }
 
+void VertexArray::getVertexElementLimitsImpl(const AttributesMask &attribsMask,
+                                             GLint64 *nonInstancedLimitOut,
+                                             GLint64 *instancedLimitOut) const
+{
+    ASSERT(mBufferAccessValidationEnabled);
+    ASSERT((attribsMask & mState.mClientMemoryAttribsMask).none());
+
+    GLint64 nonInstancedLimit = std::numeric_limits<GLint64>::max();
+    GLint64 instancedLimit    = std::numeric_limits<GLint64>::max();
+
+    for (size_t attribIndex : attribsMask)
+    {
+        const VertexAttribute &attrib = mState.mVertexAttributes[attribIndex];
+        const VertexBinding &binding  = mState.mVertexBindings[attrib.bindingIndex];
+
+        GLint64 limit = attrib.getCachedElementLimit();
+        if (binding.getDivisor() > 0)
+        {
+            instancedLimit = std::min(instancedLimit, limit);
+        }
+        else
+        {
+            nonInstancedLimit = std::min(nonInstancedLimit, limit);
+        }
+    }
+
+    mVertexElementLimitsCache.put(attribsMask, nonInstancedLimit, instancedLimit);
+    *nonInstancedLimitOut = nonInstancedLimit;
+    *instancedLimitOut    = instancedLimit;
+}
+
 VertexArray::IndexRangeCache::IndexRangeCache() = default;
 
 void VertexArray::IndexRangeCache::put(DrawElementsType type,
@@ -793,6 +841,20 @@ void VertexArray::IndexRangeCache::put(DrawElementsType type,
     mPayload       = indexRange;
 }
 
+VertexArray::VertexElementLimitsCache::VertexElementLimitsCache()
+    : mValid(false), mNonInstancedLimit(0), mInstancedLimit(0)
+{}
+
+void VertexArray::VertexElementLimitsCache::put(const AttributesMask &attribsMask,
+                                                GLint64 nonInstancedLimit,
+                                                GLint64 instancedLimit)
+{
+    mValid             = true;
+    mAttribsMaskKey    = attribsMask;
+    mNonInstancedLimit = nonInstancedLimit;
+    mInstancedLimit    = instancedLimit;
+}
+
 void VertexArray::onBufferContentsChange(uint32_t bufferIndex)
 {
     setDependentDirtyBit(true, bufferIndex);
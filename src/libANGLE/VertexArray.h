@@ -307,6 +307,19 @@ class VertexArray final : public angle::ObserverInterface,
         return getIndexRangeImpl(context, type, indexCount, indices, indexRangeOut);
     }
 
+    // Get the vertex element limits of the given attributes, which must be sourced from buffers.
+    // The limits are cached until the format, binding or buffer of an attribute changes, so that
+    // binding the vertex array again doesn't walk its attributes.
+    ANGLE_INLINE void getVertexElementLimits(const AttributesMask &attribsMask,
+                                             GLint64 *nonInstancedLimitOut,
+                                             GLint64 *instancedLimitOut) const
+    {
+        if (!mVertexElementLimitsCache.get(attribsMask, nonInstancedLimitOut, instancedLimitOut))
+        {
+            getVertexElementLimitsImpl(attribsMask, nonInstancedLimitOut, instancedLimitOut);
+        }
+    }
+
     void setBufferAccessValidationEnabled(bool enabled)
     {
         mBufferAccessValidationEnabled = enabled;
@@ -339,6 +352,9 @@ class VertexArray final : public angle::ObserverInterface,
                                     GLsizei indexCount,
                                     const void *indices,
                                     IndexRange *indexRangeOut) const;
+    void getVertexElementLimitsImpl(const AttributesMask &attribsMask,
+                                    GLint64 *nonInstancedLimitOut,
+                                    GLint64 *instancedLimitOut) const;
 
     void setVertexAttribPointerImpl(const Context *context,
                                     ComponentType componentType,
@@ -413,6 +429,40 @@ class VertexArray final : public angle::ObserverInterface,
     };
 
     mutable IndexRangeCache mIndexRangeCache;
+
+    class VertexElementLimitsCache final : angle::NonCopyable
+    {
+      public:
+        VertexElementLimitsCache();
+
+        void invalidate() { mValid = false; }
+
+        bool get(const AttributesMask &attribsMask,
+                 GLint64 *nonInstancedLimitOut,
+                 GLint64 *instancedLimitOut) const
+        {
+            if (mValid && mAttribsMaskKey == attribsMask)
+            {
+                *nonInstancedLimitOut = mNonInstancedLimit;
+                *instancedLimitOut    = mInstancedLimit;
+                return true;
+            }
+
+            return false;
+        }
+
+        void put(const AttributesMask &attribsMask,
+                 GLint64 nonInstancedLimit,
+                 GLint64 instancedLimit);
+
+      private:
+        bool mValid;
+        AttributesMask mAttribsMaskKey;
+        GLint64 mNonInstancedLimit;
+        GLint64 mInstancedLimit;
+    };
+
+    mutable VertexElementLimitsCache mVertexElementLimitsCache;
     bool mBufferAccessValidationEnabled;
     VertexArrayBufferContentsObservers mContentsObservers;
 };
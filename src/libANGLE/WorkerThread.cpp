@@ -10,13 +10,15 @@
 
 #include "libANGLE/WorkerThread.h"
 
+#include "common/PackedEnums.h"
 #include "libANGLE/trace.h"
 
 #if (ANGLE_DELEGATE_WORKERS == ANGLE_ENABLED) || (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+#    include <algorithm>
 #    include <condition_variable>
+#    include <deque>
 #    include <future>
 #    include <mutex>
-#    include <queue>
 #    include <thread>
 #endif  // (ANGLE_DELEGATE_WORKERS == ANGLE_ENABLED) || (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
 
@@ -56,14 +58,16 @@ bool SingleThreadedWaitableEvent::isReady()
 class SingleThreadedWorkerPool final : public WorkerThreadPool
 {
   public:
-    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                  WorkerTaskPriority priority) override;
     void setMaxThreads(size_t maxThreads) override;
     bool isAsync() override;
 };
 
 // SingleThreadedWorkerPool implementation.
 std::shared_ptr<WaitableEvent> SingleThreadedWorkerPool::postWorkerTask(
-    std::shared_ptr<Closure> task)
+    std::shared_ptr<Closure> task,
+    WorkerTaskPriority priority)
 {
     (*task)();
     return std::make_shared<SingleThreadedWaitableEvent>();
@@ -77,10 +81,14 @@ bool SingleThreadedWorkerPool::isAsync()
 }
 
 #if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+class AsyncWorkerPool;
+
 class AsyncWaitableEvent final : public WaitableEvent
 {
   public:
-    AsyncWaitableEvent() : mIsPending(true) {}
+    AsyncWaitableEvent(AsyncWorkerPool *pool, bool canRunInline)
+        : mPool(pool), mCanRunInline(canRunInline), mIsPending(true)
+    {}
     ~AsyncWaitableEvent() override = default;
 
     void wait() override;
@@ -90,6 +98,10 @@ class AsyncWaitableEvent final : public WaitableEvent
     friend class AsyncWorkerPool;
     void setFuture(std::future<void> &&future);
 
+    // The pool outlives the event, which holds a reference to it.
+    AsyncWorkerPool *mPool;
+    const bool mCanRunInline;
+
     // To block wait() when the task is still in queue to be run.
     // Also to protect the concurrent accesses from both main thread and
     // background threads to the member fields.
@@ -97,6 +109,7 @@ class AsyncWaitableEvent final : public WaitableEvent
 
     bool mIsPending;
     std::condition_variable mCondition;
+    // Not valid if the task was run inline by wait().
     std::future<void> mFuture;
 };
 
@@ -105,18 +118,6 @@ void AsyncWaitableEvent::setFuture(std::future<void> &&future)
     mFuture = std::move(future);
 }
 
-void AsyncWaitableEvent::wait()
-{
-    ANGLE_TRACE_EVENT0("gpu.angle", "AsyncWaitableEvent::wait");
-    {
-        std::unique_lock<std::mutex> lock(mMutex);
-        mCondition.wait(lock, [this] { return !mIsPending; });
-    }
-
-    ASSERT(mFuture.valid());
-    mFuture.wait();
-}
-
 bool AsyncWaitableEvent::isReady()
 {
     std::lock_guard<std::mutex> lock(mMutex);
@@ -124,7 +125,11 @@ bool AsyncWaitableEvent::isReady()
     {
         return false;
     }
-    ASSERT(mFuture.valid());
+    if (!mFuture.valid())
+    {
+        // The task was run inline by wait().
+        return true;
+    }
     return mFuture.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
 }
 
@@ -134,11 +139,18 @@ class AsyncWorkerPool final : public WorkerThreadPool
     AsyncWorkerPool(size_t maxThreads) : mMaxThreads(maxThreads), mRunningThreads(0) {}
     ~AsyncWorkerPool() override = default;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                  WorkerTaskPriority priority) override;
     void setMaxThreads(size_t maxThreads) override;
     bool isAsync() override;
 
+    // If the task of |waitable| hasn't been started yet, takes it out of the queue and runs it on
+    // the calling thread.  Returns false if the task was already started.
+    bool runPendingTaskInline(AsyncWaitableEvent *waitable);
+
   private:
+    using PendingTask = std::pair<std::shared_ptr<AsyncWaitableEvent>, std::shared_ptr<Closure>>;
+
     void checkToRunPendingTasks();
 
     // To protect the concurrent accesses from both main thread and background
@@ -147,18 +159,42 @@ class AsyncWorkerPool final : public WorkerThreadPool
 
     size_t mMaxThreads;
     size_t mRunningThreads;
-    std::queue<std::pair<std::shared_ptr<AsyncWaitableEvent>, std::shared_ptr<Closure>>> mTaskQueue;
+    angle::PackedEnumMap<WorkerTaskPriority, std::deque<PendingTask>> mTaskQueues;
 };
 
+void AsyncWaitableEvent::wait()
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "AsyncWaitableEvent::wait");
+
+    // Don't wait for a worker thread to become available for a task that is blocking this thread.
+    if (mCanRunInline && mPool->runPendingTaskInline(this))
+    {
+        return;
+    }
+
+    {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return !mIsPending; });
+    }
+
+    if (mFuture.valid())
+    {
+        mFuture.wait();
+    }
+}
+
 // AsyncWorkerPool implementation.
-std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(std::shared_ptr<Closure> task)
+std::shared_ptr<WaitableEvent> AsyncWorkerPool::postWorkerTask(std::shared_ptr<Closure> task,
+                                                               WorkerTaskPriority priority)
 {
     ASSERT(mMaxThreads > 0);
 
-    auto waitable = std::make_shared<AsyncWaitableEvent>();
+    // Low priority tasks are background work that may take locks held by the waiting thread, so
+    // they are always run on a worker thread.
+    auto waitable = std::make_shared<AsyncWaitableEvent>(this, priority != WorkerTaskPriority::Low);
     {
         std::lock_guard<std::mutex> lock(mMutex);
-        mTaskQueue.push(std::make_pair(waitable, task));
+        mTaskQueues[priority].push_back(std::make_pair(waitable, task));
     }
     checkToRunPendingTasks();
     return std::move(waitable);
@@ -178,13 +214,59 @@ bool AsyncWorkerPool::isAsync()
     return true;
 }
 
+bool AsyncWorkerPool::runPendingTaskInline(AsyncWaitableEvent *waitable)
+{
+    std::shared_ptr<Closure> closure;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        for (std::deque<PendingTask> &taskQueue : mTaskQueues)
+        {
+            auto iter = std::find_if(
+                taskQueue.begin(), taskQueue.end(),
+                [waitable](const PendingTask &task) { return task.first.get() == waitable; });
+            if (iter != taskQueue.end())
+            {
+                closure = std::move(iter->second);
+                taskQueue.erase(iter);
+                break;
+            }
+        }
+    }
+
+    if (!closure)
+    {
+        return false;
+    }
+
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "AsyncWorkerPool::RunTaskInline");
+        (*closure)();
+    }
+
+    {
+        std::lock_guard<std::mutex> waitableLock(waitable->mMutex);
+        waitable->mIsPending = false;
+    }
+    waitable->mCondition.notify_all();
+    return true;
+}
+
 void AsyncWorkerPool::checkToRunPendingTasks()
 {
     std::lock_guard<std::mutex> lock(mMutex);
-    while (mRunningThreads < mMaxThreads && !mTaskQueue.empty())
+    while (mRunningThreads < mMaxThreads)
     {
-        auto task = mTaskQueue.front();
-        mTaskQueue.pop();
+        // Start the tasks in order of priority, and in the order they were posted within each.
+        auto taskQueue = std::find_if(
+            mTaskQueues.begin(), mTaskQueues.end(),
+            [](const std::deque<PendingTask> &queue) { return !queue.empty(); });
+        if (taskQueue == mTaskQueues.end())
+        {
+            break;
+        }
+
+        auto task = taskQueue->front();
+        taskQueue->pop_front();
         auto waitable = task.first;
         auto closure  = task.second;
 
@@ -259,7 +341,8 @@ class DelegateWorkerPool final : public WorkerThreadPool
     DelegateWorkerPool()           = default;
     ~DelegateWorkerPool() override = default;
 
-    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) override;
+    std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                  WorkerTaskPriority priority) override;
 
     void setMaxThreads(size_t maxThreads) override;
     bool isAsync() override;
@@ -294,7 +377,9 @@ class DelegateWorkerTask
     std::shared_ptr<DelegateWaitableEvent> mWaitable;
 };
 
-std::shared_ptr<WaitableEvent> DelegateWorkerPool::postWorkerTask(std::shared_ptr<Closure> task)
+// The platform has no notion of priority, so the tasks are posted in order.
+std::shared_ptr<WaitableEvent> DelegateWorkerPool::postWorkerTask(std::shared_ptr<Closure> task,
+                                                                  WorkerTaskPriority priority)
 {
     auto waitable = std::make_shared<DelegateWaitableEvent>();
 
@@ -343,9 +428,10 @@ std::shared_ptr<WorkerThreadPool> WorkerThreadPool::Create(bool multithreaded)
 // static
 std::shared_ptr<WaitableEvent> WorkerThreadPool::PostWorkerTask(
     std::shared_ptr<WorkerThreadPool> pool,
-    std::shared_ptr<Closure> task)
+    std::shared_ptr<Closure> task,
+    WorkerTaskPriority priority)
 {
-    std::shared_ptr<WaitableEvent> event = pool->postWorkerTask(task);
+    std::shared_ptr<WaitableEvent> event = pool->postWorkerTask(task, priority);
     if (event.get())
     {
         event->setWorkerThreadPool(pool);
@@ -23,6 +23,18 @@ namespace angle
 
 class WorkerThreadPool;
 
+// The order in which the pending tasks of a pool are started.  Tasks that are about to be waited on
+// should be High, and background work that nothing blocks on should be Low.
+enum class WorkerTaskPriority
+{
+    High,
+    Normal,
+    Low,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
 // A callback function with no return value and no arguments.
 class Closure
 {
@@ -38,7 +50,8 @@ class WaitableEvent : angle::NonCopyable
     WaitableEvent();
     virtual ~WaitableEvent();
 
-    // Waits indefinitely for the event to be signaled.
+    // Waits indefinitely for the event to be signaled.  If the task hasn't been started by the
+    // pool yet and isn't Low priority, it may be run on the waiting thread instead.
     virtual void wait() = 0;
 
     // Peeks whether the event is ready. If ready, wait() will not block.
@@ -76,8 +89,10 @@ class WorkerThreadPool : angle::NonCopyable
     virtual ~WorkerThreadPool();
 
     static std::shared_ptr<WorkerThreadPool> Create(bool multithreaded);
-    static std::shared_ptr<WaitableEvent> PostWorkerTask(std::shared_ptr<WorkerThreadPool> pool,
-                                                         std::shared_ptr<Closure> task);
+    static std::shared_ptr<WaitableEvent> PostWorkerTask(
+        std::shared_ptr<WorkerThreadPool> pool,
+        std::shared_ptr<Closure> task,
+        WorkerTaskPriority priority = WorkerTaskPriority::Normal);
 
     virtual void setMaxThreads(size_t maxThreads) = 0;
 
@@ -86,7 +101,8 @@ class WorkerThreadPool : angle::NonCopyable
   private:
     // Returns an event to wait on for the task to finish.
     // If the pool fails to create the task, returns null.
-    virtual std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task) = 0;
+    virtual std::shared_ptr<WaitableEvent> postWorkerTask(std::shared_ptr<Closure> task,
+                                                          WorkerTaskPriority priority) = 0;
 };
 
 }  // namespace angle
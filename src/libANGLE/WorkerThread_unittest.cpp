@@ -8,6 +8,8 @@
 
 #include <gtest/gtest.h>
 #include <array>
+#include <condition_variable>
+#include <mutex>
 
 #include "libANGLE/WorkerThread.h"
 
@@ -49,4 +51,64 @@ TEST(WorkerPoolTest, SimpleTask)
     }
 }
 
+#if (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+// Tests that waiting on a task that no worker thread has started yet runs it on the waiting
+// thread.
+TEST(WorkerPoolTest, WaitRunsPendingTaskInline)
+{
+    class BlockingTask : public Closure
+    {
+      public:
+        void operator()() override
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this] { return released; });
+        }
+
+        void release()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                released = true;
+            }
+            condition.notify_all();
+        }
+
+        std::mutex mutex;
+        std::condition_variable condition;
+        bool released = false;
+    };
+
+    class TestTask : public Closure
+    {
+      public:
+        void operator()() override { fired = true; }
+
+        bool fired = false;
+    };
+
+    std::shared_ptr<WorkerThreadPool> pool = WorkerThreadPool::Create(true);
+    if (!pool->isAsync())
+    {
+        return;
+    }
+    pool->setMaxThreads(1);
+
+    // Occupy the only worker thread, so the next task stays in the queue.
+    auto blockingTask = std::make_shared<BlockingTask>();
+    std::shared_ptr<WaitableEvent> blockingWaitable =
+        WorkerThreadPool::PostWorkerTask(pool, blockingTask);
+
+    auto task                               = std::make_shared<TestTask>();
+    std::shared_ptr<WaitableEvent> waitable = WorkerThreadPool::PostWorkerTask(pool, task);
+
+    waitable->wait();
+    EXPECT_TRUE(task->fired);
+    EXPECT_TRUE(waitable->isReady());
+
+    blockingTask->release();
+    blockingWaitable->wait();
+}
+#endif  // (ANGLE_STD_ASYNC_WORKERS == ANGLE_ENABLED)
+
 }  // anonymous namespace
@@ -432,7 +432,7 @@ void WriteStringParamReplay(ReplayWriter &replayWriter,
                             std::ostream &header,
                             const CallCapture &call,
                             const ParamCapture &param,
-                            std::vector<uint8_t> *binaryData)
+                            BinaryDataWriter *binaryData)
 {
     const std::vector<uint8_t> &data = param.data[0];
     // null terminate C style string
@@ -444,9 +444,8 @@ void WriteStringParamReplay(ReplayWriter &replayWriter,
     {
         // Store in binary file if the string is too long.
         // Round up to 16-byte boundary for cross ABI safety.
-        size_t offset = rx::roundUpPow2(binaryData->size(), kBinaryAlignment);
-        binaryData->resize(offset + str.size() + 1);
-        memcpy(binaryData->data() + offset, str.data(), str.size() + 1);
+        size_t offset =
+            binaryData->append(reinterpret_cast<const uint8_t *>(str.c_str()), str.size() + 1);
         out << "reinterpret_cast<const char *>(&gBinaryData[" << offset << "])";
     }
     else if (str.find('\n') != std::string::npos)
@@ -556,7 +555,7 @@ void WriteBinaryParamReplay(ReplayWriter &replayWriter,
                             std::ostream &header,
                             const CallCapture &call,
                             const ParamCapture &param,
-                            std::vector<uint8_t> *binaryData)
+                            BinaryDataWriter *binaryData)
 {
     std::string varName = replayWriter.getInlineVariableName(call.entryPoint, param.name);
 
@@ -589,9 +588,7 @@ void WriteBinaryParamReplay(ReplayWriter &replayWriter,
     {
         // Store in binary file if data are not of type string or enum
         // Round up to 16-byte boundary for cross ABI safety
-        size_t offset = rx::roundUpPow2(binaryData->size(), kBinaryAlignment);
-        binaryData->resize(offset + data.size());
-        memcpy(binaryData->data() + offset, data.data(), data.size());
+        size_t offset = binaryData->append(data.data(), data.size());
         out << "reinterpret_cast<" << ParamTypeToString(overrideType) << ">(&gBinaryData[" << offset
             << "])";
     }
@@ -606,7 +603,7 @@ void WriteCppReplayForCall(const CallCapture &call,
                            ReplayWriter &replayWriter,
                            std::ostream &out,
                            std::ostream &header,
-                           std::vector<uint8_t> *binaryData)
+                           BinaryDataWriter *binaryData)
 {
     std::ostringstream callOut;
 
@@ -829,43 +826,6 @@ std::string GetBinaryDataFilePath(bool compression, const std::string &captureLa
     return fnameStream.str();
 }
 
-void SaveBinaryData(bool compression,
-                    const std::string &outDir,
-                    gl::ContextID contextId,
-                    const std::string &captureLabel,
-                    const std::vector<uint8_t> &binaryData)
-{
-    std::string binaryDataFileName = GetBinaryDataFilePath(compression, captureLabel);
-    std::string dataFilepath       = outDir + binaryDataFileName;
-
-    SaveFileHelper saveData(dataFilepath);
-
-    if (compression)
-    {
-        // Save compressed data.
-        uLong uncompressedSize       = static_cast<uLong>(binaryData.size());
-        uLong expectedCompressedSize = zlib_internal::GzipExpectedCompressedSize(uncompressedSize);
-
-        std::vector<uint8_t> compressedData(expectedCompressedSize, 0);
-
-        uLong compressedSize = expectedCompressedSize;
-        int zResult = zlib_internal::GzipCompressHelper(compressedData.data(), &compressedSize,
-                                                        binaryData.data(), uncompressedSize,
-                                                        nullptr, nullptr);
-
-        if (zResult != Z_OK)
-        {
-            FATAL() << "Error compressing binary data: " << zResult;
-        }
-
-        saveData.write(compressedData.data(), compressedSize);
-    }
-    else
-    {
-        saveData.write(binaryData.data(), binaryData.size());
-    }
-}
-
 void WriteInitReplayCall(bool compression,
                          std::ostream &out,
                          gl::ContextID contextId,
@@ -898,7 +858,7 @@ void MaybeResetResources(ResourceIDType resourceIDType,
                          std::stringstream &out,
                          std::stringstream &header,
                          ResourceTracker *resourceTracker,
-                         std::vector<uint8_t> *binaryData)
+                         BinaryDataWriter *binaryData)
 {
     // Local helper to get well structured blocks in Delete calls, i.e.
     // const GLuint deleteTextures[] = {
@@ -1250,7 +1210,7 @@ void MaybeResetFenceSyncObjects(std::stringstream &out,
                                 ReplayWriter &replayWriter,
                                 std::stringstream &header,
                                 ResourceTracker *resourceTracker,
-                                std::vector<uint8_t> *binaryData)
+                                BinaryDataWriter *binaryData)
 {
     FenceSyncCalls &fenceSyncRegenCalls = resourceTracker->getFenceSyncRegenCalls();
 
@@ -1272,7 +1232,7 @@ void MaybeResetOpaqueTypeObjects(ReplayWriter &replayWriter,
                                  std::stringstream &out,
                                  std::stringstream &header,
                                  ResourceTracker *resourceTracker,
-                                 std::vector<uint8_t> *binaryData)
+                                 BinaryDataWriter *binaryData)
 {
     MaybeResetFenceSyncObjects(out, replayWriter, header, resourceTracker, binaryData);
 }
@@ -1318,7 +1278,7 @@ void WriteCppReplayFunctionWithParts(const gl::ContextID contextID,
                                      ReplayFunc replayFunc,
                                      ReplayWriter &replayWriter,
                                      uint32_t frameIndex,
-                                     std::vector<uint8_t> *binaryData,
+                                     BinaryDataWriter *binaryData,
                                      const std::vector<CallCapture> &calls,
                                      std::stringstream &header,
                                      std::stringstream &out)
@@ -1384,7 +1344,7 @@ void WriteAuxiliaryContextCppSetupReplay(ReplayWriter &replayWriter,
                                          const std::string &captureLabel,
                                          uint32_t frameIndex,
                                          const std::vector<CallCapture> &setupCalls,
-                                         std::vector<uint8_t> *binaryData,
+                                         BinaryDataWriter *binaryData,
                                          bool serializeStateEnabled,
                                          const FrameCaptureShared &frameCaptureShared)
 {
@@ -1434,7 +1394,7 @@ void WriteShareGroupCppSetupReplay(ReplayWriter &replayWriter,
                                    uint32_t frameCount,
                                    const std::vector<CallCapture> &setupCalls,
                                    ResourceTracker *resourceTracker,
-                                   std::vector<uint8_t> *binaryData,
+                                   BinaryDataWriter *binaryData,
                                    bool serializeStateEnabled,
                                    gl::ContextID windowSurfaceContextID)
 {
@@ -2794,6 +2754,12 @@ void CaptureShareGroupMidExecutionSetup(const gl::Context *context,
     // Small helper function to make the code more readable.
     auto cap = [setupCalls](CallCapture &&call) { setupCalls->emplace_back(std::move(call)); };
 
+    // Note that the contents of the buffers and textures are read back synchronously through the
+    // GL front-end (mapRange and ANGLE_get_image), one resource at a time, so the application
+    // stalls on the trigger frame for as long as the readbacks take.  Spreading the snapshot over
+    // several frames would need asynchronous GPU copies and tracking of the resources modified in
+    // the meantime, neither of which the backends expose to capture.
+
     // Capture Buffer data.
     const gl::BufferManager &buffers = apiState.getBufferManagerForCapture();
     for (const auto &bufferIter : buffers)
@@ -4652,6 +4618,8 @@ FrameCaptureShared::FrameCaptureShared()
     }
 
     mReplayWriter.setCaptureLabel(mCaptureLabel);
+    mBinaryData.setFilePath(mCompression,
+                            mOutDirectory + GetBinaryDataFilePath(mCompression, mCaptureLabel));
 }
 
 FrameCaptureShared::~FrameCaptureShared() = default;
@@ -4774,10 +4742,26 @@ bool CoherentBuffer::contains(size_t page, size_t *relativePage)
 
 void CoherentBuffer::protectPageRange(const PageRange &pageRange)
 {
-    for (size_t i = pageRange.start; i < pageRange.end; i++)
+    if (pageRange.start >= pageRange.end)
+    {
+        return;
+    }
+
+    // Protect the whole range with one call instead of one per page, since the dirty ranges of
+    // streamed buffers can span many pages.  Protecting a page that is already clean, for example
+    // one shared with another buffer, has no effect.
+    uintptr_t rangeStart = mProtectionRange.start + pageRange.start * mPageSize;
+    size_t rangeSize     = (pageRange.end - pageRange.start) * mPageSize;
+    ASSERT(rangeStart + rangeSize <= mProtectionRange.end());
+
+    if (!ProtectMemory(rangeStart, rangeSize))
     {
-        setDirty(i, false);
+        ERR() << "Could not set protection for buffer pages " << pageRange.start << " to "
+              << pageRange.end << " at " << reinterpret_cast<void *>(rangeStart) << " with size "
+              << rangeSize;
     }
+
+    std::fill(mDirtyPages.begin() + pageRange.start, mDirtyPages.begin() + pageRange.end, false);
 }
 
 void CoherentBuffer::setDirty(size_t relativePage, bool dirty)
@@ -6454,6 +6438,7 @@ void FrameCaptureShared::onEndFrame(const gl::Context *context)
     }
 
     writeMainContextCppReplay(context, frameCapture->getSetupCalls());
+    mBinaryData.flush();
 
     if (mFrameIndex == mCaptureEndFrame)
     {
@@ -6464,8 +6449,7 @@ void FrameCaptureShared::onEndFrame(const gl::Context *context)
 
         // Save the index files after the last frame.
         writeCppReplayIndexFiles(context, false);
-        SaveBinaryData(mCompression, mOutDirectory, kSharedContextId, mCaptureLabel, mBinaryData);
-        mBinaryData.clear();
+        mBinaryData.save();
         mWroteIndexFile = true;
     }
 
@@ -6487,8 +6471,7 @@ void FrameCaptureShared::onDestroyContext(const gl::Context *context)
         mFrameIndex -= 1;
         mCaptureEndFrame = mFrameIndex;
         writeCppReplayIndexFiles(context, true);
-        SaveBinaryData(mCompression, mOutDirectory, kSharedContextId, mCaptureLabel, mBinaryData);
-        mBinaryData.clear();
+        mBinaryData.save();
         mWroteIndexFile = true;
     }
 }
@@ -7629,6 +7612,87 @@ void WriteParamValueReplay<ParamType::TEGLSetBlobFuncANDROID>(std::ostream &os,
     os << reinterpret_cast<void *>(value);
 }
 
+// BinaryDataWriter implementation.
+BinaryDataWriter::BinaryDataWriter() : mCompression(true), mWrittenSize(0) {}
+
+BinaryDataWriter::~BinaryDataWriter() = default;
+
+void BinaryDataWriter::setFilePath(bool compression, const std::string &filePath)
+{
+    ASSERT(!mStreamingFile);
+    mCompression = compression;
+    mFilePath    = filePath;
+}
+
+size_t BinaryDataWriter::append(const uint8_t *data, size_t size)
+{
+    // Round up to 16-byte boundary for cross ABI safety.  The written size is already aligned.
+    size_t pendingOffset = rx::roundUpPow2(mPendingData.size(), kBinaryAlignment);
+    mPendingData.resize(pendingOffset + size);
+    memcpy(mPendingData.data() + pendingOffset, data, size);
+    return mWrittenSize + pendingOffset;
+}
+
+void BinaryDataWriter::flush()
+{
+    // Gzip data can't be appended to, compressed data is written when the capture ends.
+    if (mCompression || mPendingData.empty())
+    {
+        return;
+    }
+
+    if (!mStreamingFile)
+    {
+        mStreamingFile = std::make_unique<SaveFileHelper>(mFilePath);
+    }
+
+    // Pad as the next append would, so the offsets of the data appended next stay the same.
+    mPendingData.resize(rx::roundUpPow2(mPendingData.size(), kBinaryAlignment));
+    mStreamingFile->write(mPendingData.data(), mPendingData.size());
+    mWrittenSize += mPendingData.size();
+
+    // Release the memory of the pending data, instead of keeping the largest frame's around.
+    std::vector<uint8_t>().swap(mPendingData);
+}
+
+void BinaryDataWriter::save()
+{
+    if (!mCompression)
+    {
+        if (!mStreamingFile)
+        {
+            mStreamingFile = std::make_unique<SaveFileHelper>(mFilePath);
+        }
+        mStreamingFile->write(mPendingData.data(), mPendingData.size());
+        mStreamingFile.reset();
+    }
+    else
+    {
+        SaveFileHelper saveData(mFilePath);
+
+        // Save compressed data.
+        uLong uncompressedSize       = static_cast<uLong>(mPendingData.size());
+        uLong expectedCompressedSize = zlib_internal::GzipExpectedCompressedSize(uncompressedSize);
+
+        std::vector<uint8_t> compressedData(expectedCompressedSize, 0);
+
+        uLong compressedSize = expectedCompressedSize;
+        int zResult = zlib_internal::GzipCompressHelper(compressedData.data(), &compressedSize,
+                                                        mPendingData.data(), uncompressedSize,
+                                                        nullptr, nullptr);
+
+        if (zResult != Z_OK)
+        {
+            FATAL() << "Error compressing binary data: " << zResult;
+        }
+
+        saveData.write(compressedData.data(), compressedSize);
+    }
+
+    mWrittenSize += mPendingData.size();
+    mPendingData.clear();
+}
+
 // ReplayWriter implementation.
 ReplayWriter::ReplayWriter()
     : mSourceFileSizeThreshold(kDefaultSourceFileSizeThreshold), mFrameIndex(1)
@@ -273,6 +273,34 @@ class ReplayWriter final : angle::NonCopyable
     std::vector<std::string> mWrittenFiles;
 };
 
+// The binary data referenced by offset from the CPP replay.  Without compression, the data is
+// appended to the data file as each frame is written, so only the data of the current frame is
+// kept in memory.  Compressed data files are written in one go when the capture ends.
+class BinaryDataWriter final : angle::NonCopyable
+{
+  public:
+    BinaryDataWriter();
+    ~BinaryDataWriter();
+
+    void setFilePath(bool compression, const std::string &filePath);
+
+    // Copies the data at the next aligned offset in the data file, and returns that offset.
+    size_t append(const uint8_t *data, size_t size);
+
+    // Writes the pending data to the data file if it is not compressed.
+    void flush();
+    // Writes all the data that is not in the data file yet.
+    void save();
+
+  private:
+    bool mCompression;
+    std::string mFilePath;
+    std::unique_ptr<SaveFileHelper> mStreamingFile;
+
+    std::vector<uint8_t> mPendingData;
+    size_t mWrittenSize;
+};
+
 using BufferCalls = std::map<GLuint, std::vector<CallCapture>>;
 
 // true means mapped, false means unmapped
@@ -740,7 +768,7 @@ class FrameCaptureShared final : angle::NonCopyable
 
     // We save one large buffer of binary data for the whole CPP replay.
     // This simplifies a lot of file management.
-    std::vector<uint8_t> mBinaryData;
+    BinaryDataWriter mBinaryData;
 
     bool mEnabled;
     bool mSerializeStateEnabled;
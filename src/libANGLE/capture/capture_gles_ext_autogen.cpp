@@ -673,6 +673,40 @@ CallCapture CaptureMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE(
                        std::move(paramBuffer));
 }
 
+CallCapture CaptureBeginCommandStreamANGLE(const State &glState, bool isCallValid, GLuint stream)
+{
+    ParamBuffer paramBuffer;
+
+    paramBuffer.addValueParam("stream", ParamType::TGLuint, stream);
+
+    return CallCapture(angle::EntryPoint::GLBeginCommandStreamANGLE, std::move(paramBuffer));
+}
+
+CallCapture CaptureEndCommandStreamANGLE(const State &glState, bool isCallValid)
+{
+    ParamBuffer paramBuffer;
+
+    return CallCapture(angle::EntryPoint::GLEndCommandStreamANGLE, std::move(paramBuffer));
+}
+
+CallCapture CaptureCallCommandStreamANGLE(const State &glState, bool isCallValid, GLuint stream)
+{
+    ParamBuffer paramBuffer;
+
+    paramBuffer.addValueParam("stream", ParamType::TGLuint, stream);
+
+    return CallCapture(angle::EntryPoint::GLCallCommandStreamANGLE, std::move(paramBuffer));
+}
+
+CallCapture CaptureDeleteCommandStreamANGLE(const State &glState, bool isCallValid, GLuint stream)
+{
+    ParamBuffer paramBuffer;
+
+    paramBuffer.addValueParam("stream", ParamType::TGLuint, stream);
+
+    return CallCapture(angle::EntryPoint::GLDeleteCommandStreamANGLE, std::move(paramBuffer));
+}
+
 CallCapture CaptureCopyTexture3DANGLE(const State &glState,
                                       bool isCallValid,
                                       TextureID sourceIdPacked,
@@ -749,6 +783,17 @@ CallCapture CaptureCopySubTexture3DANGLE(const State &glState,
     return CallCapture(angle::EntryPoint::GLCopySubTexture3DANGLE, std::move(paramBuffer));
 }
 
+CallCapture CaptureWarmUpDrawANGLE(const State &glState,
+                                   bool isCallValid,
+                                   PrimitiveMode modePacked)
+{
+    ParamBuffer paramBuffer;
+
+    paramBuffer.addValueParam("modePacked", ParamType::TPrimitiveMode, modePacked);
+
+    return CallCapture(angle::EntryPoint::GLWarmUpDrawANGLE, std::move(paramBuffer));
+}
+
 CallCapture CaptureBlitFramebufferANGLE(const State &glState,
                                         bool isCallValid,
                                         GLint srcX0,
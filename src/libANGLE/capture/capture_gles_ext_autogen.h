@@ -118,6 +118,18 @@ angle::CallCapture CaptureMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE(
     const GLuint *baseInstances,
     GLsizei drawcount);
 
+// GL_ANGLE_command_stream
+angle::CallCapture CaptureBeginCommandStreamANGLE(const State &glState,
+                                                  bool isCallValid,
+                                                  GLuint stream);
+angle::CallCapture CaptureEndCommandStreamANGLE(const State &glState, bool isCallValid);
+angle::CallCapture CaptureCallCommandStreamANGLE(const State &glState,
+                                                 bool isCallValid,
+                                                 GLuint stream);
+angle::CallCapture CaptureDeleteCommandStreamANGLE(const State &glState,
+                                                   bool isCallValid,
+                                                   GLuint stream);
+
 // GL_ANGLE_copy_texture_3d
 angle::CallCapture CaptureCopyTexture3DANGLE(const State &glState,
                                              bool isCallValid,
@@ -153,6 +165,11 @@ angle::CallCapture CaptureCopySubTexture3DANGLE(const State &glState,
 
 // GL_ANGLE_depth_texture
 
+// GL_ANGLE_draw_warm_up
+angle::CallCapture CaptureWarmUpDrawANGLE(const State &glState,
+                                          bool isCallValid,
+                                          PrimitiveMode modePacked);
+
 // GL_ANGLE_framebuffer_blit
 angle::CallCapture CaptureBlitFramebufferANGLE(const State &glState,
                                                bool isCallValid,
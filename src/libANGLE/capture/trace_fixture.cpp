@@ -13,6 +13,13 @@
 
 #include <string>
 
+#if !defined(_WIN32)
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif  // !defined(_WIN32)
+
 namespace
 {
 void UpdateResourceMap(GLuint *resourceMap, GLuint id, GLsizei readBufferOffset)
@@ -25,16 +32,73 @@ void UpdateResourceMap(GLuint *resourceMap, GLuint id, GLsizei readBufferOffset)
 DecompressCallback gDecompressCallback;
 std::string gBinaryDataDir = ".";
 
-void LoadBinaryData(const char *fileName)
+// Size of the mapping backing gBinaryData, or 0 if it was allocated.
+size_t gBinaryDataMappedSize = 0;
+
+void ReleaseBinaryData()
 {
+    if (gBinaryData == nullptr)
+    {
+        return;
+    }
+#if !defined(_WIN32)
+    if (gBinaryDataMappedSize != 0)
+    {
+        munmap(gBinaryData, gBinaryDataMappedSize);
+        gBinaryData           = nullptr;
+        gBinaryDataMappedSize = 0;
+        return;
+    }
+#endif  // !defined(_WIN32)
     // TODO(b/179188489): Fix cross-module deallocation.
-    if (gBinaryData != nullptr)
+    delete[] gBinaryData;
+    gBinaryData = nullptr;
+}
+
+#if !defined(_WIN32)
+// Maps the uncompressed data file instead of reading it, so that replay only pages in the data of
+// the calls it makes instead of waiting for the whole file.  The mapping is private, so the file
+// is never written to.
+bool MapBinaryData(const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
     {
-        delete[] gBinaryData;
+        return false;
     }
+
+    struct stat fileStat = {};
+    void *mapping        = MAP_FAILED;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        mapping = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE, fd, 0);
+    }
+    // The mapping stays valid after the file is closed.
+    close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        return false;
+    }
+    gBinaryData           = static_cast<uint8_t *>(mapping);
+    gBinaryDataMappedSize = static_cast<size_t>(fileStat.st_size);
+    return true;
+}
+#endif  // !defined(_WIN32)
+
+void LoadBinaryData(const char *fileName)
+{
+    ReleaseBinaryData();
     char pathBuffer[1000] = {};
 
     sprintf(pathBuffer, "%s/%s", gBinaryDataDir.c_str(), fileName);
+#if !defined(_WIN32)
+    if (!gDecompressCallback && strstr(fileName, ".angledata") && MapBinaryData(pathBuffer))
+    {
+        return;
+    }
+#endif  // !defined(_WIN32)
     FILE *fp = fopen(pathBuffer, "rb");
     if (fp == 0)
     {
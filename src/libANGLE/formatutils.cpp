@@ -1409,6 +1409,32 @@ const InternalFormatInfoMap &GetInternalFormatMap()
     return *formatMap;
 }
 
+// Sized internal formats have a single entry regardless of type, so they are indexed separately
+// to look them up with a single find and no checks of their nested map.
+using SizedInternalFormatInfoMap = angle::HashMap<GLenum, const InternalFormat *>;
+
+static SizedInternalFormatInfoMap BuildSizedInternalFormatInfoMap(
+    const InternalFormatInfoMap &formatMap)
+{
+    SizedInternalFormatInfoMap map;
+    for (const auto &internalFormatIter : formatMap)
+    {
+        const InternalFormat &internalFormatInfo = internalFormatIter.second.begin()->second;
+        if (internalFormatIter.second.size() == 1 && internalFormatInfo.sized)
+        {
+            map[internalFormatIter.first] = &internalFormatInfo;
+        }
+    }
+    return map;
+}
+
+static const SizedInternalFormatInfoMap &GetSizedInternalFormatMap()
+{
+    static const angle::base::NoDestructor<SizedInternalFormatInfoMap> sizedFormatMap(
+        BuildSizedInternalFormatInfoMap(GetInternalFormatMap()));
+    return *sizedFormatMap;
+}
+
 int GetAndroidHardwareBufferFormatFromChannelSizes(const egl::AttributeMap &attribMap)
 {
     // Retrieve channel size from attribute map. The default value should be 0, per spec.
@@ -1573,22 +1599,15 @@ uint32_t GetPackedTypeInfo(GLenum type)
 const InternalFormat &GetSizedInternalFormatInfo(GLenum internalFormat)
 {
     static const InternalFormat defaultInternalFormat;
-    const InternalFormatInfoMap &formatMap = GetInternalFormatMap();
-    auto iter                              = formatMap.find(internalFormat);
-
-    // Sized internal formats only have one type per entry
-    if (iter == formatMap.end() || iter->second.size() != 1)
-    {
-        return defaultInternalFormat;
-    }
+    const SizedInternalFormatInfoMap &sizedFormatMap = GetSizedInternalFormatMap();
 
-    const InternalFormat &internalFormatInfo = iter->second.begin()->second;
-    if (!internalFormatInfo.sized)
+    auto iter = sizedFormatMap.find(internalFormat);
+    if (iter == sizedFormatMap.end())
     {
         return defaultInternalFormat;
     }
 
-    return internalFormatInfo;
+    return *iter->second;
 }
 
 const InternalFormat &GetInternalFormatInfo(GLenum internalFormat, GLenum type)
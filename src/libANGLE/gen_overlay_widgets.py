@@ -127,7 +127,7 @@ def get_font_size_constant(properties):
 
 
 def is_graph_type(type):
-    return type == 'RunningGraph' or type == 'RunningHistogram'
+    return type == 'RunningGraph' or type == 'RunningHistogram' or type == 'RunningStackedGraph'
 
 
 def is_text_type(type):
@@ -151,6 +151,7 @@ class OverlayWidget:
         self.color = properties['color']
         self.coords = properties['coords']
         self.match_to = properties.get('match_to', None)
+        self.layer_colors = properties.get('layer_colors', [])
         if is_graph_type(self.type):
             self.bar_width = properties['bar_width']
             self.height = properties['height']
@@ -308,6 +309,9 @@ def generate_widget_init(widget):
     widget_init = '{\n' + widget.type + ' *widget = new ' + widget.constructor + ';\n'
 
     widget_init += generate_widget_init_helper(widget)
+    for layer_color in widget.layer_colors:
+        widget_init += 'widget->layerColors.push_back({' + ', '.join(
+            [str(channel / 255.0) + 'f' for channel in layer_color]) + '});\n'
     widget_init += 'mState.mOverlayWidgets[WidgetId::' + widget.name + '].reset(widget);\n'
 
     if is_graph_type(widget.type):
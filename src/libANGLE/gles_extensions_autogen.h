@@ -569,6 +569,9 @@ struct Extensions
     // GL_CHROMIUM_color_buffer_float_rgba
     bool colorBufferFloatRgbaCHROMIUM = false;
 
+    // GL_ANGLE_command_stream
+    bool commandStreamANGLE = false;
+
     // GL_ANGLE_compressed_texture_etc
     bool compressedTextureEtcANGLE = false;
 
@@ -581,6 +584,9 @@ struct Extensions
     // GL_ANGLE_copy_texture_3d
     bool copyTexture3dANGLE = false;
 
+    // GL_ANGLE_draw_warm_up
+    bool drawWarmUpANGLE = false;
+
     // GL_CHROMIUM_framebuffer_mixed_samples
     bool framebufferMixedSamplesCHROMIUM = false;
 
@@ -4339,6 +4339,9 @@ egl::Error QuerySurfaceAttrib(const Display *display,
         case EGL_BUFFER_AGE_EXT:
             ANGLE_TRY(surface->getBufferAge(context, value));
             break;
+        case EGL_PRESENT_LATENCY_ANGLE:
+            *value = surface->getPresentLatency();
+            break;
         case EGL_BITMAP_PITCH_KHR:
             *value = surface->getBitmapPitch();
             break;
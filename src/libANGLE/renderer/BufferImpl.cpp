@@ -8,6 +8,8 @@
 
 #include "libANGLE/renderer/BufferImpl.h"
 
+#include "libANGLE/formatutils.h"
+
 namespace rx
 {
 
@@ -20,6 +22,23 @@ angle::Result BufferImpl::getSubData(const gl::Context *context,
     return angle::Result::Stop;
 }
 
+angle::Result BufferImpl::getIndexRanges(const gl::Context *context,
+                                         gl::DrawElementsType type,
+                                         size_t offset,
+                                         size_t rangeIndexCount,
+                                         size_t rangeCount,
+                                         bool primitiveRestartEnabled,
+                                         gl::IndexRange *outRanges)
+{
+    const size_t rangeSize = rangeIndexCount * gl::GetDrawElementsTypeSize(type);
+    for (size_t rangeIndex = 0; rangeIndex < rangeCount; ++rangeIndex)
+    {
+        ANGLE_TRY(getIndexRange(context, type, offset + rangeIndex * rangeSize, rangeIndexCount,
+                                primitiveRestartEnabled, &outRanges[rangeIndex]));
+    }
+    return angle::Result::Continue;
+}
+
 angle::Result BufferImpl::setDataWithUsageFlags(const gl::Context *context,
                                                 gl::BufferBinding target,
                                                 GLeglClientBufferEXT clientBuffer,
@@ -72,6 +72,16 @@ class BufferImpl : public angle::Subject
                                         bool primitiveRestartEnabled,
                                         gl::IndexRange *outRange) = 0;
 
+    // Computes the ranges of |rangeCount| consecutive runs of |rangeIndexCount| indices starting
+    // at |offset|.  Override to access the buffer once for all the ranges.
+    virtual angle::Result getIndexRanges(const gl::Context *context,
+                                         gl::DrawElementsType type,
+                                         size_t offset,
+                                         size_t rangeIndexCount,
+                                         size_t rangeCount,
+                                         bool primitiveRestartEnabled,
+                                         gl::IndexRange *outRanges);
+
     virtual angle::Result getSubData(const gl::Context *context,
                                      GLintptr offset,
                                      GLsizeiptr size,
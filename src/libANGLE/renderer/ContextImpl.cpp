@@ -35,6 +35,11 @@ angle::Result ContextImpl::handleNoopDrawEvent()
     return angle::Result::Continue;
 }
 
+angle::Result ContextImpl::warmUpDraw(const gl::Context *context, gl::PrimitiveMode mode)
+{
+    return angle::Result::Continue;
+}
+
 void ContextImpl::setMemoryProgramCache(gl::MemoryProgramCache *memoryProgramCache)
 {
     mMemoryProgramCache = memoryProgramCache;
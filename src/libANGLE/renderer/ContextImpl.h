@@ -197,6 +197,9 @@ class ContextImpl : public GLImplFactory
     // KHR_blend_equation_advanced
     virtual void blendBarrier() {}
 
+    // GL_ANGLE_draw_warm_up
+    virtual angle::Result warmUpDraw(const gl::Context *context, gl::PrimitiveMode mode);
+
     // State sync with dirty bits.
     virtual angle::Result syncState(const gl::Context *context,
                                     const gl::State::DirtyBits &dirtyBits,
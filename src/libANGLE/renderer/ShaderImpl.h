@@ -57,6 +57,13 @@ class ShaderImpl : angle::NonCopyable
                                                           gl::ShCompilerInstance *compilerInstance,
                                                           ShCompileOptions options) = 0;
 
+    // Returns the options the translator is invoked with, given the frontend's |options|.
+    virtual ShCompileOptions getTranslatorCompileOptions(const gl::Context *context,
+                                                         ShCompileOptions options) const
+    {
+        return options;
+    }
+
     virtual std::string getDebugInfo() const = 0;
 
     const gl::ShaderState &getState() const { return mState; }
@@ -32,13 +32,13 @@ void ShaderInterfaceVariableInfoMap::clear()
 }
 
 void ShaderInterfaceVariableInfoMap::load(
-    const gl::ShaderMap<VariableTypeToInfoMap> &data,
-    const gl::ShaderMap<NameToTypeAndIndexMap> &nameToTypeAndIndexMap,
-    const gl::ShaderMap<VariableTypeToIndexMap> &indexedResourceIndexMap)
+    gl::ShaderMap<VariableTypeToInfoMap> &&data,
+    gl::ShaderMap<NameToTypeAndIndexMap> &&nameToTypeAndIndexMap,
+    gl::ShaderMap<VariableTypeToIndexMap> &&indexedResourceIndexMap)
 {
-    mData                    = data;
-    mNameToTypeAndIndexMap   = nameToTypeAndIndexMap;
-    mIndexedResourceIndexMap = indexedResourceIndexMap;
+    mData                    = std::move(data);
+    mNameToTypeAndIndexMap   = std::move(nameToTypeAndIndexMap);
+    mIndexedResourceIndexMap = std::move(indexedResourceIndexMap);
 }
 
 void ShaderInterfaceVariableInfoMap::setActiveStages(gl::ShaderType shaderType,
@@ -86,32 +86,44 @@ ShaderInterfaceVariableInfo &ShaderInterfaceVariableInfoMap::addOrGet(
     ShaderVariableType variableType,
     const std::string &variableName)
 {
-    if (!hasVariable(shaderType, variableName))
+    // Look the name up once, whether the variable is added or not.
+    VariableInfoArray &infoArray = mData[shaderType][variableType];
+    uint32_t newIndex            = static_cast<uint32_t>(infoArray.size());
+    auto insertResult            = mNameToTypeAndIndexMap[shaderType].emplace(
+        variableName, TypeAndIndex{variableType, newIndex});
+    if (insertResult.second)
     {
-        return add(shaderType, variableType, variableName);
-    }
-    else
-    {
-        uint32_t index = mNameToTypeAndIndexMap[shaderType][variableName].index;
-        return mData[shaderType][variableType][index];
+        infoArray.resize(newIndex + 1);
     }
+    return infoArray[insertResult.first->second.index];
 }
 
 bool ShaderInterfaceVariableInfoMap::hasVariable(gl::ShaderType shaderType,
                                                  const std::string &variableName) const
 {
-    auto iter = mNameToTypeAndIndexMap[shaderType].find(variableName);
-    return (iter != mNameToTypeAndIndexMap[shaderType].end());
+    return findVariableByName(shaderType, variableName) != nullptr;
 }
 
 const ShaderInterfaceVariableInfo &ShaderInterfaceVariableInfoMap::getVariableByName(
     gl::ShaderType shaderType,
     const std::string &variableName) const
+{
+    const ShaderInterfaceVariableInfo *info = findVariableByName(shaderType, variableName);
+    ASSERT(info != nullptr);
+    return *info;
+}
+
+const ShaderInterfaceVariableInfo *ShaderInterfaceVariableInfoMap::findVariableByName(
+    gl::ShaderType shaderType,
+    const std::string &variableName) const
 {
     auto iter = mNameToTypeAndIndexMap[shaderType].find(variableName);
-    ASSERT(iter != mNameToTypeAndIndexMap[shaderType].end());
-    TypeAndIndex typeAndIndex = iter->second;
-    return mData[shaderType][typeAndIndex.variableType][typeAndIndex.index];
+    if (iter == mNameToTypeAndIndexMap[shaderType].end())
+    {
+        return nullptr;
+    }
+    const TypeAndIndex &typeAndIndex = iter->second;
+    return &mData[shaderType][typeAndIndex.variableType][typeAndIndex.index];
 }
 
 bool ShaderInterfaceVariableInfoMap::hasTransformFeedbackInfo(gl::ShaderType shaderType,
@@ -138,7 +150,12 @@ void ShaderInterfaceVariableInfoMap::mapIndexedResource(gl::ShaderType shaderTyp
                                                         uint32_t resourceIndex,
                                                         uint32_t variableIndex)
 {
-    mIndexedResourceIndexMap[shaderType][variableType][resourceIndex] = variableIndex;
+    ResourceIndexMap &resourceIndexMap = mIndexedResourceIndexMap[shaderType][variableType];
+    if (resourceIndexMap.size() <= resourceIndex)
+    {
+        resourceIndexMap.resize(resourceIndex + 1, 0);
+    }
+    resourceIndexMap[resourceIndex] = variableIndex;
 }
 
 const ShaderInterfaceVariableInfoMap::VariableInfoArray &
@@ -52,17 +52,19 @@ class ShaderInterfaceVariableInfoMap final : angle::NonCopyable
     using VariableTypeToInfoMap = angle::PackedEnumMap<ShaderVariableType, VariableInfoArray>;
     using NameToTypeAndIndexMap = angle::HashMap<std::string, TypeAndIndex>;
 
-    static constexpr size_t kResourceFastMapMax = 32;
-    using ResourceIndexMap                      = angle::FastMap<uint32_t, kResourceFastMapMax>;
+    // Maps the resource index to the index of the variable in its VariableInfoArray.  There is
+    // one for every shader stage and variable type, and most are empty, so they are not
+    // preallocated.
+    using ResourceIndexMap       = std::vector<uint32_t>;
     using VariableTypeToIndexMap = angle::PackedEnumMap<ShaderVariableType, ResourceIndexMap>;
 
     ShaderInterfaceVariableInfoMap();
     ~ShaderInterfaceVariableInfoMap();
 
     void clear();
-    void load(const gl::ShaderMap<VariableTypeToInfoMap> &data,
-              const gl::ShaderMap<NameToTypeAndIndexMap> &nameToTypeAndIndexMap,
-              const gl::ShaderMap<VariableTypeToIndexMap> &indexedResourceIndexMap);
+    void load(gl::ShaderMap<VariableTypeToInfoMap> &&data,
+              gl::ShaderMap<NameToTypeAndIndexMap> &&nameToTypeAndIndexMap,
+              gl::ShaderMap<VariableTypeToIndexMap> &&indexedResourceIndexMap);
 
     ShaderInterfaceVariableInfo &add(gl::ShaderType shaderType,
                                      ShaderVariableType variableType,
@@ -101,6 +103,9 @@ class ShaderInterfaceVariableInfoMap final : angle::NonCopyable
     bool hasVariable(gl::ShaderType shaderType, const std::string &variableName) const;
     const ShaderInterfaceVariableInfo &getVariableByName(gl::ShaderType shaderType,
                                                          const std::string &variableName) const;
+    // Returns nullptr if the variable is not in the map.
+    const ShaderInterfaceVariableInfo *findVariableByName(gl::ShaderType shaderType,
+                                                          const std::string &variableName) const;
     void mapIndexedResourceByName(gl::ShaderType shaderType,
                                   ShaderVariableType variableType,
                                   uint32_t resourceIndex,
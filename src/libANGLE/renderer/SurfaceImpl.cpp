@@ -125,6 +125,13 @@ egl::Error SurfaceImpl::getBufferAge(const gl::Context *context, EGLint *age)
     return egl::NoError();
 }
 
+void SurfaceImpl::setDamageRegion(const EGLint *rects, EGLint n_rects) {}
+
+EGLint SurfaceImpl::getPresentLatency() const
+{
+    return 0;
+}
+
 egl::Error SurfaceImpl::lockSurface(const egl::Display *display,
                                     EGLint usageHint,
                                     bool preservePixels,
@@ -112,6 +112,12 @@ class SurfaceImpl : public FramebufferAttachmentObjectImpl
                                           EGLnsecsANDROID *values) const;
     virtual egl::Error getBufferAge(const gl::Context *context, EGLint *age);
 
+    // EGL_KHR_partial_update
+    virtual void setDamageRegion(const EGLint *rects, EGLint n_rects);
+
+    // EGL_ANGLE_low_latency_present
+    virtual EGLint getPresentLatency() const;
+
     // EGL_KHR_lock_surface3
     virtual egl::Error lockSurface(const egl::Display *display,
                                    EGLint usageHint,
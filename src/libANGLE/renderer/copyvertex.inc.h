@@ -6,6 +6,15 @@
 
 // copyvertex.inc.h: Implementation of vertex buffer copying and conversion functions
 
+// SSE2 is part of x86-64 and NEON of arm64, so these paths need no runtime check.
+#if defined(ANGLE_USE_SSE) && (defined(__SSE2__) || defined(_M_X64) || \
+                               (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#    define ANGLE_COPY_VERTEX_SSE2
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#    include <arm_neon.h>
+#    define ANGLE_COPY_VERTEX_NEON
+#endif
+
 namespace rx
 {
 
@@ -185,6 +194,32 @@ inline void Copy8SnormTo16SnormVertexData(const uint8_t *input,
     }
 }
 
+namespace priv
+{
+// Converts as many of the values as it can, and returns how many it converted.
+inline size_t Copy32FixedTo32FValues(const uint8_t *input, size_t valueCount, float *output)
+{
+    constexpr float kDivisor = 1.0f / (1 << 16);
+
+    size_t i = 0;
+#if defined(ANGLE_COPY_VERTEX_SSE2)
+    const __m128 divisor = _mm_set1_ps(kDivisor);
+    for (; i + 3 < valueCount; i += 4)
+    {
+        __m128i fixed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(input + i * 4));
+        _mm_storeu_ps(&output[i], _mm_mul_ps(_mm_cvtepi32_ps(fixed), divisor));
+    }
+#elif defined(ANGLE_COPY_VERTEX_NEON)
+    for (; i + 3 < valueCount; i += 4)
+    {
+        int32x4_t fixed = vld1q_s32(reinterpret_cast<const int32_t *>(input + i * 4));
+        vst1q_f32(&output[i], vmulq_n_f32(vcvtq_f32_s32(fixed), kDivisor));
+    }
+#endif
+    return i;
+}
+}  // namespace priv
+
 template <size_t inputComponentCount, size_t outputComponentCount>
 inline void Copy32FixedTo32FVertexData(const uint8_t *input,
                                        size_t stride,
@@ -193,7 +228,18 @@ inline void Copy32FixedTo32FVertexData(const uint8_t *input,
 {
     static const float divisor = 1.0f / (1 << 16);
 
-    for (size_t i = 0; i < count; i++)
+    size_t i = 0;
+    if (inputComponentCount == outputComponentCount &&
+        stride == sizeof(GLfixed) * inputComponentCount)
+    {
+        // Tightly packed attributes convert as one array.  A vertex that is only partly converted
+        // is converted again below.
+        i = priv::Copy32FixedTo32FValues(input, count * inputComponentCount,
+                                         reinterpret_cast<float *>(output)) /
+            inputComponentCount;
+    }
+
+    for (; i < count; i++)
     {
         const uint8_t *offsetInput = input + i * stride;
         float *offsetOutput        = reinterpret_cast<float *>(output) + i * outputComponentCount;
@@ -533,6 +579,209 @@ inline void CopyPackedAlpha(uint32_t data, uint8_t *output)
     }
 }
 
+
+#if defined(ANGLE_COPY_VERTEX_SSE2)
+// Converts the floats to half floats like gl::float32ToFloat16, for floats that are zero or
+// normal half floats.  The half floats are in the low 16 bits of each lane, sign extended.
+inline __m128i Float32ToFloat16ZeroOrNormal(__m128 value)
+{
+    const __m128i bits = _mm_castps_si128(value);
+    const __m128i sign =
+        _mm_srli_epi32(_mm_and_si128(bits, _mm_set1_epi32(static_cast<int>(0x80000000))), 16);
+    const __m128i abs = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+
+    __m128i rounded = _mm_add_epi32(abs, _mm_set1_epi32(static_cast<int>(0xC8000FFF)));
+    rounded = _mm_add_epi32(rounded, _mm_and_si128(_mm_srli_epi32(abs, 13), _mm_set1_epi32(1)));
+    __m128i half = _mm_srli_epi32(rounded, 13);
+
+    // Zero keeps only its sign.
+    half = _mm_andnot_si128(_mm_cmpeq_epi32(abs, _mm_setzero_si128()), half);
+    half = _mm_or_si128(sign, half);
+    return _mm_srai_epi32(_mm_slli_epi32(half, 16), 16);
+}
+#endif  // defined(ANGLE_COPY_VERTEX_SSE2)
+
+// Converts as many of the XYZ10W2 values to floats or half floats as it can, with the same
+// operations as CopyPackedRGB and CopyPackedAlpha so that the results are identical, and returns
+// how many it converted.  The 10 bit values only make zero or normal half floats.
+template <bool isSigned, bool normalized, bool toHalf>
+inline size_t CopyXYZ10W2ToXYZWFloatValues(const uint8_t *input,
+                                           size_t stride,
+                                           size_t count,
+                                           uint8_t *output)
+{
+    size_t i = 0;
+#if defined(ANGLE_COPY_VERTEX_SSE2)
+    for (; i + 3 < count; i += 4)
+    {
+        const uint8_t *offsetInput = input + i * stride;
+        __m128i packed;
+        if (stride == sizeof(GLuint))
+        {
+            packed = _mm_loadu_si128(reinterpret_cast<const __m128i *>(offsetInput));
+        }
+        else
+        {
+            packed = _mm_setr_epi32(
+                static_cast<int>(*reinterpret_cast<const GLuint *>(offsetInput)),
+                static_cast<int>(*reinterpret_cast<const GLuint *>(offsetInput + stride)),
+                static_cast<int>(*reinterpret_cast<const GLuint *>(offsetInput + 2 * stride)),
+                static_cast<int>(*reinterpret_cast<const GLuint *>(offsetInput + 3 * stride)));
+        }
+
+        // The X, Y, Z and W of the four values, each in their own vector.
+        __m128i xyzwBits[4];
+        if (isSigned)
+        {
+            // Moving the fields to the top of the lanes first sign extends them.
+            xyzwBits[0] = _mm_srai_epi32(_mm_slli_epi32(packed, 22), 22);
+            xyzwBits[1] = _mm_srai_epi32(_mm_slli_epi32(packed, 12), 22);
+            xyzwBits[2] = _mm_srai_epi32(_mm_slli_epi32(packed, 2), 22);
+            xyzwBits[3] = _mm_srai_epi32(packed, 30);
+        }
+        else
+        {
+            const __m128i rgbMask = _mm_set1_epi32(0x3FF);
+            xyzwBits[0]           = _mm_and_si128(packed, rgbMask);
+            xyzwBits[1]           = _mm_and_si128(_mm_srli_epi32(packed, 10), rgbMask);
+            xyzwBits[2]           = _mm_and_si128(_mm_srli_epi32(packed, 20), rgbMask);
+            xyzwBits[3]           = _mm_srli_epi32(packed, 30);
+        }
+
+        __m128 xyzw[4];
+        for (size_t j = 0; j < 4; j++)
+        {
+            xyzw[j] = _mm_cvtepi32_ps(xyzwBits[j]);
+        }
+
+        if (normalized && isSigned)
+        {
+            const __m128 minValue  = _mm_set1_ps(-511.0f);
+            const __m128 halfRange = _mm_set1_ps(511.0f);
+            const __m128 one       = _mm_set1_ps(1.0f);
+            for (size_t j = 0; j < 3; j++)
+            {
+                __m128 clamped = _mm_max_ps(xyzw[j], minValue);
+                xyzw[j] = _mm_sub_ps(_mm_div_ps(_mm_sub_ps(clamped, minValue), halfRange), one);
+            }
+            // The alpha values 2 and 3 are both -1.
+            xyzw[3] = _mm_max_ps(xyzw[3], _mm_set1_ps(-1.0f));
+        }
+        else if (normalized)
+        {
+            const __m128 maxValue = _mm_set1_ps(1023.0f);
+            for (size_t j = 0; j < 3; j++)
+            {
+                xyzw[j] = _mm_div_ps(xyzw[j], maxValue);
+            }
+            xyzw[3] = _mm_div_ps(xyzw[3], _mm_set1_ps(3.0f));
+        }
+
+        // Each vector now holds the XYZW of one value.
+        _MM_TRANSPOSE4_PS(xyzw[0], xyzw[1], xyzw[2], xyzw[3]);
+
+        if (toHalf)
+        {
+            __m128i *offsetOutput = reinterpret_cast<__m128i *>(output + i * 4 * sizeof(GLhalf));
+            for (size_t j = 0; j < 4; j += 2)
+            {
+                __m128i halves = _mm_packs_epi32(Float32ToFloat16ZeroOrNormal(xyzw[j]),
+                                                 Float32ToFloat16ZeroOrNormal(xyzw[j + 1]));
+                _mm_storeu_si128(offsetOutput + j / 2, halves);
+            }
+        }
+        else
+        {
+            float *offsetOutput = reinterpret_cast<float *>(output) + i * 4;
+            for (size_t j = 0; j < 4; j++)
+            {
+                _mm_storeu_ps(offsetOutput + j * 4, xyzw[j]);
+            }
+        }
+    }
+#elif defined(ANGLE_COPY_VERTEX_NEON)
+    for (; i + 3 < count; i += 4)
+    {
+        const uint8_t *offsetInput = input + i * stride;
+        uint32x4_t packed;
+        if (stride == sizeof(GLuint))
+        {
+            packed = vld1q_u32(reinterpret_cast<const uint32_t *>(offsetInput));
+        }
+        else
+        {
+            const uint32_t values[4] = {
+                *reinterpret_cast<const GLuint *>(offsetInput),
+                *reinterpret_cast<const GLuint *>(offsetInput + stride),
+                *reinterpret_cast<const GLuint *>(offsetInput + 2 * stride),
+                *reinterpret_cast<const GLuint *>(offsetInput + 3 * stride),
+            };
+            packed = vld1q_u32(values);
+        }
+
+        // The X, Y, Z and W of the four values, each in their own vector.
+        float32x4x4_t xyzw;
+        if (isSigned)
+        {
+            // Moving the fields to the top of the lanes first sign extends them.
+            const int32x4_t signedPacked = vreinterpretq_s32_u32(packed);
+            xyzw.val[0] = vcvtq_f32_s32(vshrq_n_s32(vshlq_n_s32(signedPacked, 22), 22));
+            xyzw.val[1] = vcvtq_f32_s32(vshrq_n_s32(vshlq_n_s32(signedPacked, 12), 22));
+            xyzw.val[2] = vcvtq_f32_s32(vshrq_n_s32(vshlq_n_s32(signedPacked, 2), 22));
+            xyzw.val[3] = vcvtq_f32_s32(vshrq_n_s32(signedPacked, 30));
+        }
+        else
+        {
+            const uint32x4_t rgbMask = vdupq_n_u32(0x3FF);
+            xyzw.val[0]              = vcvtq_f32_u32(vandq_u32(packed, rgbMask));
+            xyzw.val[1]              = vcvtq_f32_u32(vandq_u32(vshrq_n_u32(packed, 10), rgbMask));
+            xyzw.val[2]              = vcvtq_f32_u32(vandq_u32(vshrq_n_u32(packed, 20), rgbMask));
+            xyzw.val[3]              = vcvtq_f32_u32(vshrq_n_u32(packed, 30));
+        }
+
+        if (normalized && isSigned)
+        {
+            const float32x4_t minValue  = vdupq_n_f32(-511.0f);
+            const float32x4_t halfRange = vdupq_n_f32(511.0f);
+            const float32x4_t one       = vdupq_n_f32(1.0f);
+            for (size_t j = 0; j < 3; j++)
+            {
+                float32x4_t clamped = vmaxq_f32(xyzw.val[j], minValue);
+                xyzw.val[j] = vsubq_f32(vdivq_f32(vsubq_f32(clamped, minValue), halfRange), one);
+            }
+            // The alpha values 2 and 3 are both -1.
+            xyzw.val[3] = vmaxq_f32(xyzw.val[3], vdupq_n_f32(-1.0f));
+        }
+        else if (normalized)
+        {
+            const float32x4_t maxValue = vdupq_n_f32(1023.0f);
+            for (size_t j = 0; j < 3; j++)
+            {
+                xyzw.val[j] = vdivq_f32(xyzw.val[j], maxValue);
+            }
+            xyzw.val[3] = vdivq_f32(xyzw.val[3], vdupq_n_f32(3.0f));
+        }
+
+        if (toHalf)
+        {
+            // Rounds to nearest even like gl::float32ToFloat16, which only differs for the NaN,
+            // infinite and denormal results that can't occur here.
+            uint16x4x4_t halves;
+            for (size_t j = 0; j < 4; j++)
+            {
+                halves.val[j] = vreinterpret_u16_f16(vcvt_f16_f32(xyzw.val[j]));
+            }
+            vst4_u16(reinterpret_cast<uint16_t *>(output) + i * 4, halves);
+        }
+        else
+        {
+            vst4q_f32(reinterpret_cast<float *>(output) + i * 4, xyzw);
+        }
+    }
+#endif
+    return i;
+}
+
 }  // namespace priv
 
 template <bool isSigned, bool normalized, bool toFloat, bool toHalf>
@@ -552,7 +801,14 @@ inline void CopyXYZ10W2ToXYZWFloatVertexData(const uint8_t *input,
     const uint32_t alphaMask = 0x3;  // 1 set in bits 0 and 1
     const size_t alphaShift  = 30;   // Alpha is the 30 and 31 bits
 
-    for (size_t i = 0; i < count; i++)
+    size_t i = 0;
+    if (toFloat || toHalf)
+    {
+        i = priv::CopyXYZ10W2ToXYZWFloatValues<isSigned, normalized, toHalf>(input, stride, count,
+                                                                             output);
+    }
+
+    for (; i < count; i++)
     {
         GLuint packedValue    = *reinterpret_cast<const GLuint *>(input + (i * stride));
         uint8_t *offsetOutput = output + (i * outputComponentSize * componentCount);
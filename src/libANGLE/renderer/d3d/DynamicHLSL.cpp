@@ -183,7 +183,8 @@ std::string DynamicHLSL::generateVertexShaderForInputLayout(
     const InputLayout &inputLayout,
     const std::vector<sh::ShaderVariable> &shaderAttributes,
     const std::vector<rx::ShaderStorageBlock> &shaderStorageBlocks,
-    size_t baseUAVRegister) const
+    size_t baseUAVRegister,
+    bool usesVertexIdPointSpriteExpansion) const
 {
     std::ostringstream structStream;
     std::ostringstream initStream;
@@ -214,6 +215,11 @@ std::string DynamicHLSL::generateVertexShaderForInputLayout(
         structStream << "    float3 spriteVertexPos : SPRITEPOSITION0;\n"
                      << "    float2 spriteTexCoord : SPRITETEXCOORD0;\n";
     }
+    else if (usesPointSize && usesVertexIdPointSpriteExpansion)
+    {
+        // The quad vertices are looked up with the vertex ID instead, see generateShaderLinkHLSL().
+        structStream << "    uint dx_SpriteVertexID : SV_VertexID;\n";
+    }
 
     for (size_t attributeIndex = 0; attributeIndex < shaderAttributes.size(); ++attributeIndex)
     {
@@ -541,8 +547,9 @@ void DynamicHLSL::generateShaderLinkHLSL(const gl::Caps &caps,
     ASSERT(shaderModel >= 4 || !programMetadata.usesViewScale());
 
     bool useInstancedPointSpriteEmulation =
-        programMetadata.usesPointSize() &&
-        mRenderer->getFeatures().useInstancedPointSpriteEmulation.enabled;
+        programMetadata.usesPointSize() && programMetadata.usesInstancedPointSpriteEmulation();
+    bool useVertexIdPointSpriteExpansion =
+        useInstancedPointSpriteEmulation && programMetadata.usesVertexIdPointSpriteExpansion();
 
     // Validation done in the compiler
     ASSERT(!fragmentShader || !fragmentShader->usesFragColor() || !fragmentShader->usesFragData());
@@ -563,6 +570,18 @@ void DynamicHLSL::generateShaderLinkHLSL(const gl::Caps &caps,
                      << ".0f;\n";
     }
 
+    // Without the sprite vertex buffer, the quad vertices are looked up with the vertex ID. They
+    // match the vertices of the buffer in StateManager11::applyVertexBuffers().
+    if (useVertexIdPointSpriteExpansion)
+    {
+        vertexStream << "static const float3 dx_SpriteVertexPos[6] = {\n"
+                     << "    float3(-1, -1, 0), float3(-1, 1, 0), float3(1, 1, 0),\n"
+                     << "    float3(1, -1, 0), float3(-1, -1, 0), float3(1, 1, 0)};\n"
+                     << "static const float2 dx_SpriteTexCoord[6] = {\n"
+                     << "    float2(0, 1), float2(0, 0), float2(1, 0),\n"
+                     << "    float2(1, 1), float2(0, 1), float2(1, 0)};\n";
+    }
+
     std::ostringstream vertexGenerateOutput;
     vertexGenerateOutput << "VS_OUTPUT generateOutput(VS_INPUT input)\n"
                          << "{\n"
@@ -698,8 +717,21 @@ void DynamicHLSL::generateShaderLinkHLSL(const gl::Caps &caps,
             << "\n"
             << "    gl_PointSize = clamp(gl_PointSize, minPointSize, maxPointSize);\n";
 
+        // Non-point draws have a zero dx_PointSpriteScale, so that their vertices aren't moved.
+        if (useVertexIdPointSpriteExpansion)
+        {
+            vertexGenerateOutput
+                << "    uint spriteVertexIndex = input.dx_SpriteVertexID % 6;\n"
+                << "    float3 spriteVertexPos = dx_SpriteVertexPos[spriteVertexIndex] * "
+                   "dx_PointSpriteScale;\n";
+        }
+        else
+        {
+            vertexGenerateOutput << "    float3 spriteVertexPos = input.spriteVertexPos;\n";
+        }
+
         vertexGenerateOutput
-            << "    output.dx_Position.x += (input.spriteVertexPos.x * gl_PointSize / "
+            << "    output.dx_Position.x += (spriteVertexPos.x * gl_PointSize / "
                "(dx_ViewCoords.x*2)) * output.dx_Position.w;";
 
         if (programMetadata.usesViewScale())
@@ -707,23 +739,31 @@ void DynamicHLSL::generateShaderLinkHLSL(const gl::Caps &caps,
             // Multiply by ViewScale to invert the rendering when appropriate
             vertexGenerateOutput
                 << "    output.dx_Position.y += (-dx_ViewScale.y * "
-                   "input.spriteVertexPos.y * gl_PointSize / (dx_ViewCoords.y*2)) * "
+                   "spriteVertexPos.y * gl_PointSize / (dx_ViewCoords.y*2)) * "
                    "output.dx_Position.w;";
         }
         else
         {
             vertexGenerateOutput
-                << "    output.dx_Position.y += (input.spriteVertexPos.y * gl_PointSize / "
+                << "    output.dx_Position.y += (spriteVertexPos.y * gl_PointSize / "
                    "(dx_ViewCoords.y*2)) * output.dx_Position.w;";
         }
 
         vertexGenerateOutput
-            << "    output.dx_Position.z += input.spriteVertexPos.z * output.dx_Position.w;\n";
+            << "    output.dx_Position.z += spriteVertexPos.z * output.dx_Position.w;\n";
 
         if (programMetadata.usesPointCoord())
         {
-            vertexGenerateOutput << "\n"
-                                 << "    output.gl_PointCoord = input.spriteTexCoord;\n";
+            vertexGenerateOutput << "\n";
+            if (useVertexIdPointSpriteExpansion)
+            {
+                vertexGenerateOutput
+                    << "    output.gl_PointCoord = dx_SpriteTexCoord[spriteVertexIndex];\n";
+            }
+            else
+            {
+                vertexGenerateOutput << "    output.gl_PointCoord = input.spriteTexCoord;\n";
+            }
         }
     }
 
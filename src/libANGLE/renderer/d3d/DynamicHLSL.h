@@ -151,7 +151,8 @@ class DynamicHLSL : angle::NonCopyable
         const gl::InputLayout &inputLayout,
         const std::vector<sh::ShaderVariable> &shaderAttributes,
         const std::vector<rx::ShaderStorageBlock> &shaderStorageBlocks,
-        size_t baseUAVRegister) const;
+        size_t baseUAVRegister,
+        bool usesVertexIdPointSpriteExpansion) const;
     std::string generatePixelShaderForOutputSignature(
         const std::string &sourceShader,
         const std::vector<PixelShaderOutputVariable> &outputVariables,
@@ -24,65 +24,6 @@ namespace rx
 namespace
 {
 
-template <typename InputT, typename DestT>
-void ConvertIndexArray(const void *input,
-                       gl::DrawElementsType sourceType,
-                       void *output,
-                       gl::DrawElementsType destinationType,
-                       GLsizei count,
-                       bool usePrimitiveRestartFixedIndex)
-{
-    const InputT *in = static_cast<const InputT *>(input);
-    DestT *out       = static_cast<DestT *>(output);
-
-    if (usePrimitiveRestartFixedIndex)
-    {
-        InputT srcRestartIndex = static_cast<InputT>(gl::GetPrimitiveRestartIndex(sourceType));
-        DestT destRestartIndex = static_cast<DestT>(gl::GetPrimitiveRestartIndex(destinationType));
-        for (GLsizei i = 0; i < count; i++)
-        {
-            out[i] = (in[i] == srcRestartIndex ? destRestartIndex : static_cast<DestT>(in[i]));
-        }
-    }
-    else
-    {
-        for (GLsizei i = 0; i < count; i++)
-        {
-            out[i] = static_cast<DestT>(in[i]);
-        }
-    }
-}
-
-void ConvertIndices(gl::DrawElementsType sourceType,
-                    gl::DrawElementsType destinationType,
-                    const void *input,
-                    GLsizei count,
-                    void *output,
-                    bool usePrimitiveRestartFixedIndex)
-{
-    if (sourceType == destinationType)
-    {
-        const GLuint dstTypeSize = gl::GetDrawElementsTypeSize(destinationType);
-        memcpy(output, input, count * dstTypeSize);
-        return;
-    }
-
-    if (sourceType == gl::DrawElementsType::UnsignedByte)
-    {
-        ASSERT(destinationType == gl::DrawElementsType::UnsignedShort);
-        ConvertIndexArray<GLubyte, GLushort>(input, sourceType, output, destinationType, count,
-                                             usePrimitiveRestartFixedIndex);
-    }
-    else if (sourceType == gl::DrawElementsType::UnsignedShort)
-    {
-        ASSERT(destinationType == gl::DrawElementsType::UnsignedInt);
-        ConvertIndexArray<GLushort, GLuint>(input, sourceType, output, destinationType, count,
-                                            usePrimitiveRestartFixedIndex);
-    }
-    else
-        UNREACHABLE();
-}
-
 angle::Result StreamInIndexBuffer(const gl::Context *context,
                                   IndexBufferInterface *buffer,
                                   const void *data,
@@ -104,7 +45,7 @@ angle::Result StreamInIndexBuffer(const gl::Context *context,
     void *output = nullptr;
     ANGLE_TRY(buffer->mapBuffer(context, bufferSizeRequired, &output, offset));
 
-    ConvertIndices(srcType, dstType, data, count, output, usePrimitiveRestartFixedIndex);
+    gl::ConvertIndices(srcType, dstType, data, count, output, usePrimitiveRestartFixedIndex);
 
     ANGLE_TRY(buffer->unmapBuffer(context));
     return angle::Result::Continue;
@@ -210,14 +151,25 @@ angle::Result IndexDataManager::prepareIndexData(const gl::Context *context,
     {
         if (!staticBufferInitialized)
         {
-            const uint8_t *bufferData = nullptr;
-            ANGLE_TRY(buffer->getData(context, &bufferData));
-            ASSERT(bufferData != nullptr);
-
             unsigned int convertCount =
                 static_cast<unsigned int>(buffer->getSize()) >> srcTypeShift;
-            ANGLE_TRY(StreamInIndexBuffer(context, staticBuffer, bufferData, convertCount, srcType,
-                                          dstType, primitiveRestartFixedIndexEnabled, nullptr));
+
+            // Prefer converting the buffer where its data already is.
+            bool converted = false;
+            ANGLE_TRY(mFactory->convertStaticIndexData(context, buffer, srcType, dstType,
+                                                       convertCount,
+                                                       primitiveRestartFixedIndexEnabled,
+                                                       staticBuffer, &converted));
+            if (!converted)
+            {
+                const uint8_t *bufferData = nullptr;
+                ANGLE_TRY(buffer->getData(context, &bufferData));
+                ASSERT(bufferData != nullptr);
+
+                ANGLE_TRY(StreamInIndexBuffer(context, staticBuffer, bufferData, convertCount,
+                                              srcType, dstType, primitiveRestartFixedIndexEnabled,
+                                              nullptr));
+            }
         }
         ASSERT(offsetAligned && staticBuffer->getIndexType() == dstType);
 
@@ -276,6 +276,40 @@ class HLSLBlockLayoutEncoderFactory : public gl::CustomBlockLayoutEncoderFactory
         return new sh::HLSLBlockEncoder(sh::HLSLBlockEncoder::ENCODE_PACKED, false);
     }
 };
+
+// Point sprites can be expanded from SV_VertexID only when every vertex of the instanced quads can
+// stand for its point. Multiview programs draw instanced already, and may need a geometry shader
+// to select the view. gl_VertexID and gl_InstanceID would see the quads instead of the points, and
+// transform feedback would capture the quad vertices.
+bool CanExpandPointSpritesWithVertexId(RendererD3D *renderer,
+                                       const gl::ProgramState &state,
+                                       const ShaderD3D *vertexShader)
+{
+    const angle::FeaturesD3D &features = renderer->getFeatures();
+    if (!features.expandPointSpritesWithVertexId.enabled ||
+        features.useInstancedPointSpriteEmulation.enabled ||
+        renderer->getMajorShaderModel() < 4 || !renderer->getShaderModelSuffix().empty())
+    {
+        return false;
+    }
+
+    if (!vertexShader || !vertexShader->usesPointSize() ||
+        vertexShader->hasANGLEMultiviewEnabled() || vertexShader->usesVertexID() ||
+        !state.getTransformFeedbackVaryingNames().empty())
+    {
+        return false;
+    }
+
+    for (const sh::ShaderVariable &attribute : state.getProgramInputs())
+    {
+        if (attribute.name == "gl_InstanceID")
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
 }  // anonymous namespace
 
 // D3DUniform Implementation
@@ -399,11 +433,14 @@ D3DVarying::D3DVarying(const std::string &semanticNameIn,
 
 ProgramD3DMetadata::ProgramD3DMetadata(RendererD3D *renderer,
                                        const gl::ShaderMap<const ShaderD3D *> &attachedShaders,
-                                       EGLenum clientType)
+                                       EGLenum clientType,
+                                       bool usesVertexIdPointSpriteExpansion)
     : mRendererMajorShaderModel(renderer->getMajorShaderModel()),
       mShaderModelSuffix(renderer->getShaderModelSuffix()),
+      mUsesVertexIdPointSpriteExpansion(usesVertexIdPointSpriteExpansion),
       mUsesInstancedPointSpriteEmulation(
-          renderer->getFeatures().useInstancedPointSpriteEmulation.enabled),
+          renderer->getFeatures().useInstancedPointSpriteEmulation.enabled ||
+          usesVertexIdPointSpriteExpansion),
       mUsesViewScale(renderer->presentPathFastEnabled()),
       mCanSelectViewInVertexShader(renderer->canSelectViewInVertexShader()),
       mAttachedShaders(attachedShaders),
@@ -460,6 +497,16 @@ bool ProgramD3DMetadata::usesInsertedPointCoordValue() const
            mRendererMajorShaderModel >= 4;
 }
 
+bool ProgramD3DMetadata::usesInstancedPointSpriteEmulation() const
+{
+    return mUsesInstancedPointSpriteEmulation;
+}
+
+bool ProgramD3DMetadata::usesVertexIdPointSpriteExpansion() const
+{
+    return mUsesVertexIdPointSpriteExpansion;
+}
+
 bool ProgramD3DMetadata::usesViewScale() const
 {
     return mUsesViewScale;
@@ -687,6 +734,7 @@ ProgramD3D::ProgramD3D(const gl::ProgramState &state, RendererD3D *renderer)
       mRenderer(renderer),
       mDynamicHLSL(nullptr),
       mUsesPointSize(false),
+      mUsesVertexIdPointSpriteExpansion(false),
       mUsesFlatInterpolation(false),
       mUsedShaderSamplerRanges({}),
       mDirtySamplerMapping(true),
@@ -738,7 +786,8 @@ bool ProgramD3D::usesGeometryShader(const gl::State &state, const gl::PrimitiveM
 
 bool ProgramD3D::usesInstancedPointSpriteEmulation() const
 {
-    return mRenderer->getFeatures().useInstancedPointSpriteEmulation.enabled;
+    return mRenderer->getFeatures().useInstancedPointSpriteEmulation.enabled ||
+           mUsesVertexIdPointSpriteExpansion;
 }
 
 GLint ProgramD3D::getSamplerMapping(gl::ShaderType type,
@@ -1129,6 +1178,7 @@ std::unique_ptr<rx::LinkEvent> ProgramD3D::load(const gl::Context *context,
     stream->readBool(&mUsesVertexID);
     stream->readBool(&mUsesViewID);
     stream->readBool(&mUsesPointSize);
+    stream->readBool(&mUsesVertexIdPointSpriteExpansion);
     stream->readBool(&mUsesFlatInterpolation);
 
     const size_t pixelShaderKeySize = stream->readInt<size_t>();
@@ -1425,6 +1475,7 @@ void ProgramD3D::save(const gl::Context *context, gl::BinaryOutputStream *stream
     stream->writeBool(mUsesVertexID);
     stream->writeBool(mUsesViewID);
     stream->writeBool(mUsesPointSize);
+    stream->writeBool(mUsesVertexIdPointSpriteExpansion);
     stream->writeBool(mUsesFlatInterpolation);
 
     const std::vector<PixelShaderOutputVariable> &pixelShaderKey = mPixelShaderKey;
@@ -1592,21 +1643,14 @@ angle::Result ProgramD3D::getVertexExecutableForCachedInputLayout(
         return angle::Result::Continue;
     }
 
-    // Generate new dynamic layout with attribute conversions
-    std::string finalVertexHLSL = mDynamicHLSL->generateVertexShaderForInputLayout(
-        mShaderHLSL[gl::ShaderType::Vertex], mCachedInputLayout, mState.getProgramInputs(),
-        mShaderStorageBlocks[gl::ShaderType::Vertex], mPixelShaderKey.size());
-
     // Generate new vertex executable
     ShaderExecutableD3D *vertexExecutable = nullptr;
 
     gl::InfoLog tempInfoLog;
     gl::InfoLog *currentInfoLog = infoLog ? infoLog : &tempInfoLog;
 
-    ANGLE_TRY(mRenderer->compileToExecutable(
-        context, *currentInfoLog, finalVertexHLSL, gl::ShaderType::Vertex, mStreamOutVaryings,
-        (mState.getTransformFeedbackBufferMode() == GL_SEPARATE_ATTRIBS),
-        mShaderWorkarounds[gl::ShaderType::Vertex], &vertexExecutable));
+    ANGLE_TRY(compileVertexExecutableForInputLayout(context, mCachedInputLayout, *currentInfoLog,
+                                                    &vertexExecutable));
 
     if (vertexExecutable)
     {
@@ -1624,6 +1668,24 @@ angle::Result ProgramD3D::getVertexExecutableForCachedInputLayout(
     return angle::Result::Continue;
 }
 
+angle::Result ProgramD3D::compileVertexExecutableForInputLayout(
+    d3d::Context *context,
+    const gl::InputLayout &inputLayout,
+    gl::InfoLog &infoLog,
+    ShaderExecutableD3D **outExecutable) const
+{
+    // Generate new dynamic layout with attribute conversions
+    std::string finalVertexHLSL = mDynamicHLSL->generateVertexShaderForInputLayout(
+        mShaderHLSL[gl::ShaderType::Vertex], inputLayout, mState.getProgramInputs(),
+        mShaderStorageBlocks[gl::ShaderType::Vertex], mPixelShaderKey.size(),
+        mUsesVertexIdPointSpriteExpansion);
+
+    return mRenderer->compileToExecutable(
+        context, infoLog, finalVertexHLSL, gl::ShaderType::Vertex, mStreamOutVaryings,
+        (mState.getTransformFeedbackBufferMode() == GL_SEPARATE_ATTRIBS),
+        mShaderWorkarounds[gl::ShaderType::Vertex], outExecutable);
+}
+
 angle::Result ProgramD3D::getGeometryExecutableForPrimitiveType(d3d::Context *context,
                                                                 const gl::State &state,
                                                                 gl::PrimitiveMode drawMode,
@@ -1698,6 +1760,45 @@ class ProgramD3D::GetVertexExecutableTask : public ProgramD3D::GetExecutableTask
     }
 };
 
+// Compiles the vertex executable for the input layout of the vertex array bound at link time, which
+// is likely to be used with the program, so the first draw doesn't have to compile it.  The result
+// is only added to the program's executables once the link is resolved on the context's thread.
+class ProgramD3D::GetPredictedVertexExecutableTask : public ProgramD3D::GetExecutableTask
+{
+  public:
+    GetPredictedVertexExecutableTask(ProgramD3D *program,
+                                     const gl::InputLayout &inputLayout,
+                                     const VertexExecutable::Signature &signature)
+        : GetExecutableTask(program), mInputLayout(inputLayout), mSignature(signature)
+    {}
+
+    angle::Result run() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "ProgramD3D::GetPredictedVertexExecutableTask::run");
+
+        ShaderExecutableD3D *vertexExecutable = nullptr;
+        ANGLE_TRY(mProgram->compileVertexExecutableForInputLayout(this, mInputLayout, mInfoLog,
+                                                                  &vertexExecutable));
+        if (vertexExecutable)
+        {
+            mVertexExecutable.reset(
+                new VertexExecutable(mInputLayout, mSignature, vertexExecutable));
+        }
+
+        return angle::Result::Continue;
+    }
+
+    std::unique_ptr<VertexExecutable> releaseVertexExecutable()
+    {
+        return std::move(mVertexExecutable);
+    }
+
+  private:
+    gl::InputLayout mInputLayout;
+    VertexExecutable::Signature mSignature;
+    std::unique_ptr<VertexExecutable> mVertexExecutable;
+};
+
 void ProgramD3D::updateCachedInputLayoutFromShader()
 {
     GetDefaultInputLayoutFromShader(mState.getAttachedShader(gl::ShaderType::Vertex),
@@ -1798,24 +1899,34 @@ class ProgramD3D::GetComputeExecutableTask : public ProgramD3D::GetExecutableTas
 class ProgramD3D::GraphicsProgramLinkEvent final : public LinkEvent
 {
   public:
-    GraphicsProgramLinkEvent(gl::InfoLog &infoLog,
-                             std::shared_ptr<WorkerThreadPool> workerPool,
-                             std::shared_ptr<ProgramD3D::GetVertexExecutableTask> vertexTask,
-                             std::shared_ptr<ProgramD3D::GetPixelExecutableTask> pixelTask,
-                             std::shared_ptr<ProgramD3D::GetGeometryExecutableTask> geometryTask,
-                             bool useGS,
-                             const ShaderD3D *vertexShader,
-                             const ShaderD3D *fragmentShader)
+    GraphicsProgramLinkEvent(
+        gl::InfoLog &infoLog,
+        std::shared_ptr<WorkerThreadPool> workerPool,
+        ProgramD3D *program,
+        std::shared_ptr<ProgramD3D::GetVertexExecutableTask> vertexTask,
+        std::shared_ptr<ProgramD3D::GetPixelExecutableTask> pixelTask,
+        std::shared_ptr<ProgramD3D::GetGeometryExecutableTask> geometryTask,
+        std::shared_ptr<ProgramD3D::GetPredictedVertexExecutableTask> predictedVertexTask,
+        bool useGS,
+        const ShaderD3D *vertexShader,
+        const ShaderD3D *fragmentShader)
         : mInfoLog(infoLog),
+          mProgram(program),
           mVertexTask(vertexTask),
           mPixelTask(pixelTask),
           mGeometryTask(geometryTask),
-          mWaitEvents({{std::shared_ptr<WaitableEvent>(
-                            angle::WorkerThreadPool::PostWorkerTask(workerPool, mVertexTask)),
-                        std::shared_ptr<WaitableEvent>(
-                            angle::WorkerThreadPool::PostWorkerTask(workerPool, mPixelTask)),
-                        std::shared_ptr<WaitableEvent>(
-                            angle::WorkerThreadPool::PostWorkerTask(workerPool, mGeometryTask))}}),
+          mPredictedVertexTask(predictedVertexTask),
+          mWaitEvents(
+              {{std::shared_ptr<WaitableEvent>(
+                    angle::WorkerThreadPool::PostWorkerTask(workerPool, mVertexTask)),
+                std::shared_ptr<WaitableEvent>(
+                    angle::WorkerThreadPool::PostWorkerTask(workerPool, mPixelTask)),
+                std::shared_ptr<WaitableEvent>(
+                    angle::WorkerThreadPool::PostWorkerTask(workerPool, mGeometryTask)),
+                mPredictedVertexTask ? std::shared_ptr<WaitableEvent>(
+                                           angle::WorkerThreadPool::PostWorkerTask(
+                                               workerPool, mPredictedVertexTask))
+                                     : std::make_shared<WaitableEventDone>()}}),
           mUseGS(useGS),
           mVertexShader(vertexShader),
           mFragmentShader(fragmentShader)
@@ -1865,8 +1976,21 @@ class ProgramD3D::GraphicsProgramLinkEvent final : public LinkEvent
         if (!isLinked)
         {
             mInfoLog << "Failed to create D3D Shaders";
+            return angle::Result::Incomplete;
         }
-        return isLinked ? angle::Result::Continue : angle::Result::Incomplete;
+
+        // The predicted variant is an optimization only.  If it failed to compile, the draw that
+        // needs it will compile it again and report the error.
+        if (mPredictedVertexTask && mPredictedVertexTask->getResult() == angle::Result::Continue)
+        {
+            std::unique_ptr<VertexExecutable> predictedVertexExecutable =
+                mPredictedVertexTask->releaseVertexExecutable();
+            if (predictedVertexExecutable)
+            {
+                mProgram->mVertexExecutables.push_back(std::move(predictedVertexExecutable));
+            }
+        }
+        return angle::Result::Continue;
     }
 
     bool isLinking() override
@@ -1901,10 +2025,12 @@ class ProgramD3D::GraphicsProgramLinkEvent final : public LinkEvent
     }
 
     gl::InfoLog &mInfoLog;
+    ProgramD3D *mProgram;
     std::shared_ptr<ProgramD3D::GetVertexExecutableTask> mVertexTask;
     std::shared_ptr<ProgramD3D::GetPixelExecutableTask> mPixelTask;
     std::shared_ptr<ProgramD3D::GetGeometryExecutableTask> mGeometryTask;
-    std::array<std::shared_ptr<WaitableEvent>, 3> mWaitEvents;
+    std::shared_ptr<ProgramD3D::GetPredictedVertexExecutableTask> mPredictedVertexTask;
+    std::array<std::shared_ptr<WaitableEvent>, 4> mWaitEvents;
     bool mUseGS;
     const ShaderD3D *mVertexShader;
     const ShaderD3D *mFragmentShader;
@@ -1962,9 +2088,25 @@ std::unique_ptr<LinkEvent> ProgramD3D::compileProgramExecutables(const gl::Conte
     const ShaderD3D *fragmentShaderD3D =
         fragmentShader ? GetImplAs<ShaderD3D>(fragmentShader) : nullptr;
 
-    return std::make_unique<GraphicsProgramLinkEvent>(infoLog, context->getWorkerThreadPool(),
-                                                      vertexTask, pixelTask, geometryTask, useGS,
-                                                      vertexShaderD3D, fragmentShaderD3D);
+    // Also compile the variant for the currently bound vertex array in parallel with the others,
+    // if it needs a different one than the default input layout.
+    std::shared_ptr<GetPredictedVertexExecutableTask> predictedVertexTask;
+    if (vertexShader && context->getState().getVertexArray())
+    {
+        gl::InputLayout inputLayout;
+        VertexExecutable::Signature signature;
+        getInputLayoutFromState(context->getState(), &inputLayout);
+        VertexExecutable::getSignature(mRenderer, inputLayout, &signature);
+        if (signature != mCachedVertexSignature)
+        {
+            predictedVertexTask =
+                std::make_shared<GetPredictedVertexExecutableTask>(this, inputLayout, signature);
+        }
+    }
+
+    return std::make_unique<GraphicsProgramLinkEvent>(
+        infoLog, context->getWorkerThreadPool(), this, vertexTask, pixelTask, geometryTask,
+        predictedVertexTask, useGS, vertexShaderD3D, fragmentShaderD3D);
 }
 
 std::unique_ptr<LinkEvent> ProgramD3D::compileComputeExecutable(const gl::Context *context,
@@ -2142,14 +2284,18 @@ std::unique_ptr<LinkEvent> ProgramD3D::link(const gl::Context *context,
         const gl::VaryingPacking &varyingPacking =
             resources.varyingPacking.getOutputPacking(gl::ShaderType::Vertex);
 
-        ProgramD3DMetadata metadata(mRenderer, shadersD3D, context->getClientType());
+        const ShaderD3D *vertexShader = shadersD3D[gl::ShaderType::Vertex];
+        mUsesPointSize                = vertexShader && vertexShader->usesPointSize();
+        mUsesVertexIdPointSpriteExpansion =
+            CanExpandPointSpritesWithVertexId(mRenderer, mState, vertexShader);
+
+        ProgramD3DMetadata metadata(mRenderer, shadersD3D, context->getClientType(),
+                                    mUsesVertexIdPointSpriteExpansion);
         BuiltinVaryingsD3D builtins(metadata, varyingPacking);
 
         mDynamicHLSL->generateShaderLinkHLSL(context->getCaps(), mState, metadata, varyingPacking,
                                              builtins, &mShaderHLSL);
 
-        const ShaderD3D *vertexShader = shadersD3D[gl::ShaderType::Vertex];
-        mUsesPointSize                = vertexShader && vertexShader->usesPointSize();
         mDynamicHLSL->getPixelShaderOutputKey(data, mState, metadata, &mPixelShaderKey);
         mUsesFragDepth            = metadata.usesFragDepth();
         mUsesVertexID             = metadata.usesVertexID();
@@ -3052,8 +3198,9 @@ void ProgramD3D::reset()
     mUsesVertexID             = false;
     mUsesViewID               = false;
     mPixelShaderKey.clear();
-    mUsesPointSize         = false;
-    mUsesFlatInterpolation = false;
+    mUsesPointSize                    = false;
+    mUsesVertexIdPointSpriteExpansion = false;
+    mUsesFlatInterpolation            = false;
 
     SafeDeleteContainer(mD3DUniforms);
     mD3DUniformBlocks.clear();
@@ -3127,7 +3274,17 @@ void ProgramD3D::updateCachedInputLayout(Serial associatedSerial, const gl::Stat
     }
 
     mCurrentVertexArrayStateSerial = associatedSerial;
-    mCachedInputLayout.clear();
+    getInputLayoutFromState(state, &mCachedInputLayout);
+
+    VertexExecutable::getSignature(mRenderer, mCachedInputLayout, &mCachedVertexSignature);
+
+    updateCachedVertexExecutableIndex();
+}
+
+void ProgramD3D::getInputLayoutFromState(const gl::State &state,
+                                         gl::InputLayout *inputLayoutOut) const
+{
+    inputLayoutOut->clear();
 
     const auto &vertexAttributes = state.getVertexArray()->getVertexAttributes();
     const gl::AttributesMask &attributesMask =
@@ -3139,19 +3296,15 @@ void ProgramD3D::updateCachedInputLayout(Serial associatedSerial, const gl::Stat
 
         if (d3dSemantic != -1)
         {
-            if (mCachedInputLayout.size() < static_cast<size_t>(d3dSemantic + 1))
+            if (inputLayoutOut->size() < static_cast<size_t>(d3dSemantic + 1))
             {
-                mCachedInputLayout.resize(d3dSemantic + 1, angle::FormatID::NONE);
+                inputLayoutOut->resize(d3dSemantic + 1, angle::FormatID::NONE);
             }
-            mCachedInputLayout[d3dSemantic] =
+            (*inputLayoutOut)[d3dSemantic] =
                 GetVertexFormatID(vertexAttributes[locationIndex],
                                   state.getVertexAttribCurrentValue(locationIndex).Type);
         }
     }
-
-    VertexExecutable::getSignature(mRenderer, mCachedInputLayout, &mCachedVertexSignature);
-
-    updateCachedVertexExecutableIndex();
 }
 
 void ProgramD3D::updateCachedOutputLayout(const gl::Context *context,
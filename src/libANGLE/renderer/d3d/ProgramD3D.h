@@ -147,7 +147,8 @@ class ProgramD3DMetadata final : angle::NonCopyable
   public:
     ProgramD3DMetadata(RendererD3D *renderer,
                        const gl::ShaderMap<const ShaderD3D *> &attachedShaders,
-                       EGLenum clientType);
+                       EGLenum clientType,
+                       bool usesVertexIdPointSpriteExpansion);
     ~ProgramD3DMetadata();
 
     int getRendererMajorShaderModel() const;
@@ -158,6 +159,8 @@ class ProgramD3DMetadata final : angle::NonCopyable
     bool usesFragCoord() const;
     bool usesPointSize() const;
     bool usesInsertedPointCoordValue() const;
+    bool usesInstancedPointSpriteEmulation() const;
+    bool usesVertexIdPointSpriteExpansion() const;
     bool usesViewScale() const;
     bool hasANGLEMultiviewEnabled() const;
     bool usesVertexID() const;
@@ -173,6 +176,7 @@ class ProgramD3DMetadata final : angle::NonCopyable
   private:
     const int mRendererMajorShaderModel;
     const std::string mShaderModelSuffix;
+    const bool mUsesVertexIdPointSpriteExpansion;
     const bool mUsesInstancedPointSpriteEmulation;
     const bool mUsesViewScale;
     const bool mCanSelectViewInVertexShader;
@@ -216,6 +220,7 @@ class ProgramD3D : public ProgramImpl
     bool usesGeometryShaderForPointSpriteEmulation() const;
     bool usesGetDimensionsIgnoresBaseLevel() const;
     bool usesInstancedPointSpriteEmulation() const;
+    bool usesVertexIdPointSpriteExpansion() const { return mUsesVertexIdPointSpriteExpansion; }
 
     std::unique_ptr<LinkEvent> load(const gl::Context *context,
                                     gl::BinaryInputStream *stream,
@@ -364,6 +369,7 @@ class ProgramD3D : public ProgramImpl
     class GetVertexExecutableTask;
     class GetPixelExecutableTask;
     class GetGeometryExecutableTask;
+    class GetPredictedVertexExecutableTask;
     class GetComputeExecutableTask;
     class GraphicsProgramLinkEvent;
     class ComputeProgramLinkEvent;
@@ -525,6 +531,12 @@ class ProgramD3D : public ProgramImpl
     void initializeUniformBlocks();
     void initializeShaderStorageBlocks();
 
+    angle::Result compileVertexExecutableForInputLayout(d3d::Context *context,
+                                                        const gl::InputLayout &inputLayout,
+                                                        gl::InfoLog &infoLog,
+                                                        ShaderExecutableD3D **outExecutable) const;
+    void getInputLayoutFromState(const gl::State &state, gl::InputLayout *inputLayoutOut) const;
+
     void updateCachedInputLayoutFromShader();
     void updateCachedOutputLayoutFromShader();
     void updateCachedImage2DBindLayoutFromShader(gl::ShaderType shaderType);
@@ -558,6 +570,7 @@ class ProgramD3D : public ProgramImpl
     std::string mGeometryShaderPreamble;
 
     bool mUsesPointSize;
+    bool mUsesVertexIdPointSpriteExpansion;
     bool mUsesFlatInterpolation;
 
     gl::ShaderMap<std::unique_ptr<UniformStorageD3D>> mShaderUniformStorages;
@@ -42,6 +42,7 @@ struct LinkedVarying;
 
 namespace rx
 {
+class BufferD3D;
 class ContextImpl;
 struct D3DUniform;
 struct D3DVarying;
@@ -54,6 +55,8 @@ class NativeWindowD3D;
 class ProgramD3D;
 class RenderTargetD3D;
 class ShaderExecutableD3D;
+class StaticIndexBufferInterface;
+class StaticVertexBufferInterface;
 class SwapChainD3D;
 class TextureStorage;
 struct TranslatedIndexData;
@@ -144,6 +147,29 @@ class BufferFactoryD3D : angle::NonCopyable
                                                  GLsizei instances,
                                                  GLuint baseInstance,
                                                  unsigned int *bytesRequiredOut) const = 0;
+
+    // Fill an empty static index or vertex buffer with the converted contents of |source| without
+    // reading them back to the CPU.  |*convertedOut| is set to false if the conversion has to be
+    // done on the CPU instead.
+    virtual angle::Result convertStaticIndexData(const gl::Context *context,
+                                                 BufferD3D *source,
+                                                 gl::DrawElementsType srcType,
+                                                 gl::DrawElementsType dstType,
+                                                 unsigned int count,
+                                                 bool usePrimitiveRestartFixedIndex,
+                                                 StaticIndexBufferInterface *dest,
+                                                 bool *convertedOut) = 0;
+
+    // Warning: you should ensure binding really matches attrib.bindingIndex before using this
+    // function.
+    virtual angle::Result convertStaticVertexData(const gl::Context *context,
+                                                  BufferD3D *source,
+                                                  const gl::VertexAttribute &attrib,
+                                                  const gl::VertexBinding &binding,
+                                                  GLint start,
+                                                  GLsizei count,
+                                                  StaticVertexBufferInterface *dest,
+                                                  bool *convertedOut) = 0;
 };
 
 using AttribIndexArray = gl::AttribArray<int>;
@@ -424,6 +450,8 @@ class RendererD3D : public BufferFactoryD3D
 
     virtual bool canSelectViewInVertexShader() const = 0;
 
+    egl::Display *getDisplay() const { return mDisplay; }
+
   protected:
     virtual bool getLUID(LUID *adapterLuid) const                    = 0;
     virtual void generateCaps(gl::Caps *outCaps,
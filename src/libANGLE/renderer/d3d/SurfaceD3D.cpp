@@ -429,6 +429,10 @@ egl::Error SurfaceD3D::querySurfacePointerANGLE(EGLint attribute, void **value)
     {
         *value = mSwapChain->getKeyedMutex();
     }
+    else if (attribute == EGL_FRAME_LATENCY_WAITABLE_OBJECT_ANGLE)
+    {
+        *value = mSwapChain->getFrameLatencyWaitableObject();
+    }
     else
         UNREACHABLE();
 
@@ -68,6 +68,7 @@ class SwapChainD3D : angle::NonCopyable
 
     HANDLE getShareHandle() { return mShareHandle; }
     virtual void *getKeyedMutex() = 0;
+    virtual void *getFrameLatencyWaitableObject() = 0;
 
     virtual egl::Error getSyncValues(EGLuint64KHR *ust, EGLuint64KHR *msc, EGLuint64KHR *sbc) = 0;
 
@@ -356,22 +356,14 @@ angle::Result VertexDataManager::StoreStaticAttrib(const gl::Context *context,
     ASSERT(buffer && attrib.enabled && !DirectStoragePossible(context, attrib, binding));
     BufferD3D *bufferD3D = GetImplAs<BufferD3D>(buffer);
 
-    // Compute source data pointer
-    const uint8_t *sourceData = nullptr;
-    const int offset          = static_cast<int>(ComputeVertexAttributeOffset(attrib, binding));
-
-    ANGLE_TRY(bufferD3D->getData(context, &sourceData));
-
-    if (sourceData)
-    {
-        sourceData += offset;
-    }
+    const int offset = static_cast<int>(ComputeVertexAttributeOffset(attrib, binding));
 
     unsigned int streamOffset = 0;
 
-    translated->storage = nullptr;
-    ANGLE_TRY(bufferD3D->getFactory()->getVertexSpaceRequired(context, attrib, binding, 1, 0, 0,
-                                                              &translated->stride));
+    BufferFactoryD3D *factory = bufferD3D->getFactory();
+    translated->storage       = nullptr;
+    ANGLE_TRY(factory->getVertexSpaceRequired(context, attrib, binding, 1, 0, 0,
+                                              &translated->stride));
 
     auto *staticBuffer = bufferD3D->getStaticVertexBuffer(attrib, binding);
     ASSERT(staticBuffer);
@@ -385,8 +377,25 @@ angle::Result VertexDataManager::StoreStaticAttrib(const gl::Context *context,
 
         if (totalCount > 0)
         {
-            ANGLE_TRY(staticBuffer->storeStaticAttribute(context, attrib, binding, -startIndex,
-                                                         totalCount, 0, sourceData));
+            // Prefer converting the buffer where its data already is.
+            bool converted = false;
+            ANGLE_TRY(factory->convertStaticVertexData(context, bufferD3D, attrib, binding,
+                                                       -startIndex, totalCount, staticBuffer,
+                                                       &converted));
+            if (!converted)
+            {
+                // Compute source data pointer
+                const uint8_t *sourceData = nullptr;
+                ANGLE_TRY(bufferD3D->getData(context, &sourceData));
+
+                if (sourceData)
+                {
+                    sourceData += offset;
+                }
+
+                ANGLE_TRY(staticBuffer->storeStaticAttribute(context, attrib, binding, -startIndex,
+                                                             totalCount, 0, sourceData));
+            }
         }
     }
 
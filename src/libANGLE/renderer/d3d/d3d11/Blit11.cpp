@@ -1251,7 +1251,7 @@ angle::Result Blit11::copyAndConvertImpl(const gl::Context *context,
         mRenderer->mapResource(context, destStaging.get(), 0, D3D11_MAP_WRITE, 0, &destMapping);
     if (error == angle::Result::Stop)
     {
-        deviceContext->Unmap(sourceStaging.get(), 0);
+        mRenderer->unmapResource(sourceStaging.get(), 0);
         return error;
     }
 
@@ -1272,8 +1272,8 @@ angle::Result Blit11::copyAndConvertImpl(const gl::Context *context,
                     destPixelStride, static_cast<const uint8_t *>(sourceMapping.pData),
                     static_cast<uint8_t *>(destMapping.pData));
 
-    deviceContext->Unmap(sourceStaging.get(), 0);
-    deviceContext->Unmap(destStaging.get(), 0);
+    mRenderer->unmapResource(sourceStaging.get(), 0);
+    mRenderer->unmapResource(destStaging.get(), 0);
 
     return angle::Result::Continue;
 }
@@ -1321,7 +1321,7 @@ angle::Result Blit11::copyAndConvert(const gl::Context *context,
             mRenderer->mapResource(context, destStaging.get(), 0, D3D11_MAP_READ, 0, &mapped));
         deviceContext->UpdateSubresource(dest.get(), destSubresource, nullptr, mapped.pData,
                                          mapped.RowPitch, mapped.DepthPitch);
-        deviceContext->Unmap(destStaging.get(), 0);
+        mRenderer->unmapResource(destStaging.get(), 0);
     }
     else
     {
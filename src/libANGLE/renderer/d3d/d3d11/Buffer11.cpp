@@ -8,6 +8,7 @@
 
 #include "libANGLE/renderer/d3d/d3d11/Buffer11.h"
 
+#include <deque>
 #include <memory>
 
 #include "common/MemoryBuffer.h"
@@ -62,6 +63,26 @@ void CalculateConstantBufferParams(GLintptr offset,
     // https://msdn.microsoft.com/en-us/library/windows/desktop/hh404649%28v=vs.85%29.aspx
 }
 
+// With the combineBufferBindFlags feature, the vertex, index and pixel unpack usages share the same
+// storage, so updating the buffer for one of them doesn't require a copy for the others.  Constant
+// buffers can't be combined with other bind flags, so uniform buffers still have their own copy.
+BufferUsage GetStorageUsage(Renderer11 *renderer, BufferUsage usage)
+{
+    if (!renderer->getFeatures().combineBufferBindFlags.enabled)
+    {
+        return usage;
+    }
+
+    switch (usage)
+    {
+        case BUFFER_USAGE_INDEX:
+        case BUFFER_USAGE_PIXEL_UNPACK:
+            return BUFFER_USAGE_VERTEX_OR_TRANSFORM_FEEDBACK;
+        default:
+            return usage;
+    }
+}
+
 }  // anonymous namespace
 
 namespace gl_d3d11
@@ -295,11 +316,24 @@ class Buffer11::PackStorage : public Buffer11::BufferStorage
                              const PackPixelsParams &params);
 
   private:
+    // A readback copied to a staging texture, which isn't packed until the buffer is read or
+    // the GPU is done with the copy.
+    struct QueuedPackCommand
+    {
+        TextureHelper11 stagingTexture;
+        PackPixelsParams params;
+    };
+
+    // A readPixels of the screen every frame shouldn't keep more copies in flight than this.
+    static constexpr size_t kMaxQueuedPackCommands = 4;
+
+    // Packs the queued commands, in order, until one whose copy isn't done yet.
+    angle::Result pollQueuedPackCommands(const gl::Context *context);
     angle::Result flushQueuedPackCommand(const gl::Context *context);
+    angle::Result packQueuedPackCommand(const gl::Context *context, bool wait, bool *packedOut);
 
-    TextureHelper11 mStagingTexture;
     angle::MemoryBuffer mMemoryBuffer;
-    std::unique_ptr<PackPixelsParams> mQueuedPackCommand;
+    std::deque<QueuedPackCommand> mQueuedPackCommands;
     PackPixelsParams mPackParams;
     bool mDataModified;
 };
@@ -810,14 +844,15 @@ angle::Result Buffer11::getBufferStorage(const gl::Context *context,
                                          StorageOutT **storageOut)
 {
     ASSERT(0 <= usage && usage < BUFFER_USAGE_COUNT);
-    BufferStorage *&newStorage = mBufferStorages[usage];
+    const BufferUsage storageUsage = GetStorageUsage(mRenderer, usage);
+    BufferStorage *&newStorage     = mBufferStorages[storageUsage];
 
     if (!newStorage)
     {
-        newStorage = allocateStorage(usage);
+        newStorage = allocateStorage(storageUsage);
     }
 
-    markBufferUsage(usage);
+    markBufferUsage(storageUsage);
 
     // resize buffer
     if (newStorage->getSize() < mSize)
@@ -828,7 +863,7 @@ angle::Result Buffer11::getBufferStorage(const gl::Context *context,
     ASSERT(newStorage);
 
     ANGLE_TRY(updateBufferStorage(context, newStorage, 0, mSize));
-    ANGLE_TRY(garbageCollection(context, usage));
+    ANGLE_TRY(garbageCollection(context, storageUsage));
 
     *storageOut = GetAs<StorageOutT>(newStorage);
     return angle::Result::Continue;
@@ -1308,6 +1343,12 @@ void Buffer11::NativeStorage::FillBufferDesc(D3D11_BUFFER_DESC *bufferDesc,
                 bufferDesc->BindFlags |= D3D11_BIND_STREAM_OUTPUT;
             }
 
+            // Also used for the index and pixel unpack usages, see GetStorageUsage().
+            if (renderer->getFeatures().combineBufferBindFlags.enabled)
+            {
+                bufferDesc->BindFlags |= D3D11_BIND_INDEX_BUFFER | D3D11_BIND_SHADER_RESOURCE;
+            }
+
             bufferDesc->CPUAccessFlags = 0;
             break;
 
@@ -1389,8 +1430,7 @@ angle::Result Buffer11::NativeStorage::map(const gl::Context *context,
 void Buffer11::NativeStorage::unmap()
 {
     ASSERT(isCPUAccessible(GL_MAP_WRITE_BIT) || isCPUAccessible(GL_MAP_READ_BIT));
-    ID3D11DeviceContext *context = mRenderer->getDeviceContext();
-    context->Unmap(mBuffer.get(), 0);
+    mRenderer->unmapResource(mBuffer.get(), 0);
 }
 
 angle::Result Buffer11::NativeStorage::getSRVForFormat(const gl::Context *context,
@@ -1706,7 +1746,7 @@ void Buffer11::EmulatedIndexedStorage::unmap()
 // Buffer11::PackStorage implementation
 
 Buffer11::PackStorage::PackStorage(Renderer11 *renderer)
-    : BufferStorage(renderer, BUFFER_USAGE_PIXEL_PACK), mStagingTexture(), mDataModified(false)
+    : BufferStorage(renderer, BUFFER_USAGE_PIXEL_PACK), mDataModified(false)
 {}
 
 Buffer11::PackStorage::~PackStorage() {}
@@ -1774,7 +1814,14 @@ angle::Result Buffer11::PackStorage::packPixels(const gl::Context *context,
                                                 const gl::FramebufferAttachment &readAttachment,
                                                 const PackPixelsParams &params)
 {
-    ANGLE_TRY(flushQueuedPackCommand(context));
+    // The earlier readbacks stay queued while the GPU works on them, so that reading the screen
+    // into a pack buffer every frame doesn't wait for the GPU.
+    ANGLE_TRY(pollQueuedPackCommands(context));
+    while (mQueuedPackCommands.size() >= kMaxQueuedPackCommands)
+    {
+        bool packed = false;
+        ANGLE_TRY(packQueuedPackCommand(context, true, &packed));
+    }
 
     RenderTarget11 *renderTarget = nullptr;
     ANGLE_TRY(readAttachment.getRenderTarget(context, 0, &renderTarget));
@@ -1783,16 +1830,13 @@ angle::Result Buffer11::PackStorage::packPixels(const gl::Context *context,
     ASSERT(srcTexture.valid());
     unsigned int srcSubresource = renderTarget->getSubresourceIndex();
 
-    mQueuedPackCommand.reset(new PackPixelsParams(params));
+    QueuedPackCommand command;
+    command.params = params;
 
     gl::Extents srcTextureSize(params.area.width, params.area.height, 1);
-    if (!mStagingTexture.get() || mStagingTexture.getFormat() != srcTexture.getFormat() ||
-        mStagingTexture.getExtents() != srcTextureSize)
-    {
-        ANGLE_TRY(mRenderer->createStagingTexture(context, srcTexture.getTextureType(),
-                                                  srcTexture.getFormatSet(), srcTextureSize,
-                                                  StagingAccess::READ, &mStagingTexture));
-    }
+    ANGLE_TRY(mRenderer->getStagingTexturePool()->acquire(context, srcTexture.getTextureType(),
+                                                          srcTexture.getFormatSet(),
+                                                          srcTextureSize, &command.stagingTexture));
 
     // ReadPixels from multisampled FBOs isn't supported in current GL
     ASSERT(srcTexture.getSampleCount() <= 1);
@@ -1806,16 +1850,27 @@ angle::Result Buffer11::PackStorage::packPixels(const gl::Context *context,
 
     // Select the correct layer from a 3D attachment
     srcBox.front = 0;
-    if (mStagingTexture.is3D())
+    if (command.stagingTexture.is3D())
     {
         srcBox.front = static_cast<UINT>(readAttachment.layer());
     }
     srcBox.back = srcBox.front + 1;
 
     // Asynchronous copy
-    immediateContext->CopySubresourceRegion(mStagingTexture.get(), 0, 0, 0, 0, srcTexture.get(),
-                                            srcSubresource, &srcBox);
+    immediateContext->CopySubresourceRegion(command.stagingTexture.get(), 0, 0, 0, 0,
+                                            srcTexture.get(), srcSubresource, &srcBox);
 
+    mQueuedPackCommands.push_back(std::move(command));
+    return angle::Result::Continue;
+}
+
+angle::Result Buffer11::PackStorage::pollQueuedPackCommands(const gl::Context *context)
+{
+    bool packed = true;
+    while (packed && !mQueuedPackCommands.empty())
+    {
+        ANGLE_TRY(packQueuedPackCommand(context, false, &packed));
+    }
     return angle::Result::Continue;
 }
 
@@ -1823,13 +1878,40 @@ angle::Result Buffer11::PackStorage::flushQueuedPackCommand(const gl::Context *c
 {
     ASSERT(mMemoryBuffer.size() > 0);
 
-    if (mQueuedPackCommand)
+    while (!mQueuedPackCommands.empty())
     {
-        ANGLE_TRY(mRenderer->packPixels(context, mStagingTexture, *mQueuedPackCommand,
+        bool packed = false;
+        ANGLE_TRY(packQueuedPackCommand(context, true, &packed));
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result Buffer11::PackStorage::packQueuedPackCommand(const gl::Context *context,
+                                                           bool wait,
+                                                           bool *packedOut)
+{
+    ASSERT(!mQueuedPackCommands.empty());
+    QueuedPackCommand &command = mQueuedPackCommands.front();
+
+    if (wait)
+    {
+        ANGLE_TRY(mRenderer->packPixels(context, command.stagingTexture, command.params,
                                         mMemoryBuffer.data()));
-        mQueuedPackCommand.reset(nullptr);
+        *packedOut = true;
+    }
+    else
+    {
+        ANGLE_TRY(mRenderer->tryPackPixels(context, command.stagingTexture, command.params,
+                                           mMemoryBuffer.data(), packedOut));
+        if (!*packedOut)
+        {
+            return angle::Result::Continue;
+        }
     }
 
+    mRenderer->getStagingTexturePool()->release(std::move(command.stagingTexture));
+    mQueuedPackCommands.pop_front();
     return angle::Result::Continue;
 }
 
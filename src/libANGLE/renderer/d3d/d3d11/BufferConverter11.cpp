@@ -0,0 +1,444 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// BufferConverter11.cpp:
+//   Compute shader conversion of index and vertex buffers into their static copies, so that
+//   buffers in formats D3D11 doesn't support don't have to be read back to the CPU.
+//
+
+#include "libANGLE/renderer/d3d/d3d11/BufferConverter11.h"
+
+#include <algorithm>
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/VertexAttribute.h"
+#include "libANGLE/formatutils.h"
+#include "libANGLE/renderer/d3d/IndexBuffer.h"
+#include "libANGLE/renderer/d3d/VertexBuffer.h"
+#include "libANGLE/renderer/d3d/d3d11/Buffer11.h"
+#include "libANGLE/renderer/d3d/d3d11/Context11.h"
+#include "libANGLE/renderer/d3d/d3d11/IndexBuffer11.h"
+#include "libANGLE/renderer/d3d/d3d11/Renderer11.h"
+#include "libANGLE/renderer/d3d/d3d11/ShaderExecutable11.h"
+#include "libANGLE/renderer/d3d/d3d11/VertexBuffer11.h"
+#include "libANGLE/renderer/d3d/d3d11/formatutils11.h"
+#include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
+#include "libANGLE/trace.h"
+
+namespace rx
+{
+
+namespace
+{
+constexpr unsigned int kThreadGroupSize = 64;
+
+// The shaders are small enough to be compiled when they are first needed.  The compiled binaries
+// end up in the blob cache like the programs' own shaders.
+//
+// Each thread writes one 32-bit word of the destination, which holds one or two indices.  Out of
+// range loads of the source return 0.
+constexpr char kIndexConversionCS[] = R"(
+Buffer<uint> SourceIndices : register(t0);
+RWByteAddressBuffer DestIndices : register(u0);
+
+cbuffer IndexConversionParams : register(b0)
+{
+    uint IndexCount;
+    uint DestIndexShift;
+    uint SourceRestartIndex;
+    uint DestRestartIndex;
+    uint ThreadsPerRow;
+};
+
+uint ConvertIndex(uint index)
+{
+    uint value = SourceIndices.Load(index);
+    return value == SourceRestartIndex ? DestRestartIndex : value;
+}
+
+[numthreads(64, 1, 1)]
+void main(uint3 threadId : SV_DispatchThreadID)
+{
+    uint word           = threadId.y * ThreadsPerRow + threadId.x;
+    uint indicesPerWord = 4u >> DestIndexShift;
+    uint firstIndex     = word * indicesPerWord;
+    if (firstIndex >= IndexCount)
+    {
+        return;
+    }
+
+    uint result = ConvertIndex(firstIndex);
+    if (indicesPerWord == 2u && firstIndex + 1u < IndexCount)
+    {
+        result |= ConvertIndex(firstIndex + 1u) << 16;
+    }
+    DestIndices.Store(word * 4u, result);
+}
+)";
+
+// Each thread converts one vertex.  The conversions match the CPU copy functions of
+// copyvertex.inc.h.
+constexpr char kVertexConversionCS[] = R"(
+Buffer<uint> SourceData : register(t0);
+RWByteAddressBuffer DestData : register(u0);
+
+cbuffer VertexConversionParams : register(b0)
+{
+    uint FirstWord;
+    uint WordStride;
+    uint VertexCount;
+    uint ComponentCount;
+    uint Conversion;
+    uint ThreadsPerRow;
+};
+
+#define CONVERSION_FIXED 0
+#define CONVERSION_SNORM32 1
+#define CONVERSION_UNORM32 2
+#define CONVERSION_PACKED_SNORM 3
+#define CONVERSION_PACKED_SSCALED 4
+#define CONVERSION_PACKED_USCALED 5
+
+float ConvertComponent(uint value)
+{
+    if (Conversion == CONVERSION_FIXED)
+    {
+        return float(asint(value)) / 65536.0;
+    }
+    if (Conversion == CONVERSION_SNORM32)
+    {
+        return max(float(asint(value)) / 2147483647.0, -1.0);
+    }
+    return float(value) / 4294967295.0;
+}
+
+[numthreads(64, 1, 1)]
+void main(uint3 threadId : SV_DispatchThreadID)
+{
+    uint vertex = threadId.y * ThreadsPerRow + threadId.x;
+    if (vertex >= VertexCount)
+    {
+        return;
+    }
+
+    uint sourceWord = FirstWord + vertex * WordStride;
+    uint destOffset = vertex * ComponentCount * 4u;
+
+    if (Conversion >= CONVERSION_PACKED_SNORM)
+    {
+        uint packed = SourceData.Load(sourceWord);
+
+        // Sign extend the three 10-bit components and the 2-bit w component.
+        int4 signedValue    = int4(packed << uint4(22, 12, 2, 0)) >> uint4(22, 22, 22, 30);
+        uint4 unsignedValue = (packed >> uint4(0, 10, 20, 30)) & uint4(0x3FF, 0x3FF, 0x3FF, 0x3);
+
+        float4 result;
+        if (Conversion == CONVERSION_PACKED_SNORM)
+        {
+            result = max(float4(signedValue) / float4(511.0, 511.0, 511.0, 1.0), -1.0);
+        }
+        else if (Conversion == CONVERSION_PACKED_SSCALED)
+        {
+            result = float4(signedValue);
+        }
+        else
+        {
+            result = float4(unsignedValue);
+        }
+        DestData.Store4(destOffset, asuint(result));
+        return;
+    }
+
+    for (uint component = 0; component < ComponentCount; ++component)
+    {
+        float result = ConvertComponent(SourceData.Load(sourceWord + component));
+        DestData.Store(destOffset + component * 4u, asuint(result));
+    }
+}
+)";
+
+// Must match the defines of kVertexConversionCS.
+enum class VertexConversion : unsigned int
+{
+    Fixed         = 0,
+    Snorm32       = 1,
+    Unorm32       = 2,
+    PackedSnorm   = 3,
+    PackedSscaled = 4,
+    PackedUscaled = 5,
+
+    InvalidEnum = 6,
+};
+
+VertexConversion GetVertexConversion(angle::FormatID vertexFormatID)
+{
+    switch (vertexFormatID)
+    {
+        case angle::FormatID::R32_FIXED:
+        case angle::FormatID::R32G32_FIXED:
+        case angle::FormatID::R32G32B32_FIXED:
+        case angle::FormatID::R32G32B32A32_FIXED:
+            return VertexConversion::Fixed;
+        case angle::FormatID::R32_SNORM:
+        case angle::FormatID::R32G32_SNORM:
+        case angle::FormatID::R32G32B32_SNORM:
+        case angle::FormatID::R32G32B32A32_SNORM:
+            return VertexConversion::Snorm32;
+        case angle::FormatID::R32_UNORM:
+        case angle::FormatID::R32G32_UNORM:
+        case angle::FormatID::R32G32B32_UNORM:
+        case angle::FormatID::R32G32B32A32_UNORM:
+            return VertexConversion::Unorm32;
+        case angle::FormatID::R10G10B10A2_SNORM:
+            return VertexConversion::PackedSnorm;
+        case angle::FormatID::R10G10B10A2_SSCALED:
+            return VertexConversion::PackedSscaled;
+        case angle::FormatID::R10G10B10A2_USCALED:
+            return VertexConversion::PackedUscaled;
+        default:
+            return VertexConversion::InvalidEnum;
+    }
+}
+
+void GetDispatchSize(unsigned int threadCount, unsigned int *groupsXOut, unsigned int *groupsYOut)
+{
+    unsigned int groupCount = UnsignedCeilDivide(threadCount, kThreadGroupSize);
+    *groupsXOut =
+        std::min<unsigned int>(groupCount, D3D11_CS_DISPATCH_MAX_THREAD_GROUPS_PER_DIMENSION);
+    *groupsYOut = UnsignedCeilDivide(groupCount, *groupsXOut);
+}
+}  // anonymous namespace
+
+BufferConverter11::BufferConverter11(Renderer11 *renderer)
+    : mRenderer(renderer), mResourceState(ResourceState::Unloaded)
+{}
+
+BufferConverter11::~BufferConverter11() {}
+
+angle::Result BufferConverter11::loadResources(const gl::Context *context)
+{
+    if (mResourceState != ResourceState::Unloaded)
+    {
+        return angle::Result::Continue;
+    }
+
+    Context11 *context11 = GetImplAs<Context11>(context);
+    ANGLE_TRY(mRenderer->ensureHLSLCompilerInitialized(context11));
+
+    gl::InfoLog infoLog;
+    ShaderExecutableD3D *indexExecutable  = nullptr;
+    ShaderExecutableD3D *vertexExecutable = nullptr;
+    ANGLE_TRY(mRenderer->compileToExecutable(context11, infoLog, kIndexConversionCS,
+                                             gl::ShaderType::Compute, {}, false,
+                                             CompilerWorkaroundsD3D(), &indexExecutable));
+    mIndexConversionCS.reset(indexExecutable);
+    ANGLE_TRY(mRenderer->compileToExecutable(context11, infoLog, kVertexConversionCS,
+                                             gl::ShaderType::Compute, {}, false,
+                                             CompilerWorkaroundsD3D(), &vertexExecutable));
+    mVertexConversionCS.reset(vertexExecutable);
+
+    // A compile failure isn't an error, the buffers are then converted on the CPU.
+    if (!mIndexConversionCS || !mVertexConversionCS)
+    {
+        WARN() << "Failed to compile the buffer conversion shaders: " << infoLog.str();
+        mResourceState = ResourceState::Failed;
+        return angle::Result::Continue;
+    }
+
+    D3D11_BUFFER_DESC constantBufferDesc = {};
+    d3d11::InitConstantBufferDesc(&constantBufferDesc, sizeof(IndexConversionParams));
+    ANGLE_TRY(mRenderer->allocateResource(context11, constantBufferDesc, &mIndexParamsBuffer));
+    mIndexParamsBuffer.setInternalName("BufferConverter11IndexParams");
+
+    d3d11::InitConstantBufferDesc(&constantBufferDesc, sizeof(VertexConversionParams));
+    ANGLE_TRY(mRenderer->allocateResource(context11, constantBufferDesc, &mVertexParamsBuffer));
+    mVertexParamsBuffer.setInternalName("BufferConverter11VertexParams");
+
+    mResourceState = ResourceState::Loaded;
+    return angle::Result::Continue;
+}
+
+angle::Result BufferConverter11::convertIndices(const gl::Context *context,
+                                                Buffer11 *source,
+                                                gl::DrawElementsType srcType,
+                                                gl::DrawElementsType dstType,
+                                                unsigned int count,
+                                                bool usePrimitiveRestartFixedIndex,
+                                                StaticIndexBufferInterface *dest,
+                                                bool *convertedOut)
+{
+    *convertedOut = false;
+
+    const GLuint srcTypeShift = gl::GetDrawElementsTypeShift(srcType);
+    const GLuint dstTypeShift = gl::GetDrawElementsTypeShift(dstType);
+    if (count == 0 || srcTypeShift >= dstTypeShift)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(loadResources(context));
+    if (mResourceState != ResourceState::Loaded)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "BufferConverter11::convertIndices");
+
+    Context11 *context11 = GetImplAs<Context11>(context);
+    ANGLE_CHECK(context11, count <= (std::numeric_limits<unsigned int>::max() >> dstTypeShift),
+                "Reserving indices exceeds the maximum buffer size.", GL_OUT_OF_MEMORY);
+
+    // The source indices are read through a typed view so that the shader doesn't need to unpack
+    // them.
+    const DXGI_FORMAT srvFormat = (srcType == gl::DrawElementsType::UnsignedByte)
+                                      ? DXGI_FORMAT_R8_UINT
+                                      : DXGI_FORMAT_R16_UINT;
+    const d3d11::ShaderResourceView *sourceSRV = nullptr;
+    ANGLE_TRY(source->getSRV(context, srvFormat, &sourceSRV));
+
+    ASSERT(dest->getBufferSize() == 0);
+    IndexBuffer11 *indexBuffer = GetAs<IndexBuffer11>(dest->getIndexBuffer());
+    ANGLE_TRY(indexBuffer->initializeForUnorderedAccess(context, count << dstTypeShift, dstType));
+
+    const unsigned int wordCount = indexBuffer->getBufferSize() / 4;
+    unsigned int groupsX         = 0;
+    unsigned int groupsY         = 0;
+    GetDispatchSize(wordCount, &groupsX, &groupsY);
+
+    IndexConversionParams params = {};
+    params.IndexCount            = count;
+    params.DestIndexShift        = dstTypeShift;
+    params.SourceRestartIndex    = usePrimitiveRestartFixedIndex
+                                       ? gl::GetPrimitiveRestartIndex(srcType)
+                                       : std::numeric_limits<unsigned int>::max();
+    params.DestRestartIndex      = gl::GetPrimitiveRestartIndex(dstType);
+    params.ThreadsPerRow         = groupsX * kThreadGroupSize;
+    d3d11::SetBufferData(mRenderer->getDeviceContext(), mIndexParamsBuffer.get(), params);
+
+    ANGLE_TRY(dispatch(context, GetAs<ShaderExecutable11>(mIndexConversionCS.get()),
+                       mIndexParamsBuffer, *sourceSRV, indexBuffer->getBuffer(),
+                       indexBuffer->getBufferSize(), groupsX, groupsY));
+
+    *convertedOut = true;
+    return angle::Result::Continue;
+}
+
+angle::Result BufferConverter11::convertVertices(const gl::Context *context,
+                                                 Buffer11 *source,
+                                                 const gl::VertexAttribute &attrib,
+                                                 const gl::VertexBinding &binding,
+                                                 GLint start,
+                                                 GLsizei count,
+                                                 StaticVertexBufferInterface *dest,
+                                                 bool *convertedOut)
+{
+    *convertedOut = false;
+
+    angle::FormatID vertexFormatID       = attrib.format->id;
+    VertexConversion conversion          = GetVertexConversion(vertexFormatID);
+    const D3D_FEATURE_LEVEL featureLevel = mRenderer->getRenderer11DeviceCaps().featureLevel;
+    const d3d11::VertexFormat &vertexFormatInfo =
+        d3d11::GetVertexFormatInfo(vertexFormatID, featureLevel);
+    if (conversion == VertexConversion::InvalidEnum ||
+        vertexFormatInfo.conversionType != VERTEX_CONVERT_CPU || count <= 0)
+    {
+        return angle::Result::Continue;
+    }
+
+    // The source is read one 32-bit word at a time.
+    const GLuint stride      = static_cast<GLuint>(ComputeVertexAttributeStride(attrib, binding));
+    const GLintptr offset    = ComputeVertexAttributeOffset(attrib, binding);
+    const GLintptr firstByte = offset + static_cast<GLintptr>(start) * stride;
+    ASSERT(firstByte >= 0);
+    if (stride % 4 != 0 || firstByte % 4 != 0)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(loadResources(context));
+    if (mResourceState != ResourceState::Loaded)
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "BufferConverter11::convertVertices");
+
+    const d3d11::ShaderResourceView *sourceSRV = nullptr;
+    ANGLE_TRY(source->getSRV(context, DXGI_FORMAT_R32_UINT, &sourceSRV));
+
+    unsigned int destSize = 0;
+    ANGLE_TRY(mRenderer->getVertexSpaceRequired(context, attrib, binding, count, 0, 0, &destSize));
+
+    ASSERT(dest->empty());
+    VertexBuffer11 *vertexBuffer = GetAs<VertexBuffer11>(dest->getVertexBuffer());
+    ANGLE_TRY(vertexBuffer->initializeForUnorderedAccess(context, destSize));
+
+    unsigned int groupsX = 0;
+    unsigned int groupsY = 0;
+    GetDispatchSize(static_cast<unsigned int>(count), &groupsX, &groupsY);
+
+    // All the destination formats have 32-bit float components.
+    const unsigned int componentCount =
+        d3d11::GetDXGIFormatSizeInfo(vertexFormatInfo.nativeFormat).pixelBytes / 4;
+
+    VertexConversionParams params = {};
+    params.FirstWord              = static_cast<unsigned int>(firstByte / 4);
+    params.WordStride             = stride / 4;
+    params.VertexCount            = static_cast<unsigned int>(count);
+    params.ComponentCount         = componentCount;
+    params.Conversion             = static_cast<unsigned int>(conversion);
+    params.ThreadsPerRow          = groupsX * kThreadGroupSize;
+    d3d11::SetBufferData(mRenderer->getDeviceContext(), mVertexParamsBuffer.get(), params);
+
+    ANGLE_TRY(dispatch(context, GetAs<ShaderExecutable11>(mVertexConversionCS.get()),
+                       mVertexParamsBuffer, *sourceSRV, vertexBuffer->getBuffer(), destSize,
+                       groupsX, groupsY));
+
+    dest->setAttribute(attrib, binding);
+
+    *convertedOut = true;
+    return angle::Result::Continue;
+}
+
+angle::Result BufferConverter11::dispatch(const gl::Context *context,
+                                          ShaderExecutable11 *shader,
+                                          const d3d11::Buffer &paramsBuffer,
+                                          const d3d11::ShaderResourceView &sourceSRV,
+                                          const d3d11::Buffer &dest,
+                                          unsigned int destSize,
+                                          unsigned int groupsX,
+                                          unsigned int groupsY)
+{
+    D3D11_UNORDERED_ACCESS_VIEW_DESC uavDesc;
+    uavDesc.Format              = DXGI_FORMAT_R32_TYPELESS;
+    uavDesc.ViewDimension       = D3D11_UAV_DIMENSION_BUFFER;
+    uavDesc.Buffer.FirstElement = 0;
+    uavDesc.Buffer.NumElements  = destSize / 4;
+    uavDesc.Buffer.Flags        = D3D11_BUFFER_UAV_FLAG_RAW;
+
+    d3d11::UnorderedAccessView destUAV;
+    ANGLE_TRY(mRenderer->allocateResource(GetImplAs<Context11>(context), uavDesc, dest.get(),
+                                          &destUAV));
+
+    StateManager11 *stateManager = mRenderer->getStateManager();
+    stateManager->setComputeShader(&shader->getComputeShader());
+    stateManager->setComputeConstantBuffer(&paramsBuffer);
+    stateManager->setShaderResource(gl::ShaderType::Compute, 0, &sourceSRV);
+    stateManager->setUnorderedAccessView(gl::ShaderType::Compute, 0, &destUAV);
+
+    mRenderer->getDeviceContext()->Dispatch(groupsX, groupsY, 1);
+
+    // The destination is bound as an index or vertex buffer next, which D3D11 doesn't allow while
+    // it's still bound for output.
+    stateManager->setUnorderedAccessView(gl::ShaderType::Compute, 0, nullptr);
+    stateManager->setShaderResource(gl::ShaderType::Compute, 0, nullptr);
+
+    return angle::Result::Continue;
+}
+
+}  // namespace rx
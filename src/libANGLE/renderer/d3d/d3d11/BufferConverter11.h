@@ -0,0 +1,117 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// BufferConverter11.h:
+//   Compute shader conversion of index and vertex buffers into their static copies, so that
+//   buffers in formats D3D11 doesn't support don't have to be read back to the CPU.
+//
+
+#ifndef LIBANGLE_RENDERER_D3D_D3D11_BUFFERCONVERTER11_H_
+#define LIBANGLE_RENDERER_D3D_D3D11_BUFFERCONVERTER11_H_
+
+#include <memory>
+
+#include "common/PackedEnums.h"
+#include "libANGLE/Error.h"
+#include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
+
+namespace gl
+{
+class Context;
+struct VertexAttribute;
+struct VertexBinding;
+}  // namespace gl
+
+namespace rx
+{
+class Buffer11;
+class Renderer11;
+class ShaderExecutable11;
+class ShaderExecutableD3D;
+class StaticIndexBufferInterface;
+class StaticVertexBufferInterface;
+
+class BufferConverter11 : angle::NonCopyable
+{
+  public:
+    explicit BufferConverter11(Renderer11 *renderer);
+    ~BufferConverter11();
+
+    // Converts the first |count| indices of |source| into |dest|.  |*convertedOut| is set to
+    // false if the conversion isn't supported and has to be done on the CPU.
+    angle::Result convertIndices(const gl::Context *context,
+                                 Buffer11 *source,
+                                 gl::DrawElementsType srcType,
+                                 gl::DrawElementsType dstType,
+                                 unsigned int count,
+                                 bool usePrimitiveRestartFixedIndex,
+                                 StaticIndexBufferInterface *dest,
+                                 bool *convertedOut);
+
+    // Converts |count| elements of the attribute, starting |start| elements from its offset in
+    // |source|, into |dest|.  |*convertedOut| is set to false if the format or the alignment of
+    // the attribute isn't supported and the conversion has to be done on the CPU.
+    angle::Result convertVertices(const gl::Context *context,
+                                  Buffer11 *source,
+                                  const gl::VertexAttribute &attrib,
+                                  const gl::VertexBinding &binding,
+                                  GLint start,
+                                  GLsizei count,
+                                  StaticVertexBufferInterface *dest,
+                                  bool *convertedOut);
+
+  private:
+    // Matches the constant buffers of the shaders in BufferConverter11.cpp.
+    struct IndexConversionParams
+    {
+        unsigned int IndexCount;
+        unsigned int DestIndexShift;
+        unsigned int SourceRestartIndex;
+        unsigned int DestRestartIndex;
+        unsigned int ThreadsPerRow;
+        unsigned int Padding[3];
+    };
+
+    struct VertexConversionParams
+    {
+        unsigned int FirstWord;
+        unsigned int WordStride;
+        unsigned int VertexCount;
+        unsigned int ComponentCount;
+        unsigned int Conversion;
+        unsigned int ThreadsPerRow;
+        unsigned int Padding[2];
+    };
+
+    angle::Result loadResources(const gl::Context *context);
+    angle::Result dispatch(const gl::Context *context,
+                           ShaderExecutable11 *shader,
+                           const d3d11::Buffer &paramsBuffer,
+                           const d3d11::ShaderResourceView &sourceSRV,
+                           const d3d11::Buffer &dest,
+                           unsigned int destSize,
+                           unsigned int groupsX,
+                           unsigned int groupsY);
+
+    Renderer11 *mRenderer;
+
+    enum class ResourceState
+    {
+        Unloaded,
+        Loaded,
+        Failed,
+    };
+    ResourceState mResourceState;
+
+    std::unique_ptr<ShaderExecutableD3D> mIndexConversionCS;
+    std::unique_ptr<ShaderExecutableD3D> mVertexConversionCS;
+    d3d11::Buffer mIndexParamsBuffer;
+    d3d11::Buffer mVertexParamsBuffer;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_D3D_D3D11_BUFFERCONVERTER11_H_
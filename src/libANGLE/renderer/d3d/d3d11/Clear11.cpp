@@ -105,6 +105,56 @@ bool UpdateDataCache(RtvDsvClearInfo<T> *dataCache,
     return cacheDirty;
 }
 
+// Returns true if an integer clear value fits in a channel of the given size and survives the
+// round trip through float, in which case ClearRenderTargetView and ClearView write it exactly.
+bool IsIntegerClearValueExact(uint32_t value, GLuint bits)
+{
+    constexpr GLuint kMaxExactFloatBits = 24;
+    return bits == 0 || value <= (1u << std::min(bits, kMaxExactFloatBits)) - 1u;
+}
+
+bool IsIntegerClearValueExact(int32_t value, GLuint bits)
+{
+    constexpr GLuint kMaxExactFloatBits = 24;
+    if (bits == 0)
+    {
+        return true;
+    }
+    const int32_t maxValue = (1 << (std::min(bits, kMaxExactFloatBits) - 1)) - 1;
+    return value >= -maxValue - 1 && value <= maxValue;
+}
+
+template <typename T>
+bool CanClearIntegerWithFloatValues(const gl::Color<T> &color,
+                                    const gl::InternalFormat &formatInfo)
+{
+    return IsIntegerClearValueExact(color.red, formatInfo.redBits) &&
+           IsIntegerClearValueExact(color.green, formatInfo.greenBits) &&
+           IsIntegerClearValueExact(color.blue, formatInfo.blueBits) &&
+           IsIntegerClearValueExact(color.alpha, formatInfo.alphaBits);
+}
+
+// Returns the clear color as float values, which D3D11 converts to the render target's format.
+gl::ColorF GetClearColorAsFloat(const ClearParameters &clearParams)
+{
+    switch (clearParams.colorType)
+    {
+        case GL_UNSIGNED_INT:
+            return gl::ColorF(static_cast<float>(clearParams.colorUI.red),
+                              static_cast<float>(clearParams.colorUI.green),
+                              static_cast<float>(clearParams.colorUI.blue),
+                              static_cast<float>(clearParams.colorUI.alpha));
+        case GL_INT:
+            return gl::ColorF(static_cast<float>(clearParams.colorI.red),
+                              static_cast<float>(clearParams.colorI.green),
+                              static_cast<float>(clearParams.colorI.blue),
+                              static_cast<float>(clearParams.colorI.alpha));
+        default:
+            ASSERT(clearParams.colorType == GL_FLOAT);
+            return clearParams.colorF;
+    }
+}
+
 }  // anonymous namespace
 
 #define CLEARPS(Index)                                                                    \
@@ -456,6 +506,8 @@ angle::Result Clear11::clearFramebuffer(const gl::Context *context,
     uint32_t numRtvs        = 0;
     uint8_t commonColorMask = 0;
 
+    const gl::ColorF clearColor = GetClearColorAsFloat(clearParams);
+
     const auto &colorAttachments = fboData.getColorAttachments();
     for (auto colorAttachmentIndex : fboData.getEnabledDrawBuffers())
     {
@@ -501,8 +553,21 @@ angle::Result Clear11::clearFramebuffer(const gl::Context *context,
         const auto &framebufferRTV = renderTarget->getRenderTargetView();
         ASSERT(framebufferRTV.valid());
 
+        // Integer clears can skip the draw as well, as long as the values are exact as floats.
+        bool canUseFloatClearValues = true;
+        if (clearParams.colorType == GL_UNSIGNED_INT)
+        {
+            canUseFloatClearValues =
+                CanClearIntegerWithFloatValues(clearParams.colorUI, formatInfo);
+        }
+        else if (clearParams.colorType == GL_INT)
+        {
+            canUseFloatClearValues =
+                CanClearIntegerWithFloatValues(clearParams.colorI, formatInfo);
+        }
+
         if ((!(mRenderer->getRenderer11DeviceCaps().supportsClearView) && needScissoredClear) ||
-            clearParams.colorType != GL_FLOAT || (formatInfo.redBits > 0 && !r) ||
+            !canUseFloatClearValues || (formatInfo.redBits > 0 && !r) ||
             (formatInfo.greenBits > 0 && !g) || (formatInfo.blueBits > 0 && !b) ||
             (formatInfo.alphaBits > 0 && !a))
         {
@@ -520,16 +585,12 @@ angle::Result Clear11::clearFramebuffer(const gl::Context *context,
             // Check if the actual format has a channel that the internal format does not and
             // set them to the default values
             float clearValues[4] = {
-                ((formatInfo.redBits == 0 && nativeFormat.redBits > 0) ? 0.0f
-                                                                       : clearParams.colorF.red),
-                ((formatInfo.greenBits == 0 && nativeFormat.greenBits > 0)
-                     ? 0.0f
-                     : clearParams.colorF.green),
-                ((formatInfo.blueBits == 0 && nativeFormat.blueBits > 0) ? 0.0f
-                                                                         : clearParams.colorF.blue),
-                ((formatInfo.alphaBits == 0 && nativeFormat.alphaBits > 0)
-                     ? 1.0f
-                     : clearParams.colorF.alpha),
+                ((formatInfo.redBits == 0 && nativeFormat.redBits > 0) ? 0.0f : clearColor.red),
+                ((formatInfo.greenBits == 0 && nativeFormat.greenBits > 0) ? 0.0f
+                                                                           : clearColor.green),
+                ((formatInfo.blueBits == 0 && nativeFormat.blueBits > 0) ? 0.0f : clearColor.blue),
+                ((formatInfo.alphaBits == 0 && nativeFormat.alphaBits > 0) ? 1.0f
+                                                                           : clearColor.alpha),
             };
 
             if (formatInfo.alphaBits == 1)
@@ -537,7 +598,7 @@ angle::Result Clear11::clearFramebuffer(const gl::Context *context,
                 // Some drivers do not correctly handle calling Clear() on a format with 1-bit
                 // alpha. They can incorrectly round all non-zero values up to 1.0f. Note that
                 // WARP does not do this. We should handle the rounding for them instead.
-                clearValues[3] = (clearParams.colorF.alpha >= 0.5f) ? 1.0f : 0.0f;
+                clearValues[3] = (clearColor.alpha >= 0.5f) ? 1.0f : 0.0f;
             }
 
             if (needScissoredClear)
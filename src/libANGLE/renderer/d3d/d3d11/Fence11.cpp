@@ -50,8 +50,10 @@ angle::Result FenceTestHelper(const gl::Context *context,
     UINT getDataFlags = (flushCommandBuffer ? 0 : D3D11_ASYNC_GETDATA_DONOTFLUSH);
 
     Context11 *context11 = GetImplAs<Context11>(context);
+    ANGLE_TRY_HR(context11, fence->mRenderer->executeRecordedCommands(),
+                 "Failed to execute the recorded commands");
     HRESULT result =
-        fence->mRenderer->getDeviceContext()->GetData(fence->mQuery, nullptr, 0, getDataFlags);
+        fence->mRenderer->getImmediateContext()->GetData(fence->mQuery, nullptr, 0, getDataFlags);
     ANGLE_TRY_HR(context11, result, "Failed to get query data");
 
     ASSERT(result == S_OK || result == S_FALSE);
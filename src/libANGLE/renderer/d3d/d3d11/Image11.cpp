@@ -300,9 +300,11 @@ angle::Result Image11::loadData(const gl::Context *context,
     uint8_t *offsetMappedData = (static_cast<uint8_t *>(mappedImage.pData) +
                                  (area.y * mappedImage.RowPitch + area.x * outputPixelSize +
                                   area.z * mappedImage.DepthPitch));
-    loadFunction(area.width, area.height, area.depth,
-                 static_cast<const uint8_t *>(input) + inputSkipBytes, inputRowPitch,
-                 inputDepthPitch, offsetMappedData, mappedImage.RowPitch, mappedImage.DepthPitch);
+    LoadImageInParallel(formatInfo.compressed ? nullptr : context->getWorkerThreadPool(),
+                        loadFunction, area.width, area.height, area.depth,
+                        static_cast<const uint8_t *>(input) + inputSkipBytes, inputRowPitch,
+                        inputDepthPitch, offsetMappedData, mappedImage.RowPitch,
+                        mappedImage.DepthPitch);
 
     unmap();
 
@@ -649,8 +651,7 @@ angle::Result Image11::map(const gl::Context *context,
 
     if (!mStagingTextureSubresourceVerifier.wrap(mapType, map))
     {
-        ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
-        deviceContext->Unmap(mStagingTexture.get(), mStagingSubresource);
+        mRenderer->unmapResource(mStagingTexture.get(), mStagingSubresource);
         Context11 *context11 = GetImplAs<Context11>(context);
         context11->handleError(GL_OUT_OF_MEMORY,
                                "Failed to allocate staging texture mapping verifier buffer.",
@@ -668,8 +669,7 @@ void Image11::unmap()
     if (mStagingTexture.valid())
     {
         mStagingTextureSubresourceVerifier.unwrap();
-        ID3D11DeviceContext *deviceContext = mRenderer->getDeviceContext();
-        deviceContext->Unmap(mStagingTexture.get(), mStagingSubresource);
+        mRenderer->unmapResource(mStagingTexture.get(), mStagingSubresource);
     }
 }
 
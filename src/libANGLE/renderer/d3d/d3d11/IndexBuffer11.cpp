@@ -64,6 +64,34 @@ angle::Result IndexBuffer11::initialize(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result IndexBuffer11::initializeForUnorderedAccess(const gl::Context *context,
+                                                          unsigned int bufferSize,
+                                                          gl::DrawElementsType indexType)
+{
+    ASSERT(bufferSize > 0);
+
+    mBuffer.reset();
+
+    updateSerial();
+
+    D3D11_BUFFER_DESC bufferDesc;
+    bufferDesc.ByteWidth           = roundUpPow2(bufferSize, 4u);
+    bufferDesc.Usage               = D3D11_USAGE_DEFAULT;
+    bufferDesc.BindFlags           = D3D11_BIND_INDEX_BUFFER | D3D11_BIND_UNORDERED_ACCESS;
+    bufferDesc.CPUAccessFlags      = 0;
+    bufferDesc.MiscFlags           = D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS;
+    bufferDesc.StructureByteStride = 0;
+
+    ANGLE_TRY(mRenderer->allocateResource(GetImplAs<Context11>(context), bufferDesc, &mBuffer));
+    mBuffer.setInternalName("IndexBuffer11(static, converted)");
+
+    mBufferSize   = bufferDesc.ByteWidth;
+    mIndexType    = indexType;
+    mDynamicUsage = false;
+
+    return angle::Result::Continue;
+}
+
 angle::Result IndexBuffer11::mapBuffer(const gl::Context *context,
                                        unsigned int offset,
                                        unsigned int size,
@@ -92,8 +120,7 @@ angle::Result IndexBuffer11::unmapBuffer(const gl::Context *context)
     ANGLE_CHECK_HR(context11, mBuffer.valid(), "Internal index buffer is not initialized.",
                    E_OUTOFMEMORY);
 
-    ID3D11DeviceContext *dxContext = mRenderer->getDeviceContext();
-    dxContext->Unmap(mBuffer.get(), 0);
+    mRenderer->unmapResource(mBuffer.get(), 0);
     return angle::Result::Continue;
 }
 
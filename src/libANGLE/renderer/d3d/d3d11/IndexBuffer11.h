@@ -27,6 +27,12 @@ class IndexBuffer11 : public IndexBuffer
                              gl::DrawElementsType indexType,
                              bool dynamic) override;
 
+    // Creates a static buffer that is written by a compute shader through |getBuffer()| instead of
+    // being mapped.  |bufferSize| is rounded up to a multiple of four bytes.
+    angle::Result initializeForUnorderedAccess(const gl::Context *context,
+                                               unsigned int bufferSize,
+                                               gl::DrawElementsType indexType);
+
     angle::Result mapBuffer(const gl::Context *context,
                             unsigned int offset,
                             unsigned int size,
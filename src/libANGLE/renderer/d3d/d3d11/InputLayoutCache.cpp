@@ -9,9 +9,12 @@
 
 #include "libANGLE/renderer/d3d/d3d11/InputLayoutCache.h"
 
+#include "common/angle_version_info.h"
 #include "common/bitset_utils.h"
 #include "common/utilities.h"
+#include "libANGLE/BinaryStream.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Display.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/VertexArray.h"
 #include "libANGLE/VertexAttribute.h"
@@ -63,6 +66,47 @@ struct PackedAttribute
     uint32_t divisor;
 };
 
+// The semantic names of the input elements point to these strings, so the warm-up list saves the
+// names and maps them back when it's loaded.
+constexpr const char *kSemanticNames[] = {"TEXCOORD", "SPRITEPOSITION", "SPRITETEXCOORD"};
+
+const char *GetSemanticName(const std::string &name)
+{
+    for (const char *semanticName : kSemanticNames)
+    {
+        if (name == semanticName)
+        {
+            return semanticName;
+        }
+    }
+    return nullptr;
+}
+
+void ComputeWarmUpListKey(D3D_FEATURE_LEVEL featureLevel, egl::BlobCache::Key *hashOut)
+{
+    // The packed layouts contain the format IDs of this build, and the native vertex formats
+    // depend on the feature level.
+    gl::BinaryOutputStream keyStream;
+    keyStream.writeString("ANGLE D3D11 Input Layout Warm-Up List: ");
+    keyStream.writeBytes(reinterpret_cast<const unsigned char *>(angle::GetANGLECommitHash()),
+                         angle::GetANGLECommitHashSize());
+    keyStream.writeInt(static_cast<int>(featureLevel));
+
+    angle::base::SHA1HashBytes(static_cast<const unsigned char *>(keyStream.data()),
+                               keyStream.length(), hashOut->data());
+}
+
+void ComputeWarmUpVertexShaderKey(const ShaderData &vertexShaderData,
+                                  egl::BlobCache::Key *hashOut)
+{
+    gl::BinaryOutputStream keyStream;
+    keyStream.writeString("ANGLE D3D11 Input Layout Vertex Shader: ");
+    keyStream.writeBytes(vertexShaderData.get(), vertexShaderData.size());
+
+    angle::base::SHA1HashBytes(static_cast<const unsigned char *>(keyStream.data()),
+                               keyStream.length(), hashOut->data());
+}
+
 }  // anonymous namespace
 
 PackedAttributeLayout::PackedAttributeLayout() : numAttributes(0), flags(0), attributeData({}) {}
@@ -100,13 +144,230 @@ bool PackedAttributeLayout::operator==(const PackedAttributeLayout &other) const
            (attributeData == other.attributeData);
 }
 
-InputLayoutCache::InputLayoutCache() : mLayoutCache(kDefaultCacheSize * 2) {}
+InputLayoutCache::InputLayoutCache()
+    : mLayoutCache(kDefaultCacheSize * 2), mUnsavedWarmUpEntryCount(0), mWarmedUp(false)
+{}
 
 InputLayoutCache::~InputLayoutCache() {}
 
 void InputLayoutCache::clear()
 {
     mLayoutCache.Clear();
+    mWarmUpList.clear();
+    mWarmUpVertexShaderKeys.clear();
+    mUnsavedWarmUpEntryCount = 0;
+    mWarmedUp                = false;
+}
+
+angle::Result InputLayoutCache::warmUp(Context11 *context11)
+{
+    Renderer11 *renderer = context11->getRenderer();
+    if (mWarmedUp || !renderer->getFeatures().warmUpInputLayoutCache.enabled)
+    {
+        return angle::Result::Continue;
+    }
+    mWarmedUp = true;
+
+    egl::Display *display          = renderer->getDisplay();
+    D3D_FEATURE_LEVEL featureLevel = renderer->getRenderer11DeviceCaps().featureLevel;
+
+    egl::BlobCache::Key listKey;
+    ComputeWarmUpListKey(featureLevel, &listKey);
+
+    // The blob cache content isn't trusted; the entries are checked as they are read, and stop
+    // the warm-up at the first one that isn't valid.
+    std::vector<WarmUpEntry> entries;
+    {
+        angle::ScratchBuffer scratchBuffer;
+        egl::BlobCache::Value listBlob;
+        size_t listBlobSize = 0;
+        std::lock_guard<std::mutex> cacheLock(display->getProgramCacheMutex());
+        if (!display->getBlobCache().get(&scratchBuffer, listKey, &listBlob, &listBlobSize))
+        {
+            return angle::Result::Continue;
+        }
+
+        gl::BinaryInputStream stream(listBlob.data(), listBlobSize);
+        size_t entryCount = stream.readInt<size_t>();
+        for (size_t entryIndex = 0;
+             !stream.error() && entryIndex < std::min(entryCount, kMaxWarmUpListSize); ++entryIndex)
+        {
+            WarmUpEntry entry;
+            entry.layout.numAttributes = stream.readInt<uint32_t>();
+            entry.layout.flags         = stream.readInt<uint32_t>();
+            if (entry.layout.numAttributes > gl::MAX_VERTEX_ATTRIBS)
+            {
+                break;
+            }
+            for (uint32_t attribIndex = 0; attribIndex < entry.layout.numAttributes;
+                 ++attribIndex)
+            {
+                entry.layout.attributeData[attribIndex] = stream.readInt<uint64_t>();
+            }
+
+            // Two more elements are used by instanced point sprite emulation.
+            size_t elementCount = stream.readInt<size_t>();
+            if (elementCount > gl::MAX_VERTEX_ATTRIBS + 2)
+            {
+                break;
+            }
+            entry.inputElements.resize(elementCount);
+            bool validNames = true;
+            for (D3D11_INPUT_ELEMENT_DESC &element : entry.inputElements)
+            {
+                element.SemanticName         = GetSemanticName(stream.readString());
+                element.SemanticIndex        = stream.readInt<UINT>();
+                element.Format               = stream.readEnum<DXGI_FORMAT>();
+                element.InputSlot            = stream.readInt<UINT>();
+                element.AlignedByteOffset    = stream.readInt<UINT>();
+                element.InputSlotClass       = stream.readEnum<D3D11_INPUT_CLASSIFICATION>();
+                element.InstanceDataStepRate = stream.readInt<UINT>();
+                validNames                   = validNames && element.SemanticName != nullptr;
+            }
+            stream.readBytes(entry.vertexShaderKey.data(), entry.vertexShaderKey.size());
+
+            if (stream.error() || !validNames)
+            {
+                break;
+            }
+            entries.push_back(std::move(entry));
+        }
+    }
+
+    for (WarmUpEntry &entry : entries)
+    {
+        if (mLayoutCache.Peek(entry.layout) != mLayoutCache.end())
+        {
+            continue;
+        }
+
+        // The vertex shader may have been evicted from the blob cache since the list was saved.
+        angle::ScratchBuffer scratchBuffer;
+        egl::BlobCache::Value vertexShaderBlob;
+        size_t vertexShaderBlobSize = 0;
+        std::lock_guard<std::mutex> cacheLock(display->getProgramCacheMutex());
+        if (!display->getBlobCache().get(&scratchBuffer, entry.vertexShaderKey, &vertexShaderBlob,
+                                         &vertexShaderBlobSize))
+        {
+            continue;
+        }
+
+        InputElementArray inputElementArray(entry.inputElements.data(),
+                                            entry.inputElements.size());
+        ShaderData vertexShaderData(vertexShaderBlob.data(), vertexShaderBlobSize);
+
+        // Without an output, CreateInputLayout only validates its parameters, which keeps a
+        // corrupt entry from generating an error in the context.
+        HRESULT result = renderer->getDevice()->CreateInputLayout(
+            inputElementArray.get(), static_cast<UINT>(inputElementArray.size()),
+            vertexShaderData.get(), vertexShaderData.size(), nullptr);
+        if (result != S_FALSE)
+        {
+            continue;
+        }
+
+        d3d11::InputLayout inputLayout;
+        ANGLE_TRY(renderer->allocateResource(context11, inputElementArray, &vertexShaderData,
+                                             &inputLayout));
+        mLayoutCache.Put(entry.layout, std::move(inputLayout));
+
+        mWarmUpVertexShaderKeys.insert(entry.vertexShaderKey);
+        mWarmUpList.push_back(std::move(entry));
+    }
+
+    return angle::Result::Continue;
+}
+
+void InputLayoutCache::saveWarmUpList(Renderer11 *renderer)
+{
+    if (mUnsavedWarmUpEntryCount == 0)
+    {
+        return;
+    }
+    mUnsavedWarmUpEntryCount = 0;
+
+    gl::BinaryOutputStream stream;
+    stream.writeInt(mWarmUpList.size());
+    for (const WarmUpEntry &entry : mWarmUpList)
+    {
+        stream.writeInt(entry.layout.numAttributes);
+        stream.writeInt(entry.layout.flags);
+        for (uint32_t attribIndex = 0; attribIndex < entry.layout.numAttributes; ++attribIndex)
+        {
+            stream.writeInt(entry.layout.attributeData[attribIndex]);
+        }
+
+        stream.writeInt(entry.inputElements.size());
+        for (const D3D11_INPUT_ELEMENT_DESC &element : entry.inputElements)
+        {
+            stream.writeString(element.SemanticName);
+            stream.writeInt(element.SemanticIndex);
+            stream.writeEnum(element.Format);
+            stream.writeInt(element.InputSlot);
+            stream.writeInt(element.AlignedByteOffset);
+            stream.writeEnum(element.InputSlotClass);
+            stream.writeInt(element.InstanceDataStepRate);
+        }
+        stream.writeBytes(entry.vertexShaderKey.data(), entry.vertexShaderKey.size());
+    }
+
+    angle::MemoryBuffer listBlob;
+    if (!listBlob.resize(stream.length()))
+    {
+        return;
+    }
+    memcpy(listBlob.data(), stream.data(), stream.length());
+
+    egl::BlobCache::Key listKey;
+    ComputeWarmUpListKey(renderer->getRenderer11DeviceCaps().featureLevel, &listKey);
+
+    egl::Display *display = renderer->getDisplay();
+    std::lock_guard<std::mutex> cacheLock(display->getProgramCacheMutex());
+    display->getBlobCache().put(listKey, std::move(listBlob));
+}
+
+void InputLayoutCache::addToWarmUpList(Renderer11 *renderer,
+                                       const PackedAttributeLayout &layout,
+                                       const InputElementArray &inputElements,
+                                       const ShaderData &vertexShaderData)
+{
+    if (!renderer->getFeatures().warmUpInputLayoutCache.enabled)
+    {
+        return;
+    }
+
+    WarmUpEntry entry;
+    entry.layout = layout;
+    entry.inputElements.assign(inputElements.get(), inputElements.get() + inputElements.size());
+    ComputeWarmUpVertexShaderKey(vertexShaderData, &entry.vertexShaderKey);
+
+    // Many input layouts are created for the same vertex shader, which is only put in the blob
+    // cache once.
+    if (mWarmUpVertexShaderKeys.count(entry.vertexShaderKey) == 0)
+    {
+        angle::MemoryBuffer vertexShaderCopy;
+        if (!vertexShaderCopy.resize(vertexShaderData.size()))
+        {
+            return;
+        }
+        memcpy(vertexShaderCopy.data(), vertexShaderData.get(), vertexShaderData.size());
+
+        egl::Display *display = renderer->getDisplay();
+        std::lock_guard<std::mutex> cacheLock(display->getProgramCacheMutex());
+        display->getBlobCache().put(entry.vertexShaderKey, std::move(vertexShaderCopy));
+        mWarmUpVertexShaderKeys.insert(entry.vertexShaderKey);
+    }
+
+    mWarmUpList.push_back(std::move(entry));
+    if (mWarmUpList.size() > kMaxWarmUpListSize)
+    {
+        mWarmUpList.pop_front();
+    }
+
+    if (++mUnsavedWarmUpEntryCount >= kWarmUpListSaveInterval)
+    {
+        saveWarmUpList(renderer);
+    }
 }
 
 angle::Result InputLayoutCache::getInputLayout(
@@ -179,8 +440,9 @@ angle::Result InputLayoutCache::getInputLayout(
             angle::TrimCache(mLayoutCache.max_size() / 2, kGCLimit, "input layout", &mLayoutCache);
 
             d3d11::InputLayout newInputLayout;
-            ANGLE_TRY(createInputLayout(context11, sortedSemanticIndices, currentAttributes, mode,
-                                        vertexCount, instances, &newInputLayout));
+            ANGLE_TRY(createInputLayout(context11, layout, sortedSemanticIndices,
+                                        currentAttributes, mode, vertexCount, instances,
+                                        &newInputLayout));
 
             auto insertIt   = mLayoutCache.Put(layout, std::move(newInputLayout));
             *inputLayoutOut = &insertIt->second;
@@ -192,6 +454,7 @@ angle::Result InputLayoutCache::getInputLayout(
 
 angle::Result InputLayoutCache::createInputLayout(
     Context11 *context11,
+    const PackedAttributeLayout &layout,
     const AttribIndexArray &sortedSemanticIndices,
     const std::vector<const TranslatedAttribute *> &currentAttributes,
     gl::PrimitiveMode mode,
@@ -205,6 +468,8 @@ angle::Result InputLayoutCache::createInputLayout(
 
     bool programUsesInstancedPointSprites =
         programD3D->usesPointSize() && programD3D->usesInstancedPointSpriteEmulation();
+    bool programUsesPointSpriteBuffers =
+        programUsesInstancedPointSprites && !programD3D->usesVertexIdPointSpriteExpansion();
 
     unsigned int inputElementCount = 0;
     gl::AttribArray<D3D11_INPUT_ELEMENT_DESC> inputElements;
@@ -268,9 +533,17 @@ angle::Result InputLayoutCache::createInputLayout(
                     inputElements[elementIndex].InstanceDataStepRate = numIndicesPerInstance;
                 }
             }
-            inputElements[elementIndex].InputSlot++;
+
+            // Point sprites expanded from the vertex ID don't use the sprite vertex buffer slot.
+            if (programUsesPointSpriteBuffers)
+            {
+                inputElements[elementIndex].InputSlot++;
+            }
         }
+    }
 
+    if (programUsesPointSpriteBuffers)
+    {
         inputElements[inputElementCount].SemanticName         = "SPRITEPOSITION";
         inputElements[inputElementCount].SemanticIndex        = 0;
         inputElements[inputElementCount].Format               = DXGI_FORMAT_R32G32B32_FLOAT;
@@ -300,6 +573,8 @@ angle::Result InputLayoutCache::createInputLayout(
 
     ANGLE_TRY(renderer->allocateResource(context11, inputElementArray, &vertexShaderData,
                                          inputLayoutOut));
+
+    addToWarmUpList(renderer, layout, inputElementArray, vertexShaderData);
     return angle::Result::Continue;
 }
 
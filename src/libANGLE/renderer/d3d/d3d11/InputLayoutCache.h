@@ -15,9 +15,12 @@
 #include <cstddef>
 
 #include <array>
+#include <deque>
 #include <map>
+#include <set>
 
 #include "common/angleutils.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/Constants.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/SizedMRUCache.h"
@@ -86,8 +89,17 @@ class InputLayoutCache : angle::NonCopyable
 
     void clear();
 
+    // Creates the input layouts of the warm-up list saved in the blob cache by a previous run, so
+    // the first draws that need them find them in the cache.  Only the first call has an effect.
+    angle::Result warmUp(Context11 *context11);
+
+    // Saves the input layouts created so far to the blob cache, along with the vertex shaders
+    // they were validated against.
+    void saveWarmUpList(Renderer11 *renderer);
+
     // Useful for testing
     void setCacheSize(size_t newCacheSize);
+    size_t getCachedLayoutCount() const { return mLayoutCache.size(); }
 
     angle::Result getInputLayout(Context11 *context,
                                  const gl::State &state,
@@ -101,6 +113,7 @@ class InputLayoutCache : angle::NonCopyable
   private:
     angle::Result createInputLayout(
         Context11 *context11,
+        const PackedAttributeLayout &layout,
         const AttribIndexArray &sortedSemanticIndices,
         const std::vector<const TranslatedAttribute *> &currentAttributes,
         gl::PrimitiveMode mode,
@@ -108,14 +121,38 @@ class InputLayoutCache : angle::NonCopyable
         GLsizei instances,
         d3d11::InputLayout *inputLayoutOut);
 
+    void addToWarmUpList(Renderer11 *renderer,
+                         const PackedAttributeLayout &layout,
+                         const InputElementArray &inputElements,
+                         const ShaderData &vertexShaderData);
+
     // Starting cache size.
-    static constexpr size_t kDefaultCacheSize = 1024;
+    static constexpr size_t kDefaultCacheSize = 4096;
 
     // The cache tries to clean up this many states at once.
     static constexpr size_t kGCLimit = 128;
 
+    // The most recently created input layouts that are remembered for the next run.
+    static constexpr size_t kMaxWarmUpListSize = 512;
+
+    // The warm-up list is saved again each time this many input layouts are added to it.
+    static constexpr size_t kWarmUpListSaveInterval = 32;
+
     using LayoutCache = angle::base::HashingMRUCache<PackedAttributeLayout, d3d11::InputLayout>;
     LayoutCache mLayoutCache;
+
+    struct WarmUpEntry
+    {
+        PackedAttributeLayout layout;
+        std::vector<D3D11_INPUT_ELEMENT_DESC> inputElements;
+        egl::BlobCache::Key vertexShaderKey;
+    };
+
+    std::deque<WarmUpEntry> mWarmUpList;
+    // The vertex shaders of the warm-up list that are already in the blob cache.
+    std::set<egl::BlobCache::Key> mWarmUpVertexShaderKeys;
+    size_t mUnsavedWarmUpEntryCount;
+    bool mWarmedUp;
 };
 
 }  // namespace rx
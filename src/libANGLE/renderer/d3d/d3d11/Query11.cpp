@@ -218,7 +218,10 @@ angle::Result Query11::testQuery(Context11 *context11, QueryState *queryState)
 {
     if (!queryState->finished)
     {
-        ID3D11DeviceContext *context = mRenderer->getDeviceContext();
+        // The query has to be ended on the GPU before its data can be available.
+        ANGLE_TRY_HR(context11, mRenderer->executeRecordedCommands(),
+                     "Failed to execute the recorded commands");
+        ID3D11DeviceContext *context = mRenderer->getImmediateContext();
         switch (getType())
         {
             case gl::QueryType::AnySamples:
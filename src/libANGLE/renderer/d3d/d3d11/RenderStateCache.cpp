@@ -12,8 +12,11 @@
 #include <float.h>
 
 #include "common/Color.h"
+#include "common/angle_version_info.h"
 #include "common/debug.h"
+#include "libANGLE/BinaryStream.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/Display.h"
 #include "libANGLE/Framebuffer.h"
 #include "libANGLE/FramebufferAttachment.h"
 #include "libANGLE/renderer/d3d/d3d11/Context11.h"
@@ -25,98 +28,53 @@ namespace rx
 {
 using namespace gl_d3d11;
 
-RenderStateCache::RenderStateCache()
-    : mBlendStateCache(kMaxStates),
-      mRasterizerStateCache(kMaxStates),
-      mDepthStencilStateCache(kMaxStates),
-      mSamplerStateCache(kMaxStates)
-{}
-
-RenderStateCache::~RenderStateCache() {}
-
-void RenderStateCache::clear()
+namespace
+{
+void ComputeProfileKey(D3D_FEATURE_LEVEL featureLevel, egl::BlobCache::Key *hashOut)
 {
-    mBlendStateCache.Clear();
-    mRasterizerStateCache.Clear();
-    mDepthStencilStateCache.Clear();
-    mSamplerStateCache.Clear();
+    // The keys are saved as they are laid out in memory by this build, and the sampler states
+    // depend on the feature level.
+    gl::BinaryOutputStream keyStream;
+    keyStream.writeString("ANGLE D3D11 Render State Profile: ");
+    keyStream.writeBytes(reinterpret_cast<const unsigned char *>(angle::GetANGLECommitHash()),
+                         angle::GetANGLECommitHashSize());
+    keyStream.writeInt(static_cast<int>(featureLevel));
+
+    angle::base::SHA1HashBytes(static_cast<const unsigned char *>(keyStream.data()),
+                               keyStream.length(), hashOut->data());
 }
 
-// static
-d3d11::BlendStateKey RenderStateCache::GetBlendStateKey(const gl::Context *context,
-                                                        Framebuffer11 *framebuffer11,
-                                                        const gl::BlendStateExt &blendStateExt,
-                                                        bool sampleAlphaToCoverage)
+// The state keys are compared and hashed as plain memory, and that is how they are saved too.
+template <typename KeyT>
+void WriteProfile(gl::BinaryOutputStream *stream, const std::vector<KeyT> &profile)
 {
-    d3d11::BlendStateKey key;
-    // All fields of the BlendStateExt inside the key should be initialized for the caching to
-    // work correctly. Due to mrt_perf_workaround, the actual indices of active draw buffers may be
-    // different, so both arrays should be tracked.
-    key.blendStateExt                      = gl::BlendStateExt(blendStateExt.getDrawBufferCount());
-    const gl::AttachmentList &colorbuffers = framebuffer11->getColorAttachmentsForRender(context);
-    const gl::DrawBufferMask colorAttachmentsForRenderMask =
-        framebuffer11->getLastColorAttachmentsForRenderMask();
-
-    ASSERT(blendStateExt.getDrawBufferCount() <= colorAttachmentsForRenderMask.size());
-    ASSERT(colorbuffers.size() == colorAttachmentsForRenderMask.count());
-
-    size_t keyBlendIndex = 0;
-
-    // With blending disabled, factors and equations are ignored when building
-    // D3D11_RENDER_TARGET_BLEND_DESC, so we can reduce the amount of unique keys by
-    // enforcing default values.
-    for (size_t sourceIndex : colorAttachmentsForRenderMask)
+    static_assert(std::is_standard_layout<KeyT>::value, "Keys are saved as plain memory");
+    stream->writeInt(profile.size());
+    for (const KeyT &key : profile)
     {
-        ASSERT(keyBlendIndex < colorbuffers.size());
-        const gl::FramebufferAttachment *attachment = colorbuffers[keyBlendIndex];
-
-        // Do not set blend state for null attachments that may be present when
-        // mrt_perf_workaround is disabled.
-        if (attachment == nullptr)
-        {
-            keyBlendIndex++;
-            continue;
-        }
-
-        const uint8_t colorMask = blendStateExt.getColorMaskIndexed(sourceIndex);
-
-        const gl::InternalFormat &internalFormat = *attachment->getFormat().info;
-
-        key.blendStateExt.setColorMaskIndexed(keyBlendIndex,
-                                              gl_d3d11::GetColorMask(internalFormat) & colorMask);
-        key.rtvMax = static_cast<uint16_t>(keyBlendIndex) + 1;
-
-        // Some D3D11 drivers produce unexpected results when blending is enabled for integer
-        // attachments. Per OpenGL ES spec, it must be ignored anyway. When blending is disabled,
-        // the state remains default to reduce the number of unique keys.
-        if (blendStateExt.getEnabledMask().test(sourceIndex) && !internalFormat.isInt())
-        {
-            key.blendStateExt.setEnabledIndexed(keyBlendIndex, true);
-            key.blendStateExt.setEquationsIndexed(keyBlendIndex, sourceIndex, blendStateExt);
-            key.blendStateExt.setFactorsIndexed(keyBlendIndex, sourceIndex, blendStateExt);
-        }
-        keyBlendIndex++;
+        stream->writeBytes(reinterpret_cast<const uint8_t *>(&key), sizeof(KeyT));
     }
-
-    key.sampleAlphaToCoverage = sampleAlphaToCoverage ? 1 : 0;
-    return key;
 }
 
-angle::Result RenderStateCache::getBlendState(const gl::Context *context,
-                                              Renderer11 *renderer,
-                                              const d3d11::BlendStateKey &key,
-                                              const d3d11::BlendState **outBlendState)
+template <typename KeyT>
+bool ReadProfile(gl::BinaryInputStream *stream, size_t maxKeys, std::vector<KeyT> *profileOut)
 {
-    auto keyIter = mBlendStateCache.Get(key);
-    if (keyIter != mBlendStateCache.end())
+    size_t keyCount = stream->readInt<size_t>();
+    if (stream->error() || keyCount > maxKeys)
     {
-        *outBlendState = &keyIter->second;
-        return angle::Result::Continue;
+        return false;
     }
 
-    TrimCache(kMaxStates, kGCLimit, "blend state", &mBlendStateCache);
+    profileOut->resize(keyCount);
+    for (KeyT &key : *profileOut)
+    {
+        stream->readBytes(reinterpret_cast<uint8_t *>(&key), sizeof(KeyT));
+    }
+    return !stream->error();
+}
 
-    // Create a new blend state and insert it into the cache
+D3D11_BLEND_DESC GetBlendDesc(const d3d11::BlendStateKey &key)
+{
     D3D11_BLEND_DESC blendDesc             = {};  // avoid undefined fields
     const gl::BlendStateExt &blendStateExt = key.blendStateExt;
 
@@ -152,33 +110,12 @@ angle::Result RenderStateCache::getBlendState(const gl::Context *context,
         rtDesc.RenderTargetWriteMask = blendStateExt.getColorMaskIndexed(i);
     }
 
-    d3d11::BlendState d3dBlendState;
-    ANGLE_TRY(renderer->allocateResource(GetImplAs<Context11>(context), blendDesc, &d3dBlendState));
-    const auto &iter = mBlendStateCache.Put(key, std::move(d3dBlendState));
-
-    *outBlendState = &iter->second;
-
-    return angle::Result::Continue;
+    return blendDesc;
 }
 
-angle::Result RenderStateCache::getRasterizerState(const gl::Context *context,
-                                                   Renderer11 *renderer,
-                                                   const gl::RasterizerState &rasterState,
-                                                   bool scissorEnabled,
-                                                   ID3D11RasterizerState **outRasterizerState)
+D3D11_RASTERIZER_DESC GetRasterizerDesc(const d3d11::RasterizerStateKey &key)
 {
-    d3d11::RasterizerStateKey key;
-    key.rasterizerState = rasterState;
-    key.scissorEnabled  = scissorEnabled ? 1 : 0;
-
-    auto keyIter = mRasterizerStateCache.Get(key);
-    if (keyIter != mRasterizerStateCache.end())
-    {
-        *outRasterizerState = keyIter->second.get();
-        return angle::Result::Continue;
-    }
-
-    TrimCache(kMaxStates, kGCLimit, "rasterizer state", &mRasterizerStateCache);
+    const gl::RasterizerState &rasterState = key.rasterizerState;
 
     D3D11_CULL_MODE cullMode =
         gl_d3d11::ConvertCullMode(rasterState.cullFace, rasterState.cullMode);
@@ -196,7 +133,7 @@ angle::Result RenderStateCache::getRasterizerState(const gl::Context *context,
     rasterDesc.DepthBiasClamp = 0.0f;  // MSDN documentation of DepthBiasClamp implies a value of
                                        // zero will preform no clamping, must be tested though.
     rasterDesc.DepthClipEnable       = TRUE;
-    rasterDesc.ScissorEnable         = scissorEnabled ? TRUE : FALSE;
+    rasterDesc.ScissorEnable         = key.scissorEnabled ? TRUE : FALSE;
     rasterDesc.MultisampleEnable     = rasterState.multiSample;
     rasterDesc.AntialiasedLineEnable = FALSE;
 
@@ -211,29 +148,11 @@ angle::Result RenderStateCache::getRasterizerState(const gl::Context *context,
         rasterDesc.DepthBias            = 0;
     }
 
-    d3d11::RasterizerState dx11RasterizerState;
-    ANGLE_TRY(renderer->allocateResource(GetImplAs<Context11>(context), rasterDesc,
-                                         &dx11RasterizerState));
-    *outRasterizerState = dx11RasterizerState.get();
-    mRasterizerStateCache.Put(key, std::move(dx11RasterizerState));
-
-    return angle::Result::Continue;
+    return rasterDesc;
 }
 
-angle::Result RenderStateCache::getDepthStencilState(const gl::Context *context,
-                                                     Renderer11 *renderer,
-                                                     const gl::DepthStencilState &glState,
-                                                     const d3d11::DepthStencilState **outDSState)
+D3D11_DEPTH_STENCIL_DESC GetDepthStencilDesc(const gl::DepthStencilState &glState)
 {
-    auto keyIter = mDepthStencilStateCache.Get(glState);
-    if (keyIter != mDepthStencilStateCache.end())
-    {
-        *outDSState = &keyIter->second;
-        return angle::Result::Continue;
-    }
-
-    TrimCache(kMaxStates, kGCLimit, "depth stencil state", &mDepthStencilStateCache);
-
     D3D11_DEPTH_STENCIL_DESC dsDesc     = {};
     dsDesc.DepthEnable                  = glState.depthTest ? TRUE : FALSE;
     dsDesc.DepthWriteMask               = ConvertDepthMask(glState.depthMask);
@@ -249,33 +168,12 @@ angle::Result RenderStateCache::getDepthStencilState(const gl::Context *context,
     dsDesc.BackFace.StencilDepthFailOp  = ConvertStencilOp(glState.stencilBackPassDepthFail);
     dsDesc.BackFace.StencilPassOp       = ConvertStencilOp(glState.stencilBackPassDepthPass);
     dsDesc.BackFace.StencilFunc         = ConvertComparison(glState.stencilBackFunc);
-
-    d3d11::DepthStencilState dx11DepthStencilState;
-    ANGLE_TRY(
-        renderer->allocateResource(GetImplAs<Context11>(context), dsDesc, &dx11DepthStencilState));
-    const auto &iter = mDepthStencilStateCache.Put(glState, std::move(dx11DepthStencilState));
-
-    *outDSState = &iter->second;
-
-    return angle::Result::Continue;
+    return dsDesc;
 }
 
-angle::Result RenderStateCache::getSamplerState(const gl::Context *context,
-                                                Renderer11 *renderer,
-                                                const gl::SamplerState &samplerState,
-                                                ID3D11SamplerState **outSamplerState)
+D3D11_SAMPLER_DESC GetSamplerDesc(const gl::SamplerState &samplerState,
+                                  D3D_FEATURE_LEVEL featureLevel)
 {
-    auto keyIter = mSamplerStateCache.Get(samplerState);
-    if (keyIter != mSamplerStateCache.end())
-    {
-        *outSamplerState = keyIter->second.get();
-        return angle::Result::Continue;
-    }
-
-    TrimCache(kMaxStates, kGCLimit, "sampler state", &mSamplerStateCache);
-
-    const auto &featureLevel = renderer->getRenderer11DeviceCaps().featureLevel;
-
     D3D11_SAMPLER_DESC samplerDesc;
     samplerDesc.Filter =
         gl_d3d11::ConvertFilter(samplerState.getMinFilter(), samplerState.getMagFilter(),
@@ -311,12 +209,478 @@ angle::Result RenderStateCache::getSamplerState(const gl::Context *context,
         samplerDesc.MaxLOD = FLT_MAX;
     }
 
-    d3d11::SamplerState dx11SamplerState;
-    ANGLE_TRY(
-        renderer->allocateResource(GetImplAs<Context11>(context), samplerDesc, &dx11SamplerState));
-    *outSamplerState = dx11SamplerState.get();
-    mSamplerStateCache.Put(samplerState, std::move(dx11SamplerState));
+    return samplerDesc;
+}
+}  // anonymous namespace
+
+// Creates the states of a profile on a worker thread.  The D3D11 device is free-threaded, and the
+// states are only added to the cache while there is room for them, so that precreation never
+// evicts a state a draw is about to use.
+class RenderStateCache::PrecreateStatesTask final : public angle::Closure, public d3d::Context
+{
+  public:
+    PrecreateStatesTask(RenderStateCache *cache, Renderer11 *renderer)
+        : mCache(cache), mRenderer(renderer)
+    {}
+
+    void operator()() override
+    {
+        precreate(&mCache->mBlendStates, mBlendStateKeys,
+                  [](const d3d11::BlendStateKey &key) { return GetBlendDesc(key); });
+        precreate(&mCache->mRasterizerStates, mRasterizerStateKeys,
+                  [](const d3d11::RasterizerStateKey &key) { return GetRasterizerDesc(key); });
+        precreate(&mCache->mDepthStencilStates, mDepthStencilStateKeys,
+                  [](const gl::DepthStencilState &key) { return GetDepthStencilDesc(key); });
+
+        const D3D_FEATURE_LEVEL featureLevel = mRenderer->getRenderer11DeviceCaps().featureLevel;
+        precreate(&mCache->mSamplerStates, mSamplerStateKeys,
+                  [featureLevel](const gl::SamplerState &key) {
+                      return GetSamplerDesc(key, featureLevel);
+                  });
+    }
+
+    // A state that fails to be created is left for the draw that needs it to create.
+    void handleResult(HRESULT hr,
+                      const char *message,
+                      const char *file,
+                      const char *function,
+                      unsigned int line) override
+    {
+        WARN() << "Failed to precreate a render state: " << message << " (" << gl::FmtHR(hr)
+               << ")";
+    }
+
+    std::vector<d3d11::BlendStateKey> mBlendStateKeys;
+    std::vector<d3d11::RasterizerStateKey> mRasterizerStateKeys;
+    std::vector<gl::DepthStencilState> mDepthStencilStateKeys;
+    std::vector<gl::SamplerState> mSamplerStateKeys;
+
+  private:
+    template <typename KeyT, typename StateT, typename GetDescT>
+    void precreate(StateShard<KeyT, StateT> *shard,
+                   const std::vector<KeyT> &keys,
+                   GetDescT &&getDesc)
+    {
+        for (const KeyT &key : keys)
+        {
+            {
+                std::lock_guard<std::mutex> lock(shard->mutex);
+                if (shard->cache.size() >= kMaxStates ||
+                    shard->cache.Peek(key) != shard->cache.end())
+                {
+                    continue;
+                }
+            }
+
+            // The state is created without holding the lock, so the draws on other threads
+            // aren't held up by the device.
+            StateT state;
+            if (mRenderer->allocateResource(this, getDesc(key), &state) != angle::Result::Continue)
+            {
+                continue;
+            }
+
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            if (shard->cache.size() < kMaxStates && shard->cache.Peek(key) == shard->cache.end())
+            {
+                shard->cache.Put(key, std::move(state));
+            }
+        }
+    }
+
+    RenderStateCache *mCache;
+    Renderer11 *mRenderer;
+};
+
+RenderStateCache::RenderStateCache()
+    : mBlendStates(kMaxStates),
+      mRasterizerStates(kMaxStates),
+      mDepthStencilStates(kMaxStates),
+      mSamplerStates(kMaxStates),
+      mUnsavedProfileStateCount(0),
+      mPrecreated(false)
+{}
+
+RenderStateCache::~RenderStateCache()
+{
+    waitForPrecreation();
+}
+
+void RenderStateCache::clear()
+{
+    waitForPrecreation();
+
+    mBlendStates.cache.Clear();
+    mBlendStates.profile.clear();
+    mRasterizerStates.cache.Clear();
+    mRasterizerStates.profile.clear();
+    mDepthStencilStates.cache.Clear();
+    mDepthStencilStates.profile.clear();
+    mSamplerStates.cache.Clear();
+    mSamplerStates.profile.clear();
+    mUnsavedProfileStateCount = 0;
+    mPrecreated               = false;
+}
+
+void RenderStateCache::waitForPrecreation()
+{
+    if (mPrecreateEvent)
+    {
+        mPrecreateEvent->wait();
+        mPrecreateEvent.reset();
+    }
+}
+
+size_t RenderStateCache::getCachedStateCount()
+{
+    size_t count = 0;
+    {
+        std::lock_guard<std::mutex> lock(mBlendStates.mutex);
+        count += mBlendStates.cache.size();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mRasterizerStates.mutex);
+        count += mRasterizerStates.cache.size();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mDepthStencilStates.mutex);
+        count += mDepthStencilStates.cache.size();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mSamplerStates.mutex);
+        count += mSamplerStates.cache.size();
+    }
+    return count;
+}
+
+void RenderStateCache::precreateStates(const gl::Context *context, Renderer11 *renderer)
+{
+    if (mPrecreated || !renderer->getFeatures().precreateRenderStates.enabled)
+    {
+        return;
+    }
+    mPrecreated = true;
+
+    egl::BlobCache::Key profileKey;
+    ComputeProfileKey(renderer->getRenderer11DeviceCaps().featureLevel, &profileKey);
+
+    auto task = std::make_shared<PrecreateStatesTask>(this, renderer);
+    {
+        angle::ScratchBuffer scratchBuffer;
+        egl::BlobCache::Value profileBlob;
+        size_t profileBlobSize = 0;
+        egl::Display *display  = renderer->getDisplay();
+        std::lock_guard<std::mutex> cacheLock(display->getProgramCacheMutex());
+        if (!display->getBlobCache().get(&scratchBuffer, profileKey, &profileBlob,
+                                         &profileBlobSize))
+        {
+            return;
+        }
+
+        // The blob cache content isn't trusted, and a key that doesn't hold valid GL enums would
+        // trip the asserts of the conversions to D3D11 descs, so the profile is checksummed.
+        std::array<uint8_t, angle::base::kSHA1Length> checksum;
+        if (profileBlobSize < checksum.size())
+        {
+            return;
+        }
+        angle::base::SHA1HashBytes(profileBlob.data() + checksum.size(),
+                                   profileBlobSize - checksum.size(), checksum.data());
+        if (memcmp(checksum.data(), profileBlob.data(), checksum.size()) != 0)
+        {
+            return;
+        }
+
+        gl::BinaryInputStream stream(profileBlob.data() + checksum.size(),
+                                     profileBlobSize - checksum.size());
+        if (!ReadProfile(&stream, kMaxProfileStates, &task->mBlendStateKeys) ||
+            !ReadProfile(&stream, kMaxProfileStates, &task->mRasterizerStateKeys) ||
+            !ReadProfile(&stream, kMaxProfileStates, &task->mDepthStencilStateKeys) ||
+            !ReadProfile(&stream, kMaxProfileStates, &task->mSamplerStateKeys))
+        {
+            return;
+        }
+    }
+
+    // The precreated states stay in the profile, whether or not this run ends up using them.
+    {
+        std::lock_guard<std::mutex> lock(mBlendStates.mutex);
+        mBlendStates.profile = task->mBlendStateKeys;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mRasterizerStates.mutex);
+        mRasterizerStates.profile = task->mRasterizerStateKeys;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mDepthStencilStates.mutex);
+        mDepthStencilStates.profile = task->mDepthStencilStateKeys;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mSamplerStates.mutex);
+        mSamplerStates.profile = task->mSamplerStateKeys;
+    }
+
+    mPrecreateEvent = angle::WorkerThreadPool::PostWorkerTask(
+        context->getWorkerThreadPool(), task, angle::WorkerTaskPriority::Low);
+}
+
+void RenderStateCache::saveProfile(Renderer11 *renderer)
+{
+    if (mUnsavedProfileStateCount == 0)
+    {
+        return;
+    }
+    mUnsavedProfileStateCount = 0;
+
+    gl::BinaryOutputStream stream;
+    {
+        std::lock_guard<std::mutex> lock(mBlendStates.mutex);
+        WriteProfile(&stream, mBlendStates.profile);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mRasterizerStates.mutex);
+        WriteProfile(&stream, mRasterizerStates.profile);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mDepthStencilStates.mutex);
+        WriteProfile(&stream, mDepthStencilStates.profile);
+    }
+    {
+        std::lock_guard<std::mutex> lock(mSamplerStates.mutex);
+        WriteProfile(&stream, mSamplerStates.profile);
+    }
 
+    angle::MemoryBuffer profileBlob;
+    if (!profileBlob.resize(angle::base::kSHA1Length + stream.length()))
+    {
+        return;
+    }
+    angle::base::SHA1HashBytes(static_cast<const unsigned char *>(stream.data()), stream.length(),
+                               profileBlob.data());
+    memcpy(profileBlob.data() + angle::base::kSHA1Length, stream.data(), stream.length());
+
+    egl::BlobCache::Key profileKey;
+    ComputeProfileKey(renderer->getRenderer11DeviceCaps().featureLevel, &profileKey);
+
+    egl::Display *display = renderer->getDisplay();
+    std::lock_guard<std::mutex> cacheLock(display->getProgramCacheMutex());
+    display->getBlobCache().put(profileKey, std::move(profileBlob));
+}
+
+template <typename KeyT, typename StateT>
+bool RenderStateCache::addToProfile(Renderer11 *renderer,
+                                    StateShard<KeyT, StateT> *shard,
+                                    const KeyT &key)
+{
+    if (!renderer->getFeatures().precreateRenderStates.enabled ||
+        shard->profile.size() >= kMaxProfileStates)
+    {
+        return false;
+    }
+
+    shard->profile.push_back(key);
+    return ++mUnsavedProfileStateCount >= kProfileSaveInterval;
+}
+
+// static
+d3d11::BlendStateKey RenderStateCache::GetBlendStateKey(const gl::Context *context,
+                                                        Framebuffer11 *framebuffer11,
+                                                        const gl::BlendStateExt &blendStateExt,
+                                                        bool sampleAlphaToCoverage)
+{
+    d3d11::BlendStateKey key;
+    // All fields of the BlendStateExt inside the key should be initialized for the caching to
+    // work correctly. Due to mrt_perf_workaround, the actual indices of active draw buffers may be
+    // different, so both arrays should be tracked.
+    key.blendStateExt                      = gl::BlendStateExt(blendStateExt.getDrawBufferCount());
+    const gl::AttachmentList &colorbuffers = framebuffer11->getColorAttachmentsForRender(context);
+    const gl::DrawBufferMask colorAttachmentsForRenderMask =
+        framebuffer11->getLastColorAttachmentsForRenderMask();
+
+    ASSERT(blendStateExt.getDrawBufferCount() <= colorAttachmentsForRenderMask.size());
+    ASSERT(colorbuffers.size() == colorAttachmentsForRenderMask.count());
+
+    size_t keyBlendIndex = 0;
+
+    // With blending disabled, factors and equations are ignored when building
+    // D3D11_RENDER_TARGET_BLEND_DESC, so we can reduce the amount of unique keys by
+    // enforcing default values.
+    for (size_t sourceIndex : colorAttachmentsForRenderMask)
+    {
+        ASSERT(keyBlendIndex < colorbuffers.size());
+        const gl::FramebufferAttachment *attachment = colorbuffers[keyBlendIndex];
+
+        // Do not set blend state for null attachments that may be present when
+        // mrt_perf_workaround is disabled.
+        if (attachment == nullptr)
+        {
+            keyBlendIndex++;
+            continue;
+        }
+
+        const uint8_t colorMask = blendStateExt.getColorMaskIndexed(sourceIndex);
+
+        const gl::InternalFormat &internalFormat = *attachment->getFormat().info;
+
+        key.blendStateExt.setColorMaskIndexed(keyBlendIndex,
+                                              gl_d3d11::GetColorMask(internalFormat) & colorMask);
+        key.rtvMax = static_cast<uint16_t>(keyBlendIndex) + 1;
+
+        // Some D3D11 drivers produce unexpected results when blending is enabled for integer
+        // attachments. Per OpenGL ES spec, it must be ignored anyway. When blending is disabled,
+        // the state remains default to reduce the number of unique keys.
+        if (blendStateExt.getEnabledMask().test(sourceIndex) && !internalFormat.isInt())
+        {
+            key.blendStateExt.setEnabledIndexed(keyBlendIndex, true);
+            key.blendStateExt.setEquationsIndexed(keyBlendIndex, sourceIndex, blendStateExt);
+            key.blendStateExt.setFactorsIndexed(keyBlendIndex, sourceIndex, blendStateExt);
+        }
+        keyBlendIndex++;
+    }
+
+    key.sampleAlphaToCoverage = sampleAlphaToCoverage ? 1 : 0;
+    return key;
+}
+
+angle::Result RenderStateCache::getBlendState(const gl::Context *context,
+                                              Renderer11 *renderer,
+                                              const d3d11::BlendStateKey &key,
+                                              const d3d11::BlendState **outBlendState)
+{
+    bool saveProfileNow = false;
+    {
+        std::lock_guard<std::mutex> lock(mBlendStates.mutex);
+        auto keyIter = mBlendStates.cache.Get(key);
+        if (keyIter != mBlendStates.cache.end())
+        {
+            *outBlendState = &keyIter->second;
+            return angle::Result::Continue;
+        }
+
+        TrimCache(kMaxStates, kGCLimit, "blend state", &mBlendStates.cache);
+
+        // Create a new blend state and insert it into the cache
+        d3d11::BlendState d3dBlendState;
+        ANGLE_TRY(renderer->allocateResource(GetImplAs<Context11>(context), GetBlendDesc(key),
+                                             &d3dBlendState));
+        const auto &iter = mBlendStates.cache.Put(key, std::move(d3dBlendState));
+
+        *outBlendState = &iter->second;
+        saveProfileNow = addToProfile(renderer, &mBlendStates, key);
+    }
+
+    if (saveProfileNow)
+    {
+        saveProfile(renderer);
+    }
+    return angle::Result::Continue;
+}
+
+angle::Result RenderStateCache::getRasterizerState(const gl::Context *context,
+                                                   Renderer11 *renderer,
+                                                   const gl::RasterizerState &rasterState,
+                                                   bool scissorEnabled,
+                                                   ID3D11RasterizerState **outRasterizerState)
+{
+    d3d11::RasterizerStateKey key;
+    key.rasterizerState = rasterState;
+    key.scissorEnabled  = scissorEnabled ? 1 : 0;
+
+    bool saveProfileNow = false;
+    {
+        std::lock_guard<std::mutex> lock(mRasterizerStates.mutex);
+        auto keyIter = mRasterizerStates.cache.Get(key);
+        if (keyIter != mRasterizerStates.cache.end())
+        {
+            *outRasterizerState = keyIter->second.get();
+            return angle::Result::Continue;
+        }
+
+        TrimCache(kMaxStates, kGCLimit, "rasterizer state", &mRasterizerStates.cache);
+
+        d3d11::RasterizerState dx11RasterizerState;
+        ANGLE_TRY(renderer->allocateResource(GetImplAs<Context11>(context), GetRasterizerDesc(key),
+                                             &dx11RasterizerState));
+        *outRasterizerState = dx11RasterizerState.get();
+        mRasterizerStates.cache.Put(key, std::move(dx11RasterizerState));
+
+        saveProfileNow = addToProfile(renderer, &mRasterizerStates, key);
+    }
+
+    if (saveProfileNow)
+    {
+        saveProfile(renderer);
+    }
+    return angle::Result::Continue;
+}
+
+angle::Result RenderStateCache::getDepthStencilState(const gl::Context *context,
+                                                     Renderer11 *renderer,
+                                                     const gl::DepthStencilState &glState,
+                                                     const d3d11::DepthStencilState **outDSState)
+{
+    bool saveProfileNow = false;
+    {
+        std::lock_guard<std::mutex> lock(mDepthStencilStates.mutex);
+        auto keyIter = mDepthStencilStates.cache.Get(glState);
+        if (keyIter != mDepthStencilStates.cache.end())
+        {
+            *outDSState = &keyIter->second;
+            return angle::Result::Continue;
+        }
+
+        TrimCache(kMaxStates, kGCLimit, "depth stencil state", &mDepthStencilStates.cache);
+
+        d3d11::DepthStencilState dx11DepthStencilState;
+        ANGLE_TRY(renderer->allocateResource(GetImplAs<Context11>(context),
+                                             GetDepthStencilDesc(glState),
+                                             &dx11DepthStencilState));
+        const auto &iter = mDepthStencilStates.cache.Put(glState, std::move(dx11DepthStencilState));
+
+        *outDSState    = &iter->second;
+        saveProfileNow = addToProfile(renderer, &mDepthStencilStates, glState);
+    }
+
+    if (saveProfileNow)
+    {
+        saveProfile(renderer);
+    }
+    return angle::Result::Continue;
+}
+
+angle::Result RenderStateCache::getSamplerState(const gl::Context *context,
+                                                Renderer11 *renderer,
+                                                const gl::SamplerState &samplerState,
+                                                ID3D11SamplerState **outSamplerState)
+{
+    bool saveProfileNow = false;
+    {
+        std::lock_guard<std::mutex> lock(mSamplerStates.mutex);
+        auto keyIter = mSamplerStates.cache.Get(samplerState);
+        if (keyIter != mSamplerStates.cache.end())
+        {
+            *outSamplerState = keyIter->second.get();
+            return angle::Result::Continue;
+        }
+
+        TrimCache(kMaxStates, kGCLimit, "sampler state", &mSamplerStates.cache);
+
+        const auto &featureLevel = renderer->getRenderer11DeviceCaps().featureLevel;
+
+        d3d11::SamplerState dx11SamplerState;
+        ANGLE_TRY(renderer->allocateResource(GetImplAs<Context11>(context),
+                                             GetSamplerDesc(samplerState, featureLevel),
+                                             &dx11SamplerState));
+        *outSamplerState = dx11SamplerState.get();
+        mSamplerStates.cache.Put(samplerState, std::move(dx11SamplerState));
+
+        saveProfileNow = addToProfile(renderer, &mSamplerStates, samplerState);
+    }
+
+    if (saveProfileNow)
+    {
+        saveProfile(renderer);
+    }
     return angle::Result::Continue;
 }
 
@@ -13,10 +13,14 @@
 #include "common/angleutils.h"
 #include "libANGLE/Error.h"
 #include "libANGLE/SizedMRUCache.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/angletypes.h"
 #include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
 
+#include <atomic>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace std
 {
@@ -59,6 +63,9 @@ namespace rx
 class Framebuffer11;
 class Renderer11;
 
+// The cache belongs to the renderer, so all the contexts of the display share it.  Each type of
+// state has its own lock, so that the states precreated in the background only hold up the draws
+// that need the same type of state.
 class RenderStateCache : angle::NonCopyable
 {
   public:
@@ -67,6 +74,18 @@ class RenderStateCache : angle::NonCopyable
 
     void clear();
 
+    // Creates the states of the profile saved in the blob cache by a previous run on a worker
+    // thread, so the first draws that need them find them in the cache.  Only the first call has
+    // an effect.
+    void precreateStates(const gl::Context *context, Renderer11 *renderer);
+
+    // Saves the keys of the states created so far to the blob cache.
+    void saveProfile(Renderer11 *renderer);
+
+    // Useful for testing
+    void waitForPrecreation();
+    size_t getCachedStateCount();
+
     static d3d11::BlendStateKey GetBlendStateKey(const gl::Context *context,
                                                  Framebuffer11 *framebuffer11,
                                                  const gl::BlendStateExt &blendStateExt,
@@ -90,6 +109,8 @@ class RenderStateCache : angle::NonCopyable
                                   ID3D11SamplerState **outSamplerState);
 
   private:
+    class PrecreateStatesTask;
+
     // MSDN's documentation of ID3D11Device::CreateBlendState, ID3D11Device::CreateRasterizerState,
     // ID3D11Device::CreateDepthStencilState and ID3D11Device::CreateSamplerState claims the maximum
     // number of unique states of each type an application can create is 4096
@@ -100,23 +121,43 @@ class RenderStateCache : angle::NonCopyable
     // The cache tries to clean up this many states at once.
     static constexpr unsigned int kGCLimit = 128;
 
+    // The first states of each type created are remembered for the next run.  They are the most
+    // likely to be needed while the application is starting up.
+    static constexpr size_t kMaxProfileStates = 256;
+
+    // The profile is saved again each time this many states are added to it.
+    static constexpr size_t kProfileSaveInterval = 32;
+
+    template <typename KeyT, typename StateT>
+    struct StateShard : angle::NonCopyable
+    {
+        explicit StateShard(size_t maxStates) : cache(maxStates) {}
+
+        std::mutex mutex;
+        angle::base::HashingMRUCache<KeyT, StateT> cache;
+        std::vector<KeyT> profile;
+    };
+
+    // Adds |key| to the profile of |shard|, which must be locked.  Returns whether enough states
+    // were added since the profile was last saved to save it again.
+    template <typename KeyT, typename StateT>
+    bool addToProfile(Renderer11 *renderer, StateShard<KeyT, StateT> *shard, const KeyT &key);
+
     // Blend state cache
-    using BlendStateMap = angle::base::HashingMRUCache<d3d11::BlendStateKey, d3d11::BlendState>;
-    BlendStateMap mBlendStateCache;
+    StateShard<d3d11::BlendStateKey, d3d11::BlendState> mBlendStates;
 
     // Rasterizer state cache
-    using RasterizerStateMap =
-        angle::base::HashingMRUCache<d3d11::RasterizerStateKey, d3d11::RasterizerState>;
-    RasterizerStateMap mRasterizerStateCache;
+    StateShard<d3d11::RasterizerStateKey, d3d11::RasterizerState> mRasterizerStates;
 
     // Depth stencil state cache
-    using DepthStencilStateMap =
-        angle::base::HashingMRUCache<gl::DepthStencilState, d3d11::DepthStencilState>;
-    DepthStencilStateMap mDepthStencilStateCache;
+    StateShard<gl::DepthStencilState, d3d11::DepthStencilState> mDepthStencilStates;
 
     // Sample state cache
-    using SamplerStateMap = angle::base::HashingMRUCache<gl::SamplerState, d3d11::SamplerState>;
-    SamplerStateMap mSamplerStateCache;
+    StateShard<gl::SamplerState, d3d11::SamplerState> mSamplerStates;
+
+    std::atomic_size_t mUnsavedProfileStateCount;
+    bool mPrecreated;
+    std::shared_ptr<angle::WaitableEvent> mPrecreateEvent;
 };
 
 }  // namespace rx
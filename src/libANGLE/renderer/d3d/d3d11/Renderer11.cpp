@@ -12,8 +12,11 @@
 #include <versionhelpers.h>
 #include <sstream>
 
+#include "common/angle_version_info.h"
 #include "common/tls.h"
 #include "common/utilities.h"
+#include "libANGLE/BinaryStream.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/Buffer.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
@@ -36,6 +39,7 @@
 #include "libANGLE/renderer/d3d/VertexDataManager.h"
 #include "libANGLE/renderer/d3d/d3d11/Blit11.h"
 #include "libANGLE/renderer/d3d/d3d11/Buffer11.h"
+#include "libANGLE/renderer/d3d/d3d11/BufferConverter11.h"
 #include "libANGLE/renderer/d3d/d3d11/Clear11.h"
 #include "libANGLE/renderer/d3d/d3d11/Context11.h"
 #include "libANGLE/renderer/d3d/d3d11/ExternalImageSiblingImpl11.h"
@@ -401,6 +405,49 @@ angle::Result GetTextureD3DResourceFromStorageOrImage(const gl::Context *context
     return angle::Result::Continue;
 }
 
+void ComputeShaderBinaryKey(const std::string &hlsl,
+                            const std::string &profile,
+                            const std::vector<CompileConfig> &configs,
+                            const D3D_SHADER_MACRO *macros,
+                            egl::BlobCache::Key *hashOut)
+{
+    // Every input of D3DCompile that can change its output is part of the key.  The commit hash
+    // is included as the HLSL compiler DLL ANGLE loads may change between builds.
+    gl::BinaryOutputStream keyStream;
+    keyStream.writeString("ANGLE D3D11 Shader Binary: ");
+    keyStream.writeBytes(reinterpret_cast<const unsigned char *>(angle::GetANGLECommitHash()),
+                         angle::GetANGLECommitHashSize());
+    keyStream.writeString(profile);
+    keyStream.writeInt(configs.size());
+    for (const CompileConfig &config : configs)
+    {
+        keyStream.writeInt(config.flags);
+    }
+    for (const D3D_SHADER_MACRO *macro = macros; macro != nullptr && macro->Name != nullptr;
+         ++macro)
+    {
+        keyStream.writeString(macro->Name);
+        keyStream.writeString(macro->Definition);
+    }
+    keyStream.writeString(hlsl);
+
+    angle::base::SHA1HashBytes(static_cast<const unsigned char *>(keyStream.data()),
+                               keyStream.length(), hashOut->data());
+}
+
+void PackMappedPixels(const TextureHelper11 &textureHelper,
+                      const PackPixelsParams &params,
+                      const D3D11_MAPPED_SUBRESOURCE &mapping,
+                      uint8_t *pixelsOut)
+{
+    uint8_t *source = static_cast<uint8_t *>(mapping.pData);
+    int inputPitch  = static_cast<int>(mapping.RowPitch);
+
+    const auto &formatInfo = textureHelper.getFormatSet();
+    ASSERT(formatInfo.format().glInternalFormat != GL_NONE);
+
+    PackPixels(params, formatInfo.format(), inputPitch, source, pixelsOut);
+}
 }  // anonymous namespace
 
 Renderer11DeviceCaps::Renderer11DeviceCaps() = default;
@@ -410,6 +457,7 @@ Renderer11::Renderer11(egl::Display *display)
       mCreateDebugDevice(false),
       mStateCache(),
       mStateManager(this),
+      mStagingTexturePool(this),
       mLastHistogramUpdateTime(
           ANGLEPlatformCurrent()->monotonicallyIncreasingTime(ANGLEPlatformCurrent())),
       mDebug(nullptr),
@@ -418,8 +466,9 @@ Renderer11::Renderer11(egl::Display *display)
     mLineLoopIB    = nullptr;
     mTriangleFanIB = nullptr;
 
-    mBlit          = nullptr;
-    mPixelTransfer = nullptr;
+    mBlit            = nullptr;
+    mPixelTransfer   = nullptr;
+    mBufferConverter = nullptr;
 
     mClear = nullptr;
 
@@ -435,19 +484,22 @@ Renderer11::Renderer11(egl::Display *display)
     mRenderer11DeviceCaps.B4G4R4A4support                        = 0;
     mRenderer11DeviceCaps.B5G5R5A1support                        = 0;
 
+    mRenderer11DeviceCaps.supportsMapNoOverwriteOnDynamicConstantBuffer = false;
+
     mD3d11Module          = nullptr;
     mD3d12Module          = nullptr;
     mDxgiModule           = nullptr;
     mDCompModule          = nullptr;
     mCreatedWithDeviceEXT = false;
 
-    mDevice         = nullptr;
-    mDevice1        = nullptr;
-    mDeviceContext  = nullptr;
-    mDeviceContext1 = nullptr;
-    mDeviceContext3 = nullptr;
-    mDxgiAdapter    = nullptr;
-    mDxgiFactory    = nullptr;
+    mDevice           = nullptr;
+    mDevice1          = nullptr;
+    mDeviceContext    = nullptr;
+    mImmediateContext = nullptr;
+    mDeviceContext1   = nullptr;
+    mDeviceContext3   = nullptr;
+    mDxgiAdapter      = nullptr;
+    mDxgiFactory      = nullptr;
 
     ZeroMemory(&mAdapterDescription, sizeof(mAdapterDescription));
 
@@ -986,6 +1038,14 @@ egl::Error Renderer11::initializeDevice()
 
     populateRenderer11DeviceCaps();
 
+    // The runtime emulation of command lists doesn't save any work over issuing the commands
+    // directly.
+    if (getFeatures().recordCommandsInDeferredContext.enabled &&
+        mRenderer11DeviceCaps.supportsDriverCommandLists)
+    {
+        initializeDeferredContext();
+    }
+
     mStateCache.clear();
 
     ASSERT(!mBlit);
@@ -1010,6 +1070,9 @@ egl::Error Renderer11::initializeDevice()
     ASSERT(!mPixelTransfer);
     mPixelTransfer = new PixelTransfer11(this);
 
+    ASSERT(!mBufferConverter);
+    mBufferConverter = new BufferConverter11(this);
+
     // Gather stats on DXGI and D3D feature level
     ANGLE_HISTOGRAM_BOOLEAN("GPU.ANGLE.SupportsDXGI1_2", mRenderer11DeviceCaps.supportsDXGI1_2);
 
@@ -1030,6 +1093,52 @@ egl::Error Renderer11::initializeDevice()
     return egl::NoError();
 }
 
+void Renderer11::initializeDeferredContext()
+{
+    ASSERT(mImmediateContext == nullptr);
+
+    ID3D11DeviceContext *deferredContext = nullptr;
+    HRESULT result                       = mDevice->CreateDeferredContext(0, &deferredContext);
+    if (FAILED(result))
+    {
+        WARN() << "Failed to create a deferred context, " << gl::FmtHR(result);
+        return;
+    }
+
+    d3d11::SetDebugName(deferredContext, "DeferredContext", nullptr);
+
+    SafeRelease(mDeviceContext3);
+    SafeRelease(mDeviceContext1);
+
+    mImmediateContext = mDeviceContext;
+    mDeviceContext    = deferredContext;
+    mDeviceContext1   = d3d11::DynamicCastComObject<ID3D11DeviceContext1>(mDeviceContext);
+    mDeviceContext3   = d3d11::DynamicCastComObject<ID3D11DeviceContext3>(mDeviceContext);
+}
+
+HRESULT Renderer11::executeRecordedCommands()
+{
+    if (mImmediateContext == nullptr)
+    {
+        return S_OK;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "Renderer11::executeRecordedCommands");
+
+    // Restore the state of the deferred context after finishing the command list, so the state
+    // cached by StateManager11 remains valid.  The state of the immediate context doesn't matter
+    // as it is only used for executing command lists, mapping and polling queries.
+    angle::ComPtr<ID3D11CommandList> commandList;
+    HRESULT result = mDeviceContext->FinishCommandList(TRUE, &commandList);
+    if (FAILED(result))
+    {
+        return result;
+    }
+
+    mImmediateContext->ExecuteCommandList(commandList.Get(), FALSE);
+    return S_OK;
+}
+
 void Renderer11::populateRenderer11DeviceCaps()
 {
     HRESULT hr = S_OK;
@@ -1056,6 +1165,8 @@ void Renderer11::populateRenderer11DeviceCaps()
             mRenderer11DeviceCaps.supportsClearView = (d3d11Options.ClearView != FALSE);
             mRenderer11DeviceCaps.supportsConstantBufferOffsets =
                 (d3d11Options.ConstantBufferOffsetting != FALSE);
+            mRenderer11DeviceCaps.supportsMapNoOverwriteOnDynamicConstantBuffer =
+                (d3d11Options.MapNoOverwriteOnDynamicConstantBuffer != FALSE);
         }
     }
 
@@ -1109,6 +1220,12 @@ void Renderer11::populateRenderer11DeviceCaps()
     IDXGIAdapter2 *dxgiAdapter2 = d3d11::DynamicCastComObject<IDXGIAdapter2>(mDxgiAdapter);
     mRenderer11DeviceCaps.supportsDXGI1_2 = (dxgiAdapter2 != nullptr);
     SafeRelease(dxgiAdapter2);
+
+    D3D11_FEATURE_DATA_THREADING threadingSupport;
+    hr = mDevice->CheckFeatureSupport(D3D11_FEATURE_THREADING, &threadingSupport,
+                                      sizeof(D3D11_FEATURE_DATA_THREADING));
+    mRenderer11DeviceCaps.supportsDriverCommandLists =
+        SUCCEEDED(hr) && threadingSupport.DriverCommandLists != FALSE;
 }
 
 gl::SupportedSampleSet Renderer11::generateSampleSetForEGLConfig(
@@ -1310,6 +1427,12 @@ void Renderer11::generateDisplayExtensions(egl::DisplayExtensions *outExtensions
     outExtensions->querySurfacePointer = true;
     outExtensions->windowFixedSize     = true;
 
+#if !defined(ANGLE_ENABLE_WINDOWS_UWP)
+    // Window surfaces can use a flip-discard swap chain, see NativeWindow11Win32.
+    outExtensions->lowLatencyPresentANGLE          = true;
+    outExtensions->frameLatencyWaitableObjectANGLE = true;
+#endif
+
     // If present path fast is active then the surface orientation extension isn't supported
     outExtensions->surfaceOrientation = !mPresentPathFastEnabled;
 
@@ -1354,7 +1477,8 @@ void Renderer11::generateDisplayExtensions(egl::DisplayExtensions *outExtensions
 
 angle::Result Renderer11::flush(Context11 *context11)
 {
-    mDeviceContext->Flush();
+    ANGLE_TRY_HR(context11, executeRecordedCommands(), "Failed to execute the recorded commands");
+    getImmediateContext()->Flush();
     return angle::Result::Continue;
 }
 
@@ -1369,7 +1493,9 @@ angle::Result Renderer11::finish(Context11 *context11)
         ANGLE_TRY(allocateResource(context11, queryDesc, &mSyncQuery));
     }
 
-    mDeviceContext->End(mSyncQuery.get());
+    ANGLE_TRY_HR(context11, executeRecordedCommands(), "Failed to execute the recorded commands");
+    ID3D11DeviceContext *immediateContext = getImmediateContext();
+    immediateContext->End(mSyncQuery.get());
 
     HRESULT result       = S_OK;
     unsigned int attempt = 0;
@@ -1379,7 +1505,7 @@ angle::Result Renderer11::finish(Context11 *context11)
         UINT flags = (attempt % flushFrequency == 0) ? 0 : D3D11_ASYNC_GETDATA_DONOTFLUSH;
         attempt++;
 
-        result = mDeviceContext->GetData(mSyncQuery.get(), nullptr, 0, flags);
+        result = immediateContext->GetData(mSyncQuery.get(), nullptr, 0, flags);
         ANGLE_TRY_HR(context11, result, "Failed to get event query data");
 
         if (result == S_FALSE)
@@ -1440,9 +1566,19 @@ NativeWindowD3D *Renderer11::createNativeWindow(EGLNativeWindowType window,
 #else
     if (window == nullptr || NativeWindow11Win32::IsValidNativeWindow(window))
     {
+        bool lowLatency = attribs.get(EGL_LOW_LATENCY_PRESENT_ANGLE, EGL_FALSE) == EGL_TRUE;
+
+        // The flip model discards the back buffer contents, so SwapChain11 has to keep them in its
+        // offscreen texture, which isn't used with present path fast or an INVERT_Y orientation.
+        EGLint orientation = static_cast<EGLint>(attribs.get(EGL_SURFACE_ORIENTATION_ANGLE, 0));
+        bool flipDiscard =
+            (getFeatures().useFlipDiscardSwapChain.enabled || lowLatency) &&
+            !mPresentPathFastEnabled && (orientation & EGL_SURFACE_ORIENTATION_INVERT_Y_ANGLE) == 0;
+
         return new NativeWindow11Win32(
             window, config->alphaSize > 0,
-            attribs.get(EGL_DIRECT_COMPOSITION_ANGLE, EGL_FALSE) == EGL_TRUE);
+            attribs.get(EGL_DIRECT_COMPOSITION_ANGLE, EGL_FALSE) == EGL_TRUE, flipDiscard,
+            lowLatency);
     }
 #endif
 
@@ -1806,7 +1942,7 @@ angle::Result Renderer11::drawArrays(const gl::Context *context,
             return drawTriangleFan(context, clampedVertexCount, gl::DrawElementsType::InvalidEnum,
                                    nullptr, 0, adjustedInstanceCount);
         case gl::PrimitiveMode::Points:
-            if (getFeatures().useInstancedPointSpriteEmulation.enabled)
+            if (programD3D->usesInstancedPointSpriteEmulation())
             {
                 // This code should not be reachable by multi-view programs.
                 ASSERT(programD3D->getState().usesMultiview() == false);
@@ -1816,7 +1952,7 @@ angle::Result Renderer11::drawArrays(const gl::Context *context,
                 // D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST and DrawIndexedInstanced is called instead.
                 if (adjustedInstanceCount == 0)
                 {
-                    mDeviceContext->DrawIndexedInstanced(6, clampedVertexCount, 0, 0, baseInstance);
+                    drawPointSprites(programD3D, clampedVertexCount, 0, baseInstance);
                     return angle::Result::Continue;
                 }
 
@@ -1830,12 +1966,12 @@ angle::Result Renderer11::drawArrays(const gl::Context *context,
                 {
                     ANGLE_TRY(mStateManager.updateVertexOffsetsForPointSpritesEmulation(
                         context, firstVertex, i));
-                    mDeviceContext->DrawIndexedInstanced(6, clampedVertexCount, 0, 0, baseInstance);
+                    drawPointSprites(programD3D, clampedVertexCount, 0, baseInstance);
                 }
 
-                // This required by updateVertexOffsets... above but is outside of the loop for
-                // speed.
-                mStateManager.invalidateVertexBuffer();
+                // The next draw applies the vertex offsets of the first instance again. Only the
+                // vertex buffers whose offset changed are set, so the rest of the state is kept.
+                mStateManager.invalidateInputLayout();
                 return angle::Result::Continue;
             }
             break;
@@ -1925,7 +2061,7 @@ angle::Result Renderer11::drawElements(const gl::Context *context,
     // that do not support geometry shaders.
     if (instanceCount == 0)
     {
-        mDeviceContext->DrawIndexedInstanced(6, indexCount, 0, baseVertexAdjusted, baseInstance);
+        drawPointSprites(programD3D, indexCount, baseVertexAdjusted, baseInstance);
         return angle::Result::Continue;
     }
 
@@ -1944,13 +2080,29 @@ angle::Result Renderer11::drawElements(const gl::Context *context,
     {
         ANGLE_TRY(
             mStateManager.updateVertexOffsetsForPointSpritesEmulation(context, startVertex, i));
-        mDeviceContext->DrawIndexedInstanced(6, clampedVertexCount, 0, baseVertexAdjusted,
-                                             baseInstance);
+        drawPointSprites(programD3D, clampedVertexCount, baseVertexAdjusted, baseInstance);
     }
-    mStateManager.invalidateVertexBuffer();
+    mStateManager.invalidateInputLayout();
     return angle::Result::Continue;
 }
 
+void Renderer11::drawPointSprites(const ProgramD3D *programD3D,
+                                  UINT pointCount,
+                                  INT baseVertex,
+                                  UINT baseInstance)
+{
+    // Each point is an instance of the sprite quad. Without the sprite vertex and index buffers,
+    // the quad vertices are looked up in the vertex shader with the vertex ID.
+    if (programD3D->usesVertexIdPointSpriteExpansion())
+    {
+        mDeviceContext->DrawInstanced(6, pointCount, 0, baseInstance);
+    }
+    else
+    {
+        mDeviceContext->DrawIndexedInstanced(6, pointCount, 0, baseVertex, baseInstance);
+    }
+}
+
 angle::Result Renderer11::drawArraysIndirect(const gl::Context *context, const void *indirect)
 {
     if (mStateManager.getCullEverything())
@@ -2159,7 +2311,9 @@ angle::Result Renderer11::drawTriangleFan(const gl::Context *context,
 void Renderer11::releaseDeviceResources()
 {
     mStateManager.deinitialize();
+    mStateCache.saveProfile(this);
     mStateCache.clear();
+    mStagingTexturePool.clear();
 
     SafeDelete(mLineLoopIB);
     SafeDelete(mTriangleFanIB);
@@ -2167,6 +2321,7 @@ void Renderer11::releaseDeviceResources()
     SafeDelete(mClear);
     SafeDelete(mTrim);
     SafeDelete(mPixelTransfer);
+    SafeDelete(mBufferConverter);
 
     mSyncQuery.reset();
 
@@ -2241,6 +2396,15 @@ void Renderer11::release()
     SafeRelease(mDeviceContext3);
     SafeRelease(mDeviceContext1);
 
+    if (mImmediateContext)
+    {
+        // Drop the commands that were recorded but never executed along with the deferred context.
+        SafeRelease(mDeviceContext);
+        mDeviceContext    = mImmediateContext;
+        mImmediateContext = nullptr;
+    }
+    mImmediateMappedResources.clear();
+
     if (mDeviceContext)
     {
         mDeviceContext->ClearState();
@@ -3154,6 +3318,33 @@ angle::Result Renderer11::compileToExecutable(d3d::Context *context,
 
     D3D_SHADER_MACRO loopMacros[] = {{"ANGLE_ENABLE_LOOP_FLATTEN", "1"}, {0, 0}};
 
+    // Look for the output of a previous compilation of the same HLSL in the blob cache.  Shader
+    // variants generated for different input layouts and output signatures are often identical
+    // across programs, and the cache persists between sessions.
+    const bool cacheBinaries = getFeatures().cacheCompiledShaderBinaries.enabled;
+    egl::BlobCache::Key binaryKey;
+    if (cacheBinaries)
+    {
+        ComputeShaderBinaryKey(shaderHLSL, profile, configs, loopMacros, &binaryKey);
+
+        // This may run on a link worker thread, so the display's scratch buffer can't be used.
+        angle::ScratchBuffer scratchBuffer;
+        egl::BlobCache::Value cachedBinary;
+        size_t cachedBinarySize = 0;
+        std::lock_guard<std::mutex> cacheLock(mDisplay->getProgramCacheMutex());
+        if (mDisplay->getBlobCache().get(&scratchBuffer, binaryKey, &cachedBinary,
+                                         &cachedBinarySize) &&
+            cachedBinarySize > 0)
+        {
+            ANGLE_TRY(loadExecutable(context, cachedBinary.data(), cachedBinarySize, type,
+                                     streamOutVaryings, separatedOutputBuffers, outExectuable));
+            (*outExectuable)
+                ->appendDebugInfo("// COMPILER INPUT HLSL BEGIN\n\n" + shaderHLSL +
+                                  "\n// COMPILER INPUT HLSL END\n");
+            return angle::Result::Continue;
+        }
+    }
+
     // TODO(jmadill): Use ComPtr?
     ID3DBlob *binary = nullptr;
     std::string debugInfo;
@@ -3169,9 +3360,19 @@ angle::Result Renderer11::compileToExecutable(d3d::Context *context,
         return angle::Result::Continue;
     }
 
-    angle::Result error = loadExecutable(
-        context, static_cast<const uint8_t *>(binary->GetBufferPointer()), binary->GetBufferSize(),
-        type, streamOutVaryings, separatedOutputBuffers, outExectuable);
+    const uint8_t *binaryData = static_cast<const uint8_t *>(binary->GetBufferPointer());
+    const size_t binarySize   = binary->GetBufferSize();
+
+    angle::MemoryBuffer binaryCopy;
+    if (cacheBinaries && binaryCopy.resize(binarySize))
+    {
+        memcpy(binaryCopy.data(), binaryData, binarySize);
+        std::lock_guard<std::mutex> cacheLock(mDisplay->getProgramCacheMutex());
+        mDisplay->getBlobCache().put(binaryKey, std::move(binaryCopy));
+    }
+
+    angle::Result error = loadExecutable(context, binaryData, binarySize, type, streamOutVaryings,
+                                         separatedOutputBuffers, outExectuable);
 
     SafeRelease(binary);
     if (error == angle::Result::Stop)
@@ -3493,10 +3694,8 @@ angle::Result Renderer11::readFromAttachment(const gl::Context *context,
 
     gl::Extents safeSize(safeArea.width, safeArea.height, 1);
     TextureHelper11 stagingHelper;
-    ANGLE_TRY(createStagingTexture(context, textureHelper.getTextureType(),
-                                   textureHelper.getFormatSet(), safeSize, StagingAccess::READ,
-                                   &stagingHelper));
-    stagingHelper.setInternalName("readFromAttachment::stagingHelper");
+    ANGLE_TRY(mStagingTexturePool.acquire(context, textureHelper.getTextureType(),
+                                          textureHelper.getFormatSet(), safeSize, &stagingHelper));
 
     TextureHelper11 resolvedTextureHelper;
 
@@ -3551,7 +3750,10 @@ angle::Result Renderer11::readFromAttachment(const gl::Context *context,
     gl::Buffer *packBuffer = context->getState().getTargetBuffer(gl::BufferBinding::PixelPack);
 
     PackPixelsParams packParams(safeArea, angleFormat, outputPitch, reverseRowOrder, packBuffer, 0);
-    return packPixels(context, stagingHelper, packParams, pixelsOut);
+    ANGLE_TRY(packPixels(context, stagingHelper, packParams, pixelsOut));
+
+    mStagingTexturePool.release(std::move(stagingHelper));
+    return angle::Result::Continue;
 }
 
 angle::Result Renderer11::packPixels(const gl::Context *context,
@@ -3564,15 +3766,29 @@ angle::Result Renderer11::packPixels(const gl::Context *context,
     D3D11_MAPPED_SUBRESOURCE mapping;
     ANGLE_TRY(mapResource(context, readResource, 0, D3D11_MAP_READ, 0, &mapping));
 
-    uint8_t *source = static_cast<uint8_t *>(mapping.pData);
-    int inputPitch  = static_cast<int>(mapping.RowPitch);
+    PackMappedPixels(textureHelper, params, mapping, pixelsOut);
+    unmapResource(readResource, 0);
 
-    const auto &formatInfo = textureHelper.getFormatSet();
-    ASSERT(formatInfo.format().glInternalFormat != GL_NONE);
+    return angle::Result::Continue;
+}
 
-    PackPixels(params, formatInfo.format(), inputPitch, source, pixelsOut);
+angle::Result Renderer11::tryPackPixels(const gl::Context *context,
+                                        const TextureHelper11 &textureHelper,
+                                        const PackPixelsParams &params,
+                                        uint8_t *pixelsOut,
+                                        bool *packedOut)
+{
+    ID3D11Resource *readResource = textureHelper.get();
 
-    mDeviceContext->Unmap(readResource, 0);
+    D3D11_MAPPED_SUBRESOURCE mapping;
+    ANGLE_TRY(tryMapResource(context, readResource, 0, D3D11_MAP_READ, &mapping, packedOut));
+    if (!*packedOut)
+    {
+        return angle::Result::Continue;
+    }
+
+    PackMappedPixels(textureHelper, params, mapping, pixelsOut);
+    unmapResource(readResource, 0);
 
     return angle::Result::Continue;
 }
@@ -4033,6 +4249,45 @@ angle::Result Renderer11::getVertexSpaceRequired(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result Renderer11::convertStaticIndexData(const gl::Context *context,
+                                                 BufferD3D *source,
+                                                 gl::DrawElementsType srcType,
+                                                 gl::DrawElementsType dstType,
+                                                 unsigned int count,
+                                                 bool usePrimitiveRestartFixedIndex,
+                                                 StaticIndexBufferInterface *dest,
+                                                 bool *convertedOut)
+{
+    *convertedOut = false;
+    if (!getFeatures().convertStaticBuffersWithComputeShaders.enabled)
+    {
+        return angle::Result::Continue;
+    }
+
+    return mBufferConverter->convertIndices(context, GetAs<Buffer11>(source), srcType, dstType,
+                                            count, usePrimitiveRestartFixedIndex, dest,
+                                            convertedOut);
+}
+
+angle::Result Renderer11::convertStaticVertexData(const gl::Context *context,
+                                                  BufferD3D *source,
+                                                  const gl::VertexAttribute &attrib,
+                                                  const gl::VertexBinding &binding,
+                                                  GLint start,
+                                                  GLsizei count,
+                                                  StaticVertexBufferInterface *dest,
+                                                  bool *convertedOut)
+{
+    *convertedOut = false;
+    if (!getFeatures().convertStaticBuffersWithComputeShaders.enabled)
+    {
+        return angle::Result::Continue;
+    }
+
+    return mBufferConverter->convertVertices(context, GetAs<Buffer11>(source), attrib, binding,
+                                             start, count, dest, convertedOut);
+}
+
 void Renderer11::generateCaps(gl::Caps *outCaps,
                               gl::TextureCapsMap *outTextureCaps,
                               gl::Extensions *outExtensions,
@@ -4220,6 +4475,11 @@ angle::Result Renderer11::allocateTexture(d3d::Context *context,
     return angle::Result::Continue;
 }
 
+void Renderer11::precreateRenderStates(const gl::Context *context)
+{
+    mStateCache.precreateStates(context, this);
+}
+
 angle::Result Renderer11::getBlendState(const gl::Context *context,
                                         const d3d11::BlendStateKey &key,
                                         const d3d11::BlendState **outBlendState)
@@ -4318,11 +4578,75 @@ angle::Result Renderer11::mapResource(const gl::Context *context,
                                       UINT mapFlags,
                                       D3D11_MAPPED_SUBRESOURCE *mappedResource)
 {
-    HRESULT hr = mDeviceContext->Map(resource, subResource, mapType, mapFlags, mappedResource);
-    ANGLE_TRY_HR(GetImplAs<Context11>(context), hr, "Failed to map D3D11 resource.");
+    Context11 *context11               = GetImplAs<Context11>(context);
+    ID3D11DeviceContext *deviceContext = mDeviceContext;
+
+    // Deferred contexts can only map dynamic resources for WRITE_DISCARD.  Everything else is
+    // mapped on the immediate context, after executing the commands that might use the resource.
+    if (isRecordingInDeferredContext() && mapType != D3D11_MAP_WRITE_DISCARD)
+    {
+        ANGLE_TRY_HR(context11, executeRecordedCommands(),
+                     "Failed to execute the recorded commands");
+        deviceContext = mImmediateContext;
+    }
+
+    HRESULT hr = deviceContext->Map(resource, subResource, mapType, mapFlags, mappedResource);
+    ANGLE_TRY_HR(context11, hr, "Failed to map D3D11 resource.");
+
+    if (deviceContext != mDeviceContext)
+    {
+        mImmediateMappedResources.emplace_back(resource, subResource);
+    }
     return angle::Result::Continue;
 }
 
+angle::Result Renderer11::tryMapResource(const gl::Context *context,
+                                         ID3D11Resource *resource,
+                                         UINT subResource,
+                                         D3D11_MAP mapType,
+                                         D3D11_MAPPED_SUBRESOURCE *mappedResource,
+                                         bool *mappedOut)
+{
+    Context11 *context11               = GetImplAs<Context11>(context);
+    ID3D11DeviceContext *deviceContext = mDeviceContext;
+
+    if (isRecordingInDeferredContext())
+    {
+        ANGLE_TRY_HR(context11, executeRecordedCommands(),
+                     "Failed to execute the recorded commands");
+        deviceContext = mImmediateContext;
+    }
+
+    HRESULT hr = deviceContext->Map(resource, subResource, mapType, D3D11_MAP_FLAG_DO_NOT_WAIT,
+                                    mappedResource);
+    *mappedOut = (hr != DXGI_ERROR_WAS_STILL_DRAWING);
+    if (!*mappedOut)
+    {
+        return angle::Result::Continue;
+    }
+    ANGLE_TRY_HR(context11, hr, "Failed to map D3D11 resource.");
+
+    if (deviceContext != mDeviceContext)
+    {
+        mImmediateMappedResources.emplace_back(resource, subResource);
+    }
+    return angle::Result::Continue;
+}
+
+void Renderer11::unmapResource(ID3D11Resource *resource, UINT subResource)
+{
+    auto iter = std::find(mImmediateMappedResources.begin(), mImmediateMappedResources.end(),
+                          std::make_pair(resource, subResource));
+    if (iter == mImmediateMappedResources.end())
+    {
+        mDeviceContext->Unmap(resource, subResource);
+        return;
+    }
+
+    mImmediateMappedResources.erase(iter);
+    mImmediateContext->Unmap(resource, subResource);
+}
+
 angle::Result Renderer11::markTypedBufferUsage(const gl::Context *context)
 {
     const gl::State &glState = context->getState();
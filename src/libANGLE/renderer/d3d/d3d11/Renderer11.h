@@ -20,6 +20,7 @@
 #include "libANGLE/renderer/d3d/d3d11/DebugAnnotator11.h"
 #include "libANGLE/renderer/d3d/d3d11/RenderStateCache.h"
 #include "libANGLE/renderer/d3d/d3d11/ResourceManager11.h"
+#include "libANGLE/renderer/d3d/d3d11/StagingTexturePool11.h"
 #include "libANGLE/renderer/d3d/d3d11/StateManager11.h"
 #include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
 
@@ -32,6 +33,7 @@ class ImageIndex;
 namespace rx
 {
 class Blit11;
+class BufferConverter11;
 class Buffer11;
 class Clear11;
 class Context11;
@@ -51,6 +53,8 @@ struct Renderer11DeviceCaps
     bool supportsDXGI1_2;                         // Support for DXGI 1.2
     bool supportsClearView;                       // Support for ID3D11DeviceContext1::ClearView
     bool supportsConstantBufferOffsets;           // Support for Constant buffer offset
+    bool supportsMapNoOverwriteOnDynamicConstantBuffer;  // Dynamic constant buffers can be
+                                                         // mapped with MAP_WRITE_NO_OVERWRITE.
     bool supportsVpRtIndexWriteFromVertexShader;  // VP/RT can be selected in the Vertex Shader
                                                   // stage.
     bool supportsMultisampledDepthStencilSRVs;   // D3D feature level 10.0 no longer allows creation
@@ -66,6 +70,8 @@ struct Renderer11DeviceCaps
     UINT B5G5R5A1support;  // Bitfield of D3D11_FORMAT_SUPPORT values for DXGI_FORMAT_B5G5R5A1_UNORM
     UINT B5G5R5A1maxSamples;  // Maximum number of samples supported by DXGI_FORMAT_B5G5R5A1_UNORM
     Optional<LARGE_INTEGER> driverVersion;  // Four-part driver version number.
+    bool supportsDriverCommandLists;        // The driver builds command lists natively instead of
+                                            // the runtime emulating them.
 };
 
 enum
@@ -301,10 +307,22 @@ class Renderer11 : public RendererD3D
     ID3D11Device *getDevice() { return mDevice; }
     ID3D11Device1 *getDevice1() { return mDevice1; }
     void *getD3DDevice() override;
+    // The context commands are issued on.  This is a deferred context when the
+    // recordCommandsInDeferredContext feature is enabled.
     ID3D11DeviceContext *getDeviceContext() { return mDeviceContext; }
+    // The context to read back data and poll queries on.  The commands recorded in the deferred
+    // context need to be executed with executeRecordedCommands() before using it.
+    ID3D11DeviceContext *getImmediateContext()
+    {
+        return mImmediateContext ? mImmediateContext : mDeviceContext;
+    }
+    bool isRecordingInDeferredContext() const { return mImmediateContext != nullptr; }
+    HRESULT executeRecordedCommands();
     ID3D11DeviceContext1 *getDeviceContext1IfSupported() { return mDeviceContext1; }
     IDXGIFactory *getDxgiFactory() { return mDxgiFactory; }
 
+    // Creates the render states saved in the blob cache by a previous run in the background.
+    void precreateRenderStates(const gl::Context *context);
     angle::Result getBlendState(const gl::Context *context,
                                 const d3d11::BlendStateKey &key,
                                 const d3d11::BlendState **outBlendState);
@@ -339,6 +357,13 @@ class Renderer11 : public RendererD3D
                              const TextureHelper11 &textureHelper,
                              const PackPixelsParams &params,
                              uint8_t *pixelsOut);
+    // Like packPixels, but doesn't wait for the GPU to finish writing to |textureHelper|.
+    // |*packedOut| is set to false if it has to.
+    angle::Result tryPackPixels(const gl::Context *context,
+                                const TextureHelper11 &textureHelper,
+                                const PackPixelsParams &params,
+                                uint8_t *pixelsOut,
+                                bool *packedOut);
 
     bool getLUID(LUID *adapterLuid) const override;
     VertexConversionType getVertexConversionType(angle::FormatID vertexFormatID) const override;
@@ -354,6 +379,23 @@ class Renderer11 : public RendererD3D
                                          GLuint baseInstance,
                                          unsigned int *bytesRequiredOut) const override;
 
+    angle::Result convertStaticIndexData(const gl::Context *context,
+                                         BufferD3D *source,
+                                         gl::DrawElementsType srcType,
+                                         gl::DrawElementsType dstType,
+                                         unsigned int count,
+                                         bool usePrimitiveRestartFixedIndex,
+                                         StaticIndexBufferInterface *dest,
+                                         bool *convertedOut) override;
+    angle::Result convertStaticVertexData(const gl::Context *context,
+                                          BufferD3D *source,
+                                          const gl::VertexAttribute &attrib,
+                                          const gl::VertexBinding &binding,
+                                          GLint start,
+                                          GLsizei count,
+                                          StaticVertexBufferInterface *dest,
+                                          bool *convertedOut) override;
+
     angle::Result readFromAttachment(const gl::Context *context,
                                      const gl::FramebufferAttachment &srcAttachment,
                                      const gl::Rectangle &sourceArea,
@@ -381,6 +423,8 @@ class Renderer11 : public RendererD3D
 
     RendererClass getRendererClass() const override;
     StateManager11 *getStateManager() { return &mStateManager; }
+    RenderStateCache *getStateCache() { return &mStateCache; }
+    StagingTexturePool11 *getStagingTexturePool() { return &mStagingTexturePool; }
 
     void onSwap();
     void onBufferCreate(const Buffer11 *created);
@@ -489,6 +533,17 @@ class Renderer11 : public RendererD3D
                               D3D11_MAP mapType,
                               UINT mapFlags,
                               D3D11_MAPPED_SUBRESOURCE *mappedResource);
+    // Maps |resource| with D3D11_MAP_FLAG_DO_NOT_WAIT.  |*mappedOut| is set to false if the GPU is
+    // still using the resource.
+    angle::Result tryMapResource(const gl::Context *context,
+                                 ID3D11Resource *resource,
+                                 UINT subResource,
+                                 D3D11_MAP mapType,
+                                 D3D11_MAPPED_SUBRESOURCE *mappedResource,
+                                 bool *mappedOut);
+    // Must be used to unmap resources mapped with anything other than D3D11_MAP_WRITE_DISCARD,
+    // which are mapped on the immediate context when recording in a deferred context.
+    void unmapResource(ID3D11Resource *resource, UINT subResource);
 
     angle::Result getIncompleteTexture(const gl::Context *context,
                                        gl::TextureType type,
@@ -522,6 +577,10 @@ class Renderer11 : public RendererD3D
                                   const void *indices,
                                   int baseVertex,
                                   int instances);
+    void drawPointSprites(const ProgramD3D *programD3D,
+                          UINT pointCount,
+                          INT baseVertex,
+                          UINT baseInstance);
 
     angle::Result resolveMultisampledTexture(const gl::Context *context,
                                              RenderTarget11 *renderTarget,
@@ -550,6 +609,7 @@ class Renderer11 : public RendererD3D
                                       bool debug);
     egl::Error initializeD3DDevice();
     egl::Error initializeDevice();
+    void initializeDeferredContext();
     void releaseDeviceResources();
     void release();
 
@@ -579,12 +639,15 @@ class Renderer11 : public RendererD3D
 
     StateManager11 mStateManager;
 
+    StagingTexturePool11 mStagingTexturePool;
+
     StreamingIndexBufferInterface *mLineLoopIB;
     StreamingIndexBufferInterface *mTriangleFanIB;
 
     // Texture copy resources
     Blit11 *mBlit;
     PixelTransfer11 *mPixelTransfer;
+    BufferConverter11 *mBufferConverter;
 
     // Masked clear resources
     Clear11 *mClear;
@@ -607,6 +670,12 @@ class Renderer11 : public RendererD3D
     ID3D11Device1 *mDevice1;
     Renderer11DeviceCaps mRenderer11DeviceCaps;
     ID3D11DeviceContext *mDeviceContext;
+    // Only set when commands are recorded in a deferred context, in which case mDeviceContext is
+    // the deferred context.
+    ID3D11DeviceContext *mImmediateContext;
+    // Resources mapped on the immediate context while recording in a deferred context, so they
+    // are unmapped on the same context.
+    std::vector<std::pair<ID3D11Resource *, UINT>> mImmediateMappedResources;
     ID3D11DeviceContext1 *mDeviceContext1;
     ID3D11DeviceContext3 *mDeviceContext3;
     IDXGIAdapter *mDxgiAdapter;
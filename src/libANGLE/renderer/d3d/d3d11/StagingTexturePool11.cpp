@@ -0,0 +1,93 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StagingTexturePool11.cpp:
+//   A pool of the staging textures that readbacks copy to, so that each readPixels doesn't create
+//   and destroy one.
+//
+
+#include "libANGLE/renderer/d3d/d3d11/StagingTexturePool11.h"
+
+#include <algorithm>
+
+#include "common/mathutil.h"
+#include "libANGLE/renderer/d3d/d3d11/Renderer11.h"
+
+namespace rx
+{
+
+namespace
+{
+// Small readbacks all share the same bucket.
+constexpr int kMinPooledSize = 64;
+
+int GetBucketSize(int size)
+{
+    return static_cast<int>(
+        gl::ceilPow2(static_cast<unsigned int>(std::max(size, kMinPooledSize))));
+}
+}  // anonymous namespace
+
+StagingTexturePool11::StagingTexturePool11(Renderer11 *renderer) : mRenderer(renderer) {}
+
+StagingTexturePool11::~StagingTexturePool11() {}
+
+angle::Result StagingTexturePool11::acquire(const gl::Context *context,
+                                            ResourceType textureType,
+                                            const d3d11::Format &formatSet,
+                                            const gl::Extents &size,
+                                            TextureHelper11 *textureOut)
+{
+    ASSERT(size.depth == 1);
+
+    if (size.width > kMaxPooledSize || size.height > kMaxPooledSize)
+    {
+        return mRenderer->createStagingTexture(context, textureType, formatSet, size,
+                                               StagingAccess::READ, textureOut);
+    }
+
+    gl::Extents bucketSize(GetBucketSize(size.width), GetBucketSize(size.height), 1);
+
+    // The most recently released textures are the most likely to still be in the driver's caches.
+    for (auto iter = mFreeTextures.rbegin(); iter != mFreeTextures.rend(); ++iter)
+    {
+        if (iter->getTextureType() == textureType &&
+            iter->getFormatSet().formatID == formatSet.formatID &&
+            iter->getFormat() == formatSet.texFormat && iter->getExtents() == bucketSize)
+        {
+            *textureOut = std::move(*iter);
+            mFreeTextures.erase(std::next(iter).base());
+            return angle::Result::Continue;
+        }
+    }
+
+    ANGLE_TRY(mRenderer->createStagingTexture(context, textureType, formatSet, bucketSize,
+                                              StagingAccess::READ, textureOut));
+    textureOut->setInternalName("StagingTexturePool11");
+    return angle::Result::Continue;
+}
+
+void StagingTexturePool11::release(TextureHelper11 &&texture)
+{
+    const gl::Extents &extents = texture.getExtents();
+    if (!texture.valid() || extents.width > kMaxPooledSize || extents.height > kMaxPooledSize)
+    {
+        return;
+    }
+
+    mFreeTextures.push_back(std::move(texture));
+    if (mFreeTextures.size() > kMaxFreeTextures)
+    {
+        mFreeTextures.pop_front();
+    }
+}
+
+void StagingTexturePool11::clear()
+{
+    mFreeTextures.clear();
+}
+
+}  // namespace rx
@@ -0,0 +1,63 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StagingTexturePool11.h:
+//   A pool of the staging textures that readbacks copy to, so that each readPixels doesn't create
+//   and destroy one.
+//
+
+#ifndef LIBANGLE_RENDERER_D3D_D3D11_STAGINGTEXTUREPOOL11_H_
+#define LIBANGLE_RENDERER_D3D_D3D11_STAGINGTEXTUREPOOL11_H_
+
+#include <deque>
+
+#include "libANGLE/Error.h"
+#include "libANGLE/renderer/d3d/d3d11/renderer11_utils.h"
+
+namespace gl
+{
+class Context;
+}  // namespace gl
+
+namespace rx
+{
+class Renderer11;
+
+class StagingTexturePool11 : angle::NonCopyable
+{
+  public:
+    explicit StagingTexturePool11(Renderer11 *renderer);
+    ~StagingTexturePool11();
+
+    // Returns a readable staging texture of |formatSet| that is at least as large as |size|.  The
+    // sizes are rounded up to powers of two, so that readbacks of slightly different areas can
+    // share the same textures.
+    angle::Result acquire(const gl::Context *context,
+                          ResourceType textureType,
+                          const d3d11::Format &formatSet,
+                          const gl::Extents &size,
+                          TextureHelper11 *textureOut);
+
+    // Gives a texture returned by acquire back to the pool.  It must not be mapped.
+    void release(TextureHelper11 &&texture);
+
+    void clear();
+
+  private:
+    // The pool keeps at most this many textures, and the least recently released are destroyed
+    // first.
+    static constexpr size_t kMaxFreeTextures = 8;
+
+    // Readbacks of larger areas than this use a texture of their exact size, which isn't pooled.
+    static constexpr int kMaxPooledSize = 4096;
+
+    Renderer11 *mRenderer;
+    std::deque<TextureHelper11> mFreeTextures;
+};
+
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_D3D_D3D11_STAGINGTEXTUREPOOL11_H_
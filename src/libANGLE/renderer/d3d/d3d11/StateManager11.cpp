@@ -227,6 +227,13 @@ void UpdateUniformBuffer(ID3D11DeviceContext *deviceContext,
                                      0);
 }
 
+// The default uniform blocks of the draws are sub-allocated from one dynamic constant buffer of
+// this size when uploadDefaultUniformsThroughConstantBufferRing is enabled.
+constexpr size_t kUniformRingBufferSize = 1024 * 1024;
+// Constant buffer offsets are given in 16-byte constants, and must be multiples of 16 constants.
+constexpr size_t kUniformRingBufferAlignment = 256;
+constexpr size_t kConstantSize               = 16;
+
 size_t GetReservedBufferCount(bool usesPointSpriteEmulation)
 {
     return usesPointSpriteEmulation ? 1 : 0;
@@ -555,6 +562,21 @@ ANGLE_INLINE bool ShaderConstants11::onFirstVertexChange(GLint firstVertex)
     return firstVertexDirty;
 }
 
+// Update the ShaderConstants for a change between point and non-point draws and return whether the
+// update dirties them.
+bool ShaderConstants11::onPointSpritesActiveChange(bool pointSpritesActive)
+{
+    float newPointSpriteScale = pointSpritesActive ? 1.0f : 0.0f;
+
+    bool pointSpriteScaleDirty = (mVertex.pointSpriteScale != newPointSpriteScale);
+    if (pointSpriteScaleDirty)
+    {
+        mVertex.pointSpriteScale = newPointSpriteScale;
+        mShaderConstantsDirty.set(gl::ShaderType::Vertex);
+    }
+    return pointSpriteScaleDirty;
+}
+
 void ShaderConstants11::onSamplerChange(gl::ShaderType shaderType,
                                         unsigned int samplerIndex,
                                         const gl::Texture &texture,
@@ -711,6 +733,8 @@ StateManager11::StateManager11(Renderer11 *renderer)
       mIndexDataManager(renderer),
       mIsMultiviewEnabled(false),
       mIndependentBlendStates(false),
+      mUniformRingBufferOffset(0),
+      mUniformRingBufferGeneration(0),
       mEmptySerial(mRenderer->generateSerial()),
       mProgramD3D(nullptr),
       mVertexArray11(nullptr),
@@ -1984,12 +2008,16 @@ angle::Result StateManager11::ensureInitialized(const gl::Context *context)
 
     mCurrentAttributes.reserve(gl::MAX_VERTEX_ATTRIBS);
 
+    ANGLE_TRY(mInputLayoutCache.warmUp(GetImplAs<Context11>(context)));
+    mRenderer->precreateRenderStates(context);
+
     return angle::Result::Continue;
 }
 
 void StateManager11::deinitialize()
 {
     mCurrentValueAttribs.clear();
+    mInputLayoutCache.saveWarmUpList(mRenderer);
     mInputLayoutCache.clear();
     mVertexDataManager.deinitialize();
     mIndexDataManager.deinitialize();
@@ -2001,6 +2029,9 @@ void StateManager11::deinitialize()
 
     mPointSpriteVertexBuffer.reset();
     mPointSpriteIndexBuffer.reset();
+
+    mUniformRingBuffer.reset();
+    mUniformRingAllocations.fill(UniformRingAllocation());
 }
 
 // Applies the render target surface, depth stencil surface, viewport rectangle and
@@ -2311,6 +2342,13 @@ angle::Result StateManager11::updateState(const gl::Context *context,
             // Changing from points to not points (or vice-versa) affects the geometry shader.
             invalidateShaders();
         }
+
+        // Point sprites expanded from the vertex ID are only moved to their quad vertices in
+        // point draws.
+        if (mShaderConstants.onPointSpritesActiveChange(pointDrawMode))
+        {
+            mInternalDirtyBits.set(DIRTY_BIT_DRIVER_UNIFORMS);
+        }
     }
 
     auto dirtyBitsCopy = mInternalDirtyBits & mGraphicsDirtyBitsMask;
@@ -2414,6 +2452,15 @@ void StateManager11::setShaderResource(gl::ShaderType shaderType,
     mInternalDirtyBits.set(DIRTY_BIT_TEXTURE_AND_SAMPLER_STATE);
 }
 
+void StateManager11::setUnorderedAccessView(gl::ShaderType shaderType,
+                                            UINT resourceSlot,
+                                            const d3d11::UnorderedAccessView *uav)
+{
+    setUnorderedAccessViewInternal(shaderType, resourceSlot, uav);
+
+    mInternalDirtyBits.set(DIRTY_BIT_COMPUTE_SRVUAV_STATE);
+}
+
 void StateManager11::setPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY primitiveTopology)
 {
     if (setPrimitiveTopologyInternal(primitiveTopology))
@@ -2555,6 +2602,21 @@ void StateManager11::setPixelConstantBuffer(unsigned int slot, const d3d11::Buff
     }
 }
 
+void StateManager11::setComputeConstantBuffer(const d3d11::Buffer *buffer)
+{
+    ASSERT(buffer);
+
+    if (mCurrentComputeConstantBuffer != buffer->getSerial())
+    {
+        mRenderer->getDeviceContext()->CSSetConstantBuffers(
+            d3d11::RESERVED_CONSTANT_BUFFER_SLOT_DEFAULT_UNIFORM_BLOCK, 1, buffer->getPointer());
+        mCurrentComputeConstantBuffer = buffer->getSerial();
+
+        // The program's default uniform block has to be bound again before the next dispatch.
+        invalidateProgramUniforms();
+    }
+}
+
 void StateManager11::setDepthStencilState(const d3d11::DepthStencilState *depthStencilState,
                                           UINT stencilRef)
 {
@@ -3080,8 +3142,12 @@ angle::Result StateManager11::applyVertexBuffers(const gl::Context *context,
     bool instancedPointSpritesActive =
         programUsesInstancedPointSprites && (mode == gl::PrimitiveMode::Points);
 
+    // Point sprites expanded from the vertex ID don't need the sprite vertex and index buffers.
+    bool programUsesPointSpriteBuffers =
+        programUsesInstancedPointSprites && !mProgramD3D->usesVertexIdPointSpriteExpansion();
+
     // Note that if we use instance emulation, we reserve the first buffer slot.
-    size_t reservedBuffers = GetReservedBufferCount(programUsesInstancedPointSprites);
+    size_t reservedBuffers = GetReservedBufferCount(programUsesPointSpriteBuffers);
 
     for (size_t attribIndex = 0; attribIndex < (gl::MAX_VERTEX_ATTRIBS - reservedBuffers);
          ++attribIndex)
@@ -3151,7 +3217,7 @@ angle::Result StateManager11::applyVertexBuffers(const gl::Context *context,
     // D3D11 FL9_3 requires DrawIndexedInstanced() to be used. Shaders that contain gl_PointSize and
     // used without the GL_POINTS rendering mode require a vertex buffer because some drivers cannot
     // handle missing vertex data and will TDR the system.
-    if (programUsesInstancedPointSprites)
+    if (programUsesPointSpriteBuffers)
     {
         constexpr UINT kPointSpriteVertexStride = sizeof(float) * 5;
 
@@ -3296,7 +3362,8 @@ angle::Result StateManager11::updateVertexOffsetsForPointSpritesEmulation(
     GLint startVertex,
     GLsizei emulatedInstanceId)
 {
-    size_t reservedBuffers = GetReservedBufferCount(true);
+    size_t reservedBuffers =
+        GetReservedBufferCount(!mProgramD3D->usesVertexIdPointSpriteExpansion());
     for (size_t attribIndex = 0; attribIndex < mCurrentAttributes.size(); ++attribIndex)
     {
         const auto &attrib = *mCurrentAttributes[attribIndex];
@@ -3428,10 +3495,158 @@ angle::Result StateManager11::applyUniformsForShader(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result StateManager11::applyUniformsThroughConstantBufferRing(const gl::Context *context)
+{
+    constexpr gl::ShaderType kShaderTypes[] = {gl::ShaderType::Vertex, gl::ShaderType::Fragment};
+
+    if (!mUniformRingBuffer.valid())
+    {
+        D3D11_BUFFER_DESC desc;
+        d3d11::InitConstantBufferDesc(&desc, kUniformRingBufferSize);
+        ANGLE_TRY(mRenderer->allocateResource(GetImplAs<Context11>(context), desc,
+                                              &mUniformRingBuffer));
+
+        // The first upload discards the buffer, so it starts out as full.
+        mUniformRingBufferOffset = kUniformRingBufferSize;
+    }
+
+    gl::ShaderMap<UniformStorage11 *> storages;
+    gl::ShaderBitSet shadersToUpload;
+    size_t uploadSize = 0;
+
+    for (gl::ShaderType shaderType : kShaderTypes)
+    {
+        storages[shaderType] =
+            GetAs<UniformStorage11>(mProgramD3D->getShaderUniformStorage(shaderType));
+        ASSERT(storages[shaderType]);
+
+        const UniformRingAllocation &allocation = mUniformRingAllocations[shaderType];
+        if (storages[shaderType]->size() > 0 &&
+            (mProgramD3D->areShaderUniformsDirty(shaderType) ||
+             allocation.storage != storages[shaderType] ||
+             allocation.generation != mUniformRingBufferGeneration))
+        {
+            shadersToUpload.set(shaderType);
+            uploadSize += roundUpPow2(storages[shaderType]->size(), kUniformRingBufferAlignment);
+        }
+    }
+
+    // Append the uniforms after the ones in flight with NO_OVERWRITE, so the GPU never waits for
+    // the previous draws.  Once the buffer is full, it is discarded, which also loses the uniforms
+    // of the stages that weren't dirty, so they are uploaded again.
+    D3D11_MAP mapType = D3D11_MAP_WRITE_NO_OVERWRITE;
+    if (uploadSize > kUniformRingBufferSize - mUniformRingBufferOffset)
+    {
+        mapType                  = D3D11_MAP_WRITE_DISCARD;
+        mUniformRingBufferOffset = 0;
+        ++mUniformRingBufferGeneration;
+
+        shadersToUpload.reset();
+        for (gl::ShaderType shaderType : kShaderTypes)
+        {
+            if (storages[shaderType]->size() > 0)
+            {
+                shadersToUpload.set(shaderType);
+            }
+        }
+    }
+
+    if (shadersToUpload.any())
+    {
+        D3D11_MAPPED_SUBRESOURCE mapping = {};
+        ANGLE_TRY(mRenderer->mapResource(context, mUniformRingBuffer.get(), 0, mapType, 0,
+                                         &mapping));
+
+        for (gl::ShaderType shaderType : shadersToUpload)
+        {
+            UniformStorage11 *storage = storages[shaderType];
+            size_t alignedSize        = roundUpPow2(storage->size(), kUniformRingBufferAlignment);
+            ASSERT(mUniformRingBufferOffset + alignedSize <= kUniformRingBufferSize);
+
+            memcpy(static_cast<uint8_t *>(mapping.pData) + mUniformRingBufferOffset,
+                   storage->getDataPointer(0, 0), storage->size());
+
+            UniformRingAllocation &allocation = mUniformRingAllocations[shaderType];
+            allocation.storage                = storage;
+            allocation.generation             = mUniformRingBufferGeneration;
+            allocation.offset                 = mUniformRingBufferOffset;
+            allocation.size                   = alignedSize;
+
+            mUniformRingBufferOffset += alignedSize;
+        }
+
+        mRenderer->unmapResource(mUniformRingBuffer.get(), 0);
+    }
+
+    ID3D11DeviceContext1 *deviceContext1 = mRenderer->getDeviceContext1IfSupported();
+    ASSERT(deviceContext1);
+
+    unsigned int slot     = d3d11::RESERVED_CONSTANT_BUFFER_SLOT_DEFAULT_UNIFORM_BLOCK;
+    ResourceSerial serial = mUniformRingBuffer.getSerial();
+
+    for (gl::ShaderType shaderType : kShaderTypes)
+    {
+        // Stages without uniforms don't read the default uniform block.
+        if (storages[shaderType]->size() == 0)
+        {
+            continue;
+        }
+
+        const UniformRingAllocation &allocation = mUniformRingAllocations[shaderType];
+        GLintptr offset                         = static_cast<GLintptr>(allocation.offset);
+        GLsizeiptr size                         = static_cast<GLsizeiptr>(allocation.size);
+
+        UINT firstConstant = static_cast<UINT>(allocation.offset / kConstantSize);
+        UINT numConstants  = static_cast<UINT>(allocation.size / kConstantSize);
+
+        switch (shaderType)
+        {
+            case gl::ShaderType::Vertex:
+                if (mCurrentConstantBufferVS[slot] != serial ||
+                    mCurrentConstantBufferVSOffset[slot] != offset ||
+                    mCurrentConstantBufferVSSize[slot] != size)
+                {
+                    deviceContext1->VSSetConstantBuffers1(slot, 1, mUniformRingBuffer.getPointer(),
+                                                          &firstConstant, &numConstants);
+                    mCurrentConstantBufferVS[slot]       = serial;
+                    mCurrentConstantBufferVSOffset[slot] = offset;
+                    mCurrentConstantBufferVSSize[slot]   = size;
+                }
+                break;
+
+            case gl::ShaderType::Fragment:
+                if (mCurrentConstantBufferPS[slot] != serial ||
+                    mCurrentConstantBufferPSOffset[slot] != offset ||
+                    mCurrentConstantBufferPSSize[slot] != size)
+                {
+                    deviceContext1->PSSetConstantBuffers1(slot, 1, mUniformRingBuffer.getPointer(),
+                                                          &firstConstant, &numConstants);
+                    mCurrentConstantBufferPS[slot]       = serial;
+                    mCurrentConstantBufferPSOffset[slot] = offset;
+                    mCurrentConstantBufferPSSize[slot]   = size;
+                }
+                break;
+
+            default:
+                UNREACHABLE();
+                break;
+        }
+    }
+
+    return angle::Result::Continue;
+}
+
 angle::Result StateManager11::applyUniforms(const gl::Context *context)
 {
-    ANGLE_TRY(applyUniformsForShader(context, gl::ShaderType::Vertex));
-    ANGLE_TRY(applyUniformsForShader(context, gl::ShaderType::Fragment));
+    if (mRenderer->getFeatures().uploadDefaultUniformsThroughConstantBufferRing.enabled)
+    {
+        ANGLE_TRY(applyUniformsThroughConstantBufferRing(context));
+    }
+    else
+    {
+        ANGLE_TRY(applyUniformsForShader(context, gl::ShaderType::Vertex));
+        ANGLE_TRY(applyUniformsForShader(context, gl::ShaderType::Fragment));
+    }
     if (mProgramD3D->hasShaderStage(gl::ShaderType::Geometry))
     {
         ANGLE_TRY(applyUniformsForShader(context, gl::ShaderType::Geometry));
@@ -3956,7 +4171,7 @@ void StateManager11::syncPrimitiveTopology(const gl::State &glState,
 
             // If instanced pointsprites are enabled and the shader uses gl_PointSize, the topology
             // must be D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST.
-            if (usesPointSize && mRenderer->getFeatures().useInstancedPointSpriteEmulation.enabled)
+            if (usesPointSize && mProgramD3D->usesInstancedPointSpriteEmulation())
             {
                 primitiveTopology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
             }
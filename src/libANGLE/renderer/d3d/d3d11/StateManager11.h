@@ -26,6 +26,7 @@ class DisplayD3D;
 class Framebuffer11;
 struct RenderTargetDesc;
 struct Renderer11DeviceCaps;
+class UniformStorage11;
 class VertexArray11;
 
 class ShaderConstants11 : angle::NonCopyable
@@ -45,6 +46,7 @@ class ShaderConstants11 : angle::NonCopyable
                           bool is9_3,
                           bool presentPathFast);
     bool onFirstVertexChange(GLint firstVertex);
+    bool onPointSpritesActiveChange(bool pointSpritesActive);
     void onImageLayerChange(gl::ShaderType shaderType, unsigned int imageIndex, int layer);
     void onSamplerChange(gl::ShaderType shaderType,
                          unsigned int samplerIndex,
@@ -73,7 +75,8 @@ class ShaderConstants11 : angle::NonCopyable
               clipControlOrigin{-1.0f},
               clipControlZeroToOne{.0f},
               firstVertex{0},
-              padding{.0f, .0f}
+              pointSpriteScale{.0f},
+              padding{.0f}
         {}
 
         float depthRange[4];
@@ -93,8 +96,12 @@ class ShaderConstants11 : angle::NonCopyable
 
         uint32_t firstVertex;
 
+        // 1.0 when drawing points, so that the expanded point sprites are moved to their quad
+        // vertices, and 0.0 otherwise.
+        float pointSpriteScale;
+
         // Added here to manually pad the struct to 16 byte boundary
-        float padding[2];
+        float padding;
     };
     static_assert(sizeof(Vertex) % 16u == 0,
                   "D3D11 constant buffers must be multiples of 16 bytes");
@@ -267,6 +274,9 @@ class StateManager11 final : angle::NonCopyable
     void setShaderResource(gl::ShaderType shaderType,
                            UINT resourceSlot,
                            const d3d11::ShaderResourceView *srv);
+    void setUnorderedAccessView(gl::ShaderType shaderType,
+                                UINT resourceSlot,
+                                const d3d11::UnorderedAccessView *uav);
     void setPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY primitiveTopology);
 
     void setDrawShaders(const d3d11::VertexShader *vertexShader,
@@ -278,6 +288,8 @@ class StateManager11 final : angle::NonCopyable
     void setComputeShader(const d3d11::ComputeShader *shader);
     void setVertexConstantBuffer(unsigned int slot, const d3d11::Buffer *buffer);
     void setPixelConstantBuffer(unsigned int slot, const d3d11::Buffer *buffer);
+    // Binds an internal constant buffer in place of the compute program's default uniform block.
+    void setComputeConstantBuffer(const d3d11::Buffer *buffer);
     void setDepthStencilState(const d3d11::DepthStencilState *depthStencilState, UINT stencilRef);
     void setSimpleBlendState(const d3d11::BlendState *blendState);
     void setRasterizerState(const d3d11::RasterizerState *rasterizerState);
@@ -393,6 +405,7 @@ class StateManager11 final : angle::NonCopyable
                                                gl::ShaderType shaderType);
     angle::Result applyUniforms(const gl::Context *context);
     angle::Result applyUniformsForShader(const gl::Context *context, gl::ShaderType shaderType);
+    angle::Result applyUniformsThroughConstantBufferRing(const gl::Context *context);
 
     angle::Result syncShaderStorageBuffersForShader(const gl::Context *context,
                                                     gl::ShaderType shaderType);
@@ -655,6 +668,21 @@ class StateManager11 final : angle::NonCopyable
     ComputeConstantBufferArray<GLintptr> mCurrentConstantBufferCSOffset;
     ComputeConstantBufferArray<GLsizeiptr> mCurrentConstantBufferCSSize;
 
+    // Default uniform blocks sub-allocated from a dynamic constant buffer.  The generation is
+    // bumped each time the buffer is discarded, which invalidates all the allocations.
+    struct UniformRingAllocation
+    {
+        const UniformStorage11 *storage = nullptr;
+        unsigned int generation         = 0;
+        size_t offset                   = 0;
+        size_t size                     = 0;
+    };
+
+    d3d11::Buffer mUniformRingBuffer;
+    size_t mUniformRingBufferOffset;
+    unsigned int mUniformRingBufferGeneration;
+    gl::ShaderMap<UniformRingAllocation> mUniformRingAllocations;
+
     // Currently applied transform feedback buffers
     Serial mAppliedTFSerial;
 
@@ -42,6 +42,9 @@ namespace
 static constexpr int64_t kQPCOverflowThreshold  = 0x8637BD05AF7;
 static constexpr int64_t kMicrosecondsPerSecond = 1000000;
 
+// Bounds the wait on the frame latency waitable object in case the compositor stops presenting.
+static constexpr DWORD kFrameLatencyWaitTimeoutMs = 1000;
+
 bool NeedsOffscreenTexture(Renderer11 *renderer, NativeWindow11 *nativeWindow, EGLint orientation)
 {
     // We don't need an offscreen texture if either orientation = INVERT_Y,
@@ -72,6 +75,10 @@ SwapChain11::SwapChain11(Renderer11 *renderer,
       mSwapChain(nullptr),
       mSwapChain1(nullptr),
       mKeyedMutex(nullptr),
+      mFrameLatencyWaitableObject(nullptr),
+      mFrameLatencyWaitableObjectQueried(false),
+      mAllowTearing(false),
+      mFlipDiscard(false),
       mBackBufferTexture(),
       mBackBufferRTView(),
       mBackBufferSRView(),
@@ -114,8 +121,7 @@ void SwapChain11::release()
 {
     // TODO(jmadill): Should probably signal that the RenderTarget is dirty.
 
-    SafeRelease(mSwapChain1);
-    SafeRelease(mSwapChain);
+    releaseSwapChain();
     SafeRelease(mKeyedMutex);
     mBackBufferTexture.reset();
     mBackBufferRTView.reset();
@@ -139,6 +145,21 @@ void SwapChain11::release()
     }
 }
 
+void SwapChain11::releaseSwapChain()
+{
+    if (mFrameLatencyWaitableObject != nullptr)
+    {
+        CloseHandle(mFrameLatencyWaitableObject);
+        mFrameLatencyWaitableObject = nullptr;
+    }
+    mFrameLatencyWaitableObjectQueried = false;
+    mAllowTearing                      = false;
+    mFlipDiscard                       = false;
+
+    SafeRelease(mSwapChain1);
+    SafeRelease(mSwapChain);
+}
+
 void SwapChain11::releaseOffscreenColorBuffer()
 {
     mOffscreenTexture.reset();
@@ -508,8 +529,9 @@ EGLint SwapChain11::resize(DisplayD3D *displayD3D, EGLint backbufferWidth, EGLin
         return EGL_BAD_ALLOC;
     }
 
+    // The flags can't change on resize.
     hr = mSwapChain->ResizeBuffers(desc.BufferCount, backbufferWidth, backbufferHeight,
-                                   getSwapChainNativeFormat(), 0);
+                                   getSwapChainNativeFormat(), desc.Flags);
 
     if (FAILED(hr))
     {
@@ -613,8 +635,7 @@ EGLint SwapChain11::reset(DisplayD3D *displayD3D,
 
     // Release specific resources to free up memory for the new render target, while the
     // old render target still exists for the purpose of preserving its contents.
-    SafeRelease(mSwapChain1);
-    SafeRelease(mSwapChain);
+    releaseSwapChain();
     mBackBufferTexture.reset();
     mBackBufferRTView.reset();
 
@@ -655,6 +676,24 @@ EGLint SwapChain11::reset(DisplayD3D *displayD3D,
             mSwapChain1 = d3d11::DynamicCastComObject<IDXGISwapChain1>(mSwapChain);
         }
 
+        DXGI_SWAP_CHAIN_DESC desc;
+        if (SUCCEEDED(mSwapChain->GetDesc(&desc)))
+        {
+            mFlipDiscard  = desc.SwapEffect == DXGI_SWAP_EFFECT_FLIP_DISCARD;
+            mAllowTearing = (desc.Flags & DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING) != 0;
+
+            if ((desc.Flags & DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT) != 0)
+            {
+                IDXGISwapChain2 *swapChain2 =
+                    d3d11::DynamicCastComObject<IDXGISwapChain2>(mSwapChain);
+                if (swapChain2 != nullptr)
+                {
+                    mFrameLatencyWaitableObject = swapChain2->GetFrameLatencyWaitableObject();
+                    SafeRelease(swapChain2);
+                }
+            }
+        }
+
         ID3D11Texture2D *backbufferTex = nullptr;
         hr                             = mSwapChain->GetBuffer(0, __uuidof(ID3D11Texture2D),
                                    reinterpret_cast<LPVOID *>(&backbufferTex));
@@ -793,7 +832,11 @@ EGLint SwapChain11::swapRect(DisplayD3D *displayD3D,
 {
     if (mNeedsOffscreenTexture)
     {
-        EGLint result = copyOffscreenToBackbuffer(displayD3D, x, y, width, height);
+        // A flip-discard back buffer has undefined contents, so all of it is copied.  Present
+        // still passes the swapped rect as the dirty rect.
+        EGLint result = mFlipDiscard
+                            ? copyOffscreenToBackbuffer(displayD3D, 0, 0, mWidth, mHeight)
+                            : copyOffscreenToBackbuffer(displayD3D, x, y, width, height);
         if (result != EGL_SUCCESS)
         {
             return result;
@@ -911,7 +954,18 @@ EGLint SwapChain11::present(DisplayD3D *displayD3D, EGLint x, EGLint y, EGLint w
     swapInterval = 0;
 #endif
 
-    HRESULT result = S_OK;
+    // The commands recorded in a deferred context have to be executed before the frame is
+    // presented.
+    HRESULT result = mRenderer->executeRecordedCommands();
+    if (FAILED(result))
+    {
+        ERR() << "Failed to execute the recorded commands before presenting, "
+              << gl::FmtHR(result);
+        return EGL_BAD_ALLOC;
+    }
+
+    // A zero swap interval may tear on variable refresh rate displays.
+    UINT flags = (mAllowTearing && swapInterval == 0) ? DXGI_PRESENT_ALLOW_TEARING : 0;
 
     // Use IDXGISwapChain1::Present1 with a dirty rect if DXGI 1.2 is available.
     // Dirty rect present is not supported with a multisampled swapchain.
@@ -921,19 +975,19 @@ EGLint SwapChain11::present(DisplayD3D *displayD3D, EGLint x, EGLint y, EGLint w
         {
             // Can't swap with a dirty rect if this swap chain has never swapped before
             DXGI_PRESENT_PARAMETERS params = {0, nullptr, nullptr, nullptr};
-            result                         = mSwapChain1->Present1(swapInterval, 0, &params);
+            result                         = mSwapChain1->Present1(swapInterval, flags, &params);
         }
         else
         {
             RECT rect = {static_cast<LONG>(x), static_cast<LONG>(mHeight - y - height),
                          static_cast<LONG>(x + width), static_cast<LONG>(mHeight - y)};
             DXGI_PRESENT_PARAMETERS params = {1, &rect, nullptr, nullptr};
-            result                         = mSwapChain1->Present1(swapInterval, 0, &params);
+            result                         = mSwapChain1->Present1(swapInterval, flags, &params);
         }
     }
     else
     {
-        result = mSwapChain->Present(swapInterval, 0);
+        result = mSwapChain->Present(swapInterval, flags);
     }
 
     mFirstSwap = false;
@@ -960,6 +1014,13 @@ EGLint SwapChain11::present(DisplayD3D *displayD3D, EGLint x, EGLint y, EGLint w
 
     mNativeWindow->commitChange();
 
+    // Block until the queue of frames has room, which then doesn't happen in the next Present, so
+    // that the application samples its input for the next frame as late as possible.
+    if (mFrameLatencyWaitableObject != nullptr && !mFrameLatencyWaitableObjectQueried)
+    {
+        WaitForSingleObjectEx(mFrameLatencyWaitableObject, kFrameLatencyWaitTimeoutMs, TRUE);
+    }
+
     return EGL_SUCCESS;
 }
 
@@ -1044,6 +1105,13 @@ void *SwapChain11::getKeyedMutex()
     return mKeyedMutex;
 }
 
+void *SwapChain11::getFrameLatencyWaitableObject()
+{
+    // The application now waits on the object before rendering each frame.
+    mFrameLatencyWaitableObjectQueried = mFrameLatencyWaitableObject != nullptr;
+    return mFrameLatencyWaitableObject;
+}
+
 void SwapChain11::recreate()
 {
     // possibly should use this method instead of reset
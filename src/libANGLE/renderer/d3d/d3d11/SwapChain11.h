@@ -57,12 +57,14 @@ class SwapChain11 final : public SwapChainD3D
     EGLint getWidth() const { return mWidth; }
     EGLint getHeight() const { return mHeight; }
     void *getKeyedMutex() override;
+    void *getFrameLatencyWaitableObject() override;
     EGLint getSamples() const { return mEGLSamples; }
 
     egl::Error getSyncValues(EGLuint64KHR *ust, EGLuint64KHR *msc, EGLuint64KHR *sbc) override;
 
   private:
     void release();
+    void releaseSwapChain();
     angle::Result initPassThroughResources(DisplayD3D *displayD3D);
 
     void releaseOffscreenColorBuffer();
@@ -100,6 +102,13 @@ class SwapChain11 final : public SwapChainD3D
     IDXGISwapChain1 *mSwapChain1;
     IDXGIKeyedMutex *mKeyedMutex;
 
+    // Set if the swap chain was created with DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT.
+    // Once the application has queried the waitable object it waits on it itself.
+    HANDLE mFrameLatencyWaitableObject;
+    bool mFrameLatencyWaitableObjectQueried;
+    bool mAllowTearing;
+    bool mFlipDiscard;
+
     TextureHelper11 mBackBufferTexture;
     d3d11::RenderTargetView mBackBufferRTView;
     d3d11::SharedSRV mBackBufferSRView;
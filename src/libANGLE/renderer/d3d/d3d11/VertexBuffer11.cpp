@@ -69,6 +69,32 @@ angle::Result VertexBuffer11::initialize(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result VertexBuffer11::initializeForUnorderedAccess(const gl::Context *context,
+                                                           unsigned int size)
+{
+    ASSERT(size > 0 && size % 4 == 0);
+    ASSERT(mMappedResourceData == nullptr);
+
+    mBuffer.reset();
+    updateSerial();
+
+    D3D11_BUFFER_DESC bufferDesc;
+    bufferDesc.ByteWidth           = size;
+    bufferDesc.Usage               = D3D11_USAGE_DEFAULT;
+    bufferDesc.BindFlags           = D3D11_BIND_VERTEX_BUFFER | D3D11_BIND_UNORDERED_ACCESS;
+    bufferDesc.CPUAccessFlags      = 0;
+    bufferDesc.MiscFlags           = D3D11_RESOURCE_MISC_BUFFER_ALLOW_RAW_VIEWS;
+    bufferDesc.StructureByteStride = 0;
+
+    ANGLE_TRY(mRenderer->allocateResource(GetImplAs<Context11>(context), bufferDesc, &mBuffer));
+    mBuffer.setInternalName("VertexBuffer11(static, converted)");
+
+    mBufferSize   = size;
+    mDynamicUsage = false;
+
+    return angle::Result::Continue;
+}
+
 angle::Result VertexBuffer11::mapResource(const gl::Context *context)
 {
     if (mMappedResourceData == nullptr)
@@ -88,8 +114,7 @@ void VertexBuffer11::hintUnmapResource()
 {
     if (mMappedResourceData != nullptr)
     {
-        ID3D11DeviceContext *dxContext = mRenderer->getDeviceContext();
-        dxContext->Unmap(mBuffer.get(), 0);
+        mRenderer->unmapResource(mBuffer.get(), 0);
 
         mMappedResourceData = nullptr;
     }
@@ -27,6 +27,10 @@ class VertexBuffer11 : public VertexBuffer
                              unsigned int size,
                              bool dynamicUsage) override;
 
+    // Creates a static buffer that is written by a compute shader through |getBuffer()| instead of
+    // being mapped.  |size| must be a multiple of four bytes.
+    angle::Result initializeForUnorderedAccess(const gl::Context *context, unsigned int size);
+
     // Warning: you should ensure binding really matches attrib.bindingIndex before using this
     // function.
     angle::Result storeVertexAttributes(const gl::Context *context,
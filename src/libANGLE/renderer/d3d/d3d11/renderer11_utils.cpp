@@ -2550,6 +2550,42 @@ void InitializeFeatures(const Renderer11DeviceCaps &deviceCaps,
     // to work around a slow fxc compile performance issue with dynamic uniform indexing.
     ANGLE_FEATURE_CONDITION(features, allowTranslateUniformBlockToStructuredBuffer,
                             IsWin10OrGreater());
+
+    // D3DCompile is the most expensive part of linking a program and of generating new input
+    // layout and output signature variants, and its output only depends on its inputs.
+    ANGLE_FEATURE_CONDITION(features, cacheCompiledShaderBinaries, true);
+
+    // Feature level 9_3 doesn't allow a buffer to be bound both as a vertex and an index buffer.
+    ANGLE_FEATURE_CONDITION(features, combineBufferBindFlags, !isFeatureLevel9_3);
+
+    // Executing command lists has its own overhead, which only pays off when the driver builds
+    // them natively.  Keep it opt-in until it is shown to be a win on real workloads.
+    ANGLE_FEATURE_CONDITION(features, recordCommandsInDeferredContext, false);
+
+    // Sub-allocating the default uniform blocks from one buffer needs D3D11.1's constant buffer
+    // offsets, and the driver's permission to map a constant buffer with NO_OVERWRITE.
+    ANGLE_FEATURE_CONDITION(features, uploadDefaultUniformsThroughConstantBufferRing,
+                            deviceCaps.supportsConstantBufferOffsets &&
+                                deviceCaps.supportsMapNoOverwriteOnDynamicConstantBuffer);
+
+    // Like the shader binaries, the input layouts created by a previous run of the application are
+    // likely to be needed again, so they are created ahead of the first draw.
+    ANGLE_FEATURE_CONDITION(features, warmUpInputLayoutCache, true);
+
+    // The conversion shaders write the index and vertex buffers through raw UAVs, which need
+    // feature level 11_0.
+    ANGLE_FEATURE_CONDITION(features, convertStaticBuffersWithComputeShaders,
+                            deviceCaps.featureLevel >= D3D_FEATURE_LEVEL_11_0);
+
+    // The render states are cheap to keep around, but creating them takes the device lock.
+    ANGLE_FEATURE_CONDITION(features, precreateRenderStates, true);
+
+    // SV_VertexID isn't available on Feature Level 9_3, which uses the sprite vertex buffer.
+    ANGLE_FEATURE_CONDITION(features, expandPointSpritesWithVertexId, false);
+
+    // Flip model windows can't mix with GDI drawing, so by default only surfaces created with
+    // EGL_LOW_LATENCY_PRESENT_ANGLE use it.
+    ANGLE_FEATURE_CONDITION(features, useFlipDiscardSwapChain, false);
 }
 
 void InitializeFrontendFeatures(const DXGI_ADAPTER_DESC &adapterDesc,
@@ -15,16 +15,44 @@
 #include <initguid.h>
 
 #include <dcomp.h>
+#include <dxgi1_5.h>
 
 namespace rx
 {
 
+namespace
+{
+// Frames that may be queued for presentation on a flip-discard swap chain.  DXGI queues up to
+// three frames by default.
+constexpr UINT kFrameLatency           = 3;
+constexpr UINT kLowLatencyFrameLatency = 1;
+
+bool SupportsTearing(IDXGIFactory2 *factory2)
+{
+    IDXGIFactory5 *factory5 = d3d11::DynamicCastComObject<IDXGIFactory5>(factory2);
+    if (factory5 == nullptr)
+    {
+        return false;
+    }
+
+    BOOL allowTearing = FALSE;
+    HRESULT result    = factory5->CheckFeatureSupport(DXGI_FEATURE_PRESENT_ALLOW_TEARING,
+                                                      &allowTearing, sizeof(allowTearing));
+    SafeRelease(factory5);
+    return SUCCEEDED(result) && allowTearing == TRUE;
+}
+}  // anonymous namespace
+
 NativeWindow11Win32::NativeWindow11Win32(EGLNativeWindowType window,
                                          bool hasAlpha,
-                                         bool directComposition)
+                                         bool directComposition,
+                                         bool flipDiscard,
+                                         bool lowLatency)
     : NativeWindow11(window),
       mDirectComposition(directComposition),
       mHasAlpha(hasAlpha),
+      mFlipDiscard(flipDiscard),
+      mLowLatency(lowLatency),
       mDevice(nullptr),
       mCompositionTarget(nullptr),
       mVisual(nullptr)
@@ -150,6 +178,16 @@ HRESULT NativeWindow11Win32::createSwapChain(ID3D11Device *device,
     IDXGIFactory2 *factory2 = d3d11::DynamicCastComObject<IDXGIFactory2>(factory);
     if (factory2 != nullptr)
     {
+        // The flip model doesn't support multisampled back buffers.  Creation also fails before
+        // Windows 10, which falls back to the sequential swap chain.
+        if (mFlipDiscard && samples <= 1 &&
+            SUCCEEDED(createFlipDiscardSwapChain(device, factory2, format, width, height,
+                                                 swapChain)))
+        {
+            SafeRelease(factory2);
+            return S_OK;
+        }
+
         DXGI_SWAP_CHAIN_DESC1 swapChainDesc = {};
         swapChainDesc.Width                 = width;
         swapChainDesc.Height                = height;
@@ -202,6 +240,56 @@ HRESULT NativeWindow11Win32::createSwapChain(ID3D11Device *device,
     return result;
 }
 
+HRESULT NativeWindow11Win32::createFlipDiscardSwapChain(ID3D11Device *device,
+                                                        IDXGIFactory2 *factory2,
+                                                        DXGI_FORMAT format,
+                                                        UINT width,
+                                                        UINT height,
+                                                        IDXGISwapChain **swapChain)
+{
+    // Flipping the back buffer to the compositor saves the copy into the redirection surface.
+    // The waitable object lets the application, or SwapChain11, block until the queue of frames
+    // has room instead of blocking in Present.
+    DXGI_SWAP_CHAIN_DESC1 swapChainDesc = {};
+    swapChainDesc.Width                 = width;
+    swapChainDesc.Height                = height;
+    swapChainDesc.Format                = format;
+    swapChainDesc.Stereo                = FALSE;
+    swapChainDesc.SampleDesc.Count      = 1;
+    swapChainDesc.SampleDesc.Quality    = 0;
+    swapChainDesc.BufferUsage =
+        DXGI_USAGE_RENDER_TARGET_OUTPUT | DXGI_USAGE_SHADER_INPUT | DXGI_USAGE_BACK_BUFFER;
+    swapChainDesc.BufferCount = mLowLatency ? 2 : 3;
+    swapChainDesc.Scaling     = DXGI_SCALING_STRETCH;
+    swapChainDesc.SwapEffect  = DXGI_SWAP_EFFECT_FLIP_DISCARD;
+    swapChainDesc.AlphaMode   = DXGI_ALPHA_MODE_UNSPECIFIED;
+    swapChainDesc.Flags       = DXGI_SWAP_CHAIN_FLAG_FRAME_LATENCY_WAITABLE_OBJECT;
+    if (SupportsTearing(factory2))
+    {
+        // Lets a zero swap interval present immediately on variable refresh rate displays.
+        swapChainDesc.Flags |= DXGI_SWAP_CHAIN_FLAG_ALLOW_TEARING;
+    }
+
+    IDXGISwapChain1 *swapChain1 = nullptr;
+    HRESULT result = factory2->CreateSwapChainForHwnd(device, getNativeWindow(), &swapChainDesc,
+                                                      nullptr, nullptr, &swapChain1);
+    if (FAILED(result))
+    {
+        return result;
+    }
+
+    IDXGISwapChain2 *swapChain2 = d3d11::DynamicCastComObject<IDXGISwapChain2>(swapChain1);
+    if (swapChain2 != nullptr)
+    {
+        swapChain2->SetMaximumFrameLatency(mLowLatency ? kLowLatencyFrameLatency : kFrameLatency);
+        SafeRelease(swapChain2);
+    }
+
+    factory2->MakeWindowAssociation(getNativeWindow(), DXGI_MWA_NO_ALT_ENTER);
+    *swapChain = static_cast<IDXGISwapChain *>(swapChain1);
+    return S_OK;
+}
+
 void NativeWindow11Win32::commitChange()
 {
     if (mDevice)
@@ -21,7 +21,11 @@ namespace rx
 class NativeWindow11Win32 : public NativeWindow11
 {
   public:
-    NativeWindow11Win32(EGLNativeWindowType window, bool hasAlpha, bool directComposition);
+    NativeWindow11Win32(EGLNativeWindowType window,
+                        bool hasAlpha,
+                        bool directComposition,
+                        bool flipDiscard,
+                        bool lowLatency);
     ~NativeWindow11Win32() override;
 
     bool initialize() override;
@@ -41,8 +45,17 @@ class NativeWindow11Win32 : public NativeWindow11
     static bool IsValidNativeWindow(EGLNativeWindowType window);
 
   private:
+    HRESULT createFlipDiscardSwapChain(ID3D11Device *device,
+                                       IDXGIFactory2 *factory2,
+                                       DXGI_FORMAT format,
+                                       UINT width,
+                                       UINT height,
+                                       IDXGISwapChain **swapChain);
+
     bool mDirectComposition;
     bool mHasAlpha;
+    bool mFlipDiscard;
+    bool mLowLatency;
     IDCompositionDevice *mDevice;
     IDCompositionTarget *mCompositionTarget;
     IDCompositionVisual *mVisual;
@@ -502,9 +502,10 @@ angle::Result Image9::loadData(const gl::Context *context,
     D3DLOCKED_RECT locked;
     ANGLE_TRY(lock(GetImplAs<Context9>(context), &locked, lockRect));
 
-    d3dFormatInfo.loadFunction(area.width, area.height, area.depth,
-                               static_cast<const uint8_t *>(input), inputRowPitch, 0,
-                               static_cast<uint8_t *>(locked.pBits), locked.Pitch, 0);
+    LoadImageInParallel(formatInfo.compressed ? nullptr : context->getWorkerThreadPool(),
+                        d3dFormatInfo.loadFunction, area.width, area.height, area.depth,
+                        static_cast<const uint8_t *>(input), inputRowPitch, 0,
+                        static_cast<uint8_t *>(locked.pBits), locked.Pitch, 0);
 
     unlock();
 
@@ -3047,6 +3047,33 @@ angle::Result Renderer9::getVertexSpaceRequired(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result Renderer9::convertStaticIndexData(const gl::Context *context,
+                                                BufferD3D *source,
+                                                gl::DrawElementsType srcType,
+                                                gl::DrawElementsType dstType,
+                                                unsigned int count,
+                                                bool usePrimitiveRestartFixedIndex,
+                                                StaticIndexBufferInterface *dest,
+                                                bool *convertedOut)
+{
+    // D3D9 has no compute shaders, the conversion is always done on the CPU.
+    *convertedOut = false;
+    return angle::Result::Continue;
+}
+
+angle::Result Renderer9::convertStaticVertexData(const gl::Context *context,
+                                                 BufferD3D *source,
+                                                 const gl::VertexAttribute &attrib,
+                                                 const gl::VertexBinding &binding,
+                                                 GLint start,
+                                                 GLsizei count,
+                                                 StaticVertexBufferInterface *dest,
+                                                 bool *convertedOut)
+{
+    *convertedOut = false;
+    return angle::Result::Continue;
+}
+
 void Renderer9::generateCaps(gl::Caps *outCaps,
                              gl::TextureCapsMap *outTextureCaps,
                              gl::Extensions *outExtensions,
@@ -371,6 +371,23 @@ class Renderer9 : public RendererD3D
                                          GLuint baseInstance,
                                          unsigned int *bytesRequiredOut) const override;
 
+    angle::Result convertStaticIndexData(const gl::Context *context,
+                                         BufferD3D *source,
+                                         gl::DrawElementsType srcType,
+                                         gl::DrawElementsType dstType,
+                                         unsigned int count,
+                                         bool usePrimitiveRestartFixedIndex,
+                                         StaticIndexBufferInterface *dest,
+                                         bool *convertedOut) override;
+    angle::Result convertStaticVertexData(const gl::Context *context,
+                                          BufferD3D *source,
+                                          const gl::VertexAttribute &attrib,
+                                          const gl::VertexBinding &binding,
+                                          GLint start,
+                                          GLsizei count,
+                                          StaticVertexBufferInterface *dest,
+                                          bool *convertedOut) override;
+
     angle::Result copyToRenderTarget(const gl::Context *context,
                                      IDirect3DSurface9 *dest,
                                      IDirect3DSurface9 *source,
@@ -422,6 +422,12 @@ void *SwapChain9::getKeyedMutex()
     return nullptr;
 }
 
+void *SwapChain9::getFrameLatencyWaitableObject()
+{
+    UNREACHABLE();
+    return nullptr;
+}
+
 egl::Error SwapChain9::getSyncValues(EGLuint64KHR *ust, EGLuint64KHR *msc, EGLuint64KHR *sbc)
 {
     UNREACHABLE();
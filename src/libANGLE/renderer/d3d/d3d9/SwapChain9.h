@@ -53,6 +53,7 @@ class SwapChain9 : public SwapChainD3D
     EGLint getHeight() const { return mHeight; }
 
     void *getKeyedMutex() override;
+    void *getFrameLatencyWaitableObject() override;
 
     egl::Error getSyncValues(EGLuint64KHR *ust, EGLuint64KHR *msc, EGLuint64KHR *sbc) override;
 
@@ -224,6 +224,28 @@ angle::Result UnbindAttachments(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+// glCopyImageSubData addresses cube map faces and array layers as the z coordinate.
+void GetCopyImageTargetAndLayer(const gl::ImageIndex &index, GLenum *targetOut, GLint *layerOut)
+{
+    *targetOut = ToGLenum(index.getType());
+    *layerOut  = index.hasLayer() ? index.getLayerIndex() : 0;
+}
+
+bool CanCopyAttachmentWithCopyImage(const gl::FramebufferAttachment *attachment,
+                                    const gl::Rectangle &area)
+{
+    if (attachment == nullptr || attachment->type() != GL_TEXTURE ||
+        attachment->getResourceSamples() > 1 || attachment->isLayered() ||
+        attachment->isMultiview() || attachment->isExternalTexture())
+    {
+        return false;
+    }
+
+    // Unlike blits, copies are not clipped.
+    const gl::Extents size = attachment->getSize();
+    return area.x >= 0 && area.y >= 0 && area.x1() <= size.width && area.y1() <= size.height;
+}
+
 }  // anonymous namespace
 
 BlitGL::BlitGL(const FunctionsGL *functions,
@@ -568,6 +590,98 @@ angle::Result BlitGL::blitColorBufferWithShader(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result BlitGL::blitColorBufferWithCopyImage(const gl::Context *context,
+                                                   const gl::Framebuffer *source,
+                                                   const gl::Framebuffer *dest,
+                                                   const gl::Rectangle &sourceArea,
+                                                   const gl::Rectangle &destArea,
+                                                   bool *copySucceededOut)
+{
+    *copySucceededOut = false;
+
+    if (mFunctions->copyImageSubData == nullptr || sourceArea.width <= 0 ||
+        sourceArea.height <= 0 || sourceArea.width != destArea.width ||
+        sourceArea.height != destArea.height)
+    {
+        return angle::Result::Continue;
+    }
+
+    const gl::FramebufferAttachment *readAttachment = source->getReadColorAttachment();
+    const gl::FramebufferAttachment *drawAttachment = nullptr;
+    for (size_t drawBufferIdx = 0; drawBufferIdx < dest->getDrawbufferStateCount();
+         ++drawBufferIdx)
+    {
+        const gl::FramebufferAttachment *attachment = dest->getDrawBuffer(drawBufferIdx);
+        if (attachment == nullptr)
+        {
+            continue;
+        }
+        if (drawAttachment != nullptr)
+        {
+            // Copies only have a single destination.
+            return angle::Result::Continue;
+        }
+        drawAttachment = attachment;
+    }
+
+    if (!CanCopyAttachmentWithCopyImage(readAttachment, sourceArea) ||
+        !CanCopyAttachmentWithCopyImage(drawAttachment, destArea) ||
+        readAttachment->getFormat().info->sizedInternalFormat !=
+            drawAttachment->getFormat().info->sizedInternalFormat)
+    {
+        return angle::Result::Continue;
+    }
+
+    const gl::ImageIndex &sourceIndex = readAttachment->getTextureImageIndex();
+    const gl::ImageIndex &destIndex   = drawAttachment->getTextureImageIndex();
+    const TextureGL *sourceGL         = GetImplAs<TextureGL>(readAttachment->getTexture());
+    const TextureGL *destGL           = GetImplAs<TextureGL>(drawAttachment->getTexture());
+    if (sourceGL->getNativeInternalFormat(sourceIndex) !=
+            destGL->getNativeInternalFormat(destIndex) ||
+        sourceGL->hasEmulatedAlphaChannel(sourceIndex) ||
+        destGL->hasEmulatedAlphaChannel(destIndex))
+    {
+        return angle::Result::Continue;
+    }
+
+    return copyImageSubData(context, sourceGL->getTextureID(), sourceIndex, destGL->getTextureID(),
+                            destIndex, sourceArea, gl::Offset(destArea.x, destArea.y, 0),
+                            copySucceededOut);
+}
+
+angle::Result BlitGL::copyImageSubData(const gl::Context *context,
+                                       GLuint sourceID,
+                                       const gl::ImageIndex &sourceIndex,
+                                       GLuint destID,
+                                       const gl::ImageIndex &destIndex,
+                                       const gl::Rectangle &sourceArea,
+                                       const gl::Offset &destOffset,
+                                       bool *copySucceededOut)
+{
+    if (mFunctions->copyImageSubData == nullptr)
+    {
+        *copySucceededOut = false;
+        return angle::Result::Continue;
+    }
+
+    GLenum sourceTarget = GL_NONE;
+    GLint sourceLayer   = 0;
+    GetCopyImageTargetAndLayer(sourceIndex, &sourceTarget, &sourceLayer);
+
+    GLenum destTarget = GL_NONE;
+    GLint destLayer   = 0;
+    GetCopyImageTargetAndLayer(destIndex, &destTarget, &destLayer);
+
+    ANGLE_GL_TRY(context, mFunctions->copyImageSubData(
+                              sourceID, sourceTarget, sourceIndex.getLevelIndex(), sourceArea.x,
+                              sourceArea.y, sourceLayer, destID, destTarget,
+                              destIndex.getLevelIndex(), destOffset.x, destOffset.y,
+                              destLayer + destOffset.z, sourceArea.width, sourceArea.height, 1));
+
+    *copySucceededOut = true;
+    return angle::Result::Continue;
+}
+
 angle::Result BlitGL::copySubTexture(const gl::Context *context,
                                      TextureGL *source,
                                      size_t sourceLevel,
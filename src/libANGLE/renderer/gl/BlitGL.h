@@ -92,6 +92,26 @@ class BlitGL : angle::NonCopyable
                                             GLenum filter,
                                             bool writeAlpha);
 
+    // Tries to blit between single sampled texture attachments of the same format without
+    // scaling, which needs no conversion and is done with copyImageSubData.
+    angle::Result blitColorBufferWithCopyImage(const gl::Context *context,
+                                               const gl::Framebuffer *source,
+                                               const gl::Framebuffer *dest,
+                                               const gl::Rectangle &sourceArea,
+                                               const gl::Rectangle &destArea,
+                                               bool *copySucceededOut);
+
+    // Raw copy between two images of the same format with glCopyImageSubData.  It bypasses the
+    // framebuffer and draw setup of the other paths, so it is the cheapest when available.
+    angle::Result copyImageSubData(const gl::Context *context,
+                                   GLuint sourceID,
+                                   const gl::ImageIndex &sourceIndex,
+                                   GLuint destID,
+                                   const gl::ImageIndex &destIndex,
+                                   const gl::Rectangle &sourceArea,
+                                   const gl::Offset &destOffset,
+                                   bool *copySucceededOut);
+
     angle::Result copySubTexture(const gl::Context *context,
                                  TextureGL *source,
                                  size_t sourceLevel,
@@ -284,6 +284,55 @@ angle::Result BufferGL::getIndexRange(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result BufferGL::getIndexRanges(const gl::Context *context,
+                                       gl::DrawElementsType type,
+                                       size_t offset,
+                                       size_t rangeIndexCount,
+                                       size_t rangeCount,
+                                       bool primitiveRestartEnabled,
+                                       gl::IndexRange *outRanges)
+{
+    ContextGL *contextGL              = GetImplAs<ContextGL>(context);
+    const FunctionsGL *functions      = GetFunctionsGL(context);
+    StateManagerGL *stateManager      = GetStateManagerGL(context);
+    const angle::FeaturesGL &features = GetFeaturesGL(context);
+
+    ASSERT(!mIsMapped);
+
+    const size_t rangeSize = rangeIndexCount * gl::GetDrawElementsTypeSize(type);
+
+    const uint8_t *bufferData = nullptr;
+    if (features.keepBufferShadowCopy.enabled)
+    {
+        bufferData = mShadowCopy.data() + offset;
+    }
+    else
+    {
+        stateManager->bindBuffer(DestBufferOperationTarget, mBufferID);
+        bufferData =
+            MapBufferRangeWithFallback(functions, gl::ToGLenum(DestBufferOperationTarget), offset,
+                                       rangeSize * rangeCount, GL_MAP_READ_BIT);
+    }
+
+    for (size_t rangeIndex = 0; rangeIndex < rangeCount; ++rangeIndex)
+    {
+        // Workaround the null driver not having map support.
+        outRanges[rangeIndex] =
+            bufferData ? gl::ComputeIndexRange(type, bufferData + rangeIndex * rangeSize,
+                                               rangeIndexCount, primitiveRestartEnabled)
+                       : gl::IndexRange(0, 0, 1);
+    }
+
+    if (bufferData && !features.keepBufferShadowCopy.enabled)
+    {
+        ANGLE_GL_TRY(context, functions->unmapBuffer(gl::ToGLenum(DestBufferOperationTarget)));
+    }
+
+    contextGL->markWorkSubmitted();
+
+    return angle::Result::Continue;
+}
+
 GLuint BufferGL::getBufferID() const
 {
     return mBufferID;
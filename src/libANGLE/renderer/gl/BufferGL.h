@@ -55,6 +55,13 @@ class BufferGL : public BufferImpl
                                 size_t count,
                                 bool primitiveRestartEnabled,
                                 gl::IndexRange *outRange) override;
+    angle::Result getIndexRanges(const gl::Context *context,
+                                 gl::DrawElementsType type,
+                                 size_t offset,
+                                 size_t rangeIndexCount,
+                                 size_t rangeCount,
+                                 bool primitiveRestartEnabled,
+                                 gl::IndexRange *outRanges) override;
 
     GLuint getBufferID() const;
 
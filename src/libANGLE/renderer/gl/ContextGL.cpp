@@ -27,6 +27,7 @@
 #include "libANGLE/renderer/gl/SemaphoreGL.h"
 #include "libANGLE/renderer/gl/ShaderGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
 #include "libANGLE/renderer/gl/SyncGL.h"
 #include "libANGLE/renderer/gl/TextureGL.h"
 #include "libANGLE/renderer/gl/TransformFeedbackGL.h"
@@ -34,6 +35,24 @@
 
 namespace rx
 {
+namespace
+{
+template <typename T>
+bool AnyNonZero(const T *values, GLsizei count)
+{
+    return std::any_of(values, values + count, [](T value) { return value != 0; });
+}
+
+bool AreIndexOffsetsAligned(gl::DrawElementsType type,
+                            const GLvoid *const *indices,
+                            GLsizei drawcount)
+{
+    const uintptr_t typeSize = gl::GetDrawElementsTypeSize(type);
+    return std::all_of(indices, indices + drawcount, [typeSize](const GLvoid *offset) {
+        return reinterpret_cast<uintptr_t>(offset) % typeSize == 0;
+    });
+}
+}  // anonymous namespace
 
 ContextGL::ContextGL(const gl::State &state,
                      gl::ErrorSet *errorSet,
@@ -42,10 +61,41 @@ ContextGL::ContextGL(const gl::State &state,
     : ContextImpl(state, errorSet),
       mRenderer(renderer),
       mRobustnessVideoMemoryPurgeStatus(robustnessVideoMemoryPurgeStatus)
-{}
+{
+    angle::PerfMonitorCounterGroup openGLGroup;
+    openGLGroup.name = "opengl";
+
+#define ANGLE_ADD_PERF_MONITOR_COUNTERS(CALL)    \
+    {                                            \
+        angle::PerfMonitorCounter counter;       \
+        counter.value = 0;                       \
+        counter.name  = #CALL "Issued";          \
+        openGLGroup.counters.push_back(counter); \
+        counter.name = #CALL "Skipped";          \
+        openGLGroup.counters.push_back(counter); \
+    }
+
+    ANGLE_GL_STATE_CALLS_X(ANGLE_ADD_PERF_MONITOR_COUNTERS)
+
+#undef ANGLE_ADD_PERF_MONITOR_COUNTERS
+
+    mPerfMonitorCounters.push_back(openGLGroup);
+}
 
 ContextGL::~ContextGL() {}
 
+void ContextGL::onDestroy(const gl::Context *context)
+{
+    getStateManager()->deleteBuffer(mMultiDrawIndirectBuffer);
+    mMultiDrawIndirectBuffer = 0;
+
+    if (mPixelUnpackStreamingBuffer)
+    {
+        mPixelUnpackStreamingBuffer->destroy(context);
+        mPixelUnpackStreamingBuffer.reset();
+    }
+}
+
 angle::Result ContextGL::initialize()
 {
     return angle::Result::Continue;
@@ -216,6 +266,13 @@ angle::Result ContextGL::finish(const gl::Context *context)
     return mRenderer->finish();
 }
 
+ANGLE_INLINE bool ContextGL::usesInstancedMultiview(const gl::Program *program) const
+{
+    return program->usesMultiview() &&
+           mRenderer->getMultiviewImplementationType() ==
+               MultiviewImplementationTypeGL::NV_VIEWPORT_ARRAY2;
+}
+
 ANGLE_INLINE angle::Result ContextGL::setDrawArraysState(const gl::Context *context,
                                                          GLint first,
                                                          GLsizei count,
@@ -312,7 +369,7 @@ angle::Result ContextGL::drawArrays(const gl::Context *context,
                                     GLsizei count)
 {
     const gl::Program *program  = context->getState().getProgram();
-    const bool usesMultiview    = program->usesMultiview();
+    const bool usesMultiview    = usesInstancedMultiview(program);
     const GLsizei instanceCount = usesMultiview ? program->getNumViews() : 0;
 
 #if defined(ANGLE_STATE_VALIDATION_ENABLED)
@@ -342,7 +399,7 @@ angle::Result ContextGL::drawArraysInstanced(const gl::Context *context,
 {
     GLsizei adjustedInstanceCount = instanceCount;
     const gl::Program *program    = context->getState().getProgram();
-    if (program->usesMultiview())
+    if (usesInstancedMultiview(program))
     {
         adjustedInstanceCount *= program->getNumViews();
     }
@@ -441,7 +498,7 @@ angle::Result ContextGL::drawArraysInstancedBaseInstance(const gl::Context *cont
 {
     GLsizei adjustedInstanceCount = instanceCount;
     const gl::Program *program    = context->getState().getProgram();
-    if (program->usesMultiview())
+    if (usesInstancedMultiview(program))
     {
         adjustedInstanceCount *= program->getNumViews();
     }
@@ -486,7 +543,7 @@ angle::Result ContextGL::drawElements(const gl::Context *context,
 {
     const gl::State &glState    = context->getState();
     const gl::Program *program  = glState.getProgram();
-    const bool usesMultiview    = program->usesMultiview();
+    const bool usesMultiview    = usesInstancedMultiview(program);
     const GLsizei instanceCount = usesMultiview ? program->getNumViews() : 0;
     const void *drawIndexPtr    = nullptr;
 
@@ -520,7 +577,7 @@ angle::Result ContextGL::drawElementsBaseVertex(const gl::Context *context,
 {
     const gl::State &glState    = context->getState();
     const gl::Program *program  = glState.getProgram();
-    const bool usesMultiview    = program->usesMultiview();
+    const bool usesMultiview    = usesInstancedMultiview(program);
     const GLsizei instanceCount = usesMultiview ? program->getNumViews() : 0;
     const void *drawIndexPtr    = nullptr;
 
@@ -554,7 +611,7 @@ angle::Result ContextGL::drawElementsInstanced(const gl::Context *context,
 {
     GLsizei adjustedInstanceCount = instances;
     const gl::Program *program    = context->getState().getProgram();
-    if (program->usesMultiview())
+    if (usesInstancedMultiview(program))
     {
         adjustedInstanceCount *= program->getNumViews();
     }
@@ -578,7 +635,7 @@ angle::Result ContextGL::drawElementsInstancedBaseVertex(const gl::Context *cont
 {
     GLsizei adjustedInstanceCount = instances;
     const gl::Program *program    = context->getState().getProgram();
-    if (program->usesMultiview())
+    if (usesInstancedMultiview(program))
     {
         adjustedInstanceCount *= program->getNumViews();
     }
@@ -605,7 +662,7 @@ angle::Result ContextGL::drawElementsInstancedBaseVertexBaseInstance(const gl::C
 {
     GLsizei adjustedInstanceCount = instances;
     const gl::Program *program    = context->getState().getProgram();
-    if (program->usesMultiview())
+    if (usesInstancedMultiview(program))
     {
         adjustedInstanceCount *= program->getNumViews();
     }
@@ -651,7 +708,7 @@ angle::Result ContextGL::drawRangeElements(const gl::Context *context,
                                            const void *indices)
 {
     const gl::Program *program   = context->getState().getProgram();
-    const bool usesMultiview     = program->usesMultiview();
+    const bool usesMultiview     = usesInstancedMultiview(program);
     const GLsizei instanceCount  = usesMultiview ? program->getNumViews() : 0;
     const void *drawIndexPointer = nullptr;
 
@@ -683,7 +740,7 @@ angle::Result ContextGL::drawRangeElementsBaseVertex(const gl::Context *context,
                                                      GLint baseVertex)
 {
     const gl::Program *program   = context->getState().getProgram();
-    const bool usesMultiview     = program->usesMultiview();
+    const bool usesMultiview     = usesInstancedMultiview(program);
     const GLsizei instanceCount  = usesMultiview ? program->getNumViews() : 0;
     const void *drawIndexPointer = nullptr;
 
@@ -726,12 +783,154 @@ angle::Result ContextGL::drawElementsIndirect(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+bool ContextGL::canUseNativeMultiDraw(const gl::Context *context, bool isIndexed) const
+{
+    const gl::State &glState         = context->getState();
+    const gl::StateCache &stateCache = context->getStateCache();
+
+    // Client data is streamed for each draw, and the transform feedback buffer usage is tracked
+    // for each draw.
+    if (stateCache.hasAnyActiveClientAttrib() || stateCache.isTransformFeedbackActiveUnpaused() ||
+        getFeaturesGL().shiftInstancedArrayDataWithOffset.enabled)
+    {
+        return false;
+    }
+
+    if (isIndexed && glState.getVertexArray()->getElementArrayBuffer() == nullptr)
+    {
+        return false;
+    }
+
+    // The emulated gl_DrawID, gl_BaseVertex and gl_BaseInstance uniforms are set for each draw.
+    const gl::Program *program = glState.getProgram();
+    return program == nullptr ||
+           (!usesInstancedMultiview(program) && !program->hasDrawIDUniform() &&
+            !program->hasBaseVertexUniform() && !program->hasBaseInstanceUniform());
+}
+
+bool ContextGL::canUseIndirectMultiDraw(const gl::Context *context,
+                                        bool isIndexed,
+                                        const GLuint *baseInstances,
+                                        GLsizei drawcount) const
+{
+    const FunctionsGL *functions = getFunctions();
+    const bool hasMultiDrawIndirect =
+        isIndexed ? functions->multiDrawElementsIndirect != nullptr
+                  : functions->multiDrawArraysIndirect != nullptr;
+
+    // Indirect draws are not allowed with the default vertex array in OpenGL ES.
+    if (!hasMultiDrawIndirect || getFeaturesGL().syncVertexArraysToDefault.enabled ||
+        !canUseNativeMultiDraw(context, isIndexed))
+    {
+        return false;
+    }
+
+    // The base instance of the indirect commands is ignored without GL_ARB_base_instance.
+    return baseInstances == nullptr || functions->drawArraysInstancedBaseInstance != nullptr ||
+           !AnyNonZero(baseInstances, drawcount);
+}
+
+angle::Result ContextGL::setMultiDrawIndirectCommands(const gl::Context *context,
+                                                      const void *commands,
+                                                      size_t size)
+{
+    const FunctionsGL *functions = getFunctions();
+
+    if (mMultiDrawIndirectBuffer == 0)
+    {
+        ANGLE_GL_TRY(context, functions->genBuffers(1, &mMultiDrawIndirectBuffer));
+    }
+
+    getStateManager()->bindBuffer(gl::BufferBinding::DrawIndirect, mMultiDrawIndirectBuffer);
+    ANGLE_GL_TRY(context,
+                 functions->bufferData(GL_DRAW_INDIRECT_BUFFER, size, commands, GL_STREAM_DRAW));
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextGL::multiDrawArraysInstancedIndirect(const gl::Context *context,
+                                                          gl::PrimitiveMode mode,
+                                                          const GLint *firsts,
+                                                          const GLsizei *counts,
+                                                          const GLsizei *instanceCounts,
+                                                          const GLuint *baseInstances,
+                                                          GLsizei drawcount)
+{
+    std::vector<gl::DrawArraysIndirectCommand> commands(drawcount);
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        gl::DrawArraysIndirectCommand &command = commands[drawID];
+        command.count                          = static_cast<GLuint>(counts[drawID]);
+        command.instanceCount                  = static_cast<GLuint>(instanceCounts[drawID]);
+        command.first                          = static_cast<GLuint>(firsts[drawID]);
+        command.baseInstance                   = baseInstances ? baseInstances[drawID] : 0;
+    }
+
+    ANGLE_TRY(setDrawArraysState(context, 0, 0, 0));
+    ANGLE_TRY(setMultiDrawIndirectCommands(context, commands.data(),
+                                           commands.size() * sizeof(commands[0])));
+    ANGLE_GL_TRY(context,
+                 getFunctions()->multiDrawArraysIndirect(ToGLenum(mode), nullptr, drawcount, 0));
+    getStateManager()->updateDrawIndirectBufferBinding(context);
+    mRenderer->markWorkSubmitted();
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextGL::multiDrawElementsInstancedIndirect(const gl::Context *context,
+                                                            gl::PrimitiveMode mode,
+                                                            const GLsizei *counts,
+                                                            gl::DrawElementsType type,
+                                                            const GLvoid *const *indices,
+                                                            const GLsizei *instanceCounts,
+                                                            const GLint *baseVertices,
+                                                            const GLuint *baseInstances,
+                                                            GLsizei drawcount)
+{
+    const uintptr_t typeSize = gl::GetDrawElementsTypeSize(type);
+
+    std::vector<gl::DrawElementsIndirectCommand> commands(drawcount);
+    for (GLsizei drawID = 0; drawID < drawcount; ++drawID)
+    {
+        const uintptr_t indexOffset = reinterpret_cast<uintptr_t>(indices[drawID]);
+
+        gl::DrawElementsIndirectCommand &command = commands[drawID];
+        command.count                            = static_cast<GLuint>(counts[drawID]);
+        command.primCount                        = static_cast<GLuint>(instanceCounts[drawID]);
+        command.firstIndex                       = static_cast<GLuint>(indexOffset / typeSize);
+        command.baseVertex                       = baseVertices ? baseVertices[drawID] : 0;
+        command.baseInstance                     = baseInstances ? baseInstances[drawID] : 0;
+    }
+
+    const void *drawIndexPointer = nullptr;
+    ANGLE_TRY(setDrawElementsState(context, 0, type, nullptr, 0, &drawIndexPointer));
+    ANGLE_TRY(setMultiDrawIndirectCommands(context, commands.data(),
+                                           commands.size() * sizeof(commands[0])));
+    ANGLE_GL_TRY(context, getFunctions()->multiDrawElementsIndirect(
+                              ToGLenum(mode), ToGLenum(type), nullptr, drawcount, 0));
+    getStateManager()->updateDrawIndirectBufferBinding(context);
+    mRenderer->markWorkSubmitted();
+
+    return angle::Result::Continue;
+}
+
 angle::Result ContextGL::multiDrawArrays(const gl::Context *context,
                                          gl::PrimitiveMode mode,
                                          const GLint *firsts,
                                          const GLsizei *counts,
                                          GLsizei drawcount)
 {
+    const FunctionsGL *functions = getFunctions();
+    if (functions->multiDrawArrays && canUseNativeMultiDraw(context, false))
+    {
+        ANGLE_TRY(setDrawArraysState(context, 0, 0, 0));
+        ANGLE_GL_TRY(context,
+                     functions->multiDrawArrays(ToGLenum(mode), firsts, counts, drawcount));
+        mRenderer->markWorkSubmitted();
+
+        return angle::Result::Continue;
+    }
+
     mRenderer->markWorkSubmitted();
 
     return rx::MultiDrawArraysGeneral(this, context, mode, firsts, counts, drawcount);
@@ -744,6 +943,12 @@ angle::Result ContextGL::multiDrawArraysInstanced(const gl::Context *context,
                                                   const GLsizei *instanceCounts,
                                                   GLsizei drawcount)
 {
+    if (canUseIndirectMultiDraw(context, false, nullptr, drawcount))
+    {
+        return multiDrawArraysInstancedIndirect(context, mode, firsts, counts, instanceCounts,
+                                                nullptr, drawcount);
+    }
+
     mRenderer->markWorkSubmitted();
 
     return rx::MultiDrawArraysInstancedGeneral(this, context, mode, firsts, counts, instanceCounts,
@@ -758,6 +963,14 @@ angle::Result ContextGL::multiDrawArraysIndirect(const gl::Context *context,
 {
     mRenderer->markWorkSubmitted();
 
+    const FunctionsGL *functions = getFunctions();
+    if (functions->multiDrawArraysIndirect)
+    {
+        ANGLE_GL_TRY(context, functions->multiDrawArraysIndirect(ToGLenum(mode), indirect,
+                                                                 drawcount, stride));
+        return angle::Result::Continue;
+    }
+
     return rx::MultiDrawArraysIndirectGeneral(this, context, mode, indirect, drawcount, stride);
 }
 
@@ -768,6 +981,18 @@ angle::Result ContextGL::multiDrawElements(const gl::Context *context,
                                            const GLvoid *const *indices,
                                            GLsizei drawcount)
 {
+    const FunctionsGL *functions = getFunctions();
+    if (functions->multiDrawElements && canUseNativeMultiDraw(context, true))
+    {
+        const void *drawIndexPointer = nullptr;
+        ANGLE_TRY(setDrawElementsState(context, 0, type, nullptr, 0, &drawIndexPointer));
+        ANGLE_GL_TRY(context, functions->multiDrawElements(ToGLenum(mode), counts, ToGLenum(type),
+                                                           indices, drawcount));
+        mRenderer->markWorkSubmitted();
+
+        return angle::Result::Continue;
+    }
+
     mRenderer->markWorkSubmitted();
 
     return rx::MultiDrawElementsGeneral(this, context, mode, counts, type, indices, drawcount);
@@ -781,6 +1006,13 @@ angle::Result ContextGL::multiDrawElementsInstanced(const gl::Context *context,
                                                     const GLsizei *instanceCounts,
                                                     GLsizei drawcount)
 {
+    if (canUseIndirectMultiDraw(context, true, nullptr, drawcount) &&
+        AreIndexOffsetsAligned(type, indices, drawcount))
+    {
+        return multiDrawElementsInstancedIndirect(context, mode, counts, type, indices,
+                                                  instanceCounts, nullptr, nullptr, drawcount);
+    }
+
     mRenderer->markWorkSubmitted();
 
     return rx::MultiDrawElementsInstancedGeneral(this, context, mode, counts, type, indices,
@@ -796,6 +1028,14 @@ angle::Result ContextGL::multiDrawElementsIndirect(const gl::Context *context,
 {
     mRenderer->markWorkSubmitted();
 
+    const FunctionsGL *functions = getFunctions();
+    if (functions->multiDrawElementsIndirect)
+    {
+        ANGLE_GL_TRY(context, functions->multiDrawElementsIndirect(ToGLenum(mode), ToGLenum(type),
+                                                                   indirect, drawcount, stride));
+        return angle::Result::Continue;
+    }
+
     return rx::MultiDrawElementsIndirectGeneral(this, context, mode, type, indirect, drawcount,
                                                 stride);
 }
@@ -808,6 +1048,12 @@ angle::Result ContextGL::multiDrawArraysInstancedBaseInstance(const gl::Context
                                                               const GLuint *baseInstances,
                                                               GLsizei drawcount)
 {
+    if (canUseIndirectMultiDraw(context, false, baseInstances, drawcount))
+    {
+        return multiDrawArraysInstancedIndirect(context, mode, firsts, counts, instanceCounts,
+                                                baseInstances, drawcount);
+    }
+
     mRenderer->markWorkSubmitted();
 
     return rx::MultiDrawArraysInstancedBaseInstanceGeneral(
@@ -825,6 +1071,35 @@ angle::Result ContextGL::multiDrawElementsInstancedBaseVertexBaseInstance(
     const GLuint *baseInstances,
     GLsizei drawcount)
 {
+    const FunctionsGL *functions = getFunctions();
+
+    // WebGL multi-draw commonly uses a single instance per draw, which doesn't need indirect
+    // commands.
+    const bool isSingleInstance =
+        std::all_of(instanceCounts, instanceCounts + drawcount,
+                    [](GLsizei instanceCount) { return instanceCount == 1; }) &&
+        !AnyNonZero(baseInstances, drawcount);
+    if (isSingleInstance && functions->multiDrawElementsBaseVertex &&
+        canUseNativeMultiDraw(context, true))
+    {
+        const void *drawIndexPointer = nullptr;
+        ANGLE_TRY(setDrawElementsState(context, 0, type, nullptr, 0, &drawIndexPointer));
+        ANGLE_GL_TRY(context,
+                     functions->multiDrawElementsBaseVertex(ToGLenum(mode), counts, ToGLenum(type),
+                                                            indices, drawcount, baseVertices));
+        mRenderer->markWorkSubmitted();
+
+        return angle::Result::Continue;
+    }
+
+    if (canUseIndirectMultiDraw(context, true, baseInstances, drawcount) &&
+        AreIndexOffsetsAligned(type, indices, drawcount))
+    {
+        return multiDrawElementsInstancedIndirect(context, mode, counts, type, indices,
+                                                  instanceCounts, baseVertices, baseInstances,
+                                                  drawcount);
+    }
+
     mRenderer->markWorkSubmitted();
 
     return rx::MultiDrawElementsInstancedBaseVertexBaseInstanceGeneral(
@@ -952,6 +1227,21 @@ ClearMultiviewGL *ContextGL::getMultiviewClearer() const
     return mRenderer->getMultiviewClearer();
 }
 
+MultiviewImplementationTypeGL ContextGL::getMultiviewImplementationType() const
+{
+    return mRenderer->getMultiviewImplementationType();
+}
+
+StreamingBufferGL *ContextGL::getPixelUnpackStreamingBuffer()
+{
+    if (!mPixelUnpackStreamingBuffer)
+    {
+        mPixelUnpackStreamingBuffer =
+            std::make_unique<StreamingBufferGL>(gl::BufferBinding::PixelUnpack);
+    }
+    return mPixelUnpackStreamingBuffer.get();
+}
+
 angle::Result ContextGL::dispatchCompute(const gl::Context *context,
                                          GLuint numGroupsX,
                                          GLuint numGroupsY,
@@ -984,6 +1274,24 @@ void ContextGL::invalidateTexture(gl::TextureType target)
     mRenderer->getStateManager()->invalidateTexture(target);
 }
 
+const angle::PerfMonitorCounterGroups &ContextGL::getPerfMonitorCounters()
+{
+    // The counters are cumulative, and shared by all contexts using the same state manager.
+    const StateCallCounters &stateCalls = getStateManager()->getStateCallCounters();
+    angle::PerfMonitorCounters &counters =
+        angle::GetPerfMonitorCounterGroup(mPerfMonitorCounters, "opengl").counters;
+
+#define ANGLE_UPDATE_PERF_MAP(CALL)                                                          \
+    angle::GetPerfMonitorCounter(counters, #CALL "Issued").value  = stateCalls.CALL.issued;  \
+    angle::GetPerfMonitorCounter(counters, #CALL "Skipped").value = stateCalls.CALL.skipped;
+
+    ANGLE_GL_STATE_CALLS_X(ANGLE_UPDATE_PERF_MAP)
+
+#undef ANGLE_UPDATE_PERF_MAP
+
+    return mPerfMonitorCounters;
+}
+
 void ContextGL::validateState() const
 {
     const StateManagerGL *stateManager = mRenderer->getStateManager();
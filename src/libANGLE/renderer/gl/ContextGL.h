@@ -30,6 +30,8 @@ class ClearMultiviewGL;
 class FunctionsGL;
 class RendererGL;
 class StateManagerGL;
+class StreamingBufferGL;
+enum class MultiviewImplementationTypeGL;
 
 enum class RobustnessVideoMemoryPurgeStatus
 {
@@ -46,6 +48,7 @@ class ContextGL : public ContextImpl
               RobustnessVideoMemoryPurgeStatus robustnessVideoMemoryPurgeStatus);
     ~ContextGL() override;
 
+    void onDestroy(const gl::Context *context) override;
     angle::Result initialize() override;
 
     // Shader creation
@@ -262,6 +265,9 @@ class ContextGL : public ContextImpl
     const angle::FeaturesGL &getFeaturesGL() const;
     BlitGL *getBlitter() const;
     ClearMultiviewGL *getMultiviewClearer() const;
+    MultiviewImplementationTypeGL getMultiviewImplementationType() const;
+    // Ring buffer that texture uploads of client data are streamed through.
+    StreamingBufferGL *getPixelUnpackStreamingBuffer();
 
     angle::Result dispatchCompute(const gl::Context *context,
                                   GLuint numGroupsX,
@@ -276,6 +282,8 @@ class ContextGL : public ContextImpl
 
     void invalidateTexture(gl::TextureType target) override;
 
+    const angle::PerfMonitorCounterGroups &getPerfMonitorCounters() override;
+
     void validateState() const;
 
     void setNeedsFlushBeforeDeleteTextures();
@@ -286,6 +294,9 @@ class ContextGL : public ContextImpl
     const gl::Debug &getDebug() const { return mState.getDebug(); }
 
   private:
+    // Whether the views of |program| are rendered by replicating the instances of the draw calls.
+    bool usesInstancedMultiview(const gl::Program *program) const;
+
     angle::Result setDrawArraysState(const gl::Context *context,
                                      GLint first,
                                      GLsizei count,
@@ -302,10 +313,45 @@ class ContextGL : public ContextImpl
                                                        GLuint baseInstance);
     void resetUpdatedAttributes(gl::AttributesMask attribMask);
 
+    // Whether a multi-draw can be issued with a single native call, which is not possible when
+    // each draw needs to be emulated separately.
+    bool canUseNativeMultiDraw(const gl::Context *context, bool isIndexed) const;
+    // Instanced multi-draws are issued as a native indirect multi-draw.
+    bool canUseIndirectMultiDraw(const gl::Context *context,
+                                 bool isIndexed,
+                                 const GLuint *baseInstances,
+                                 GLsizei drawcount) const;
+
+    angle::Result setMultiDrawIndirectCommands(const gl::Context *context,
+                                               const void *commands,
+                                               size_t size);
+    angle::Result multiDrawArraysInstancedIndirect(const gl::Context *context,
+                                                   gl::PrimitiveMode mode,
+                                                   const GLint *firsts,
+                                                   const GLsizei *counts,
+                                                   const GLsizei *instanceCounts,
+                                                   const GLuint *baseInstances,
+                                                   GLsizei drawcount);
+    angle::Result multiDrawElementsInstancedIndirect(const gl::Context *context,
+                                                     gl::PrimitiveMode mode,
+                                                     const GLsizei *counts,
+                                                     gl::DrawElementsType type,
+                                                     const GLvoid *const *indices,
+                                                     const GLsizei *instanceCounts,
+                                                     const GLint *baseVertices,
+                                                     const GLuint *baseInstances,
+                                                     GLsizei drawcount);
+
   protected:
     std::shared_ptr<RendererGL> mRenderer;
 
     RobustnessVideoMemoryPurgeStatus mRobustnessVideoMemoryPurgeStatus;
+
+    angle::PerfMonitorCounterGroups mPerfMonitorCounters;
+
+    GLuint mMultiDrawIndirectBuffer = 0;
+
+    std::unique_ptr<StreamingBufferGL> mPixelUnpackStreamingBuffer;
 };
 
 }  // namespace rx
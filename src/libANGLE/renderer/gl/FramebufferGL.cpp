@@ -77,7 +77,8 @@ static BlitFramebufferBounds GetBlitFramebufferBounds(const gl::Context *context
 void BindFramebufferAttachment(const FunctionsGL *functions,
                                GLenum attachmentPoint,
                                const FramebufferAttachment *attachment,
-                               const angle::FeaturesGL &features)
+                               const angle::FeaturesGL &features,
+                               MultiviewImplementationTypeGL multiviewImplementationType)
 {
     if (attachment)
     {
@@ -137,8 +138,18 @@ void BindFramebufferAttachment(const FunctionsGL *functions,
                      texture->getType() == TextureType::_2DMultisampleArray ||
                      texture->getType() == TextureType::CubeMapArray)
             {
-                if (attachment->isMultiview())
+                if (attachment->isMultiview() &&
+                    multiviewImplementationType == MultiviewImplementationTypeGL::OVR_MULTIVIEW2)
                 {
+                    ASSERT(functions->framebufferTextureMultiviewOVR);
+                    functions->framebufferTextureMultiviewOVR(
+                        GL_FRAMEBUFFER, attachmentPoint, textureGL->getTextureID(),
+                        attachment->mipLevel(), attachment->getBaseViewIndex(),
+                        attachment->getNumViews());
+                }
+                else if (attachment->isMultiview())
+                {
+                    // All layers are attached, and the shaders select the layer of each view.
                     ASSERT(functions->framebufferTexture);
                     functions->framebufferTexture(GL_FRAMEBUFFER, attachmentPoint,
                                                   textureGL->getTextureID(),
@@ -195,8 +206,16 @@ bool AreAllLayersActive(const FramebufferAttachment &attachment)
     return (attachment.getNumViews() == numLayers);
 }
 
-bool RequiresMultiviewClear(const FramebufferState &state, bool scissorTestEnabled)
+bool RequiresMultiviewClear(const FramebufferState &state,
+                            bool scissorTestEnabled,
+                            MultiviewImplementationTypeGL multiviewImplementationType)
 {
+    // Native multiview clears all the views of the framebuffer.
+    if (multiviewImplementationType == MultiviewImplementationTypeGL::OVR_MULTIVIEW2)
+    {
+        return false;
+    }
+
     // Get one attachment and check whether all layers are attached.
     const FramebufferAttachment *attachment = nullptr;
     bool allTextureArraysAreFullyAttached   = true;
@@ -517,7 +536,8 @@ angle::Result FramebufferGL::clear(const gl::Context *context, GLbitfield mask)
     syncClearState(context, mask);
     stateManager->bindFramebuffer(GL_FRAMEBUFFER, mFramebufferID);
 
-    if (!RequiresMultiviewClear(mState, context->getState().isScissorTestEnabled()))
+    if (!RequiresMultiviewClear(mState, context->getState().isScissorTestEnabled(),
+                                GetMultiviewImplementationType(context)))
     {
         functions->clear(mask);
     }
@@ -545,7 +565,8 @@ angle::Result FramebufferGL::clearBufferfv(const gl::Context *context,
     syncClearBufferState(context, buffer, drawbuffer);
     stateManager->bindFramebuffer(GL_FRAMEBUFFER, mFramebufferID);
 
-    if (!RequiresMultiviewClear(mState, context->getState().isScissorTestEnabled()))
+    if (!RequiresMultiviewClear(mState, context->getState().isScissorTestEnabled(),
+                                GetMultiviewImplementationType(context)))
     {
         functions->clearBufferfv(buffer, drawbuffer, values);
     }
@@ -574,7 +595,8 @@ angle::Result FramebufferGL::clearBufferuiv(const gl::Context *context,
     syncClearBufferState(context, buffer, drawbuffer);
     stateManager->bindFramebuffer(GL_FRAMEBUFFER, mFramebufferID);
 
-    if (!RequiresMultiviewClear(mState, context->getState().isScissorTestEnabled()))
+    if (!RequiresMultiviewClear(mState, context->getState().isScissorTestEnabled(),
+                                GetMultiviewImplementationType(context)))
     {
         functions->clearBufferuiv(buffer, drawbuffer, values);
     }
@@ -603,7 +625,8 @@ angle::Result FramebufferGL::clearBufferiv(const gl::Context *context,
     syncClearBufferState(context, buffer, drawbuffer);
     stateManager->bindFramebuffer(GL_FRAMEBUFFER, mFramebufferID);
 
-    if (!RequiresMultiviewClear(mState, context->getState().isScissorTestEnabled()))
+    if (!RequiresMultiviewClear(mState, context->getState().isScissorTestEnabled(),
+                                GetMultiviewImplementationType(context)))
     {
         functions->clearBufferiv(buffer, drawbuffer, values);
     }
@@ -633,7 +656,8 @@ angle::Result FramebufferGL::clearBufferfi(const gl::Context *context,
     syncClearBufferState(context, buffer, drawbuffer);
     stateManager->bindFramebuffer(GL_FRAMEBUFFER, mFramebufferID);
 
-    if (!RequiresMultiviewClear(mState, context->getState().isScissorTestEnabled()))
+    if (!RequiresMultiviewClear(mState, context->getState().isScissorTestEnabled(),
+                                GetMultiviewImplementationType(context)))
     {
         functions->clearBufferfi(buffer, drawbuffer, depth, stencil);
     }
@@ -829,9 +853,23 @@ angle::Result FramebufferGL::blit(const gl::Context *context,
     if (needManualColorBlit && (mask & GL_COLOR_BUFFER_BIT) && readAttachmentSamples <= 1)
     {
         BlitGL *blitter = GetBlitGL(context);
-        ANGLE_TRY(blitter->blitColorBufferWithShader(context, sourceFramebuffer, destFramebuffer,
-                                                     sourceArea, destArea, filter,
-                                                     !mHasEmulatedAlphaAttachment));
+
+        // An unscaled blit between identical formats doesn't convert anything, so it can be a
+        // copy instead of a draw.  Copies ignore the scissor and write the alpha channel.
+        bool copySucceeded = false;
+        if (!context->getState().isScissorTestEnabled() && !mHasEmulatedAlphaAttachment)
+        {
+            ANGLE_TRY(blitter->blitColorBufferWithCopyImage(context, sourceFramebuffer,
+                                                            destFramebuffer, sourceArea, destArea,
+                                                            &copySucceeded));
+        }
+
+        if (!copySucceeded)
+        {
+            ANGLE_TRY(blitter->blitColorBufferWithShader(context, sourceFramebuffer,
+                                                         destFramebuffer, sourceArea, destArea,
+                                                         filter, !mHasEmulatedAlphaAttachment));
+        }
         blitMask &= ~GL_COLOR_BUFFER_BIT;
     }
 
@@ -1274,7 +1312,8 @@ angle::Result FramebufferGL::syncState(const gl::Context *context,
             {
                 const FramebufferAttachment *newAttachment = mState.getDepthAttachment();
                 BindFramebufferAttachment(functions, GL_DEPTH_ATTACHMENT, newAttachment,
-                                          GetFeaturesGL(context));
+                                          GetFeaturesGL(context),
+                                          GetMultiviewImplementationType(context));
                 if (newAttachment)
                 {
                     attachment = newAttachment;
@@ -1285,7 +1324,8 @@ angle::Result FramebufferGL::syncState(const gl::Context *context,
             {
                 const FramebufferAttachment *newAttachment = mState.getStencilAttachment();
                 BindFramebufferAttachment(functions, GL_STENCIL_ATTACHMENT, newAttachment,
-                                          GetFeaturesGL(context));
+                                          GetFeaturesGL(context),
+                                          GetMultiviewImplementationType(context));
                 if (newAttachment)
                 {
                     attachment = newAttachment;
@@ -1338,7 +1378,8 @@ angle::Result FramebufferGL::syncState(const gl::Context *context,
                     const FramebufferAttachment *newAttachment = mState.getColorAttachment(index);
                     BindFramebufferAttachment(functions,
                                               static_cast<GLenum>(GL_COLOR_ATTACHMENT0 + index),
-                                              newAttachment, GetFeaturesGL(context));
+                                              newAttachment, GetFeaturesGL(context),
+                                              GetMultiviewImplementationType(context));
                     if (newAttachment)
                     {
                         attachment = newAttachment;
@@ -8,6 +8,8 @@
 
 #include "libANGLE/renderer/gl/ProgramGL.h"
 
+#include <sstream>
+
 #include "common/angleutils.h"
 #include "common/bitset_utils.h"
 #include "common/debug.h"
@@ -115,6 +117,103 @@ void ProgramGL::reapplyUBOBindingsIfNeeded(const gl::Context *context)
     }
 }
 
+void ProgramGL::computeNativeBinaryKey(const gl::Context *context,
+                                       egl::BlobCache::Key *keyOut) const
+{
+    constexpr char kSeparator = ':';
+    std::ostringstream keyStream;
+
+    for (const gl::ShaderType shaderType : gl::AllShaderTypes())
+    {
+        const gl::Shader *shader = mState.getAttachedShader(shaderType);
+        if (shader)
+        {
+            const std::string &translatedSource = shader->getState().getTranslatedSource();
+            keyStream << shaderType << kSeparator << translatedSource.length() << kSeparator
+                      << translatedSource << kSeparator;
+        }
+    }
+
+    for (const sh::ShaderVariable &attribute : mState.getProgramInputs())
+    {
+        if (attribute.active && !attribute.isBuiltIn())
+        {
+            keyStream << attribute.location << kSeparator << attribute.mappedName << kSeparator;
+        }
+    }
+
+    for (const std::string &tfVaryingName : mState.getTransformFeedbackVaryingNames())
+    {
+        keyStream << tfVaryingName << kSeparator;
+    }
+    keyStream << mState.getTransformFeedbackBufferMode() << kSeparator;
+
+    for (const std::vector<gl::VariableLocation> *outputLocations :
+         {&mState.getOutputLocations(), &mState.getSecondaryOutputLocations()})
+    {
+        for (const gl::VariableLocation &outputLocation : *outputLocations)
+        {
+            keyStream << outputLocation.index << kSeparator << outputLocation.arrayIndex
+                      << kSeparator << outputLocation.ignored << kSeparator;
+        }
+        keyStream << kSeparator;
+    }
+
+    keyStream << context->getExtensions().blendFuncExtendedEXT << kSeparator
+              << mState.isSeparable();
+
+    const std::string &key = keyStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(key.c_str()),
+                               key.length(), keyOut->data());
+}
+
+bool ProgramGL::loadCachedNativeBinary(const egl::BlobCache::Key &key)
+{
+    GLenum binaryFormat = GL_NONE;
+    std::vector<uint8_t> binary;
+    if (!mRenderer->getCachedProgramBinary(key, &binaryFormat, &binary))
+    {
+        return false;
+    }
+
+    mFunctions->programBinary(mProgramID, binaryFormat, binary.data(),
+                              static_cast<GLsizei>(binary.size()));
+
+    GLint linkStatus = GL_FALSE;
+    mFunctions->getProgramiv(mProgramID, GL_LINK_STATUS, &linkStatus);
+    if (linkStatus == GL_FALSE)
+    {
+        // The driver rejects binaries it no longer understands, e.g. after a driver update or a
+        // GPU switch.  Drop the entry and link the program from its shaders instead.
+        mRenderer->eraseCachedProgramBinary(key);
+        return false;
+    }
+
+    return true;
+}
+
+void ProgramGL::saveNativeBinaryToCache(const egl::BlobCache::Key &key)
+{
+    GLint binaryLength = 0;
+    mFunctions->getProgramiv(mProgramID, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    if (binaryLength <= 0)
+    {
+        return;
+    }
+
+    std::vector<uint8_t> binary(binaryLength);
+    GLenum binaryFormat = GL_NONE;
+    mFunctions->getProgramBinary(mProgramID, binaryLength, &binaryLength, &binaryFormat,
+                                 binary.data());
+    if (binaryLength <= 0)
+    {
+        return;
+    }
+
+    binary.resize(binaryLength);
+    mRenderer->putCachedProgramBinary(key, binaryFormat, std::move(binary));
+}
+
 void ProgramGL::setBinaryRetrievableHint(bool retrievable)
 {
     // glProgramParameteri isn't always available on ES backends.
@@ -228,6 +327,29 @@ std::unique_ptr<LinkEvent> ProgramGL::link(const gl::Context *context,
 
     preLink();
 
+    egl::BlobCache::Key nativeBinaryKey = {};
+    const bool cacheNativeBinary        = mFeatures.cacheNativeProgramBinaries.enabled;
+    if (cacheNativeBinary)
+    {
+        computeNativeBinaryKey(context, &nativeBinaryKey);
+        if (loadCachedNativeBinary(nativeBinaryKey))
+        {
+            if (mFeatures.alwaysCallUseProgramAfterLink.enabled)
+            {
+                mStateManager->forceUseProgram(mProgramID);
+            }
+
+            linkResources(resources);
+            postLink();
+            reapplyUBOBindingsIfNeeded(context);
+
+            return std::make_unique<LinkEventDone>(angle::Result::Continue);
+        }
+
+        // Some drivers only keep the binary of programs linked with the hint set.
+        setBinaryRetrievableHint(true);
+    }
+
     if (mState.getAttachedShader(gl::ShaderType::Compute))
     {
         const ShaderGL *computeShaderGL =
@@ -429,8 +551,8 @@ std::unique_ptr<LinkEvent> ProgramGL::link(const gl::Context *context,
         return false;
     });
 
-    auto postLinkImplTask = [this, &infoLog, &resources](bool fallbackToMainContext,
-                                                         const std::string &workerInfoLog) {
+    auto postLinkImplTask = [this, &infoLog, &resources, cacheNativeBinary, nativeBinaryKey](
+                                bool fallbackToMainContext, const std::string &workerInfoLog) {
         infoLog << workerInfoLog;
         if (fallbackToMainContext)
         {
@@ -462,6 +584,11 @@ std::unique_ptr<LinkEvent> ProgramGL::link(const gl::Context *context,
             return angle::Result::Incomplete;
         }
 
+        if (cacheNativeBinary)
+        {
+            saveNativeBinaryToCache(nativeBinaryKey);
+        }
+
         if (mFeatures.alwaysCallUseProgramAfterLink.enabled)
         {
             mStateManager->forceUseProgram(mProgramID);
@@ -483,6 +610,7 @@ std::unique_ptr<LinkEvent> ProgramGL::link(const gl::Context *context,
              (!mFeatures.dontRelinkProgramsInParallel.enabled || !mLinkedInParallel))
     {
         mLinkedInParallel = true;
+        mRenderer->prepareWorkerContext();
         return std::make_unique<LinkEventGL>(workerPool, linkTask, postLinkImplTask);
     }
     else
@@ -1033,7 +1161,9 @@ void ProgramGL::postLink()
         mUniformRealLocationMap[uniformLocation] = realLocation;
     }
 
-    if (mState.usesMultiview())
+    if (mState.usesMultiview() &&
+        mRenderer->getMultiviewImplementationType() ==
+            MultiviewImplementationTypeGL::NV_VIEWPORT_ARRAY2)
     {
         mMultiviewBaseViewLayerIndexUniformLocation =
             mFunctions->getUniformLocation(mProgramID, "multiviewBaseViewLayerIndex");
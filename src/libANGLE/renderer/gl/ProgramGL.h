@@ -12,6 +12,7 @@
 #include <string>
 #include <vector>
 
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/renderer/ProgramImpl.h"
 
 namespace angle
@@ -125,6 +126,12 @@ class ProgramGL : public ProgramImpl
 
     void reapplyUBOBindingsIfNeeded(const gl::Context *context);
 
+    // The native program binary cache is keyed on everything that is given to the driver before
+    // glLinkProgram.
+    void computeNativeBinaryKey(const gl::Context *context, egl::BlobCache::Key *keyOut) const;
+    bool loadCachedNativeBinary(const egl::BlobCache::Key &key);
+    void saveNativeBinaryToCache(const egl::BlobCache::Key &key);
+
     bool getUniformBlockSize(const std::string &blockName,
                              const std::string &blockMappedName,
                              size_t *sizeOut) const;
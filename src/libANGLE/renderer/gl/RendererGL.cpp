@@ -42,6 +42,8 @@
 namespace
 {
 
+constexpr size_t kProgramBinaryCacheSize = 16 * 1024 * 1024;
+
 void SetMaxShaderCompilerThreads(const rx::FunctionsGL *functions, GLuint count)
 {
     if (functions->maxShaderCompilerThreadsKHR != nullptr)
@@ -148,6 +150,7 @@ RendererGL::RendererGL(std::unique_ptr<FunctionsGL> functions,
       mCapsInitialized(false),
       mMultiviewImplementationType(MultiviewImplementationTypeGL::UNSPECIFIED),
       mNativeParallelCompileEnabled(false),
+      mProgramBinaryCache(kProgramBinaryCacheSize),
       mNeedsFlushBeforeDeleteTextures(false)
 {
     ASSERT(mFunctions);
@@ -156,8 +159,8 @@ RendererGL::RendererGL(std::unique_ptr<FunctionsGL> functions,
         nativegl_gl::InitializeFeatures(mFunctions.get(), &mFeatures);
     }
     ApplyFeatureOverrides(&mFeatures, display->getState());
-    mStateManager =
-        new StateManagerGL(mFunctions.get(), getNativeCaps(), getNativeExtensions(), mFeatures);
+    mStateManager     = new StateManagerGL(mFunctions.get(), getNativeCaps(), getNativeExtensions(),
+                                           mFeatures, getMultiviewImplementationType());
     mBlitter          = new BlitGL(mFunctions.get(), mFeatures, mStateManager);
     mMultiviewClearer = new ClearMultiviewGL(mFunctions.get(), mStateManager);
 
@@ -366,6 +369,31 @@ angle::Result RendererGL::memoryBarrierByRegion(GLbitfield barriers)
     return angle::Result::Continue;
 }
 
+void RendererGL::prepareWorkerContext()
+{
+    if (mFeatures.disableWorkerContexts.enabled)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mWorkerMutex);
+    ++mPendingWorkerTasks;
+    if (mWorkerContextPool.size() >= mPendingWorkerTasks ||
+        mWorkerContextCount >= getMaxWorkerContexts())
+    {
+        return;
+    }
+
+    // On failure, the worker tries again when binding and falls back to the main context.
+    std::string infoLog;
+    WorkerContext *newContext = createWorkerContext(&infoLog);
+    if (newContext != nullptr)
+    {
+        mWorkerContextPool.emplace_back(newContext);
+        ++mWorkerContextCount;
+    }
+}
+
 bool RendererGL::bindWorkerContext(std::string *infoLog)
 {
     if (mFeatures.disableWorkerContexts.enabled)
@@ -375,6 +403,11 @@ bool RendererGL::bindWorkerContext(std::string *infoLog)
 
     std::thread::id threadID = std::this_thread::get_id();
     std::lock_guard<std::mutex> lock(mWorkerMutex);
+    if (mPendingWorkerTasks > 0)
+    {
+        --mPendingWorkerTasks;
+    }
+
     std::unique_ptr<WorkerContext> workerContext;
     if (!mWorkerContextPool.empty())
     {
@@ -384,12 +417,19 @@ bool RendererGL::bindWorkerContext(std::string *infoLog)
     }
     else
     {
+        if (mWorkerContextCount >= getMaxWorkerContexts())
+        {
+            *infoLog += "Too many worker contexts.";
+            return false;
+        }
+
         WorkerContext *newContext = createWorkerContext(infoLog);
         if (newContext == nullptr)
         {
             return false;
         }
         workerContext.reset(newContext);
+        ++mWorkerContextCount;
     }
 
     if (!workerContext->makeCurrent())
@@ -419,6 +459,39 @@ unsigned int RendererGL::getMaxWorkerContexts()
     return std::min(16u, std::thread::hardware_concurrency());
 }
 
+bool RendererGL::getCachedProgramBinary(const egl::BlobCache::Key &key,
+                                        GLenum *binaryFormatOut,
+                                        std::vector<uint8_t> *binaryOut)
+{
+    std::lock_guard<std::mutex> lock(mProgramBinaryCacheMutex);
+
+    const NativeProgramBinary *entry = nullptr;
+    if (!mProgramBinaryCache.get(key, &entry))
+    {
+        return false;
+    }
+
+    *binaryFormatOut = entry->format;
+    *binaryOut       = entry->binary;
+    return true;
+}
+
+void RendererGL::putCachedProgramBinary(const egl::BlobCache::Key &key,
+                                        GLenum binaryFormat,
+                                        std::vector<uint8_t> &&binary)
+{
+    std::lock_guard<std::mutex> lock(mProgramBinaryCacheMutex);
+
+    const size_t size = binary.size();
+    mProgramBinaryCache.put(key, {binaryFormat, std::move(binary)}, size);
+}
+
+void RendererGL::eraseCachedProgramBinary(const egl::BlobCache::Key &key)
+{
+    std::lock_guard<std::mutex> lock(mProgramBinaryCacheMutex);
+    mProgramBinaryCache.eraseByKey(key);
+}
+
 bool RendererGL::hasNativeParallelCompile()
 {
     if (mFeatures.disableNativeParallelCompile.enabled)
@@ -12,9 +12,12 @@
 #include <list>
 #include <mutex>
 #include <thread>
+#include <vector>
 
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/Caps.h"
 #include "libANGLE/Error.h"
+#include "libANGLE/SizedMRUCache.h"
 #include "libANGLE/Version.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
 #include "platform/FeaturesGL_autogen.h"
@@ -123,6 +126,9 @@ class RendererGL : angle::NonCopyable
     angle::Result memoryBarrier(GLbitfield barriers);
     angle::Result memoryBarrierByRegion(GLbitfield barriers);
 
+    // Creates a worker context ahead of a task that will bind one, so that the native context is
+    // created on the context thread instead of on the worker thread with mWorkerMutex held.
+    void prepareWorkerContext();
     bool bindWorkerContext(std::string *infoLog);
     void unbindWorkerContext();
     // Checks if the driver has the KHR_parallel_shader_compile or ARB_parallel_shader_compile
@@ -132,6 +138,16 @@ class RendererGL : angle::NonCopyable
 
     static unsigned int getMaxWorkerContexts();
 
+    // Native program binaries saved by ProgramGL, keyed on the translated shaders and the pre-link
+    // program state.  Used when the cacheNativeProgramBinaries feature is enabled.
+    bool getCachedProgramBinary(const egl::BlobCache::Key &key,
+                                GLenum *binaryFormatOut,
+                                std::vector<uint8_t> *binaryOut);
+    void putCachedProgramBinary(const egl::BlobCache::Key &key,
+                                GLenum binaryFormat,
+                                std::vector<uint8_t> &&binary);
+    void eraseCachedProgramBinary(const egl::BlobCache::Key &key);
+
     void setNeedsFlushBeforeDeleteTextures();
     void flushIfNecessaryBeforeDeleteTextures();
 
@@ -172,11 +188,24 @@ class RendererGL : angle::NonCopyable
     angle::HashMap<std::thread::id, std::unique_ptr<WorkerContext>> mCurrentWorkerContexts;
     // The worker contexts available to use.
     std::list<std::unique_ptr<WorkerContext>> mWorkerContextPool;
+    // The number of worker contexts created, capped to getMaxWorkerContexts().
+    size_t mWorkerContextCount = 0;
+    // The number of tasks posted after prepareWorkerContext() that haven't bound a context yet.
+    size_t mPendingWorkerTasks = 0;
     // Protect the concurrent accesses to worker contexts.
     std::mutex mWorkerMutex;
 
     bool mNativeParallelCompileEnabled;
 
+    struct NativeProgramBinary
+    {
+        GLenum format;
+        std::vector<uint8_t> binary;
+    };
+    angle::SizedMRUCache<egl::BlobCache::Key, NativeProgramBinary> mProgramBinaryCache;
+    // Contexts on different threads share the renderer.
+    std::mutex mProgramBinaryCacheMutex;
+
     angle::FeaturesGL mFeatures;
 
     // Workaround for anglebug.com/4267
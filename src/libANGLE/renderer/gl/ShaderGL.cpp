@@ -414,6 +414,7 @@ std::shared_ptr<WaitableCompileEvent> ShaderGL::compile(const gl::Context *conte
             std::make_shared<TranslateTaskGL>(compilerInstance->getHandle(), options, source,
                                               std::move(compileAndCheckShaderInWorkerFunctor));
 
+        mRenderer->prepareWorkerContext();
         auto compileAndCheckShaderFunctor = [this](const char *source) {
             compileAndCheckShader(source);
         };
@@ -30,6 +30,7 @@
 #include "libANGLE/renderer/gl/TextureGL.h"
 #include "libANGLE/renderer/gl/TransformFeedbackGL.h"
 #include "libANGLE/renderer/gl/VertexArrayGL.h"
+#include "libANGLE/renderer/gl/renderergl_utils.h"
 
 namespace rx
 {
@@ -72,7 +73,8 @@ StateManagerGL::IndexedBufferBinding::IndexedBufferBinding() : offset(0), size(0
 StateManagerGL::StateManagerGL(const FunctionsGL *functions,
                                const gl::Caps &rendererCaps,
                                const gl::Extensions &extensions,
-                               const angle::FeaturesGL &features)
+                               const angle::FeaturesGL &features,
+                               MultiviewImplementationTypeGL multiviewImplementationType)
     : mFunctions(functions),
       mFeatures(features),
       mProgram(0),
@@ -155,7 +157,8 @@ StateManagerGL::StateManagerGL(const FunctionsGL *functions,
       mMultisamplingEnabled(true),
       mSampleAlphaToOneEnabled(false),
       mCoverageModulation(GL_NONE),
-      mIsMultiviewEnabled(extensions.multiviewOVR || extensions.multiview2OVR),
+      mIsInstancedMultiviewEnabled(multiviewImplementationType ==
+                                   MultiviewImplementationTypeGL::NV_VIEWPORT_ARRAY2),
       mProvokingVertex(GL_LAST_VERTEX_CONVENTION),
       mMaxClipDistances(rendererCaps.maxClipDistances),
       mLocalDirtyBits()
@@ -393,7 +396,7 @@ void StateManagerGL::deleteTransformFeedback(GLuint transformFeedback)
 
 void StateManagerGL::useProgram(GLuint program)
 {
-    if (mProgram != program)
+    if (countStateCall(&StateCallCounters::useProgram, mProgram != program))
     {
         forceUseProgram(program);
     }
@@ -409,7 +412,7 @@ void StateManagerGL::forceUseProgram(GLuint program)
 void StateManagerGL::bindVertexArray(GLuint vao, VertexArrayStateGL *vaoState)
 {
     ASSERT(vaoState);
-    if (mVAO != vao)
+    if (countStateCall(&StateCallCounters::bindVertexArray, mVAO != vao))
     {
         ASSERT(!mFeatures.syncVertexArraysToDefault.enabled);
 
@@ -429,7 +432,7 @@ void StateManagerGL::bindBuffer(gl::BufferBinding target, GLuint buffer)
     // glBindTransformFeedback is called. To avoid these behavior differences we shouldn't try to
     // use it.
     ASSERT(target != gl::BufferBinding::TransformFeedback);
-    if (mBuffers[target] != buffer)
+    if (countStateCall(&StateCallCounters::bindBuffer, mBuffers[target] != buffer))
     {
         mBuffers[target] = buffer;
         mFunctions->bindBuffer(gl::ToGLenum(target), buffer);
@@ -443,8 +446,9 @@ void StateManagerGL::bindBufferBase(gl::BufferBinding target, size_t index, GLui
 
     ASSERT(index < mIndexedBuffers[target].size());
     auto &binding = mIndexedBuffers[target][index];
-    if (binding.buffer != buffer || binding.offset != static_cast<size_t>(-1) ||
-        binding.size != static_cast<size_t>(-1))
+    const bool changed = binding.buffer != buffer || binding.offset != static_cast<size_t>(-1) ||
+                         binding.size != static_cast<size_t>(-1);
+    if (countStateCall(&StateCallCounters::bindBufferBase, changed))
     {
         binding.buffer   = buffer;
         binding.offset   = static_cast<size_t>(-1);
@@ -464,7 +468,9 @@ void StateManagerGL::bindBufferRange(gl::BufferBinding target,
     ASSERT(target != gl::BufferBinding::TransformFeedback);
 
     auto &binding = mIndexedBuffers[target][index];
-    if (binding.buffer != buffer || binding.offset != offset || binding.size != size)
+    const bool changed =
+        binding.buffer != buffer || binding.offset != offset || binding.size != size;
+    if (countStateCall(&StateCallCounters::bindBufferRange, changed))
     {
         binding.buffer   = buffer;
         binding.offset   = offset;
@@ -477,7 +483,7 @@ void StateManagerGL::bindBufferRange(gl::BufferBinding target,
 
 void StateManagerGL::activeTexture(size_t unit)
 {
-    if (mTextureUnitIndex != unit)
+    if (countStateCall(&StateCallCounters::activeTexture, mTextureUnitIndex != unit))
     {
         mTextureUnitIndex = unit;
         mFunctions->activeTexture(GL_TEXTURE0 + static_cast<GLenum>(mTextureUnitIndex));
@@ -487,7 +493,8 @@ void StateManagerGL::activeTexture(size_t unit)
 void StateManagerGL::bindTexture(gl::TextureType type, GLuint texture)
 {
     gl::TextureType nativeType = nativegl::GetNativeTextureType(type);
-    if (mTextures[nativeType][mTextureUnitIndex] != texture)
+    if (countStateCall(&StateCallCounters::bindTexture,
+                       mTextures[nativeType][mTextureUnitIndex] != texture))
     {
         mTextures[nativeType][mTextureUnitIndex] = texture;
         mFunctions->bindTexture(nativegl::GetTextureBindingTarget(type), texture);
@@ -506,7 +513,7 @@ void StateManagerGL::invalidateTexture(gl::TextureType type)
 
 void StateManagerGL::bindSampler(size_t unit, GLuint sampler)
 {
-    if (mSamplers[unit] != sampler)
+    if (countStateCall(&StateCallCounters::bindSampler, mSamplers[unit] != sampler))
     {
         mSamplers[unit] = sampler;
         mFunctions->bindSampler(static_cast<GLuint>(unit), sampler);
@@ -523,8 +530,10 @@ void StateManagerGL::bindImageTexture(size_t unit,
                                       GLenum format)
 {
     auto &binding = mImages[unit];
-    if (binding.texture != texture || binding.level != level || binding.layered != layered ||
-        binding.layer != layer || binding.access != access || binding.format != format)
+    const bool changed = binding.texture != texture || binding.level != level ||
+                         binding.layered != layered || binding.layer != layer ||
+                         binding.access != access || binding.format != format;
+    if (countStateCall(&StateCallCounters::bindImageTexture, changed))
     {
         binding.texture = texture;
         binding.level   = level;
@@ -540,7 +549,7 @@ void StateManagerGL::bindImageTexture(size_t unit,
 angle::Result StateManagerGL::setPixelUnpackState(const gl::Context *context,
                                                   const gl::PixelUnpackState &unpack)
 {
-    if (mUnpackAlignment != unpack.alignment)
+    if (countStateCall(&StateCallCounters::pixelStorei, mUnpackAlignment != unpack.alignment))
     {
         mUnpackAlignment = unpack.alignment;
         ANGLE_GL_TRY(context, mFunctions->pixelStorei(GL_UNPACK_ALIGNMENT, mUnpackAlignment));
@@ -548,7 +557,7 @@ angle::Result StateManagerGL::setPixelUnpackState(const gl::Context *context,
         mLocalDirtyBits.set(gl::State::DIRTY_BIT_UNPACK_STATE);
     }
 
-    if (mUnpackRowLength != unpack.rowLength)
+    if (countStateCall(&StateCallCounters::pixelStorei, mUnpackRowLength != unpack.rowLength))
     {
         mUnpackRowLength = unpack.rowLength;
         ANGLE_GL_TRY(context, mFunctions->pixelStorei(GL_UNPACK_ROW_LENGTH, mUnpackRowLength));
@@ -556,7 +565,7 @@ angle::Result StateManagerGL::setPixelUnpackState(const gl::Context *context,
         mLocalDirtyBits.set(gl::State::DIRTY_BIT_UNPACK_STATE);
     }
 
-    if (mUnpackSkipRows != unpack.skipRows)
+    if (countStateCall(&StateCallCounters::pixelStorei, mUnpackSkipRows != unpack.skipRows))
     {
         mUnpackSkipRows = unpack.skipRows;
         ANGLE_GL_TRY(context, mFunctions->pixelStorei(GL_UNPACK_SKIP_ROWS, mUnpackSkipRows));
@@ -564,7 +573,7 @@ angle::Result StateManagerGL::setPixelUnpackState(const gl::Context *context,
         mLocalDirtyBits.set(gl::State::DIRTY_BIT_UNPACK_STATE);
     }
 
-    if (mUnpackSkipPixels != unpack.skipPixels)
+    if (countStateCall(&StateCallCounters::pixelStorei, mUnpackSkipPixels != unpack.skipPixels))
     {
         mUnpackSkipPixels = unpack.skipPixels;
         ANGLE_GL_TRY(context, mFunctions->pixelStorei(GL_UNPACK_SKIP_PIXELS, mUnpackSkipPixels));
@@ -572,7 +581,7 @@ angle::Result StateManagerGL::setPixelUnpackState(const gl::Context *context,
         mLocalDirtyBits.set(gl::State::DIRTY_BIT_UNPACK_STATE);
     }
 
-    if (mUnpackImageHeight != unpack.imageHeight)
+    if (countStateCall(&StateCallCounters::pixelStorei, mUnpackImageHeight != unpack.imageHeight))
     {
         mUnpackImageHeight = unpack.imageHeight;
         ANGLE_GL_TRY(context, mFunctions->pixelStorei(GL_UNPACK_IMAGE_HEIGHT, mUnpackImageHeight));
@@ -580,7 +589,7 @@ angle::Result StateManagerGL::setPixelUnpackState(const gl::Context *context,
         mLocalDirtyBits.set(gl::State::DIRTY_BIT_UNPACK_STATE);
     }
 
-    if (mUnpackSkipImages != unpack.skipImages)
+    if (countStateCall(&StateCallCounters::pixelStorei, mUnpackSkipImages != unpack.skipImages))
     {
         mUnpackSkipImages = unpack.skipImages;
         ANGLE_GL_TRY(context, mFunctions->pixelStorei(GL_UNPACK_SKIP_IMAGES, mUnpackSkipImages));
@@ -607,7 +616,7 @@ angle::Result StateManagerGL::setPixelUnpackBuffer(const gl::Context *context,
 angle::Result StateManagerGL::setPixelPackState(const gl::Context *context,
                                                 const gl::PixelPackState &pack)
 {
-    if (mPackAlignment != pack.alignment)
+    if (countStateCall(&StateCallCounters::pixelStorei, mPackAlignment != pack.alignment))
     {
         mPackAlignment = pack.alignment;
         ANGLE_GL_TRY(context, mFunctions->pixelStorei(GL_PACK_ALIGNMENT, mPackAlignment));
@@ -615,7 +624,7 @@ angle::Result StateManagerGL::setPixelPackState(const gl::Context *context,
         mLocalDirtyBits.set(gl::State::DIRTY_BIT_PACK_STATE);
     }
 
-    if (mPackRowLength != pack.rowLength)
+    if (countStateCall(&StateCallCounters::pixelStorei, mPackRowLength != pack.rowLength))
     {
         mPackRowLength = pack.rowLength;
         ANGLE_GL_TRY(context, mFunctions->pixelStorei(GL_PACK_ROW_LENGTH, mPackRowLength));
@@ -623,7 +632,7 @@ angle::Result StateManagerGL::setPixelPackState(const gl::Context *context,
         mLocalDirtyBits.set(gl::State::DIRTY_BIT_PACK_STATE);
     }
 
-    if (mPackSkipRows != pack.skipRows)
+    if (countStateCall(&StateCallCounters::pixelStorei, mPackSkipRows != pack.skipRows))
     {
         mPackSkipRows = pack.skipRows;
         ANGLE_GL_TRY(context, mFunctions->pixelStorei(GL_PACK_SKIP_ROWS, mPackSkipRows));
@@ -631,7 +640,7 @@ angle::Result StateManagerGL::setPixelPackState(const gl::Context *context,
         mLocalDirtyBits.set(gl::State::DIRTY_BIT_PACK_STATE);
     }
 
-    if (mPackSkipPixels != pack.skipPixels)
+    if (countStateCall(&StateCallCounters::pixelStorei, mPackSkipPixels != pack.skipPixels))
     {
         mPackSkipPixels = pack.skipPixels;
         ANGLE_GL_TRY(context, mFunctions->pixelStorei(GL_PACK_SKIP_PIXELS, mPackSkipPixels));
@@ -706,6 +715,7 @@ void StateManagerGL::bindFramebuffer(GLenum type, GLuint framebuffer)
             break;
     }
 
+    countStateCall(&StateCallCounters::bindFramebuffer, framebufferChanged);
     if (framebufferChanged && mFeatures.flushOnFramebufferChange.enabled)
     {
         mFunctions->flush();
@@ -715,7 +725,7 @@ void StateManagerGL::bindFramebuffer(GLenum type, GLuint framebuffer)
 void StateManagerGL::bindRenderbuffer(GLenum type, GLuint renderbuffer)
 {
     ASSERT(type == GL_RENDERBUFFER);
-    if (mRenderbuffer != renderbuffer)
+    if (countStateCall(&StateCallCounters::bindRenderbuffer, mRenderbuffer != renderbuffer))
     {
         mRenderbuffer = renderbuffer;
         mFunctions->bindRenderbuffer(type, mRenderbuffer);
@@ -725,7 +735,8 @@ void StateManagerGL::bindRenderbuffer(GLenum type, GLuint renderbuffer)
 void StateManagerGL::bindTransformFeedback(GLenum type, GLuint transformFeedback)
 {
     ASSERT(type == GL_TRANSFORM_FEEDBACK);
-    if (mTransformFeedback != transformFeedback)
+    if (countStateCall(&StateCallCounters::bindTransformFeedback,
+                       mTransformFeedback != transformFeedback))
     {
         // Pause the current transform feedback if one is active.
         // To handle virtualized contexts, StateManagerGL needs to be able to bind a new transform
@@ -1060,7 +1071,7 @@ void StateManagerGL::updateProgramImageBindings(const gl::Context *context)
 void StateManagerGL::setAttributeCurrentData(size_t index,
                                              const gl::VertexAttribCurrentValueData &data)
 {
-    if (mVertexAttribCurrentValues[index] != data)
+    if (countStateCall(&StateCallCounters::vertexAttrib, mVertexAttribCurrentValues[index] != data))
     {
         mVertexAttribCurrentValues[index] = data;
         switch (mVertexAttribCurrentValues[index].Type)
@@ -1089,7 +1100,7 @@ void StateManagerGL::setAttributeCurrentData(size_t index,
 
 void StateManagerGL::setScissorTestEnabled(bool enabled)
 {
-    if (mScissorTestEnabled != enabled)
+    if (countCapabilityCall(enabled, mScissorTestEnabled != enabled))
     {
         mScissorTestEnabled = enabled;
         if (mScissorTestEnabled)
@@ -1107,7 +1118,7 @@ void StateManagerGL::setScissorTestEnabled(bool enabled)
 
 void StateManagerGL::setScissor(const gl::Rectangle &scissor)
 {
-    if (scissor != mScissor)
+    if (countStateCall(&StateCallCounters::scissor, scissor != mScissor))
     {
         mScissor = scissor;
         mFunctions->scissor(mScissor.x, mScissor.y, mScissor.width, mScissor.height);
@@ -1118,7 +1129,7 @@ void StateManagerGL::setScissor(const gl::Rectangle &scissor)
 
 void StateManagerGL::setViewport(const gl::Rectangle &viewport)
 {
-    if (viewport != mViewport)
+    if (countStateCall(&StateCallCounters::viewport, viewport != mViewport))
     {
         mViewport = viewport;
         mFunctions->viewport(mViewport.x, mViewport.y, mViewport.width, mViewport.height);
@@ -1129,6 +1140,11 @@ void StateManagerGL::setViewport(const gl::Rectangle &viewport)
 
 void StateManagerGL::setDepthRange(float near, float far)
 {
+    if (!countStateCall(&StateCallCounters::depthRange, mNear != near || mFar != far))
+    {
+        return;
+    }
+
     mNear = near;
     mFar  = far;
 
@@ -1151,7 +1167,7 @@ void StateManagerGL::setBlendEnabled(bool enabled)
 {
     const gl::DrawBufferMask mask =
         enabled ? mBlendStateExt.getAllEnabledMask() : gl::DrawBufferMask::Zero();
-    if (mBlendStateExt.getEnabledMask() == mask)
+    if (!countCapabilityCall(enabled, mBlendStateExt.getEnabledMask() != mask))
     {
         return;
     }
@@ -1171,7 +1187,8 @@ void StateManagerGL::setBlendEnabled(bool enabled)
 
 void StateManagerGL::setBlendEnabledIndexed(const gl::DrawBufferMask enabledMask)
 {
-    if (mBlendStateExt.getEnabledMask() == enabledMask)
+    if (!countStateCall(&StateCallCounters::enablei,
+                        mBlendStateExt.getEnabledMask() != enabledMask))
     {
         return;
     }
@@ -1195,11 +1212,13 @@ void StateManagerGL::setBlendEnabledIndexed(const gl::DrawBufferMask enabledMask
         if (enabledCount < diffCount && enabledCount <= disabledCount)
         {
             diffMask = enabledMask;
+            countStateCall(&StateCallCounters::disable, true);
             mFunctions->disable(GL_BLEND);
         }
         else if (disabledCount < diffCount && disabledCount <= enabledCount)
         {
             diffMask = disabledMask;
+            countStateCall(&StateCallCounters::enable, true);
             mFunctions->enable(GL_BLEND);
         }
     }
@@ -1208,10 +1227,12 @@ void StateManagerGL::setBlendEnabledIndexed(const gl::DrawBufferMask enabledMask
     {
         if (enabledMask.test(drawBufferIndex))
         {
+            countStateCall(&StateCallCounters::enablei, true);
             mFunctions->enablei(GL_BLEND, static_cast<GLuint>(drawBufferIndex));
         }
         else
         {
+            countStateCall(&StateCallCounters::disablei, true);
             mFunctions->disablei(GL_BLEND, static_cast<GLuint>(drawBufferIndex));
         }
     }
@@ -1222,7 +1243,7 @@ void StateManagerGL::setBlendEnabledIndexed(const gl::DrawBufferMask enabledMask
 
 void StateManagerGL::setBlendColor(const gl::ColorF &blendColor)
 {
-    if (mBlendColor != blendColor)
+    if (countStateCall(&StateCallCounters::blendColor, mBlendColor != blendColor))
     {
         mBlendColor = blendColor;
         mFunctions->blendColor(mBlendColor.red, mBlendColor.green, mBlendColor.blue,
@@ -1239,11 +1260,13 @@ void StateManagerGL::setBlendFuncs(const gl::BlendStateExt &blendStateExt)
         mBlendStateExt.getSrcAlphaBits() == blendStateExt.getSrcAlphaBits() &&
         mBlendStateExt.getDstAlphaBits() == blendStateExt.getDstAlphaBits())
     {
+        countStateCall(&StateCallCounters::blendFuncSeparate, false);
         return;
     }
 
     if (!mIndependentBlendStates)
     {
+        countStateCall(&StateCallCounters::blendFuncSeparate, true);
         mFunctions->blendFuncSeparate(
             blendStateExt.getSrcColorIndexed(0), blendStateExt.getDstColorIndexed(0),
             blendStateExt.getSrcAlphaIndexed(0), blendStateExt.getDstAlphaIndexed(0));
@@ -1296,6 +1319,7 @@ void StateManagerGL::setBlendFuncs(const gl::BlendStateExt &blendStateExt)
             }
             if (found)
             {
+                countStateCall(&StateCallCounters::blendFuncSeparate, true);
                 mFunctions->blendFuncSeparate(
                     ToGLenum(gl::BlendStateExt::FactorStorage::GetValueIndexed(0, commonSrcColor)),
                     ToGLenum(gl::BlendStateExt::FactorStorage::GetValueIndexed(0, commonDstColor)),
@@ -1306,6 +1330,7 @@ void StateManagerGL::setBlendFuncs(const gl::BlendStateExt &blendStateExt)
 
         for (size_t drawBufferIndex : diffMask)
         {
+            countStateCall(&StateCallCounters::blendFuncSeparatei, true);
             mFunctions->blendFuncSeparatei(static_cast<GLuint>(drawBufferIndex),
                                            blendStateExt.getSrcColorIndexed(drawBufferIndex),
                                            blendStateExt.getDstColorIndexed(drawBufferIndex),
@@ -1325,11 +1350,13 @@ void StateManagerGL::setBlendEquations(const gl::BlendStateExt &blendStateExt)
     if (mBlendStateExt.getEquationColorBits() == blendStateExt.getEquationColorBits() &&
         mBlendStateExt.getEquationAlphaBits() == blendStateExt.getEquationAlphaBits())
     {
+        countStateCall(&StateCallCounters::blendEquationSeparate, false);
         return;
     }
 
     if (!mIndependentBlendStates)
     {
+        countStateCall(&StateCallCounters::blendEquationSeparate, true);
         mFunctions->blendEquationSeparate(blendStateExt.getEquationColorIndexed(0),
                                           blendStateExt.getEquationAlphaIndexed(0));
     }
@@ -1373,6 +1400,7 @@ void StateManagerGL::setBlendEquations(const gl::BlendStateExt &blendStateExt)
             }
             if (found)
             {
+                countStateCall(&StateCallCounters::blendEquationSeparate, true);
                 mFunctions->blendEquationSeparate(
                     ToGLenum(gl::BlendStateExt::EquationStorage::GetValueIndexed(
                         0, commonEquationColor)),
@@ -1383,6 +1411,7 @@ void StateManagerGL::setBlendEquations(const gl::BlendStateExt &blendStateExt)
 
         for (size_t drawBufferIndex : diffMask)
         {
+            countStateCall(&StateCallCounters::blendEquationSeparatei, true);
             mFunctions->blendEquationSeparatei(
                 static_cast<GLuint>(drawBufferIndex),
                 blendStateExt.getEquationColorIndexed(drawBufferIndex),
@@ -1398,7 +1427,7 @@ void StateManagerGL::setColorMask(bool red, bool green, bool blue, bool alpha)
 {
     const gl::BlendStateExt::ColorMaskStorage::Type mask =
         mBlendStateExt.expandColorMaskValue(red, green, blue, alpha);
-    if (mBlendStateExt.getColorMaskBits() != mask)
+    if (countStateCall(&StateCallCounters::colorMask, mBlendStateExt.getColorMaskBits() != mask))
     {
         mFunctions->colorMask(red, green, blue, alpha);
         mBlendStateExt.setColorMaskBits(mask);
@@ -1408,7 +1437,7 @@ void StateManagerGL::setColorMask(bool red, bool green, bool blue, bool alpha)
 
 void StateManagerGL::setSampleAlphaToCoverageEnabled(bool enabled)
 {
-    if (mSampleAlphaToCoverageEnabled != enabled)
+    if (countCapabilityCall(enabled, mSampleAlphaToCoverageEnabled != enabled))
     {
         mSampleAlphaToCoverageEnabled = enabled;
         if (mSampleAlphaToCoverageEnabled)
@@ -1426,7 +1455,7 @@ void StateManagerGL::setSampleAlphaToCoverageEnabled(bool enabled)
 
 void StateManagerGL::setSampleCoverageEnabled(bool enabled)
 {
-    if (mSampleCoverageEnabled != enabled)
+    if (countCapabilityCall(enabled, mSampleCoverageEnabled != enabled))
     {
         mSampleCoverageEnabled = enabled;
         if (mSampleCoverageEnabled)
@@ -1444,7 +1473,8 @@ void StateManagerGL::setSampleCoverageEnabled(bool enabled)
 
 void StateManagerGL::setSampleCoverage(float value, bool invert)
 {
-    if (mSampleCoverageValue != value || mSampleCoverageInvert != invert)
+    if (countStateCall(&StateCallCounters::sampleCoverage,
+                       mSampleCoverageValue != value || mSampleCoverageInvert != invert))
     {
         mSampleCoverageValue  = value;
         mSampleCoverageInvert = invert;
@@ -1456,7 +1486,7 @@ void StateManagerGL::setSampleCoverage(float value, bool invert)
 
 void StateManagerGL::setSampleMaskEnabled(bool enabled)
 {
-    if (mSampleMaskEnabled != enabled)
+    if (countCapabilityCall(enabled, mSampleMaskEnabled != enabled))
     {
         mSampleMaskEnabled = enabled;
         if (mSampleMaskEnabled)
@@ -1475,7 +1505,7 @@ void StateManagerGL::setSampleMaskEnabled(bool enabled)
 void StateManagerGL::setSampleMaski(GLuint maskNumber, GLbitfield mask)
 {
     ASSERT(maskNumber < mSampleMaskValues.size());
-    if (mSampleMaskValues[maskNumber] != mask)
+    if (countStateCall(&StateCallCounters::sampleMaski, mSampleMaskValues[maskNumber] != mask))
     {
         mSampleMaskValues[maskNumber] = mask;
         mFunctions->sampleMaski(maskNumber, mask);
@@ -1484,120 +1514,160 @@ void StateManagerGL::setSampleMaski(GLuint maskNumber, GLbitfield mask)
     }
 }
 
-// Depth and stencil redundant state changes are guarded in the
-// frontend so for related cases here just set the dirty bit
-// and update backend states.
+// Depth and stencil redundant state changes are also guarded in the frontend, but the native
+// state can still match when all state is dirtied on a virtualized context switch or after an
+// internal blit.
 void StateManagerGL::setDepthTestEnabled(bool enabled)
 {
-    mDepthTestEnabled = enabled;
-    if (mDepthTestEnabled)
-    {
-        mFunctions->enable(GL_DEPTH_TEST);
-    }
-    else
+    if (countCapabilityCall(enabled, mDepthTestEnabled != enabled))
     {
-        mFunctions->disable(GL_DEPTH_TEST);
-    }
+        mDepthTestEnabled = enabled;
+        if (mDepthTestEnabled)
+        {
+            mFunctions->enable(GL_DEPTH_TEST);
+        }
+        else
+        {
+            mFunctions->disable(GL_DEPTH_TEST);
+        }
 
-    mLocalDirtyBits.set(gl::State::DIRTY_BIT_DEPTH_TEST_ENABLED);
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_DEPTH_TEST_ENABLED);
+    }
 }
 
 void StateManagerGL::setDepthFunc(GLenum depthFunc)
 {
-    mDepthFunc = depthFunc;
-    mFunctions->depthFunc(mDepthFunc);
+    if (countStateCall(&StateCallCounters::depthFunc, mDepthFunc != depthFunc))
+    {
+        mDepthFunc = depthFunc;
+        mFunctions->depthFunc(mDepthFunc);
 
-    mLocalDirtyBits.set(gl::State::DIRTY_BIT_DEPTH_FUNC);
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_DEPTH_FUNC);
+    }
 }
 
 void StateManagerGL::setDepthMask(bool mask)
 {
-    mDepthMask = mask;
-    mFunctions->depthMask(mDepthMask);
+    if (countStateCall(&StateCallCounters::depthMask, mDepthMask != mask))
+    {
+        mDepthMask = mask;
+        mFunctions->depthMask(mDepthMask);
 
-    mLocalDirtyBits.set(gl::State::DIRTY_BIT_DEPTH_MASK);
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_DEPTH_MASK);
+    }
 }
 
 void StateManagerGL::setStencilTestEnabled(bool enabled)
 {
-    mStencilTestEnabled = enabled;
-    if (mStencilTestEnabled)
-    {
-        mFunctions->enable(GL_STENCIL_TEST);
-    }
-    else
+    if (countCapabilityCall(enabled, mStencilTestEnabled != enabled))
     {
-        mFunctions->disable(GL_STENCIL_TEST);
-    }
+        mStencilTestEnabled = enabled;
+        if (mStencilTestEnabled)
+        {
+            mFunctions->enable(GL_STENCIL_TEST);
+        }
+        else
+        {
+            mFunctions->disable(GL_STENCIL_TEST);
+        }
 
-    mLocalDirtyBits.set(gl::State::DIRTY_BIT_STENCIL_TEST_ENABLED);
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_STENCIL_TEST_ENABLED);
+    }
 }
 
 void StateManagerGL::setStencilFrontWritemask(GLuint mask)
 {
-    mStencilFrontWritemask = mask;
-    mFunctions->stencilMaskSeparate(GL_FRONT, mStencilFrontWritemask);
+    if (countStateCall(&StateCallCounters::stencilMaskSeparate, mStencilFrontWritemask != mask))
+    {
+        mStencilFrontWritemask = mask;
+        mFunctions->stencilMaskSeparate(GL_FRONT, mStencilFrontWritemask);
 
-    mLocalDirtyBits.set(gl::State::DIRTY_BIT_STENCIL_WRITEMASK_FRONT);
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_STENCIL_WRITEMASK_FRONT);
+    }
 }
 
 void StateManagerGL::setStencilBackWritemask(GLuint mask)
 {
-    mStencilBackWritemask = mask;
-    mFunctions->stencilMaskSeparate(GL_BACK, mStencilBackWritemask);
+    if (countStateCall(&StateCallCounters::stencilMaskSeparate, mStencilBackWritemask != mask))
+    {
+        mStencilBackWritemask = mask;
+        mFunctions->stencilMaskSeparate(GL_BACK, mStencilBackWritemask);
 
-    mLocalDirtyBits.set(gl::State::DIRTY_BIT_STENCIL_WRITEMASK_BACK);
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_STENCIL_WRITEMASK_BACK);
+    }
 }
 
 void StateManagerGL::setStencilFrontFuncs(GLenum func, GLint ref, GLuint mask)
 {
-    mStencilFrontFunc      = func;
-    mStencilFrontRef       = ref;
-    mStencilFrontValueMask = mask;
-    mFunctions->stencilFuncSeparate(GL_FRONT, mStencilFrontFunc, mStencilFrontRef,
-                                    mStencilFrontValueMask);
+    const bool changed =
+        mStencilFrontFunc != func || mStencilFrontRef != ref || mStencilFrontValueMask != mask;
+    if (countStateCall(&StateCallCounters::stencilFuncSeparate, changed))
+    {
+        mStencilFrontFunc      = func;
+        mStencilFrontRef       = ref;
+        mStencilFrontValueMask = mask;
+        mFunctions->stencilFuncSeparate(GL_FRONT, mStencilFrontFunc, mStencilFrontRef,
+                                        mStencilFrontValueMask);
 
-    mLocalDirtyBits.set(gl::State::DIRTY_BIT_STENCIL_FUNCS_FRONT);
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_STENCIL_FUNCS_FRONT);
+    }
 }
 
 void StateManagerGL::setStencilBackFuncs(GLenum func, GLint ref, GLuint mask)
 {
-    mStencilBackFunc      = func;
-    mStencilBackRef       = ref;
-    mStencilBackValueMask = mask;
-    mFunctions->stencilFuncSeparate(GL_BACK, mStencilBackFunc, mStencilBackRef,
-                                    mStencilBackValueMask);
+    const bool changed =
+        mStencilBackFunc != func || mStencilBackRef != ref || mStencilBackValueMask != mask;
+    if (countStateCall(&StateCallCounters::stencilFuncSeparate, changed))
+    {
+        mStencilBackFunc      = func;
+        mStencilBackRef       = ref;
+        mStencilBackValueMask = mask;
+        mFunctions->stencilFuncSeparate(GL_BACK, mStencilBackFunc, mStencilBackRef,
+                                        mStencilBackValueMask);
 
-    mLocalDirtyBits.set(gl::State::DIRTY_BIT_STENCIL_FUNCS_BACK);
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_STENCIL_FUNCS_BACK);
+    }
 }
 
 void StateManagerGL::setStencilFrontOps(GLenum sfail, GLenum dpfail, GLenum dppass)
 {
-    mStencilFrontStencilFailOp          = sfail;
-    mStencilFrontStencilPassDepthFailOp = dpfail;
-    mStencilFrontStencilPassDepthPassOp = dppass;
-    mFunctions->stencilOpSeparate(GL_FRONT, mStencilFrontStencilFailOp,
-                                  mStencilFrontStencilPassDepthFailOp,
-                                  mStencilFrontStencilPassDepthPassOp);
+    const bool changed = mStencilFrontStencilFailOp != sfail ||
+                         mStencilFrontStencilPassDepthFailOp != dpfail ||
+                         mStencilFrontStencilPassDepthPassOp != dppass;
+    if (countStateCall(&StateCallCounters::stencilOpSeparate, changed))
+    {
+        mStencilFrontStencilFailOp          = sfail;
+        mStencilFrontStencilPassDepthFailOp = dpfail;
+        mStencilFrontStencilPassDepthPassOp = dppass;
+        mFunctions->stencilOpSeparate(GL_FRONT, mStencilFrontStencilFailOp,
+                                      mStencilFrontStencilPassDepthFailOp,
+                                      mStencilFrontStencilPassDepthPassOp);
 
-    mLocalDirtyBits.set(gl::State::DIRTY_BIT_STENCIL_OPS_FRONT);
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_STENCIL_OPS_FRONT);
+    }
 }
 
 void StateManagerGL::setStencilBackOps(GLenum sfail, GLenum dpfail, GLenum dppass)
 {
-    mStencilBackStencilFailOp          = sfail;
-    mStencilBackStencilPassDepthFailOp = dpfail;
-    mStencilBackStencilPassDepthPassOp = dppass;
-    mFunctions->stencilOpSeparate(GL_BACK, mStencilBackStencilFailOp,
-                                  mStencilBackStencilPassDepthFailOp,
-                                  mStencilBackStencilPassDepthPassOp);
+    const bool changed = mStencilBackStencilFailOp != sfail ||
+                         mStencilBackStencilPassDepthFailOp != dpfail ||
+                         mStencilBackStencilPassDepthPassOp != dppass;
+    if (countStateCall(&StateCallCounters::stencilOpSeparate, changed))
+    {
+        mStencilBackStencilFailOp          = sfail;
+        mStencilBackStencilPassDepthFailOp = dpfail;
+        mStencilBackStencilPassDepthPassOp = dppass;
+        mFunctions->stencilOpSeparate(GL_BACK, mStencilBackStencilFailOp,
+                                      mStencilBackStencilPassDepthFailOp,
+                                      mStencilBackStencilPassDepthPassOp);
 
-    mLocalDirtyBits.set(gl::State::DIRTY_BIT_STENCIL_OPS_BACK);
+        mLocalDirtyBits.set(gl::State::DIRTY_BIT_STENCIL_OPS_BACK);
+    }
 }
 
 void StateManagerGL::setCullFaceEnabled(bool enabled)
 {
-    if (mCullFaceEnabled != enabled)
+    if (countCapabilityCall(enabled, mCullFaceEnabled != enabled))
     {
         mCullFaceEnabled = enabled;
         if (mCullFaceEnabled)
@@ -1615,7 +1685,7 @@ void StateManagerGL::setCullFaceEnabled(bool enabled)
 
 void StateManagerGL::setCullFace(gl::CullFaceMode cullFace)
 {
-    if (mCullFace != cullFace)
+    if (countStateCall(&StateCallCounters::cullFace, mCullFace != cullFace))
     {
         mCullFace = cullFace;
         mFunctions->cullFace(ToGLenum(mCullFace));
@@ -1626,7 +1696,7 @@ void StateManagerGL::setCullFace(gl::CullFaceMode cullFace)
 
 void StateManagerGL::setFrontFace(GLenum frontFace)
 {
-    if (mFrontFace != frontFace)
+    if (countStateCall(&StateCallCounters::frontFace, mFrontFace != frontFace))
     {
         mFrontFace = frontFace;
         mFunctions->frontFace(mFrontFace);
@@ -1637,7 +1707,7 @@ void StateManagerGL::setFrontFace(GLenum frontFace)
 
 void StateManagerGL::setPolygonOffsetFillEnabled(bool enabled)
 {
-    if (mPolygonOffsetFillEnabled != enabled)
+    if (countCapabilityCall(enabled, mPolygonOffsetFillEnabled != enabled))
     {
         mPolygonOffsetFillEnabled = enabled;
         if (mPolygonOffsetFillEnabled)
@@ -1655,7 +1725,8 @@ void StateManagerGL::setPolygonOffsetFillEnabled(bool enabled)
 
 void StateManagerGL::setPolygonOffset(float factor, float units)
 {
-    if (mPolygonOffsetFactor != factor || mPolygonOffsetUnits != units)
+    if (countStateCall(&StateCallCounters::polygonOffset,
+                       mPolygonOffsetFactor != factor || mPolygonOffsetUnits != units))
     {
         mPolygonOffsetFactor = factor;
         mPolygonOffsetUnits  = units;
@@ -1667,7 +1738,7 @@ void StateManagerGL::setPolygonOffset(float factor, float units)
 
 void StateManagerGL::setRasterizerDiscardEnabled(bool enabled)
 {
-    if (mRasterizerDiscardEnabled != enabled)
+    if (countCapabilityCall(enabled, mRasterizerDiscardEnabled != enabled))
     {
         mRasterizerDiscardEnabled = enabled;
         if (mRasterizerDiscardEnabled)
@@ -1685,7 +1756,7 @@ void StateManagerGL::setRasterizerDiscardEnabled(bool enabled)
 
 void StateManagerGL::setLineWidth(float width)
 {
-    if (mLineWidth != width)
+    if (countStateCall(&StateCallCounters::lineWidth, mLineWidth != width))
     {
         mLineWidth = width;
         mFunctions->lineWidth(mLineWidth);
@@ -1696,7 +1767,7 @@ void StateManagerGL::setLineWidth(float width)
 
 angle::Result StateManagerGL::setPrimitiveRestartEnabled(const gl::Context *context, bool enabled)
 {
-    if (mPrimitiveRestartEnabled != enabled)
+    if (countCapabilityCall(enabled, mPrimitiveRestartEnabled != enabled))
     {
         GLenum cap = mFeatures.emulatePrimitiveRestartFixedIndex.enabled
                          ? GL_PRIMITIVE_RESTART
@@ -1720,7 +1791,7 @@ angle::Result StateManagerGL::setPrimitiveRestartEnabled(const gl::Context *cont
 
 angle::Result StateManagerGL::setPrimitiveRestartIndex(const gl::Context *context, GLuint index)
 {
-    if (mPrimitiveRestartIndex != index)
+    if (countStateCall(&StateCallCounters::primitiveRestartIndex, mPrimitiveRestartIndex != index))
     {
         ANGLE_GL_TRY(context, mFunctions->primitiveRestartIndex(index));
         mPrimitiveRestartIndex = index;
@@ -1733,7 +1804,7 @@ angle::Result StateManagerGL::setPrimitiveRestartIndex(const gl::Context *contex
 
 void StateManagerGL::setClearDepth(float clearDepth)
 {
-    if (mClearDepth != clearDepth)
+    if (countStateCall(&StateCallCounters::clearDepth, mClearDepth != clearDepth))
     {
         mClearDepth = clearDepth;
 
@@ -1772,7 +1843,7 @@ void StateManagerGL::setClearColor(const gl::ColorF &clearColor)
         }
     }
 
-    if (mClearColor != modifiedClearColor)
+    if (countStateCall(&StateCallCounters::clearColor, mClearColor != modifiedClearColor))
     {
         mClearColor = modifiedClearColor;
         mFunctions->clearColor(mClearColor.red, mClearColor.green, mClearColor.blue,
@@ -1784,7 +1855,7 @@ void StateManagerGL::setClearColor(const gl::ColorF &clearColor)
 
 void StateManagerGL::setClearStencil(GLint clearStencil)
 {
-    if (mClearStencil != clearStencil)
+    if (countStateCall(&StateCallCounters::clearStencil, mClearStencil != clearStencil))
     {
         mClearStencil = clearStencil;
         mFunctions->clearStencil(mClearStencil);
@@ -2096,7 +2167,7 @@ angle::Result StateManagerGL::syncState(const gl::Context *context,
                         iter.setLaterBit(gl::State::DIRTY_BIT_ATOMIC_COUNTER_BUFFER_BINDING);
                     }
 
-                    if (mIsMultiviewEnabled && program->usesMultiview())
+                    if (mIsInstancedMultiviewEnabled && program->usesMultiview())
                     {
                         updateMultiviewBaseViewLayerIndexUniform(
                             program, state.getDrawFramebuffer()->getImplementation()->getState());
@@ -2205,7 +2276,7 @@ void StateManagerGL::setFramebufferSRGBEnabled(const gl::Context *context, bool
         return;
     }
 
-    if (mFramebufferSRGBEnabled != enabled)
+    if (countCapabilityCall(enabled, mFramebufferSRGBEnabled != enabled))
     {
         mFramebufferSRGBEnabled = enabled;
         if (mFramebufferSRGBEnabled)
@@ -2257,6 +2328,7 @@ void StateManagerGL::setColorMaskForFramebuffer(const gl::BlendStateExt &blendSt
     // Check if the current mask already matches the new state
     if (mBlendStateExt.getColorMaskBits() == blendStateExt.getColorMaskBits())
     {
+        countStateCall(&StateCallCounters::colorMaski, false);
         return;
     }
 
@@ -2296,6 +2368,7 @@ void StateManagerGL::setColorMaskForFramebuffer(const gl::BlendStateExt &blendSt
         if (found)
         {
             gl::BlendStateExt::UnpackColorMask(commonColorMask, &r, &g, &b, &a);
+            countStateCall(&StateCallCounters::colorMask, true);
             mFunctions->colorMask(r, g, b, a);
         }
     }
@@ -2303,6 +2376,7 @@ void StateManagerGL::setColorMaskForFramebuffer(const gl::BlendStateExt &blendSt
     for (size_t drawBufferIndex : diffMask)
     {
         blendStateExt.getColorMaskIndexed(drawBufferIndex, &r, &g, &b, &a);
+        countStateCall(&StateCallCounters::colorMaski, true);
         mFunctions->colorMaski(static_cast<GLuint>(drawBufferIndex), r, g, b, a);
     }
 
@@ -2312,7 +2386,7 @@ void StateManagerGL::setColorMaskForFramebuffer(const gl::BlendStateExt &blendSt
 
 void StateManagerGL::setDitherEnabled(bool enabled)
 {
-    if (mDitherEnabled != enabled)
+    if (countCapabilityCall(enabled, mDitherEnabled != enabled))
     {
         mDitherEnabled = enabled;
         if (mDitherEnabled)
@@ -2328,7 +2402,7 @@ void StateManagerGL::setDitherEnabled(bool enabled)
 
 void StateManagerGL::setMultisamplingStateEnabled(bool enabled)
 {
-    if (mMultisamplingEnabled != enabled)
+    if (countCapabilityCall(enabled, mMultisamplingEnabled != enabled))
     {
         mMultisamplingEnabled = enabled;
         if (mMultisamplingEnabled)
@@ -2345,7 +2419,7 @@ void StateManagerGL::setMultisamplingStateEnabled(bool enabled)
 
 void StateManagerGL::setSampleAlphaToOneStateEnabled(bool enabled)
 {
-    if (mSampleAlphaToOneEnabled != enabled)
+    if (countCapabilityCall(enabled, mSampleAlphaToOneEnabled != enabled))
     {
         mSampleAlphaToOneEnabled = enabled;
         if (mSampleAlphaToOneEnabled)
@@ -2362,7 +2436,7 @@ void StateManagerGL::setSampleAlphaToOneStateEnabled(bool enabled)
 
 void StateManagerGL::setCoverageModulation(GLenum components)
 {
-    if (mCoverageModulation != components)
+    if (countStateCall(&StateCallCounters::coverageModulationNV, mCoverageModulation != components))
     {
         mCoverageModulation = components;
         mFunctions->coverageModulationNV(components);
@@ -2373,7 +2447,7 @@ void StateManagerGL::setCoverageModulation(GLenum components)
 
 void StateManagerGL::setProvokingVertex(GLenum mode)
 {
-    if (mode != mProvokingVertex)
+    if (countStateCall(&StateCallCounters::provokingVertex, mode != mProvokingVertex))
     {
         mFunctions->provokingVertex(mode);
         mProvokingVertex = mode;
@@ -2386,6 +2460,7 @@ void StateManagerGL::setClipDistancesEnable(const gl::State::ClipDistanceEnableB
 {
     if (enables == mEnabledClipDistances)
     {
+        countStateCall(&StateCallCounters::enable, false);
         return;
     }
     ASSERT(mMaxClipDistances <= gl::IMPLEMENTATION_MAX_CLIP_DISTANCES);
@@ -2393,6 +2468,7 @@ void StateManagerGL::setClipDistancesEnable(const gl::State::ClipDistanceEnableB
     gl::State::ClipDistanceEnableBits diff = enables ^ mEnabledClipDistances;
     for (size_t i : diff)
     {
+        countCapabilityCall(enables.test(i), true);
         if (enables.test(i))
         {
             mFunctions->enable(GL_CLIP_DISTANCE0_EXT + static_cast<uint32_t>(i));
@@ -2415,7 +2491,7 @@ void StateManagerGL::setTextureCubemapSeamlessEnabled(bool enabled)
         return;
     }
 
-    if (mTextureCubemapSeamlessEnabled != enabled)
+    if (countCapabilityCall(enabled, mTextureCubemapSeamlessEnabled != enabled))
     {
         mTextureCubemapSeamlessEnabled = enabled;
         if (mTextureCubemapSeamlessEnabled)
@@ -2439,7 +2515,7 @@ angle::Result StateManagerGL::propagateProgramToVAO(const gl::Context *context,
     }
 
     // Number of views:
-    if (mIsMultiviewEnabled)
+    if (mIsInstancedMultiviewEnabled)
     {
         int programNumViews = 1;
         if (program && program->usesMultiview())
@@ -2463,7 +2539,7 @@ void StateManagerGL::updateMultiviewBaseViewLayerIndexUniformImpl(
     const gl::Program *program,
     const gl::FramebufferState &drawFramebufferState) const
 {
-    ASSERT(mIsMultiviewEnabled && program && program->usesMultiview());
+    ASSERT(mIsInstancedMultiviewEnabled && program && program->usesMultiview());
     const ProgramGL *programGL = GetImplAs<ProgramGL>(program);
     if (drawFramebufferState.isMultiview())
     {
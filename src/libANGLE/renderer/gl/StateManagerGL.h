@@ -32,6 +32,7 @@ namespace rx
 class FramebufferGL;
 class FunctionsGL;
 class TransformFeedbackGL;
+enum class MultiviewImplementationTypeGL;
 class VertexArrayGL;
 class QueryGL;
 
@@ -145,13 +146,80 @@ struct VertexArrayStateGL
     angle::FixedVector<VertexBindingGL, gl::MAX_VERTEX_ATTRIBS> bindings;
 };
 
+// The FunctionsGL entry points that set shadowed state.  Variants of an entry point, such as
+// glTexParameteri and glTexParameterf or glDepthRange and glDepthRangef, are counted together.
+#define ANGLE_GL_STATE_CALLS_X(FN) \
+    FN(activeTexture)              \
+    FN(bindBuffer)                 \
+    FN(bindBufferBase)             \
+    FN(bindBufferRange)            \
+    FN(bindFramebuffer)            \
+    FN(bindImageTexture)           \
+    FN(bindRenderbuffer)           \
+    FN(bindSampler)                \
+    FN(bindTexture)                \
+    FN(bindTransformFeedback)      \
+    FN(bindVertexArray)            \
+    FN(blendColor)                 \
+    FN(blendEquationSeparate)      \
+    FN(blendEquationSeparatei)     \
+    FN(blendFuncSeparate)          \
+    FN(blendFuncSeparatei)         \
+    FN(clearColor)                 \
+    FN(clearDepth)                 \
+    FN(clearStencil)               \
+    FN(colorMask)                  \
+    FN(colorMaski)                 \
+    FN(coverageModulationNV)       \
+    FN(cullFace)                   \
+    FN(depthFunc)                  \
+    FN(depthMask)                  \
+    FN(depthRange)                 \
+    FN(disable)                    \
+    FN(disablei)                   \
+    FN(enable)                     \
+    FN(enablei)                    \
+    FN(frontFace)                  \
+    FN(lineWidth)                  \
+    FN(pixelStorei)                \
+    FN(polygonOffset)              \
+    FN(primitiveRestartIndex)      \
+    FN(provokingVertex)            \
+    FN(sampleCoverage)             \
+    FN(sampleMaski)                \
+    FN(samplerParameter)           \
+    FN(scissor)                    \
+    FN(stencilFuncSeparate)        \
+    FN(stencilMaskSeparate)        \
+    FN(stencilOpSeparate)          \
+    FN(texParameter)               \
+    FN(useProgram)                 \
+    FN(vertexAttrib)               \
+    FN(viewport)
+
+// How many calls to an entry point were issued to the driver, and how many were skipped because
+// the shadowed state already matched.
+struct StateCallCounter
+{
+    uint64_t issued  = 0;
+    uint64_t skipped = 0;
+};
+
+struct StateCallCounters
+{
+#define ANGLE_DECLARE_STATE_CALL_COUNTER(CALL) StateCallCounter CALL;
+    ANGLE_GL_STATE_CALLS_X(ANGLE_DECLARE_STATE_CALL_COUNTER)
+#undef ANGLE_DECLARE_STATE_CALL_COUNTER
+};
+
 class StateManagerGL final : angle::NonCopyable
 {
   public:
     StateManagerGL(const FunctionsGL *functions,
                    const gl::Caps &rendererCaps,
                    const gl::Extensions &extensions,
-                   const angle::FeaturesGL &features);
+                   const angle::FeaturesGL &features,
+                   MultiviewImplementationTypeGL multiviewImplementationType);
     ~StateManagerGL();
 
     void deleteProgram(GLuint program);
@@ -276,7 +344,7 @@ class StateManagerGL final : angle::NonCopyable
         const gl::Program *program,
         const gl::FramebufferState &drawFramebufferState) const
     {
-        if (mIsMultiviewEnabled && program && program->usesMultiview())
+        if (mIsInstancedMultiviewEnabled && program && program->usesMultiview())
         {
             updateMultiviewBaseViewLayerIndexUniformImpl(program, drawFramebufferState);
         }
@@ -298,9 +366,34 @@ class StateManagerGL final : angle::NonCopyable
 
     void validateState() const;
 
+    // Records a call to |call| as issued if |changed| is true, or as skipped otherwise.  Returns
+    // |changed| so that it can wrap the redundancy check.
+    ANGLE_INLINE bool countStateCall(StateCallCounter StateCallCounters::*call, bool changed)
+    {
+        StateCallCounter &counter = mStateCallCounters.*call;
+        if (changed)
+        {
+            counter.issued++;
+        }
+        else
+        {
+            counter.skipped++;
+        }
+        return changed;
+    }
+    ANGLE_INLINE bool countCapabilityCall(bool enabled, bool changed)
+    {
+        return countStateCall(enabled ? &StateCallCounters::enable : &StateCallCounters::disable,
+                              changed);
+    }
+    const StateCallCounters &getStateCallCounters() const { return mStateCallCounters; }
+
     void syncFromNativeContext(const gl::Extensions &extensions, ExternalContextState *state);
     void restoreNativeContext(const gl::Extensions &extensions, const ExternalContextState *state);
 
+    // Rebinds the frontend draw indirect buffer after an internal indirect draw.
+    void updateDrawIndirectBufferBinding(const gl::Context *context);
+
   private:
     void setTextureCubemapSeamlessEnabled(bool enabled);
 
@@ -315,7 +408,6 @@ class StateManagerGL final : angle::NonCopyable
     void updateProgramImageBindings(const gl::Context *context);
 
     void updateDispatchIndirectBufferBinding(const gl::Context *context);
-    void updateDrawIndirectBufferBinding(const gl::Context *context);
 
     template <typename T>
     void get(GLenum name, T *value);
@@ -506,7 +598,9 @@ class StateManagerGL final : angle::NonCopyable
 
     GLenum mCoverageModulation;
 
-    const bool mIsMultiviewEnabled;
+    // Whether multiview is emulated with instancing, which needs the vertex attribute divisors and
+    // the base view index of the shaders to be updated.
+    const bool mIsInstancedMultiviewEnabled;
 
     GLenum mProvokingVertex;
 
@@ -515,6 +609,8 @@ class StateManagerGL final : angle::NonCopyable
 
     gl::State::DirtyBits mLocalDirtyBits;
     gl::AttributesMask mLocalDirtyCurrentValues;
+
+    StateCallCounters mStateCallCounters;
 };
 
 }  // namespace rx
@@ -0,0 +1,173 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferGL.cpp: Implements the class methods for StreamingBufferGL.
+
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
+
+#include "common/debug.h"
+#include "common/mathutil.h"
+#include "libANGLE/Context.h"
+#include "libANGLE/renderer/gl/ContextGL.h"
+#include "libANGLE/renderer/gl/FunctionsGL.h"
+#include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/SyncGL.h"
+#include "libANGLE/renderer/gl/renderergl_utils.h"
+
+namespace rx
+{
+namespace
+{
+constexpr size_t kMinBufferSize = 1024 * 1024;
+
+// Fences are waited on in steps so that a lost context does not hang the wait forever.
+constexpr GLuint64 kFenceWaitTimeoutNs = 1000000000;
+}  // anonymous namespace
+
+StreamingBufferGL::StreamingBufferGL(gl::BufferBinding target) : mTarget(target) {}
+
+StreamingBufferGL::~StreamingBufferGL()
+{
+    ASSERT(mBufferID == 0);
+}
+
+void StreamingBufferGL::destroy(const gl::Context *context)
+{
+    for (std::unique_ptr<SyncGL> &fence : mSegmentFences)
+    {
+        if (fence)
+        {
+            fence->onDestroy(context);
+            fence.reset();
+        }
+    }
+    mUnfencedSegments.reset();
+
+    // Deleting the buffer implicitly unmaps it.
+    GetStateManagerGL(context)->deleteBuffer(mBufferID);
+    mBufferID      = 0;
+    mSize          = 0;
+    mSegmentSize   = 0;
+    mHead          = 0;
+    mMappedPointer = nullptr;
+}
+
+angle::Result StreamingBufferGL::initialize(const gl::Context *context, size_t size)
+{
+    const FunctionsGL *functions = GetFunctionsGL(context);
+    StateManagerGL *stateManager = GetStateManagerGL(context);
+
+    ASSERT(mBufferID == 0);
+    ASSERT(size % kSegmentCount == 0);
+
+    ANGLE_GL_TRY(context, functions->genBuffers(1, &mBufferID));
+    stateManager->bindBuffer(mTarget, mBufferID);
+
+    constexpr GLbitfield kStorageFlags =
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    ANGLE_GL_TRY(context,
+                 functions->bufferStorage(gl::ToGLenum(mTarget), size, nullptr, kStorageFlags));
+
+    mMappedPointer = static_cast<uint8_t *>(ANGLE_GL_TRY(
+        context, functions->mapBufferRange(gl::ToGLenum(mTarget), 0, size, kStorageFlags)));
+    ANGLE_CHECK(GetImplAs<ContextGL>(context), mMappedPointer != nullptr,
+                "Failed to map the client data streaming buffer.", GL_OUT_OF_MEMORY);
+
+    mSize        = size;
+    mSegmentSize = size / kSegmentCount;
+    mHead        = 0;
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingBufferGL::insertFence(const gl::Context *context, size_t segment)
+{
+    ASSERT(!mSegmentFences[segment]);
+    mSegmentFences[segment].reset(new SyncGL(GetFunctionsGL(context)));
+    return mSegmentFences[segment]->set(context, GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+angle::Result StreamingBufferGL::waitForFence(const gl::Context *context, size_t segment)
+{
+    std::unique_ptr<SyncGL> &fence = mSegmentFences[segment];
+    if (!fence)
+    {
+        return angle::Result::Continue;
+    }
+
+    GLenum result = GL_TIMEOUT_EXPIRED;
+    while (result == GL_TIMEOUT_EXPIRED)
+    {
+        ANGLE_TRY(
+            fence->clientWait(context, GL_SYNC_FLUSH_COMMANDS_BIT, kFenceWaitTimeoutNs, &result));
+    }
+
+    fence->onDestroy(context);
+    fence.reset();
+
+    ANGLE_CHECK(GetImplAs<ContextGL>(context), result != GL_WAIT_FAILED,
+                "Failed to wait for the client data streaming buffer.", GL_OUT_OF_MEMORY);
+    return angle::Result::Continue;
+}
+
+angle::Result StreamingBufferGL::allocate(const gl::Context *context,
+                                          size_t size,
+                                          size_t alignment,
+                                          uint8_t **ptrOut,
+                                          size_t *offsetOut)
+{
+    ASSERT(size > 0 && alignment > 0);
+
+    // Keep room for at least two allocations, otherwise every allocation waits for the previous
+    // one to be consumed.
+    if (size > mSize / 2)
+    {
+        size_t newSize = std::max(mSize, kMinBufferSize);
+        while (newSize < size * 2)
+        {
+            newSize *= 2;
+        }
+
+        destroy(context);
+        ANGLE_TRY(initialize(context, newSize));
+    }
+    else
+    {
+        GetStateManagerGL(context)->bindBuffer(mTarget, mBufferID);
+    }
+
+    size_t offset    = roundUp(mHead, alignment);
+    const bool wraps = offset + size > mSize;
+    if (wraps)
+    {
+        offset = 0;
+    }
+
+    const size_t firstSegment = offset / mSegmentSize;
+    const size_t lastSegment  = (offset + size - 1) / mSegmentSize;
+
+    // All the draws that read from the previous allocations have been issued.  Fence the segments
+    // they were written to, except the one this allocation continues in.
+    for (size_t segment : mUnfencedSegments)
+    {
+        if (wraps || segment != firstSegment)
+        {
+            ANGLE_TRY(insertFence(context, segment));
+            mUnfencedSegments.reset(segment);
+        }
+    }
+
+    for (size_t segment = firstSegment; segment <= lastSegment; ++segment)
+    {
+        ANGLE_TRY(waitForFence(context, segment));
+        mUnfencedSegments.set(segment);
+    }
+
+    mHead      = offset + size;
+    *ptrOut    = mMappedPointer + offset;
+    *offsetOut = offset;
+    return angle::Result::Continue;
+}
+}  // namespace rx
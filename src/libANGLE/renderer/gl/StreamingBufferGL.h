@@ -0,0 +1,74 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// StreamingBufferGL.h: Defines the class interface for StreamingBufferGL, a persistently and
+// coherently mapped ring buffer used to stream client-side data.
+
+#ifndef LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
+#define LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
+
+#include <array>
+#include <memory>
+
+#include "common/PackedEnums.h"
+#include "common/angleutils.h"
+#include "common/bitset_utils.h"
+#include "libANGLE/Error.h"
+
+namespace gl
+{
+class Context;
+}  // namespace gl
+
+namespace rx
+{
+class SyncGL;
+
+// The buffer is split in segments.  Once the allocations leave a segment, a fence is inserted
+// after the draws that read from it, and the segment is only written to again once that fence
+// has signaled.  This replaces the implicit synchronization of glBufferSubData, which stalls on
+// many drivers when the buffer is still in use by the previous draw.
+class StreamingBufferGL final : angle::NonCopyable
+{
+  public:
+    explicit StreamingBufferGL(gl::BufferBinding target);
+    ~StreamingBufferGL();
+
+    void destroy(const gl::Context *context);
+
+    // Returns a write pointer to |size| bytes of the buffer, and their offset in the buffer.  The
+    // buffer is bound to its target, and is recreated when |size| does not fit in it.  The data
+    // must be written before the draw that uses it is issued.
+    angle::Result allocate(const gl::Context *context,
+                           size_t size,
+                           size_t alignment,
+                           uint8_t **ptrOut,
+                           size_t *offsetOut);
+
+    GLuint getBufferID() const { return mBufferID; }
+
+  private:
+    static constexpr size_t kSegmentCount = 4;
+    using SegmentMask                     = angle::BitSet8<kSegmentCount>;
+
+    angle::Result initialize(const gl::Context *context, size_t size);
+    angle::Result insertFence(const gl::Context *context, size_t segment);
+    angle::Result waitForFence(const gl::Context *context, size_t segment);
+
+    gl::BufferBinding mTarget;
+    GLuint mBufferID        = 0;
+    size_t mSize            = 0;
+    size_t mSegmentSize     = 0;
+    size_t mHead            = 0;
+    uint8_t *mMappedPointer = nullptr;
+
+    // Segments written to since their last fence.
+    SegmentMask mUnfencedSegments;
+    std::array<std::unique_ptr<SyncGL>, kSegmentCount> mSegmentFences;
+};
+}  // namespace rx
+
+#endif  // LIBANGLE_RENDERER_GL_STREAMINGBUFFERGL_H_
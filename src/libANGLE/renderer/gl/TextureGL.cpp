@@ -26,6 +26,7 @@
 #include "libANGLE/renderer/gl/ImageGL.h"
 #include "libANGLE/renderer/gl/MemoryObjectGL.h"
 #include "libANGLE/renderer/gl/StateManagerGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
 #include "libANGLE/renderer/gl/SurfaceGL.h"
 #include "libANGLE/renderer/gl/formatutilsgl.h"
 #include "libANGLE/renderer/gl/renderergl_utils.h"
@@ -41,6 +42,12 @@ namespace
 // For use with the uploadTextureDataInChunks feature.  See http://crbug.com/1181068
 constexpr const size_t kUploadTextureDataInChunksUploadSize = (120 * 1024) - 1;
 
+// Smaller uploads are cheaper to copy on the spot than to fence in the streaming buffer.
+constexpr GLuint kMinStreamedTextureUploadSize = 16 * 1024;
+
+// The buffer offset must be a multiple of the pixel type size.
+constexpr size_t kStreamedTextureUploadAlignment = 16;
+
 size_t GetLevelInfoIndex(gl::TextureTarget target, size_t level)
 {
     return gl::IsCubeMapFaceTarget(target)
@@ -143,6 +150,7 @@ TextureGL::TextureGL(const gl::TextureState &state, GLuint id)
       mAppliedSampler(state.getSamplerState()),
       mAppliedBaseLevel(state.getEffectiveBaseLevel()),
       mAppliedMaxLevel(state.getEffectiveMaxLevel()),
+      mAppliedDepthStencilTextureMode(GL_DEPTH_COMPONENT),
       mTextureID(id)
 {
     mLevelInfo.resize(GetMaxLevelInfoCountForTextureType(getType()));
@@ -372,6 +380,37 @@ angle::Result TextureGL::setSubImage(const gl::Context *context,
                                              pixels);
     }
 
+    // Copy client data into the streaming buffer and upload from there.  The unpack state applies
+    // to the buffer the same way it applies to client memory.
+    const uint8_t *uploadPixels = pixels;
+    bool streamed               = false;
+    if (features.streamTextureUploadsThroughPixelUnpackBuffer.enabled &&
+        features.usePersistentMappedStreamingBuffers.enabled && unpackBuffer == nullptr &&
+        pixels != nullptr)
+    {
+        const gl::InternalFormat &glFormat = gl::GetInternalFormatInfo(format, type);
+        GLuint endByte                     = 0;
+        ANGLE_CHECK_GL_MATH(GetImplAs<ContextGL>(context),
+                            glFormat.computePackUnpackEndByte(
+                                type, gl::Extents(area.width, area.height, area.depth), unpack,
+                                nativegl::UseTexImage3D(getType()), &endByte));
+
+        if (endByte >= kMinStreamedTextureUploadSize)
+        {
+            StreamingBufferGL *streamingBuffer =
+                GetImplAs<ContextGL>(context)->getPixelUnpackStreamingBuffer();
+
+            uint8_t *bufferPointer = nullptr;
+            size_t bufferOffset    = 0;
+            ANGLE_TRY(streamingBuffer->allocate(context, endByte, kStreamedTextureUploadAlignment,
+                                                &bufferPointer, &bufferOffset));
+            memcpy(bufferPointer, pixels, endByte);
+
+            uploadPixels = reinterpret_cast<const uint8_t *>(bufferOffset);
+            streamed     = true;
+        }
+    }
+
     if (nativegl::UseTexImage2D(getType()))
     {
         ASSERT(area.z == 0 && area.depth == 1);
@@ -379,7 +418,7 @@ angle::Result TextureGL::setSubImage(const gl::Context *context,
                      functions->texSubImage2D(nativegl::GetTextureBindingTarget(target),
                                               static_cast<GLint>(level), area.x, area.y, area.width,
                                               area.height, texSubImageFormat.format,
-                                              texSubImageFormat.type, pixels));
+                                              texSubImageFormat.type, uploadPixels));
     }
     else
     {
@@ -387,7 +426,13 @@ angle::Result TextureGL::setSubImage(const gl::Context *context,
         ANGLE_GL_TRY(context, functions->texSubImage3D(
                                   ToGLenum(target), static_cast<GLint>(level), area.x, area.y,
                                   area.z, area.width, area.height, area.depth,
-                                  texSubImageFormat.format, texSubImageFormat.type, pixels));
+                                  texSubImageFormat.format, texSubImageFormat.type, uploadPixels));
+    }
+
+    if (streamed)
+    {
+        // Restore the application's unpack buffer binding, which is known to be empty.
+        ANGLE_TRY(stateManager->setPixelUnpackBuffer(context, nullptr));
     }
 
     return angle::Result::Continue;
@@ -982,6 +1027,30 @@ angle::Result TextureGL::copySubTextureHelper(const gl::Context *context,
     GLenum sourceComponentType = sourceFormatInfo.componentType;
     GLenum destComponentType   = destFormat.componentType;
     bool destSRGB              = destFormat.colorEncoding == GL_SRGB;
+
+    // Without any conversion, the copy is a raw copy between images of the same native format.
+    // This is the cheapest path, as it needs neither a framebuffer nor a draw.
+    const LevelInfoGL &destLevelInfo = getLevelInfo(target, level);
+    if (!unpackFlipY && unpackPremultiplyAlpha == unpackUnmultiplyAlpha && !needsLumaWorkaround &&
+        !destLevelInfo.lumaWorkaround.enabled && !sourceLevelInfo.emulatedAlphaChannel &&
+        !destLevelInfo.emulatedAlphaChannel &&
+        sourceFormatInfo.sizedInternalFormat == destFormat.sizedInternalFormat &&
+        sourceLevelInfo.nativeInternalFormat == destLevelInfo.nativeInternalFormat &&
+        (sourceGL->getType() == gl::TextureType::_2D ||
+         sourceGL->getType() == gl::TextureType::Rectangle))
+    {
+        bool copySucceeded = false;
+        ANGLE_TRY(blitter->copyImageSubData(
+            context, sourceGL->getTextureID(),
+            gl::ImageIndex::MakeFromType(sourceGL->getType(), sourceLevel), mTextureID,
+            gl::ImageIndex::MakeFromTarget(target, static_cast<GLint>(level), 1), sourceArea,
+            destOffset, &copySucceeded));
+        if (copySucceeded)
+        {
+            return angle::Result::Continue;
+        }
+    }
+
     if (!unpackFlipY && unpackPremultiplyAlpha == unpackUnmultiplyAlpha && !needsLumaWorkaround &&
         sourceFormatContainSupersetOfDestFormat && sourceComponentType == destComponentType &&
         !destSRGB && sourceGL->getType() == gl::TextureType::_2D)
@@ -996,7 +1065,6 @@ angle::Result TextureGL::copySubTextureHelper(const gl::Context *context,
     }
 
     // Check if the destination is renderable and copy on the GPU
-    const LevelInfoGL &destLevelInfo = getLevelInfo(target, level);
     // todo(jonahr): http://crbug.com/773861
     // Behavior for now is to fallback to CPU readback implementation if the destination texture
     // is a luminance format. The correct solution is to handle both source and destination in the
@@ -1467,6 +1535,9 @@ angle::Result TextureGL::syncState(const gl::Context *context,
 
     stateManager->bindTexture(getType(), mTextureID);
 
+    const GLenum target                  = nativegl::GetTextureBindingTarget(getType());
+    const gl::SamplerState &samplerState = mState.getSamplerState();
+
     gl::Texture::DirtyBits syncDirtyBits = dirtyBits | mLocalDirtyBits;
     if (dirtyBits[gl::Texture::DIRTY_BIT_BASE_LEVEL] || dirtyBits[gl::Texture::DIRTY_BIT_MAX_LEVEL])
     {
@@ -1480,98 +1551,129 @@ angle::Result TextureGL::syncState(const gl::Context *context,
         switch (dirtyBit)
         {
             case gl::Texture::DIRTY_BIT_MIN_FILTER:
-                mAppliedSampler.setMinFilter(mState.getSamplerState().getMinFilter());
-                ANGLE_GL_TRY(context, functions->texParameteri(
-                                          nativegl::GetTextureBindingTarget(getType()),
-                                          GL_TEXTURE_MIN_FILTER, mAppliedSampler.getMinFilter()));
+                if (stateManager->countStateCall(
+                        &StateCallCounters::texParameter,
+                        mAppliedSampler.setMinFilter(samplerState.getMinFilter())))
+                {
+                    ANGLE_GL_TRY(context, functions->texParameteri(target, GL_TEXTURE_MIN_FILTER,
+                                                                   mAppliedSampler.getMinFilter()));
+                }
                 break;
             case gl::Texture::DIRTY_BIT_MAG_FILTER:
-                mAppliedSampler.setMagFilter(mState.getSamplerState().getMagFilter());
-                ANGLE_GL_TRY(context, functions->texParameteri(
-                                          nativegl::GetTextureBindingTarget(getType()),
-                                          GL_TEXTURE_MAG_FILTER, mAppliedSampler.getMagFilter()));
+                if (stateManager->countStateCall(
+                        &StateCallCounters::texParameter,
+                        mAppliedSampler.setMagFilter(samplerState.getMagFilter())))
+                {
+                    ANGLE_GL_TRY(context, functions->texParameteri(target, GL_TEXTURE_MAG_FILTER,
+                                                                   mAppliedSampler.getMagFilter()));
+                }
                 break;
             case gl::Texture::DIRTY_BIT_WRAP_S:
-                mAppliedSampler.setWrapS(mState.getSamplerState().getWrapS());
-                ANGLE_GL_TRY(context, functions->texParameteri(
-                                          nativegl::GetTextureBindingTarget(getType()),
-                                          GL_TEXTURE_WRAP_S, mAppliedSampler.getWrapS()));
+                if (stateManager->countStateCall(&StateCallCounters::texParameter,
+                                                 mAppliedSampler.setWrapS(samplerState.getWrapS())))
+                {
+                    ANGLE_GL_TRY(context, functions->texParameteri(target, GL_TEXTURE_WRAP_S,
+                                                                   mAppliedSampler.getWrapS()));
+                }
                 break;
             case gl::Texture::DIRTY_BIT_WRAP_T:
-                mAppliedSampler.setWrapT(mState.getSamplerState().getWrapT());
-                ANGLE_GL_TRY(context, functions->texParameteri(
-                                          nativegl::GetTextureBindingTarget(getType()),
-                                          GL_TEXTURE_WRAP_T, mAppliedSampler.getWrapT()));
+                if (stateManager->countStateCall(&StateCallCounters::texParameter,
+                                                 mAppliedSampler.setWrapT(samplerState.getWrapT())))
+                {
+                    ANGLE_GL_TRY(context, functions->texParameteri(target, GL_TEXTURE_WRAP_T,
+                                                                   mAppliedSampler.getWrapT()));
+                }
                 break;
             case gl::Texture::DIRTY_BIT_WRAP_R:
-                mAppliedSampler.setWrapR(mState.getSamplerState().getWrapR());
-                ANGLE_GL_TRY(context, functions->texParameteri(
-                                          nativegl::GetTextureBindingTarget(getType()),
-                                          GL_TEXTURE_WRAP_R, mAppliedSampler.getWrapR()));
+                if (stateManager->countStateCall(&StateCallCounters::texParameter,
+                                                 mAppliedSampler.setWrapR(samplerState.getWrapR())))
+                {
+                    ANGLE_GL_TRY(context, functions->texParameteri(target, GL_TEXTURE_WRAP_R,
+                                                                   mAppliedSampler.getWrapR()));
+                }
                 break;
             case gl::Texture::DIRTY_BIT_MAX_ANISOTROPY:
-                mAppliedSampler.setMaxAnisotropy(mState.getSamplerState().getMaxAnisotropy());
-                ANGLE_GL_TRY(context,
-                             functions->texParameterf(nativegl::GetTextureBindingTarget(getType()),
-                                                      GL_TEXTURE_MAX_ANISOTROPY_EXT,
-                                                      mAppliedSampler.getMaxAnisotropy()));
+                if (stateManager->countStateCall(
+                        &StateCallCounters::texParameter,
+                        mAppliedSampler.setMaxAnisotropy(samplerState.getMaxAnisotropy())))
+                {
+                    ANGLE_GL_TRY(context,
+                                 functions->texParameterf(target, GL_TEXTURE_MAX_ANISOTROPY_EXT,
+                                                          mAppliedSampler.getMaxAnisotropy()));
+                }
                 break;
             case gl::Texture::DIRTY_BIT_MIN_LOD:
-                mAppliedSampler.setMinLod(mState.getSamplerState().getMinLod());
-                ANGLE_GL_TRY(context, functions->texParameterf(
-                                          nativegl::GetTextureBindingTarget(getType()),
-                                          GL_TEXTURE_MIN_LOD, mAppliedSampler.getMinLod()));
+                if (stateManager->countStateCall(
+                        &StateCallCounters::texParameter,
+                        mAppliedSampler.setMinLod(samplerState.getMinLod())))
+                {
+                    ANGLE_GL_TRY(context, functions->texParameterf(target, GL_TEXTURE_MIN_LOD,
+                                                                   mAppliedSampler.getMinLod()));
+                }
                 break;
             case gl::Texture::DIRTY_BIT_MAX_LOD:
-                mAppliedSampler.setMaxLod(mState.getSamplerState().getMaxLod());
-                ANGLE_GL_TRY(context, functions->texParameterf(
-                                          nativegl::GetTextureBindingTarget(getType()),
-                                          GL_TEXTURE_MAX_LOD, mAppliedSampler.getMaxLod()));
+                if (stateManager->countStateCall(
+                        &StateCallCounters::texParameter,
+                        mAppliedSampler.setMaxLod(samplerState.getMaxLod())))
+                {
+                    ANGLE_GL_TRY(context, functions->texParameterf(target, GL_TEXTURE_MAX_LOD,
+                                                                   mAppliedSampler.getMaxLod()));
+                }
                 break;
             case gl::Texture::DIRTY_BIT_COMPARE_MODE:
-                mAppliedSampler.setCompareMode(mState.getSamplerState().getCompareMode());
-                ANGLE_GL_TRY(context,
-                             functions->texParameteri(nativegl::GetTextureBindingTarget(getType()),
-                                                      GL_TEXTURE_COMPARE_MODE,
-                                                      mAppliedSampler.getCompareMode()));
+                if (stateManager->countStateCall(
+                        &StateCallCounters::texParameter,
+                        mAppliedSampler.setCompareMode(samplerState.getCompareMode())))
+                {
+                    ANGLE_GL_TRY(context,
+                                 functions->texParameteri(target, GL_TEXTURE_COMPARE_MODE,
+                                                          mAppliedSampler.getCompareMode()));
+                }
                 break;
             case gl::Texture::DIRTY_BIT_COMPARE_FUNC:
-                mAppliedSampler.setCompareFunc(mState.getSamplerState().getCompareFunc());
-                ANGLE_GL_TRY(context,
-                             functions->texParameteri(nativegl::GetTextureBindingTarget(getType()),
-                                                      GL_TEXTURE_COMPARE_FUNC,
-                                                      mAppliedSampler.getCompareFunc()));
+                if (stateManager->countStateCall(
+                        &StateCallCounters::texParameter,
+                        mAppliedSampler.setCompareFunc(samplerState.getCompareFunc())))
+                {
+                    ANGLE_GL_TRY(context,
+                                 functions->texParameteri(target, GL_TEXTURE_COMPARE_FUNC,
+                                                          mAppliedSampler.getCompareFunc()));
+                }
                 break;
             case gl::Texture::DIRTY_BIT_SRGB_DECODE:
-                mAppliedSampler.setSRGBDecode(mState.getSamplerState().getSRGBDecode());
-                ANGLE_GL_TRY(context,
-                             functions->texParameteri(nativegl::GetTextureBindingTarget(getType()),
-                                                      GL_TEXTURE_SRGB_DECODE_EXT,
-                                                      mAppliedSampler.getSRGBDecode()));
+                if (stateManager->countStateCall(
+                        &StateCallCounters::texParameter,
+                        mAppliedSampler.setSRGBDecode(samplerState.getSRGBDecode())))
+                {
+                    ANGLE_GL_TRY(context,
+                                 functions->texParameteri(target, GL_TEXTURE_SRGB_DECODE_EXT,
+                                                          mAppliedSampler.getSRGBDecode()));
+                }
                 break;
             case gl::Texture::DIRTY_BIT_BORDER_COLOR:
             {
-                const angle::ColorGeneric &borderColor(mState.getSamplerState().getBorderColor());
-                mAppliedSampler.setBorderColor(borderColor);
+                const angle::ColorGeneric &borderColor(samplerState.getBorderColor());
+                if (!stateManager->countStateCall(&StateCallCounters::texParameter,
+                                                  mAppliedSampler.setBorderColor(borderColor)))
+                {
+                    break;
+                }
                 switch (borderColor.type)
                 {
                     case angle::ColorGeneric::Type::Float:
                         ANGLE_GL_TRY(context,
-                                     functions->texParameterfv(
-                                         nativegl::GetTextureBindingTarget(getType()),
-                                         GL_TEXTURE_BORDER_COLOR, &borderColor.colorF.red));
+                                     functions->texParameterfv(target, GL_TEXTURE_BORDER_COLOR,
+                                                               &borderColor.colorF.red));
                         break;
                     case angle::ColorGeneric::Type::Int:
                         ANGLE_GL_TRY(context,
-                                     functions->texParameterIiv(
-                                         nativegl::GetTextureBindingTarget(getType()),
-                                         GL_TEXTURE_BORDER_COLOR, &borderColor.colorI.red));
+                                     functions->texParameterIiv(target, GL_TEXTURE_BORDER_COLOR,
+                                                                &borderColor.colorI.red));
                         break;
                     case angle::ColorGeneric::Type::UInt:
                         ANGLE_GL_TRY(context,
-                                     functions->texParameterIuiv(
-                                         nativegl::GetTextureBindingTarget(getType()),
-                                         GL_TEXTURE_BORDER_COLOR, &borderColor.colorUI.red));
+                                     functions->texParameterIuiv(target, GL_TEXTURE_BORDER_COLOR,
+                                                                 &borderColor.colorUI.red));
                         break;
                     default:
                         UNREACHABLE();
@@ -1602,25 +1704,35 @@ angle::Result TextureGL::syncState(const gl::Context *context,
                                                   &mAppliedSwizzle.swizzleAlpha));
                 break;
             case gl::Texture::DIRTY_BIT_BASE_LEVEL:
-                mAppliedBaseLevel = mState.getEffectiveBaseLevel();
-                ANGLE_GL_TRY(context,
-                             functions->texParameteri(nativegl::GetTextureBindingTarget(getType()),
-                                                      GL_TEXTURE_BASE_LEVEL, mAppliedBaseLevel));
+                if (stateManager->countStateCall(
+                        &StateCallCounters::texParameter,
+                        mAppliedBaseLevel != mState.getEffectiveBaseLevel()))
+                {
+                    mAppliedBaseLevel = mState.getEffectiveBaseLevel();
+                    ANGLE_GL_TRY(context, functions->texParameteri(target, GL_TEXTURE_BASE_LEVEL,
+                                                                   mAppliedBaseLevel));
+                }
                 break;
             case gl::Texture::DIRTY_BIT_MAX_LEVEL:
-                mAppliedMaxLevel = mState.getEffectiveMaxLevel();
-                ANGLE_GL_TRY(context,
-                             functions->texParameteri(nativegl::GetTextureBindingTarget(getType()),
-                                                      GL_TEXTURE_MAX_LEVEL, mAppliedMaxLevel));
+                if (stateManager->countStateCall(&StateCallCounters::texParameter,
+                                                 mAppliedMaxLevel != mState.getEffectiveMaxLevel()))
+                {
+                    mAppliedMaxLevel = mState.getEffectiveMaxLevel();
+                    ANGLE_GL_TRY(context, functions->texParameteri(target, GL_TEXTURE_MAX_LEVEL,
+                                                                   mAppliedMaxLevel));
+                }
                 break;
             case gl::Texture::DIRTY_BIT_DEPTH_STENCIL_TEXTURE_MODE:
-            {
-                GLenum mDepthStencilTextureMode = mState.getDepthStencilTextureMode();
-                ANGLE_GL_TRY(context, functions->texParameteri(
-                                          nativegl::GetTextureBindingTarget(getType()),
-                                          GL_DEPTH_STENCIL_TEXTURE_MODE, mDepthStencilTextureMode));
+                if (stateManager->countStateCall(
+                        &StateCallCounters::texParameter,
+                        mAppliedDepthStencilTextureMode != mState.getDepthStencilTextureMode()))
+                {
+                    mAppliedDepthStencilTextureMode = mState.getDepthStencilTextureMode();
+                    ANGLE_GL_TRY(context,
+                                 functions->texParameteri(target, GL_DEPTH_STENCIL_TEXTURE_MODE,
+                                                          mAppliedDepthStencilTextureMode));
+                }
                 break;
-            }
             case gl::Texture::DIRTY_BIT_USAGE:
                 break;
 
@@ -1819,8 +1931,9 @@ angle::Result TextureGL::recreateTexture(const gl::Context *context)
     mAppliedSwizzle = gl::SwizzleState();
     mAppliedSampler = gl::SamplerState::CreateDefaultForTarget(getType());
 
-    mAppliedBaseLevel = 0;
-    mAppliedBaseLevel = gl::kInitialMaxLevel;
+    mAppliedBaseLevel               = 0;
+    mAppliedMaxLevel                = gl::kInitialMaxLevel;
+    mAppliedDepthStencilTextureMode = GL_DEPTH_COMPONENT;
 
     mLocalDirtyBits = mAllModifiedDirtyBits;
 
@@ -1944,8 +2057,12 @@ angle::Result TextureGL::syncTextureStateSwizzle(const gl::Context *context,
         }
     }
 
-    *outValue = resultSwizzle;
-    ANGLE_GL_TRY(context, functions->texParameteri(ToGLenum(getType()), name, resultSwizzle));
+    StateManagerGL *stateManager = GetStateManagerGL(context);
+    if (stateManager->countStateCall(&StateCallCounters::texParameter, *outValue != resultSwizzle))
+    {
+        *outValue = resultSwizzle;
+        ANGLE_GL_TRY(context, functions->texParameteri(ToGLenum(getType()), name, resultSwizzle));
+    }
 
     return angle::Result::Continue;
 }
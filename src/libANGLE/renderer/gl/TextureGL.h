@@ -287,6 +287,7 @@ class TextureGL : public TextureImpl
     gl::SamplerState mAppliedSampler;
     GLuint mAppliedBaseLevel;
     GLuint mAppliedMaxLevel;
+    GLenum mAppliedDepthStencilTextureMode;
 
     GLuint mTextureID;
 };
@@ -77,38 +77,50 @@ angle::Result TransformFeedbackGL::bindIndexedBuffer(
 {
     const angle::FeaturesGL &features = GetFeaturesGL(context);
 
+    IndexedBufferBinding newBinding;
+    if (binding.get() != nullptr)
+    {
+        newBinding.buffer = GetImplAs<BufferGL>(binding.get())->getBufferID();
+        newBinding.offset = binding.getOffset();
+        newBinding.size   = binding.getSize();
+    }
+
+    ASSERT(index < mAppliedBindings.size());
+    IndexedBufferBinding &appliedBinding = mAppliedBindings[index];
+    const bool isRange                   = newBinding.size != 0;
+
+    const bool changed = appliedBinding.buffer != newBinding.buffer ||
+                         appliedBinding.offset != newBinding.offset ||
+                         appliedBinding.size != newBinding.size;
+    if (!mStateManager->countStateCall(isRange ? &StateCallCounters::bindBufferRange
+                                               : &StateCallCounters::bindBufferBase,
+                                       changed))
+    {
+        return angle::Result::Continue;
+    }
+    appliedBinding = newBinding;
+
     // Directly bind buffer (not through the StateManager methods) because the buffer bindings are
     // tracked per transform feedback object
     mStateManager->bindTransformFeedback(GL_TRANSFORM_FEEDBACK, mTransformFeedbackID);
-    if (binding.get() != nullptr)
+    if (newBinding.buffer != 0 && features.bindTransformFeedbackBufferBeforeBindBufferRange.enabled)
     {
-        const BufferGL *bufferGL = GetImplAs<BufferGL>(binding.get());
-
-        if (features.bindTransformFeedbackBufferBeforeBindBufferRange.enabled)
-        {
-            // Generic binding will be overwritten by the bindRange/bindBase below.
-            ANGLE_GL_TRY(context, mFunctions->bindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER,
-                                                         bufferGL->getBufferID()));
-        }
+        // Generic binding will be overwritten by the bindRange/bindBase below.
+        ANGLE_GL_TRY(context,
+                     mFunctions->bindBuffer(GL_TRANSFORM_FEEDBACK_BUFFER, newBinding.buffer));
+    }
 
-        if (binding.getSize() != 0)
-        {
-            ANGLE_GL_TRY(context,
-                         mFunctions->bindBufferRange(
-                             GL_TRANSFORM_FEEDBACK_BUFFER, static_cast<GLuint>(index),
-                             bufferGL->getBufferID(), binding.getOffset(), binding.getSize()));
-        }
-        else
-        {
-            ANGLE_GL_TRY(context, mFunctions->bindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER,
-                                                             static_cast<GLuint>(index),
-                                                             bufferGL->getBufferID()));
-        }
+    if (isRange)
+    {
+        ANGLE_GL_TRY(context, mFunctions->bindBufferRange(
+                                  GL_TRANSFORM_FEEDBACK_BUFFER, static_cast<GLuint>(index),
+                                  newBinding.buffer, newBinding.offset, newBinding.size));
     }
     else
     {
         ANGLE_GL_TRY(context, mFunctions->bindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER,
-                                                         static_cast<GLuint>(index), 0));
+                                                         static_cast<GLuint>(index),
+                                                         newBinding.buffer));
     }
     return angle::Result::Continue;
 }
@@ -47,6 +47,17 @@ class TransformFeedbackGL : public TransformFeedbackImpl
 
     GLuint mTransformFeedbackID;
 
+    // The buffer bindings of the native transform feedback object.  A size of 0 is a whole buffer
+    // binding.
+    struct IndexedBufferBinding
+    {
+        GLuint buffer   = 0;
+        GLintptr offset = 0;
+        GLsizeiptr size = 0;
+    };
+    std::array<IndexedBufferBinding, gl::IMPLEMENTATION_MAX_TRANSFORM_FEEDBACK_BUFFERS>
+        mAppliedBindings;
+
     mutable bool mIsActive;
     mutable bool mIsPaused;
     mutable GLuint mActiveProgram;
@@ -108,7 +108,9 @@ VertexArrayGL::VertexArrayGL(const VertexArrayState &state, GLuint id)
     : VertexArrayImpl(state),
       mVertexArrayID(id),
       mOwnsNativeState(true),
-      mNativeState(new VertexArrayStateGL(state.getMaxAttribs(), state.getMaxBindings()))
+      mNativeState(new VertexArrayStateGL(state.getMaxAttribs(), state.getMaxBindings())),
+      mStreamingElementArrayRingBuffer(gl::BufferBinding::ElementArray),
+      mStreamingArrayRingBuffer(gl::BufferBinding::Array)
 {
     mForcedStreamingAttributesFirstOffsets.fill(0);
 }
@@ -116,7 +118,12 @@ VertexArrayGL::VertexArrayGL(const VertexArrayState &state, GLuint id)
 VertexArrayGL::VertexArrayGL(const gl::VertexArrayState &state,
                              GLuint id,
                              VertexArrayStateGL *sharedState)
-    : VertexArrayImpl(state), mVertexArrayID(id), mOwnsNativeState(false), mNativeState(sharedState)
+    : VertexArrayImpl(state),
+      mVertexArrayID(id),
+      mOwnsNativeState(false),
+      mNativeState(sharedState),
+      mStreamingElementArrayRingBuffer(gl::BufferBinding::ElementArray),
+      mStreamingArrayRingBuffer(gl::BufferBinding::Array)
 {
     ASSERT(mNativeState);
     mForcedStreamingAttributesFirstOffsets.fill(0);
@@ -149,6 +156,9 @@ void VertexArrayGL::destroy(const gl::Context *context)
     mStreamingArrayBufferSize = 0;
     mStreamingArrayBuffer     = 0;
 
+    mStreamingElementArrayRingBuffer.destroy(context);
+    mStreamingArrayRingBuffer.destroy(context);
+
     if (mOwnsNativeState)
     {
         delete mNativeState;
@@ -301,6 +311,28 @@ angle::Result VertexArrayGL::syncIndexData(const gl::Context *context,
             *outIndexRange = ComputeIndexRange(type, indices, count, primitiveRestartEnabled);
         }
 
+        const GLuint indexTypeBytes        = gl::GetDrawElementsTypeSize(type);
+        size_t requiredStreamingBufferSize = indexTypeBytes * count;
+
+        if (GetFeaturesGL(context).usePersistentMappedStreamingBuffers.enabled)
+        {
+            stateManager->bindVertexArray(mVertexArrayID, mNativeState);
+            mElementArrayBuffer.set(context, nullptr);
+
+            uint8_t *bufferPointer = nullptr;
+            size_t bufferOffset    = 0;
+            ANGLE_TRY(mStreamingElementArrayRingBuffer.allocate(
+                context, requiredStreamingBufferSize, indexTypeBytes, &bufferPointer,
+                &bufferOffset));
+            mNativeState->elementArrayBuffer = mStreamingElementArrayRingBuffer.getBufferID();
+
+            memcpy(bufferPointer, indices, requiredStreamingBufferSize);
+
+            // The index offset for the draw call is the offset of the copied indices
+            *outIndices = reinterpret_cast<const void *>(bufferOffset);
+            return angle::Result::Continue;
+        }
+
         // Allocate the streaming element array buffer
         if (mStreamingElementArrayBuffer == 0)
         {
@@ -315,8 +347,6 @@ angle::Result VertexArrayGL::syncIndexData(const gl::Context *context,
         mNativeState->elementArrayBuffer = mStreamingElementArrayBuffer;
 
         // Make sure the element array buffer is large enough
-        const GLuint indexTypeBytes        = gl::GetDrawElementsTypeSize(type);
-        size_t requiredStreamingBufferSize = indexTypeBytes * count;
         if (requiredStreamingBufferSize > mStreamingElementArrayBufferSize)
         {
             // Copy the indices in while resizing the buffer
@@ -393,18 +423,36 @@ angle::Result VertexArrayGL::streamAttributes(
         return angle::Result::Continue;
     }
 
-    if (mStreamingArrayBuffer == 0)
-    {
-        ANGLE_GL_TRY(context, functions->genBuffers(1, &mStreamingArrayBuffer));
-        mStreamingArrayBufferSize = 0;
-    }
-
     // If first is greater than zero, a slack space needs to be left at the beginning of the buffer
     // for each attribute so that the same 'first' argument can be passed into the draw call.
     const size_t bufferEmptySpace =
         attribsToStream.count() * maxAttributeDataSize * indexRange.start;
     const size_t requiredBufferSize = streamingDataSize + bufferEmptySpace;
 
+    if (GetFeaturesGL(context).usePersistentMappedStreamingBuffers.enabled)
+    {
+        stateManager->bindVertexArray(mVertexArrayID, mNativeState);
+
+        uint8_t *bufferPointer = nullptr;
+        size_t bufferOffset    = 0;
+        ANGLE_TRY(mStreamingArrayRingBuffer.allocate(context, requiredBufferSize,
+                                                     maxAttributeDataSize, &bufferPointer,
+                                                     &bufferOffset));
+
+        // The buffer is coherently mapped, so the data is visible to the draw without unmapping it.
+        return writeStreamingAttributes(context, attribsToStream, instanceCount, indexRange,
+                                        applyExtraOffsetWorkaroundForInstancedAttributes,
+                                        maxAttributeDataSize,
+                                        mStreamingArrayRingBuffer.getBufferID(), bufferPointer,
+                                        bufferOffset);
+    }
+
+    if (mStreamingArrayBuffer == 0)
+    {
+        ANGLE_GL_TRY(context, functions->genBuffers(1, &mStreamingArrayBuffer));
+        mStreamingArrayBufferSize = 0;
+    }
+
     stateManager->bindBuffer(gl::BufferBinding::Array, mStreamingArrayBuffer);
     if (requiredBufferSize > mStreamingArrayBufferSize)
     {
@@ -424,135 +472,157 @@ angle::Result VertexArrayGL::streamAttributes(
     {
         uint8_t *bufferPointer = MapBufferRangeWithFallback(functions, GL_ARRAY_BUFFER, 0,
                                                             requiredBufferSize, GL_MAP_WRITE_BIT);
-        size_t curBufferOffset = maxAttributeDataSize * indexRange.start;
+        ANGLE_TRY(writeStreamingAttributes(context, attribsToStream, instanceCount, indexRange,
+                                           applyExtraOffsetWorkaroundForInstancedAttributes,
+                                           maxAttributeDataSize, mStreamingArrayBuffer,
+                                           bufferPointer, 0));
 
-        const auto &attribs  = mState.getVertexAttributes();
-        const auto &bindings = mState.getVertexBindings();
+        unmapResult = ANGLE_GL_TRY(context, functions->unmapBuffer(GL_ARRAY_BUFFER));
+    }
 
-        for (auto idx : attribsToStream)
-        {
-            const auto &attrib = attribs[idx];
-            ASSERT(IsVertexAttribPointerSupported(idx, attrib));
-
-            const auto &binding = bindings[attrib.bindingIndex];
-
-            GLuint adjustedDivisor = GetAdjustedDivisor(mAppliedNumViews, binding.getDivisor());
-            // streamedVertexCount is only going to be modified by
-            // shiftInstancedArrayDataWithOffset workaround, otherwise it's const
-            size_t streamedVertexCount = ComputeVertexBindingElementCount(
-                adjustedDivisor, indexRange.vertexCount(), instanceCount);
-
-            const size_t sourceStride = ComputeVertexAttributeStride(attrib, binding);
-            const size_t destStride   = ComputeVertexAttributeTypeSize(attrib);
-
-            // Vertices do not apply the 'start' offset when the divisor is non-zero even when doing
-            // a non-instanced draw call
-            const size_t firstIndex =
-                (adjustedDivisor == 0 || applyExtraOffsetWorkaroundForInstancedAttributes)
-                    ? indexRange.start
-                    : 0;
-
-            // Attributes using client memory ignore the VERTEX_ATTRIB_BINDING state.
-            // https://www.opengl.org/registry/specs/ARB/vertex_attrib_binding.txt
-            const uint8_t *inputPointer = static_cast<const uint8_t *>(attrib.pointer);
-            // store batchMemcpySize since streamedVertexCount could be changed by workaround
-            const size_t batchMemcpySize = destStride * streamedVertexCount;
-
-            size_t batchMemcpyInputOffset                    = sourceStride * firstIndex;
-            bool needsUnmapAndRebindStreamingAttributeBuffer = false;
-            size_t firstIndexForSeparateCopy                 = firstIndex;
-
-            if (applyExtraOffsetWorkaroundForInstancedAttributes && adjustedDivisor > 0)
-            {
-                const size_t originalStreamedVertexCount = streamedVertexCount;
-                streamedVertexCount =
-                    (instanceCount + indexRange.start + adjustedDivisor - 1u) / adjustedDivisor;
+    ANGLE_CHECK(GetImplAs<ContextGL>(context), unmapResult == GL_TRUE,
+                "Failed to unmap the client data streaming buffer.", GL_OUT_OF_MEMORY);
+    return angle::Result::Continue;
+}
 
-                const size_t copySize =
-                    sourceStride *
-                    originalStreamedVertexCount;  // the real data in the buffer we are streaming
+angle::Result VertexArrayGL::writeStreamingAttributes(
+    const gl::Context *context,
+    const gl::AttributesMask &attribsToStream,
+    GLsizei instanceCount,
+    const gl::IndexRange &indexRange,
+    bool applyExtraOffsetWorkaroundForInstancedAttributes,
+    size_t maxAttributeDataSize,
+    GLuint streamingBuffer,
+    uint8_t *bufferPointer,
+    size_t bufferOffset) const
+{
+    const FunctionsGL *functions = GetFunctionsGL(context);
+    StateManagerGL *stateManager = GetStateManagerGL(context);
 
-                const gl::Buffer *bindingBufferPointer = binding.getBuffer().get();
-                if (!bindingBufferPointer)
-                {
-                    if (!inputPointer)
-                    {
-                        continue;
-                    }
-                    inputPointer = static_cast<const uint8_t *>(attrib.pointer);
-                }
-                else
-                {
-                    needsUnmapAndRebindStreamingAttributeBuffer = true;
-                    const auto buffer = GetImplAs<BufferGL>(bindingBufferPointer);
-                    stateManager->bindBuffer(gl::BufferBinding::Array, buffer->getBufferID());
-                    // The workaround is only for latest Mac Intel so glMapBufferRange should be
-                    // supported
-                    ASSERT(CanMapBufferForRead(functions));
-                    uint8_t *inputBufferPointer = MapBufferRangeWithFallback(
-                        functions, GL_ARRAY_BUFFER, binding.getOffset(), copySize, GL_MAP_READ_BIT);
-                    ASSERT(inputBufferPointer);
-                    inputPointer = inputBufferPointer;
-                }
+    size_t curBufferOffset = maxAttributeDataSize * indexRange.start;
 
-                batchMemcpyInputOffset    = 0;
-                firstIndexForSeparateCopy = 0;
-            }
+    const auto &attribs  = mState.getVertexAttributes();
+    const auto &bindings = mState.getVertexBindings();
+
+    for (auto idx : attribsToStream)
+    {
+        const auto &attrib = attribs[idx];
+        ASSERT(IsVertexAttribPointerSupported(idx, attrib));
+
+        const auto &binding = bindings[attrib.bindingIndex];
+
+        GLuint adjustedDivisor = GetAdjustedDivisor(mAppliedNumViews, binding.getDivisor());
+        // streamedVertexCount is only going to be modified by
+        // shiftInstancedArrayDataWithOffset workaround, otherwise it's const
+        size_t streamedVertexCount = ComputeVertexBindingElementCount(
+            adjustedDivisor, indexRange.vertexCount(), instanceCount);
+
+        const size_t sourceStride = ComputeVertexAttributeStride(attrib, binding);
+        const size_t destStride   = ComputeVertexAttributeTypeSize(attrib);
+
+        // Vertices do not apply the 'start' offset when the divisor is non-zero even when doing
+        // a non-instanced draw call
+        const size_t firstIndex =
+            (adjustedDivisor == 0 || applyExtraOffsetWorkaroundForInstancedAttributes)
+                ? indexRange.start
+                : 0;
+
+        // Attributes using client memory ignore the VERTEX_ATTRIB_BINDING state.
+        // https://www.opengl.org/registry/specs/ARB/vertex_attrib_binding.txt
+        const uint8_t *inputPointer = static_cast<const uint8_t *>(attrib.pointer);
+        // store batchMemcpySize since streamedVertexCount could be changed by workaround
+        const size_t batchMemcpySize = destStride * streamedVertexCount;
+
+        size_t batchMemcpyInputOffset                    = sourceStride * firstIndex;
+        bool needsUnmapAndRebindStreamingAttributeBuffer = false;
+        size_t firstIndexForSeparateCopy                 = firstIndex;
+
+        if (applyExtraOffsetWorkaroundForInstancedAttributes && adjustedDivisor > 0)
+        {
+            const size_t originalStreamedVertexCount = streamedVertexCount;
+            streamedVertexCount =
+                (instanceCount + indexRange.start + adjustedDivisor - 1u) / adjustedDivisor;
 
-            // Pack the data when copying it, user could have supplied a very large stride that
-            // would cause the buffer to be much larger than needed.
-            if (destStride == sourceStride)
+            const size_t copySize =
+                sourceStride *
+                originalStreamedVertexCount;  // the real data in the buffer we are streaming
+
+            const gl::Buffer *bindingBufferPointer = binding.getBuffer().get();
+            if (!bindingBufferPointer)
             {
-                // Can copy in one go, the data is packed
-                memcpy(bufferPointer + curBufferOffset, inputPointer + batchMemcpyInputOffset,
-                       batchMemcpySize);
+                if (!inputPointer)
+                {
+                    continue;
+                }
+                inputPointer = static_cast<const uint8_t *>(attrib.pointer);
             }
             else
             {
-                for (size_t vertexIdx = 0; vertexIdx < streamedVertexCount; vertexIdx++)
-                {
-                    uint8_t *out = bufferPointer + curBufferOffset + (destStride * vertexIdx);
-                    const uint8_t *in =
-                        inputPointer + sourceStride * (vertexIdx + firstIndexForSeparateCopy);
-                    memcpy(out, in, destStride);
-                }
+                needsUnmapAndRebindStreamingAttributeBuffer = true;
+                const auto buffer = GetImplAs<BufferGL>(bindingBufferPointer);
+                stateManager->bindBuffer(gl::BufferBinding::Array, buffer->getBufferID());
+                // The workaround is only for latest Mac Intel so glMapBufferRange should be
+                // supported
+                ASSERT(CanMapBufferForRead(functions));
+                uint8_t *inputBufferPointer = MapBufferRangeWithFallback(
+                    functions, GL_ARRAY_BUFFER, binding.getOffset(), copySize, GL_MAP_READ_BIT);
+                ASSERT(inputBufferPointer);
+                inputPointer = inputBufferPointer;
             }
 
-            if (needsUnmapAndRebindStreamingAttributeBuffer)
+            batchMemcpyInputOffset    = 0;
+            firstIndexForSeparateCopy = 0;
+        }
+
+        // Pack the data when copying it, user could have supplied a very large stride that
+        // would cause the buffer to be much larger than needed.
+        if (destStride == sourceStride)
+        {
+            // Can copy in one go, the data is packed
+            memcpy(bufferPointer + curBufferOffset, inputPointer + batchMemcpyInputOffset,
+                   batchMemcpySize);
+        }
+        else
+        {
+            for (size_t vertexIdx = 0; vertexIdx < streamedVertexCount; vertexIdx++)
             {
-                ANGLE_GL_TRY(context, functions->unmapBuffer(GL_ARRAY_BUFFER));
-                stateManager->bindBuffer(gl::BufferBinding::Array, mStreamingArrayBuffer);
+                uint8_t *out = bufferPointer + curBufferOffset + (destStride * vertexIdx);
+                const uint8_t *in =
+                    inputPointer + sourceStride * (vertexIdx + firstIndexForSeparateCopy);
+                memcpy(out, in, destStride);
             }
+        }
 
-            // Compute where the 0-index vertex would be.
-            const size_t vertexStartOffset = curBufferOffset - (firstIndex * destStride);
+        if (needsUnmapAndRebindStreamingAttributeBuffer)
+        {
+            ANGLE_GL_TRY(context, functions->unmapBuffer(GL_ARRAY_BUFFER));
+            stateManager->bindBuffer(gl::BufferBinding::Array, streamingBuffer);
+        }
 
-            ANGLE_TRY(callVertexAttribPointer(context, static_cast<GLuint>(idx), attrib,
-                                              static_cast<GLsizei>(destStride),
-                                              static_cast<GLintptr>(vertexStartOffset)));
+        // Compute where the 0-index vertex would be.
+        const size_t vertexStartOffset = bufferOffset + curBufferOffset - (firstIndex * destStride);
 
-            // Update the state to track the streamed attribute
-            mNativeState->attributes[idx].format = attrib.format;
+        ANGLE_TRY(callVertexAttribPointer(context, static_cast<GLuint>(idx), attrib,
+                                          static_cast<GLsizei>(destStride),
+                                          static_cast<GLintptr>(vertexStartOffset)));
 
-            mNativeState->attributes[idx].relativeOffset = 0;
-            mNativeState->attributes[idx].bindingIndex   = static_cast<GLuint>(idx);
+        // Update the state to track the streamed attribute
+        mNativeState->attributes[idx].format = attrib.format;
 
-            mNativeState->bindings[idx].stride = static_cast<GLsizei>(destStride);
-            mNativeState->bindings[idx].offset = static_cast<GLintptr>(vertexStartOffset);
-            mArrayBuffers[idx].set(context, nullptr);
-            mNativeState->bindings[idx].buffer = mStreamingArrayBuffer;
+        mNativeState->attributes[idx].relativeOffset = 0;
+        mNativeState->attributes[idx].bindingIndex   = static_cast<GLuint>(idx);
 
-            // There's maxAttributeDataSize * indexRange.start of empty space allocated for each
-            // streaming attributes
-            curBufferOffset +=
-                destStride * streamedVertexCount + maxAttributeDataSize * indexRange.start;
-        }
+        mNativeState->bindings[idx].stride = static_cast<GLsizei>(destStride);
+        mNativeState->bindings[idx].offset = static_cast<GLintptr>(vertexStartOffset);
+        mArrayBuffers[idx].set(context, nullptr);
+        mNativeState->bindings[idx].buffer = streamingBuffer;
 
-        unmapResult = ANGLE_GL_TRY(context, functions->unmapBuffer(GL_ARRAY_BUFFER));
+        // There's maxAttributeDataSize * indexRange.start of empty space allocated for each
+        // streaming attributes
+        curBufferOffset +=
+            destStride * streamedVertexCount + maxAttributeDataSize * indexRange.start;
     }
 
-    ANGLE_CHECK(GetImplAs<ContextGL>(context), unmapResult == GL_TRUE,
-                "Failed to unmap the client data streaming buffer.", GL_OUT_OF_MEMORY);
     return angle::Result::Continue;
 }
 
@@ -14,6 +14,7 @@
 #include "common/mathutil.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/renderer/gl/ContextGL.h"
+#include "libANGLE/renderer/gl/StreamingBufferGL.h"
 
 namespace rx
 {
@@ -97,6 +98,18 @@ class VertexArrayGL : public VertexArrayImpl
                                    GLsizei instanceCount,
                                    const gl::IndexRange &indexRange,
                                    bool applyExtraOffsetWorkaroundForInstancedAttributes) const;
+    // Write the streamed attributes to the mapped buffer and point the attributes at them.
+    // |bufferPointer| maps the data at |bufferOffset| in |streamingBuffer|.
+    angle::Result writeStreamingAttributes(
+        const gl::Context *context,
+        const gl::AttributesMask &attribsToStream,
+        GLsizei instanceCount,
+        const gl::IndexRange &indexRange,
+        bool applyExtraOffsetWorkaroundForInstancedAttributes,
+        size_t maxAttributeDataSize,
+        GLuint streamingBuffer,
+        uint8_t *bufferPointer,
+        size_t bufferOffset) const;
     angle::Result syncDirtyAttrib(const gl::Context *context,
                                   size_t attribIndex,
                                   const gl::VertexArray::DirtyAttribBits &dirtyAttribBits);
@@ -145,6 +158,10 @@ class VertexArrayGL : public VertexArrayImpl
     mutable size_t mStreamingArrayBufferSize = 0;
     mutable GLuint mStreamingArrayBuffer     = 0;
 
+    // Used instead of the buffers above when usePersistentMappedStreamingBuffers is enabled.
+    mutable StreamingBufferGL mStreamingElementArrayRingBuffer;
+    mutable StreamingBufferGL mStreamingArrayRingBuffer;
+
     // Used for Mac Intel instanced draw workaround
     mutable gl::AttributesMask mForcedStreamingAttributesForDrawArraysInstancedMask;
     mutable gl::AttributesMask mInstancedAttributesMask;
@@ -1417,8 +1417,18 @@ void GenerateCaps(const FunctionsGL *functions,
     // TODO(crbug.com/776222): support Android and Apple devices.
     extensions->videoTextureWEBGL = !IsAndroid() && !IsApple();
 
-    if (functions->hasGLExtension("GL_ARB_shader_viewport_layer_array") ||
-        functions->hasGLExtension("GL_NV_viewport_array2"))
+    if (functions->hasGLExtension("GL_OVR_multiview2") ||
+        functions->hasGLESExtension("GL_OVR_multiview2"))
+    {
+        // Prefer the native implementation, which renders all views in a single pass without
+        // replicating the instances of each draw call.
+        extensions->multiviewOVR     = true;
+        extensions->multiview2OVR    = true;
+        caps->maxViews               = QuerySingleGLInt(functions, GL_MAX_VIEWS_OVR);
+        *multiviewImplementationType = MultiviewImplementationTypeGL::OVR_MULTIVIEW2;
+    }
+    else if (functions->hasGLExtension("GL_ARB_shader_viewport_layer_array") ||
+             functions->hasGLExtension("GL_NV_viewport_array2"))
     {
         extensions->multiviewOVR  = true;
         extensions->multiview2OVR = true;
@@ -1522,8 +1532,10 @@ void GenerateCaps(const FunctionsGL *functions,
     extensions->textureStorageMultisample2dArrayOES =
         functions->isAtLeastGL(gl::Version(4, 2)) || functions->isAtLeastGLES(gl::Version(3, 2));
 
-    extensions->multiviewMultisampleANGLE = extensions->textureStorageMultisample2dArrayOES &&
-                                            (extensions->multiviewOVR || extensions->multiview2OVR);
+    // Native multiview can't be relied on to support multisampled array textures.
+    extensions->multiviewMultisampleANGLE =
+        extensions->textureStorageMultisample2dArrayOES &&
+        *multiviewImplementationType == MultiviewImplementationTypeGL::NV_VIEWPORT_ARRAY2;
 
     extensions->textureMultisampleANGLE = functions->isAtLeastGL(gl::Version(3, 2)) ||
                                           functions->hasGLExtension("GL_ARB_texture_multisample");
@@ -2220,6 +2232,22 @@ void InitializeFeatures(const FunctionsGL *functions, angle::FeaturesGL *feature
     // https://anglebug.com/5536
     ANGLE_FEATURE_CONDITION(features, alwaysUnbindFramebufferTexture2D,
                             isNvidia && (IsWindows() || IsLinux()));
+
+    // Ring buffer reuse is tracked with fences, and the buffer stays mapped while it is drawn from.
+    ANGLE_FEATURE_CONDITION(features, usePersistentMappedStreamingBuffers,
+                            functions->bufferStorage != nullptr &&
+                                functions->mapBufferRange != nullptr &&
+                                functions->fenceSync != nullptr);
+
+    // Only enabled through overrides until it has been profiled on more drivers.
+    ANGLE_FEATURE_CONDITION(features, streamTextureUploadsThroughPixelUnpackBuffer, false);
+
+    // Binaries that the driver no longer accepts are evicted and the program is linked normally.
+    ANGLE_FEATURE_CONDITION(features, cacheNativeProgramBinaries,
+                            functions->getProgramBinary != nullptr &&
+                                functions->programBinary != nullptr &&
+                                QuerySingleGLInt(functions, GL_NUM_PROGRAM_BINARY_FORMATS) > 0 &&
+                                !IsPowerVrRogue(functions));
 }
 
 void InitializeFrontendFeatures(const FunctionsGL *functions, angle::FrontendFeatures *features)
@@ -2497,6 +2525,11 @@ ClearMultiviewGL *GetMultiviewClearer(const gl::Context *context)
     return GetImplAs<ContextGL>(context)->getMultiviewClearer();
 }
 
+MultiviewImplementationTypeGL GetMultiviewImplementationType(const gl::Context *context)
+{
+    return GetImplAs<ContextGL>(context)->getMultiviewImplementationType();
+}
+
 const angle::FeaturesGL &GetFeaturesGL(const gl::Context *context)
 {
     return GetImplAs<ContextGL>(context)->getFeaturesGL();
@@ -44,6 +44,9 @@ class FunctionsGL;
 class StateManagerGL;
 enum class MultiviewImplementationTypeGL
 {
+    // Views are rendered by the native driver.
+    OVR_MULTIVIEW2,
+    // Views are emulated with instancing, selecting the layer of each instance in the shader.
     NV_VIEWPORT_ARRAY2,
     UNSPECIFIED
 };
@@ -69,6 +72,7 @@ const FunctionsGL *GetFunctionsGL(const gl::Context *context);
 StateManagerGL *GetStateManagerGL(const gl::Context *context);
 BlitGL *GetBlitGL(const gl::Context *context);
 ClearMultiviewGL *GetMultiviewClearer(const gl::Context *context);
+MultiviewImplementationTypeGL GetMultiviewImplementationType(const gl::Context *context);
 const angle::FeaturesGL &GetFeaturesGL(const gl::Context *context);
 
 // Clear all errors on the stored context, emits console warnings
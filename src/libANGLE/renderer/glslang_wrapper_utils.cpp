@@ -1606,6 +1606,9 @@ class SpirvInactiveVaryingRemover final : angle::NonCopyable
     // following vector maps the Output type id to the corresponding Private one.
     std::vector<spirv::IdRef> mTypePointerTransformedId;
 
+    // The pointee type of the Input type pointers, used to zero-initialize inactive inputs.
+    std::vector<spirv::IdRef> mInputTypePointerPointeeId;
+
     // Whether a variable has been marked inactive.
     std::vector<bool> mIsInactiveById;
 };
@@ -1615,6 +1618,7 @@ void SpirvInactiveVaryingRemover::init(size_t indexBound)
     // Allocate storage for Output type pointer map.  At index i, this vector holds the identical
     // type as %i except for its storage class turned to Private.
     mTypePointerTransformedId.resize(indexBound);
+    mInputTypePointerPointeeId.resize(indexBound);
     mIsInactiveById.resize(indexBound, false);
 }
 
@@ -1709,6 +1713,10 @@ TransformationState SpirvInactiveVaryingRemover::transformTypePointer(
     // Remember the id of the replacement.
     ASSERT(id < mTypePointerTransformedId.size());
     mTypePointerTransformedId[id] = newPrivateTypeId;
+    if (storageClass == spv::StorageClassInput)
+    {
+        mInputTypePointerPointeeId[id] = typeId;
+    }
 
     // The original instruction should still be present as well.  At this point, we don't know
     // whether we will need the original or Private type.
@@ -1724,14 +1732,217 @@ TransformationState SpirvInactiveVaryingRemover::transformVariable(spirv::IdResu
 
     ASSERT(typeId < mTypePointerTransformedId.size());
     ASSERT(mTypePointerTransformedId[typeId].valid());
+
+    // Inactive inputs may still be read by the shader, for example if the previous stage never
+    // writes the varying.  Initialize them with zero, as the previous stage would have if it
+    // initialized its outputs.
+    spirv::IdRef nullConstantId;
+    if (storageClass == spv::StorageClassInput)
+    {
+        ASSERT(mInputTypePointerPointeeId[typeId].valid());
+        nullConstantId = spirv::IdRef(SpirvTransformerBase::GetNewId(blobOut));
+        spirv::WriteConstantNull(blobOut, mInputTypePointerPointeeId[typeId], nullConstantId);
+    }
+
     spirv::WriteVariable(blobOut, mTypePointerTransformedId[typeId], id, spv::StorageClassPrivate,
-                         nullptr);
+                         nullConstantId.valid() ? &nullConstantId : nullptr);
 
     mIsInactiveById[id] = true;
 
     return TransformationState::Transformed;
 }
 
+// Helper class that moves the default uniform block to push constants, when the program has
+// assigned it a push constant offset.
+class SpirvDefaultUniformPromoter final : angle::NonCopyable
+{
+  public:
+    SpirvDefaultUniformPromoter() {}
+
+    void init(size_t indexBound);
+
+    void visitTypePointer(spirv::IdResult id, spv::StorageClass storageClass, spirv::IdRef typeId);
+    void visitVariable(const ShaderInterfaceVariableInfo &info,
+                       spirv::IdResultType typeId,
+                       spirv::IdResult id,
+                       spv::StorageClass storageClass);
+
+    TransformationState transformAccessChain(spirv::IdResultType typeId,
+                                             spirv::IdResult id,
+                                             spirv::IdRef baseId,
+                                             const spirv::IdRefList &indexList,
+                                             spirv::Blob *blobOut);
+    TransformationState transformDecorate(spirv::IdRef id, spv::Decoration decoration);
+    TransformationState transformMemberDecorate(spirv::IdRef typeId,
+                                                spirv::LiteralInteger member,
+                                                spv::Decoration decoration,
+                                                const spirv::LiteralIntegerList &decorationValues,
+                                                spirv::Blob *blobOut);
+    TransformationState transformTypePointer(spirv::IdResult id,
+                                             spv::StorageClass storageClass,
+                                             spirv::IdRef typeId,
+                                             spirv::Blob *blobOut);
+    TransformationState transformVariable(spirv::IdResultType typeId,
+                                          spirv::IdResult id,
+                                          spv::StorageClass storageClass,
+                                          spirv::Blob *blobOut);
+
+  private:
+    // Whether an id is the default uniform variable or a pointer derived from it.
+    bool isPromoted(spirv::IdRef id) const { return mIsPromotedById[id]; }
+
+    // The pointee type of every "OpTypePointer Uniform" instruction, used to find the block type
+    // of the default uniform variable.
+    std::vector<spirv::IdRef> mUniformPointeeTypeId;
+
+    // Similarly to SpirvInactiveVaryingRemover, every OpTypePointer instruction with the Uniform
+    // storage class is duplicated with the PushConstant storage class.  This maps the Uniform type
+    // id to the PushConstant one.
+    std::vector<spirv::IdRef> mTypePointerTransformedId;
+
+    // The default uniform variable and any access chain based on it.
+    std::vector<bool> mIsPromotedById;
+
+    spirv::IdRef mVariableId;
+    spirv::IdRef mBlockTypeId;
+    uint32_t mPushConstantOffset = 0;
+};
+
+void SpirvDefaultUniformPromoter::init(size_t indexBound)
+{
+    mUniformPointeeTypeId.resize(indexBound);
+    mTypePointerTransformedId.resize(indexBound);
+    mIsPromotedById.resize(indexBound, false);
+}
+
+void SpirvDefaultUniformPromoter::visitTypePointer(spirv::IdResult id,
+                                                   spv::StorageClass storageClass,
+                                                   spirv::IdRef typeId)
+{
+    if (storageClass == spv::StorageClassUniform)
+    {
+        ASSERT(id < mUniformPointeeTypeId.size());
+        mUniformPointeeTypeId[id] = typeId;
+    }
+}
+
+void SpirvDefaultUniformPromoter::visitVariable(const ShaderInterfaceVariableInfo &info,
+                                                spirv::IdResultType typeId,
+                                                spirv::IdResult id,
+                                                spv::StorageClass storageClass)
+{
+    if (info.pushConstantOffset == ShaderInterfaceVariableInfo::kInvalid ||
+        storageClass != spv::StorageClassUniform)
+    {
+        return;
+    }
+
+    ASSERT(!mVariableId.valid());
+    ASSERT(mUniformPointeeTypeId[typeId].valid());
+
+    mVariableId         = id;
+    mBlockTypeId        = mUniformPointeeTypeId[typeId];
+    mPushConstantOffset = info.pushConstantOffset;
+    mIsPromotedById[id] = true;
+}
+
+TransformationState SpirvDefaultUniformPromoter::transformAccessChain(
+    spirv::IdResultType typeId,
+    spirv::IdResult id,
+    spirv::IdRef baseId,
+    const spirv::IdRefList &indexList,
+    spirv::Blob *blobOut)
+{
+    if (!isPromoted(baseId))
+    {
+        return TransformationState::Unchanged;
+    }
+
+    // The result of the access chain is a pointer to PushConstant as well.
+    ASSERT(typeId < mTypePointerTransformedId.size());
+    ASSERT(mTypePointerTransformedId[typeId].valid());
+
+    spirv::WriteAccessChain(blobOut, mTypePointerTransformedId[typeId], id, baseId, indexList);
+    mIsPromotedById[id] = true;
+
+    return TransformationState::Transformed;
+}
+
+TransformationState SpirvDefaultUniformPromoter::transformDecorate(spirv::IdRef id,
+                                                                   spv::Decoration decoration)
+{
+    // Push constants are not bound to a descriptor, so drop the set and binding decorations.
+    if (id == mVariableId &&
+        (decoration == spv::DecorationDescriptorSet || decoration == spv::DecorationBinding))
+    {
+        return TransformationState::Transformed;
+    }
+
+    return TransformationState::Unchanged;
+}
+
+TransformationState SpirvDefaultUniformPromoter::transformMemberDecorate(
+    spirv::IdRef typeId,
+    spirv::LiteralInteger member,
+    spv::Decoration decoration,
+    const spirv::LiteralIntegerList &decorationValues,
+    spirv::Blob *blobOut)
+{
+    if (!mBlockTypeId.valid() || typeId != mBlockTypeId || decoration != spv::DecorationOffset)
+    {
+        return TransformationState::Unchanged;
+    }
+
+    // The push constant range is shared by all stages, so offset the members of this stage's
+    // block by where it is placed in that range.
+    ASSERT(decorationValues.size() == 1);
+    const uint32_t offset = decorationValues[0] + mPushConstantOffset;
+    spirv::WriteMemberDecorate(blobOut, typeId, member, decoration,
+                               {spirv::LiteralInteger(offset)});
+
+    return TransformationState::Transformed;
+}
+
+TransformationState SpirvDefaultUniformPromoter::transformTypePointer(
+    spirv::IdResult id,
+    spv::StorageClass storageClass,
+    spirv::IdRef typeId,
+    spirv::Blob *blobOut)
+{
+    if (!mVariableId.valid() || storageClass != spv::StorageClassUniform)
+    {
+        return TransformationState::Unchanged;
+    }
+
+    // The type may be used by uniform blocks as well as the default uniform block, so keep the
+    // original and add a PushConstant counterpart.
+    const spirv::IdRef newTypeId(SpirvTransformerBase::GetNewId(blobOut));
+    spirv::WriteTypePointer(blobOut, newTypeId, spv::StorageClassPushConstant, typeId);
+
+    ASSERT(id < mTypePointerTransformedId.size());
+    mTypePointerTransformedId[id] = newTypeId;
+
+    return TransformationState::Unchanged;
+}
+
+TransformationState SpirvDefaultUniformPromoter::transformVariable(spirv::IdResultType typeId,
+                                                                   spirv::IdResult id,
+                                                                   spv::StorageClass storageClass,
+                                                                   spirv::Blob *blobOut)
+{
+    if (id != mVariableId)
+    {
+        return TransformationState::Unchanged;
+    }
+
+    ASSERT(storageClass == spv::StorageClassUniform);
+    ASSERT(mTypePointerTransformedId[typeId].valid());
+    spirv::WriteVariable(blobOut, mTypePointerTransformedId[typeId], id,
+                         spv::StorageClassPushConstant, nullptr);
+
+    return TransformationState::Transformed;
+}
+
 // Helper class that fixes varying precisions so they match between shader stages.
 class SpirvVaryingPrecisionFixer final : angle::NonCopyable
 {
@@ -2958,6 +3169,7 @@ class SpirvTransformer final : public SpirvTransformerBase
 
     SpirvPerVertexTrimmer mPerVertexTrimmer;
     SpirvInactiveVaryingRemover mInactiveVaryingRemover;
+    SpirvDefaultUniformPromoter mDefaultUniformPromoter;
     SpirvVaryingPrecisionFixer mVaryingPrecisionFixer;
     SpirvTransformFeedbackCodeGenerator mXfbCodeGenerator;
     SpirvPositionTransformer mPositionTransformer;
@@ -2983,6 +3195,7 @@ void SpirvTransformer::resolveVariableIds()
 
     mIds.init(indexBound);
     mInactiveVaryingRemover.init(indexBound);
+    mDefaultUniformPromoter.init(indexBound);
     mVaryingPrecisionFixer.init(indexBound);
 
     // Allocate storage for id-to-info map.  If %i is the id of a name in mVariableInfoMap, index i
@@ -3277,15 +3490,14 @@ void SpirvTransformer::visitMemberName(const uint32_t *instruction)
     spirv::LiteralString name;
     spirv::ParseMemberName(instruction, &id, &member, &name);
 
-    if (!mVariableInfoMap.hasVariable(mOptions.shaderType, name))
+    const ShaderInterfaceVariableInfo *info =
+        mVariableInfoMap.findVariableByName(mOptions.shaderType, name);
+    if (info == nullptr)
     {
         return;
     }
 
-    const ShaderInterfaceVariableInfo &info =
-        mVariableInfoMap.getVariableByName(mOptions.shaderType, name);
-
-    mIds.visitMemberName(info, id, member, name);
+    mIds.visitMemberName(*info, id, member, name);
 }
 
 void SpirvTransformer::visitTypeArray(const uint32_t *instruction)
@@ -3325,6 +3537,7 @@ void SpirvTransformer::visitTypePointer(const uint32_t *instruction)
     spirv::ParseTypePointer(instruction, &id, &storageClass, &typeId);
 
     mIds.visitTypePointer(id, storageClass, typeId);
+    mDefaultUniformPromoter.visitTypePointer(id, storageClass, typeId);
     mVaryingPrecisionFixer.visitTypePointer(id, storageClass, typeId);
     mXfbCodeGenerator.visitTypePointer(id, storageClass, typeId);
 }
@@ -3375,6 +3588,7 @@ void SpirvTransformer::visitVariable(const uint32_t *instruction)
     // Associate the id of this name with its info.
     mVariableInfoById[id] = &info;
 
+    mDefaultUniformPromoter.visitVariable(info, typeId, id, storageClass);
     mVaryingPrecisionFixer.visitVariable(info, mOptions.shaderType, typeId, id, storageClass,
                                          mSpirvBlobOut);
     if (mOptions.isTransformFeedbackStage)
@@ -3400,6 +3614,12 @@ TransformationState SpirvTransformer::transformDecorate(const uint32_t *instruct
         return TransformationState::Unchanged;
     }
 
+    if (mDefaultUniformPromoter.transformDecorate(id, decoration) ==
+        TransformationState::Transformed)
+    {
+        return TransformationState::Transformed;
+    }
+
     if (mInactiveVaryingRemover.transformDecorate(*info, mOptions.shaderType, id, decoration,
                                                   decorationValues, mSpirvBlobOut) ==
         TransformationState::Transformed)
@@ -3502,7 +3722,15 @@ TransformationState SpirvTransformer::transformMemberDecorate(const uint32_t *in
     spirv::IdRef typeId;
     spirv::LiteralInteger member;
     spv::Decoration decoration;
-    spirv::ParseMemberDecorate(instruction, &typeId, &member, &decoration, nullptr);
+    spirv::LiteralIntegerList decorationValues;
+    spirv::ParseMemberDecorate(instruction, &typeId, &member, &decoration, &decorationValues);
+
+    if (mDefaultUniformPromoter.transformMemberDecorate(typeId, member, decoration,
+                                                        decorationValues, mSpirvBlobOut) ==
+        TransformationState::Transformed)
+    {
+        return TransformationState::Transformed;
+    }
 
     return mPerVertexTrimmer.transformMemberDecorate(mIds, typeId, member, decoration);
 }
@@ -3587,6 +3815,8 @@ TransformationState SpirvTransformer::transformTypePointer(const uint32_t *instr
     spirv::IdRef typeId;
     spirv::ParseTypePointer(instruction, &id, &storageClass, &typeId);
 
+    mDefaultUniformPromoter.transformTypePointer(id, storageClass, typeId, mSpirvBlobOut);
+
     return mInactiveVaryingRemover.transformTypePointer(mIds, id, storageClass, typeId,
                                                         mSpirvBlobOut);
 }
@@ -3647,6 +3877,12 @@ TransformationState SpirvTransformer::transformVariable(const uint32_t *instruct
         return TransformationState::Unchanged;
     }
 
+    if (mDefaultUniformPromoter.transformVariable(typeId, id, storageClass, mSpirvBlobOut) ==
+        TransformationState::Transformed)
+    {
+        return TransformationState::Transformed;
+    }
+
     // Furthermore, if it's not an inactive varying output, there's nothing to do.  Note that
     // inactive varying inputs are already pruned by the translator.
     // However, input or output storage class for interface block will not be pruned when a shader
@@ -3682,6 +3918,13 @@ TransformationState SpirvTransformer::transformAccessChain(const uint32_t *instr
     spirv::IdRefList indexList;
     spirv::ParseAccessChain(instruction, &typeId, &id, &baseId, &indexList);
 
+    if (mDefaultUniformPromoter.transformAccessChain(typeId, id, baseId, indexList,
+                                                     mSpirvBlobOut) ==
+        TransformationState::Transformed)
+    {
+        return TransformationState::Transformed;
+    }
+
     // If not accessing an inactive output varying, nothing to do.
     const ShaderInterfaceVariableInfo *info = mVariableInfoById[baseId];
     if (info == nullptr)
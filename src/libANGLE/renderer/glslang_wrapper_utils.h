@@ -107,6 +107,9 @@ struct ShaderInterfaceVariableInfo
     // Used for interface blocks and opaque uniforms.
     uint32_t descriptorSet = kInvalid;
     uint32_t binding       = kInvalid;
+    // Used for the default uniform block when it is moved to push constants instead of being
+    // bound as a uniform buffer.  The offset of the block in the program's push constant range.
+    uint32_t pushConstantOffset = kInvalid;
     // Used for vertex attributes, fragment shader outputs and varyings.  There could be different
     // variables that share the same name, such as a vertex attribute and a fragment output.  They
     // will share this object since they have the same name, but will find possibly different
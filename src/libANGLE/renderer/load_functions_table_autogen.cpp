@@ -508,6 +508,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA8_ETC2_EAC_to_R8G8B8A8_UNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_10x10_KHR_to_R8G8B8A8_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCToRGBA8<10, 10>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_10x10_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -520,6 +532,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_10x10_KHR_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_10x5_KHR_to_R8G8B8A8_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCToRGBA8<10, 5>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_10x5_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -532,6 +556,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_10x5_KHR_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_10x6_KHR_to_R8G8B8A8_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCToRGBA8<10, 6>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_10x6_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -544,6 +580,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_10x6_KHR_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_10x8_KHR_to_R8G8B8A8_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCToRGBA8<10, 8>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_10x8_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -556,6 +604,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_10x8_KHR_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_12x10_KHR_to_R8G8B8A8_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCToRGBA8<12, 10>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_12x10_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -568,6 +628,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_12x10_KHR_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_12x12_KHR_to_R8G8B8A8_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCToRGBA8<12, 12>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_12x12_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -604,6 +676,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_4x3x3_OES_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_4x4_KHR_to_R8G8B8A8_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCToRGBA8<4, 4>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_4x4_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -640,6 +724,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_4x4x4_OES_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_5x4_KHR_to_R8G8B8A8_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCToRGBA8<5, 4>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_5x4_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -664,6 +760,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_5x4x4_OES_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_5x5_KHR_to_R8G8B8A8_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCToRGBA8<5, 5>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_5x5_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -700,6 +808,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_5x5x5_OES_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_6x5_KHR_to_R8G8B8A8_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCToRGBA8<6, 5>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_6x5_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -724,6 +844,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_6x5x5_OES_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_6x6_KHR_to_R8G8B8A8_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCToRGBA8<6, 6>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_6x6_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -760,6 +892,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_6x6x6_OES_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_8x5_KHR_to_R8G8B8A8_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCToRGBA8<8, 5>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_8x5_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -772,6 +916,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_8x5_KHR_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_8x6_KHR_to_R8G8B8A8_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCToRGBA8<8, 6>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_8x6_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -784,6 +940,18 @@ LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_8x6_KHR_to_default(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_8x8_KHR_to_R8G8B8A8_UNORM(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCToRGBA8<8, 8>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_RGBA_ASTC_8x8_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -976,6 +1144,18 @@ LoadImageFunctionInfo COMPRESSED_SIGNED_RG11_EAC_to_R16G16_SNORM(GLenum type)
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR_to_R8G8B8A8_UNORM_SRGB(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCSRGBToRGBA8<10, 10>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -988,6 +1168,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR_to_default(GLenum t
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR_to_R8G8B8A8_UNORM_SRGB(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCSRGBToRGBA8<10, 5>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -1000,6 +1192,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR_to_default(GLenum ty
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR_to_R8G8B8A8_UNORM_SRGB(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCSRGBToRGBA8<10, 6>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -1012,6 +1216,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR_to_default(GLenum ty
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR_to_R8G8B8A8_UNORM_SRGB(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCSRGBToRGBA8<10, 8>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -1024,6 +1240,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR_to_default(GLenum ty
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR_to_R8G8B8A8_UNORM_SRGB(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCSRGBToRGBA8<12, 10>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -1036,6 +1264,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR_to_default(GLenum t
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR_to_R8G8B8A8_UNORM_SRGB(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCSRGBToRGBA8<12, 12>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -1072,6 +1312,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_4x3x3_OES_to_default(GLenum t
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR_to_R8G8B8A8_UNORM_SRGB(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCSRGBToRGBA8<4, 4>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -1108,6 +1360,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_4x4x4_OES_to_default(GLenum t
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR_to_R8G8B8A8_UNORM_SRGB(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCSRGBToRGBA8<5, 4>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -1132,6 +1396,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_5x4x4_OES_to_default(GLenum t
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR_to_R8G8B8A8_UNORM_SRGB(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCSRGBToRGBA8<5, 5>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -1168,6 +1444,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_5x5x5_OES_to_default(GLenum t
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR_to_R8G8B8A8_UNORM_SRGB(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCSRGBToRGBA8<6, 5>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -1192,6 +1480,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_6x5x5_OES_to_default(GLenum t
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR_to_R8G8B8A8_UNORM_SRGB(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCSRGBToRGBA8<6, 6>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -1228,6 +1528,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_6x6x6_OES_to_default(GLenum t
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR_to_R8G8B8A8_UNORM_SRGB(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCSRGBToRGBA8<8, 5>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -1240,6 +1552,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR_to_default(GLenum typ
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR_to_R8G8B8A8_UNORM_SRGB(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCSRGBToRGBA8<8, 6>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -1252,6 +1576,18 @@ LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR_to_default(GLenum typ
     }
 }
 
+LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR_to_R8G8B8A8_UNORM_SRGB(GLenum type)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE:
+            return LoadImageFunctionInfo(LoadASTCSRGBToRGBA8<8, 8>, true);
+        default:
+            UNREACHABLE();
+            return LoadImageFunctionInfo(UnreachableLoadFunction, true);
+    }
+}
+
 LoadImageFunctionInfo COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR_to_default(GLenum type)
 {
     switch (type)
@@ -3463,53 +3799,165 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
             break;
         }
         case GL_COMPRESSED_RGBA_ASTC_10x10_KHR:
-            return COMPRESSED_RGBA_ASTC_10x10_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM:
+                    return COMPRESSED_RGBA_ASTC_10x10_KHR_to_R8G8B8A8_UNORM;
+                default:
+                    return COMPRESSED_RGBA_ASTC_10x10_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_RGBA_ASTC_10x5_KHR:
-            return COMPRESSED_RGBA_ASTC_10x5_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM:
+                    return COMPRESSED_RGBA_ASTC_10x5_KHR_to_R8G8B8A8_UNORM;
+                default:
+                    return COMPRESSED_RGBA_ASTC_10x5_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_RGBA_ASTC_10x6_KHR:
-            return COMPRESSED_RGBA_ASTC_10x6_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM:
+                    return COMPRESSED_RGBA_ASTC_10x6_KHR_to_R8G8B8A8_UNORM;
+                default:
+                    return COMPRESSED_RGBA_ASTC_10x6_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_RGBA_ASTC_10x8_KHR:
-            return COMPRESSED_RGBA_ASTC_10x8_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM:
+                    return COMPRESSED_RGBA_ASTC_10x8_KHR_to_R8G8B8A8_UNORM;
+                default:
+                    return COMPRESSED_RGBA_ASTC_10x8_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_RGBA_ASTC_12x10_KHR:
-            return COMPRESSED_RGBA_ASTC_12x10_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM:
+                    return COMPRESSED_RGBA_ASTC_12x10_KHR_to_R8G8B8A8_UNORM;
+                default:
+                    return COMPRESSED_RGBA_ASTC_12x10_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_RGBA_ASTC_12x12_KHR:
-            return COMPRESSED_RGBA_ASTC_12x12_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM:
+                    return COMPRESSED_RGBA_ASTC_12x12_KHR_to_R8G8B8A8_UNORM;
+                default:
+                    return COMPRESSED_RGBA_ASTC_12x12_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_RGBA_ASTC_3x3x3_OES:
             return COMPRESSED_RGBA_ASTC_3x3x3_OES_to_default;
         case GL_COMPRESSED_RGBA_ASTC_4x3x3_OES:
             return COMPRESSED_RGBA_ASTC_4x3x3_OES_to_default;
         case GL_COMPRESSED_RGBA_ASTC_4x4_KHR:
-            return COMPRESSED_RGBA_ASTC_4x4_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM:
+                    return COMPRESSED_RGBA_ASTC_4x4_KHR_to_R8G8B8A8_UNORM;
+                default:
+                    return COMPRESSED_RGBA_ASTC_4x4_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_RGBA_ASTC_4x4x3_OES:
             return COMPRESSED_RGBA_ASTC_4x4x3_OES_to_default;
         case GL_COMPRESSED_RGBA_ASTC_4x4x4_OES:
             return COMPRESSED_RGBA_ASTC_4x4x4_OES_to_default;
         case GL_COMPRESSED_RGBA_ASTC_5x4_KHR:
-            return COMPRESSED_RGBA_ASTC_5x4_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM:
+                    return COMPRESSED_RGBA_ASTC_5x4_KHR_to_R8G8B8A8_UNORM;
+                default:
+                    return COMPRESSED_RGBA_ASTC_5x4_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_RGBA_ASTC_5x4x4_OES:
             return COMPRESSED_RGBA_ASTC_5x4x4_OES_to_default;
         case GL_COMPRESSED_RGBA_ASTC_5x5_KHR:
-            return COMPRESSED_RGBA_ASTC_5x5_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM:
+                    return COMPRESSED_RGBA_ASTC_5x5_KHR_to_R8G8B8A8_UNORM;
+                default:
+                    return COMPRESSED_RGBA_ASTC_5x5_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_RGBA_ASTC_5x5x4_OES:
             return COMPRESSED_RGBA_ASTC_5x5x4_OES_to_default;
         case GL_COMPRESSED_RGBA_ASTC_5x5x5_OES:
             return COMPRESSED_RGBA_ASTC_5x5x5_OES_to_default;
         case GL_COMPRESSED_RGBA_ASTC_6x5_KHR:
-            return COMPRESSED_RGBA_ASTC_6x5_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM:
+                    return COMPRESSED_RGBA_ASTC_6x5_KHR_to_R8G8B8A8_UNORM;
+                default:
+                    return COMPRESSED_RGBA_ASTC_6x5_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_RGBA_ASTC_6x5x5_OES:
             return COMPRESSED_RGBA_ASTC_6x5x5_OES_to_default;
         case GL_COMPRESSED_RGBA_ASTC_6x6_KHR:
-            return COMPRESSED_RGBA_ASTC_6x6_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM:
+                    return COMPRESSED_RGBA_ASTC_6x6_KHR_to_R8G8B8A8_UNORM;
+                default:
+                    return COMPRESSED_RGBA_ASTC_6x6_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_RGBA_ASTC_6x6x5_OES:
             return COMPRESSED_RGBA_ASTC_6x6x5_OES_to_default;
         case GL_COMPRESSED_RGBA_ASTC_6x6x6_OES:
             return COMPRESSED_RGBA_ASTC_6x6x6_OES_to_default;
         case GL_COMPRESSED_RGBA_ASTC_8x5_KHR:
-            return COMPRESSED_RGBA_ASTC_8x5_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM:
+                    return COMPRESSED_RGBA_ASTC_8x5_KHR_to_R8G8B8A8_UNORM;
+                default:
+                    return COMPRESSED_RGBA_ASTC_8x5_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_RGBA_ASTC_8x6_KHR:
-            return COMPRESSED_RGBA_ASTC_8x6_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM:
+                    return COMPRESSED_RGBA_ASTC_8x6_KHR_to_R8G8B8A8_UNORM;
+                default:
+                    return COMPRESSED_RGBA_ASTC_8x6_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_RGBA_ASTC_8x8_KHR:
-            return COMPRESSED_RGBA_ASTC_8x8_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM:
+                    return COMPRESSED_RGBA_ASTC_8x8_KHR_to_R8G8B8A8_UNORM;
+                default:
+                    return COMPRESSED_RGBA_ASTC_8x8_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_RGBA_BPTC_UNORM_EXT:
             return COMPRESSED_RGBA_BPTC_UNORM_EXT_to_default;
         case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
@@ -3559,53 +4007,165 @@ LoadFunctionMap GetLoadFunctionsMap(GLenum internalFormat, FormatID angleFormat)
             break;
         }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR:
-            return COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM_SRGB:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR_to_R8G8B8A8_UNORM_SRGB;
+                default:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_10x10_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR:
-            return COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM_SRGB:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR_to_R8G8B8A8_UNORM_SRGB;
+                default:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_10x5_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR:
-            return COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM_SRGB:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR_to_R8G8B8A8_UNORM_SRGB;
+                default:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_10x6_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR:
-            return COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM_SRGB:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR_to_R8G8B8A8_UNORM_SRGB;
+                default:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_10x8_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR:
-            return COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM_SRGB:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR_to_R8G8B8A8_UNORM_SRGB;
+                default:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_12x10_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR:
-            return COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM_SRGB:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR_to_R8G8B8A8_UNORM_SRGB;
+                default:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_12x12_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_3x3x3_OES:
             return COMPRESSED_SRGB8_ALPHA8_ASTC_3x3x3_OES_to_default;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x3x3_OES:
             return COMPRESSED_SRGB8_ALPHA8_ASTC_4x3x3_OES_to_default;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR:
-            return COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM_SRGB:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR_to_R8G8B8A8_UNORM_SRGB;
+                default:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_4x4_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4x3_OES:
             return COMPRESSED_SRGB8_ALPHA8_ASTC_4x4x3_OES_to_default;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_4x4x4_OES:
             return COMPRESSED_SRGB8_ALPHA8_ASTC_4x4x4_OES_to_default;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR:
-            return COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM_SRGB:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR_to_R8G8B8A8_UNORM_SRGB;
+                default:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_5x4_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x4x4_OES:
             return COMPRESSED_SRGB8_ALPHA8_ASTC_5x4x4_OES_to_default;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR:
-            return COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM_SRGB:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR_to_R8G8B8A8_UNORM_SRGB;
+                default:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_5x5_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5x4_OES:
             return COMPRESSED_SRGB8_ALPHA8_ASTC_5x5x4_OES_to_default;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_5x5x5_OES:
             return COMPRESSED_SRGB8_ALPHA8_ASTC_5x5x5_OES_to_default;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR:
-            return COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM_SRGB:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR_to_R8G8B8A8_UNORM_SRGB;
+                default:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_6x5_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x5x5_OES:
             return COMPRESSED_SRGB8_ALPHA8_ASTC_6x5x5_OES_to_default;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR:
-            return COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM_SRGB:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR_to_R8G8B8A8_UNORM_SRGB;
+                default:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_6x6_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6x5_OES:
             return COMPRESSED_SRGB8_ALPHA8_ASTC_6x6x5_OES_to_default;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_6x6x6_OES:
             return COMPRESSED_SRGB8_ALPHA8_ASTC_6x6x6_OES_to_default;
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR:
-            return COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM_SRGB:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR_to_R8G8B8A8_UNORM_SRGB;
+                default:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_8x5_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR:
-            return COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM_SRGB:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR_to_R8G8B8A8_UNORM_SRGB;
+                default:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_8x6_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR:
-            return COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR_to_default;
+        {
+            switch (angleFormat)
+            {
+                case FormatID::R8G8B8A8_UNORM_SRGB:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR_to_R8G8B8A8_UNORM_SRGB;
+                default:
+                    return COMPRESSED_SRGB8_ALPHA8_ASTC_8x8_KHR_to_default;
+            }
+        }
         case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
         {
             switch (angleFormat)
@@ -80,6 +80,30 @@ struct IndexConversionBufferMtl : public ConversionBufferMtl
     IndexRange getRangeForConvertedBuffer(size_t count);
 };
 
+// Index buffers generated from a range of the buffer to draw triangle fans or line loops, or to
+// emulate the last provoking vertex.
+struct PrimitiveConversionBufferMtl : public ConversionBufferMtl
+{
+    PrimitiveConversionBufferMtl(ContextMtl *context,
+                                 gl::PrimitiveMode modeIn,
+                                 gl::DrawElementsType elemTypeIn,
+                                 bool primitiveRestartEnabledIn,
+                                 size_t offsetIn,
+                                 size_t countIn);
+
+    // The conversion is identified by the draw call parameters, which are reassigned when the
+    // entry is recycled for another range.
+    gl::PrimitiveMode mode;
+    gl::DrawElementsType elemType;
+    bool primitiveRestartEnabled;
+    size_t offset;
+    size_t count;
+    // Number of generated indices, which depends on the restarts in the range.
+    uint32_t convertedCount;
+    // The primitive mode to draw the generated indices with.
+    gl::PrimitiveMode convertedMode;
+};
+
 struct UniformConversionBufferMtl : public ConversionBufferMtl
 {
     UniformConversionBufferMtl(ContextMtl *context, size_t offsetIn);
@@ -163,6 +187,13 @@ class BufferMtl : public BufferImpl, public BufferHolderMtl
                                                        bool primitiveRestartEnabled,
                                                        size_t offset);
 
+    PrimitiveConversionBufferMtl *getPrimitiveConversionBuffer(ContextMtl *context,
+                                                               gl::PrimitiveMode mode,
+                                                               gl::DrawElementsType elemType,
+                                                               bool primitiveRestartEnabled,
+                                                               size_t offset,
+                                                               size_t count);
+
     ConversionBufferMtl *getUniformConversionBuffer(ContextMtl *context, size_t offset);
 
     size_t size() const { return static_cast<size_t>(mState.getSize()); }
@@ -212,6 +243,11 @@ class BufferMtl : public BufferImpl, public BufferHolderMtl
 
     std::vector<IndexConversionBufferMtl> mIndexConversionBuffers;
 
+    // The ranges drawn as triangle fans or line loops are bounded in number, the oldest entry is
+    // recycled once the limit is reached.
+    std::vector<PrimitiveConversionBufferMtl> mPrimitiveConversionBuffers;
+    size_t mNextPrimitiveConversionBufferToRecycle = 0;
+
     std::vector<UniformConversionBufferMtl> mUniformConversionBuffers;
 
     struct RestartRangeCache
@@ -23,6 +23,9 @@ namespace
 // Start with a fairly small buffer size. We can increase this dynamically as we convert more data.
 constexpr size_t kConvertedElementArrayBufferInitialSize = 1024 * 8;
 
+// Maximum number of triangle fan and line loop ranges whose generated indices are kept.
+constexpr size_t kMaxPrimitiveConversionBuffers = 16;
+
 template <typename IndexType>
 angle::Result GetFirstLastIndices(const IndexType *indices,
                                   size_t count,
@@ -70,6 +73,25 @@ IndexRange IndexConversionBufferMtl::getRangeForConvertedBuffer(size_t count)
     return IndexRange{0, count};
 }
 
+// PrimitiveConversionBufferMtl implementation.
+PrimitiveConversionBufferMtl::PrimitiveConversionBufferMtl(ContextMtl *context,
+                                                           gl::PrimitiveMode modeIn,
+                                                           gl::DrawElementsType elemTypeIn,
+                                                           bool primitiveRestartEnabledIn,
+                                                           size_t offsetIn,
+                                                           size_t countIn)
+    : ConversionBufferMtl(context,
+                          kConvertedElementArrayBufferInitialSize,
+                          mtl::kIndexBufferOffsetAlignment),
+      mode(modeIn),
+      elemType(elemTypeIn),
+      primitiveRestartEnabled(primitiveRestartEnabledIn),
+      offset(offsetIn),
+      count(countIn),
+      convertedCount(0),
+      convertedMode(gl::PrimitiveMode::InvalidEnum)
+{}
+
 // UniformConversionBufferMtl implementation
 UniformConversionBufferMtl::UniformConversionBufferMtl(ContextMtl *context, size_t offsetIn)
     : ConversionBufferMtl(context, 0, mtl::kUniformBufferSettingOffsetMinAlignment),
@@ -144,6 +166,7 @@ angle::Result BufferMtl::copySubData(const gl::Context *context,
         mtl::BlitCommandEncoder *blitEncoder = contextMtl->getBlitCommandEncoder();
         blitEncoder->copyBuffer(srcMtl->getCurrentBuffer(), sourceOffset, mBuffer, destOffset,
                                 size);
+        markConversionBuffersDirty();
 
         return angle::Result::Continue;
     }
@@ -359,6 +382,49 @@ IndexConversionBufferMtl *BufferMtl::getIndexConversionBuffer(ContextMtl *contex
     return &mIndexConversionBuffers.back();
 }
 
+PrimitiveConversionBufferMtl *BufferMtl::getPrimitiveConversionBuffer(
+    ContextMtl *context,
+    gl::PrimitiveMode mode,
+    gl::DrawElementsType elemType,
+    bool primitiveRestartEnabled,
+    size_t offset,
+    size_t count)
+{
+    for (PrimitiveConversionBufferMtl &buffer : mPrimitiveConversionBuffers)
+    {
+        if (buffer.mode == mode && buffer.elemType == elemType && buffer.offset == offset &&
+            buffer.count == count && buffer.primitiveRestartEnabled == primitiveRestartEnabled)
+        {
+            return &buffer;
+        }
+    }
+
+    if (mPrimitiveConversionBuffers.size() < kMaxPrimitiveConversionBuffers)
+    {
+        mPrimitiveConversionBuffers.emplace_back(context, mode, elemType, primitiveRestartEnabled,
+                                                 offset, count);
+        return &mPrimitiveConversionBuffers.back();
+    }
+
+    // Recycle the oldest entry, keeping its buffer pool.
+    PrimitiveConversionBufferMtl &buffer =
+        mPrimitiveConversionBuffers[mNextPrimitiveConversionBufferToRecycle];
+    mNextPrimitiveConversionBufferToRecycle =
+        (mNextPrimitiveConversionBufferToRecycle + 1) % kMaxPrimitiveConversionBuffers;
+
+    buffer.mode                    = mode;
+    buffer.elemType                = elemType;
+    buffer.primitiveRestartEnabled = primitiveRestartEnabled;
+    buffer.offset                  = offset;
+    buffer.count                   = count;
+    buffer.dirty                   = true;
+    buffer.convertedBuffer         = nullptr;
+    buffer.convertedOffset         = 0;
+    buffer.convertedCount          = 0;
+    buffer.convertedMode           = gl::PrimitiveMode::InvalidEnum;
+    return &buffer;
+}
+
 ConversionBufferMtl *BufferMtl::getUniformConversionBuffer(ContextMtl *context, size_t offset)
 {
     for (UniformConversionBufferMtl &buffer : mUniformConversionBuffers)
@@ -389,6 +455,14 @@ void BufferMtl::markConversionBuffersDirty()
         buffer.convertedOffset = 0;
     }
 
+    for (PrimitiveConversionBufferMtl &buffer : mPrimitiveConversionBuffers)
+    {
+        buffer.dirty           = true;
+        buffer.convertedBuffer = nullptr;
+        buffer.convertedOffset = 0;
+        buffer.convertedCount  = 0;
+    }
+
     for (UniformConversionBufferMtl &buffer : mUniformConversionBuffers)
     {
         buffer.dirty           = true;
@@ -402,6 +476,8 @@ void BufferMtl::clearConversionBuffers()
 {
     mVertexConversionBuffers.clear();
     mIndexConversionBuffers.clear();
+    mPrimitiveConversionBuffers.clear();
+    mNextPrimitiveConversionBufferToRecycle = 0;
     mUniformConversionBuffers.clear();
     mRestartRangeCache.reset();
 }
@@ -421,6 +421,15 @@ class ContextMtl : public ContextImpl, public mtl::Context
                                          GLint first,
                                          GLsizei count,
                                          GLsizei instances);
+    // Generates the indices to draw a triangle fan or line loop from an elements array.
+    angle::Result generateElementsIndexBuffer(gl::PrimitiveMode mode,
+                                              GLsizei count,
+                                              gl::DrawElementsType type,
+                                              const void *indices,
+                                              bool primitiveRestart,
+                                              mtl::BufferRef *bufferOut,
+                                              uint32_t *offsetOut,
+                                              uint32_t *indicesCountOut);
     angle::Result drawTriFanElements(const gl::Context *context,
                                      GLsizei count,
                                      gl::DrawElementsType type,
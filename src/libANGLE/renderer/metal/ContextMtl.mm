@@ -239,6 +239,9 @@ angle::Result ContextMtl::initialize()
 
     mContextDevice.set(mDisplay->getMetalDevice());
 
+    mRenderEncoder.setParallelEncodingEnabled(
+        getDisplay()->getFeatures().encodeRenderPassesInParallel.enabled);
+
     return angle::Result::Continue;
 }
 
@@ -254,6 +257,9 @@ void ContextMtl::onDestroy(const gl::Context *context)
     mProvokingVertexHelper.onDestroy(this);
     mDummyXFBRenderTexture = nullptr;
 
+    // Store the pipelines created so far, in case the display is never terminated.
+    getDisplay()->saveRenderPipelineArchive();
+
     mContextDevice.reset();
 }
 
@@ -523,6 +529,70 @@ angle::Result ContextMtl::drawArraysInstancedBaseInstance(const gl::Context *con
     return drawArraysImpl(context, mode, first, count, instanceCount, baseInstance);
 }
 
+angle::Result ContextMtl::generateElementsIndexBuffer(gl::PrimitiveMode mode,
+                                                      GLsizei count,
+                                                      gl::DrawElementsType type,
+                                                      const void *indices,
+                                                      bool primitiveRestart,
+                                                      mtl::BufferRef *bufferOut,
+                                                      uint32_t *offsetOut,
+                                                      uint32_t *indicesCountOut)
+{
+    ASSERT(mode == gl::PrimitiveMode::TriangleFan || mode == gl::PrimitiveMode::LineLoop);
+
+    // Indices generated from an element array buffer are kept with it until its content changes,
+    // so drawing the same range again doesn't regenerate them.
+    mtl::BufferPool *pool;
+    PrimitiveConversionBufferMtl *conversion = nullptr;
+    const gl::Buffer *elementBuffer = getState().getVertexArray()->getElementArrayBuffer();
+    if (elementBuffer)
+    {
+        BufferMtl *bufferMtl = mtl::GetImpl(elementBuffer);
+        conversion           = bufferMtl->getPrimitiveConversionBuffer(
+            this, mode, type, primitiveRestart, reinterpret_cast<size_t>(indices), count);
+        if (!conversion->dirty)
+        {
+            *bufferOut       = conversion->convertedBuffer;
+            *offsetOut       = static_cast<uint32_t>(conversion->convertedOffset);
+            *indicesCountOut = conversion->convertedCount;
+            return angle::Result::Continue;
+        }
+        pool = &conversion->data;
+    }
+    else
+    {
+        pool = mode == gl::PrimitiveMode::TriangleFan ? &mTriFanIndexBuffer : &mLineLoopIndexBuffer;
+    }
+
+    if (mode == gl::PrimitiveMode::TriangleFan)
+    {
+        ANGLE_TRY(AllocateTriangleFanBufferFromPool(this, count, pool, bufferOut, offsetOut,
+                                                    indicesCountOut));
+        ANGLE_TRY(getDisplay()->getUtils().generateTriFanBufferFromElementsArray(
+            this, {type, count, indices, *bufferOut, *offsetOut, primitiveRestart},
+            indicesCountOut));
+    }
+    else
+    {
+        ANGLE_TRY(AllocateBufferFromPool(this, count * 2, pool, bufferOut, offsetOut));
+        ANGLE_TRY(getDisplay()->getUtils().generateLineLoopBufferFromElementsArray(
+            this, {type, count, indices, *bufferOut, *offsetOut, primitiveRestart},
+            indicesCountOut));
+    }
+
+    ANGLE_TRY(pool->commit(this));
+
+    if (conversion)
+    {
+        conversion->dirty           = false;
+        conversion->convertedBuffer = *bufferOut;
+        conversion->convertedOffset = *offsetOut;
+        conversion->convertedCount  = *indicesCountOut;
+    }
+
+    return angle::Result::Continue;
+}
+
 angle::Result ContextMtl::drawTriFanElements(const gl::Context *context,
                                              GLsizei count,
                                              gl::DrawElementsType type,
@@ -537,14 +607,9 @@ angle::Result ContextMtl::drawTriFanElements(const gl::Context *context,
         uint32_t genIdxBufferOffset;
         uint32_t genIndicesCount;
         bool primitiveRestart = getState().isPrimitiveRestartEnabled();
-        ANGLE_TRY(AllocateTriangleFanBufferFromPool(this, count, &mTriFanIndexBuffer, &genIdxBuffer,
-                                                    &genIdxBufferOffset, &genIndicesCount));
-
-        ANGLE_TRY(getDisplay()->getUtils().generateTriFanBufferFromElementsArray(
-            this, {type, count, indices, genIdxBuffer, genIdxBufferOffset, primitiveRestart},
-            &genIndicesCount));
-
-        ANGLE_TRY(mTriFanIndexBuffer.commit(this));
+        ANGLE_TRY(generateElementsIndexBuffer(gl::PrimitiveMode::TriangleFan, count, type, indices,
+                                              primitiveRestart, &genIdxBuffer,
+                                              &genIdxBufferOffset, &genIndicesCount));
 
         ANGLE_TRY(setupDraw(context, gl::PrimitiveMode::TriangleFan, 0, count, instances, type,
                             indices, false));
@@ -612,16 +677,10 @@ angle::Result ContextMtl::drawLineLoopElements(const gl::Context *context,
 
         mtl::BufferRef genIdxBuffer;
         uint32_t genIdxBufferOffset;
-        uint32_t reservedIndices = count * 2;
         uint32_t genIndicesCount;
-        ANGLE_TRY(AllocateBufferFromPool(this, reservedIndices, &mLineLoopIndexBuffer,
-                                         &genIdxBuffer, &genIdxBufferOffset));
-
-        ANGLE_TRY(getDisplay()->getUtils().generateLineLoopBufferFromElementsArray(
-            this, {type, count, indices, genIdxBuffer, genIdxBufferOffset, primitiveRestart},
-            &genIndicesCount));
-
-        ANGLE_TRY(mLineLoopIndexBuffer.commit(this));
+        ANGLE_TRY(generateElementsIndexBuffer(gl::PrimitiveMode::LineLoop, count, type, indices,
+                                              primitiveRestart, &genIdxBuffer,
+                                              &genIdxBufferOffset, &genIndicesCount));
 
         ANGLE_TRY(setupDraw(context, gl::PrimitiveMode::LineLoop, 0, count, instances, type,
                             indices, false));
@@ -782,13 +841,47 @@ angle::Result ContextMtl::drawElementsImpl(const gl::Context *context,
     {
         size_t outIndexCount      = 0;
         gl::PrimitiveMode newMode = gl::PrimitiveMode::InvalidEnum;
-        drawIdxBuffer             = mProvokingVertexHelper.preconditionIndexBuffer(
-                        mtl::GetImpl(context), idxBuffer, count, convertedOffset,
-                        mState.isPrimitiveRestartEnabled(), mode, convertedType, outIndexCount,
-                        provokingVertexAdditionalOffset, newMode);
-        if (!drawIdxBuffer)
+        bool primitiveRestart     = mState.isPrimitiveRestartEnabled();
+
+        // Indices rewritten from an element array buffer are kept with it until its content
+        // changes.  The converted offset identifies the range, since the index conversion is
+        // only redone when the content changes too.
+        PrimitiveConversionBufferMtl *conversion = nullptr;
+        const gl::Buffer *elementBuffer = mState.getVertexArray()->getElementArrayBuffer();
+        if (elementBuffer)
         {
-            return angle::Result::Stop;
+            conversion = mtl::GetImpl(elementBuffer)
+                             ->getPrimitiveConversionBuffer(this, mode, convertedType,
+                                                            primitiveRestart, convertedOffset,
+                                                            count);
+        }
+
+        if (conversion && !conversion->dirty)
+        {
+            drawIdxBuffer                   = conversion->convertedBuffer;
+            provokingVertexAdditionalOffset = conversion->convertedOffset;
+            outIndexCount                   = conversion->convertedCount;
+            newMode                         = conversion->convertedMode;
+        }
+        else
+        {
+            drawIdxBuffer = mProvokingVertexHelper.preconditionIndexBuffer(
+                mtl::GetImpl(context), idxBuffer, count, convertedOffset, primitiveRestart, mode,
+                convertedType, conversion ? &conversion->data : nullptr, outIndexCount,
+                provokingVertexAdditionalOffset, newMode);
+            if (!drawIdxBuffer)
+            {
+                return angle::Result::Stop;
+            }
+
+            if (conversion)
+            {
+                conversion->dirty           = false;
+                conversion->convertedBuffer = drawIdxBuffer;
+                conversion->convertedOffset = provokingVertexAdditionalOffset;
+                conversion->convertedCount  = static_cast<uint32_t>(outIndexCount);
+                conversion->convertedMode   = newMode;
+            }
         }
         // Line strips and triangle strips are rewritten to flat line arrays and tri arrays.
         convertedCounti32 = (uint32_t)outIndexCount;
@@ -16,6 +16,8 @@
 #include "libANGLE/renderer/metal/mtl_command_buffer.h"
 #include "libANGLE/renderer/metal/mtl_context_device.h"
 #include "libANGLE/renderer/metal/mtl_format_utils.h"
+#include "libANGLE/renderer/metal/mtl_library_cache.h"
+#include "libANGLE/renderer/metal/mtl_pipeline_archive.h"
 #include "libANGLE/renderer/metal/mtl_render_utils.h"
 #include "libANGLE/renderer/metal/mtl_state_cache.h"
 #include "libANGLE/renderer/metal/mtl_utils.h"
@@ -138,6 +140,11 @@ class DisplayMtl : public DisplayImpl
     const mtl::FormatTable &getFormatTable() const { return mFormatTable; }
     mtl::RenderUtils &getUtils() { return mUtils; }
     mtl::StateCache &getStateCache() { return mStateCache; }
+    // Render pipelines archive shared by all the contexts of the display.
+    mtl::PipelineArchive &getRenderPipelineArchive() { return mRenderPipelineArchive; }
+    void saveRenderPipelineArchive();
+    // Libraries compiled from translated shaders, shared by all the contexts of the display.
+    mtl::LibraryCache &getLibraryCache() { return mLibraryCache; }
     uint32_t getMaxColorTargetBits() { return mMaxColorTargetBits; }
 
     id<MTLLibrary> getDefaultShadersLib();
@@ -188,6 +195,8 @@ class DisplayMtl : public DisplayImpl
     mutable mtl::FormatTable mFormatTable;
     mtl::StateCache mStateCache;
     mtl::RenderUtils mUtils;
+    mtl::PipelineArchive mRenderPipelineArchive;
+    mtl::LibraryCache mLibraryCache;
 
     // Built-in Shaders
     std::shared_ptr<DefaultShaderAsyncInfoMtl> mDefaultShadersAsyncInfo;
@@ -169,6 +169,10 @@ angle::Result DisplayMtl::initializeImpl(egl::Display *display)
 
 void DisplayMtl::terminate()
 {
+    saveRenderPipelineArchive();
+    mRenderPipelineArchive.destroy();
+    mLibraryCache.destroy();
+
     mUtils.onDestroy();
     mCmdQueue.reset();
     mDefaultShadersAsyncInfo = nullptr;
@@ -1132,6 +1136,18 @@ void DisplayMtl::initializeFeatures()
 
     ANGLE_FEATURE_CONDITION((&mFeatures), forceNonCSBaseMipmapGeneration, isIntel());
 
+    // The CPU cost of encoding is only worth spreading across threads on desktop-class CPUs.
+    ANGLE_FEATURE_CONDITION((&mFeatures), encodeRenderPassesInParallel,
+                            (isOSX || isCatalyst) && !isSimulator);
+
+    ANGLE_FEATURE_CONDITION((&mFeatures), useBinaryArchiveForRenderPipelines,
+                            ANGLE_APPLE_AVAILABLE_XCI(11.0, 14.0, 14.0) && !isSimulator);
+    ANGLE_FEATURE_CONDITION((&mFeatures), createRenderPipelinesAsynchronously, true);
+
+    // Only the tile GPUs of iOS and tvOS devices have memoryless storage.
+    ANGLE_FEATURE_CONDITION((&mFeatures), useMemorylessTransientAttachments,
+                            !isOSX && !isCatalyst && !isSimulator);
+
     bool defaultDirectToMetal = true;
 
     ANGLE_FEATURE_CONDITION((&mFeatures), directMetalGeneration, defaultDirectToMetal);
@@ -1297,6 +1313,14 @@ mtl::AutoObjCObj<MTLSharedEventListener> DisplayMtl::getOrCreateSharedEventListe
 }
 #endif
 
+void DisplayMtl::saveRenderPipelineArchive()
+{
+    if (mFeatures.useBinaryArchiveForRenderPipelines.enabled)
+    {
+        mRenderPipelineArchive.save(mMetalDevice, getBlobCache());
+    }
+}
+
 bool DisplayMtl::useDirectToMetalCompiler() const
 {
     return mFeatures.directMetalGeneration.enabled;
@@ -478,8 +478,12 @@ angle::Result FramebufferMtl::blitWithDraw(const gl::Context *context,
         RenderTargetMtl *srcDepthRt   = srcFrameBuffer->getDepthRenderTarget();
         RenderTargetMtl *srcStencilRt = srcFrameBuffer->getStencilRenderTarget();
 
+        // The source and the stencil copied via a buffer are read outside the render pass, which
+        // needs memory behind them.
         if (blitDepthBuffer)
         {
+            ANGLE_MTL_CHECK(contextMtl, srcDepthRt->getTexture()->allocatePersistentStorage(),
+                            GL_OUT_OF_MEMORY);
             dsBlitParams.src      = srcDepthRt->getTexture();
             dsBlitParams.srcLevel = srcDepthRt->getLevelIndex();
             dsBlitParams.srcLayer = srcDepthRt->getLayerIndex();
@@ -487,6 +491,8 @@ angle::Result FramebufferMtl::blitWithDraw(const gl::Context *context,
 
         if (blitStencilBuffer && srcStencilRt->getTexture())
         {
+            ANGLE_MTL_CHECK(contextMtl, srcStencilRt->getTexture()->allocatePersistentStorage(),
+                            GL_OUT_OF_MEMORY);
             dsBlitParams.srcStencil = srcStencilRt->getTexture()->getStencilView();
             dsBlitParams.srcLevel   = srcStencilRt->getLevelIndex();
             dsBlitParams.srcLayer   = srcStencilRt->getLayerIndex();
@@ -496,6 +502,9 @@ angle::Result FramebufferMtl::blitWithDraw(const gl::Context *context,
             {
                 // Directly writing to stencil in shader is not supported, use temporary copy buffer
                 // work around. This is a compute pass.
+                ANGLE_MTL_CHECK(contextMtl,
+                                mStencilRenderTarget->getTexture()->allocatePersistentStorage(),
+                                GL_OUT_OF_MEMORY);
                 mtl::StencilBlitViaBufferParams stencilOnlyBlitParams = dsBlitParams;
                 stencilOnlyBlitParams.dstStencil      = mStencilRenderTarget->getTexture();
                 stencilOnlyBlitParams.dstStencilLayer = mStencilRenderTarget->getLayerIndex();
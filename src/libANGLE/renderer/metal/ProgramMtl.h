@@ -39,6 +39,13 @@ struct ProgramArgumentBufferEncoderMtl
 
     mtl::AutoObjCPtr<id<MTLArgumentEncoder>> metalArgBufferEncoder;
     mtl::BufferPool bufferPool;
+
+    // The last encoded argument buffer, and the buffers and offsets encoded in its slots.  It is
+    // bound again as long as the uniform buffers don't change.
+    mtl::BufferRef encodedArgumentBuffer;
+    size_t encodedArgumentBufferOffset = 0;
+    std::array<std::pair<mtl::AutoObjCPtr<id<MTLBuffer>>, uint32_t>, mtl::kMaxShaderBuffers>
+        encodedBuffers;
 };
 
 // Represents a specialized shader variant. For example, a shader variant with fragment coverage
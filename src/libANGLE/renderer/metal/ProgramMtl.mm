@@ -188,6 +188,10 @@ void ProgramArgumentBufferEncoderMtl::reset(ContextMtl *contextMtl)
 {
     metalArgBufferEncoder = nil;
     bufferPool.destroy(contextMtl);
+
+    encodedArgumentBuffer       = nullptr;
+    encodedArgumentBufferOffset = 0;
+    encodedBuffers.fill({nil, 0});
 }
 
 // ProgramShaderObjVariantMtl implementation
@@ -750,8 +754,9 @@ angle::Result ProgramMtl::createMslShaderLib(
         bool disableFastMath = (context->getDisplay()->getFeatures().intelDisableFastMath.enabled &&
                                 translatedMslInfo->hasInvariantOrAtan);
         translatedMslInfo->metalLibrary =
-            mtl::CreateShaderLibrary(metalDevice, translatedMslInfo->metalShaderSource,
-                                     substitutionMacros, !disableFastMath, &err);
+            context->getDisplay()->getLibraryCache().getOrCompileShaderLibrary(
+                metalDevice, translatedMslInfo->metalShaderSource, substitutionMacros,
+                !disableFastMath, &err);
         if (err && !translatedMslInfo->metalLibrary)
         {
             std::ostringstream ss;
@@ -1537,16 +1542,6 @@ angle::Result ProgramMtl::encodeUniformBuffersInfoArgumentBuffer(
     ProgramArgumentBufferEncoderMtl &bufferEncoder =
         mCurrentShaderVariants[shaderType]->uboArgBufferEncoder;
 
-    mtl::BufferRef argumentBuffer;
-    size_t argumentBufferOffset;
-    bufferEncoder.bufferPool.releaseInFlightBuffers(context);
-    ANGLE_TRY(bufferEncoder.bufferPool.allocate(
-        context, bufferEncoder.metalArgBufferEncoder.get().encodedLength, nullptr, &argumentBuffer,
-        &argumentBufferOffset));
-
-    [bufferEncoder.metalArgBufferEncoder setArgumentBuffer:argumentBuffer->get()
-                                                    offset:argumentBufferOffset];
-
     constexpr gl::ShaderMap<MTLRenderStages> kShaderStageMap = {
         {gl::ShaderType::Vertex, mtl::kRenderStageVertex},
         {gl::ShaderType::Fragment, mtl::kRenderStageFragment},
@@ -1554,6 +1549,8 @@ angle::Result ProgramMtl::encodeUniformBuffersInfoArgumentBuffer(
 
     auto mtlRenderStage = kShaderStageMap[shaderType];
 
+    std::array<std::pair<id<MTLBuffer>, uint32_t>, mtl::kMaxShaderBuffers> buffers = {};
+
     for (uint32_t bufferIndex = 0; bufferIndex < blocks.size(); ++bufferIndex)
     {
         const gl::InterfaceBlock &block = blocks[bufferIndex];
@@ -1573,16 +1570,51 @@ angle::Result ProgramMtl::encodeUniformBuffersInfoArgumentBuffer(
             continue;
         }
 
-        mtl::BufferRef mtlBuffer = mLegalizedOffsetedUniformBuffers[bufferIndex].first;
-        uint32_t offset          = mLegalizedOffsetedUniformBuffers[bufferIndex].second;
-        [bufferEncoder.metalArgBufferEncoder setBuffer:mtlBuffer->get()
-                                                offset:offset
-                                               atIndex:actualBufferIdx];
+        buffers[actualBufferIdx] = {mLegalizedOffsetedUniformBuffers[bufferIndex].first->get(),
+                                    mLegalizedOffsetedUniformBuffers[bufferIndex].second};
     }
 
-    ANGLE_TRY(bufferEncoder.bufferPool.commit(context));
+    // The argument buffer is immutable once encoded, so it is only encoded in a new allocation
+    // when the bound buffers change.  Reusing it is safe since binding it marks its pool buffer
+    // as in use by the GPU once more.
+    bool buffersChanged = !bufferEncoder.encodedArgumentBuffer;
+    for (uint32_t slot = 0; slot < mtl::kMaxShaderBuffers && !buffersChanged; ++slot)
+    {
+        buffersChanged = bufferEncoder.encodedBuffers[slot].first.get() != buffers[slot].first ||
+                         bufferEncoder.encodedBuffers[slot].second != buffers[slot].second;
+    }
+
+    if (buffersChanged)
+    {
+        mtl::BufferRef argumentBuffer;
+        size_t argumentBufferOffset;
+        bufferEncoder.bufferPool.releaseInFlightBuffers(context);
+        ANGLE_TRY(bufferEncoder.bufferPool.allocate(
+            context, bufferEncoder.metalArgBufferEncoder.get().encodedLength, nullptr,
+            &argumentBuffer, &argumentBufferOffset));
+
+        [bufferEncoder.metalArgBufferEncoder setArgumentBuffer:argumentBuffer->get()
+                                                        offset:argumentBufferOffset];
+
+        for (uint32_t slot = 0; slot < mtl::kMaxShaderBuffers; ++slot)
+        {
+            bufferEncoder.encodedBuffers[slot] = buffers[slot];
+            if (buffers[slot].first)
+            {
+                [bufferEncoder.metalArgBufferEncoder setBuffer:buffers[slot].first
+                                                        offset:buffers[slot].second
+                                                       atIndex:slot];
+            }
+        }
+
+        ANGLE_TRY(bufferEncoder.bufferPool.commit(context));
+
+        bufferEncoder.encodedArgumentBuffer       = argumentBuffer;
+        bufferEncoder.encodedArgumentBufferOffset = argumentBufferOffset;
+    }
 
-    cmdEncoder->setBuffer(shaderType, argumentBuffer, static_cast<uint32_t>(argumentBufferOffset),
+    cmdEncoder->setBuffer(shaderType, bufferEncoder.encodedArgumentBuffer,
+                          static_cast<uint32_t>(bufferEncoder.encodedArgumentBufferOffset),
                           mtl::kUBOArgumentBufferBindingIndex);
     return angle::Result::Continue;
 }
@@ -28,6 +28,8 @@ class ProvokingVertexHelper : public mtl::ProvokingVertexCacheSpecializeShaderFa
     ProvokingVertexHelper(ContextMtl *context,
                           mtl::CommandQueue *commandQueue,
                           DisplayMtl *display);
+    // The rewritten indices are allocated from |indexBufferPool| if it's not null, so that the
+    // caller can keep them.  Otherwise they are only valid for the current draw.
     mtl::BufferRef preconditionIndexBuffer(ContextMtl *context,
                                            mtl::BufferRef indexBuffer,
                                            size_t indexCount,
@@ -35,10 +37,13 @@ class ProvokingVertexHelper : public mtl::ProvokingVertexCacheSpecializeShaderFa
                                            bool primitiveRestartEnabled,
                                            gl::PrimitiveMode primitiveMode,
                                            gl::DrawElementsType elementsType,
+                                           mtl::BufferPool *indexBufferPool,
                                            size_t &outIndexCount,
                                            size_t &outIndexOffset,
                                            gl::PrimitiveMode &outPrimitiveMode);
 
+    // The generated indices only depend on the draw parameters, so they are kept for the next
+    // draws with the same ones.
     mtl::BufferRef generateIndexBuffer(ContextMtl *context,
                                        size_t first,
                                        size_t indexCount,
@@ -54,6 +59,18 @@ class ProvokingVertexHelper : public mtl::ProvokingVertexCacheSpecializeShaderFa
     mtl::ComputeCommandEncoder *getComputeCommandEncoder();
 
   private:
+    struct GeneratedIndexBuffer
+    {
+        gl::PrimitiveMode primitiveMode;
+        gl::DrawElementsType elementsType;
+        size_t first;
+        size_t indexCount;
+
+        mtl::BufferRef buffer;
+        size_t outIndexCount;
+        gl::PrimitiveMode outPrimitiveMode;
+    };
+
     id<MTLLibrary> mProvokingVertexLibrary;
     mtl::CommandBuffer mCommandBuffer;
     mtl::BufferPool mIndexBuffers;
@@ -61,6 +78,10 @@ class ProvokingVertexHelper : public mtl::ProvokingVertexCacheSpecializeShaderFa
     mtl::ProvokingVertexComputePipelineDesc mCachedDesc;
     mtl::ComputeCommandEncoder mCurrentEncoder;
 
+    // The oldest entry is replaced once the limit is reached.
+    std::vector<GeneratedIndexBuffer> mGeneratedIndexBuffers;
+    size_t mNextGeneratedIndexBufferToReplace = 0;
+
     // Program cache
     virtual angle::Result getSpecializedShader(
         rx::mtl::Context *context,
@@ -20,6 +20,9 @@ namespace rx
 namespace
 {
 constexpr size_t kInitialIndexBufferSize = 0xFFFF;  // Initial 64k pool.
+
+// Maximum number of index buffers generated for array draws that are kept.
+constexpr size_t kMaxGeneratedIndexBuffers = 16;
 }
 static inline uint primCountForIndexCount(const uint fixIndexBufferKey, const uint indexCount)
 {
@@ -115,6 +118,7 @@ ProvokingVertexHelper::ProvokingVertexHelper(ContextMtl *context,
 void ProvokingVertexHelper::onDestroy(ContextMtl *context)
 {
     mIndexBuffers.destroy(context);
+    mGeneratedIndexBuffers.clear();
     mPipelineCache.clear();
 }
 
@@ -221,6 +225,7 @@ mtl::BufferRef ProvokingVertexHelper::preconditionIndexBuffer(ContextMtl *contex
                                                               bool primitiveRestartEnabled,
                                                               gl::PrimitiveMode primitiveMode,
                                                               gl::DrawElementsType elementsType,
+                                                              mtl::BufferPool *indexBufferPool,
                                                               size_t &outIndexCount,
                                                               size_t &outIndexOffset,
                                                               gl::PrimitiveMode &outPrimitiveMode)
@@ -229,6 +234,14 @@ mtl::BufferRef ProvokingVertexHelper::preconditionIndexBuffer(ContextMtl *contex
     // Upload index buffer
     // dispatch per-primitive?
     ensureCommandBufferReady();
+    if (indexBufferPool)
+    {
+        indexBufferPool->releaseInFlightBuffers(context);
+    }
+    else
+    {
+        indexBufferPool = &mIndexBuffers;
+    }
     mtl::ProvokingVertexComputePipelineDesc pipelineDesc;
     pipelineDesc.elementType             = (uint8_t)elementsType;
     pipelineDesc.primitiveMode           = primitiveMode;
@@ -240,8 +253,8 @@ mtl::BufferRef ProvokingVertexHelper::preconditionIndexBuffer(ContextMtl *contex
     size_t indexSize   = gl::GetDrawElementsTypeSize(elementsType);
     size_t newOffset   = 0;
     mtl::BufferRef newBuffer;
-    if (mIndexBuffers.allocate(context, newIndexCount * indexSize + indexOffset, nullptr,
-                               &newBuffer, &newOffset) == angle::Result::Stop)
+    if (indexBufferPool->allocate(context, newIndexCount * indexSize + indexOffset, nullptr,
+                                  &newBuffer, &newOffset) == angle::Result::Stop)
     {
         return nullptr;
     }
@@ -274,6 +287,18 @@ mtl::BufferRef ProvokingVertexHelper::generateIndexBuffer(ContextMtl *context,
                                                           size_t &outIndexOffset,
                                                           gl::PrimitiveMode &outPrimitiveMode)
 {
+    for (const GeneratedIndexBuffer &generated : mGeneratedIndexBuffers)
+    {
+        if (generated.primitiveMode == primitiveMode && generated.elementsType == elementsType &&
+            generated.first == first && generated.indexCount == indexCount)
+        {
+            outIndexCount    = generated.outIndexCount;
+            outIndexOffset   = 0;
+            outPrimitiveMode = generated.outPrimitiveMode;
+            return generated.buffer;
+        }
+    }
+
     // Get specialized program
     // Upload index buffer
     // dispatch per-primitive?
@@ -289,8 +314,9 @@ mtl::BufferRef ProvokingVertexHelper::generateIndexBuffer(ContextMtl *context,
     size_t indexSize      = gl::GetDrawElementsTypeSize(elementsType);
     size_t newIndexOffset = 0;
     mtl::BufferRef newBuffer;
-    if (mIndexBuffers.allocate(context, newIndexCount * indexSize, nullptr, &newBuffer,
-                               &newIndexOffset) == angle::Result::Stop)
+    // The buffer isn't taken from the pool, which recycles its buffers.
+    if (mtl::Buffer::MakeBuffer(context, newIndexCount * indexSize, nullptr, &newBuffer) ==
+        angle::Result::Stop)
     {
         return nullptr;
     }
@@ -312,6 +338,25 @@ mtl::BufferRef ProvokingVertexHelper::generateIndexBuffer(ContextMtl *context,
     outIndexCount    = newIndexCount;
     outIndexOffset   = newIndexOffset;
     outPrimitiveMode = getNewPrimitiveMode(indexBufferKey);
+
+    GeneratedIndexBuffer generated;
+    generated.primitiveMode    = primitiveMode;
+    generated.elementsType     = elementsType;
+    generated.first            = first;
+    generated.indexCount       = indexCount;
+    generated.buffer           = newBuffer;
+    generated.outIndexCount    = newIndexCount;
+    generated.outPrimitiveMode = outPrimitiveMode;
+    if (mGeneratedIndexBuffers.size() < kMaxGeneratedIndexBuffers)
+    {
+        mGeneratedIndexBuffers.push_back(generated);
+    }
+    else
+    {
+        mGeneratedIndexBuffers[mNextGeneratedIndexBufferToReplace] = generated;
+        mNextGeneratedIndexBufferToReplace =
+            (mNextGeneratedIndexBufferToReplace + 1) % kMaxGeneratedIndexBuffers;
+    }
     return newBuffer;
 }
 
@@ -44,6 +44,7 @@ angle::Result CreateOrResizeTexture(const gl::Context *context,
                                     uint32_t height,
                                     uint32_t samples,
                                     bool renderTargetOnly,
+                                    bool memoryless,
                                     mtl::TextureRef *textureOut)
 {
     ContextMtl *contextMtl = mtl::GetImpl(context);
@@ -54,9 +55,17 @@ angle::Result CreateOrResizeTexture(const gl::Context *context,
         size_t resourceSize = EstimateTextureSizeInBytes(format, width, height, 1, samples, 1);
         if (*textureOut)
         {
-            (*textureOut)->setEstimatedByteSize(resourceSize);
+            (*textureOut)->setEstimatedByteSize((*textureOut)->isMemoryless() ? 0 : resourceSize);
         }
     }
+    else if (memoryless)
+    {
+        // The texture is given memory the first time a render pass needs to load or store it.
+        ANGLE_TRY(mtl::Texture::MakeMemoryLess2DTexture(contextMtl, format, width, height, samples,
+                                                        /** renderTargetOnly */ renderTargetOnly,
+                                                        /** allowFormatView */ allowFormatView,
+                                                        textureOut));
+    }
     else if (samples > 1)
     {
         ANGLE_TRY(mtl::Texture::Make2DMSTexture(contextMtl, format, width, height, samples,
@@ -339,6 +348,8 @@ angle::Result SurfaceMtl::ensureCompanionTexturesSizeCorrect(const gl::Context *
                                                              const gl::Extents &size)
 {
     ContextMtl *contextMtl = mtl::GetImpl(context);
+    const bool memoryless =
+        contextMtl->getDisplay()->getFeatures().useMemorylessTransientAttachments.enabled;
 
     ASSERT(mColorTexture);
 
@@ -346,8 +357,10 @@ angle::Result SurfaceMtl::ensureCompanionTexturesSizeCorrect(const gl::Context *
     {
         mAutoResolveMSColorTexture =
             contextMtl->getDisplay()->getFeatures().allowMultisampleStoreAndResolve.enabled;
+        // Without auto resolve, the multisample texture is read to resolve it.
         ANGLE_TRY(CreateOrResizeTexture(context, mColorFormat, size.width, size.height, mSamples,
                                         /** renderTargetOnly */ mAutoResolveMSColorTexture,
+                                        memoryless && mAutoResolveMSColorTexture,
                                         &mMSColorTexture));
 
         if (mAutoResolveMSColorTexture)
@@ -364,7 +377,8 @@ angle::Result SurfaceMtl::ensureCompanionTexturesSizeCorrect(const gl::Context *
     if (mDepthFormat.valid() && (!mDepthTexture || mDepthTexture->sizeAt0() != size))
     {
         ANGLE_TRY(CreateOrResizeTexture(context, mDepthFormat, size.width, size.height, mSamples,
-                                        /** renderTargetOnly */ false, &mDepthTexture));
+                                        /** renderTargetOnly */ false, memoryless,
+                                        &mDepthTexture));
 
         mDepthRenderTarget.set(mDepthTexture, mtl::kZeroNativeMipLevel, 0, mDepthFormat);
     }
@@ -379,7 +393,8 @@ angle::Result SurfaceMtl::ensureCompanionTexturesSizeCorrect(const gl::Context *
         {
             ANGLE_TRY(CreateOrResizeTexture(context, mStencilFormat, size.width, size.height,
                                             mSamples,
-                                            /** renderTargetOnly */ false, &mStencilTexture));
+                                            /** renderTargetOnly */ false, memoryless,
+                                            &mStencilTexture));
         }
 
         mStencilRenderTarget.set(mStencilTexture, mtl::kZeroNativeMipLevel, 0, mStencilFormat);
@@ -761,7 +776,8 @@ angle::Result OffscreenSurfaceMtl::ensureTexturesSizeCorrect(const gl::Context *
     if (!mColorTexture || mColorTexture->sizeAt0() != mSize)
     {
         ANGLE_TRY(CreateOrResizeTexture(context, mColorFormat, mSize.width, mSize.height, 1,
-                                        /** renderTargetOnly */ false, &mColorTexture));
+                                        /** renderTargetOnly */ false, /** memoryless */ false,
+                                        &mColorTexture));
 
         mColorRenderTarget.set(mColorTexture, mtl::kZeroNativeMipLevel, 0, mColorFormat);
     }
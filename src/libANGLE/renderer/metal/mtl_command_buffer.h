@@ -498,6 +498,10 @@ class RenderCommandEncoder final : public CommandEncoder
     const RenderPassDesc &renderPassDesc() const { return mRenderPassDesc; }
     bool hasDrawCalls() const { return mHasDrawCalls; }
 
+    // When enabled, render passes with many draws are recorded in chunks which are encoded
+    // concurrently into the sub-encoders of a MTLParallelRenderCommandEncoder.
+    void setParallelEncodingEnabled(bool enabled) { mParallelEncodingEnabled = enabled; }
+
   private:
     // Override CommandEncoder
     id<MTLRenderCommandEncoder> get()
@@ -510,8 +514,13 @@ class RenderCommandEncoder final : public CommandEncoder
     void initWriteDependency(const TextureRef &texture);
 
     void finalizeLoadStoreAction(MTLRenderPassAttachmentDescriptor *objCRenderPassAttachment);
+    // Memoryless attachments can't be loaded or stored.
+    void finalizeMemorylessAttachments();
 
     void encodeMetalEncoder();
+    void encodeParallelChunks();
+    void onDrawRecorded();
+    void beginParallelChunk();
     void simulateDiscardFramebuffer();
     void endEncodingImpl(bool considerDiscardSimulation);
 
@@ -542,6 +551,16 @@ class RenderCommandEncoder final : public CommandEncoder
     RenderCommandEncoderStates mStateCache = {};
 
     bool mPipelineStateSet = false;
+
+    // Chunks recorded before mCommands when the render pass is split for parallel encoding.
+    // Every chunk but the first starts with the commands restoring the state that the previous
+    // chunks left behind, since each sub-encoder starts with the default state.
+    bool mParallelEncodingEnabled = false;
+    bool mParallelEncodingAllowed = true;
+    uint32_t mDrawsInChunk        = 0;
+    std::vector<IntermediateCommandStream> mParallelChunks;
+    // setBytes() data is not kept in mStateCache, so keep a copy to restore it in the next chunk.
+    gl::ShaderMap<std::array<std::vector<uint8_t>, kMaxShaderBuffers>> mBoundBytes;
 };
 
 class BlitCommandEncoder final : public CommandEncoder
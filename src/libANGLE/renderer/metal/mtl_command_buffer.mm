@@ -414,6 +414,43 @@ void PopDebugGroupCmd(id<MTLRenderCommandEncoder> encoder, IntermediateCommandSt
 using CommandEncoderFunc = void (*)(id<MTLRenderCommandEncoder>, IntermediateCommandStream *);
 constexpr CommandEncoderFunc gCommandEncoders[] = {ANGLE_MTL_CMD_X(ANGLE_MTL_CMD_MAP)};
 
+// Number of draws recorded in a chunk before the render pass is split for parallel encoding.
+constexpr uint32_t kDrawsPerParallelChunk = 256;
+
+void DecodeCommands(id<MTLRenderCommandEncoder> encoder, IntermediateCommandStream *stream)
+{
+    while (stream->good())
+    {
+        CmdType cmdType            = stream->fetch<CmdType>();
+        CommandEncoderFunc decoder = gCommandEncoders[static_cast<int>(cmdType)];
+        decoder(encoder, stream);
+    }
+
+    stream->clear();
+}
+
+template <typename Callback>
+void ForEachAttachment(const RenderPassDesc &desc, MTLRenderPassDescriptor *objCDesc, Callback cb)
+{
+    for (uint32_t i = 0; i < desc.numColorAttachments; ++i)
+    {
+        cb(desc.colorAttachments[i], objCDesc.colorAttachments[i]);
+    }
+    cb(desc.depthAttachment, objCDesc.depthAttachment);
+    cb(desc.stencilAttachment, objCDesc.stencilAttachment);
+}
+
+// The texture the render pass draws into, rather than the one it resolves into.
+const TextureRef &GetAttachmentRenderTexture(const RenderPassAttachmentDesc &attachment)
+{
+    return attachment.hasImplicitMSTexture() ? attachment.implicitMSTexture : attachment.texture;
+}
+
+bool IsStoringStoreAction(MTLStoreAction action)
+{
+    return action == MTLStoreActionStore || action == MTLStoreActionStoreAndMultisampleResolve;
+}
+
 NSString *cppLabelToObjC(const std::string &marker)
 {
     NSString *label = [NSString stringWithUTF8String:marker.c_str()];
@@ -1102,6 +1139,15 @@ void RenderCommandEncoder::reset()
     mRecording        = false;
     mPipelineStateSet = false;
     mCommands.clear();
+    mParallelChunks.clear();
+    mDrawsInChunk = 0;
+    for (gl::ShaderType shaderType : gl::AllShaderTypes())
+    {
+        for (std::vector<uint8_t> &bytes : mBoundBytes[shaderType])
+        {
+            bytes.clear();
+        }
+    }
 }
 
 void RenderCommandEncoder::finalizeLoadStoreAction(
@@ -1141,6 +1187,53 @@ void RenderCommandEncoder::finalizeLoadStoreAction(
     }
 }
 
+void RenderCommandEncoder::finalizeMemorylessAttachments()
+{
+    MTLRenderPassDescriptor *objCRenderPassDesc = mCachedRenderPassDescObjC.get();
+
+    // A render pass that stores a memoryless attachment needs it backed by memory from now on.
+    // This is done for all the attachments first, since depth and stencil may share a texture.
+    ForEachAttachment(
+        mRenderPassDesc, objCRenderPassDesc,
+        [](const RenderPassAttachmentDesc &attachment,
+           MTLRenderPassAttachmentDescriptor *objCAttachment) {
+            const TextureRef &texture = GetAttachmentRenderTexture(attachment);
+            if (texture && texture->isMemoryless() &&
+                IsStoringStoreAction(objCAttachment.storeAction) &&
+                !texture->allocatePersistentStorage())
+            {
+                ERR() << "Failed to allocate the storage of a memoryless attachment.";
+            }
+        });
+
+    ForEachAttachment(
+        mRenderPassDesc, objCRenderPassDesc,
+        [](const RenderPassAttachmentDesc &attachment,
+           MTLRenderPassAttachmentDescriptor *objCAttachment) {
+            const TextureRef &texture = GetAttachmentRenderTexture(attachment);
+            if (!texture || !objCAttachment.texture)
+            {
+                return;
+            }
+            objCAttachment.texture = texture->get();
+
+            if (texture->isMemoryless())
+            {
+                // The attachment was never stored, so there is no content to load.
+                if (objCAttachment.loadAction == MTLLoadActionLoad)
+                {
+                    objCAttachment.loadAction = MTLLoadActionDontCare;
+                }
+                if (IsStoringStoreAction(objCAttachment.storeAction))
+                {
+                    objCAttachment.storeAction = objCAttachment.resolveTexture
+                                                     ? MTLStoreActionMultisampleResolve
+                                                     : MTLStoreActionDontCare;
+                }
+            }
+        });
+}
+
 void RenderCommandEncoder::endEncoding()
 {
     endEncodingImpl(true);
@@ -1170,6 +1263,8 @@ void RenderCommandEncoder::endEncodingImpl(bool considerDiscardSimulation)
         mRenderPassDesc.stencilAttachment.storeAction;
     finalizeLoadStoreAction(objCRenderPassDesc.stencilAttachment);
 
+    finalizeMemorylessAttachments();
+
     // Set visibility result buffer
     if (mOcclusionQueryPool.getNumRenderPassAllocatedQueries())
     {
@@ -1279,6 +1374,18 @@ void RenderCommandEncoder::simulateDiscardFramebuffer()
 
 void RenderCommandEncoder::encodeMetalEncoder()
 {
+    if (!mParallelChunks.empty())
+    {
+        mParallelChunks.push_back(std::move(mCommands));
+        mCommands.clear();
+
+        if (mParallelEncodingAllowed)
+        {
+            encodeParallelChunks();
+            return;
+        }
+    }
+
     ANGLE_MTL_OBJC_SCOPE
     {
         ANGLE_MTL_LOG("Creating new render command encoder with desc: %@",
@@ -1301,15 +1408,157 @@ void RenderCommandEncoder::encodeMetalEncoder()
             metalCmdEncoder.label = mLabel;
         }
 
-        while (mCommands.good())
+        // The restore commands at the start of each chunk are redundant but harmless when the
+        // chunks are encoded back to back.
+        for (IntermediateCommandStream &chunk : mParallelChunks)
         {
-            CmdType cmdType            = mCommands.fetch<CmdType>();
-            CommandEncoderFunc encoder = gCommandEncoders[static_cast<int>(cmdType)];
-            encoder(metalCmdEncoder, &mCommands);
+            DecodeCommands(metalCmdEncoder, &chunk);
         }
+        mParallelChunks.clear();
 
-        mCommands.clear();
+        DecodeCommands(metalCmdEncoder, &mCommands);
+    }
+}
+
+void RenderCommandEncoder::encodeParallelChunks()
+{
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        ANGLE_MTL_LOG("Creating new parallel render command encoder with %zu chunks, desc: %@",
+                      mParallelChunks.size(), [mCachedRenderPassDescObjC description]);
+
+        id<MTLParallelRenderCommandEncoder> parallelEncoder = [cmdBuffer().get()
+            parallelRenderCommandEncoderWithDescriptor:mCachedRenderPassDescObjC];
+
+        // endEncoding() is called on the parallel encoder once all the sub-encoders are ended.
+        set(parallelEncoder);
+
+        // Verify that it was created successfully
+        ASSERT(get());
+
+        if (mLabel)
+        {
+            parallelEncoder.label = mLabel;
+        }
+
+        // The GPU executes the sub-encoders in their creation order, so they are all created
+        // here before any of them is encoded.
+        const size_t chunkCount = mParallelChunks.size();
+        NSMutableArray<id<MTLRenderCommandEncoder>> *subEncoders =
+            [NSMutableArray arrayWithCapacity:chunkCount];
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk)
+        {
+            id<MTLRenderCommandEncoder> subEncoder = [parallelEncoder renderCommandEncoder];
+            ASSERT(subEncoder);
+
+            // Work-around driver bug on iOS devices: stencil must be explicitly set to zero
+            // even if the doc says the default value is already zero.
+            [subEncoder setStencilReferenceValue:0];
+
+            [subEncoders addObject:subEncoder];
+        }
+
+        IntermediateCommandStream *chunks = mParallelChunks.data();
+        dispatch_apply(chunkCount, dispatch_get_global_queue(QOS_CLASS_USER_INTERACTIVE, 0),
+                       ^(size_t chunk) {
+                         ANGLE_MTL_OBJC_SCOPE
+                         {
+                             id<MTLRenderCommandEncoder> subEncoder = subEncoders[chunk];
+                             DecodeCommands(subEncoder, &chunks[chunk]);
+                             [subEncoder endEncoding];
+                         }
+                       });
+
+        mParallelChunks.clear();
+    }
+}
+
+void RenderCommandEncoder::onDrawRecorded()
+{
+    if (!mParallelEncodingEnabled || !mParallelEncodingAllowed ||
+        ++mDrawsInChunk < kDrawsPerParallelChunk)
+    {
+        return;
     }
+
+    beginParallelChunk();
+}
+
+void RenderCommandEncoder::beginParallelChunk()
+{
+    mParallelChunks.push_back(std::move(mCommands));
+    mCommands.clear();
+    mDrawsInChunk = 0;
+
+    // Record the current state again through the regular setters, which filter out what matches
+    // the default state of the new sub-encoder.
+    const RenderCommandEncoderStates states = mStateCache;
+    mStateCache.reset();
+
+    setRenderPipelineState(states.renderPipeline);
+    setTriangleFillMode(states.triangleFillMode);
+    setFrontFacingWinding(states.winding);
+    setCullMode(states.cullMode);
+    setDepthStencilState(states.depthStencilState);
+    setDepthBias(states.depthBias, states.depthSlopeScale, states.depthClamp);
+    setStencilRefVals(states.stencilFrontRef, states.stencilBackRef);
+    if (states.viewport.valid())
+    {
+        setViewport(states.viewport.value());
+    }
+    if (states.scissorRect.valid())
+    {
+        setScissorRect(states.scissorRect.value());
+    }
+    setBlendColor(states.blendColor[0], states.blendColor[1], states.blendColor[2],
+                  states.blendColor[3]);
+
+    for (gl::ShaderType shaderType : gl::AllShaderTypes())
+    {
+        if (mSetBufferCmds[shaderType] == static_cast<uint8_t>(CmdType::Invalid))
+        {
+            continue;
+        }
+
+        const RenderCommandEncoderShaderStates &shaderStates = states.perShaderStates[shaderType];
+        for (uint32_t index = 0; index < kMaxShaderBuffers; ++index)
+        {
+            if (shaderStates.buffers[index])
+            {
+                commonSetBuffer(shaderType, shaderStates.buffers[index],
+                                shaderStates.bufferOffsets[index], index);
+            }
+            else if (!mBoundBytes[shaderType][index].empty())
+            {
+                // setBytes() updates mBoundBytes, so pass it a copy.
+                const std::vector<uint8_t> bytes = mBoundBytes[shaderType][index];
+                setBytes(shaderType, bytes.data(), bytes.size(), index);
+            }
+        }
+
+        for (uint32_t index = 0; index < kMaxShaderSamplers; ++index)
+        {
+            if (shaderStates.samplers[index] && shaderStates.samplerLodClamps[index].valid())
+            {
+                const std::pair<float, float> &lodClampRange =
+                    shaderStates.samplerLodClamps[index].value();
+                setSamplerState(shaderType, shaderStates.samplers[index], lodClampRange.first,
+                                lodClampRange.second, index);
+            }
+
+            id<MTLTexture> mtlTexture = shaderStates.textures[index];
+            if (mtlTexture)
+            {
+                // The dependency on the texture was already tracked when it was first bound.
+                mStateCache.perShaderStates[shaderType].textures[index] = mtlTexture;
+                mCommands.push(static_cast<CmdType>(mSetTextureCmds[shaderType]))
+                    .push([mtlTexture ANGLE_MTL_RETAIN])
+                    .push(index);
+            }
+        }
+    }
+
+    setVisibilityResultMode(states.visibilityResultMode, states.visibilityResultBufferOffset);
 }
 
 RenderCommandEncoder &RenderCommandEncoder::restart(const RenderPassDesc &desc,
@@ -1336,6 +1585,8 @@ RenderCommandEncoder &RenderCommandEncoder::restart(const RenderPassDesc &desc,
     mRenderPassDesc           = desc;
     mRecording                = true;
     mHasDrawCalls             = false;
+    mParallelEncodingAllowed  = true;
+    mDrawsInChunk             = 0;
     mRenderPassMaxScissorRect = {.x      = 0,
                                  .y      = 0,
                                  .width  = std::numeric_limits<NSUInteger>::max(),
@@ -1599,6 +1850,11 @@ RenderCommandEncoder &RenderCommandEncoder::setBytes(gl::ShaderType shaderType,
     shaderStates.buffers[index]                    = nil;
     shaderStates.bufferOffsets[index]              = 0;
 
+    if (mParallelEncodingEnabled)
+    {
+        mBoundBytes[shaderType][index].assign(bytes, bytes + size);
+    }
+
     mCommands.push(static_cast<CmdType>(mSetBytesCmds[shaderType]))
         .push(size)
         .push(bytes, size)
@@ -1676,6 +1932,8 @@ RenderCommandEncoder &RenderCommandEncoder::draw(MTLPrimitiveType primitiveType,
     mHasDrawCalls = true;
     mCommands.push(CmdType::Draw).push(primitiveType).push(vertexStart).push(vertexCount);
 
+    onDrawRecorded();
+
     return *this;
 }
 
@@ -1693,6 +1951,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawInstanced(MTLPrimitiveType primi
         .push(vertexCount)
         .push(instances);
 
+    onDrawRecorded();
+
     return *this;
 }
 
@@ -1713,6 +1973,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawInstancedBaseInstance(
         .push(instances)
         .push(baseInstance);
 
+    onDrawRecorded();
+
     return *this;
 }
 
@@ -1739,6 +2001,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawIndexed(MTLPrimitiveType primiti
         .push([indexBuffer->get() ANGLE_MTL_RETAIN])
         .push(bufferOffset);
 
+    onDrawRecorded();
+
     return *this;
 }
 
@@ -1767,6 +2031,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawIndexedInstanced(MTLPrimitiveTyp
         .push(bufferOffset)
         .push(instances);
 
+    onDrawRecorded();
+
     return *this;
 }
 
@@ -1800,6 +2066,8 @@ RenderCommandEncoder &RenderCommandEncoder::drawIndexedInstancedBaseVertexBaseIn
         .push(baseVertex)
         .push(baseInstance);
 
+    onDrawRecorded();
+
     return *this;
 }
 
@@ -1829,6 +2097,9 @@ RenderCommandEncoder &RenderCommandEncoder::useResource(const BufferRef &resourc
 
     cmdBuffer().setReadDependency(resource);
 
+    // The resource residency would only apply to the sub-encoder it is recorded in.
+    mParallelEncodingAllowed = false;
+
     mCommands.push(CmdType::UseResource)
         .push([resource->get() ANGLE_MTL_RETAIN])
         .push(usage)
@@ -1848,6 +2119,9 @@ RenderCommandEncoder &RenderCommandEncoder::memoryBarrierWithResource(const Buff
 
     cmdBuffer().setWriteDependency(resource);
 
+    // Barriers do not order the draws of different sub-encoders.
+    mParallelEncodingAllowed = false;
+
     mCommands.push(CmdType::MemoryBarrierWithResource)
         .push([resource->get() ANGLE_MTL_RETAIN])
         .push(after)
@@ -1864,11 +2138,13 @@ void RenderCommandEncoder::insertDebugSignImpl(NSString *label)
 
 void RenderCommandEncoder::pushDebugGroup(NSString *label)
 {
-    // Defer the insertion until endEncoding()
+    // Defer the insertion until endEncoding().  Debug groups can't span sub-encoders.
+    mParallelEncodingAllowed = false;
     mCommands.push(CmdType::PushDebugGroup).push([label ANGLE_MTL_RETAIN]);
 }
 void RenderCommandEncoder::popDebugGroup()
 {
+    mParallelEncodingAllowed = false;
     mCommands.push(CmdType::PopDebugGroup);
 }
 
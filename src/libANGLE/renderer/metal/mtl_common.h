@@ -435,6 +435,13 @@ using SharedEventRef = AutoObjCPtr<id<MTLSharedEvent>>;
 using SharedEventRef = AutoObjCObj<NSObject>;
 #endif
 
+// NOTE: BinaryArchive is only declared on iOS 14.0+ or mac 11.0+
+#if defined(__IPHONE_14_0) || defined(__MAC_11_0)
+#    define ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE 1
+#else
+#    define ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE 0
+#endif
+
 // The native image index used by Metal back-end,  the image index uses native mipmap level instead
 // of "virtual" level modified by OpenGL's base level.
 using MipmapNativeLevel = gl::LevelIndexWrapper<uint32_t>;
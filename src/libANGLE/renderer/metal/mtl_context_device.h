@@ -48,6 +48,13 @@ class ContextDevice final : public WrappedObject<id<MTLDevice>>, angle::NonCopya
     AutoObjCPtr<id<MTLRenderPipelineState>> newRenderPipelineStateWithDescriptor(
         MTLRenderPipelineDescriptor *descriptor,
         __autoreleasing NSError **error) const;
+    AutoObjCPtr<id<MTLRenderPipelineState>> newRenderPipelineStateWithDescriptor(
+        MTLRenderPipelineDescriptor *descriptor,
+        MTLPipelineOption options,
+        __autoreleasing NSError **error) const;
+    void newRenderPipelineStateWithDescriptor(
+        MTLRenderPipelineDescriptor *descriptor,
+        MTLNewRenderPipelineStateCompletionHandler completionHandler) const;
 
     AutoObjCPtr<id<MTLLibrary>> newLibraryWithSource(NSString *source,
                                                      MTLCompileOptions *options,
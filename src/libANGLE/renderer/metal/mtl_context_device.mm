@@ -106,6 +106,24 @@ AutoObjCPtr<id<MTLRenderPipelineState>> ContextDevice::newRenderPipelineStateWit
     return adoptObjCObj([get() newRenderPipelineStateWithDescriptor:descriptor error:error]);
 }
 
+AutoObjCPtr<id<MTLRenderPipelineState>> ContextDevice::newRenderPipelineStateWithDescriptor(
+    MTLRenderPipelineDescriptor *descriptor,
+    MTLPipelineOption options,
+    __autoreleasing NSError **error) const
+{
+    return adoptObjCObj([get() newRenderPipelineStateWithDescriptor:descriptor
+                                                            options:options
+                                                         reflection:nil
+                                                              error:error]);
+}
+
+void ContextDevice::newRenderPipelineStateWithDescriptor(
+    MTLRenderPipelineDescriptor *descriptor,
+    MTLNewRenderPipelineStateCompletionHandler completionHandler) const
+{
+    [get() newRenderPipelineStateWithDescriptor:descriptor completionHandler:completionHandler];
+}
+
 AutoObjCPtr<id<MTLLibrary>> ContextDevice::newLibraryWithSource(
     NSString *source,
     MTLCompileOptions *options,
@@ -0,0 +1,61 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// mtl_library_cache.h:
+//    Defines the class interface for LibraryCache, a cache of the MTLLibrary objects compiled
+//    from the MSL generated by the translator.
+//
+
+#ifndef LIBANGLE_RENDERER_METAL_MTL_LIBRARY_CACHE_H_
+#define LIBANGLE_RENDERER_METAL_MTL_LIBRARY_CACHE_H_
+
+#import <Metal/Metal.h>
+
+#include <mutex>
+#include <string>
+
+#include "common/angleutils.h"
+#include "libANGLE/BlobCache.h"
+#include "libANGLE/SizedMRUCache.h"
+#include "libANGLE/renderer/metal/mtl_common.h"
+
+namespace rx
+{
+namespace mtl
+{
+class ContextDevice;
+
+// Libraries are keyed by the hash of the MSL source and of the options it is compiled with, so
+// that identical shaders linked in different programs, relinked, or loaded from the program cache
+// by any context of the display are compiled once.  Metal can't serialize a library compiled
+// from source, so the cache is in memory only; the compiled code of the pipelines is persisted
+// separately by PipelineArchive.
+class LibraryCache final : angle::NonCopyable
+{
+  public:
+    LibraryCache();
+    ~LibraryCache();
+
+    void destroy();
+
+    // Returns the library compiled from |source|, compiling it if it's not in the cache.  On
+    // failure, returns nil and the error is in |errorOut|.
+    AutoObjCPtr<id<MTLLibrary>> getOrCompileShaderLibrary(
+        const ContextDevice &metalDevice,
+        const std::string &source,
+        NSDictionary<NSString *, NSObject *> *substitutionMacros,
+        bool enableFastMath,
+        AutoObjCPtr<NSError *> *errorOut);
+
+  private:
+    std::mutex mMutex;
+    // The size of the entries is that of their source, as the size of the libraries is unknown.
+    angle::SizedMRUCache<egl::BlobCacheKey, AutoObjCPtr<id<MTLLibrary>>> mCache;
+};
+
+}  // namespace mtl
+}  // namespace rx
+
+#endif /* LIBANGLE_RENDERER_METAL_MTL_LIBRARY_CACHE_H_ */
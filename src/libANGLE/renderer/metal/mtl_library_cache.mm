@@ -0,0 +1,93 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// mtl_library_cache.mm:
+//    Implements the class methods for LibraryCache.
+//
+
+#include "libANGLE/renderer/metal/mtl_library_cache.h"
+
+#include <sstream>
+
+#include "libANGLE/renderer/metal/mtl_context_device.h"
+#include "libANGLE/renderer/metal/mtl_utils.h"
+
+namespace rx
+{
+namespace mtl
+{
+
+namespace
+{
+// Total size of the MSL source of the cached libraries.
+constexpr size_t kMaxCachedSourceSize = 16 * 1024 * 1024;
+
+void ComputeLibraryKey(const std::string &source,
+                       NSDictionary<NSString *, NSObject *> *substitutionMacros,
+                       bool enableFastMath,
+                       egl::BlobCacheKey *keyOut)
+{
+    // The description of a dictionary with string keys lists them in ascending order, so it
+    // doesn't depend on the order the macros were added in.
+    std::ostringstream hashStream;
+    if (substitutionMacros)
+    {
+        hashStream << substitutionMacros.description.UTF8String;
+    }
+    hashStream << enableFastMath << source;
+
+    const std::string &hashString = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(hashString.c_str()),
+                               hashString.length(), keyOut->data());
+}
+}  // anonymous namespace
+
+LibraryCache::LibraryCache() : mCache(kMaxCachedSourceSize) {}
+
+LibraryCache::~LibraryCache() = default;
+
+void LibraryCache::destroy()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    mCache.clear();
+}
+
+AutoObjCPtr<id<MTLLibrary>> LibraryCache::getOrCompileShaderLibrary(
+    const ContextDevice &metalDevice,
+    const std::string &source,
+    NSDictionary<NSString *, NSObject *> *substitutionMacros,
+    bool enableFastMath,
+    AutoObjCPtr<NSError *> *errorOut)
+{
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        egl::BlobCacheKey key;
+        ComputeLibraryKey(source, substitutionMacros, enableFastMath, &key);
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            const AutoObjCPtr<id<MTLLibrary>> *cachedLibrary = nullptr;
+            if (mCache.get(key, &cachedLibrary))
+            {
+                return *cachedLibrary;
+            }
+        }
+
+        // Compile without holding the lock, so that contexts compiling different shaders don't
+        // wait on each other.
+        AutoObjCPtr<id<MTLLibrary>> library =
+            CreateShaderLibrary(metalDevice, source, substitutionMacros, enableFastMath, errorOut);
+        if (library)
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mCache.put(key, AutoObjCPtr<id<MTLLibrary>>(library), source.size());
+        }
+
+        return library;
+    }
+}
+
+}  // namespace mtl
+}  // namespace rx
@@ -0,0 +1,73 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// mtl_pipeline_archive.h:
+//    Defines the class interface for PipelineArchive, a MTLBinaryArchive of the render pipelines
+//    created by a display, persisted in the blob cache.
+//
+
+#ifndef LIBANGLE_RENDERER_METAL_MTL_PIPELINE_ARCHIVE_H_
+#define LIBANGLE_RENDERER_METAL_MTL_PIPELINE_ARCHIVE_H_
+
+#import <Metal/Metal.h>
+
+#include <condition_variable>
+#include <mutex>
+
+#include "common/angleutils.h"
+#include "libANGLE/renderer/metal/mtl_common.h"
+
+namespace egl
+{
+class BlobCache;
+}  // namespace egl
+
+namespace rx
+{
+namespace mtl
+{
+
+// The archive is loaded from the blob cache on first use.  The functions of the render pipelines
+// that miss in it are added on a background thread, and the archive is stored back in the blob
+// cache by save().  Metal can't load an archive from or serialize it to memory, so the data goes
+// through files in the temporary directory.
+class PipelineArchive final : angle::NonCopyable
+{
+  public:
+    PipelineArchive();
+    ~PipelineArchive();
+
+    void destroy();
+
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+    // Returns nil if the archive can't be created, or the blob cache is not enabled.
+    id<MTLBinaryArchive> getArchive(id<MTLDevice> device, egl::BlobCache *blobCache);
+
+    void addRenderPipeline(MTLRenderPipelineDescriptor *descriptor);
+#endif
+
+    // Waits for the pending additions, and stores the archive in the blob cache if it changed.
+    void save(id<MTLDevice> device, egl::BlobCache *blobCache);
+
+  private:
+    void waitForPendingAdds();
+
+    std::mutex mMutex;
+    std::condition_variable mPendingAddsCondition;
+    size_t mPendingAdds = 0;
+    bool mLoaded        = false;
+    bool mDirty         = false;
+
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+    AutoObjCPtr<id<MTLBinaryArchive>> mArchive;
+#endif
+    // The file the archive was loaded from, which backs it until it is destroyed.
+    AutoObjCObj<NSURL> mLoadedFileURL;
+};
+
+}  // namespace mtl
+}  // namespace rx
+
+#endif /* LIBANGLE_RENDERER_METAL_MTL_PIPELINE_ARCHIVE_H_ */
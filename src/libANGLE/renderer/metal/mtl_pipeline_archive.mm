@@ -0,0 +1,233 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// mtl_pipeline_archive.mm:
+//    Implements the class methods for PipelineArchive.
+//
+
+#include "libANGLE/renderer/metal/mtl_pipeline_archive.h"
+
+#include <sstream>
+
+#include "common/apple_platform_utils.h"
+#include "common/debug.h"
+#include "libANGLE/BlobCache.h"
+
+namespace rx
+{
+namespace mtl
+{
+
+namespace
+{
+
+void ComputePipelineArchiveKey(id<MTLDevice> device, egl::BlobCache::Key *keyOut)
+{
+    // Archives are only compatible with the device and the OS version they were created with.
+    std::ostringstream hashStream("ANGLE Metal render pipeline archive: ", std::ios_base::ate);
+    hashStream << device.name.UTF8String << std::hex << device.registryID;
+    hashStream << [NSProcessInfo processInfo].operatingSystemVersionString.UTF8String;
+
+    const std::string &hashString = hashStream.str();
+    angle::base::SHA1HashBytes(reinterpret_cast<const unsigned char *>(hashString.c_str()),
+                               hashString.length(), keyOut->data());
+}
+
+NSURL *NewTemporaryFileURL()
+{
+    NSString *fileName =
+        [NSString stringWithFormat:@"angle-pipeline-archive-%@.metallib", [NSUUID UUID].UUIDString];
+    return [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:fileName]];
+}
+
+void RemoveFile(NSURL *fileURL)
+{
+    [[NSFileManager defaultManager] removeItemAtURL:fileURL error:nil];
+}
+
+}  // anonymous namespace
+
+PipelineArchive::PipelineArchive() {}
+
+PipelineArchive::~PipelineArchive()
+{
+    ASSERT(mPendingAdds == 0);
+}
+
+void PipelineArchive::destroy()
+{
+    waitForPendingAdds();
+
+    std::lock_guard<std::mutex> lock(mMutex);
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+    mArchive = nil;
+#endif
+    if (mLoadedFileURL)
+    {
+        RemoveFile(mLoadedFileURL);
+        mLoadedFileURL = nil;
+    }
+    mLoaded = false;
+    mDirty  = false;
+}
+
+void PipelineArchive::waitForPendingAdds()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mPendingAddsCondition.wait(lock, [this] { return mPendingAdds == 0; });
+}
+
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+id<MTLBinaryArchive> PipelineArchive::getArchive(id<MTLDevice> device, egl::BlobCache *blobCache)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mLoaded)
+    {
+        return mArchive;
+    }
+
+    // Without a blob cache, the archive would only duplicate the work of the Metal shader cache.
+    if (!blobCache || !blobCache->isCachingEnabled())
+    {
+        return nil;
+    }
+
+    mLoaded = true;
+    if (!ANGLE_APPLE_AVAILABLE_XCI(11.0, 14.0, 14.0))
+    {
+        return nil;
+    }
+
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        MTLBinaryArchiveDescriptor *desc =
+            [[[MTLBinaryArchiveDescriptor alloc] init] ANGLE_MTL_AUTORELEASE];
+
+        egl::BlobCache::Key key;
+        ComputePipelineArchiveKey(device, &key);
+
+        angle::ScratchBuffer scratchBuffer;
+        egl::BlobCache::Value compressedData;
+        size_t compressedSize = 0;
+        angle::MemoryBuffer data;
+        if (blobCache->get(&scratchBuffer, key, &compressedData, &compressedSize) &&
+            egl::DecompressBlobCacheData(compressedData.data(), compressedSize, &data))
+        {
+            NSURL *fileURL   = NewTemporaryFileURL();
+            NSData *fileData = [NSData dataWithBytesNoCopy:data.data()
+                                                    length:data.size()
+                                              freeWhenDone:NO];
+            if ([fileData writeToURL:fileURL atomically:NO])
+            {
+                mLoadedFileURL = fileURL;
+                desc.url       = fileURL;
+            }
+        }
+
+        NSError *err = nil;
+        mArchive     = adoptObjCObj([device newBinaryArchiveWithDescriptor:desc error:&err]);
+        if (!mArchive && desc.url)
+        {
+            // The cached archive may be from an incompatible driver, start from an empty one.
+            WARN() << "Failed to load the render pipeline archive: "
+                   << FormatMetalErrorMessage(err);
+            desc.url = nil;
+            err      = nil;
+            mArchive = adoptObjCObj([device newBinaryArchiveWithDescriptor:desc error:&err]);
+        }
+
+        if (!mArchive)
+        {
+            WARN() << "Failed to create the render pipeline archive: "
+                   << FormatMetalErrorMessage(err);
+        }
+    }
+
+    return mArchive;
+}
+
+void PipelineArchive::addRenderPipeline(MTLRenderPipelineDescriptor *descriptor)
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (!mArchive)
+        {
+            return;
+        }
+        ++mPendingAdds;
+    }
+
+    // Adding the functions compiles them again, which shouldn't delay the draw that needed the
+    // pipeline.  The descriptor is copied since the caller may modify it afterwards.
+    MTLRenderPipelineDescriptor *descriptorCopy = [[descriptor copy] ANGLE_MTL_AUTORELEASE];
+    dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+      ANGLE_MTL_OBJC_SCOPE
+      {
+          std::lock_guard<std::mutex> lock(mMutex);
+          NSError *err = nil;
+          if ([mArchive.get() addRenderPipelineFunctionsWithDescriptor:descriptorCopy error:&err])
+          {
+              mDirty = true;
+          }
+          else
+          {
+              WARN() << "Failed to add a render pipeline to the archive: "
+                     << FormatMetalErrorMessage(err);
+          }
+
+          --mPendingAdds;
+          mPendingAddsCondition.notify_all();
+      }
+    });
+}
+#endif
+
+void PipelineArchive::save(id<MTLDevice> device, egl::BlobCache *blobCache)
+{
+    waitForPendingAdds();
+
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mDirty || !mArchive || !blobCache)
+    {
+        return;
+    }
+
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        // The archive may still read from the file it was loaded from, so serialize it to a new
+        // one.
+        NSURL *fileURL = NewTemporaryFileURL();
+        NSError *err   = nil;
+        if (![mArchive.get() serializeToURL:fileURL error:&err])
+        {
+            WARN() << "Failed to serialize the render pipeline archive: "
+                   << FormatMetalErrorMessage(err);
+            RemoveFile(fileURL);
+            return;
+        }
+
+        NSData *fileData = [NSData dataWithContentsOfURL:fileURL];
+        RemoveFile(fileURL);
+
+        angle::MemoryBuffer compressedData;
+        if (!fileData ||
+            !egl::CompressBlobCacheData(fileData.length,
+                                        static_cast<const uint8_t *>(fileData.bytes),
+                                        &compressedData))
+        {
+            return;
+        }
+
+        egl::BlobCache::Key key;
+        ComputePipelineArchiveKey(device, &key);
+        blobCache->put(key, std::move(compressedData));
+        mDirty = false;
+    }
+#endif
+}
+
+}  // namespace mtl
+}  // namespace rx
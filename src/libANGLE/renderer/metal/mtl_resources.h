@@ -127,6 +127,9 @@ class Texture final : public Resource,
                                                  const Format &format,
                                                  uint32_t width,
                                                  uint32_t height,
+                                                 uint32_t samples,
+                                                 bool renderTargetOnly,
+                                                 bool allowFormatView,
                                                  TextureRef *refOut);
 
     static angle::Result MakeCubeTexture(ContextMtl *context,
@@ -238,6 +241,13 @@ class Texture final : public Resource,
 
     angle::Result resize(ContextMtl *context, uint32_t width, uint32_t height);
 
+    // A memoryless texture only lives in tile memory, so it can only be a render pass attachment
+    // that is neither loaded nor stored.
+    bool isMemoryless() const;
+    // Replaces a memoryless texture with one backed by memory, with the usage it was created for.
+    // The content is undefined.  Returns false if the texture couldn't be allocated.
+    bool allocatePersistentStorage();
+
     // For render target
     MTLColorWriteMask getColorWritableMask() const { return *mColorWritableMask; }
     void setColorWritableMask(MTLColorWriteMask mask) { *mColorWritableMask = mask; }
@@ -325,6 +335,8 @@ class Texture final : public Resource,
     void syncContentIfNeeded(ContextMtl *context);
 
     AutoObjCObj<MTLTextureDescriptor> mCreationDesc;
+    // The usage of a memoryless texture once it is backed by memory.
+    MTLTextureUsage mPersistentUsage = MTLTextureUsageUnknown;
 
     // This property is shared between this object and its views:
     std::shared_ptr<MTLColorWriteMask> mColorWritableMask;
@@ -130,17 +130,23 @@ angle::Result Texture::MakeMemoryLess2DTexture(ContextMtl *context,
                                                const Format &format,
                                                uint32_t width,
                                                uint32_t height,
+                                               uint32_t samples,
+                                               bool renderTargetOnly,
+                                               bool allowFormatView,
                                                TextureRef *refOut)
 {
     ANGLE_MTL_OBJC_SCOPE
     {
-        MTLTextureDescriptor *desc =
-            [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:format.metalFormat
-                                                               width:width
-                                                              height:height
-                                                           mipmapped:NO];
+        MTLTextureDescriptor *desc = [[MTLTextureDescriptor new] ANGLE_MTL_AUTORELEASE];
+        desc.textureType           = samples > 1 ? MTLTextureType2DMultisample : MTLTextureType2D;
+        desc.pixelFormat           = format.metalFormat;
+        desc.width                 = width;
+        desc.height                = height;
+        desc.mipmapLevelCount      = 1;
+        desc.sampleCount           = std::max(samples, 1u);
 
-        return MakeTexture(context, format, desc, 1, true, false, true, refOut);
+        return MakeTexture(context, format, desc, 1, renderTargetOnly, allowFormatView, true,
+                           refOut);
     }  // ANGLE_MTL_OBJC_SCOPE
 }
 /** static */
@@ -405,6 +411,15 @@ Texture::Texture(ContextMtl *context,
             desc.usage = desc.usage | MTLTextureUsagePixelFormatView;
         }
 
+#if (TARGET_OS_IOS || TARGET_OS_TV) && !TARGET_OS_MACCATALYST
+        if (memoryLess)
+        {
+            // Memoryless textures can only be render targets.
+            mPersistentUsage = desc.usage;
+            desc.usage       = MTLTextureUsageRenderTarget;
+        }
+#endif
+
         set(metalDevice.newTextureWithDescriptor(desc));
 
         mCreationDesc.retainAssign(desc);
@@ -787,6 +802,44 @@ angle::Result Texture::resize(ContextMtl *context, uint32_t width, uint32_t heig
     return angle::Result::Continue;
 }
 
+bool Texture::isMemoryless() const
+{
+#if (TARGET_OS_IOS || TARGET_OS_TV) && !TARGET_OS_MACCATALYST
+    return get().storageMode == MTLStorageModeMemoryless;
+#else
+    return false;
+#endif
+}
+
+bool Texture::allocatePersistentStorage()
+{
+    if (!isMemoryless())
+    {
+        return true;
+    }
+
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        ASSERT(mCreationDesc);
+        MTLTextureDescriptor *newDesc = [[mCreationDesc.get() copy] ANGLE_MTL_AUTORELEASE];
+        newDesc.resourceOptions       = MTLResourceStorageModePrivate;
+        newDesc.usage                 = mPersistentUsage;
+
+        id<MTLDevice> device = get().device;
+        AutoObjCPtr<id<MTLTexture>> newTexture =
+            adoptObjCObj([device newTextureWithDescriptor:newDesc]);
+        if (!newTexture)
+        {
+            return false;
+        }
+        mCreationDesc.retainAssign(newDesc);
+        set(newTexture);
+        setEstimatedByteSize([device heapTextureSizeAndAlignWithDescriptor:newDesc].size);
+    }
+
+    return true;
+}
+
 TextureRef Texture::getLinearColorView()
 {
     if (mLinearColorView)
@@ -517,6 +517,7 @@ class RenderPipelineCache final : angle::NonCopyable
   private:
     void clearPipelineStates();
     void recreatePipelineStates(ContextMtl *context);
+    void recreatePipelineStatesAsync(ContextMtl *context);
     AutoObjCPtr<id<MTLRenderPipelineState>> insertRenderPipelineState(
         ContextMtl *context,
         const RenderPipelineDesc &desc,
@@ -525,6 +526,10 @@ class RenderPipelineCache final : angle::NonCopyable
         ContextMtl *context,
         const RenderPipelineDesc &desc,
         bool insertDefaultAttribLayout);
+    AutoObjCObj<MTLRenderPipelineDescriptor> createRenderPipelineDescriptor(
+        ContextMtl *context,
+        const RenderPipelineDesc &desc,
+        bool insertDefaultAttribLayout);
 
     bool hasDefaultAttribs(const RenderPipelineDesc &desc) const;
 
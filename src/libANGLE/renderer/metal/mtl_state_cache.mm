@@ -10,11 +10,15 @@
 
 #include "libANGLE/renderer/metal/mtl_state_cache.h"
 
+#include <condition_variable>
+#include <mutex>
 #include <sstream>
 
+#include "common/apple_platform_utils.h"
 #include "common/debug.h"
 #include "common/hash_utils.h"
 #include "libANGLE/renderer/metal/ContextMtl.h"
+#include "libANGLE/renderer/metal/DisplayMtl.h"
 #include "libANGLE/renderer/metal/mtl_resources.h"
 #include "libANGLE/renderer/metal/mtl_utils.h"
 #include "platform/FeaturesMtl_autogen.h"
@@ -949,6 +953,63 @@ AutoObjCPtr<id<MTLRenderPipelineState>> RenderPipelineCache::insertRenderPipelin
 }
 
 AutoObjCPtr<id<MTLRenderPipelineState>> RenderPipelineCache::createRenderPipelineState(
+    ContextMtl *context,
+    const RenderPipelineDesc &desc,
+    bool insertDefaultAttribLayout)
+{
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        AutoObjCObj<MTLRenderPipelineDescriptor> objCDesc =
+            createRenderPipelineDescriptor(context, desc, insertDefaultAttribLayout);
+        if (!objCDesc)
+        {
+            return nil;
+        }
+
+        const mtl::ContextDevice &metalDevice = context->getMetalDevice();
+        NSError *err                          = nil;
+        bool usesArchive                      = false;
+
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+        if (ANGLE_APPLE_AVAILABLE_XCI(11.0, 14.0, 14.0))
+        {
+            usesArchive = objCDesc.get().binaryArchives.count > 0;
+        }
+        if (usesArchive)
+        {
+            // Look the pipeline up in the archive first, so that only the misses are added to it.
+            AutoObjCPtr<id<MTLRenderPipelineState>> archivedState =
+                metalDevice.newRenderPipelineStateWithDescriptor(
+                    objCDesc, MTLPipelineOptionFailOnBinaryArchiveMiss, &err);
+            if (archivedState)
+            {
+                return archivedState;
+            }
+            err = nil;
+        }
+#endif
+
+        // Create pipeline state
+        auto newState = metalDevice.newRenderPipelineStateWithDescriptor(objCDesc, &err);
+        if (err)
+        {
+            ANGLE_MTL_HANDLE_ERROR(context, mtl::FormatMetalErrorMessage(err).c_str(),
+                                   GL_INVALID_OPERATION);
+            return nil;
+        }
+
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+        if (usesArchive)
+        {
+            context->getDisplay()->getRenderPipelineArchive().addRenderPipeline(objCDesc);
+        }
+#endif
+
+        return newState;
+    }
+}
+
+AutoObjCObj<MTLRenderPipelineDescriptor> RenderPipelineCache::createRenderPipelineDescriptor(
     ContextMtl *context,
     const RenderPipelineDesc &originalDesc,
     bool insertDefaultAttribLayout)
@@ -1039,22 +1100,32 @@ AutoObjCPtr<id<MTLRenderPipelineState>> RenderPipelineCache::createRenderPipelin
             [objCDesc.get().vertexDescriptor.layouts setObject:defaultAttribLayoutObjCDesc
                                             atIndexedSubscript:kDefaultAttribsBindingIndex];
         }
-        // Create pipeline state
-        NSError *err  = nil;
-        auto newState = metalDevice.newRenderPipelineStateWithDescriptor(objCDesc, &err);
-        if (err)
+
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+        DisplayMtl *display = context->getDisplay();
+        if (display->getFeatures().useBinaryArchiveForRenderPipelines.enabled)
         {
-            ANGLE_MTL_HANDLE_ERROR(context, mtl::FormatMetalErrorMessage(err).c_str(),
-                                   GL_INVALID_OPERATION);
-            return nil;
+            id<MTLBinaryArchive> archive = display->getRenderPipelineArchive().getArchive(
+                display->getMetalDevice(), display->getBlobCache());
+            if (archive)
+            {
+                objCDesc.get().binaryArchives = @[ archive ];
+            }
         }
+#endif
 
-        return newState;
+        return objCDesc;
     }
 }
 
 void RenderPipelineCache::recreatePipelineStates(ContextMtl *context)
 {
+    if (context->getDisplay()->getFeatures().createRenderPipelinesAsynchronously.enabled)
+    {
+        recreatePipelineStatesAsync(context);
+        return;
+    }
+
     for (int hasDefaultAttrib = 0; hasDefaultAttrib <= 1; ++hasDefaultAttrib)
     {
         for (auto &ite : mRenderPipelineStates[hasDefaultAttrib])
@@ -1069,6 +1140,86 @@ void RenderPipelineCache::recreatePipelineStates(ContextMtl *context)
     }
 }
 
+void RenderPipelineCache::recreatePipelineStatesAsync(ContextMtl *context)
+{
+    // All the pipeline states are needed again, so create them concurrently through the
+    // completion handler API and wait for all of them.
+    struct PendingPipelineStates
+    {
+        std::mutex mutex;
+        std::condition_variable condition;
+        size_t count = 0;
+        std::string errorMessage;
+    };
+
+    ANGLE_MTL_OBJC_SCOPE
+    {
+        const mtl::ContextDevice &metalDevice = context->getMetalDevice();
+        PendingPipelineStates pendingStates;
+        PendingPipelineStates *pending = &pendingStates;
+        std::vector<AutoObjCObj<MTLRenderPipelineDescriptor>> objCDescs;
+
+        for (int hasDefaultAttrib = 0; hasDefaultAttrib <= 1; ++hasDefaultAttrib)
+        {
+            for (auto &ite : mRenderPipelineStates[hasDefaultAttrib])
+            {
+                if (ite.second == nil)
+                {
+                    continue;
+                }
+
+                AutoObjCObj<MTLRenderPipelineDescriptor> objCDesc =
+                    createRenderPipelineDescriptor(context, ite.first, hasDefaultAttrib);
+                ite.second = nil;
+                if (!objCDesc)
+                {
+                    continue;
+                }
+                objCDescs.push_back(objCDesc);
+
+                // The table is not modified until all the handlers have run.
+                AutoObjCPtr<id<MTLRenderPipelineState>> *stateOut = &ite.second;
+                {
+                    std::lock_guard<std::mutex> lock(pending->mutex);
+                    ++pending->count;
+                }
+                metalDevice.newRenderPipelineStateWithDescriptor(
+                    objCDesc, ^(id<MTLRenderPipelineState> state, NSError *error) {
+                      std::lock_guard<std::mutex> lock(pending->mutex);
+                      *stateOut = state;
+                      if (!state && pending->errorMessage.empty())
+                      {
+                          pending->errorMessage = mtl::FormatMetalErrorMessage(error);
+                      }
+                      --pending->count;
+                      pending->condition.notify_one();
+                    });
+            }
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(pending->mutex);
+            pending->condition.wait(lock, [pending] { return pending->count == 0; });
+        }
+
+        if (!pendingStates.errorMessage.empty())
+        {
+            ANGLE_MTL_HANDLE_ERROR(context, pendingStates.errorMessage.c_str(),
+                                   GL_INVALID_OPERATION);
+        }
+
+#if ANGLE_MTL_BINARY_ARCHIVE_AVAILABLE
+        if (context->getDisplay()->getFeatures().useBinaryArchiveForRenderPipelines.enabled)
+        {
+            for (AutoObjCObj<MTLRenderPipelineDescriptor> &objCDesc : objCDescs)
+            {
+                context->getDisplay()->getRenderPipelineArchive().addRenderPipeline(objCDesc);
+            }
+        }
+#endif
+    }
+}
+
 void RenderPipelineCache::clear()
 {
     mVertexShader   = nil;
@@ -18,6 +18,7 @@
 #include "libANGLE/Context.h"
 #include "libANGLE/Context.inl.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/ContextImpl.h"
 #include "libANGLE/renderer/Format.h"
@@ -25,6 +26,9 @@
 
 #include <string.h>
 #include <cctype>
+#include <functional>
+#include <utility>
+#include <thread>
 
 namespace angle
 {
@@ -354,6 +358,88 @@ void RotateRectangle(const SurfaceRotation rotation,
     }
 }
 
+void EarlyAdjustFlipYForPreRotation(SurfaceRotation blitAngleIn,
+                                    SurfaceRotation *blitAngleOut,
+                                    bool *blitFlipYOut)
+{
+    switch (blitAngleIn)
+    {
+        case SurfaceRotation::Identity:
+            // No adjustments needed
+            break;
+        case SurfaceRotation::Rotated90Degrees:
+            *blitAngleOut = SurfaceRotation::Rotated90Degrees;
+            *blitFlipYOut = false;
+            break;
+        case SurfaceRotation::Rotated180Degrees:
+            *blitAngleOut = SurfaceRotation::Rotated180Degrees;
+            break;
+        case SurfaceRotation::Rotated270Degrees:
+            *blitAngleOut = SurfaceRotation::Rotated270Degrees;
+            *blitFlipYOut = false;
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
+void AdjustBlitAreaForPreRotation(SurfaceRotation framebufferAngle,
+                                  const gl::Rectangle &blitAreaIn,
+                                  const gl::Rectangle &framebufferDimensions,
+                                  gl::Rectangle *blitAreaOut)
+{
+    switch (framebufferAngle)
+    {
+        case SurfaceRotation::Identity:
+            // No adjustments needed
+            break;
+        case SurfaceRotation::Rotated90Degrees:
+            blitAreaOut->x = blitAreaIn.y;
+            blitAreaOut->y = blitAreaIn.x;
+            std::swap(blitAreaOut->width, blitAreaOut->height);
+            break;
+        case SurfaceRotation::Rotated180Degrees:
+            blitAreaOut->x = framebufferDimensions.width - blitAreaIn.x - blitAreaIn.width;
+            blitAreaOut->y = framebufferDimensions.height - blitAreaIn.y - blitAreaIn.height;
+            break;
+        case SurfaceRotation::Rotated270Degrees:
+            blitAreaOut->x = framebufferDimensions.height - blitAreaIn.y - blitAreaIn.height;
+            blitAreaOut->y = framebufferDimensions.width - blitAreaIn.x - blitAreaIn.width;
+            std::swap(blitAreaOut->width, blitAreaOut->height);
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
+void AdjustDimensionsAndFlipForPreRotation(SurfaceRotation framebufferAngle,
+                                           gl::Rectangle *framebufferDimensions,
+                                           bool *flipX,
+                                           bool *flipY)
+{
+    switch (framebufferAngle)
+    {
+        case SurfaceRotation::Identity:
+            // No adjustments needed
+            break;
+        case SurfaceRotation::Rotated90Degrees:
+            std::swap(framebufferDimensions->width, framebufferDimensions->height);
+            std::swap(*flipX, *flipY);
+            break;
+        case SurfaceRotation::Rotated180Degrees:
+            break;
+        case SurfaceRotation::Rotated270Degrees:
+            std::swap(framebufferDimensions->width, framebufferDimensions->height);
+            std::swap(*flipX, *flipY);
+            break;
+        default:
+            UNREACHABLE();
+            break;
+    }
+}
+
 PackPixelsParams::PackPixelsParams()
     : destFormat(nullptr),
       outputPitch(0),
@@ -528,6 +614,67 @@ const FastCopyFunctionMap::Entry *getEntry(const FastCopyFunctionMap::Entry *ent
     return nullptr;
 }
 
+// Below this size of the output, an image is converted or filtered on the calling thread.
+constexpr size_t kMinParallelImageBytes = 4 * 1024 * 1024;
+// The smallest band of the output processed on a worker thread.
+constexpr size_t kMinParallelImageBandBytes = 1024 * 1024;
+
+// Processes the units, rows or slices, in the range given to it.
+using ImageBandFunction = std::function<void(size_t bandStart, size_t bandUnitCount)>;
+
+class ImageBandTask final : public angle::Closure
+{
+  public:
+    ImageBandTask(const ImageBandFunction &bandFunction, size_t bandStart, size_t bandUnitCount)
+        : mBandFunction(bandFunction), mBandStart(bandStart), mBandUnitCount(bandUnitCount)
+    {}
+
+    void operator()() override { mBandFunction(mBandStart, mBandUnitCount); }
+
+  private:
+    const ImageBandFunction &mBandFunction;
+    size_t mBandStart;
+    size_t mBandUnitCount;
+};
+
+// Splits the units of the image in bands, and processes the first band on this thread while the
+// worker threads process the rest.
+void ProcessImageInBands(const std::shared_ptr<angle::WorkerThreadPool> &workerThreadPool,
+                         size_t unitCount,
+                         size_t outputBytes,
+                         const ImageBandFunction &bandFunction)
+{
+    size_t bandCount = 1;
+    if (workerThreadPool && workerThreadPool->isAsync() && outputBytes >= kMinParallelImageBytes)
+    {
+        bandCount = std::min<size_t>({std::max(std::thread::hardware_concurrency(), 1u),
+                                      outputBytes / kMinParallelImageBandBytes, unitCount});
+    }
+
+    if (bandCount <= 1)
+    {
+        bandFunction(0, unitCount);
+        return;
+    }
+
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitableEvents;
+    for (size_t band = 1; band < bandCount; ++band)
+    {
+        const size_t bandStart = unitCount * band / bandCount;
+        auto task              = std::make_shared<ImageBandTask>(
+            bandFunction, bandStart, unitCount * (band + 1) / bandCount - bandStart);
+        waitableEvents.push_back(angle::WorkerThreadPool::PostWorkerTask(
+            workerThreadPool, std::move(task), angle::WorkerTaskPriority::High));
+    }
+
+    bandFunction(0, unitCount / bandCount);
+
+    // The tasks reference the band function, so they must be done before it goes away.
+    for (std::shared_ptr<angle::WaitableEvent> &waitableEvent : waitableEvents)
+    {
+        waitableEvent->wait();
+    }
+}
 }  // namespace
 
 FastCopyFunction FastCopyFunctionMap::get(angle::FormatID formatID) const
@@ -536,6 +683,64 @@ FastCopyFunction FastCopyFunctionMap::get(angle::FormatID formatID) const
     return entry ? entry->func : nullptr;
 }
 
+void LoadImageInParallel(const std::shared_ptr<angle::WorkerThreadPool> &workerThreadPool,
+                         LoadImageFunction loadFunction,
+                         size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch)
+{
+    // 3D images are split along their slices, and others along their rows.
+    const bool splitSlices       = depth > 1;
+    const size_t unitCount       = splitSlices ? depth : height;
+    const size_t inputUnitPitch  = splitSlices ? inputDepthPitch : inputRowPitch;
+    const size_t outputUnitPitch = splitSlices ? outputDepthPitch : outputRowPitch;
+
+    ProcessImageInBands(
+        workerThreadPool, unitCount, unitCount * outputUnitPitch,
+        [&](size_t bandStart, size_t bandUnitCount) {
+            loadFunction(width, splitSlices ? height : bandUnitCount,
+                         splitSlices ? bandUnitCount : 1, input + bandStart * inputUnitPitch,
+                         inputRowPitch, inputDepthPitch, output + bandStart * outputUnitPitch,
+                         outputRowPitch, outputDepthPitch);
+        });
+}
+
+void GenerateMipInParallel(const std::shared_ptr<angle::WorkerThreadPool> &workerThreadPool,
+                           MipGenerationFunction mipGenerationFunction,
+                           size_t sourceWidth,
+                           size_t sourceHeight,
+                           size_t sourceDepth,
+                           const uint8_t *sourceData,
+                           size_t sourceRowPitch,
+                           size_t sourceDepthPitch,
+                           uint8_t *destData,
+                           size_t destRowPitch,
+                           size_t destDepthPitch)
+{
+    // The rows of the destination are split, so that every band filters its own pairs of source
+    // rows.  The last band keeps the odd source row, if any, so that it picks the same filter.
+    const size_t mipHeight = std::max<size_t>(1, sourceHeight >> 1);
+    const size_t mipDepth  = std::max<size_t>(1, sourceDepth >> 1);
+
+    ProcessImageInBands(
+        workerThreadPool, mipHeight, mipHeight * destRowPitch * mipDepth,
+        [&](size_t bandStart, size_t bandRowCount) {
+            const size_t bandSourceHeight = bandStart + bandRowCount == mipHeight
+                                                ? sourceHeight - bandStart * 2
+                                                : bandRowCount * 2;
+            mipGenerationFunction(sourceWidth, bandSourceHeight, sourceDepth,
+                                  sourceData + bandStart * 2 * sourceRowPitch, sourceRowPitch,
+                                  sourceDepthPitch, destData + bandStart * destRowPitch,
+                                  destRowPitch, destDepthPitch);
+        });
+}
+
 bool ShouldUseDebugLayers(const egl::AttributeMap &attribs)
 {
     EGLAttrib debugSetting =
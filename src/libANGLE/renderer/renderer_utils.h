@@ -25,6 +25,7 @@ namespace angle
 struct FeatureSetBase;
 struct Format;
 enum class FormatID;
+class WorkerThreadPool;
 }  // namespace angle
 
 namespace gl
@@ -72,6 +73,21 @@ void RotateRectangle(const SurfaceRotation rotation,
                      const gl::Rectangle &incoming,
                      gl::Rectangle *outgoing);
 
+// Helpers for blits between framebuffers of which one is pre-rotated.  The first notes the overall
+// rotation of the blit and whether the y-axis remains flipped.  The others rotate the blit area
+// and the framebuffer dimensions and flips to the non-rotated space of the framebuffer image.
+void EarlyAdjustFlipYForPreRotation(SurfaceRotation blitAngleIn,
+                                    SurfaceRotation *blitAngleOut,
+                                    bool *blitFlipYOut);
+void AdjustBlitAreaForPreRotation(SurfaceRotation framebufferAngle,
+                                  const gl::Rectangle &blitAreaIn,
+                                  const gl::Rectangle &framebufferDimensions,
+                                  gl::Rectangle *blitAreaOut);
+void AdjustDimensionsAndFlipForPreRotation(SurfaceRotation framebufferAngle,
+                                           gl::Rectangle *framebufferDimensions,
+                                           bool *flipX,
+                                           bool *flipY);
+
 using MipGenerationFunction = void (*)(size_t sourceWidth,
                                        size_t sourceHeight,
                                        size_t sourceDepth,
@@ -169,6 +185,36 @@ struct LoadImageFunctionInfo
 
 using LoadFunctionMap = LoadImageFunctionInfo (*)(GLenum);
 
+// Calls the load function in bands of rows, or of slices for 3D images, that are converted in
+// parallel on the worker threads.  Images too small to make up for the cost of the tasks are
+// converted on the calling thread, as is everything when the pool is null or not async.  Only for
+// formats that are not block compressed, since a band could split the blocks.
+void LoadImageInParallel(const std::shared_ptr<angle::WorkerThreadPool> &workerThreadPool,
+                         LoadImageFunction loadFunction,
+                         size_t width,
+                         size_t height,
+                         size_t depth,
+                         const uint8_t *input,
+                         size_t inputRowPitch,
+                         size_t inputDepthPitch,
+                         uint8_t *output,
+                         size_t outputRowPitch,
+                         size_t outputDepthPitch);
+
+// Generates the next mip level in bands of rows that are filtered in parallel on the worker
+// threads, with the same thresholds as LoadImageInParallel.
+void GenerateMipInParallel(const std::shared_ptr<angle::WorkerThreadPool> &workerThreadPool,
+                           MipGenerationFunction mipGenerationFunction,
+                           size_t sourceWidth,
+                           size_t sourceHeight,
+                           size_t sourceDepth,
+                           const uint8_t *sourceData,
+                           size_t sourceRowPitch,
+                           size_t sourceDepthPitch,
+                           uint8_t *destData,
+                           size_t destRowPitch,
+                           size_t destDepthPitch);
+
 bool ShouldUseDebugLayers(const egl::AttributeMap &attribs);
 
 void CopyImageCHROMIUM(const uint8_t *sourceData,
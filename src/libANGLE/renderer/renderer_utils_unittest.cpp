@@ -0,0 +1,124 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// renderer_utils_unittest:
+//   Unit tests for the utilities shared by the back ends.
+//
+
+#include <gtest/gtest.h>
+
+#include "image_util/generatemip.h"
+#include "image_util/loadimage.h"
+#include "libANGLE/WorkerThread.h"
+#include "libANGLE/renderer/renderer_utils.h"
+
+namespace rx
+{
+namespace
+{
+void TestLoadImageInParallel(bool multithreaded, size_t width, size_t height, size_t depth)
+{
+    // RGB8 input rows are padded, to check that the pitches are applied to every band.
+    const size_t inputRowPitch    = width * 3 + 5;
+    const size_t inputDepthPitch  = inputRowPitch * height;
+    const size_t outputRowPitch   = width * 4;
+    const size_t outputDepthPitch = outputRowPitch * height;
+
+    std::vector<uint8_t> input(inputDepthPitch * depth);
+    for (size_t index = 0; index < input.size(); ++index)
+    {
+        input[index] = static_cast<uint8_t>(index * 13);
+    }
+
+    std::vector<uint8_t> expected(outputDepthPitch * depth);
+    angle::LoadRGB8ToBGRX8(width, height, depth, input.data(), inputRowPitch, inputDepthPitch,
+                           expected.data(), outputRowPitch, outputDepthPitch);
+
+    std::vector<uint8_t> actual(outputDepthPitch * depth);
+    std::shared_ptr<angle::WorkerThreadPool> pool = angle::WorkerThreadPool::Create(multithreaded);
+    LoadImageInParallel(pool, angle::LoadRGB8ToBGRX8, width, height, depth, input.data(),
+                        inputRowPitch, inputDepthPitch, actual.data(), outputRowPitch,
+                        outputDepthPitch);
+
+    EXPECT_EQ(expected, actual);
+}
+
+// Tests that 2D images loaded in bands of rows match a load on a single thread.
+TEST(LoadImageInParallelTest, Rows)
+{
+    TestLoadImageInParallel(true, 1024, 1031, 1);
+    TestLoadImageInParallel(false, 1024, 1031, 1);
+}
+
+// Tests that 3D images loaded in bands of slices match a load on a single thread.
+TEST(LoadImageInParallelTest, Slices)
+{
+    TestLoadImageInParallel(true, 256, 256, 23);
+    TestLoadImageInParallel(false, 256, 256, 23);
+}
+
+// Tests that images below the threshold are loaded too.
+TEST(LoadImageInParallelTest, Small)
+{
+    TestLoadImageInParallel(true, 17, 3, 1);
+}
+
+void TestGenerateMipInParallel(bool multithreaded,
+                               size_t sourceWidth,
+                               size_t sourceHeight,
+                               size_t sourceDepth)
+{
+    // The source rows are padded, to check that the pitches are applied to every band.
+    const size_t sourceRowPitch   = sourceWidth * 4 + 12;
+    const size_t sourceDepthPitch = sourceRowPitch * sourceHeight;
+    const size_t destWidth        = std::max<size_t>(1, sourceWidth >> 1);
+    const size_t destHeight       = std::max<size_t>(1, sourceHeight >> 1);
+    const size_t destDepth        = std::max<size_t>(1, sourceDepth >> 1);
+    const size_t destRowPitch     = destWidth * 4;
+    const size_t destDepthPitch   = destRowPitch * destHeight;
+
+    std::vector<uint8_t> source(sourceDepthPitch * sourceDepth);
+    for (size_t index = 0; index < source.size(); ++index)
+    {
+        source[index] = static_cast<uint8_t>(index * 13);
+    }
+
+    std::vector<uint8_t> expected(destDepthPitch * destDepth);
+    angle::GenerateMip<angle::R8G8B8A8>(sourceWidth, sourceHeight, sourceDepth, source.data(),
+                                        sourceRowPitch, sourceDepthPitch, expected.data(),
+                                        destRowPitch, destDepthPitch);
+
+    std::vector<uint8_t> actual(destDepthPitch * destDepth);
+    std::shared_ptr<angle::WorkerThreadPool> pool = angle::WorkerThreadPool::Create(multithreaded);
+    GenerateMipInParallel(pool, angle::GenerateMip<angle::R8G8B8A8>, sourceWidth, sourceHeight,
+                          sourceDepth, source.data(), sourceRowPitch, sourceDepthPitch,
+                          actual.data(), destRowPitch, destDepthPitch);
+
+    EXPECT_EQ(expected, actual);
+}
+
+// Tests that 2D mips generated in bands of rows match a mip generated on a single thread,
+// including when the last band has an odd source row.
+TEST(GenerateMipInParallelTest, Rows)
+{
+    TestGenerateMipInParallel(true, 4096, 4096, 1);
+    TestGenerateMipInParallel(true, 4095, 4097, 1);
+    TestGenerateMipInParallel(false, 4095, 4097, 1);
+}
+
+// Tests that 3D mips generated in bands of rows match a mip generated on a single thread.
+TEST(GenerateMipInParallelTest, Volume)
+{
+    TestGenerateMipInParallel(true, 512, 512, 33);
+}
+
+// Tests that levels too short to be split are generated too.
+TEST(GenerateMipInParallelTest, SingleRow)
+{
+    TestGenerateMipInParallel(true, 8192, 1, 1);
+    TestGenerateMipInParallel(true, 1, 8192, 1);
+}
+}  // anonymous namespace
+}  // namespace rx
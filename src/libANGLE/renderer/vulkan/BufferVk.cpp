@@ -14,6 +14,7 @@
 #include "common/mathutil.h"
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
+#include "libANGLE/formatutils.h"
 #include "libANGLE/renderer/vulkan/ContextVk.h"
 #include "libANGLE/renderer/vulkan/RendererVk.h"
 #include "libANGLE/trace.h"
@@ -60,6 +61,15 @@ static_assert(gl::isPow2(kBufferSizeGranularity), "use as alignment, must be pow
 // Start with a fairly small buffer size. We can increase this dynamically as we convert more data.
 constexpr size_t kConvertedArrayBufferInitialSize = 1024 * 8;
 
+// The maximum number of line loop index buffers cached per buffer.  The line loops drawn past
+// this are generated again on every draw.
+constexpr size_t kMaxLineLoopConversionBuffers = 1024;
+
+// The number of updates after which the update history of a buffer decays, and the number of
+// updates needed before the history is used.
+constexpr uint32_t kUpdateHistoryWindow    = 16;
+constexpr uint32_t kMinUpdateHistoryForUse = 4;
+
 // Buffers that have a static usage pattern will be allocated in
 // device local memory to speed up access to and from the GPU.
 // Dynamic usage patterns or that are frequently mapped
@@ -127,16 +137,6 @@ ANGLE_INLINE VkMemoryPropertyFlags GetStorageMemoryType(RendererVk *renderer,
     return hasMapAccess ? kHostCachedFlags : kDeviceLocalFlags;
 }
 
-ANGLE_INLINE bool ShouldAllocateNewMemoryForUpdate(ContextVk *contextVk,
-                                                   size_t subDataSize,
-                                                   size_t bufferSize)
-{
-    // A sub data update with size > 50% of buffer size meets the threshold
-    // to acquire a new BufferHelper from the pool.
-    return contextVk->getRenderer()->getFeatures().preferCPUForBufferSubData.enabled ||
-           subDataSize > (bufferSize / 2);
-}
-
 ANGLE_INLINE bool ShouldUseCPUToCopyData(ContextVk *contextVk, size_t copySize, size_t bufferSize)
 {
     RendererVk *renderer = contextVk->getRenderer();
@@ -154,6 +154,20 @@ ANGLE_INLINE bool IsUsageDynamic(gl::BufferUsage usage)
             usage == gl::BufferUsage::DynamicRead);
 }
 
+ANGLE_INLINE bool IsUsageStream(gl::BufferUsage usage)
+{
+    return (usage == gl::BufferUsage::StreamDraw || usage == gl::BufferUsage::StreamCopy ||
+            usage == gl::BufferUsage::StreamRead);
+}
+
+// Buffers with a static usage, as well as those created with glBufferStorage, are expected to live
+// long and are kept apart from the frequently respecified dynamic and stream buffers.
+vk::BufferUsageType GetBufferUsageType(gl::BufferUsage usage)
+{
+    return (IsUsageDynamic(usage) || IsUsageStream(usage)) ? vk::BufferUsageType::Dynamic
+                                                           : vk::BufferUsageType::Static;
+}
+
 angle::Result GetMemoryTypeIndex(ContextVk *contextVk,
                                  VkDeviceSize size,
                                  VkMemoryPropertyFlags memoryPropertyFlags,
@@ -197,7 +211,7 @@ ConversionBuffer::ConversionBuffer(RendererVk *renderer,
                                    size_t initialSize,
                                    size_t alignment,
                                    bool hostVisible)
-    : dirty(true)
+    : dirty(true), dirtyRange(0, std::numeric_limits<size_t>::max())
 {
     data = std::make_unique<vk::BufferHelper>();
 }
@@ -209,6 +223,36 @@ ConversionBuffer::~ConversionBuffer()
 
 ConversionBuffer::ConversionBuffer(ConversionBuffer &&other) = default;
 
+void ConversionBuffer::setDirty()
+{
+    dirty      = true;
+    dirtyRange = angle::Range<size_t>(0, std::numeric_limits<size_t>::max());
+}
+
+void ConversionBuffer::addDirtyRange(size_t offset, size_t size)
+{
+    if (size == 0)
+    {
+        return;
+    }
+
+    if (!dirty)
+    {
+        dirty      = true;
+        dirtyRange = angle::Range<size_t>(offset, offset + size);
+        return;
+    }
+
+    dirtyRange.extend(offset);
+    dirtyRange.extend(offset + size - 1);
+}
+
+void ConversionBuffer::clearDirty()
+{
+    dirty = false;
+    dirtyRange.invalidate();
+}
+
 // BufferVk::VertexConversionBuffer implementation.
 BufferVk::VertexConversionBuffer::VertexConversionBuffer(RendererVk *renderer,
                                                          angle::FormatID formatIDIn,
@@ -229,17 +273,34 @@ BufferVk::VertexConversionBuffer::VertexConversionBuffer(VertexConversionBuffer
 
 BufferVk::VertexConversionBuffer::~VertexConversionBuffer() = default;
 
+// LineLoopConversionBuffer implementation.
+LineLoopConversionBuffer::LineLoopConversionBuffer(RendererVk *renderer)
+    : ConversionBuffer(renderer,
+                       vk::kIndexBufferUsageFlags,
+                       kConvertedArrayBufferInitialSize,
+                       vk::kIndexBufferAlignment,
+                       true),
+      indexCount(0)
+{}
+
+LineLoopConversionBuffer::LineLoopConversionBuffer(LineLoopConversionBuffer &&other) = default;
+
+LineLoopConversionBuffer::~LineLoopConversionBuffer() = default;
+
 // BufferVk implementation.
 BufferVk::BufferVk(const gl::BufferState &state)
     : BufferImpl(state),
       mClientBuffer(nullptr),
       mMemoryTypeIndex(0),
       mMemoryPropertyFlags(0),
+      mUsageType(vk::BufferUsageType::Static),
       mIsStagingBufferMapped(false),
       mHasValidData(false),
       mIsMappedForWrite(false),
       mMappedOffset(0),
-      mMappedLength(0)
+      mMappedLength(0),
+      mRecentUpdateCount(0),
+      mRecentInUseUpdateCount(0)
 {}
 
 BufferVk::~BufferVk() {}
@@ -248,6 +309,7 @@ void BufferVk::destroy(const gl::Context *context)
 {
     ContextVk *contextVk = vk::GetImpl(context);
 
+    contextVk->getShareGroupVk()->removeBuffer(this);
     release(contextVk);
 }
 
@@ -268,6 +330,12 @@ void BufferVk::release(ContextVk *contextVk)
         buffer.data->release(renderer);
     }
     mVertexConversionBuffers.clear();
+
+    for (auto &buffer : mLineLoopConversionBuffers)
+    {
+        buffer.second.data->release(renderer);
+    }
+    mLineLoopConversionBuffers.clear();
 }
 
 angle::Result BufferVk::setExternalBufferData(const gl::Context *context,
@@ -386,6 +454,7 @@ angle::Result BufferVk::setDataWithMemoryType(const gl::Context *context,
         release(contextVk);
 
         mMemoryPropertyFlags = memoryPropertyFlags;
+        mUsageType           = GetBufferUsageType(usage);
         ANGLE_TRY(GetMemoryTypeIndex(contextVk, size, memoryPropertyFlags, &mMemoryTypeIndex));
 
         ANGLE_TRY(acquireBufferHelper(contextVk, size));
@@ -794,6 +863,40 @@ angle::Result BufferVk::getIndexRange(const gl::Context *context,
     return angle::Result::Continue;
 }
 
+angle::Result BufferVk::getIndexRanges(const gl::Context *context,
+                                       gl::DrawElementsType type,
+                                       size_t offset,
+                                       size_t rangeIndexCount,
+                                       size_t rangeCount,
+                                       bool primitiveRestartEnabled,
+                                       gl::IndexRange *outRanges)
+{
+    ContextVk *contextVk = vk::GetImpl(context);
+    RendererVk *renderer = contextVk->getRenderer();
+
+    if (renderer->isMockICDEnabled())
+    {
+        std::fill(outRanges, outRanges + rangeCount, gl::IndexRange());
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "BufferVk::getIndexRanges");
+
+    const size_t rangeSize = rangeIndexCount * gl::GetDrawElementsTypeSize(type);
+
+    void *mapPtr;
+    ANGLE_TRY(mapRangeImpl(contextVk, offset, rangeSize * rangeCount, GL_MAP_READ_BIT, &mapPtr));
+    for (size_t rangeIndex = 0; rangeIndex < rangeCount; ++rangeIndex)
+    {
+        const uint8_t *rangeData = static_cast<const uint8_t *>(mapPtr) + rangeIndex * rangeSize;
+        outRanges[rangeIndex] =
+            gl::ComputeIndexRange(type, rangeData, rangeIndexCount, primitiveRestartEnabled);
+    }
+    ANGLE_TRY(unmapImpl(contextVk));
+
+    return angle::Result::Continue;
+}
+
 angle::Result BufferVk::updateBuffer(ContextVk *contextVk,
                                      const uint8_t *data,
                                      size_t size,
@@ -842,7 +945,26 @@ angle::Result BufferVk::stagedUpdate(ContextVk *contextVk,
     uint8_t *mapPointer = nullptr;
     ANGLE_TRY(allocStagingBuffer(contextVk, vk::MemoryCoherency::NonCoherent, size, &mapPointer));
     memcpy(mapPointer, data, size);
-    ANGLE_TRY(flushStagingBuffer(contextVk, offset, size));
+
+    // Large uploads to idle buffers are copied on the transfer queue, if any, so that they overlap
+    // with rendering.
+    RendererVk *renderer = contextVk->getRenderer();
+    if (renderer->getTransferQueue().valid() && size >= vk::kMinTransferQueueUploadSize &&
+        !isExternalBuffer() && !contextVk->hasProtectedContent() &&
+        !mBuffer.isCurrentlyInUse(contextVk->getLastCompletedQueueSerial()))
+    {
+        if (!mStagingBuffer.isCoherent())
+        {
+            ANGLE_TRY(mStagingBuffer.flush(renderer));
+        }
+
+        VkBufferCopy copyRegion = {mStagingBuffer.getOffset(), mBuffer.getOffset() + offset, size};
+        ANGLE_TRY(mBuffer.copyFromBufferOnTransferQueue(contextVk, &mStagingBuffer, copyRegion));
+    }
+    else
+    {
+        ANGLE_TRY(flushStagingBuffer(contextVk, offset, size));
+    }
     mIsStagingBufferMapped = false;
 
     return angle::Result::Continue;
@@ -951,7 +1073,20 @@ angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
     //          acquire a new BufferHelper from the pool
     //     else stage the update
     // else update the buffer directly
-    if (isCurrentlyInUse(contextVk))
+    bool inUse = isCurrentlyInUse(contextVk);
+
+    // The GPU may have finished using the buffer since completed commands were last checked.  If
+    // the buffer isn't used by commands that are yet to be submitted, and it's usually idle when
+    // updated, check again so the update can avoid a copy.
+    if (inUse && !mBuffer.usedInRecordedCommands() && !isFrequentlyUpdatedWhileInUse())
+    {
+        ANGLE_TRY(contextVk->checkCompletedCommands());
+        inUse = isCurrentlyInUse(contextVk);
+    }
+    recordUpdate(inUse);
+
+    angle::VulkanPerfCounters &perfCounters = contextVk->getPerfCounters();
+    if (inUse)
     {
         // If storage has just been redefined, don't go down acquireAndUpdate code path. There is no
         // reason you acquire another new buffer right after redefined. And if we do go into
@@ -965,27 +1100,95 @@ angle::Result BufferVk::setDataImpl(ContextVk *contextVk,
         // acquireAndUpdate over stagedUpdate. This could happen when app calls glBufferData with
         // same size and we will try to reuse the existing buffer storage.
         if (!isExternalBuffer() && updateType != BufferUpdateType::StorageRedefined &&
-            (!mHasValidData || ShouldAllocateNewMemoryForUpdate(
-                                   contextVk, size, static_cast<size_t>(mState.getSize()))))
+            shouldAcquireNewBufferForUpdate(contextVk, size))
         {
+            ++perfCounters.bufferAcquireAndUpdates;
             ANGLE_TRY(acquireAndUpdate(contextVk, data, size, offset, updateType));
         }
         else
         {
+            ++perfCounters.bufferStagedUpdates;
             ANGLE_TRY(stagedUpdate(contextVk, data, size, offset));
         }
     }
     else
     {
+        if (mBuffer.isHostVisible())
+        {
+            ++perfCounters.bufferDirectUpdates;
+        }
+        else
+        {
+            ++perfCounters.bufferStagedUpdates;
+        }
         ANGLE_TRY(updateBuffer(contextVk, data, size, offset));
     }
 
-    // Update conversions
-    dataUpdated();
+    // Update conversions.  Updates of part of the buffer only need the vertices they modify to be
+    // converted again.
+    if (updateType == BufferUpdateType::ContentsUpdate)
+    {
+        dataRangeUpdated(offset, size);
+    }
+    else
+    {
+        dataUpdated();
+    }
 
     return angle::Result::Continue;
 }
 
+bool BufferVk::shouldAcquireNewBufferForUpdate(ContextVk *contextVk, size_t updateSize) const
+{
+    // If there is no valid data, there is nothing to copy to the new buffer.
+    if (!mHasValidData)
+    {
+        return true;
+    }
+
+    // A sub data update with size > 50% of buffer size copies less data to the new buffer than it
+    // updates, so it meets the threshold to acquire a new BufferHelper from the pool.
+    const size_t bufferSize = static_cast<size_t>(mState.getSize());
+    if (updateSize > bufferSize / 2)
+    {
+        return true;
+    }
+
+    RendererVk *renderer = contextVk->getRenderer();
+    if (!renderer->getFeatures().preferCPUForBufferSubData.enabled)
+    {
+        return false;
+    }
+
+    // preferCPUForBufferSubData avoids GPU copies by acquiring a new buffer and copying the rest
+    // of the data on the CPU.  If the buffer is frequently updated while in use though, copying
+    // the rest of a large buffer on every update costs more than staging the updates.
+    const size_t preservedSize = bufferSize - updateSize;
+    return preservedSize < renderer->getMaxCopyBytesUsingCPUWhenPreservingBufferData() ||
+           !isFrequentlyUpdatedWhileInUse();
+}
+
+void BufferVk::recordUpdate(bool inUse)
+{
+    if (mRecentUpdateCount == kUpdateHistoryWindow)
+    {
+        mRecentUpdateCount /= 2;
+        mRecentInUseUpdateCount /= 2;
+    }
+
+    ++mRecentUpdateCount;
+    if (inUse)
+    {
+        ++mRecentInUseUpdateCount;
+    }
+}
+
+bool BufferVk::isFrequentlyUpdatedWhileInUse() const
+{
+    return mRecentUpdateCount >= kMinUpdateHistoryForUse &&
+           mRecentInUseUpdateCount * 2 > mRecentUpdateCount;
+}
+
 ConversionBuffer *BufferVk::getVertexConversionBuffer(RendererVk *renderer,
                                                       angle::FormatID formatID,
                                                       GLuint stride,
@@ -1005,11 +1208,56 @@ ConversionBuffer *BufferVk::getVertexConversionBuffer(RendererVk *renderer,
     return &mVertexConversionBuffers.back();
 }
 
+LineLoopConversionBuffer *BufferVk::getLineLoopConversionBuffer(RendererVk *renderer,
+                                                                gl::DrawElementsType indexType,
+                                                                uint32_t indexCount,
+                                                                size_t offset,
+                                                                bool primitiveRestartEnabled)
+{
+    LineLoopConversionKey key   = {};
+    key.offset                  = offset;
+    key.indexType               = indexType;
+    key.indexCount              = indexCount;
+    key.primitiveRestartEnabled = primitiveRestartEnabled;
+
+    auto iter = mLineLoopConversionBuffers.find(key);
+    if (iter != mLineLoopConversionBuffers.end())
+    {
+        return &iter->second;
+    }
+
+    if (mLineLoopConversionBuffers.size() >= kMaxLineLoopConversionBuffers)
+    {
+        return nullptr;
+    }
+
+    return &mLineLoopConversionBuffers.emplace(key, LineLoopConversionBuffer(renderer))
+                .first->second;
+}
+
 void BufferVk::dataUpdated()
 {
     for (VertexConversionBuffer &buffer : mVertexConversionBuffers)
     {
-        buffer.dirty = true;
+        buffer.setDirty();
+    }
+    for (auto &buffer : mLineLoopConversionBuffers)
+    {
+        buffer.second.setDirty();
+    }
+    // Now we have valid data
+    mHasValidData = true;
+}
+
+void BufferVk::dataRangeUpdated(size_t offset, size_t size)
+{
+    for (VertexConversionBuffer &buffer : mVertexConversionBuffers)
+    {
+        buffer.addDirtyRange(offset, size);
+    }
+    for (auto &buffer : mLineLoopConversionBuffers)
+    {
+        buffer.second.setDirty();
     }
     // Now we have valid data
     mHasValidData = true;
@@ -1032,7 +1280,8 @@ angle::Result BufferVk::acquireBufferHelper(ContextVk *contextVk, size_t sizeInB
     }
 
     // Allocate the buffer directly
-    ANGLE_TRY(mBuffer.initSuballocation(contextVk, mMemoryTypeIndex, size, alignment));
+    ANGLE_TRY(mBuffer.initSuballocation(contextVk, mMemoryTypeIndex, size, alignment,
+                                        mUsageType));
 
     // Tell the observers (front end) that a new buffer was created, so the necessary
     // dirty bits can be set. This allows the buffer views pointing to the old buffer to
@@ -1043,6 +1292,37 @@ angle::Result BufferVk::acquireBufferHelper(ContextVk *contextVk, size_t sizeInB
     return angle::Result::Continue;
 }
 
+angle::Result BufferVk::moveOutOfEvacuatingBufferBlock(ContextVk *contextVk,
+                                                       VkDeviceSize *movedSizeOut)
+{
+    *movedSizeOut = 0;
+
+    // A mapped buffer must keep its storage, as the application holds a pointer into it.
+    if (!mBuffer.valid() || !mBuffer.isInEvacuatingBufferBlock() || mState.isMapped() ||
+        isExternalBuffer())
+    {
+        return angle::Result::Continue;
+    }
+
+    vk::BufferHelper src = std::move(mBuffer);
+
+    // The new suballocation is never placed in an evacuating block.  This also notifies the
+    // observers so that bindings to the old buffer are updated.
+    ANGLE_TRY(acquireBufferHelper(contextVk, static_cast<size_t>(mState.getSize())));
+
+    if (mHasValidData)
+    {
+        VkBufferCopy copyRegion = {src.getOffset(), mBuffer.getOffset(),
+                                   static_cast<VkDeviceSize>(mState.getSize())};
+        ANGLE_TRY(mBuffer.copyFromBuffer(contextVk, &src, 1, &copyRegion));
+    }
+
+    src.release(contextVk->getRenderer());
+    *movedSizeOut = mBuffer.getSize();
+
+    return angle::Result::Continue;
+}
+
 bool BufferVk::isCurrentlyInUse(ContextVk *contextVk) const
 {
     return mBuffer.isCurrentlyInUse(contextVk->getLastCompletedQueueSerial());
@@ -10,6 +10,7 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_BUFFERVK_H_
 #define LIBANGLE_RENDERER_VULKAN_BUFFERVK_H_
 
+#include "common/hash_utils.h"
 #include "libANGLE/Buffer.h"
 #include "libANGLE/Observer.h"
 #include "libANGLE/renderer/BufferImpl.h"
@@ -31,13 +32,41 @@ struct ConversionBuffer
 
     ConversionBuffer(ConversionBuffer &&other);
 
+    // Marks the whole source as modified.
+    void setDirty();
+    // Marks a range of source bytes as modified.
+    void addDirtyRange(size_t offset, size_t size);
+    void clearDirty();
+    // Whether only ranges of the source were modified since the last conversion.
+    bool isPartiallyDirty() const
+    {
+        return dirty && dirtyRange.high() != std::numeric_limits<size_t>::max();
+    }
+
     // One state value determines if we need to re-stream vertex data.
     bool dirty;
+    // The bytes of the source modified since the last conversion, which is all of them unless only
+    // ranges of the source were updated.  Vertex conversions can then convert the affected vertices
+    // only.
+    angle::Range<size_t> dirtyRange;
 
     // Where the conversion data is stored.
     std::unique_ptr<vk::BufferHelper> data;
 };
 
+// Line loop index buffers generated from the indices of a buffer, which close the loop.
+struct LineLoopConversionBuffer : public ConversionBuffer
+{
+    LineLoopConversionBuffer(RendererVk *renderer);
+    ~LineLoopConversionBuffer();
+
+    LineLoopConversionBuffer(LineLoopConversionBuffer &&other);
+
+    // The number of generated indices, which depends on the restarts when primitive restart is
+    // enabled.
+    uint32_t indexCount;
+};
+
 enum class BufferUpdateType
 {
     StorageRedefined,
@@ -98,6 +127,13 @@ class BufferVk : public BufferImpl
                                 size_t count,
                                 bool primitiveRestartEnabled,
                                 gl::IndexRange *outRange) override;
+    angle::Result getIndexRanges(const gl::Context *context,
+                                 gl::DrawElementsType type,
+                                 size_t offset,
+                                 size_t rangeIndexCount,
+                                 size_t rangeCount,
+                                 bool primitiveRestartEnabled,
+                                 gl::IndexRange *outRanges) override;
 
     GLint64 getSize() const { return mState.getSize(); }
 
@@ -131,6 +167,20 @@ class BufferVk : public BufferImpl
                                                 size_t offset,
                                                 bool hostVisible);
 
+    // Returns the line loop index buffer generated from |indexCount| indices at |offset|, which is
+    // dirty if they were modified since.  Returns null when too many line loops are cached
+    // already.
+    LineLoopConversionBuffer *getLineLoopConversionBuffer(RendererVk *renderer,
+                                                          gl::DrawElementsType indexType,
+                                                          uint32_t indexCount,
+                                                          size_t offset,
+                                                          bool primitiveRestartEnabled);
+
+    // Moves the storage out of a BufferBlock that is being evacuated for defragmentation, with a
+    // GPU copy of the contents.  |movedSizeOut| is set to the number of bytes moved.
+    angle::Result moveOutOfEvacuatingBufferBlock(ContextVk *contextVk,
+                                                 VkDeviceSize *movedSizeOut);
+
   private:
     angle::Result updateBuffer(ContextVk *contextVk,
                                const uint8_t *data,
@@ -170,8 +220,12 @@ class BufferVk : public BufferImpl
                               size_t size,
                               size_t offset,
                               BufferUpdateType updateType);
+    bool shouldAcquireNewBufferForUpdate(ContextVk *contextVk, size_t updateSize) const;
+    void recordUpdate(bool inUse);
+    bool isFrequentlyUpdatedWhileInUse() const;
     void release(ContextVk *context);
     void dataUpdated();
+    void dataRangeUpdated(size_t offset, size_t size);
 
     angle::Result acquireBufferHelper(ContextVk *contextVk, size_t sizeInBytes);
 
@@ -194,6 +248,27 @@ class BufferVk : public BufferImpl
         size_t offset;
     };
 
+    struct LineLoopConversionKey
+    {
+        bool operator==(const LineLoopConversionKey &other) const
+        {
+            return memcmp(this, &other, sizeof(LineLoopConversionKey)) == 0;
+        }
+
+        size_t offset;
+        gl::DrawElementsType indexType;
+        uint32_t indexCount;
+        uint32_t primitiveRestartEnabled;
+    };
+
+    struct LineLoopConversionKeyHash
+    {
+        size_t operator()(const LineLoopConversionKey &key) const
+        {
+            return angle::ComputeGenericHash(key);
+        }
+    };
+
     vk::BufferHelper mBuffer;
 
     // If not null, this is the external memory pointer passed from client API.
@@ -202,6 +277,8 @@ class BufferVk : public BufferImpl
     uint32_t mMemoryTypeIndex;
     // Memory/Usage property that will be used for memory allocation.
     VkMemoryPropertyFlags mMemoryPropertyFlags;
+    // The expected lifetime of the buffer, which selects the pool it is suballocated from.
+    vk::BufferUsageType mUsageType;
 
     // The staging buffer to aid map operations. This is used when buffers are not host visible or
     // for performance optimization when only a smaller range of buffer is mapped.
@@ -210,6 +287,11 @@ class BufferVk : public BufferImpl
     // A cache of converted vertex data.
     std::vector<VertexConversionBuffer> mVertexConversionBuffers;
 
+    // A cache of the line loop index buffers generated from the indices of this buffer.  Apps may
+    // draw many line loops from one buffer, so they are looked up in a map.
+    angle::HashMap<LineLoopConversionKey, LineLoopConversionBuffer, LineLoopConversionKeyHash>
+        mLineLoopConversionBuffers;
+
     // Tracks whether mStagingBuffer has been mapped to user or not
     bool mIsStagingBufferMapped;
 
@@ -225,6 +307,11 @@ class BufferVk : public BufferImpl
     // mapped from angle internal.
     VkDeviceSize mMappedOffset;
     VkDeviceSize mMappedLength;
+
+    // The number of recent updates of the buffer, and how many of them found it in use by the GPU.
+    // They are halved periodically so that they follow changes in the usage pattern of the buffer.
+    uint32_t mRecentUpdateCount;
+    uint32_t mRecentInUseUpdateCount;
 };
 
 }  // namespace rx
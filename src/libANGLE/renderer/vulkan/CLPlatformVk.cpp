@@ -13,6 +13,7 @@
 
 #include "anglebase/no_destructor.h"
 #include "common/angle_version_info.h"
+#include "common/debug.h"
 
 namespace rx
 {
@@ -70,8 +71,11 @@ CLContextImpl::Ptr CLPlatformVk::createContext(cl::Context &context,
                                                bool userSync,
                                                cl_int &errorCode)
 {
-    CLContextImpl::Ptr contextImpl;
-    return contextImpl;
+    // The Vulkan back end can't run commands yet, so its devices are reported as not available
+    // rather than handing out a context without an implementation.
+    UNIMPLEMENTED();
+    errorCode = CL_DEVICE_NOT_AVAILABLE;
+    return CLContextImpl::Ptr();
 }
 
 CLContextImpl::Ptr CLPlatformVk::createContextFromType(cl::Context &context,
@@ -79,8 +83,9 @@ CLContextImpl::Ptr CLPlatformVk::createContextFromType(cl::Context &context,
                                                        bool userSync,
                                                        cl_int &errorCode)
 {
-    CLContextImpl::Ptr contextImpl;
-    return contextImpl;
+    UNIMPLEMENTED();
+    errorCode = CL_DEVICE_NOT_AVAILABLE;
+    return CLContextImpl::Ptr();
 }
 
 cl_int CLPlatformVk::unloadCompiler()
@@ -8,9 +8,14 @@
 //
 
 #include "libANGLE/renderer/vulkan/CommandProcessor.h"
+#include "common/FastVector.h"
+#include "common/Spinlock.h"
+#include "common/system_utils.h"
 #include "libANGLE/renderer/vulkan/RendererVk.h"
 #include "libANGLE/trace.h"
 
+#include <algorithm>
+
 namespace rx
 {
 namespace vk
@@ -22,6 +27,16 @@ constexpr bool kOutputVmaStatsString    = false;
 // When suballocation garbages is more than this, we may wait for GPU to finish and free up some
 // memory for allocation.
 constexpr VkDeviceSize kMaxBufferSuballocationGarbageSize = 64 * 1024 * 1024;
+// Number of tasks that can be queued to the worker thread before producers have to wait.
+constexpr size_t kMaxQueuedTasks = 256;
+// Number of times the worker thread polls an empty task queue before parking.  Spinning is
+// pointless if there is no other core for the producer to run on.
+constexpr uint32_t kSpinCountBeforePark = 2000;
+
+uint32_t GetSpinCountBeforePark()
+{
+    return std::thread::hardware_concurrency() > 1 ? kSpinCountBeforePark : 0;
+}
 
 void InitializeSubmitInfo(VkSubmitInfo *submitInfo,
                           const vk::PrimaryCommandBuffer &commandBuffer,
@@ -88,16 +103,18 @@ ANGLE_MAYBE_UNUSED void ResetSecondaryCommandBuffers<std::vector<VulkanSecondary
 // Count the number of batches with serial <= given serial.  A reference to the fence of the last
 // batch with a valid fence is returned for waiting purposes.  Note that due to empty submissions
 // being optimized out, there may not be a fence associated with every batch.
-size_t GetBatchCountUpToSerial(std::vector<CommandBatch> &inFlightCommands,
+// |batchToWaitOnOut| is set to the last batch up to |serial| that made a submission, if any.
+size_t GetBatchCountUpToSerial(const std::vector<CommandBatch> &inFlightCommands,
                                Serial serial,
-                               Shared<Fence> **fenceToWaitOnOut)
+                               const CommandBatch **batchToWaitOnOut)
 {
     size_t batchCount = 0;
     while (batchCount < inFlightCommands.size() && inFlightCommands[batchCount].serial <= serial)
     {
-        if (inFlightCommands[batchCount].fence.isReferenced())
+        const CommandBatch &batch = inFlightCommands[batchCount];
+        if (batch.fence.isReferenced() || batch.signalsTimelineSemaphore)
         {
-            *fenceToWaitOnOut = &inFlightCommands[batchCount].fence;
+            *batchToWaitOnOut = &batch;
         }
 
         batchCount++;
@@ -164,6 +181,7 @@ void CommandProcessorTask::initTask()
     mOneOffCommandBufferVk          = VK_NULL_HANDLE;
     mPriority                       = egl::ContextPriority::Medium;
     mHasProtectedContent            = false;
+    mQueueTime                      = 0.0;
 }
 
 void CommandProcessorTask::initOutsideRenderPassProcessCommands(
@@ -194,7 +212,7 @@ void CommandProcessorTask::copyPresentInfo(const VkPresentInfoKHR &other)
     }
 
     mPresentInfo.sType = other.sType;
-    mPresentInfo.pNext = other.pNext;
+    mPresentInfo.pNext = nullptr;
 
     if (other.swapchainCount > 0)
     {
@@ -235,11 +253,25 @@ void CommandProcessorTask::copyPresentInfo(const VkPresentInfoKHR &other)
                 mPresentRegion.pRectangles = mRects.data();
 
                 mPresentRegions.sType          = VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR;
-                mPresentRegions.pNext          = presentRegions->pNext;
+                mPresentRegions.pNext          = nullptr;
                 mPresentRegions.swapchainCount = 1;
                 mPresentRegions.pRegions       = &mPresentRegion;
-                mPresentInfo.pNext             = &mPresentRegions;
-                pNext                          = const_cast<void *>(presentRegions->pNext);
+                AddToPNextChain(&mPresentInfo, &mPresentRegions);
+                pNext = const_cast<void *>(presentRegions->pNext);
+                break;
+            }
+            case VK_STRUCTURE_TYPE_PRESENT_ID_KHR:
+            {
+                const VkPresentIdKHR *presentId = reinterpret_cast<VkPresentIdKHR *>(pNext);
+                ASSERT(presentId->swapchainCount == 1);
+                mPresentIdValue = presentId->pPresentIds[0];
+
+                mPresentId.sType          = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+                mPresentId.pNext          = nullptr;
+                mPresentId.swapchainCount = 1;
+                mPresentId.pPresentIds    = &mPresentIdValue;
+                AddToPNextChain(&mPresentInfo, &mPresentId);
+                pNext = const_cast<void *>(presentId->pNext);
                 break;
             }
             default:
@@ -336,6 +368,7 @@ CommandProcessorTask &CommandProcessorTask::operator=(CommandProcessorTask &&rhs
     std::swap(mPriority, rhs.mPriority);
     std::swap(mHasProtectedContent, rhs.mHasProtectedContent);
     std::swap(mOneOffCommandBufferVk, rhs.mOneOffCommandBufferVk);
+    std::swap(mQueueTime, rhs.mQueueTime);
 
     copyPresentInfo(rhs.mPresentInfo);
 
@@ -346,7 +379,12 @@ CommandProcessorTask &CommandProcessorTask::operator=(CommandProcessorTask &&rhs
 }
 
 // CommandBatch implementation.
-CommandBatch::CommandBatch() : commandPools(nullptr), hasProtectedContent(false) {}
+CommandBatch::CommandBatch()
+    : commandPools(nullptr),
+      hasProtectedContent(false),
+      signalsTimelineSemaphore(false),
+      priority(egl::ContextPriority::Medium)
+{}
 
 CommandBatch::~CommandBatch() = default;
 
@@ -360,17 +398,22 @@ CommandBatch &CommandBatch::operator=(CommandBatch &&other)
     std::swap(primaryCommands, other.primaryCommands);
     std::swap(commandPools, other.commandPools);
     std::swap(commandBuffersToReset, other.commandBuffersToReset);
+    std::swap(replayCommandBuffers, other.replayCommandBuffers);
     std::swap(fence, other.fence);
     std::swap(serial, other.serial);
     std::swap(hasProtectedContent, other.hasProtectedContent);
+    std::swap(signalsTimelineSemaphore, other.signalsTimelineSemaphore);
+    std::swap(priority, other.priority);
     return *this;
 }
 
 void CommandBatch::destroy(VkDevice device)
 {
     primaryCommands.destroy(device);
+    replayCommandBuffers.destroy(device);
     fence.reset(device);
-    hasProtectedContent = false;
+    hasProtectedContent      = false;
+    signalsTimelineSemaphore = false;
 }
 
 void CommandBatch::resetSecondaryCommandBuffers(VkDevice device)
@@ -404,8 +447,356 @@ void CommandProcessor::handleError(VkResult errorCode,
     mErrors.emplace(error);
 }
 
+// SubmitLatencyTracker implementation.
+SubmitLatencyTracker::SubmitLatencyTracker()
+{
+    for (Samples &samples : mSamples)
+    {
+        samples.latenciesNs.fill(0);
+        samples.count = 0;
+        samples.next  = 0;
+    }
+}
+
+SubmitLatencyTracker::~SubmitLatencyTracker() = default;
+
+void SubmitLatencyTracker::record(egl::ContextPriority priority, uint64_t latencyNs)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    Samples &samples                  = mSamples[priority];
+    samples.latenciesNs[samples.next] = latencyNs;
+    samples.next                      = (samples.next + 1) % kMaxSamples;
+    samples.count                     = std::min(samples.count + 1, kMaxSamples);
+}
+
+uint64_t SubmitLatencyTracker::getPercentileNs(egl::ContextPriority priority,
+                                               uint32_t percentile) const
+{
+    ASSERT(percentile <= 100);
+
+    std::array<uint64_t, kMaxSamples> latenciesNs;
+    size_t count = 0;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        latenciesNs = mSamples[priority].latenciesNs;
+        count       = mSamples[priority].count;
+    }
+
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    // Nearest-rank percentile over the recorded samples.
+    const size_t rank = std::max<size_t>((percentile * count + 99) / 100, 1) - 1;
+    std::nth_element(latenciesNs.begin(), latenciesNs.begin() + rank, latenciesNs.begin() + count);
+    return latenciesNs[rank];
+}
+
+// PresentThread implementation.
+PresentThread::PresentThread() : mQueue(VK_NULL_HANDLE), mPendingCount(0), mExitThread(false) {}
+
+PresentThread::~PresentThread()
+{
+    ASSERT(!mThread.joinable());
+}
+
+void PresentThread::init(VkQueue queue)
+{
+    ASSERT(queue != VK_NULL_HANDLE);
+    mQueue  = queue;
+    mThread = std::thread(&PresentThread::processPresents, this);
+}
+
+void PresentThread::destroy()
+{
+    if (!mThread.joinable())
+    {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExitThread = true;
+        mWorkAvailableCondition.notify_one();
+    }
+    mThread.join();
+
+    ASSERT(mPresents.empty());
+    mSwapchainStatus.clear();
+    mQueue = VK_NULL_HANDLE;
+}
+
+void PresentThread::enqueue(CommandProcessorTask &&task)
+{
+    ASSERT(task.getTaskCommand() == CustomTask::Present);
+    // Verify that we are presenting one and only one swapchain
+    ASSERT(task.getPresentInfo().swapchainCount == 1);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    auto iter = mSwapchainStatus.find(task.getPresentInfo().pSwapchains[0]);
+    if (iter == mSwapchainStatus.end())
+    {
+        iter = mSwapchainStatus.emplace(task.getPresentInfo().pSwapchains[0],
+                                        SwapchainStatus{0, VK_SUCCESS})
+                   .first;
+    }
+    ++iter->second.pendingCount;
+    ++mPendingCount;
+
+    mPresents.push(std::move(task));
+    mWorkAvailableCondition.notify_one();
+}
+
+VkResult PresentThread::waitForPresents(VkSwapchainKHR swapchain)
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    auto iter = mSwapchainStatus.find(swapchain);
+    if (iter == mSwapchainStatus.end())
+    {
+        return VK_SUCCESS;
+    }
+
+    ANGLE_TRACE_EVENT0("gpu.angle", "PresentThread::waitForPresents");
+    mPresentDoneCondition.wait(lock, [iter] { return iter->second.pendingCount == 0; });
+
+    VkResult result = iter->second.lastResult;
+    mSwapchainStatus.erase(iter);
+    return result;
+}
+
+void PresentThread::waitIdle()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    mPresentDoneCondition.wait(lock, [this] { return mPendingCount == 0; });
+}
+
+void PresentThread::processPresents()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+    while (true)
+    {
+        mWorkAvailableCondition.wait(lock, [this] { return mExitThread || !mPresents.empty(); });
+
+        // Drain the queue before exiting, so every queued present's semaphore is waited on.
+        if (mPresents.empty())
+        {
+            ASSERT(mExitThread);
+            break;
+        }
+
+        CommandProcessorTask task = std::move(mPresents.front());
+        mPresents.pop();
+
+        // Don't hold the lock while presenting, so the next frame's present can be queued and other
+        // swapchains can be waited on meanwhile.
+        lock.unlock();
+        VkResult result;
+        {
+            ANGLE_TRACE_EVENT0("gpu.angle", "vkQueuePresentKHR");
+            result = vkQueuePresentKHR(mQueue, &task.getPresentInfo());
+        }
+        lock.lock();
+
+        SwapchainStatus &status = mSwapchainStatus[task.getPresentInfo().pSwapchains[0]];
+        ASSERT(status.pendingCount > 0 && mPendingCount > 0);
+        --status.pendingCount;
+        --mPendingCount;
+        status.lastResult = result;
+        mPresentDoneCondition.notify_all();
+    }
+}
+
+// TransferQueue implementation.
+TransferQueue::TransferQueue()
+    : mQueue(VK_NULL_HANDLE),
+      mQueueFamilyIndex(QueueFamily::kInvalidIndex),
+      mLastSubmittedValue(0),
+      mLastCompletedValue(0)
+{}
+
+TransferQueue::~TransferQueue()
+{
+    ASSERT(!valid());
+}
+
+angle::Result TransferQueue::init(Context *context, uint32_t queueFamilyIndex, VkQueue queue)
+{
+    ASSERT(queue != VK_NULL_HANDLE);
+    VkDevice device = context->getDevice();
+
+    mQueue            = queue;
+    mQueueFamilyIndex = queueFamilyIndex;
+
+    VkCommandPoolCreateInfo poolInfo = {};
+    poolInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags =
+        VK_COMMAND_POOL_CREATE_TRANSIENT_BIT | VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    poolInfo.queueFamilyIndex = queueFamilyIndex;
+    ANGLE_VK_TRY(context, mCommandPool.init(device, poolInfo));
+
+    ANGLE_VK_TRY(context, mSemaphore.initTimeline(device, 0));
+
+    return angle::Result::Continue;
+}
+
+void TransferQueue::destroy(VkDevice device)
+{
+    if (!valid())
+    {
+        return;
+    }
+
+    // The graphics queues are idle at this point, and so is this queue once its semaphore has
+    // reached the last value.
+    vkQueueWaitIdle(mQueue);
+
+    for (InFlightCommandBuffer &inFlight : mInFlightCommandBuffers)
+    {
+        inFlight.commandBuffer.destroy(device, mCommandPool);
+    }
+    mInFlightCommandBuffers.clear();
+    for (PrimaryCommandBuffer &commandBuffer : mFreeCommandBuffers)
+    {
+        commandBuffer.destroy(device, mCommandPool);
+    }
+    mFreeCommandBuffers.clear();
+
+    mCommandPool.destroy(device);
+    mSemaphore.destroy(device);
+    mQueue            = VK_NULL_HANDLE;
+    mQueueFamilyIndex = QueueFamily::kInvalidIndex;
+}
+
+angle::Result TransferQueue::beginCommandBuffer(Context *context,
+                                                PrimaryCommandBuffer *commandBufferOut)
+{
+    ASSERT(valid());
+    VkDevice device = context->getDevice();
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        recycleCompletedCommandBuffersLocked(device);
+
+        if (!mFreeCommandBuffers.empty())
+        {
+            *commandBufferOut = std::move(mFreeCommandBuffers.back());
+            mFreeCommandBuffers.pop_back();
+        }
+        else
+        {
+            VkCommandBufferAllocateInfo allocInfo = {};
+            allocInfo.sType                       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocInfo.commandBufferCount          = 1;
+            allocInfo.commandPool                 = mCommandPool.getHandle();
+            ANGLE_VK_TRY(context, commandBufferOut->init(device, allocInfo));
+        }
+    }
+
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType                    = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+    ANGLE_VK_TRY(context, commandBufferOut->begin(beginInfo));
+
+    return angle::Result::Continue;
+}
+
+angle::Result TransferQueue::submit(Context *context, PrimaryCommandBuffer &&commandBuffer)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "TransferQueue::submit");
+    ASSERT(valid());
+
+    ANGLE_VK_TRY(context, commandBuffer.end());
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    const uint64_t value = mLastSubmittedValue.load(std::memory_order_relaxed) + 1;
+
+    VkTimelineSemaphoreSubmitInfoKHR timelineInfo = {};
+    timelineInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+    timelineInfo.signalSemaphoreValueCount = 1;
+    timelineInfo.pSignalSemaphoreValues    = &value;
+
+    VkSubmitInfo submitInfo         = {};
+    submitInfo.sType                = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    submitInfo.pNext                = &timelineInfo;
+    submitInfo.commandBufferCount   = 1;
+    submitInfo.pCommandBuffers      = commandBuffer.ptr();
+    submitInfo.signalSemaphoreCount = 1;
+    submitInfo.pSignalSemaphores    = mSemaphore.ptr();
+
+    ANGLE_VK_TRY(context, vkQueueSubmit(mQueue, 1, &submitInfo, VK_NULL_HANDLE));
+
+    // Published only once submitted, so the graphics queues never wait for a value that no
+    // submission signals.
+    mLastSubmittedValue.store(value, std::memory_order_release);
+    mInFlightCommandBuffers.push_back({std::move(commandBuffer), value});
+
+    return angle::Result::Continue;
+}
+
+bool TransferQueue::getPendingWaitValue(VkDevice device, uint64_t *valueOut)
+{
+    const uint64_t lastSubmittedValue = mLastSubmittedValue.load(std::memory_order_acquire);
+    if (lastSubmittedValue <= mLastCompletedValue.load(std::memory_order_relaxed))
+    {
+        return false;
+    }
+
+    uint64_t completedValue = 0;
+    if (mSemaphore.getCounterValue(device, &completedValue) == VK_SUCCESS)
+    {
+        mLastCompletedValue.store(completedValue, std::memory_order_relaxed);
+        if (lastSubmittedValue <= completedValue)
+        {
+            return false;
+        }
+    }
+
+    *valueOut = lastSubmittedValue;
+    return true;
+}
+
+void TransferQueue::recycleCompletedCommandBuffersLocked(VkDevice device)
+{
+    if (mInFlightCommandBuffers.empty())
+    {
+        return;
+    }
+
+    uint64_t completedValue = 0;
+    if (mSemaphore.getCounterValue(device, &completedValue) != VK_SUCCESS)
+    {
+        return;
+    }
+    mLastCompletedValue.store(completedValue, std::memory_order_relaxed);
+
+    while (!mInFlightCommandBuffers.empty() &&
+           mInFlightCommandBuffers.front().value <= completedValue)
+    {
+        PrimaryCommandBuffer &commandBuffer = mInFlightCommandBuffers.front().commandBuffer;
+        if (commandBuffer.reset() == VK_SUCCESS)
+        {
+            mFreeCommandBuffers.push_back(std::move(commandBuffer));
+        }
+        else
+        {
+            commandBuffer.destroy(device, mCommandPool);
+        }
+        mInFlightCommandBuffers.pop_front();
+    }
+}
+
 CommandProcessor::CommandProcessor(RendererVk *renderer)
-    : Context(renderer), mWorkerThreadIdle(false)
+    : Context(renderer),
+      mTasks(kMaxQueuedTasks),
+      mSpinCountBeforePark(GetSpinCountBeforePark()),
+      mWorkerThreadParked(false),
+      mWorkerThreadIdle(false)
 {
     std::lock_guard<std::mutex> queueLock(mErrorMutex);
     while (!mErrors.empty())
@@ -435,12 +826,24 @@ angle::Result CommandProcessor::checkAndPopPendingError(Context *errorHandlingCo
 void CommandProcessor::queueCommand(CommandProcessorTask &&task)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "CommandProcessor::queueCommand");
-    // Grab the worker mutex so that we put things on the queue in the same order as we give out
-    // serials.
-    std::lock_guard<std::mutex> queueLock(mWorkerMutex);
+    // Callers hold the renderer's command queue mutex, so tasks are put on the queue in the same
+    // order as serials are given out.
+    task.setQueueTime(angle::GetCurrentSystemTime());
 
-    mTasks.emplace(std::move(task));
-    mWorkAvailableCondition.notify_one();
+    while (!mTasks.tryPush(std::move(task)))
+    {
+        // The worker thread is behind; it will free up a slot shortly.
+        std::this_thread::yield();
+    }
+
+    // The push above and the load below are sequentially consistent, as are the corresponding
+    // operations in processTasksImpl(), so either the worker thread sees the new task before
+    // parking, or the parked flag is seen here.
+    if (mWorkerThreadParked.load())
+    {
+        std::lock_guard<std::mutex> lock(mWorkerMutex);
+        mWorkAvailableCondition.notify_one();
+    }
 }
 
 void CommandProcessor::processTasks()
@@ -467,27 +870,39 @@ void CommandProcessor::processTasks()
 
 angle::Result CommandProcessor::processTasksImpl(bool *exitThread)
 {
+    CommandProcessorTask task;
     while (true)
     {
-        std::unique_lock<std::mutex> lock(mWorkerMutex);
-        if (mTasks.empty())
+        uint32_t spinCount = 0;
+        while (!mTasks.tryPop(&task))
         {
-            mWorkerThreadIdle = true;
-            mWorkerIdleCondition.notify_all();
-            // Only wake if notified and command queue is not empty
-            mWorkAvailableCondition.wait(lock, [this] { return !mTasks.empty(); });
+            if (spinCount < mSpinCountBeforePark)
+            {
+                ++spinCount;
+                ANGLE_SMT_PAUSE();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mWorkerMutex);
+            mWorkerThreadParked.store(true);
+            if (mTasks.empty())
+            {
+                mWorkerThreadIdle = true;
+                mWorkerIdleCondition.notify_all();
+                // Only wake if notified and command queue is not empty
+                mWorkAvailableCondition.wait(lock, [this] { return !mTasks.empty(); });
+            }
+            mWorkerThreadParked.store(false);
+            mWorkerThreadIdle = false;
+            spinCount         = 0;
         }
-        mWorkerThreadIdle = false;
-        CommandProcessorTask task(std::move(mTasks.front()));
-        mTasks.pop();
-        lock.unlock();
 
         ANGLE_TRY(processTask(&task));
         if (task.getTaskCommand() == CustomTask::Exit)
         {
 
             *exitThread = true;
-            lock.lock();
+            std::lock_guard<std::mutex> lock(mWorkerMutex);
             mWorkerThreadIdle = true;
             mWorkerIdleCondition.notify_one();
             return angle::Result::Continue;
@@ -521,6 +936,7 @@ angle::Result CommandProcessor::processTask(CommandProcessorTask *task)
                 task->getWaitSemaphoreStageMasks(), task->getSemaphore(),
                 std::move(task->getGarbage()), std::move(task->getCommandBuffersToReset()),
                 task->getCommandPools(), task->getQueueSerial()));
+            recordSubmitLatency(*task);
 
             ASSERT(task->getGarbage().empty());
             break;
@@ -534,6 +950,7 @@ angle::Result CommandProcessor::processTask(CommandProcessorTask *task)
                 task->getOneOffCommandBufferVk(), task->getOneOffWaitSemaphore(),
                 task->getOneOffWaitSemaphoreStageMask(), task->getOneOffFence(),
                 SubmitPolicy::EnsureSubmitted, task->getQueueSerial()));
+            recordSubmitLatency(*task);
             ANGLE_TRY(mCommandQueue.checkCompletedCommands(this));
             break;
         }
@@ -550,6 +967,14 @@ angle::Result CommandProcessor::processTask(CommandProcessorTask *task)
         }
         case CustomTask::Present:
         {
+            if (mRenderer->isPresentThreadEnabled())
+            {
+                // The submission that signals the present's wait semaphore has been made, so the
+                // present can be handed off.
+                handOffPresent(std::move(*task));
+                break;
+            }
+
             VkResult result = present(task->getPriority(), task->getPresentInfo());
             if (ANGLE_UNLIKELY(result == VK_ERROR_OUT_OF_DATE_KHR || result == VK_SUBOPTIMAL_KHR))
             {
@@ -701,6 +1126,13 @@ void CommandProcessor::handleDeviceLost(RendererVk *renderer)
     mCommandQueue.handleDeviceLost(renderer);
 }
 
+void CommandProcessor::recordSubmitLatency(const CommandProcessorTask &task)
+{
+    const double latencySeconds = angle::GetCurrentSystemTime() - task.getQueueTime();
+    mSubmitLatencyTracker.record(task.getPriority(),
+                                 static_cast<uint64_t>(std::max(latencySeconds, 0.0) * 1e9));
+}
+
 VkResult CommandProcessor::getLastAndClearPresentResult(VkSwapchainKHR swapchain)
 {
     std::unique_lock<std::mutex> lock(mSwapchainStatusMutex);
@@ -716,6 +1148,20 @@ VkResult CommandProcessor::getLastAndClearPresentResult(VkSwapchainKHR swapchain
     return result;
 }
 
+void CommandProcessor::handOffPresent(CommandProcessorTask &&task)
+{
+    ASSERT(task.getPresentInfo().swapchainCount == 1);
+    VkSwapchainKHR swapchain = task.getPresentInfo().pSwapchains[0];
+
+    mRenderer->getPresentThread().enqueue(std::move(task));
+
+    // Unblock getLastAndClearPresentResult.  The result of the present itself is returned by the
+    // present thread.
+    std::lock_guard<std::mutex> lock(mSwapchainStatusMutex);
+    mSwapchainStatus[swapchain] = VK_SUCCESS;
+    mSwapchainStatusCondition.notify_all();
+}
+
 VkResult CommandProcessor::present(egl::ContextPriority priority,
                                    const VkPresentInfoKHR &presentInfo)
 {
@@ -846,7 +1292,10 @@ angle::Result CommandProcessor::ensureNoPendingWork(Context *context)
 }
 
 // CommandQueue implementation.
-CommandQueue::CommandQueue() : mCurrentQueueSerial(mQueueSerialFactory.generate()), mPerfCounters{}
+CommandQueue::CommandQueue()
+    : mCurrentQueueSerial(mQueueSerialFactory.generate()),
+      mUseTimelineSemaphores(false),
+      mPerfCounters{}
 {}
 
 CommandQueue::~CommandQueue() = default;
@@ -876,8 +1325,14 @@ void CommandQueue::destroy(Context *context)
         mProtectedPrimaryCommandPool.destroy(renderer->getDevice());
     }
 
+    mCommandReplayer.destroy(renderer->getDevice());
     mFenceRecycler.destroy(context);
 
+    for (Semaphore &semaphore : mTimelineSemaphores)
+    {
+        semaphore.destroy(renderer->getDevice());
+    }
+
     ASSERT(mInFlightCommands.empty() && mGarbageQueue.empty());
 }
 
@@ -892,6 +1347,24 @@ angle::Result CommandQueue::init(Context *context, const vk::DeviceQueueMap &que
         ANGLE_TRY(mProtectedPrimaryCommandPool.init(context, true, queueMap.getIndex()));
     }
 
+    const angle::FeaturesVk &features = context->getRenderer()->getFeatures();
+
+    if (features.replayRenderPassCommandsInParallel.enabled)
+    {
+        mCommandReplayer.init(queueMap.getIndex());
+    }
+
+    mUseTimelineSemaphores = features.supportsTimelineSemaphore.enabled &&
+                             features.useTimelineSemaphoreForQueueSerials.enabled;
+    if (mUseTimelineSemaphores)
+    {
+        // Queue serials start at 1, so 0 is never a serial that was submitted.
+        for (Semaphore &semaphore : mTimelineSemaphores)
+        {
+            ANGLE_VK_TRY(context, semaphore.initTimeline(context->getDevice(), 0));
+        }
+    }
+
     return angle::Result::Continue;
 }
 
@@ -903,12 +1376,29 @@ angle::Result CommandQueue::checkCompletedCommands(Context *context)
 
     int finishedCount = 0;
 
+    // With timeline semaphores, the counter of each priority is read at most once.  0 is never a
+    // submitted serial, so it says the counter has not been read yet.
+    angle::PackedEnumMap<egl::ContextPriority, uint64_t> completedTimelineValues = {};
+
     for (CommandBatch &batch : mInFlightCommands)
     {
         // For empty submissions, fence is not set but there may be garbage to be collected.  In
         // such a case, the empty submission is "completed" at the same time as the last submission
         // that actually happened.
-        if (batch.fence.isReferenced())
+        if (batch.signalsTimelineSemaphore)
+        {
+            uint64_t &completedValue = completedTimelineValues[batch.priority];
+            if (completedValue == 0)
+            {
+                ANGLE_VK_TRY(context, mTimelineSemaphores[batch.priority].getCounterValue(
+                                          device, &completedValue));
+            }
+            if (completedValue < batch.serial.getValue())
+            {
+                break;
+            }
+        }
+        else if (batch.fence.isReferenced())
         {
             VkResult result = batch.fence.get().getStatus(device);
             if (result == VK_NOT_READY)
@@ -954,6 +1444,7 @@ angle::Result CommandQueue::retireFinishedCommands(Context *context, size_t fini
         }
         ANGLE_TRACE_EVENT0("gpu.angle", "Secondary command buffer recycling");
         batch.resetSecondaryCommandBuffers(device);
+        ANGLE_TRY(mCommandReplayer.recycleCommandBuffers(context, &batch.replayCommandBuffers));
     }
 
     mLastCompletedQueueSerial = lastCompletedQueueSerial;
@@ -993,6 +1484,12 @@ void CommandQueue::releaseToCommandBatch(bool hasProtectedContent,
     batch->primaryCommands     = std::move(commandBuffer);
     batch->commandPools        = commandPools;
     batch->hasProtectedContent = hasProtectedContent;
+
+    // Render passes are only replayed in parallel into the unprotected primary command buffer.
+    if (!hasProtectedContent)
+    {
+        mCommandReplayer.releaseInFlightCommandBuffers(&batch->replayCommandBuffers);
+    }
 }
 
 void CommandQueue::clearAllGarbage(RendererVk *renderer)
@@ -1017,9 +1514,9 @@ void CommandQueue::handleDeviceLost(RendererVk *renderer)
     for (CommandBatch &batch : mInFlightCommands)
     {
         // On device loss we need to wait for fence to be signaled before destroying it
-        if (batch.fence.isReferenced())
+        if (hasSubmission(batch))
         {
-            VkResult status = batch.fence.get().wait(device, renderer->getMaxFenceWaitTimeNs());
+            VkResult status = waitForBatch(device, batch, renderer->getMaxFenceWaitTimeNs());
             // If the wait times out, it is probably not possible to recover from lost device
             ASSERT(status == VK_SUCCESS || status == VK_ERROR_DEVICE_LOST);
 
@@ -1034,10 +1531,25 @@ void CommandQueue::handleDeviceLost(RendererVk *renderer)
         }
 
         batch.resetSecondaryCommandBuffers(device);
+        batch.replayCommandBuffers.destroy(device);
     }
     mInFlightCommands.clear();
 }
 
+VkResult CommandQueue::waitForBatch(VkDevice device,
+                                    const CommandBatch &batch,
+                                    uint64_t timeout) const
+{
+    ASSERT(hasSubmission(batch));
+
+    if (batch.signalsTimelineSemaphore)
+    {
+        return mTimelineSemaphores[batch.priority].wait(device, batch.serial.getValue(), timeout);
+    }
+
+    return batch.fence.get().wait(device, timeout);
+}
+
 bool CommandQueue::allInFlightCommandsAreAfterSerial(Serial serial)
 {
     return mInFlightCommands.empty() || mInFlightCommands[0].serial > serial;
@@ -1055,8 +1567,8 @@ angle::Result CommandQueue::finishToSerial(Context *context, Serial finishSerial
     // Find the serial in the the list. The serials should be in order.
     ASSERT(CommandsHaveValidOrdering(mInFlightCommands));
 
-    Shared<Fence> *fenceToWaitOn = nullptr;
-    size_t finishCount = GetBatchCountUpToSerial(mInFlightCommands, finishSerial, &fenceToWaitOn);
+    const CommandBatch *batchToWaitOn = nullptr;
+    size_t finishCount = GetBatchCountUpToSerial(mInFlightCommands, finishSerial, &batchToWaitOn);
 
     if (finishCount == 0)
     {
@@ -1065,10 +1577,10 @@ angle::Result CommandQueue::finishToSerial(Context *context, Serial finishSerial
 
     // Wait for it finish.  If no fence, the serial is already finished, it might just have garbage
     // to clean up.
-    if (fenceToWaitOn != nullptr)
+    if (batchToWaitOn != nullptr)
     {
         VkDevice device = context->getDevice();
-        VkResult status = fenceToWaitOn->get().wait(device, timeout);
+        VkResult status = waitForBatch(device, *batchToWaitOn, timeout);
 
         ANGLE_VK_TRY(context, status);
     }
@@ -1116,6 +1628,7 @@ angle::Result CommandQueue::submitFrame(
     batch.serial                = submitQueueSerial;
     batch.hasProtectedContent   = hasProtectedContent;
     batch.commandBuffersToReset = std::move(commandBuffersToReset);
+    batch.priority              = priority;
 
     // Don't make a submission if there is nothing to submit.
     PrimaryCommandBuffer &commandBuffer = getCommandBuffer(hasProtectedContent);
@@ -1142,8 +1655,17 @@ angle::Result CommandQueue::submitFrame(
 
         ANGLE_TRACE_EVENT0("gpu.angle", "CommandQueue::submitFrame");
 
-        ANGLE_TRY(mFenceRecycler.newSharedFence(context, &batch.fence));
-        ANGLE_TRY(queueSubmit(context, priority, submitInfo, &batch.fence.get(), batch.serial));
+        if (mUseTimelineSemaphores)
+        {
+            // queueSubmit() signals the timeline semaphore.
+            batch.signalsTimelineSemaphore = true;
+            ANGLE_TRY(queueSubmit(context, priority, submitInfo, nullptr, batch.serial));
+        }
+        else
+        {
+            ANGLE_TRY(mFenceRecycler.newSharedFence(context, &batch.fence));
+            ANGLE_TRY(queueSubmit(context, priority, submitInfo, &batch.fence.get(), batch.serial));
+        }
     }
     else
     {
@@ -1201,8 +1723,8 @@ angle::Result CommandQueue::waitForSerialWithUserTimeout(vk::Context *context,
                                                          uint64_t timeout,
                                                          VkResult *result)
 {
-    Shared<Fence> *fenceToWaitOn = nullptr;
-    size_t finishCount = GetBatchCountUpToSerial(mInFlightCommands, serial, &fenceToWaitOn);
+    const CommandBatch *batchToWaitOn = nullptr;
+    size_t finishCount = GetBatchCountUpToSerial(mInFlightCommands, serial, &batchToWaitOn);
 
     // The serial is already complete if:
     //
@@ -1210,7 +1732,7 @@ angle::Result CommandQueue::waitForSerialWithUserTimeout(vk::Context *context,
     // - The given serial is smaller than the smallest serial, or
     // - Every batch up to this serial is a garbage-clean-up-only batch (i.e. empty submission
     //   that's optimized out)
-    if (finishCount == 0 || fenceToWaitOn == nullptr)
+    if (finishCount == 0 || batchToWaitOn == nullptr)
     {
         *result = VK_SUCCESS;
         return angle::Result::Continue;
@@ -1229,7 +1751,7 @@ angle::Result CommandQueue::waitForSerialWithUserTimeout(vk::Context *context,
     }
     ASSERT(serial == batch.serial);
 
-    *result = fenceToWaitOn->get().wait(context->getDevice(), timeout);
+    *result = waitForBatch(context->getDevice(), *batchToWaitOn, timeout);
 
     // Don't trigger an error on timeout.
     if (*result != VK_TIMEOUT)
@@ -1279,7 +1801,9 @@ angle::Result CommandQueue::flushRenderPassCommands(
 {
     ANGLE_TRY(ensurePrimaryCommandBufferValid(context, hasProtectedContent));
     PrimaryCommandBuffer &commandBuffer = getCommandBuffer(hasProtectedContent);
-    return (*renderPassCommands)->flushToPrimary(context, &commandBuffer, &renderPass);
+    // Protected command pools are not supported by the replayer.
+    ParallelCommandReplayer *replayer = hasProtectedContent ? nullptr : &mCommandReplayer;
+    return (*renderPassCommands)->flushToPrimary(context, &commandBuffer, &renderPass, replayer);
 }
 
 angle::Result CommandQueue::queueSubmitOneOff(Context *context,
@@ -1337,7 +1861,76 @@ angle::Result CommandQueue::queueSubmit(Context *context,
 
     VkFence fenceHandle = fence ? fence->getHandle() : VK_NULL_HANDLE;
     VkQueue queue       = getQueue(contextPriority);
-    ANGLE_VK_TRY(context, vkQueueSubmit(queue, 1, &submitInfo, fenceHandle));
+
+    // Uploads made on the transfer queue are acquired by the commands of this submission, so it
+    // must wait for them.  Only the transfer work of the submission waits, which is where the
+    // acquire barriers execute.
+    TransferQueue &transferQueue     = renderer->getTransferQueue();
+    uint64_t transferQueueWaitValue  = 0;
+    const bool waitsForTransferQueue =
+        transferQueue.valid() &&
+        transferQueue.getPendingWaitValue(renderer->getDevice(), &transferQueueWaitValue);
+
+    if (mUseTimelineSemaphores || waitsForTransferQueue)
+    {
+        // Append the timeline semaphores to the wait and signal semaphores.  The values of binary
+        // semaphores are ignored.
+        constexpr size_t kMaxSignalSemaphores = 2;
+        ASSERT(submitInfo.signalSemaphoreCount < kMaxSignalSemaphores);
+
+        angle::FastVector<VkSemaphore, 4> waitSemaphores;
+        angle::FastVector<VkPipelineStageFlags, 4> waitStageMasks;
+        angle::FastVector<uint64_t, 4> waitValues;
+        for (uint32_t index = 0; index < submitInfo.waitSemaphoreCount; ++index)
+        {
+            waitSemaphores.push_back(submitInfo.pWaitSemaphores[index]);
+            waitStageMasks.push_back(submitInfo.pWaitDstStageMask[index]);
+            waitValues.push_back(0);
+        }
+        if (waitsForTransferQueue)
+        {
+            waitSemaphores.push_back(transferQueue.getSemaphore().getHandle());
+            waitStageMasks.push_back(VK_PIPELINE_STAGE_TRANSFER_BIT);
+            waitValues.push_back(transferQueueWaitValue);
+        }
+
+        angle::FixedVector<VkSemaphore, kMaxSignalSemaphores> signalSemaphores;
+        angle::FixedVector<uint64_t, kMaxSignalSemaphores> signalValues;
+        for (uint32_t index = 0; index < submitInfo.signalSemaphoreCount; ++index)
+        {
+            signalSemaphores.push_back(submitInfo.pSignalSemaphores[index]);
+            signalValues.push_back(0);
+        }
+        if (mUseTimelineSemaphores)
+        {
+            signalSemaphores.push_back(mTimelineSemaphores[contextPriority].getHandle());
+            signalValues.push_back(submitQueueSerial.getValue());
+        }
+
+        VkTimelineSemaphoreSubmitInfoKHR timelineInfo = {};
+
+        timelineInfo.sType = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO_KHR;
+        timelineInfo.pNext = submitInfo.pNext;
+
+        timelineInfo.waitSemaphoreValueCount   = static_cast<uint32_t>(waitValues.size());
+        timelineInfo.pWaitSemaphoreValues      = waitValues.data();
+        timelineInfo.signalSemaphoreValueCount = static_cast<uint32_t>(signalValues.size());
+        timelineInfo.pSignalSemaphoreValues    = signalValues.data();
+
+        VkSubmitInfo timelineSubmitInfo         = submitInfo;
+        timelineSubmitInfo.pNext                = &timelineInfo;
+        timelineSubmitInfo.waitSemaphoreCount   = static_cast<uint32_t>(waitSemaphores.size());
+        timelineSubmitInfo.pWaitSemaphores      = waitSemaphores.data();
+        timelineSubmitInfo.pWaitDstStageMask    = waitStageMasks.data();
+        timelineSubmitInfo.signalSemaphoreCount = static_cast<uint32_t>(signalSemaphores.size());
+        timelineSubmitInfo.pSignalSemaphores    = signalSemaphores.data();
+
+        ANGLE_VK_TRY(context, vkQueueSubmit(queue, 1, &timelineSubmitInfo, fenceHandle));
+    }
+    else
+    {
+        ANGLE_VK_TRY(context, vkQueueSubmit(queue, 1, &submitInfo, fenceHandle));
+    }
     mLastSubmittedQueueSerial = submitQueueSerial;
 
     ++mPerfCounters.vkQueueSubmitCallsTotal;
@@ -1370,6 +1963,8 @@ constexpr float kVulkanQueuePriorityHigh   = 1.0;
 
 const float QueueFamily::kQueuePriorities[static_cast<uint32_t>(egl::ContextPriority::EnumCount)] =
     {kVulkanQueuePriorityMedium, kVulkanQueuePriorityHigh, kVulkanQueuePriorityLow};
+const float QueueFamily::kPresentQueuePriority  = kVulkanQueuePriorityHigh;
+const float QueueFamily::kTransferQueuePriority = kVulkanQueuePriorityMedium;
 
 egl::ContextPriority DeviceQueueMap::getDevicePriority(egl::ContextPriority priority) const
 {
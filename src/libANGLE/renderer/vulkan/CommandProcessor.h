@@ -11,11 +11,15 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_COMMAND_PROCESSOR_H_
 #define LIBANGLE_RENDERER_VULKAN_COMMAND_PROCESSOR_H_
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <queue>
 #include <thread>
 
+#include "common/MPSCQueue.h"
 #include "common/vulkan/vk_headers.h"
 #include "libANGLE/renderer/vulkan/PersistentCommandPool.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
@@ -126,6 +130,8 @@ class CommandProcessorTask
 
     void setQueueSerial(Serial serial) { mSerial = serial; }
     Serial getQueueSerial() const { return mSerial; }
+    void setQueueTime(double queueTime) { mQueueTime = queueTime; }
+    double getQueueTime() const { return mQueueTime; }
     CustomTask getTaskCommand() { return mTask; }
     std::vector<VkSemaphore> &getWaitSemaphores() { return mWaitSemaphores; }
     std::vector<VkPipelineStageFlags> &getWaitSemaphoreStageMasks()
@@ -186,6 +192,9 @@ class CommandProcessorTask
     VkPresentRegionKHR mPresentRegion;
     VkPresentRegionsKHR mPresentRegions;
     std::vector<VkRectLayerKHR> mRects;
+    // Used by Present if the surface paces frames with VK_KHR_present_wait
+    VkPresentIdKHR mPresentId;
+    uint64_t mPresentIdValue;
 
     // Used by OneOffQueueSubmit
     VkCommandBuffer mOneOffCommandBufferVk;
@@ -196,6 +205,9 @@ class CommandProcessorTask
     // Flush, Present & QueueWaitIdle data
     egl::ContextPriority mPriority;
     bool mHasProtectedContent;
+
+    // Time at which the task was queued to the worker thread, used to measure submit latency.
+    double mQueueTime;
 };
 
 struct CommandBatch final : angle::NonCopyable
@@ -212,9 +224,15 @@ struct CommandBatch final : angle::NonCopyable
     // commandPools is for secondary CommandBuffer allocation
     SecondaryCommandPools *commandPools;
     SecondaryCommandBufferList commandBuffersToReset;
+    // Vulkan secondary command buffers that render passes were replayed into in parallel.
+    ReplayCommandBufferList replayCommandBuffers;
     Shared<Fence> fence;
     Serial serial;
     bool hasProtectedContent;
+    // When queue serials are tracked with timeline semaphores, the batch is complete once the
+    // semaphore of |priority| reaches |serial|.  Empty batches signal nothing.
+    bool signalsTimelineSemaphore;
+    egl::ContextPriority priority;
 };
 
 class DeviceQueueMap;
@@ -230,6 +248,10 @@ class QueueFamily final : angle::NonCopyable
                               uint32_t *matchCount);
     static const uint32_t kQueueCount = static_cast<uint32_t>(egl::ContextPriority::EnumCount);
     static const float kQueuePriorities[static_cast<uint32_t>(egl::ContextPriority::EnumCount)];
+    // Priority of the queue used by PresentThread, created after the kQueueCount queues above.
+    static const float kPresentQueuePriority;
+    // Priority of the queue used by TransferQueue, which is of another queue family.
+    static const float kTransferQueuePriority;
 
     QueueFamily() : mProperties{}, mIndex(kInvalidIndex) {}
     ~QueueFamily() {}
@@ -251,11 +273,11 @@ class QueueFamily final : angle::NonCopyable
                                       uint32_t queueIndex,
                                       uint32_t queueCount);
 
+    void getDeviceQueue(VkDevice device, bool makeProtected, uint32_t queueIndex, VkQueue *queue);
+
   private:
     VkQueueFamilyProperties mProperties;
     uint32_t mIndex;
-
-    void getDeviceQueue(VkDevice device, bool makeProtected, uint32_t queueIndex, VkQueue *queue);
 };
 
 class DeviceQueueMap : public angle::PackedEnumMap<egl::ContextPriority, VkQueue>
@@ -436,6 +458,14 @@ class CommandQueue final : public CommandQueueInterface
     angle::Result retireFinishedCommands(Context *context, size_t finishedCount);
     angle::Result ensurePrimaryCommandBufferValid(Context *context, bool hasProtectedContent);
 
+    // Whether the batch made a submission that can be waited on.  Batches that did not are complete
+    // when the previous batch is.
+    bool hasSubmission(const CommandBatch &batch) const
+    {
+        return batch.fence.isReferenced() || batch.signalsTimelineSemaphore;
+    }
+    VkResult waitForBatch(VkDevice device, const CommandBatch &batch, uint64_t timeout) const;
+
     bool allInFlightCommandsAreAfterSerial(Serial serial);
 
     PrimaryCommandBuffer &getCommandBuffer(bool hasProtectedContent)
@@ -472,6 +502,9 @@ class CommandQueue final : public CommandQueueInterface
     PrimaryCommandBuffer mProtectedPrimaryCommands;
     PersistentCommandPool mProtectedPrimaryCommandPool;
 
+    // Replays large render passes in parallel, if enabled.
+    ParallelCommandReplayer mCommandReplayer;
+
     // Queue serial management.
     AtomicSerialFactory mQueueSerialFactory;
     Serial mLastSubmittedQueueSerial;
@@ -486,9 +519,145 @@ class CommandQueue final : public CommandQueueInterface
 
     FenceRecycler mFenceRecycler;
 
+    // With useTimelineSemaphoreForQueueSerials, every submission signals the timeline semaphore of
+    // its priority with its queue serial instead of a fence.  Serials are submitted in increasing
+    // order, so a single counter read tells which batches of that priority are complete.  Each
+    // priority gets its own semaphore as submissions to different queues may finish out of order.
+    bool mUseTimelineSemaphores;
+    angle::PackedEnumMap<egl::ContextPriority, Semaphore> mTimelineSemaphores;
+
     angle::VulkanPerfCounters mPerfCounters;
 };
 
+// Keeps track of how long the most recent submissions to each queue priority waited in the
+// CommandProcessor, from the time they were queued until vkQueueSubmit returned.
+class SubmitLatencyTracker final : angle::NonCopyable
+{
+  public:
+    SubmitLatencyTracker();
+    ~SubmitLatencyTracker();
+
+    void record(egl::ContextPriority priority, uint64_t latencyNs);
+
+    // |percentile| is in [0, 100].  Returns 0 if nothing was submitted at |priority| yet.
+    uint64_t getPercentileNs(egl::ContextPriority priority, uint32_t percentile) const;
+
+  private:
+    static constexpr size_t kMaxSamples = 256;
+
+    struct Samples
+    {
+        std::array<uint64_t, kMaxSamples> latenciesNs;
+        size_t count;
+        size_t next;
+    };
+
+    mutable std::mutex mMutex;
+    angle::PackedEnumMap<egl::ContextPriority, Samples> mSamples;
+};
+
+// PresentThread calls vkQueuePresentKHR on a queue of its own when the asyncPresent feature is
+// enabled, so that a present that blocks (typically on the compositor) holds up neither the
+// application thread nor the submission of the next frame.  Presents are queued only after the
+// submission that signals their wait semaphore, which keeps the binary semaphore rules satisfied
+// across the two queues.
+//
+// Vulkan requires external synchronization of the swapchain between vkQueuePresentKHR and
+// vkAcquireNextImageKHR (or destroying the swapchain), so the owner of the swapchain must call
+// waitForPresents before doing either.
+class PresentThread final : angle::NonCopyable
+{
+  public:
+    PresentThread();
+    ~PresentThread();
+
+    void init(VkQueue queue);
+    void destroy();
+
+    bool valid() const { return mQueue != VK_NULL_HANDLE; }
+
+    // |task| must be a CustomTask::Present task.
+    void enqueue(CommandProcessorTask &&task);
+
+    // Waits for the presents queued to |swapchain| to be done, and returns the result of the last
+    // one.  Returns VK_SUCCESS if there are none.
+    VkResult waitForPresents(VkSwapchainKHR swapchain);
+
+    // Waits for all queued presents to be done.
+    void waitIdle();
+
+  private:
+    struct SwapchainStatus
+    {
+        uint32_t pendingCount;
+        VkResult lastResult;
+    };
+
+    void processPresents();
+
+    VkQueue mQueue;
+
+    std::mutex mMutex;
+    std::condition_variable mWorkAvailableCondition;
+    std::condition_variable mPresentDoneCondition;
+    std::queue<CommandProcessorTask> mPresents;
+    std::map<VkSwapchainKHR, SwapchainStatus> mSwapchainStatus;
+    uint32_t mPendingCount;
+    bool mExitThread;
+
+    std::thread mThread;
+};
+
+// TransferQueue executes large uploads on a queue of a transfer-only queue family when the
+// useTransferQueueForUploads feature is enabled, so that the copies run on the copy engine of the
+// GPU alongside rendering.  Every submission signals a timeline semaphore with an increasing
+// value.  Resources written on this queue are released to the graphics queue family at the end of
+// the submission, and every submission to the graphics queues waits for the transfer submissions
+// made before it at the transfer stage, which is where the acquire barriers execute.
+class TransferQueue final : angle::NonCopyable
+{
+  public:
+    TransferQueue();
+    ~TransferQueue();
+
+    angle::Result init(Context *context, uint32_t queueFamilyIndex, VkQueue queue);
+    void destroy(VkDevice device);
+
+    bool valid() const { return mQueue != VK_NULL_HANDLE; }
+    uint32_t getQueueFamilyIndex() const { return mQueueFamilyIndex; }
+    const Semaphore &getSemaphore() const { return mSemaphore; }
+
+    // Returns a command buffer in the recording state.  It must be given back with submit.
+    angle::Result beginCommandBuffer(Context *context, PrimaryCommandBuffer *commandBufferOut);
+    angle::Result submit(Context *context, PrimaryCommandBuffer &&commandBuffer);
+
+    // Returns false if every submission is known to be complete.  Otherwise, |valueOut| is the
+    // value of the semaphore signaled by the last submission.
+    bool getPendingWaitValue(VkDevice device, uint64_t *valueOut);
+
+  private:
+    struct InFlightCommandBuffer
+    {
+        PrimaryCommandBuffer commandBuffer;
+        uint64_t value;
+    };
+
+    void recycleCompletedCommandBuffersLocked(VkDevice device);
+
+    VkQueue mQueue;
+    uint32_t mQueueFamilyIndex;
+    Semaphore mSemaphore;
+
+    std::atomic<uint64_t> mLastSubmittedValue;
+    std::atomic<uint64_t> mLastCompletedValue;
+
+    // Protects the command pool and the command buffers, as contexts of any thread may upload.
+    std::mutex mMutex;
+    CommandPool mCommandPool;
+    std::vector<PrimaryCommandBuffer> mFreeCommandBuffers;
+    std::deque<InFlightCommandBuffer> mInFlightCommandBuffers;
+};
+
 // CommandProcessor is used to dispatch work to the GPU when the asyncCommandQueue feature is
 // enabled. Issuing the |destroy| command will cause the worker thread to clean up it's resources
 // and shut down. This command is sent when the renderer instance shuts down. Tasks are defined by
@@ -588,6 +757,11 @@ class CommandProcessor final : public Context, public CommandQueueInterface
     }
     void resetPerFramePerfCounters() { mCommandQueue.resetPerFramePerfCounters(); }
 
+    uint64_t getSubmitLatencyPercentileNs(egl::ContextPriority priority, uint32_t percentile) const
+    {
+        return mSubmitLatencyTracker.getPercentileNs(priority, percentile);
+    }
+
   private:
     bool hasPendingError() const
     {
@@ -610,14 +784,21 @@ class CommandProcessor final : public Context, public CommandQueueInterface
 
     // Command processor thread, process a task
     angle::Result processTask(CommandProcessorTask *task);
+    void recordSubmitLatency(const CommandProcessorTask &task);
 
     VkResult getLastAndClearPresentResult(VkSwapchainKHR swapchain);
+    void handOffPresent(CommandProcessorTask &&task);
     VkResult present(egl::ContextPriority priority, const VkPresentInfoKHR &presentInfo);
 
     // Used by main thread to wait for worker thread to complete all outstanding work.
     angle::Result waitForWorkComplete(Context *context);
 
-    std::queue<CommandProcessorTask> mTasks;
+    // Tasks are pushed without taking a lock.  The worker thread spins for a short while when the
+    // queue runs dry before parking on mWorkAvailableCondition, and producers only take
+    // mWorkerMutex to wake it up if it has parked.
+    angle::BoundedMPSCQueue<CommandProcessorTask> mTasks;
+    const uint32_t mSpinCountBeforePark;
+    std::atomic<bool> mWorkerThreadParked;
     mutable std::mutex mWorkerMutex;
     // Signal worker thread when work is available
     std::condition_variable mWorkAvailableCondition;
@@ -625,6 +806,8 @@ class CommandProcessor final : public Context, public CommandQueueInterface
     mutable std::condition_variable mWorkerIdleCondition;
     // Track worker thread Idle state for assertion purposes
     bool mWorkerThreadIdle;
+
+    SubmitLatencyTracker mSubmitLatencyTracker;
     CommandQueue mCommandQueue;
 
     mutable std::mutex mQueueSerialMutex;
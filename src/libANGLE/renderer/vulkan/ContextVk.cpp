@@ -14,6 +14,7 @@
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
+#include "libANGLE/MemoryProgramCache.h"
 #include "libANGLE/Program.h"
 #include "libANGLE/Semaphore.h"
 #include "libANGLE/Surface.h"
@@ -42,6 +43,7 @@
 
 #include "libANGLE/trace.h"
 
+#include <algorithm>
 #include <iostream>
 
 namespace rx
@@ -165,6 +167,7 @@ constexpr gl::ShaderMap<vk::ImageLayout> kShaderWriteImageLayouts = {
 
 constexpr VkBufferUsageFlags kVertexBufferUsage   = VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
 constexpr size_t kDynamicVertexDataSize           = 16 * 1024;
+constexpr size_t kStreamedAttribsDataSize         = 64 * 1024;
 constexpr size_t kDriverUniformsAllocatorPageSize = 4 * 1024;
 
 bool CanMultiDrawIndirectUseCmd(ContextVk *contextVk,
@@ -173,24 +176,32 @@ bool CanMultiDrawIndirectUseCmd(ContextVk *contextVk,
                                 GLsizei drawcount,
                                 GLsizei stride)
 {
-    // Use the generic implementation if multiDrawIndirect is disabled, if line loop is being used
-    // for multiDraw, if drawcount is greater than maxDrawIndirectCount, or if there are streaming
-    // vertex attributes.
+    // Use the generic implementation if line loop is being used for multiDraw, or if there are
+    // streaming vertex attributes.  If multiDrawIndirect is disabled or drawcount is greater than
+    // maxDrawIndirectCount, the draws are split over multiple indirect draw commands instead; see
+    // GetMaxDrawIndirectCount().
     ASSERT(drawcount > 1);
-    const bool supportsMultiDrawIndirect =
-        contextVk->getFeatures().supportsMultiDrawIndirect.enabled;
-    const bool isMultiDrawLineLoop = (mode == gl::PrimitiveMode::LineLoop);
-    const bool isDrawCountBeyondLimit =
-        (static_cast<uint32_t>(drawcount) >
-         contextVk->getRenderer()->getPhysicalDeviceProperties().limits.maxDrawIndirectCount);
+    const bool isMultiDrawLineLoop             = (mode == gl::PrimitiveMode::LineLoop);
     const bool isMultiDrawWithStreamingAttribs = vertexArray->getStreamingVertexAttribsMask().any();
 
-    const bool canMultiDrawIndirectUseCmd = supportsMultiDrawIndirect && !isMultiDrawLineLoop &&
-                                            !isDrawCountBeyondLimit &&
-                                            !isMultiDrawWithStreamingAttribs;
+    const bool canMultiDrawIndirectUseCmd =
+        !isMultiDrawLineLoop && !isMultiDrawWithStreamingAttribs;
     return canMultiDrawIndirectUseCmd;
 }
 
+// The number of draws a single vkCmdDraw*Indirect command can make.  Without multiDrawIndirect,
+// the draw count must be 0 or 1.
+uint32_t GetMaxDrawIndirectCount(ContextVk *contextVk)
+{
+    if (!contextVk->getFeatures().supportsMultiDrawIndirect.enabled)
+    {
+        return 1;
+    }
+
+    return std::max(
+        contextVk->getRenderer()->getPhysicalDeviceProperties().limits.maxDrawIndirectCount, 1u);
+}
+
 uint32_t GetCoverageSampleCount(const gl::State &glState, FramebufferVk *drawFramebuffer)
 {
     if (!glState.isSampleCoverageEnabled())
@@ -582,6 +593,8 @@ constexpr angle::PackedEnumMap<RenderPassClosureReason, const char *> kRenderPas
      "Render pass closed due to sync object with fd insertion"},
     {RenderPassClosureReason::SyncObjectClientWait,
      "Render pass closed due to sync object client wait"},
+    {RenderPassClosureReason::SyncObjectGetStatus,
+     "Render pass closed due to sync object status query"},
     {RenderPassClosureReason::SyncObjectServerWait,
      "Render pass closed due to sync object server wait"},
     {RenderPassClosureReason::XfbPause, "Render pass closed due to transform feedback pause"},
@@ -645,6 +658,8 @@ constexpr ContextVk::DirtyBits ContextVk::kDriverUniformsAndBindingDirtyBits;
 
 void ContextVk::flushDescriptorSetUpdates()
 {
+    gl::ScopedCpuTimePhase cpuTimePhase(mState.getOverlay(), gl::CpuTimePhase::DescriptorUpdate);
+
     mPerfCounters.writeDescriptorSets +=
         mUpdateDescriptorSetsBuilder.flushDescriptorSetUpdates(getDevice());
 }
@@ -698,6 +713,7 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk
       mRenderPassCommandBuffer(nullptr),
       mCurrentGraphicsPipeline(nullptr),
       mCurrentComputePipeline(nullptr),
+      mCurrentGraphicsPipelinesSerial(0),
       mCurrentDrawMode(gl::PrimitiveMode::InvalidEnum),
       mCurrentWindowSurface(nullptr),
       mCurrentRotationDrawFramebuffer(SurfaceRotation::Identity),
@@ -706,16 +722,20 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk
       mLastIndexBufferOffset(nullptr),
       mCurrentIndexBufferOffset(0),
       mCurrentDrawElementsType(gl::DrawElementsType::InvalidEnum),
-      mXfbBaseVertex(0),
+      mXfbBufferOffsets{},
       mXfbVertexCountPerInstance(0),
+      mXfbDriverUniformsCurrent(false),
       mClearColorValue{},
       mClearDepthStencilValue{},
       mClearColorMasks(0),
       mFlipYForCurrentSurface(false),
       mFlipViewportForDrawFramebuffer(false),
       mFlipViewportForReadFramebuffer(false),
+      mHasBeenCurrent(false),
       mIsAnyHostVisibleBufferWritten(false),
       mEmulateSeamfulCubeMapSampling(false),
+      mUpdateAllActiveTextures(true),
+      mHasInFlightStreamedAttribsBuffer(false),
       mOutsideRenderPassCommands(nullptr),
       mRenderPassCommands(nullptr),
       mQueryEventType(GraphicsEventCmdBuf::NotInQueryCmd),
@@ -790,6 +810,10 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk
             DIRTY_BIT_DYNAMIC_STENCIL_OP,
         };
     }
+    if (getFeatures().useDynamicPrimitiveTopology.enabled)
+    {
+        mDynamicStateDirtyBits.set(DIRTY_BIT_DYNAMIC_PRIMITIVE_TOPOLOGY);
+    }
     if (getFeatures().supportsExtendedDynamicState2.enabled)
     {
         mDynamicStateDirtyBits |= DirtyBits{
@@ -881,6 +905,8 @@ ContextVk::ContextVk(const gl::State &state, gl::ErrorSet *errorSet, RendererVk
         &ContextVk::handleDirtyGraphicsDynamicStencilTestEnable;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_STENCIL_OP] =
         &ContextVk::handleDirtyGraphicsDynamicStencilOp;
+    mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_PRIMITIVE_TOPOLOGY] =
+        &ContextVk::handleDirtyGraphicsDynamicPrimitiveTopology;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_RASTERIZER_DISCARD_ENABLE] =
         &ContextVk::handleDirtyGraphicsDynamicRasterizerDiscardEnable;
     mGraphicsDirtyBitHandlers[DIRTY_BIT_DYNAMIC_DEPTH_BIAS_ENABLE] =
@@ -1030,6 +1056,7 @@ void ContextVk::onDestroy(const gl::Context *context)
     {
         defaultBuffer.destroy(mRenderer);
     }
+    mStreamedAttribsBuffer.destroy(mRenderer);
 
     for (vk::DynamicQueryPool &queryPool : mQueryPools)
     {
@@ -1042,8 +1069,15 @@ void ContextVk::onDestroy(const gl::Context *context)
 
     mUtils.destroy(mRenderer);
 
+    // Pipelines still being created on worker threads may be using render passes from this
+    // context.
+    for (std::shared_ptr<angle::WaitableEvent> &waitableEvent : mAsyncGraphicsPipelineEvents)
+    {
+        waitableEvent->wait();
+    }
+    mAsyncGraphicsPipelineEvents.clear();
+
     mRenderPassCache.destroy(mRenderer);
-    mShaderLibrary.destroy(device);
     mGpuEventQueryPool.destroy(device);
     mCommandPools.outsideRenderPassPool.destroy(device);
     mCommandPools.renderPassPool.destroy(device);
@@ -1116,6 +1150,20 @@ angle::Result ContextVk::initialize()
     // Init GLES to Vulkan index type map.
     initIndexTypeMap();
 
+    if (getFeatures().asyncGraphicsPipelineCreation.enabled)
+    {
+        mPipelineWorkerPool = angle::WorkerThreadPool::Create(true);
+        if (!mPipelineWorkerPool->isAsync())
+        {
+            mPipelineWorkerPool.reset();
+        }
+    }
+
+    if (getFeatures().loadTextureDataInParallel.enabled)
+    {
+        mImageLoadWorkerPool = angle::WorkerThreadPool::Create(true);
+    }
+
     // Init driver uniforms and get the descriptor set layouts.
     for (PipelineType pipeline : angle::AllEnums<PipelineType>())
     {
@@ -1157,6 +1205,8 @@ angle::Result ContextVk::initialize()
     {
         buffer.init(mRenderer, kVertexBufferUsage, 1, kDynamicVertexDataSize, true);
     }
+    mStreamedAttribsBuffer.init(mRenderer, kVertexBufferUsage, vk::kVertexBufferAlignment,
+                                kStreamedAttribsDataSize, true);
 
 #if ANGLE_ENABLE_VULKAN_GPU_TRACE_EVENTS
     angle::PlatformMethods *platform = ANGLEPlatformCurrent();
@@ -1279,12 +1329,24 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
                                    const void *indices,
                                    DirtyBits dirtyBitMask)
 {
+    gl::ScopedCpuTimePhase cpuTimePhase(mState.getOverlay(), gl::CpuTimePhase::CommandRecording);
+
     // Set any dirty bits that depend on draw call parameters or other objects.
     if (mode != mCurrentDrawMode)
     {
-        invalidateCurrentGraphicsPipeline();
         mCurrentDrawMode = mode;
+
+        // With dynamic topology, the pipeline only changes if the topology class does.
+        const VkPrimitiveTopology previousTopology = mGraphicsPipelineDesc->getTopology();
         mGraphicsPipelineDesc->updateTopology(&mGraphicsPipelineTransition, mCurrentDrawMode);
+        if (mGraphicsPipelineDesc->getTopology() != previousTopology)
+        {
+            invalidateCurrentGraphicsPipeline();
+        }
+        if (getFeatures().useDynamicPrimitiveTopology.enabled)
+        {
+            mGraphicsDirtyBits.set(DIRTY_BIT_DYNAMIC_PRIMITIVE_TOPOLOGY);
+        }
     }
 
     // Must be called before the command buffer is started. Can call finish.
@@ -1305,16 +1367,44 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
         mGraphicsDirtyBits.set(DIRTY_BIT_UNIFORMS);
     }
 
+    // Pick up the optimized pipeline as soon as the worker thread is done creating it.
+    if (mCurrentGraphicsPipeline != nullptr && mCurrentGraphicsPipeline->hasPendingAsyncPipeline())
+    {
+        mGraphicsDirtyBits.set(DIRTY_BIT_PIPELINE_DESC);
+    }
+
     // Update transform feedback offsets on every draw call when emulating transform feedback.  This
     // relies on the fact that no geometry/tessellation, indirect or indexed calls are supported in
-    // ES3.1 (and emulation is not done for ES3.2).
+    // ES3.1 (and emulation is not done for ES3.2).  The driver uniforms are only updated if the
+    // offsets or vertex count change.
     if (getFeatures().emulateTransformFeedback.enabled &&
         mState.isTransformFeedbackActiveUnpaused())
     {
         ASSERT(firstVertexOrInvalid != -1);
-        mXfbBaseVertex             = firstVertexOrInvalid;
-        mXfbVertexCountPerInstance = vertexOrIndexCount;
-        invalidateGraphicsDriverUniforms();
+        std::array<int32_t, gl::IMPLEMENTATION_MAX_TRANSFORM_FEEDBACK_BUFFERS> xfbBufferOffsets =
+            {};
+        vk::GetImpl(mState.getCurrentTransformFeedback())
+            ->getBufferOffsets(this, firstVertexOrInvalid, xfbBufferOffsets.data(),
+                               xfbBufferOffsets.size());
+
+        if (!mXfbDriverUniformsCurrent || xfbBufferOffsets != mXfbBufferOffsets ||
+            vertexOrIndexCount != mXfbVertexCountPerInstance)
+        {
+            mXfbBufferOffsets          = xfbBufferOffsets;
+            mXfbVertexCountPerInstance = vertexOrIndexCount;
+            invalidateGraphicsDriverUniforms();
+        }
+    }
+
+    // Clears queued in the render pass must be recorded before the draw call.  Draw calls are
+    // recorded through mRenderPassCommandBuffer directly, so this is not done automatically.
+    mRenderPassCommands->flushPendingClearAttachments();
+
+    // While a glMemoryBarrier is deferred, every draw call must check whether it depends on the
+    // storage writes of the render pass, regardless of what state has changed since the barrier.
+    if (mRenderPassCommands->hasDeferredGLMemoryBarrier())
+    {
+        mGraphicsDirtyBits.set(DIRTY_BIT_MEMORY_BARRIER);
     }
 
     DirtyBits dirtyBits = mGraphicsDirtyBits & dirtyBitMask;
@@ -1325,22 +1415,73 @@ angle::Result ContextVk::setupDraw(const gl::Context *context,
         return angle::Result::Continue;
     }
 
-    // Flush any relevant dirty bits.
+    const uint32_t graphicsPipelineMissCount = mPerFrameGraphicsPipelineCacheStats.getMissCount();
+
+    // Flush any relevant dirty bits.  The bits that are dirty in most draw calls are dispatched
+    // directly, which avoids an indirect call through the handler table and lets the compiler
+    // inline the handlers.  Their handlers are the same regardless of the enabled features.
     for (DirtyBits::Iterator dirtyBitIter = dirtyBits.begin(); dirtyBitIter != dirtyBits.end();
          ++dirtyBitIter)
     {
-        ASSERT(mGraphicsDirtyBitHandlers[*dirtyBitIter]);
-        ANGLE_TRY((this->*mGraphicsDirtyBitHandlers[*dirtyBitIter])(&dirtyBitIter, dirtyBitMask));
+        switch (*dirtyBitIter)
+        {
+            case DIRTY_BIT_TEXTURES:
+                ANGLE_TRY(handleDirtyGraphicsTextures(&dirtyBitIter, dirtyBitMask));
+                break;
+            case DIRTY_BIT_VERTEX_BUFFERS:
+                ANGLE_TRY(handleDirtyGraphicsVertexBuffers(&dirtyBitIter, dirtyBitMask));
+                break;
+            case DIRTY_BIT_INDEX_BUFFER:
+                ANGLE_TRY(handleDirtyGraphicsIndexBuffer(&dirtyBitIter, dirtyBitMask));
+                break;
+            case DIRTY_BIT_UNIFORMS:
+                ANGLE_TRY(handleDirtyGraphicsUniforms(&dirtyBitIter, dirtyBitMask));
+                break;
+            case DIRTY_BIT_DRIVER_UNIFORMS:
+                ANGLE_TRY(handleDirtyGraphicsDriverUniforms(&dirtyBitIter, dirtyBitMask));
+                break;
+            case DIRTY_BIT_DESCRIPTOR_SETS:
+                ANGLE_TRY(handleDirtyGraphicsDescriptorSets(&dirtyBitIter, dirtyBitMask));
+                break;
+            default:
+                ASSERT(mGraphicsDirtyBitHandlers[*dirtyBitIter]);
+                ANGLE_TRY(
+                    (this->*mGraphicsDirtyBitHandlers[*dirtyBitIter])(&dirtyBitIter, dirtyBitMask));
+                break;
+        }
     }
 
     mGraphicsDirtyBits &= ~dirtyBitMask;
 
+    if (mPerFrameGraphicsPipelineCacheStats.getMissCount() != graphicsPipelineMissCount)
+    {
+        ANGLE_TRY(onNewGraphicsPipelines(context));
+    }
+
     // Render pass must be always available at this point.
     ASSERT(mRenderPassCommandBuffer);
 
     return angle::Result::Continue;
 }
 
+angle::Result ContextVk::onNewGraphicsPipelines(const gl::Context *context)
+{
+    if (!getFeatures().warmUpGraphicsPipelinesOnProgramLoad.enabled ||
+        mMemoryProgramCache == nullptr)
+    {
+        return angle::Result::Continue;
+    }
+
+    // Program pipeline objects are not stored in the program cache.
+    const gl::Program *program = mState.getProgram();
+    if (program == nullptr)
+    {
+        return angle::Result::Continue;
+    }
+
+    return mMemoryProgramCache->updateProgram(context, program);
+}
+
 angle::Result ContextVk::setupIndexedDraw(const gl::Context *context,
                                           gl::PrimitiveMode mode,
                                           GLsizei indexCount,
@@ -1544,6 +1685,8 @@ angle::Result ContextVk::setupLineLoopDraw(const gl::Context *context,
 
 angle::Result ContextVk::setupDispatch(const gl::Context *context)
 {
+    gl::ScopedCpuTimePhase cpuTimePhase(mState.getOverlay(), gl::CpuTimePhase::CommandRecording);
+
     // Note: numerous tests miss a glMemoryBarrier call between the initial texture data upload and
     // the dispatch call.  Flush the outside render pass command buffer as a workaround.
     // TODO: Remove this and fix tests.  http://anglebug.com/5070
@@ -1662,9 +1805,100 @@ bool ContextVk::renderPassUsesStorageResources() const
     return false;
 }
 
+bool ContextVk::renderPassWritesDrawInputs() const
+{
+    const gl::ProgramExecutable *executable = mState.getProgramExecutable();
+    ASSERT(executable);
+
+    // Vertex and index buffers:
+    VertexArrayVk *vertexArrayVk = getVertexArray();
+    const gl::AttribArray<vk::BufferHelper *> &arrayBuffers =
+        vertexArrayVk->getCurrentArrayBuffers();
+    for (size_t attribIndex : executable->getActiveAttribLocationsMask())
+    {
+        const vk::BufferHelper *buffer = arrayBuffers[attribIndex];
+        if (buffer != nullptr && mRenderPassCommands->usesBufferForWrite(*buffer))
+        {
+            return true;
+        }
+    }
+
+    const vk::BufferHelper *elementArrayBuffer = vertexArrayVk->getCurrentElementArrayBuffer();
+    if (elementArrayBuffer != nullptr &&
+        mRenderPassCommands->usesBufferForWrite(*elementArrayBuffer))
+    {
+        return true;
+    }
+
+    // Indirect buffer:
+    gl::Buffer *indirectBuffer = mState.getTargetBuffer(gl::BufferBinding::DrawIndirect);
+    if (indirectBuffer != nullptr &&
+        mRenderPassCommands->usesBufferForWrite(vk::GetImpl(indirectBuffer)->getBuffer()))
+    {
+        return true;
+    }
+
+    // Uniform buffers:
+    for (const gl::InterfaceBlock &block : executable->getUniformBlocks())
+    {
+        const gl::OffsetBindingPointer<gl::Buffer> &bufferBinding =
+            mState.getIndexedUniformBuffer(block.binding);
+
+        if (bufferBinding.get() != nullptr &&
+            mRenderPassCommands->usesBufferForWrite(vk::GetImpl(bufferBinding.get())->getBuffer()))
+        {
+            return true;
+        }
+    }
+
+    // Textures:
+    for (size_t textureUnit : executable->getActiveSamplersMask())
+    {
+        TextureVk *textureVk = mActiveTextures[textureUnit];
+        if (textureVk == nullptr)
+        {
+            continue;
+        }
+
+        if (textureVk->getBuffer().get() != nullptr)
+        {
+            vk::BufferHelper &buffer = vk::GetImpl(textureVk->getBuffer().get())->getBuffer();
+            if (mRenderPassCommands->usesBufferForWrite(buffer))
+            {
+                return true;
+            }
+        }
+        else if (IsRenderPassStartedAndUsesImage(*mRenderPassCommands, textureVk->getImage()))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 angle::Result ContextVk::handleDirtyMemoryBarrierImpl(DirtyBits::Iterator *dirtyBitsIterator,
                                                       DirtyBits dirtyBitMask)
 {
+    // If breaking the render pass has been deferred by glMemoryBarrier, break it as soon as a
+    // command may depend on its storage writes: any dispatch (which is recorded outside the render
+    // pass), or a draw that reads a resource that was written in the render pass.
+    if (mRenderPassCommands->hasDeferredGLMemoryBarrier())
+    {
+        if (dirtyBitsIterator == nullptr)
+        {
+            return flushCommandsAndEndRenderPass(
+                RenderPassClosureReason::StorageResourceUseThenGLMemoryBarrier);
+        }
+
+        if (renderPassWritesDrawInputs() || renderPassUsesStorageResources())
+        {
+            return flushDirtyGraphicsRenderPass(
+                dirtyBitsIterator, dirtyBitMask,
+                RenderPassClosureReason::StorageResourceUseThenGLMemoryBarrier);
+        }
+    }
+
     const gl::ProgramExecutable *executable = mState.getProgramExecutable();
     ASSERT(executable);
 
@@ -1822,9 +2056,9 @@ angle::Result ContextVk::handleDirtyGraphicsPipelineDesc(DirtyBits::Iterator *di
         updateGraphicsPipelineDescWithSpecConstUsageBits(usageBits);
 
         // Draw call shader patching, shader compilation, and pipeline cache query.
-        ANGLE_TRY(executableVk->getGraphicsPipeline(
-            this, mCurrentDrawMode, &pipelineCache, PipelineSource::Draw, *mGraphicsPipelineDesc,
-            glExecutable, &descPtr, &mCurrentGraphicsPipeline));
+        ANGLE_TRY(executableVk->getGraphicsPipeline(this, &pipelineCache, PipelineSource::Draw,
+                                                    *mGraphicsPipelineDesc, glExecutable, &descPtr,
+                                                    &mCurrentGraphicsPipeline));
         mGraphicsPipelineTransition.reset();
     }
     else if (mGraphicsPipelineTransition.any())
@@ -1836,9 +2070,9 @@ angle::Result ContextVk::handleDirtyGraphicsPipelineDesc(DirtyBits::Iterator *di
             vk::PipelineHelper *oldPipeline = mCurrentGraphicsPipeline;
             const vk::GraphicsPipelineDesc *descPtr;
 
-            ANGLE_TRY(executableVk->getGraphicsPipeline(
-                this, mCurrentDrawMode, &pipelineCache, PipelineSource::Draw,
-                *mGraphicsPipelineDesc, glExecutable, &descPtr, &mCurrentGraphicsPipeline));
+            ANGLE_TRY(executableVk->getGraphicsPipeline(this, &pipelineCache, PipelineSource::Draw,
+                                                        *mGraphicsPipelineDesc, glExecutable,
+                                                        &descPtr, &mCurrentGraphicsPipeline));
 
             oldPipeline->addTransition(mGraphicsPipelineTransition, descPtr,
                                        mCurrentGraphicsPipeline);
@@ -1846,6 +2080,12 @@ angle::Result ContextVk::handleDirtyGraphicsPipelineDesc(DirtyBits::Iterator *di
 
         mGraphicsPipelineTransition.reset();
     }
+
+    if (mCurrentGraphicsPipeline->hasPendingAsyncPipeline())
+    {
+        ANGLE_TRY(mCurrentGraphicsPipeline->updateAsyncPipeline(this));
+    }
+
     // Update the queue serial for the pipeline object.
     ASSERT(mCurrentGraphicsPipeline && mCurrentGraphicsPipeline->valid());
 
@@ -1938,19 +2178,26 @@ angle::Result ContextVk::handleDirtyGraphicsReadOnlyDepthFeedbackLoopMode(
 angle::Result ContextVk::handleDirtyGraphicsRenderPass(DirtyBits::Iterator *dirtyBitsIterator,
                                                        DirtyBits dirtyBitMask)
 {
+    FramebufferVk *drawFramebufferVk  = getDrawFramebuffer();
+    gl::Rectangle scissoredRenderArea = drawFramebufferVk->getRotatedScissoredRenderArea(this);
+    bool renderPassDescChanged        = false;
+
     // If the render pass needs to be recreated, close it using the special mid-dirty-bit-handling
     // function, so later dirty bits can be set.
     if (mRenderPassCommands->started())
     {
+        bool resumed = false;
+        ANGLE_TRY(resumeRenderPassIfSameFramebuffer(scissoredRenderArea, &resumed));
+        if (resumed)
+        {
+            return angle::Result::Continue;
+        }
+
         ANGLE_TRY(flushDirtyGraphicsRenderPass(dirtyBitsIterator,
                                                dirtyBitMask & ~DirtyBits{DIRTY_BIT_RENDER_PASS},
                                                RenderPassClosureReason::AlreadySpecifiedElsewhere));
     }
 
-    FramebufferVk *drawFramebufferVk  = getDrawFramebuffer();
-    gl::Rectangle scissoredRenderArea = drawFramebufferVk->getRotatedScissoredRenderArea(this);
-    bool renderPassDescChanged        = false;
-
     ANGLE_TRY(startRenderPass(scissoredRenderArea, nullptr, &renderPassDescChanged));
 
     // The render pass desc can change when starting the render pass, for example due to
@@ -1964,6 +2211,52 @@ angle::Result ContextVk::handleDirtyGraphicsRenderPass(DirtyBits::Iterator *dirt
     return angle::Result::Continue;
 }
 
+angle::Result ContextVk::resumeRenderPassIfSameFramebuffer(const gl::Rectangle &renderArea,
+                                                           bool *resumedOut)
+{
+    ASSERT(mRenderPassCommands->started());
+    *resumedOut = false;
+
+    FramebufferVk *drawFramebufferVk = getDrawFramebuffer();
+
+    // Deferred clears are applied through the loadOps of a new render pass.  Transform feedback
+    // and the subpass index are reset when the draw framebuffer binding changes.
+    if (drawFramebufferVk->hasDeferredClears() ||
+        mRenderPassCommands->isTransformFeedbackStarted() ||
+        mRenderPassCommands->getCurrentSubpass() != mGraphicsPipelineDesc->getSubpass() ||
+        !(mRenderPassCommands->getRenderPassDesc() == drawFramebufferVk->getRenderPassDesc()))
+    {
+        return angle::Result::Continue;
+    }
+
+    // The read-only depth/stencil feedback loop mode of the framebuffer is reset when it's bound,
+    // so it may no longer match the render pass.
+    RenderTargetVk *depthStencilRenderTarget = drawFramebufferVk->getDepthStencilRenderTarget();
+    if (depthStencilRenderTarget != nullptr &&
+        depthStencilRenderTarget->getImageForRenderPass()
+            .usedByCurrentRenderPassAsAttachmentAndSampler())
+    {
+        return angle::Result::Continue;
+    }
+
+    vk::MaybeImagelessFramebuffer framebuffer;
+    ANGLE_TRY(drawFramebufferVk->getFramebuffer(this, &framebuffer, nullptr,
+                                                SwapchainResolveMode::Disabled));
+    if (mRenderPassCommands->getFramebuffer() != framebuffer)
+    {
+        return angle::Result::Continue;
+    }
+
+    mRenderPassCommandBuffer = &mRenderPassCommands->getCommandBuffer();
+    mRenderPassCommands->growRenderArea(this, renderArea);
+    ANGLE_TRY(resumeRenderPassQueriesIfActive());
+
+    mPerfCounters.resumedRenderPasses++;
+    *resumedOut = true;
+
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::handleDirtyGraphicsColorAccess(DirtyBits::Iterator *dirtyBitsIterator,
                                                         DirtyBits dirtyBitMask)
 {
@@ -2055,6 +2348,8 @@ ANGLE_INLINE angle::Result ContextVk::handleDirtyTexturesImpl(
     CommandBufferHelperT *commandBufferHelper,
     PipelineType pipelineType)
 {
+    gl::ScopedCpuTimePhase cpuTimePhase(mState.getOverlay(), gl::CpuTimePhase::DescriptorUpdate);
+
     const gl::ProgramExecutable *executable = mState.getProgramExecutable();
     ASSERT(executable);
     const gl::ActiveTextureMask &activeTextures = executable->getActiveSamplersMask();
@@ -2241,6 +2536,8 @@ template <typename CommandBufferHelperT>
 angle::Result ContextVk::handleDirtyShaderResourcesImpl(CommandBufferHelperT *commandBufferHelper,
                                                         PipelineType pipelineType)
 {
+    gl::ScopedCpuTimePhase cpuTimePhase(mState.getOverlay(), gl::CpuTimePhase::DescriptorUpdate);
+
     const gl::ProgramExecutable *executable = mState.getProgramExecutable();
     ASSERT(executable);
 
@@ -2520,6 +2817,8 @@ angle::Result ContextVk::handleDirtyComputeUniforms()
 
 angle::Result ContextVk::handleDirtyUniformsImpl(vk::CommandBufferHelperCommon *commandBufferHelper)
 {
+    gl::ScopedCpuTimePhase cpuTimePhase(mState.getOverlay(), gl::CpuTimePhase::DescriptorUpdate);
+
     ProgramExecutableVk *programExecutableVk = getExecutable();
     TransformFeedbackVk *transformFeedbackVk =
         vk::SafeGetImpl(mState.getCurrentTransformFeedback());
@@ -2696,6 +2995,14 @@ angle::Result ContextVk::handleDirtyGraphicsDynamicStencilOp(DirtyBits::Iterator
     return angle::Result::Continue;
 }
 
+angle::Result ContextVk::handleDirtyGraphicsDynamicPrimitiveTopology(
+    DirtyBits::Iterator *dirtyBitsIterator,
+    DirtyBits dirtyBitMask)
+{
+    mRenderPassCommandBuffer->setPrimitiveTopology(gl_vk::GetPrimitiveTopology(mCurrentDrawMode));
+    return angle::Result::Continue;
+}
+
 angle::Result ContextVk::handleDirtyGraphicsDynamicRasterizerDiscardEnable(
     DirtyBits::Iterator *dirtyBitsIterator,
     DirtyBits dirtyBitMask)
@@ -2828,6 +3135,8 @@ template <typename CommandBufferHelperT>
 angle::Result ContextVk::handleDirtyDescriptorSetsImpl(CommandBufferHelperT *commandBufferHelper,
                                                        PipelineType pipelineType)
 {
+    gl::ScopedCpuTimePhase cpuTimePhase(mState.getOverlay(), gl::CpuTimePhase::DescriptorUpdate);
+
     // When using Vulkan secondary command buffers, the descriptor sets need to be updated before
     // they are bound.
     if (!commandBufferHelper->getCommandBuffer().ExecutesInline())
@@ -2891,17 +3200,20 @@ void ContextVk::syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQ
         mVulkanCacheStats[VulkanCacheType::DriverUniformsDescriptors].getSize();
 
     mPerfCounters.descriptorSetCacheKeySizeBytes = 0;
+    mPerfCounters.descriptorPoolCount            = 0;
 
     for (DescriptorSetIndex descriptorSetIndex : angle::AllEnums<DescriptorSetIndex>())
     {
         vk::MetaDescriptorPool &descriptorPool =
             mShareGroupVk->getMetaDescriptorPool(descriptorSetIndex);
         mPerfCounters.descriptorSetCacheKeySizeBytes += descriptorPool.getTotalCacheKeySizeBytes();
+        mPerfCounters.descriptorPoolCount += descriptorPool.getTotalPoolCount();
     }
 
     for (vk::DynamicDescriptorPool &pool : mDriverUniformsDescriptorPools)
     {
         mPerfCounters.descriptorSetCacheKeySizeBytes += pool.getTotalCacheKeySizeBytes();
+        mPerfCounters.descriptorPoolCount += pool.getPoolCount();
     }
 
     // Update perf counters from the renderer as well
@@ -2912,8 +3224,21 @@ void ContextVk::syncObjectPerfCounters(const angle::VulkanPerfCounters &commandQ
     mPerfCounters.vkQueueSubmitCallsTotal    = commandQueuePerfCounters.vkQueueSubmitCallsTotal;
     mPerfCounters.vkQueueSubmitCallsPerFrame = commandQueuePerfCounters.vkQueueSubmitCallsPerFrame;
 
+    // Latency of submissions through the command processor thread to this context's queue
+    mPerfCounters.commandProcessorSubmitLatencyP50Ns =
+        mRenderer->getCommandProcessorSubmitLatencyPercentileNs(mContextPriority, 50);
+    mPerfCounters.commandProcessorSubmitLatencyP90Ns =
+        mRenderer->getCommandProcessorSubmitLatencyPercentileNs(mContextPriority, 90);
+    mPerfCounters.commandProcessorSubmitLatencyP99Ns =
+        mRenderer->getCommandProcessorSubmitLatencyPercentileNs(mContextPriority, 99);
+
     // Return current drawFramebuffer's cache stats
     mPerfCounters.framebufferCacheSize = getDrawFramebuffer()->getCacheSize();
+
+    mPerfCounters.graphicsPipelineCacheMissesPerFrame =
+        mPerFrameGraphicsPipelineCacheStats.getMissCount();
+    mPerfCounters.graphicsPipelineCacheStallsPerFrame =
+        mPerFrameGraphicsPipelineCacheStats.getStallCount();
 }
 
 void ContextVk::updateOverlayOnPresent()
@@ -3060,6 +3385,8 @@ angle::Result ContextVk::submitFrameOutsideCommandBufferOnly(Serial *submitSeria
 angle::Result ContextVk::submitCommands(const vk::Semaphore *signalSemaphore,
                                         Serial *submitSerialOut)
 {
+    gl::ScopedCpuTimePhase cpuTimePhase(mState.getOverlay(), gl::CpuTimePhase::Submission);
+
     if (mCurrentWindowSurface)
     {
         const vk::Semaphore *waitSemaphore =
@@ -3091,6 +3418,13 @@ angle::Result ContextVk::submitCommands(const vk::Semaphore *signalSemaphore,
     if (mGpuEventsEnabled)
     {
         ANGLE_TRY(checkCompletedGpuEvents());
+
+        // Without GPU work, the clocks can be synchronized on every submission, so that the GPU
+        // events of finished submissions are reported right away instead of on glFinish.
+        if (getFeatures().supportsCalibratedTimestamps.enabled && !mGpuEvents.empty())
+        {
+            ANGLE_TRY(synchronizeCpuGpuTime());
+        }
     }
 
     mTotalBufferToImageCopySize = 0;
@@ -3115,6 +3449,43 @@ angle::Result ContextVk::synchronizeCpuGpuTime()
 {
     ASSERT(mGpuEventsEnabled);
 
+    ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::synchronizeCpuGpuTime");
+
+    // Time suffixes used are S for seconds and Cycles for cycles
+    double TcpuS        = 0;
+    uint64_t TgpuCycles = 0;
+    if (getFeatures().supportsCalibratedTimestamps.enabled)
+    {
+        ANGLE_TRY(getCalibratedCpuGpuTimestamps(&TcpuS, &TgpuCycles));
+    }
+    else
+    {
+        ANGLE_TRY(getCpuGpuTimestampsWithEvents(&TcpuS, &TgpuCycles));
+    }
+
+    // Use the first timestamp queried as origin.
+    if (mGpuEventTimestampOrigin == 0)
+    {
+        mGpuEventTimestampOrigin = TgpuCycles;
+    }
+
+    // timestampPeriod gives nanoseconds/cycle.
+    double TgpuS =
+        (TgpuCycles - mGpuEventTimestampOrigin) *
+        static_cast<double>(getRenderer()->getPhysicalDeviceProperties().limits.timestampPeriod) /
+        1'000'000'000.0;
+
+    flushGpuEvents(TgpuS, TcpuS);
+
+    mGpuClockSync.gpuTimestampS = TgpuS;
+    mGpuClockSync.cpuTimestampS = TcpuS;
+
+    return angle::Result::Continue;
+}
+
+angle::Result ContextVk::getCpuGpuTimestampsWithEvents(double *cpuTimestampSOut,
+                                                       uint64_t *gpuTimestampCyclesOut)
+{
     angle::PlatformMethods *platform = ANGLEPlatformCurrent();
     ASSERT(platform);
 
@@ -3181,9 +3552,7 @@ angle::Result ContextVk::synchronizeCpuGpuTime()
     // a limited number of times and the Tcpu,Tgpu pair corresponding to smallest Te-Ts used for
     // calibration.
     //
-    // Note: Once VK_EXT_calibrated_timestamps is ubiquitous, this should be redone.
-
-    ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::synchronizeCpuGpuTime");
+    // Note: getCalibratedCpuGpuTimestamps is used instead with VK_EXT_calibrated_timestamps.
 
     // Create a query used to receive the GPU timestamp
     vk::QueryHelper timestampQuery;
@@ -3202,10 +3571,7 @@ angle::Result ContextVk::synchronizeCpuGpuTime()
 
     constexpr uint32_t kRetries = 10;
 
-    // Time suffixes used are S for seconds and Cycles for cycles
     double tightestRangeS = 1e6f;
-    double TcpuS          = 0;
-    uint64_t TgpuCycles   = 0;
     for (uint32_t i = 0; i < kRetries; ++i)
     {
         // Reset the events
@@ -3275,35 +3641,58 @@ angle::Result ContextVk::synchronizeCpuGpuTime()
         vk::QueryResult gpuTimestampCycles(1);
         ANGLE_TRY(timestampQuery.getUint64Result(this, &gpuTimestampCycles));
 
-        // Use the first timestamp queried as origin.
-        if (mGpuEventTimestampOrigin == 0)
-        {
-            mGpuEventTimestampOrigin =
-                gpuTimestampCycles.getResult(vk::QueryResult::kDefaultResultIndex);
-        }
-
         // Take these CPU and GPU timestamps if there is better confidence.
         double confidenceRangeS = TeS - TsS;
         if (confidenceRangeS < tightestRangeS)
         {
-            tightestRangeS = confidenceRangeS;
-            TcpuS          = cpuTimestampS;
-            TgpuCycles     = gpuTimestampCycles.getResult(vk::QueryResult::kDefaultResultIndex);
+            tightestRangeS    = confidenceRangeS;
+            *cpuTimestampSOut = cpuTimestampS;
+            *gpuTimestampCyclesOut =
+                gpuTimestampCycles.getResult(vk::QueryResult::kDefaultResultIndex);
         }
     }
 
     mGpuEventQueryPool.freeQuery(this, &timestampQuery);
 
-    // timestampPeriod gives nanoseconds/cycle.
-    double TgpuS =
-        (TgpuCycles - mGpuEventTimestampOrigin) *
-        static_cast<double>(getRenderer()->getPhysicalDeviceProperties().limits.timestampPeriod) /
-        1'000'000'000.0;
+    return angle::Result::Continue;
+}
 
-    flushGpuEvents(TgpuS, TcpuS);
+angle::Result ContextVk::getCalibratedCpuGpuTimestamps(double *cpuTimestampSOut,
+                                                       uint64_t *gpuTimestampCyclesOut)
+{
+    ASSERT(getFeatures().supportsCalibratedTimestamps.enabled);
 
-    mGpuClockSync.gpuTimestampS = TgpuS;
-    mGpuClockSync.cpuTimestampS = TcpuS;
+    angle::PlatformMethods *platform = ANGLEPlatformCurrent();
+    ASSERT(platform);
+
+    // The device timestamp is sampled when vkGetCalibratedTimestampsEXT is called, without any
+    // GPU work.  The CPU timestamps taken around the call bound the time it was sampled at, and
+    // the tightest of a few tries is used.
+    VkCalibratedTimestampInfoEXT timestampInfo = {};
+    timestampInfo.sType                        = VK_STRUCTURE_TYPE_CALIBRATED_TIMESTAMP_INFO_EXT;
+    timestampInfo.timeDomain                   = VK_TIME_DOMAIN_DEVICE_EXT;
+
+    constexpr uint32_t kRetries = 3;
+
+    double tightestRangeS = 1e6f;
+    for (uint32_t i = 0; i < kRetries; ++i)
+    {
+        uint64_t gpuTimestampCycles = 0;
+        uint64_t maxDeviation       = 0;
+
+        double TsS = platform->monotonicallyIncreasingTime(platform);
+        ANGLE_VK_TRY(this, vkGetCalibratedTimestampsEXT(getDevice(), 1, &timestampInfo,
+                                                        &gpuTimestampCycles, &maxDeviation));
+        double TeS = platform->monotonicallyIncreasingTime(platform);
+
+        double confidenceRangeS = TeS - TsS;
+        if (confidenceRangeS < tightestRangeS)
+        {
+            tightestRangeS         = confidenceRangeS;
+            *cpuTimestampSOut      = (TsS + TeS) / 2.0;
+            *gpuTimestampCyclesOut = gpuTimestampCycles;
+        }
+    }
 
     return angle::Result::Continue;
 }
@@ -3762,9 +4151,18 @@ angle::Result ContextVk::multiDrawArraysIndirectHelper(const gl::Context *contex
 
     ANGLE_TRY(setupIndirectDraw(context, mode, mNonIndexedDirtyBitsMask, currentIndirectBuf));
 
-    mRenderPassCommandBuffer->drawIndirect(
-        currentIndirectBuf->getBuffer(), currentIndirectBuf->getOffset() + currentIndirectBufOffset,
-        drawcount, vkStride);
+    // The draw state is set up once for all draws, even if they need multiple commands.
+    const uint32_t maxDrawCount = GetMaxDrawIndirectCount(this);
+    VkDeviceSize drawOffset     = currentIndirectBuf->getOffset() + currentIndirectBufOffset;
+    uint32_t remainingDrawCount = static_cast<uint32_t>(drawcount);
+    while (remainingDrawCount > 0)
+    {
+        const uint32_t drawCount = std::min(remainingDrawCount, maxDrawCount);
+        mRenderPassCommandBuffer->drawIndirect(currentIndirectBuf->getBuffer(), drawOffset,
+                                               drawCount, vkStride);
+        drawOffset += static_cast<VkDeviceSize>(drawCount) * vkStride;
+        remainingDrawCount -= drawCount;
+    }
 
     return angle::Result::Continue;
 }
@@ -3809,7 +4207,11 @@ angle::Result ContextVk::multiDrawElementsIndirectHelper(const gl::Context *cont
                                                          GLsizei stride)
 {
     VertexArrayVk *vertexArrayVk = getVertexArray();
-    if (drawcount > 1 && !CanMultiDrawIndirectUseCmd(this, vertexArrayVk, mode, drawcount, stride))
+    // Converting uint8 indices on the GPU only produces one indirect command, so every draw is
+    // converted separately.
+    if (drawcount > 1 &&
+        (!CanMultiDrawIndirectUseCmd(this, vertexArrayVk, mode, drawcount, stride) ||
+         shouldConvertUint8VkIndexType(type)))
     {
         return rx::MultiDrawElementsIndirectGeneral(this, context, mode, type, indirect, drawcount,
                                                     stride);
@@ -3885,9 +4287,18 @@ angle::Result ContextVk::multiDrawElementsIndirectHelper(const gl::Context *cont
         ANGLE_TRY(setupIndexedIndirectDraw(context, mode, type, currentIndirectBuf));
     }
 
-    mRenderPassCommandBuffer->drawIndexedIndirect(
-        currentIndirectBuf->getBuffer(), currentIndirectBuf->getOffset() + currentIndirectBufOffset,
-        drawcount, vkStride);
+    // The draw state is set up once for all draws, even if they need multiple commands.
+    const uint32_t maxDrawCount = GetMaxDrawIndirectCount(this);
+    VkDeviceSize drawOffset     = currentIndirectBuf->getOffset() + currentIndirectBufOffset;
+    uint32_t remainingDrawCount = static_cast<uint32_t>(drawcount);
+    while (remainingDrawCount > 0)
+    {
+        const uint32_t drawCount = std::min(remainingDrawCount, maxDrawCount);
+        mRenderPassCommandBuffer->drawIndexedIndirect(currentIndirectBuf->getBuffer(), drawOffset,
+                                                      drawCount, vkStride);
+        drawOffset += static_cast<VkDeviceSize>(drawCount) * vkStride;
+        remainingDrawCount -= drawCount;
+    }
 
     return angle::Result::Continue;
 }
@@ -3975,7 +4386,7 @@ angle::Result ContextVk::optimizeRenderPassForPresent(VkFramebuffer framebufferH
         ANGLE_TRY(colorImageView->getLevelLayerDrawImageView(this, *colorImage, vk::LevelIndex(0),
                                                              0, gl::SrgbWriteControlMode::Default,
                                                              &resolveImageView));
-        vk::Framebuffer *newFramebuffer                      = nullptr;
+        vk::MaybeImagelessFramebuffer newFramebuffer;
         constexpr SwapchainResolveMode kSwapchainResolveMode = SwapchainResolveMode::Enabled;
         ANGLE_TRY(drawFramebufferVk->getFramebuffer(this, &newFramebuffer, resolveImageView,
                                                     kSwapchainResolveMode));
@@ -4685,12 +5096,22 @@ angle::Result ContextVk::invalidateProgramExecutableHelper(const gl::Context *co
         // No additional work is needed here. We will update the pipeline desc
         // later.
         invalidateDefaultAttributes(context->getStateCache().getActiveDefaultAttribsMask());
-        invalidateVertexAndIndexBuffers();
         bool useVertexBuffer = (executable->getMaxActiveAttribLocation() > 0);
         mNonIndexedDirtyBitsMask.set(DIRTY_BIT_VERTEX_BUFFERS, useVertexBuffer);
         mIndexedDirtyBitsMask.set(DIRTY_BIT_VERTEX_BUFFERS, useVertexBuffer);
-        mCurrentGraphicsPipeline = nullptr;
-        mGraphicsPipelineTransition.reset();
+
+        // If only compute programs were bound since this program was last used for draws, the
+        // current pipeline (with the transitions accumulated since) and the vertex and index
+        // buffer bindings are still valid.  The compute pipeline is bound to a separate bind point
+        // and in a separate command buffer, so it doesn't disturb them.
+        const uint64_t pipelinesSerial = getExecutable()->getPipelinesSerial();
+        if (pipelinesSerial != mCurrentGraphicsPipelinesSerial)
+        {
+            invalidateVertexAndIndexBuffers();
+            mCurrentGraphicsPipeline = nullptr;
+            mGraphicsPipelineTransition.reset();
+            mCurrentGraphicsPipelinesSerial = pipelinesSerial;
+        }
 
         if (getDrawFramebuffer()->getRenderPassDesc().getFramebufferFetchMode() !=
             executable->usesFramebufferFetch())
@@ -4710,6 +5131,8 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                                    const gl::State::DirtyBits &bitMask,
                                    gl::Command command)
 {
+    gl::ScopedCpuTimePhase cpuTimePhase(mState.getOverlay(), gl::CpuTimePhase::SyncState);
+
     const gl::State &glState                       = context->getState();
     const gl::ProgramExecutable *programExecutable = glState.getProgramExecutable();
 
@@ -5026,6 +5449,7 @@ angle::Result ContextVk::syncState(const gl::Context *context,
                     gl::State::DIRTY_BIT_TEXTURE_BINDINGS > gl::State::DIRTY_BIT_PROGRAM_EXECUTABLE,
                     "Dirty bit order");
                 iter.setLaterBit(gl::State::DIRTY_BIT_TEXTURE_BINDINGS);
+                mUpdateAllActiveTextures = true;
                 static_assert(gl::State::DIRTY_BIT_ATOMIC_COUNTER_BUFFER_BINDING >
                                   gl::State::DIRTY_BIT_PROGRAM_EXECUTABLE,
                               "Dirty bit order");
@@ -5184,6 +5608,12 @@ angle::Result ContextVk::onMakeCurrent(const gl::Context *context)
 {
     mRenderer->reloadVolkIfNeeded();
 
+    const bool previousFlipYForCurrentSurface             = mFlipYForCurrentSurface;
+    const bool previousFlipViewportForDrawFramebuffer     = mFlipViewportForDrawFramebuffer;
+    const bool previousFlipViewportForReadFramebuffer     = mFlipViewportForReadFramebuffer;
+    const SurfaceRotation previousRotationDrawFramebuffer = mCurrentRotationDrawFramebuffer;
+    const SurfaceRotation previousRotationReadFramebuffer = mCurrentRotationReadFramebuffer;
+
     // Flip viewports if the user did not request that the surface is flipped.
     egl::Surface *drawSurface = context->getCurrentDrawSurface();
     mFlipYForCurrentSurface =
@@ -5205,12 +5635,26 @@ angle::Result ContextVk::onMakeCurrent(const gl::Context *context)
     updateSurfaceRotationDrawFramebuffer(glState);
     updateSurfaceRotationReadFramebuffer(glState);
 
-    invalidateDriverUniforms();
-    if (!getFeatures().forceDriverUniformOverSpecConst.enabled)
-    {
-        // Force update mGraphicsPipelineDesc
-        mCurrentGraphicsPipeline = nullptr;
-        invalidateCurrentGraphicsPipeline();
+    // The driver uniforms and the specialization constants only depend on the surfaces through the
+    // flip and rotation, so they are kept when switching back to a context whose surfaces are
+    // flipped and rotated as before.  This makes switching between contexts every frame cheaper.
+    const bool surfaceTransformChanged =
+        !mHasBeenCurrent || mFlipYForCurrentSurface != previousFlipYForCurrentSurface ||
+        mFlipViewportForDrawFramebuffer != previousFlipViewportForDrawFramebuffer ||
+        mFlipViewportForReadFramebuffer != previousFlipViewportForReadFramebuffer ||
+        mCurrentRotationDrawFramebuffer != previousRotationDrawFramebuffer ||
+        mCurrentRotationReadFramebuffer != previousRotationReadFramebuffer;
+    mHasBeenCurrent = true;
+
+    if (surfaceTransformChanged)
+    {
+        invalidateDriverUniforms();
+        if (!getFeatures().forceDriverUniformOverSpecConst.enabled)
+        {
+            // Force update mGraphicsPipelineDesc
+            mCurrentGraphicsPipeline = nullptr;
+            invalidateCurrentGraphicsPipeline();
+        }
     }
 
     const gl::ProgramExecutable *executable = mState.getProgramExecutable();
@@ -5229,7 +5673,13 @@ angle::Result ContextVk::onMakeCurrent(const gl::Context *context)
 
 angle::Result ContextVk::onUnMakeCurrent(const gl::Context *context)
 {
-    ANGLE_TRY(flushImpl(nullptr, RenderPassClosureReason::ContextChange));
+    // Skip the flush if there's nothing recorded, as with applications that switch to a context
+    // only to query it.
+    if (mHasAnyCommandsPendingSubmission || hasStartedRenderPass() ||
+        !mOutsideRenderPassCommands->empty() || !mWaitSemaphores.empty())
+    {
+        ANGLE_TRY(flushImpl(nullptr, RenderPassClosureReason::ContextChange));
+    }
     mCurrentWindowSurface = nullptr;
     return angle::Result::Continue;
 }
@@ -5354,7 +5804,9 @@ RenderbufferImpl *ContextVk::createRenderbuffer(const gl::RenderbufferState &sta
 
 BufferImpl *ContextVk::createBuffer(const gl::BufferState &state)
 {
-    return new BufferVk(state);
+    BufferVk *bufferVk = new BufferVk(state);
+    mShareGroupVk->addBuffer(bufferVk);
+    return bufferVk;
 }
 
 VertexArrayImpl *ContextVk::createVertexArray(const gl::VertexArrayState &state)
@@ -5424,12 +5876,14 @@ angle::Result ContextVk::invalidateCurrentTextures(const gl::Context *context, g
     const gl::ProgramExecutable *executable = mState.getProgramExecutable();
     ASSERT(executable);
 
+    const gl::ActiveTextureMask dirtyTextureUnits = mState.getAndResetDirtyTextureBindingUnits();
+
     if (executable->hasTextures())
     {
         mGraphicsDirtyBits |= kTexturesAndDescSetDirtyBits;
         mComputeDirtyBits |= kTexturesAndDescSetDirtyBits;
 
-        ANGLE_TRY(updateActiveTextures(context, command));
+        ANGLE_TRY(updateActiveTextures(context, command, dirtyTextureUnits));
 
         if (command == gl::Command::Dispatch)
         {
@@ -5857,16 +6311,42 @@ angle::Result ContextVk::memoryBarrier(const gl::Context *context, GLbitfield ba
     // To achieve this, a dirty bit is added that breaks the render pass if any storage
     // buffer/images are used in it.  Until the render pass breaks, changing the program or storage
     // buffer/image bindings should set this dirty bit again.
+    //
+    // The barrier bits that only affect draw/dispatch calls are an exception to the first barrier:
+    // draw calls are checked for an actual dependency on the storage writes of the render pass
+    // before it's broken, which allows the render pass to remain open in scenarios such as this:
+    //
+    // - Draw with storage buffer/image X
+    // - glMemoryBarrier
+    // - Draw using resources other than X
+    //
+    // Dispatch calls always break the render pass in that case, as they are recorded outside it.
+    constexpr GLbitfield kDrawOrDispatchBarriers =
+        GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT | GL_UNIFORM_BARRIER_BIT |
+        GL_TEXTURE_FETCH_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_COMMAND_BARRIER_BIT |
+        GL_ATOMIC_COUNTER_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT;
 
     if (mRenderPassCommands->hasShaderStorageOutput())
     {
-        // Break the render pass if necessary as future non-draw commands can't know if they should.
-        ANGLE_TRY(flushCommandsAndEndRenderPass(
-            RenderPassClosureReason::StorageResourceUseThenGLMemoryBarrier));
+        if ((barriers & ~kDrawOrDispatchBarriers) == 0)
+        {
+            // Defer breaking the render pass until a draw/dispatch call depends on its writes.
+            mRenderPassCommands->setGLMemoryBarrierDeferred();
+            mGraphicsDirtyBits.set(DIRTY_BIT_MEMORY_BARRIER);
+            mComputeDirtyBits.set(DIRTY_BIT_MEMORY_BARRIER);
+        }
+        else
+        {
+            // Break the render pass if necessary as future non-draw commands can't know if they
+            // should.
+            ANGLE_TRY(flushCommandsAndEndRenderPass(
+                RenderPassClosureReason::StorageResourceUseThenGLMemoryBarrier));
+        }
     }
-    else if (mOutsideRenderPassCommands->hasShaderStorageOutput())
+
+    if (mOutsideRenderPassCommands->hasShaderStorageOutput())
     {
-        // Otherwise flush the outside render pass commands if necessary.
+        // Flush the outside render pass commands if necessary.
         ANGLE_TRY(flushOutsideRenderPassCommands());
     }
 
@@ -5924,6 +6404,34 @@ void ContextVk::blendBarrier()
     }
 }
 
+angle::Result ContextVk::warmUpDraw(const gl::Context *context, gl::PrimitiveMode mode)
+{
+    ASSERT(mState.getProgramExecutable() != nullptr);
+    const gl::ProgramExecutable &glExecutable = *mState.getProgramExecutable();
+    ProgramExecutableVk *executableVk         = getExecutable();
+    ASSERT(executableVk);
+
+    // Build the desc a draw with |mode| would use from a copy, so that the current pipeline and
+    // its pending transition are left for the next draw.
+    vk::GraphicsPipelineDesc desc = *mGraphicsPipelineDesc;
+    vk::GraphicsPipelineTransitionBits transition;
+    desc.updateTopology(&transition, mode);
+    if (IsRotatedAspectRatio(mCurrentRotationDrawFramebuffer) != desc.getSurfaceRotation())
+    {
+        desc.updateSurfaceRotation(&transition, mCurrentRotationDrawFramebuffer);
+    }
+
+    PipelineCacheAccess pipelineCache;
+    ANGLE_TRY(mRenderer->getPipelineCache(&pipelineCache));
+
+    // With asyncGraphicsPipelineCreation, the pipeline is created on a worker thread, and the
+    // draw only waits for it if it is not ready by then.  Otherwise it is created right away.
+    const vk::GraphicsPipelineDesc *descPtr = nullptr;
+    vk::PipelineHelper *pipeline            = nullptr;
+    return executableVk->getGraphicsPipeline(this, &pipelineCache, PipelineSource::WarmUp, desc,
+                                             glExecutable, &descPtr, &pipeline);
+}
+
 angle::Result ContextVk::acquireTextures(const gl::Context *context,
                                          const gl::TextureBarrierVector &textureBarriers)
 {
@@ -6140,13 +6648,10 @@ angle::Result ContextVk::handleDirtyGraphicsDriverUniforms(DirtyBits::Iterator *
             static_cast<float>(glViewport.x), static_cast<float>(glViewport.y),
             static_cast<float>(glViewport.width), static_cast<float>(glViewport.height)};
 
-        if (mState.isTransformFeedbackActiveUnpaused())
+        mXfbDriverUniformsCurrent = mState.isTransformFeedbackActiveUnpaused();
+        if (mXfbDriverUniformsCurrent)
         {
-            TransformFeedbackVk *transformFeedbackVk =
-                vk::GetImpl(mState.getCurrentTransformFeedback());
-            transformFeedbackVk->getBufferOffsets(this, mXfbBaseVertex,
-                                                  driverUniformsExt->xfbBufferOffsets.data(),
-                                                  driverUniformsExt->xfbBufferOffsets.size());
+            driverUniformsExt->xfbBufferOffsets = mXfbBufferOffsets;
         }
         driverUniformsExt->xfbVerticesPerInstance =
             static_cast<int32_t>(mXfbVertexCountPerInstance);
@@ -6365,7 +6870,9 @@ void ContextVk::handleError(VkResult errorCode,
     mErrors->handleError(glErrorCode, errorStream.str().c_str(), file, function, line);
 }
 
-angle::Result ContextVk::updateActiveTextures(const gl::Context *context, gl::Command command)
+angle::Result ContextVk::updateActiveTextures(const gl::Context *context,
+                                              gl::Command command,
+                                              const gl::ActiveTextureMask &dirtyTextureUnits)
 {
     const gl::ProgramExecutable *executable = mState.getProgramExecutable();
     ASSERT(executable);
@@ -6375,16 +6882,31 @@ angle::Result ContextVk::updateActiveTextures(const gl::Context *context, gl::Co
     const gl::ActiveTextureMask &activeTextures    = executable->getActiveSamplersMask();
     const gl::ActiveTextureTypeArray &textureTypes = executable->getActiveSamplerTypes();
 
-    mActiveTextures.fill(nullptr);
+    gl::ActiveTextureMask texturesToUpdate = activeTextures;
+    if (mUpdateAllActiveTextures)
+    {
+        mActiveTextures.fill(nullptr);
+        mActiveDepthStencilTextureUnits.reset();
+        mActiveImmutableSamplerTextureUnits.reset();
+        mUpdateAllActiveTextures = false;
+    }
+    else
+    {
+        // Depth/stencil textures are always revisited, as whether they are in a feedback loop
+        // depends on the framebuffer and not only on the texture binding.
+        texturesToUpdate &= dirtyTextureUnits | mActiveDepthStencilTextureUnits;
+    }
 
-    bool recreatePipelineLayout                       = false;
-    ImmutableSamplerIndexMap immutableSamplerIndexMap = {};
-    for (size_t textureUnit : activeTextures)
+    bool recreatePipelineLayout = false;
+    for (size_t textureUnit : texturesToUpdate)
     {
         gl::Texture *texture        = textures[textureUnit];
         gl::TextureType textureType = textureTypes[textureUnit];
         ASSERT(textureType != gl::TextureType::InvalidEnum);
 
+        mActiveDepthStencilTextureUnits.reset(textureUnit);
+        mActiveImmutableSamplerTextureUnits.reset(textureUnit);
+
         const bool isIncompleteTexture = texture == nullptr;
 
         // Null textures represent incomplete textures.
@@ -6405,6 +6927,11 @@ angle::Result ContextVk::updateActiveTextures(const gl::Context *context, gl::Co
             continue;
         }
 
+        if (!isIncompleteTexture && texture->isDepthOrStencil())
+        {
+            mActiveDepthStencilTextureUnits.set(textureUnit);
+        }
+
         if (!isIncompleteTexture && texture->isDepthOrStencil() &&
             shouldSwitchToReadOnlyDepthFeedbackLoopMode(texture, command))
         {
@@ -6459,8 +6986,7 @@ angle::Result ContextVk::updateActiveTextures(const gl::Context *context, gl::Co
 
         if (image.hasImmutableSampler())
         {
-            immutableSamplerIndexMap[image.getYcbcrConversionDesc()] =
-                static_cast<uint32_t>(textureUnit);
+            mActiveImmutableSamplerTextureUnits.set(textureUnit);
         }
 
         if (textureVk->getAndResetImmutableSamplerDirtyState())
@@ -6469,6 +6995,14 @@ angle::Result ContextVk::updateActiveTextures(const gl::Context *context, gl::Co
         }
     }
 
+    ImmutableSamplerIndexMap immutableSamplerIndexMap = {};
+    for (size_t textureUnit : mActiveImmutableSamplerTextureUnits)
+    {
+        const vk::ImageHelper &image = mActiveTextures[textureUnit]->getImage();
+        immutableSamplerIndexMap[image.getYcbcrConversionDesc()] =
+            static_cast<uint32_t>(textureUnit);
+    }
+
     if (!executableVk->areImmutableSamplersCompatible(immutableSamplerIndexMap))
     {
         recreatePipelineLayout = true;
@@ -6636,6 +7170,12 @@ angle::Result ContextVk::flushAndGetSerial(const vk::Semaphore *signalSemaphore,
         mHasInFlightStreamedVertexBuffers.reset();
     }
 
+    if (mHasInFlightStreamedAttribsBuffer)
+    {
+        mStreamedAttribsBuffer.releaseInFlightBuffersToResourceUseList(this);
+        mHasInFlightStreamedAttribsBuffer = false;
+    }
+
     ANGLE_TRY(submitFrame(signalSemaphore, submitSerialOut));
 
     ASSERT(mWaitSemaphores.empty());
@@ -6650,17 +7190,97 @@ angle::Result ContextVk::flushAndGetSerial(const vk::Semaphore *signalSemaphore,
 
     // Try to detect frame boundary for both on screen and offscreen usage by detecting
     // fush/finish/swap.
-    if ((renderPassClosureReason == RenderPassClosureReason::GLFlush ||
-         renderPassClosureReason == RenderPassClosureReason::GLFinish ||
-         renderPassClosureReason == RenderPassClosureReason::EGLSwapBuffers) &&
-        mShareGroupVk->isDueForBufferPoolPrune(mRenderer))
+    const bool isFrameBoundary = renderPassClosureReason == RenderPassClosureReason::GLFlush ||
+                                 renderPassClosureReason == RenderPassClosureReason::GLFinish ||
+                                 renderPassClosureReason == RenderPassClosureReason::EGLSwapBuffers;
+    if (!isFrameBoundary)
+    {
+        return angle::Result::Continue;
+    }
+
+    if (mRenderer->getFeatures().supportsMemoryBudget.enabled &&
+        mRenderer->isMemoryBudgetUnderPressure())
+    {
+        trimMemoryOnBudgetPressure();
+    }
+    else if (mShareGroupVk->isDueForBufferPoolPrune(mRenderer))
     {
         mShareGroupVk->pruneDefaultBufferPools(mRenderer);
     }
 
+    // Keep moving buffers out of sparsely used blocks at every frame boundary until they are
+    // empty and can be pruned.
+    if (mShareGroupVk->hasEvacuatingBufferBlocks())
+    {
+        ANGLE_TRY(mShareGroupVk->moveBuffersOutOfEvacuatingBlocks(this));
+    }
+
     return angle::Result::Continue;
 }
 
+void ContextVk::trimMemoryOnBudgetPressure()
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::trimMemoryOnBudgetPressure");
+    ANGLE_VK_PERF_WARNING(this, GL_DEBUG_SEVERITY_LOW,
+                          "Releasing cached memory because a memory heap is close to its budget");
+
+    // Drop the buffers that are only kept around to avoid reallocation.
+    for (vk::DynamicBuffer &streamedVertexBuffer : mStreamedVertexBuffers)
+    {
+        streamedVertexBuffer.releaseFreeBuffers(mRenderer);
+    }
+    mStreamedAttribsBuffer.releaseFreeBuffers(mRenderer);
+    mDefaultUniformStorage.releaseFreeBuffers(mRenderer);
+
+    // Free the garbage whose GPU work has finished, including the buffers released above if
+    // they are idle, then give the empty buffer blocks back to the driver.
+    mRenderer->cleanupCompletedCommandsGarbage();
+    mShareGroupVk->pruneDefaultBufferPools(mRenderer);
+}
+
+angle::Result ContextVk::onSyncObjectInit(vk::Resource *syncObject, bool isEGLSyncObject)
+{
+    // Submit the commands:
+    //
+    // - This breaks the current render pass to ensure the proper ordering of the sync object in the
+    //   commands,
+    // - The sync object has a valid serial when it's waited on later,
+    // - After waiting on the sync object, every resource that's used so far (and is being synced)
+    //   will also be aware that it's finished (based on the serial) and won't incur a further wait
+    //   (for example when a buffer is mapped).
+    //
+    // Apps commonly insert a fence every frame to manage ring buffers, so for GL sync objects
+    // that's deferred until the render pass ends.  The sync object is retained by the render pass,
+    // so it gets the serial of the submission that includes it.  Waiting on it or querying its
+    // status from this context submits the commands right away.  That's only possible if no other
+    // context can wait on the sync object: other contexts of the share group can't submit the
+    // commands of this one, so glClientWaitSync would time out and glWaitSync would not be ordered
+    // after the commands.  EGL sync objects can be waited on from any thread, so they are always
+    // submitted immediately.
+    if (!isEGLSyncObject && mRenderer->getFeatures().deferFlushUntilEndRenderPass.enabled &&
+        hasStartedRenderPass() && mState.getShareGroup()->getShareGroupContextCount() == 1)
+    {
+        mRenderPassCommands->retainResource(syncObject);
+        mHasDeferredFlush = true;
+        return angle::Result::Continue;
+    }
+
+    vk::ResourceUseList resourceUseList;
+    syncObject->retain(&resourceUseList);
+    getShareGroupVk()->acquireResourceUseList(std::move(resourceUseList));
+
+    return flushImpl(nullptr, RenderPassClosureReason::SyncObjectInit);
+}
+
+angle::Result ContextVk::flushIfDeferred(RenderPassClosureReason renderPassClosureReason)
+{
+    if (!mHasDeferredFlush)
+    {
+        return angle::Result::Continue;
+    }
+    return flushImpl(nullptr, renderPassClosureReason);
+}
+
 angle::Result ContextVk::finishImpl(RenderPassClosureReason renderPassClosureReason)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "ContextVk::finishImpl");
@@ -6857,7 +7477,7 @@ angle::Result ContextVk::onImageReleaseToExternal(const vk::ImageHelper &image)
 }
 
 angle::Result ContextVk::beginNewRenderPass(
-    const vk::Framebuffer &framebuffer,
+    const vk::MaybeImagelessFramebuffer &framebuffer,
     const gl::Rectangle &renderArea,
     const vk::RenderPassDesc &renderPassDesc,
     const vk::AttachmentOpsArray &renderPassAttachmentOps,
@@ -6910,7 +7530,7 @@ angle::Result ContextVk::startNextSubpass()
     return mRenderPassCommands->nextSubpass(this, &mRenderPassCommandBuffer);
 }
 
-void ContextVk::restoreFinishedRenderPass(vk::Framebuffer *framebuffer)
+void ContextVk::restoreFinishedRenderPass(const vk::MaybeImagelessFramebuffer &framebuffer)
 {
     if (mRenderPassCommandBuffer != nullptr)
     {
@@ -6918,8 +7538,7 @@ void ContextVk::restoreFinishedRenderPass(vk::Framebuffer *framebuffer)
         return;
     }
 
-    if (mRenderPassCommands->started() &&
-        mRenderPassCommands->getFramebufferHandle() == framebuffer->getHandle())
+    if (mRenderPassCommands->started() && mRenderPassCommands->getFramebuffer() == framebuffer)
     {
         // There is already a render pass open for this framebuffer, so just restore the
         // pointer rather than starting a whole new render pass. One possible path here
@@ -7398,25 +8017,21 @@ angle::Result ContextVk::onResourceAccess(const vk::CommandBufferAccess &access)
 {
     ANGLE_TRY(flushCommandBuffersIfNecessary(access));
 
-    vk::OutsideRenderPassCommandBuffer *commandBuffer =
-        &mOutsideRenderPassCommands->getCommandBuffer();
-
     for (const vk::CommandBufferImageAccess &imageAccess : access.getReadImages())
     {
         ASSERT(!IsRenderPassStartedAndUsesImage(*mRenderPassCommands, *imageAccess.image));
 
-        imageAccess.image->recordReadBarrier(this, imageAccess.aspectFlags, imageAccess.imageLayout,
-                                             commandBuffer);
-        mOutsideRenderPassCommands->retainResource(imageAccess.image);
+        mOutsideRenderPassCommands->recordImageReadBarrier(
+            this, imageAccess.aspectFlags, imageAccess.imageLayout, imageAccess.image);
     }
 
     for (const vk::CommandBufferImageWrite &imageWrite : access.getWriteImages())
     {
         ASSERT(!IsRenderPassStartedAndUsesImage(*mRenderPassCommands, *imageWrite.access.image));
 
-        imageWrite.access.image->recordWriteBarrier(this, imageWrite.access.aspectFlags,
-                                                    imageWrite.access.imageLayout, commandBuffer);
-        mOutsideRenderPassCommands->retainResource(imageWrite.access.image);
+        mOutsideRenderPassCommands->recordImageWriteBarrier(this, imageWrite.access.aspectFlags,
+                                                            imageWrite.access.imageLayout,
+                                                            imageWrite.access.image);
         imageWrite.access.image->onWrite(imageWrite.levelStart, imageWrite.levelCount,
                                          imageWrite.layerStart, imageWrite.layerCount,
                                          imageWrite.access.aspectFlags);
@@ -7654,6 +8269,25 @@ ProgramExecutableVk *ContextVk::getExecutable() const
     return nullptr;
 }
 
+std::shared_ptr<angle::WaitableEvent> ContextVk::postAsyncGraphicsPipelineTask(
+    std::shared_ptr<angle::Closure> task)
+{
+    ASSERT(mPipelineWorkerPool);
+
+    // Forget about the tasks that are already done.
+    mAsyncGraphicsPipelineEvents.erase(
+        std::remove_if(mAsyncGraphicsPipelineEvents.begin(), mAsyncGraphicsPipelineEvents.end(),
+                       [](const std::shared_ptr<angle::WaitableEvent> &waitableEvent) {
+                           return waitableEvent->isReady();
+                       }),
+        mAsyncGraphicsPipelineEvents.end());
+
+    std::shared_ptr<angle::WaitableEvent> waitableEvent =
+        angle::WorkerThreadPool::PostWorkerTask(mPipelineWorkerPool, std::move(task));
+    mAsyncGraphicsPipelineEvents.push_back(waitableEvent);
+    return waitableEvent;
+}
+
 const angle::PerfMonitorCounterGroups &ContextVk::getPerfMonitorCounters()
 {
     syncObjectPerfCounters(mRenderer->getCommandQueuePerfCounters());
@@ -7759,19 +8393,49 @@ VkBufferView *UpdateDescriptorSetsBuilder::allocBufferViews(size_t count)
         &mBufferViews, count);
 }
 
+vk::DescriptorTemplateInfo *UpdateDescriptorSetsBuilder::allocTemplateDescriptorInfos(
+    const vk::DescriptorUpdateTemplate &updateTemplate,
+    VkDescriptorSet descriptorSet,
+    size_t count)
+{
+    // The infos are referenced by index until flush, so the storage is free to grow.
+    size_t oldSize = mTemplateDescriptorInfos.size();
+    mTemplateDescriptorInfos.resize(oldSize + count, {});
+    mTemplateUpdates.push_back({updateTemplate.getHandle(), descriptorSet, oldSize});
+    return &mTemplateDescriptorInfos[oldSize];
+}
+
 uint32_t UpdateDescriptorSetsBuilder::flushDescriptorSetUpdates(VkDevice device)
 {
+    uint32_t retVal = 0;
+
+    if (!mTemplateUpdates.empty())
+    {
+        for (const TemplateUpdate &update : mTemplateUpdates)
+        {
+            vkUpdateDescriptorSetWithTemplateKHR(device, update.descriptorSet,
+                                                 update.updateTemplate,
+                                                 &mTemplateDescriptorInfos[update.firstInfoIndex]);
+        }
+
+        retVal += mTemplateImageDescriptorCount;
+
+        mTemplateUpdates.clear();
+        mTemplateDescriptorInfos.clear();
+        mTemplateImageDescriptorCount = 0;
+    }
+
     if (mWriteDescriptorSets.empty())
     {
         ASSERT(mDescriptorBufferInfos.empty());
         ASSERT(mDescriptorImageInfos.empty());
-        return 0;
+        return retVal;
     }
 
     vkUpdateDescriptorSets(device, static_cast<uint32_t>(mWriteDescriptorSets.size()),
                            mWriteDescriptorSets.data(), 0, nullptr);
 
-    uint32_t retVal = static_cast<uint32_t>(mDescriptorImageInfos.size());
+    retVal += static_cast<uint32_t>(mDescriptorImageInfos.size());
 
     mWriteDescriptorSets.clear();
     mDescriptorBufferInfos.clear();
@@ -7789,6 +8453,8 @@ void ContextVk::resetPerFramePerfCounters()
     mPerfCounters.resolveImageCommands                   = 0;
     mPerfCounters.descriptorSetAllocations               = 0;
 
+    mPerFrameGraphicsPipelineCacheStats.reset();
+
     mRenderer->resetCommandQueuePerFrameCounters();
 
     mShareGroupVk->getMetaDescriptorPool(DescriptorSetIndex::UniformsAndXfb)
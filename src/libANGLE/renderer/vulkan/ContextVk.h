@@ -72,6 +72,17 @@ class UpdateDescriptorSetsBuilder final : angle::NonCopyable
     VkWriteDescriptorSet &allocWriteDescriptorSet() { return *allocWriteDescriptorSets(1); }
     VkBufferView &allocBufferView() { return *allocBufferViews(1); }
 
+    // Descriptor sets written with a descriptor update template.  The returned infos are only valid
+    // until the next allocation.
+    vk::DescriptorTemplateInfo *allocTemplateDescriptorInfos(
+        const vk::DescriptorUpdateTemplate &updateTemplate,
+        VkDescriptorSet descriptorSet,
+        size_t count);
+    void onTemplateImageDescriptorsWritten(uint32_t count)
+    {
+        mTemplateImageDescriptorCount += count;
+    }
+
     // Returns the number of written descriptor sets.
     uint32_t flushDescriptorSetUpdates(VkDevice device);
 
@@ -85,6 +96,16 @@ class UpdateDescriptorSetsBuilder final : angle::NonCopyable
     std::vector<VkDescriptorImageInfo> mDescriptorImageInfos;
     std::vector<VkWriteDescriptorSet> mWriteDescriptorSets;
     std::vector<VkBufferView> mBufferViews;
+
+    struct TemplateUpdate
+    {
+        VkDescriptorUpdateTemplateKHR updateTemplate;
+        VkDescriptorSet descriptorSet;
+        size_t firstInfoIndex;
+    };
+    std::vector<vk::DescriptorTemplateInfo> mTemplateDescriptorInfos;
+    std::vector<TemplateUpdate> mTemplateUpdates;
+    uint32_t mTemplateImageDescriptorCount = 0;
 };
 
 // Why depth/stencil feedback loop is being updated.  Based on whether it's due to a draw or clear,
@@ -384,6 +405,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     // KHR_blend_equation_advanced
     void blendBarrier() override;
 
+    // GL_ANGLE_draw_warm_up
+    angle::Result warmUpDraw(const gl::Context *context, gl::PrimitiveMode mode) override;
+
     // GL_ANGLE_vulkan_image
     angle::Result acquireTextures(const gl::Context *context,
                                   const gl::TextureBarrierVector &textureBarriers) override;
@@ -479,6 +503,13 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                     RenderPassClosureReason renderPassClosureReason);
     angle::Result finishImpl(RenderPassClosureReason renderPassClosureReason);
 
+    // Called when a fence sync object is created.  The commands are submitted so the sync object
+    // gets a serial, but for GL sync objects created inside a render pass of a context that doesn't
+    // share them with other contexts, that is deferred until the render pass ends, as with glFlush.
+    angle::Result onSyncObjectInit(vk::Resource *syncObject, bool isEGLSyncObject);
+    // Submits the commands if a flush was deferred, such as by onSyncObjectInit().
+    angle::Result flushIfDeferred(RenderPassClosureReason renderPassClosureReason);
+
     void addWaitSemaphore(VkSemaphore semaphore, VkPipelineStageFlags stageMask);
 
     Serial getLastCompletedQueueSerial() const { return mRenderer->getLastCompletedQueueSerial(); }
@@ -506,7 +537,6 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                        const vk::AttachmentOpsArray &ops,
                                        vk::RenderPass **renderPassOut);
 
-    vk::ShaderLibrary &getShaderLibrary() { return mShaderLibrary; }
     UtilsVk &getUtils() { return mUtils; }
 
     angle::Result getTimestamp(uint64_t *timestampOut);
@@ -525,6 +555,21 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     RenderPassCache &getRenderPassCache() { return mRenderPassCache; }
 
+    // Used by GraphicsPipelineCache to create optimized pipelines on a worker thread.
+    bool canCreateGraphicsPipelinesAsync() const { return mPipelineWorkerPool != nullptr; }
+    std::shared_ptr<angle::WaitableEvent> postAsyncGraphicsPipelineTask(
+        std::shared_ptr<angle::Closure> task);
+
+    // Used by ImageHelper to convert large texture uploads on worker threads.
+    const std::shared_ptr<angle::WorkerThreadPool> &getImageLoadWorkerPool() const
+    {
+        return mImageLoadWorkerPool;
+    }
+    CacheStats &getPerFrameGraphicsPipelineCacheStats()
+    {
+        return mPerFrameGraphicsPipelineCacheStats;
+    }
+
     vk::DescriptorSetLayoutDesc getDriverUniformsDescriptorSetDesc() const;
 
     bool emulateSeamfulCubeMapSampling() const { return mEmulateSeamfulCubeMapSampling; }
@@ -609,7 +654,7 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         return flushOutsideRenderPassCommands();
     }
 
-    angle::Result beginNewRenderPass(const vk::Framebuffer &framebuffer,
+    angle::Result beginNewRenderPass(const vk::MaybeImagelessFramebuffer &framebuffer,
                                      const gl::Rectangle &renderArea,
                                      const vk::RenderPassDesc &renderPassDesc,
                                      const vk::AttachmentOpsArray &renderPassAttachmentOps,
@@ -625,15 +670,14 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         return mRenderPassCommandBuffer && mRenderPassCommands->started();
     }
 
-    bool hasStartedRenderPassWithFramebuffer(vk::Framebuffer *framebuffer)
+    bool hasStartedRenderPassWithFramebuffer(const vk::MaybeImagelessFramebuffer &framebuffer)
     {
-        return hasStartedRenderPass() &&
-               mRenderPassCommands->getFramebufferHandle() == framebuffer->getHandle();
+        return hasStartedRenderPass() && mRenderPassCommands->getFramebuffer() == framebuffer;
     }
 
     bool hasStartedRenderPassWithCommands() const
     {
-        return hasStartedRenderPass() && !mRenderPassCommands->getCommandBuffer().empty();
+        return hasStartedRenderPass() && mRenderPassCommands->hasCommands();
     }
 
     vk::RenderPassCommandBufferHelper &getStartedRenderPassCommands()
@@ -643,7 +687,7 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     }
 
     // TODO(https://anglebug.com/4968): Support multiple open render passes.
-    void restoreFinishedRenderPass(vk::Framebuffer *framebuffer);
+    void restoreFinishedRenderPass(const vk::MaybeImagelessFramebuffer &framebuffer);
 
     uint32_t getCurrentSubpassIndex() const;
     uint32_t getCurrentViewCount() const;
@@ -714,9 +758,11 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     void flushDescriptorSetUpdates();
 
-    vk::BufferPool *getDefaultBufferPool(VkDeviceSize size, uint32_t memoryTypeIndex)
+    vk::BufferPool *getDefaultBufferPool(VkDeviceSize size,
+                                         uint32_t memoryTypeIndex,
+                                         vk::BufferUsageType usageType)
     {
-        return mShareGroupVk->getDefaultBufferPool(mRenderer, size, memoryTypeIndex);
+        return mShareGroupVk->getDefaultBufferPool(mRenderer, size, memoryTypeIndex, usageType);
     }
 
     angle::Result allocateStreamedVertexBuffer(size_t attribIndex,
@@ -733,6 +779,17 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         return angle::Result::Continue;
     }
 
+    // Allocates a single region that holds the data of all client attributes used by a draw call.
+    angle::Result allocateStreamedAttribsBuffer(size_t bytesToAllocate,
+                                                vk::BufferHelper **vertexBufferOut)
+    {
+        bool newBufferOut;
+        ANGLE_TRY(
+            mStreamedAttribsBuffer.allocate(this, bytesToAllocate, vertexBufferOut, &newBufferOut));
+        mHasInFlightStreamedAttribsBuffer = mHasInFlightStreamedAttribsBuffer || newBufferOut;
+        return angle::Result::Continue;
+    }
+
     const angle::PerfMonitorCounterGroups &getPerfMonitorCounters() override;
 
     void resetPerFramePerfCounters();
@@ -813,6 +870,7 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         DIRTY_BIT_DYNAMIC_DEPTH_COMPARE_OP,
         DIRTY_BIT_DYNAMIC_STENCIL_TEST_ENABLE,
         DIRTY_BIT_DYNAMIC_STENCIL_OP,
+        DIRTY_BIT_DYNAMIC_PRIMITIVE_TOPOLOGY,
         // - In VK_EXT_extended_dynamic_state2
         DIRTY_BIT_DYNAMIC_RASTERIZER_DISCARD_ENABLE,
         DIRTY_BIT_DYNAMIC_DEPTH_BIAS_ENABLE,
@@ -902,6 +960,8 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                   "Render pass using dirty bit must be handled after the render pass dirty bit");
     static_assert(DIRTY_BIT_DYNAMIC_STENCIL_OP > DIRTY_BIT_RENDER_PASS,
                   "Render pass using dirty bit must be handled after the render pass dirty bit");
+    static_assert(DIRTY_BIT_DYNAMIC_PRIMITIVE_TOPOLOGY > DIRTY_BIT_RENDER_PASS,
+                  "Render pass using dirty bit must be handled after the render pass dirty bit");
     static_assert(DIRTY_BIT_DYNAMIC_RASTERIZER_DISCARD_ENABLE > DIRTY_BIT_RENDER_PASS,
                   "Render pass using dirty bit must be handled after the render pass dirty bit");
     static_assert(DIRTY_BIT_DYNAMIC_DEPTH_BIAS_ENABLE > DIRTY_BIT_RENDER_PASS,
@@ -975,6 +1035,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                             gl::DrawElementsType indexTypeOrInvalid,
                             const void *indices,
                             DirtyBits dirtyBitMask);
+    // Refreshes the program cache entry so the new pipelines are warmed up when the program binary
+    // is loaded.
+    angle::Result onNewGraphicsPipelines(const gl::Context *context);
 
     angle::Result setupIndexedDraw(const gl::Context *context,
                                    gl::PrimitiveMode mode,
@@ -1025,7 +1088,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     void updateSurfaceRotationDrawFramebuffer(const gl::State &glState);
     void updateSurfaceRotationReadFramebuffer(const gl::State &glState);
 
-    angle::Result updateActiveTextures(const gl::Context *context, gl::Command command);
+    angle::Result updateActiveTextures(const gl::Context *context,
+                                       gl::Command command,
+                                       const gl::ActiveTextureMask &dirtyTextureUnits);
     template <typename CommandBufferHelperT>
     angle::Result updateActiveImages(CommandBufferHelperT *commandBufferHelper);
 
@@ -1132,6 +1197,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
         DirtyBits dirtyBitMask);
     angle::Result handleDirtyGraphicsDynamicStencilOp(DirtyBits::Iterator *dirtyBitsIterator,
                                                       DirtyBits dirtyBitMask);
+    angle::Result handleDirtyGraphicsDynamicPrimitiveTopology(
+        DirtyBits::Iterator *dirtyBitsIterator,
+        DirtyBits dirtyBitMask);
     angle::Result handleDirtyGraphicsDynamicRasterizerDiscardEnable(
         DirtyBits::Iterator *dirtyBitsIterator,
         DirtyBits dirtyBitMask);
@@ -1191,10 +1259,18 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     void writeAtomicCounterBufferDriverUniformOffsets(uint32_t *offsetsOut, size_t offsetsSize);
 
     angle::Result submitFrame(const vk::Semaphore *signalSemaphore, Serial *submitSerialOut);
+
+    // Releases cached memory that can be recreated on demand when VK_EXT_memory_budget reports
+    // that a heap is close to its budget.
+    void trimMemoryOnBudgetPressure();
     angle::Result submitFrameOutsideCommandBufferOnly(Serial *submitSerialOut);
     angle::Result submitCommands(const vk::Semaphore *signalSemaphore, Serial *submitSerialOut);
 
     angle::Result synchronizeCpuGpuTime();
+    angle::Result getCpuGpuTimestampsWithEvents(double *cpuTimestampSOut,
+                                                uint64_t *gpuTimestampCyclesOut);
+    angle::Result getCalibratedCpuGpuTimestamps(double *cpuTimestampSOut,
+                                                uint64_t *gpuTimestampCyclesOut);
     angle::Result traceGpuEventImpl(vk::OutsideRenderPassCommandBuffer *commandBuffer,
                                     char phase,
                                     const EventName &name);
@@ -1215,6 +1291,12 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                                                DirtyBits dirtyBitMask,
                                                RenderPassClosureReason reason);
 
+    // If the started render pass belongs to the draw framebuffer, for example because the
+    // framebuffer was bound away and back with nothing in between, continue recording in it instead
+    // of starting a new render pass.
+    angle::Result resumeRenderPassIfSameFramebuffer(const gl::Rectangle &renderArea,
+                                                    bool *resumedOut);
+
     void onRenderPassFinished(RenderPassClosureReason reason);
 
     void initIndexTypeMap();
@@ -1259,6 +1341,7 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     angle::Result onResourceAccess(const vk::CommandBufferAccess &access);
     angle::Result flushCommandBuffersIfNecessary(const vk::CommandBufferAccess &access);
     bool renderPassUsesStorageResources() const;
+    bool renderPassWritesDrawInputs() const;
 
     angle::Result pushDebugGroupImpl(GLenum source, GLuint id, const char *message);
     angle::Result popDebugGroupImpl();
@@ -1291,6 +1374,10 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     vk::PipelineHelper *mCurrentGraphicsPipeline;
     vk::PipelineHelper *mCurrentComputePipeline;
+    // The pipelines serial of the executable mCurrentGraphicsPipeline belongs to.  Binding compute
+    // programs doesn't change it, so that rebinding the same graphics program after a dispatch can
+    // keep using the current graphics pipeline.
+    uint64_t mCurrentGraphicsPipelinesSerial;
     gl::PrimitiveMode mCurrentDrawMode;
 
     WindowSurfaceVk *mCurrentWindowSurface;
@@ -1347,13 +1434,16 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     gl::DrawElementsType mCurrentDrawElementsType;
     angle::PackedEnumMap<gl::DrawElementsType, VkIndexType> mIndexTypeMap;
 
-    // Cache the current draw call's firstVertex to be passed to
-    // TransformFeedbackVk::getBufferOffsets.  Unfortunately, gl_BaseVertex support in Vulkan is
-    // not yet ubiquitous, which would have otherwise removed the need for this value to be passed
-    // as a uniform.
-    GLint mXfbBaseVertex;
+    // Cache the current draw call's transform feedback buffer offsets, as calculated by
+    // TransformFeedbackVk::getBufferOffsets from the draw call's firstVertex.  Unfortunately,
+    // gl_BaseVertex support in Vulkan is not yet ubiquitous, which would have otherwise removed
+    // the need for these values to be passed as uniforms.
+    std::array<int32_t, gl::IMPLEMENTATION_MAX_TRANSFORM_FEEDBACK_BUFFERS> mXfbBufferOffsets;
     // Cache the current draw call's vertex count as well to support instanced draw calls
     GLuint mXfbVertexCountPerInstance;
+    // Whether the driver uniforms hold the values above.  Draw calls that capture where the
+    // previous one stopped, such as draws of consecutive vertex ranges, don't update them.
+    bool mXfbDriverUniformsCurrent;
 
     // Cached clear value/mask for color and depth/stencil.
     VkClearValue mClearColorValue;
@@ -1367,6 +1457,9 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     bool mFlipYForCurrentSurface;
     bool mFlipViewportForDrawFramebuffer;
     bool mFlipViewportForReadFramebuffer;
+    // Whether onMakeCurrent was called before, so that the state affected by the flip and rotation
+    // of the surfaces is known to be up to date.
+    bool mHasBeenCurrent;
 
     // If any host-visible buffer is written by the GPU since last submission, a barrier is inserted
     // at the end of the command buffer to make that write available to the host.
@@ -1379,6 +1472,12 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     // This info is used in the descriptor update step.
     gl::ActiveTextureArray<TextureVk *> mActiveTextures;
+    // When only some texture bindings change, updateActiveTextures() only revisits the units that
+    // changed, along with the units that need to be checked on every update.  All active units are
+    // revisited when the program executable changes.
+    bool mUpdateAllActiveTextures;
+    gl::ActiveTextureMask mActiveDepthStencilTextureUnits;
+    gl::ActiveTextureMask mActiveImmutableSamplerTextureUnits;
 
     // We use textureSerial to optimize texture binding updates. Each permutation of a
     // {VkImage/VkSampler} generates a unique serial. These object ids are combined to form a unique
@@ -1399,6 +1498,11 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
     gl::AttribArray<vk::DynamicBuffer> mStreamedVertexBuffers;
     gl::AttributesMask mHasInFlightStreamedVertexBuffers;
 
+    // DynamicBuffer shared by all client attributes of a draw call, so that they are written to a
+    // single persistently mapped region and flushed together.
+    vk::DynamicBuffer mStreamedAttribsBuffer;
+    bool mHasInFlightStreamedAttribsBuffer;
+
     // We use a single pool for recording commands. We also keep a free list for pool recycling.
     vk::SecondaryCommandPools mCommandPools;
 
@@ -1425,8 +1529,6 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
                             gl::IMPLEMENTATION_MAX_TRANSFORM_FEEDBACK_BUFFERS>
         mCurrentTransformFeedbackBuffers;
 
-    // Internal shader library.
-    vk::ShaderLibrary mShaderLibrary;
     UtilsVk mUtils;
 
     bool mGpuEventsEnabled;
@@ -1504,6 +1606,19 @@ class ContextVk : public ContextImpl, public vk::Context, public MultisampleText
 
     VulkanCacheStats mVulkanCacheStats;
 
+    // Graphics pipeline cache misses in the current frame, and how many of them the draw call had
+    // to wait on.
+    CacheStats mPerFrameGraphicsPipelineCacheStats;
+
+    // Worker threads that create optimized pipelines when asyncGraphicsPipelineCreation is enabled,
+    // and the tasks that may still reference this context's render pass cache.
+    std::shared_ptr<angle::WorkerThreadPool> mPipelineWorkerPool;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mAsyncGraphicsPipelineEvents;
+
+    // Worker threads that convert large texture uploads, and filter large levels of mipmaps
+    // generated on the CPU, when loadTextureDataInParallel is enabled.
+    std::shared_ptr<angle::WorkerThreadPool> mImageLoadWorkerPool;
+
     // A graph built from pipeline descs and their transitions.
     std::ostringstream mPipelineCacheGraph;
 };
@@ -27,6 +27,8 @@ namespace rx
 {
 // Time interval in seconds that we should try to prune default buffer pools.
 constexpr double kTimeElapsedForPruneDefaultBufferPool = 0.25;
+// Limits the GPU copies done at each frame boundary to defragment the default buffer pools.
+constexpr VkDeviceSize kMaxBufferBytesToMovePerFrame = 8 * 1024 * 1024;
 
 // Set to true will log bufferpool stats into INFO stream
 #define ANGLE_ENABLE_BUFFER_POOL_STATS_LOGGING 0
@@ -56,6 +58,7 @@ void DisplayVk::terminate()
     mRenderer->reloadVolkIfNeeded();
 
     ASSERT(mRenderer);
+    mExternalImageCache.destroy(mRenderer);
     mRenderer->onDestroy(this);
 }
 
@@ -277,6 +280,12 @@ ExternalImageSiblingImpl *DisplayVk::createExternalImageSibling(const gl::Contex
     }
 }
 
+ExternalImageCache *DisplayVk::getExternalImageCache()
+{
+    return getRenderer()->getFeatures().reuseImportedExternalImages.enabled ? &mExternalImageCache
+                                                                            : nullptr;
+}
+
 void DisplayVk::generateExtensions(egl::DisplayExtensions *outExtensions) const
 {
     outExtensions->createContextRobustness    = getRenderer()->getNativeExtensions().robustnessEXT;
@@ -347,6 +356,8 @@ void DisplayVk::generateExtensions(egl::DisplayExtensions *outExtensions) const
 
     outExtensions->vulkanImageANGLE = true;
 
+    outExtensions->lowLatencyPresentANGLE = true;
+
     outExtensions->lockSurface3KHR =
         getRenderer()->getFeatures().supportsLockSurfaceExtension.enabled;
 
@@ -407,6 +418,13 @@ egl::Error DisplayVk::getEGLError(EGLint errorCode)
     return egl::Error(errorCode, 0, std::move(errorString));
 }
 
+void DisplayVk::initializeFrontendFeatures(angle::FrontendFeatures *features) const
+{
+    // The Vulkan backend derives everything it needs from the translator's output, so translated
+    // shaders can be cached and reused without invoking the translator again.
+    ANGLE_FEATURE_CONDITION(features, cacheCompiledShader, true);
+}
+
 void DisplayVk::populateFeatureList(angle::FeatureList *features)
 {
     mRenderer->getFeatures().populateFeatureList(features);
@@ -416,6 +434,7 @@ ShareGroupVk::ShareGroupVk()
 {
     mLastPruneTime             = angle::GetCurrentSystemTime();
     mOrphanNonEmptyBufferBlock = false;
+    mHasEvacuatingBufferBlocks = false;
 }
 
 void ShareGroupVk::addContext(ContextVk *contextVk)
@@ -437,11 +456,14 @@ void ShareGroupVk::onDestroy(const egl::Display *display)
 {
     RendererVk *renderer = vk::GetImpl(display)->getRenderer();
 
-    for (std::unique_ptr<vk::BufferPool> &pool : mDefaultBufferPools)
+    for (vk::BufferPoolPointerArray &pools : mDefaultBufferPools)
     {
-        if (pool)
+        for (std::unique_ptr<vk::BufferPool> &pool : pools)
         {
-            pool->destroy(renderer, mOrphanNonEmptyBufferBlock);
+            if (pool)
+            {
+                pool->destroy(renderer, mOrphanNonEmptyBufferBlock);
+            }
         }
     }
 
@@ -477,7 +499,8 @@ void ShareGroupVk::releaseResourceUseLists(const Serial &submitSerial)
 
 vk::BufferPool *ShareGroupVk::getDefaultBufferPool(RendererVk *renderer,
                                                    VkDeviceSize size,
-                                                   uint32_t memoryTypeIndex)
+                                                   uint32_t memoryTypeIndex,
+                                                   vk::BufferUsageType usageType)
 {
     if (size <= kMaxSizeToUseSmallBufferPool &&
         memoryTypeIndex ==
@@ -498,7 +521,9 @@ vk::BufferPool *ShareGroupVk::getDefaultBufferPool(RendererVk *renderer,
         }
         return mSmallBufferPool.get();
     }
-    else if (!mDefaultBufferPools[memoryTypeIndex])
+
+    vk::BufferPoolPointerArray &pools = mDefaultBufferPools[usageType];
+    if (!pools[memoryTypeIndex])
     {
         const vk::Allocator &allocator = renderer->getAllocator();
         VkBufferUsageFlags usageFlags  = GetDefaultBufferUsageFlags(renderer);
@@ -509,10 +534,10 @@ vk::BufferPool *ShareGroupVk::getDefaultBufferPool(RendererVk *renderer,
         std::unique_ptr<vk::BufferPool> pool = std::make_unique<vk::BufferPool>();
         pool->initWithFlags(renderer, vma::VirtualBlockCreateFlagBits::GENERAL, usageFlags, 0,
                             memoryTypeIndex, memoryPropertyFlags);
-        mDefaultBufferPools[memoryTypeIndex] = std::move(pool);
+        pools[memoryTypeIndex] = std::move(pool);
     }
 
-    return mDefaultBufferPools[memoryTypeIndex].get();
+    return pools[memoryTypeIndex].get();
 }
 
 void ShareGroupVk::pruneDefaultBufferPools(RendererVk *renderer)
@@ -525,16 +550,24 @@ void ShareGroupVk::pruneDefaultBufferPools(RendererVk *renderer)
         return;
     }
 
-    for (std::unique_ptr<vk::BufferPool> &pool : mDefaultBufferPools)
+    mHasEvacuatingBufferBlocks = false;
+    for (vk::BufferPoolPointerArray &pools : mDefaultBufferPools)
     {
-        if (pool)
+        for (std::unique_ptr<vk::BufferPool> &pool : pools)
         {
-            pool->pruneEmptyBuffers(renderer);
+            if (pool)
+            {
+                pool->pruneEmptyBuffers(renderer);
+                mHasEvacuatingBufferBlocks =
+                    mHasEvacuatingBufferBlocks || pool->hasEvacuatingBlocks();
+            }
         }
     }
     if (mSmallBufferPool)
     {
         mSmallBufferPool->pruneEmptyBuffers(renderer);
+        mHasEvacuatingBufferBlocks =
+            mHasEvacuatingBufferBlocks || mSmallBufferPool->hasEvacuatingBlocks();
     }
 
     renderer->onBufferPoolPrune();
@@ -544,6 +577,30 @@ void ShareGroupVk::pruneDefaultBufferPools(RendererVk *renderer)
 #endif
 }
 
+angle::Result ShareGroupVk::moveBuffersOutOfEvacuatingBlocks(ContextVk *contextVk)
+{
+    ASSERT(mHasEvacuatingBufferBlocks);
+
+    VkDeviceSize totalMovedSize = 0;
+    for (BufferVk *bufferVk : mBuffers)
+    {
+        VkDeviceSize movedSize = 0;
+        ANGLE_TRY(bufferVk->moveOutOfEvacuatingBufferBlock(contextVk, &movedSize));
+
+        totalMovedSize += movedSize;
+        if (totalMovedSize >= kMaxBufferBytesToMovePerFrame)
+        {
+            // Continue at the next frame boundary.
+            return angle::Result::Continue;
+        }
+    }
+
+    // Every buffer that could be moved has been; the evacuated blocks are freed once the GPU is
+    // done with them and the pools are pruned.
+    mHasEvacuatingBufferBlocks = false;
+    return angle::Result::Continue;
+}
+
 bool ShareGroupVk::isDueForBufferPoolPrune(RendererVk *renderer)
 {
     // Ensure we periodically prune to maintain the heuristic information
@@ -567,12 +624,15 @@ void ShareGroupVk::calculateTotalBufferCount(size_t *bufferCount, VkDeviceSize *
 {
     *bufferCount = 0;
     *totalSize   = 0;
-    for (const std::unique_ptr<vk::BufferPool> &pool : mDefaultBufferPools)
+    for (const vk::BufferPoolPointerArray &pools : mDefaultBufferPools)
     {
-        if (pool)
+        for (const std::unique_ptr<vk::BufferPool> &pool : pools)
         {
-            *bufferCount += pool->getBufferCount();
-            *totalSize += pool->getMemorySize();
+            if (pool)
+            {
+                *bufferCount += pool->getBufferCount();
+                *totalSize += pool->getMemorySize();
+            }
         }
     }
     if (mSmallBufferPool)
@@ -590,20 +650,26 @@ void ShareGroupVk::logBufferPools() const
 
     INFO() << "BufferBlocks count:" << totalBufferCount << " memorySize:" << totalMemorySize / 1024
            << " UnusedBytes/memorySize (KBs):";
-    for (const std::unique_ptr<vk::BufferPool> &pool : mDefaultBufferPools)
+    for (vk::BufferUsageType usageType : angle::AllEnums<vk::BufferUsageType>())
     {
-        if (pool && pool->getBufferCount() > 0)
+        const vk::BufferPoolPointerArray &pools = mDefaultBufferPools[usageType];
+        for (size_t memoryTypeIndex = 0; memoryTypeIndex < pools.size(); ++memoryTypeIndex)
         {
-            std::ostringstream log;
-            pool->addStats(&log);
-            INFO() << "\t" << log.str();
+            const std::unique_ptr<vk::BufferPool> &pool = pools[memoryTypeIndex];
+            if (pool && pool->getBufferCount() > 0)
+            {
+                std::ostringstream log;
+                pool->addStats(&log);
+                INFO() << "\t" << (usageType == vk::BufferUsageType::Static ? "Static" : "Dynamic")
+                       << " memoryType " << memoryTypeIndex << ": " << log.str();
+            }
         }
     }
     if (mSmallBufferPool && mSmallBufferPool->getBufferCount() > 0)
     {
         std::ostringstream log;
         mSmallBufferPool->addStats(&log);
-        INFO() << "\t" << log.str();
+        INFO() << "\tSmall: " << log.str();
     }
 }
 }  // namespace rx
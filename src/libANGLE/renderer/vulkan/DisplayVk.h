@@ -12,6 +12,7 @@
 
 #include "common/MemoryBuffer.h"
 #include "libANGLE/renderer/DisplayImpl.h"
+#include "libANGLE/renderer/vulkan/ImageVk.h"
 #include "libANGLE/renderer/vulkan/ResourceVk.h"
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
@@ -21,6 +22,7 @@ namespace rx
 {
 constexpr VkDeviceSize kMaxTotalEmptyBufferBytes = 16 * 1024 * 1024;
 
+class BufferVk;
 class RendererVk;
 using ContextVkSet = std::set<ContextVk *>;
 
@@ -30,9 +32,11 @@ class ShareGroupVk : public ShareGroupImpl
     ShareGroupVk();
     void onDestroy(const egl::Display *display) override;
 
-    // PipelineLayoutCache and DescriptorSetLayoutCache can be shared between multiple threads
-    // accessing them via shared contexts. The ShareGroup locks around gl entrypoints ensuring
-    // synchronous update to the caches.
+    // PipelineLayoutCache, DescriptorSetLayoutCache and the descriptor set caches in the
+    // MetaDescriptorPools can be shared between multiple threads accessing them via shared
+    // contexts. The ShareGroup locks around gl entrypoints ensuring synchronous update to the
+    // caches.  Descriptor sets cached here are looked up by every context in the share group, so a
+    // set written by one context is reused by the others without another vkUpdateDescriptorSets.
     PipelineLayoutCache &getPipelineLayoutCache() { return mPipelineLayoutCache; }
     DescriptorSetLayoutCache &getDescriptorSetLayoutCache() { return mDescriptorSetLayoutCache; }
     const ContextVkSet &getContexts() const { return mContexts; }
@@ -49,10 +53,18 @@ class ShareGroupVk : public ShareGroupImpl
 
     vk::BufferPool *getDefaultBufferPool(RendererVk *renderer,
                                          VkDeviceSize size,
-                                         uint32_t memoryTypeIndex);
+                                         uint32_t memoryTypeIndex,
+                                         vk::BufferUsageType usageType);
     void pruneDefaultBufferPools(RendererVk *renderer);
     bool isDueForBufferPoolPrune(RendererVk *renderer);
 
+    // Buffers are tracked so that their storage can be moved out of the BufferBlocks that the
+    // default buffer pools evacuate when they are fragmented.
+    void addBuffer(BufferVk *bufferVk) { mBuffers.insert(bufferVk); }
+    void removeBuffer(BufferVk *bufferVk) { mBuffers.erase(bufferVk); }
+    bool hasEvacuatingBufferBlocks() const { return mHasEvacuatingBufferBlocks; }
+    angle::Result moveBuffersOutOfEvacuatingBlocks(ContextVk *contextVk);
+
     void calculateTotalBufferCount(size_t *bufferCount, VkDeviceSize *totalSize) const;
     void logBufferPools() const;
 
@@ -76,8 +88,9 @@ class ShareGroupVk : public ShareGroupImpl
     // ShareGroupVk submits the next command.
     std::vector<vk::ResourceUseList> mResourceUseLists;
 
-    // The per shared group buffer pools that all buffers should sub-allocate from.
-    vk::BufferPoolPointerArray mDefaultBufferPools;
+    // The per shared group buffer pools that all buffers should sub-allocate from, separated by
+    // the expected lifetime of the buffers.
+    vk::BufferPoolPointerArrays mDefaultBufferPools;
 
     // The pool dedicated for small allocations that uses faster buddy algorithm
     std::unique_ptr<vk::BufferPool> mSmallBufferPool;
@@ -86,6 +99,11 @@ class ShareGroupVk : public ShareGroupImpl
     // The system time when last pruneEmptyBuffer gets called.
     double mLastPruneTime;
 
+    // All buffers of the share group, and whether any default buffer pool has blocks whose
+    // buffers should be moved elsewhere.
+    angle::HashSet<BufferVk *> mBuffers;
+    bool mHasEvacuatingBufferBlocks;
+
     // If true, it is expected that a BufferBlock may still in used by textures that outlived
     // ShareGroup. The non-empty BufferBlock will be put into RendererVk's orphan list instead.
     bool mOrphanNonEmptyBufferBlock;
@@ -171,6 +189,9 @@ class DisplayVk : public DisplayImpl, public vk::Context
                                            angle::MemoryBuffer **scratchBufferOut) const;
     angle::ScratchBuffer *getScratchBuffer() const { return &mScratchBuffer; }
 
+    // nullptr unless the reuseImportedExternalImages feature is enabled.
+    ExternalImageCache *getExternalImageCache();
+
     void handleError(VkResult result,
                      const char *file,
                      const char *function,
@@ -179,6 +200,8 @@ class DisplayVk : public DisplayImpl, public vk::Context
     // TODO(jmadill): Remove this once refactor is done. http://anglebug.com/3041
     egl::Error getEGLError(EGLint errorCode);
 
+    void initializeFrontendFeatures(angle::FrontendFeatures *features) const override;
+
     void populateFeatureList(angle::FeatureList *features) override;
 
     ShareGroupImpl *createShareGroup() override;
@@ -195,6 +218,8 @@ class DisplayVk : public DisplayImpl, public vk::Context
 
     mutable angle::ScratchBuffer mScratchBuffer;
 
+    ExternalImageCache mExternalImageCache;
+
     vk::Error mSavedError;
 };
 
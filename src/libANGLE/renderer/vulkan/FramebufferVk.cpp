@@ -94,88 +94,6 @@ bool AreSrcAndDstDepthStencilChannelsBlitCompatible(RenderTargetVk *srcRenderTar
            (dstFormat.stencilBits > 0 || srcFormat.stencilBits == 0);
 }
 
-void EarlyAdjustFlipYForPreRotation(SurfaceRotation blitAngleIn,
-                                    SurfaceRotation *blitAngleOut,
-                                    bool *blitFlipYOut)
-{
-    switch (blitAngleIn)
-    {
-        case SurfaceRotation::Identity:
-            // No adjustments needed
-            break;
-        case SurfaceRotation::Rotated90Degrees:
-            *blitAngleOut = SurfaceRotation::Rotated90Degrees;
-            *blitFlipYOut = false;
-            break;
-        case SurfaceRotation::Rotated180Degrees:
-            *blitAngleOut = SurfaceRotation::Rotated180Degrees;
-            break;
-        case SurfaceRotation::Rotated270Degrees:
-            *blitAngleOut = SurfaceRotation::Rotated270Degrees;
-            *blitFlipYOut = false;
-            break;
-        default:
-            UNREACHABLE();
-            break;
-    }
-}
-
-void AdjustBlitAreaForPreRotation(SurfaceRotation framebufferAngle,
-                                  const gl::Rectangle &blitAreaIn,
-                                  const gl::Rectangle &framebufferDimensions,
-                                  gl::Rectangle *blitAreaOut)
-{
-    switch (framebufferAngle)
-    {
-        case SurfaceRotation::Identity:
-            // No adjustments needed
-            break;
-        case SurfaceRotation::Rotated90Degrees:
-            blitAreaOut->x = blitAreaIn.y;
-            blitAreaOut->y = blitAreaIn.x;
-            std::swap(blitAreaOut->width, blitAreaOut->height);
-            break;
-        case SurfaceRotation::Rotated180Degrees:
-            blitAreaOut->x = framebufferDimensions.width - blitAreaIn.x - blitAreaIn.width;
-            blitAreaOut->y = framebufferDimensions.height - blitAreaIn.y - blitAreaIn.height;
-            break;
-        case SurfaceRotation::Rotated270Degrees:
-            blitAreaOut->x = framebufferDimensions.height - blitAreaIn.y - blitAreaIn.height;
-            blitAreaOut->y = framebufferDimensions.width - blitAreaIn.x - blitAreaIn.width;
-            std::swap(blitAreaOut->width, blitAreaOut->height);
-            break;
-        default:
-            UNREACHABLE();
-            break;
-    }
-}
-
-void AdjustDimensionsAndFlipForPreRotation(SurfaceRotation framebufferAngle,
-                                           gl::Rectangle *framebufferDimensions,
-                                           bool *flipX,
-                                           bool *flipY)
-{
-    switch (framebufferAngle)
-    {
-        case SurfaceRotation::Identity:
-            // No adjustments needed
-            break;
-        case SurfaceRotation::Rotated90Degrees:
-            std::swap(framebufferDimensions->width, framebufferDimensions->height);
-            std::swap(*flipX, *flipY);
-            break;
-        case SurfaceRotation::Rotated180Degrees:
-            break;
-        case SurfaceRotation::Rotated270Degrees:
-            std::swap(framebufferDimensions->width, framebufferDimensions->height);
-            std::swap(*flipX, *flipY);
-            break;
-        default:
-            UNREACHABLE();
-            break;
-    }
-}
-
 // When blitting, the source and destination areas are viewed like UVs.  For example, a 64x64
 // texture if flipped should have an offset of 64 in either X or Y which corresponds to U or V of 1.
 // On the other hand, when resolving, the source and destination areas are used as fragment
@@ -272,6 +190,18 @@ bool HasResolveAttachment(const gl::AttachmentArray<RenderTargetVk *> &colorRend
     return false;
 }
 
+void AddImagelessFramebufferAttachment(const RenderTargetVk &renderTarget,
+                                       const vk::ImageHelper &image,
+                                       vk::ImagelessFramebufferDesc *desc)
+{
+    // The views of the render target and its resolve attachment are of the same level.
+    vk::LevelIndex levelVk =
+        renderTarget.getImageForRenderPass().toVkLevel(renderTarget.getLevelIndex());
+    desc->addAttachment(image.getCreateFlags(), image.getUsage(), image.getLevelExtents2D(levelVk),
+                        renderTarget.getLayerCount(), image.getViewFormatCount(),
+                        image.getViewFormats());
+}
+
 vk::FramebufferNonResolveAttachmentMask MakeUnresolveAttachmentMask(const vk::RenderPassDesc &desc)
 {
     vk::FramebufferNonResolveAttachmentMask unresolveMask(
@@ -331,7 +261,6 @@ FramebufferVk::FramebufferVk(RendererVk *renderer,
                              WindowSurfaceVk *backbuffer)
     : FramebufferImpl(state),
       mBackbuffer(backbuffer),
-      mFramebuffer(nullptr),
       mActiveColorComponentMasksForClear(0),
       mReadOnlyDepthFeedbackLoopMode(false)
 {}
@@ -345,7 +274,9 @@ void FramebufferVk::destroy(const gl::Context *context)
 
     mFramebufferCache.clear(contextVk);
     mFramebufferCache.destroy(rendererVk);
-    mFramebuffer = nullptr;
+    mImagelessFramebufferCache.clear(contextVk);
+    mImagelessFramebufferCache.destroy(rendererVk);
+    mCurrentFramebuffer.reset();
 }
 
 angle::Result FramebufferVk::discard(const gl::Context *context,
@@ -478,17 +409,31 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
                          : UpdateDepthFeedbackLoopReason::None));
     }
 
-    const bool scissoredClear = scissoredRenderArea != getRotatedCompleteRenderArea(contextVk);
+    // Clears that cover the damage region of the window surface are not scissored, as there's no
+    // need to preserve the contents outside of it.
+    const bool scissoredClear = scissoredRenderArea != getRotatedDamagedRenderArea(contextVk);
+
+    const bool preferDrawOverClearAttachments =
+        contextVk->getRenderer()->getFeatures().preferDrawClearOverVkCmdClearAttachments.enabled;
 
-    // We use the draw path if scissored clear, or color or stencil are masked.  Note that depth
-    // clearing is already disabled if there's a depth mask.
+    // We use the draw path if color or stencil are masked.  Note that depth clearing is already
+    // disabled if there's a depth mask.  Scissored clears that are otherwise unmasked use
+    // vkCmdClearAttachments with the scissor as the clear rect, which the render pass batches with
+    // neighboring clears of the same attachments, unless draws are preferred for this.
     const bool maskedClearColor = clearColor && (mActiveColorComponentMasksForClear & colorMasks) !=
                                                     mActiveColorComponentMasksForClear;
-    const bool maskedClearStencil = clearStencil && stencilMask != 0xFF;
+    const bool maskedClearStencil     = clearStencil && stencilMask != 0xFF;
+    const bool scissoredClearWithDraw = scissoredClear && preferDrawOverClearAttachments;
 
-    bool clearColorWithDraw   = clearColor && (maskedClearColor || scissoredClear);
-    bool clearDepthWithDraw   = clearDepth && scissoredClear;
-    bool clearStencilWithDraw = clearStencil && (maskedClearStencil || scissoredClear);
+    bool clearColorWithDraw   = clearColor && (maskedClearColor || scissoredClearWithDraw);
+    bool clearDepthWithDraw   = clearDepth && scissoredClearWithDraw;
+    bool clearStencilWithDraw = clearStencil && (maskedClearStencil || scissoredClearWithDraw);
+
+    const bool clearColorWithCommand   = clearColor && !clearColorWithDraw && scissoredClear;
+    const bool clearDepthWithCommand   = clearDepth && !clearDepthWithDraw && scissoredClear;
+    const bool clearStencilWithCommand = clearStencil && !clearStencilWithDraw && scissoredClear;
+    const bool clearAnyWithCommand =
+        clearColorWithCommand || clearDepthWithCommand || clearStencilWithCommand;
 
     const bool isMidRenderPassClear = contextVk->hasStartedRenderPassWithCommands();
 
@@ -496,7 +441,7 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
     {
         // If a render pass is open with commands, it must be for this framebuffer.  Otherwise,
         // either FramebufferVk::syncState() or ContextVk::syncState() would have closed it.
-        vk::Framebuffer *currentFramebuffer = nullptr;
+        vk::MaybeImagelessFramebuffer currentFramebuffer;
         ANGLE_TRY(getFramebuffer(contextVk, &currentFramebuffer, nullptr,
                                  SwapchainResolveMode::Disabled));
         ASSERT(contextVk->hasStartedRenderPassWithFramebuffer(currentFramebuffer));
@@ -512,9 +457,6 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
             contextVk->handleGraphicsEventLog(rx::GraphicsEventCmdBuf::InOutsideCmdBufQueryCmd));
     }
 
-    const bool preferDrawOverClearAttachments =
-        contextVk->getRenderer()->getFeatures().preferDrawClearOverVkCmdClearAttachments.enabled;
-
     // Merge current clears with the deferred clears, then proceed with only processing deferred
     // clears.  This simplifies the clear paths such that they don't need to consider both the
     // current and deferred clears.  Additionally, it avoids needing to undo an unresolve
@@ -536,22 +478,23 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
     else
     {
         gl::DrawBufferMask clearColorDrawBuffersMask;
-        if (clearColor && !clearColorWithDraw)
+        if (clearColor && !clearColorWithDraw && !clearColorWithCommand)
         {
             clearColorDrawBuffersMask = clearColorBuffers;
         }
 
-        mergeClearsWithDeferredClears(clearColorDrawBuffersMask, clearDepth && !clearDepthWithDraw,
-                                      clearStencil && !clearStencilWithDraw, clearColorValue,
-                                      clearDepthStencilValue);
+        mergeClearsWithDeferredClears(
+            clearColorDrawBuffersMask, clearDepth && !clearDepthWithDraw && !clearDepthWithCommand,
+            clearStencil && !clearStencilWithDraw && !clearStencilWithCommand, clearColorValue,
+            clearDepthStencilValue);
     }
 
+    const bool clearAnyWithDraw = clearColorWithDraw || clearDepthWithDraw || clearStencilWithDraw;
+
     // If any deferred clears, we can further defer them, clear them with vkCmdClearAttachments or
     // flush them if necessary.
     if (mDeferredClears.any())
     {
-        const bool clearAnyWithDraw =
-            clearColorWithDraw || clearDepthWithDraw || clearStencilWithDraw;
 
         // If we are in an active renderpass that has recorded commands and the framebuffer hasn't
         // changed, inline the clear.
@@ -581,9 +524,10 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
             ASSERT(!contextVk->hasStartedRenderPass());
 
             // This path will defer the current clears along with deferred clears.  This won't work
-            // if any attachment needs to be subsequently cleared with a draw call.  In that case,
-            // flush deferred clears, which will start a render pass with deferred clear values.
-            // The subsequent draw call will then operate on the cleared attachments.
+            // if any attachment needs to be subsequently cleared with a draw call or
+            // vkCmdClearAttachments.  In that case, flush deferred clears, which will start a
+            // render pass with deferred clear values.  The subsequent clears will then operate on
+            // the cleared attachments.
             //
             // Additionally, if the framebuffer is layered, any attachment is 3D and it has a larger
             // depth than the framebuffer layers, clears cannot be deferred.  This is because the
@@ -593,7 +537,7 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
                 mRenderTargetCache, mState.getColorAttachmentsMask(),
                 mCurrentFramebufferDesc.getLayerCount());
 
-            if (clearAnyWithDraw || isAnyAttachment3DWithoutAllLayers)
+            if (clearAnyWithDraw || clearAnyWithCommand || isAnyAttachment3DWithoutAllLayers)
             {
                 ANGLE_TRY(flushDeferredClears(contextVk));
             }
@@ -602,13 +546,27 @@ angle::Result FramebufferVk::clearImpl(const gl::Context *context,
                 redeferClears(contextVk);
             }
         }
+    }
+    ASSERT(mDeferredClears.empty());
 
-        // If nothing left to clear, early out.
-        if (!clearAnyWithDraw)
+    if (clearAnyWithCommand)
+    {
+        gl::DrawBufferMask clearColorCommandBuffersMask;
+        if (clearColorWithCommand)
         {
-            ASSERT(mDeferredClears.empty());
-            return angle::Result::Continue;
+            clearColorCommandBuffersMask = clearColorBuffers;
         }
+
+        ANGLE_TRY(clearScissoredWithCommand(contextVk, scissoredRenderArea,
+                                            clearColorCommandBuffersMask, clearDepthWithCommand,
+                                            clearStencilWithCommand, clearColorValue,
+                                            clearDepthStencilValue));
+    }
+
+    // If nothing left to clear, early out.
+    if (!clearAnyWithDraw)
+    {
+        return angle::Result::Continue;
     }
 
     if (!clearColorWithDraw)
@@ -752,39 +710,9 @@ angle::Result FramebufferVk::readPixels(const gl::Context *context,
                                                    clippedArea, &params, &outputSkipBytes));
 
     bool flipY = contextVk->isViewportFlipEnabledForReadFBO();
-    switch (params.rotation = contextVk->getRotationReadFramebuffer())
-    {
-        case SurfaceRotation::Identity:
-            // Do not rotate gl_Position (surface matches the device's orientation):
-            if (flipY)
-            {
-                params.area.y = fbRect.height - clippedArea.y - clippedArea.height;
-            }
-            break;
-        case SurfaceRotation::Rotated90Degrees:
-            // Rotate gl_Position 90 degrees:
-            params.area.x = clippedArea.y;
-            params.area.y =
-                flipY ? clippedArea.x : fbRect.width - clippedArea.x - clippedArea.width;
-            std::swap(params.area.width, params.area.height);
-            break;
-        case SurfaceRotation::Rotated180Degrees:
-            // Rotate gl_Position 180 degrees:
-            params.area.x = fbRect.width - clippedArea.x - clippedArea.width;
-            params.area.y =
-                flipY ? clippedArea.y : fbRect.height - clippedArea.y - clippedArea.height;
-            break;
-        case SurfaceRotation::Rotated270Degrees:
-            // Rotate gl_Position 270 degrees:
-            params.area.x = fbRect.height - clippedArea.y - clippedArea.height;
-            params.area.y =
-                flipY ? fbRect.width - clippedArea.x - clippedArea.width : clippedArea.x;
-            std::swap(params.area.width, params.area.height);
-            break;
-        default:
-            UNREACHABLE();
-            break;
-    }
+    params.rotation = contextVk->getRotationReadFramebuffer();
+    RotateRectangle(params.rotation, flipY, fbRect.width, fbRect.height, clippedArea,
+                    &params.area);
     if (flipY)
     {
         params.reverseRowOrder = !params.reverseRowOrder;
@@ -1193,7 +1121,7 @@ angle::Result FramebufferVk::blit(const gl::Context *context,
             // already done and whose data is already flushed from the tile (in a tile-based
             // renderer), so there's no chance for the resolve attachment to take advantage of the
             // data already being present in the tile.
-            vk::Framebuffer *srcVkFramebuffer = nullptr;
+            vk::MaybeImagelessFramebuffer srcVkFramebuffer;
             ANGLE_TRY(srcFramebufferVk->getFramebuffer(contextVk, &srcVkFramebuffer, nullptr,
                                                        SwapchainResolveMode::Disabled));
 
@@ -1351,7 +1279,7 @@ void FramebufferVk::updateColorResolveAttachment(
     vk::ImageOrBufferViewSubresourceSerial resolveImageViewSerial)
 {
     mCurrentFramebufferDesc.updateColorResolve(colorIndexGL, resolveImageViewSerial);
-    mFramebuffer = nullptr;
+    mCurrentFramebuffer.reset();
     mRenderPassDesc.packColorResolveAttachment(colorIndexGL);
 }
 
@@ -1359,7 +1287,7 @@ void FramebufferVk::removeColorResolveAttachment(uint32_t colorIndexGL)
 {
     mCurrentFramebufferDesc.updateColorResolve(colorIndexGL,
                                                vk::kInvalidImageOrBufferViewSubresourceSerial);
-    mFramebuffer = nullptr;
+    mCurrentFramebuffer.reset();
     mRenderPassDesc.removeColorResolveAttachment(colorIndexGL);
 }
 
@@ -1433,7 +1361,7 @@ angle::Result FramebufferVk::resolveColorWithSubpass(ContextVk *contextVk,
     RenderTargetVk *drawRenderTarget      = mRenderTargetCache.getColors()[drawColorIndexGL];
     const vk::ImageView *resolveImageView = nullptr;
     ANGLE_TRY(drawRenderTarget->getImageView(contextVk, &resolveImageView));
-    vk::Framebuffer *newSrcFramebuffer = nullptr;
+    vk::MaybeImagelessFramebuffer newSrcFramebuffer;
     ANGLE_TRY(srcFramebufferVk->getFramebuffer(contextVk, &newSrcFramebuffer, resolveImageView,
                                                SwapchainResolveMode::Disabled));
     // 2. Update the RenderPassCommandBufferHelper with the new framebuffer and render pass
@@ -1638,7 +1566,7 @@ angle::Result FramebufferVk::invalidateImpl(ContextVk *contextVk,
     //- Bind FBO 2, draw
     //- Bind FBO 1, invalidate D/S
     // to invalidate the D/S of FBO 2 since it would be the currently active renderpass.
-    vk::Framebuffer *currentFramebuffer = nullptr;
+    vk::MaybeImagelessFramebuffer currentFramebuffer;
     ANGLE_TRY(
         getFramebuffer(contextVk, &currentFramebuffer, nullptr, SwapchainResolveMode::Disabled));
 
@@ -1889,7 +1817,8 @@ angle::Result FramebufferVk::syncState(const gl::Context *context,
                 // Invalidate the cache. If we have performance critical code hitting this path we
                 // can add related data (such as width/height) to the cache
                 mFramebufferCache.clear(contextVk);
-                mFramebuffer = nullptr;
+                mImagelessFramebufferCache.clear(contextVk);
+                mCurrentFramebuffer.reset();
                 break;
             case gl::Framebuffer::DIRTY_BIT_FRAMEBUFFER_SRGB_WRITE_CONTROL_MODE:
                 shouldUpdateSrgbWriteControlMode = true;
@@ -1987,7 +1916,7 @@ angle::Result FramebufferVk::syncState(const gl::Context *context,
     updateRenderPassDesc(contextVk);
 
     // Deactivate Framebuffer
-    mFramebuffer = nullptr;
+    mCurrentFramebuffer.reset();
 
     // Notify the ContextVk to update the pipeline desc.
     return contextVk->onFramebufferChange(this, command);
@@ -2083,22 +2012,60 @@ void FramebufferVk::updateRenderPassDesc(ContextVk *contextVk)
     mRenderPassDesc.setWriteControlMode(mCurrentFramebufferDesc.getWriteControlMode());
 }
 
+bool FramebufferVk::canUseImagelessFramebuffer(ContextVk *contextVk,
+                                               const vk::ImageView *resolveImageViewIn) const
+{
+    // The swapchain images and the resolve attachments that come from another framebuffer keep
+    // using framebuffers of image views.
+    if (!contextVk->getFeatures().supportsImagelessFramebuffer.enabled || mBackbuffer ||
+        resolveImageViewIn)
+    {
+        return false;
+    }
+
+    const auto &colorRenderTargets = mRenderTargetCache.getColors();
+    for (size_t colorIndexGL : mState.getColorAttachmentsMask())
+    {
+        const RenderTargetVk *colorRenderTarget = colorRenderTargets[colorIndexGL];
+        ASSERT(colorRenderTarget);
+
+        if (!colorRenderTarget->getImageForRenderPass().hasKnownViewFormats() ||
+            (colorRenderTarget->hasResolveAttachment() &&
+             !colorRenderTarget->getResolveImageForRenderPass().hasKnownViewFormats()))
+        {
+            return false;
+        }
+    }
+
+    const RenderTargetVk *depthStencilRenderTarget = getDepthStencilRenderTarget();
+    return depthStencilRenderTarget == nullptr ||
+           (depthStencilRenderTarget->getImageForRenderPass().hasKnownViewFormats() &&
+            (!depthStencilRenderTarget->hasResolveAttachment() ||
+             depthStencilRenderTarget->getResolveImageForRenderPass().hasKnownViewFormats()));
+}
+
 angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
-                                            vk::Framebuffer **framebufferOut,
+                                            vk::MaybeImagelessFramebuffer *framebufferOut,
                                             const vk::ImageView *resolveImageViewIn,
                                             const SwapchainResolveMode swapchainResolveMode)
 {
     // First return a presently valid Framebuffer
-    if (mFramebuffer != nullptr)
+    if (mCurrentFramebuffer.valid())
     {
-        *framebufferOut = &mFramebuffer->getFramebuffer();
+        *framebufferOut = mCurrentFramebuffer;
         return angle::Result::Continue;
     }
+
+    // Imageless framebuffers are looked up by the properties of the attachments instead, once
+    // their image views are gathered.
+    const bool useImagelessFramebuffer = canUseImagelessFramebuffer(contextVk, resolveImageViewIn);
+
     // No current FB, so now check for previously cached Framebuffer
     vk::FramebufferHelper *framebufferHelper = nullptr;
-    if (mFramebufferCache.get(contextVk, mCurrentFramebufferDesc, &framebufferHelper))
+    if (!useImagelessFramebuffer &&
+        mFramebufferCache.get(contextVk, mCurrentFramebufferDesc, &framebufferHelper))
     {
-        *framebufferOut = &framebufferHelper->getFramebuffer();
+        framebufferOut->setHandle(framebufferHelper->getFramebuffer().getHandle());
         return angle::Result::Continue;
     }
 
@@ -2108,15 +2075,20 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
     // If we've a Framebuffer provided by a Surface (default FBO/backbuffer), query it.
     if (mBackbuffer)
     {
-        return mBackbuffer->getCurrentFramebuffer(
+        vk::Framebuffer *backbufferFramebuffer = nullptr;
+        ANGLE_TRY(mBackbuffer->getCurrentFramebuffer(
             contextVk,
             mRenderPassDesc.getFramebufferFetchMode() ? FramebufferFetchMode::Enabled
                                                       : FramebufferFetchMode::Disabled,
-            *compatibleRenderPass, swapchainResolveMode, framebufferOut);
+            *compatibleRenderPass, swapchainResolveMode, &backbufferFramebuffer));
+
+        framebufferOut->setHandle(backbufferFramebuffer->getHandle());
+        return angle::Result::Continue;
     }
 
     // Gather VkImageViews over all FBO attachments, also size of attached region.
-    std::vector<VkImageView> attachments;
+    vk::FramebufferAttachmentsVector<VkImageView> attachments;
+    vk::ImagelessFramebufferDesc imagelessDesc;
     gl::Extents attachmentsSize = mState.getExtents();
     ASSERT(attachmentsSize.width != 0 && attachmentsSize.height != 0);
 
@@ -2132,6 +2104,11 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
             contextVk, mCurrentFramebufferDesc.getWriteControlMode(), &imageView));
 
         attachments.push_back(imageView->getHandle());
+        if (useImagelessFramebuffer)
+        {
+            AddImagelessFramebufferAttachment(
+                *colorRenderTarget, colorRenderTarget->getImageForRenderPass(), &imagelessDesc);
+        }
     }
 
     // Depth/stencil attachment.
@@ -2142,6 +2119,12 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
         ANGLE_TRY(depthStencilRenderTarget->getImageView(contextVk, &imageView));
 
         attachments.push_back(imageView->getHandle());
+        if (useImagelessFramebuffer)
+        {
+            AddImagelessFramebufferAttachment(*depthStencilRenderTarget,
+                                              depthStencilRenderTarget->getImageForRenderPass(),
+                                              &imagelessDesc);
+        }
     }
 
     // Color resolve attachments.
@@ -2167,6 +2150,12 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
                 ANGLE_TRY(colorRenderTarget->getResolveImageView(contextVk, &resolveImageView));
 
                 attachments.push_back(resolveImageView->getHandle());
+                if (useImagelessFramebuffer)
+                {
+                    AddImagelessFramebufferAttachment(
+                        *colorRenderTarget, colorRenderTarget->getResolveImageForRenderPass(),
+                        &imagelessDesc);
+                }
             }
         }
     }
@@ -2178,6 +2167,12 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
         ANGLE_TRY(depthStencilRenderTarget->getResolveImageView(contextVk, &imageView));
 
         attachments.push_back(imageView->getHandle());
+        if (useImagelessFramebuffer)
+        {
+            AddImagelessFramebufferAttachment(
+                *depthStencilRenderTarget, depthStencilRenderTarget->getResolveImageForRenderPass(),
+                &imagelessDesc);
+        }
     }
 
     VkFramebufferCreateInfo framebufferInfo = {};
@@ -2195,17 +2190,54 @@ angle::Result FramebufferVk::getFramebuffer(ContextVk *contextVk,
         framebufferInfo.layers = std::max(mCurrentFramebufferDesc.getLayerCount(), 1u);
     }
 
-    vk::FramebufferHelper newFramebuffer;
-    ANGLE_TRY(newFramebuffer.init(contextVk, framebufferInfo));
-
     // Check that our description matches our attachments. Can catch implementation bugs.
     ASSERT(static_cast<uint32_t>(attachments.size()) == mCurrentFramebufferDesc.attachmentCount());
 
+    if (useImagelessFramebuffer)
+    {
+        imagelessDesc.update(mRenderPassDesc, framebufferInfo.width, framebufferInfo.height,
+                             framebufferInfo.layers);
+
+        if (!mImagelessFramebufferCache.get(contextVk, imagelessDesc, &framebufferHelper))
+        {
+            vk::FramebufferAttachmentArray<VkFramebufferAttachmentImageInfoKHR>
+                attachmentImageInfos;
+            imagelessDesc.getAttachmentImageInfos(&attachmentImageInfos);
+
+            VkFramebufferAttachmentsCreateInfoKHR attachmentsCreateInfo = {};
+            attachmentsCreateInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO_KHR;
+            attachmentsCreateInfo.attachmentImageInfoCount = imagelessDesc.attachmentCount();
+            attachmentsCreateInfo.pAttachmentImageInfos    = attachmentImageInfos.data();
+
+            framebufferInfo.flags        = VK_FRAMEBUFFER_CREATE_IMAGELESS_BIT_KHR;
+            framebufferInfo.pAttachments = nullptr;
+            vk::AddToPNextChain(&framebufferInfo, &attachmentsCreateInfo);
+
+            vk::FramebufferHelper newFramebuffer;
+            ANGLE_TRY(newFramebuffer.init(contextVk, framebufferInfo));
+
+            mImagelessFramebufferCache.insert(imagelessDesc, std::move(newFramebuffer));
+            bool result =
+                mImagelessFramebufferCache.get(contextVk, imagelessDesc, &framebufferHelper);
+            ASSERT(result);
+        }
+
+        // The image views are given when the render pass begins.
+        mCurrentFramebuffer.setImageless(framebufferHelper->getFramebuffer().getHandle(),
+                                         attachments);
+        *framebufferOut = mCurrentFramebuffer;
+        return angle::Result::Continue;
+    }
+
+    vk::FramebufferHelper newFramebuffer;
+    ANGLE_TRY(newFramebuffer.init(contextVk, framebufferInfo));
+
     mFramebufferCache.insert(mCurrentFramebufferDesc, std::move(newFramebuffer));
-    bool result = mFramebufferCache.get(contextVk, mCurrentFramebufferDesc, &mFramebuffer);
+    bool result = mFramebufferCache.get(contextVk, mCurrentFramebufferDesc, &framebufferHelper);
     ASSERT(result);
 
-    *framebufferOut = &mFramebuffer->getFramebuffer();
+    mCurrentFramebuffer.setHandle(framebufferHelper->getFramebuffer().getHandle());
+    *framebufferOut = mCurrentFramebuffer;
     return angle::Result::Continue;
 }
 
@@ -2461,15 +2493,95 @@ void FramebufferVk::clearWithCommand(ContextVk *contextVk, const gl::Rectangle &
 
     const uint32_t layerCount = mState.isMultiview() ? 1 : mCurrentFramebufferDesc.getLayerCount();
 
-    VkClearRect rect                                     = {};
-    rect.rect.extent.width                               = scissoredRenderArea.width;
-    rect.rect.extent.height                              = scissoredRenderArea.height;
-    rect.layerCount                                      = layerCount;
-    vk::RenderPassCommandBuffer *renderPassCommandBuffer = &renderPassCommands->getCommandBuffer();
+    VkClearRect rect        = {};
+    rect.rect.extent.width  = scissoredRenderArea.width;
+    rect.rect.extent.height = scissoredRenderArea.height;
+    rect.layerCount         = layerCount;
 
-    renderPassCommandBuffer->clearAttachments(static_cast<uint32_t>(attachments.size()),
-                                              attachments.data(), 1, &rect);
-    return;
+    renderPassCommands->queueClearAttachments(attachments, rect);
+}
+
+angle::Result FramebufferVk::clearScissoredWithCommand(
+    ContextVk *contextVk,
+    const gl::Rectangle &scissoredRenderArea,
+    gl::DrawBufferMask clearColorBuffers,
+    bool clearDepth,
+    bool clearStencil,
+    const VkClearColorValue &clearColorValue,
+    const VkClearDepthStencilValue &clearDepthStencilValue)
+{
+    // All deferred clears should be handled already.
+    ASSERT(mDeferredClears.empty());
+
+    // Start a new render pass if not already started
+    vk::MaybeImagelessFramebuffer currentFramebuffer;
+    ANGLE_TRY(getFramebuffer(contextVk, &currentFramebuffer, nullptr,
+                             SwapchainResolveMode::Disabled));
+    if (contextVk->hasStartedRenderPassWithFramebuffer(currentFramebuffer))
+    {
+        contextVk->getStartedRenderPassCommands().growRenderArea(contextVk, scissoredRenderArea);
+    }
+    else
+    {
+        ANGLE_TRY(contextVk->startRenderPass(scissoredRenderArea, nullptr, nullptr));
+    }
+
+    vk::RenderPassCommandBufferHelper *renderPassCommands =
+        &contextVk->getStartedRenderPassCommands();
+
+    gl::AttachmentVector<VkClearAttachment> attachments;
+
+    vk::PackedAttachmentIndex colorIndexVk(0);
+    for (size_t colorIndexGL : mState.getColorAttachmentsMask())
+    {
+        if (clearColorBuffers.test(colorIndexGL))
+        {
+            attachments.emplace_back(
+                VkClearAttachment{VK_IMAGE_ASPECT_COLOR_BIT, static_cast<uint32_t>(colorIndexGL),
+                                  getCorrectedColorClearValue(colorIndexGL, clearColorValue)});
+            ++contextVk->getPerfCounters().colorClearAttachments;
+
+            renderPassCommands->onColorAccess(colorIndexVk, vk::ResourceAccess::Write);
+        }
+        ++colorIndexVk;
+    }
+
+    VkImageAspectFlags dsAspectFlags = 0;
+    VkClearValue dsClearValue        = {};
+    dsClearValue.depthStencil        = clearDepthStencilValue;
+    if (clearDepth)
+    {
+        dsAspectFlags |= VK_IMAGE_ASPECT_DEPTH_BIT;
+        renderPassCommands->onDepthAccess(vk::ResourceAccess::Write);
+        ++contextVk->getPerfCounters().depthClearAttachments;
+    }
+    if (clearStencil)
+    {
+        dsAspectFlags |= VK_IMAGE_ASPECT_STENCIL_BIT;
+        renderPassCommands->onStencilAccess(vk::ResourceAccess::Write);
+        ++contextVk->getPerfCounters().stencilClearAttachments;
+    }
+
+    if (dsAspectFlags != 0)
+    {
+        attachments.emplace_back(VkClearAttachment{dsAspectFlags, 0, dsClearValue});
+        // Because we may have changed the depth stencil access mode, update read only depth mode
+        // now.
+        updateRenderPassReadOnlyDepthMode(contextVk, renderPassCommands);
+    }
+
+    ASSERT(!attachments.empty());
+
+    VkClearRect rect        = {};
+    rect.rect.offset.x      = scissoredRenderArea.x;
+    rect.rect.offset.y      = scissoredRenderArea.y;
+    rect.rect.extent.width  = scissoredRenderArea.width;
+    rect.rect.extent.height = scissoredRenderArea.height;
+    rect.layerCount         = mState.isMultiview() ? 1 : mCurrentFramebufferDesc.getLayerCount();
+
+    renderPassCommands->queueClearAttachments(attachments, rect);
+
+    return angle::Result::Continue;
 }
 
 void FramebufferVk::clearWithLoadOp(ContextVk *contextVk)
@@ -2757,24 +2869,24 @@ angle::Result FramebufferVk::startNewRenderPass(ContextVk *contextVk,
     if (unresolveChanged)
     {
         // Make sure framebuffer is recreated.
-        mFramebuffer = nullptr;
+        mCurrentFramebuffer.reset();
 
         mCurrentFramebufferDesc.updateUnresolveMask(MakeUnresolveAttachmentMask(mRenderPassDesc));
     }
 
-    vk::Framebuffer *framebuffer = nullptr;
+    vk::MaybeImagelessFramebuffer framebuffer;
     ANGLE_TRY(getFramebuffer(contextVk, &framebuffer, nullptr, SwapchainResolveMode::Disabled));
 
     // If deferred clears were used in the render pass, expand the render area to the whole
-    // framebuffer.
+    // framebuffer, or to the damage region of the window surface if any.
     gl::Rectangle renderArea = scissoredRenderArea;
     if (hasDeferredClears)
     {
-        renderArea = getRotatedCompleteRenderArea(contextVk);
+        renderArea = getRotatedDamagedRenderArea(contextVk);
     }
 
     ANGLE_TRY(contextVk->beginNewRenderPass(
-        *framebuffer, renderArea, mRenderPassDesc, renderPassAttachmentOps, colorIndexVk,
+        framebuffer, renderArea, mRenderPassDesc, renderPassAttachmentOps, colorIndexVk,
         depthStencilAttachmentIndex, packedClearValues, commandBufferOut));
 
     // Add the images to the renderpass tracking list (through onColorDraw).
@@ -2886,12 +2998,49 @@ gl::Rectangle FramebufferVk::getRotatedScissoredRenderArea(ContextVk *contextVk)
     const gl::Rectangle renderArea = getNonRotatedCompleteRenderArea();
     bool invertViewport            = contextVk->isViewportFlipEnabledForDrawFBO();
     gl::Rectangle scissoredArea    = ClipRectToScissor(contextVk->getState(), renderArea, false);
+    scissoredArea                  = clipToDamageRegion(scissoredArea);
     gl::Rectangle rotatedScissoredArea;
     RotateRectangle(contextVk->getRotationDrawFramebuffer(), invertViewport, renderArea.width,
                     renderArea.height, scissoredArea, &rotatedScissoredArea);
     return rotatedScissoredArea;
 }
 
+// Return the part of the framebuffer's render area that needs to be rendered to.  This is the
+// complete render area, except for window surfaces with an EGL_KHR_partial_update damage region,
+// where the contents outside the damage region are undefined after rendering.  It IS ROTATED and
+// IS Y-FLIPPED for the draw FBO.
+gl::Rectangle FramebufferVk::getRotatedDamagedRenderArea(ContextVk *contextVk) const
+{
+    if (mBackbuffer == nullptr || !mBackbuffer->getDamageRegion().valid())
+    {
+        return getRotatedCompleteRenderArea(contextVk);
+    }
+
+    const gl::Rectangle renderArea = getNonRotatedCompleteRenderArea();
+    bool invertViewport            = contextVk->isViewportFlipEnabledForDrawFBO();
+    gl::Rectangle rotatedDamagedArea;
+    RotateRectangle(contextVk->getRotationDrawFramebuffer(), invertViewport, renderArea.width,
+                    renderArea.height, clipToDamageRegion(renderArea), &rotatedDamagedArea);
+    return rotatedDamagedArea;
+}
+
+gl::Rectangle FramebufferVk::clipToDamageRegion(const gl::Rectangle &area) const
+{
+    if (mBackbuffer == nullptr || !mBackbuffer->getDamageRegion().valid())
+    {
+        return area;
+    }
+
+    // If the area doesn't intersect the damage region, leave it as is.  Rendering to it is
+    // undefined anyway, and this avoids empty render areas.
+    gl::Rectangle damagedArea;
+    if (!gl::ClipRectangle(area, mBackbuffer->getDamageRegion().value(), &damagedArea))
+    {
+        return area;
+    }
+    return damagedArea;
+}
+
 GLint FramebufferVk::getSamples() const
 {
     const gl::FramebufferAttachment *lastAttachment = nullptr;
@@ -2955,7 +3104,7 @@ void FramebufferVk::onSwitchProgramFramebufferFetch(ContextVk *contextVk,
     if (programUsesFramebufferFetch != mRenderPassDesc.getFramebufferFetchMode())
     {
         // Make sure framebuffer is recreated.
-        mFramebuffer = nullptr;
+        mCurrentFramebuffer.reset();
         mCurrentFramebufferDesc.updateFramebufferFetchMode(programUsesFramebufferFetch);
 
         mRenderPassDesc.setFramebufferFetchMode(programUsesFramebufferFetch);
@@ -2964,15 +3113,17 @@ void FramebufferVk::onSwitchProgramFramebufferFetch(ContextVk *contextVk,
 }
 
 // FramebufferCache implementation.
-void FramebufferCache::destroy(RendererVk *rendererVk)
+template <typename Desc>
+void FramebufferCache<Desc>::destroy(RendererVk *rendererVk)
 {
     rendererVk->accumulateCacheStats(VulkanCacheType::Framebuffer, mCacheStats);
     mPayload.clear();
 }
 
-bool FramebufferCache::get(ContextVk *contextVk,
-                           const vk::FramebufferDesc &desc,
-                           vk::FramebufferHelper **framebufferHelperOut)
+template <typename Desc>
+bool FramebufferCache<Desc>::get(ContextVk *contextVk,
+                                 const Desc &desc,
+                                 vk::FramebufferHelper **framebufferHelperOut)
 {
     auto iter = mPayload.find(desc);
     if (iter != mPayload.end())
@@ -2986,13 +3137,14 @@ bool FramebufferCache::get(ContextVk *contextVk,
     return false;
 }
 
-void FramebufferCache::insert(const vk::FramebufferDesc &desc,
-                              vk::FramebufferHelper &&framebufferHelper)
+template <typename Desc>
+void FramebufferCache<Desc>::insert(const Desc &desc, vk::FramebufferHelper &&framebufferHelper)
 {
     mPayload.emplace(desc, std::move(framebufferHelper));
 }
 
-void FramebufferCache::clear(ContextVk *contextVk)
+template <typename Desc>
+void FramebufferCache<Desc>::clear(ContextVk *contextVk)
 {
     for (auto &entry : mPayload)
     {
@@ -3001,4 +3153,7 @@ void FramebufferCache::clear(ContextVk *contextVk)
     }
     mPayload.clear();
 }
+
+template class FramebufferCache<vk::FramebufferDesc>;
+template class FramebufferCache<vk::ImagelessFramebufferDesc>;
 }  // namespace rx
@@ -26,7 +26,9 @@ class RendererVk;
 class RenderTargetVk;
 class WindowSurfaceVk;
 
-// FramebufferVk Cache
+// FramebufferVk Cache.  Framebuffers are keyed by their image views, or by the properties of
+// their attachments for imageless framebuffers.
+template <typename Desc>
 class FramebufferCache final : angle::NonCopyable
 {
   public:
@@ -35,16 +37,14 @@ class FramebufferCache final : angle::NonCopyable
 
     void destroy(RendererVk *rendererVk);
 
-    bool get(ContextVk *contextVk,
-             const vk::FramebufferDesc &desc,
-             vk::FramebufferHelper **framebufferOut);
-    void insert(const vk::FramebufferDesc &desc, vk::FramebufferHelper &&framebufferHelper);
+    bool get(ContextVk *contextVk, const Desc &desc, vk::FramebufferHelper **framebufferOut);
+    void insert(const Desc &desc, vk::FramebufferHelper &&framebufferHelper);
     void clear(ContextVk *contextVk);
 
     size_t getSize() const { return mPayload.size(); }
 
   private:
-    angle::HashMap<vk::FramebufferDesc, vk::FramebufferHelper> mPayload;
+    angle::HashMap<Desc, vk::FramebufferHelper> mPayload;
     CacheStats mCacheStats;
 };
 
@@ -134,6 +134,7 @@ class FramebufferVk : public FramebufferImpl
     gl::Rectangle getNonRotatedCompleteRenderArea() const;
     gl::Rectangle getRotatedCompleteRenderArea(ContextVk *contextVk) const;
     gl::Rectangle getRotatedScissoredRenderArea(ContextVk *contextVk) const;
+    gl::Rectangle getRotatedDamagedRenderArea(ContextVk *contextVk) const;
 
     const gl::DrawBufferMask &getEmulatedAlphaAttachmentMask() const;
     RenderTargetVk *getColorDrawRenderTarget(size_t colorIndex) const;
@@ -153,7 +154,7 @@ class FramebufferVk : public FramebufferImpl
         vk::ImageOrBufferViewSubresourceSerial resolveImageViewSerial);
 
     angle::Result getFramebuffer(ContextVk *contextVk,
-                                 vk::Framebuffer **framebufferOut,
+                                 vk::MaybeImagelessFramebuffer *framebufferOut,
                                  const vk::ImageView *resolveImageViewIn,
                                  const SwapchainResolveMode swapchainResolveMode);
 
@@ -172,13 +173,19 @@ class FramebufferVk : public FramebufferImpl
 
     void removeColorResolveAttachment(uint32_t colorIndexGL);
 
-    size_t getCacheSize() const { return mFramebufferCache.getSize(); }
+    size_t getCacheSize() const
+    {
+        return mFramebufferCache.getSize() + mImagelessFramebufferCache.getSize();
+    }
 
   private:
     FramebufferVk(RendererVk *renderer,
                   const gl::FramebufferState &state,
                   WindowSurfaceVk *backbuffer);
 
+    // Clips a non-rotated area to the damage region of the window surface, if any.
+    gl::Rectangle clipToDamageRegion(const gl::Rectangle &area) const;
+
     // The 'in' rectangles must be clipped to the scissor and FBO. The clipping is done in 'blit'.
     angle::Result blitWithCommand(ContextVk *contextVk,
                                   const gl::Rectangle &sourceArea,
@@ -224,6 +231,13 @@ class FramebufferVk : public FramebufferImpl
                                 const VkClearDepthStencilValue &clearDepthStencilValue);
     void redeferClears(ContextVk *contextVk);
     void clearWithCommand(ContextVk *contextVk, const gl::Rectangle &scissoredRenderArea);
+    angle::Result clearScissoredWithCommand(ContextVk *contextVk,
+                                            const gl::Rectangle &scissoredRenderArea,
+                                            gl::DrawBufferMask clearColorBuffers,
+                                            bool clearDepth,
+                                            bool clearStencil,
+                                            const VkClearColorValue &clearColorValue,
+                                            const VkClearDepthStencilValue &clearDepthStencilValue);
     void clearWithLoadOp(ContextVk *contextVk);
     void updateActiveColorMasks(size_t colorIndex, bool r, bool g, bool b, bool a);
     void updateRenderPassDesc(ContextVk *contextVk);
@@ -248,10 +262,13 @@ class FramebufferVk : public FramebufferImpl
 
     void updateLayerCount();
 
+    bool canUseImagelessFramebuffer(ContextVk *contextVk,
+                                    const vk::ImageView *resolveImageViewIn) const;
+
     WindowSurfaceVk *mBackbuffer;
 
     vk::RenderPassDesc mRenderPassDesc;
-    vk::FramebufferHelper *mFramebuffer;
+    vk::MaybeImagelessFramebuffer mCurrentFramebuffer;
     RenderTargetCache<RenderTargetVk> mRenderTargetCache;
 
     // This variable is used to quickly compute if we need to do a masked clear. If a color
@@ -265,7 +282,8 @@ class FramebufferVk : public FramebufferImpl
     gl::DrawBufferMask mEmulatedAlphaAttachmentMask;
 
     vk::FramebufferDesc mCurrentFramebufferDesc;
-    FramebufferCache mFramebufferCache;
+    FramebufferCache<vk::FramebufferDesc> mFramebufferCache;
+    FramebufferCache<vk::ImagelessFramebufferDesc> mImagelessFramebufferCache;
 
     vk::ClearValuesArray mDeferredClears;
 
@@ -20,6 +20,84 @@
 
 namespace rx
 {
+namespace
+{
+void ReleaseCachedImage(RendererVk *renderer, vk::ImageHelper *image)
+{
+    image->releaseImage(renderer);
+    image->releaseStagedUpdates(renderer);
+}
+}  // anonymous namespace
+
+ExternalImageCache::ExternalImageCache() = default;
+
+ExternalImageCache::~ExternalImageCache()
+{
+    ASSERT(mImages.empty());
+}
+
+void ExternalImageCache::destroy(RendererVk *renderer)
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    for (auto &keyAndImage : mImages)
+    {
+        ReleaseCachedImage(renderer, keyAndImage.second.get());
+    }
+    mImages.clear();
+}
+
+std::unique_ptr<vk::ImageHelper> ExternalImageCache::take(const Key &key)
+{
+    std::unique_ptr<vk::ImageHelper> image;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+
+        for (auto iter = mImages.begin(); iter != mImages.end(); ++iter)
+        {
+            if (iter->first == key)
+            {
+                image = std::move(iter->second);
+                mImages.erase(iter);
+                break;
+            }
+        }
+    }
+
+    if (image)
+    {
+        image->resetToExternalImport(VK_QUEUE_FAMILY_FOREIGN_EXT);
+    }
+    return image;
+}
+
+void ExternalImageCache::put(RendererVk *renderer,
+                             Key &&key,
+                             std::unique_ptr<vk::ImageHelper> &&image)
+{
+    // Updates staged through an EGL image that was destroyed before using it are dropped, like
+    // they would be with the image.
+    image->releaseStagedUpdates(renderer);
+
+    std::lock_guard<std::mutex> lock(mMutex);
+
+    // The buffer may have been imported again while its image was in use.  Keep only one.
+    for (const auto &keyAndImage : mImages)
+    {
+        if (keyAndImage.first == key)
+        {
+            ReleaseCachedImage(renderer, image.get());
+            return;
+        }
+    }
+
+    if (mImages.size() == kMaxCachedImages)
+    {
+        ReleaseCachedImage(renderer, mImages.front().second.get());
+        mImages.pop_front();
+    }
+    mImages.emplace_back(std::move(key), std::move(image));
+}
 
 ImageVk::ImageVk(const egl::ImageState &state, const gl::Context *context)
     : ImageImpl(state), mOwnsImage(false), mImage(nullptr), mContext(context)
@@ -13,6 +13,9 @@
 #include "libANGLE/renderer/ImageImpl.h"
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
 
+#include <deque>
+#include <mutex>
+
 namespace rx
 {
 
@@ -27,6 +30,40 @@ class ExternalImageSiblingVk : public ExternalImageSiblingImpl
     virtual void release(RendererVk *renderer) = 0;
 };
 
+// Keeps the images imported from external buffers after the EGL images created from them are
+// destroyed.  Applications that cycle through a ring of buffers, such as video decoders and
+// cameras, create a new EGL image every time a buffer comes back; with this cache, the VkImage and
+// its imported memory are created only once per buffer.  The key identifies the buffer and every
+// parameter of the import.  The imported memory holds a reference to the buffer, so the key cannot
+// be reused by another buffer while its image is cached.
+//
+// The cache belongs to the display, and images are imported and destroyed from contexts of any
+// share group, so it's internally synchronized.
+class ExternalImageCache final : angle::NonCopyable
+{
+  public:
+    using Key = std::vector<uint64_t>;
+
+    ExternalImageCache();
+    ~ExternalImageCache();
+
+    void destroy(RendererVk *renderer);
+
+    // Returns the image imported with |key|, in the state of a new import from
+    // VK_QUEUE_FAMILY_FOREIGN_EXT, or nullptr if there is none.  The image is removed from the
+    // cache until it's put back.
+    std::unique_ptr<vk::ImageHelper> take(const Key &key);
+    // Evicts the least recently cached image if the cache is full.
+    void put(RendererVk *renderer, Key &&key, std::unique_ptr<vk::ImageHelper> &&image);
+
+  private:
+    // Enough for the buffer rings of a few video streams.
+    static constexpr size_t kMaxCachedImages = 16;
+
+    std::mutex mMutex;
+    std::deque<std::pair<Key, std::unique_ptr<vk::ImageHelper>>> mImages;
+};
+
 class ImageVk : public ImageImpl
 {
   public:
@@ -8,6 +8,11 @@
 
 #include "libANGLE/renderer/vulkan/ProgramExecutableVk.h"
 
+#include <atomic>
+
+#include "common/angle_version_info.h"
+#include "common/spirv/angle_spirv_optimizer.h"
+#include "libANGLE/BlobCache.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
@@ -24,6 +29,50 @@ namespace rx
 {
 namespace
 {
+// Version of the graphics pipeline warm up index at the end of the program binary.  Indices with
+// a different version are ignored.
+constexpr uint32_t kGraphicsPipelineWarmUpIndexVersion = 2;
+
+// The default uniforms are only moved to push constants if they fit in the size that every device
+// supports (maxPushConstantsSize is at least 128).  Each stage's block is aligned to the largest
+// base alignment of std140 members.
+constexpr uint32_t kMaxDefaultUniformPushConstantsSize      = 128;
+constexpr uint32_t kDefaultUniformPushConstantBlockAlignment = 16;
+
+// Pipelines serials are unique across executables, so that an executable allocated at the address
+// of a deleted one is never mistaken for it.
+std::atomic<uint64_t> gNextPipelinesSerial(1);
+
+struct GraphicsPipelineWarmUpEntry
+{
+    ProgramTransformOptions transformOptions;
+    vk::GraphicsPipelineDesc desc;
+};
+
+// Without the draw framebuffer, the missing outputs are derived from the color attachments of the
+// render pass.
+gl::DrawBufferMask GetWarmUpMissingOutputsMask(ContextVk *contextVk,
+                                               const gl::ProgramExecutable &glExecutable,
+                                               const vk::GraphicsPipelineDesc &desc)
+{
+    gl::DrawBufferMask missingOutputsMask;
+    if (!contextVk->getExtensions().robustFragmentShaderOutputANGLE)
+    {
+        return missingOutputsMask;
+    }
+
+    const vk::RenderPassDesc &renderPassDesc = desc.getRenderPassDesc();
+    gl::DrawBufferMask framebufferMask;
+    for (size_t colorIndexGL = 0; colorIndexGL < renderPassDesc.colorAttachmentRange();
+         ++colorIndexGL)
+    {
+        framebufferMask.set(colorIndexGL, renderPassDesc.isColorAttachmentEnabled(colorIndexGL));
+    }
+
+    missingOutputsMask = ~glExecutable.getActiveOutputVariablesMask() & framebufferMask;
+    return missingOutputsMask;
+}
+
 void LoadShaderInterfaceVariableXfbInfo(gl::BinaryInputStream *stream,
                                         ShaderInterfaceVariableXfbInfo *xfb)
 {
@@ -60,6 +109,178 @@ void SaveShaderInterfaceVariableXfbInfo(const ShaderInterfaceVariableXfbInfo &xf
     }
 }
 
+void SaveShaderInterfaceVariableInfoMap(const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                        gl::BinaryOutputStream *stream)
+{
+    const gl::ShaderMap<ShaderInterfaceVariableInfoMap::VariableTypeToInfoMap> &data =
+        variableInfoMap.getData();
+    const gl::ShaderMap<ShaderInterfaceVariableInfoMap::NameToTypeAndIndexMap>
+        &nameToTypeAndIndexMap = variableInfoMap.getNameToTypeAndIndexMap();
+    const gl::ShaderMap<ShaderInterfaceVariableInfoMap::VariableTypeToIndexMap>
+        &indexedResourceMap = variableInfoMap.getIndexedResourceMap();
+
+    for (gl::ShaderType shaderType : gl::AllShaderTypes())
+    {
+        // Every variable has exactly one name.  The names are written along with the variables in
+        // index order, which doesn't depend on the iteration order of the hash map, so that the
+        // output is the same for identical maps (it's part of the transformed SPIR-V cache key)
+        // and the type and index don't need to be written.
+        angle::PackedEnumMap<ShaderVariableType, std::vector<const std::string *>> names;
+        for (ShaderVariableType variableType : angle::AllEnums<ShaderVariableType>())
+        {
+            names[variableType].resize(data[shaderType][variableType].size(), nullptr);
+        }
+        for (const auto &iter : nameToTypeAndIndexMap[shaderType])
+        {
+            const TypeAndIndex &typeAndIndex                     = iter.second;
+            names[typeAndIndex.variableType][typeAndIndex.index] = &iter.first;
+        }
+
+        for (ShaderVariableType variableType : angle::AllEnums<ShaderVariableType>())
+        {
+            const ShaderInterfaceVariableInfoMap::VariableInfoArray &infoArray =
+                data[shaderType][variableType];
+
+            stream->writeInt(infoArray.size());
+            for (size_t infoIndex = 0; infoIndex < infoArray.size(); ++infoIndex)
+            {
+                const ShaderInterfaceVariableInfo &info = infoArray[infoIndex];
+
+                ASSERT(names[variableType][infoIndex] != nullptr);
+                stream->writeString(*names[variableType][infoIndex]);
+                stream->writeInt(info.descriptorSet);
+                stream->writeInt(info.binding);
+                stream->writeInt(info.pushConstantOffset);
+                stream->writeInt(info.location);
+                stream->writeInt(info.component);
+                stream->writeInt(info.index);
+                // PackedEnumBitSet uses uint8_t
+                stream->writeInt(info.activeStages.bits());
+                SaveShaderInterfaceVariableXfbInfo(info.xfb, stream);
+                stream->writeInt(info.fieldXfb.size());
+                for (const ShaderInterfaceVariableXfbInfo &xfb : info.fieldXfb)
+                {
+                    SaveShaderInterfaceVariableXfbInfo(xfb, stream);
+                }
+                stream->writeBool(info.useRelaxedPrecision);
+                stream->writeBool(info.varyingIsInput);
+                stream->writeBool(info.varyingIsOutput);
+                stream->writeInt(info.attributeComponentCount);
+                stream->writeInt(info.attributeLocationCount);
+                stream->writeBool(info.isDuplicate);
+            }
+
+            const ShaderInterfaceVariableInfoMap::ResourceIndexMap &resourceIndexMap =
+                indexedResourceMap[shaderType][variableType];
+            stream->writeInt(static_cast<uint32_t>(resourceIndexMap.size()));
+            for (uint32_t resourceIndex = 0; resourceIndex < resourceIndexMap.size();
+                 ++resourceIndex)
+            {
+                stream->writeInt(resourceIndexMap[resourceIndex]);
+            }
+        }
+    }
+}
+
+void ComputeTransformedSpirvKey(const GlslangSpirvOptions &options,
+                                const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                bool optimize,
+                                const angle::spirv::Blob &originalSpirvBlob,
+                                egl::BlobCache::Key *hashOut)
+{
+    // The transformation is a function of the options, the variable info map and the input
+    // SPIR-V only.  The commit hash is included as the transformation itself may change between
+    // builds that share the application's cache.
+    gl::BinaryOutputStream keyStream;
+    keyStream.writeString("ANGLE Transformed SPIR-V: ");
+    keyStream.writeBytes(reinterpret_cast<const unsigned char *>(angle::GetANGLECommitHash()),
+                         angle::GetANGLECommitHashSize());
+    keyStream.writeEnum(options.shaderType);
+    keyStream.writeBool(options.negativeViewportSupported);
+    keyStream.writeBool(options.transformPositionToVulkanClipSpace);
+    keyStream.writeBool(options.removeDebugInfo);
+    keyStream.writeBool(options.isLastPreFragmentStage);
+    keyStream.writeBool(options.isTransformFeedbackStage);
+    keyStream.writeBool(options.isTransformFeedbackEmulated);
+    keyStream.writeBool(optimize);
+    SaveShaderInterfaceVariableInfoMap(variableInfoMap, &keyStream);
+    keyStream.writeInt(originalSpirvBlob.size());
+    keyStream.writeBytes(reinterpret_cast<const unsigned char *>(originalSpirvBlob.data()),
+                         originalSpirvBlob.size() * sizeof(uint32_t));
+
+    angle::base::SHA1HashBytes(static_cast<const unsigned char *>(keyStream.data()),
+                               keyStream.length(), hashOut->data());
+}
+
+angle::Result TransformAndOptimizeSpirV(const GlslangSpirvOptions &options,
+                                        const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                                        bool optimize,
+                                        const angle::spirv::Blob &originalSpirvBlob,
+                                        angle::spirv::Blob *transformedSpirvBlobOut)
+{
+    ANGLE_TRY(GlslangWrapperVk::TransformSpirV(options, variableInfoMap, originalSpirvBlob,
+                                               transformedSpirvBlobOut));
+
+    if (optimize)
+    {
+        // The unoptimized SPIR-V is used if the optimizer fails, which is not expected.
+        angle::spirv::Blob optimizedSpirvBlob;
+        if (angle::spirv::Optimize(*transformedSpirvBlobOut, &optimizedSpirvBlob))
+        {
+            *transformedSpirvBlobOut = std::move(optimizedSpirvBlob);
+        }
+    }
+
+    return angle::Result::Continue;
+}
+
+angle::Result TransformSpirV(vk::Context *context,
+                             const GlslangSpirvOptions &options,
+                             const ShaderInterfaceVariableInfoMap &variableInfoMap,
+                             const angle::spirv::Blob &originalSpirvBlob,
+                             angle::spirv::Blob *transformedSpirvBlobOut)
+{
+    RendererVk *renderer = context->getRenderer();
+    const bool optimize  = renderer->getFeatures().optimizeSpirv.enabled;
+    if (!renderer->getFeatures().cacheTransformedSpirv.enabled)
+    {
+        return TransformAndOptimizeSpirV(options, variableInfoMap, optimize, originalSpirvBlob,
+                                         transformedSpirvBlobOut);
+    }
+
+    DisplayVk *displayVk      = vk::GetImpl(renderer->getDisplay());
+    egl::BlobCache *blobCache = displayVk->getBlobCache();
+
+    egl::BlobCache::Key transformedSpirvKey;
+    ComputeTransformedSpirvKey(options, variableInfoMap, optimize, originalSpirvBlob,
+                               &transformedSpirvKey);
+
+    // This may run on a link worker thread, so the display's scratch buffer can't be used.
+    angle::ScratchBuffer scratchBuffer;
+    egl::BlobCache::Value cachedSpirv;
+    size_t cachedSpirvSize = 0;
+    if (blobCache->get(&scratchBuffer, transformedSpirvKey, &cachedSpirv, &cachedSpirvSize) &&
+        cachedSpirvSize > 0 && cachedSpirvSize % sizeof(uint32_t) == 0)
+    {
+        transformedSpirvBlobOut->resize(cachedSpirvSize / sizeof(uint32_t));
+        memcpy(transformedSpirvBlobOut->data(), cachedSpirv.data(), cachedSpirvSize);
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(TransformAndOptimizeSpirV(options, variableInfoMap, optimize, originalSpirvBlob,
+                                        transformedSpirvBlobOut));
+
+    const size_t transformedSpirvSize = transformedSpirvBlobOut->size() * sizeof(uint32_t);
+    angle::MemoryBuffer transformedSpirv;
+    if (transformedSpirv.resize(transformedSpirvSize))
+    {
+        memcpy(transformedSpirv.data(), transformedSpirvBlobOut->data(), transformedSpirvSize);
+        blobCache->put(transformedSpirvKey, std::move(transformedSpirv));
+    }
+
+    return angle::Result::Continue;
+}
+
 bool ValidateTransformedSpirV(const gl::ShaderBitSet &linkedShaderStages,
                               const ShaderInterfaceVariableInfoMap &variableInfoMap,
                               const gl::ShaderMap<angle::spirv::Blob> &spirvBlobs)
@@ -176,6 +397,23 @@ angle::Result ProgramInfo::initProgram(ContextVk *contextVk,
                                        ProgramTransformOptions optionBits,
                                        const ShaderInterfaceVariableInfoMap &variableInfoMap)
 {
+    ANGLE_TRY(initShader(contextVk, shaderType, isLastPreFragmentStage, isTransformFeedbackProgram,
+                         shaderInfo, optionBits, variableInfoMap));
+    setShader(shaderType);
+
+    return angle::Result::Continue;
+}
+
+angle::Result ProgramInfo::initShader(vk::Context *context,
+                                      gl::ShaderType shaderType,
+                                      bool isLastPreFragmentStage,
+                                      bool isTransformFeedbackProgram,
+                                      const ShaderInfo &shaderInfo,
+                                      ProgramTransformOptions optionBits,
+                                      const ShaderInterfaceVariableInfoMap &variableInfoMap)
+{
+    const angle::FeaturesVk &features = context->getRenderer()->getFeatures();
+
     const gl::ShaderMap<angle::spirv::Blob> &originalSpirvBlobs = shaderInfo.getSpirvBlobs();
     const angle::spirv::Blob &originalSpirvBlob                 = originalSpirvBlobs[shaderType];
     gl::ShaderMap<angle::spirv::Blob> transformedSpirvBlobs;
@@ -183,36 +421,33 @@ angle::Result ProgramInfo::initProgram(ContextVk *contextVk,
 
     GlslangSpirvOptions options;
     options.shaderType               = shaderType;
-    options.removeDebugInfo          = !contextVk->getFeatures().retainSPIRVDebugInfo.enabled;
+    options.removeDebugInfo          = !features.retainSPIRVDebugInfo.enabled;
     options.isLastPreFragmentStage   = isLastPreFragmentStage;
     options.isTransformFeedbackStage = isLastPreFragmentStage && isTransformFeedbackProgram &&
                                        !optionBits.removeTransformFeedbackEmulation;
-    options.isTransformFeedbackEmulated = contextVk->getFeatures().emulateTransformFeedback.enabled;
-    options.negativeViewportSupported   = contextVk->getFeatures().supportsNegativeViewport.enabled;
+    options.isTransformFeedbackEmulated = features.emulateTransformFeedback.enabled;
+    options.negativeViewportSupported   = features.supportsNegativeViewport.enabled;
 
     if (isLastPreFragmentStage)
     {
         options.transformPositionToVulkanClipSpace =
-            optionBits.enableDepthCorrection &&
-            !contextVk->getFeatures().supportsDepthClipControl.enabled;
+            optionBits.enableDepthCorrection && !features.supportsDepthClipControl.enabled;
     }
 
-    ANGLE_TRY(GlslangWrapperVk::TransformSpirV(options, variableInfoMap, originalSpirvBlob,
-                                               &transformedSpirvBlob));
-    ANGLE_TRY(vk::InitShaderAndSerial(contextVk, &mShaders[shaderType].get(),
+    ANGLE_TRY(TransformSpirV(context, options, variableInfoMap, originalSpirvBlob,
+                             &transformedSpirvBlob));
+    ANGLE_TRY(vk::InitShaderAndSerial(context, &mShaders[shaderType].get(),
                                       transformedSpirvBlob.data(),
                                       transformedSpirvBlob.size() * sizeof(uint32_t)));
 
-    mProgramHelper.setShader(shaderType, &mShaders[shaderType]);
-
-    mProgramHelper.setSpecializationConstant(sh::vk::SpecializationConstantId::LineRasterEmulation,
-                                             optionBits.enableLineRasterEmulation);
-    mProgramHelper.setSpecializationConstant(sh::vk::SpecializationConstantId::SurfaceRotation,
-                                             optionBits.surfaceRotation);
-
     return angle::Result::Continue;
 }
 
+void ProgramInfo::setShader(gl::ShaderType shaderType)
+{
+    mProgramHelper.setShader(shaderType, &mShaders[shaderType]);
+}
+
 void ProgramInfo::release(ContextVk *contextVk)
 {
     mProgramHelper.release(contextVk);
@@ -224,8 +459,10 @@ void ProgramInfo::release(ContextVk *contextVk)
 }
 
 ProgramExecutableVk::ProgramExecutableVk()
-    : mEmptyDescriptorSets{},
+    : mPipelinesSerial(gNextPipelinesSerial++),
+      mEmptyDescriptorSets{},
       mNumDefaultUniformDescriptors(0),
+      mPushConstantsSize(0),
       mImmutableSamplersMaxDescriptorCount(1),
       mUniformBufferDescriptorType(VK_DESCRIPTOR_TYPE_MAX_ENUM),
       mDynamicUniformDescriptorOffsets{}
@@ -239,6 +476,12 @@ ProgramExecutableVk::ProgramExecutableVk()
 ProgramExecutableVk::~ProgramExecutableVk() {}
 
 void ProgramExecutableVk::reset(ContextVk *contextVk)
+{
+    resetLayout();
+    releasePrograms(contextVk);
+}
+
+void ProgramExecutableVk::resetLayout()
 {
     for (auto &descriptorSetLayout : mDescriptorSetLayouts)
     {
@@ -251,6 +494,8 @@ void ProgramExecutableVk::reset(ContextVk *contextVk)
     mDescriptorSets.fill(VK_NULL_HANDLE);
     mEmptyDescriptorSets.fill(VK_NULL_HANDLE);
     mNumDefaultUniformDescriptors = 0;
+    mPushConstantsStages.reset();
+    mPushConstantsSize = 0;
     mTransformOptions             = {};
 
     for (vk::RefCountedDescriptorPoolBinding &binding : mDescriptorPoolBindings)
@@ -265,12 +510,16 @@ void ProgramExecutableVk::reset(ContextVk *contextVk)
 
     // Initialize with an invalid BufferSerial
     mCurrentDefaultUniformBufferSerial = vk::BufferSerial();
+}
 
+void ProgramExecutableVk::releasePrograms(ContextVk *contextVk)
+{
     for (ProgramInfo &programInfo : mGraphicsProgramInfos)
     {
         programInfo.release(contextVk);
     }
     mComputeProgramInfo.release(contextVk);
+    mPipelinesSerial = gNextPipelinesSerial++;
 
     contextVk->onProgramExecutableReset(this);
 }
@@ -285,27 +534,26 @@ std::unique_ptr<rx::LinkEvent> ProgramExecutableVk::load(ContextVk *contextVk,
 
     for (gl::ShaderType shaderType : gl::AllShaderTypes())
     {
-        size_t nameCount = stream->readInt<size_t>();
-        for (size_t nameIndex = 0; nameIndex < nameCount; ++nameIndex)
-        {
-            const std::string variableName  = stream->readString();
-            ShaderVariableType variableType = stream->readEnum<ShaderVariableType>();
-            uint32_t index                  = stream->readInt<uint32_t>();
-            nameToTypeAndIndexMap[shaderType][variableName] = {variableType, index};
-        }
-
         for (ShaderVariableType variableType : angle::AllEnums<ShaderVariableType>())
         {
-            size_t infoArraySize = stream->readInt<size_t>();
-            for (size_t infoIndex = 0; infoIndex < infoArraySize; ++infoIndex)
-            {
-                ShaderInterfaceVariableInfo info;
+            ShaderInterfaceVariableInfoMap::VariableInfoArray &infoArray =
+                data[shaderType][variableType];
 
-                info.descriptorSet = stream->readInt<uint32_t>();
-                info.binding       = stream->readInt<uint32_t>();
-                info.location      = stream->readInt<uint32_t>();
-                info.component     = stream->readInt<uint32_t>();
-                info.index         = stream->readInt<uint32_t>();
+            // Read the variables in place, which avoids copying their transform feedback info.
+            infoArray.resize(stream->readInt<size_t>());
+            for (size_t infoIndex = 0; infoIndex < infoArray.size(); ++infoIndex)
+            {
+                ShaderInterfaceVariableInfo &info = infoArray[infoIndex];
+
+                nameToTypeAndIndexMap[shaderType].emplace(
+                    stream->readString(),
+                    TypeAndIndex{variableType, static_cast<uint32_t>(infoIndex)});
+                info.descriptorSet      = stream->readInt<uint32_t>();
+                info.binding            = stream->readInt<uint32_t>();
+                info.pushConstantOffset = stream->readInt<uint32_t>();
+                info.location           = stream->readInt<uint32_t>();
+                info.component          = stream->readInt<uint32_t>();
+                info.index              = stream->readInt<uint32_t>();
                 // PackedEnumBitSet uses uint8_t
                 info.activeStages = gl::ShaderBitSet(stream->readInt<uint8_t>());
                 LoadShaderInterfaceVariableXfbInfo(stream, &info.xfb);
@@ -320,20 +568,20 @@ std::unique_ptr<rx::LinkEvent> ProgramExecutableVk::load(ContextVk *contextVk,
                 info.attributeComponentCount = stream->readInt<uint8_t>();
                 info.attributeLocationCount  = stream->readInt<uint8_t>();
                 info.isDuplicate             = stream->readBool();
-
-                data[shaderType][variableType].push_back(info);
             }
 
-            uint32_t resourceMapSize = stream->readInt<uint32_t>();
-            for (uint32_t resourceIndex = 0; resourceIndex < resourceMapSize; ++resourceIndex)
+            ShaderInterfaceVariableInfoMap::ResourceIndexMap &resourceIndexMap =
+                indexedResourceMap[shaderType][variableType];
+            resourceIndexMap.resize(stream->readInt<uint32_t>());
+            for (uint32_t &variableIndex : resourceIndexMap)
             {
-                uint32_t variableIndex = stream->readInt<uint32_t>();
-                indexedResourceMap[shaderType][variableType][resourceIndex] = variableIndex;
+                variableIndex = stream->readInt<uint32_t>();
             }
         }
     }
 
-    mVariableInfoMap.load(data, nameToTypeAndIndexMap, indexedResourceMap);
+    mVariableInfoMap.load(std::move(data), std::move(nameToTypeAndIndexMap),
+                          std::move(indexedResourceMap));
 
     mOriginalShaderInfo.load(stream);
 
@@ -365,70 +613,71 @@ std::unique_ptr<rx::LinkEvent> ProgramExecutableVk::load(ContextVk *contextVk,
     }
 
     status = createPipelineLayout(contextVk, glExecutable, nullptr);
+    if (status != angle::Result::Continue)
+    {
+        return std::make_unique<LinkEventDone>(status);
+    }
+
+    status = loadGraphicsPipelineWarmUpIndex(contextVk, glExecutable, stream);
     return std::make_unique<LinkEventDone>(status);
 }
 
-void ProgramExecutableVk::save(gl::BinaryOutputStream *stream)
+angle::Result ProgramExecutableVk::loadGraphicsPipelineWarmUpIndex(
+    ContextVk *contextVk,
+    const gl::ProgramExecutable &glExecutable,
+    gl::BinaryInputStream *stream)
 {
-    const gl::ShaderMap<ShaderInterfaceVariableInfoMap::VariableTypeToInfoMap> &data =
-        mVariableInfoMap.getData();
-    const gl::ShaderMap<ShaderInterfaceVariableInfoMap::NameToTypeAndIndexMap>
-        &nameToTypeAndIndexMap = mVariableInfoMap.getNameToTypeAndIndexMap();
-    const gl::ShaderMap<ShaderInterfaceVariableInfoMap::VariableTypeToIndexMap>
-        &indexedResourceMap = mVariableInfoMap.getIndexedResourceMap();
+    const uint32_t version   = stream->readInt<uint32_t>();
+    const uint32_t descSize  = stream->readInt<uint32_t>();
+    const uint32_t descCount = stream->readInt<uint32_t>();
 
-    for (gl::ShaderType shaderType : gl::AllShaderTypes())
+    if (version != kGraphicsPipelineWarmUpIndexVersion || descSize != vk::kGraphicsPipelineDescSize)
     {
-        stream->writeInt(nameToTypeAndIndexMap[shaderType].size());
-        for (const auto &iter : nameToTypeAndIndexMap[shaderType])
-        {
-            const std::string &name          = iter.first;
-            const TypeAndIndex &typeAndIndex = iter.second;
-            stream->writeString(name);
-            stream->writeEnum(typeAndIndex.variableType);
-            stream->writeInt(typeAndIndex.index);
-        }
+        stream->skip(static_cast<size_t>(descCount) * (sizeof(uint8_t) + descSize));
+        return angle::Result::Continue;
+    }
 
-        for (ShaderVariableType variableType : angle::AllEnums<ShaderVariableType>())
-        {
-            const ShaderInterfaceVariableInfoMap::VariableInfoArray &infoArray =
-                data[shaderType][variableType];
+    std::vector<GraphicsPipelineWarmUpEntry> entries;
+    for (uint32_t descIndex = 0; descIndex < descCount && !stream->error(); ++descIndex)
+    {
+        GraphicsPipelineWarmUpEntry entry;
+        entry.transformOptions =
+            gl::bitCast<ProgramTransformOptions, uint8_t>(stream->readInt<uint8_t>());
+        stream->readBytes(reinterpret_cast<unsigned char *>(&entry.desc), descSize);
+        entries.push_back(entry);
+    }
 
-            stream->writeInt(infoArray.size());
-            for (const ShaderInterfaceVariableInfo &info : infoArray)
-            {
-                stream->writeInt(info.descriptorSet);
-                stream->writeInt(info.binding);
-                stream->writeInt(info.location);
-                stream->writeInt(info.component);
-                stream->writeInt(info.index);
-                // PackedEnumBitSet uses uint8_t
-                stream->writeInt(info.activeStages.bits());
-                SaveShaderInterfaceVariableXfbInfo(info.xfb, stream);
-                stream->writeInt(info.fieldXfb.size());
-                for (const ShaderInterfaceVariableXfbInfo &xfb : info.fieldXfb)
-                {
-                    SaveShaderInterfaceVariableXfbInfo(xfb, stream);
-                }
-                stream->writeBool(info.useRelaxedPrecision);
-                stream->writeBool(info.varyingIsInput);
-                stream->writeBool(info.varyingIsOutput);
-                stream->writeInt(info.attributeComponentCount);
-                stream->writeInt(info.attributeLocationCount);
-                stream->writeBool(info.isDuplicate);
-            }
+    if (stream->error() || entries.empty() ||
+        !contextVk->getFeatures().warmUpGraphicsPipelinesOnProgramLoad.enabled)
+    {
+        return angle::Result::Continue;
+    }
 
-            const ShaderInterfaceVariableInfoMap::ResourceIndexMap &resourceIndexMap =
-                indexedResourceMap[shaderType][variableType];
-            stream->writeInt(static_cast<uint32_t>(resourceIndexMap.size()));
-            for (uint32_t resourceIndex = 0; resourceIndex < resourceIndexMap.size();
-                 ++resourceIndex)
-            {
-                stream->writeInt(resourceIndexMap[resourceIndex]);
-            }
-        }
+    ANGLE_TRACE_EVENT0("gpu.angle", "ProgramExecutableVk::loadGraphicsPipelineWarmUpIndex");
+
+    PipelineCacheAccess pipelineCache;
+    ANGLE_TRY(contextVk->getRenderer()->getPipelineCache(&pipelineCache));
+
+    // With asyncGraphicsPipelineCreation, the pipelines are created on the worker threads, and
+    // draw calls only wait for them if they are not ready by then.
+    for (const GraphicsPipelineWarmUpEntry &entry : entries)
+    {
+        const vk::GraphicsPipelineDesc *descPtr = nullptr;
+        vk::PipelineHelper *pipeline            = nullptr;
+
+        mTransformOptions = entry.transformOptions;
+        ANGLE_TRY(getGraphicsPipelineImpl(
+            contextVk, &pipelineCache, PipelineSource::WarmUp, entry.desc, glExecutable,
+            GetWarmUpMissingOutputsMask(contextVk, glExecutable, entry.desc), &descPtr, &pipeline));
     }
 
+    return angle::Result::Continue;
+}
+
+void ProgramExecutableVk::save(ContextVk *contextVk, gl::BinaryOutputStream *stream)
+{
+    SaveShaderInterfaceVariableInfoMap(mVariableInfoMap, stream);
+
     mOriginalShaderInfo.save(stream);
 
     // Serializes the uniformLayout data of mDefaultUniformBlocks
@@ -449,6 +698,45 @@ void ProgramExecutableVk::save(gl::BinaryOutputStream *stream)
     {
         stream->writeInt(mDefaultUniformBlocks[shaderType]->uniformData.size());
     }
+
+    saveGraphicsPipelineWarmUpIndex(contextVk, stream);
+}
+
+void ProgramExecutableVk::saveGraphicsPipelineWarmUpIndex(ContextVk *contextVk,
+                                                          gl::BinaryOutputStream *stream)
+{
+    const bool saveDescs = contextVk->getFeatures().warmUpGraphicsPipelinesOnProgramLoad.enabled;
+
+    uint32_t descCount = 0;
+    if (saveDescs)
+    {
+        for (ProgramInfo &programInfo : mGraphicsProgramInfos)
+        {
+            programInfo.getShaderProgram()->getGraphicsPipelineCache().forEachPipelineDesc(
+                [&descCount](const vk::GraphicsPipelineDesc &) { ++descCount; });
+        }
+    }
+
+    stream->writeInt(kGraphicsPipelineWarmUpIndexVersion);
+    stream->writeInt(static_cast<uint32_t>(vk::kGraphicsPipelineDescSize));
+    stream->writeInt(descCount);
+
+    if (descCount == 0)
+    {
+        return;
+    }
+
+    for (uint8_t optionBits = 0; optionBits < ProgramTransformOptions::kPermutationCount;
+         ++optionBits)
+    {
+        mGraphicsProgramInfos[optionBits]
+            .getShaderProgram()
+            ->getGraphicsPipelineCache()
+            .forEachPipelineDesc([stream, optionBits](const vk::GraphicsPipelineDesc &desc) {
+                stream->writeInt(optionBits);
+                stream->writeBytes(desc.getPtr<unsigned char>(), vk::kGraphicsPipelineDescSize);
+            });
+    }
 }
 
 void ProgramExecutableVk::clearVariableInfoMap()
@@ -694,7 +982,7 @@ angle::Result ProgramExecutableVk::addTextureDescriptorSetDesc(
                 descOut->update(info.binding, VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, arraySize,
                                 activeStages, &immutableSampler);
                 const vk::ImageHelper &image                              = textureVk->getImage();
-                mImmutableSamplerIndexMap[image.getYcbcrConversionDesc()] = textureIndex;
+                mImmutableSamplerIndexMap[image.getYcbcrConversionDesc()] = textureUnit;
                 // The Vulkan spec has the following note -
                 // All descriptors in a binding use the same maximum
                 // combinedImageSamplerDescriptorCount descriptors to allow implementations to use a
@@ -736,7 +1024,6 @@ angle::Result ProgramExecutableVk::addTextureDescriptorSetDesc(
 }
 
 angle::Result ProgramExecutableVk::getGraphicsPipeline(ContextVk *contextVk,
-                                                       gl::PrimitiveMode mode,
                                                        PipelineCacheAccess *pipelineCache,
                                                        PipelineSource source,
                                                        const vk::GraphicsPipelineDesc &desc,
@@ -748,13 +1035,35 @@ angle::Result ProgramExecutableVk::getGraphicsPipeline(ContextVk *contextVk,
 
     ASSERT(glExecutable.hasLinkedShaderStage(gl::ShaderType::Vertex));
 
-    mTransformOptions.enableLineRasterEmulation = contextVk->isBresenhamEmulationEnabled(mode);
-    mTransformOptions.surfaceRotation           = desc.getSurfaceRotation();
-    mTransformOptions.enableDepthCorrection     = !glState.isClipControlDepthZeroToOne();
+    mTransformOptions.enableDepthCorrection = !glState.isClipControlDepthZeroToOne();
     mTransformOptions.removeTransformFeedbackEmulation =
         contextVk->getFeatures().emulateTransformFeedback.enabled &&
         !glState.isTransformFeedbackActiveUnpaused();
 
+    // Calculate missing shader outputs.  Writes to these are masked off with
+    // GL_ANGLE_robust_fragment_shader_output.
+    gl::DrawBufferMask missingOutputsMask;
+    if (contextVk->getExtensions().robustFragmentShaderOutputANGLE)
+    {
+        const gl::DrawBufferMask &shaderOutMask = glExecutable.getActiveOutputVariablesMask();
+        gl::DrawBufferMask framebufferMask = glState.getDrawFramebuffer()->getDrawBufferMask();
+        missingOutputsMask                 = ~shaderOutMask & framebufferMask;
+    }
+
+    return getGraphicsPipelineImpl(contextVk, pipelineCache, source, desc, glExecutable,
+                                   missingOutputsMask, descPtrOut, pipelineOut);
+}
+
+angle::Result ProgramExecutableVk::getGraphicsPipelineImpl(
+    ContextVk *contextVk,
+    PipelineCacheAccess *pipelineCache,
+    PipelineSource source,
+    const vk::GraphicsPipelineDesc &desc,
+    const gl::ProgramExecutable &glExecutable,
+    const gl::DrawBufferMask &missingOutputsMask,
+    const vk::GraphicsPipelineDesc **descPtrOut,
+    vk::PipelineHelper **pipelineOut)
+{
     // This must be called after mTransformOptions have been set.
     ProgramInfo &programInfo                  = getGraphicsProgramInfo();
     const gl::ShaderBitSet linkedShaderStages = glExecutable.getLinkedShaderStages();
@@ -773,10 +1082,15 @@ angle::Result ProgramExecutableVk::getGraphicsPipeline(ContextVk *contextVk,
     vk::ShaderProgramHelper *shaderProgram = programInfo.getShaderProgram();
     ASSERT(shaderProgram);
 
-    // Dither is part of specialization constant, but does not have its own dedicated
-    // programInfo entry. We pick the programInfo entry based on the mTransformOptions and then
-    // update the dither specialization constant. It will go through desc matching and if
-    // spec constant does not match, it will recompile pipeline program.
+    // The specialization constants don't have their own programInfo entries.  They are all
+    // derived from the pipeline description, so the pipeline cache of the programInfo entry
+    // (which is keyed by the description) never mixes pipelines created with different values.
+    const bool enableLineRasterEmulation =
+        contextVk->getFeatures().basicGLLineRasterization.enabled && desc.hasLineTopology();
+    shaderProgram->setSpecializationConstant(sh::vk::SpecializationConstantId::LineRasterEmulation,
+                                             enableLineRasterEmulation);
+    shaderProgram->setSpecializationConstant(sh::vk::SpecializationConstantId::SurfaceRotation,
+                                             desc.getSurfaceRotation());
     shaderProgram->setSpecializationConstant(sh::vk::SpecializationConstantId::Dither,
                                              desc.getEmulatedDitherControl());
 
@@ -784,11 +1098,6 @@ angle::Result ProgramExecutableVk::getGraphicsPipeline(ContextVk *contextVk,
     const gl::AttributesMask &activeAttribLocations =
         glExecutable.getNonBuiltinAttribLocationsMask();
 
-    // Calculate missing shader outputs.
-    const gl::DrawBufferMask &shaderOutMask = glExecutable.getActiveOutputVariablesMask();
-    gl::DrawBufferMask framebufferMask      = glState.getDrawFramebuffer()->getDrawBufferMask();
-    gl::DrawBufferMask missingOutputsMask   = ~shaderOutMask & framebufferMask;
-
     return shaderProgram->getGraphicsPipeline(
         contextVk, &contextVk->getRenderPassCache(), pipelineCache, getPipelineLayout(), source,
         desc, activeAttribLocations, glExecutable.getAttributesTypeMask(), missingOutputsMask,
@@ -819,7 +1128,12 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
     gl::TransformFeedback *transformFeedback = contextVk->getState().getCurrentTransformFeedback();
     const gl::ShaderBitSet &linkedShaderStages = glExecutable.getLinkedShaderStages();
 
-    reset(contextVk);
+    // The pipelines only depend on the pipeline layout, so they are kept if the layout is recreated
+    // identically, for example when an external image is replaced by one that uses the same Ycbcr
+    // conversion.
+    const VkPipelineLayout previousPipelineLayout =
+        mPipelineLayout.valid() ? mPipelineLayout.get().getHandle() : VK_NULL_HANDLE;
+    resetLayout();
 
     // Store a reference to the pipeline and descriptor set layouts. This will create them if they
     // don't already exist in the cache.
@@ -836,6 +1150,16 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
             continue;
         }
 
+        // Default uniforms in push constants don't need a descriptor.
+        if (info.pushConstantOffset != ShaderInterfaceVariableInfo::kInvalid)
+        {
+            const uint32_t blockSize = static_cast<uint32_t>(
+                mDefaultUniformBlocks[shaderType]->uniformData.size());
+            mPushConstantsStages.set(shaderType);
+            mPushConstantsSize = std::max(mPushConstantsSize, info.pushConstantOffset + blockSize);
+            continue;
+        }
+
         uniformsAndXfbSetDesc.update(info.binding, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1,
                                      gl_vk::kShaderStageMap[shaderType], nullptr);
         mNumDefaultUniformDescriptors++;
@@ -937,10 +1261,20 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
     pipelineLayoutDesc.updateDescriptorSetLayout(DescriptorSetIndex::Texture, texturesSetDesc);
     pipelineLayoutDesc.updateDescriptorSetLayout(DescriptorSetIndex::Internal,
                                                  driverUniformsSetDesc);
+    if (usesDefaultUniformPushConstants())
+    {
+        pipelineLayoutDesc.updatePushConstantRange(
+            gl_vk::GetShaderStageFlags(mPushConstantsStages), 0, mPushConstantsSize);
+    }
 
     ANGLE_TRY(contextVk->getPipelineLayoutCache().getPipelineLayout(
         contextVk, pipelineLayoutDesc, mDescriptorSetLayouts, &mPipelineLayout));
 
+    if (mPipelineLayout.get().getHandle() != previousPipelineLayout)
+    {
+        releasePrograms(contextVk);
+    }
+
     // Initialize descriptor pools.
     ANGLE_TRY(contextVk->bindCachedDescriptorPool(
         DescriptorSetIndex::UniformsAndXfb, uniformsAndXfbSetDesc, 1,
@@ -953,7 +1287,8 @@ angle::Result ProgramExecutableVk::createPipelineLayout(
                                             &mDescriptorPools[DescriptorSetIndex::ShaderResource]));
 
     mDynamicUniformDescriptorOffsets.clear();
-    mDynamicUniformDescriptorOffsets.resize(glExecutable.getLinkedShaderStageCount(), 0);
+    mDynamicUniformDescriptorOffsets.resize(
+        usesDefaultUniformPushConstants() ? 0 : glExecutable.getLinkedShaderStageCount(), 0);
 
     return angle::Result::Continue;
 }
@@ -1015,7 +1350,8 @@ angle::Result ProgramExecutableVk::getOrAllocateDescriptorSet(
 
     if (cacheResult == vk::DescriptorCacheResult::NewAllocation)
     {
-        descriptorSetDesc.updateDescriptorSet(updateBuilder, mDescriptorSets[setIndex]);
+        ANGLE_TRY(mDescriptorPools[setIndex].get().updateDescriptorSet(
+            context, descriptorSetDesc, updateBuilder, mDescriptorSets[setIndex]));
     }
     else
     {
@@ -1089,7 +1425,8 @@ angle::Result ProgramExecutableVk::updateTexturesDescriptorSet(
         ANGLE_TRY(fullDesc.updateFullActiveTextures(context, mVariableInfoMap, executable, textures,
                                                     samplers, emulateSeamfulCubeMapSampling,
                                                     pipelineType));
-        fullDesc.updateDescriptorSet(updateBuilder, mDescriptorSets[DescriptorSetIndex::Texture]);
+        ANGLE_TRY(mDescriptorPools[DescriptorSetIndex::Texture].get().updateDescriptorSet(
+            context, fullDesc, updateBuilder, mDescriptorSets[DescriptorSetIndex::Texture]));
     }
     else
     {
@@ -1181,6 +1518,27 @@ angle::Result ProgramExecutableVk::bindDescriptorSets(
         }
     }
 
+    // Push constants don't survive a new command buffer either, so the default uniforms are pushed
+    // along with the descriptor sets, which are always rebound after the uniforms are updated.
+    if (usesDefaultUniformPushConstants())
+    {
+        const VkShaderStageFlags stageMask = gl_vk::GetShaderStageFlags(mPushConstantsStages);
+        for (gl::ShaderType shaderType : mPushConstantsStages)
+        {
+            const angle::MemoryBuffer &uniformData = mDefaultUniformBlocks[shaderType]->uniformData;
+            if (uniformData.empty())
+            {
+                continue;
+            }
+
+            const ShaderInterfaceVariableInfo &info =
+                mVariableInfoMap.getDefaultUniformInfo(shaderType);
+            commandBuffer->pushConstants(getPipelineLayout(), stageMask, info.pushConstantOffset,
+                                         static_cast<uint32_t>(uniformData.size()),
+                                         uniformData.data());
+        }
+    }
+
     return angle::Result::Continue;
 }
 
@@ -1219,6 +1577,13 @@ angle::Result ProgramExecutableVk::updateUniforms(
 {
     ASSERT(hasDirtyUniforms());
 
+    // The default uniforms are pushed when the descriptor sets are bound.
+    if (usesDefaultUniformPushConstants())
+    {
+        mDefaultUniformBlocksDirty.reset();
+        return angle::Result::Continue;
+    }
+
     vk::BufferHelper *defaultUniformBuffer;
     bool anyNewBufferAllocated          = false;
     gl::ShaderMap<VkDeviceSize> offsets = {};  // offset to the beginning of bufferData
@@ -1302,6 +1667,41 @@ size_t ProgramExecutableVk::calcUniformUpdateRequiredSpace(
     return requiredSpace;
 }
 
+void ProgramExecutableVk::assignDefaultUniformPushConstantOffsets(
+    ContextVk *contextVk,
+    const gl::ProgramExecutable &glExecutable)
+{
+    if (!contextVk->getFeatures().promoteDefaultUniformsToPushConstants.enabled)
+    {
+        return;
+    }
+
+    const gl::ShaderBitSet linkedShaderStages = glExecutable.getLinkedShaderStages();
+
+    gl::ShaderMap<uint32_t> offsets = {};
+    uint32_t totalSize              = 0;
+    for (gl::ShaderType shaderType : linkedShaderStages)
+    {
+        const size_t blockSize = mDefaultUniformBlocks[shaderType]->uniformData.size();
+        offsets[shaderType]    = roundUp(totalSize, kDefaultUniformPushConstantBlockAlignment);
+        totalSize              = offsets[shaderType] + static_cast<uint32_t>(blockSize);
+    }
+
+    // Programs without uniforms keep using the empty uniform buffer.
+    if (totalSize == 0 || totalSize > kMaxDefaultUniformPushConstantsSize)
+    {
+        return;
+    }
+
+    for (gl::ShaderType shaderType : linkedShaderStages)
+    {
+        mVariableInfoMap
+            .getMutable(shaderType, ShaderVariableType::DefaultUniform,
+                        kDefaultUniformNames[shaderType])
+            .pushConstantOffset = offsets[shaderType];
+    }
+}
+
 void ProgramExecutableVk::onProgramBind(const gl::ProgramExecutable &glExecutable)
 {
     // Because all programs share default uniform buffers, when we switch programs, we have to
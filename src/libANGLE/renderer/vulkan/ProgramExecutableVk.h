@@ -42,24 +42,24 @@ class ShaderInfo final : angle::NonCopyable
 
     // Save and load implementation for GLES Program Binary support.
     void load(gl::BinaryInputStream *stream);
-    void save(gl::BinaryOutputStream *stream);
+    void save(ContextVk *contextVk, gl::BinaryOutputStream *stream);
 
   private:
     gl::ShaderMap<angle::spirv::Blob> mSpirvBlobs;
     bool mIsInitialized = false;
 };
 
+// Options that change the transformed SPIR-V, and so need a shader module of their own.  Options
+// that can be expressed as specialization constants (line raster emulation, surface rotation and
+// dither) are instead derived from the pipeline description and share the shader modules.
 struct ProgramTransformOptions final
 {
-    uint8_t enableLineRasterEmulation : 1;
-    uint8_t surfaceRotation : 1;
     uint8_t enableDepthCorrection : 1;
     uint8_t removeTransformFeedbackEmulation : 1;
-    uint8_t reserved : 4;  // must initialize to zero
-    static constexpr uint32_t kPermutationCount = 0x1 << 4;
+    uint8_t reserved : 6;  // must initialize to zero
+    static constexpr uint32_t kPermutationCount = 0x1 << 2;
 };
 static_assert(sizeof(ProgramTransformOptions) == 1, "Size check failed");
-static_assert(static_cast<int>(SurfaceRotation::EnumCount) <= 8, "Size check failed");
 
 class ProgramInfo final : angle::NonCopyable
 {
@@ -74,6 +74,20 @@ class ProgramInfo final : angle::NonCopyable
                               const ShaderInfo &shaderInfo,
                               ProgramTransformOptions optionBits,
                               const ShaderInterfaceVariableInfoMap &variableInfoMap);
+
+    // initProgram() is split in two for parallel link.  initShader() transforms the SPIR-V of one
+    // stage and creates its shader module without touching the program helper, so it may run on a
+    // worker thread with its own |context|.  setShader() then gives the shader to the program
+    // helper on the context thread.
+    angle::Result initShader(vk::Context *context,
+                             gl::ShaderType shaderType,
+                             bool isLastPreFragmentStage,
+                             bool isTransformFeedbackProgram,
+                             const ShaderInfo &shaderInfo,
+                             ProgramTransformOptions optionBits,
+                             const ShaderInterfaceVariableInfoMap &variableInfoMap);
+    void setShader(gl::ShaderType shaderType);
+
     void release(ContextVk *contextVk);
 
     ANGLE_INLINE bool valid(gl::ShaderType shaderType) const
@@ -116,7 +130,7 @@ class ProgramExecutableVk
 
     void reset(ContextVk *contextVk);
 
-    void save(gl::BinaryOutputStream *stream);
+    void save(ContextVk *contextVk, gl::BinaryOutputStream *stream);
     std::unique_ptr<rx::LinkEvent> load(ContextVk *contextVk,
                                         const gl::ProgramExecutable &glExecutable,
                                         gl::BinaryInputStream *stream);
@@ -135,7 +149,6 @@ class ProgramExecutableVk
     }
 
     angle::Result getGraphicsPipeline(ContextVk *contextVk,
-                                      gl::PrimitiveMode mode,
                                       PipelineCacheAccess *pipelineCache,
                                       PipelineSource source,
                                       const vk::GraphicsPipelineDesc &desc,
@@ -150,6 +163,8 @@ class ProgramExecutableVk
                                      vk::PipelineHelper **pipelineOut);
 
     const vk::PipelineLayout &getPipelineLayout() const { return mPipelineLayout.get(); }
+    // Changes every time the pipelines of the executable are released.
+    uint64_t getPipelinesSerial() const { return mPipelinesSerial; }
     angle::Result createPipelineLayout(ContextVk *contextVk,
                                        const gl::ProgramExecutable &glExecutable,
                                        gl::ActiveTextureArray<TextureVk *> *activeTextures);
@@ -214,6 +229,14 @@ class ProgramExecutableVk
 
     bool hasDirtyUniforms() const { return mDefaultUniformBlocksDirty.any(); }
 
+    // When the default uniform blocks of all stages fit in the push constant range that every
+    // device supports, they are passed in push constants instead of a uniform buffer.  This is
+    // decided at link time, and recorded in the variable info map so the SPIR-V can be
+    // transformed accordingly.
+    void assignDefaultUniformPushConstantOffsets(ContextVk *contextVk,
+                                                 const gl::ProgramExecutable &glExecutable);
+    bool usesDefaultUniformPushConstants() const { return mPushConstantsStages.any(); }
+
     void setAllDefaultUniformsDirty(const gl::ProgramExecutable &executable);
     angle::Result updateUniforms(vk::Context *context,
                                  UpdateDescriptorSetsBuilder *updateBuilder,
@@ -253,6 +276,22 @@ class ProgramExecutableVk
 
     void resolvePrecisionMismatch(const gl::ProgramMergedVaryings &mergedVaryings);
 
+    angle::Result getGraphicsPipelineImpl(ContextVk *contextVk,
+                                          PipelineCacheAccess *pipelineCache,
+                                          PipelineSource source,
+                                          const vk::GraphicsPipelineDesc &desc,
+                                          const gl::ProgramExecutable &glExecutable,
+                                          const gl::DrawBufferMask &missingOutputsMask,
+                                          const vk::GraphicsPipelineDesc **descPtrOut,
+                                          vk::PipelineHelper **pipelineOut);
+
+    // The descriptions of the graphics pipelines created for this program are saved in the program
+    // binary, and the pipelines are warmed up when the binary is loaded.
+    void saveGraphicsPipelineWarmUpIndex(ContextVk *contextVk, gl::BinaryOutputStream *stream);
+    angle::Result loadGraphicsPipelineWarmUpIndex(ContextVk *contextVk,
+                                                  const gl::ProgramExecutable &glExecutable,
+                                                  gl::BinaryInputStream *stream);
+
     size_t calcUniformUpdateRequiredSpace(vk::Context *context,
                                           const gl::ProgramExecutable &glExecutable,
                                           gl::ShaderMap<VkDeviceSize> *uniformOffsets) const;
@@ -303,6 +342,10 @@ class ProgramExecutableVk
                            programInfo, variableInfoMap);
     }
 
+    // Releases the layouts and descriptor pools, or the shader programs and pipelines.
+    void resetLayout();
+    void releasePrograms(ContextVk *contextVk);
+
     angle::Result resizeUniformBlockMemory(ContextVk *contextVk,
                                            const gl::ProgramExecutable &glExecutable,
                                            const gl::ShaderMap<size_t> &requiredBufferSize);
@@ -313,12 +356,17 @@ class ProgramExecutableVk
                                              const vk::DescriptorSetDescBuilder &descriptorSetDesc,
                                              DescriptorSetIndex setIndex);
 
+    uint64_t mPipelinesSerial;
+
     // Descriptor sets and pools for shader resources for this program.
     vk::DescriptorSetArray<VkDescriptorSet> mDescriptorSets;
     vk::DescriptorSetArray<VkDescriptorSet> mEmptyDescriptorSets;
     vk::DescriptorSetArray<vk::DescriptorPoolPointer> mDescriptorPools;
     vk::DescriptorSetArray<vk::RefCountedDescriptorPoolBinding> mDescriptorPoolBindings;
     uint32_t mNumDefaultUniformDescriptors;
+    // The stages and size of the push constant range holding the default uniforms, if any.
+    gl::ShaderBitSet mPushConstantsStages;
+    uint32_t mPushConstantsSize;
     vk::BufferSerial mCurrentDefaultUniformBufferSerial;
 
     // We keep a reference to the pipeline and descriptor set layouts. This ensures they don't get
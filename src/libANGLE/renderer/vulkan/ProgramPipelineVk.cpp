@@ -102,6 +102,8 @@ angle::Result ProgramPipelineVk::link(const gl::Context *glContext,
         mExecutable.resolvePrecisionMismatch(mergedVaryings);
     }
 
+    mExecutable.assignDefaultUniformPushConstantOffsets(contextVk, glExecutable);
+
     return mExecutable.createPipelineLayout(contextVk, mState.getExecutable(), nullptr);
 }  // namespace rx
 
@@ -13,6 +13,7 @@
 #include "common/utilities.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/ProgramLinkedResources.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/glslang_wrapper_utils.h"
 #include "libANGLE/renderer/renderer_utils.h"
 #include "libANGLE/renderer/vulkan/BufferVk.h"
@@ -70,8 +71,11 @@ void InitDefaultUniformBlock(const std::vector<sh::ShaderVariable> &uniforms,
     return;
 }
 
+// Returns whether the shadow copy of the uniform data was modified.  Applications often set
+// uniforms to the values they already have, in which case the block doesn't need to be uploaded
+// again.
 template <typename T>
-void UpdateDefaultUniformBlock(GLsizei count,
+bool UpdateDefaultUniformBlock(GLsizei count,
                                uint32_t arrayIndex,
                                int componentCount,
                                const T *v,
@@ -79,6 +83,7 @@ void UpdateDefaultUniformBlock(GLsizei count,
                                angle::MemoryBuffer *uniformData)
 {
     const int elementSize = sizeof(T) * componentCount;
+    bool changed          = false;
 
     uint8_t *dst = uniformData->data() + layoutInfo.offset;
     if (layoutInfo.arrayStride == 0 || layoutInfo.arrayStride == elementSize)
@@ -86,7 +91,11 @@ void UpdateDefaultUniformBlock(GLsizei count,
         uint32_t arrayOffset = arrayIndex * layoutInfo.arrayStride;
         uint8_t *writePtr    = dst + arrayOffset;
         ASSERT(writePtr + (elementSize * count) <= uniformData->data() + uniformData->size());
-        memcpy(writePtr, v, elementSize * count);
+        if (memcmp(writePtr, v, elementSize * count) != 0)
+        {
+            memcpy(writePtr, v, elementSize * count);
+            changed = true;
+        }
     }
     else
     {
@@ -99,9 +108,15 @@ void UpdateDefaultUniformBlock(GLsizei count,
             uint8_t *writePtr     = dst + arrayOffset;
             const T *readPtr      = v + (readIndex * componentCount);
             ASSERT(writePtr + elementSize <= uniformData->data() + uniformData->size());
-            memcpy(writePtr, readPtr, elementSize);
+            if (memcmp(writePtr, readPtr, elementSize) != 0)
+            {
+                memcpy(writePtr, readPtr, elementSize);
+                changed = true;
+            }
         }
     }
+
+    return changed;
 }
 
 template <typename T>
@@ -153,8 +168,139 @@ void SetupDefaultPipelineState(const ContextVk *contextVk,
                                                                     kDefaultColorAttachmentFormat);
     }
 }
+
+// Transforms the SPIR-V of one shader stage and creates its shader module during parallel link.
+// The task is its own vk::Context so that errors on the worker thread don't touch the ContextVk.
+// The program's SPIR-V and variable info map are not modified until the link is resolved, which
+// waits for the task.
+class InitShaderTask final : public vk::Context, public angle::Closure
+{
+  public:
+    InitShaderTask(RendererVk *renderer,
+                   ProgramInfo *programInfo,
+                   gl::ShaderType shaderType,
+                   bool isLastPreFragmentStage,
+                   bool isTransformFeedbackProgram,
+                   const ShaderInfo &shaderInfo,
+                   ProgramTransformOptions optionBits,
+                   const ShaderInterfaceVariableInfoMap &variableInfoMap)
+        : vk::Context(renderer),
+          mProgramInfo(programInfo),
+          mShaderType(shaderType),
+          mIsLastPreFragmentStage(isLastPreFragmentStage),
+          mIsTransformFeedbackProgram(isTransformFeedbackProgram),
+          mShaderInfo(shaderInfo),
+          mOptionBits(optionBits),
+          mVariableInfoMap(variableInfoMap),
+          mResult(angle::Result::Continue),
+          mErrorCode(VK_SUCCESS),
+          mErrorFile(nullptr),
+          mErrorFunction(nullptr),
+          mErrorLine(0)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "InitShaderTask");
+        mResult = mProgramInfo->initShader(this, mShaderType, mIsLastPreFragmentStage,
+                                           mIsTransformFeedbackProgram, mShaderInfo, mOptionBits,
+                                           mVariableInfoMap);
+    }
+
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override
+    {
+        mErrorCode     = result;
+        mErrorFile     = file;
+        mErrorFunction = function;
+        mErrorLine     = line;
+    }
+
+    angle::Result getResult(ContextVk *contextVk)
+    {
+        if (mErrorCode != VK_SUCCESS)
+        {
+            contextVk->handleError(mErrorCode, mErrorFile, mErrorFunction, mErrorLine);
+        }
+        return mResult;
+    }
+
+    gl::ShaderType getShaderType() const { return mShaderType; }
+
+  private:
+    ProgramInfo *mProgramInfo;
+    gl::ShaderType mShaderType;
+    bool mIsLastPreFragmentStage;
+    bool mIsTransformFeedbackProgram;
+    const ShaderInfo &mShaderInfo;
+    ProgramTransformOptions mOptionBits;
+    const ShaderInterfaceVariableInfoMap &mVariableInfoMap;
+
+    angle::Result mResult;
+    VkResult mErrorCode;
+    const char *mErrorFile;
+    const char *mErrorFunction;
+    unsigned int mErrorLine;
+};
 }  // anonymous namespace
 
+// The LinkEvent implementation for linking with the shader modules created on worker threads.
+// Waiting for the event hands the shaders to the program and finishes the link.
+class ProgramVk::LinkEventVk final : public LinkEvent
+{
+  public:
+    LinkEventVk(ProgramVk *program,
+                std::shared_ptr<angle::WorkerThreadPool> workerPool,
+                ProgramInfo *programInfo,
+                std::vector<std::shared_ptr<InitShaderTask>> &&tasks)
+        : mProgram(program), mProgramInfo(programInfo), mTasks(std::move(tasks))
+    {
+        for (std::shared_ptr<InitShaderTask> &task : mTasks)
+        {
+            mWaitEvents.push_back(angle::WorkerThreadPool::PostWorkerTask(workerPool, task));
+        }
+    }
+
+    angle::Result wait(const gl::Context *context) override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "ProgramVk::LinkEventVk::wait");
+        ContextVk *contextVk = vk::GetImpl(context);
+
+        for (std::shared_ptr<angle::WaitableEvent> &waitEvent : mWaitEvents)
+        {
+            waitEvent->wait();
+        }
+
+        for (std::shared_ptr<InitShaderTask> &task : mTasks)
+        {
+            ANGLE_TRY(task->getResult(contextVk));
+            mProgramInfo->setShader(task->getShaderType());
+        }
+
+        return mProgram->warmUpPipelineCache(context);
+    }
+
+    bool isLinking() override
+    {
+        for (std::shared_ptr<angle::WaitableEvent> &waitEvent : mWaitEvents)
+        {
+            if (!waitEvent->isReady())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+  private:
+    ProgramVk *mProgram;
+    ProgramInfo *mProgramInfo;
+    std::vector<std::shared_ptr<InitShaderTask>> mTasks;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> mWaitEvents;
+};
+
 // ProgramVk implementation.
 ProgramVk::ProgramVk(const gl::ProgramState &state) : ProgramImpl(state)
 {
@@ -189,7 +335,7 @@ std::unique_ptr<rx::LinkEvent> ProgramVk::load(const gl::Context *context,
 
 void ProgramVk::save(const gl::Context *context, gl::BinaryOutputStream *stream)
 {
-    mExecutable.save(stream);
+    mExecutable.save(vk::GetImpl(context), stream);
 }
 
 void ProgramVk::setBinaryRetrievableHint(bool retrievable)
@@ -243,27 +389,81 @@ std::unique_ptr<LinkEvent> ProgramVk::link(const gl::Context *context,
         return std::make_unique<LinkEventDone>(status);
     }
 
-    // TODO(jie.a.chen@intel.com): Parallelize linking.
-    // http://crbug.com/849576
-    status = mExecutable.createPipelineLayout(contextVk, programExecutable, nullptr);
+    mExecutable.assignDefaultUniformPushConstantOffsets(contextVk, programExecutable);
 
-    // Create pipeline with default state
-    if ((status == angle::Result::Continue) &&
-        contextVk->getFeatures().createPipelineDuringLink.enabled)
+    status = mExecutable.createPipelineLayout(contextVk, programExecutable, nullptr);
+    if (status != angle::Result::Continue)
     {
-        PipelineCacheAccess pipelineCache;
-        status = contextVk->getRenderer()->getPipelineCache(&pipelineCache);
-        if (status != angle::Result::Continue)
-        {
-            return std::make_unique<LinkEventDone>(status);
-        }
+        return std::make_unique<LinkEventDone>(status);
+    }
 
-        status = createGraphicsPipelineWithDefaultState(context, &pipelineCache);
+    // Separable programs are drawn with the shaders of the program pipeline instead.
+    std::shared_ptr<angle::WorkerThreadPool> workerPool = context->getWorkerThreadPool();
+    if (!mState.isSeparable() && workerPool->isAsync())
+    {
+        return initShadersInParallel(context, workerPool);
     }
 
+    status = warmUpPipelineCache(context);
     return std::make_unique<LinkEventDone>(status);
 }
 
+std::unique_ptr<LinkEvent> ProgramVk::initShadersInParallel(
+    const gl::Context *context,
+    std::shared_ptr<angle::WorkerThreadPool> workerPool)
+{
+    ContextVk *contextVk                           = vk::GetImpl(context);
+    const gl::ProgramExecutable &programExecutable = mState.getExecutable();
+    const gl::ShaderBitSet linkedShaderStages      = programExecutable.getLinkedShaderStages();
+
+    // Create the shaders of the variant that the first draw or dispatch is most likely to use,
+    // that is the one for the current clip control and transform feedback state.
+    ProgramTransformOptions optionBits = {};
+    ProgramInfo *programInfo           = &mExecutable.getComputeProgramInfo();
+    if (!programExecutable.hasLinkedShaderStage(gl::ShaderType::Compute))
+    {
+        const gl::State &glState         = context->getState();
+        optionBits.enableDepthCorrection = !glState.isClipControlDepthZeroToOne();
+        optionBits.removeTransformFeedbackEmulation =
+            contextVk->getFeatures().emulateTransformFeedback.enabled &&
+            !glState.isTransformFeedbackActiveUnpaused();
+
+        const uint8_t index = gl::bitCast<uint8_t, ProgramTransformOptions>(optionBits);
+        programInfo         = &mExecutable.mGraphicsProgramInfos[index];
+    }
+
+    const gl::ShaderType lastPreFragmentStage = gl::GetLastPreFragmentStage(linkedShaderStages);
+    const bool isTransformFeedbackProgram =
+        !programExecutable.getLinkedTransformFeedbackVaryings().empty();
+
+    std::vector<std::shared_ptr<InitShaderTask>> tasks;
+    for (gl::ShaderType shaderType : linkedShaderStages)
+    {
+        tasks.push_back(std::make_shared<InitShaderTask>(
+            contextVk->getRenderer(), programInfo, shaderType, shaderType == lastPreFragmentStage,
+            isTransformFeedbackProgram, mExecutable.mOriginalShaderInfo, optionBits,
+            mExecutable.mVariableInfoMap));
+    }
+
+    return std::make_unique<LinkEventVk>(this, workerPool, programInfo, std::move(tasks));
+}
+
+angle::Result ProgramVk::warmUpPipelineCache(const gl::Context *context)
+{
+    ContextVk *contextVk = vk::GetImpl(context);
+
+    // Create pipeline with default state
+    if (!contextVk->getFeatures().createPipelineDuringLink.enabled)
+    {
+        return angle::Result::Continue;
+    }
+
+    PipelineCacheAccess pipelineCache;
+    ANGLE_TRY(contextVk->getRenderer()->getPipelineCache(&pipelineCache));
+
+    return createGraphicsPipelineWithDefaultState(context, &pipelineCache);
+}
+
 angle::Result ProgramVk::createGraphicsPipelineWithDefaultState(const gl::Context *context,
                                                                 PipelineCacheAccess *pipelineCache)
 {
@@ -295,7 +495,7 @@ angle::Result ProgramVk::createGraphicsPipelineWithDefaultState(const gl::Contex
                                  : gl::PrimitiveMode::TriangleStrip;
     SetupDefaultPipelineState(contextVk, glExecutable.getOutputVariables().size(), mode,
                               &graphicsPipelineDesc);
-    return mExecutable.getGraphicsPipeline(contextVk, mode, pipelineCache, PipelineSource::WarmUp,
+    return mExecutable.getGraphicsPipeline(contextVk, pipelineCache, PipelineSource::WarmUp,
                                            graphicsPipelineDesc, glExecutable, &descPtr, &pipeline);
 }
 
@@ -419,9 +619,11 @@ void ProgramVk::setUniformImpl(GLint location, GLsizei count, const T *v, GLenum
             }
 
             const GLint componentCount = linkedUniform.typeInfo->componentCount;
-            UpdateDefaultUniformBlock(count, locationInfo.arrayIndex, componentCount, v, layoutInfo,
-                                      &uniformBlock.uniformData);
-            mExecutable.mDefaultUniformBlocksDirty.set(shaderType);
+            if (UpdateDefaultUniformBlock(count, locationInfo.arrayIndex, componentCount, v,
+                                          layoutInfo, &uniformBlock.uniformData))
+            {
+                mExecutable.mDefaultUniformBlocksDirty.set(shaderType);
+            }
         }
     }
     else
@@ -443,6 +645,7 @@ void ProgramVk::setUniformImpl(GLint location, GLsizei count, const T *v, GLenum
 
             GLint initialArrayOffset =
                 locationInfo.arrayIndex * layoutInfo.arrayStride + layoutInfo.offset;
+            bool changed = false;
             for (GLint i = 0; i < count; i++)
             {
                 GLint elementOffset = i * layoutInfo.arrayStride + initialArrayOffset;
@@ -452,11 +655,16 @@ void ProgramVk::setUniformImpl(GLint location, GLsizei count, const T *v, GLenum
 
                 for (int c = 0; c < componentCount; c++)
                 {
-                    dst[c] = (source[c] == static_cast<T>(0)) ? GL_FALSE : GL_TRUE;
+                    const GLint value = (source[c] == static_cast<T>(0)) ? GL_FALSE : GL_TRUE;
+                    changed           = changed || dst[c] != value;
+                    dst[c]            = value;
                 }
             }
 
-            mExecutable.mDefaultUniformBlocksDirty.set(shaderType);
+            if (changed)
+            {
+                mExecutable.mDefaultUniformBlocksDirty.set(shaderType);
+            }
         }
     }
 }
@@ -581,9 +789,26 @@ void ProgramVk::setUniformMatrixfv(GLint location,
             continue;
         }
 
-        SetFloatUniformMatrixGLSL<cols, rows>::Run(
-            locationInfo.arrayIndex, linkedUniform.getArraySizeProduct(), count, transpose, value,
-            uniformBlock.uniformData.data() + layoutInfo.offset);
+        uint8_t *dst = uniformBlock.uniformData.data() + layoutInfo.offset;
+
+        // Untransposed matrices with 4 rows have the same layout as the shadow copy, so they are
+        // cheap to compare.  Skip the upload if the data is already up to date.
+        if (rows == 4 && !transpose)
+        {
+            constexpr size_t kMatrixSize = sizeof(GLfloat) * cols * 4;
+            const unsigned int arraySize = linkedUniform.getArraySizeProduct();
+            const unsigned int clampedCount =
+                std::min(arraySize - locationInfo.arrayIndex, static_cast<unsigned int>(count));
+            if (memcmp(dst + locationInfo.arrayIndex * kMatrixSize, value,
+                       kMatrixSize * clampedCount) == 0)
+            {
+                continue;
+            }
+        }
+
+        SetFloatUniformMatrixGLSL<cols, rows>::Run(locationInfo.arrayIndex,
+                                                   linkedUniform.getArraySizeProduct(), count,
+                                                   transpose, value, dst);
 
         mExecutable.mDefaultUniformBlocksDirty.set(shaderType);
     }
@@ -121,6 +121,8 @@ class ProgramVk : public ProgramImpl
     }
 
   private:
+    class LinkEventVk;
+
     template <int cols, int rows>
     void setUniformMatrixfv(GLint location,
                             GLsizei count,
@@ -140,6 +142,10 @@ class ProgramVk : public ProgramImpl
     void setUniformImpl(GLint location, GLsizei count, const T *v, GLenum entryPointType);
     void linkResources(const gl::ProgramLinkedResources &resources);
 
+    std::unique_ptr<LinkEvent> initShadersInParallel(
+        const gl::Context *context,
+        std::shared_ptr<angle::WorkerThreadPool> workerPool);
+    angle::Result warmUpPipelineCache(const gl::Context *context);
     angle::Result createGraphicsPipelineWithDefaultState(const gl::Context *context,
                                                          PipelineCacheAccess *pipelineCache);
 
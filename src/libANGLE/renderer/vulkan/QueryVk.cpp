@@ -107,7 +107,8 @@ QueryVk::QueryVk(gl::QueryType type)
     : QueryImpl(type),
       mTransformFeedbackPrimitivesDrawn(0),
       mCachedResult(0),
-      mCachedResultValid(false)
+      mCachedResultValid(false),
+      mAvailabilityPolledBeforeFlush(false)
 {}
 
 QueryVk::~QueryVk() = default;
@@ -302,7 +303,8 @@ angle::Result QueryVk::begin(const gl::Context *context)
 {
     ContextVk *contextVk = vk::GetImpl(context);
 
-    mCachedResultValid = false;
+    mCachedResultValid             = false;
+    mAvailabilityPolledBeforeFlush = false;
 
     // Transform feedback query is handled by a CPU-calculated value when emulated.
     if (IsEmulatedTransformFeedbackQuery(contextVk, mType))
@@ -421,7 +423,8 @@ angle::Result QueryVk::queryCounter(const gl::Context *context)
     ASSERT(mType == gl::QueryType::Timestamp);
     ContextVk *contextVk = vk::GetImpl(context);
 
-    mCachedResultValid = false;
+    mCachedResultValid             = false;
+    mAvailabilityPolledBeforeFlush = false;
 
     if (!mQueryHelper.isReferenced())
     {
@@ -521,6 +524,17 @@ angle::Result QueryVk::getResult(const gl::Context *context, bool wait)
 
     if (isUsedInRecordedCommands())
     {
+        // Applications that poll many queries, such as for occlusion culling, commonly check for
+        // availability right after the query ends and use the result once it's available in a
+        // later frame.  Don't break the render pass for the first poll; the query will very likely
+        // be submitted by the end of the frame.  If the application polls again before that, flush
+        // so that the query is guaranteed to become available in finite time.
+        if (!wait && !mAvailabilityPolledBeforeFlush)
+        {
+            mAvailabilityPolledBeforeFlush = true;
+            return angle::Result::Continue;
+        }
+
         ANGLE_TRY(contextVk->flushImpl(nullptr, RenderPassClosureReason::GetQueryResult));
 
         ASSERT(!mQueryHelperTimeElapsedBegin.usedInRecordedCommands());
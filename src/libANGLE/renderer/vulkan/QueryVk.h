@@ -80,6 +80,10 @@ class QueryVk : public QueryImpl
 
     uint64_t mCachedResult;
     bool mCachedResultValid;
+
+    // Whether the result availability has been polled while the query was only recorded and not
+    // submitted yet.  The next poll flushes the commands so that the query completes.
+    bool mAvailabilityPolledBeforeFlush;
 };
 
 }  // namespace rx
@@ -14,6 +14,7 @@
 
 #include <EGL/eglext.h>
 
+#include "common/aligned_memory.h"
 #include "common/debug.h"
 #include "common/platform.h"
 #include "common/system_utils.h"
@@ -70,6 +71,11 @@ constexpr uint32_t kPreferredDefaultUniformBufferSize = 64 * 1024u;
 
 // Update the pipeline cache every this many swaps.
 constexpr uint32_t kPipelineCacheVkUpdatePeriod = 60;
+
+// Memory heaps are considered under pressure once their usage reaches this percentage of the
+// budget reported by VK_EXT_memory_budget.
+constexpr VkDeviceSize kMemoryBudgetPressurePercent = 90;
+
 // Per the Vulkan specification, as long as Vulkan 1.1+ is returned by vkEnumerateInstanceVersion,
 // ANGLE must indicate the highest version of Vulkan functionality that it uses.  The Vulkan
 // validation layers will issue messages for any core functionality that requires a higher version.
@@ -1134,6 +1140,145 @@ ANGLE_INLINE gl::ShadingRate GetShadingRateFromVkExtent(const VkExtent2D &extent
 
     return gl::ShadingRate::_1x1;
 }
+
+// The format properties queried by the displays of the process that are already terminated.  Test
+// runners and other short-lived processes initialize and terminate displays many times, and the
+// properties of a device can't change while its driver is loaded.
+struct CachedFormatProperties
+{
+    uint32_t vendorID;
+    uint32_t deviceID;
+    uint32_t driverVersion;
+    angle::FormatMap<VkFormatProperties> formatProperties;
+};
+
+std::mutex &GetCachedFormatPropertiesMutex()
+{
+    static std::mutex *cachedFormatPropertiesMutex = new std::mutex;
+    return *cachedFormatPropertiesMutex;
+}
+
+std::vector<CachedFormatProperties> &GetCachedFormatProperties()
+{
+    static std::vector<CachedFormatProperties> *cachedFormatProperties =
+        new std::vector<CachedFormatProperties>;
+    return *cachedFormatProperties;
+}
+
+bool IsSameDevice(const CachedFormatProperties &cached,
+                  const VkPhysicalDeviceProperties &physicalDeviceProperties)
+{
+    return cached.vendorID == physicalDeviceProperties.vendorID &&
+           cached.deviceID == physicalDeviceProperties.deviceID &&
+           cached.driverVersion == physicalDeviceProperties.driverVersion;
+}
+
+// Copies the properties of the formats that were queried from |src| to |dst|.
+void MergeFormatProperties(const angle::FormatMap<VkFormatProperties> &src,
+                           angle::FormatMap<VkFormatProperties> *dst)
+{
+    for (size_t formatIndex = 0; formatIndex < angle::kNumANGLEFormats; ++formatIndex)
+    {
+        const auto formatID = static_cast<angle::FormatID>(formatIndex);
+        // The properties of D16_UNORM may be changed by forceD16TexFilter, which depends on the
+        // display.
+        if (src[formatID].bufferFeatures != kInvalidFormatFeatureFlags &&
+            formatID != angle::FormatID::D16_UNORM)
+        {
+            (*dst)[formatID] = src[formatID];
+        }
+    }
+}
+
+void LoadCachedFormatProperties(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                angle::FormatMap<VkFormatProperties> *formatPropertiesOut)
+{
+    std::lock_guard<std::mutex> lock(GetCachedFormatPropertiesMutex());
+    for (const CachedFormatProperties &cached : GetCachedFormatProperties())
+    {
+        if (IsSameDevice(cached, physicalDeviceProperties))
+        {
+            MergeFormatProperties(cached.formatProperties, formatPropertiesOut);
+            return;
+        }
+    }
+}
+
+void StoreCachedFormatProperties(const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                 const angle::FormatMap<VkFormatProperties> &formatProperties)
+{
+    std::lock_guard<std::mutex> lock(GetCachedFormatPropertiesMutex());
+    std::vector<CachedFormatProperties> &cachedFormatProperties = GetCachedFormatProperties();
+
+    for (CachedFormatProperties &cached : cachedFormatProperties)
+    {
+        if (IsSameDevice(cached, physicalDeviceProperties))
+        {
+            MergeFormatProperties(formatProperties, &cached.formatProperties);
+            return;
+        }
+    }
+
+    CachedFormatProperties cached = {physicalDeviceProperties.vendorID,
+                                     physicalDeviceProperties.deviceID,
+                                     physicalDeviceProperties.driverVersion, {}};
+    VkFormatProperties invalid    = {0, 0, kInvalidFormatFeatureFlags};
+    cached.formatProperties.fill(invalid);
+    MergeFormatProperties(formatProperties, &cached.formatProperties);
+    cachedFormatProperties.push_back(cached);
+}
+
+// Returns the first queue family that supports transfers but neither graphics nor compute, which
+// are executed by the copy engines of the GPU.  Copies to images must allow any granularity, as
+// uploads are made to arbitrary regions of the textures.
+uint32_t FindTransferOnlyQueueFamily(const std::vector<VkQueueFamilyProperties> &queueFamilies)
+{
+    for (uint32_t familyIndex = 0; familyIndex < queueFamilies.size(); ++familyIndex)
+    {
+        const VkQueueFamilyProperties &properties = queueFamilies[familyIndex];
+        const VkExtent3D &granularity             = properties.minImageTransferGranularity;
+        if ((properties.queueFlags & VK_QUEUE_TRANSFER_BIT) != 0 &&
+            (properties.queueFlags & (VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT)) == 0 &&
+            properties.queueCount > 0 && granularity.width == 1 && granularity.height == 1 &&
+            granularity.depth == 1)
+        {
+            return familyIndex;
+        }
+    }
+    return vk::QueueFamily::kInvalidIndex;
+}
+
+// GPU trace events only need device timestamps sampled at a known CPU time.
+bool CanCalibrateDeviceTimestamps(VkInstance instance,
+                                  VkPhysicalDevice physicalDevice,
+                                  const vk::ExtensionNameList &deviceExtensionNames)
+{
+    if (!ExtensionFound(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME, deviceExtensionNames))
+    {
+        return false;
+    }
+
+#if !defined(ANGLE_SHARED_LIBVULKAN)
+    InitCalibratedTimestampsEXTFunctions(instance);
+#endif  // !defined(ANGLE_SHARED_LIBVULKAN)
+
+    uint32_t timeDomainCount = 0;
+    if (vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, &timeDomainCount,
+                                                       nullptr) != VK_SUCCESS)
+    {
+        return false;
+    }
+
+    std::vector<VkTimeDomainEXT> timeDomains(timeDomainCount);
+    if (vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(physicalDevice, &timeDomainCount,
+                                                       timeDomains.data()) != VK_SUCCESS)
+    {
+        return false;
+    }
+
+    return std::find(timeDomains.begin(), timeDomains.end(), VK_TIME_DOMAIN_DEVICE_EXT) !=
+           timeDomains.end();
+}
 }  // namespace
 
 // RendererVk implementation.
@@ -1216,6 +1361,11 @@ void RendererVk::onDestroy(vk::Context *context)
         handleDeviceLost();
     }
 
+    if (mPhysicalDevice != VK_NULL_HANDLE)
+    {
+        StoreCachedFormatProperties(mPhysicalDeviceProperties, mFormatProperties);
+    }
+
     for (std::unique_ptr<vk::BufferBlock> &block : mOrphanedBufferBlocks)
     {
         ASSERT(block->isEmpty());
@@ -1235,6 +1385,12 @@ void RendererVk::onDestroy(vk::Context *context)
         }
     }
 
+    // Destroyed after the command processor, which may still hand presents off to it.
+    mPresentThread.destroy();
+
+    // Destroyed after the command queues, whose submissions may wait for it.
+    mTransferQueue.destroy(mDevice);
+
     // Assigns an infinite "last completed" serial to force garbage to delete.
     cleanupGarbage(Serial::Infinite());
     ASSERT(!hasSharedGarbage());
@@ -1249,6 +1405,7 @@ void RendererVk::onDestroy(vk::Context *context)
     mPipelineCache.destroy(mDevice);
     mSamplerCache.destroy(this);
     mYuvConversionCache.destroy(this);
+    mUtilsPrograms.destroy(this);
     mVkFormatDescriptorCountMap.clear();
 
     mOutsideRenderPassCommandBufferRecycler.onDestroy();
@@ -1260,7 +1417,7 @@ void RendererVk::onDestroy(vk::Context *context)
 
     if (mDevice)
     {
-        vkDestroyDevice(mDevice, nullptr);
+        vkDestroyDevice(mDevice, mHostAllocator.getCallbacks());
         mDevice = VK_NULL_HANDLE;
     }
 
@@ -1690,7 +1847,9 @@ angle::Result RendererVk::initialize(DisplayVk *displayVk,
         sh::InitializeGlslang();
     }
 
-    // Initialize the format table.
+    // Initialize the format table, without querying the formats already queried by a previous
+    // display of the same device.
+    LoadCachedFormatProperties(mPhysicalDeviceProperties, &mFormatProperties);
     mFormatTable.initialize(this, &mNativeTextureCaps);
 
     setGlobalDebugAnnotator();
@@ -1881,6 +2040,20 @@ void RendererVk::queryDeviceExtensionFeatures(const vk::ExtensionNameList &devic
     mHostQueryResetFeatures       = {};
     mHostQueryResetFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES_EXT;
 
+    mImagelessFramebufferFeatures = {};
+    mImagelessFramebufferFeatures.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES_KHR;
+
+    mTimelineSemaphoreFeatures = {};
+    mTimelineSemaphoreFeatures.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES_KHR;
+
+    mPresentIdFeatures       = {};
+    mPresentIdFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_ID_FEATURES_KHR;
+
+    mPresentWaitFeatures       = {};
+    mPresentWaitFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRESENT_WAIT_FEATURES_KHR;
+
     mDepthClipControlFeatures = {};
     mDepthClipControlFeatures.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_CONTROL_FEATURES_EXT;
@@ -1905,6 +2078,13 @@ void RendererVk::queryDeviceExtensionFeatures(const vk::ExtensionNameList &devic
     mFragmentShadingRateFeatures.sType =
         VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR;
 
+    mHostImageCopyFeatures       = {};
+    mHostImageCopyFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_FEATURES_EXT;
+
+    mHostImageCopyProperties = {};
+    mHostImageCopyProperties.sType =
+        VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_IMAGE_COPY_PROPERTIES_EXT;
+
     if (!vkGetPhysicalDeviceProperties2KHR || !vkGetPhysicalDeviceFeatures2KHR)
     {
         return;
@@ -2032,6 +2212,27 @@ void RendererVk::queryDeviceExtensionFeatures(const vk::ExtensionNameList &devic
         vk::AddToPNextChain(&deviceFeatures, &mHostQueryResetFeatures);
     }
 
+    // Query imageless framebuffer features
+    if (ExtensionFound(VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(&deviceFeatures, &mImagelessFramebufferFeatures);
+    }
+
+    if (ExtensionFound(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(&deviceFeatures, &mTimelineSemaphoreFeatures);
+    }
+
+    if (ExtensionFound(VK_KHR_PRESENT_ID_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(&deviceFeatures, &mPresentIdFeatures);
+    }
+
+    if (ExtensionFound(VK_KHR_PRESENT_WAIT_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(&deviceFeatures, &mPresentWaitFeatures);
+    }
+
     if (ExtensionFound(VK_EXT_DEPTH_CLIP_CONTROL_EXTENSION_NAME, deviceExtensionNames))
     {
         vk::AddToPNextChain(&deviceFeatures, &mDepthClipControlFeatures);
@@ -2062,9 +2263,33 @@ void RendererVk::queryDeviceExtensionFeatures(const vk::ExtensionNameList &devic
         vk::AddToPNextChain(&deviceFeatures, &mFragmentShadingRateFeatures);
     }
 
+    if (ExtensionFound(VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME, deviceExtensionNames))
+    {
+        vk::AddToPNextChain(&deviceFeatures, &mHostImageCopyFeatures);
+        vk::AddToPNextChain(&deviceProperties, &mHostImageCopyProperties);
+    }
+
     vkGetPhysicalDeviceFeatures2KHR(mPhysicalDevice, &deviceFeatures);
     vkGetPhysicalDeviceProperties2KHR(mPhysicalDevice, &deviceProperties);
 
+    // The layouts host image copies support are queried separately, now that their count is known.
+    if (mHostImageCopyFeatures.hostImageCopy == VK_TRUE)
+    {
+        mHostImageCopySrcLayouts.resize(mHostImageCopyProperties.copySrcLayoutCount);
+        mHostImageCopyDstLayouts.resize(mHostImageCopyProperties.copyDstLayoutCount);
+        mHostImageCopyProperties.pNext           = nullptr;
+        mHostImageCopyProperties.pCopySrcLayouts = mHostImageCopySrcLayouts.data();
+        mHostImageCopyProperties.pCopyDstLayouts = mHostImageCopyDstLayouts.data();
+
+        VkPhysicalDeviceProperties2 hostImageCopyProperties = {};
+        hostImageCopyProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        vk::AddToPNextChain(&hostImageCopyProperties, &mHostImageCopyProperties);
+        vkGetPhysicalDeviceProperties2KHR(mPhysicalDevice, &hostImageCopyProperties);
+
+        mHostImageCopyProperties.pCopySrcLayouts = nullptr;
+        mHostImageCopyProperties.pCopyDstLayouts = nullptr;
+    }
+
     // Clean up pNext chains
     mLineRasterizationFeatures.pNext                 = nullptr;
     mMemoryReportFeatures.pNext                      = nullptr;
@@ -2088,12 +2313,18 @@ void RendererVk::queryDeviceExtensionFeatures(const vk::ExtensionNameList &devic
     mProtectedMemoryFeatures.pNext                   = nullptr;
     mProtectedMemoryProperties.pNext                 = nullptr;
     mHostQueryResetFeatures.pNext                    = nullptr;
+    mImagelessFramebufferFeatures.pNext              = nullptr;
+    mTimelineSemaphoreFeatures.pNext                 = nullptr;
+    mPresentIdFeatures.pNext                         = nullptr;
+    mPresentWaitFeatures.pNext                       = nullptr;
     mDepthClipControlFeatures.pNext                  = nullptr;
     mBlendOperationAdvancedFeatures.pNext            = nullptr;
     mPipelineCreationCacheControlFeatures.pNext      = nullptr;
     mExtendedDynamicStateFeatures.pNext              = nullptr;
     mExtendedDynamicState2Features.pNext             = nullptr;
     mFragmentShadingRateFeatures.pNext               = nullptr;
+    mHostImageCopyFeatures.pNext                     = nullptr;
+    mHostImageCopyProperties.pNext                   = nullptr;
 }
 
 angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueFamilyIndex)
@@ -2223,6 +2454,30 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
         mEnabledDeviceExtensions.push_back(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME);
     }
 
+    if (getFeatures().supportsDescriptorUpdateTemplate.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME);
+    }
+
+    if (getFeatures().supportsTimelineSemaphore.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_KHR_TIMELINE_SEMAPHORE_EXTENSION_NAME);
+        vk::AddToPNextChain(&mEnabledFeatures, &mTimelineSemaphoreFeatures);
+    }
+
+    if (getFeatures().supportsPresentWait.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_KHR_PRESENT_ID_EXTENSION_NAME);
+        mEnabledDeviceExtensions.push_back(VK_KHR_PRESENT_WAIT_EXTENSION_NAME);
+        vk::AddToPNextChain(&mEnabledFeatures, &mPresentIdFeatures);
+        vk::AddToPNextChain(&mEnabledFeatures, &mPresentWaitFeatures);
+    }
+
+    if (getFeatures().supportsCalibratedTimestamps.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_EXT_CALIBRATED_TIMESTAMPS_EXTENSION_NAME);
+    }
+
     if (getFeatures().supportsIncrementalPresent.enabled)
     {
         mEnabledDeviceExtensions.push_back(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME);
@@ -2479,9 +2734,12 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
         }
         else
         {
+            // Host memory stats are still available if the driver uses ANGLE's allocator.
+            const bool keepMemoryReportStats = getFeatures().useHostAllocationCallbacks.enabled;
+
             WARN() << "Disabling the following feature(s) because driver does not support "
                       "VK_EXT_device_memory_report extension:";
-            if (getFeatures().logMemoryReportStats.enabled)
+            if (getFeatures().logMemoryReportStats.enabled && !keepMemoryReportStats)
             {
                 WARN() << "\tlogMemoryReportStats";
                 ANGLE_FEATURE_CONDITION(&mFeatures, logMemoryReportStats, false);
@@ -2510,6 +2768,11 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
 #endif  // !defined(ANGLE_SHARED_LIBVULKAN)
     }
 
+    if (getFeatures().supportsMemoryBudget.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    }
+
     if (getFeatures().supportsYUVSamplerConversion.enabled)
     {
         mEnabledDeviceExtensions.push_back(VK_KHR_SAMPLER_YCBCR_CONVERSION_EXTENSION_NAME);
@@ -2533,6 +2796,22 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
         vk::AddToPNextChain(&mEnabledFeatures, &mHostQueryResetFeatures);
     }
 
+    if (getFeatures().supportsImagelessFramebuffer.enabled)
+    {
+        mEnabledDeviceExtensions.push_back(VK_KHR_MAINTENANCE_2_EXTENSION_NAME);
+        mEnabledDeviceExtensions.push_back(VK_KHR_IMAGELESS_FRAMEBUFFER_EXTENSION_NAME);
+        vk::AddToPNextChain(&mEnabledFeatures, &mImagelessFramebufferFeatures);
+    }
+
+    if (getFeatures().supportsHostImageCopy.enabled)
+    {
+        // VK_EXT_host_image_copy depends on VK_KHR_copy_commands2 and VK_KHR_format_feature_flags2.
+        mEnabledDeviceExtensions.push_back(VK_KHR_COPY_COMMANDS_2_EXTENSION_NAME);
+        mEnabledDeviceExtensions.push_back(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME);
+        mEnabledDeviceExtensions.push_back(VK_EXT_HOST_IMAGE_COPY_EXTENSION_NAME);
+        vk::AddToPNextChain(&mEnabledFeatures, &mHostImageCopyFeatures);
+    }
+
     if (getFeatures().supportsPipelineCreationCacheControl.enabled)
     {
         mEnabledDeviceExtensions.push_back(VK_EXT_PIPELINE_CREATION_CACHE_CONTROL_EXTENSION_NAME);
@@ -2590,13 +2869,43 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     uint32_t queueCount = std::min(queueFamily.getDeviceQueueCount(),
                                    static_cast<uint32_t>(egl::ContextPriority::EnumCount));
 
+    // The present thread gets the queue after the ones used for submissions, if there is one.  The
+    // family is the same, so presentation support of surfaces is unaffected.
+    const bool usePresentThread =
+        getFeatures().asyncPresent.enabled && queueFamily.getDeviceQueueCount() > queueCount;
+
+    std::array<float, vk::QueueFamily::kQueueCount + 1> queuePriorities;
+    std::copy(std::begin(vk::QueueFamily::kQueuePriorities),
+              std::end(vk::QueueFamily::kQueuePriorities), queuePriorities.begin());
+    queuePriorities[queueCount] = vk::QueueFamily::kPresentQueuePriority;
+
     uint32_t queueCreateInfoCount              = 1;
-    VkDeviceQueueCreateInfo queueCreateInfo[1] = {};
+    VkDeviceQueueCreateInfo queueCreateInfo[2] = {};
     queueCreateInfo[0].sType                   = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
     queueCreateInfo[0].flags = enableProtectedContent ? VK_DEVICE_QUEUE_CREATE_PROTECTED_BIT : 0;
     queueCreateInfo[0].queueFamilyIndex = queueFamilyIndex;
-    queueCreateInfo[0].queueCount       = queueCount;
-    queueCreateInfo[0].pQueuePriorities = vk::QueueFamily::kQueuePriorities;
+    queueCreateInfo[0].queueCount       = queueCount + (usePresentThread ? 1 : 0);
+    queueCreateInfo[0].pQueuePriorities = queuePriorities.data();
+
+    // The transfer queue needs timeline semaphores for the graphics queues to wait on it.
+    vk::QueueFamily transferQueueFamily;
+    if (getFeatures().useTransferQueueForUploads.enabled &&
+        getFeatures().supportsTimelineSemaphore.enabled)
+    {
+        uint32_t transferQueueFamilyIndex = FindTransferOnlyQueueFamily(mQueueFamilyProperties);
+        if (transferQueueFamilyIndex != vk::QueueFamily::kInvalidIndex)
+        {
+            transferQueueFamily.initialize(mQueueFamilyProperties[transferQueueFamilyIndex],
+                                           transferQueueFamilyIndex);
+
+            queueCreateInfo[1].sType            = VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO;
+            queueCreateInfo[1].flags            = 0;
+            queueCreateInfo[1].queueFamilyIndex = transferQueueFamilyIndex;
+            queueCreateInfo[1].queueCount       = 1;
+            queueCreateInfo[1].pQueuePriorities = &vk::QueueFamily::kTransferQueuePriority;
+            ++queueCreateInfoCount;
+        }
+    }
 
     // Create Device
     createInfo.sType                 = VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO;
@@ -2620,7 +2929,15 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
         vk::AppendToPNextChain(&createInfo, mEnabledFeatures.pNext);
     }
 
-    ANGLE_VK_TRY(displayVk, vkCreateDevice(mPhysicalDevice, &createInfo, nullptr, &mDevice));
+    // Objects created from the device without their own callbacks have their host memory allocated
+    // with the device's.
+    if (getFeatures().useHostAllocationCallbacks.enabled)
+    {
+        mHostAllocator.init(&mMemoryReport);
+    }
+
+    ANGLE_VK_TRY(displayVk, vkCreateDevice(mPhysicalDevice, &createInfo,
+                                           mHostAllocator.getCallbacks(), &mDevice));
 #if defined(ANGLE_SHARED_LIBVULKAN)
     // Load volk if we are loading dynamically
     volkLoadDevice(mDevice);
@@ -2638,6 +2955,20 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
         ANGLE_TRY(mCommandQueue.init(displayVk, graphicsQueueMap));
     }
 
+    if (usePresentThread)
+    {
+        VkQueue presentQueue = VK_NULL_HANDLE;
+        queueFamily.getDeviceQueue(mDevice, enableProtectedContent, queueCount, &presentQueue);
+        mPresentThread.init(presentQueue);
+    }
+
+    if (transferQueueFamily.valid())
+    {
+        VkQueue transferQueue = VK_NULL_HANDLE;
+        transferQueueFamily.getDeviceQueue(mDevice, false, 0, &transferQueue);
+        ANGLE_TRY(mTransferQueue.init(displayVk, transferQueueFamily.getIndex(), transferQueue));
+    }
+
 #if defined(ANGLE_SHARED_LIBVULKAN)
     // Avoid compiler warnings on unused-but-set variables.
     ANGLE_UNUSED_VARIABLE(hasGetMemoryRequirements2KHR);
@@ -2675,8 +3006,25 @@ angle::Result RendererVk::initializeDevice(DisplayVk *displayVk, uint32_t queueF
     {
                        InitExtendedDynamicState2EXTFunctions(mDevice);
     }
+    if (getFeatures().supportsDescriptorUpdateTemplate.enabled)
+    {
+        InitDescriptorUpdateTemplateKHRFunctions(mDevice);
+    }
+    if (getFeatures().supportsTimelineSemaphore.enabled)
+    {
+        InitTimelineSemaphoreKHRFunctions(mDevice);
+    }
+    if (getFeatures().supportsPresentWait.enabled)
+    {
+        InitPresentWaitKHRFunctions(mDevice);
+    }
 #endif  // !defined(ANGLE_SHARED_LIBVULKAN)
 
+    if (getFeatures().supportsHostImageCopy.enabled)
+    {
+        InitHostImageCopyEXTFunctions(mDevice);
+    }
+
     if (getFeatures().forceMaxUniformBufferSize16KB.enabled)
     {
         mDefaultUniformBufferSize = kMinDefaultUniformBufferSize;
@@ -3155,6 +3503,31 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
         &mFeatures, supportsRenderpass2,
         ExtensionFound(VK_KHR_CREATE_RENDERPASS_2_EXTENSION_NAME, deviceExtensionNames));
 
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsDescriptorUpdateTemplate,
+        ExtensionFound(VK_KHR_DESCRIPTOR_UPDATE_TEMPLATE_EXTENSION_NAME, deviceExtensionNames));
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsTimelineSemaphore,
+                            mTimelineSemaphoreFeatures.timelineSemaphore == VK_TRUE);
+
+    // Opt-in until it has been measured on more drivers.
+    ANGLE_FEATURE_CONDITION(&mFeatures, useTimelineSemaphoreForQueueSerials, false);
+
+    ANGLE_FEATURE_CONDITION(&mFeatures, supportsPresentWait,
+                            displayVk->isUsingSwapchain() &&
+                                mPresentIdFeatures.presentId == VK_TRUE &&
+                                mPresentWaitFeatures.presentWait == VK_TRUE);
+
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsCalibratedTimestamps,
+        CanCalibrateDeviceTimestamps(mInstance, mPhysicalDevice, deviceExtensionNames));
+
+    // Disabled by default until the dispatch is measured to beat the CPU conversion on a device.
+    ANGLE_FEATURE_CONDITION(&mFeatures, convertRgbTextureUploadsWithCompute, false);
+
+    // Disabled by default, as the levels that are not allocated are not visible to textureSize().
+    ANGLE_FEATURE_CONDITION(&mFeatures, deferImmutableTextureLevelAllocation, false);
+
     ANGLE_FEATURE_CONDITION(
         &mFeatures, supportsIncrementalPresent,
         ExtensionFound(VK_KHR_INCREMENTAL_PRESENT_EXTENSION_NAME, deviceExtensionNames));
@@ -3344,6 +3717,11 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
         &mFeatures, supportsExternalMemoryHost,
         ExtensionFound(VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME, deviceExtensionNames));
 
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsMemoryBudget,
+        ExtensionFound(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, deviceExtensionNames) &&
+            vkGetPhysicalDeviceMemoryProperties2KHR != nullptr);
+
     // Android pre-rotation support can be disabled.
     ANGLE_FEATURE_CONDITION(&mFeatures, enablePreRotateSurfaces,
                             IsAndroid() && supportsNegativeViewport);
@@ -3369,6 +3747,53 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
     // Currently disabled by default: http://anglebug.com/4324
     ANGLE_FEATURE_CONDITION(&mFeatures, asyncCommandQueue, false);
 
+    // Currently disabled by default.  Only takes effect if the graphics queue family has a queue
+    // to spare for presentation.
+    ANGLE_FEATURE_CONDITION(&mFeatures, asyncPresent, false);
+
+    // Currently disabled by default.  Only takes effect if timeline semaphores are supported and
+    // the device has a transfer-only queue family, which is typical of discrete GPUs.
+    ANGLE_FEATURE_CONDITION(&mFeatures, useTransferQueueForUploads, false);
+
+    // Currently disabled by default.  Gives the driver ANGLE's host allocator, which serves command
+    // scope allocations from per-thread arenas and reports host memory with logMemoryReportStats.
+    ANGLE_FEATURE_CONDITION(&mFeatures, useHostAllocationCallbacks, false);
+
+    // Trades extra pipeline creations for shorter draw call stalls on pipeline cache misses.
+    // Currently disabled by default.
+    ANGLE_FEATURE_CONDITION(&mFeatures, asyncGraphicsPipelineCreation, false);
+
+    // Grows program binaries by the descriptions of the pipelines that were used with the program.
+    // Currently disabled by default.
+    ANGLE_FEATURE_CONDITION(&mFeatures, warmUpGraphicsPipelinesOnProgramLoad, false);
+
+    // Only beneficial for render passes with many draw calls, which must then replay the current
+    // state in every Vulkan secondary command buffer.  Currently disabled by default.
+    ANGLE_FEATURE_CONDITION(&mFeatures, replayRenderPassCommandsInParallel, false);
+
+    // Hashing the input SPIR-V is not much cheaper than transforming it, so this only pays off when
+    // the application's blob cache persists the results across runs.  Currently disabled by
+    // default.
+    ANGLE_FEATURE_CONDITION(&mFeatures, cacheTransformedSpirv, false);
+
+    // Drivers are expected to optimize the SPIR-V themselves, so this is only useful where their
+    // compiler is known to generate poor code from ANGLE's SPIR-V.  The optimization results are
+    // cached along with the transformed SPIR-V when cacheTransformedSpirv is enabled.  Currently
+    // disabled by default.
+    ANGLE_FEATURE_CONDITION(&mFeatures, optimizeSpirv, false);
+
+    // Unrolling loops with constant bounds in the translator lets the expressions of the loop index
+    // be folded, for drivers that don't do it well themselves.  Currently disabled by default.
+    ANGLE_FEATURE_CONDITION(&mFeatures, unrollConstantLoops, false);
+
+    // Default uniforms that fit in the push constant range that every device supports can skip
+    // the uniform buffer and its descriptor.  Currently disabled by default.
+    ANGLE_FEATURE_CONDITION(&mFeatures, promoteDefaultUniformsToPushConstants, false);
+
+    // Keeps up to a handful of external buffers alive after the application has destroyed all the
+    // EGL images created from them.  Currently disabled by default.
+    ANGLE_FEATURE_CONDITION(&mFeatures, reuseImportedExternalImages, false);
+
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsYUVSamplerConversion,
                             mSamplerYcbcrConversionFeatures.samplerYcbcrConversion != VK_FALSE);
 
@@ -3417,6 +3842,24 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
         &mFeatures, supportsImageFormatList,
         ExtensionFound(VK_KHR_IMAGE_FORMAT_LIST_EXTENSION_NAME, deviceExtensionNames));
 
+    // VK_KHR_imageless_framebuffer depends on VK_KHR_maintenance2 and VK_KHR_image_format_list.
+    // The formats the attachments may be viewed with are part of the framebuffer, so imageless
+    // framebuffers are only used along with the image format lists.
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsImagelessFramebuffer,
+        mImagelessFramebufferFeatures.imagelessFramebuffer == VK_TRUE &&
+            ExtensionFound(VK_KHR_MAINTENANCE_2_EXTENSION_NAME, deviceExtensionNames) &&
+            mFeatures.supportsImageFormatList.enabled);
+
+    // Host image copies are only used to upload to images in the TRANSFER_DST_OPTIMAL layout, which
+    // is what the staged uploads leave the images in.
+    ANGLE_FEATURE_CONDITION(
+        &mFeatures, supportsHostImageCopy,
+        mHostImageCopyFeatures.hostImageCopy == VK_TRUE &&
+            ExtensionFound(VK_KHR_COPY_COMMANDS_2_EXTENSION_NAME, deviceExtensionNames) &&
+            ExtensionFound(VK_KHR_FORMAT_FEATURE_FLAGS_2_EXTENSION_NAME, deviceExtensionNames) &&
+            isHostImageCopyDstLayout(VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL));
+
     // Feature disabled due to driver bugs:
     //
     // - Swiftshader:
@@ -3546,6 +3989,12 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsExtendedDynamicState2,
                             mExtendedDynamicState2Features.extendedDynamicState2 == VK_TRUE);
 
+    // Without VK_EXT_extended_dynamic_state3's dynamicPrimitiveTopologyUnrestricted, the dynamic
+    // topology must belong to the same class as the one the pipeline is created with, so only
+    // strips and fans are folded into their list counterparts.
+    ANGLE_FEATURE_CONDITION(&mFeatures, useDynamicPrimitiveTopology,
+                            mFeatures.supportsExtendedDynamicState.enabled);
+
     // Support GL_QCOM_shading_rate extension
     ANGLE_FEATURE_CONDITION(&mFeatures, supportsFragmentShadingRate,
                             canSupportFragmentShadingRate(deviceExtensionNames));
@@ -3558,6 +4007,10 @@ void RendererVk::initFeatures(DisplayVk *displayVk,
     // Only enable it on integrations without EGL_FRONT_BUFFER_AUTO_REFRESH_ANDROID passthrough.
     ANGLE_FEATURE_CONDITION(&mFeatures, forceContinuousRefreshOnSharedPresent, false);
 
+    // Uploads below a few megabytes are still converted on the calling thread, so this only
+    // affects the large uploads that are bound by the speed of the conversion.
+    ANGLE_FEATURE_CONDITION(&mFeatures, loadTextureDataInParallel, true);
+
     ApplyFeatureOverrides(&mFeatures, displayVk->getState());
 
     // Disable async command queue when using Vulkan secondary command buffers temporarily to avoid
@@ -3752,7 +4205,8 @@ angle::Result RendererVk::syncPipelineCacheVk(DisplayVk *displayVk, const gl::Co
                 displayVk, contextVk, std::move(pipelineCacheData), kMaxTotalSize);
         mCompressEvent = std::make_shared<WaitableCompressEventImpl>(
             angle::WorkerThreadPool::PostWorkerTask(context->getWorkerThreadPool(),
-                                                    compressAndStorePipelineCacheTask),
+                                                    compressAndStorePipelineCacheTask,
+                                                    angle::WorkerTaskPriority::Low),
             compressAndStorePipelineCacheTask);
     }
     else
@@ -3817,6 +4271,33 @@ void RendererVk::outputVmaStatString()
     mAllocator.freeStatsString(statsString);
 }
 
+bool RendererVk::isMemoryBudgetUnderPressure() const
+{
+    ASSERT(getFeatures().supportsMemoryBudget.enabled);
+
+    VkPhysicalDeviceMemoryBudgetPropertiesEXT memoryBudget = {};
+    memoryBudget.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT;
+
+    VkPhysicalDeviceMemoryProperties2 memoryProperties = {};
+    memoryProperties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2;
+    memoryProperties.pNext = &memoryBudget;
+
+    vkGetPhysicalDeviceMemoryProperties2KHR(mPhysicalDevice, &memoryProperties);
+
+    const uint32_t heapCount = memoryProperties.memoryProperties.memoryHeapCount;
+    for (uint32_t heapIndex = 0; heapIndex < heapCount; ++heapIndex)
+    {
+        const VkDeviceSize budget = memoryBudget.heapBudget[heapIndex];
+        const VkDeviceSize usage  = memoryBudget.heapUsage[heapIndex];
+        if (budget > 0 && usage >= budget / 100 * kMemoryBudgetPressurePercent)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 angle::Result RendererVk::queueSubmitOneOff(vk::Context *context,
                                             vk::PrimaryCommandBuffer &&primary,
                                             bool hasProtectedContent,
@@ -4344,6 +4825,14 @@ VkResult RendererVk::queuePresent(vk::Context *context,
     {
         result = mCommandProcessor.queuePresent(priority, presentInfo);
     }
+    else if (isPresentThreadEnabled())
+    {
+        // The submission that signals the present's wait semaphore has already been made.  As with
+        // the async command queue, the result is retrieved with getLastPresentResult.
+        vk::CommandProcessorTask task;
+        task.initPresent(priority, presentInfo);
+        mPresentThread.enqueue(std::move(task));
+    }
     else
     {
         result = mCommandQueue.queuePresent(priority, presentInfo);
@@ -4418,10 +4907,11 @@ void RendererVk::logCacheStats() const
     std::unique_lock<std::mutex> localLock(mCacheStatsMutex);
 
     int cacheType = 0;
-    INFO() << "Vulkan object cache hit ratios: ";
+    INFO() << "Vulkan object cache hit ratios and sizes: ";
     for (const CacheStats &stats : mVulkanCacheStats)
     {
-        INFO() << "    CacheType " << cacheType++ << ": " << stats.getHitRatio();
+        INFO() << "    CacheType " << cacheType++ << ": " << stats.getHitRatio() << " ("
+               << stats.getSize() << " entries)";
     }
 }
 
@@ -4463,6 +4953,51 @@ angle::Result RendererVk::getFormatDescriptorCountForVkFormat(ContextVk *context
     return angle::Result::Continue;
 }
 
+bool RendererVk::isHostImageCopyOptimal(VkFormat format,
+                                        VkImageType imageType,
+                                        VkImageUsageFlags usage,
+                                        VkImageCreateFlags createFlags) const
+{
+    ASSERT(getFeatures().supportsHostImageCopy.enabled);
+
+    VkPhysicalDeviceImageFormatInfo2 imageFormatInfo = {};
+    imageFormatInfo.sType  = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2;
+    imageFormatInfo.format = format;
+    imageFormatInfo.type   = imageType;
+    imageFormatInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+    imageFormatInfo.usage  = usage | VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT;
+    imageFormatInfo.flags  = createFlags;
+
+    VkHostImageCopyDevicePerformanceQueryEXT performanceQuery = {};
+    performanceQuery.sType = VK_STRUCTURE_TYPE_HOST_IMAGE_COPY_DEVICE_PERFORMANCE_QUERY_EXT;
+
+    VkImageFormatProperties2 imageFormatProperties = {};
+    imageFormatProperties.sType = VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2;
+    imageFormatProperties.pNext = &performanceQuery;
+
+    if (vkGetPhysicalDeviceImageFormatProperties2(mPhysicalDevice, &imageFormatInfo,
+                                                  &imageFormatProperties) != VK_SUCCESS)
+    {
+        return false;
+    }
+
+    // Host image copies may change the layout of the image in memory.  They are not worth the
+    // slower rendering and sampling of the image.
+    return performanceQuery.optimalDeviceAccess == VK_TRUE;
+}
+
+bool RendererVk::isHostImageCopySrcLayout(VkImageLayout layout) const
+{
+    return std::find(mHostImageCopySrcLayouts.begin(), mHostImageCopySrcLayouts.end(), layout) !=
+           mHostImageCopySrcLayouts.end();
+}
+
+bool RendererVk::isHostImageCopyDstLayout(VkImageLayout layout) const
+{
+    return std::find(mHostImageCopyDstLayouts.begin(), mHostImageCopyDstLayouts.end(), layout) !=
+           mHostImageCopyDstLayouts.end();
+}
+
 angle::Result RendererVk::getFormatDescriptorCountForExternalFormat(ContextVk *contextVk,
                                                                     uint64_t format,
                                                                     uint32_t *descriptorCountOut)
@@ -4508,6 +5043,26 @@ MemoryReport::MemoryReport()
       mMaxTotalImportedMemory(0)
 {}
 
+void MemoryReport::onHostAllocation(VkSystemAllocationScope scope, size_t size)
+{
+    ASSERT(static_cast<size_t>(scope) < kHostAllocationScopeCount);
+    HostMemorySizes &sizes = mHostSizesPerScope[scope];
+
+    const size_t allocatedMemory = sizes.allocatedMemory.fetch_add(size) + size;
+    size_t allocatedMemoryMax    = sizes.allocatedMemoryMax.load(std::memory_order_relaxed);
+    while (allocatedMemoryMax < allocatedMemory &&
+           !sizes.allocatedMemoryMax.compare_exchange_weak(allocatedMemoryMax, allocatedMemory))
+    {
+    }
+}
+
+void MemoryReport::onHostFree(VkSystemAllocationScope scope, size_t size)
+{
+    ASSERT(static_cast<size_t>(scope) < kHostAllocationScopeCount);
+    ASSERT(mHostSizesPerScope[scope].allocatedMemory >= size);
+    mHostSizesPerScope[scope].allocatedMemory.fetch_sub(size);
+}
+
 void MemoryReport::processCallback(const VkDeviceMemoryReportCallbackDataEXT &callbackData,
                                    bool logCallback)
 {
@@ -4609,6 +5164,229 @@ void MemoryReport::logMemoryReportStats() const
                << allocatedMemoryMax << ");  Imported=" << std::setw(10) << importedMemory
                << " (max=" << std::setw(10) << importedMemoryMax << ")";
     }
+
+    constexpr const char *kHostAllocationScopeNames[kHostAllocationScopeCount] = {
+        "Command", "Object", "Cache", "Device", "Instance",
+    };
+    bool hasHostAllocations = false;
+    for (size_t scope = 0; scope < kHostAllocationScopeCount; ++scope)
+    {
+        const size_t allocatedMemoryMax = mHostSizesPerScope[scope].allocatedMemoryMax.load();
+        if (allocatedMemoryMax == 0)
+        {
+            continue;
+        }
+        if (!hasHostAllocations)
+        {
+            INFO() << "Host memory per allocation scope:";
+            hasHostAllocations = true;
+        }
+        INFO() << std::right << "- Scope=" << std::setw(15) << kHostAllocationScopeNames[scope]
+               << ":  Allocated=" << std::setw(10)
+               << mHostSizesPerScope[scope].allocatedMemory.load()
+               << " (max=" << std::setw(10) << allocatedMemoryMax << ")";
+    }
+}
+
+namespace
+{
+class CommandScopeArena;
+
+// Stored right before each allocation made by HostAllocator.
+struct HostAllocationHeader
+{
+    void *block;
+    size_t size;
+    CommandScopeArena *arena;
+    VkSystemAllocationScope scope;
+};
+
+HostAllocationHeader *GetHostAllocationHeader(void *memory)
+{
+    return reinterpret_cast<HostAllocationHeader *>(static_cast<uint8_t *>(memory) -
+                                                    sizeof(HostAllocationHeader));
+}
+
+// Command scope allocations are freed before the Vulkan command that made them returns, so they
+// are taken linearly from a per-thread block that is rewound once none of them is alive.
+class CommandScopeArena final : angle::NonCopyable
+{
+  public:
+    static constexpr size_t kSize      = 64 * 1024;
+    static constexpr size_t kAlignment = 64;
+
+    CommandScopeArena()
+        : mStorage(static_cast<uint8_t *>(angle::AlignedAlloc(kSize, kAlignment))),
+          mOffset(0),
+          mLiveAllocationCount(0)
+    {}
+    ~CommandScopeArena() { angle::AlignedFree(mStorage); }
+
+    // Returns nullptr if the allocation doesn't fit, in which case it's taken from the heap.
+    void *allocate(size_t size, size_t alignment)
+    {
+        // Only the owning thread allocates, but the driver may free from another thread.
+        if (mLiveAllocationCount.load(std::memory_order_acquire) == 0)
+        {
+            mOffset = 0;
+        }
+
+        if (mStorage == nullptr || alignment > kAlignment || size > kSize)
+        {
+            return nullptr;
+        }
+
+        const size_t offset = roundUp(mOffset, alignment);
+        if (offset > kSize - size)
+        {
+            return nullptr;
+        }
+
+        mOffset = offset + size;
+        mLiveAllocationCount.fetch_add(1, std::memory_order_relaxed);
+        return mStorage + offset;
+    }
+
+    void free() { mLiveAllocationCount.fetch_sub(1, std::memory_order_release); }
+
+  private:
+    uint8_t *mStorage;
+    size_t mOffset;
+    std::atomic<uint32_t> mLiveAllocationCount;
+};
+
+CommandScopeArena *GetCommandScopeArena()
+{
+    thread_local CommandScopeArena arena;
+    return &arena;
+}
+}  // anonymous namespace
+
+HostAllocator::HostAllocator() : mMemoryReport(nullptr), mCallbacks{} {}
+
+void HostAllocator::init(MemoryReport *memoryReport)
+{
+    mMemoryReport                    = memoryReport;
+    mCallbacks.pUserData             = this;
+    mCallbacks.pfnAllocation         = &Allocate;
+    mCallbacks.pfnReallocation       = &Reallocate;
+    mCallbacks.pfnFree               = &Free;
+    mCallbacks.pfnInternalAllocation = &OnInternalAllocation;
+    mCallbacks.pfnInternalFree       = &OnInternalFree;
+}
+
+// static
+VKAPI_ATTR void *VKAPI_CALL HostAllocator::Allocate(void *userData,
+                                                    size_t size,
+                                                    size_t alignment,
+                                                    VkSystemAllocationScope scope)
+{
+    if (size == 0)
+    {
+        return nullptr;
+    }
+
+    // The header is placed right before the returned memory, in the space reserved for alignment.
+    alignment                 = std::max(alignment, alignof(HostAllocationHeader));
+    const size_t headerOffset = roundUp(sizeof(HostAllocationHeader), alignment);
+    const size_t blockSize    = headerOffset + size;
+
+    CommandScopeArena *arena = nullptr;
+    void *block              = nullptr;
+    if (scope == VK_SYSTEM_ALLOCATION_SCOPE_COMMAND)
+    {
+        arena = GetCommandScopeArena();
+        block = arena->allocate(blockSize, alignment);
+        if (block == nullptr)
+        {
+            arena = nullptr;
+        }
+    }
+    if (block == nullptr)
+    {
+        block = angle::AlignedAlloc(blockSize, alignment);
+        if (block == nullptr)
+        {
+            return nullptr;
+        }
+    }
+
+    void *memory                 = static_cast<uint8_t *>(block) + headerOffset;
+    HostAllocationHeader *header = GetHostAllocationHeader(memory);
+    header->block                = block;
+    header->size                 = size;
+    header->arena                = arena;
+    header->scope                = scope;
+
+    static_cast<HostAllocator *>(userData)->mMemoryReport->onHostAllocation(scope, size);
+    return memory;
+}
+
+// static
+VKAPI_ATTR void *VKAPI_CALL HostAllocator::Reallocate(void *userData,
+                                                      void *original,
+                                                      size_t size,
+                                                      size_t alignment,
+                                                      VkSystemAllocationScope scope)
+{
+    if (original == nullptr)
+    {
+        return Allocate(userData, size, alignment, scope);
+    }
+
+    if (size == 0)
+    {
+        Free(userData, original);
+        return nullptr;
+    }
+
+    // On failure, the original allocation must be left untouched.
+    void *memory = Allocate(userData, size, alignment, scope);
+    if (memory != nullptr)
+    {
+        memcpy(memory, original, std::min(size, GetHostAllocationHeader(original)->size));
+        Free(userData, original);
+    }
+    return memory;
+}
+
+// static
+VKAPI_ATTR void VKAPI_CALL HostAllocator::Free(void *userData, void *memory)
+{
+    if (memory == nullptr)
+    {
+        return;
+    }
+
+    HostAllocationHeader *header = GetHostAllocationHeader(memory);
+    static_cast<HostAllocator *>(userData)->mMemoryReport->onHostFree(header->scope, header->size);
+
+    if (header->arena != nullptr)
+    {
+        header->arena->free();
+    }
+    else
+    {
+        angle::AlignedFree(header->block);
+    }
+}
+
+// static
+VKAPI_ATTR void VKAPI_CALL HostAllocator::OnInternalAllocation(void *userData,
+                                                               size_t size,
+                                                               VkInternalAllocationType type,
+                                                               VkSystemAllocationScope scope)
+{
+    static_cast<HostAllocator *>(userData)->mMemoryReport->onHostAllocation(scope, size);
+}
+
+// static
+VKAPI_ATTR void VKAPI_CALL HostAllocator::OnInternalFree(void *userData,
+                                                         size_t size,
+                                                         VkInternalAllocationType type,
+                                                         VkSystemAllocationScope scope)
+{
+    static_cast<HostAllocator *>(userData)->mMemoryReport->onHostFree(scope, size);
 }
 }  // namespace vk
 }  // namespace rx
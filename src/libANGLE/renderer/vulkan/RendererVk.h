@@ -10,6 +10,8 @@
 #ifndef LIBANGLE_RENDERER_VULKAN_RENDERERVK_H_
 #define LIBANGLE_RENDERER_VULKAN_RENDERERVK_H_
 
+#include <array>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <memory>
@@ -66,6 +68,10 @@ class MemoryReport final : angle::NonCopyable
     void processCallback(const VkDeviceMemoryReportCallbackDataEXT &callbackData, bool logCallback);
     void logMemoryReportStats() const;
 
+    // Host memory allocated by the driver through HostAllocator.
+    void onHostAllocation(VkSystemAllocationScope scope, size_t size);
+    void onHostFree(VkSystemAllocationScope scope, size_t size);
+
   private:
     struct MemorySizes
     {
@@ -81,6 +87,56 @@ class MemoryReport final : angle::NonCopyable
     VkDeviceSize mCurrentTotalImportedMemory;
     VkDeviceSize mMaxTotalImportedMemory;
     angle::HashMap<uint64_t, int> mUniqueIDCounts;
+
+    // Host allocations are much more frequent than device memory reports, so they are counted with
+    // atomics instead of under mMemoryReportMutex.
+    struct HostMemorySizes
+    {
+        std::atomic<size_t> allocatedMemory{0};
+        std::atomic<size_t> allocatedMemoryMax{0};
+    };
+    static constexpr size_t kHostAllocationScopeCount = VK_SYSTEM_ALLOCATION_SCOPE_INSTANCE + 1;
+    std::array<HostMemorySizes, kHostAllocationScopeCount> mHostSizesPerScope;
+};
+
+// Host memory allocator given to the driver with VkAllocationCallbacks.  Command scope allocations,
+// which only live for the duration of a Vulkan command, are taken from a per-thread arena instead
+// of the heap.  Every allocation is reported to the MemoryReport.
+class HostAllocator final : angle::NonCopyable
+{
+  public:
+    HostAllocator();
+
+    void init(MemoryReport *memoryReport);
+
+    // Returns nullptr if the allocator is not in use, so that the driver uses its own.
+    const VkAllocationCallbacks *getCallbacks() const
+    {
+        return mMemoryReport != nullptr ? &mCallbacks : nullptr;
+    }
+
+  private:
+    static VKAPI_ATTR void *VKAPI_CALL Allocate(void *userData,
+                                                size_t size,
+                                                size_t alignment,
+                                                VkSystemAllocationScope scope);
+    static VKAPI_ATTR void *VKAPI_CALL Reallocate(void *userData,
+                                                  void *original,
+                                                  size_t size,
+                                                  size_t alignment,
+                                                  VkSystemAllocationScope scope);
+    static VKAPI_ATTR void VKAPI_CALL Free(void *userData, void *memory);
+    static VKAPI_ATTR void VKAPI_CALL OnInternalAllocation(void *userData,
+                                                           size_t size,
+                                                           VkInternalAllocationType type,
+                                                           VkSystemAllocationScope scope);
+    static VKAPI_ATTR void VKAPI_CALL OnInternalFree(void *userData,
+                                                     size_t size,
+                                                     VkInternalAllocationType type,
+                                                     VkSystemAllocationScope scope);
+
+    MemoryReport *mMemoryReport;
+    VkAllocationCallbacks mCallbacks;
 };
 
 // Information used to accurately skip known synchronization issues in ANGLE.
@@ -439,11 +495,48 @@ class RendererVk : angle::NonCopyable
         }
     }
 
+    // Time from queueing a submission to the command processor thread until it is submitted to
+    // the queue of |priority|, at |percentile| of recent submissions.  Only tracked when
+    // asyncCommandQueue is enabled; there is no such delay otherwise.
+    uint64_t getCommandProcessorSubmitLatencyPercentileNs(egl::ContextPriority priority,
+                                                          uint32_t percentile) const
+    {
+        return isAsyncCommandQueueEnabled()
+                   ? mCommandProcessor.getSubmitLatencyPercentileNs(priority, percentile)
+                   : 0;
+    }
+
     egl::Display *getDisplay() const { return mDisplay; }
 
+    // Only valid when the async command queue or the present thread is in use.  Otherwise, the
+    // result of the present is returned by queuePresent.
     VkResult getLastPresentResult(VkSwapchainKHR swapchain)
     {
-        return mCommandProcessor.getLastPresentResult(swapchain);
+        VkResult result = VK_SUCCESS;
+        if (isAsyncCommandQueueEnabled())
+        {
+            result = mCommandProcessor.getLastPresentResult(swapchain);
+        }
+        if (result == VK_SUCCESS && isPresentThreadEnabled())
+        {
+            result = mPresentThread.waitForPresents(swapchain);
+        }
+        return result;
+    }
+
+    // The present thread is only created if asyncPresent is enabled and the queue family has a
+    // queue to spare for it.
+    bool isPresentThreadEnabled() const { return mPresentThread.valid(); }
+    vk::PresentThread &getPresentThread() { return mPresentThread; }
+    // The transfer queue is only created if useTransferQueueForUploads is enabled and the device
+    // has a transfer-only queue family.
+    vk::TransferQueue &getTransferQueue() { return mTransferQueue; }
+    void waitForPresentThreadIdle()
+    {
+        if (isPresentThreadEnabled())
+        {
+            mPresentThread.waitIdle();
+        }
     }
 
     bool enableDebugUtils() const { return mEnableDebugUtils; }
@@ -451,6 +544,7 @@ class RendererVk : angle::NonCopyable
 
     SamplerCache &getSamplerCache() { return mSamplerCache; }
     SamplerYcbcrConversionCache &getYuvConversionCache() { return mYuvConversionCache; }
+    UtilsProgramsVk &getUtilsPrograms() { return mUtilsPrograms; }
 
     void onAllocateHandle(vk::HandleType handleType);
     void onDeallocateHandle(vk::HandleType handleType);
@@ -463,6 +557,10 @@ class RendererVk : angle::NonCopyable
 
     void outputVmaStatString();
 
+    // Returns whether any memory heap's usage is close to the budget reported by
+    // VK_EXT_memory_budget.  Requires supportsMemoryBudget.
+    bool isMemoryBudgetUnderPressure() const;
+
     bool haveSameFormatFeatureBits(angle::FormatID formatID1, angle::FormatID formatID2) const;
 
     void cleanupGarbage(Serial lastCompletedQueueSerial);
@@ -545,6 +643,16 @@ class RendererVk : angle::NonCopyable
                                                             uint64_t format,
                                                             uint32_t *descriptorCountOut);
 
+    // Whether images of these properties can be created with VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT
+    // without making device access to them any slower.
+    bool isHostImageCopyOptimal(VkFormat format,
+                                VkImageType imageType,
+                                VkImageUsageFlags usage,
+                                VkImageCreateFlags createFlags) const;
+    // Whether host image copies can transition images out of, or copy to images in, this layout.
+    bool isHostImageCopySrcLayout(VkImageLayout layout) const;
+    bool isHostImageCopyDstLayout(VkImageLayout layout) const;
+
     VkDeviceSize getMaxCopyBytesUsingCPUWhenPreservingBufferData() const
     {
         return mMaxCopyBytesUsingCPUWhenPreservingBufferData;
@@ -692,6 +800,10 @@ class RendererVk : angle::NonCopyable
     VkPhysicalDeviceProtectedMemoryFeatures mProtectedMemoryFeatures;
     VkPhysicalDeviceProtectedMemoryProperties mProtectedMemoryProperties;
     VkPhysicalDeviceHostQueryResetFeaturesEXT mHostQueryResetFeatures;
+    VkPhysicalDeviceImagelessFramebufferFeaturesKHR mImagelessFramebufferFeatures;
+    VkPhysicalDeviceTimelineSemaphoreFeaturesKHR mTimelineSemaphoreFeatures;
+    VkPhysicalDevicePresentIdFeaturesKHR mPresentIdFeatures;
+    VkPhysicalDevicePresentWaitFeaturesKHR mPresentWaitFeatures;
     VkPhysicalDeviceDepthClipControlFeaturesEXT mDepthClipControlFeatures;
     VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT mBlendOperationAdvancedFeatures;
     VkPhysicalDeviceSamplerYcbcrConversionFeatures mSamplerYcbcrConversionFeatures;
@@ -699,6 +811,10 @@ class RendererVk : angle::NonCopyable
     VkPhysicalDeviceExtendedDynamicStateFeaturesEXT mExtendedDynamicStateFeatures;
     VkPhysicalDeviceExtendedDynamicState2FeaturesEXT mExtendedDynamicState2Features;
     VkPhysicalDeviceFragmentShadingRateFeaturesKHR mFragmentShadingRateFeatures;
+    VkPhysicalDeviceHostImageCopyFeaturesEXT mHostImageCopyFeatures;
+    VkPhysicalDeviceHostImageCopyPropertiesEXT mHostImageCopyProperties;
+    std::vector<VkImageLayout> mHostImageCopySrcLayouts;
+    std::vector<VkImageLayout> mHostImageCopyDstLayouts;
     angle::PackedEnumBitSet<gl::ShadingRate, uint8_t> mSupportedFragmentShadingRates;
     std::vector<VkQueueFamilyProperties> mQueueFamilyProperties;
     uint32_t mMaxVertexAttribDivisor;
@@ -797,6 +913,13 @@ class RendererVk : angle::NonCopyable
     // Async Command Queue
     vk::CommandProcessor mCommandProcessor;
 
+    // Presents on a queue of its own when asyncPresent is enabled.
+    vk::PresentThread mPresentThread;
+
+    // Copies large uploads on a queue of a transfer-only family when useTransferQueueForUploads is
+    // enabled.
+    vk::TransferQueue mTransferQueue;
+
     // Command buffer pool management.
     std::mutex mCommandBufferRecyclerMutex;
     vk::CommandBufferHandleAllocator mCommandBufferHandleAllocator;
@@ -808,6 +931,7 @@ class RendererVk : angle::NonCopyable
 
     SamplerCache mSamplerCache;
     SamplerYcbcrConversionCache mYuvConversionCache;
+    UtilsProgramsVk mUtilsPrograms;
     angle::HashMap<VkFormat, uint32_t> mVkFormatDescriptorCountMap;
     vk::ActiveHandleCounter mActiveHandleCounts;
     std::mutex mActiveHandleCountsMutex;
@@ -819,6 +943,8 @@ class RendererVk : angle::NonCopyable
     VkApplicationInfo mApplicationInfo;
     // Process GPU memory reports
     vk::MemoryReport mMemoryReport;
+    // Host memory allocator of the device, if useHostAllocationCallbacks is enabled
+    vk::HostAllocator mHostAllocator;
     // Helpers for adding trace annotations
     DebugAnnotatorVk mAnnotator;
 
@@ -8,6 +8,9 @@
 //
 
 #include "libANGLE/renderer/vulkan/SecondaryCommandBuffer.h"
+
+#include <algorithm>
+
 #include "common/debug.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
 #include "libANGLE/trace.h"
@@ -138,6 +141,8 @@ const char *GetCommandString(CommandID id)
             return "SetLineWidth";
         case CommandID::SetPrimitiveRestartEnable:
             return "SetPrimitiveRestartEnable";
+        case CommandID::SetPrimitiveTopology:
+            return "SetPrimitiveTopology";
         case CommandID::SetRasterizerDiscardEnable:
             return "SetRasterizerDiscardEnable";
         case CommandID::SetScissor:
@@ -172,6 +177,553 @@ ANGLE_INLINE const CommandHeader *NextCommand(const CommandHeader *command)
                                                    command->size);
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::executeCommand(VkCommandBuffer cmdBuffer,
+                                                        const CommandHeader *command) const
+{
+    switch (command->id)
+    {
+        case CommandID::BeginDebugUtilsLabel:
+        {
+            const DebugUtilsLabelParams *params = getParamPtr<DebugUtilsLabelParams>(command);
+            const char *pLabelName = Offset<char>(params, sizeof(DebugUtilsLabelParams));
+            const VkDebugUtilsLabelEXT label = {
+                VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT,
+                nullptr,
+                pLabelName,
+                {params->color[0], params->color[1], params->color[2], params->color[3]}};
+            ASSERT(vkCmdBeginDebugUtilsLabelEXT);
+            vkCmdBeginDebugUtilsLabelEXT(cmdBuffer, &label);
+            break;
+        }
+        case CommandID::BeginQuery:
+        {
+            const BeginQueryParams *params = getParamPtr<BeginQueryParams>(command);
+            vkCmdBeginQuery(cmdBuffer, params->queryPool, params->query, params->flags);
+            break;
+        }
+        case CommandID::BeginTransformFeedback:
+        {
+            const BeginTransformFeedbackParams *params =
+                getParamPtr<BeginTransformFeedbackParams>(command);
+            const VkBuffer *counterBuffers =
+                Offset<VkBuffer>(params, sizeof(BeginTransformFeedbackParams));
+            const VkDeviceSize *counterBufferOffsets =
+                reinterpret_cast<const VkDeviceSize *>(counterBuffers + params->bufferCount);
+            vkCmdBeginTransformFeedbackEXT(cmdBuffer, 0, params->bufferCount, counterBuffers,
+                                           counterBufferOffsets);
+            break;
+        }
+        case CommandID::BindComputePipeline:
+        {
+            const BindPipelineParams *params = getParamPtr<BindPipelineParams>(command);
+            vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, params->pipeline);
+            break;
+        }
+        case CommandID::BindDescriptorSets:
+        {
+            const BindDescriptorSetParams *params = getParamPtr<BindDescriptorSetParams>(command);
+            const VkDescriptorSet *descriptorSets =
+                Offset<VkDescriptorSet>(params, sizeof(BindDescriptorSetParams));
+            const uint32_t *dynamicOffsets = Offset<uint32_t>(
+                descriptorSets, sizeof(VkDescriptorSet) * params->descriptorSetCount);
+            vkCmdBindDescriptorSets(cmdBuffer, params->pipelineBindPoint, params->layout,
+                                    params->firstSet, params->descriptorSetCount, descriptorSets,
+                                    params->dynamicOffsetCount, dynamicOffsets);
+            break;
+        }
+        case CommandID::BindGraphicsPipeline:
+        {
+            const BindPipelineParams *params = getParamPtr<BindPipelineParams>(command);
+            vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, params->pipeline);
+            break;
+        }
+        case CommandID::BindIndexBuffer:
+        {
+            const BindIndexBufferParams *params = getParamPtr<BindIndexBufferParams>(command);
+            vkCmdBindIndexBuffer(cmdBuffer, params->buffer, params->offset, params->indexType);
+            break;
+        }
+        case CommandID::BindTransformFeedbackBuffers:
+        {
+            const BindTransformFeedbackBuffersParams *params =
+                getParamPtr<BindTransformFeedbackBuffersParams>(command);
+            const VkBuffer *buffers =
+                Offset<VkBuffer>(params, sizeof(BindTransformFeedbackBuffersParams));
+            const VkDeviceSize *offsets =
+                Offset<VkDeviceSize>(buffers, sizeof(VkBuffer) * params->bindingCount);
+            const VkDeviceSize *sizes =
+                Offset<VkDeviceSize>(offsets, sizeof(VkDeviceSize) * params->bindingCount);
+            vkCmdBindTransformFeedbackBuffersEXT(cmdBuffer, 0, params->bindingCount, buffers,
+                                                 offsets, sizes);
+            break;
+        }
+        case CommandID::BindVertexBuffers:
+        {
+            const BindVertexBuffersParams *params = getParamPtr<BindVertexBuffersParams>(command);
+            const VkBuffer *buffers = Offset<VkBuffer>(params, sizeof(BindVertexBuffersParams));
+            const VkDeviceSize *offsets =
+                Offset<VkDeviceSize>(buffers, sizeof(VkBuffer) * params->bindingCount);
+            vkCmdBindVertexBuffers(cmdBuffer, 0, params->bindingCount, buffers, offsets);
+            break;
+        }
+        case CommandID::BindVertexBuffers2:
+        {
+            const BindVertexBuffers2Params *params = getParamPtr<BindVertexBuffers2Params>(command);
+            const VkBuffer *buffers = Offset<VkBuffer>(params, sizeof(BindVertexBuffers2Params));
+            const VkDeviceSize *offsets =
+                Offset<VkDeviceSize>(buffers, sizeof(VkBuffer) * params->bindingCount);
+            const VkDeviceSize *strides =
+                Offset<VkDeviceSize>(offsets, sizeof(VkDeviceSize) * params->bindingCount);
+            vkCmdBindVertexBuffers2EXT(cmdBuffer, 0, params->bindingCount, buffers, offsets,
+                                       nullptr, strides);
+            break;
+        }
+        case CommandID::BlitImage:
+        {
+            const BlitImageParams *params = getParamPtr<BlitImageParams>(command);
+            vkCmdBlitImage(cmdBuffer, params->srcImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                           params->dstImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1,
+                           &params->region, params->filter);
+            break;
+        }
+        case CommandID::BufferBarrier:
+        {
+            const BufferBarrierParams *params = getParamPtr<BufferBarrierParams>(command);
+            vkCmdPipelineBarrier(cmdBuffer, params->srcStageMask, params->dstStageMask, 0, 0,
+                                 nullptr, 1, &params->bufferMemoryBarrier, 0, nullptr);
+            break;
+        }
+        case CommandID::ClearAttachments:
+        {
+            const ClearAttachmentsParams *params = getParamPtr<ClearAttachmentsParams>(command);
+            const VkClearAttachment *attachments =
+                Offset<VkClearAttachment>(params, sizeof(ClearAttachmentsParams));
+            const VkClearRect *rects = Offset<VkClearRect>(
+                attachments, params->attachmentCount * sizeof(VkClearAttachment));
+            vkCmdClearAttachments(cmdBuffer, params->attachmentCount, attachments,
+                                  params->rectCount, rects);
+            break;
+        }
+        case CommandID::ClearColorImage:
+        {
+            const ClearColorImageParams *params = getParamPtr<ClearColorImageParams>(command);
+            vkCmdClearColorImage(cmdBuffer, params->image, params->imageLayout, &params->color, 1,
+                                 &params->range);
+            break;
+        }
+        case CommandID::ClearDepthStencilImage:
+        {
+            const ClearDepthStencilImageParams *params =
+                getParamPtr<ClearDepthStencilImageParams>(command);
+            vkCmdClearDepthStencilImage(cmdBuffer, params->image, params->imageLayout,
+                                        &params->depthStencil, 1, &params->range);
+            break;
+        }
+        case CommandID::CopyBuffer:
+        {
+            const CopyBufferParams *params = getParamPtr<CopyBufferParams>(command);
+            const VkBufferCopy *regions = Offset<VkBufferCopy>(params, sizeof(CopyBufferParams));
+            vkCmdCopyBuffer(cmdBuffer, params->srcBuffer, params->destBuffer, params->regionCount,
+                            regions);
+            break;
+        }
+        case CommandID::CopyBufferToImage:
+        {
+            const CopyBufferToImageParams *params = getParamPtr<CopyBufferToImageParams>(command);
+            const VkBufferImageCopy *regions =
+                Offset<VkBufferImageCopy>(params, sizeof(CopyBufferToImageParams));
+            vkCmdCopyBufferToImage(cmdBuffer, params->srcBuffer, params->dstImage,
+                                   params->dstImageLayout, params->regionCount, regions);
+            break;
+        }
+        case CommandID::CopyImage:
+        {
+            const CopyImageParams *params = getParamPtr<CopyImageParams>(command);
+            vkCmdCopyImage(cmdBuffer, params->srcImage, params->srcImageLayout, params->dstImage,
+                           params->dstImageLayout, 1, &params->region);
+            break;
+        }
+        case CommandID::CopyImageToBuffer:
+        {
+            const CopyImageToBufferParams *params = getParamPtr<CopyImageToBufferParams>(command);
+            vkCmdCopyImageToBuffer(cmdBuffer, params->srcImage, params->srcImageLayout,
+                                   params->dstBuffer, 1, &params->region);
+            break;
+        }
+        case CommandID::Dispatch:
+        {
+            const DispatchParams *params = getParamPtr<DispatchParams>(command);
+            vkCmdDispatch(cmdBuffer, params->groupCountX, params->groupCountY, params->groupCountZ);
+            break;
+        }
+        case CommandID::DispatchIndirect:
+        {
+            const DispatchIndirectParams *params = getParamPtr<DispatchIndirectParams>(command);
+            vkCmdDispatchIndirect(cmdBuffer, params->buffer, params->offset);
+            break;
+        }
+        case CommandID::Draw:
+        {
+            const DrawParams *params = getParamPtr<DrawParams>(command);
+            vkCmdDraw(cmdBuffer, params->vertexCount, 1, params->firstVertex, 0);
+            break;
+        }
+        case CommandID::DrawIndexed:
+        {
+            const DrawIndexedParams *params = getParamPtr<DrawIndexedParams>(command);
+            vkCmdDrawIndexed(cmdBuffer, params->indexCount, 1, 0, 0, 0);
+            break;
+        }
+        case CommandID::DrawIndexedBaseVertex:
+        {
+            const DrawIndexedBaseVertexParams *params =
+                getParamPtr<DrawIndexedBaseVertexParams>(command);
+            vkCmdDrawIndexed(cmdBuffer, params->indexCount, 1, 0, params->vertexOffset, 0);
+            break;
+        }
+        case CommandID::DrawIndexedIndirect:
+        {
+            const DrawIndexedIndirectParams *params =
+                getParamPtr<DrawIndexedIndirectParams>(command);
+            vkCmdDrawIndexedIndirect(cmdBuffer, params->buffer, params->offset, params->drawCount,
+                                     params->stride);
+            break;
+        }
+        case CommandID::DrawIndexedInstanced:
+        {
+            const DrawIndexedInstancedParams *params =
+                getParamPtr<DrawIndexedInstancedParams>(command);
+            vkCmdDrawIndexed(cmdBuffer, params->indexCount, params->instanceCount, 0, 0, 0);
+            break;
+        }
+        case CommandID::DrawIndexedInstancedBaseVertex:
+        {
+            const DrawIndexedInstancedBaseVertexParams *params =
+                getParamPtr<DrawIndexedInstancedBaseVertexParams>(command);
+            vkCmdDrawIndexed(cmdBuffer, params->indexCount, params->instanceCount, 0,
+                             params->vertexOffset, 0);
+            break;
+        }
+        case CommandID::DrawIndexedInstancedBaseVertexBaseInstance:
+        {
+            const DrawIndexedInstancedBaseVertexBaseInstanceParams *params =
+                getParamPtr<DrawIndexedInstancedBaseVertexBaseInstanceParams>(command);
+            vkCmdDrawIndexed(cmdBuffer, params->indexCount, params->instanceCount,
+                             params->firstIndex, params->vertexOffset, params->firstInstance);
+            break;
+        }
+        case CommandID::DrawIndirect:
+        {
+            const DrawIndirectParams *params = getParamPtr<DrawIndirectParams>(command);
+            vkCmdDrawIndirect(cmdBuffer, params->buffer, params->offset, params->drawCount,
+                              params->stride);
+            break;
+        }
+        case CommandID::DrawInstanced:
+        {
+            const DrawInstancedParams *params = getParamPtr<DrawInstancedParams>(command);
+            vkCmdDraw(cmdBuffer, params->vertexCount, params->instanceCount, params->firstVertex,
+                      0);
+            break;
+        }
+        case CommandID::DrawInstancedBaseInstance:
+        {
+            const DrawInstancedBaseInstanceParams *params =
+                getParamPtr<DrawInstancedBaseInstanceParams>(command);
+            vkCmdDraw(cmdBuffer, params->vertexCount, params->instanceCount, params->firstVertex,
+                      params->firstInstance);
+            break;
+        }
+        case CommandID::EndDebugUtilsLabel:
+        {
+            ASSERT(vkCmdEndDebugUtilsLabelEXT);
+            vkCmdEndDebugUtilsLabelEXT(cmdBuffer);
+            break;
+        }
+        case CommandID::EndQuery:
+        {
+            const EndQueryParams *params = getParamPtr<EndQueryParams>(command);
+            vkCmdEndQuery(cmdBuffer, params->queryPool, params->query);
+            break;
+        }
+        case CommandID::EndTransformFeedback:
+        {
+            const EndTransformFeedbackParams *params =
+                getParamPtr<EndTransformFeedbackParams>(command);
+            const VkBuffer *counterBuffers =
+                Offset<VkBuffer>(params, sizeof(EndTransformFeedbackParams));
+            const VkDeviceSize *counterBufferOffsets =
+                reinterpret_cast<const VkDeviceSize *>(counterBuffers + params->bufferCount);
+            vkCmdEndTransformFeedbackEXT(cmdBuffer, 0, params->bufferCount, counterBuffers,
+                                         counterBufferOffsets);
+            break;
+        }
+        case CommandID::FillBuffer:
+        {
+            const FillBufferParams *params = getParamPtr<FillBufferParams>(command);
+            vkCmdFillBuffer(cmdBuffer, params->dstBuffer, params->dstOffset, params->size,
+                            params->data);
+            break;
+        }
+        case CommandID::ImageBarrier:
+        {
+            const ImageBarrierParams *params = getParamPtr<ImageBarrierParams>(command);
+            vkCmdPipelineBarrier(cmdBuffer, params->srcStageMask, params->dstStageMask, 0, 0,
+                                 nullptr, 0, nullptr, 1, &params->imageMemoryBarrier);
+            break;
+        }
+        case CommandID::InsertDebugUtilsLabel:
+        {
+            const DebugUtilsLabelParams *params = getParamPtr<DebugUtilsLabelParams>(command);
+            const char *pLabelName = Offset<char>(params, sizeof(DebugUtilsLabelParams));
+            const VkDebugUtilsLabelEXT label = {
+                VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT,
+                nullptr,
+                pLabelName,
+                {params->color[0], params->color[1], params->color[2], params->color[3]}};
+            ASSERT(vkCmdInsertDebugUtilsLabelEXT);
+            vkCmdInsertDebugUtilsLabelEXT(cmdBuffer, &label);
+            break;
+        }
+        case CommandID::MemoryBarrier:
+        {
+            const MemoryBarrierParams *params = getParamPtr<MemoryBarrierParams>(command);
+            vkCmdPipelineBarrier(cmdBuffer, params->srcStageMask, params->dstStageMask, 0, 1,
+                                 &params->memoryBarrier, 0, nullptr, 0, nullptr);
+            break;
+        }
+        case CommandID::NextSubpass:
+        {
+            const NextSubpassParams *params = getParamPtr<NextSubpassParams>(command);
+            vkCmdNextSubpass(cmdBuffer, params->subpassContents);
+            break;
+        }
+        case CommandID::PipelineBarrier:
+        {
+            const PipelineBarrierParams *params = getParamPtr<PipelineBarrierParams>(command);
+            const VkMemoryBarrier *memoryBarriers =
+                Offset<VkMemoryBarrier>(params, sizeof(PipelineBarrierParams));
+            const VkBufferMemoryBarrier *bufferMemoryBarriers = Offset<VkBufferMemoryBarrier>(
+                memoryBarriers, params->memoryBarrierCount * sizeof(VkMemoryBarrier));
+            const VkImageMemoryBarrier *imageMemoryBarriers = Offset<VkImageMemoryBarrier>(
+                bufferMemoryBarriers,
+                params->bufferMemoryBarrierCount * sizeof(VkBufferMemoryBarrier));
+            vkCmdPipelineBarrier(cmdBuffer, params->srcStageMask, params->dstStageMask,
+                                 params->dependencyFlags, params->memoryBarrierCount,
+                                 memoryBarriers, params->bufferMemoryBarrierCount,
+                                 bufferMemoryBarriers, params->imageMemoryBarrierCount,
+                                 imageMemoryBarriers);
+            break;
+        }
+        case CommandID::PushConstants:
+        {
+            const PushConstantsParams *params = getParamPtr<PushConstantsParams>(command);
+            const void *data = Offset<void>(params, sizeof(PushConstantsParams));
+            vkCmdPushConstants(cmdBuffer, params->layout, params->flag, params->offset,
+                               params->size, data);
+            break;
+        }
+        case CommandID::ResetEvent:
+        {
+            const ResetEventParams *params = getParamPtr<ResetEventParams>(command);
+            vkCmdResetEvent(cmdBuffer, params->event, params->stageMask);
+            break;
+        }
+        case CommandID::ResetQueryPool:
+        {
+            const ResetQueryPoolParams *params = getParamPtr<ResetQueryPoolParams>(command);
+            vkCmdResetQueryPool(cmdBuffer, params->queryPool, params->firstQuery,
+                                params->queryCount);
+            break;
+        }
+        case CommandID::ResolveImage:
+        {
+            const ResolveImageParams *params = getParamPtr<ResolveImageParams>(command);
+            vkCmdResolveImage(cmdBuffer, params->srcImage, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                              params->dstImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1,
+                              &params->region);
+            break;
+        }
+        case CommandID::SetBlendConstants:
+        {
+            const SetBlendConstantsParams *params = getParamPtr<SetBlendConstantsParams>(command);
+            vkCmdSetBlendConstants(cmdBuffer, params->blendConstants);
+            break;
+        }
+        case CommandID::SetCullMode:
+        {
+            const SetCullModeParams *params = getParamPtr<SetCullModeParams>(command);
+            vkCmdSetCullModeEXT(cmdBuffer, params->cullMode);
+            break;
+        }
+        case CommandID::SetDepthBias:
+        {
+            const SetDepthBiasParams *params = getParamPtr<SetDepthBiasParams>(command);
+            vkCmdSetDepthBias(cmdBuffer, params->depthBiasConstantFactor, params->depthBiasClamp,
+                              params->depthBiasSlopeFactor);
+            break;
+        }
+        case CommandID::SetDepthBiasEnable:
+        {
+            const SetDepthBiasEnableParams *params = getParamPtr<SetDepthBiasEnableParams>(command);
+            vkCmdSetDepthBiasEnableEXT(cmdBuffer, params->depthBiasEnable);
+            break;
+        }
+        case CommandID::SetDepthCompareOp:
+        {
+            const SetDepthCompareOpParams *params = getParamPtr<SetDepthCompareOpParams>(command);
+            vkCmdSetDepthCompareOpEXT(cmdBuffer, params->depthCompareOp);
+            break;
+        }
+        case CommandID::SetDepthTestEnable:
+        {
+            const SetDepthTestEnableParams *params = getParamPtr<SetDepthTestEnableParams>(command);
+            vkCmdSetDepthTestEnableEXT(cmdBuffer, params->depthTestEnable);
+            break;
+        }
+        case CommandID::SetDepthWriteEnable:
+        {
+            const SetDepthWriteEnableParams *params =
+                getParamPtr<SetDepthWriteEnableParams>(command);
+            vkCmdSetDepthWriteEnableEXT(cmdBuffer, params->depthWriteEnable);
+            break;
+        }
+        case CommandID::SetEvent:
+        {
+            const SetEventParams *params = getParamPtr<SetEventParams>(command);
+            vkCmdSetEvent(cmdBuffer, params->event, params->stageMask);
+            break;
+        }
+        case CommandID::SetFragmentShadingRate:
+        {
+            const SetFragmentShadingRateParams *params =
+                getParamPtr<SetFragmentShadingRateParams>(command);
+            const VkExtent2D fragmentSize = {params->fragmentWidth, params->fragmentHeight};
+            const VkFragmentShadingRateCombinerOpKHR ops[2] = {
+                VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR,
+                VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR};
+            vkCmdSetFragmentShadingRateKHR(cmdBuffer, &fragmentSize, ops);
+            break;
+        }
+        case CommandID::SetFrontFace:
+        {
+            const SetFrontFaceParams *params = getParamPtr<SetFrontFaceParams>(command);
+            vkCmdSetFrontFaceEXT(cmdBuffer, params->frontFace);
+            break;
+        }
+        case CommandID::SetLineWidth:
+        {
+            const SetLineWidthParams *params = getParamPtr<SetLineWidthParams>(command);
+            vkCmdSetLineWidth(cmdBuffer, params->lineWidth);
+            break;
+        }
+        case CommandID::SetPrimitiveRestartEnable:
+        {
+            const SetPrimitiveRestartEnableParams *params =
+                getParamPtr<SetPrimitiveRestartEnableParams>(command);
+            vkCmdSetPrimitiveRestartEnableEXT(cmdBuffer, params->primitiveRestartEnable);
+            break;
+        }
+        case CommandID::SetPrimitiveTopology:
+        {
+            const SetPrimitiveTopologyParams *params =
+                getParamPtr<SetPrimitiveTopologyParams>(command);
+            vkCmdSetPrimitiveTopologyEXT(cmdBuffer, params->primitiveTopology);
+            break;
+        }
+        case CommandID::SetRasterizerDiscardEnable:
+        {
+            const SetRasterizerDiscardEnableParams *params =
+                getParamPtr<SetRasterizerDiscardEnableParams>(command);
+            vkCmdSetRasterizerDiscardEnableEXT(cmdBuffer, params->rasterizerDiscardEnable);
+            break;
+        }
+        case CommandID::SetScissor:
+        {
+            const SetScissorParams *params = getParamPtr<SetScissorParams>(command);
+            vkCmdSetScissor(cmdBuffer, 0, 1, &params->scissor);
+            break;
+        }
+        case CommandID::SetStencilCompareMask:
+        {
+            const SetStencilCompareMaskParams *params =
+                getParamPtr<SetStencilCompareMaskParams>(command);
+            vkCmdSetStencilCompareMask(cmdBuffer, VK_STENCIL_FACE_FRONT_BIT,
+                                       params->compareFrontMask);
+            vkCmdSetStencilCompareMask(cmdBuffer, VK_STENCIL_FACE_BACK_BIT,
+                                       params->compareBackMask);
+            break;
+        }
+        case CommandID::SetStencilOp:
+        {
+            const SetStencilOpParams *params = getParamPtr<SetStencilOpParams>(command);
+            vkCmdSetStencilOpEXT(cmdBuffer, static_cast<VkStencilFaceFlags>(params->faceMask),
+                                 static_cast<VkStencilOp>(params->failOp),
+                                 static_cast<VkStencilOp>(params->passOp),
+                                 static_cast<VkStencilOp>(params->depthFailOp),
+                                 static_cast<VkCompareOp>(params->compareOp));
+            break;
+        }
+        case CommandID::SetStencilReference:
+        {
+            const SetStencilReferenceParams *params =
+                getParamPtr<SetStencilReferenceParams>(command);
+            vkCmdSetStencilReference(cmdBuffer, VK_STENCIL_FACE_FRONT_BIT, params->frontReference);
+            vkCmdSetStencilReference(cmdBuffer, VK_STENCIL_FACE_BACK_BIT, params->backReference);
+            break;
+        }
+        case CommandID::SetStencilTestEnable:
+        {
+            const SetStencilTestEnableParams *params =
+                getParamPtr<SetStencilTestEnableParams>(command);
+            vkCmdSetStencilTestEnableEXT(cmdBuffer, params->stencilTestEnable);
+            break;
+        }
+        case CommandID::SetStencilWriteMask:
+        {
+            const SetStencilWriteMaskParams *params =
+                getParamPtr<SetStencilWriteMaskParams>(command);
+            vkCmdSetStencilWriteMask(cmdBuffer, VK_STENCIL_FACE_FRONT_BIT, params->writeFrontMask);
+            vkCmdSetStencilWriteMask(cmdBuffer, VK_STENCIL_FACE_BACK_BIT, params->writeBackMask);
+            break;
+        }
+        case CommandID::SetViewport:
+        {
+            const SetViewportParams *params = getParamPtr<SetViewportParams>(command);
+            vkCmdSetViewport(cmdBuffer, 0, 1, &params->viewport);
+            break;
+        }
+        case CommandID::WaitEvents:
+        {
+            const WaitEventsParams *params = getParamPtr<WaitEventsParams>(command);
+            const VkEvent *events = Offset<VkEvent>(params, sizeof(WaitEventsParams));
+            const VkMemoryBarrier *memoryBarriers =
+                Offset<VkMemoryBarrier>(events, params->eventCount * sizeof(VkEvent));
+            const VkBufferMemoryBarrier *bufferMemoryBarriers = Offset<VkBufferMemoryBarrier>(
+                memoryBarriers, params->memoryBarrierCount * sizeof(VkMemoryBarrier));
+            const VkImageMemoryBarrier *imageMemoryBarriers = Offset<VkImageMemoryBarrier>(
+                bufferMemoryBarriers,
+                params->bufferMemoryBarrierCount * sizeof(VkBufferMemoryBarrier));
+            vkCmdWaitEvents(cmdBuffer, params->eventCount, events, params->srcStageMask,
+                            params->dstStageMask, params->memoryBarrierCount, memoryBarriers,
+                            params->bufferMemoryBarrierCount, bufferMemoryBarriers,
+                            params->imageMemoryBarrierCount, imageMemoryBarriers);
+            break;
+        }
+        case CommandID::WriteTimestamp:
+        {
+            const WriteTimestampParams *params = getParamPtr<WriteTimestampParams>(command);
+            vkCmdWriteTimestamp(cmdBuffer, params->pipelineStage, params->queryPool, params->query);
+            break;
+        }
+        default:
+        {
+            UNREACHABLE();
+            break;
+        }
+    }
+}
+
 // Parse the cmds in this cmd buffer into given primary cmd buffer
 void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
 {
@@ -183,600 +735,258 @@ void SecondaryCommandBuffer::executeCommands(PrimaryCommandBuffer *primary)
         for (const CommandHeader *currentCommand                      = command;
              currentCommand->id != CommandID::Invalid; currentCommand = NextCommand(currentCommand))
         {
-            switch (currentCommand->id)
-            {
-                case CommandID::BeginDebugUtilsLabel:
-                {
-                    const DebugUtilsLabelParams *params =
-                        getParamPtr<DebugUtilsLabelParams>(currentCommand);
-                    const char *pLabelName = Offset<char>(params, sizeof(DebugUtilsLabelParams));
-                    const VkDebugUtilsLabelEXT label = {
-                        VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT,
-                        nullptr,
-                        pLabelName,
-                        {params->color[0], params->color[1], params->color[2], params->color[3]}};
-                    ASSERT(vkCmdBeginDebugUtilsLabelEXT);
-                    vkCmdBeginDebugUtilsLabelEXT(cmdBuffer, &label);
-                    break;
-                }
-                case CommandID::BeginQuery:
-                {
-                    const BeginQueryParams *params = getParamPtr<BeginQueryParams>(currentCommand);
-                    vkCmdBeginQuery(cmdBuffer, params->queryPool, params->query, params->flags);
-                    break;
-                }
-                case CommandID::BeginTransformFeedback:
-                {
-                    const BeginTransformFeedbackParams *params =
-                        getParamPtr<BeginTransformFeedbackParams>(currentCommand);
-                    const VkBuffer *counterBuffers =
-                        Offset<VkBuffer>(params, sizeof(BeginTransformFeedbackParams));
-                    const VkDeviceSize *counterBufferOffsets =
-                        reinterpret_cast<const VkDeviceSize *>(counterBuffers +
-                                                               params->bufferCount);
-                    vkCmdBeginTransformFeedbackEXT(cmdBuffer, 0, params->bufferCount,
-                                                   counterBuffers, counterBufferOffsets);
-                    break;
-                }
-                case CommandID::BindComputePipeline:
-                {
-                    const BindPipelineParams *params =
-                        getParamPtr<BindPipelineParams>(currentCommand);
-                    vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, params->pipeline);
-                    break;
-                }
-                case CommandID::BindDescriptorSets:
-                {
-                    const BindDescriptorSetParams *params =
-                        getParamPtr<BindDescriptorSetParams>(currentCommand);
-                    const VkDescriptorSet *descriptorSets =
-                        Offset<VkDescriptorSet>(params, sizeof(BindDescriptorSetParams));
-                    const uint32_t *dynamicOffsets = Offset<uint32_t>(
-                        descriptorSets, sizeof(VkDescriptorSet) * params->descriptorSetCount);
-                    vkCmdBindDescriptorSets(cmdBuffer, params->pipelineBindPoint, params->layout,
-                                            params->firstSet, params->descriptorSetCount,
-                                            descriptorSets, params->dynamicOffsetCount,
-                                            dynamicOffsets);
-                    break;
-                }
-                case CommandID::BindGraphicsPipeline:
-                {
-                    const BindPipelineParams *params =
-                        getParamPtr<BindPipelineParams>(currentCommand);
-                    vkCmdBindPipeline(cmdBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, params->pipeline);
-                    break;
-                }
-                case CommandID::BindIndexBuffer:
-                {
-                    const BindIndexBufferParams *params =
-                        getParamPtr<BindIndexBufferParams>(currentCommand);
-                    vkCmdBindIndexBuffer(cmdBuffer, params->buffer, params->offset,
-                                         params->indexType);
-                    break;
-                }
-                case CommandID::BindTransformFeedbackBuffers:
-                {
-                    const BindTransformFeedbackBuffersParams *params =
-                        getParamPtr<BindTransformFeedbackBuffersParams>(currentCommand);
-                    const VkBuffer *buffers =
-                        Offset<VkBuffer>(params, sizeof(BindTransformFeedbackBuffersParams));
-                    const VkDeviceSize *offsets =
-                        Offset<VkDeviceSize>(buffers, sizeof(VkBuffer) * params->bindingCount);
-                    const VkDeviceSize *sizes =
-                        Offset<VkDeviceSize>(offsets, sizeof(VkDeviceSize) * params->bindingCount);
-                    vkCmdBindTransformFeedbackBuffersEXT(cmdBuffer, 0, params->bindingCount,
-                                                         buffers, offsets, sizes);
-                    break;
-                }
-                case CommandID::BindVertexBuffers:
-                {
-                    const BindVertexBuffersParams *params =
-                        getParamPtr<BindVertexBuffersParams>(currentCommand);
-                    const VkBuffer *buffers =
-                        Offset<VkBuffer>(params, sizeof(BindVertexBuffersParams));
-                    const VkDeviceSize *offsets =
-                        Offset<VkDeviceSize>(buffers, sizeof(VkBuffer) * params->bindingCount);
-                    vkCmdBindVertexBuffers(cmdBuffer, 0, params->bindingCount, buffers, offsets);
-                    break;
-                }
-                case CommandID::BindVertexBuffers2:
-                {
-                    const BindVertexBuffers2Params *params =
-                        getParamPtr<BindVertexBuffers2Params>(currentCommand);
-                    const VkBuffer *buffers =
-                        Offset<VkBuffer>(params, sizeof(BindVertexBuffers2Params));
-                    const VkDeviceSize *offsets =
-                        Offset<VkDeviceSize>(buffers, sizeof(VkBuffer) * params->bindingCount);
-                    const VkDeviceSize *strides =
-                        Offset<VkDeviceSize>(offsets, sizeof(VkDeviceSize) * params->bindingCount);
-                    vkCmdBindVertexBuffers2EXT(cmdBuffer, 0, params->bindingCount, buffers, offsets,
-                                               nullptr, strides);
-                    break;
-                }
-                case CommandID::BlitImage:
-                {
-                    const BlitImageParams *params = getParamPtr<BlitImageParams>(currentCommand);
-                    vkCmdBlitImage(cmdBuffer, params->srcImage,
-                                   VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, params->dstImage,
-                                   VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &params->region,
-                                   params->filter);
-                    break;
-                }
-                case CommandID::BufferBarrier:
-                {
-                    const BufferBarrierParams *params =
-                        getParamPtr<BufferBarrierParams>(currentCommand);
-                    vkCmdPipelineBarrier(cmdBuffer, params->srcStageMask, params->dstStageMask, 0,
-                                         0, nullptr, 1, &params->bufferMemoryBarrier, 0, nullptr);
-                    break;
-                }
-                case CommandID::ClearAttachments:
-                {
-                    const ClearAttachmentsParams *params =
-                        getParamPtr<ClearAttachmentsParams>(currentCommand);
-                    const VkClearAttachment *attachments =
-                        Offset<VkClearAttachment>(params, sizeof(ClearAttachmentsParams));
-                    vkCmdClearAttachments(cmdBuffer, params->attachmentCount, attachments, 1,
-                                          &params->rect);
-                    break;
-                }
-                case CommandID::ClearColorImage:
-                {
-                    const ClearColorImageParams *params =
-                        getParamPtr<ClearColorImageParams>(currentCommand);
-                    vkCmdClearColorImage(cmdBuffer, params->image, params->imageLayout,
-                                         &params->color, 1, &params->range);
-                    break;
-                }
-                case CommandID::ClearDepthStencilImage:
-                {
-                    const ClearDepthStencilImageParams *params =
-                        getParamPtr<ClearDepthStencilImageParams>(currentCommand);
-                    vkCmdClearDepthStencilImage(cmdBuffer, params->image, params->imageLayout,
-                                                &params->depthStencil, 1, &params->range);
-                    break;
-                }
-                case CommandID::CopyBuffer:
-                {
-                    const CopyBufferParams *params = getParamPtr<CopyBufferParams>(currentCommand);
-                    const VkBufferCopy *regions =
-                        Offset<VkBufferCopy>(params, sizeof(CopyBufferParams));
-                    vkCmdCopyBuffer(cmdBuffer, params->srcBuffer, params->destBuffer,
-                                    params->regionCount, regions);
-                    break;
-                }
-                case CommandID::CopyBufferToImage:
-                {
-                    const CopyBufferToImageParams *params =
-                        getParamPtr<CopyBufferToImageParams>(currentCommand);
-                    vkCmdCopyBufferToImage(cmdBuffer, params->srcBuffer, params->dstImage,
-                                           params->dstImageLayout, 1, &params->region);
-                    break;
-                }
-                case CommandID::CopyImage:
-                {
-                    const CopyImageParams *params = getParamPtr<CopyImageParams>(currentCommand);
-                    vkCmdCopyImage(cmdBuffer, params->srcImage, params->srcImageLayout,
-                                   params->dstImage, params->dstImageLayout, 1, &params->region);
-                    break;
-                }
-                case CommandID::CopyImageToBuffer:
-                {
-                    const CopyImageToBufferParams *params =
-                        getParamPtr<CopyImageToBufferParams>(currentCommand);
-                    vkCmdCopyImageToBuffer(cmdBuffer, params->srcImage, params->srcImageLayout,
-                                           params->dstBuffer, 1, &params->region);
-                    break;
-                }
-                case CommandID::Dispatch:
-                {
-                    const DispatchParams *params = getParamPtr<DispatchParams>(currentCommand);
-                    vkCmdDispatch(cmdBuffer, params->groupCountX, params->groupCountY,
-                                  params->groupCountZ);
-                    break;
-                }
-                case CommandID::DispatchIndirect:
-                {
-                    const DispatchIndirectParams *params =
-                        getParamPtr<DispatchIndirectParams>(currentCommand);
-                    vkCmdDispatchIndirect(cmdBuffer, params->buffer, params->offset);
-                    break;
-                }
+            executeCommand(cmdBuffer, currentCommand);
+        }
+    }
+}
+
+// CommandRangeStateTracker implementation.
+CommandRangeStateTracker::CommandRangeStateTracker() : mNextOrder(0) {}
+
+CommandRangeStateTracker::~CommandRangeStateTracker() = default;
+
+void CommandRangeStateTracker::setStateCommand(uint64_t stateKey, const CommandHeader *command)
+{
+    mStateCommands[stateKey] = {command, mNextOrder++};
+}
+
+void CommandRangeStateTracker::getStateCommands(
+    std::vector<const CommandHeader *> *commandsOut) const
+{
+    std::vector<StateCommand> stateCommands;
+    stateCommands.reserve(mStateCommands.size());
+    for (const auto &keyAndCommand : mStateCommands)
+    {
+        stateCommands.push_back(keyAndCommand.second);
+    }
+
+    // Replay state in the original order, as e.g. binding a descriptor set with an incompatible
+    // pipeline layout disturbs the other bound sets.
+    std::sort(stateCommands.begin(), stateCommands.end(),
+              [](const StateCommand &a, const StateCommand &b) { return a.order < b.order; });
+
+    commandsOut->clear();
+    for (const StateCommand &stateCommand : stateCommands)
+    {
+        commandsOut->push_back(stateCommand.command);
+    }
+}
+
+namespace
+{
+ANGLE_INLINE uint64_t PackStateKey(CommandID id, uint32_t subKey)
+{
+    return static_cast<uint64_t>(id) << 32 | subKey;
+}
+}  // namespace
+
+bool SecondaryCommandBuffer::getStateKey(const CommandHeader *command,
+                                         uint64_t *stateKeyOut) const
+{
+    switch (command->id)
+    {
+        case CommandID::BindDescriptorSets:
+        {
+            // Only drop a previous binding if this one replaces the exact same set range.
+            const BindDescriptorSetParams *params = getParamPtr<BindDescriptorSetParams>(command);
+            ASSERT(params->firstSet < 0x100 && params->descriptorSetCount < 0x100);
+            const uint32_t bindPoint = static_cast<uint32_t>(params->pipelineBindPoint);
+            *stateKeyOut             = PackStateKey(
+                command->id, bindPoint << 16 | params->firstSet << 8 | params->descriptorSetCount);
+            return true;
+        }
+        case CommandID::BindVertexBuffers:
+        case CommandID::BindVertexBuffers2:
+        {
+            // Both commands bind vertex buffers starting at binding 0.
+            const BindVertexBuffersParams *params = getParamPtr<BindVertexBuffersParams>(command);
+            *stateKeyOut = PackStateKey(CommandID::BindVertexBuffers, params->bindingCount);
+            return true;
+        }
+        case CommandID::PushConstants:
+        {
+            const PushConstantsParams *params = getParamPtr<PushConstantsParams>(command);
+            ASSERT(params->flag < 0x10000 && params->offset < 0x100 && params->size < 0x100);
+            *stateKeyOut =
+                PackStateKey(command->id, params->flag << 16 | params->offset << 8 | params->size);
+            return true;
+        }
+        case CommandID::SetStencilOp:
+        {
+            const SetStencilOpParams *params = getParamPtr<SetStencilOpParams>(command);
+            *stateKeyOut = PackStateKey(command->id, params->faceMask);
+            return true;
+        }
+        case CommandID::BindGraphicsPipeline:
+        case CommandID::BindIndexBuffer:
+        case CommandID::BindTransformFeedbackBuffers:
+        case CommandID::SetBlendConstants:
+        case CommandID::SetCullMode:
+        case CommandID::SetDepthBias:
+        case CommandID::SetDepthBiasEnable:
+        case CommandID::SetDepthCompareOp:
+        case CommandID::SetDepthTestEnable:
+        case CommandID::SetDepthWriteEnable:
+        case CommandID::SetFragmentShadingRate:
+        case CommandID::SetFrontFace:
+        case CommandID::SetLineWidth:
+        case CommandID::SetPrimitiveRestartEnable:
+        case CommandID::SetPrimitiveTopology:
+        case CommandID::SetRasterizerDiscardEnable:
+        case CommandID::SetScissor:
+        case CommandID::SetStencilCompareMask:
+        case CommandID::SetStencilReference:
+        case CommandID::SetStencilTestEnable:
+        case CommandID::SetStencilWriteMask:
+        case CommandID::SetViewport:
+            // These commands replace all state they set, regardless of their parameters.
+            *stateKeyOut = PackStateKey(command->id, 0);
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool SecondaryCommandBuffer::splitIntoCommandRanges(uint32_t drawsPerRange,
+                                                    CommandRangeStateTracker *stateTracker,
+                                                    std::vector<CommandRange> *rangesOut) const
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "SecondaryCommandBuffer::splitIntoCommandRanges");
+    ASSERT(drawsPerRange > 0);
+    rangesOut->clear();
+    if (mCommands.empty())
+    {
+        return true;
+    }
+
+    CommandRange range = {};
+    range.begin        = mCommands[0];
+    stateTracker->getStateCommands(&range.stateCommands);
+
+    uint32_t drawCount   = 0;
+    uint32_t openScopes  = 0;
+    bool rangeHasCommand = false;
+
+    for (size_t blockIndex = 0; blockIndex < mCommands.size(); ++blockIndex)
+    {
+        for (const CommandHeader *command = mCommands[blockIndex]; command->id != CommandID::Invalid;
+             command                      = NextCommand(command))
+        {
+            rangeHasCommand = true;
+
+            switch (command->id)
+            {
+                case CommandID::BeginDebugUtilsLabel:
+                case CommandID::BeginQuery:
+                case CommandID::BeginTransformFeedback:
+                    ++openScopes;
+                    continue;
+                case CommandID::EndDebugUtilsLabel:
+                case CommandID::EndQuery:
+                case CommandID::EndTransformFeedback:
+                    if (openScopes == 0)
+                    {
+                        // The scope was opened in a different command buffer.
+                        return false;
+                    }
+                    --openScopes;
+                    continue;
+                case CommandID::NextSubpass:
+                    return false;
                 case CommandID::Draw:
-                {
-                    const DrawParams *params = getParamPtr<DrawParams>(currentCommand);
-                    vkCmdDraw(cmdBuffer, params->vertexCount, 1, params->firstVertex, 0);
-                    break;
-                }
                 case CommandID::DrawIndexed:
-                {
-                    const DrawIndexedParams *params =
-                        getParamPtr<DrawIndexedParams>(currentCommand);
-                    vkCmdDrawIndexed(cmdBuffer, params->indexCount, 1, 0, 0, 0);
-                    break;
-                }
                 case CommandID::DrawIndexedBaseVertex:
-                {
-                    const DrawIndexedBaseVertexParams *params =
-                        getParamPtr<DrawIndexedBaseVertexParams>(currentCommand);
-                    vkCmdDrawIndexed(cmdBuffer, params->indexCount, 1, 0, params->vertexOffset, 0);
-                    break;
-                }
                 case CommandID::DrawIndexedIndirect:
-                {
-                    const DrawIndexedIndirectParams *params =
-                        getParamPtr<DrawIndexedIndirectParams>(currentCommand);
-                    vkCmdDrawIndexedIndirect(cmdBuffer, params->buffer, params->offset,
-                                             params->drawCount, params->stride);
-                    break;
-                }
                 case CommandID::DrawIndexedInstanced:
-                {
-                    const DrawIndexedInstancedParams *params =
-                        getParamPtr<DrawIndexedInstancedParams>(currentCommand);
-                    vkCmdDrawIndexed(cmdBuffer, params->indexCount, params->instanceCount, 0, 0, 0);
-                    break;
-                }
                 case CommandID::DrawIndexedInstancedBaseVertex:
-                {
-                    const DrawIndexedInstancedBaseVertexParams *params =
-                        getParamPtr<DrawIndexedInstancedBaseVertexParams>(currentCommand);
-                    vkCmdDrawIndexed(cmdBuffer, params->indexCount, params->instanceCount, 0,
-                                     params->vertexOffset, 0);
-                    break;
-                }
                 case CommandID::DrawIndexedInstancedBaseVertexBaseInstance:
-                {
-                    const DrawIndexedInstancedBaseVertexBaseInstanceParams *params =
-                        getParamPtr<DrawIndexedInstancedBaseVertexBaseInstanceParams>(
-                            currentCommand);
-                    vkCmdDrawIndexed(cmdBuffer, params->indexCount, params->instanceCount,
-                                     params->firstIndex, params->vertexOffset,
-                                     params->firstInstance);
-                    break;
-                }
                 case CommandID::DrawIndirect:
-                {
-                    const DrawIndirectParams *params =
-                        getParamPtr<DrawIndirectParams>(currentCommand);
-                    vkCmdDrawIndirect(cmdBuffer, params->buffer, params->offset, params->drawCount,
-                                      params->stride);
-                    break;
-                }
                 case CommandID::DrawInstanced:
-                {
-                    const DrawInstancedParams *params =
-                        getParamPtr<DrawInstancedParams>(currentCommand);
-                    vkCmdDraw(cmdBuffer, params->vertexCount, params->instanceCount,
-                              params->firstVertex, 0);
-                    break;
-                }
                 case CommandID::DrawInstancedBaseInstance:
-                {
-                    const DrawInstancedBaseInstanceParams *params =
-                        getParamPtr<DrawInstancedBaseInstanceParams>(currentCommand);
-                    vkCmdDraw(cmdBuffer, params->vertexCount, params->instanceCount,
-                              params->firstVertex, params->firstInstance);
-                    break;
-                }
-                case CommandID::EndDebugUtilsLabel:
-                {
-                    ASSERT(vkCmdEndDebugUtilsLabelEXT);
-                    vkCmdEndDebugUtilsLabelEXT(cmdBuffer);
+                    ++drawCount;
                     break;
-                }
-                case CommandID::EndQuery:
-                {
-                    const EndQueryParams *params = getParamPtr<EndQueryParams>(currentCommand);
-                    vkCmdEndQuery(cmdBuffer, params->queryPool, params->query);
-                    break;
-                }
-                case CommandID::EndTransformFeedback:
-                {
-                    const EndTransformFeedbackParams *params =
-                        getParamPtr<EndTransformFeedbackParams>(currentCommand);
-                    const VkBuffer *counterBuffers =
-                        Offset<VkBuffer>(params, sizeof(EndTransformFeedbackParams));
-                    const VkDeviceSize *counterBufferOffsets =
-                        reinterpret_cast<const VkDeviceSize *>(counterBuffers +
-                                                               params->bufferCount);
-                    vkCmdEndTransformFeedbackEXT(cmdBuffer, 0, params->bufferCount, counterBuffers,
-                                                 counterBufferOffsets);
-                    break;
-                }
-                case CommandID::FillBuffer:
-                {
-                    const FillBufferParams *params = getParamPtr<FillBufferParams>(currentCommand);
-                    vkCmdFillBuffer(cmdBuffer, params->dstBuffer, params->dstOffset, params->size,
-                                    params->data);
-                    break;
-                }
-                case CommandID::ImageBarrier:
-                {
-                    const ImageBarrierParams *params =
-                        getParamPtr<ImageBarrierParams>(currentCommand);
-                    vkCmdPipelineBarrier(cmdBuffer, params->srcStageMask, params->dstStageMask, 0,
-                                         0, nullptr, 0, nullptr, 1, &params->imageMemoryBarrier);
-                    break;
-                }
-                case CommandID::InsertDebugUtilsLabel:
-                {
-                    const DebugUtilsLabelParams *params =
-                        getParamPtr<DebugUtilsLabelParams>(currentCommand);
-                    const char *pLabelName = Offset<char>(params, sizeof(DebugUtilsLabelParams));
-                    const VkDebugUtilsLabelEXT label = {
-                        VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT,
-                        nullptr,
-                        pLabelName,
-                        {params->color[0], params->color[1], params->color[2], params->color[3]}};
-                    ASSERT(vkCmdInsertDebugUtilsLabelEXT);
-                    vkCmdInsertDebugUtilsLabelEXT(cmdBuffer, &label);
-                    break;
-                }
-                case CommandID::MemoryBarrier:
-                {
-                    const MemoryBarrierParams *params =
-                        getParamPtr<MemoryBarrierParams>(currentCommand);
-                    vkCmdPipelineBarrier(cmdBuffer, params->srcStageMask, params->dstStageMask, 0,
-                                         1, &params->memoryBarrier, 0, nullptr, 0, nullptr);
-                    break;
-                }
-                case CommandID::NextSubpass:
-                {
-                    const NextSubpassParams *params =
-                        getParamPtr<NextSubpassParams>(currentCommand);
-                    vkCmdNextSubpass(cmdBuffer, params->subpassContents);
-                    break;
-                }
-                case CommandID::PipelineBarrier:
-                {
-                    const PipelineBarrierParams *params =
-                        getParamPtr<PipelineBarrierParams>(currentCommand);
-                    const VkMemoryBarrier *memoryBarriers =
-                        Offset<VkMemoryBarrier>(params, sizeof(PipelineBarrierParams));
-                    const VkBufferMemoryBarrier *bufferMemoryBarriers =
-                        Offset<VkBufferMemoryBarrier>(
-                            memoryBarriers, params->memoryBarrierCount * sizeof(VkMemoryBarrier));
-                    const VkImageMemoryBarrier *imageMemoryBarriers = Offset<VkImageMemoryBarrier>(
-                        bufferMemoryBarriers,
-                        params->bufferMemoryBarrierCount * sizeof(VkBufferMemoryBarrier));
-                    vkCmdPipelineBarrier(cmdBuffer, params->srcStageMask, params->dstStageMask,
-                                         params->dependencyFlags, params->memoryBarrierCount,
-                                         memoryBarriers, params->bufferMemoryBarrierCount,
-                                         bufferMemoryBarriers, params->imageMemoryBarrierCount,
-                                         imageMemoryBarriers);
-                    break;
-                }
-                case CommandID::PushConstants:
-                {
-                    const PushConstantsParams *params =
-                        getParamPtr<PushConstantsParams>(currentCommand);
-                    const void *data = Offset<void>(params, sizeof(PushConstantsParams));
-                    vkCmdPushConstants(cmdBuffer, params->layout, params->flag, params->offset,
-                                       params->size, data);
-                    break;
-                }
-                case CommandID::ResetEvent:
-                {
-                    const ResetEventParams *params = getParamPtr<ResetEventParams>(currentCommand);
-                    vkCmdResetEvent(cmdBuffer, params->event, params->stageMask);
-                    break;
-                }
-                case CommandID::ResetQueryPool:
-                {
-                    const ResetQueryPoolParams *params =
-                        getParamPtr<ResetQueryPoolParams>(currentCommand);
-                    vkCmdResetQueryPool(cmdBuffer, params->queryPool, params->firstQuery,
-                                        params->queryCount);
-                    break;
-                }
-                case CommandID::ResolveImage:
-                {
-                    const ResolveImageParams *params =
-                        getParamPtr<ResolveImageParams>(currentCommand);
-                    vkCmdResolveImage(cmdBuffer, params->srcImage,
-                                      VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, params->dstImage,
-                                      VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &params->region);
-                    break;
-                }
-                case CommandID::SetBlendConstants:
-                {
-                    const SetBlendConstantsParams *params =
-                        getParamPtr<SetBlendConstantsParams>(currentCommand);
-                    vkCmdSetBlendConstants(cmdBuffer, params->blendConstants);
-                    break;
-                }
-                case CommandID::SetCullMode:
-                {
-                    const SetCullModeParams *params =
-                        getParamPtr<SetCullModeParams>(currentCommand);
-                    vkCmdSetCullModeEXT(cmdBuffer, params->cullMode);
-                    break;
-                }
-                case CommandID::SetDepthBias:
-                {
-                    const SetDepthBiasParams *params =
-                        getParamPtr<SetDepthBiasParams>(currentCommand);
-                    vkCmdSetDepthBias(cmdBuffer, params->depthBiasConstantFactor,
-                                      params->depthBiasClamp, params->depthBiasSlopeFactor);
-                    break;
-                }
-                case CommandID::SetDepthBiasEnable:
-                {
-                    const SetDepthBiasEnableParams *params =
-                        getParamPtr<SetDepthBiasEnableParams>(currentCommand);
-                    vkCmdSetDepthBiasEnableEXT(cmdBuffer, params->depthBiasEnable);
-                    break;
-                }
-                case CommandID::SetDepthCompareOp:
-                {
-                    const SetDepthCompareOpParams *params =
-                        getParamPtr<SetDepthCompareOpParams>(currentCommand);
-                    vkCmdSetDepthCompareOpEXT(cmdBuffer, params->depthCompareOp);
-                    break;
-                }
-                case CommandID::SetDepthTestEnable:
-                {
-                    const SetDepthTestEnableParams *params =
-                        getParamPtr<SetDepthTestEnableParams>(currentCommand);
-                    vkCmdSetDepthTestEnableEXT(cmdBuffer, params->depthTestEnable);
-                    break;
-                }
-                case CommandID::SetDepthWriteEnable:
-                {
-                    const SetDepthWriteEnableParams *params =
-                        getParamPtr<SetDepthWriteEnableParams>(currentCommand);
-                    vkCmdSetDepthWriteEnableEXT(cmdBuffer, params->depthWriteEnable);
-                    break;
-                }
-                case CommandID::SetEvent:
-                {
-                    const SetEventParams *params = getParamPtr<SetEventParams>(currentCommand);
-                    vkCmdSetEvent(cmdBuffer, params->event, params->stageMask);
-                    break;
-                }
-                case CommandID::SetFragmentShadingRate:
-                {
-                    const SetFragmentShadingRateParams *params =
-                        getParamPtr<SetFragmentShadingRateParams>(currentCommand);
-                    const VkExtent2D fragmentSize = {params->fragmentWidth, params->fragmentHeight};
-                    const VkFragmentShadingRateCombinerOpKHR ops[2] = {
-                        VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR,
-                        VK_FRAGMENT_SHADING_RATE_COMBINER_OP_KEEP_KHR};
-                    vkCmdSetFragmentShadingRateKHR(cmdBuffer, &fragmentSize, ops);
-                    break;
-                }
-                case CommandID::SetFrontFace:
-                {
-                    const SetFrontFaceParams *params =
-                        getParamPtr<SetFrontFaceParams>(currentCommand);
-                    vkCmdSetFrontFaceEXT(cmdBuffer, params->frontFace);
-                    break;
-                }
-                case CommandID::SetLineWidth:
-                {
-                    const SetLineWidthParams *params =
-                        getParamPtr<SetLineWidthParams>(currentCommand);
-                    vkCmdSetLineWidth(cmdBuffer, params->lineWidth);
-                    break;
-                }
-                case CommandID::SetPrimitiveRestartEnable:
-                {
-                    const SetPrimitiveRestartEnableParams *params =
-                        getParamPtr<SetPrimitiveRestartEnableParams>(currentCommand);
-                    vkCmdSetPrimitiveRestartEnableEXT(cmdBuffer, params->primitiveRestartEnable);
-                    break;
-                }
-                case CommandID::SetRasterizerDiscardEnable:
-                {
-                    const SetRasterizerDiscardEnableParams *params =
-                        getParamPtr<SetRasterizerDiscardEnableParams>(currentCommand);
-                    vkCmdSetRasterizerDiscardEnableEXT(cmdBuffer, params->rasterizerDiscardEnable);
-                    break;
-                }
-                case CommandID::SetScissor:
-                {
-                    const SetScissorParams *params = getParamPtr<SetScissorParams>(currentCommand);
-                    vkCmdSetScissor(cmdBuffer, 0, 1, &params->scissor);
-                    break;
-                }
-                case CommandID::SetStencilCompareMask:
-                {
-                    const SetStencilCompareMaskParams *params =
-                        getParamPtr<SetStencilCompareMaskParams>(currentCommand);
-                    vkCmdSetStencilCompareMask(cmdBuffer, VK_STENCIL_FACE_FRONT_BIT,
-                                               params->compareFrontMask);
-                    vkCmdSetStencilCompareMask(cmdBuffer, VK_STENCIL_FACE_BACK_BIT,
-                                               params->compareBackMask);
-                    break;
-                }
-                case CommandID::SetStencilOp:
-                {
-                    const SetStencilOpParams *params =
-                        getParamPtr<SetStencilOpParams>(currentCommand);
-                    vkCmdSetStencilOpEXT(cmdBuffer,
-                                         static_cast<VkStencilFaceFlags>(params->faceMask),
-                                         static_cast<VkStencilOp>(params->failOp),
-                                         static_cast<VkStencilOp>(params->passOp),
-                                         static_cast<VkStencilOp>(params->depthFailOp),
-                                         static_cast<VkCompareOp>(params->compareOp));
-                    break;
-                }
-                case CommandID::SetStencilReference:
-                {
-                    const SetStencilReferenceParams *params =
-                        getParamPtr<SetStencilReferenceParams>(currentCommand);
-                    vkCmdSetStencilReference(cmdBuffer, VK_STENCIL_FACE_FRONT_BIT,
-                                             params->frontReference);
-                    vkCmdSetStencilReference(cmdBuffer, VK_STENCIL_FACE_BACK_BIT,
-                                             params->backReference);
-                    break;
-                }
-                case CommandID::SetStencilTestEnable:
-                {
-                    const SetStencilTestEnableParams *params =
-                        getParamPtr<SetStencilTestEnableParams>(currentCommand);
-                    vkCmdSetStencilTestEnableEXT(cmdBuffer, params->stencilTestEnable);
-                    break;
-                }
-                case CommandID::SetStencilWriteMask:
-                {
-                    const SetStencilWriteMaskParams *params =
-                        getParamPtr<SetStencilWriteMaskParams>(currentCommand);
-                    vkCmdSetStencilWriteMask(cmdBuffer, VK_STENCIL_FACE_FRONT_BIT,
-                                             params->writeFrontMask);
-                    vkCmdSetStencilWriteMask(cmdBuffer, VK_STENCIL_FACE_BACK_BIT,
-                                             params->writeBackMask);
-                    break;
-                }
-                case CommandID::SetViewport:
-                {
-                    const SetViewportParams *params =
-                        getParamPtr<SetViewportParams>(currentCommand);
-                    vkCmdSetViewport(cmdBuffer, 0, 1, &params->viewport);
-                    break;
-                }
-                case CommandID::WaitEvents:
-                {
-                    const WaitEventsParams *params = getParamPtr<WaitEventsParams>(currentCommand);
-                    const VkEvent *events = Offset<VkEvent>(params, sizeof(WaitEventsParams));
-                    const VkMemoryBarrier *memoryBarriers =
-                        Offset<VkMemoryBarrier>(events, params->eventCount * sizeof(VkEvent));
-                    const VkBufferMemoryBarrier *bufferMemoryBarriers =
-                        Offset<VkBufferMemoryBarrier>(
-                            memoryBarriers, params->memoryBarrierCount * sizeof(VkMemoryBarrier));
-                    const VkImageMemoryBarrier *imageMemoryBarriers = Offset<VkImageMemoryBarrier>(
-                        bufferMemoryBarriers,
-                        params->bufferMemoryBarrierCount * sizeof(VkBufferMemoryBarrier));
-                    vkCmdWaitEvents(cmdBuffer, params->eventCount, events, params->srcStageMask,
-                                    params->dstStageMask, params->memoryBarrierCount,
-                                    memoryBarriers, params->bufferMemoryBarrierCount,
-                                    bufferMemoryBarriers, params->imageMemoryBarrierCount,
-                                    imageMemoryBarriers);
-                    break;
-                }
-                case CommandID::WriteTimestamp:
-                {
-                    const WriteTimestampParams *params =
-                        getParamPtr<WriteTimestampParams>(currentCommand);
-                    vkCmdWriteTimestamp(cmdBuffer, params->pipelineStage, params->queryPool,
-                                        params->query);
-                    break;
-                }
                 default:
                 {
-                    UNREACHABLE();
-                    break;
+                    uint64_t stateKey = 0;
+                    if (getStateKey(command, &stateKey))
+                    {
+                        stateTracker->setStateCommand(stateKey, command);
+                    }
+                    continue;
                 }
             }
+
+            if (drawCount < drawsPerRange || openScopes > 0)
+            {
+                continue;
+            }
+
+            // End the range after this draw call, and start a new one with the current state.
+            range.endBlock = blockIndex;
+            range.end      = NextCommand(command);
+            rangesOut->push_back(std::move(range));
+
+            range            = {};
+            range.beginBlock = blockIndex;
+            range.begin      = NextCommand(command);
+            stateTracker->getStateCommands(&range.stateCommands);
+
+            drawCount       = 0;
+            rangeHasCommand = false;
         }
     }
+
+    if (openScopes > 0)
+    {
+        // The scope is closed in a different command buffer.
+        return false;
+    }
+
+    if (rangeHasCommand || rangesOut->empty())
+    {
+        range.endBlock = mCommands.size() - 1;
+        range.end      = nullptr;
+        rangesOut->push_back(std::move(range));
+    }
+
+    return true;
+}
+
+void SecondaryCommandBuffer::executeCommandRange(VkCommandBuffer commandBuffer,
+                                                 const CommandRange &range) const
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "SecondaryCommandBuffer::executeCommandRange");
+
+    for (const CommandHeader *command : range.stateCommands)
+    {
+        executeCommand(commandBuffer, command);
+    }
+
+    size_t blockIndex            = range.beginBlock;
+    const CommandHeader *command = range.begin;
+    while (command != range.end)
+    {
+        if (command->id == CommandID::Invalid)
+        {
+            // Move on to the next block.
+            if (++blockIndex == mCommands.size())
+            {
+                ASSERT(range.end == nullptr);
+                break;
+            }
+            command = mCommands[blockIndex];
+            continue;
+        }
+
+        executeCommand(commandBuffer, command);
+        command = NextCommand(command);
+    }
 }
 
 void SecondaryCommandBuffer::getMemoryUsageStats(size_t *usedMemoryOut,
                                                  size_t *allocatedMemoryOut) const
 {
-    *allocatedMemoryOut = kBlockSize * mCommands.size();
+    *allocatedMemoryOut = mAllocatedBlockBytes;
 
     *usedMemoryOut = 0;
     for (const CommandHeader *command : mCommands)
@@ -91,6 +91,7 @@ enum class CommandID : uint16_t
     SetFrontFace,
     SetLineWidth,
     SetPrimitiveRestartEnable,
+    SetPrimitiveTopology,
     SetRasterizerDiscardEnable,
     SetScissor,
     SetStencilCompareMask,
@@ -175,10 +176,11 @@ struct BufferBarrierParams
 };
 VERIFY_4_BYTE_ALIGNMENT(BufferBarrierParams)
 
+// Followed by |attachmentCount| VkClearAttachments and |rectCount| VkClearRects.
 struct ClearAttachmentsParams
 {
     uint32_t attachmentCount;
-    VkClearRect rect;
+    uint32_t rectCount;
 };
 VERIFY_4_BYTE_ALIGNMENT(ClearAttachmentsParams)
 
@@ -213,7 +215,7 @@ struct CopyBufferToImageParams
     VkBuffer srcBuffer;
     VkImage dstImage;
     VkImageLayout dstImageLayout;
-    VkBufferImageCopy region;
+    uint32_t regionCount;
 };
 VERIFY_4_BYTE_ALIGNMENT(CopyBufferToImageParams)
 
@@ -505,6 +507,12 @@ struct SetPrimitiveRestartEnableParams
 };
 VERIFY_4_BYTE_ALIGNMENT(SetPrimitiveRestartEnableParams)
 
+struct SetPrimitiveTopologyParams
+{
+    VkPrimitiveTopology primitiveTopology;
+};
+VERIFY_4_BYTE_ALIGNMENT(SetPrimitiveTopologyParams)
+
 struct SetRasterizerDiscardEnableParams
 {
     VkBool32 rasterizerDiscardEnable;
@@ -599,6 +607,44 @@ ANGLE_INLINE const DestT *Offset(const T *ptr, size_t bytes)
     return reinterpret_cast<const DestT *>((reinterpret_cast<const uint8_t *>(ptr) + bytes));
 }
 
+// A contiguous sequence of commands in a SecondaryCommandBuffer.  Large render passes are split
+// into ranges that are replayed in parallel into Vulkan secondary command buffers.  Vulkan
+// secondary command buffers don't inherit state from the primary command buffer, so each range
+// also records the commands that set up the state that is current at its start.
+struct CommandRange
+{
+    size_t beginBlock;
+    const CommandHeader *begin;
+    size_t endBlock;
+    // nullptr if the range extends to the end of the command buffer.
+    const CommandHeader *end;
+    std::vector<const CommandHeader *> stateCommands;
+};
+
+// Tracks the last command that set each piece of state while a render pass is split into
+// ranges.  The tracker is carried over between the subpasses of a render pass, as state set in
+// one subpass remains valid in the next.
+class CommandRangeStateTracker final : angle::NonCopyable
+{
+  public:
+    CommandRangeStateTracker();
+    ~CommandRangeStateTracker();
+
+    void setStateCommand(uint64_t stateKey, const CommandHeader *command);
+
+    // Get the state commands in the order they were originally recorded.
+    void getStateCommands(std::vector<const CommandHeader *> *commandsOut) const;
+
+  private:
+    struct StateCommand
+    {
+        const CommandHeader *command;
+        uint64_t order;
+    };
+    angle::HashMap<uint64_t, StateCommand> mStateCommands;
+    uint64_t mNextOrder;
+};
+
 class SecondaryCommandBuffer final : angle::NonCopyable
 {
   public:
@@ -620,7 +666,7 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     }
     static angle::Result InitializeRenderPassInheritanceInfo(
         ContextVk *contextVk,
-        const Framebuffer &framebuffer,
+        VkFramebuffer framebuffer,
         const RenderPassDesc &renderPassDesc,
         VkCommandBufferInheritanceInfo *inheritanceInfoOut)
     {
@@ -823,6 +869,7 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     void setFrontFace(VkFrontFace frontFace);
     void setLineWidth(float lineWidth);
     void setPrimitiveRestartEnable(VkBool32 primitiveRestartEnable);
+    void setPrimitiveTopology(VkPrimitiveTopology primitiveTopology);
     void setRasterizerDiscardEnable(VkBool32 rasterizerDiscardEnable);
     void setScissor(uint32_t firstScissor, uint32_t scissorCount, const VkRect2D *scissors);
     void setStencilCompareMask(uint32_t compareFrontMask, uint32_t compareBackMask);
@@ -857,6 +904,17 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     // Parse the cmds in this cmd buffer into given primary cmd buffer for execution
     void executeCommands(PrimaryCommandBuffer *primary);
 
+    // Split the commands into ranges of roughly |drawsPerRange| draw calls each.  Ranges never
+    // split a query, transform feedback or debug label scope.  Returns false if these scopes are
+    // not contained in this command buffer, in which case the commands cannot be split.
+    bool splitIntoCommandRanges(uint32_t drawsPerRange,
+                                CommandRangeStateTracker *stateTracker,
+                                std::vector<CommandRange> *rangesOut) const;
+
+    // Replay the state commands of |range| followed by its commands into |commandBuffer|.  This
+    // doesn't modify the SecondaryCommandBuffer, so ranges can be replayed from multiple threads.
+    void executeCommandRange(VkCommandBuffer commandBuffer, const CommandRange &range) const;
+
     // Calculate memory usage of this command buffer for diagnostics.
     void getMemoryUsageStats(size_t *usedMemoryOut, size_t *allocatedMemoryOut) const;
 
@@ -868,6 +926,9 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     static constexpr size_t kBlockSize = 1364;
     // Make sure block size is 4-byte aligned to avoid Android errors
     static_assert((kBlockSize % 4) == 0, "Check kBlockSize alignment");
+    // Blocks double in size as more are allocated, so that heavy render passes make fewer block
+    // allocations.  Three blocks of this size still fill a pool page exactly.
+    static constexpr size_t kMaxBlockSize = kBlockSize * 4;
 
     // Initialize the SecondaryCommandBuffer by setting the allocator it will use
     angle::Result initialize(vk::Context *context,
@@ -877,7 +938,8 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     {
         ASSERT(allocator);
         ASSERT(mCommands.empty());
-        mAllocator = allocator;
+        mAllocator     = allocator;
+        mNextBlockSize = mInitialBlockSize;
         allocateNewBlock();
         // Set first command to Invalid to start
         reinterpret_cast<CommandHeader *>(mCurrentWritePointer)->id = CommandID::Invalid;
@@ -896,9 +958,15 @@ class SecondaryCommandBuffer final : angle::NonCopyable
 
     void reset()
     {
+        // Adapt the size of the first block of the next recording to this one: start with larger
+        // blocks if more than one was needed, and shrink back otherwise.
+        mInitialBlockSize = mCommands.size() > 1 ? std::min(mInitialBlockSize * 2, kMaxBlockSize)
+                                                 : std::max(mInitialBlockSize / 2, kBlockSize);
+
         mCommands.clear();
         mCurrentWritePointer   = nullptr;
         mCurrentBytesRemaining = 0;
+        mAllocatedBlockBytes   = 0;
         mCommandTracker.reset();
     }
 
@@ -914,6 +982,10 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     }
 
   private:
+    void executeCommand(VkCommandBuffer cmdBuffer, const CommandHeader *command) const;
+    // Returns false if |command| doesn't set state that outlives it.
+    bool getStateKey(const CommandHeader *command, uint64_t *stateKeyOut) const;
+
     void commonDebugUtilsLabel(CommandID cmd, const VkDebugUtilsLabelEXT &label);
     template <class StructType>
     ANGLE_INLINE StructType *commonInit(CommandID cmdID, size_t allocationSize)
@@ -931,11 +1003,17 @@ class SecondaryCommandBuffer final : angle::NonCopyable
         reinterpret_cast<CommandHeader *>(mCurrentWritePointer)->id = CommandID::Invalid;
         return Offset<StructType>(header, sizeof(CommandHeader));
     }
-    ANGLE_INLINE void allocateNewBlock(size_t blockSize = kBlockSize)
+    ANGLE_INLINE void allocateNewBlock()
+    {
+        allocateNewBlock(mNextBlockSize);
+        mNextBlockSize = std::min(mNextBlockSize * 2, kMaxBlockSize);
+    }
+    ANGLE_INLINE void allocateNewBlock(size_t blockSize)
     {
         ASSERT(mAllocator);
         mCurrentWritePointer   = mAllocator->fastAllocate(blockSize);
         mCurrentBytesRemaining = blockSize;
+        mAllocatedBlockBytes += blockSize;
         mCommands.push_back(reinterpret_cast<CommandHeader *>(mCurrentWritePointer));
     }
 
@@ -954,7 +1032,7 @@ class SecondaryCommandBuffer final : angle::NonCopyable
         if (mCurrentBytesRemaining < requiredSize)
         {
             // variable size command can potentially exceed default cmd allocation blockSize
-            if (requiredSize <= kBlockSize)
+            if (requiredSize <= mNextBlockSize)
                 allocateNewBlock();
             else
             {
@@ -1012,11 +1090,23 @@ class SecondaryCommandBuffer final : angle::NonCopyable
     uint8_t *mCurrentWritePointer;
     size_t mCurrentBytesRemaining;
 
+    // The size of the next block to allocate, and of the first block of a recording.
+    size_t mNextBlockSize;
+    size_t mInitialBlockSize;
+    // The total size of the allocated blocks, for diagnostics.
+    size_t mAllocatedBlockBytes;
+
     CommandBufferCommandTracker mCommandTracker;
 };
 
 ANGLE_INLINE SecondaryCommandBuffer::SecondaryCommandBuffer()
-    : mIsOpen(true), mAllocator(nullptr), mCurrentWritePointer(nullptr), mCurrentBytesRemaining(0)
+    : mIsOpen(true),
+      mAllocator(nullptr),
+      mCurrentWritePointer(nullptr),
+      mCurrentBytesRemaining(0),
+      mNextBlockSize(kBlockSize),
+      mInitialBlockSize(kBlockSize),
+      mAllocatedBlockBytes(0)
 {}
 
 ANGLE_INLINE SecondaryCommandBuffer::~SecondaryCommandBuffer() {}
@@ -1214,15 +1304,17 @@ ANGLE_INLINE void SecondaryCommandBuffer::clearAttachments(uint32_t attachmentCo
                                                            uint32_t rectCount,
                                                            const VkClearRect *rects)
 {
-    ASSERT(rectCount == 1);
+    ASSERT(rectCount > 0);
     uint8_t *writePtr;
     size_t attachSize = attachmentCount * sizeof(VkClearAttachment);
-    ClearAttachmentsParams *paramStruct =
-        initCommand<ClearAttachmentsParams>(CommandID::ClearAttachments, attachSize, &writePtr);
+    size_t rectSize   = rectCount * sizeof(VkClearRect);
+    ClearAttachmentsParams *paramStruct = initCommand<ClearAttachmentsParams>(
+        CommandID::ClearAttachments, attachSize + rectSize, &writePtr);
     paramStruct->attachmentCount = attachmentCount;
-    paramStruct->rect            = rects[0];
+    paramStruct->rectCount       = rectCount;
     // Copy variable sized data
-    storePointerParameter(writePtr, attachments, attachSize);
+    writePtr = storePointerParameter(writePtr, attachments, attachSize);
+    storePointerParameter(writePtr, rects, rectSize);
 
     mCommandTracker.onClearAttachments();
 }
@@ -1280,13 +1372,16 @@ ANGLE_INLINE void SecondaryCommandBuffer::copyBufferToImage(VkBuffer srcBuffer,
                                                             uint32_t regionCount,
                                                             const VkBufferImageCopy *regions)
 {
-    ASSERT(regionCount == 1);
+    uint8_t *writePtr;
+    size_t regionSize = regionCount * sizeof(VkBufferImageCopy);
     CopyBufferToImageParams *paramStruct =
-        initCommand<CopyBufferToImageParams>(CommandID::CopyBufferToImage);
+        initCommand<CopyBufferToImageParams>(CommandID::CopyBufferToImage, regionSize, &writePtr);
     paramStruct->srcBuffer      = srcBuffer;
     paramStruct->dstImage       = dstImage.getHandle();
     paramStruct->dstImageLayout = dstImageLayout;
-    paramStruct->region         = regions[0];
+    paramStruct->regionCount    = regionCount;
+    // Copy variable sized data
+    storePointerParameter(writePtr, regions, regionSize);
 }
 
 ANGLE_INLINE void SecondaryCommandBuffer::copyImage(const Image &srcImage,
@@ -1724,6 +1819,14 @@ ANGLE_INLINE void SecondaryCommandBuffer::setPrimitiveRestartEnable(VkBool32 pri
     paramStruct->primitiveRestartEnable = primitiveRestartEnable;
 }
 
+ANGLE_INLINE void SecondaryCommandBuffer::setPrimitiveTopology(
+    VkPrimitiveTopology primitiveTopology)
+{
+    SetPrimitiveTopologyParams *paramStruct =
+        initCommand<SetPrimitiveTopologyParams>(CommandID::SetPrimitiveTopology);
+    paramStruct->primitiveTopology = primitiveTopology;
+}
+
 ANGLE_INLINE void SecondaryCommandBuffer::setRasterizerDiscardEnable(
     VkBool32 rasterizerDiscardEnable)
 {
@@ -24,6 +24,13 @@ ShaderVk::~ShaderVk() {}
 std::shared_ptr<WaitableCompileEvent> ShaderVk::compile(const gl::Context *context,
                                                         gl::ShCompilerInstance *compilerInstance,
                                                         ShCompileOptions options)
+{
+    return compileImpl(context, compilerInstance, mState.getSource(),
+                       getTranslatorCompileOptions(context, options));
+}
+
+ShCompileOptions ShaderVk::getTranslatorCompileOptions(const gl::Context *context,
+                                                       ShCompileOptions options) const
 {
     ShCompileOptions compileOptions = 0;
 
@@ -101,7 +108,12 @@ std::shared_ptr<WaitableCompileEvent> ShaderVk::compile(const gl::Context *conte
         compileOptions |= SH_ROUND_OUTPUT_AFTER_DITHERING;
     }
 
-    return compileImpl(context, compilerInstance, mState.getSource(), compileOptions | options);
+    if (contextVk->getFeatures().unrollConstantLoops.enabled)
+    {
+        compileOptions |= SH_UNROLL_CONSTANT_LOOPS;
+    }
+
+    return compileOptions | options;
 }
 
 std::string ShaderVk::getDebugInfo() const
@@ -24,6 +24,8 @@ class ShaderVk : public ShaderImpl
     std::shared_ptr<WaitableCompileEvent> compile(const gl::Context *context,
                                                   gl::ShCompilerInstance *compilerInstance,
                                                   ShCompileOptions options) override;
+    ShCompileOptions getTranslatorCompileOptions(const gl::Context *context,
+                                                 ShCompileOptions options) const override;
 
     std::string getDebugInfo() const override;
 };
@@ -10,6 +10,7 @@
 #include "libANGLE/renderer/vulkan/SurfaceVk.h"
 
 #include "common/debug.h"
+#include "common/system_utils.h"
 #include "libANGLE/Context.h"
 #include "libANGLE/Display.h"
 #include "libANGLE/Overlay.h"
@@ -104,6 +105,38 @@ vk::PresentMode GetDesiredPresentMode(const std::vector<vk::PresentMode> &presen
     return vk::PresentMode::FifoKHR;
 }
 
+uint32_t GetMinImageCount(vk::PresentMode presentMode,
+                          bool lowLatencyPresent,
+                          const VkSurfaceCapabilitiesKHR &surfaceCaps)
+{
+    // - On mailbox, we need at least three images; one is being displayed to the user until the
+    //   next v-sync, and the application alternatingly renders to the other two, one being
+    //   recorded, and the other queued for presentation if v-sync happens in the meantime.
+    // - On immediate, we need at least two images; the application alternates between the two
+    //   images.
+    // - On fifo, we use at least three images.  Triple-buffering allows us to present an image,
+    //   have one in the queue, and record in another.  Note: on certain configurations (windows +
+    //   nvidia + windowed mode), we could get away with a smaller number.
+    //
+    // For simplicity, we always allocate at least three images, unless low-latency presentation is
+    // requested.  In that case, fifo and immediate are double-buffered so that no more than one
+    // frame is queued behind the one being displayed.
+    uint32_t minImageCount = 3;
+    if (lowLatencyPresent && presentMode != vk::PresentMode::MailboxKHR)
+    {
+        minImageCount = 2;
+    }
+    minImageCount = std::max(minImageCount, surfaceCaps.minImageCount);
+
+    // Make sure we don't exceed maxImageCount.
+    if (surfaceCaps.maxImageCount > 0 && minImageCount > surfaceCaps.maxImageCount)
+    {
+        minImageCount = surfaceCaps.maxImageCount;
+    }
+
+    return minImageCount;
+}
+
 constexpr VkImageUsageFlags kSurfaceVkImageUsageFlags =
     VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_SAMPLED_BIT;
 constexpr VkImageUsageFlags kSurfaceVkColorImageUsageFlags =
@@ -783,7 +816,15 @@ WindowSurfaceVk::WindowSurfaceVk(const egl::SurfaceState &surfaceState, EGLNativ
       mColorImageMSBinding(this, kAnySurfaceImageSubjectIndex),
       mNeedToAcquireNextSwapchainImage(false),
       mFrameCount(1),
-      mBufferAgeQueryFrameNumber(0)
+      mBufferAgeQueryFrameNumber(0),
+      mLowLatencyPresent(surfaceState.attributes.get(EGL_LOW_LATENCY_PRESENT_ANGLE, EGL_FALSE) ==
+                         EGL_TRUE),
+      mUsePresentWait(false),
+      mPresentId(0),
+      mSwapchainFirstPresentId(0),
+      mFrameStartTime(0),
+      mPresentedFrameStartTime(0),
+      mPresentLatency(0)
 {
     // Initialize the color render target with the multisampled targets.  If not multisampled, the
     // render target will be updated to refer to a swapchain image on every acquire.
@@ -810,6 +851,7 @@ void WindowSurfaceVk::destroy(const egl::Display *display)
 
     // flush the pipe.
     (void)renderer->finish(displayVk, mState.hasProtectedContent());
+    renderer->waitForPresentThreadIdle();
 
     if (mLockBufferHelper.valid())
     {
@@ -866,6 +908,12 @@ angle::Result WindowSurfaceVk::initializeImpl(DisplayVk *displayVk)
 
     renderer->reloadVolkIfNeeded();
 
+    // vkWaitForPresentKHR requires external synchronization of the swapchain, which the async
+    // command queue and the present thread present to from their own threads.
+    mUsePresentWait = mLowLatencyPresent && renderer->getFeatures().supportsPresentWait.enabled &&
+                      !renderer->isAsyncCommandQueueEnabled() &&
+                      !renderer->isPresentThreadEnabled();
+
     gl::Extents windowSize;
     ANGLE_TRY(createSurfaceVk(displayVk, &windowSize));
 
@@ -1112,6 +1160,8 @@ angle::Result WindowSurfaceVk::initializeImpl(DisplayVk *displayVk)
     ASSERT(vkResult != VK_SUBOPTIMAL_KHR);
     ANGLE_VK_TRY(displayVk, vkResult);
 
+    mFrameStartTime = angle::GetCurrentSystemTime();
+
     return angle::Result::Continue;
 }
 
@@ -1375,8 +1425,9 @@ angle::Result WindowSurfaceVk::createSwapChain(vk::Context *context,
     // swapchain need to carry over to the new one.  http://anglebug.com/2942
     VkSwapchainKHR newSwapChain = VK_NULL_HANDLE;
     ANGLE_VK_TRY(context, vkCreateSwapchainKHR(device, &swapchainInfo, nullptr, &newSwapChain));
-    mSwapchain            = newSwapChain;
-    mSwapchainPresentMode = mDesiredSwapchainPresentMode;
+    mSwapchain               = newSwapChain;
+    mSwapchainPresentMode    = mDesiredSwapchainPresentMode;
+    mSwapchainFirstPresentId = mPresentId + 1;
 
     // Initialize the swapchain image views.
     uint32_t imageCount = 0;
@@ -1871,6 +1922,19 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
         presentInfo.pNext = &presentRegions;
     }
 
+    VkPresentIdKHR presentId  = {};
+    const bool usePresentWait = mUsePresentWait && !isSharedPresentMode();
+    if (usePresentWait)
+    {
+        ++mPresentId;
+
+        presentId.sType          = VK_STRUCTURE_TYPE_PRESENT_ID_KHR;
+        presentId.swapchainCount = 1;
+        presentId.pPresentIds    = &mPresentId;
+
+        vk::AddToPNextChain(&presentInfo, &presentId);
+    }
+
     ASSERT(mAcquireImageSemaphore == nullptr);
 
     VkResult result = renderer->queuePresent(contextVk, contextVk->getPriority(), presentInfo);
@@ -1878,6 +1942,11 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
     // Set FrameNumber for the presented image.
     mSwapchainImages[mCurrentSwapchainImageIndex].mFrameNumber = mFrameCount++;
 
+    if (usePresentWait)
+    {
+        ANGLE_TRY(waitForPreviousPresent(contextVk));
+    }
+
     ANGLE_TRY(computePresentOutOfDate(contextVk, result, presentOutOfDate));
 
     contextVk->resetPerFramePerfCounters();
@@ -1885,6 +1954,40 @@ angle::Result WindowSurfaceVk::present(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+angle::Result WindowSurfaceVk::waitForPreviousPresent(ContextVk *contextVk)
+{
+    // Waiting for the previous frame rather than this one lets the GPU work on this frame while
+    // the CPU waits, while still never queuing more than one frame behind the displayed one.
+    const uint64_t previousPresentId = mPresentId - 1;
+    if (previousPresentId >= mSwapchainFirstPresentId)
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "WindowSurfaceVk::present: Wait for previous present");
+
+        // Don't let a present that never completes (for example because the window is hidden)
+        // hang the application.
+        constexpr uint64_t kMaxPresentWaitTimeNs = 100'000'000;
+        VkResult result = vkWaitForPresentKHR(contextVk->getDevice(), mSwapchain,
+                                              previousPresentId, kMaxPresentWaitTimeNs);
+        if (result == VK_SUCCESS)
+        {
+            const double latency = angle::GetCurrentSystemTime() - mPresentedFrameStartTime;
+            mPresentLatency      = static_cast<EGLint>(latency * 1'000'000);
+        }
+        else if (result != VK_TIMEOUT && result != VK_SUBOPTIMAL_KHR &&
+                 result != VK_ERROR_OUT_OF_DATE_KHR)
+        {
+            // An out-of-date swapchain is handled when the next image is acquired.
+            ANGLE_VK_TRY(contextVk, result);
+        }
+    }
+
+    // The application starts its next frame once the swap returns.
+    mPresentedFrameStartTime = mFrameStartTime;
+    mFrameStartTime          = angle::GetCurrentSystemTime();
+
+    return angle::Result::Continue;
+}
+
 angle::Result WindowSurfaceVk::swapImpl(const gl::Context *context,
                                         const EGLint *rects,
                                         EGLint n_rects,
@@ -1897,6 +2000,9 @@ angle::Result WindowSurfaceVk::swapImpl(const gl::Context *context,
     bool presentOutOfDate = false;
     ANGLE_TRY(present(contextVk, rects, n_rects, pNextChain, &presentOutOfDate));
 
+    // The damage region only applies to the frame that was just presented.
+    mDamageRegion.reset();
+
     if (!presentOutOfDate)
     {
         // Defer acquiring the next swapchain image since the swapchain is not out-of-date.
@@ -1942,7 +2048,9 @@ angle::Result WindowSurfaceVk::doDeferredAcquireNextImage(const gl::Context *con
     ContextVk *contextVk = vk::GetImpl(context);
 
     // TODO(jmadill): Expose in CommandQueueInterface, or manage in CommandQueue. b/172704839
-    if (contextVk->getRenderer()->isAsyncCommandQueueEnabled())
+    // This also makes sure the swapchain is no longer being presented to from another thread.
+    if (contextVk->getRenderer()->isAsyncCommandQueueEnabled() ||
+        contextVk->getRenderer()->isPresentThreadEnabled())
     {
         VkResult result = contextVk->getRenderer()->getLastPresentResult(mSwapchain);
 
@@ -2151,24 +2259,8 @@ void WindowSurfaceVk::setSwapInterval(EGLint interval)
     interval = gl::clamp(interval, minSwapInterval, maxSwapInterval);
 
     mDesiredSwapchainPresentMode = GetDesiredPresentMode(mPresentModes, interval);
-
-    // - On mailbox, we need at least three images; one is being displayed to the user until the
-    //   next v-sync, and the application alternatingly renders to the other two, one being
-    //   recorded, and the other queued for presentation if v-sync happens in the meantime.
-    // - On immediate, we need at least two images; the application alternates between the two
-    //   images.
-    // - On fifo, we use at least three images.  Triple-buffering allows us to present an image,
-    //   have one in the queue, and record in another.  Note: on certain configurations (windows +
-    //   nvidia + windowed mode), we could get away with a smaller number.
-    //
-    // For simplicity, we always allocate at least three images.
-    mMinImageCount = std::max(3u, mSurfaceCaps.minImageCount);
-
-    // Make sure we don't exceed maxImageCount.
-    if (mSurfaceCaps.maxImageCount > 0 && mMinImageCount > mSurfaceCaps.maxImageCount)
-    {
-        mMinImageCount = mSurfaceCaps.maxImageCount;
-    }
+    mMinImageCount =
+        GetMinImageCount(mDesiredSwapchainPresentMode, mLowLatencyPresent, mSurfaceCaps);
 
     // On the next swap, if the desired present mode is different from the current one, the
     // swapchain will be recreated.
@@ -2508,12 +2600,44 @@ egl::Error WindowSurfaceVk::getBufferAge(const gl::Context *context, EGLint *age
     return egl::NoError();
 }
 
+EGLint WindowSurfaceVk::getPresentLatency() const
+{
+    return mPresentLatency;
+}
+
 bool WindowSurfaceVk::supportsPresentMode(vk::PresentMode presentMode) const
 {
     return (std::find(mPresentModes.begin(), mPresentModes.end(), presentMode) !=
             mPresentModes.end());
 }
 
+void WindowSurfaceVk::setDamageRegion(const EGLint *rects, EGLint n_rects)
+{
+    // An empty list of rectangles damages the whole surface.
+    mDamageRegion.reset();
+    if (n_rects == 0)
+    {
+        return;
+    }
+
+    // Rectangles are given as (x, y, width, height) with a bottom-left origin, which matches the
+    // non-rotated render area of the default framebuffer.
+    gl::Rectangle boundingBox(rects[0], rects[1], rects[2], rects[3]);
+    for (EGLint rectIndex = 1; rectIndex < n_rects; ++rectIndex)
+    {
+        const EGLint *rect = rects + rectIndex * 4;
+        gl::ExtendRectangle(boundingBox, gl::Rectangle(rect[0], rect[1], rect[2], rect[3]),
+                            &boundingBox);
+    }
+
+    gl::Rectangle clippedBoundingBox;
+    if (gl::ClipRectangle(boundingBox, gl::Rectangle(0, 0, getWidth(), getHeight()),
+                          &clippedBoundingBox))
+    {
+        mDamageRegion = clippedBoundingBox;
+    }
+}
+
 egl::Error WindowSurfaceVk::setRenderBuffer(EGLint renderBuffer)
 {
     if (renderBuffer == EGL_SINGLE_BUFFER)
@@ -271,6 +271,14 @@ class WindowSurfaceVk : public SurfaceVk
     }
 
     egl::Error getBufferAge(const gl::Context *context, EGLint *age) override;
+    void setDamageRegion(const EGLint *rects, EGLint n_rects) override;
+
+    // The bounding box of the EGL_KHR_partial_update damage region of the current frame, if one is
+    // set.  Rendering outside of it has undefined results, so the render passes of the back buffer
+    // don't need to cover more than this area.
+    const Optional<gl::Rectangle> &getDamageRegion() const { return mDamageRegion; }
+
+    EGLint getPresentLatency() const override;
 
     egl::Error setRenderBuffer(EGLint renderBuffer) override;
 
@@ -334,6 +342,9 @@ class WindowSurfaceVk : public SurfaceVk
                           EGLint n_rects,
                           const void *pNextChain,
                           bool *presentOutOfDate);
+    // In low-latency mode, waits for the frame presented before the one that was just presented to
+    // be displayed, and measures its latency.
+    angle::Result waitForPreviousPresent(ContextVk *contextVk);
 
     void updateOverlay(ContextVk *contextVk) const;
     bool overlayHasEnabledWidget(ContextVk *contextVk) const;
@@ -425,9 +436,24 @@ class WindowSurfaceVk : public SurfaceVk
 
     // EGL_KHR_partial_update
     uint64_t mBufferAgeQueryFrameNumber;
+    Optional<gl::Rectangle> mDamageRegion;
 
     // GL_EXT_shader_framebuffer_fetch
     FramebufferFetchMode mFramebufferFetchMode = FramebufferFetchMode::Disabled;
+
+    // EGL_ANGLE_low_latency_present: With VK_KHR_present_wait, every present is given an id so
+    // that the CPU can wait for the previous frame to be displayed before starting the next one.
+    // Ids restart being waitable from mSwapchainFirstPresentId when the swapchain is recreated.
+    bool mLowLatencyPresent;
+    bool mUsePresentWait;
+    uint64_t mPresentId;
+    uint64_t mSwapchainFirstPresentId;
+    // The time at which the application started the frame being recorded, and the frame that was
+    // last presented.  The latency of a frame is measured from this time until it is displayed.
+    double mFrameStartTime;
+    double mPresentedFrameStartTime;
+    // In microseconds.
+    EGLint mPresentLatency;
 };
 
 }  // namespace rx
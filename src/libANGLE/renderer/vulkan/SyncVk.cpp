@@ -84,20 +84,7 @@ angle::Result SyncHelper::initialize(ContextVk *contextVk, bool isEglSyncObject)
 {
     ASSERT(!mUse.getSerial().valid());
 
-    // Submit the commands:
-    //
-    // - This breaks the current render pass to ensure the proper ordering of the sync object in the
-    //   commands,
-    // - The sync object has a valid serial when it's waited on later,
-    // - After waiting on the sync object, every resource that's used so far (and is being synced)
-    //   will also be aware that it's finished (based on the serial) and won't incur a further wait
-    //   (for example when a buffer is mapped).
-    //
-    ResourceUseList resourceUseList;
-    retain(&resourceUseList);
-    contextVk->getShareGroupVk()->acquireResourceUseList(std::move(resourceUseList));
-
-    return contextVk->flushImpl(nullptr, RenderPassClosureReason::SyncObjectInit);
+    return contextVk->onSyncObjectInit(this, isEglSyncObject);
 }
 
 angle::Result SyncHelper::clientWait(Context *context,
@@ -108,6 +95,13 @@ angle::Result SyncHelper::clientWait(Context *context,
 {
     RendererVk *renderer = context->getRenderer();
 
+    // If the submission of the commands was deferred on initialization, do it now so the wait can
+    // finish.  This is done regardless of |flushCommands|, as nothing else may end the render pass.
+    if (contextVk != nullptr && usedInRecordedCommands())
+    {
+        ANGLE_TRY(contextVk->flushIfDeferred(RenderPassClosureReason::SyncObjectClientWait));
+    }
+
     // If the event is already set, don't wait
     bool alreadySignaled = false;
     ANGLE_TRY(getStatus(context, &alreadySignaled));
@@ -124,9 +118,14 @@ angle::Result SyncHelper::clientWait(Context *context,
         return angle::Result::Continue;
     }
 
-    // We always flush when a sync object is created, so they should always have a valid Serial
-    // when being waited on.
-    ASSERT(mUse.getSerial().valid() && !usedInRecordedCommands());
+    // If the sync object is still in the recorded commands of another context, the wait can't
+    // finish until that context submits them.
+    if (usedInRecordedCommands())
+    {
+        *outResult = VK_TIMEOUT;
+        return angle::Result::Continue;
+    }
+    ASSERT(mUse.getSerial().valid());
 
     VkResult status = VK_SUCCESS;
     ANGLE_TRY(renderer->waitForSerialWithUserTimeout(context, mUse.getSerial(), timeout, &status));
@@ -156,10 +155,24 @@ angle::Result SyncHelper::serverWait(ContextVk *contextVk)
 
 angle::Result SyncHelper::getStatus(Context *context, bool *signaled) const
 {
-    ASSERT(mUse.getSerial().valid() && !usedInRecordedCommands());
+    // The commands may not have been submitted yet if that was deferred on initialization.
+    if (usedInRecordedCommands())
+    {
+        *signaled = false;
+        return angle::Result::Continue;
+    }
+    ASSERT(mUse.getSerial().valid());
+
+    // Check against the last completed serial first, which doesn't need to query the driver.
+    RendererVk *renderer = context->getRenderer();
+    if (!usedInRunningCommands(renderer->getLastCompletedQueueSerial()))
+    {
+        *signaled = true;
+        return angle::Result::Continue;
+    }
 
-    ANGLE_TRY(context->getRenderer()->checkCompletedCommands(context));
-    *signaled = !isCurrentlyInUse(context->getRenderer()->getLastCompletedQueueSerial());
+    ANGLE_TRY(renderer->checkCompletedCommands(context));
+    *signaled = !usedInRunningCommands(renderer->getLastCompletedQueueSerial());
     return angle::Result::Continue;
 }
 
@@ -428,7 +441,15 @@ angle::Result SyncVk::serverWait(const gl::Context *context, GLbitfield flags, G
 angle::Result SyncVk::getStatus(const gl::Context *context, GLint *outResult)
 {
     ContextVk *contextVk = vk::GetImpl(context);
-    bool signaled        = false;
+
+    // Apps may poll the status of the sync object without issuing any other command, so submit the
+    // commands if that was deferred on initialization.
+    if (mSyncHelper.usedInRecordedCommands())
+    {
+        ANGLE_TRY(contextVk->flushIfDeferred(RenderPassClosureReason::SyncObjectGetStatus));
+    }
+
+    bool signaled = false;
     ANGLE_TRY(mSyncHelper.getStatus(contextVk, &signaled));
 
     *outResult = signaled ? GL_SIGNALED : GL_UNSIGNALED;
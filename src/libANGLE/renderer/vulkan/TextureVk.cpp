@@ -48,6 +48,22 @@ constexpr VkImageAspectFlags kDepthStencilAspects =
 
 constexpr angle::SubjectIndex kTextureImageSubjectIndex = 0;
 
+// The dirty bits of the state the texture's sampler is created from.
+constexpr gl::Texture::DirtyBits kSamplerDirtyBits = gl::Texture::DirtyBits({
+    gl::Texture::DIRTY_BIT_MIN_FILTER,
+    gl::Texture::DIRTY_BIT_MAG_FILTER,
+    gl::Texture::DIRTY_BIT_WRAP_S,
+    gl::Texture::DIRTY_BIT_WRAP_T,
+    gl::Texture::DIRTY_BIT_WRAP_R,
+    gl::Texture::DIRTY_BIT_MAX_ANISOTROPY,
+    gl::Texture::DIRTY_BIT_MIN_LOD,
+    gl::Texture::DIRTY_BIT_MAX_LOD,
+    gl::Texture::DIRTY_BIT_COMPARE_MODE,
+    gl::Texture::DIRTY_BIT_COMPARE_FUNC,
+    gl::Texture::DIRTY_BIT_BORDER_COLOR,
+    gl::Texture::DIRTY_BIT_DEPTH_STENCIL_TEXTURE_MODE,
+});
+
 // Test whether a texture level is within the range of levels for which the current image is
 // allocated.  This is used to ensure out-of-range updates are staged in the image, and not
 // attempted to be directly applied.
@@ -293,6 +309,7 @@ TextureVk::TextureVk(const gl::TextureState &state, RendererVk *renderer)
     : TextureImpl(state),
       mOwnsImage(false),
       mRequiresMutableStorage(false),
+      mDeferImmutableLevelAllocation(false),
       mRequiredImageAccess(vk::ImageAccess::SampleOnly),
       mImmutableSamplerDirty(false),
       mEGLImageNativeType(gl::TextureType::InvalidEnum),
@@ -416,29 +433,39 @@ angle::Result TextureVk::setImageImpl(const gl::Context *context,
                            unpackBuffer, pixels, vkFormat);
 }
 
-bool TextureVk::isFastUnpackPossible(const vk::Format &vkFormat, size_t offset) const
+bool TextureVk::isUnpackBufferCopyPossible(const vk::Format &vkFormat) const
 {
-    // Conditions to determine if fast unpacking is possible
-    // 1. Image must be well defined to unpack directly to it
-    //    TODO(http://anglebug.com/4222) Create and stage a temp image instead
-    // 2. Can't perform a fast copy for depth/stencil, except from non-emulated depth or stencil
-    //    to emulated depth/stencil.  GL requires depth and stencil data to be packed, while Vulkan
+    // Conditions to determine if the unpack buffer can be copied to the image
+    // 1. Can't perform a copy for depth/stencil, except from non-emulated depth or stencil to
+    //    emulated depth/stencil.  GL requires depth and stencil data to be packed, while Vulkan
     //    requires them to be separate.
-    // 2. Can't perform a fast copy for emulated formats, except from non-emulated depth or stencil
-    //    to emulated depth/stencil.
-    // 3. vkCmdCopyBufferToImage requires byte offset to be a multiple of 4
+    // 2. Can't perform a copy for emulated formats, except from non-emulated depth or stencil to
+    //    emulated depth/stencil.
     const angle::Format &bufferFormat = vkFormat.getActualBufferFormat(false);
     const bool isCombinedDepthStencil = bufferFormat.depthBits > 0 && bufferFormat.stencilBits > 0;
     const bool isDepthXorStencil = (bufferFormat.depthBits > 0 && bufferFormat.stencilBits == 0) ||
                                    (bufferFormat.depthBits == 0 && bufferFormat.stencilBits > 0);
     const bool isCompatibleDepth = vkFormat.getIntendedFormat().depthBits == bufferFormat.depthBits;
-    const VkDeviceSize imageCopyAlignment =
-        vk::GetImageCopyBufferAlignment(mImage->getActualFormatID());
-    return mImage->valid() && !isCombinedDepthStencil &&
+    return !isCombinedDepthStencil &&
            (vkFormat.getIntendedFormatID() ==
                 vkFormat.getActualImageFormatID(getRequiredImageAccess()) ||
-            (isDepthXorStencil && isCompatibleDepth)) &&
-           (offset % imageCopyAlignment) == 0;
+            (isDepthXorStencil && isCompatibleDepth));
+}
+
+bool TextureVk::isFastUnpackPossible(const vk::Format &vkFormat, size_t offset) const
+{
+    // Conditions to determine if fast unpacking is possible
+    // 1. Image must be well defined to unpack directly to it
+    // 2. The unpack buffer can be copied to the image, see isUnpackBufferCopyPossible
+    // 3. vkCmdCopyBufferToImage requires byte offset to be a multiple of 4
+    if (!mImage->valid() || !isUnpackBufferCopyPossible(vkFormat))
+    {
+        return false;
+    }
+
+    const VkDeviceSize imageCopyAlignment =
+        vk::GetImageCopyBufferAlignment(mImage->getActualFormatID());
+    return (offset % imageCopyAlignment) == 0;
 }
 
 bool TextureVk::shouldUpdateBeStaged(gl::LevelIndex textureLevelIndexGL,
@@ -514,19 +541,22 @@ angle::Result TextureVk::setSubImageImpl(const gl::Context *context,
         const VkImageAspectFlags aspectFlags =
             vk::GetFormatAspectFlags(vkFormat.getIntendedFormat());
 
-        if (!shouldUpdateBeStaged(gl::LevelIndex(index.getLevelIndex()),
-                                  vkFormat.getActualImageFormatID(getRequiredImageAccess())) &&
-            isFastUnpackPossible(vkFormat, offsetBytes))
+        const bool isUpdateStaged =
+            shouldUpdateBeStaged(gl::LevelIndex(index.getLevelIndex()),
+                                 vkFormat.getActualImageFormatID(getRequiredImageAccess()));
+
+        GLuint pixelSize   = formatInfo.pixelBytes;
+        GLuint blockWidth  = formatInfo.compressedBlockWidth;
+        GLuint blockHeight = formatInfo.compressedBlockHeight;
+        if (!formatInfo.compressed)
+        {
+            pixelSize   = formatInfo.computePixelBytes(type);
+            blockWidth  = 1;
+            blockHeight = 1;
+        }
+
+        if (!isUpdateStaged && isFastUnpackPossible(vkFormat, offsetBytes))
         {
-            GLuint pixelSize   = formatInfo.pixelBytes;
-            GLuint blockWidth  = formatInfo.compressedBlockWidth;
-            GLuint blockHeight = formatInfo.compressedBlockHeight;
-            if (!formatInfo.compressed)
-            {
-                pixelSize   = formatInfo.computePixelBytes(type);
-                blockWidth  = 1;
-                blockHeight = 1;
-            }
             ASSERT(pixelSize != 0 && inputRowPitch != 0 && blockWidth != 0 && blockHeight != 0);
 
             GLuint rowLengthPixels   = inputRowPitch / pixelSize * blockWidth;
@@ -535,6 +565,29 @@ angle::Result TextureVk::setSubImageImpl(const gl::Context *context,
             ANGLE_TRY(copyBufferDataToImage(contextVk, &bufferHelper, index, rowLengthPixels,
                                             imageHeightPixels, area, offsetBytes, aspectFlags));
         }
+        else if (isUpdateStaged && isUnpackBufferCopyPossible(vkFormat))
+        {
+            // The update can't be applied yet, e.g. because the image is not yet created.  Instead
+            // of mapping the unpack buffer, which waits for the GPU to finish writing it, the data
+            // is copied on the GPU to a staging buffer the update is then applied from.
+            ASSERT(pixelSize != 0 && inputRowPitch != 0 && blockWidth != 0 && blockHeight != 0);
+
+            GLuint rowLengthPixels   = inputRowPitch / pixelSize * blockWidth;
+            GLuint imageHeightPixels = inputDepthPitch / inputRowPitch * blockHeight;
+
+            GLuint endByte = 0;
+            ANGLE_VK_CHECK_MATH(
+                contextVk, formatInfo.computePackUnpackEndByte(
+                               type, gl::Extents(area.width, area.height, area.depth), unpack,
+                               index.usesTex3D(), &endByte));
+            ASSERT(endByte >= inputSkipBytes);
+
+            ANGLE_TRY(mImage->stageSubresourceUpdateFromBuffer(
+                contextVk, &bufferHelper, offsetBytes, endByte - inputSkipBytes,
+                getNativeImageIndex(index), gl::Extents(area.width, area.height, area.depth),
+                gl::Offset(area.x, area.y, area.z), rowLengthPixels, imageHeightPixels,
+                aspectFlags, vkFormat.getActualImageFormatID(getRequiredImageAccess())));
+        }
         else
         {
             ANGLE_VK_PERF_WARNING(
@@ -560,16 +613,32 @@ angle::Result TextureVk::setSubImageImpl(const gl::Context *context,
     }
     else if (pixels)
     {
-        ANGLE_TRY(mImage->stageSubresourceUpdate(
-            contextVk, getNativeImageIndex(index), gl::Extents(area.width, area.height, area.depth),
-            gl::Offset(area.x, area.y, area.z), formatInfo, unpack, type, pixels, vkFormat,
-            getRequiredImageAccess()));
+        // Updates that would be flushed right away are copied on the host instead if possible,
+        // which needs neither a staging buffer nor a command buffer.
+        bool copiedOnHost = false;
+        if (shouldFlush)
+        {
+            ANGLE_TRY(mImage->updateSubresourceOnHost(
+                contextVk, getNativeImageIndex(index),
+                gl::Extents(area.width, area.height, area.depth),
+                gl::Offset(area.x, area.y, area.z), formatInfo, unpack, type, pixels, vkFormat,
+                getRequiredImageAccess(), &copiedOnHost));
+        }
+
+        if (!copiedOnHost)
+        {
+            ANGLE_TRY(mImage->stageSubresourceUpdate(
+                contextVk, getNativeImageIndex(index),
+                gl::Extents(area.width, area.height, area.depth),
+                gl::Offset(area.x, area.y, area.z), formatInfo, unpack, type, pixels, vkFormat,
+                getRequiredImageAccess()));
+        }
     }
 
     // If we used context's staging buffer, flush out the updates
     if (shouldFlush)
     {
-        ANGLE_TRY(ensureImageInitialized(contextVk, ImageMipLevels::EnabledLevels));
+        ANGLE_TRY(ensureImageInitialized(contextVk, ImageMipLevels::UpdatedLevels));
 
         // If forceSubmitImmutableTextureUpdates is enabled, submit the staged updates as well
         if (contextVk->getFeatures().forceSubmitImmutableTextureUpdates.enabled)
@@ -1309,6 +1378,18 @@ angle::Result TextureVk::setStorageMultisample(const gl::Context *context,
 
     ASSERT(mState.getImmutableFormat());
     ASSERT(!mRedefinedLevels.any());
+
+    // Defer creating the image until the texture is used, so that it can be created with only the
+    // levels that are uploaded to by then.
+    mDeferImmutableLevelAllocation =
+        contextVk->getFeatures().deferImmutableTextureLevelAllocation.enabled && samples <= 1 &&
+        mState.getImmutableLevels() > 1 && !contextVk->isRobustResourceInitEnabled() &&
+        !mState.hasProtectedContent();
+    if (mDeferImmutableLevelAllocation)
+    {
+        return angle::Result::Continue;
+    }
+
     ANGLE_TRY(initImage(contextVk, format.getIntendedFormatID(),
                         format.getActualImageFormatID(getRequiredImageAccess()),
                         ImageMipLevels::FullMipChain));
@@ -1489,9 +1570,10 @@ void TextureVk::releaseAndDeleteImageAndViews(ContextVk *contextVk)
         releaseStagedUpdates(contextVk);
         releaseImage(contextVk);
         mImageObserverBinding.bind(nullptr);
-        mRequiresMutableStorage = false;
-        mRequiredImageAccess    = vk::ImageAccess::SampleOnly;
-        mImageCreateFlags       = 0;
+        mRequiresMutableStorage        = false;
+        mDeferImmutableLevelAllocation = false;
+        mRequiredImageAccess           = vk::ImageAccess::SampleOnly;
+        mImageCreateFlags              = 0;
         SafeDelete(mImage);
     }
     mBufferViews.release(contextVk);
@@ -1992,18 +2074,35 @@ angle::Result TextureVk::maybeUpdateBaseMaxLevels(ContextVk *contextVk,
         return angle::Result::Continue;
     }
 
+    // Whether the image already has the new base level, with the size it's now defined with.
+    const bool isBaseLevelInImage =
+        mOwnsImage && newBaseLevel >= mImage->getFirstAllocatedLevel() &&
+        newBaseLevel <= mImage->getLastAllocatedLevel() &&
+        mState.getBaseLevelDesc().size == mImage->getLevelExtents(mImage->toVkLevel(newBaseLevel));
+
     if (mState.getImmutableFormat())
     {
+        // If the image doesn't have the new base level yet, allocate the rest of the mip chain.
+        if (isImmutableImagePartiallyAllocated() && newBaseLevel > mImage->getLastAllocatedLevel())
+        {
+            *updateResultOut = TextureUpdateResult::ImageRespecified;
+            return ensureAllImmutableLevelsAllocated(contextVk);
+        }
+
         // For immutable texture, baseLevel/maxLevel should be a subset of the texture's actual
         // number of mip levels. We don't need to respecify an image.
         ASSERT(!baseLevelChanged || newBaseLevel >= mImage->getFirstAllocatedLevel());
-        ASSERT(!maxLevelChanged || newMaxLevel < gl::LevelIndex(mImage->getLevelCount()));
+        ASSERT(!maxLevelChanged || newMaxLevel < gl::LevelIndex(mState.getImmutableLevels()));
     }
-    else if (!baseLevelChanged && (newMaxLevel <= mImage->getLastAllocatedLevel()))
+    else if (newMaxLevel <= mImage->getLastAllocatedLevel() &&
+             (!baseLevelChanged || isBaseLevelInImage))
     {
-        // With a valid image, check if only changing the maxLevel to a subset of the texture's
-        // actual number of mip levels
-        ASSERT(maxLevelChanged);
+        // With a valid image, check if the base and max levels are changed to a subset of the
+        // texture's actual mip levels.  The image views can select the new range of levels without
+        // respecifying the image, which would otherwise copy every level it retains.  Levels that
+        // fall out of the range are kept in the image, so that widening the range back doesn't
+        // respecify the image either.
+        ASSERT(baseLevelChanged || maxLevelChanged);
     }
     else
     {
@@ -2014,8 +2113,10 @@ angle::Result TextureVk::maybeUpdateBaseMaxLevels(ContextVk *contextVk,
     // Don't need to respecify the texture; but do need to update which vkImageView's are served up
     // by ImageViewHelper
 
-    // Update the current max level in ImageViewHelper
-    ANGLE_TRY(initImageViews(contextVk, newMaxLevel - newBaseLevel + 1));
+    // Update the current max level in ImageViewHelper.  Immutable textures whose level allocation
+    // is deferred may not have all the levels up to the max level.
+    const gl::LevelIndex newViewMaxLevel = std::min(newMaxLevel, mImage->getLastAllocatedLevel());
+    ANGLE_TRY(initImageViews(contextVk, newViewMaxLevel - newBaseLevel + 1));
 
     mCurrentBaseLevel = newBaseLevel;
     mCurrentMaxLevel  = newMaxLevel;
@@ -2263,6 +2364,29 @@ angle::Result TextureVk::respecifyImageStorage(ContextVk *contextVk)
     return angle::Result::Continue;
 }
 
+bool TextureVk::isImmutableImagePartiallyAllocated() const
+{
+    return mState.getImmutableFormat() && mOwnsImage && mImage != nullptr && mImage->valid() &&
+           mImage->getLevelCount() < mState.getImmutableLevels();
+}
+
+angle::Result TextureVk::ensureAllImmutableLevelsAllocated(ContextVk *contextVk)
+{
+    mDeferImmutableLevelAllocation = false;
+
+    if (!isImmutableImagePartiallyAllocated())
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_TRY(respecifyImageStorage(contextVk));
+
+    const vk::Format &format = getBaseLevelFormat(contextVk->getRenderer());
+    return initImage(contextVk, format.getIntendedFormatID(),
+                     format.getActualImageFormatID(getRequiredImageAccess()),
+                     ImageMipLevels::FullMipChain);
+}
+
 angle::Result TextureVk::bindTexImage(const gl::Context *context, egl::Surface *surface)
 {
     ContextVk *contextVk = vk::GetImpl(context);
@@ -2306,6 +2430,13 @@ angle::Result TextureVk::getAttachmentRenderTarget(const gl::Context *context,
 
     // Don't flush staged updates here. We'll handle that in FramebufferVk so we can defer clears.
 
+    mDeferImmutableLevelAllocation = false;
+    if (isImmutableImagePartiallyAllocated() &&
+        gl::LevelIndex(imageIndex.getLevelIndex()) > mImage->getLastAllocatedLevel())
+    {
+        ANGLE_TRY(ensureAllImmutableLevelsAllocated(contextVk));
+    }
+
     if (!mImage->valid())
     {
         const vk::Format &format = getBaseLevelFormat(contextVk->getRenderer());
@@ -2374,6 +2505,15 @@ angle::Result TextureVk::getAttachmentRenderTarget(const gl::Context *context,
 
 angle::Result TextureVk::ensureImageInitialized(ContextVk *contextVk, ImageMipLevels mipLevels)
 {
+    // Uploads can be deferred to levels that the image doesn't have, in which case the rest of the
+    // mip chain needs to be allocated.  Any other use of the texture needs all of its levels.
+    if (mipLevels != ImageMipLevels::UpdatedLevels ||
+        (isImmutableImagePartiallyAllocated() &&
+         mImage->getStagedUpdatesLevelEnd() > mImage->getLastAllocatedLevel() + 1))
+    {
+        ANGLE_TRY(ensureAllImmutableLevelsAllocated(contextVk));
+    }
+
     if (mImage->valid() && !mImage->hasStagedUpdatesInAllocatedLevels())
     {
         return angle::Result::Continue;
@@ -2640,7 +2780,7 @@ angle::Result TextureVk::respecifyImageStorageIfNecessary(ContextVk *contextVk,
     // then have more levels defined in it and mipmapping enabled.  In that case, the image needs
     // to be recreated.
     bool isMipmapEnabledByMinFilter = false;
-    if (!isGenerateMipmap && mImage && mImage->valid())
+    if (!isGenerateMipmap && !mState.getImmutableFormat() && mImage && mImage->valid())
     {
         isMipmapEnabledByMinFilter =
             mImage->getLevelCount() < getMipLevelCount(ImageMipLevels::EnabledLevels);
@@ -2720,10 +2860,19 @@ angle::Result TextureVk::syncState(const gl::Context *context,
 
     ANGLE_TRY(respecifyImageStorageIfNecessary(contextVk, source));
 
-    // Initialize the image storage and flush the pixel buffer.
+    // Initialize the image storage and flush the pixel buffer.  Textures that are only sampled
+    // don't need the levels that have not been uploaded to yet.
     const bool isGenerateMipmap = source == gl::Command::GenerateMipmap;
-    ANGLE_TRY(ensureImageInitialized(contextVk, isGenerateMipmap ? ImageMipLevels::FullMipChain
-                                                                 : ImageMipLevels::EnabledLevels));
+    ImageMipLevels mipLevels    = ImageMipLevels::UpdatedLevels;
+    if (isGenerateMipmap)
+    {
+        mipLevels = ImageMipLevels::FullMipChain;
+    }
+    else if (mState.hasBeenBoundAsImage())
+    {
+        mipLevels = ImageMipLevels::EnabledLevels;
+    }
+    ANGLE_TRY(ensureImageInitialized(contextVk, mipLevels));
 
     // Mask out the IMPLEMENTATION dirty bit to avoid unnecessary syncs.
     gl::Texture::DirtyBits localBits = dirtyBits;
@@ -2746,11 +2895,6 @@ angle::Result TextureVk::syncState(const gl::Context *context,
         return angle::Result::Continue;
     }
 
-    if (mSampler.valid())
-    {
-        mSampler.reset();
-    }
-
     if (localBits.test(gl::Texture::DIRTY_BIT_SWIZZLE_RED) ||
         localBits.test(gl::Texture::DIRTY_BIT_SWIZZLE_GREEN) ||
         localBits.test(gl::Texture::DIRTY_BIT_SWIZZLE_BLUE) ||
@@ -2766,9 +2910,17 @@ angle::Result TextureVk::syncState(const gl::Context *context,
         ANGLE_TRY(refreshImageViews(contextVk));
     }
 
-    vk::SamplerDesc samplerDesc(contextVk, mState.getSamplerState(), mState.isStencilMode(),
-                                &mImage->getYcbcrConversionDesc(), mImage->getIntendedFormatID());
-    ANGLE_TRY(renderer->getSamplerCache().getSampler(contextVk, samplerDesc, &mSampler));
+    // Keep the current sampler if none of the state it's created from has changed.  This avoids
+    // looking up the sampler cache, and keeps the descriptor sets that use the sampler valid.
+    if (!mSampler.valid() || (localBits & kSamplerDirtyBits).any())
+    {
+        mSampler.reset();
+
+        vk::SamplerDesc samplerDesc(contextVk, mState.getSamplerState(), mState.isStencilMode(),
+                                    &mImage->getYcbcrConversionDesc(),
+                                    mImage->getIntendedFormatID());
+        ANGLE_TRY(renderer->getSamplerCache().getSampler(contextVk, samplerDesc, &mSampler));
+    }
 
     updateCachedImageViewSerials();
 
@@ -3003,6 +3155,16 @@ angle::Result TextureVk::initImage(ContextVk *contextVk,
         firstLevelDesc = &mState.getLevelZeroDesc();
         firstLevel     = 0;
         levelCount     = mState.getImmutableLevels();
+
+        if (mipLevels == ImageMipLevels::UpdatedLevels && mDeferImmutableLevelAllocation)
+        {
+            // Only allocate up to the last level that has been uploaded to, making sure the base
+            // level is included.  The rest of the levels are allocated once they are needed.
+            const uint32_t baseLevelCount = mState.getEffectiveBaseLevel() + 1;
+            const uint32_t updatedLevelCount =
+                static_cast<uint32_t>(mImage->getStagedUpdatesLevelEnd().get());
+            levelCount = std::min(levelCount, std::max(baseLevelCount, updatedLevelCount));
+        }
     }
     else
     {
@@ -3022,9 +3184,21 @@ angle::Result TextureVk::initImage(ContextVk *contextVk,
         mImageCreateFlags |= VK_IMAGE_CREATE_PROTECTED_BIT;
     }
 
+    // Let uploads to the image be copied on the host when that doesn't slow down the device.  See
+    // vk::ImageHelper::updateSubresourceOnHost.
+    VkImageUsageFlags imageUsageFlags = mImageUsageFlags;
+    if (renderer->getFeatures().supportsHostImageCopy.enabled && samples == 1 &&
+        !mState.hasProtectedContent() &&
+        renderer->isHostImageCopyOptimal(vk::GetVkFormatFromFormatID(actualImageFormatID),
+                                         gl_vk::GetImageType(mState.getType()), mImageUsageFlags,
+                                         mImageCreateFlags))
+    {
+        imageUsageFlags |= VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT;
+    }
+
     ANGLE_TRY(mImage->initExternal(
         contextVk, mState.getType(), vkExtent, intendedImageFormatID, actualImageFormatID, samples,
-        mImageUsageFlags, mImageCreateFlags, vk::ImageLayout::Undefined, nullptr,
+        imageUsageFlags, mImageCreateFlags, vk::ImageLayout::Undefined, nullptr,
         gl::LevelIndex(firstLevel), levelCount, layerCount,
         contextVk->isRobustResourceInitEnabled(), mState.hasProtectedContent()));
 
@@ -3040,7 +3214,10 @@ angle::Result TextureVk::initImage(ContextVk *contextVk,
                                  renderer->getMemoryProperties(), flags));
 
     const uint32_t viewLevelCount =
-        mState.getImmutableFormat() ? getMipLevelCount(ImageMipLevels::EnabledLevels) : levelCount;
+        mState.getImmutableFormat()
+            ? std::min(getMipLevelCount(ImageMipLevels::EnabledLevels),
+                       levelCount - mState.getEffectiveBaseLevel())
+            : levelCount;
     ANGLE_TRY(initImageViews(contextVk, viewLevelCount));
 
     mCurrentBaseLevel = gl::LevelIndex(mState.getBaseLevel());
@@ -3159,6 +3336,7 @@ uint32_t TextureVk::getMipLevelCount(ImageMipLevels mipLevels) const
     {
         // Returns level count from base to max that has been specified, i.e, enabled.
         case ImageMipLevels::EnabledLevels:
+        case ImageMipLevels::UpdatedLevels:
             return mState.getEnabledLevelCount();
         // Returns all mipmap levels from base to max regardless if an image has been specified or
         // not.
@@ -3219,9 +3397,11 @@ angle::Result TextureVk::generateMipmapLevelsWithCPU(ContextVk *contextVk,
             mipLevelExtents, gl::Offset(), &destData, sourceFormat.id));
 
         // Generate the mipmap into that new buffer
-        sourceFormat.mipGenerationFunction(
-            previousLevelWidth, previousLevelHeight, previousLevelDepth, previousLevelData,
-            previousLevelRowPitch, previousLevelDepthPitch, destData, destRowPitch, destDepthPitch);
+        GenerateMipInParallel(contextVk->getImageLoadWorkerPool(),
+                              sourceFormat.mipGenerationFunction, previousLevelWidth,
+                              previousLevelHeight, previousLevelDepth, previousLevelData,
+                              previousLevelRowPitch, previousLevelDepthPitch, destData,
+                              destRowPitch, destDepthPitch);
 
         // Swap for the next iteration
         previousLevelWidth      = mipWidth;
@@ -23,8 +23,11 @@ enum class ImageMipLevels
 {
     EnabledLevels = 0,
     FullMipChain  = 1,
+    // Same as EnabledLevels, except immutable textures may only allocate the levels that have been
+    // uploaded to.  Used by paths that only upload to or sample from the texture.
+    UpdatedLevels = 2,
 
-    InvalidEnum = 2,
+    InvalidEnum = 3,
 };
 
 enum class TextureUpdateResult
@@ -495,10 +498,18 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
     // attributes at the next opportunity.
     angle::Result respecifyImageStorage(ContextVk *contextVk);
 
+    // With deferImmutableTextureLevelAllocation, the image of an immutable texture may be created
+    // with only the levels that have been uploaded to.  This recreates such an image with all of
+    // its levels, staging its current contents as updates to the new image.
+    bool isImmutableImagePartiallyAllocated() const;
+    angle::Result ensureAllImmutableLevelsAllocated(ContextVk *contextVk);
+
     // Update base and max levels, and re-create image if needed.
     angle::Result maybeUpdateBaseMaxLevels(ContextVk *contextVk,
                                            TextureUpdateResult *changeResultOut);
 
+    // Whether the unpack buffer can be copied to the image without conversion.
+    bool isUnpackBufferCopyPossible(const vk::Format &vkFormat) const;
     bool isFastUnpackPossible(const vk::Format &vkFormat, size_t offset) const;
 
     bool shouldUpdateBeStaged(gl::LevelIndex textureLevelIndexGL,
@@ -533,6 +544,9 @@ class TextureVk : public TextureImpl, public angle::ObserverInterface
 
     bool mOwnsImage;
     bool mRequiresMutableStorage;
+    // Whether the image of this immutable texture is allowed to allocate only the levels that are
+    // uploaded to.  Cleared once the texture is used in any other way.
+    bool mDeferImmutableLevelAllocation;
     vk::ImageAccess mRequiredImageAccess;
     bool mImmutableSamplerDirty;
 
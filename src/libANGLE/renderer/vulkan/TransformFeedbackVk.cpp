@@ -115,7 +115,8 @@ angle::Result TransformFeedbackVk::begin(const gl::Context *context,
                 vk::BufferHelper &bufferHelper = mCounterBufferHelpers[bufferIndex];
                 ANGLE_TRY(bufferHelper.initSuballocation(
                     contextVk, contextVk->getRenderer()->getDeviceLocalMemoryTypeIndex(), 16,
-                    contextVk->getRenderer()->getDefaultBufferAlignment()));
+                    contextVk->getRenderer()->getDefaultBufferAlignment(),
+                    vk::BufferUsageType::Static));
                 mCounterBufferHandles[bufferIndex] = bufferHelper.getBuffer().getHandle();
                 mCounterBufferOffsets[bufferIndex] = bufferHelper.getOffset();
             }
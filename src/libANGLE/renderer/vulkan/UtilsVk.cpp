@@ -1064,6 +1064,7 @@ void ResetDynamicState(ContextVk *contextVk, vk::RenderPassCommandBuffer *comman
     // - stencil reference: UtilsVk sets this when enabling stencil test
     // - stencil func: UtilsVk sets this when enabling stencil test
     // - stencil ops: UtilsVk sets this when enabling stencil test
+    // - primitive topology: UtilsVk sets this when not drawing a triangle list
 
     // Reset all other dynamic state, since it can affect UtilsVk functions:
     if (contextVk->getFeatures().supportsExtendedDynamicState.enabled)
@@ -1073,6 +1074,10 @@ void ResetDynamicState(ContextVk *contextVk, vk::RenderPassCommandBuffer *comman
         commandBuffer->setDepthTestEnable(VK_FALSE);
         commandBuffer->setStencilTestEnable(VK_FALSE);
     }
+    if (contextVk->getFeatures().useDynamicPrimitiveTopology.enabled)
+    {
+        commandBuffer->setPrimitiveTopology(VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST);
+    }
     if (contextVk->getFeatures().supportsExtendedDynamicState2.enabled)
     {
         commandBuffer->setRasterizerDiscardEnable(VK_FALSE);
@@ -1115,24 +1120,14 @@ uint32_t UtilsVk::GetGenerateMipmapMaxLevels(ContextVk *contextVk)
                : kGenerateMipmapMaxLevels;
 }
 
-UtilsVk::UtilsVk() = default;
+UtilsProgramsVk::UtilsProgramsVk() = default;
 
-UtilsVk::~UtilsVk() = default;
+UtilsProgramsVk::~UtilsProgramsVk() = default;
 
-void UtilsVk::destroy(RendererVk *renderer)
+void UtilsProgramsVk::destroy(RendererVk *renderer)
 {
     VkDevice device = renderer->getDevice();
 
-    for (Function f : angle::AllEnums<Function>())
-    {
-        for (auto &descriptorSetLayout : mDescriptorSetLayouts[f])
-        {
-            descriptorSetLayout.reset();
-        }
-        mPipelineLayouts[f].reset();
-        mDescriptorPools[f].destroy(renderer, VulkanCacheType::DriverUniformsDescriptors);
-    }
-
     for (vk::ShaderProgramHelper &program : mConvertIndexPrograms)
     {
         program.destroy(renderer);
@@ -1186,6 +1181,27 @@ void UtilsVk::destroy(RendererVk *renderer)
     }
     mUnresolveFragShaders.clear();
 
+    mShaderLibrary.destroy(device);
+}
+
+UtilsVk::UtilsVk() = default;
+
+UtilsVk::~UtilsVk() = default;
+
+void UtilsVk::destroy(RendererVk *renderer)
+{
+    VkDevice device = renderer->getDevice();
+
+    for (Function f : angle::AllEnums<Function>())
+    {
+        for (auto &descriptorSetLayout : mDescriptorSetLayouts[f])
+        {
+            descriptorSetLayout.reset();
+        }
+        mPipelineLayouts[f].reset();
+        mDescriptorPools[f].destroy(renderer, VulkanCacheType::DriverUniformsDescriptors);
+    }
+
     mPointSampler.destroy(device);
     mLinearSampler.destroy(device);
 }
@@ -1645,12 +1661,18 @@ angle::Result UtilsVk::convertIndexBuffer(ContextVk *contextVk,
         flags |= vk::InternalShader::ConvertIndex_comp::kIsPrimitiveRestartEnabled;
     }
 
-    vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
-    ANGLE_TRY(contextVk->getShaderLibrary().getConvertIndex_comp(contextVk, flags, &shader));
+    {
+        UtilsProgramsVk &programs = contextVk->getRenderer()->getUtilsPrograms();
+        std::lock_guard<std::mutex> lock(programs.getMutex());
 
-    ANGLE_TRY(setupComputeProgram(contextVk, Function::ConvertIndexBuffer, shader,
-                                  &mConvertIndexPrograms[flags], descriptorSet, &shaderParams,
-                                  sizeof(ConvertIndexShaderParams), commandBufferHelper));
+        vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
+        ANGLE_TRY(programs.mShaderLibrary.getConvertIndex_comp(contextVk, flags, &shader));
+
+        ANGLE_TRY(setupComputeProgram(contextVk, Function::ConvertIndexBuffer, shader,
+                                      &programs.mConvertIndexPrograms[flags], descriptorSet,
+                                      &shaderParams, sizeof(ConvertIndexShaderParams),
+                                      commandBufferHelper));
+    }
 
     constexpr uint32_t kInvocationsPerGroup = 64;
     constexpr uint32_t kInvocationsPerIndex = 2;
@@ -1719,12 +1741,18 @@ angle::Result UtilsVk::convertIndexIndirectBuffer(ContextVk *contextVk,
         flags |= vk::InternalShader::ConvertIndex_comp::kIsPrimitiveRestartEnabled;
     }
 
-    vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
-    ANGLE_TRY(contextVk->getShaderLibrary().getConvertIndex_comp(contextVk, flags, &shader));
+    {
+        UtilsProgramsVk &programs = contextVk->getRenderer()->getUtilsPrograms();
+        std::lock_guard<std::mutex> lock(programs.getMutex());
+
+        vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
+        ANGLE_TRY(programs.mShaderLibrary.getConvertIndex_comp(contextVk, flags, &shader));
 
-    ANGLE_TRY(setupComputeProgram(contextVk, Function::ConvertIndexIndirectBuffer, shader,
-                                  &mConvertIndexPrograms[flags], descriptorSet, &shaderParams,
-                                  sizeof(ConvertIndexIndirectShaderParams), commandBufferHelper));
+        ANGLE_TRY(setupComputeProgram(contextVk, Function::ConvertIndexIndirectBuffer, shader,
+                                      &programs.mConvertIndexPrograms[flags], descriptorSet,
+                                      &shaderParams, sizeof(ConvertIndexIndirectShaderParams),
+                                      commandBufferHelper));
+    }
 
     constexpr uint32_t kInvocationsPerGroup = 64;
     constexpr uint32_t kInvocationsPerIndex = 2;
@@ -1793,14 +1821,19 @@ angle::Result UtilsVk::convertLineLoopIndexIndirectBuffer(
 
     uint32_t flags = GetConvertIndexIndirectLineLoopFlag(params.indicesBitsWidth);
 
-    vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
-    ANGLE_TRY(contextVk->getShaderLibrary().getConvertIndexIndirectLineLoop_comp(contextVk, flags,
-                                                                                 &shader));
+    {
+        UtilsProgramsVk &programs = contextVk->getRenderer()->getUtilsPrograms();
+        std::lock_guard<std::mutex> lock(programs.getMutex());
 
-    ANGLE_TRY(setupComputeProgram(contextVk, Function::ConvertIndexIndirectLineLoopBuffer, shader,
-                                  &mConvertIndexIndirectLineLoopPrograms[flags], descriptorSet,
-                                  &shaderParams, sizeof(ConvertIndexIndirectLineLoopShaderParams),
-                                  commandBufferHelper));
+        vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
+        ANGLE_TRY(programs.mShaderLibrary.getConvertIndexIndirectLineLoop_comp(contextVk, flags,
+                                                                               &shader));
+
+        ANGLE_TRY(setupComputeProgram(
+            contextVk, Function::ConvertIndexIndirectLineLoopBuffer, shader,
+            &programs.mConvertIndexIndirectLineLoopPrograms[flags], descriptorSet, &shaderParams,
+            sizeof(ConvertIndexIndirectLineLoopShaderParams), commandBufferHelper));
+    }
 
     commandBuffer->dispatch(1, 1, 1);
 
@@ -1859,14 +1892,20 @@ angle::Result UtilsVk::convertLineLoopArrayIndirectBuffer(
 
     uint32_t flags = 0;
 
-    vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
-    ANGLE_TRY(
-        contextVk->getShaderLibrary().getConvertIndirectLineLoop_comp(contextVk, flags, &shader));
+    {
+        UtilsProgramsVk &programs = contextVk->getRenderer()->getUtilsPrograms();
+        std::lock_guard<std::mutex> lock(programs.getMutex());
 
-    ANGLE_TRY(setupComputeProgram(contextVk, Function::ConvertIndirectLineLoopBuffer, shader,
-                                  &mConvertIndirectLineLoopPrograms[flags], descriptorSet,
-                                  &shaderParams, sizeof(ConvertIndirectLineLoopShaderParams),
-                                  commandBufferHelper));
+        vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
+        ANGLE_TRY(
+            programs.mShaderLibrary.getConvertIndirectLineLoop_comp(contextVk, flags, &shader));
+
+        ANGLE_TRY(setupComputeProgram(contextVk, Function::ConvertIndirectLineLoopBuffer, shader,
+                                      &programs.mConvertIndirectLineLoopPrograms[flags],
+                                      descriptorSet, &shaderParams,
+                                      sizeof(ConvertIndirectLineLoopShaderParams),
+                                      commandBufferHelper));
+    }
 
     commandBuffer->dispatch(1, 1, 1);
 
@@ -2020,12 +2059,17 @@ angle::Result UtilsVk::convertVertexBufferImpl(
 
     vkUpdateDescriptorSets(contextVk->getDevice(), 1, &writeInfo, 0, nullptr);
 
-    vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
-    ANGLE_TRY(contextVk->getShaderLibrary().getConvertVertex_comp(contextVk, flags, &shader));
+    {
+        UtilsProgramsVk &programs = contextVk->getRenderer()->getUtilsPrograms();
+        std::lock_guard<std::mutex> lock(programs.getMutex());
+
+        vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
+        ANGLE_TRY(programs.mShaderLibrary.getConvertVertex_comp(contextVk, flags, &shader));
 
-    ANGLE_TRY(setupComputeProgram(contextVk, Function::ConvertVertexBuffer, shader,
-                                  &mConvertVertexPrograms[flags], descriptorSet, &shaderParams,
-                                  sizeof(shaderParams), commandBufferHelper));
+        ANGLE_TRY(setupComputeProgram(contextVk, Function::ConvertVertexBuffer, shader,
+                                      &programs.mConvertVertexPrograms[flags], descriptorSet,
+                                      &shaderParams, sizeof(shaderParams), commandBufferHelper));
+    }
 
     commandBuffer->dispatch(UnsignedCeilDivide(shaderParams.outputCount, 64), 1, 1);
 
@@ -2059,6 +2103,9 @@ angle::Result UtilsVk::startRenderPass(ContextVk *contextVk,
     vk::Framebuffer framebuffer;
     ANGLE_VK_TRY(contextVk, framebuffer.init(contextVk->getDevice(), framebufferInfo));
 
+    vk::MaybeImagelessFramebuffer renderPassFramebuffer;
+    renderPassFramebuffer.setHandle(framebuffer.getHandle());
+
     vk::AttachmentOpsArray renderPassAttachmentOps;
     vk::PackedClearValuesArray clearValues;
     clearValues.store(vk::kAttachmentIndexZero, VK_IMAGE_ASPECT_COLOR_BIT, {});
@@ -2068,7 +2115,7 @@ angle::Result UtilsVk::startRenderPass(ContextVk *contextVk,
                                               vk::ImageLayout::ColorAttachment);
 
     ANGLE_TRY(contextVk->beginNewRenderPass(
-        framebuffer, renderArea, renderPassDesc, renderPassAttachmentOps,
+        renderPassFramebuffer, renderArea, renderPassDesc, renderPassAttachmentOps,
         vk::PackedAttachmentCount(1), vk::kAttachmentIndexInvalid, clearValues, commandBufferOut));
 
     contextVk->addGarbage(&framebuffer);
@@ -2083,7 +2130,7 @@ angle::Result UtilsVk::clearFramebuffer(ContextVk *contextVk,
     ANGLE_TRY(ensureImageClearResourcesInitialized(contextVk));
 
     const gl::Rectangle &scissoredRenderArea = params.clearArea;
-    vk::Framebuffer *currentFramebuffer      = nullptr;
+    vk::MaybeImagelessFramebuffer currentFramebuffer;
     vk::RenderPassCommandBuffer *commandBuffer;
 
     // Start a new render pass if not already started
@@ -2145,30 +2192,36 @@ angle::Result UtilsVk::clearFramebuffer(ContextVk *contextVk,
         SetStencilStateForWrite(&pipelineDesc);
     }
 
-    vk::ShaderLibrary &shaderLibrary                    = contextVk->getShaderLibrary();
-    vk::RefCounted<vk::ShaderAndSerial> *vertexShader   = nullptr;
-    vk::RefCounted<vk::ShaderAndSerial> *fragmentShader = nullptr;
-    vk::ShaderProgramHelper *imageClearProgram          = &mImageClearProgramVSOnly;
-
-    ANGLE_TRY(shaderLibrary.getFullScreenTri_vert(contextVk, 0, &vertexShader));
-    if (params.clearColor)
-    {
-        const uint32_t flags =
-            GetImageClearFlags(*params.colorFormat, params.colorAttachmentIndexGL,
-                               params.clearDepth && !supportsDepthClamp);
-        ANGLE_TRY(shaderLibrary.getImageClear_frag(contextVk, flags, &fragmentShader));
-        imageClearProgram = &mImageClearPrograms[flags];
-    }
-
     // Make sure transform feedback is paused.  Needs to be done before binding the pipeline as
     // that's not allowed in Vulkan.
     const bool isTransformFeedbackActiveUnpaused =
         contextVk->getStartedRenderPassCommands().isTransformFeedbackActiveUnpaused();
     contextVk->pauseTransformFeedbackIfActiveUnpaused();
 
-    ANGLE_TRY(setupGraphicsProgram(contextVk, Function::ImageClear, vertexShader, fragmentShader,
-                                   imageClearProgram, &pipelineDesc, VK_NULL_HANDLE, &shaderParams,
-                                   sizeof(shaderParams), commandBuffer));
+    {
+        UtilsProgramsVk &programs = contextVk->getRenderer()->getUtilsPrograms();
+        std::lock_guard<std::mutex> lock(programs.getMutex());
+
+        vk::ShaderLibrary &shaderLibrary                    = programs.mShaderLibrary;
+        vk::RefCounted<vk::ShaderAndSerial> *vertexShader   = nullptr;
+        vk::RefCounted<vk::ShaderAndSerial> *fragmentShader = nullptr;
+        vk::ShaderProgramHelper *imageClearProgram          = &programs.mImageClearProgramVSOnly;
+
+        ANGLE_TRY(shaderLibrary.getFullScreenTri_vert(contextVk, 0, &vertexShader));
+        if (params.clearColor)
+        {
+            const uint32_t flags =
+                GetImageClearFlags(*params.colorFormat, params.colorAttachmentIndexGL,
+                                   params.clearDepth && !supportsDepthClamp);
+            ANGLE_TRY(shaderLibrary.getImageClear_frag(contextVk, flags, &fragmentShader));
+            imageClearProgram = &programs.mImageClearPrograms[flags];
+        }
+
+        ANGLE_TRY(setupGraphicsProgram(contextVk, Function::ImageClear, vertexShader,
+                                       fragmentShader, imageClearProgram, &pipelineDesc,
+                                       VK_NULL_HANDLE, &shaderParams, sizeof(shaderParams),
+                                       commandBuffer));
+    }
 
     // Set dynamic state
     VkViewport viewport;
@@ -2293,15 +2346,21 @@ angle::Result UtilsVk::clearImage(ContextVk *contextVk,
 
     const uint32_t flags = GetImageClearFlags(dstActualFormat, 0, false);
 
-    vk::ShaderLibrary &shaderLibrary                    = contextVk->getShaderLibrary();
-    vk::RefCounted<vk::ShaderAndSerial> *vertexShader   = nullptr;
-    vk::RefCounted<vk::ShaderAndSerial> *fragmentShader = nullptr;
-    ANGLE_TRY(shaderLibrary.getFullScreenTri_vert(contextVk, 0, &vertexShader));
-    ANGLE_TRY(shaderLibrary.getImageClear_frag(contextVk, flags, &fragmentShader));
+    {
+        UtilsProgramsVk &programs = contextVk->getRenderer()->getUtilsPrograms();
+        std::lock_guard<std::mutex> lock(programs.getMutex());
+
+        vk::ShaderLibrary &shaderLibrary                    = programs.mShaderLibrary;
+        vk::RefCounted<vk::ShaderAndSerial> *vertexShader   = nullptr;
+        vk::RefCounted<vk::ShaderAndSerial> *fragmentShader = nullptr;
+        ANGLE_TRY(shaderLibrary.getFullScreenTri_vert(contextVk, 0, &vertexShader));
+        ANGLE_TRY(shaderLibrary.getImageClear_frag(contextVk, flags, &fragmentShader));
 
-    ANGLE_TRY(setupGraphicsProgram(contextVk, Function::ImageClear, vertexShader, fragmentShader,
-                                   &mImageClearPrograms[flags], &pipelineDesc, VK_NULL_HANDLE,
-                                   &shaderParams, sizeof(shaderParams), commandBuffer));
+        ANGLE_TRY(setupGraphicsProgram(contextVk, Function::ImageClear, vertexShader,
+                                       fragmentShader, &programs.mImageClearPrograms[flags],
+                                       &pipelineDesc, VK_NULL_HANDLE, &shaderParams,
+                                       sizeof(shaderParams), commandBuffer));
+    }
 
     // Set dynamic state
     VkViewport viewport;
@@ -2574,15 +2633,21 @@ angle::Result UtilsVk::blitResolveImpl(ContextVk *contextVk,
                            nullptr);
     vkUpdateDescriptorSets(contextVk->getDevice(), 1, &writeInfos[2], 0, nullptr);
 
-    vk::ShaderLibrary &shaderLibrary                    = contextVk->getShaderLibrary();
-    vk::RefCounted<vk::ShaderAndSerial> *vertexShader   = nullptr;
-    vk::RefCounted<vk::ShaderAndSerial> *fragmentShader = nullptr;
-    ANGLE_TRY(shaderLibrary.getFullScreenTri_vert(contextVk, 0, &vertexShader));
-    ANGLE_TRY(shaderLibrary.getBlitResolve_frag(contextVk, flags, &fragmentShader));
+    {
+        UtilsProgramsVk &programs = contextVk->getRenderer()->getUtilsPrograms();
+        std::lock_guard<std::mutex> lock(programs.getMutex());
 
-    ANGLE_TRY(setupGraphicsProgram(contextVk, Function::BlitResolve, vertexShader, fragmentShader,
-                                   &mBlitResolvePrograms[flags], &pipelineDesc, descriptorSet,
-                                   &shaderParams, sizeof(shaderParams), commandBuffer));
+        vk::ShaderLibrary &shaderLibrary                    = programs.mShaderLibrary;
+        vk::RefCounted<vk::ShaderAndSerial> *vertexShader   = nullptr;
+        vk::RefCounted<vk::ShaderAndSerial> *fragmentShader = nullptr;
+        ANGLE_TRY(shaderLibrary.getFullScreenTri_vert(contextVk, 0, &vertexShader));
+        ANGLE_TRY(shaderLibrary.getBlitResolve_frag(contextVk, flags, &fragmentShader));
+
+        ANGLE_TRY(setupGraphicsProgram(contextVk, Function::BlitResolve, vertexShader,
+                                       fragmentShader, &programs.mBlitResolvePrograms[flags],
+                                       &pipelineDesc, descriptorSet, &shaderParams,
+                                       sizeof(shaderParams), commandBuffer));
+    }
 
     // Set dynamic state
     VkViewport viewport;
@@ -2654,7 +2719,8 @@ angle::Result UtilsVk::stencilBlitResolveNoShaderExport(ContextVk *contextVk,
 
     ANGLE_TRY(blitBuffer.get().initSuballocation(
         contextVk, contextVk->getRenderer()->getDeviceLocalMemoryTypeIndex(),
-        static_cast<size_t>(bufferSize), contextVk->getRenderer()->getDefaultBufferAlignment()));
+        static_cast<size_t>(bufferSize), contextVk->getRenderer()->getDefaultBufferAlignment(),
+        vk::BufferUsageType::Dynamic));
 
     BlitResolveStencilNoExportShaderParams shaderParams;
     // Note: adjustments made for pre-rotatation in FramebufferVk::blit() affect these
@@ -2788,13 +2854,19 @@ angle::Result UtilsVk::stencilBlitResolveNoShaderExport(ContextVk *contextVk,
 
     vkUpdateDescriptorSets(contextVk->getDevice(), 3, writeInfos, 0, nullptr);
 
-    vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
-    ANGLE_TRY(contextVk->getShaderLibrary().getBlitResolveStencilNoExport_comp(contextVk, flags,
-                                                                               &shader));
+    {
+        UtilsProgramsVk &programs = contextVk->getRenderer()->getUtilsPrograms();
+        std::lock_guard<std::mutex> lock(programs.getMutex());
+
+        vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
+        ANGLE_TRY(programs.mShaderLibrary.getBlitResolveStencilNoExport_comp(contextVk, flags,
+                                                                             &shader));
 
-    ANGLE_TRY(setupComputeProgram(contextVk, Function::BlitResolveStencilNoExport, shader,
-                                  &mBlitResolveStencilNoExportPrograms[flags], descriptorSet,
-                                  &shaderParams, sizeof(shaderParams), commandBufferHelper));
+        ANGLE_TRY(setupComputeProgram(contextVk, Function::BlitResolveStencilNoExport, shader,
+                                      &programs.mBlitResolveStencilNoExportPrograms[flags],
+                                      descriptorSet, &shaderParams, sizeof(shaderParams),
+                                      commandBufferHelper));
+    }
     commandBuffer->dispatch(UnsignedCeilDivide(bufferRowLengthInUints, 8),
                             UnsignedCeilDivide(params.blitArea.height, 8), 1);
     descriptorPoolBinding.reset();
@@ -2990,15 +3062,21 @@ angle::Result UtilsVk::copyImage(ContextVk *contextVk,
 
     vkUpdateDescriptorSets(contextVk->getDevice(), 1, &writeInfo, 0, nullptr);
 
-    vk::ShaderLibrary &shaderLibrary                    = contextVk->getShaderLibrary();
-    vk::RefCounted<vk::ShaderAndSerial> *vertexShader   = nullptr;
-    vk::RefCounted<vk::ShaderAndSerial> *fragmentShader = nullptr;
-    ANGLE_TRY(shaderLibrary.getFullScreenTri_vert(contextVk, 0, &vertexShader));
-    ANGLE_TRY(shaderLibrary.getImageCopy_frag(contextVk, flags, &fragmentShader));
+    {
+        UtilsProgramsVk &programs = contextVk->getRenderer()->getUtilsPrograms();
+        std::lock_guard<std::mutex> lock(programs.getMutex());
+
+        vk::ShaderLibrary &shaderLibrary                    = programs.mShaderLibrary;
+        vk::RefCounted<vk::ShaderAndSerial> *vertexShader   = nullptr;
+        vk::RefCounted<vk::ShaderAndSerial> *fragmentShader = nullptr;
+        ANGLE_TRY(shaderLibrary.getFullScreenTri_vert(contextVk, 0, &vertexShader));
+        ANGLE_TRY(shaderLibrary.getImageCopy_frag(contextVk, flags, &fragmentShader));
 
-    ANGLE_TRY(setupGraphicsProgram(contextVk, Function::ImageCopy, vertexShader, fragmentShader,
-                                   &mImageCopyPrograms[flags], &pipelineDesc, descriptorSet,
-                                   &shaderParams, sizeof(shaderParams), commandBuffer));
+        ANGLE_TRY(setupGraphicsProgram(contextVk, Function::ImageCopy, vertexShader,
+                                       fragmentShader, &programs.mImageCopyPrograms[flags],
+                                       &pipelineDesc, descriptorSet, &shaderParams,
+                                       sizeof(shaderParams), commandBuffer));
+    }
 
     // Set dynamic state
     VkViewport viewport;
@@ -3310,17 +3388,22 @@ angle::Result UtilsVk::generateMipmap(ContextVk *contextVk,
 
     vkUpdateDescriptorSets(contextVk->getDevice(), 2, writeInfos, 0, nullptr);
 
-    vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
-    ANGLE_TRY(contextVk->getShaderLibrary().getGenerateMipmap_comp(contextVk, flags, &shader));
-
     // Note: onImageRead/onImageWrite is expected to be called by the caller.  This avoids inserting
     // barriers between calls for each layer of the image.
     vk::OutsideRenderPassCommandBuffer *commandBuffer;
     commandBuffer = &commandBufferHelper->getCommandBuffer();
 
-    ANGLE_TRY(setupComputeProgram(contextVk, Function::GenerateMipmap, shader,
-                                  &mGenerateMipmapPrograms[flags], descriptorSet, &shaderParams,
-                                  sizeof(shaderParams), commandBufferHelper));
+    {
+        UtilsProgramsVk &programs = contextVk->getRenderer()->getUtilsPrograms();
+        std::lock_guard<std::mutex> lock(programs.getMutex());
+
+        vk::RefCounted<vk::ShaderAndSerial> *shader = nullptr;
+        ANGLE_TRY(programs.mShaderLibrary.getGenerateMipmap_comp(contextVk, flags, &shader));
+
+        ANGLE_TRY(setupComputeProgram(contextVk, Function::GenerateMipmap, shader,
+                                      &programs.mGenerateMipmapPrograms[flags], descriptorSet,
+                                      &shaderParams, sizeof(shaderParams), commandBufferHelper));
+    }
 
     commandBuffer->dispatch(workGroupX, workGroupY, 1);
     descriptorPoolBinding.reset();
@@ -3467,16 +3550,22 @@ angle::Result UtilsVk::unresolve(ContextVk *contextVk,
     uint32_t flags = GetUnresolveFlags(colorAttachmentCount, colorSrc, params.unresolveDepth,
                                        params.unresolveStencil, &colorAttachmentTypes);
 
-    vk::ShaderLibrary &shaderLibrary                    = contextVk->getShaderLibrary();
-    vk::RefCounted<vk::ShaderAndSerial> *vertexShader   = nullptr;
-    vk::RefCounted<vk::ShaderAndSerial> *fragmentShader = &mUnresolveFragShaders[flags];
-    ANGLE_TRY(shaderLibrary.getFullScreenTri_vert(contextVk, 0, &vertexShader));
-    ANGLE_TRY(GetUnresolveFrag(contextVk, colorAttachmentCount, colorAttachmentTypes,
-                               params.unresolveDepth, params.unresolveStencil, fragmentShader));
+    {
+        UtilsProgramsVk &programs = contextVk->getRenderer()->getUtilsPrograms();
+        std::lock_guard<std::mutex> lock(programs.getMutex());
+
+        vk::ShaderLibrary &shaderLibrary                    = programs.mShaderLibrary;
+        vk::RefCounted<vk::ShaderAndSerial> *vertexShader   = nullptr;
+        vk::RefCounted<vk::ShaderAndSerial> *fragmentShader =
+            &programs.mUnresolveFragShaders[flags];
+        ANGLE_TRY(shaderLibrary.getFullScreenTri_vert(contextVk, 0, &vertexShader));
+        ANGLE_TRY(GetUnresolveFrag(contextVk, colorAttachmentCount, colorAttachmentTypes,
+                                   params.unresolveDepth, params.unresolveStencil, fragmentShader));
 
-    ANGLE_TRY(setupGraphicsProgram(contextVk, function, vertexShader, fragmentShader,
-                                   &mUnresolvePrograms[flags], &pipelineDesc, descriptorSet,
-                                   nullptr, 0, commandBuffer));
+        ANGLE_TRY(setupGraphicsProgram(contextVk, function, vertexShader, fragmentShader,
+                                       &programs.mUnresolvePrograms[flags], &pipelineDesc,
+                                       descriptorSet, nullptr, 0, commandBuffer));
+    }
 
     // Set dynamic state
     VkViewport viewport;
@@ -3625,15 +3714,20 @@ angle::Result UtilsVk::drawOverlay(ContextVk *contextVk,
 
     vkUpdateDescriptorSets(contextVk->getDevice(), 3, writeInfos, 0, nullptr);
 
-    vk::ShaderLibrary &shaderLibrary                    = contextVk->getShaderLibrary();
-    vk::RefCounted<vk::ShaderAndSerial> *vertexShader   = nullptr;
-    vk::RefCounted<vk::ShaderAndSerial> *fragmentShader = nullptr;
-    ANGLE_TRY(shaderLibrary.getOverlayDraw_vert(contextVk, 0, &vertexShader));
-    ANGLE_TRY(shaderLibrary.getOverlayDraw_frag(contextVk, 0, &fragmentShader));
+    {
+        UtilsProgramsVk &programs = contextVk->getRenderer()->getUtilsPrograms();
+        std::lock_guard<std::mutex> lock(programs.getMutex());
 
-    ANGLE_TRY(setupGraphicsProgram(contextVk, Function::OverlayDraw, vertexShader, fragmentShader,
-                                   &mOverlayDrawProgram, &pipelineDesc, descriptorSet, nullptr, 0,
-                                   commandBuffer));
+        vk::ShaderLibrary &shaderLibrary                    = programs.mShaderLibrary;
+        vk::RefCounted<vk::ShaderAndSerial> *vertexShader   = nullptr;
+        vk::RefCounted<vk::ShaderAndSerial> *fragmentShader = nullptr;
+        ANGLE_TRY(shaderLibrary.getOverlayDraw_vert(contextVk, 0, &vertexShader));
+        ANGLE_TRY(shaderLibrary.getOverlayDraw_frag(contextVk, 0, &fragmentShader));
+
+        ANGLE_TRY(setupGraphicsProgram(contextVk, Function::OverlayDraw, vertexShader,
+                                       fragmentShader, &programs.mOverlayDrawProgram,
+                                       &pipelineDesc, descriptorSet, nullptr, 0, commandBuffer));
+    }
 
     // Set dynamic state
     VkViewport viewport;
@@ -3643,6 +3737,11 @@ angle::Result UtilsVk::drawOverlay(ContextVk *contextVk,
     VkRect2D scissor = gl_vk::GetRect(renderArea);
     commandBuffer->setScissor(0, 1, &scissor);
 
+    if (contextVk->getFeatures().useDynamicPrimitiveTopology.enabled)
+    {
+        commandBuffer->setPrimitiveTopology(VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP);
+    }
+
     // Draw all the graph widgets.
     if (params.graphWidgetCount > 0)
     {
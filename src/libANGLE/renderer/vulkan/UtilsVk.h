@@ -32,8 +32,56 @@
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
 #include "libANGLE/renderer/vulkan/vk_internal_shaders_autogen.h"
 
+#include <mutex>
+
 namespace rx
 {
+// The internal shaders and the programs (and thus pipelines) created from them are owned by the
+// renderer and shared by the UtilsVk of every context, so that a blit, resolve or clear on a new
+// context doesn't have to recompile pipelines that another context has already created.  The
+// pipeline layouts used with these programs remain per-context in UtilsVk; as they are always
+// created from identical descriptions, they are compatible with the shared pipelines.  Contexts in
+// different share groups may run concurrently, so all accesses must be made under getMutex().
+class UtilsProgramsVk : angle::NonCopyable
+{
+  public:
+    UtilsProgramsVk();
+    ~UtilsProgramsVk();
+
+    void destroy(RendererVk *renderer);
+
+    std::mutex &getMutex() { return mMutex; }
+
+  private:
+    friend class UtilsVk;
+
+    std::mutex mMutex;
+
+    vk::ShaderLibrary mShaderLibrary;
+
+    vk::ShaderProgramHelper mConvertIndexPrograms[vk::InternalShader::ConvertIndex_comp::kArrayLen];
+    vk::ShaderProgramHelper mConvertIndexIndirectLineLoopPrograms
+        [vk::InternalShader::ConvertIndexIndirectLineLoop_comp::kArrayLen];
+    vk::ShaderProgramHelper mConvertIndirectLineLoopPrograms
+        [vk::InternalShader::ConvertIndirectLineLoop_comp::kArrayLen];
+    vk::ShaderProgramHelper
+        mConvertVertexPrograms[vk::InternalShader::ConvertVertex_comp::kArrayLen];
+    vk::ShaderProgramHelper mImageClearProgramVSOnly;
+    vk::ShaderProgramHelper mImageClearPrograms[vk::InternalShader::ImageClear_frag::kArrayLen];
+    vk::ShaderProgramHelper mImageCopyPrograms[vk::InternalShader::ImageCopy_frag::kArrayLen];
+    vk::ShaderProgramHelper mBlitResolvePrograms[vk::InternalShader::BlitResolve_frag::kArrayLen];
+    vk::ShaderProgramHelper mBlitResolveStencilNoExportPrograms
+        [vk::InternalShader::BlitResolveStencilNoExport_comp::kArrayLen];
+    vk::ShaderProgramHelper mOverlayDrawProgram;
+    vk::ShaderProgramHelper
+        mGenerateMipmapPrograms[vk::InternalShader::GenerateMipmap_comp::kArrayLen];
+
+    // Unresolve shaders are special as they are generated on the fly due to the large number of
+    // combinations.
+    std::unordered_map<uint32_t, vk::RefCounted<vk::ShaderAndSerial>> mUnresolveFragShaders;
+    std::unordered_map<uint32_t, vk::ShaderProgramHelper> mUnresolvePrograms;
+};
+
 class UtilsVk : angle::NonCopyable
 {
   public:
@@ -547,28 +595,6 @@ class UtilsVk : angle::NonCopyable
     angle::PackedEnumMap<Function, vk::BindingPointer<vk::PipelineLayout>> mPipelineLayouts;
     angle::PackedEnumMap<Function, vk::DynamicDescriptorPool> mDescriptorPools;
 
-    vk::ShaderProgramHelper mConvertIndexPrograms[vk::InternalShader::ConvertIndex_comp::kArrayLen];
-    vk::ShaderProgramHelper mConvertIndexIndirectLineLoopPrograms
-        [vk::InternalShader::ConvertIndexIndirectLineLoop_comp::kArrayLen];
-    vk::ShaderProgramHelper mConvertIndirectLineLoopPrograms
-        [vk::InternalShader::ConvertIndirectLineLoop_comp::kArrayLen];
-    vk::ShaderProgramHelper
-        mConvertVertexPrograms[vk::InternalShader::ConvertVertex_comp::kArrayLen];
-    vk::ShaderProgramHelper mImageClearProgramVSOnly;
-    vk::ShaderProgramHelper mImageClearPrograms[vk::InternalShader::ImageClear_frag::kArrayLen];
-    vk::ShaderProgramHelper mImageCopyPrograms[vk::InternalShader::ImageCopy_frag::kArrayLen];
-    vk::ShaderProgramHelper mBlitResolvePrograms[vk::InternalShader::BlitResolve_frag::kArrayLen];
-    vk::ShaderProgramHelper mBlitResolveStencilNoExportPrograms
-        [vk::InternalShader::BlitResolveStencilNoExport_comp::kArrayLen];
-    vk::ShaderProgramHelper mOverlayDrawProgram;
-    vk::ShaderProgramHelper
-        mGenerateMipmapPrograms[vk::InternalShader::GenerateMipmap_comp::kArrayLen];
-
-    // Unresolve shaders are special as they are generated on the fly due to the large number of
-    // combinations.
-    std::unordered_map<uint32_t, vk::RefCounted<vk::ShaderAndSerial>> mUnresolveFragShaders;
-    std::unordered_map<uint32_t, vk::ShaderProgramHelper> mUnresolvePrograms;
-
     vk::Sampler mPointSampler;
     vk::Sampler mLinearSampler;
 };
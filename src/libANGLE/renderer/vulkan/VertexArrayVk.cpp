@@ -66,40 +66,25 @@ void WarnOnVertexFormatConversion(ContextVk *contextVk,
         vertexFormat.getActualBufferFormat(compressed).glInternalFormat);
 }
 
-angle::Result StreamVertexData(ContextVk *contextVk,
-                               vk::BufferHelper *dstBufferHelper,
-                               const uint8_t *srcData,
-                               size_t bytesToAllocate,
-                               size_t dstOffset,
-                               size_t vertexCount,
-                               size_t srcStride,
-                               VertexCopyFunction vertexLoadFunction)
+void StreamVertexData(uint8_t *dst,
+                      const uint8_t *srcData,
+                      size_t vertexCount,
+                      size_t srcStride,
+                      VertexCopyFunction vertexLoadFunction)
 {
-    RendererVk *renderer = contextVk->getRenderer();
-
-    uint8_t *dst = dstBufferHelper->getMappedMemory() + dstOffset;
-
     vertexLoadFunction(srcData, srcStride, vertexCount, dst);
-
-    ANGLE_TRY(dstBufferHelper->flush(renderer));
-
-    return angle::Result::Continue;
 }
 
-angle::Result StreamVertexDataWithDivisor(ContextVk *contextVk,
-                                          vk::BufferHelper *dstBufferHelper,
-                                          const uint8_t *srcData,
-                                          size_t bytesToAllocate,
-                                          size_t srcStride,
-                                          size_t dstStride,
-                                          VertexCopyFunction vertexLoadFunction,
-                                          uint32_t divisor,
-                                          size_t numSrcVertices)
+void StreamVertexDataWithDivisor(ContextVk *contextVk,
+                                 uint8_t *dst,
+                                 const uint8_t *srcData,
+                                 size_t bytesToAllocate,
+                                 size_t srcStride,
+                                 size_t dstStride,
+                                 VertexCopyFunction vertexLoadFunction,
+                                 uint32_t divisor,
+                                 size_t numSrcVertices)
 {
-    RendererVk *renderer = contextVk->getRenderer();
-
-    uint8_t *dst = dstBufferHelper->getMappedMemory();
-
     // Each source vertex is used `divisor` times before advancing. Clamp to avoid OOB reads.
     size_t clampedSize = std::min(numSrcVertices * dstStride * divisor, bytesToAllocate);
 
@@ -127,10 +112,29 @@ angle::Result StreamVertexDataWithDivisor(ContextVk *contextVk,
             memset(dst, 0, bytesToAllocate - clampedSize);
         }
     }
+}
 
-    ANGLE_TRY(dstBufferHelper->flush(renderer));
-
-    return angle::Result::Continue;
+// The size of the data streamed for a client or emulated attribute.  Only instanced attributes
+// whose divisor exceeds the device limits are stored in a buffer object.
+size_t GetStreamedAttribSize(RendererVk *renderer,
+                             const gl::VertexBinding &binding,
+                             GLuint stride,
+                             GLint startVertex,
+                             size_t vertexCount,
+                             GLsizei instanceCount)
+{
+    const uint32_t divisor = binding.getDivisor();
+    if (divisor == 0)
+    {
+        // Allocate space for startVertex + vertexCount so indexing will work.
+        return (startVertex + vertexCount) * stride;
+    }
+    if (divisor > renderer->getMaxVertexAttribDivisor())
+    {
+        // Divisor will be set to 1 & so update buffer to have 1 attrib per instance
+        return instanceCount * stride;
+    }
+    return UnsignedCeilDivide(instanceCount, divisor) * stride;
 }
 
 size_t GetVertexCount(BufferVk *srcBuffer, const gl::VertexBinding &binding, uint32_t srcFormatSize)
@@ -340,7 +344,8 @@ angle::Result VertexArrayVk::convertIndexBufferCPU(ContextVk *contextVk,
                                                 renderer->getVertexConversionBufferMemoryTypeIndex(
                                                     vk::MemoryHostVisibility::Visible),
                                                 amount,
-                                                renderer->getVertexConversionBufferAlignment()));
+                                                renderer->getVertexConversionBufferAlignment(),
+                                                vk::BufferUsageType::Static));
             memcpy(buffer->getMappedMemory(), sourcePointer, amount);
             ANGLE_TRY(buffer->flush(renderer));
 
@@ -363,34 +368,9 @@ angle::Result VertexArrayVk::convertIndexBufferCPU(ContextVk *contextVk,
     {
         // Unsigned bytes don't have direct support in Vulkan so we have to expand the
         // memory to a GLushort.
-        const GLubyte *in     = static_cast<const GLubyte *>(sourcePointer);
-        GLushort *expandedDst = reinterpret_cast<GLushort *>(dst);
-        bool primitiveRestart = contextVk->getState().isPrimitiveRestartEnabled();
-
-        constexpr GLubyte kUnsignedByteRestartValue   = 0xFF;
-        constexpr GLushort kUnsignedShortRestartValue = 0xFFFF;
-
-        if (primitiveRestart)
-        {
-            for (size_t index = 0; index < indexCount; index++)
-            {
-                GLushort value = static_cast<GLushort>(in[index]);
-                if (in[index] == kUnsignedByteRestartValue)
-                {
-                    // Convert from 8-bit restart value to 16-bit restart value
-                    value = kUnsignedShortRestartValue;
-                }
-                expandedDst[index] = value;
-            }
-        }
-        else
-        {
-            // Fast path for common case.
-            for (size_t index = 0; index < indexCount; index++)
-            {
-                expandedDst[index] = static_cast<GLushort>(in[index]);
-            }
-        }
+        gl::ConvertIndices(gl::DrawElementsType::UnsignedByte, gl::DrawElementsType::UnsignedShort,
+                           sourcePointer, indexCount, dst,
+                           contextVk->getState().isPrimitiveRestartEnabled());
     }
     else
     {
@@ -429,23 +409,59 @@ angle::Result VertexArrayVk::convertVertexBufferGPU(ContextVk *contextVk,
     }
     ASSERT(vertexFormat.getVertexInputAlignment(compressed) <= vk::kVertexBufferAlignment);
 
-    // Allocate buffer for results
+    const size_t srcOffset = binding.getOffset() + relativeOffset;
+    size_t firstVertex     = 0;
+    size_t endVertex       = numVertices;
+
+    // If only part of the source was modified since the last conversion, only the vertices that
+    // overlap it are converted again, in place.  That's possible if the previous conversion is
+    // kept in a device local buffer that is large enough, which allocateForVertexConversion reuses
+    // even if the GPU is still using it.
     vk::BufferHelper *dstBuffer = conversion->data.get();
+    ASSERT(conversion->dirty);
+    if (dstBuffer->valid() && !dstBuffer->isHostVisible() &&
+        numVertices * dstFormatSize <= dstBuffer->getSize() && binding.getStride() > 0 &&
+        conversion->isPartiallyDirty())
+    {
+        const size_t srcStride = binding.getStride();
+        const size_t dirtyLow  = conversion->dirtyRange.low();
+        const size_t dirtyHigh = conversion->dirtyRange.high();
+
+        // Vertices may be closer than their size, so the first vertex is the first that ends past
+        // the start of the range.
+        firstVertex = dirtyLow >= srcOffset + srcFormatSize
+                          ? (dirtyLow - srcOffset - srcFormatSize) / srcStride + 1
+                          : 0;
+        endVertex = dirtyHigh > srcOffset ? (dirtyHigh - srcOffset + srcStride - 1) / srcStride : 0;
+
+        // The shader writes 4 bytes at a time, so the converted range is extended to whole 4-byte
+        // outputs that don't hold parts of other vertices.
+        const size_t vertexGranularity =
+            dstFormatSize % 4 == 0 ? 1 : (dstFormatSize % 2 == 0 ? 2 : 4);
+        firstVertex = roundDownPow2(firstVertex, vertexGranularity);
+        endVertex   = std::min(roundUpPow2(endVertex, vertexGranularity), numVertices);
+    }
+
+    // Allocate buffer for results
     ANGLE_TRY(dstBuffer->allocateForVertexConversion(contextVk, numVertices * dstFormatSize,
                                                      vk::MemoryHostVisibility::NonVisible));
 
-    ASSERT(conversion->dirty);
-    conversion->dirty = false;
+    conversion->clearDirty();
+
+    if (firstVertex >= endVertex)
+    {
+        return angle::Result::Continue;
+    }
 
     vk::BufferHelper *srcBufferHelper = &srcBuffer->getBuffer();
 
     UtilsVk::ConvertVertexParameters params;
-    params.vertexCount = numVertices;
+    params.vertexCount = endVertex - firstVertex;
     params.srcFormat   = &srcFormat;
     params.dstFormat   = &dstFormat;
     params.srcStride   = binding.getStride();
-    params.srcOffset   = binding.getOffset() + relativeOffset;
-    params.dstOffset   = 0;
+    params.srcOffset   = srcOffset + firstVertex * binding.getStride();
+    params.dstOffset   = firstVertex * dstFormatSize;
 
     ANGLE_TRY(
         contextVk->getUtils().convertVertexBuffer(contextVk, dstBuffer, srcBufferHelper, params));
@@ -484,14 +500,16 @@ angle::Result VertexArrayVk::convertVertexBufferCPU(ContextVk *contextVk,
     ANGLE_TRY(dstBufferHelper->allocateForVertexConversion(contextVk, numVertices * dstFormatSize,
                                                            vk::MemoryHostVisibility::Visible));
 
-    ANGLE_TRY(StreamVertexData(contextVk, dstBufferHelper, srcBytes, numVertices * dstFormatSize, 0,
-                               numVertices, binding.getStride(),
-                               vertexFormat.getVertexLoadFunction(compressed)));
+    StreamVertexData(dstBufferHelper->getMappedMemory(), srcBytes, numVertices,
+                     binding.getStride(), vertexFormat.getVertexLoadFunction(compressed));
+    ANGLE_TRY(dstBufferHelper->flush(contextVk->getRenderer()));
     ANGLE_TRY(srcBuffer->unmapImpl(contextVk));
     mCurrentArrayBuffers[attribIndex] = dstBufferHelper;
 
+    // The whole buffer is converted again even if only part of it was modified, as the previous
+    // conversion may still be in use by the GPU.
     ASSERT(conversion->dirty);
-    conversion->dirty = false;
+    conversion->clearDirty();
 
     return angle::Result::Continue;
 }
@@ -835,8 +853,14 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
     const auto &attribs  = mState.getVertexAttributes();
     const auto &bindings = mState.getVertexBindings();
 
-    // TODO: When we have a bunch of interleaved attributes, they end up
-    // un-interleaved, wasting space and copying time.  Consider improving on that.
+    // Stream all attributes into a single allocation unless the vertex buffers need to have the
+    // exact size of the data, so that the draw costs one allocation and one flush.  The offset of
+    // each attribute in that allocation is rounded up to kVertexBufferAlignment.
+    const bool coalesceAttribs = !contextVk->isRobustResourceInitEnabled();
+
+    gl::AttribArray<size_t> attribSizes;
+    gl::AttribArray<size_t> attribOffsets;
+    size_t totalSize = 0;
     for (size_t attribIndex : activeStreamedAttribs)
     {
         const gl::VertexAttribute &attrib = attribs[attribIndex];
@@ -846,12 +870,46 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
         const vk::Format &vertexFormat = renderer->getFormat(attrib.format->id);
         GLuint stride                  = vertexFormat.getActualBufferFormat(false).pixelBytes;
 
+        attribSizes[attribIndex] = GetStreamedAttribSize(renderer, binding, stride, startVertex,
+                                                         vertexCount, instanceCount);
+        attribOffsets[attribIndex] = totalSize;
+        totalSize                  = roundUp(totalSize + attribSizes[attribIndex],
+                                             static_cast<size_t>(vk::kVertexBufferAlignment));
+    }
+
+    vk::BufferHelper *streamedAttribsBuffer = nullptr;
+    if (coalesceAttribs)
+    {
+        ANGLE_TRY(contextVk->allocateStreamedAttribsBuffer(totalSize, &streamedAttribsBuffer));
+    }
+
+    // TODO: When we have a bunch of interleaved attributes, they end up
+    // un-interleaved, wasting space and copying time.  Consider improving on that.
+    for (size_t attribIndex : activeStreamedAttribs)
+    {
+        const gl::VertexAttribute &attrib = attribs[attribIndex];
+        const gl::VertexBinding &binding  = bindings[attrib.bindingIndex];
+
+        const vk::Format &vertexFormat = renderer->getFormat(attrib.format->id);
+        GLuint stride                  = vertexFormat.getActualBufferFormat(false).pixelBytes;
+
         bool compressed = false;
         WarnOnVertexFormatConversion(contextVk, vertexFormat, compressed, false);
 
         ASSERT(vertexFormat.getVertexInputAlignment(false) <= vk::kVertexBufferAlignment);
 
-        vk::BufferHelper *vertexDataBuffer;
+        const size_t bytesToAllocate = attribSizes[attribIndex];
+
+        vk::BufferHelper *vertexDataBuffer = streamedAttribsBuffer;
+        size_t attribOffset                = attribOffsets[attribIndex];
+        if (!coalesceAttribs)
+        {
+            ANGLE_TRY(contextVk->allocateStreamedVertexBuffer(attribIndex, bytesToAllocate,
+                                                              &vertexDataBuffer));
+            attribOffset = 0;
+        }
+        uint8_t *dst = vertexDataBuffer->getMappedMemory() + attribOffset;
+
         const uint8_t *src     = static_cast<const uint8_t *>(attrib.pointer);
         const uint32_t divisor = binding.getDivisor();
         if (divisor > 0)
@@ -860,12 +918,6 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
             if (divisor > renderer->getMaxVertexAttribDivisor())
             {
                 // Divisor will be set to 1 & so update buffer to have 1 attrib per instance
-                size_t bytesToAllocate = instanceCount * stride;
-
-                // Allocate buffer for results
-                ANGLE_TRY(contextVk->allocateStreamedVertexBuffer(attribIndex, bytesToAllocate,
-                                                                  &vertexDataBuffer));
-
                 gl::Buffer *bufferGL = binding.getBuffer().get();
                 if (bufferGL != nullptr)
                 {
@@ -883,61 +935,51 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
 
                         size_t numVertices = GetVertexCount(bufferVk, binding, srcAttributeSize);
 
-                        ANGLE_TRY(StreamVertexDataWithDivisor(
-                            contextVk, vertexDataBuffer, src, bytesToAllocate, binding.getStride(),
-                            stride, vertexFormat.getVertexLoadFunction(compressed), divisor,
-                            numVertices));
+                        StreamVertexDataWithDivisor(contextVk, dst, src, bytesToAllocate,
+                                                    binding.getStride(), stride,
+                                                    vertexFormat.getVertexLoadFunction(compressed),
+                                                    divisor, numVertices);
 
                         ANGLE_TRY(bufferVk->unmapImpl(contextVk));
                     }
                     else if (contextVk->getExtensions().robustnessEXT)
                     {
                         // Satisfy robustness constraints (only if extension enabled)
-                        uint8_t *dst = vertexDataBuffer->getMappedMemory();
                         memset(dst, 0, bytesToAllocate);
                     }
                 }
                 else
                 {
                     size_t numVertices = instanceCount;
-                    ANGLE_TRY(StreamVertexDataWithDivisor(
-                        contextVk, vertexDataBuffer, src, bytesToAllocate, binding.getStride(),
-                        stride, vertexFormat.getVertexLoadFunction(compressed), divisor,
-                        numVertices));
+                    StreamVertexDataWithDivisor(contextVk, dst, src, bytesToAllocate,
+                                                binding.getStride(), stride,
+                                                vertexFormat.getVertexLoadFunction(compressed),
+                                                divisor, numVertices);
                 }
             }
             else
             {
                 ASSERT(binding.getBuffer().get() == nullptr);
-                size_t count           = UnsignedCeilDivide(instanceCount, divisor);
-                size_t bytesToAllocate = count * stride;
-
-                // Allocate buffer for results
-                ANGLE_TRY(contextVk->allocateStreamedVertexBuffer(attribIndex, bytesToAllocate,
-                                                                  &vertexDataBuffer));
-
-                ANGLE_TRY(StreamVertexData(contextVk, vertexDataBuffer, src, bytesToAllocate, 0,
-                                           count, binding.getStride(),
-                                           vertexFormat.getVertexLoadFunction(compressed)));
+                size_t count = UnsignedCeilDivide(instanceCount, divisor);
+                StreamVertexData(dst, src, count, binding.getStride(),
+                                 vertexFormat.getVertexLoadFunction(compressed));
             }
         }
         else
         {
             ASSERT(binding.getBuffer().get() == nullptr);
-            // Allocate space for startVertex + vertexCount so indexing will work.  If we don't
+            // Space is allocated for startVertex + vertexCount so indexing will work.  If we don't
             // start at zero all the indices will be off.
             // Only vertexCount vertices will be used by the upcoming draw so that is all we copy.
             src += startVertex * binding.getStride();
-            size_t destOffset      = startVertex * stride;
-            size_t bytesToAllocate = (startVertex + vertexCount) * stride;
-
-            // Allocate buffer for results
-            ANGLE_TRY(contextVk->allocateStreamedVertexBuffer(attribIndex, bytesToAllocate,
-                                                              &vertexDataBuffer));
+            dst += startVertex * stride;
+            StreamVertexData(dst, src, vertexCount, binding.getStride(),
+                             vertexFormat.getVertexLoadFunction(compressed));
+        }
 
-            ANGLE_TRY(StreamVertexData(contextVk, vertexDataBuffer, src, bytesToAllocate,
-                                       destOffset, vertexCount, binding.getStride(),
-                                       vertexFormat.getVertexLoadFunction(compressed)));
+        if (!coalesceAttribs)
+        {
+            ANGLE_TRY(vertexDataBuffer->flush(renderer));
         }
 
         mCurrentArrayBuffers[attribIndex] = vertexDataBuffer;
@@ -946,10 +988,15 @@ angle::Result VertexArrayVk::updateStreamedAttribs(const gl::Context *context,
             vertexDataBuffer
                 ->getBufferForVertexArray(contextVk, vertexDataBuffer->getSize(), &bufferOffset)
                 .getHandle();
-        mCurrentArrayBufferOffsets[attribIndex] = bufferOffset;
+        mCurrentArrayBufferOffsets[attribIndex] = bufferOffset + attribOffset;
         mCurrentArrayBufferStrides[attribIndex] = stride;
     }
 
+    if (coalesceAttribs)
+    {
+        ANGLE_TRY(streamedAttribsBuffer->flush(renderer));
+    }
+
     return angle::Result::Continue;
 }
 
@@ -36,7 +36,7 @@ angle::Result VulkanSecondaryCommandBuffer::InitializeCommandPool(Context *conte
 
 angle::Result VulkanSecondaryCommandBuffer::InitializeRenderPassInheritanceInfo(
     ContextVk *contextVk,
-    const Framebuffer &framebuffer,
+    VkFramebuffer framebuffer,
     const RenderPassDesc &renderPassDesc,
     VkCommandBufferInheritanceInfo *inheritanceInfoOut)
 {
@@ -46,7 +46,7 @@ angle::Result VulkanSecondaryCommandBuffer::InitializeRenderPassInheritanceInfo(
     inheritanceInfoOut->sType       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
     inheritanceInfoOut->renderPass  = compatibleRenderPass->getHandle();
     inheritanceInfoOut->subpass     = 0;
-    inheritanceInfoOut->framebuffer = framebuffer.getHandle();
+    inheritanceInfoOut->framebuffer = framebuffer;
 
     return angle::Result::Continue;
 }
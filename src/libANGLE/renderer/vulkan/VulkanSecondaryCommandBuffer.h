@@ -39,7 +39,7 @@ class VulkanSecondaryCommandBuffer : public priv::CommandBuffer
                                                bool hasProtectedContent);
     static angle::Result InitializeRenderPassInheritanceInfo(
         ContextVk *contextVk,
-        const Framebuffer &framebuffer,
+        VkFramebuffer framebuffer,
         const RenderPassDesc &renderPassDesc,
         VkCommandBufferInheritanceInfo *inheritanceInfoOut);
 
@@ -142,7 +142,8 @@ HardwareBufferImageSiblingVkAndroid::HardwareBufferImageSiblingVkAndroid(EGLClie
       mLevelCount(0),
       mUsage(0),
       mSamples(0),
-      mImage(nullptr)
+      mImage(nullptr),
+      mImageCache(nullptr)
 {}
 
 HardwareBufferImageSiblingVkAndroid::~HardwareBufferImageSiblingVkAndroid() {}
@@ -243,6 +244,37 @@ angle::Result HardwareBufferImageSiblingVkAndroid::initImpl(DisplayVk *displayVk
         angle::android::ANativeWindowBufferToAHardwareBuffer(windowBuffer);
 
     functions.acquire(hardwareBuffer);
+
+    const vk::Format &vkFormat = renderer->getFormat(internalFormat);
+
+    constexpr uint32_t kColorRenderableRequiredBits        = VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT;
+    constexpr uint32_t kDepthStencilRenderableRequiredBits = VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT;
+    mRenderable = renderer->hasImageFormatFeatureBits(vkFormat.getActualRenderableImageFormatID(),
+                                                      kColorRenderableRequiredBits) ||
+                  renderer->hasImageFormatFeatureBits(vkFormat.getActualRenderableImageFormatID(),
+                                                      kDepthStencilRenderableRequiredBits);
+
+    constexpr uint32_t kTextureableRequiredBits =
+        VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
+    mTextureable = renderer->hasImageFormatFeatureBits(vkFormat.getActualRenderableImageFormatID(),
+                                                       kTextureableRequiredBits);
+
+    // Everything else about the import only depends on the buffer, so if it's been imported
+    // before, its image can be used as is.
+    ExternalImageCache *imageCache = displayVk->getExternalImageCache();
+    if (imageCache != nullptr)
+    {
+        mImageCacheKey = {reinterpret_cast<uintptr_t>(hardwareBuffer)};
+        mImage         = imageCache->take(mImageCacheKey).release();
+        if (mImage != nullptr)
+        {
+            mImageCache = imageCache;
+            mLevelCount = mImage->getLevelCount();
+            mYUV        = mImage->getYcbcrConversionDesc().valid();
+            return angle::Result::Continue;
+        }
+    }
+
     VkAndroidHardwareBufferFormatPropertiesANDROID bufferFormatProperties;
     bufferFormatProperties.sType =
         VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID;
@@ -260,7 +292,6 @@ angle::Result HardwareBufferImageSiblingVkAndroid::initImpl(DisplayVk *displayVk
     externalFormat.sType                   = VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID;
     externalFormat.externalFormat          = 0;
 
-    const vk::Format &vkFormat         = renderer->getFormat(internalFormat);
     const vk::Format &externalVkFormat = renderer->getFormat(angle::FormatID::NONE);
     const angle::Format &imageFormat   = vkFormat.getActualRenderableImageFormat();
     bool isDepthOrStencilFormat        = imageFormat.hasDepthOrStencilBits();
@@ -373,17 +404,8 @@ angle::Result HardwareBufferImageSiblingVkAndroid::initImpl(DisplayVk *displayVk
                                          externalMemoryRequirements, 1, &dedicatedAllocInfoPtr,
                                          VK_QUEUE_FAMILY_FOREIGN_EXT, flags));
 
-    constexpr uint32_t kColorRenderableRequiredBits        = VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT;
-    constexpr uint32_t kDepthStencilRenderableRequiredBits = VK_FORMAT_FEATURE_COLOR_ATTACHMENT_BIT;
-    mRenderable = renderer->hasImageFormatFeatureBits(vkFormat.getActualRenderableImageFormatID(),
-                                                      kColorRenderableRequiredBits) ||
-                  renderer->hasImageFormatFeatureBits(vkFormat.getActualRenderableImageFormatID(),
-                                                      kDepthStencilRenderableRequiredBits);
-
-    constexpr uint32_t kTextureableRequiredBits =
-        VK_FORMAT_FEATURE_SAMPLED_IMAGE_BIT | VK_FORMAT_FEATURE_SAMPLED_IMAGE_FILTER_LINEAR_BIT;
-    mTextureable = renderer->hasImageFormatFeatureBits(vkFormat.getActualRenderableImageFormatID(),
-                                                       kTextureableRequiredBits);
+    // Only a successfully imported image is cached.
+    mImageCache = imageCache;
 
     return angle::Result::Continue;
 }
@@ -452,7 +474,13 @@ vk::ImageHelper *HardwareBufferImageSiblingVkAndroid::getImage() const
 
 void HardwareBufferImageSiblingVkAndroid::release(RendererVk *renderer)
 {
-    if (mImage != nullptr)
+    if (mImage != nullptr && mImageCache != nullptr)
+    {
+        mImageCache->put(renderer, std::move(mImageCacheKey),
+                         std::unique_ptr<vk::ImageHelper>(mImage));
+        mImage = nullptr;
+    }
+    else if (mImage != nullptr)
     {
         // TODO: Handle the case where the EGLImage is used in two contexts not in the same share
         // group.  https://issuetracker.google.com/169868803
@@ -14,6 +14,7 @@
 #include "libANGLE/renderer/vulkan/RendererVk.h"
 
 #include <fcntl.h>
+#include <sys/stat.h>
 
 namespace rx
 {
@@ -319,6 +320,29 @@ angle::Result GetAllocateInfo(const egl::AttributeMap &attribs,
 
     return angle::Result::Continue;
 }
+
+// The fds are identified by the inode of their dma-buf, as applications close and reuse fds.
+bool GetImageCacheKey(const egl::AttributeMap &attribs, ExternalImageCache::Key *keyOut)
+{
+    for (const auto &attrib : attribs)
+    {
+        keyOut->push_back(attrib.first);
+        if (std::find(kFds.begin(), kFds.end(), attrib.first) == kFds.end())
+        {
+            keyOut->push_back(attrib.second);
+            continue;
+        }
+
+        struct stat fdStat;
+        if (fstat(static_cast<int>(attrib.second), &fdStat) != 0)
+        {
+            return false;
+        }
+        keyOut->push_back(fdStat.st_dev);
+        keyOut->push_back(fdStat.st_ino);
+    }
+    return true;
+}
 }  // anonymous namespace
 
 DmaBufImageSiblingVkLinux::DmaBufImageSiblingVkLinux(const egl::AttributeMap &attribs)
@@ -329,7 +353,8 @@ DmaBufImageSiblingVkLinux::DmaBufImageSiblingVkLinux(const egl::AttributeMap &at
       mTextureable(false),
       mYUV(false),
       mSamples(0),
-      mImage(nullptr)
+      mImage(nullptr),
+      mImageCache(nullptr)
 {
     ASSERT(mAttribs.contains(EGL_WIDTH));
     ASSERT(mAttribs.contains(EGL_HEIGHT));
@@ -563,6 +588,25 @@ angle::Result DmaBufImageSiblingVkLinux::initImpl(DisplayVk *displayVk)
     const vk::Format &vkFormat  = renderer->getFormat(mFormat.info->sizedInternalFormat);
     const angle::Format &format = vkFormat.getActualImageFormat(rx::vk::ImageAccess::SampleOnly);
 
+    // The image only depends on the attributes, so if the same buffer has been imported with the
+    // same attributes before, its image can be used as is.
+    ExternalImageCache *imageCache = displayVk->getExternalImageCache();
+    if (imageCache != nullptr && !GetImageCacheKey(mAttribs, &mImageCacheKey))
+    {
+        imageCache = nullptr;
+    }
+    if (imageCache != nullptr)
+    {
+        mImage = imageCache->take(mImageCacheKey).release();
+        if (mImage != nullptr)
+        {
+            mImageCache  = imageCache;
+            mRenderable  = mImage->getUsage() & kRenderUsage;
+            mTextureable = mImage->getUsage() & kTextureUsage;
+            return angle::Result::Continue;
+        }
+    }
+
     InitResult initResult;
 
     for (VkFormat vkFmt : mVkFormats)
@@ -571,6 +615,7 @@ angle::Result DmaBufImageSiblingVkLinux::initImpl(DisplayVk *displayVk)
         ANGLE_TRY(initWithFormat(displayVk, format, vkFmt, MutableFormat::Allowed, &initResult));
         if (initResult == InitResult::Success)
         {
+            mImageCache = imageCache;
             return angle::Result::Continue;
         }
     }
@@ -581,6 +626,7 @@ angle::Result DmaBufImageSiblingVkLinux::initImpl(DisplayVk *displayVk)
         ANGLE_TRY(initWithFormat(displayVk, format, vkFmt, MutableFormat::NotAllowed, &initResult));
         if (initResult == InitResult::Success)
         {
+            mImageCache = imageCache;
             return angle::Result::Continue;
         }
     }
@@ -638,7 +684,13 @@ vk::ImageHelper *DmaBufImageSiblingVkLinux::getImage() const
 
 void DmaBufImageSiblingVkLinux::release(RendererVk *renderer)
 {
-    if (mImage != nullptr)
+    if (mImage != nullptr && mImageCache != nullptr)
+    {
+        mImageCache->put(renderer, std::move(mImageCacheKey),
+                         std::unique_ptr<vk::ImageHelper>(mImage));
+        mImage = nullptr;
+    }
+    else if (mImage != nullptr)
     {
         // TODO: Handle the case where the EGLImage is used in two contexts not in the same share
         // group.  https://issuetracker.google.com/169868803
@@ -71,6 +71,10 @@ class DmaBufImageSiblingVkLinux : public ExternalImageSiblingVk
     size_t mSamples;
 
     vk::ImageHelper *mImage;
+
+    // Set if the image is returned to the cache on release.
+    ExternalImageCache *mImageCache;
+    ExternalImageCache::Key mImageCacheKey;
 };
 
 }  // namespace rx
@@ -14,6 +14,7 @@
 #include "common/vulkan/vk_google_filtering_precision.h"
 #include "libANGLE/BlobCache.h"
 #include "libANGLE/VertexAttribute.h"
+#include "libANGLE/trace.h"
 #include "libANGLE/renderer/vulkan/DisplayVk.h"
 #include "libANGLE/renderer/vulkan/FramebufferVk.h"
 #include "libANGLE/renderer/vulkan/ProgramVk.h"
@@ -2307,7 +2308,7 @@ void OutputAllPipelineState(ContextVk *contextVk,
 
 void DumpPipelineCacheGraph(
     ContextVk *contextVk,
-    const std::unordered_map<vk::GraphicsPipelineDesc, vk::PipelineHelper> &cache)
+    const angle::NodeHashMap<vk::GraphicsPipelineDesc, vk::PipelineHelper> &cache)
 {
     std::ostream &out = contextVk->getPipelineCacheGraphStream();
 
@@ -2666,6 +2667,8 @@ void GraphicsPipelineDesc::initDefaults(const ContextVk *contextVk)
         contextVk->getFeatures().supportsExtendedDynamicState.enabled;
     mDynamicState.ds1And2.supportsDynamicState2 =
         contextVk->getFeatures().supportsExtendedDynamicState2.enabled;
+    mDynamicState.ds1And2.supportsDynamicPrimitiveTopology =
+        contextVk->getFeatures().useDynamicPrimitiveTopology.enabled;
     mDynamicState.ds1And2.padding = 0;
 
     SetBitField(mDynamicState.ds1.front.ops.fail, VK_STENCIL_OP_KEEP);
@@ -2680,7 +2683,7 @@ void GraphicsPipelineDesc::initDefaults(const ContextVk *contextVk)
 }
 
 angle::Result GraphicsPipelineDesc::initializePipeline(
-    ContextVk *contextVk,
+    Context *context,
     PipelineCacheAccess *pipelineCache,
     const RenderPass &compatibleRenderPass,
     const PipelineLayout &pipelineLayout,
@@ -2689,9 +2692,12 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     const gl::DrawBufferMask &missingOutputsMask,
     const ShaderAndSerialMap &shaders,
     const SpecializationConstants &specConsts,
+    VkPipelineCreateFlags createFlags,
     Pipeline *pipelineOut,
     CacheLookUpFeedback *feedbackOut) const
 {
+    RendererVk *renderer = context->getRenderer();
+
     angle::FixedVector<VkPipelineShaderStageCreateInfo, 5> shaderStages;
     VkPipelineVertexInputStateCreateInfo vertexInputState     = {};
     VkPipelineInputAssemblyStateCreateInfo inputAssemblyState = {};
@@ -2807,7 +2813,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
 
         // Get the corresponding VkFormat for the attrib's format.
         angle::FormatID formatID            = static_cast<angle::FormatID>(packedAttrib.format);
-        const Format &format                = contextVk->getRenderer()->getFormat(formatID);
+        const Format &format                = renderer->getFormat(formatID);
         const angle::Format &intendedFormat = format.getIntendedFormat();
         VkFormat vkFormat = format.getActualBufferVkFormat(packedAttrib.compressed);
 
@@ -2832,8 +2838,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
                 // When converting from an unsigned to a signed format or vice versa, attempt to
                 // match the bit width.
                 angle::FormatID convertedFormatID = gl::ConvertFormatSignedness(intendedFormat);
-                const Format &convertedFormat =
-                    contextVk->getRenderer()->getFormat(convertedFormatID);
+                const Format &convertedFormat = renderer->getFormat(convertedFormatID);
                 ASSERT(intendedFormat.channelCount ==
                        convertedFormat.getIntendedFormat().channelCount);
                 ASSERT(intendedFormat.redBits == convertedFormat.getIntendedFormat().redBits);
@@ -2844,11 +2849,11 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
                 vkFormat = convertedFormat.getActualBufferVkFormat(packedAttrib.compressed);
             }
 
-            ASSERT(contextVk->getNativeExtensions().relaxedVertexAttributeTypeANGLE);
+            ASSERT(renderer->getNativeExtensions().relaxedVertexAttributeTypeANGLE);
             // If using dynamic state for stride, the value for stride is unconditionally 0 here.
             // |ContextVk::handleDirtyGraphicsVertexBuffers| implements the same fix when setting
             // stride dynamically.
-            ASSERT(!contextVk->getFeatures().supportsExtendedDynamicState.enabled ||
+            ASSERT(!renderer->getFeatures().supportsExtendedDynamicState.enabled ||
                    bindingDesc.stride == 0);
 
             if (programAttribType == gl::ComponentType::Float ||
@@ -2906,7 +2911,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     viewportState.pScissors     = nullptr;
 
     VkPipelineViewportDepthClipControlCreateInfoEXT depthClipControl = {};
-    if (contextVk->getFeatures().supportsDepthClipControl.enabled)
+    if (renderer->getFeatures().supportsDepthClipControl.enabled)
     {
         depthClipControl.sType =
             VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_DEPTH_CLIP_CONTROL_CREATE_INFO_EXT;
@@ -2944,7 +2949,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
         !mDynamicState.ds1And2.rasterizerDiscardEnable &&
         !inputAndRaster.bits.alphaToCoverageEnable && !inputAndRaster.bits.alphaToOneEnable &&
         !inputAndRaster.bits.sampleShadingEnable &&
-        contextVk->getFeatures().bresenhamLineRasterization.enabled)
+        renderer->getFeatures().bresenhamLineRasterization.enabled)
     {
         rasterLineState.lineRasterizationMode = VK_LINE_RASTERIZATION_MODE_BRESENHAM_EXT;
         *pNextPtr                             = &rasterLineState;
@@ -2955,7 +2960,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     provokingVertexState.sType =
         VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_PROVOKING_VERTEX_STATE_CREATE_INFO_EXT;
     // Always set provoking vertex mode to last if available.
-    if (contextVk->getFeatures().provokingVertex.enabled)
+    if (renderer->getFeatures().provokingVertex.enabled)
     {
         provokingVertexState.provokingVertexMode = VK_PROVOKING_VERTEX_MODE_LAST_VERTEX_EXT;
         *pNextPtr                                = &provokingVertexState;
@@ -2969,7 +2974,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     VkPipelineRasterizationDepthClipStateCreateInfoEXT depthClipState = {};
     depthClipState.sType =
         VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT;
-    if (contextVk->getFeatures().depthClamping.enabled)
+    if (renderer->getFeatures().depthClamping.enabled)
     {
         depthClipState.depthClipEnable = VK_TRUE;
         *pNextPtr                      = &depthClipState;
@@ -2978,7 +2983,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
 
     VkPipelineRasterizationStateStreamCreateInfoEXT rasterStreamState = {};
     rasterStreamState.sType = VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT;
-    if (contextVk->getFeatures().supportsGeometryStreamsCapability.enabled)
+    if (renderer->getFeatures().supportsGeometryStreamsCapability.enabled)
     {
         rasterStreamState.rasterizationStream = 0;
         *pNextPtr                             = &rasterStreamState;
@@ -3051,8 +3056,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
             // From OpenGL ES clients, this means disabling blending for integer formats.
             if (!angle::Format::Get(mRenderPassDesc[colorIndexGL]).isInt())
             {
-                ASSERT(!contextVk->getRenderer()
-                            ->getFormat(mRenderPassDesc[colorIndexGL])
+                ASSERT(!renderer->getFormat(mRenderPassDesc[colorIndexGL])
                             .getActualRenderableImageFormat()
                             .isInt());
 
@@ -3062,7 +3066,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
                 const PackedColorBlendAttachmentState &packedBlendState =
                     colorBlend.attachments[colorIndexGL];
                 if (packedBlendState.colorBlendOp <= static_cast<uint8_t>(VK_BLEND_OP_MAX) ||
-                    contextVk->getFeatures().supportsBlendOperationAdvanced.enabled)
+                    renderer->getFeatures().supportsBlendOperationAdvanced.enabled)
                 {
                     state.blendEnable = VK_TRUE;
                     UnpackBlendAttachmentState(packedBlendState, &state);
@@ -3070,8 +3074,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
             }
         }
 
-        if (contextVk->getExtensions().robustFragmentShaderOutputANGLE &&
-            missingOutputsMask[colorIndexGL])
+        if (missingOutputsMask[colorIndexGL])
         {
             state.colorWriteMask = 0;
         }
@@ -3083,7 +3086,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     }
 
     // Dynamic state
-    angle::FixedVector<VkDynamicState, 21> dynamicStateList;
+    angle::FixedVector<VkDynamicState, 22> dynamicStateList;
     dynamicStateList.push_back(VK_DYNAMIC_STATE_VIEWPORT);
     dynamicStateList.push_back(VK_DYNAMIC_STATE_SCISSOR);
     dynamicStateList.push_back(VK_DYNAMIC_STATE_LINE_WIDTH);
@@ -3093,7 +3096,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     dynamicStateList.push_back(VK_DYNAMIC_STATE_STENCIL_COMPARE_MASK);
     dynamicStateList.push_back(VK_DYNAMIC_STATE_STENCIL_WRITE_MASK);
     dynamicStateList.push_back(VK_DYNAMIC_STATE_STENCIL_REFERENCE);
-    if (contextVk->getFeatures().supportsExtendedDynamicState.enabled)
+    if (renderer->getFeatures().supportsExtendedDynamicState.enabled)
     {
         dynamicStateList.push_back(VK_DYNAMIC_STATE_CULL_MODE_EXT);
         dynamicStateList.push_back(VK_DYNAMIC_STATE_FRONT_FACE_EXT);
@@ -3107,13 +3110,17 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
         dynamicStateList.push_back(VK_DYNAMIC_STATE_STENCIL_TEST_ENABLE);
         dynamicStateList.push_back(VK_DYNAMIC_STATE_STENCIL_OP);
     }
-    if (contextVk->getFeatures().supportsExtendedDynamicState2.enabled)
+    if (renderer->getFeatures().useDynamicPrimitiveTopology.enabled)
+    {
+        dynamicStateList.push_back(VK_DYNAMIC_STATE_PRIMITIVE_TOPOLOGY_EXT);
+    }
+    if (renderer->getFeatures().supportsExtendedDynamicState2.enabled)
     {
         dynamicStateList.push_back(VK_DYNAMIC_STATE_RASTERIZER_DISCARD_ENABLE);
         dynamicStateList.push_back(VK_DYNAMIC_STATE_DEPTH_BIAS_ENABLE);
         dynamicStateList.push_back(VK_DYNAMIC_STATE_PRIMITIVE_RESTART_ENABLE);
     }
-    if (contextVk->getFeatures().supportsFragmentShadingRate.enabled)
+    if (renderer->getFeatures().supportsFragmentShadingRate.enabled)
     {
         dynamicStateList.push_back(VK_DYNAMIC_STATE_FRAGMENT_SHADING_RATE_KHR);
     }
@@ -3139,7 +3146,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     }
 
     createInfo.sType               = VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO;
-    createInfo.flags               = 0;
+    createInfo.flags               = createFlags;
     createInfo.stageCount          = static_cast<uint32_t>(shaderStages.size());
     createInfo.pStages             = shaderStages.data();
     createInfo.pVertexInputState   = &vertexInputState;
@@ -3170,13 +3177,13 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
     feedbackInfo.pipelineStageCreationFeedbackCount = createInfo.stageCount;
     feedbackInfo.pPipelineStageCreationFeedbacks    = perStageFeedback.data();
 
-    const bool supportsFeedback = contextVk->getFeatures().supportsPipelineCreationFeedback.enabled;
+    const bool supportsFeedback = renderer->getFeatures().supportsPipelineCreationFeedback.enabled;
     if (supportsFeedback)
     {
         createInfo.pNext = &feedbackInfo;
     }
 
-    ANGLE_TRY(pipelineCache->createGraphicsPipeline(contextVk, createInfo, pipelineOut));
+    ANGLE_TRY(pipelineCache->createGraphicsPipeline(context, createInfo, pipelineOut));
 
     if (supportsFeedback)
     {
@@ -3185,7 +3192,7 @@ angle::Result GraphicsPipelineDesc::initializePipeline(
             0;
 
         *feedbackOut = cacheHit ? CacheLookUpFeedback::Hit : CacheLookUpFeedback::Miss;
-        ApplyPipelineCreationFeedback(contextVk, feedback);
+        ApplyPipelineCreationFeedback(context, feedback);
     }
 
     return angle::Result::Continue;
@@ -3234,14 +3241,37 @@ void GraphicsPipelineDesc::updateVertexInput(ContextVk *contextVk,
 void GraphicsPipelineDesc::setTopology(gl::PrimitiveMode drawMode)
 {
     VkPrimitiveTopology vkTopology = gl_vk::GetPrimitiveTopology(drawMode);
+
+    // When the topology is dynamic, the pipeline only needs to know the topology class.  The
+    // adjacency topologies are left alone as they change the geometry shader's input.
+    if (mDynamicState.ds1And2.supportsDynamicPrimitiveTopology)
+    {
+        switch (vkTopology)
+        {
+            case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP:
+                vkTopology = VK_PRIMITIVE_TOPOLOGY_LINE_LIST;
+                break;
+            case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP:
+            case VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN:
+                vkTopology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+                break;
+            default:
+                break;
+        }
+    }
+
     SetBitField(mInputAssemblyAndRasterizationStateInfo.misc.topology, vkTopology);
 }
 
 void GraphicsPipelineDesc::updateTopology(GraphicsPipelineTransitionBits *transition,
                                           gl::PrimitiveMode drawMode)
 {
+    const uint32_t previousTopology = mInputAssemblyAndRasterizationStateInfo.misc.topology;
     setTopology(drawMode);
-    transition->set(ANGLE_GET_TRANSITION_BIT(mInputAssemblyAndRasterizationStateInfo, misc));
+    if (mInputAssemblyAndRasterizationStateInfo.misc.topology != previousTopology)
+    {
+        transition->set(ANGLE_GET_TRANSITION_BIT(mInputAssemblyAndRasterizationStateInfo, misc));
+    }
 }
 
 void GraphicsPipelineDesc::updateDepthClipControl(GraphicsPipelineTransitionBits *transition,
@@ -3678,6 +3708,19 @@ uint32_t GraphicsPipelineDesc::getSubpass() const
     return mInputAssemblyAndRasterizationStateInfo.bits.subpass;
 }
 
+bool GraphicsPipelineDesc::hasLineTopology() const
+{
+    // GL_LINE_LOOP is drawn as a line strip.  GL_LINES_ADJACENCY is not a line mode.
+    switch (mInputAssemblyAndRasterizationStateInfo.misc.topology)
+    {
+        case VK_PRIMITIVE_TOPOLOGY_LINE_LIST:
+        case VK_PRIMITIVE_TOPOLOGY_LINE_STRIP:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void GraphicsPipelineDesc::updateEmulatedDitherControl(GraphicsPipelineTransitionBits *transition,
                                                        uint16_t value)
 {
@@ -3927,6 +3970,94 @@ void PipelineLayoutDesc::updatePushConstantRange(VkShaderStageFlags stageMask,
     SetBitField(mPushConstantRange.stageMask, stageMask);
 }
 
+// CreateGraphicsPipelineTask implementation.
+//
+// The task is its own vk::Context so that errors on the worker thread don't touch the ContextVk.
+// Everything referenced by the task is owned by the ShaderProgramHelper (shaders and the pipeline
+// cache entries), the pipeline layout cache or the render pass cache.  The pipeline cache waits for
+// the task before releasing its entries, and ContextVk waits for it before destroying its render
+// pass cache.
+class CreateGraphicsPipelineTask final : public Context, public angle::Closure
+{
+  public:
+    CreateGraphicsPipelineTask(RendererVk *renderer,
+                               const PipelineCacheAccess &pipelineCache,
+                               const GraphicsPipelineDesc &desc,
+                               const RenderPass &compatibleRenderPass,
+                               const PipelineLayout &pipelineLayout,
+                               const gl::AttributesMask &activeAttribLocationsMask,
+                               const gl::ComponentTypeMask &programAttribsTypeMask,
+                               const gl::DrawBufferMask &missingOutputsMask,
+                               const ShaderAndSerialMap &shaders,
+                               const SpecializationConstants &specConsts)
+        : Context(renderer),
+          mPipelineCache(pipelineCache),
+          mDesc(desc),
+          mCompatibleRenderPass(compatibleRenderPass),
+          mPipelineLayout(pipelineLayout),
+          mActiveAttribLocationsMask(activeAttribLocationsMask),
+          mProgramAttribsTypeMask(programAttribsTypeMask),
+          mMissingOutputsMask(missingOutputsMask),
+          mShaders(shaders),
+          mSpecConsts(specConsts),
+          mErrorCode(VK_SUCCESS),
+          mErrorFile(nullptr),
+          mErrorFunction(nullptr),
+          mErrorLine(0)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "CreateGraphicsPipelineTask");
+        CacheLookUpFeedback feedback = CacheLookUpFeedback::None;
+        (void)mDesc.initializePipeline(this, &mPipelineCache, mCompatibleRenderPass,
+                                       mPipelineLayout, mActiveAttribLocationsMask,
+                                       mProgramAttribsTypeMask, mMissingOutputsMask, mShaders,
+                                       mSpecConsts, 0, &mPipeline, &feedback);
+    }
+
+    void handleError(VkResult result,
+                     const char *file,
+                     const char *function,
+                     unsigned int line) override
+    {
+        mErrorCode     = result;
+        mErrorFile     = file;
+        mErrorFunction = function;
+        mErrorLine     = line;
+    }
+
+    angle::Result getResult(ContextVk *contextVk)
+    {
+        if (mErrorCode != VK_SUCCESS)
+        {
+            contextVk->handleError(mErrorCode, mErrorFile, mErrorFunction, mErrorLine);
+            return angle::Result::Stop;
+        }
+        return angle::Result::Continue;
+    }
+
+    Pipeline &getPipeline() { return mPipeline; }
+
+  private:
+    PipelineCacheAccess mPipelineCache;
+    const GraphicsPipelineDesc &mDesc;
+    const RenderPass &mCompatibleRenderPass;
+    const PipelineLayout &mPipelineLayout;
+    gl::AttributesMask mActiveAttribLocationsMask;
+    gl::ComponentTypeMask mProgramAttribsTypeMask;
+    gl::DrawBufferMask mMissingOutputsMask;
+    const ShaderAndSerialMap &mShaders;
+    SpecializationConstants mSpecConsts;
+
+    Pipeline mPipeline;
+
+    VkResult mErrorCode;
+    const char *mErrorFile;
+    const char *mErrorFunction;
+    unsigned int mErrorLine;
+};
+
 // PipelineHelper implementation.
 PipelineHelper::PipelineHelper() = default;
 
@@ -3934,35 +4065,82 @@ PipelineHelper::~PipelineHelper() = default;
 
 void PipelineHelper::destroy(VkDevice device)
 {
+    if (mAsyncCreatePipelineTask)
+    {
+        waitForAsyncPipeline();
+        mAsyncCreatePipelineTask->getPipeline().destroy(device);
+        mAsyncCreatePipelineTask.reset();
+    }
+
     mPipeline.destroy(device);
     mCacheLookUpFeedback = CacheLookUpFeedback::None;
 }
 
 void PipelineHelper::release(ContextVk *contextVk)
 {
+    if (mAsyncCreatePipelineTask)
+    {
+        waitForAsyncPipeline();
+        contextVk->addGarbage(&mAsyncCreatePipelineTask->getPipeline());
+        mAsyncCreatePipelineTask.reset();
+    }
+
     contextVk->addGarbage(&mPipeline);
     mCacheLookUpFeedback = CacheLookUpFeedback::None;
 }
 
-void PipelineHelper::addTransition(GraphicsPipelineTransitionBits bits,
-                                   const GraphicsPipelineDesc *desc,
-                                   PipelineHelper *pipeline)
+void PipelineHelper::setAsyncCreatePipelineTask(std::shared_ptr<CreateGraphicsPipelineTask> task,
+                                                std::shared_ptr<angle::WaitableEvent> waitableEvent)
 {
-    mTransitions.emplace_back(bits, desc, pipeline);
+    ASSERT(!mAsyncCreatePipelineTask && !mAsyncCreatePipelineEvent);
+    mAsyncCreatePipelineTask  = std::move(task);
+    mAsyncCreatePipelineEvent = std::move(waitableEvent);
 }
 
-// DescriptorSetDesc implementation.
-size_t DescriptorSetDesc::hash() const
+void PipelineHelper::waitForAsyncPipeline()
 {
-    if (mDescriptorInfos.empty())
+    if (mAsyncCreatePipelineEvent)
     {
-        return 0;
+        mAsyncCreatePipelineEvent->wait();
+        mAsyncCreatePipelineEvent.reset();
     }
+}
+
+angle::Result PipelineHelper::updateAsyncPipeline(ContextVk *contextVk)
+{
+    ASSERT(mAsyncCreatePipelineTask && mAsyncCreatePipelineEvent);
+    if (!mAsyncCreatePipelineEvent->isReady())
+    {
+        return angle::Result::Continue;
+    }
+
+    return finishAsyncPipeline(contextVk);
+}
 
-    return angle::ComputeGenericHash(mDescriptorInfos.data(),
-                                     sizeof(mDescriptorInfos[0]) * mDescriptorInfos.size());
+angle::Result PipelineHelper::finishAsyncPipeline(ContextVk *contextVk)
+{
+    ASSERT(mAsyncCreatePipelineTask && mAsyncCreatePipelineEvent);
+    waitForAsyncPipeline();
+
+    std::shared_ptr<CreateGraphicsPipelineTask> task = std::move(mAsyncCreatePipelineTask);
+    ANGLE_TRY(task->getResult(contextVk));
+
+    // The unoptimized pipeline may still be in use by recorded commands.  Pipelines that are
+    // warmed up in the background don't have one.
+    contextVk->addGarbage(&mPipeline);
+    mPipeline = std::move(task->getPipeline());
+
+    return angle::Result::Continue;
 }
 
+void PipelineHelper::addTransition(GraphicsPipelineTransitionBits bits,
+                                   const GraphicsPipelineDesc *desc,
+                                   PipelineHelper *pipeline)
+{
+    mTransitions.emplace_back(bits, desc, pipeline);
+}
+
+// DescriptorSetDesc implementation.
 // FramebufferDesc implementation.
 
 FramebufferDesc::FramebufferDesc()
@@ -4077,6 +4255,89 @@ void FramebufferDesc::updateRenderToTexture(bool isRenderToTexture)
     SetBitField(mIsRenderToTexture, isRenderToTexture);
 }
 
+// ImagelessFramebufferDesc implementation.
+ImagelessFramebufferDesc::ImagelessFramebufferDesc()
+{
+    // Unused attachments are zeroed, so descriptions can be compared with memcmp.
+    memset(this, 0, sizeof(ImagelessFramebufferDesc));
+}
+
+ImagelessFramebufferDesc::~ImagelessFramebufferDesc() = default;
+ImagelessFramebufferDesc::ImagelessFramebufferDesc(const ImagelessFramebufferDesc &other) =
+    default;
+ImagelessFramebufferDesc &ImagelessFramebufferDesc::operator=(
+    const ImagelessFramebufferDesc &other) = default;
+
+void ImagelessFramebufferDesc::update(const RenderPassDesc &renderPassDesc,
+                                      uint32_t width,
+                                      uint32_t height,
+                                      uint32_t layers)
+{
+    mRenderPassDesc = renderPassDesc;
+    mWidth          = width;
+    mHeight         = height;
+    mLayers         = layers;
+}
+
+void ImagelessFramebufferDesc::addAttachment(VkImageCreateFlags createFlags,
+                                             VkImageUsageFlags usage,
+                                             const gl::Extents &extents,
+                                             uint32_t layerCount,
+                                             uint32_t viewFormatCount,
+                                             const VkFormat *viewFormats)
+{
+    ASSERT(mAttachmentCount < kMaxFramebufferAttachments);
+    ASSERT(viewFormatCount <= kMaxImagelessFramebufferViewFormats);
+
+    Attachment &attachment     = mAttachments[mAttachmentCount++];
+    attachment.createFlags     = createFlags;
+    attachment.usage           = usage;
+    attachment.width           = static_cast<uint32_t>(extents.width);
+    attachment.height          = static_cast<uint32_t>(extents.height);
+    attachment.layerCount      = layerCount;
+    attachment.viewFormatCount = viewFormatCount;
+    for (uint32_t formatIndex = 0; formatIndex < viewFormatCount; ++formatIndex)
+    {
+        attachment.viewFormats[formatIndex] = viewFormats[formatIndex];
+    }
+}
+
+size_t ImagelessFramebufferDesc::validSize() const
+{
+    return offsetof(ImagelessFramebufferDesc, mAttachments) +
+           sizeof(mAttachments[0]) * mAttachmentCount;
+}
+
+size_t ImagelessFramebufferDesc::hash() const
+{
+    return angle::ComputeGenericHash(this, validSize());
+}
+
+bool ImagelessFramebufferDesc::operator==(const ImagelessFramebufferDesc &other) const
+{
+    return mAttachmentCount == other.mAttachmentCount && memcmp(this, &other, validSize()) == 0;
+}
+
+void ImagelessFramebufferDesc::getAttachmentImageInfos(
+    FramebufferAttachmentArray<VkFramebufferAttachmentImageInfoKHR> *infosOut) const
+{
+    for (uint32_t index = 0; index < mAttachmentCount; ++index)
+    {
+        const Attachment &attachment              = mAttachments[index];
+        VkFramebufferAttachmentImageInfoKHR &info = (*infosOut)[index];
+
+        info                 = {};
+        info.sType           = VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO_KHR;
+        info.flags           = attachment.createFlags;
+        info.usage           = attachment.usage;
+        info.width           = attachment.width;
+        info.height          = attachment.height;
+        info.layerCount      = attachment.layerCount;
+        info.viewFormatCount = attachment.viewFormatCount;
+        info.pViewFormats    = attachment.viewFormats;
+    }
+}
+
 // YcbcrConversionDesc implementation
 YcbcrConversionDesc::YcbcrConversionDesc()
 {
@@ -4582,6 +4843,95 @@ void DescriptorSetDesc::updateDescriptorSet(UpdateDescriptorSetsBuilder *updateB
     }
 }
 
+void DescriptorSetDesc::getUpdateTemplateEntries(
+    std::vector<VkDescriptorUpdateTemplateEntryKHR> *entriesOut) const
+{
+    entriesOut->clear();
+
+    for (uint32_t writeIndex = 0; writeIndex < static_cast<uint32_t>(mWriteDescriptors.size());
+         ++writeIndex)
+    {
+        const WriteDescriptorDesc &writeDesc = mWriteDescriptors[writeIndex];
+
+        if (writeDesc.descriptorCount == 0)
+        {
+            continue;
+        }
+
+        VkDescriptorUpdateTemplateEntryKHR entry = {};
+
+        entry.dstBinding      = writeIndex;
+        entry.dstArrayElement = 0;
+        entry.descriptorCount = writeDesc.descriptorCount;
+        entry.descriptorType  = static_cast<VkDescriptorType>(writeDesc.descriptorType);
+        entry.offset          = writeDesc.descriptorInfoIndex * sizeof(DescriptorTemplateInfo);
+        entry.stride          = sizeof(DescriptorTemplateInfo);
+
+        entriesOut->push_back(entry);
+    }
+}
+
+void DescriptorSetDesc::updateDescriptorSetWithTemplate(
+    UpdateDescriptorSetsBuilder *updateBuilder,
+    const DescriptorDescHandles *handles,
+    const DescriptorUpdateTemplate &updateTemplate,
+    VkDescriptorSet descriptorSet) const
+{
+    uint32_t imageDescriptorCount         = 0;
+    DescriptorTemplateInfo *templateInfos = updateBuilder->allocTemplateDescriptorInfos(
+        updateTemplate, descriptorSet, mDescriptorInfos.size());
+
+    for (uint32_t writeIndex = 0; writeIndex < static_cast<uint32_t>(mWriteDescriptors.size());
+         ++writeIndex)
+    {
+        const WriteDescriptorDesc &writeDesc = mWriteDescriptors[writeIndex];
+        uint32_t infoDescIndex               = writeDesc.descriptorInfoIndex;
+
+        for (uint32_t arrayElement = 0; arrayElement < writeDesc.descriptorCount; ++arrayElement)
+        {
+            const uint32_t infoIndex                 = infoDescIndex + arrayElement;
+            const DescriptorInfoDesc &infoDesc       = mDescriptorInfos[infoIndex];
+            const DescriptorDescHandles &descHandles = handles[infoIndex];
+            DescriptorTemplateInfo &templateInfo     = templateInfos[infoIndex];
+
+            switch (static_cast<VkDescriptorType>(writeDesc.descriptorType))
+            {
+                case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    ASSERT(writeDesc.descriptorCount == 1);
+                    templateInfo.bufferView = descHandles.bufferView;
+                    break;
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+                case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
+                    templateInfo.buffer.buffer = descHandles.buffer;
+                    templateInfo.buffer.offset = infoDesc.imageViewSerialOrOffset;
+                    templateInfo.buffer.range  = infoDesc.imageLayoutOrRange;
+                    break;
+                case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
+                case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
+                case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
+                case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                {
+                    ImageLayout imageLayout = static_cast<ImageLayout>(infoDesc.imageLayoutOrRange);
+
+                    templateInfo.image.imageLayout = ConvertImageLayoutToVkImageLayout(imageLayout);
+                    templateInfo.image.imageView   = descHandles.imageView;
+                    templateInfo.image.sampler     = descHandles.sampler;
+                    ++imageDescriptorCount;
+                    break;
+                }
+                default:
+                    UNREACHABLE();
+                    break;
+            }
+        }
+    }
+
+    updateBuilder->onTemplateImageDescriptorsWritten(imageDescriptorCount);
+}
+
 void DescriptorSetDesc::streamOut(std::ostream &ostr) const
 {
     ostr << mWriteDescriptors.size() << " write descriptor descs:\n";
@@ -4737,18 +5087,23 @@ void DescriptorSetDescBuilder::updateUniformsAndXfb(Context *context,
 
     for (const gl::ShaderType shaderType : linkedStages)
     {
-        uint32_t binding = variableInfoMap.getDefaultUniformBinding(shaderType);
-        updateWriteDesc(binding, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1);
-
-        VkDeviceSize bufferRange = executableVk.getDefaultUniformAlignedSize(context, shaderType);
-        if (bufferRange == 0)
-        {
-            updateUniformBuffer(binding, emptyBuffer, emptyBuffer.getSize());
-        }
-        else
+        // Default uniforms in push constants have no descriptor.
+        if (!executableVk.usesDefaultUniformPushConstants())
         {
-            ASSERT(currentUniformBuffer);
-            updateUniformBuffer(binding, *currentUniformBuffer, bufferRange);
+            uint32_t binding = variableInfoMap.getDefaultUniformBinding(shaderType);
+            updateWriteDesc(binding, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, 1);
+
+            VkDeviceSize bufferRange =
+                executableVk.getDefaultUniformAlignedSize(context, shaderType);
+            if (bufferRange == 0)
+            {
+                updateUniformBuffer(binding, emptyBuffer, emptyBuffer.getSize());
+            }
+            else
+            {
+                ASSERT(currentUniformBuffer);
+                updateUniformBuffer(binding, *currentUniformBuffer, bufferRange);
+            }
         }
 
         if (transformFeedbackVk && shaderType == gl::ShaderType::Vertex &&
@@ -5287,6 +5642,15 @@ void DescriptorSetDescBuilder::updateDescriptorSet(UpdateDescriptorSetsBuilder *
 {
     mDesc.updateDescriptorSet(updateBuilder, mHandles.data(), descriptorSet);
 }
+
+void DescriptorSetDescBuilder::updateDescriptorSetWithTemplate(
+    UpdateDescriptorSetsBuilder *updateBuilder,
+    const DescriptorUpdateTemplate &updateTemplate,
+    VkDescriptorSet descriptorSet) const
+{
+    mDesc.updateDescriptorSetWithTemplate(updateBuilder, mHandles.data(), updateTemplate,
+                                          descriptorSet);
+}
 }  // namespace vk
 
 // RenderPassCache implementation.
@@ -5473,7 +5837,7 @@ void GraphicsPipelineCache::release(ContextVk *contextVk)
     for (auto &item : mPayload)
     {
         vk::PipelineHelper &pipeline = item.second;
-        contextVk->addGarbage(&pipeline.getPipeline());
+        pipeline.release(contextVk);
     }
 
     mPayload.clear();
@@ -5502,13 +5866,47 @@ angle::Result GraphicsPipelineCache::insertPipeline(
     vk::Pipeline newPipeline;
     vk::CacheLookUpFeedback feedback = vk::CacheLookUpFeedback::None;
 
+    mCacheStats.missAndIncrementSize();
+
+    // Draw calls don't wait for the optimized pipeline if it can be created in the background.
+    // Instead, a pipeline without optimizations is created for immediate use, as that is
+    // considerably faster.  Warm up pipelines are entirely created in the background; a draw call
+    // that needs one before it's ready waits for it.
+    const bool createAsync = contextVk != nullptr && source != PipelineSource::Utils &&
+                             contextVk->canCreateGraphicsPipelinesAsync();
+
     // This "if" is left here for the benefit of VulkanPipelineCachePerfTest.
     if (contextVk != nullptr)
     {
-        ANGLE_TRY(desc.initializePipeline(contextVk, pipelineCache, compatibleRenderPass,
-                                          pipelineLayout, activeAttribLocationsMask,
-                                          programAttribsTypeMask, missingOutputsMask, shaders,
-                                          specConsts, &newPipeline, &feedback));
+        // Misses during warm up or in UtilsVk are not attributed to the current frame.
+        CacheStats unattributedCacheStats;
+        CacheStats &perFrameCacheStats = source == PipelineSource::Draw
+                                             ? contextVk->getPerFrameGraphicsPipelineCacheStats()
+                                             : unattributedCacheStats;
+        perFrameCacheStats.miss();
+
+        if (createAsync && source == PipelineSource::Draw)
+        {
+            // The unoptimized pipeline is not worth caching, and going through the pipeline cache
+            // would have to wait for any pipeline creation in progress on the worker threads.
+            PipelineCacheAccess noPipelineCache;
+            noPipelineCache.init(&mNullPipelineCache, nullptr);
+
+            ANGLE_TRY(desc.initializePipeline(
+                contextVk, &noPipelineCache, compatibleRenderPass, pipelineLayout,
+                activeAttribLocationsMask, programAttribsTypeMask, missingOutputsMask, shaders,
+                specConsts, VK_PIPELINE_CREATE_DISABLE_OPTIMIZATION_BIT, &newPipeline, &feedback));
+        }
+        else if (!createAsync)
+        {
+            mCacheStats.stall();
+            perFrameCacheStats.stall();
+
+            ANGLE_TRY(desc.initializePipeline(contextVk, pipelineCache, compatibleRenderPass,
+                                              pipelineLayout, activeAttribLocationsMask,
+                                              programAttribsTypeMask, missingOutputsMask, shaders,
+                                              specConsts, 0, &newPipeline, &feedback));
+        }
     }
 
     if (source == PipelineSource::WarmUp)
@@ -5523,9 +5921,38 @@ angle::Result GraphicsPipelineCache::insertPipeline(
     *descPtrOut       = &insertedItem.first->first;
     *pipelineOut      = &insertedItem.first->second;
 
+    if (createAsync)
+    {
+        // The task references the desc stored in the cache, which is not removed before the task
+        // is waited on.
+        auto task = std::make_shared<vk::CreateGraphicsPipelineTask>(
+            contextVk->getRenderer(), *pipelineCache, insertedItem.first->first,
+            compatibleRenderPass, pipelineLayout, activeAttribLocationsMask, programAttribsTypeMask,
+            missingOutputsMask, shaders, specConsts);
+        std::shared_ptr<angle::WaitableEvent> waitableEvent =
+            contextVk->postAsyncGraphicsPipelineTask(task);
+        insertedItem.first->second.setAsyncCreatePipelineTask(std::move(task),
+                                                              std::move(waitableEvent));
+    }
+
     return angle::Result::Continue;
 }
 
+angle::Result GraphicsPipelineCache::waitForWarmUpPipeline(ContextVk *contextVk,
+                                                           PipelineSource source,
+                                                           vk::PipelineHelper *pipeline)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "GraphicsPipelineCache::waitForWarmUpPipeline");
+
+    mCacheStats.stall();
+    if (source == PipelineSource::Draw)
+    {
+        contextVk->getPerFrameGraphicsPipelineCacheStats().stall();
+    }
+
+    return pipeline->finishAsyncPipeline(contextVk);
+}
+
 void GraphicsPipelineCache::populate(const vk::GraphicsPipelineDesc &desc, vk::Pipeline &&pipeline)
 {
     auto item = mPayload.find(desc);
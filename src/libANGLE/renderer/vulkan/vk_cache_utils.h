@@ -13,7 +13,9 @@
 
 #include "common/Color.h"
 #include "common/FixedVector.h"
+#include "common/hash_utils.h"
 #include "libANGLE/Uniform.h"
+#include "libANGLE/WorkerThread.h"
 #include "libANGLE/renderer/ShaderInterfaceVariableInfoMap.h"
 #include "libANGLE/renderer/vulkan/ResourceVk.h"
 #include "libANGLE/renderer/vulkan/vk_utils.h"
@@ -504,8 +506,11 @@ struct PackedDynamicState1And2 final
     // is to support GraphicsPipelineDesc::hash(), allowing it to exclude this state from the hash.
     uint32_t supportsDynamicState1 : 1;
     uint32_t supportsDynamicState2 : 1;
+    // Whether the topology is set dynamically, in which case only the topology class is kept in
+    // the pipeline description.
+    uint32_t supportsDynamicPrimitiveTopology : 1;
 
-    uint32_t padding : 12;
+    uint32_t padding : 11;
 };
 
 constexpr size_t kPackedDynamicState1And2Size = sizeof(PackedDynamicState1And2);
@@ -576,7 +581,8 @@ class GraphicsPipelineDesc final
         return reinterpret_cast<const T *>(this);
     }
 
-    angle::Result initializePipeline(ContextVk *contextVk,
+    // Note: this may be called from a worker thread, so |context| is not necessarily a ContextVk.
+    angle::Result initializePipeline(Context *context,
                                      PipelineCacheAccess *pipelineCache,
                                      const RenderPass &compatibleRenderPass,
                                      const PipelineLayout &pipelineLayout,
@@ -585,6 +591,7 @@ class GraphicsPipelineDesc final
                                      const gl::DrawBufferMask &missingOutputsMask,
                                      const ShaderAndSerialMap &shaders,
                                      const SpecializationConstants &specConsts,
+                                     VkPipelineCreateFlags createFlags,
                                      Pipeline *pipelineOut,
                                      CacheLookUpFeedback *feedbackOut) const;
 
@@ -716,13 +723,23 @@ class GraphicsPipelineDesc final
         return mInputAssemblyAndRasterizationStateInfo.misc.surfaceRotation;
     }
 
+    VkPrimitiveTopology getTopology() const
+    {
+        return static_cast<VkPrimitiveTopology>(
+            mInputAssemblyAndRasterizationStateInfo.misc.topology);
+    }
+
+    // Whether the topology is that of a gl::IsLineMode() primitive mode.
+    bool hasLineTopology() const;
+
     void updateEmulatedDitherControl(GraphicsPipelineTransitionBits *transition, uint16_t value);
     uint32_t getEmulatedDitherControl() const { return mDither.emulatedDitherControl; }
 
     void setSupportsDynamicStateForTest(bool supports)
     {
-        mDynamicState.ds1And2.supportsDynamicState1 = supports;
-        mDynamicState.ds1And2.supportsDynamicState2 = supports;
+        mDynamicState.ds1And2.supportsDynamicState1            = supports;
+        mDynamicState.ds1And2.supportsDynamicState2            = supports;
+        mDynamicState.ds1And2.supportsDynamicPrimitiveTopology = supports;
     }
 
     // Helpers to dump the state
@@ -993,6 +1010,7 @@ static_assert(sizeof(SamplerDesc) == 56, "Unexpected SamplerDesc size");
 ANGLE_DISABLE_STRUCT_PADDING_WARNINGS
 
 class PipelineHelper;
+class CreateGraphicsPipelineTask;
 
 struct GraphicsPipelineTransition
 {
@@ -1090,10 +1108,28 @@ class PipelineHelper final : public Resource
     }
     CacheLookUpFeedback getCacheLookUpFeedback() const { return mCacheLookUpFeedback; }
 
+    // With the asyncGraphicsPipelineCreation feature, mPipeline is initially created without
+    // optimizations, and the optimized pipeline is created by |task| on a worker thread.  Once
+    // ready, the optimized pipeline replaces mPipeline.  Since transitions refer to the
+    // PipelineHelper and not the VkPipeline, they automatically pick up the new pipeline.
+    void setAsyncCreatePipelineTask(std::shared_ptr<CreateGraphicsPipelineTask> task,
+                                    std::shared_ptr<angle::WaitableEvent> waitableEvent);
+    bool hasPendingAsyncPipeline() const { return mAsyncCreatePipelineEvent != nullptr; }
+    // Swaps in the optimized pipeline if the worker thread is done creating it.
+    angle::Result updateAsyncPipeline(ContextVk *contextVk);
+    // Waits for the worker thread to create the pipeline and swaps it in.  Used for pipelines that
+    // are warmed up in the background and have no pipeline to fall back to.
+    angle::Result finishAsyncPipeline(ContextVk *contextVk);
+
   private:
+    void waitForAsyncPipeline();
+
     std::vector<GraphicsPipelineTransition> mTransitions;
     Pipeline mPipeline;
     CacheLookUpFeedback mCacheLookUpFeedback = CacheLookUpFeedback::None;
+
+    std::shared_ptr<CreateGraphicsPipelineTask> mAsyncCreatePipelineTask;
+    std::shared_ptr<angle::WaitableEvent> mAsyncCreatePipelineEvent;
 };
 
 ANGLE_INLINE PipelineHelper::PipelineHelper(Pipeline &&pipeline, CacheLookUpFeedback feedback)
@@ -1188,6 +1224,15 @@ struct DescriptorDescHandles
     VkBufferView bufferView;
 };
 
+// The data a descriptor update template created by DescriptorSetDesc::getUpdateTemplateEntries
+// reads.  There is one element per DescriptorInfoDesc, at the same index.
+union DescriptorTemplateInfo
+{
+    VkDescriptorBufferInfo buffer;
+    VkDescriptorImageInfo image;
+    VkBufferView bufferView;
+};
+
 class DescriptorSetDesc
 {
   public:
@@ -1195,22 +1240,26 @@ class DescriptorSetDesc
     ~DescriptorSetDesc() = default;
 
     DescriptorSetDesc(const DescriptorSetDesc &other)
-        : mWriteDescriptors(other.mWriteDescriptors), mDescriptorInfos(other.mDescriptorInfos)
+        : mWriteDescriptors(other.mWriteDescriptors),
+          mDescriptorInfos(other.mDescriptorInfos),
+          mDescriptorInfosHash(other.mDescriptorInfosHash)
     {}
 
     DescriptorSetDesc &operator=(const DescriptorSetDesc &other)
     {
-        mWriteDescriptors = other.mWriteDescriptors;
-        mDescriptorInfos  = other.mDescriptorInfos;
+        mWriteDescriptors    = other.mWriteDescriptors;
+        mDescriptorInfos     = other.mDescriptorInfos;
+        mDescriptorInfosHash = other.mDescriptorInfosHash;
         return *this;
     }
 
-    size_t hash() const;
+    size_t hash() const { return static_cast<size_t>(mDescriptorInfosHash); }
 
     void reset()
     {
         mWriteDescriptors.clear();
         mDescriptorInfos.clear();
+        mDescriptorInfosHash = 0;
     }
 
     size_t getKeySizeBytes() const
@@ -1235,6 +1284,12 @@ class DescriptorSetDesc
 
     void updateInfoDesc(uint32_t infoDescIndex, const DescriptorInfoDesc &infoDesc)
     {
+        // The infos that the map adds when it grows are zero, and don't count towards the hash.
+        if (infoDescIndex < mDescriptorInfos.size())
+        {
+            mDescriptorInfosHash -= HashInfoDesc(infoDescIndex, mDescriptorInfos[infoDescIndex]);
+        }
+        mDescriptorInfosHash += HashInfoDesc(infoDescIndex, infoDesc);
         mDescriptorInfos[infoDescIndex] = infoDesc;
     }
 
@@ -1255,6 +1310,19 @@ class DescriptorSetDesc
                              const DescriptorDescHandles *handles,
                              VkDescriptorSet descriptorSet) const;
 
+    // Descriptor update template support.  A template built from one desc can write any desc that
+    // has the same write descriptors, i.e. that only differs in the descriptor infos.
+    bool hasSameWriteDescriptors(const DescriptorSetDesc &other) const
+    {
+        return mWriteDescriptors == other.mWriteDescriptors;
+    }
+    void getUpdateTemplateEntries(
+        std::vector<VkDescriptorUpdateTemplateEntryKHR> *entriesOut) const;
+    void updateDescriptorSetWithTemplate(UpdateDescriptorSetsBuilder *updateBuilder,
+                                         const DescriptorDescHandles *handles,
+                                         const DescriptorUpdateTemplate &updateTemplate,
+                                         VkDescriptorSet descriptorSet) const;
+
     bool empty() const { return mWriteDescriptors.size() == 0; }
 
     void streamOut(std::ostream &os) const;
@@ -1265,9 +1333,20 @@ class DescriptorSetDesc
     }
 
   private:
+    static uint64_t HashInfoDesc(uint32_t infoDescIndex, const DescriptorInfoDesc &infoDesc)
+    {
+        uint64_t words[2];
+        memcpy(words, &infoDesc, sizeof(words));
+        return angle::ComputeWordHashForSum(words[0], infoDescIndex * 2) +
+               angle::ComputeWordHashForSum(words[1], infoDescIndex * 2 + 1);
+    }
+
     // After a preliminary minimum size, use heap memory.
     angle::FastMap<WriteDescriptorDesc, kFastDescriptorSetDescLimit> mWriteDescriptors;
     angle::FastMap<DescriptorInfoDesc, kFastDescriptorSetDescLimit> mDescriptorInfos;
+    // The sum of the hashes of the infos, kept up to date by updateInfoDesc so that a lookup after
+    // a few descriptor changes doesn't hash every info.
+    uint64_t mDescriptorInfosHash = 0;
 };
 
 constexpr VkDescriptorType kStorageBufferDescriptorType = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
@@ -1350,6 +1429,9 @@ class DescriptorSetDescBuilder final
 
     void updateDescriptorSet(UpdateDescriptorSetsBuilder *updateBuilder,
                              VkDescriptorSet descriptorSet) const;
+    void updateDescriptorSetWithTemplate(UpdateDescriptorSetsBuilder *updateBuilder,
+                                         const DescriptorUpdateTemplate &updateTemplate,
+                                         VkDescriptorSet descriptorSet) const;
 
     const uint32_t *getDynamicOffsets() const { return mDynamicOffsets.data(); }
     size_t getDynamicOffsetsSize() const { return mDynamicOffsets.size(); }
@@ -1476,6 +1558,69 @@ class FramebufferDesc
 constexpr size_t kFramebufferDescSize = sizeof(FramebufferDesc);
 static_assert(kFramebufferDescSize == 148, "Size check failed");
 
+// Maximum number of view formats of an attachment of an imageless framebuffer.  Images that are
+// created with more view formats aren't used with imageless framebuffers.
+constexpr uint32_t kMaxImagelessFramebufferViewFormats = 2;
+
+// Imageless framebuffers are described by the properties of their attachments instead of their
+// image views, so the same framebuffer can be used after an attachment is reallocated.
+class ImagelessFramebufferDesc
+{
+  public:
+    ImagelessFramebufferDesc();
+    ~ImagelessFramebufferDesc();
+
+    ImagelessFramebufferDesc(const ImagelessFramebufferDesc &other);
+    ImagelessFramebufferDesc &operator=(const ImagelessFramebufferDesc &other);
+
+    void update(const RenderPassDesc &renderPassDesc,
+                uint32_t width,
+                uint32_t height,
+                uint32_t layers);
+    void addAttachment(VkImageCreateFlags createFlags,
+                       VkImageUsageFlags usage,
+                       const gl::Extents &extents,
+                       uint32_t layerCount,
+                       uint32_t viewFormatCount,
+                       const VkFormat *viewFormats);
+
+    size_t hash() const;
+    bool operator==(const ImagelessFramebufferDesc &other) const;
+
+    uint32_t attachmentCount() const { return mAttachmentCount; }
+    uint32_t getWidth() const { return mWidth; }
+    uint32_t getHeight() const { return mHeight; }
+    uint32_t getLayers() const { return mLayers; }
+
+    // The returned infos point to the view formats of this description.
+    void getAttachmentImageInfos(
+        FramebufferAttachmentArray<VkFramebufferAttachmentImageInfoKHR> *infosOut) const;
+
+  private:
+    struct Attachment
+    {
+        VkImageCreateFlags createFlags;
+        VkImageUsageFlags usage;
+        uint32_t width;
+        uint32_t height;
+        uint32_t layerCount;
+        uint32_t viewFormatCount;
+        VkFormat viewFormats[kMaxImagelessFramebufferViewFormats];
+    };
+
+    size_t validSize() const;
+
+    RenderPassDesc mRenderPassDesc;
+    uint32_t mWidth;
+    uint32_t mHeight;
+    uint32_t mLayers;
+    uint32_t mAttachmentCount;
+    FramebufferAttachmentArray<Attachment> mAttachments;
+};
+
+constexpr size_t kImagelessFramebufferDescSize = sizeof(ImagelessFramebufferDesc);
+static_assert(kImagelessFramebufferDescSize == 608, "Size check failed");
+
 // Disable warnings about struct padding.
 ANGLE_DISABLE_STRUCT_PADDING_WARNINGS
 
@@ -1581,6 +1726,12 @@ struct hash<rx::vk::FramebufferDesc>
     size_t operator()(const rx::vk::FramebufferDesc &key) const { return key.hash(); }
 };
 
+template <>
+struct hash<rx::vk::ImagelessFramebufferDesc>
+{
+    size_t operator()(const rx::vk::ImagelessFramebufferDesc &key) const { return key.hash(); }
+};
+
 template <>
 struct hash<rx::vk::YcbcrConversionDesc>
 {
@@ -1637,34 +1788,47 @@ class CacheStats final : angle::NonCopyable
     ~CacheStats() {}
 
     CacheStats(const CacheStats &rhs)
-        : mHitCount(rhs.mHitCount), mMissCount(rhs.mMissCount), mSize(rhs.mSize)
+        : mHitCount(rhs.mHitCount),
+          mMissCount(rhs.mMissCount),
+          mStallCount(rhs.mStallCount),
+          mSize(rhs.mSize)
     {}
 
     CacheStats &operator=(const CacheStats &rhs)
     {
-        mHitCount  = rhs.mHitCount;
-        mMissCount = rhs.mMissCount;
-        mSize      = rhs.mSize;
+        mHitCount   = rhs.mHitCount;
+        mMissCount  = rhs.mMissCount;
+        mStallCount = rhs.mStallCount;
+        mSize       = rhs.mSize;
         return *this;
     }
 
     ANGLE_INLINE void hit() { mHitCount++; }
     ANGLE_INLINE void miss() { mMissCount++; }
+    // A miss that the caller had to wait on, as opposed to one that was handled asynchronously.
+    ANGLE_INLINE void stall() { mStallCount++; }
     ANGLE_INLINE void incrementSize() { mSize++; }
     ANGLE_INLINE void missAndIncrementSize()
     {
         mMissCount++;
         mSize++;
     }
+    ANGLE_INLINE void decrementSize(uint32_t count)
+    {
+        ASSERT(mSize >= count);
+        mSize -= count;
+    }
     ANGLE_INLINE void accumulate(const CacheStats &stats)
     {
         mHitCount += stats.mHitCount;
         mMissCount += stats.mMissCount;
+        mStallCount += stats.mStallCount;
         mSize += stats.mSize;
     }
 
     uint32_t getHitCount() const { return mHitCount; }
     uint32_t getMissCount() const { return mMissCount; }
+    uint32_t getStallCount() const { return mStallCount; }
 
     ANGLE_INLINE double getHitRatio() const
     {
@@ -1682,26 +1846,30 @@ class CacheStats final : angle::NonCopyable
 
     void reset()
     {
-        mHitCount  = 0;
-        mMissCount = 0;
-        mSize      = 0;
+        mHitCount   = 0;
+        mMissCount  = 0;
+        mStallCount = 0;
+        mSize       = 0;
     }
 
     void resetHitAndMissCount()
     {
-        mHitCount  = 0;
-        mMissCount = 0;
+        mHitCount   = 0;
+        mMissCount  = 0;
+        mStallCount = 0;
     }
 
     void accumulateCacheStats(VulkanCacheType cacheType, const CacheStats &cacheStats)
     {
         mHitCount += cacheStats.getHitCount();
         mMissCount += cacheStats.getMissCount();
+        mStallCount += cacheStats.getStallCount();
     }
 
   private:
     uint32_t mHitCount;
     uint32_t mMissCount;
+    uint32_t mStallCount;
     uint32_t mSize;
 };
 
@@ -1774,9 +1942,9 @@ class RenderPassCache final : angle::NonCopyable
 
     // Use a two-layer caching scheme. The top level matches the "compatible" RenderPass elements.
     // The second layer caches the attachment load/store ops and initial/final layout.
-    // Switch to `std::unordered_map` to retain pointer stability.
-    using InnerCache = std::unordered_map<vk::AttachmentOpsArray, vk::RenderPassHelper>;
-    using OuterCache = std::unordered_map<vk::RenderPassDesc, InnerCache>;
+    // Node based, to retain pointer stability.
+    using InnerCache = angle::NodeHashMap<vk::AttachmentOpsArray, vk::RenderPassHelper>;
+    using OuterCache = angle::NodeHashMap<vk::RenderPassDesc, InnerCache>;
 
     OuterCache mPayload;
     CacheStats mCompatibleRenderPassCacheStats;
@@ -1850,10 +2018,17 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
             *descPtrOut  = &item->first;
             *pipelineOut = &item->second;
             mCacheStats.hit();
+
+            // A pipeline that is being warmed up on a worker thread has nothing to fall back to.
+            // Warming it up again doesn't need to wait for it.
+            if (ANGLE_UNLIKELY(item->second.hasPendingAsyncPipeline() && !item->second.valid()) &&
+                source != PipelineSource::WarmUp)
+            {
+                return waitForWarmUpPipeline(contextVk, source, &item->second);
+            }
             return angle::Result::Continue;
         }
 
-        mCacheStats.missAndIncrementSize();
         return insertPipeline(contextVk, pipelineCache, compatibleRenderPass, pipelineLayout,
                               activeAttribLocationsMask, programAttribsTypeMask, missingOutputsMask,
                               shaders, specConsts, source, desc, descPtrOut, pipelineOut);
@@ -1862,7 +2037,21 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
     // Helper for VulkanPipelineCachePerf that resets the object without destroying any object.
     void reset();
 
+    // Used to save the pipeline descriptions in the program binary, so that the pipelines can be
+    // warmed up when the binary is loaded.
+    template <typename Callback>
+    void forEachPipelineDesc(Callback callback) const
+    {
+        for (const auto &item : mPayload)
+        {
+            callback(item.first);
+        }
+    }
+
   private:
+    angle::Result waitForWarmUpPipeline(ContextVk *contextVk,
+                                        PipelineSource source,
+                                        vk::PipelineHelper *pipeline);
     angle::Result insertPipeline(ContextVk *contextVk,
                                  PipelineCacheAccess *pipelineCache,
                                  const vk::RenderPass &compatibleRenderPass,
@@ -1877,7 +2066,11 @@ class GraphicsPipelineCache final : public HasCacheStats<VulkanCacheType::Graphi
                                  const vk::GraphicsPipelineDesc **descPtrOut,
                                  vk::PipelineHelper **pipelineOut);
 
-    std::unordered_map<vk::GraphicsPipelineDesc, vk::PipelineHelper> mPayload;
+    // Node based, since the descs and pipelines are referenced by pointer.
+    angle::NodeHashMap<vk::GraphicsPipelineDesc, vk::PipelineHelper> mPayload;
+
+    // Used to create unoptimized pipelines without going through the pipeline cache.
+    vk::PipelineCache mNullPipelineCache;
 };
 
 class DescriptorSetLayoutCache final : angle::NonCopyable
@@ -1928,7 +2121,8 @@ class SamplerCache final : public HasCacheStats<VulkanCacheType::Sampler>
                              vk::SamplerBinding *samplerOut);
 
   private:
-    std::unordered_map<vk::SamplerDesc, vk::RefCountedSampler> mPayload;
+    // Node based, since the sampler bindings reference the samplers by pointer.
+    angle::NodeHashMap<vk::SamplerDesc, vk::RefCountedSampler> mPayload;
 };
 
 // YuvConversion Cache
@@ -1972,6 +2166,8 @@ class DescriptorSetCache final : angle::NonCopyable
 
     void resetCache() { mPayload.clear(); }
 
+    size_t getCacheEntryCount() const { return mPayload.size(); }
+
     ANGLE_INLINE bool getDescriptorSet(const vk::DescriptorSetDesc &desc,
                                        VkDescriptorSet *descriptorSet)
     {
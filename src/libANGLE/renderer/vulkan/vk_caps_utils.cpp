@@ -310,6 +310,12 @@ void RendererVk::ensureCapsInitialized() const
         mNativeLimitations.emulatedEtc1 = true;
     }
 
+    // ASTC LDR formats that aren't natively supported are decoded to RGBA8 on upload.
+    if (mPhysicalDeviceFeatures.textureCompressionASTC_LDR != VK_TRUE)
+    {
+        mNativeLimitations.emulatedAstc = true;
+    }
+
     // Vulkan doesn't support ASTC 3D block textures, which are required by
     // GL_OES_texture_compression_astc.
     mNativeExtensions.textureCompressionAstcOES = false;
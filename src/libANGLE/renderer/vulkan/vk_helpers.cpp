@@ -880,6 +880,84 @@ bool IsClearOfAllChannels(UpdateSource updateSource)
            updateSource == UpdateSource::ClearAfterInvalidate;
 }
 
+bool AreRangesOverlapping(int64_t startA, int64_t sizeA, int64_t startB, int64_t sizeB)
+{
+    return startA < startB + sizeB && startB < startA + sizeA;
+}
+
+// Uploads smaller than this many texels are converted on the CPU, as the conversion is cheaper than
+// the dispatch and the barrier that the GPU path requires.
+constexpr size_t kMinTexelCountForComputeUploadConversion = 128 * 128;
+
+// Whether the texture upload can be converted from the format of the client data to
+// |storageFormat| with ConvertVertex.comp.  This is the case when RGBA is used as fallback for RGB,
+// and the client data is tightly packed RGB in the intended format, so that an alpha channel is all
+// that needs to be added.  Other conversions, such as to BGRX or packed formats, stay on the CPU.
+bool CanConvertTextureUploadWithCompute(RendererVk *renderer,
+                                        const gl::InternalFormat &inputFormatInfo,
+                                        const angle::Format &intendedFormat,
+                                        const angle::Format &storageFormat,
+                                        const gl::Extents &glExtents,
+                                        GLuint inputRowPitch,
+                                        GLuint inputDepthPitch)
+{
+    if (!renderer->getFeatures().convertRgbTextureUploadsWithCompute.enabled)
+    {
+        return false;
+    }
+
+    const size_t texelCount =
+        static_cast<size_t>(glExtents.width) * glExtents.height * glExtents.depth;
+    if (texelCount < kMinTexelCountForComputeUploadConversion)
+    {
+        return false;
+    }
+
+    if (intendedFormat.channelCount != 3 || storageFormat.channelCount != 4 ||
+        intendedFormat.isBlock || intendedFormat.isYUV ||
+        inputFormatInfo.sizedInternalFormat != intendedFormat.glInternalFormat)
+    {
+        return false;
+    }
+
+    // The storage format must be the RGBA format with the same component type as the client data,
+    // which rules out BGRA fallbacks as well.
+    const GLenum rgbaFormat = inputFormatInfo.format == GL_RGB_INTEGER ? GL_RGBA_INTEGER : GL_RGBA;
+    if (gl::GetInternalFormatInfo(rgbaFormat, inputFormatInfo.type).sizedInternalFormat !=
+        storageFormat.glInternalFormat)
+    {
+        return false;
+    }
+
+    // ConvertVertex.comp reads the source as a flat array of texels.
+    const GLuint packedRowPitch = glExtents.width * intendedFormat.pixelBytes;
+    return inputRowPitch == packedRowPitch &&
+           (glExtents.depth == 1 || inputDepthPitch == packedRowPitch * glExtents.height);
+}
+
+// Whether |copy| writes to any texel written by |copies|.  All copies are to the same level.
+bool IsBufferImageCopyOverlapping(const VkBufferImageCopy &copy,
+                                  const std::vector<VkBufferImageCopy> &copies)
+{
+    for (const VkBufferImageCopy &other : copies)
+    {
+        if (AreRangesOverlapping(copy.imageSubresource.baseArrayLayer,
+                                 copy.imageSubresource.layerCount,
+                                 other.imageSubresource.baseArrayLayer,
+                                 other.imageSubresource.layerCount) &&
+            AreRangesOverlapping(copy.imageOffset.x, copy.imageExtent.width, other.imageOffset.x,
+                                 other.imageExtent.width) &&
+            AreRangesOverlapping(copy.imageOffset.y, copy.imageExtent.height, other.imageOffset.y,
+                                 other.imageExtent.height) &&
+            AreRangesOverlapping(copy.imageOffset.z, copy.imageExtent.depth, other.imageOffset.z,
+                                 other.imageExtent.depth))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 angle::Result InitDynamicDescriptorPool(Context *context,
                                         const DescriptorSetLayoutDesc &descriptorSetLayoutDesc,
                                         VkDescriptorSetLayout descriptorSetLayout,
@@ -929,6 +1007,106 @@ angle::Result InitDynamicDescriptorPool(Context *context,
 
     return angle::Result::Continue;
 }
+
+// Large render passes are split into ranges to be replayed in parallel.  This is only done for
+// ANGLE's custom command buffers, which are otherwise replayed inline in the primary command
+// buffer.
+template <typename CommandBufferT>
+bool SplitSubpassesIntoCommandRanges(const CommandBufferT *subpassCommandBuffers,
+                                     size_t subpassCount,
+                                     std::vector<priv::CommandRange> *subpassRangesOut)
+{
+    return false;
+}
+
+template <>
+ANGLE_MAYBE_UNUSED bool SplitSubpassesIntoCommandRanges<priv::SecondaryCommandBuffer>(
+    const priv::SecondaryCommandBuffer *subpassCommandBuffers,
+    size_t subpassCount,
+    std::vector<priv::CommandRange> *subpassRangesOut)
+{
+    // State set in a subpass carries over to the next one.
+    priv::CommandRangeStateTracker stateTracker;
+    for (size_t subpass = 0; subpass < subpassCount; ++subpass)
+    {
+        if (!subpassCommandBuffers[subpass].splitIntoCommandRanges(
+                ParallelCommandReplayer::kDrawsPerRange, &stateTracker, &subpassRangesOut[subpass]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename CommandBufferT>
+angle::Result ReplayCommandRanges(Context *context,
+                                  ParallelCommandReplayer *replayer,
+                                  const CommandBufferT &commandBuffer,
+                                  const std::vector<priv::CommandRange> &ranges,
+                                  const VkCommandBufferInheritanceInfo &inheritanceInfo,
+                                  PrimaryCommandBuffer *primary)
+{
+    UNREACHABLE();
+    return angle::Result::Stop;
+}
+
+template <>
+ANGLE_MAYBE_UNUSED angle::Result ReplayCommandRanges<priv::SecondaryCommandBuffer>(
+    Context *context,
+    ParallelCommandReplayer *replayer,
+    const priv::SecondaryCommandBuffer &commandBuffer,
+    const std::vector<priv::CommandRange> &ranges,
+    const VkCommandBufferInheritanceInfo &inheritanceInfo,
+    PrimaryCommandBuffer *primary)
+{
+    return replayer->replayCommandRanges(context, commandBuffer, ranges, inheritanceInfo, primary);
+}
+
+VkResult ReplayCommandRange(const priv::SecondaryCommandBuffer &commands,
+                            const priv::CommandRange &range,
+                            const VkCommandBufferBeginInfo &beginInfo,
+                            priv::CommandBuffer *commandBuffer)
+{
+    VkResult result = commandBuffer->begin(beginInfo);
+    if (result != VK_SUCCESS)
+    {
+        return result;
+    }
+    commands.executeCommandRange(commandBuffer->getHandle(), range);
+    return commandBuffer->end();
+}
+
+// Replays a range of a render pass on a worker thread.  vk::Context is not thread-safe, so the
+// result is stored for the thread that waits on the task to process.
+class ReplayCommandRangeTask final : public angle::Closure
+{
+  public:
+    ReplayCommandRangeTask(const priv::SecondaryCommandBuffer &commands,
+                           const priv::CommandRange &range,
+                           const VkCommandBufferBeginInfo &beginInfo,
+                           priv::CommandBuffer *commandBuffer)
+        : mCommands(commands),
+          mRange(range),
+          mBeginInfo(beginInfo),
+          mCommandBuffer(commandBuffer),
+          mResult(VK_SUCCESS)
+    {}
+
+    void operator()() override
+    {
+        ANGLE_TRACE_EVENT0("gpu.angle", "ReplayCommandRangeTask");
+        mResult = ReplayCommandRange(mCommands, mRange, mBeginInfo, mCommandBuffer);
+    }
+
+    VkResult getResult() const { return mResult; }
+
+  private:
+    const priv::SecondaryCommandBuffer &mCommands;
+    const priv::CommandRange &mRange;
+    const VkCommandBufferBeginInfo mBeginInfo;
+    priv::CommandBuffer *mCommandBuffer;
+    VkResult mResult;
+};
 }  // anonymous namespace
 
 // This is an arbitrary max. We can change this later if necessary.
@@ -1559,6 +1737,44 @@ void OutsideRenderPassCommandBufferHelper::imageWrite(ContextVk *contextVk,
     imageWriteImpl(contextVk, level, layerStart, layerCount, aspectFlags, imageLayout, image);
 }
 
+void OutsideRenderPassCommandBufferHelper::recordImageReadBarrier(ContextVk *contextVk,
+                                                                  VkImageAspectFlags aspectFlags,
+                                                                  ImageLayout imageLayout,
+                                                                  ImageHelper *image)
+{
+    // If the image is already used by previous commands in this command buffer, the barrier must
+    // be placed between those commands and the next.  Otherwise, there is no other access to the
+    // image between the start of the command buffer and the upcoming command, so the barrier can
+    // be hoisted to before the command buffer.
+    if (usesImage(*image))
+    {
+        image->recordReadBarrier(contextVk, aspectFlags, imageLayout, &mCommandBuffer);
+    }
+    else
+    {
+        bool needLayoutTransition = false;
+        imageReadImpl(contextVk, aspectFlags, imageLayout, image, &needLayoutTransition);
+    }
+    image->retainCommands(mID, &mResourceUseList);
+}
+
+void OutsideRenderPassCommandBufferHelper::recordImageWriteBarrier(ContextVk *contextVk,
+                                                                   VkImageAspectFlags aspectFlags,
+                                                                   ImageLayout imageLayout,
+                                                                   ImageHelper *image)
+{
+    // See comment in recordImageReadBarrier.
+    if (usesImage(*image))
+    {
+        image->recordWriteBarrier(contextVk, aspectFlags, imageLayout, &mCommandBuffer);
+    }
+    else
+    {
+        updateImageLayoutAndBarrier(contextVk, image, aspectFlags, imageLayout);
+    }
+    image->retainCommands(mID, &mResourceUseList);
+}
+
 angle::Result OutsideRenderPassCommandBufferHelper::flushToPrimary(Context *context,
                                                                    PrimaryCommandBuffer *primary)
 {
@@ -1584,12 +1800,213 @@ void OutsideRenderPassCommandBufferHelper::addCommandDiagnostics(ContextVk *cont
     contextVk->addCommandBufferDiagnostics(out.str());
 }
 
+// ReplayCommandBufferList implementation.
+ReplayCommandBufferList::ReplayCommandBufferList() = default;
+
+ReplayCommandBufferList::~ReplayCommandBufferList()
+{
+    ASSERT(empty());
+}
+
+ReplayCommandBufferList::ReplayCommandBufferList(ReplayCommandBufferList &&other)
+{
+    *this = std::move(other);
+}
+
+ReplayCommandBufferList &ReplayCommandBufferList::operator=(ReplayCommandBufferList &&other)
+{
+    std::swap(mCommandPools, other.mCommandPools);
+    std::swap(mCommandBuffers, other.mCommandBuffers);
+    return *this;
+}
+
+void ReplayCommandBufferList::destroy(VkDevice device)
+{
+    // Destroying the pools frees the command buffers allocated from them.
+    for (priv::CommandBuffer &commandBuffer : mCommandBuffers)
+    {
+        commandBuffer.destroy(device);
+    }
+    for (CommandPool &commandPool : mCommandPools)
+    {
+        commandPool.destroy(device);
+    }
+    mCommandBuffers.clear();
+    mCommandPools.clear();
+}
+
+VkResult ReplayCommandBufferList::reset(VkDevice device)
+{
+    for (CommandPool &commandPool : mCommandPools)
+    {
+        VkResult result = commandPool.reset(device, 0);
+        if (result != VK_SUCCESS)
+        {
+            return result;
+        }
+    }
+    return VK_SUCCESS;
+}
+
+void ReplayCommandBufferList::push(CommandPool &&commandPool, priv::CommandBuffer &&commandBuffer)
+{
+    mCommandPools.push_back(std::move(commandPool));
+    mCommandBuffers.push_back(std::move(commandBuffer));
+}
+
+void ReplayCommandBufferList::popInto(ReplayCommandBufferList *other)
+{
+    ASSERT(!empty());
+    other->push(std::move(mCommandPools.back()), std::move(mCommandBuffers.back()));
+    mCommandPools.pop_back();
+    mCommandBuffers.pop_back();
+}
+
+// ParallelCommandReplayer implementation.
+ParallelCommandReplayer::ParallelCommandReplayer() : mQueueFamilyIndex(0) {}
+
+ParallelCommandReplayer::~ParallelCommandReplayer() = default;
+
+void ParallelCommandReplayer::init(uint32_t queueFamilyIndex)
+{
+    mQueueFamilyIndex = queueFamilyIndex;
+
+    // There is no point in replaying in parallel without worker threads.
+    mWorkerThreadPool = angle::WorkerThreadPool::Create(true);
+    if (!mWorkerThreadPool->isAsync())
+    {
+        mWorkerThreadPool.reset();
+    }
+}
+
+void ParallelCommandReplayer::destroy(VkDevice device)
+{
+    mFreeCommandBuffers.destroy(device);
+    mInFlightCommandBuffers.destroy(device);
+    mWorkerThreadPool.reset();
+}
+
+angle::Result ParallelCommandReplayer::acquireCommandBuffer(Context *context)
+{
+    if (!mFreeCommandBuffers.empty())
+    {
+        mFreeCommandBuffers.popInto(&mInFlightCommandBuffers);
+        return angle::Result::Continue;
+    }
+
+    VkDevice device = context->getDevice();
+
+    VkCommandPoolCreateInfo poolInfo = {};
+    poolInfo.sType                   = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
+    poolInfo.queueFamilyIndex        = mQueueFamilyIndex;
+
+    CommandPool commandPool;
+    ANGLE_VK_TRY(context, commandPool.init(device, poolInfo));
+
+    VkCommandBufferAllocateInfo allocInfo = {};
+    allocInfo.sType                       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+    allocInfo.commandPool                 = commandPool.getHandle();
+    allocInfo.level                       = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+    allocInfo.commandBufferCount          = 1;
+
+    priv::CommandBuffer commandBuffer;
+    VkResult result = commandBuffer.init(device, allocInfo);
+    if (result != VK_SUCCESS)
+    {
+        commandPool.destroy(device);
+        ANGLE_VK_TRY(context, result);
+    }
+
+    mInFlightCommandBuffers.push(std::move(commandPool), std::move(commandBuffer));
+    return angle::Result::Continue;
+}
+
+angle::Result ParallelCommandReplayer::replayCommandRanges(
+    Context *context,
+    const priv::SecondaryCommandBuffer &commandBuffer,
+    const std::vector<priv::CommandRange> &ranges,
+    const VkCommandBufferInheritanceInfo &inheritanceInfo,
+    PrimaryCommandBuffer *primary)
+{
+    ANGLE_TRACE_EVENT0("gpu.angle", "ParallelCommandReplayer::replayCommandRanges");
+    ASSERT(valid() && ranges.size() > 1);
+
+    // Acquire all command buffers before posting the tasks, as the tasks hold pointers to them.
+    const size_t firstCommandBuffer = mInFlightCommandBuffers.size();
+    for (size_t rangeIndex = 0; rangeIndex < ranges.size(); ++rangeIndex)
+    {
+        ANGLE_TRY(acquireCommandBuffer(context));
+    }
+    priv::CommandBuffer *commandBuffers =
+        mInFlightCommandBuffers.getCommandBuffers(firstCommandBuffer);
+
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType                    = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT |
+                      VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+    // Replay the first range on this thread while the worker threads replay the rest.
+    std::vector<std::shared_ptr<ReplayCommandRangeTask>> tasks;
+    std::vector<std::shared_ptr<angle::WaitableEvent>> waitableEvents;
+    for (size_t rangeIndex = 1; rangeIndex < ranges.size(); ++rangeIndex)
+    {
+        tasks.push_back(std::make_shared<ReplayCommandRangeTask>(
+            commandBuffer, ranges[rangeIndex], beginInfo, &commandBuffers[rangeIndex]));
+        waitableEvents.push_back(angle::WorkerThreadPool::PostWorkerTask(
+            mWorkerThreadPool, tasks.back(), angle::WorkerTaskPriority::High));
+    }
+
+    VkResult result = ReplayCommandRange(commandBuffer, ranges[0], beginInfo, &commandBuffers[0]);
+
+    // Wait for all tasks before handling errors, since they reference the command buffers.
+    for (std::shared_ptr<angle::WaitableEvent> &waitableEvent : waitableEvents)
+    {
+        waitableEvent->wait();
+    }
+
+    ANGLE_VK_TRY(context, result);
+    for (const std::shared_ptr<ReplayCommandRangeTask> &task : tasks)
+    {
+        ANGLE_VK_TRY(context, task->getResult());
+    }
+
+    primary->executeCommands(static_cast<uint32_t>(ranges.size()), commandBuffers);
+    return angle::Result::Continue;
+}
+
+void ParallelCommandReplayer::releaseInFlightCommandBuffers(
+    ReplayCommandBufferList *commandBuffersOut)
+{
+    ASSERT(commandBuffersOut->empty());
+    *commandBuffersOut = std::move(mInFlightCommandBuffers);
+}
+
+angle::Result ParallelCommandReplayer::recycleCommandBuffers(
+    Context *context,
+    ReplayCommandBufferList *commandBuffers)
+{
+    if (commandBuffers->empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    ANGLE_VK_TRY(context, commandBuffers->reset(context->getDevice()));
+    while (!commandBuffers->empty())
+    {
+        commandBuffers->popInto(&mFreeCommandBuffers);
+    }
+    return angle::Result::Continue;
+}
+
 // RenderPassCommandBufferHelper implementation.
 RenderPassCommandBufferHelper::RenderPassCommandBufferHelper()
     : mCurrentSubpass(0),
       mCounter(0),
       mClearValues{},
       mRenderPassStarted(false),
+      mHasDeferredGLMemoryBarrier(false),
       mTransformFeedbackCounterBuffers{},
       mTransformFeedbackCounterBufferOffsets{},
       mValidTransformFeedbackBufferCount(0),
@@ -1603,7 +2020,7 @@ RenderPassCommandBufferHelper::RenderPassCommandBufferHelper()
 
 RenderPassCommandBufferHelper::~RenderPassCommandBufferHelper()
 {
-    mFramebuffer.setHandle(VK_NULL_HANDLE);
+    mFramebuffer.reset();
 }
 
 angle::Result RenderPassCommandBufferHelper::initialize(Context *context, CommandPool *commandPool)
@@ -1638,11 +2055,14 @@ angle::Result RenderPassCommandBufferHelper::reset(Context *context)
     mRebindTransformFeedbackBuffers    = false;
     mHasShaderStorageOutput            = false;
     mHasGLMemoryBarrierIssued          = false;
+    mHasDeferredGLMemoryBarrier        = false;
     mPreviousSubpassesCmdCount         = 0;
     mColorAttachmentsCount             = PackedAttachmentCount(0);
     mDepthStencilAttachmentIndex       = kAttachmentIndexInvalid;
     mRenderPassImagesWithLayoutTransition.clear();
     mImageOptimizeForPresent = nullptr;
+    // The render pass is ended before it's reset, which records any queued clears.
+    ASSERT(!hasPendingClearAttachments());
 
     // Reset and re-initialize the command buffers
     for (uint32_t subpass = 0; subpass <= mCurrentSubpass; ++subpass)
@@ -2088,7 +2508,7 @@ void RenderPassCommandBufferHelper::finalizeDepthStencilImageLayoutAndLoadStore(
 
 angle::Result RenderPassCommandBufferHelper::beginRenderPass(
     ContextVk *contextVk,
-    const Framebuffer &framebuffer,
+    const MaybeImagelessFramebuffer &framebuffer,
     const gl::Rectangle &renderArea,
     const RenderPassDesc &renderPassDesc,
     const AttachmentOpsArray &renderPassAttachmentOps,
@@ -2103,10 +2523,10 @@ angle::Result RenderPassCommandBufferHelper::beginRenderPass(
     mAttachmentOps               = renderPassAttachmentOps;
     mDepthStencilAttachmentIndex = depthStencilAttachmentIndex;
     mColorAttachmentsCount       = colorAttachmentCount;
-    mFramebuffer.setHandle(framebuffer.getHandle());
-    mRenderArea       = renderArea;
-    mClearValues      = clearValues;
-    *commandBufferOut = &getCommandBuffer();
+    mFramebuffer                 = framebuffer;
+    mRenderArea                  = renderArea;
+    mClearValues                 = clearValues;
+    *commandBufferOut            = &getCommandBuffer();
 
     mRenderPassStarted = true;
     mCounter++;
@@ -2117,8 +2537,11 @@ angle::Result RenderPassCommandBufferHelper::beginRenderPass(
 angle::Result RenderPassCommandBufferHelper::beginRenderPassCommandBuffer(ContextVk *contextVk)
 {
     VkCommandBufferInheritanceInfo inheritanceInfo = {};
+    // The image views of imageless framebuffers are only known when the render pass begins, so
+    // they aren't given to the secondary command buffers.
     ANGLE_TRY(RenderPassCommandBuffer::InitializeRenderPassInheritanceInfo(
-        contextVk, mFramebuffer, mRenderPassDesc, &inheritanceInfo));
+        contextVk, mFramebuffer.isImageless() ? VK_NULL_HANDLE : mFramebuffer.getHandle(),
+        mRenderPassDesc, &inheritanceInfo));
     inheritanceInfo.subpass = mCurrentSubpass;
 
     return getCommandBuffer().begin(contextVk, inheritanceInfo);
@@ -2267,7 +2690,8 @@ void RenderPassCommandBufferHelper::invalidateRenderPassStencilAttachment(
 
 angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
                                                             PrimaryCommandBuffer *primary,
-                                                            const RenderPass *renderPass)
+                                                            const RenderPass *renderPass,
+                                                            ParallelCommandReplayer *replayer)
 {
     ANGLE_TRACE_EVENT0("gpu.angle", "RenderPassCommandBufferHelper::flushToPrimary");
     ASSERT(mRenderPassStarted);
@@ -2288,19 +2712,60 @@ angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
     beginInfo.clearValueCount          = static_cast<uint32_t>(mRenderPassDesc.attachmentCount());
     beginInfo.pClearValues             = mClearValues.data();
 
+    VkRenderPassAttachmentBeginInfoKHR attachmentBeginInfo = {};
+    if (mFramebuffer.isImageless())
+    {
+        const FramebufferAttachmentsVector<VkImageView> &imageViews = mFramebuffer.getImageViews();
+
+        attachmentBeginInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO_KHR;
+        attachmentBeginInfo.attachmentCount = static_cast<uint32_t>(imageViews.size());
+        attachmentBeginInfo.pAttachments    = imageViews.data();
+
+        AddToPNextChain(&beginInfo, &attachmentBeginInfo);
+    }
+
     // Run commands inside the RenderPass.
     constexpr VkSubpassContents kSubpassContents =
         RenderPassCommandBuffer::ExecutesInline() ? VK_SUBPASS_CONTENTS_INLINE
                                                   : VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS;
 
-    primary->beginRenderPass(beginInfo, kSubpassContents);
+    // Subpasses that are split into multiple ranges are replayed in parallel into Vulkan secondary
+    // command buffers.
+    std::array<std::vector<priv::CommandRange>, kMaxSubpassCount> subpassRanges;
+    const bool replayInParallel =
+        replayer != nullptr && replayer->valid() &&
+        SplitSubpassesIntoCommandRanges(mCommandBuffers.data(), mCurrentSubpass + 1,
+                                        subpassRanges.data());
+    auto getSubpassContents = [&](uint32_t subpass) {
+        return replayInParallel && subpassRanges[subpass].size() > 1
+                   ? VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS
+                   : kSubpassContents;
+    };
+
+    VkCommandBufferInheritanceInfo inheritanceInfo = {};
+    inheritanceInfo.sType       = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.renderPass  = renderPass->getHandle();
+    inheritanceInfo.framebuffer =
+        mFramebuffer.isImageless() ? VK_NULL_HANDLE : mFramebuffer.getHandle();
+
+    primary->beginRenderPass(beginInfo, getSubpassContents(0));
     for (uint32_t subpass = 0; subpass <= mCurrentSubpass; ++subpass)
     {
         if (subpass > 0)
         {
-            primary->nextSubpass(kSubpassContents);
+            primary->nextSubpass(getSubpassContents(subpass));
+        }
+
+        if (getSubpassContents(subpass) != kSubpassContents)
+        {
+            inheritanceInfo.subpass = subpass;
+            ANGLE_TRY(ReplayCommandRanges(context, replayer, mCommandBuffers[subpass],
+                                          subpassRanges[subpass], inheritanceInfo, primary));
+        }
+        else
+        {
+            mCommandBuffers[subpass].executeCommands(primary);
         }
-        mCommandBuffers[subpass].executeCommands(primary);
     }
     primary->endRenderPass();
 
@@ -2308,12 +2773,13 @@ angle::Result RenderPassCommandBufferHelper::flushToPrimary(Context *context,
     return reset(context);
 }
 
-void RenderPassCommandBufferHelper::updateRenderPassForResolve(ContextVk *contextVk,
-                                                               Framebuffer *newFramebuffer,
-                                                               const RenderPassDesc &renderPassDesc)
+void RenderPassCommandBufferHelper::updateRenderPassForResolve(
+    ContextVk *contextVk,
+    const MaybeImagelessFramebuffer &newFramebuffer,
+    const RenderPassDesc &renderPassDesc)
 {
-    ASSERT(newFramebuffer);
-    mFramebuffer.setHandle(newFramebuffer->getHandle());
+    ASSERT(newFramebuffer.valid());
+    mFramebuffer    = newFramebuffer;
     mRenderPassDesc = renderPassDesc;
 }
 
@@ -2371,6 +2837,49 @@ void RenderPassCommandBufferHelper::updateRenderPassDepthStencilClear(
     mClearValues.storeNoDepthStencil(mDepthStencilAttachmentIndex, combinedClearValue);
 }
 
+void RenderPassCommandBufferHelper::queueClearAttachments(
+    const gl::AttachmentVector<VkClearAttachment> &attachments,
+    const VkClearRect &rect)
+{
+    ASSERT(mRenderPassStarted);
+    ASSERT(!attachments.empty());
+
+    bool matchesPendingClears = attachments.size() == mPendingClearAttachments.size();
+    for (size_t index = 0; matchesPendingClears && index < attachments.size(); ++index)
+    {
+        const VkClearAttachment &attachment        = attachments[index];
+        const VkClearAttachment &pendingAttachment = mPendingClearAttachments[index];
+        matchesPendingClears =
+            attachment.aspectMask == pendingAttachment.aspectMask &&
+            attachment.colorAttachment == pendingAttachment.colorAttachment &&
+            memcmp(&attachment.clearValue, &pendingAttachment.clearValue, sizeof(VkClearValue)) ==
+                0;
+    }
+
+    if (!matchesPendingClears)
+    {
+        flushPendingClearAttachments();
+        mPendingClearAttachments = attachments;
+    }
+
+    mPendingClearRects.push_back(rect);
+}
+
+void RenderPassCommandBufferHelper::flushPendingClearAttachments()
+{
+    if (mPendingClearRects.empty())
+    {
+        return;
+    }
+
+    mCommandBuffers[mCurrentSubpass].clearAttachments(
+        static_cast<uint32_t>(mPendingClearAttachments.size()), mPendingClearAttachments.data(),
+        static_cast<uint32_t>(mPendingClearRects.size()), mPendingClearRects.data());
+
+    mPendingClearAttachments.clear();
+    mPendingClearRects.clear();
+}
+
 void RenderPassCommandBufferHelper::growRenderArea(ContextVk *contextVk,
                                                    const gl::Rectangle &newRenderArea)
 {
@@ -2713,6 +3222,11 @@ void DynamicBuffer::release(RendererVk *renderer)
     }
 }
 
+void DynamicBuffer::releaseFreeBuffers(RendererVk *renderer)
+{
+    ReleaseBufferListToRenderer(renderer, &mBufferFreeList);
+}
+
 void DynamicBuffer::releaseInFlightBuffersToResourceUseList(ContextVk *contextVk)
 {
     ResourceUseList resourceUseList;
@@ -2822,7 +3336,8 @@ BufferPool::BufferPool()
       mSize(0),
       mMemoryTypeIndex(0),
       mTotalMemorySize(0),
-      mNumberOfNewBuffersNeededSinceLastPrune(0)
+      mNumberOfNewBuffersNeededSinceLastPrune(0),
+      mEvacuatingBlockCount(0)
 {}
 
 BufferPool::BufferPool(BufferPool &&other)
@@ -2830,7 +3345,8 @@ BufferPool::BufferPool(BufferPool &&other)
       mUsage(other.mUsage),
       mHostVisible(other.mHostVisible),
       mSize(other.mSize),
-      mMemoryTypeIndex(other.mMemoryTypeIndex)
+      mMemoryTypeIndex(other.mMemoryTypeIndex),
+      mEvacuatingBlockCount(0)
 {}
 
 void BufferPool::initWithFlags(RendererVk *renderer,
@@ -2883,6 +3399,7 @@ void BufferPool::pruneEmptyBuffers(RendererVk *renderer)
             }
             else
             {
+                block->setEvacuating(false);
                 mEmptyBufferBlocks.push_back(std::move(block));
             }
             needsCompact = true;
@@ -2921,6 +3438,66 @@ void BufferPool::pruneEmptyBuffers(RendererVk *renderer)
         mEmptyBufferBlocks.pop_back();
     }
     mNumberOfNewBuffersNeededSinceLastPrune = 0;
+
+    updateEvacuatingBlocks();
+}
+
+void BufferPool::updateEvacuatingBlocks()
+{
+    // Blocks that are used less than 1/kEvacuationUsageDivisor are evacuated if the pool as a whole
+    // is used less than 1/kFragmentationUsageDivisor.
+    constexpr VkDeviceSize kEvacuationUsageDivisor    = 4;
+    constexpr VkDeviceSize kFragmentationUsageDivisor = 2;
+
+    mEvacuatingBlockCount = 0;
+
+    std::vector<std::pair<VkDeviceSize, BufferBlock *>> blockUsedSizes;
+    blockUsedSizes.reserve(mBufferBlocks.size());
+    VkDeviceSize totalUsedSize   = 0;
+    VkDeviceSize totalMemorySize = 0;
+    for (std::unique_ptr<BufferBlock> &block : mBufferBlocks)
+    {
+        block->setEvacuating(false);
+
+        vma::StatInfo statInfo;
+        block->calculateStats(&statInfo);
+        blockUsedSizes.emplace_back(statInfo.usedBytes, block.get());
+        totalUsedSize += statInfo.usedBytes;
+        totalMemorySize += block->getMemorySize();
+    }
+
+    if (blockUsedSizes.size() < 2 || totalUsedSize * kFragmentationUsageDivisor > totalMemorySize)
+    {
+        return;
+    }
+
+    // Evacuate the most sparsely used blocks first, as long as their live data still fits in the
+    // free space of the blocks that are kept.
+    std::sort(blockUsedSizes.begin(), blockUsedSizes.end(),
+              [](const std::pair<VkDeviceSize, BufferBlock *> &lhs,
+                 const std::pair<VkDeviceSize, BufferBlock *> &rhs) {
+                  return static_cast<double>(lhs.first) / lhs.second->getMemorySize() <
+                         static_cast<double>(rhs.first) / rhs.second->getMemorySize();
+              });
+
+    VkDeviceSize evacuatedUsedSize = 0;
+    VkDeviceSize keptFreeSize      = totalMemorySize - totalUsedSize;
+    for (const std::pair<VkDeviceSize, BufferBlock *> &blockUsedSize : blockUsedSizes)
+    {
+        const VkDeviceSize usedSize = blockUsedSize.first;
+        BufferBlock *block          = blockUsedSize.second;
+        const VkDeviceSize freeSize = block->getMemorySize() - usedSize;
+        if (usedSize * kEvacuationUsageDivisor > block->getMemorySize() ||
+            evacuatedUsedSize + usedSize > keptFreeSize - freeSize)
+        {
+            break;
+        }
+
+        block->setEvacuating(true);
+        evacuatedUsedSize += usedSize;
+        keptFreeSize -= freeSize;
+        ++mEvacuatingBlockCount;
+    }
 }
 
 angle::Result BufferPool::allocateNewBuffer(Context *context, VkDeviceSize sizeInBytes)
@@ -3048,6 +3625,13 @@ angle::Result BufferPool::allocateBuffer(Context *context,
             continue;
         }
 
+        if (block->isEvacuating())
+        {
+            // Don't add to a block that is being emptied for defragmentation.
+            ++iter;
+            continue;
+        }
+
         if (block->allocate(alignedSize, alignment, &offset) == VK_SUCCESS)
         {
             suballocation->init(context->getDevice(), block.get(), offset, alignedSize);
@@ -3145,7 +3729,7 @@ void BufferPool::addStats(std::ostringstream *out) const
 }
 
 // DescriptorPoolHelper implementation.
-DescriptorPoolHelper::DescriptorPoolHelper() : mFreeDescriptorSets(0) {}
+DescriptorPoolHelper::DescriptorPoolHelper() : mMaxSets(0), mFreeDescriptorSets(0) {}
 
 DescriptorPoolHelper::~DescriptorPoolHelper() = default;
 
@@ -3181,6 +3765,7 @@ angle::Result DescriptorPoolHelper::init(Context *context,
     descriptorPoolInfo.poolSizeCount              = static_cast<uint32_t>(poolSizes.size());
     descriptorPoolInfo.pPoolSizes                 = poolSizes.data();
 
+    mMaxSets            = maxSets;
     mFreeDescriptorSets = maxSets;
 
     ANGLE_VK_TRY(context, mDescriptorPool.init(renderer->getDevice(), descriptorPoolInfo));
@@ -3268,6 +3853,9 @@ DynamicDescriptorPool &DynamicDescriptorPool::operator=(DynamicDescriptorPool &&
     std::swap(mDescriptorPools, other.mDescriptorPools);
     std::swap(mPoolSizes, other.mPoolSizes);
     std::swap(mCachedDescriptorSetLayout, other.mCachedDescriptorSetLayout);
+    std::swap(mCacheStats, other.mCacheStats);
+    std::swap(mUpdateTemplate, other.mUpdateTemplate);
+    std::swap(mUpdateTemplateDesc, other.mUpdateTemplateDesc);
     return *this;
 }
 
@@ -3301,6 +3889,12 @@ void DynamicDescriptorPool::destroy(RendererVk *renderer, VulkanCacheType cacheT
         delete pool;
     }
 
+    renderer->accumulateCacheStats(cacheType, mCacheStats);
+    mCacheStats.reset();
+
+    mUpdateTemplate.destroy(renderer->getDevice());
+    mUpdateTemplateDesc.reset();
+
     mDescriptorPools.clear();
     mCurrentPoolIndex          = 0;
     mCachedDescriptorSetLayout = VK_NULL_HANDLE;
@@ -3315,6 +3909,12 @@ void DynamicDescriptorPool::release(ContextVk *contextVk, VulkanCacheType cacheT
         delete pool;
     }
 
+    contextVk->getRenderer()->accumulateCacheStats(cacheType, mCacheStats);
+    mCacheStats.reset();
+
+    contextVk->addGarbage(&mUpdateTemplate);
+    mUpdateTemplateDesc.reset();
+
     mDescriptorPools.clear();
     mCurrentPoolIndex          = 0;
     mCachedDescriptorSetLayout = VK_NULL_HANDLE;
@@ -3391,24 +3991,78 @@ angle::Result DynamicDescriptorPool::getOrAllocateDescriptorSet(
     return angle::Result::Continue;
 }
 
+angle::Result DynamicDescriptorPool::updateDescriptorSet(
+    Context *context,
+    const DescriptorSetDescBuilder &descBuilder,
+    UpdateDescriptorSetsBuilder *updateBuilder,
+    VkDescriptorSet descriptorSet)
+{
+    const DescriptorSetDesc &desc = descBuilder.getDesc();
+
+    if (!context->getRenderer()->getFeatures().supportsDescriptorUpdateTemplate.enabled ||
+        desc.empty())
+    {
+        descBuilder.updateDescriptorSet(updateBuilder, descriptorSet);
+        return angle::Result::Continue;
+    }
+
+    if (!mUpdateTemplate.valid())
+    {
+        std::vector<VkDescriptorUpdateTemplateEntryKHR> entries;
+        desc.getUpdateTemplateEntries(&entries);
+        ASSERT(!entries.empty());
+
+        VkDescriptorUpdateTemplateCreateInfoKHR createInfo = {};
+
+        createInfo.sType        = VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO_KHR;
+        createInfo.templateType = VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET_KHR;
+
+        createInfo.descriptorUpdateEntryCount = static_cast<uint32_t>(entries.size());
+        createInfo.pDescriptorUpdateEntries   = entries.data();
+        createInfo.descriptorSetLayout        = mCachedDescriptorSetLayout;
+
+        ANGLE_VK_TRY(context, mUpdateTemplate.init(context->getDevice(), createInfo));
+        mUpdateTemplateDesc = desc;
+    }
+
+    if (!mUpdateTemplateDesc.hasSameWriteDescriptors(desc))
+    {
+        descBuilder.updateDescriptorSet(updateBuilder, descriptorSet);
+        return angle::Result::Continue;
+    }
+
+    descBuilder.updateDescriptorSetWithTemplate(updateBuilder, mUpdateTemplate, descriptorSet);
+    return angle::Result::Continue;
+}
+
 angle::Result DynamicDescriptorPool::allocateNewPool(Context *context)
 {
-    bool found = false;
+    RendererVk *renderer       = context->getRenderer();
+    Serial lastCompletedSerial = renderer->getLastCompletedQueueSerial();
 
-    Serial lastCompletedSerial = context->getRenderer()->getLastCompletedQueueSerial();
+    // Recycle the least recently used pool that is no longer in use, so the pools that are still
+    // hot keep their cached descriptor sets.
+    bool found              = false;
+    Serial lruPoolUseSerial = Serial::Infinite();
     for (size_t poolIndex = 0; poolIndex < mDescriptorPools.size(); ++poolIndex)
     {
-        if (!mDescriptorPools[poolIndex]->isReferenced() &&
-            !mDescriptorPools[poolIndex]->get().isCurrentlyInUse(lastCompletedSerial))
+        RefCountedDescriptorPoolHelper *pool = mDescriptorPools[poolIndex];
+        if (!pool->isReferenced() && !pool->get().isCurrentlyInUse(lastCompletedSerial) &&
+            (!found || pool->get().getLastUseSerial() < lruPoolUseSerial))
         {
             mCurrentPoolIndex = poolIndex;
             found             = true;
-            mDescriptorPools[poolIndex]->get().resetCache();
-            break;
+            lruPoolUseSerial  = pool->get().getLastUseSerial();
         }
     }
 
-    if (!found)
+    if (found)
+    {
+        DescriptorPoolHelper &pool = mDescriptorPools[mCurrentPoolIndex]->get();
+        mCacheStats.decrementSize(pool.getCachedDescriptorSetCount());
+        pool.resetCache();
+    }
+    else
     {
         mDescriptorPools.push_back(new RefCountedDescriptorPoolHelper());
         mCurrentPoolIndex = mDescriptorPools.size() - 1;
@@ -3424,7 +4078,58 @@ angle::Result DynamicDescriptorPool::allocateNewPool(Context *context)
         mMaxSetsPerPool *= mMaxSetsPerPoolMultiplier;
     }
 
-    return mDescriptorPools[mCurrentPoolIndex]->get().init(context, mPoolSizes, mMaxSetsPerPool);
+    ANGLE_TRY(
+        mDescriptorPools[mCurrentPoolIndex]->get().init(context, mPoolSizes, mMaxSetsPerPool));
+
+    destroyIdlePoolsOverBudget(renderer, lastCompletedSerial);
+    return angle::Result::Continue;
+}
+
+void DynamicDescriptorPool::destroyIdlePoolsOverBudget(RendererVk *renderer,
+                                                       Serial lastCompletedSerial)
+{
+    uint32_t totalMaxSets = 0;
+    for (RefCountedDescriptorPoolHelper *pool : mDescriptorPools)
+    {
+        totalMaxSets += pool->get().getMaxSets();
+    }
+
+    while (totalMaxSets > kMaxCachedDescriptorSets)
+    {
+        // Find the least recently used pool, other than the current one, that the GPU is done with.
+        size_t lruPoolIndex     = mDescriptorPools.size();
+        Serial lruPoolUseSerial = Serial::Infinite();
+        for (size_t poolIndex = 0; poolIndex < mDescriptorPools.size(); ++poolIndex)
+        {
+            RefCountedDescriptorPoolHelper *pool = mDescriptorPools[poolIndex];
+            if (poolIndex != mCurrentPoolIndex && !pool->isReferenced() &&
+                !pool->get().isCurrentlyInUse(lastCompletedSerial) &&
+                pool->get().getLastUseSerial() < lruPoolUseSerial)
+            {
+                lruPoolIndex     = poolIndex;
+                lruPoolUseSerial = pool->get().getLastUseSerial();
+            }
+        }
+
+        if (lruPoolIndex == mDescriptorPools.size())
+        {
+            // Everything else is still in use; the pools will be trimmed on a later allocation.
+            break;
+        }
+
+        RefCountedDescriptorPoolHelper *pool = mDescriptorPools[lruPoolIndex];
+        totalMaxSets -= pool->get().getMaxSets();
+        mCacheStats.decrementSize(pool->get().getCachedDescriptorSetCount());
+        // The cache stats are tracked by this class, so the cache type is not needed here.
+        pool->get().destroy(renderer, VulkanCacheType::EnumCount);
+        delete pool;
+
+        mDescriptorPools.erase(mDescriptorPools.begin() + lruPoolIndex);
+        if (mCurrentPoolIndex > lruPoolIndex)
+        {
+            --mCurrentPoolIndex;
+        }
+    }
 }
 
 // For testing only!
@@ -4030,50 +4735,73 @@ angle::Result LineLoopHelper::getIndexBufferForElementArrayBuffer(ContextVk *con
                                                                   BufferHelper **bufferOut,
                                                                   uint32_t *indexCountOut)
 {
-    if (glIndexType == gl::DrawElementsType::UnsignedByte ||
-        contextVk->getState().isPrimitiveRestartEnabled())
+    const bool isPrimitiveRestartEnabled = contextVk->getState().isPrimitiveRestartEnabled();
+
+    // The index buffer generated from the same indices is used again until they are modified, so
+    // drawing the same line loops again costs nothing.
+    LineLoopConversionBuffer *conversion = elementArrayBufferVk->getLineLoopConversionBuffer(
+        contextVk->getRenderer(), glIndexType, static_cast<uint32_t>(indexCount),
+        static_cast<size_t>(elementArrayOffset), isPrimitiveRestartEnabled);
+    BufferHelper *dstBuffer = conversion != nullptr ? conversion->data.get() : &mDynamicIndexBuffer;
+
+    if (conversion != nullptr && !conversion->dirty)
+    {
+        *bufferOut     = dstBuffer;
+        *indexCountOut = conversion->indexCount;
+        return angle::Result::Continue;
+    }
+
+    if (glIndexType == gl::DrawElementsType::UnsignedByte || isPrimitiveRestartEnabled)
     {
         ANGLE_TRACE_EVENT0("gpu.angle", "LineLoopHelper::getIndexBufferForElementArrayBuffer");
 
         void *srcDataMapping = nullptr;
         ANGLE_TRY(elementArrayBufferVk->mapImpl(contextVk, GL_MAP_READ_BIT, &srcDataMapping));
-        ANGLE_TRY(streamIndices(contextVk, glIndexType, indexCount,
-                                static_cast<const uint8_t *>(srcDataMapping) + elementArrayOffset,
-                                bufferOut, indexCountOut));
+        ANGLE_TRY(streamIndicesImpl(
+            contextVk, glIndexType, indexCount,
+            static_cast<const uint8_t *>(srcDataMapping) + elementArrayOffset, dstBuffer,
+            indexCountOut));
         ANGLE_TRY(elementArrayBufferVk->unmapImpl(contextVk));
-        return angle::Result::Continue;
     }
+    else
+    {
+        *indexCountOut = indexCount + 1;
 
-    *indexCountOut = indexCount + 1;
+        size_t unitSize = contextVk->getVkIndexTypeSize(glIndexType);
 
-    size_t unitSize = contextVk->getVkIndexTypeSize(glIndexType);
+        size_t allocateBytes = unitSize * (indexCount + 1) + 1;
+        ANGLE_TRY(dstBuffer->allocateForVertexConversion(contextVk, allocateBytes,
+                                                         MemoryHostVisibility::Visible));
 
-    size_t allocateBytes = unitSize * (indexCount + 1) + 1;
-    ANGLE_TRY(mDynamicIndexBuffer.allocateForVertexConversion(contextVk, allocateBytes,
-                                                              MemoryHostVisibility::Visible));
+        BufferHelper *sourceBuffer = &elementArrayBufferVk->getBuffer();
+        VkDeviceSize sourceOffset =
+            static_cast<VkDeviceSize>(elementArrayOffset) + sourceBuffer->getOffset();
+        uint64_t unitCount                         = static_cast<VkDeviceSize>(indexCount);
+        angle::FixedVector<VkBufferCopy, 2> copies = {
+            {sourceOffset, dstBuffer->getOffset(), unitCount * unitSize},
+            {sourceOffset, dstBuffer->getOffset() + unitCount * unitSize, unitSize},
+        };
 
-    BufferHelper *sourceBuffer = &elementArrayBufferVk->getBuffer();
-    VkDeviceSize sourceOffset =
-        static_cast<VkDeviceSize>(elementArrayOffset) + sourceBuffer->getOffset();
-    uint64_t unitCount                         = static_cast<VkDeviceSize>(indexCount);
-    angle::FixedVector<VkBufferCopy, 2> copies = {
-        {sourceOffset, mDynamicIndexBuffer.getOffset(), unitCount * unitSize},
-        {sourceOffset, mDynamicIndexBuffer.getOffset() + unitCount * unitSize, unitSize},
-    };
+        vk::CommandBufferAccess access;
+        access.onBufferTransferWrite(dstBuffer);
+        access.onBufferTransferRead(sourceBuffer);
 
-    vk::CommandBufferAccess access;
-    access.onBufferTransferWrite(&mDynamicIndexBuffer);
-    access.onBufferTransferRead(sourceBuffer);
+        vk::OutsideRenderPassCommandBuffer *commandBuffer;
+        ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
 
-    vk::OutsideRenderPassCommandBuffer *commandBuffer;
-    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
+        commandBuffer->copyBuffer(sourceBuffer->getBuffer(), dstBuffer->getBuffer(),
+                                  static_cast<uint32_t>(copies.size()), copies.data());
 
-    commandBuffer->copyBuffer(sourceBuffer->getBuffer(), mDynamicIndexBuffer.getBuffer(),
-                              static_cast<uint32_t>(copies.size()), copies.data());
+        ANGLE_TRY(dstBuffer->flush(contextVk->getRenderer()));
+    }
 
-    ANGLE_TRY(mDynamicIndexBuffer.flush(contextVk->getRenderer()));
+    if (conversion != nullptr)
+    {
+        conversion->clearDirty();
+        conversion->indexCount = *indexCountOut;
+    }
 
-    *bufferOut = &mDynamicIndexBuffer;
+    *bufferOut = dstBuffer;
 
     return angle::Result::Continue;
 }
@@ -4084,6 +4812,20 @@ angle::Result LineLoopHelper::streamIndices(ContextVk *contextVk,
                                             const uint8_t *srcPtr,
                                             BufferHelper **bufferOut,
                                             uint32_t *indexCountOut)
+{
+    ANGLE_TRY(streamIndicesImpl(contextVk, glIndexType, indexCount, srcPtr, &mDynamicIndexBuffer,
+                                indexCountOut));
+    *bufferOut = &mDynamicIndexBuffer;
+
+    return angle::Result::Continue;
+}
+
+angle::Result LineLoopHelper::streamIndicesImpl(ContextVk *contextVk,
+                                                gl::DrawElementsType glIndexType,
+                                                GLsizei indexCount,
+                                                const uint8_t *srcPtr,
+                                                BufferHelper *dstBuffer,
+                                                uint32_t *indexCountOut)
 {
     size_t unitSize = contextVk->getVkIndexTypeSize(glIndexType);
 
@@ -4094,9 +4836,9 @@ angle::Result LineLoopHelper::streamIndices(ContextVk *contextVk,
     }
     *indexCountOut = numOutIndices;
 
-    ANGLE_TRY(mDynamicIndexBuffer.allocateForVertexConversion(contextVk, unitSize * numOutIndices,
-                                                              MemoryHostVisibility::Visible));
-    uint8_t *indices = mDynamicIndexBuffer.getMappedMemory();
+    ANGLE_TRY(dstBuffer->allocateForVertexConversion(contextVk, unitSize * numOutIndices,
+                                                     MemoryHostVisibility::Visible));
+    uint8_t *indices = dstBuffer->getMappedMemory();
 
     if (contextVk->getState().isPrimitiveRestartEnabled())
     {
@@ -4124,9 +4866,7 @@ angle::Result LineLoopHelper::streamIndices(ContextVk *contextVk,
         }
     }
 
-    ANGLE_TRY(mDynamicIndexBuffer.flush(contextVk->getRenderer()));
-
-    *bufferOut = &mDynamicIndexBuffer;
+    ANGLE_TRY(dstBuffer->flush(contextVk->getRenderer()));
 
     return angle::Result::Continue;
 }
@@ -4398,7 +5138,8 @@ angle::Result BufferHelper::initExternal(ContextVk *contextVk,
 angle::Result BufferHelper::initSuballocation(ContextVk *contextVk,
                                               uint32_t memoryTypeIndex,
                                               size_t size,
-                                              size_t alignment)
+                                              size_t alignment,
+                                              BufferUsageType usageType)
 {
     RendererVk *renderer = contextVk->getRenderer();
 
@@ -4413,7 +5154,7 @@ angle::Result BufferHelper::initSuballocation(ContextVk *contextVk,
         size += maxVertexAttribStride;
     }
 
-    vk::BufferPool *pool = contextVk->getDefaultBufferPool(size, memoryTypeIndex);
+    vk::BufferPool *pool = contextVk->getDefaultBufferPool(size, memoryTypeIndex, usageType);
     ANGLE_TRY(pool->allocateBuffer(contextVk, size, alignment, &mSuballocation));
 
     if (renderer->getFeatures().allocateNonZeroMemory.enabled)
@@ -4431,7 +5172,8 @@ angle::Result BufferHelper::allocateForCopyBuffer(ContextVk *contextVk,
     RendererVk *renderer     = contextVk->getRenderer();
     uint32_t memoryTypeIndex = renderer->getStagingBufferMemoryTypeIndex(coherency);
     size_t alignment         = renderer->getStagingBufferAlignment();
-    return initSuballocation(contextVk, memoryTypeIndex, size, alignment);
+    return initSuballocation(contextVk, memoryTypeIndex, size, alignment,
+                             BufferUsageType::Dynamic);
 }
 
 angle::Result BufferHelper::allocateForVertexConversion(ContextVk *contextVk,
@@ -4470,7 +5212,8 @@ angle::Result BufferHelper::allocateForVertexConversion(ContextVk *contextVk,
     // size anyway.
     size_t sizeToAllocate = roundUp(size, alignment);
 
-    return initSuballocation(contextVk, memoryTypeIndex, sizeToAllocate, alignment);
+    return initSuballocation(contextVk, memoryTypeIndex, sizeToAllocate, alignment,
+                             BufferUsageType::Dynamic);
 }
 
 angle::Result BufferHelper::allocateForCopyImage(ContextVk *contextVk,
@@ -4493,7 +5236,8 @@ angle::Result BufferHelper::allocateForCopyImage(ContextVk *contextVk,
     allocationSize          = roundUp(allocationSize, imageCopyAlignment);
     size_t stagingAlignment = static_cast<size_t>(renderer->getStagingBufferAlignment());
 
-    ANGLE_TRY(initSuballocation(contextVk, memoryTypeIndex, allocationSize, stagingAlignment));
+    ANGLE_TRY(initSuballocation(contextVk, memoryTypeIndex, allocationSize, stagingAlignment,
+                                BufferUsageType::Dynamic));
 
     *offset  = roundUp(getOffset(), static_cast<VkDeviceSize>(imageCopyAlignment));
     *dataPtr = getMappedMemory() + (*offset) - getOffset();
@@ -4660,6 +5404,57 @@ angle::Result BufferHelper::copyFromBuffer(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+angle::Result BufferHelper::copyFromBufferOnTransferQueue(ContextVk *contextVk,
+                                                          BufferHelper *srcBuffer,
+                                                          const VkBufferCopy &copyRegion)
+{
+    RendererVk *renderer                    = contextVk->getRenderer();
+    TransferQueue &transferQueue            = renderer->getTransferQueue();
+    const uint32_t graphicsQueueFamilyIndex = renderer->getQueueFamilyIndex();
+    ASSERT(transferQueue.valid() && mCurrentQueueFamilyIndex == graphicsQueueFamilyIndex);
+
+    PrimaryCommandBuffer commandBuffer;
+    ANGLE_TRY(transferQueue.beginCommandBuffer(contextVk, &commandBuffer));
+
+    // The previous contents of the range are overwritten, so the range is used on the transfer
+    // queue without an ownership transfer.  It's then released to the graphics queue.  The rest of
+    // the buffer stays owned by the graphics queue and keeps its contents, so it's left out of both
+    // the release and the acquire.
+    commandBuffer.copyBuffer(srcBuffer->getBuffer(), getBuffer(), 1, &copyRegion);
+
+    VkBufferMemoryBarrier releaseBarrier = {};
+    releaseBarrier.sType                 = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
+    releaseBarrier.srcAccessMask         = VK_ACCESS_TRANSFER_WRITE_BIT;
+    releaseBarrier.dstAccessMask         = 0;
+    releaseBarrier.srcQueueFamilyIndex   = transferQueue.getQueueFamilyIndex();
+    releaseBarrier.dstQueueFamilyIndex   = graphicsQueueFamilyIndex;
+    releaseBarrier.buffer                = getBuffer().getHandle();
+    releaseBarrier.offset                = copyRegion.dstOffset;
+    releaseBarrier.size                  = copyRegion.size;
+    commandBuffer.pipelineBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                  VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, 0, 0, nullptr, 1,
+                                  &releaseBarrier, 0, nullptr);
+
+    ANGLE_TRY(transferQueue.submit(contextVk, std::move(commandBuffer)));
+
+    // Acquire the range on the graphics queue, whose submissions wait for the transfer queue.  The
+    // copy is tracked as a transfer write so that later uses of the buffer wait for it, and the
+    // staging buffer is kept alive by the graphics commands, which only complete after the copy
+    // has.
+    CommandBufferAccess access;
+    access.onBufferTransferRead(srcBuffer);
+    access.onBufferTransferWrite(this);
+
+    OutsideRenderPassCommandBuffer *graphicsCommandBuffer;
+    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &graphicsCommandBuffer));
+
+    mCurrentQueueFamilyIndex = transferQueue.getQueueFamilyIndex();
+    changeQueueOfRange(graphicsQueueFamilyIndex, copyRegion.dstOffset, copyRegion.size,
+                       graphicsCommandBuffer);
+
+    return angle::Result::Continue;
+}
+
 angle::Result BufferHelper::map(Context *context, uint8_t **ptrOut)
 {
     if (!mSuballocation.isMapped())
@@ -4700,6 +5495,14 @@ angle::Result BufferHelper::invalidate(RendererVk *renderer)
 
 void BufferHelper::changeQueue(uint32_t newQueueFamilyIndex,
                                OutsideRenderPassCommandBuffer *commandBuffer)
+{
+    changeQueueOfRange(newQueueFamilyIndex, getOffset(), getSize(), commandBuffer);
+}
+
+void BufferHelper::changeQueueOfRange(uint32_t newQueueFamilyIndex,
+                                      VkDeviceSize offset,
+                                      VkDeviceSize size,
+                                      OutsideRenderPassCommandBuffer *commandBuffer)
 {
     VkBufferMemoryBarrier bufferMemoryBarrier = {};
     bufferMemoryBarrier.sType                 = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER;
@@ -4708,8 +5511,8 @@ void BufferHelper::changeQueue(uint32_t newQueueFamilyIndex,
     bufferMemoryBarrier.srcQueueFamilyIndex   = mCurrentQueueFamilyIndex;
     bufferMemoryBarrier.dstQueueFamilyIndex   = newQueueFamilyIndex;
     bufferMemoryBarrier.buffer                = getBuffer().getHandle();
-    bufferMemoryBarrier.offset                = getOffset();
-    bufferMemoryBarrier.size                  = getSize();
+    bufferMemoryBarrier.offset                = offset;
+    bufferMemoryBarrier.size                  = size;
 
     commandBuffer->bufferBarrier(VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
                                  VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, &bufferMemoryBarrier);
@@ -4850,6 +5653,9 @@ ImageHelper::ImageHelper(ImageHelper &&other)
       mTilingMode(other.mTilingMode),
       mCreateFlags(other.mCreateFlags),
       mUsage(other.mUsage),
+      mHasKnownViewFormats(other.mHasKnownViewFormats),
+      mViewFormatCount(other.mViewFormatCount),
+      mViewFormats(other.mViewFormats),
       mExtents(other.mExtents),
       mRotatedAspectRatio(other.mRotatedAspectRatio),
       mIntendedFormatID(other.mIntendedFormatID),
@@ -4885,6 +5691,8 @@ void ImageHelper::resetCachedProperties()
     mTilingMode                  = VK_IMAGE_TILING_OPTIMAL;
     mCreateFlags                 = kVkImageCreateFlagsNone;
     mUsage                       = 0;
+    mHasKnownViewFormats         = false;
+    mViewFormatCount             = 0;
     mExtents                     = {};
     mRotatedAspectRatio          = false;
     mIntendedFormatID            = angle::FormatID::NONE;
@@ -5090,6 +5898,7 @@ angle::Result ImageHelper::initExternal(Context *context,
         // Derive the tiling for external images.
         deriveExternalImageTiling(externalImageCreateInfo);
     }
+    deriveViewFormats(imageCreateInfoPNext);
 
     mYcbcrConversionDesc.reset();
 
@@ -5212,6 +6021,34 @@ const void *ImageHelper::DeriveCreateInfoPNext(
     return pNext;
 }
 
+void ImageHelper::deriveViewFormats(const void *createInfoChain)
+{
+    mHasKnownViewFormats = true;
+    mViewFormatCount     = 0;
+
+    const VkBaseInStructure *chain = reinterpret_cast<const VkBaseInStructure *>(createInfoChain);
+    while (chain != nullptr)
+    {
+        if (chain->sType == VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO_KHR)
+        {
+            const VkImageFormatListCreateInfoKHR *formatList =
+                reinterpret_cast<const VkImageFormatListCreateInfoKHR *>(chain);
+            if (formatList->viewFormatCount > kImageListFormatCount)
+            {
+                mHasKnownViewFormats = false;
+                return;
+            }
+
+            mViewFormatCount = formatList->viewFormatCount;
+            std::copy(formatList->pViewFormats, formatList->pViewFormats + mViewFormatCount,
+                      mViewFormats.begin());
+            return;
+        }
+
+        chain = reinterpret_cast<const VkBaseInStructure *>(chain->pNext);
+    }
+}
+
 void ImageHelper::deriveExternalImageTiling(const void *createInfoChain)
 {
     const VkBaseInStructure *chain = reinterpret_cast<const VkBaseInStructure *>(createInfoChain);
@@ -5660,6 +6497,7 @@ void ImageHelper::init2DWeakReference(Context *context,
     mCurrentLayout           = ImageLayout::Undefined;
     mLayerCount              = 1;
     mLevelCount              = 1;
+    mHasKnownViewFormats     = false;
 
     mImage.setHandle(handle);
 
@@ -5708,6 +6546,9 @@ angle::Result ImageHelper::initStaging(Context *context,
     mLevelCount         = mipLevels;
     mUsage              = usage;
 
+    // Staging images aren't used in imageless framebuffers.
+    mHasKnownViewFormats = false;
+
     // Validate that mLayerCount is compatible with the image type
     ASSERT(imageType != VK_IMAGE_TYPE_3D || mLayerCount == 1);
     ASSERT(imageType != VK_IMAGE_TYPE_2D || mExtents.depth == 1);
@@ -5769,24 +6610,47 @@ angle::Result ImageHelper::initImplicitMultisampledRenderToTexture(
     // based on whether the memory that will be used to create the image would have
     // VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT.  TRANSIENT is provided if there is any memory that
     // supports LAZILY_ALLOCATED.  However, based on actual image requirements, such a memory may
-    // not be suitable for the image.  We don't support such a case, which will result in the
-    // |initMemory| call below failing.
-    const bool hasLazilyAllocatedMemory = memoryProperties.hasLazilyAllocatedMemory();
-
-    const VkImageUsageFlags kMultisampledUsageFlags =
-        (hasLazilyAllocatedMemory ? VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT : 0) |
-        (resolveImage.getAspectFlags() == VK_IMAGE_ASPECT_COLOR_BIT
-             ? VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT
-             : VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT);
+    // not be suitable for the image.  In that case, the image is recreated without TRANSIENT and
+    // backed by regular device-local memory.
+    bool useLazilyAllocatedMemory = memoryProperties.hasLazilyAllocatedMemory();
+
+    const VkImageUsageFlags kAttachmentUsageFlags =
+        resolveImage.getAspectFlags() == VK_IMAGE_ASPECT_COLOR_BIT
+            ? VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT
+            : VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
     const VkImageCreateFlags kMultisampledCreateFlags =
         hasProtectedContent ? VK_IMAGE_CREATE_PROTECTED_BIT : 0;
 
-    ANGLE_TRY(initExternal(context, textureType, resolveImage.getExtents(),
-                           resolveImage.getIntendedFormatID(), resolveImage.getActualFormatID(),
-                           samples, kMultisampledUsageFlags, kMultisampledCreateFlags,
-                           ImageLayout::Undefined, nullptr, resolveImage.getFirstAllocatedLevel(),
-                           resolveImage.getLevelCount(), resolveImage.getLayerCount(),
-                           isRobustResourceInitEnabled, hasProtectedContent));
+    while (true)
+    {
+        const VkImageUsageFlags multisampledUsageFlags =
+            kAttachmentUsageFlags |
+            (useLazilyAllocatedMemory ? VK_IMAGE_USAGE_TRANSIENT_ATTACHMENT_BIT : 0);
+
+        ANGLE_TRY(initExternal(
+            context, textureType, resolveImage.getExtents(), resolveImage.getIntendedFormatID(),
+            resolveImage.getActualFormatID(), samples, multisampledUsageFlags,
+            kMultisampledCreateFlags, ImageLayout::Undefined, nullptr,
+            resolveImage.getFirstAllocatedLevel(), resolveImage.getLevelCount(),
+            resolveImage.getLayerCount(), isRobustResourceInitEnabled, hasProtectedContent));
+
+        if (!useLazilyAllocatedMemory)
+        {
+            break;
+        }
+
+        VkMemoryRequirements memoryRequirements;
+        mImage.getMemoryRequirements(context->getDevice(), &memoryRequirements);
+
+        if (memoryProperties.hasCompatibleLazilyAllocatedMemory(memoryRequirements))
+        {
+            break;
+        }
+
+        // The image is not yet in use, so it can be destroyed right away.
+        destroy(context->getRenderer());
+        useLazilyAllocatedMemory = false;
+    }
 
     // Remove the emulated format clear from the multisampled image if any.  There is one already
     // staged on the resolve image if needed.
@@ -5794,11 +6658,10 @@ angle::Result ImageHelper::initImplicitMultisampledRenderToTexture(
 
     const VkMemoryPropertyFlags kMultisampledMemoryFlags =
         VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
-        (hasLazilyAllocatedMemory ? VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT : 0) |
+        (useLazilyAllocatedMemory ? VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT : 0) |
         (hasProtectedContent ? VK_MEMORY_PROPERTY_PROTECTED_BIT : 0);
 
-    // If this ever fails, it can be retried without the LAZILY_ALLOCATED flag (which will probably
-    // still fail), but ideally that means GL_EXT_multisampled_render_to_texture should not be
+    // If this ever fails, ideally that means GL_EXT_multisampled_render_to_texture should not be
     // advertized on this platform in the first place.
     return initMemory(context, hasProtectedContent, memoryProperties, kMultisampledMemoryFlags);
 }
@@ -5955,6 +6818,14 @@ void ImageHelper::releaseToExternal(ContextVk *contextVk,
                          commandBuffer);
 }
 
+void ImageHelper::resetToExternalImport(uint32_t externalQueueFamilyIndex)
+{
+    ASSERT(valid() && !hasStagedUpdatesInAllocatedLevels());
+    mCurrentLayout           = ImageLayout::ExternalPreInitialized;
+    mCurrentQueueFamilyIndex = externalQueueFamilyIndex;
+    setEntireContentDefined();
+}
+
 bool ImageHelper::isReleasedToExternal() const
 {
 #if !defined(ANGLE_PLATFORM_MACOS) && !defined(ANGLE_PLATFORM_ANDROID)
@@ -6195,6 +7066,7 @@ void ImageHelper::clearDepthStencil(VkImageAspectFlags clearAspectFlags,
 void ImageHelper::clear(VkImageAspectFlags aspectFlags,
                         const VkClearValue &value,
                         LevelIndex mipLevel,
+                        uint32_t levelCount,
                         uint32_t baseArrayLayer,
                         uint32_t layerCount,
                         OutsideRenderPassCommandBuffer *commandBuffer)
@@ -6204,14 +7076,14 @@ void ImageHelper::clear(VkImageAspectFlags aspectFlags,
 
     if (isDepthStencil)
     {
-        clearDepthStencil(aspectFlags, value.depthStencil, mipLevel, 1, baseArrayLayer, layerCount,
-                          commandBuffer);
+        clearDepthStencil(aspectFlags, value.depthStencil, mipLevel, levelCount, baseArrayLayer,
+                          layerCount, commandBuffer);
     }
     else
     {
         ASSERT(!angleFormat.isBlock);
 
-        clearColor(value.color, mipLevel, 1, baseArrayLayer, layerCount, commandBuffer);
+        clearColor(value.color, mipLevel, levelCount, baseArrayLayer, layerCount, commandBuffer);
     }
 }
 
@@ -6694,17 +7566,64 @@ angle::Result ImageHelper::stageSubresourceUpdateImpl(ContextVk *contextVk,
         std::make_unique<RefCounted<BufferHelper>>();
     BufferHelper *currentBuffer = &stagingBuffer->get();
 
-    uint8_t *stagingPointer;
+    uint8_t *stagingPointer = nullptr;
     VkDeviceSize stagingOffset;
-    ANGLE_TRY(currentBuffer->allocateForCopyImage(contextVk, allocationSize,
-                                                  MemoryCoherency::NonCoherent, storageFormat.id,
-                                                  &stagingOffset, &stagingPointer));
 
     const uint8_t *source = pixels + static_cast<ptrdiff_t>(inputSkipBytes);
 
-    loadFunctionInfo.loadFunction(glExtents.width, glExtents.height, glExtents.depth, source,
-                                  inputRowPitch, inputDepthPitch, stagingPointer, outputRowPitch,
-                                  outputDepthPitch);
+    if (loadFunctionInfo.requiresConversion &&
+        CanConvertTextureUploadWithCompute(contextVk->getRenderer(), formatInfo,
+                                           vkFormat.getIntendedFormat(), storageFormat, glExtents,
+                                           inputRowPitch, inputDepthPitch))
+    {
+        ASSERT(stencilAllocationSize == 0);
+        const angle::Format &intendedFormat = vkFormat.getIntendedFormat();
+        const size_t texelCount =
+            static_cast<size_t>(glExtents.width) * glExtents.height * glExtents.depth;
+
+        // Copy the client data as is, and let ConvertVertex.comp expand it to the device-local
+        // staging buffer that the image is updated from.  The source size is rounded up to a
+        // multiple of uint size, as that is the granularity in which the shader reads it.
+        const size_t sourceSize = texelCount * intendedFormat.pixelBytes;
+        RendererScoped<BufferHelper> sourceBuffer(contextVk->getRenderer());
+        ANGLE_TRY(sourceBuffer.get().allocateForVertexConversion(
+            contextVk, roundUpPow2(sourceSize, sizeof(uint32_t)), MemoryHostVisibility::Visible));
+        memcpy(sourceBuffer.get().getMappedMemory(), source, sourceSize);
+        ANGLE_TRY(sourceBuffer.get().flush(contextVk->getRenderer()));
+
+        // The copy offset must be a multiple of the texel size, which may be larger than the
+        // alignment of the conversion buffer.
+        const size_t convertedSize = allocationSize + storageFormat.pixelBytes;
+        ANGLE_TRY(currentBuffer->allocateForVertexConversion(contextVk, convertedSize,
+                                                             MemoryHostVisibility::NonVisible));
+        stagingOffset = roundUp(currentBuffer->getOffset(),
+                                static_cast<VkDeviceSize>(storageFormat.pixelBytes));
+
+        UtilsVk::ConvertVertexParameters params;
+        params.vertexCount = texelCount;
+        params.srcFormat   = &intendedFormat;
+        params.dstFormat   = &storageFormat;
+        params.srcStride   = intendedFormat.pixelBytes;
+        params.srcOffset   = 0;
+        params.dstOffset   = static_cast<size_t>(stagingOffset - currentBuffer->getOffset());
+
+        ANGLE_TRY(contextVk->getUtils().convertVertexBuffer(contextVk, currentBuffer,
+                                                            &sourceBuffer.get(), params));
+    }
+    else
+    {
+        ANGLE_TRY(currentBuffer->allocateForCopyImage(contextVk, allocationSize,
+                                                      MemoryCoherency::NonCoherent,
+                                                      storageFormat.id, &stagingOffset,
+                                                      &stagingPointer));
+
+        // Block compressed and YUV images can't be split in bands of rows.
+        const bool canLoadInParallel = !storageFormat.isBlock && !storageFormat.isYUV;
+        LoadImageInParallel(canLoadInParallel ? contextVk->getImageLoadWorkerPool() : nullptr,
+                            loadFunctionInfo.loadFunction, glExtents.width, glExtents.height,
+                            glExtents.depth, source, inputRowPitch, inputDepthPitch,
+                            stagingPointer, outputRowPitch, outputDepthPitch);
+    }
 
     // YUV formats need special handling.
     if (storageFormat.isYUV)
@@ -7207,6 +8126,131 @@ angle::Result ImageHelper::stageSubresourceUpdate(ContextVk *contextVk,
     return angle::Result::Continue;
 }
 
+angle::Result ImageHelper::updateSubresourceOnHost(ContextVk *contextVk,
+                                                   const gl::ImageIndex &index,
+                                                   const gl::Extents &glExtents,
+                                                   const gl::Offset &offset,
+                                                   const gl::InternalFormat &formatInfo,
+                                                   const gl::PixelUnpackState &unpack,
+                                                   GLenum type,
+                                                   const uint8_t *pixels,
+                                                   const Format &vkFormat,
+                                                   ImageAccess access,
+                                                   bool *copiedOut)
+{
+    RendererVk *renderer = contextVk->getRenderer();
+    *copiedOut           = false;
+
+    // The image must have been created for host copies, and the GPU must be done with it.
+    if (!valid() || (mUsage & VK_IMAGE_USAGE_HOST_TRANSFER_BIT_EXT) == 0 ||
+        isReleasedToExternal() || isCurrentlyInUse(renderer->getLastCompletedQueueSerial()))
+    {
+        return angle::Result::Continue;
+    }
+    ASSERT(renderer->getFeatures().supportsHostImageCopy.enabled);
+
+    // The level must be allocated, and updates staged to it must not be reordered with this one.
+    gl::LevelIndex updateLevelGL(index.getLevelIndex());
+    if (updateLevelGL < mFirstAllocatedLevel ||
+        static_cast<uint32_t>(toVkLevel(updateLevelGL).get()) >= mLevelCount)
+    {
+        return angle::Result::Continue;
+    }
+    const std::vector<SubresourceUpdate> *levelUpdates = getLevelUpdates(updateLevelGL);
+    if (levelUpdates != nullptr && !levelUpdates->empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    // Only color data that is copied as is can be given to the device as is.  Depth/stencil,
+    // block compressed and YUV data take the staged path, as do conversions.
+    const angle::Format &storageFormat     = vkFormat.getActualImageFormat(access);
+    LoadImageFunctionInfo loadFunctionInfo = vkFormat.getTextureLoadFunction(access, type);
+    if (storageFormat.id != mActualFormatID || storageFormat.isBlock || storageFormat.isYUV ||
+        storageFormat.depthBits > 0 || storageFormat.stencilBits > 0 ||
+        loadFunctionInfo.requiresConversion ||
+        formatInfo.computePixelBytes(type) != storageFormat.pixelBytes || glExtents.empty())
+    {
+        return angle::Result::Continue;
+    }
+
+    GLuint inputRowPitch   = 0;
+    GLuint inputDepthPitch = 0;
+    GLuint inputSkipBytes  = 0;
+    ANGLE_TRY(CalculateBufferInfo(contextVk, glExtents, formatInfo, unpack, type, index.usesTex3D(),
+                                  &inputRowPitch, &inputDepthPitch, &inputSkipBytes));
+    if (inputRowPitch % storageFormat.pixelBytes != 0 || inputDepthPitch % inputRowPitch != 0)
+    {
+        return angle::Result::Continue;
+    }
+
+    // The image is copied to in its current layout if possible, so that it needs no barrier
+    // before it's used again.  Otherwise, it is transitioned to TRANSFER_DST_OPTIMAL on the host,
+    // which the feature guarantees is supported.
+    VkImageLayout copyLayout = getCurrentLayout();
+    if (!renderer->isHostImageCopyDstLayout(copyLayout))
+    {
+        if (mCurrentLayout != ImageLayout::Undefined &&
+            !renderer->isHostImageCopySrcLayout(copyLayout))
+        {
+            return angle::Result::Continue;
+        }
+
+        VkHostImageLayoutTransitionInfoEXT transition = {};
+        transition.sType     = VK_STRUCTURE_TYPE_HOST_IMAGE_LAYOUT_TRANSITION_INFO_EXT;
+        transition.image     = mImage.getHandle();
+        transition.oldLayout = copyLayout;
+        transition.newLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+
+        transition.subresourceRange.aspectMask     = getAspectFlags();
+        transition.subresourceRange.baseMipLevel   = 0;
+        transition.subresourceRange.levelCount     = mLevelCount;
+        transition.subresourceRange.baseArrayLayer = 0;
+        transition.subresourceRange.layerCount     = mLayerCount;
+        ANGLE_VK_TRY(contextVk, vkTransitionImageLayoutEXT(contextVk->getDevice(), 1, &transition));
+
+        copyLayout = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+        setCurrentImageLayout(ImageLayout::TransferDst);
+    }
+
+    VkMemoryToImageCopyEXT copy      = {};
+    copy.sType                       = VK_STRUCTURE_TYPE_MEMORY_TO_IMAGE_COPY_EXT;
+    copy.pHostPointer                = pixels + static_cast<ptrdiff_t>(inputSkipBytes);
+    copy.memoryRowLength             = inputRowPitch / storageFormat.pixelBytes;
+    copy.memoryImageHeight           = inputDepthPitch / inputRowPitch;
+    copy.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    copy.imageSubresource.mipLevel   = toVkLevel(updateLevelGL).get();
+    copy.imageSubresource.layerCount = index.getLayerCount();
+
+    gl_vk::GetOffset(offset, &copy.imageOffset);
+    gl_vk::GetExtent(glExtents, &copy.imageExtent);
+
+    if (gl::IsArrayTextureType(index.getType()))
+    {
+        copy.imageSubresource.baseArrayLayer = offset.z;
+        copy.imageOffset.z                   = 0;
+        copy.imageExtent.depth               = 1;
+    }
+    else
+    {
+        copy.imageSubresource.baseArrayLayer = index.hasLayer() ? index.getLayerIndex() : 0;
+    }
+
+    VkCopyMemoryToImageInfoEXT copyInfo = {};
+    copyInfo.sType                      = VK_STRUCTURE_TYPE_COPY_MEMORY_TO_IMAGE_INFO_EXT;
+    copyInfo.dstImage                   = mImage.getHandle();
+    copyInfo.dstImageLayout             = copyLayout;
+    copyInfo.regionCount                = 1;
+    copyInfo.pRegions                   = &copy;
+    ANGLE_VK_TRY(contextVk, vkCopyMemoryToImageEXT(contextVk->getDevice(), &copyInfo));
+
+    setContentDefined(toVkLevel(updateLevelGL), 1, copy.imageSubresource.baseArrayLayer,
+                      copy.imageSubresource.layerCount, VK_IMAGE_ASPECT_COLOR_BIT);
+
+    *copiedOut = true;
+    return angle::Result::Continue;
+}
+
 angle::Result ImageHelper::stageSubresourceUpdateAndGetData(ContextVk *contextVk,
                                                             size_t allocationSize,
                                                             const gl::ImageIndex &imageIndex,
@@ -7247,6 +8291,69 @@ angle::Result ImageHelper::stageSubresourceUpdateAndGetData(ContextVk *contextVk
     return angle::Result::Continue;
 }
 
+angle::Result ImageHelper::stageSubresourceUpdateFromBuffer(ContextVk *contextVk,
+                                                            BufferHelper *srcBuffer,
+                                                            VkDeviceSize srcOffset,
+                                                            size_t size,
+                                                            const gl::ImageIndex &index,
+                                                            const gl::Extents &glExtents,
+                                                            const gl::Offset &offset,
+                                                            uint32_t rowLength,
+                                                            uint32_t imageHeight,
+                                                            VkImageAspectFlags aspectFlags,
+                                                            angle::FormatID formatID)
+{
+    std::unique_ptr<RefCounted<BufferHelper>> stagingBuffer =
+        std::make_unique<RefCounted<BufferHelper>>();
+    BufferHelper *currentBuffer = &stagingBuffer->get();
+
+    VkDeviceSize stagingOffset;
+    uint8_t *stagingPointer;
+    ANGLE_TRY(currentBuffer->allocateForCopyImage(contextVk, size, MemoryCoherency::NonCoherent,
+                                                  formatID, &stagingOffset, &stagingPointer));
+
+    CommandBufferAccess access;
+    access.onBufferTransferRead(srcBuffer);
+    access.onBufferTransferWrite(currentBuffer);
+
+    OutsideRenderPassCommandBuffer *commandBuffer;
+    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
+
+    VkBufferCopy bufferCopy = {};
+    bufferCopy.srcOffset    = srcOffset;
+    bufferCopy.dstOffset    = stagingOffset;
+    bufferCopy.size         = size;
+    commandBuffer->copyBuffer(srcBuffer->getBuffer(), currentBuffer->getBuffer(), 1, &bufferCopy);
+
+    VkBufferImageCopy copy = {};
+    copy.bufferOffset      = stagingOffset;
+    copy.bufferRowLength   = rowLength;
+    copy.bufferImageHeight = imageHeight;
+
+    gl::LevelIndex updateLevelGL(index.getLevelIndex());
+    copy.imageSubresource.aspectMask = aspectFlags;
+    copy.imageSubresource.mipLevel   = updateLevelGL.get();
+    copy.imageSubresource.layerCount = index.getLayerCount();
+
+    gl_vk::GetOffset(offset, &copy.imageOffset);
+    gl_vk::GetExtent(glExtents, &copy.imageExtent);
+
+    if (gl::IsArrayTextureType(index.getType()))
+    {
+        copy.imageSubresource.baseArrayLayer = offset.z;
+        copy.imageOffset.z                   = 0;
+        copy.imageExtent.depth               = 1;
+    }
+    else
+    {
+        copy.imageSubresource.baseArrayLayer = index.hasLayer() ? index.getLayerIndex() : 0;
+    }
+
+    appendSubresourceUpdate(
+        updateLevelGL, SubresourceUpdate(stagingBuffer.release(), currentBuffer, copy, formatID));
+    return angle::Result::Continue;
+}
+
 angle::Result ImageHelper::stageSubresourceUpdateFromFramebuffer(
     const gl::Context *context,
     const gl::ImageIndex &index,
@@ -7724,6 +8831,155 @@ angle::Result ImageHelper::flushSingleSubresourceStagedUpdates(ContextVk *contex
     return flushStagedUpdates(contextVk, levelGL, levelGL + 1, layer, layer + layerCount, {});
 }
 
+angle::Result ImageHelper::flushStagedUpdatesOnTransferQueue(ContextVk *contextVk,
+                                                             gl::LevelIndex levelGLStart,
+                                                             gl::LevelIndex levelGLEnd,
+                                                             uint32_t layerStart,
+                                                             uint32_t layerEnd,
+                                                             bool *flushedOut)
+{
+    RendererVk *renderer                    = contextVk->getRenderer();
+    TransferQueue &transferQueue            = renderer->getTransferQueue();
+    const uint32_t graphicsQueueFamilyIndex = renderer->getQueueFamilyIndex();
+    const uint32_t transferQueueFamilyIndex = transferQueue.getQueueFamilyIndex();
+    const VkImageAspectFlags aspectFlags    = VK_IMAGE_ASPECT_COLOR_BIT;
+
+    *flushedOut = false;
+
+    // Only images that were never used are uploaded on the transfer queue, as their contents
+    // don't need to be released by the graphics queue first.  The transfer queue isn't protected,
+    // and copies of depth/stencil aspects aren't guaranteed to be supported on it.
+    if (mCurrentLayout != ImageLayout::Undefined ||
+        mCurrentQueueFamilyIndex != graphicsQueueFamilyIndex ||
+        (mCreateFlags & VK_IMAGE_CREATE_PROTECTED_BIT) != 0 ||
+        GetFormatAspectFlags(getActualFormat()) != aspectFlags ||
+        isCurrentlyInUse(contextVk->getLastCompletedQueueSerial()))
+    {
+        return angle::Result::Continue;
+    }
+
+    // Every update must be a copy from a staging buffer that was written by the host and that is
+    // in the flushed range, so that the image is entirely initialized by the transfer queue.
+    VkDeviceSize totalCopySize = 0;
+    for (size_t levelIndex = 0; levelIndex < mSubresourceUpdates.size(); ++levelIndex)
+    {
+        const gl::LevelIndex levelGL(static_cast<GLint>(levelIndex));
+        for (const SubresourceUpdate &update : mSubresourceUpdates[levelIndex])
+        {
+            uint32_t updateBaseLayer, updateLayerCount;
+            update.getDestSubresource(mLayerCount, &updateBaseLayer, &updateLayerCount);
+
+            if (levelGL < levelGLStart || levelGL >= levelGLEnd || updateBaseLayer < layerStart ||
+                updateBaseLayer + updateLayerCount > layerEnd ||
+                update.updateSource != UpdateSource::Buffer ||
+                update.data.buffer.formatID != mActualFormatID ||
+                update.data.buffer.bufferHelper->isCurrentlyInUse(
+                    contextVk->getLastCompletedQueueSerial()))
+            {
+                return angle::Result::Continue;
+            }
+            totalCopySize += update.data.buffer.bufferHelper->getSize();
+        }
+    }
+
+    if (totalCopySize < kMinTransferQueueUploadSize)
+    {
+        return angle::Result::Continue;
+    }
+
+    ASSERT(validateSubresourceUpdateRefCountsConsistent());
+
+    PrimaryCommandBuffer commandBuffer;
+    ANGLE_TRY(transferQueue.beginCommandBuffer(contextVk, &commandBuffer));
+
+    // The contents of the image are undefined, so it is used on the transfer queue without an
+    // ownership transfer.
+    mCurrentQueueFamilyIndex = transferQueueFamilyIndex;
+    barrierImpl(contextVk, aspectFlags, ImageLayout::TransferDst, transferQueueFamilyIndex,
+                &commandBuffer);
+
+    // Buffer updates recorded since the last barrier.  Copies to different levels never overlap.
+    std::vector<VkBufferImageCopy> copiesInProgress;
+    for (gl::LevelIndex levelGL = levelGLStart; levelGL < levelGLEnd; ++levelGL)
+    {
+        std::vector<SubresourceUpdate> *levelUpdates = getLevelUpdates(levelGL);
+        if (levelUpdates == nullptr)
+        {
+            break;
+        }
+
+        copiesInProgress.clear();
+        for (SubresourceUpdate &update : *levelUpdates)
+        {
+            BufferUpdate &bufferUpdate = update.data.buffer;
+            ANGLE_TRY(bufferUpdate.bufferHelper->flush(renderer));
+
+            VkBufferImageCopy &copyRegion        = bufferUpdate.copyRegion;
+            copyRegion.imageSubresource.mipLevel = toVkLevel(levelGL).get();
+
+            if (IsBufferImageCopyOverlapping(copyRegion, copiesInProgress))
+            {
+                VkMemoryBarrier memoryBarrier = {};
+                memoryBarrier.sType           = VK_STRUCTURE_TYPE_MEMORY_BARRIER;
+                memoryBarrier.srcAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+                memoryBarrier.dstAccessMask   = VK_ACCESS_TRANSFER_WRITE_BIT;
+                commandBuffer.memoryBarrier(VK_PIPELINE_STAGE_TRANSFER_BIT,
+                                            VK_PIPELINE_STAGE_TRANSFER_BIT, &memoryBarrier);
+                copiesInProgress.clear();
+            }
+            copiesInProgress.push_back(copyRegion);
+
+            commandBuffer.copyBufferToImage(bufferUpdate.bufferHelper->getBuffer().getHandle(),
+                                            mImage, getCurrentLayout(), 1, &copyRegion);
+
+            uint32_t updateBaseLayer, updateLayerCount;
+            update.getDestSubresource(mLayerCount, &updateBaseLayer, &updateLayerCount);
+            onWrite(levelGL, 1, updateBaseLayer, updateLayerCount,
+                    copyRegion.imageSubresource.aspectMask);
+        }
+    }
+
+    // Release the image to the graphics queue.
+    barrierImpl(contextVk, aspectFlags, ImageLayout::TransferDst, graphicsQueueFamilyIndex,
+                &commandBuffer);
+
+    ANGLE_TRY(transferQueue.submit(contextVk, std::move(commandBuffer)));
+
+    // Acquire the image on the graphics queue, whose submissions wait for the transfer queue.
+    mCurrentQueueFamilyIndex = transferQueueFamilyIndex;
+
+    CommandBufferAccess access;
+    access.onExternalAcquireRelease(this);
+    OutsideRenderPassCommandBuffer *graphicsCommandBuffer;
+    ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &graphicsCommandBuffer));
+    changeLayoutAndQueue(contextVk, aspectFlags, ImageLayout::TransferDst, graphicsQueueFamilyIndex,
+                         graphicsCommandBuffer);
+
+    // The staging buffers are kept alive by the graphics commands, which only complete after the
+    // copies have.
+    for (std::vector<SubresourceUpdate> &levelUpdates : mSubresourceUpdates)
+    {
+        for (SubresourceUpdate &update : levelUpdates)
+        {
+            CommandBufferAccess bufferAccess;
+            bufferAccess.onBufferTransferRead(update.data.buffer.bufferHelper);
+            ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(bufferAccess,
+                                                                   &graphicsCommandBuffer));
+            update.release(renderer);
+        }
+    }
+    mSubresourceUpdates.clear();
+
+    ASSERT(validateSubresourceUpdateRefCountsConsistent());
+    onStateChange(angle::SubjectMessage::InitializationComplete);
+
+    *flushedOut = true;
+
+    // The staging buffers are only freed once the graphics commands are submitted, which the
+    // accounting of the copy size makes happen regularly.
+    return contextVk->onCopyUpdate(totalCopySize);
+}
+
 angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
                                               gl::LevelIndex levelGLStart,
                                               gl::LevelIndex levelGLEnd,
@@ -7764,6 +9020,18 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
         }
     }
 
+    if (skipLevelsMask.none() && renderer->getTransferQueue().valid())
+    {
+        bool flushedOnTransferQueue = false;
+        ANGLE_TRY(flushStagedUpdatesOnTransferQueue(contextVk, levelGLStart, levelGLEnd,
+                                                    layerStart, layerEnd,
+                                                    &flushedOnTransferQueue));
+        if (flushedOnTransferQueue)
+        {
+            return angle::Result::Continue;
+        }
+    }
+
     ASSERT(validateSubresourceUpdateRefCountsConsistent());
 
     const VkImageAspectFlags aspectFlags = GetFormatAspectFlags(getActualFormat());
@@ -7778,6 +9046,21 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
     // level.
     constexpr uint32_t kMaxParallelSubresourceUpload = 64;
 
+    // Buffer updates are accumulated and recorded as a single multi-region copy as long as they
+    // are sourced from the same VkBuffer, which is common as staging buffers are suballocated from
+    // large blocks.  Additionally, a buffer update that overlaps the layers of a previous buffer
+    // update doesn't need a barrier if the regions written are disjoint, such as when many glyphs
+    // are uploaded to a texture atlas.  Both are limited to a number of regions, which also keeps
+    // the overlap tests cheap.
+    constexpr size_t kMaxBatchedBufferImageCopyRegions = 1024;
+
+    // Buffer updates recorded since the last barrier.
+    std::vector<VkBufferImageCopy> copiesInProgress;
+    // Buffer updates that are yet to be recorded.
+    std::vector<VkBufferImageCopy> pendingCopyRegions;
+    VkBuffer pendingCopyBuffer   = VK_NULL_HANDLE;
+    VkDeviceSize pendingCopySize = 0;
+
     // Start in TransferDst.  Don't yet mark any subresource as having defined contents; that is
     // done with fine granularity as updates are applied.  This is achieved by specifying a layer
     // that is outside the tracking range.
@@ -7788,6 +9071,42 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
     OutsideRenderPassCommandBuffer *commandBuffer;
     ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(access, &commandBuffer));
 
+    // Clears of all channels to the same value and layers of consecutive levels are recorded as a
+    // single clear, which is common as robust resource init stages a clear for every level of a
+    // texture.  The pending clear is recorded before anything else is, so the order of the
+    // updates is kept.
+    Optional<ClearUpdate> pendingClear;
+    LevelIndex pendingClearBaseLevelVk(0);
+    uint32_t pendingClearLevelCount = 0;
+
+    auto flushPendingClear = [&]() {
+        if (!pendingClear.valid())
+        {
+            return;
+        }
+        const ClearUpdate &clearUpdate = pendingClear.value();
+        clear(clearUpdate.aspectFlags, clearUpdate.value, pendingClearBaseLevelVk,
+              pendingClearLevelCount, clearUpdate.layerIndex, clearUpdate.layerCount,
+              commandBuffer);
+        pendingClear.reset();
+    };
+
+    auto flushPendingCopies = [&]() {
+        if (pendingCopyRegions.empty())
+        {
+            return angle::Result::Continue;
+        }
+        commandBuffer->copyBufferToImage(pendingCopyBuffer, mImage, getCurrentLayout(),
+                                         static_cast<uint32_t>(pendingCopyRegions.size()),
+                                         pendingCopyRegions.data());
+        pendingCopyRegions.clear();
+        pendingCopyBuffer = VK_NULL_HANDLE;
+
+        const VkDeviceSize copySize = pendingCopySize;
+        pendingCopySize             = 0;
+        return contextVk->onCopyUpdate(copySize);
+    };
+
     for (gl::LevelIndex updateMipLevelGL = levelGLStart; updateMipLevelGL < levelGLEnd;
          ++updateMipLevelGL)
     {
@@ -7802,6 +9121,10 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
 
         // Hash map of uploads in progress.  See comment on kMaxParallelSubresourceUpload.
         uint64_t subresourceUploadsInProgress = 0;
+        // Hash map of uploads in progress that are not buffer updates, i.e. that are not tracked
+        // in copiesInProgress.
+        uint64_t subresourceNonCopyUploadsInProgress = 0;
+        copiesInProgress.clear();
 
         for (SubresourceUpdate &update : *levelUpdates)
         {
@@ -7860,11 +9183,33 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
                 update.data.image.copyRegion.dstSubresource.mipLevel = updateMipLevelVk.get();
             }
 
+            const bool isBufferUpdate = update.updateSource == UpdateSource::Buffer;
+
+            // A clear can only join the pending clear if it's the first update of the next level,
+            // which needs no barrier.
+            const bool extendsPendingClear =
+                pendingClear.valid() && IsClearOfAllChannels(update.updateSource) &&
+                subresourceUploadsInProgress == 0 && mImageType != VK_IMAGE_TYPE_3D &&
+                updateLayerCount < kMaxParallelSubresourceUpload &&
+                pendingClearBaseLevelVk + pendingClearLevelCount == updateMipLevelVk &&
+                pendingClear.value().aspectFlags == update.data.clear.aspectFlags &&
+                pendingClear.value().layerIndex == updateBaseLayer &&
+                pendingClear.value().layerCount == updateLayerCount &&
+                memcmp(&pendingClear.value().value, &update.data.clear.value,
+                       sizeof(VkClearValue)) == 0;
+            if (!extendsPendingClear)
+            {
+                flushPendingClear();
+            }
+
             if (updateLayerCount >= kMaxParallelSubresourceUpload)
             {
                 // If there are more subresources than bits we can track, always insert a barrier.
+                ANGLE_TRY(flushPendingCopies());
                 recordWriteBarrier(contextVk, aspectFlags, ImageLayout::TransferDst, commandBuffer);
-                subresourceUploadsInProgress = std::numeric_limits<uint64_t>::max();
+                subresourceUploadsInProgress        = std::numeric_limits<uint64_t>::max();
+                subresourceNonCopyUploadsInProgress = std::numeric_limits<uint64_t>::max();
+                copiesInProgress.clear();
             }
             else
             {
@@ -7874,20 +9219,54 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
                 const uint64_t subresourceHash =
                     ANGLE_ROTL64(subresourceHashRange, subresourceHashOffset);
 
-                if ((subresourceUploadsInProgress & subresourceHash) != 0)
+                // A buffer update that only overlaps other buffer updates in layers can proceed
+                // without a barrier if the regions are disjoint.
+                const bool isDisjointCopy =
+                    isBufferUpdate &&
+                    (subresourceNonCopyUploadsInProgress & subresourceHash) == 0 &&
+                    copiesInProgress.size() < kMaxBatchedBufferImageCopyRegions &&
+                    !IsBufferImageCopyOverlapping(update.data.buffer.copyRegion, copiesInProgress);
+
+                if ((subresourceUploadsInProgress & subresourceHash) != 0 && !isDisjointCopy)
                 {
                     // If there's overlap in subresource upload, issue a barrier.
+                    ANGLE_TRY(flushPendingCopies());
                     recordWriteBarrier(contextVk, aspectFlags, ImageLayout::TransferDst,
                                        commandBuffer);
-                    subresourceUploadsInProgress = 0;
+                    subresourceUploadsInProgress        = 0;
+                    subresourceNonCopyUploadsInProgress = 0;
+                    copiesInProgress.clear();
                 }
                 subresourceUploadsInProgress |= subresourceHash;
+                if (!isBufferUpdate)
+                {
+                    subresourceNonCopyUploadsInProgress |= subresourceHash;
+                }
+            }
+
+            if (isBufferUpdate)
+            {
+                copiesInProgress.push_back(update.data.buffer.copyRegion);
+            }
+            else
+            {
+                ANGLE_TRY(flushPendingCopies());
             }
 
             if (IsClearOfAllChannels(update.updateSource))
             {
-                clear(update.data.clear.aspectFlags, update.data.clear.value, updateMipLevelVk,
-                      updateBaseLayer, updateLayerCount, commandBuffer);
+                if (extendsPendingClear)
+                {
+                    ++pendingClearLevelCount;
+                }
+                else
+                {
+                    pendingClear                    = update.data.clear;
+                    pendingClear.value().layerIndex = updateBaseLayer;
+                    pendingClear.value().layerCount = updateLayerCount;
+                    pendingClearBaseLevelVk         = updateMipLevelVk;
+                    pendingClearLevelCount          = 1;
+                }
                 // Remember the latest operation is a clear call
                 mCurrentSingleClearValue = update.data.clear;
 
@@ -7921,17 +9300,30 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
                 ASSERT(currentBuffer && currentBuffer->valid());
                 ANGLE_TRY(currentBuffer->flush(renderer));
 
+                // Reading a staging buffer that was written on the GPU, such as when the upload
+                // was converted with a compute shader, may close the command buffer.  Record the
+                // pending copies before that happens.  Staging buffers written by the host never
+                // close the command buffer.
+                const VkBuffer srcBuffer = currentBuffer->getBuffer().getHandle();
+                if (srcBuffer != pendingCopyBuffer ||
+                    pendingCopyRegions.size() >= kMaxBatchedBufferImageCopyRegions ||
+                    currentBuffer->isCurrentlyInUseForWrite(
+                        renderer->getLastCompletedQueueSerial()))
+                {
+                    ANGLE_TRY(flushPendingCopies());
+                }
+
                 CommandBufferAccess bufferAccess;
                 bufferAccess.onBufferTransferRead(currentBuffer);
                 ANGLE_TRY(
                     contextVk->getOutsideRenderPassCommandBuffer(bufferAccess, &commandBuffer));
 
-                VkBufferImageCopy *copyRegion = &update.data.buffer.copyRegion;
-                commandBuffer->copyBufferToImage(currentBuffer->getBuffer().getHandle(), mImage,
-                                                 getCurrentLayout(), 1, copyRegion);
-                ANGLE_TRY(contextVk->onCopyUpdate(currentBuffer->getSize()));
+                const VkBufferImageCopy &copyRegion = bufferUpdate.copyRegion;
+                pendingCopyBuffer                   = srcBuffer;
+                pendingCopyRegions.push_back(copyRegion);
+                pendingCopySize += currentBuffer->getSize();
                 onWrite(updateMipLevelGL, 1, updateBaseLayer, updateLayerCount,
-                        copyRegion->imageSubresource.aspectMask);
+                        copyRegion.imageSubresource.aspectMask);
             }
             else
             {
@@ -7952,10 +9344,14 @@ angle::Result ImageHelper::flushStagedUpdates(ContextVk *contextVk,
             update.release(contextVk->getRenderer());
         }
 
+        ANGLE_TRY(flushPendingCopies());
+
         // Only remove the updates that were actually applied to the image.
         *levelUpdates = std::move(updatesToKeep);
     }
 
+    flushPendingClear();
+
     // Compact mSubresourceUpdates, then check if there are any updates left.
     size_t compactSize;
     for (compactSize = mSubresourceUpdates.size(); compactSize > 0; --compactSize)
@@ -8053,6 +9449,18 @@ bool ImageHelper::hasStagedUpdatesInAllocatedLevels() const
     return hasStagedUpdatesInLevels(mFirstAllocatedLevel, getLastAllocatedLevel() + 1);
 }
 
+gl::LevelIndex ImageHelper::getStagedUpdatesLevelEnd() const
+{
+    for (size_t levelEnd = mSubresourceUpdates.size(); levelEnd > 0; --levelEnd)
+    {
+        if (!mSubresourceUpdates[levelEnd - 1].empty())
+        {
+            return gl::LevelIndex(static_cast<GLint>(levelEnd));
+        }
+    }
+    return gl::LevelIndex(0);
+}
+
 bool ImageHelper::hasStagedUpdatesInLevels(gl::LevelIndex levelStart, gl::LevelIndex levelEnd) const
 {
     for (gl::LevelIndex level = levelStart; level < levelEnd; ++level)
@@ -8644,6 +10052,37 @@ bool ImageHelper::canCopyWithTransformForReadPixels(const PackPixelsParams &pack
            isPitchMultipleOfTexelSize;
 }
 
+bool ImageHelper::canBlitWithTransformForReadPixels(ContextVk *contextVk,
+                                                    const PackPixelsParams &packPixelsParams,
+                                                    const angle::Format *readFormat,
+                                                    VkImageAspectFlagBits copyAspectFlags)
+{
+    ASSERT(mActualFormatID != angle::FormatID::NONE && mIntendedFormatID != angle::FormatID::NONE);
+
+    RendererVk *renderer               = contextVk->getRenderer();
+    const angle::Format &destFormat    = *packPixelsParams.destFormat;
+    const angle::FormatID destFormatID = destFormat.id;
+
+    // The blit converts between the color formats, and flips the rows if needed.  Rotation is
+    // left to the CPU.
+    const bool isColorCopy   = copyAspectFlags == VK_IMAGE_ASPECT_COLOR_BIT && !readFormat->isBlock;
+    const bool needsRotation = packPixelsParams.rotation != SurfaceRotation::Identity;
+
+    // Vulkan disallows blits between integer and non-integer formats.  sRGB sources are excluded
+    // as the blit would decode them, while ReadPixels returns the encoded values.
+    const bool isConvertibleFormat =
+        !readFormat->isInt() && !destFormat.isInt() && !readFormat->isSRGB;
+
+    const bool isPitchMultipleOfTexelSize =
+        destFormat.pixelBytes > 0 && packPixelsParams.outputPitch % destFormat.pixelBytes == 0;
+
+    return !hasEmulatedImageFormat() && isColorCopy && !needsRotation && isConvertibleFormat &&
+           isPitchMultipleOfTexelSize && destFormatID != angle::FormatID::NONE &&
+           renderer->hasImageFormatFeatureBits(mActualFormatID, VK_FORMAT_FEATURE_BLIT_SRC_BIT) &&
+           renderer->hasImageFormatFeatureBits(
+               destFormatID, VK_FORMAT_FEATURE_BLIT_DST_BIT | VK_FORMAT_FEATURE_TRANSFER_SRC_BIT);
+}
+
 angle::Result ImageHelper::readPixels(ContextVk *contextVk,
                                       const gl::Rectangle &area,
                                       const PackPixelsParams &packPixelsParams,
@@ -8744,8 +10183,65 @@ angle::Result ImageHelper::readPixels(ContextVk *contextVk,
     }
 
     // If PBO and if possible, copy directly on the GPU.
-    if (packPixelsParams.packBuffer &&
-        canCopyWithTransformForReadPixels(packPixelsParams, readFormat))
+    bool canCopyToPackBuffer = packPixelsParams.packBuffer != nullptr &&
+                               canCopyWithTransformForReadPixels(packPixelsParams, readFormat);
+
+    // Otherwise, if the format conversion and row flip can be done by a blit, blit into an image
+    // of the destination format and copy that to the PBO.  This avoids waiting for the GPU to
+    // pack the pixels on the CPU, for example when reading back a flipped BGRA swapchain image.
+    RendererScoped<ImageHelper> blitImage(contextVk->getRenderer());
+    if (packPixelsParams.packBuffer != nullptr && !canCopyToPackBuffer &&
+        canBlitWithTransformForReadPixels(contextVk, packPixelsParams, readFormat,
+                                          copyAspectFlags))
+    {
+        const angle::FormatID destFormatID = packPixelsParams.destFormat->id;
+        ANGLE_TRY(blitImage.get().init2DStaging(
+            contextVk, contextVk->hasProtectedContent(), renderer->getMemoryProperties(),
+            gl::Extents(area.width, area.height, 1), destFormatID, destFormatID,
+            VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT, 1));
+
+        CommandBufferAccess blitAccess;
+        blitAccess.onImageTransferRead(layoutChangeAspectFlags, src);
+        blitAccess.onImageTransferWrite(gl::LevelIndex(0), 1, 0, 1, VK_IMAGE_ASPECT_COLOR_BIT,
+                                        &blitImage.get());
+
+        OutsideRenderPassCommandBuffer *blitCommandBuffer;
+        ANGLE_TRY(contextVk->getOutsideRenderPassCommandBuffer(blitAccess, &blitCommandBuffer));
+
+        const int32_t width    = static_cast<int32_t>(srcExtent.width);
+        const int32_t height   = static_cast<int32_t>(srcExtent.height);
+        const int32_t dstFirst = packPixelsParams.reverseRowOrder ? height : 0;
+        const int32_t dstLast  = packPixelsParams.reverseRowOrder ? 0 : height;
+
+        VkImageBlit blit                   = {};
+        blit.srcSubresource                = srcSubresource;
+        blit.srcOffsets[0]                 = srcOffset;
+        blit.srcOffsets[1]                 = {srcOffset.x + width, srcOffset.y + height,
+                                              srcOffset.z + 1};
+        blit.dstSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        blit.dstSubresource.mipLevel       = 0;
+        blit.dstSubresource.baseArrayLayer = 0;
+        blit.dstSubresource.layerCount     = 1;
+        blit.dstOffsets[0]                 = {0, dstFirst, 0};
+        blit.dstOffsets[1]                 = {width, dstLast, 1};
+
+        blitCommandBuffer->blitImage(src->getImage(), src->getCurrentLayout(),
+                                     blitImage.get().getImage(),
+                                     blitImage.get().getCurrentLayout(), 1, &blit,
+                                     VK_FILTER_NEAREST);
+
+        // Make the blitted image the source of the buffer copy.
+        src                           = &blitImage.get();
+        readFormat                    = packPixelsParams.destFormat;
+        srcOffset                     = {0, 0, 0};
+        srcSubresource.aspectMask     = VK_IMAGE_ASPECT_COLOR_BIT;
+        srcSubresource.baseArrayLayer = 0;
+        srcSubresource.layerCount     = 1;
+        srcSubresource.mipLevel       = 0;
+        canCopyToPackBuffer           = true;
+    }
+
+    if (canCopyToPackBuffer)
     {
         BufferHelper &packBuffer      = GetImpl(packPixelsParams.packBuffer)->getBuffer();
         VkDeviceSize packBufferOffset = packBuffer.getOffset();
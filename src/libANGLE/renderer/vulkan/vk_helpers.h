@@ -10,6 +10,7 @@
 #define LIBANGLE_RENDERER_VULKAN_VK_HELPERS_H_
 
 #include "common/MemoryBuffer.h"
+#include "common/SlabAllocator.h"
 #include "libANGLE/renderer/vulkan/vk_cache_utils.h"
 #include "libANGLE/renderer/vulkan/vk_format_utils.h"
 
@@ -38,6 +39,10 @@ constexpr VkBufferUsageFlags kStagingBufferFlags =
     VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
 constexpr size_t kStagingBufferSize = 1024 * 16;
 
+// Uploads at least this large are copied on the transfer queue when it is enabled.  Smaller ones
+// aren't worth the extra submission and queue family ownership transfers.
+constexpr VkDeviceSize kMinTransferQueueUploadSize = 1024 * 1024;
+
 constexpr VkImageCreateFlags kVkImageCreateFlagsNone = 0;
 
 using StagingBufferOffsetArray = std::array<VkDeviceSize, 2>;
@@ -90,6 +95,10 @@ class DynamicBuffer : angle::NonCopyable
     // them.
     void releaseInFlightBuffersToResourceUseList(ContextVk *contextVk);
 
+    // This releases the buffers that are kept around for reuse.  The current buffer and the
+    // in-flight buffers are left untouched.
+    void releaseFreeBuffers(RendererVk *renderer);
+
     // This frees resources immediately.
     void destroy(RendererVk *renderer);
 
@@ -178,8 +187,18 @@ class DescriptorPoolHelper final : public Resource
     {
         return mDescriptorSetCache.getTotalCacheKeySizeBytes();
     }
+    uint32_t getCachedDescriptorSetCount() const
+    {
+        return static_cast<uint32_t>(mDescriptorSetCache.getCacheEntryCount());
+    }
+    uint32_t getMaxSets() const { return mMaxSets; }
+
+    // The serial of the last submission that used this pool.  Used to find the least recently
+    // used pool once the GPU is done with it.
+    Serial getLastUseSerial() const { return mUse.getSerial(); }
 
   private:
+    uint32_t mMaxSets;
     uint32_t mFreeDescriptorSets;
     DescriptorPool mDescriptorPool;
     DescriptorSetCache mDescriptorSetCache;
@@ -226,6 +245,13 @@ class DynamicDescriptorPool final : angle::NonCopyable
                                              VkDescriptorSet *descriptorSetOut,
                                              DescriptorCacheResult *cacheResultOut);
 
+    // Writes a newly allocated descriptor set.  A descriptor update template is used when the
+    // device supports it, created the first time a set is written from this pool.
+    angle::Result updateDescriptorSet(Context *context,
+                                      const DescriptorSetDescBuilder &descBuilder,
+                                      UpdateDescriptorSetsBuilder *updateBuilder,
+                                      VkDescriptorSet descriptorSet);
+
     template <typename Accumulator>
     void accumulateDescriptorCacheStats(VulkanCacheType cacheType, Accumulator *accum) const
     {
@@ -246,6 +272,8 @@ class DynamicDescriptorPool final : angle::NonCopyable
         return totalSize;
     }
 
+    size_t getPoolCount() const { return mDescriptorPools.size(); }
+
     // For testing only!
     static uint32_t GetMaxSetsPerPoolForTesting();
     static void SetMaxSetsPerPoolForTesting(uint32_t maxSetsPerPool);
@@ -254,8 +282,12 @@ class DynamicDescriptorPool final : angle::NonCopyable
 
   private:
     angle::Result allocateNewPool(Context *context);
+    void destroyIdlePoolsOverBudget(RendererVk *renderer, Serial lastCompletedSerial);
 
     static constexpr uint32_t kMaxSetsPerPoolMax = 512;
+    // Once the pools can hold more than this many descriptor sets in total, the least recently
+    // used pools the GPU is done with are destroyed rather than kept around for their cache.
+    static constexpr uint32_t kMaxCachedDescriptorSets = 4 * kMaxSetsPerPoolMax;
     static uint32_t mMaxSetsPerPool;
     static uint32_t mMaxSetsPerPoolMultiplier;
     size_t mCurrentPoolIndex;
@@ -266,6 +298,10 @@ class DynamicDescriptorPool final : angle::NonCopyable
     // descriptor count is accurate and new pools are created appropriately.
     VkDescriptorSetLayout mCachedDescriptorSetLayout;
     CacheStats mCacheStats;
+    // The update template is built from the write descriptors of the first set written from this
+    // pool.  Sets with different write descriptors are written with vkUpdateDescriptorSets.
+    DescriptorUpdateTemplate mUpdateTemplate;
+    DescriptorSetDesc mUpdateTemplateDesc;
 };
 
 struct DescriptorSetAndPoolIndex
@@ -326,6 +362,19 @@ class MetaDescriptorPool final : angle::NonCopyable
         return totalSize;
     }
 
+    size_t getTotalPoolCount() const
+    {
+        size_t totalCount = 0;
+
+        for (const auto &iter : mPayload)
+        {
+            const RefCountedDescriptorPool &pool = iter.second;
+            totalCount += pool.get().getPoolCount();
+        }
+
+        return totalCount;
+    }
+
   private:
     std::unordered_map<DescriptorSetLayoutDesc, RefCountedDescriptorPool> mPayload;
 };
@@ -747,7 +796,20 @@ enum class MemoryHostVisibility
     Visible
 };
 
-class BufferHelper : public ReadWriteResource
+// The expected lifetime of a suballocated buffer.  Buffers of each type are suballocated from
+// separate BufferPools, so that short-lived staging and streaming data don't fragment the blocks
+// holding long-lived static data.
+enum class BufferUsageType
+{
+    Static,
+    Dynamic,
+
+    InvalidEnum,
+    EnumCount = InvalidEnum,
+};
+
+// Buffers are created and destroyed often, so they are allocated from the slab allocator.
+class BufferHelper : public ReadWriteResource, public angle::SlabAllocated
 {
   public:
     BufferHelper();
@@ -766,7 +828,8 @@ class BufferHelper : public ReadWriteResource
     angle::Result initSuballocation(ContextVk *contextVk,
                                     uint32_t memoryTypeIndex,
                                     size_t size,
-                                    size_t alignment);
+                                    size_t alignment,
+                                    BufferUsageType usageType);
 
     // Helper functions to initialize a buffer for a specific usage
     // Suballocate a buffer with alignment good for shader storage or copyBuffer .
@@ -795,6 +858,10 @@ class BufferHelper : public ReadWriteResource
         return mSuballocation.getBlockSerial();
     }
     bool valid() const { return mSuballocation.valid(); }
+    bool isInEvacuatingBufferBlock() const
+    {
+        return mSuballocation.valid() && mSuballocation.isInEvacuatingBlock();
+    }
     const Buffer &getBuffer() const { return mSuballocation.getBuffer(); }
     VkDeviceSize getOffset() const { return mSuballocation.getOffset(); }
     VkDeviceSize getSize() const { return mSuballocation.getSize(); }
@@ -820,6 +887,12 @@ class BufferHelper : public ReadWriteResource
                                  BufferHelper *srcBuffer,
                                  uint32_t regionCount,
                                  const VkBufferCopy *copyRegions);
+    // Copies |srcBuffer|, which must have been written by the host only, on the transfer queue.
+    // The written range is then acquired by the graphics queue in the outside render pass command
+    // buffer.
+    angle::Result copyFromBufferOnTransferQueue(ContextVk *contextVk,
+                                                BufferHelper *srcBuffer,
+                                                const VkBufferCopy &copyRegion);
 
     angle::Result map(Context *context, uint8_t **ptrOut);
     angle::Result mapWithOffset(ContextVk *contextVk, uint8_t **ptrOut, size_t offset);
@@ -832,6 +905,11 @@ class BufferHelper : public ReadWriteResource
     angle::Result invalidate(RendererVk *renderer, VkDeviceSize offset, VkDeviceSize size);
 
     void changeQueue(uint32_t newQueueFamilyIndex, OutsideRenderPassCommandBuffer *commandBuffer);
+    // Same as changeQueue, but only transfers the ownership of a range of the VkBuffer.
+    void changeQueueOfRange(uint32_t newQueueFamilyIndex,
+                            VkDeviceSize offset,
+                            VkDeviceSize size,
+                            OutsideRenderPassCommandBuffer *commandBuffer);
 
     // Performs an ownership transfer from an external instance or API.
     void acquireFromExternal(ContextVk *contextVk,
@@ -923,6 +1001,7 @@ class BufferPool : angle::NonCopyable
     void pruneEmptyBuffers(RendererVk *renderer);
 
     bool valid() const { return mSize != 0; }
+    bool hasEvacuatingBlocks() const { return mEvacuatingBlockCount > 0; }
 
     void addStats(std::ostringstream *out) const;
     size_t getBufferCount() const { return mBufferBlocks.size() + mEmptyBufferBlocks.size(); }
@@ -931,6 +1010,8 @@ class BufferPool : angle::NonCopyable
   private:
     angle::Result allocateNewBuffer(Context *context, VkDeviceSize sizeInBytes);
     VkDeviceSize getTotalEmptyMemorySize() const;
+    // Marks the most sparsely used blocks as evacuating if the pool is fragmented.
+    void updateEvacuatingBlocks();
 
     vma::VirtualBlockCreateFlags mVirtualBlockCreateFlags;
     VkBufferUsageFlags mUsage;
@@ -943,11 +1024,13 @@ class BufferPool : angle::NonCopyable
     // Tracks the number of new buffers needed for suballocation since last pruneEmptyBuffers call.
     // We will use this heuristic information to decide how many empty buffers to keep around.
     size_t mNumberOfNewBuffersNeededSinceLastPrune;
+    size_t mEvacuatingBlockCount;
     // max size to go down the suballocation code path. Any allocation greater or equal this size
     // will call into vulkan directly to allocate a dedicated VkDeviceMemory.
     static constexpr size_t kMaxBufferSizeForSuballocation = 4 * 1024 * 1024;
 };
 using BufferPoolPointerArray = std::array<std::unique_ptr<BufferPool>, VK_MAX_MEMORY_TYPES>;
+using BufferPoolPointerArrays = angle::PackedEnumMap<BufferUsageType, BufferPoolPointerArray>;
 
 enum class BufferAccess
 {
@@ -1202,6 +1285,20 @@ class OutsideRenderPassCommandBufferHelper final : public CommandBufferHelperCom
                     ImageLayout imageLayout,
                     ImageHelper *image);
 
+    // Record the barrier needed before a command accesses |image|.  If the image is not yet used
+    // by this command buffer, the barrier is deferred to before the command buffer, where it's
+    // batched with the barriers of other such resources.  Otherwise, it's recorded inline.
+    void recordImageReadBarrier(ContextVk *contextVk,
+                                VkImageAspectFlags aspectFlags,
+                                ImageLayout imageLayout,
+                                ImageHelper *image);
+    void recordImageWriteBarrier(ContextVk *contextVk,
+                                 VkImageAspectFlags aspectFlags,
+                                 ImageLayout imageLayout,
+                                 ImageHelper *image);
+
+    bool usesImage(const ImageHelper &image) const;
+
     angle::Result flushToPrimary(Context *context, PrimaryCommandBuffer *primary);
 
     void setGLMemoryBarrierIssued()
@@ -1220,6 +1317,115 @@ class OutsideRenderPassCommandBufferHelper final : public CommandBufferHelperCom
     OutsideRenderPassCommandBuffer mCommandBuffer;
 };
 
+// Vulkan secondary command buffers that large render passes are replayed into, each allocated
+// from its own command pool as command pools are externally synchronized.
+class ReplayCommandBufferList final : angle::NonCopyable
+{
+  public:
+    ReplayCommandBufferList();
+    ~ReplayCommandBufferList();
+    ReplayCommandBufferList(ReplayCommandBufferList &&other);
+    ReplayCommandBufferList &operator=(ReplayCommandBufferList &&other);
+
+    void destroy(VkDevice device);
+    // Reset the command pools, which returns the command buffers to the initial state.
+    VkResult reset(VkDevice device);
+
+    bool empty() const { return mCommandBuffers.empty(); }
+    size_t size() const { return mCommandBuffers.size(); }
+
+    void push(CommandPool &&commandPool, priv::CommandBuffer &&commandBuffer);
+    // Move the last command buffer and its pool to |other|.
+    void popInto(ReplayCommandBufferList *other);
+
+    priv::CommandBuffer *getCommandBuffers(size_t index) { return &mCommandBuffers[index]; }
+
+  private:
+    std::vector<CommandPool> mCommandPools;
+    std::vector<priv::CommandBuffer> mCommandBuffers;
+};
+
+// Replays large render passes recorded in ANGLE's custom command buffers into Vulkan secondary
+// command buffers on worker threads, to be executed in the primary command buffer.  This offloads
+// the vkCmd* calls of render passes that contain many draw calls from the thread that records the
+// primary command buffer.  The Vulkan command buffers used by a submission are handed to its
+// CommandBatch, and are recycled once the submission has finished.
+class ParallelCommandReplayer final : angle::NonCopyable
+{
+  public:
+    // Subpasses are split into ranges of this many draw calls.  Subpasses with fewer draw calls
+    // are replayed inline in the primary command buffer.
+    static constexpr uint32_t kDrawsPerRange = 2048;
+
+    ParallelCommandReplayer();
+    ~ParallelCommandReplayer();
+
+    void init(uint32_t queueFamilyIndex);
+    void destroy(VkDevice device);
+
+    bool valid() const { return mWorkerThreadPool != nullptr; }
+
+    // Replay |ranges| of |commandBuffer| into Vulkan secondary command buffers in parallel, and
+    // execute them in |primary|.  The current subpass of |primary| must have been started with
+    // VK_SUBPASS_CONTENTS_SECONDARY_COMMAND_BUFFERS.
+    angle::Result replayCommandRanges(Context *context,
+                                      const priv::SecondaryCommandBuffer &commandBuffer,
+                                      const std::vector<priv::CommandRange> &ranges,
+                                      const VkCommandBufferInheritanceInfo &inheritanceInfo,
+                                      PrimaryCommandBuffer *primary);
+
+    // Take the command buffers executed in the primary command buffer that is being submitted.
+    void releaseInFlightCommandBuffers(ReplayCommandBufferList *commandBuffersOut);
+    // Reset and reuse the command buffers of a finished submission.
+    angle::Result recycleCommandBuffers(Context *context, ReplayCommandBufferList *commandBuffers);
+
+  private:
+    angle::Result acquireCommandBuffer(Context *context);
+
+    std::shared_ptr<angle::WorkerThreadPool> mWorkerThreadPool;
+    uint32_t mQueueFamilyIndex;
+
+    ReplayCommandBufferList mFreeCommandBuffers;
+    ReplayCommandBufferList mInFlightCommandBuffers;
+};
+
+// A framebuffer, along with the image views it is used with if it's imageless.  Imageless
+// framebuffers only depend on the properties of their attachments, so the same framebuffer is used
+// with different attachments, and the image views are given when the render pass begins.
+class MaybeImagelessFramebuffer final
+{
+  public:
+    MaybeImagelessFramebuffer() : mHandle(VK_NULL_HANDLE) {}
+
+    void setHandle(VkFramebuffer handle)
+    {
+        mHandle = handle;
+        mImageViews.clear();
+    }
+    void setImageless(VkFramebuffer handle, const FramebufferAttachmentsVector<VkImageView> &views)
+    {
+        ASSERT(!views.empty());
+        mHandle     = handle;
+        mImageViews = views;
+    }
+    void reset() { setHandle(VK_NULL_HANDLE); }
+
+    bool valid() const { return mHandle != VK_NULL_HANDLE; }
+    VkFramebuffer getHandle() const { return mHandle; }
+    bool isImageless() const { return !mImageViews.empty(); }
+    const FramebufferAttachmentsVector<VkImageView> &getImageViews() const { return mImageViews; }
+
+    bool operator==(const MaybeImagelessFramebuffer &other) const
+    {
+        return mHandle == other.mHandle && mImageViews == other.mImageViews;
+    }
+    bool operator!=(const MaybeImagelessFramebuffer &other) const { return !(*this == other); }
+
+  private:
+    VkFramebuffer mHandle;
+    FramebufferAttachmentsVector<VkImageView> mImageViews;
+};
+
 class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
 {
   public:
@@ -1230,15 +1436,39 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
 
     angle::Result reset(Context *context);
 
-    RenderPassCommandBuffer &getCommandBuffer() { return mCommandBuffers[mCurrentSubpass]; }
+    // Any clears queued with queueClearAttachments are recorded before the command buffer is
+    // returned, so they remain ordered with the commands that follow.
+    RenderPassCommandBuffer &getCommandBuffer()
+    {
+        if (ANGLE_UNLIKELY(hasPendingClearAttachments()))
+        {
+            flushPendingClearAttachments();
+        }
+        return mCommandBuffers[mCurrentSubpass];
+    }
 
     bool empty() const { return !started(); }
 
+    // Whether any command has been recorded in the current subpass, including queued clears.
+    bool hasCommands() const
+    {
+        return hasPendingClearAttachments() || !mCommandBuffers[mCurrentSubpass].empty();
+    }
+
 #if defined(ANGLE_ENABLE_ASSERTS)
-    void markOpen() { getCommandBuffer().open(); }
-    void markClosed() { getCommandBuffer().close(); }
+    void markOpen() { mCommandBuffers[mCurrentSubpass].open(); }
+    void markClosed() { mCommandBuffers[mCurrentSubpass].close(); }
 #endif
 
+    // Clears issued back to back, such as glClearBuffer* calls on individual draw buffers followed
+    // by scissored clears, are accumulated here so that clears of the same attachments to the same
+    // values are recorded as one vkCmdClearAttachments call with many rects.  The clears are
+    // recorded when the next command is recorded in the render pass.
+    void queueClearAttachments(const gl::AttachmentVector<VkClearAttachment> &attachments,
+                               const VkClearRect &rect);
+    bool hasPendingClearAttachments() const { return !mPendingClearRects.empty(); }
+    void flushPendingClearAttachments();
+
     void imageRead(ContextVk *contextVk,
                    VkImageAspectFlags aspectFlags,
                    ImageLayout imageLayout,
@@ -1266,9 +1496,11 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     bool usesImage(const ImageHelper &image) const;
     bool isImageWithLayoutTransition(const ImageHelper &image) const;
 
+    // If |replayer| is not null, large subpasses may be replayed in parallel.
     angle::Result flushToPrimary(Context *context,
                                  PrimaryCommandBuffer *primary,
-                                 const RenderPass *renderPass);
+                                 const RenderPass *renderPass,
+                                 ParallelCommandReplayer *replayer);
 
     bool started() const { return mRenderPassStarted; }
 
@@ -1276,7 +1508,7 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     void finalizeImageLayout(Context *context, const ImageHelper *image);
 
     angle::Result beginRenderPass(ContextVk *contextVk,
-                                  const Framebuffer &framebuffer,
+                                  const MaybeImagelessFramebuffer &framebuffer,
                                   const gl::Rectangle &renderArea,
                                   const RenderPassDesc &renderPassDesc,
                                   const AttachmentOpsArray &renderPassAttachmentOps,
@@ -1331,6 +1563,8 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     }
 
     VkFramebuffer getFramebufferHandle() const { return mFramebuffer.getHandle(); }
+    const MaybeImagelessFramebuffer &getFramebuffer() const { return mFramebuffer; }
+    uint32_t getCurrentSubpass() const { return mCurrentSubpass; }
 
     void onColorAccess(PackedAttachmentIndex packedAttachmentIndex, ResourceAccess access);
     void onDepthAccess(ResourceAccess access);
@@ -1345,7 +1579,7 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     bool hasAnyStencilAccess() { return mStencilAttachment.hasAnyAccess(); }
 
     void updateRenderPassForResolve(ContextVk *contextVk,
-                                    Framebuffer *newFramebuffer,
+                                    const MaybeImagelessFramebuffer &newFramebuffer,
                                     const RenderPassDesc &renderPassDesc);
 
     bool hasDepthStencilWriteOrClear() const
@@ -1368,6 +1602,12 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
             mHasGLMemoryBarrierIssued = true;
         }
     }
+    void setGLMemoryBarrierDeferred()
+    {
+        ASSERT(mRenderPassStarted);
+        mHasDeferredGLMemoryBarrier = true;
+    }
+    bool hasDeferredGLMemoryBarrier() const { return mHasDeferredGLMemoryBarrier; }
     void addCommandDiagnostics(ContextVk *contextVk);
 
   private:
@@ -1408,14 +1648,21 @@ class RenderPassCommandBufferHelper final : public CommandBufferHelperCommon
     std::array<RenderPassCommandBuffer, kMaxSubpassCount> mCommandBuffers;
     uint32_t mCurrentSubpass;
 
+    // Clears queued by queueClearAttachments that are yet to be recorded.
+    gl::AttachmentVector<VkClearAttachment> mPendingClearAttachments;
+    std::vector<VkClearRect> mPendingClearRects;
+
     // RenderPass state
     uint32_t mCounter;
     RenderPassDesc mRenderPassDesc;
     AttachmentOpsArray mAttachmentOps;
-    Framebuffer mFramebuffer;
+    MaybeImagelessFramebuffer mFramebuffer;
     gl::Rectangle mRenderArea;
     PackedClearValuesArray mClearValues;
     bool mRenderPassStarted;
+    // Whether glMemoryBarrier has been called after storage writes in this render pass, and
+    // breaking the render pass is deferred until a draw or dispatch depends on those writes.
+    bool mHasDeferredGLMemoryBarrier;
 
     // Transform feedback state
     gl::TransformFeedbackBuffersArray<VkBuffer> mTransformFeedbackCounterBuffers;
@@ -1611,7 +1858,7 @@ bool CanCopyWithTransfer(RendererVk *renderer,
                          angle::FormatID dstFormatID,
                          VkImageTiling dstTilingMode);
 class ImageViewHelper;
-class ImageHelper final : public Resource, public angle::Subject
+class ImageHelper final : public Resource, public angle::Subject, public angle::SlabAllocated
 {
   public:
     ImageHelper();
@@ -1782,6 +2029,11 @@ class ImageHelper final : public Resource, public angle::Subject
     VkImageTiling getTilingMode() const { return mTilingMode; }
     VkImageCreateFlags getCreateFlags() const { return mCreateFlags; }
     VkImageUsageFlags getUsage() const { return mUsage; }
+    // The formats of the VkImageFormatListCreateInfo the image is created with, which imageless
+    // framebuffers are created with.  They are only known for the images created by initExternal.
+    bool hasKnownViewFormats() const { return mHasKnownViewFormats; }
+    uint32_t getViewFormatCount() const { return mViewFormatCount; }
+    const VkFormat *getViewFormats() const { return mViewFormats.data(); }
     VkImageType getType() const { return mImageType; }
     const VkExtent3D &getExtents() const { return mExtents; }
     const VkExtent3D getRotatedExtents() const;
@@ -1930,6 +2182,21 @@ class ImageHelper final : public Resource, public angle::Subject
                                          const Format &vkFormat,
                                          ImageAccess access);
 
+    // Copies the pixels of an update straight to the image on the host with
+    // VK_EXT_host_image_copy, if the image allows it and is not in use by the GPU.  Otherwise,
+    // |copiedOut| is set to false and the update should be staged instead.
+    angle::Result updateSubresourceOnHost(ContextVk *contextVk,
+                                          const gl::ImageIndex &index,
+                                          const gl::Extents &glExtents,
+                                          const gl::Offset &offset,
+                                          const gl::InternalFormat &formatInfo,
+                                          const gl::PixelUnpackState &unpack,
+                                          GLenum type,
+                                          const uint8_t *pixels,
+                                          const Format &vkFormat,
+                                          ImageAccess access,
+                                          bool *copiedOut);
+
     angle::Result stageSubresourceUpdateAndGetData(ContextVk *contextVk,
                                                    size_t allocationSize,
                                                    const gl::ImageIndex &imageIndex,
@@ -1938,6 +2205,20 @@ class ImageHelper final : public Resource, public angle::Subject
                                                    uint8_t **destData,
                                                    angle::FormatID formatID);
 
+    // Stages an update from a buffer that can be modified before the update is applied, such as
+    // a pixel unpack buffer.  The data is copied on the GPU to a staging buffer.
+    angle::Result stageSubresourceUpdateFromBuffer(ContextVk *contextVk,
+                                                   BufferHelper *srcBuffer,
+                                                   VkDeviceSize srcOffset,
+                                                   size_t size,
+                                                   const gl::ImageIndex &index,
+                                                   const gl::Extents &glExtents,
+                                                   const gl::Offset &offset,
+                                                   uint32_t rowLength,
+                                                   uint32_t imageHeight,
+                                                   VkImageAspectFlags aspectFlags,
+                                                   angle::FormatID formatID);
+
     angle::Result stageSubresourceUpdateFromFramebuffer(const gl::Context *context,
                                                         const gl::ImageIndex &index,
                                                         const gl::Rectangle &sourceArea,
@@ -2016,6 +2297,8 @@ class ImageHelper final : public Resource, public angle::Subject
                                         uint32_t layer,
                                         uint32_t layerCount) const;
     bool hasStagedUpdatesInAllocatedLevels() const;
+    // Returns one past the last level that has staged updates, or 0 if there are none.
+    gl::LevelIndex getStagedUpdatesLevelEnd() const;
 
     bool removeStagedClearUpdatesAndReturnColor(gl::LevelIndex levelGL,
                                                 const VkClearColorValue **color);
@@ -2085,6 +2368,10 @@ class ImageHelper final : public Resource, public angle::Subject
     // Returns true if the image is owned by an external API or instance.
     bool isReleasedToExternal() const;
 
+    // Puts an image that stays bound to imported memory back in the state it was imported in, as
+    // its external owner may have modified it since.
+    void resetToExternalImport(uint32_t externalQueueFamilyIndex);
+
     gl::LevelIndex getFirstAllocatedLevel() const
     {
         ASSERT(valid());
@@ -2308,6 +2595,7 @@ class ImageHelper final : public Resource, public angle::Subject
     static constexpr uint32_t kMaxContentDefinedLayerCount = 8;
     using LevelContentDefinedMask = angle::BitSet8<kMaxContentDefinedLayerCount>;
 
+    void deriveViewFormats(const void *createInfoChain);
     void deriveExternalImageTiling(const void *createInfoChain);
 
     // Called from flushStagedUpdates, removes updates that are later superseded by another.  This
@@ -2315,6 +2603,16 @@ class ImageHelper final : public Resource, public angle::Subject
     // extents are not known).
     void removeSupersededUpdates(ContextVk *contextVk, gl::TexLevelMask skipLevelsMask);
 
+    // Called from flushStagedUpdates, copies all the updates of a new image on the transfer queue
+    // if they are buffer updates that are large enough.  |flushedOut| is false if the updates must
+    // be flushed on the graphics queue instead.
+    angle::Result flushStagedUpdatesOnTransferQueue(ContextVk *contextVk,
+                                                    gl::LevelIndex levelGLStart,
+                                                    gl::LevelIndex levelGLEnd,
+                                                    uint32_t layerStart,
+                                                    uint32_t layerEnd,
+                                                    bool *flushedOut);
+
     void initImageMemoryBarrierStruct(VkImageAspectFlags aspectMask,
                                       ImageLayout newLayout,
                                       uint32_t newQueueFamilyIndex,
@@ -2338,6 +2636,7 @@ class ImageHelper final : public Resource, public angle::Subject
     void clear(VkImageAspectFlags aspectFlags,
                const VkClearValue &value,
                LevelIndex mipLevel,
+               uint32_t levelCount,
                uint32_t baseArrayLayer,
                uint32_t layerCount,
                OutsideRenderPassCommandBuffer *commandBuffer);
@@ -2425,6 +2724,10 @@ class ImageHelper final : public Resource, public angle::Subject
 
     bool canCopyWithTransformForReadPixels(const PackPixelsParams &packPixelsParams,
                                            const angle::Format *readFormat);
+    bool canBlitWithTransformForReadPixels(ContextVk *contextVk,
+                                           const PackPixelsParams &packPixelsParams,
+                                           const angle::Format *readFormat,
+                                           VkImageAspectFlagBits copyAspectFlags);
     // Vulkan objects.
     Image mImage;
     DeviceMemory mDeviceMemory;
@@ -2435,6 +2738,9 @@ class ImageHelper final : public Resource, public angle::Subject
     VkImageTiling mTilingMode;
     VkImageCreateFlags mCreateFlags;
     VkImageUsageFlags mUsage;
+    bool mHasKnownViewFormats;
+    uint32_t mViewFormatCount;
+    ImageListFormats mViewFormats;
     // For Android swapchain images, the Vulkan VkImage must be "rotated".  However, most of ANGLE
     // uses non-rotated extents (i.e. the way the application views the extents--see "Introduction
     // to Android rotation and pre-rotation" in "SurfaceVk.cpp").  Thus, mExtents are non-rotated.
@@ -2483,6 +2789,11 @@ class ImageHelper final : public Resource, public angle::Subject
     std::vector<vk::GarbageObject> mImageAndViewGarbage;
 };
 
+ANGLE_INLINE bool OutsideRenderPassCommandBufferHelper::usesImage(const ImageHelper &image) const
+{
+    return image.usedByCommandBuffer(mID);
+}
+
 ANGLE_INLINE bool RenderPassCommandBufferHelper::usesImage(const ImageHelper &image) const
 {
     return image.usedByCommandBuffer(mID);
@@ -2900,6 +3211,8 @@ class ShaderProgramHelper : angle::NonCopyable
                                      PipelineSource source,
                                      PipelineHelper **pipelineOut);
 
+    const GraphicsPipelineCache &getGraphicsPipelineCache() const { return mGraphicsPipelines; }
+
   private:
     ShaderAndSerialMap mShaders;
     GraphicsPipelineCache mGraphicsPipelines;
@@ -3124,6 +3437,13 @@ class LineLoopHelper final : angle::NonCopyable
     static void Draw(uint32_t count, uint32_t baseVertex, RenderPassCommandBuffer *commandBuffer);
 
   private:
+    angle::Result streamIndicesImpl(ContextVk *contextVk,
+                                    gl::DrawElementsType glIndexType,
+                                    GLsizei indexCount,
+                                    const uint8_t *srcPtr,
+                                    BufferHelper *dstBuffer,
+                                    uint32_t *indexCountOut);
+
     BufferHelper mDynamicIndexBuffer;
     BufferHelper mDynamicIndirectBuffer;
 };
@@ -417,6 +417,17 @@ bool MemoryProperties::hasLazilyAllocatedMemory() const
     return false;
 }
 
+bool MemoryProperties::hasCompatibleLazilyAllocatedMemory(
+    const VkMemoryRequirements &memoryRequirements) const
+{
+    VkMemoryPropertyFlags memoryPropertyFlags = 0;
+    uint32_t typeIndex                        = 0;
+    return FindCompatibleMemory(mMemoryProperties, memoryRequirements,
+                                VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
+                                    VK_MEMORY_PROPERTY_LAZILY_ALLOCATED_BIT,
+                                &memoryPropertyFlags, &typeIndex);
+}
+
 angle::Result MemoryProperties::findCompatibleMemoryIndex(
     Context *context,
     const VkMemoryRequirements &memoryRequirements,
@@ -753,6 +764,10 @@ void GarbageObject::destroy(RendererVk *renderer)
         case HandleType::DescriptorSetLayout:
             vkDestroyDescriptorSetLayout(device, (VkDescriptorSetLayout)mHandle, nullptr);
             break;
+        case HandleType::DescriptorUpdateTemplate:
+            vkDestroyDescriptorUpdateTemplateKHR(device, (VkDescriptorUpdateTemplateKHR)mHandle,
+                                                 nullptr);
+            break;
         case HandleType::Sampler:
             vkDestroySampler(device, (VkSampler)mHandle, nullptr);
             break;
@@ -1037,6 +1052,23 @@ PFN_vkCmdSetRasterizerDiscardEnableEXT vkCmdSetRasterizerDiscardEnableEXT = null
 PFN_vkGetPhysicalDeviceFragmentShadingRatesKHR vkGetPhysicalDeviceFragmentShadingRatesKHR = nullptr;
 PFN_vkCmdSetFragmentShadingRateKHR vkCmdSetFragmentShadingRateKHR                         = nullptr;
 
+// VK_KHR_descriptor_update_template
+PFN_vkCreateDescriptorUpdateTemplateKHR vkCreateDescriptorUpdateTemplateKHR   = nullptr;
+PFN_vkDestroyDescriptorUpdateTemplateKHR vkDestroyDescriptorUpdateTemplateKHR = nullptr;
+PFN_vkUpdateDescriptorSetWithTemplateKHR vkUpdateDescriptorSetWithTemplateKHR = nullptr;
+
+// VK_KHR_timeline_semaphore
+PFN_vkGetSemaphoreCounterValueKHR vkGetSemaphoreCounterValueKHR = nullptr;
+PFN_vkWaitSemaphoresKHR vkWaitSemaphoresKHR                     = nullptr;
+
+// VK_KHR_present_wait
+PFN_vkWaitForPresentKHR vkWaitForPresentKHR = nullptr;
+
+// VK_EXT_calibrated_timestamps
+PFN_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT vkGetPhysicalDeviceCalibrateableTimeDomainsEXT =
+    nullptr;
+PFN_vkGetCalibratedTimestampsEXT vkGetCalibratedTimestampsEXT = nullptr;
+
 void InitDebugUtilsEXTFunctions(VkInstance instance)
 {
     GET_INSTANCE_FUNC(vkCreateDebugUtilsMessengerEXT);
@@ -1193,11 +1225,52 @@ void InitFragmentShadingRateKHRFunctions(VkDevice device)
     GET_DEVICE_FUNC(vkCmdSetFragmentShadingRateKHR);
 }
 
+// VK_KHR_descriptor_update_template
+void InitDescriptorUpdateTemplateKHRFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkCreateDescriptorUpdateTemplateKHR);
+    GET_DEVICE_FUNC(vkDestroyDescriptorUpdateTemplateKHR);
+    GET_DEVICE_FUNC(vkUpdateDescriptorSetWithTemplateKHR);
+}
+
+// VK_KHR_timeline_semaphore
+void InitTimelineSemaphoreKHRFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkGetSemaphoreCounterValueKHR);
+    GET_DEVICE_FUNC(vkWaitSemaphoresKHR);
+}
+
+// VK_KHR_present_wait
+void InitPresentWaitKHRFunctions(VkDevice device)
+{
+    GET_DEVICE_FUNC(vkWaitForPresentKHR);
+}
+
+// VK_EXT_calibrated_timestamps
+void InitCalibratedTimestampsEXTFunctions(VkInstance instance)
+{
+    GET_INSTANCE_FUNC(vkGetPhysicalDeviceCalibrateableTimeDomainsEXT);
+    GET_INSTANCE_FUNC(vkGetCalibratedTimestampsEXT);
+}
+
 #    undef GET_INSTANCE_FUNC
 #    undef GET_DEVICE_FUNC
 
 #endif  // !defined(ANGLE_SHARED_LIBVULKAN)
 
+// VK_EXT_host_image_copy
+PFN_vkCopyMemoryToImageEXT vkCopyMemoryToImageEXT         = nullptr;
+PFN_vkTransitionImageLayoutEXT vkTransitionImageLayoutEXT = nullptr;
+
+void InitHostImageCopyEXTFunctions(VkDevice device)
+{
+    vkCopyMemoryToImageEXT     = reinterpret_cast<PFN_vkCopyMemoryToImageEXT>(
+        vkGetDeviceProcAddr(device, "vkCopyMemoryToImageEXT"));
+    vkTransitionImageLayoutEXT = reinterpret_cast<PFN_vkTransitionImageLayoutEXT>(
+        vkGetDeviceProcAddr(device, "vkTransitionImageLayoutEXT"));
+    ASSERT(vkCopyMemoryToImageEXT && vkTransitionImageLayoutEXT);
+}
+
 GLenum CalculateGenerateMipmapFilter(ContextVk *contextVk, angle::FormatID formatID)
 {
     const bool formatSupportsLinearFiltering = contextVk->getRenderer()->hasImageFormatFeatureBits(
@@ -1684,7 +1757,9 @@ gl::LevelIndex GetLevelIndex(vk::LevelIndex levelVk, gl::LevelIndex baseLevel)
 namespace vk
 {
 // BufferBlock implementation.
-BufferBlock::BufferBlock() : mMemoryPropertyFlags(0), mSize(0), mMappedMemory(nullptr) {}
+BufferBlock::BufferBlock()
+    : mMemoryPropertyFlags(0), mSize(0), mMappedMemory(nullptr), mIsEvacuating(false)
+{}
 
 BufferBlock::BufferBlock(BufferBlock &&other)
     : mVirtualBlock(std::move(other.mVirtualBlock)),
@@ -1694,7 +1769,8 @@ BufferBlock::BufferBlock(BufferBlock &&other)
       mSize(other.mSize),
       mMappedMemory(other.mMappedMemory),
       mSerial(other.mSerial),
-      mCountRemainsEmpty(0)
+      mCountRemainsEmpty(0),
+      mIsEvacuating(other.mIsEvacuating)
 {}
 
 BufferBlock &BufferBlock::operator=(BufferBlock &&other)
@@ -1707,6 +1783,7 @@ BufferBlock &BufferBlock::operator=(BufferBlock &&other)
     std::swap(mMappedMemory, other.mMappedMemory);
     std::swap(mSerial, other.mSerial);
     std::swap(mCountRemainsEmpty, other.mCountRemainsEmpty);
+    std::swap(mIsEvacuating, other.mIsEvacuating);
     return *this;
 }
 
@@ -381,6 +381,7 @@ class MemoryProperties final : angle::NonCopyable
 
     void init(VkPhysicalDevice physicalDevice);
     bool hasLazilyAllocatedMemory() const;
+    bool hasCompatibleLazilyAllocatedMemory(const VkMemoryRequirements &memoryRequirements) const;
     angle::Result findCompatibleMemoryIndex(Context *context,
                                             const VkMemoryRequirements &memoryRequirements,
                                             VkMemoryPropertyFlags requestedMemoryPropertyFlags,
@@ -954,6 +955,11 @@ class BufferBlock final : angle::NonCopyable
     int32_t getAndIncrementEmptyCounter();
     void calculateStats(vma::StatInfo *pStatInfo) const;
 
+    // Set by BufferPool when this block is sparsely used.  New suballocations avoid evacuating
+    // blocks, and live ones are moved out of them so the block becomes empty and can be freed.
+    void setEvacuating(bool isEvacuating) { mIsEvacuating = isEvacuating; }
+    bool isEvacuating() const { return mIsEvacuating; }
+
   private:
     // Protect multi-thread access to mVirtualBlock, which could be possible when asyncCommandQueue
     // is enabled.
@@ -970,6 +976,7 @@ class BufferBlock final : angle::NonCopyable
     // buffer block is found to be empty when pruneEmptyBuffer is called. This gets reset whenever
     // it becomes non-empty.
     int32_t mCountRemainsEmpty;
+    bool mIsEvacuating;
 };
 using BufferBlockPointerVector = std::vector<std::unique_ptr<BufferBlock>>;
 
@@ -1008,6 +1015,7 @@ class BufferSuballocation final : angle::NonCopyable
     uint8_t *getBlockMemory() const;
     VkDeviceSize getBlockMemorySize() const;
     bool isSuballocated() const { return mBufferBlock->hasVirtualBlock(); }
+    bool isInEvacuatingBlock() const { return isSuballocated() && mBufferBlock->isEvacuating(); }
 
   private:
     // Only used by DynamicBuffer where DynamicBuffer does the actual suballocation and pass the
@@ -1356,8 +1364,23 @@ void InitExtendedDynamicState2EXTFunctions(VkDevice device);
 // VK_KHR_fragment_shading_rate
 void InitFragmentShadingRateKHRFunctions(VkDevice device);
 
+// VK_KHR_descriptor_update_template
+void InitDescriptorUpdateTemplateKHRFunctions(VkDevice device);
+
+// VK_KHR_timeline_semaphore
+void InitTimelineSemaphoreKHRFunctions(VkDevice device);
+
+// VK_KHR_present_wait
+void InitPresentWaitKHRFunctions(VkDevice device);
+
+// VK_EXT_calibrated_timestamps
+void InitCalibratedTimestampsEXTFunctions(VkInstance instance);
+
 #endif  // !defined(ANGLE_SHARED_LIBVULKAN)
 
+// VK_EXT_host_image_copy, loaded with either loader.
+void InitHostImageCopyEXTFunctions(VkDevice device);
+
 GLenum CalculateGenerateMipmapFilter(ContextVk *contextVk, angle::FormatID formatID);
 size_t PackSampleCount(GLint sampleCount);
 
@@ -1488,6 +1511,7 @@ enum class RenderPassClosureReason
     SyncObjectInit,
     SyncObjectWithFdInit,
     SyncObjectClientWait,
+    SyncObjectGetStatus,
     SyncObjectServerWait,
 
     // Closures that ANGLE could have avoided, but doesn't for simplicity or optimization of more
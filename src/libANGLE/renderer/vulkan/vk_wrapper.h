@@ -39,6 +39,7 @@ namespace vk
     FUNC(CommandPool)              \
     FUNC(DescriptorPool)           \
     FUNC(DescriptorSetLayout)      \
+    FUNC(DescriptorUpdateTemplate) \
     FUNC(DeviceMemory)             \
     FUNC(Event)                    \
     FUNC(Fence)                    \
@@ -339,6 +340,7 @@ class CommandBuffer : public WrappedObject<CommandBuffer, VkCommandBuffer>
     void setFrontFace(VkFrontFace frontFace);
     void setLineWidth(float lineWidth);
     void setPrimitiveRestartEnable(VkBool32 primitiveRestartEnable);
+    void setPrimitiveTopology(VkPrimitiveTopology primitiveTopology);
     void setRasterizerDiscardEnable(VkBool32 rasterizerDiscardEnable);
     void setScissor(uint32_t firstScissor, uint32_t scissorCount, const VkRect2D *scissors);
     void setStencilCompareMask(uint32_t compareFrontMask, uint32_t compareBackMask);
@@ -443,6 +445,11 @@ class Semaphore final : public WrappedObject<Semaphore, VkSemaphore>
 
     VkResult init(VkDevice device);
     VkResult importFd(VkDevice device, const VkImportSemaphoreFdInfoKHR &importFdInfo) const;
+
+    // Timeline semaphores (VK_KHR_timeline_semaphore).
+    VkResult initTimeline(VkDevice device, uint64_t initialValue);
+    VkResult getCounterValue(VkDevice device, uint64_t *valueOut) const;
+    VkResult wait(VkDevice device, uint64_t value, uint64_t timeout) const;
 };
 
 class Framebuffer final : public WrappedObject<Framebuffer, VkFramebuffer>
@@ -599,6 +606,18 @@ class DescriptorSetLayout final : public WrappedObject<DescriptorSetLayout, VkDe
     VkResult init(VkDevice device, const VkDescriptorSetLayoutCreateInfo &createInfo);
 };
 
+class DescriptorUpdateTemplate final
+    : public WrappedObject<DescriptorUpdateTemplate, VkDescriptorUpdateTemplateKHR>
+{
+  public:
+    DescriptorUpdateTemplate() = default;
+    void destroy(VkDevice device);
+
+    VkResult init(VkDevice device, const VkDescriptorUpdateTemplateCreateInfoKHR &createInfo);
+
+    void updateDescriptorSet(VkDevice device, VkDescriptorSet descriptorSet, const void *data) const;
+};
+
 class DescriptorPool final : public WrappedObject<DescriptorPool, VkDescriptorPool>
 {
   public:
@@ -1050,6 +1069,12 @@ ANGLE_INLINE void CommandBuffer::setPrimitiveRestartEnable(VkBool32 primitiveRes
     vkCmdSetPrimitiveRestartEnableEXT(mHandle, primitiveRestartEnable);
 }
 
+ANGLE_INLINE void CommandBuffer::setPrimitiveTopology(VkPrimitiveTopology primitiveTopology)
+{
+    ASSERT(valid());
+    vkCmdSetPrimitiveTopologyEXT(mHandle, primitiveTopology);
+}
+
 ANGLE_INLINE void CommandBuffer::setRasterizerDiscardEnable(VkBool32 rasterizerDiscardEnable)
 {
     ASSERT(valid());
@@ -1427,6 +1452,44 @@ ANGLE_INLINE VkResult Semaphore::init(VkDevice device)
     return vkCreateSemaphore(device, &semaphoreInfo, nullptr, &mHandle);
 }
 
+ANGLE_INLINE VkResult Semaphore::initTimeline(VkDevice device, uint64_t initialValue)
+{
+    ASSERT(!valid());
+
+    VkSemaphoreTypeCreateInfoKHR semaphoreTypeInfo = {};
+
+    semaphoreTypeInfo.sType         = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO_KHR;
+    semaphoreTypeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE_KHR;
+    semaphoreTypeInfo.initialValue  = initialValue;
+
+    VkSemaphoreCreateInfo semaphoreInfo = {};
+    semaphoreInfo.sType                 = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    semaphoreInfo.pNext                 = &semaphoreTypeInfo;
+    semaphoreInfo.flags                 = 0;
+
+    return vkCreateSemaphore(device, &semaphoreInfo, nullptr, &mHandle);
+}
+
+ANGLE_INLINE VkResult Semaphore::getCounterValue(VkDevice device, uint64_t *valueOut) const
+{
+    ASSERT(valid());
+    return vkGetSemaphoreCounterValueKHR(device, mHandle, valueOut);
+}
+
+ANGLE_INLINE VkResult Semaphore::wait(VkDevice device, uint64_t value, uint64_t timeout) const
+{
+    ASSERT(valid());
+
+    VkSemaphoreWaitInfoKHR waitInfo = {};
+    waitInfo.sType                  = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO_KHR;
+    waitInfo.flags                  = 0;
+    waitInfo.semaphoreCount         = 1;
+    waitInfo.pSemaphores            = &mHandle;
+    waitInfo.pValues                = &value;
+
+    return vkWaitSemaphoresKHR(device, &waitInfo, timeout);
+}
+
 ANGLE_INLINE VkResult Semaphore::importFd(VkDevice device,
                                           const VkImportSemaphoreFdInfoKHR &importFdInfo) const
 {
@@ -1795,6 +1858,32 @@ ANGLE_INLINE VkResult DescriptorSetLayout::init(VkDevice device,
     return vkCreateDescriptorSetLayout(device, &createInfo, nullptr, &mHandle);
 }
 
+// DescriptorUpdateTemplate implementation.
+ANGLE_INLINE void DescriptorUpdateTemplate::destroy(VkDevice device)
+{
+    if (valid())
+    {
+        vkDestroyDescriptorUpdateTemplateKHR(device, mHandle, nullptr);
+        mHandle = VK_NULL_HANDLE;
+    }
+}
+
+ANGLE_INLINE VkResult
+DescriptorUpdateTemplate::init(VkDevice device,
+                               const VkDescriptorUpdateTemplateCreateInfoKHR &createInfo)
+{
+    ASSERT(!valid());
+    return vkCreateDescriptorUpdateTemplateKHR(device, &createInfo, nullptr, &mHandle);
+}
+
+ANGLE_INLINE void DescriptorUpdateTemplate::updateDescriptorSet(VkDevice device,
+                                                                VkDescriptorSet descriptorSet,
+                                                                const void *data) const
+{
+    ASSERT(valid());
+    vkUpdateDescriptorSetWithTemplateKHR(device, descriptorSet, mHandle, data);
+}
+
 // DescriptorPool implementation.
 ANGLE_INLINE void DescriptorPool::destroy(VkDevice device)
 {
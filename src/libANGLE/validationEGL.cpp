@@ -2494,6 +2494,21 @@ bool ValidateCreateWindowSurface(const ValidationContext *val,
                 }
                 break;
 
+            case EGL_LOW_LATENCY_PRESENT_ANGLE:
+                if (!displayExtensions.lowLatencyPresentANGLE)
+                {
+                    val->setError(EGL_BAD_ATTRIBUTE,
+                                  "EGL_ANGLE_low_latency_present is not enabled.");
+                    return false;
+                }
+                if (value != EGL_TRUE && value != EGL_FALSE)
+                {
+                    val->setError(EGL_BAD_ATTRIBUTE,
+                                  "EGL_LOW_LATENCY_PRESENT_ANGLE must be EGL_TRUE or EGL_FALSE.");
+                    return false;
+                }
+                break;
+
             case EGL_VG_COLORSPACE:
                 if (value != EGL_VG_COLORSPACE_sRGB)
                 {
@@ -5109,6 +5124,9 @@ bool ValidateProgramCacheGetAttribANGLE(const ValidationContext *val,
     {
         case EGL_PROGRAM_CACHE_KEY_LENGTH_ANGLE:
         case EGL_PROGRAM_CACHE_SIZE_ANGLE:
+        case EGL_PROGRAM_CACHE_HIT_COUNT_ANGLE:
+        case EGL_PROGRAM_CACHE_MISS_COUNT_ANGLE:
+        case EGL_PROGRAM_CACHE_EVICTION_COUNT_ANGLE:
             break;
 
         default:
@@ -5467,6 +5485,16 @@ bool ValidateQuerySurface(const ValidationContext *val,
             }
             break;
 
+        case EGL_PRESENT_LATENCY_ANGLE:
+            if (!display->getExtensions().lowLatencyPresentANGLE)
+            {
+                val->setError(EGL_BAD_ATTRIBUTE,
+                              "EGL_PRESENT_LATENCY_ANGLE cannot be used without "
+                              "EGL_ANGLE_low_latency_present support.");
+                return false;
+            }
+            break;
+
         case EGL_BUFFER_AGE_EXT:
         {
             if (!display->getExtensions().bufferAgeEXT)
@@ -6097,6 +6125,13 @@ bool ValidateQuerySurfacePointerANGLE(const ValidationContext *val,
                 return false;
             }
             break;
+        case EGL_FRAME_LATENCY_WAITABLE_OBJECT_ANGLE:
+            if (!display->getExtensions().frameLatencyWaitableObjectANGLE)
+            {
+                val->setError(EGL_BAD_ATTRIBUTE);
+                return false;
+            }
+            break;
         default:
             val->setError(EGL_BAD_ATTRIBUTE);
             return false;
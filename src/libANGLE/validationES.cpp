@@ -4038,24 +4038,31 @@ const char *ValidateProgramPipelineAttachedPrograms(ProgramPipeline *programPipe
     return nullptr;
 }
 
-// Note all errors returned from this function are INVALID_OPERATION except for the draw framebuffer
-// completeness check.
-const char *ValidateDrawStates(const Context *context)
+// The draw state checks are split by the state they depend on so that StateCache can redo only
+// the checks affected by a state change.  Together, in this order, they make up
+// ValidateDrawStates.
+const char *ValidateDrawVertexArrayBufferStates(const Context *context)
 {
-    const Extensions &extensions = context->getExtensions();
-    const State &state           = context->getState();
-
     // WebGL buffers cannot be mapped/unmapped because the MapBufferRange, FlushMappedBufferRange,
     // and UnmapBuffer entry points are removed from the WebGL 2.0 API.
     // https://www.khronos.org/registry/webgl/specs/latest/2.0/#5.14
-    VertexArray *vertexArray = state.getVertexArray();
+    const VertexArray *vertexArray = context->getState().getVertexArray();
     ASSERT(vertexArray);
 
-    if (!extensions.webglCompatibilityANGLE && vertexArray->hasInvalidMappedArrayBuffer())
+    if (!context->getExtensions().webglCompatibilityANGLE &&
+        vertexArray->hasInvalidMappedArrayBuffer())
     {
         return kBufferMapped;
     }
 
+    return nullptr;
+}
+
+const char *ValidateDrawFramebufferStates(const Context *context)
+{
+    const Extensions &extensions = context->getExtensions();
+    const State &state           = context->getState();
+
     // Note: these separate values are not supported in WebGL, due to D3D's limitations. See
     // Section 6.10 of the WebGL 1.0 spec.
     Framebuffer *framebuffer = state.getDrawFramebuffer();
@@ -4127,8 +4134,7 @@ const char *ValidateDrawStates(const Context *context)
         return kDrawFramebufferIncomplete;
     }
 
-    bool framebufferIsYUV = framebuffer->hasYUVAttachment();
-    if (framebufferIsYUV)
+    if (framebuffer->hasYUVAttachment())
     {
         const BlendState &blendState = state.getBlendState();
         if (!blendState.colorMaskRed || !blendState.colorMaskGreen || !blendState.colorMaskBlue)
@@ -4177,6 +4183,14 @@ const char *ValidateDrawStates(const Context *context)
         }
     }
 
+    return nullptr;
+}
+
+const char *ValidateDrawClientAttribStates(const Context *context)
+{
+    const Extensions &extensions = context->getExtensions();
+    const State &state           = context->getState();
+
     if (context->getStateCache().hasAnyEnabledClientAttrib())
     {
         if (extensions.webglCompatibilityANGLE || !state.areClientArraysEnabled())
@@ -4196,6 +4210,16 @@ const char *ValidateDrawStates(const Context *context)
         }
     }
 
+    return nullptr;
+}
+
+const char *ValidateDrawProgramStates(const Context *context)
+{
+    const Extensions &extensions = context->getExtensions();
+    const State &state           = context->getState();
+    Framebuffer *framebuffer     = state.getDrawFramebuffer();
+    ASSERT(framebuffer);
+
     // If we are running GLES1, there is no current program.
     if (context->getClientVersion() >= Version(2, 0))
     {
@@ -4267,7 +4291,7 @@ const char *ValidateDrawStates(const Context *context)
             }
         }
 
-        if (programIsYUVOutput != framebufferIsYUV)
+        if (programIsYUVOutput != framebuffer->hasYUVAttachment())
         {
             // Both the program and framebuffer must match in YUV output state.
             return kYUVOutputMissmatch;
@@ -4333,6 +4357,31 @@ const char *ValidateDrawStates(const Context *context)
     return nullptr;
 }
 
+// Note all errors returned from this function are INVALID_OPERATION except for the draw framebuffer
+// completeness check.
+const char *ValidateDrawStates(const Context *context)
+{
+    const char *errorMsg = ValidateDrawVertexArrayBufferStates(context);
+    if (errorMsg)
+    {
+        return errorMsg;
+    }
+
+    errorMsg = ValidateDrawFramebufferStates(context);
+    if (errorMsg)
+    {
+        return errorMsg;
+    }
+
+    errorMsg = ValidateDrawClientAttribStates(context);
+    if (errorMsg)
+    {
+        return errorMsg;
+    }
+
+    return ValidateDrawProgramStates(context);
+}
+
 void RecordDrawModeError(const Context *context, angle::EntryPoint entryPoint, PrimitiveMode mode)
 {
     const State &state                      = context->getState();
@@ -952,6 +952,10 @@ const char *ValidateProgramPipelineDrawStates(const State &state,
                                               const Extensions &extensions,
                                               ProgramPipeline *programPipeline);
 const char *ValidateProgramPipelineAttachedPrograms(ProgramPipeline *programPipeline);
+const char *ValidateDrawVertexArrayBufferStates(const Context *context);
+const char *ValidateDrawFramebufferStates(const Context *context);
+const char *ValidateDrawClientAttribStates(const Context *context);
+const char *ValidateDrawProgramStates(const Context *context);
 const char *ValidateDrawStates(const Context *context);
 
 void RecordDrawAttribsError(const Context *context, angle::EntryPoint entryPoint);
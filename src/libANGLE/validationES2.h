@@ -21,7 +21,21 @@ ANGLE_INLINE bool ValidateDrawArrays(const Context *context,
                                      GLint first,
                                      GLsizei count)
 {
-    return ValidateDrawArraysCommon(context, entryPoint, mode, first, count, 1);
+    ScopedCpuTimePhase cpuTimePhase(context->getState().getOverlay(), CpuTimePhase::Validation);
+
+    if (!ValidateDrawArraysCommon(context, entryPoint, mode, first, count, 1))
+    {
+        return false;
+    }
+
+    if (ANGLE_UNLIKELY(context->isRecordingCommandStream()) &&
+        context->getStateCache().hasAnyEnabledClientAttrib())
+    {
+        context->validationError(entryPoint, GL_INVALID_OPERATION, err::kCommandStreamClientMemory);
+        return false;
+    }
+
+    return true;
 }
 
 ANGLE_INLINE bool ValidateUniform2f(const Context *context,
@@ -61,7 +75,22 @@ ANGLE_INLINE bool ValidateDrawElements(const Context *context,
                                        DrawElementsType type,
                                        const void *indices)
 {
-    return ValidateDrawElementsCommon(context, entryPoint, mode, count, type, indices, 1);
+    ScopedCpuTimePhase cpuTimePhase(context->getState().getOverlay(), CpuTimePhase::Validation);
+
+    if (!ValidateDrawElementsCommon(context, entryPoint, mode, count, type, indices, 1))
+    {
+        return false;
+    }
+
+    if (ANGLE_UNLIKELY(context->isRecordingCommandStream()) &&
+        (context->getStateCache().hasAnyEnabledClientAttrib() ||
+         context->getState().getVertexArray()->getElementArrayBuffer() == nullptr))
+    {
+        context->validationError(entryPoint, GL_INVALID_OPERATION, err::kCommandStreamClientMemory);
+        return false;
+    }
+
+    return true;
 }
 
 ANGLE_INLINE bool ValidateVertexAttribPointer(const Context *context,
@@ -3762,6 +3762,8 @@ bool ValidateDrawElementsInstanced(const Context *context,
                                    const void *indices,
                                    GLsizei instanceCount)
 {
+    ScopedCpuTimePhase cpuTimePhase(context->getState().getOverlay(), CpuTimePhase::Validation);
+
     if (context->getClientMajorVersion() < 3)
     {
         context->validationError(entryPoint, GL_INVALID_OPERATION, kES3Required);
@@ -4676,6 +4678,8 @@ bool ValidateDrawArraysInstanced(const Context *context,
                                  GLsizei count,
                                  GLsizei primcount)
 {
+    ScopedCpuTimePhase cpuTimePhase(context->getState().getOverlay(), CpuTimePhase::Validation);
+
     if (context->getClientMajorVersion() < 3)
     {
         context->validationError(entryPoint, GL_INVALID_OPERATION, kES3Required);
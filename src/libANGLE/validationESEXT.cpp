@@ -2757,6 +2757,90 @@ bool ValidateReleaseTexturesANGLE(const Context *context,
     return true;
 }
 
+bool ValidateBeginCommandStreamANGLE(const Context *context,
+                                     angle::EntryPoint entryPoint,
+                                     GLuint stream)
+{
+    if (!context->getExtensions().commandStreamANGLE)
+    {
+        context->validationError(entryPoint, GL_INVALID_OPERATION, kExtensionNotEnabled);
+        return false;
+    }
+
+    if (stream == 0)
+    {
+        context->validationError(entryPoint, GL_INVALID_VALUE, kCommandStreamZero);
+        return false;
+    }
+
+    if (context->isRecordingCommandStream())
+    {
+        context->validationError(entryPoint, GL_INVALID_OPERATION, kCommandStreamRecording);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateEndCommandStreamANGLE(const Context *context, angle::EntryPoint entryPoint)
+{
+    if (!context->getExtensions().commandStreamANGLE)
+    {
+        context->validationError(entryPoint, GL_INVALID_OPERATION, kExtensionNotEnabled);
+        return false;
+    }
+
+    if (!context->isRecordingCommandStream())
+    {
+        context->validationError(entryPoint, GL_INVALID_OPERATION, kCommandStreamNotRecording);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateCallCommandStreamANGLE(const Context *context,
+                                    angle::EntryPoint entryPoint,
+                                    GLuint stream)
+{
+    // Calling a stream is not allowed while recording, which also prevents a stream from calling
+    // itself.
+    return ValidateBeginCommandStreamANGLE(context, entryPoint, stream);
+}
+
+bool ValidateDeleteCommandStreamANGLE(const Context *context,
+                                      angle::EntryPoint entryPoint,
+                                      GLuint stream)
+{
+    if (!context->getExtensions().commandStreamANGLE)
+    {
+        context->validationError(entryPoint, GL_INVALID_OPERATION, kExtensionNotEnabled);
+        return false;
+    }
+
+    if (context->isRecordingCommandStream())
+    {
+        context->validationError(entryPoint, GL_INVALID_OPERATION, kCommandStreamRecording);
+        return false;
+    }
+
+    return true;
+}
+
+bool ValidateWarmUpDrawANGLE(const Context *context,
+                             angle::EntryPoint entryPoint,
+                             PrimitiveMode modePacked)
+{
+    if (!context->getExtensions().drawWarmUpANGLE)
+    {
+        context->validationError(entryPoint, GL_INVALID_OPERATION, kExtensionNotEnabled);
+        return false;
+    }
+
+    // The pipeline is derived from the current state, which must be valid for a draw.
+    return ValidateDrawBase(context, entryPoint, modePacked);
+}
+
 bool ValidateFramebufferParameteriMESA(const Context *context,
                                        angle::EntryPoint entryPoint,
                                        GLenum target,
@@ -117,6 +117,18 @@ bool ValidateMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE(const Context
                                                                    const GLuint *baseInstances,
                                                                    GLsizei drawcount);
 
+// GL_ANGLE_command_stream
+bool ValidateBeginCommandStreamANGLE(const Context *context,
+                                     angle::EntryPoint entryPoint,
+                                     GLuint stream);
+bool ValidateEndCommandStreamANGLE(const Context *context, angle::EntryPoint entryPoint);
+bool ValidateCallCommandStreamANGLE(const Context *context,
+                                    angle::EntryPoint entryPoint,
+                                    GLuint stream);
+bool ValidateDeleteCommandStreamANGLE(const Context *context,
+                                      angle::EntryPoint entryPoint,
+                                      GLuint stream);
+
 // GL_ANGLE_copy_texture_3d
 bool ValidateCopyTexture3DANGLE(const Context *context,
                                 angle::EntryPoint entryPoint,
@@ -152,6 +164,11 @@ bool ValidateCopySubTexture3DANGLE(const Context *context,
 
 // GL_ANGLE_depth_texture
 
+// GL_ANGLE_draw_warm_up
+bool ValidateWarmUpDrawANGLE(const Context *context,
+                             angle::EntryPoint entryPoint,
+                             PrimitiveMode modePacked);
+
 // GL_ANGLE_framebuffer_blit
 bool ValidateBlitFramebufferANGLE(const Context *context,
                                   angle::EntryPoint entryPoint,
@@ -38,7 +38,7 @@ void GL_APIENTRY GL_Accum(GLenum op, GLfloat value)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateAccum(context, angle::EntryPoint::GLAccum, op, value));
         if (isCallValid)
@@ -62,7 +62,7 @@ void GL_APIENTRY GL_AlphaFunc(GLenum func, GLfloat ref)
     if (context)
     {
         AlphaTestFunc funcPacked                              = PackParam<AlphaTestFunc>(func);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateAlphaFunc(context, angle::EntryPoint::GLAlphaFunc, funcPacked, ref));
@@ -86,7 +86,7 @@ void GL_APIENTRY GL_Begin(GLenum mode)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateBegin(context, angle::EntryPoint::GLBegin, mode));
         if (isCallValid)
@@ -117,7 +117,7 @@ void GL_APIENTRY GL_Bitmap(GLsizei width,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBitmap(context, angle::EntryPoint::GLBitmap, width, height,
                                                                                 xorig, yorig, xmove, ymove, bitmap));
@@ -143,7 +143,7 @@ void GL_APIENTRY GL_BlendFunc(GLenum sfactor, GLenum dfactor)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlendFunc(context, angle::EntryPoint::GLBlendFunc, sfactor, dfactor));
@@ -166,7 +166,7 @@ void GL_APIENTRY GL_CallList(GLuint list)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCallList(context, angle::EntryPoint::GLCallList, list));
         if (isCallValid)
@@ -189,7 +189,7 @@ void GL_APIENTRY GL_CallLists(GLsizei n, GLenum type, const void *lists)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCallLists(context, angle::EntryPoint::GLCallLists, n, type, lists));
@@ -213,7 +213,7 @@ void GL_APIENTRY GL_Clear(GLbitfield mask)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateClear(context, angle::EntryPoint::GLClear, mask));
         if (isCallValid)
@@ -236,7 +236,7 @@ void GL_APIENTRY GL_ClearAccum(GLfloat red, GLfloat green, GLfloat blue, GLfloat
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateClearAccum(context, angle::EntryPoint::GLClearAccum, red, green, blue, alpha));
@@ -260,7 +260,7 @@ void GL_APIENTRY GL_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateClearColor(context, angle::EntryPoint::GLClearColor, red, green, blue, alpha));
@@ -283,7 +283,7 @@ void GL_APIENTRY GL_ClearDepth(GLdouble depth)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearDepth(context, angle::EntryPoint::GLClearDepth, depth));
         if (isCallValid)
@@ -305,7 +305,7 @@ void GL_APIENTRY GL_ClearIndex(GLfloat c)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearIndex(context, angle::EntryPoint::GLClearIndex, c));
         if (isCallValid)
@@ -327,7 +327,7 @@ void GL_APIENTRY GL_ClearStencil(GLint s)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearStencil(context, angle::EntryPoint::GLClearStencil, s));
         if (isCallValid)
@@ -350,7 +350,7 @@ void GL_APIENTRY GL_ClipPlane(GLenum plane, const GLdouble *equation)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateClipPlane(context, angle::EntryPoint::GLClipPlane, plane, equation));
@@ -374,7 +374,7 @@ void GL_APIENTRY GL_Color3b(GLbyte red, GLbyte green, GLbyte blue)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor3b(context, angle::EntryPoint::GLColor3b, red, green, blue));
@@ -397,7 +397,7 @@ void GL_APIENTRY GL_Color3bv(const GLbyte *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor3bv(context, angle::EntryPoint::GLColor3bv, v));
         if (isCallValid)
@@ -420,7 +420,7 @@ void GL_APIENTRY GL_Color3d(GLdouble red, GLdouble green, GLdouble blue)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor3d(context, angle::EntryPoint::GLColor3d, red, green, blue));
@@ -443,7 +443,7 @@ void GL_APIENTRY GL_Color3dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor3dv(context, angle::EntryPoint::GLColor3dv, v));
         if (isCallValid)
@@ -466,7 +466,7 @@ void GL_APIENTRY GL_Color3f(GLfloat red, GLfloat green, GLfloat blue)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor3f(context, angle::EntryPoint::GLColor3f, red, green, blue));
@@ -489,7 +489,7 @@ void GL_APIENTRY GL_Color3fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor3fv(context, angle::EntryPoint::GLColor3fv, v));
         if (isCallValid)
@@ -512,7 +512,7 @@ void GL_APIENTRY GL_Color3i(GLint red, GLint green, GLint blue)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor3i(context, angle::EntryPoint::GLColor3i, red, green, blue));
@@ -535,7 +535,7 @@ void GL_APIENTRY GL_Color3iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor3iv(context, angle::EntryPoint::GLColor3iv, v));
         if (isCallValid)
@@ -558,7 +558,7 @@ void GL_APIENTRY GL_Color3s(GLshort red, GLshort green, GLshort blue)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor3s(context, angle::EntryPoint::GLColor3s, red, green, blue));
@@ -581,7 +581,7 @@ void GL_APIENTRY GL_Color3sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor3sv(context, angle::EntryPoint::GLColor3sv, v));
         if (isCallValid)
@@ -604,7 +604,7 @@ void GL_APIENTRY GL_Color3ub(GLubyte red, GLubyte green, GLubyte blue)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor3ub(context, angle::EntryPoint::GLColor3ub, red, green, blue));
@@ -627,7 +627,7 @@ void GL_APIENTRY GL_Color3ubv(const GLubyte *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor3ubv(context, angle::EntryPoint::GLColor3ubv, v));
         if (isCallValid)
@@ -650,7 +650,7 @@ void GL_APIENTRY GL_Color3ui(GLuint red, GLuint green, GLuint blue)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor3ui(context, angle::EntryPoint::GLColor3ui, red, green, blue));
@@ -673,7 +673,7 @@ void GL_APIENTRY GL_Color3uiv(const GLuint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor3uiv(context, angle::EntryPoint::GLColor3uiv, v));
         if (isCallValid)
@@ -696,7 +696,7 @@ void GL_APIENTRY GL_Color3us(GLushort red, GLushort green, GLushort blue)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor3us(context, angle::EntryPoint::GLColor3us, red, green, blue));
@@ -719,7 +719,7 @@ void GL_APIENTRY GL_Color3usv(const GLushort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor3usv(context, angle::EntryPoint::GLColor3usv, v));
         if (isCallValid)
@@ -742,7 +742,7 @@ void GL_APIENTRY GL_Color4b(GLbyte red, GLbyte green, GLbyte blue, GLbyte alpha)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor4b(context, angle::EntryPoint::GLColor4b, red, green, blue, alpha));
@@ -765,7 +765,7 @@ void GL_APIENTRY GL_Color4bv(const GLbyte *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor4bv(context, angle::EntryPoint::GLColor4bv, v));
         if (isCallValid)
@@ -788,7 +788,7 @@ void GL_APIENTRY GL_Color4d(GLdouble red, GLdouble green, GLdouble blue, GLdoubl
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor4d(context, angle::EntryPoint::GLColor4d, red, green, blue, alpha));
@@ -811,7 +811,7 @@ void GL_APIENTRY GL_Color4dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor4dv(context, angle::EntryPoint::GLColor4dv, v));
         if (isCallValid)
@@ -834,7 +834,7 @@ void GL_APIENTRY GL_Color4f(GLfloat red, GLfloat green, GLfloat blue, GLfloat al
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor4f(context, angle::EntryPoint::GLColor4f, red, green, blue, alpha));
@@ -857,7 +857,7 @@ void GL_APIENTRY GL_Color4fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor4fv(context, angle::EntryPoint::GLColor4fv, v));
         if (isCallValid)
@@ -880,7 +880,7 @@ void GL_APIENTRY GL_Color4i(GLint red, GLint green, GLint blue, GLint alpha)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor4i(context, angle::EntryPoint::GLColor4i, red, green, blue, alpha));
@@ -903,7 +903,7 @@ void GL_APIENTRY GL_Color4iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor4iv(context, angle::EntryPoint::GLColor4iv, v));
         if (isCallValid)
@@ -926,7 +926,7 @@ void GL_APIENTRY GL_Color4s(GLshort red, GLshort green, GLshort blue, GLshort al
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor4s(context, angle::EntryPoint::GLColor4s, red, green, blue, alpha));
@@ -949,7 +949,7 @@ void GL_APIENTRY GL_Color4sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor4sv(context, angle::EntryPoint::GLColor4sv, v));
         if (isCallValid)
@@ -972,7 +972,7 @@ void GL_APIENTRY GL_Color4ub(GLubyte red, GLubyte green, GLubyte blue, GLubyte a
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor4ub(context, angle::EntryPoint::GLColor4ub, red, green, blue, alpha));
@@ -995,7 +995,7 @@ void GL_APIENTRY GL_Color4ubv(const GLubyte *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor4ubv(context, angle::EntryPoint::GLColor4ubv, v));
         if (isCallValid)
@@ -1018,7 +1018,7 @@ void GL_APIENTRY GL_Color4ui(GLuint red, GLuint green, GLuint blue, GLuint alpha
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor4ui(context, angle::EntryPoint::GLColor4ui, red, green, blue, alpha));
@@ -1041,7 +1041,7 @@ void GL_APIENTRY GL_Color4uiv(const GLuint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor4uiv(context, angle::EntryPoint::GLColor4uiv, v));
         if (isCallValid)
@@ -1064,7 +1064,7 @@ void GL_APIENTRY GL_Color4us(GLushort red, GLushort green, GLushort blue, GLusho
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColor4us(context, angle::EntryPoint::GLColor4us, red, green, blue, alpha));
@@ -1087,7 +1087,7 @@ void GL_APIENTRY GL_Color4usv(const GLushort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColor4usv(context, angle::EntryPoint::GLColor4usv, v));
         if (isCallValid)
@@ -1111,7 +1111,7 @@ void GL_APIENTRY GL_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GL
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColorMask(context, angle::EntryPoint::GLColorMask, red, green, blue, alpha));
@@ -1136,7 +1136,7 @@ void GL_APIENTRY GL_ColorMaterial(GLenum face, GLenum mode)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateColorMaterial(context, angle::EntryPoint::GLColorMaterial, face, mode));
@@ -1160,7 +1160,7 @@ void GL_APIENTRY GL_CopyPixels(GLint x, GLint y, GLsizei width, GLsizei height,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyPixels(context, angle::EntryPoint::GLCopyPixels, x, y,
                                                                                     width, height, type));
@@ -1185,7 +1185,7 @@ void GL_APIENTRY GL_CullFace(GLenum mode)
     if (context)
     {
         CullFaceMode modePacked                               = PackParam<CullFaceMode>(mode);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCullFace(context, angle::EntryPoint::GLCullFace, modePacked));
         if (isCallValid)
@@ -1207,7 +1207,7 @@ void GL_APIENTRY GL_DeleteLists(GLuint list, GLsizei range)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDeleteLists(context, angle::EntryPoint::GLDeleteLists, list, range));
@@ -1231,7 +1231,7 @@ void GL_APIENTRY GL_DepthFunc(GLenum func)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDepthFunc(context, angle::EntryPoint::GLDepthFunc, func));
         if (isCallValid)
@@ -1253,7 +1253,7 @@ void GL_APIENTRY GL_DepthMask(GLboolean flag)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDepthMask(context, angle::EntryPoint::GLDepthMask, flag));
         if (isCallValid)
@@ -1275,7 +1275,7 @@ void GL_APIENTRY GL_DepthRange(GLdouble n, GLdouble f)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDepthRange(context, angle::EntryPoint::GLDepthRange, n, f));
         if (isCallValid)
@@ -1298,7 +1298,7 @@ void GL_APIENTRY GL_Disable(GLenum cap)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDisable(context, angle::EntryPoint::GLDisable, cap));
         if (isCallValid)
@@ -1321,7 +1321,7 @@ void GL_APIENTRY GL_DrawBuffer(GLenum buf)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawBuffer(context, angle::EntryPoint::GLDrawBuffer, buf));
         if (isCallValid)
@@ -1348,7 +1348,7 @@ GL_DrawPixels(GLsizei width, GLsizei height, GLenum format, GLenum type, const v
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawPixels(context, angle::EntryPoint::GLDrawPixels, width,
                                                                                     height, format, type, pixels));
@@ -1371,7 +1371,7 @@ void GL_APIENTRY GL_EdgeFlag(GLboolean flag)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEdgeFlag(context, angle::EntryPoint::GLEdgeFlag, flag));
         if (isCallValid)
@@ -1394,7 +1394,7 @@ void GL_APIENTRY GL_EdgeFlagv(const GLboolean *flag)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEdgeFlagv(context, angle::EntryPoint::GLEdgeFlagv, flag));
         if (isCallValid)
@@ -1417,7 +1417,7 @@ void GL_APIENTRY GL_Enable(GLenum cap)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEnable(context, angle::EntryPoint::GLEnable, cap));
         if (isCallValid)
@@ -1439,7 +1439,7 @@ void GL_APIENTRY GL_End()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEnd(context, angle::EntryPoint::GLEnd));
         if (isCallValid)
@@ -1461,7 +1461,7 @@ void GL_APIENTRY GL_EndList()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateEndList(context, angle::EntryPoint::GLEndList));
         if (isCallValid)
@@ -1483,7 +1483,7 @@ void GL_APIENTRY GL_EvalCoord1d(GLdouble u)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEvalCoord1d(context, angle::EntryPoint::GLEvalCoord1d, u));
         if (isCallValid)
@@ -1506,7 +1506,7 @@ void GL_APIENTRY GL_EvalCoord1dv(const GLdouble *u)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEvalCoord1dv(context, angle::EntryPoint::GLEvalCoord1dv, u));
         if (isCallValid)
@@ -1528,7 +1528,7 @@ void GL_APIENTRY GL_EvalCoord1f(GLfloat u)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEvalCoord1f(context, angle::EntryPoint::GLEvalCoord1f, u));
         if (isCallValid)
@@ -1551,7 +1551,7 @@ void GL_APIENTRY GL_EvalCoord1fv(const GLfloat *u)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEvalCoord1fv(context, angle::EntryPoint::GLEvalCoord1fv, u));
         if (isCallValid)
@@ -1573,7 +1573,7 @@ void GL_APIENTRY GL_EvalCoord2d(GLdouble u, GLdouble v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEvalCoord2d(context, angle::EntryPoint::GLEvalCoord2d, u, v));
         if (isCallValid)
@@ -1596,7 +1596,7 @@ void GL_APIENTRY GL_EvalCoord2dv(const GLdouble *u)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEvalCoord2dv(context, angle::EntryPoint::GLEvalCoord2dv, u));
         if (isCallValid)
@@ -1618,7 +1618,7 @@ void GL_APIENTRY GL_EvalCoord2f(GLfloat u, GLfloat v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEvalCoord2f(context, angle::EntryPoint::GLEvalCoord2f, u, v));
         if (isCallValid)
@@ -1641,7 +1641,7 @@ void GL_APIENTRY GL_EvalCoord2fv(const GLfloat *u)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEvalCoord2fv(context, angle::EntryPoint::GLEvalCoord2fv, u));
         if (isCallValid)
@@ -1664,7 +1664,7 @@ void GL_APIENTRY GL_EvalMesh1(GLenum mode, GLint i1, GLint i2)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateEvalMesh1(context, angle::EntryPoint::GLEvalMesh1, mode, i1, i2));
@@ -1688,7 +1688,7 @@ void GL_APIENTRY GL_EvalMesh2(GLenum mode, GLint i1, GLint i2, GLint j1, GLint j
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateEvalMesh2(context, angle::EntryPoint::GLEvalMesh2, mode, i1, i2, j1, j2));
@@ -1711,7 +1711,7 @@ void GL_APIENTRY GL_EvalPoint1(GLint i)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEvalPoint1(context, angle::EntryPoint::GLEvalPoint1, i));
         if (isCallValid)
@@ -1733,7 +1733,7 @@ void GL_APIENTRY GL_EvalPoint2(GLint i, GLint j)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEvalPoint2(context, angle::EntryPoint::GLEvalPoint2, i, j));
         if (isCallValid)
@@ -1757,7 +1757,7 @@ void GL_APIENTRY GL_FeedbackBuffer(GLsizei size, GLenum type, GLfloat *buffer)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFeedbackBuffer(context, angle::EntryPoint::GLFeedbackBuffer,
                                                                                         size, type, buffer));
@@ -1780,7 +1780,7 @@ void GL_APIENTRY GL_Finish()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFinish(context, angle::EntryPoint::GLFinish));
         if (isCallValid)
@@ -1802,7 +1802,7 @@ void GL_APIENTRY GL_Flush()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFlush(context, angle::EntryPoint::GLFlush));
         if (isCallValid)
@@ -1825,7 +1825,7 @@ void GL_APIENTRY GL_Fogf(GLenum pname, GLfloat param)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFogf(context, angle::EntryPoint::GLFogf, pname, param));
         if (isCallValid)
@@ -1848,7 +1848,7 @@ void GL_APIENTRY GL_Fogfv(GLenum pname, const GLfloat *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFogfv(context, angle::EntryPoint::GLFogfv, pname, params));
         if (isCallValid)
@@ -1871,7 +1871,7 @@ void GL_APIENTRY GL_Fogi(GLenum pname, GLint param)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFogi(context, angle::EntryPoint::GLFogi, pname, param));
         if (isCallValid)
@@ -1894,7 +1894,7 @@ void GL_APIENTRY GL_Fogiv(GLenum pname, const GLint *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFogiv(context, angle::EntryPoint::GLFogiv, pname, params));
         if (isCallValid)
@@ -1917,7 +1917,7 @@ void GL_APIENTRY GL_FrontFace(GLenum mode)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFrontFace(context, angle::EntryPoint::GLFrontFace, mode));
         if (isCallValid)
@@ -1946,7 +1946,7 @@ void GL_APIENTRY GL_Frustum(GLdouble left,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateFrustum(context, angle::EntryPoint::GLFrustum,
                                                           left, right, bottom, top, zNear, zFar));
@@ -1970,7 +1970,7 @@ GLuint GL_APIENTRY GL_GenLists(GLsizei range)
     GLuint returnValue;
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGenLists(context, angle::EntryPoint::GLGenLists, range));
         if (isCallValid)
@@ -1999,7 +1999,7 @@ void GL_APIENTRY GL_GetBooleanv(GLenum pname, GLboolean *data)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetBooleanv(context, angle::EntryPoint::GLGetBooleanv, pname, data));
@@ -2023,7 +2023,7 @@ void GL_APIENTRY GL_GetClipPlane(GLenum plane, GLdouble *equation)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetClipPlane(context, angle::EntryPoint::GLGetClipPlane, plane, equation));
@@ -2047,7 +2047,7 @@ void GL_APIENTRY GL_GetDoublev(GLenum pname, GLdouble *data)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetDoublev(context, angle::EntryPoint::GLGetDoublev, pname, data));
@@ -2071,7 +2071,7 @@ GLenum GL_APIENTRY GL_GetError()
     GLenum returnValue;
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateGetError(context, angle::EntryPoint::GLGetError));
         if (isCallValid)
@@ -2100,7 +2100,7 @@ void GL_APIENTRY GL_GetFloatv(GLenum pname, GLfloat *data)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetFloatv(context, angle::EntryPoint::GLGetFloatv, pname, data));
@@ -2124,7 +2124,7 @@ void GL_APIENTRY GL_GetIntegerv(GLenum pname, GLint *data)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetIntegerv(context, angle::EntryPoint::GLGetIntegerv, pname, data));
@@ -2150,7 +2150,7 @@ void GL_APIENTRY GL_GetLightfv(GLenum light, GLenum pname, GLfloat *params)
     if (context)
     {
         LightParameter pnamePacked                            = PackParam<LightParameter>(pname);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetLightfv(context, angle::EntryPoint::GLGetLightfv, light,
                                                                                     pnamePacked, params));
@@ -2175,7 +2175,7 @@ void GL_APIENTRY GL_GetLightiv(GLenum light, GLenum pname, GLint *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetLightiv(context, angle::EntryPoint::GLGetLightiv, light, pname, params));
@@ -2200,7 +2200,7 @@ void GL_APIENTRY GL_GetMapdv(GLenum target, GLenum query, GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetMapdv(context, angle::EntryPoint::GLGetMapdv, target, query, v));
@@ -2225,7 +2225,7 @@ void GL_APIENTRY GL_GetMapfv(GLenum target, GLenum query, GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetMapfv(context, angle::EntryPoint::GLGetMapfv, target, query, v));
@@ -2250,7 +2250,7 @@ void GL_APIENTRY GL_GetMapiv(GLenum target, GLenum query, GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetMapiv(context, angle::EntryPoint::GLGetMapiv, target, query, v));
@@ -2277,7 +2277,7 @@ void GL_APIENTRY GL_GetMaterialfv(GLenum face, GLenum pname, GLfloat *params)
     if (context)
     {
         MaterialParameter pnamePacked                         = PackParam<MaterialParameter>(pname);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetMaterialfv(context, angle::EntryPoint::GLGetMaterialfv, face,
                                                                                        pnamePacked, params));
@@ -2303,7 +2303,7 @@ void GL_APIENTRY GL_GetMaterialiv(GLenum face, GLenum pname, GLint *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetMaterialiv(context, angle::EntryPoint::GLGetMaterialiv, face,
                                                                                        pname, params));
@@ -2327,7 +2327,7 @@ void GL_APIENTRY GL_GetPixelMapfv(GLenum map, GLfloat *values)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetPixelMapfv(context, angle::EntryPoint::GLGetPixelMapfv, map, values));
@@ -2351,7 +2351,7 @@ void GL_APIENTRY GL_GetPixelMapuiv(GLenum map, GLuint *values)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetPixelMapuiv(context, angle::EntryPoint::GLGetPixelMapuiv, map, values));
@@ -2375,7 +2375,7 @@ void GL_APIENTRY GL_GetPixelMapusv(GLenum map, GLushort *values)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetPixelMapusv(context, angle::EntryPoint::GLGetPixelMapusv, map, values));
@@ -2399,7 +2399,7 @@ void GL_APIENTRY GL_GetPolygonStipple(GLubyte *mask)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetPolygonStipple(context, angle::EntryPoint::GLGetPolygonStipple, mask));
@@ -2424,7 +2424,7 @@ const GLubyte *GL_APIENTRY GL_GetString(GLenum name)
     const GLubyte *returnValue;
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetString(context, angle::EntryPoint::GLGetString, name));
         if (isCallValid)
@@ -2457,7 +2457,7 @@ void GL_APIENTRY GL_GetTexEnvfv(GLenum target, GLenum pname, GLfloat *params)
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexEnvfv(context, angle::EntryPoint::GLGetTexEnvfv,
                                                                                      targetPacked, pnamePacked, params));
@@ -2485,7 +2485,7 @@ void GL_APIENTRY GL_GetTexEnviv(GLenum target, GLenum pname, GLint *params)
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexEnviv(context, angle::EntryPoint::GLGetTexEnviv,
                                                                                      targetPacked, pnamePacked, params));
@@ -2511,7 +2511,7 @@ void GL_APIENTRY GL_GetTexGendv(GLenum coord, GLenum pname, GLdouble *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexGendv(context, angle::EntryPoint::GLGetTexGendv, coord, pname, params));
@@ -2537,7 +2537,7 @@ void GL_APIENTRY GL_GetTexGenfv(GLenum coord, GLenum pname, GLfloat *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexGenfv(context, angle::EntryPoint::GLGetTexGenfv, coord, pname, params));
@@ -2563,7 +2563,7 @@ void GL_APIENTRY GL_GetTexGeniv(GLenum coord, GLenum pname, GLint *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexGeniv(context, angle::EntryPoint::GLGetTexGeniv, coord, pname, params));
@@ -2593,7 +2593,7 @@ GL_GetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pix
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTexImage(context, angle::EntryPoint::GLGetTexImage,
                                                                                      targetPacked, level, format, type, pixels));
@@ -2624,7 +2624,7 @@ void GL_APIENTRY GL_GetTexLevelParameterfv(GLenum target,
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexLevelParameterfv(context, angle::EntryPoint::GLGetTexLevelParameterfv,
@@ -2653,7 +2653,7 @@ void GL_APIENTRY GL_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pn
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexLevelParameteriv(context, angle::EntryPoint::GLGetTexLevelParameteriv,
@@ -2682,7 +2682,7 @@ void GL_APIENTRY GL_GetTexParameterfv(GLenum target, GLenum pname, GLfloat *para
     if (context)
     {
         TextureType targetPacked                              = PackParam<TextureType>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexParameterfv(context, angle::EntryPoint::GLGetTexParameterfv,
@@ -2710,7 +2710,7 @@ void GL_APIENTRY GL_GetTexParameteriv(GLenum target, GLenum pname, GLint *params
     if (context)
     {
         TextureType targetPacked                              = PackParam<TextureType>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTexParameteriv(context, angle::EntryPoint::GLGetTexParameteriv,
@@ -2736,7 +2736,7 @@ void GL_APIENTRY GL_Hint(GLenum target, GLenum mode)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateHint(context, angle::EntryPoint::GLHint, target, mode));
         if (isCallValid)
@@ -2758,7 +2758,7 @@ void GL_APIENTRY GL_IndexMask(GLuint mask)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateIndexMask(context, angle::EntryPoint::GLIndexMask, mask));
         if (isCallValid)
@@ -2780,7 +2780,7 @@ void GL_APIENTRY GL_Indexd(GLdouble c)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIndexd(context, angle::EntryPoint::GLIndexd, c));
         if (isCallValid)
@@ -2802,7 +2802,7 @@ void GL_APIENTRY GL_Indexdv(const GLdouble *c)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateIndexdv(context, angle::EntryPoint::GLIndexdv, c));
         if (isCallValid)
@@ -2824,7 +2824,7 @@ void GL_APIENTRY GL_Indexf(GLfloat c)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIndexf(context, angle::EntryPoint::GLIndexf, c));
         if (isCallValid)
@@ -2846,7 +2846,7 @@ void GL_APIENTRY GL_Indexfv(const GLfloat *c)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateIndexfv(context, angle::EntryPoint::GLIndexfv, c));
         if (isCallValid)
@@ -2868,7 +2868,7 @@ void GL_APIENTRY GL_Indexi(GLint c)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIndexi(context, angle::EntryPoint::GLIndexi, c));
         if (isCallValid)
@@ -2890,7 +2890,7 @@ void GL_APIENTRY GL_Indexiv(const GLint *c)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateIndexiv(context, angle::EntryPoint::GLIndexiv, c));
         if (isCallValid)
@@ -2912,7 +2912,7 @@ void GL_APIENTRY GL_Indexs(GLshort c)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateIndexs(context, angle::EntryPoint::GLIndexs, c));
         if (isCallValid)
@@ -2934,7 +2934,7 @@ void GL_APIENTRY GL_Indexsv(const GLshort *c)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateIndexsv(context, angle::EntryPoint::GLIndexsv, c));
         if (isCallValid)
@@ -2956,7 +2956,7 @@ void GL_APIENTRY GL_InitNames()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateInitNames(context, angle::EntryPoint::GLInitNames));
         if (isCallValid)
@@ -2980,7 +2980,7 @@ GLboolean GL_APIENTRY GL_IsEnabled(GLenum cap)
     GLboolean returnValue;
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateIsEnabled(context, angle::EntryPoint::GLIsEnabled, cap));
         if (isCallValid)
@@ -3009,7 +3009,7 @@ GLboolean GL_APIENTRY GL_IsList(GLuint list)
     GLboolean returnValue;
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateIsList(context, angle::EntryPoint::GLIsList, list));
         if (isCallValid)
@@ -3038,7 +3038,7 @@ void GL_APIENTRY GL_LightModelf(GLenum pname, GLfloat param)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateLightModelf(context, angle::EntryPoint::GLLightModelf, pname, param));
@@ -3062,7 +3062,7 @@ void GL_APIENTRY GL_LightModelfv(GLenum pname, const GLfloat *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateLightModelfv(context, angle::EntryPoint::GLLightModelfv, pname, params));
@@ -3086,7 +3086,7 @@ void GL_APIENTRY GL_LightModeli(GLenum pname, GLint param)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateLightModeli(context, angle::EntryPoint::GLLightModeli, pname, param));
@@ -3110,7 +3110,7 @@ void GL_APIENTRY GL_LightModeliv(GLenum pname, const GLint *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateLightModeliv(context, angle::EntryPoint::GLLightModeliv, pname, params));
@@ -3136,7 +3136,7 @@ void GL_APIENTRY GL_Lightf(GLenum light, GLenum pname, GLfloat param)
     if (context)
     {
         LightParameter pnamePacked                            = PackParam<LightParameter>(pname);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateLightf(context, angle::EntryPoint::GLLightf, light, pnamePacked, param));
@@ -3162,7 +3162,7 @@ void GL_APIENTRY GL_Lightfv(GLenum light, GLenum pname, const GLfloat *params)
     if (context)
     {
         LightParameter pnamePacked                            = PackParam<LightParameter>(pname);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateLightfv(context, angle::EntryPoint::GLLightfv, light, pnamePacked, params));
@@ -3187,7 +3187,7 @@ void GL_APIENTRY GL_Lighti(GLenum light, GLenum pname, GLint param)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateLighti(context, angle::EntryPoint::GLLighti, light, pname, param));
@@ -3212,7 +3212,7 @@ void GL_APIENTRY GL_Lightiv(GLenum light, GLenum pname, const GLint *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateLightiv(context, angle::EntryPoint::GLLightiv, light, pname, params));
@@ -3236,7 +3236,7 @@ void GL_APIENTRY GL_LineStipple(GLint factor, GLushort pattern)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateLineStipple(context, angle::EntryPoint::GLLineStipple, factor, pattern));
@@ -3259,7 +3259,7 @@ void GL_APIENTRY GL_LineWidth(GLfloat width)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateLineWidth(context, angle::EntryPoint::GLLineWidth, width));
         if (isCallValid)
@@ -3281,7 +3281,7 @@ void GL_APIENTRY GL_ListBase(GLuint base)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateListBase(context, angle::EntryPoint::GLListBase, base));
         if (isCallValid)
@@ -3303,7 +3303,7 @@ void GL_APIENTRY GL_LoadIdentity()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateLoadIdentity(context, angle::EntryPoint::GLLoadIdentity));
         if (isCallValid)
@@ -3326,7 +3326,7 @@ void GL_APIENTRY GL_LoadMatrixd(const GLdouble *m)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateLoadMatrixd(context, angle::EntryPoint::GLLoadMatrixd, m));
         if (isCallValid)
@@ -3349,7 +3349,7 @@ void GL_APIENTRY GL_LoadMatrixf(const GLfloat *m)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateLoadMatrixf(context, angle::EntryPoint::GLLoadMatrixf, m));
         if (isCallValid)
@@ -3371,7 +3371,7 @@ void GL_APIENTRY GL_LoadName(GLuint name)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateLoadName(context, angle::EntryPoint::GLLoadName, name));
         if (isCallValid)
@@ -3395,7 +3395,7 @@ void GL_APIENTRY GL_LogicOp(GLenum opcode)
     if (context)
     {
         LogicalOperation opcodePacked                         = PackParam<LogicalOperation>(opcode);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateLogicOp(context, angle::EntryPoint::GLLogicOp, opcodePacked));
         if (isCallValid)
@@ -3422,7 +3422,7 @@ GL_Map1d(GLenum target, GLdouble u1, GLdouble u2, GLint stride, GLint order, con
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMap1d(context, angle::EntryPoint::GLMap1d, target,
                                                         u1, u2, stride, order, points));
@@ -3450,7 +3450,7 @@ GL_Map1f(GLenum target, GLfloat u1, GLfloat u2, GLint stride, GLint order, const
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateMap1f(context, angle::EntryPoint::GLMap1f, target,
                                                         u1, u2, stride, order, points));
@@ -3486,7 +3486,7 @@ void GL_APIENTRY GL_Map2d(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMap2d(context, angle::EntryPoint::GLMap2d, target, u1, u2,
                                                                                ustride, uorder, v1, v2, vstride, vorder, points));
@@ -3523,7 +3523,7 @@ void GL_APIENTRY GL_Map2f(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMap2f(context, angle::EntryPoint::GLMap2f, target, u1, u2,
                                                                                ustride, uorder, v1, v2, vstride, vorder, points));
@@ -3548,7 +3548,7 @@ void GL_APIENTRY GL_MapGrid1d(GLint un, GLdouble u1, GLdouble u2)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMapGrid1d(context, angle::EntryPoint::GLMapGrid1d, un, u1, u2));
         if (isCallValid)
@@ -3571,7 +3571,7 @@ void GL_APIENTRY GL_MapGrid1f(GLint un, GLfloat u1, GLfloat u2)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMapGrid1f(context, angle::EntryPoint::GLMapGrid1f, un, u1, u2));
         if (isCallValid)
@@ -3596,7 +3596,7 @@ GL_MapGrid2d(GLint un, GLdouble u1, GLdouble u2, GLint vn, GLdouble v1, GLdouble
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMapGrid2d(context, angle::EntryPoint::GLMapGrid2d, un, u1, u2, vn, v1, v2));
@@ -3621,7 +3621,7 @@ void GL_APIENTRY GL_MapGrid2f(GLint un, GLfloat u1, GLfloat u2, GLint vn, GLfloa
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMapGrid2f(context, angle::EntryPoint::GLMapGrid2f, un, u1, u2, vn, v1, v2));
@@ -3647,7 +3647,7 @@ void GL_APIENTRY GL_Materialf(GLenum face, GLenum pname, GLfloat param)
     if (context)
     {
         MaterialParameter pnamePacked                         = PackParam<MaterialParameter>(pname);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMaterialf(context, angle::EntryPoint::GLMaterialf, face, pnamePacked, param));
@@ -3673,7 +3673,7 @@ void GL_APIENTRY GL_Materialfv(GLenum face, GLenum pname, const GLfloat *params)
     if (context)
     {
         MaterialParameter pnamePacked                         = PackParam<MaterialParameter>(pname);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMaterialfv(context, angle::EntryPoint::GLMaterialfv, face,
                                                                                     pnamePacked, params));
@@ -3698,7 +3698,7 @@ void GL_APIENTRY GL_Materiali(GLenum face, GLenum pname, GLint param)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMateriali(context, angle::EntryPoint::GLMateriali, face, pname, param));
@@ -3723,7 +3723,7 @@ void GL_APIENTRY GL_Materialiv(GLenum face, GLenum pname, const GLint *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMaterialiv(context, angle::EntryPoint::GLMaterialiv, face, pname, params));
@@ -3748,7 +3748,7 @@ void GL_APIENTRY GL_MatrixMode(GLenum mode)
     if (context)
     {
         MatrixType modePacked                                 = PackParam<MatrixType>(mode);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMatrixMode(context, angle::EntryPoint::GLMatrixMode, modePacked));
@@ -3772,7 +3772,7 @@ void GL_APIENTRY GL_MultMatrixd(const GLdouble *m)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultMatrixd(context, angle::EntryPoint::GLMultMatrixd, m));
         if (isCallValid)
@@ -3795,7 +3795,7 @@ void GL_APIENTRY GL_MultMatrixf(const GLfloat *m)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultMatrixf(context, angle::EntryPoint::GLMultMatrixf, m));
         if (isCallValid)
@@ -3818,7 +3818,7 @@ void GL_APIENTRY GL_NewList(GLuint list, GLenum mode)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNewList(context, angle::EntryPoint::GLNewList, list, mode));
         if (isCallValid)
@@ -3840,7 +3840,7 @@ void GL_APIENTRY GL_Normal3b(GLbyte nx, GLbyte ny, GLbyte nz)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNormal3b(context, angle::EntryPoint::GLNormal3b, nx, ny, nz));
         if (isCallValid)
@@ -3862,7 +3862,7 @@ void GL_APIENTRY GL_Normal3bv(const GLbyte *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNormal3bv(context, angle::EntryPoint::GLNormal3bv, v));
         if (isCallValid)
@@ -3884,7 +3884,7 @@ void GL_APIENTRY GL_Normal3d(GLdouble nx, GLdouble ny, GLdouble nz)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNormal3d(context, angle::EntryPoint::GLNormal3d, nx, ny, nz));
         if (isCallValid)
@@ -3906,7 +3906,7 @@ void GL_APIENTRY GL_Normal3dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNormal3dv(context, angle::EntryPoint::GLNormal3dv, v));
         if (isCallValid)
@@ -3928,7 +3928,7 @@ void GL_APIENTRY GL_Normal3f(GLfloat nx, GLfloat ny, GLfloat nz)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNormal3f(context, angle::EntryPoint::GLNormal3f, nx, ny, nz));
         if (isCallValid)
@@ -3950,7 +3950,7 @@ void GL_APIENTRY GL_Normal3fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNormal3fv(context, angle::EntryPoint::GLNormal3fv, v));
         if (isCallValid)
@@ -3972,7 +3972,7 @@ void GL_APIENTRY GL_Normal3i(GLint nx, GLint ny, GLint nz)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNormal3i(context, angle::EntryPoint::GLNormal3i, nx, ny, nz));
         if (isCallValid)
@@ -3994,7 +3994,7 @@ void GL_APIENTRY GL_Normal3iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNormal3iv(context, angle::EntryPoint::GLNormal3iv, v));
         if (isCallValid)
@@ -4016,7 +4016,7 @@ void GL_APIENTRY GL_Normal3s(GLshort nx, GLshort ny, GLshort nz)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNormal3s(context, angle::EntryPoint::GLNormal3s, nx, ny, nz));
         if (isCallValid)
@@ -4038,7 +4038,7 @@ void GL_APIENTRY GL_Normal3sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNormal3sv(context, angle::EntryPoint::GLNormal3sv, v));
         if (isCallValid)
@@ -4067,7 +4067,7 @@ void GL_APIENTRY GL_Ortho(GLdouble left,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateOrtho(context, angle::EntryPoint::GLOrtho, left,
                                                         right, bottom, top, zNear, zFar));
@@ -4090,7 +4090,7 @@ void GL_APIENTRY GL_PassThrough(GLfloat token)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePassThrough(context, angle::EntryPoint::GLPassThrough, token));
         if (isCallValid)
@@ -4113,7 +4113,7 @@ void GL_APIENTRY GL_PixelMapfv(GLenum map, GLsizei mapsize, const GLfloat *value
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePixelMapfv(context, angle::EntryPoint::GLPixelMapfv, map, mapsize, values));
@@ -4138,7 +4138,7 @@ void GL_APIENTRY GL_PixelMapuiv(GLenum map, GLsizei mapsize, const GLuint *value
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePixelMapuiv(context, angle::EntryPoint::GLPixelMapuiv, map, mapsize, values));
@@ -4163,7 +4163,7 @@ void GL_APIENTRY GL_PixelMapusv(GLenum map, GLsizei mapsize, const GLushort *val
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePixelMapusv(context, angle::EntryPoint::GLPixelMapusv, map, mapsize, values));
@@ -4187,7 +4187,7 @@ void GL_APIENTRY GL_PixelStoref(GLenum pname, GLfloat param)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePixelStoref(context, angle::EntryPoint::GLPixelStoref, pname, param));
@@ -4211,7 +4211,7 @@ void GL_APIENTRY GL_PixelStorei(GLenum pname, GLint param)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePixelStorei(context, angle::EntryPoint::GLPixelStorei, pname, param));
@@ -4235,7 +4235,7 @@ void GL_APIENTRY GL_PixelTransferf(GLenum pname, GLfloat param)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePixelTransferf(context, angle::EntryPoint::GLPixelTransferf, pname, param));
@@ -4259,7 +4259,7 @@ void GL_APIENTRY GL_PixelTransferi(GLenum pname, GLint param)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePixelTransferi(context, angle::EntryPoint::GLPixelTransferi, pname, param));
@@ -4283,7 +4283,7 @@ void GL_APIENTRY GL_PixelZoom(GLfloat xfactor, GLfloat yfactor)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePixelZoom(context, angle::EntryPoint::GLPixelZoom, xfactor, yfactor));
@@ -4306,7 +4306,7 @@ void GL_APIENTRY GL_PointSize(GLfloat size)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePointSize(context, angle::EntryPoint::GLPointSize, size));
         if (isCallValid)
@@ -4330,7 +4330,7 @@ void GL_APIENTRY GL_PolygonMode(GLenum face, GLenum mode)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePolygonMode(context, angle::EntryPoint::GLPolygonMode, face, mode));
@@ -4354,7 +4354,7 @@ void GL_APIENTRY GL_PolygonStipple(const GLubyte *mask)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePolygonStipple(context, angle::EntryPoint::GLPolygonStipple, mask));
@@ -4377,7 +4377,7 @@ void GL_APIENTRY GL_PopAttrib()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePopAttrib(context, angle::EntryPoint::GLPopAttrib));
         if (isCallValid)
@@ -4399,7 +4399,7 @@ void GL_APIENTRY GL_PopMatrix()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePopMatrix(context, angle::EntryPoint::GLPopMatrix));
         if (isCallValid)
@@ -4421,7 +4421,7 @@ void GL_APIENTRY GL_PopName()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidatePopName(context, angle::EntryPoint::GLPopName));
         if (isCallValid)
@@ -4444,7 +4444,7 @@ void GL_APIENTRY GL_PushAttrib(GLbitfield mask)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePushAttrib(context, angle::EntryPoint::GLPushAttrib, mask));
         if (isCallValid)
@@ -4466,7 +4466,7 @@ void GL_APIENTRY GL_PushMatrix()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePushMatrix(context, angle::EntryPoint::GLPushMatrix));
         if (isCallValid)
@@ -4488,7 +4488,7 @@ void GL_APIENTRY GL_PushName(GLuint name)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePushName(context, angle::EntryPoint::GLPushName, name));
         if (isCallValid)
@@ -4510,7 +4510,7 @@ void GL_APIENTRY GL_RasterPos2d(GLdouble x, GLdouble y)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos2d(context, angle::EntryPoint::GLRasterPos2d, x, y));
         if (isCallValid)
@@ -4533,7 +4533,7 @@ void GL_APIENTRY GL_RasterPos2dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos2dv(context, angle::EntryPoint::GLRasterPos2dv, v));
         if (isCallValid)
@@ -4555,7 +4555,7 @@ void GL_APIENTRY GL_RasterPos2f(GLfloat x, GLfloat y)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos2f(context, angle::EntryPoint::GLRasterPos2f, x, y));
         if (isCallValid)
@@ -4578,7 +4578,7 @@ void GL_APIENTRY GL_RasterPos2fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos2fv(context, angle::EntryPoint::GLRasterPos2fv, v));
         if (isCallValid)
@@ -4600,7 +4600,7 @@ void GL_APIENTRY GL_RasterPos2i(GLint x, GLint y)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos2i(context, angle::EntryPoint::GLRasterPos2i, x, y));
         if (isCallValid)
@@ -4623,7 +4623,7 @@ void GL_APIENTRY GL_RasterPos2iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos2iv(context, angle::EntryPoint::GLRasterPos2iv, v));
         if (isCallValid)
@@ -4645,7 +4645,7 @@ void GL_APIENTRY GL_RasterPos2s(GLshort x, GLshort y)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos2s(context, angle::EntryPoint::GLRasterPos2s, x, y));
         if (isCallValid)
@@ -4668,7 +4668,7 @@ void GL_APIENTRY GL_RasterPos2sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos2sv(context, angle::EntryPoint::GLRasterPos2sv, v));
         if (isCallValid)
@@ -4690,7 +4690,7 @@ void GL_APIENTRY GL_RasterPos3d(GLdouble x, GLdouble y, GLdouble z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateRasterPos3d(context, angle::EntryPoint::GLRasterPos3d, x, y, z));
@@ -4714,7 +4714,7 @@ void GL_APIENTRY GL_RasterPos3dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos3dv(context, angle::EntryPoint::GLRasterPos3dv, v));
         if (isCallValid)
@@ -4736,7 +4736,7 @@ void GL_APIENTRY GL_RasterPos3f(GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateRasterPos3f(context, angle::EntryPoint::GLRasterPos3f, x, y, z));
@@ -4760,7 +4760,7 @@ void GL_APIENTRY GL_RasterPos3fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos3fv(context, angle::EntryPoint::GLRasterPos3fv, v));
         if (isCallValid)
@@ -4782,7 +4782,7 @@ void GL_APIENTRY GL_RasterPos3i(GLint x, GLint y, GLint z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateRasterPos3i(context, angle::EntryPoint::GLRasterPos3i, x, y, z));
@@ -4806,7 +4806,7 @@ void GL_APIENTRY GL_RasterPos3iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos3iv(context, angle::EntryPoint::GLRasterPos3iv, v));
         if (isCallValid)
@@ -4828,7 +4828,7 @@ void GL_APIENTRY GL_RasterPos3s(GLshort x, GLshort y, GLshort z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateRasterPos3s(context, angle::EntryPoint::GLRasterPos3s, x, y, z));
@@ -4852,7 +4852,7 @@ void GL_APIENTRY GL_RasterPos3sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos3sv(context, angle::EntryPoint::GLRasterPos3sv, v));
         if (isCallValid)
@@ -4875,7 +4875,7 @@ void GL_APIENTRY GL_RasterPos4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateRasterPos4d(context, angle::EntryPoint::GLRasterPos4d, x, y, z, w));
@@ -4899,7 +4899,7 @@ void GL_APIENTRY GL_RasterPos4dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos4dv(context, angle::EntryPoint::GLRasterPos4dv, v));
         if (isCallValid)
@@ -4922,7 +4922,7 @@ void GL_APIENTRY GL_RasterPos4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateRasterPos4f(context, angle::EntryPoint::GLRasterPos4f, x, y, z, w));
@@ -4946,7 +4946,7 @@ void GL_APIENTRY GL_RasterPos4fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos4fv(context, angle::EntryPoint::GLRasterPos4fv, v));
         if (isCallValid)
@@ -4969,7 +4969,7 @@ void GL_APIENTRY GL_RasterPos4i(GLint x, GLint y, GLint z, GLint w)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateRasterPos4i(context, angle::EntryPoint::GLRasterPos4i, x, y, z, w));
@@ -4993,7 +4993,7 @@ void GL_APIENTRY GL_RasterPos4iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos4iv(context, angle::EntryPoint::GLRasterPos4iv, v));
         if (isCallValid)
@@ -5016,7 +5016,7 @@ void GL_APIENTRY GL_RasterPos4s(GLshort x, GLshort y, GLshort z, GLshort w)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateRasterPos4s(context, angle::EntryPoint::GLRasterPos4s, x, y, z, w));
@@ -5040,7 +5040,7 @@ void GL_APIENTRY GL_RasterPos4sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRasterPos4sv(context, angle::EntryPoint::GLRasterPos4sv, v));
         if (isCallValid)
@@ -5063,7 +5063,7 @@ void GL_APIENTRY GL_ReadBuffer(GLenum src)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateReadBuffer(context, angle::EntryPoint::GLReadBuffer, src));
         if (isCallValid)
@@ -5095,7 +5095,7 @@ void GL_APIENTRY GL_ReadPixels(GLint x,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateReadPixels(context, angle::EntryPoint::GLReadPixels, x, y,
                                                                                     width, height, format, type, pixels));
@@ -5120,7 +5120,7 @@ void GL_APIENTRY GL_Rectd(GLdouble x1, GLdouble y1, GLdouble x2, GLdouble y2)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRectd(context, angle::EntryPoint::GLRectd, x1, y1, x2, y2));
         if (isCallValid)
@@ -5143,7 +5143,7 @@ void GL_APIENTRY GL_Rectdv(const GLdouble *v1, const GLdouble *v2)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRectdv(context, angle::EntryPoint::GLRectdv, v1, v2));
         if (isCallValid)
@@ -5166,7 +5166,7 @@ void GL_APIENTRY GL_Rectf(GLfloat x1, GLfloat y1, GLfloat x2, GLfloat y2)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRectf(context, angle::EntryPoint::GLRectf, x1, y1, x2, y2));
         if (isCallValid)
@@ -5189,7 +5189,7 @@ void GL_APIENTRY GL_Rectfv(const GLfloat *v1, const GLfloat *v2)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRectfv(context, angle::EntryPoint::GLRectfv, v1, v2));
         if (isCallValid)
@@ -5212,7 +5212,7 @@ void GL_APIENTRY GL_Recti(GLint x1, GLint y1, GLint x2, GLint y2)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRecti(context, angle::EntryPoint::GLRecti, x1, y1, x2, y2));
         if (isCallValid)
@@ -5235,7 +5235,7 @@ void GL_APIENTRY GL_Rectiv(const GLint *v1, const GLint *v2)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRectiv(context, angle::EntryPoint::GLRectiv, v1, v2));
         if (isCallValid)
@@ -5258,7 +5258,7 @@ void GL_APIENTRY GL_Rects(GLshort x1, GLshort y1, GLshort x2, GLshort y2)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRects(context, angle::EntryPoint::GLRects, x1, y1, x2, y2));
         if (isCallValid)
@@ -5281,7 +5281,7 @@ void GL_APIENTRY GL_Rectsv(const GLshort *v1, const GLshort *v2)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRectsv(context, angle::EntryPoint::GLRectsv, v1, v2));
         if (isCallValid)
@@ -5305,7 +5305,7 @@ GLint GL_APIENTRY GL_RenderMode(GLenum mode)
     GLint returnValue;
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRenderMode(context, angle::EntryPoint::GLRenderMode, mode));
         if (isCallValid)
@@ -5334,7 +5334,7 @@ void GL_APIENTRY GL_Rotated(GLdouble angle, GLdouble x, GLdouble y, GLdouble z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRotated(context, angle::EntryPoint::GLRotated, angle, x, y, z));
         if (isCallValid)
@@ -5357,7 +5357,7 @@ void GL_APIENTRY GL_Rotatef(GLfloat angle, GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateRotatef(context, angle::EntryPoint::GLRotatef, angle, x, y, z));
         if (isCallValid)
@@ -5379,7 +5379,7 @@ void GL_APIENTRY GL_Scaled(GLdouble x, GLdouble y, GLdouble z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateScaled(context, angle::EntryPoint::GLScaled, x, y, z));
         if (isCallValid)
@@ -5401,7 +5401,7 @@ void GL_APIENTRY GL_Scalef(GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateScalef(context, angle::EntryPoint::GLScalef, x, y, z));
         if (isCallValid)
@@ -5424,7 +5424,7 @@ void GL_APIENTRY GL_Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateScissor(context, angle::EntryPoint::GLScissor, x, y, width, height));
@@ -5448,7 +5448,7 @@ void GL_APIENTRY GL_SelectBuffer(GLsizei size, GLuint *buffer)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSelectBuffer(context, angle::EntryPoint::GLSelectBuffer, size, buffer));
@@ -5473,7 +5473,7 @@ void GL_APIENTRY GL_ShadeModel(GLenum mode)
     if (context)
     {
         ShadingModel modePacked                               = PackParam<ShadingModel>(mode);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateShadeModel(context, angle::EntryPoint::GLShadeModel, modePacked));
@@ -5497,7 +5497,7 @@ void GL_APIENTRY GL_StencilFunc(GLenum func, GLint ref, GLuint mask)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateStencilFunc(context, angle::EntryPoint::GLStencilFunc, func, ref, mask));
@@ -5520,7 +5520,7 @@ void GL_APIENTRY GL_StencilMask(GLuint mask)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateStencilMask(context, angle::EntryPoint::GLStencilMask, mask));
         if (isCallValid)
@@ -5545,7 +5545,7 @@ void GL_APIENTRY GL_StencilOp(GLenum fail, GLenum zfail, GLenum zpass)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateStencilOp(context, angle::EntryPoint::GLStencilOp, fail, zfail, zpass));
@@ -5568,7 +5568,7 @@ void GL_APIENTRY GL_TexCoord1d(GLdouble s)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord1d(context, angle::EntryPoint::GLTexCoord1d, s));
         if (isCallValid)
@@ -5591,7 +5591,7 @@ void GL_APIENTRY GL_TexCoord1dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord1dv(context, angle::EntryPoint::GLTexCoord1dv, v));
         if (isCallValid)
@@ -5613,7 +5613,7 @@ void GL_APIENTRY GL_TexCoord1f(GLfloat s)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord1f(context, angle::EntryPoint::GLTexCoord1f, s));
         if (isCallValid)
@@ -5636,7 +5636,7 @@ void GL_APIENTRY GL_TexCoord1fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord1fv(context, angle::EntryPoint::GLTexCoord1fv, v));
         if (isCallValid)
@@ -5658,7 +5658,7 @@ void GL_APIENTRY GL_TexCoord1i(GLint s)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord1i(context, angle::EntryPoint::GLTexCoord1i, s));
         if (isCallValid)
@@ -5681,7 +5681,7 @@ void GL_APIENTRY GL_TexCoord1iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord1iv(context, angle::EntryPoint::GLTexCoord1iv, v));
         if (isCallValid)
@@ -5703,7 +5703,7 @@ void GL_APIENTRY GL_TexCoord1s(GLshort s)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord1s(context, angle::EntryPoint::GLTexCoord1s, s));
         if (isCallValid)
@@ -5726,7 +5726,7 @@ void GL_APIENTRY GL_TexCoord1sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord1sv(context, angle::EntryPoint::GLTexCoord1sv, v));
         if (isCallValid)
@@ -5748,7 +5748,7 @@ void GL_APIENTRY GL_TexCoord2d(GLdouble s, GLdouble t)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord2d(context, angle::EntryPoint::GLTexCoord2d, s, t));
         if (isCallValid)
@@ -5771,7 +5771,7 @@ void GL_APIENTRY GL_TexCoord2dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord2dv(context, angle::EntryPoint::GLTexCoord2dv, v));
         if (isCallValid)
@@ -5793,7 +5793,7 @@ void GL_APIENTRY GL_TexCoord2f(GLfloat s, GLfloat t)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord2f(context, angle::EntryPoint::GLTexCoord2f, s, t));
         if (isCallValid)
@@ -5816,7 +5816,7 @@ void GL_APIENTRY GL_TexCoord2fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord2fv(context, angle::EntryPoint::GLTexCoord2fv, v));
         if (isCallValid)
@@ -5838,7 +5838,7 @@ void GL_APIENTRY GL_TexCoord2i(GLint s, GLint t)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord2i(context, angle::EntryPoint::GLTexCoord2i, s, t));
         if (isCallValid)
@@ -5861,7 +5861,7 @@ void GL_APIENTRY GL_TexCoord2iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord2iv(context, angle::EntryPoint::GLTexCoord2iv, v));
         if (isCallValid)
@@ -5883,7 +5883,7 @@ void GL_APIENTRY GL_TexCoord2s(GLshort s, GLshort t)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord2s(context, angle::EntryPoint::GLTexCoord2s, s, t));
         if (isCallValid)
@@ -5906,7 +5906,7 @@ void GL_APIENTRY GL_TexCoord2sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord2sv(context, angle::EntryPoint::GLTexCoord2sv, v));
         if (isCallValid)
@@ -5928,7 +5928,7 @@ void GL_APIENTRY GL_TexCoord3d(GLdouble s, GLdouble t, GLdouble r)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord3d(context, angle::EntryPoint::GLTexCoord3d, s, t, r));
         if (isCallValid)
@@ -5951,7 +5951,7 @@ void GL_APIENTRY GL_TexCoord3dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord3dv(context, angle::EntryPoint::GLTexCoord3dv, v));
         if (isCallValid)
@@ -5973,7 +5973,7 @@ void GL_APIENTRY GL_TexCoord3f(GLfloat s, GLfloat t, GLfloat r)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord3f(context, angle::EntryPoint::GLTexCoord3f, s, t, r));
         if (isCallValid)
@@ -5996,7 +5996,7 @@ void GL_APIENTRY GL_TexCoord3fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord3fv(context, angle::EntryPoint::GLTexCoord3fv, v));
         if (isCallValid)
@@ -6018,7 +6018,7 @@ void GL_APIENTRY GL_TexCoord3i(GLint s, GLint t, GLint r)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord3i(context, angle::EntryPoint::GLTexCoord3i, s, t, r));
         if (isCallValid)
@@ -6041,7 +6041,7 @@ void GL_APIENTRY GL_TexCoord3iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord3iv(context, angle::EntryPoint::GLTexCoord3iv, v));
         if (isCallValid)
@@ -6063,7 +6063,7 @@ void GL_APIENTRY GL_TexCoord3s(GLshort s, GLshort t, GLshort r)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord3s(context, angle::EntryPoint::GLTexCoord3s, s, t, r));
         if (isCallValid)
@@ -6086,7 +6086,7 @@ void GL_APIENTRY GL_TexCoord3sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord3sv(context, angle::EntryPoint::GLTexCoord3sv, v));
         if (isCallValid)
@@ -6109,7 +6109,7 @@ void GL_APIENTRY GL_TexCoord4d(GLdouble s, GLdouble t, GLdouble r, GLdouble q)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexCoord4d(context, angle::EntryPoint::GLTexCoord4d, s, t, r, q));
@@ -6133,7 +6133,7 @@ void GL_APIENTRY GL_TexCoord4dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord4dv(context, angle::EntryPoint::GLTexCoord4dv, v));
         if (isCallValid)
@@ -6156,7 +6156,7 @@ void GL_APIENTRY GL_TexCoord4f(GLfloat s, GLfloat t, GLfloat r, GLfloat q)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexCoord4f(context, angle::EntryPoint::GLTexCoord4f, s, t, r, q));
@@ -6180,7 +6180,7 @@ void GL_APIENTRY GL_TexCoord4fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord4fv(context, angle::EntryPoint::GLTexCoord4fv, v));
         if (isCallValid)
@@ -6203,7 +6203,7 @@ void GL_APIENTRY GL_TexCoord4i(GLint s, GLint t, GLint r, GLint q)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexCoord4i(context, angle::EntryPoint::GLTexCoord4i, s, t, r, q));
@@ -6227,7 +6227,7 @@ void GL_APIENTRY GL_TexCoord4iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord4iv(context, angle::EntryPoint::GLTexCoord4iv, v));
         if (isCallValid)
@@ -6250,7 +6250,7 @@ void GL_APIENTRY GL_TexCoord4s(GLshort s, GLshort t, GLshort r, GLshort q)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexCoord4s(context, angle::EntryPoint::GLTexCoord4s, s, t, r, q));
@@ -6274,7 +6274,7 @@ void GL_APIENTRY GL_TexCoord4sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoord4sv(context, angle::EntryPoint::GLTexCoord4sv, v));
         if (isCallValid)
@@ -6300,7 +6300,7 @@ void GL_APIENTRY GL_TexEnvf(GLenum target, GLenum pname, GLfloat param)
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexEnvf(context, angle::EntryPoint::GLTexEnvf,
                                                           targetPacked, pnamePacked, param));
@@ -6327,7 +6327,7 @@ void GL_APIENTRY GL_TexEnvfv(GLenum target, GLenum pname, const GLfloat *params)
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexEnvfv(context, angle::EntryPoint::GLTexEnvfv,
                                                            targetPacked, pnamePacked, params));
@@ -6354,7 +6354,7 @@ void GL_APIENTRY GL_TexEnvi(GLenum target, GLenum pname, GLint param)
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexEnvi(context, angle::EntryPoint::GLTexEnvi,
                                                           targetPacked, pnamePacked, param));
@@ -6381,7 +6381,7 @@ void GL_APIENTRY GL_TexEnviv(GLenum target, GLenum pname, const GLint *params)
     {
         TextureEnvTarget targetPacked   = PackParam<TextureEnvTarget>(target);
         TextureEnvParameter pnamePacked = PackParam<TextureEnvParameter>(pname);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateTexEnviv(context, angle::EntryPoint::GLTexEnviv,
                                                            targetPacked, pnamePacked, params));
@@ -6406,7 +6406,7 @@ void GL_APIENTRY GL_TexGend(GLenum coord, GLenum pname, GLdouble param)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexGend(context, angle::EntryPoint::GLTexGend, coord, pname, param));
@@ -6431,7 +6431,7 @@ void GL_APIENTRY GL_TexGendv(GLenum coord, GLenum pname, const GLdouble *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexGendv(context, angle::EntryPoint::GLTexGendv, coord, pname, params));
@@ -6456,7 +6456,7 @@ void GL_APIENTRY GL_TexGenf(GLenum coord, GLenum pname, GLfloat param)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexGenf(context, angle::EntryPoint::GLTexGenf, coord, pname, param));
@@ -6481,7 +6481,7 @@ void GL_APIENTRY GL_TexGenfv(GLenum coord, GLenum pname, const GLfloat *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexGenfv(context, angle::EntryPoint::GLTexGenfv, coord, pname, params));
@@ -6506,7 +6506,7 @@ void GL_APIENTRY GL_TexGeni(GLenum coord, GLenum pname, GLint param)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexGeni(context, angle::EntryPoint::GLTexGeni, coord, pname, param));
@@ -6531,7 +6531,7 @@ void GL_APIENTRY GL_TexGeniv(GLenum coord, GLenum pname, const GLint *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexGeniv(context, angle::EntryPoint::GLTexGeniv, coord, pname, params));
@@ -6566,7 +6566,7 @@ void GL_APIENTRY GL_TexImage1D(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexImage1D(context, angle::EntryPoint::GLTexImage1D, target, level,
@@ -6605,7 +6605,7 @@ void GL_APIENTRY GL_TexImage2D(GLenum target,
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexImage2D(context, angle::EntryPoint::GLTexImage2D, targetPacked, level,
@@ -6634,7 +6634,7 @@ void GL_APIENTRY GL_TexParameterf(GLenum target, GLenum pname, GLfloat param)
     if (context)
     {
         TextureType targetPacked                              = PackParam<TextureType>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterf(context, angle::EntryPoint::GLTexParameterf,
                                                                                        targetPacked, pname, param));
@@ -6661,7 +6661,7 @@ void GL_APIENTRY GL_TexParameterfv(GLenum target, GLenum pname, const GLfloat *p
     if (context)
     {
         TextureType targetPacked                              = PackParam<TextureType>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameterfv(context, angle::EntryPoint::GLTexParameterfv,
                                                                                         targetPacked, pname, params));
@@ -6687,7 +6687,7 @@ void GL_APIENTRY GL_TexParameteri(GLenum target, GLenum pname, GLint param)
     if (context)
     {
         TextureType targetPacked                              = PackParam<TextureType>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameteri(context, angle::EntryPoint::GLTexParameteri,
                                                                                        targetPacked, pname, param));
@@ -6714,7 +6714,7 @@ void GL_APIENTRY GL_TexParameteriv(GLenum target, GLenum pname, const GLint *par
     if (context)
     {
         TextureType targetPacked                              = PackParam<TextureType>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexParameteriv(context, angle::EntryPoint::GLTexParameteriv,
                                                                                         targetPacked, pname, params));
@@ -6737,7 +6737,7 @@ void GL_APIENTRY GL_Translated(GLdouble x, GLdouble y, GLdouble z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTranslated(context, angle::EntryPoint::GLTranslated, x, y, z));
         if (isCallValid)
@@ -6759,7 +6759,7 @@ void GL_APIENTRY GL_Translatef(GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTranslatef(context, angle::EntryPoint::GLTranslatef, x, y, z));
         if (isCallValid)
@@ -6781,7 +6781,7 @@ void GL_APIENTRY GL_Vertex2d(GLdouble x, GLdouble y)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex2d(context, angle::EntryPoint::GLVertex2d, x, y));
         if (isCallValid)
@@ -6803,7 +6803,7 @@ void GL_APIENTRY GL_Vertex2dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex2dv(context, angle::EntryPoint::GLVertex2dv, v));
         if (isCallValid)
@@ -6825,7 +6825,7 @@ void GL_APIENTRY GL_Vertex2f(GLfloat x, GLfloat y)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex2f(context, angle::EntryPoint::GLVertex2f, x, y));
         if (isCallValid)
@@ -6847,7 +6847,7 @@ void GL_APIENTRY GL_Vertex2fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex2fv(context, angle::EntryPoint::GLVertex2fv, v));
         if (isCallValid)
@@ -6869,7 +6869,7 @@ void GL_APIENTRY GL_Vertex2i(GLint x, GLint y)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex2i(context, angle::EntryPoint::GLVertex2i, x, y));
         if (isCallValid)
@@ -6891,7 +6891,7 @@ void GL_APIENTRY GL_Vertex2iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex2iv(context, angle::EntryPoint::GLVertex2iv, v));
         if (isCallValid)
@@ -6913,7 +6913,7 @@ void GL_APIENTRY GL_Vertex2s(GLshort x, GLshort y)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex2s(context, angle::EntryPoint::GLVertex2s, x, y));
         if (isCallValid)
@@ -6935,7 +6935,7 @@ void GL_APIENTRY GL_Vertex2sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex2sv(context, angle::EntryPoint::GLVertex2sv, v));
         if (isCallValid)
@@ -6957,7 +6957,7 @@ void GL_APIENTRY GL_Vertex3d(GLdouble x, GLdouble y, GLdouble z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex3d(context, angle::EntryPoint::GLVertex3d, x, y, z));
         if (isCallValid)
@@ -6979,7 +6979,7 @@ void GL_APIENTRY GL_Vertex3dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex3dv(context, angle::EntryPoint::GLVertex3dv, v));
         if (isCallValid)
@@ -7001,7 +7001,7 @@ void GL_APIENTRY GL_Vertex3f(GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex3f(context, angle::EntryPoint::GLVertex3f, x, y, z));
         if (isCallValid)
@@ -7023,7 +7023,7 @@ void GL_APIENTRY GL_Vertex3fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex3fv(context, angle::EntryPoint::GLVertex3fv, v));
         if (isCallValid)
@@ -7045,7 +7045,7 @@ void GL_APIENTRY GL_Vertex3i(GLint x, GLint y, GLint z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex3i(context, angle::EntryPoint::GLVertex3i, x, y, z));
         if (isCallValid)
@@ -7067,7 +7067,7 @@ void GL_APIENTRY GL_Vertex3iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex3iv(context, angle::EntryPoint::GLVertex3iv, v));
         if (isCallValid)
@@ -7089,7 +7089,7 @@ void GL_APIENTRY GL_Vertex3s(GLshort x, GLshort y, GLshort z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex3s(context, angle::EntryPoint::GLVertex3s, x, y, z));
         if (isCallValid)
@@ -7111,7 +7111,7 @@ void GL_APIENTRY GL_Vertex3sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex3sv(context, angle::EntryPoint::GLVertex3sv, v));
         if (isCallValid)
@@ -7134,7 +7134,7 @@ void GL_APIENTRY GL_Vertex4d(GLdouble x, GLdouble y, GLdouble z, GLdouble w)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex4d(context, angle::EntryPoint::GLVertex4d, x, y, z, w));
         if (isCallValid)
@@ -7156,7 +7156,7 @@ void GL_APIENTRY GL_Vertex4dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex4dv(context, angle::EntryPoint::GLVertex4dv, v));
         if (isCallValid)
@@ -7179,7 +7179,7 @@ void GL_APIENTRY GL_Vertex4f(GLfloat x, GLfloat y, GLfloat z, GLfloat w)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex4f(context, angle::EntryPoint::GLVertex4f, x, y, z, w));
         if (isCallValid)
@@ -7201,7 +7201,7 @@ void GL_APIENTRY GL_Vertex4fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex4fv(context, angle::EntryPoint::GLVertex4fv, v));
         if (isCallValid)
@@ -7224,7 +7224,7 @@ void GL_APIENTRY GL_Vertex4i(GLint x, GLint y, GLint z, GLint w)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex4i(context, angle::EntryPoint::GLVertex4i, x, y, z, w));
         if (isCallValid)
@@ -7246,7 +7246,7 @@ void GL_APIENTRY GL_Vertex4iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex4iv(context, angle::EntryPoint::GLVertex4iv, v));
         if (isCallValid)
@@ -7269,7 +7269,7 @@ void GL_APIENTRY GL_Vertex4s(GLshort x, GLshort y, GLshort z, GLshort w)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex4s(context, angle::EntryPoint::GLVertex4s, x, y, z, w));
         if (isCallValid)
@@ -7291,7 +7291,7 @@ void GL_APIENTRY GL_Vertex4sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertex4sv(context, angle::EntryPoint::GLVertex4sv, v));
         if (isCallValid)
@@ -7314,7 +7314,7 @@ void GL_APIENTRY GL_Viewport(GLint x, GLint y, GLsizei width, GLsizei height)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateViewport(context, angle::EntryPoint::GLViewport, x, y, width, height));
@@ -7343,7 +7343,7 @@ GLboolean GL_APIENTRY GL_AreTexturesResident(GLsizei n,
     GLboolean returnValue;
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateAreTexturesResident(context, angle::EntryPoint::GLAreTexturesResident, n,
@@ -7375,7 +7375,7 @@ void GL_APIENTRY GL_ArrayElement(GLint i)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateArrayElement(context, angle::EntryPoint::GLArrayElement, i));
         if (isCallValid)
@@ -7400,7 +7400,7 @@ void GL_APIENTRY GL_BindTexture(GLenum target, GLuint texture)
     {
         TextureType targetPacked                              = PackParam<TextureType>(target);
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindTexture(context, angle::EntryPoint::GLBindTexture,
                                                                                      targetPacked, texturePacked));
@@ -7427,7 +7427,7 @@ void GL_APIENTRY GL_ColorPointer(GLint size, GLenum type, GLsizei stride, const
     if (context)
     {
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateColorPointer(context, angle::EntryPoint::GLColorPointer, size,
                                                                                       typePacked, stride, pointer));
@@ -7460,7 +7460,7 @@ void GL_APIENTRY GL_CopyTexImage1D(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCopyTexImage1D(context, angle::EntryPoint::GLCopyTexImage1D, target, level,
@@ -7497,7 +7497,7 @@ void GL_APIENTRY GL_CopyTexImage2D(GLenum target,
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCopyTexImage2D(context, angle::EntryPoint::GLCopyTexImage2D, targetPacked,
@@ -7527,7 +7527,7 @@ GL_CopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCopyTexSubImage1D(context, angle::EntryPoint::GLCopyTexSubImage1D, target,
@@ -7564,7 +7564,7 @@ void GL_APIENTRY GL_CopyTexSubImage2D(GLenum target,
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCopyTexSubImage2D(context, angle::EntryPoint::GLCopyTexSubImage2D,
@@ -7591,7 +7591,7 @@ void GL_APIENTRY GL_DeleteTextures(GLsizei n, const GLuint *textures)
     if (context)
     {
         const TextureID *texturesPacked = PackParam<const TextureID *>(textures);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDeleteTextures(context, angle::EntryPoint::GLDeleteTextures, n,
                                                                                         texturesPacked));
@@ -7616,7 +7616,7 @@ void GL_APIENTRY GL_DisableClientState(GLenum array)
     if (context)
     {
         ClientVertexArrayType arrayPacked = PackParam<ClientVertexArrayType>(array);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDisableClientState(
                                                                      context, angle::EntryPoint::GLDisableClientState, arrayPacked));
@@ -7641,7 +7641,7 @@ void GL_APIENTRY GL_DrawArrays(GLenum mode, GLint first, GLsizei count)
     if (context)
     {
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawArrays(context, angle::EntryPoint::GLDrawArrays, modePacked,
                                                                                     first, count));
@@ -7669,7 +7669,7 @@ void GL_APIENTRY GL_DrawElements(GLenum mode, GLsizei count, GLenum type, const
     {
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElements(context, angle::EntryPoint::GLDrawElements,
                                                                                       modePacked, count, typePacked, indices));
@@ -7694,7 +7694,7 @@ void GL_APIENTRY GL_EdgeFlagPointer(GLsizei stride, const void *pointer)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEdgeFlagPointer(context, angle::EntryPoint::GLEdgeFlagPointer,
                                                                                          stride, pointer));
@@ -7719,7 +7719,7 @@ void GL_APIENTRY GL_EnableClientState(GLenum array)
     if (context)
     {
         ClientVertexArrayType arrayPacked = PackParam<ClientVertexArrayType>(array);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEnableClientState(
                                                                      context, angle::EntryPoint::GLEnableClientState, arrayPacked));
@@ -7744,7 +7744,7 @@ void GL_APIENTRY GL_GenTextures(GLsizei n, GLuint *textures)
     if (context)
     {
         TextureID *texturesPacked                             = PackParam<TextureID *>(textures);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGenTextures(context, angle::EntryPoint::GLGenTextures, n, texturesPacked));
@@ -7768,7 +7768,7 @@ void GL_APIENTRY GL_GetPointerv(GLenum pname, void **params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetPointerv(context, angle::EntryPoint::GLGetPointerv, pname, params));
@@ -7793,7 +7793,7 @@ void GL_APIENTRY GL_IndexPointer(GLenum type, GLsizei stride, const void *pointe
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateIndexPointer(context, angle::EntryPoint::GLIndexPointer, type,
                                                                                       stride, pointer));
@@ -7816,7 +7816,7 @@ void GL_APIENTRY GL_Indexub(GLubyte c)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateIndexub(context, angle::EntryPoint::GLIndexub, c));
         if (isCallValid)
@@ -7838,7 +7838,7 @@ void GL_APIENTRY GL_Indexubv(const GLubyte *c)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateIndexubv(context, angle::EntryPoint::GLIndexubv, c));
         if (isCallValid)
@@ -7862,7 +7862,7 @@ void GL_APIENTRY GL_InterleavedArrays(GLenum format, GLsizei stride, const void
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateInterleavedArrays(context, angle::EntryPoint::GLInterleavedArrays, format,
@@ -7888,7 +7888,7 @@ GLboolean GL_APIENTRY GL_IsTexture(GLuint texture)
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateIsTexture(context, angle::EntryPoint::GLIsTexture, texturePacked));
@@ -7920,7 +7920,7 @@ void GL_APIENTRY GL_NormalPointer(GLenum type, GLsizei stride, const void *point
     if (context)
     {
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNormalPointer(context, angle::EntryPoint::GLNormalPointer,
                                                                                        typePacked, stride, pointer));
@@ -7944,7 +7944,7 @@ void GL_APIENTRY GL_PolygonOffset(GLfloat factor, GLfloat units)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePolygonOffset(context, angle::EntryPoint::GLPolygonOffset, factor, units));
@@ -7967,7 +7967,7 @@ void GL_APIENTRY GL_PopClientAttrib()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePopClientAttrib(context, angle::EntryPoint::GLPopClientAttrib));
         if (isCallValid)
@@ -7991,7 +7991,7 @@ void GL_APIENTRY GL_PrioritizeTextures(GLsizei n, const GLuint *textures, const
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePrioritizeTextures(context, angle::EntryPoint::GLPrioritizeTextures, n,
@@ -8016,7 +8016,7 @@ void GL_APIENTRY GL_PushClientAttrib(GLbitfield mask)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePushClientAttrib(context, angle::EntryPoint::GLPushClientAttrib, mask));
@@ -8043,7 +8043,7 @@ void GL_APIENTRY GL_TexCoordPointer(GLint size, GLenum type, GLsizei stride, con
     if (context)
     {
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexCoordPointer(context, angle::EntryPoint::GLTexCoordPointer,
                                                                                          size, typePacked, stride, pointer));
@@ -8077,7 +8077,7 @@ void GL_APIENTRY GL_TexSubImage1D(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexSubImage1D(context, angle::EntryPoint::GLTexSubImage1D, target, level,
@@ -8116,7 +8116,7 @@ void GL_APIENTRY GL_TexSubImage2D(GLenum target,
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexSubImage2D(context, angle::EntryPoint::GLTexSubImage2D, targetPacked, level,
@@ -8146,7 +8146,7 @@ void GL_APIENTRY GL_VertexPointer(GLint size, GLenum type, GLsizei stride, const
     if (context)
     {
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexPointer(context, angle::EntryPoint::GLVertexPointer, size,
                                                                                        typePacked, stride, pointer));
@@ -8183,7 +8183,7 @@ void GL_APIENTRY GL_CopyTexSubImage3D(GLenum target,
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTexSubImage3D(
                                                                      context, angle::EntryPoint::GLCopyTexSubImage3D, targetPacked,
@@ -8220,7 +8220,7 @@ void GL_APIENTRY GL_DrawRangeElements(GLenum mode,
     {
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDrawRangeElements(context, angle::EntryPoint::GLDrawRangeElements, modePacked,
@@ -8260,7 +8260,7 @@ void GL_APIENTRY GL_TexImage3D(GLenum target,
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexImage3D(context, angle::EntryPoint::GLTexImage3D,
                                                                                     targetPacked, level, internalformat, width, height,
@@ -8302,7 +8302,7 @@ void GL_APIENTRY GL_TexSubImage3D(GLenum target,
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexSubImage3D(context, angle::EntryPoint::GLTexSubImage3D,
                                                                                        targetPacked, level, xoffset, yoffset, zoffset,
@@ -8330,7 +8330,7 @@ void GL_APIENTRY GL_ActiveTexture(GLenum texture)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateActiveTexture(context, angle::EntryPoint::GLActiveTexture, texture));
@@ -8354,7 +8354,7 @@ void GL_APIENTRY GL_ClientActiveTexture(GLenum texture)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClientActiveTexture(
                                                                      context, angle::EntryPoint::GLClientActiveTexture, texture));
@@ -8388,7 +8388,7 @@ void GL_APIENTRY GL_CompressedTexImage1D(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCompressedTexImage1D(
                                                                      context, angle::EntryPoint::GLCompressedTexImage1D, target, level,
@@ -8427,7 +8427,7 @@ void GL_APIENTRY GL_CompressedTexImage2D(GLenum target,
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCompressedTexImage2D(
                                                                      context, angle::EntryPoint::GLCompressedTexImage2D, targetPacked,
@@ -8467,7 +8467,7 @@ void GL_APIENTRY GL_CompressedTexImage3D(GLenum target,
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCompressedTexImage3D(context, angle::EntryPoint::GLCompressedTexImage3D,
@@ -8504,7 +8504,7 @@ void GL_APIENTRY GL_CompressedTexSubImage1D(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCompressedTexSubImage1D(
                                                                      context, angle::EntryPoint::GLCompressedTexSubImage1D, target,
@@ -8544,7 +8544,7 @@ void GL_APIENTRY GL_CompressedTexSubImage2D(GLenum target,
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCompressedTexSubImage2D(
                                                                      context, angle::EntryPoint::GLCompressedTexSubImage2D, targetPacked,
@@ -8586,7 +8586,7 @@ void GL_APIENTRY GL_CompressedTexSubImage3D(GLenum target,
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCompressedTexSubImage3D(context, angle::EntryPoint::GLCompressedTexSubImage3D,
@@ -8616,7 +8616,7 @@ void GL_APIENTRY GL_GetCompressedTexImage(GLenum target, GLint level, void *img)
     if (context)
     {
         TextureTarget targetPacked                            = PackParam<TextureTarget>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetCompressedTexImage(context, angle::EntryPoint::GLGetCompressedTexImage,
@@ -8641,7 +8641,7 @@ void GL_APIENTRY GL_LoadTransposeMatrixd(const GLdouble *m)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateLoadTransposeMatrixd(context, angle::EntryPoint::GLLoadTransposeMatrixd, m));
@@ -8665,7 +8665,7 @@ void GL_APIENTRY GL_LoadTransposeMatrixf(const GLfloat *m)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateLoadTransposeMatrixf(context, angle::EntryPoint::GLLoadTransposeMatrixf, m));
@@ -8689,7 +8689,7 @@ void GL_APIENTRY GL_MultTransposeMatrixd(const GLdouble *m)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultTransposeMatrixd(context, angle::EntryPoint::GLMultTransposeMatrixd, m));
@@ -8713,7 +8713,7 @@ void GL_APIENTRY GL_MultTransposeMatrixf(const GLfloat *m)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultTransposeMatrixf(context, angle::EntryPoint::GLMultTransposeMatrixf, m));
@@ -8737,7 +8737,7 @@ void GL_APIENTRY GL_MultiTexCoord1d(GLenum target, GLdouble s)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord1d(context, angle::EntryPoint::GLMultiTexCoord1d, target, s));
@@ -8761,7 +8761,7 @@ void GL_APIENTRY GL_MultiTexCoord1dv(GLenum target, const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord1dv(context, angle::EntryPoint::GLMultiTexCoord1dv, target, v));
@@ -8785,7 +8785,7 @@ void GL_APIENTRY GL_MultiTexCoord1f(GLenum target, GLfloat s)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord1f(context, angle::EntryPoint::GLMultiTexCoord1f, target, s));
@@ -8809,7 +8809,7 @@ void GL_APIENTRY GL_MultiTexCoord1fv(GLenum target, const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord1fv(context, angle::EntryPoint::GLMultiTexCoord1fv, target, v));
@@ -8833,7 +8833,7 @@ void GL_APIENTRY GL_MultiTexCoord1i(GLenum target, GLint s)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord1i(context, angle::EntryPoint::GLMultiTexCoord1i, target, s));
@@ -8857,7 +8857,7 @@ void GL_APIENTRY GL_MultiTexCoord1iv(GLenum target, const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord1iv(context, angle::EntryPoint::GLMultiTexCoord1iv, target, v));
@@ -8881,7 +8881,7 @@ void GL_APIENTRY GL_MultiTexCoord1s(GLenum target, GLshort s)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord1s(context, angle::EntryPoint::GLMultiTexCoord1s, target, s));
@@ -8905,7 +8905,7 @@ void GL_APIENTRY GL_MultiTexCoord1sv(GLenum target, const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord1sv(context, angle::EntryPoint::GLMultiTexCoord1sv, target, v));
@@ -8929,7 +8929,7 @@ void GL_APIENTRY GL_MultiTexCoord2d(GLenum target, GLdouble s, GLdouble t)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord2d(context, angle::EntryPoint::GLMultiTexCoord2d, target, s, t));
@@ -8953,7 +8953,7 @@ void GL_APIENTRY GL_MultiTexCoord2dv(GLenum target, const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord2dv(context, angle::EntryPoint::GLMultiTexCoord2dv, target, v));
@@ -8977,7 +8977,7 @@ void GL_APIENTRY GL_MultiTexCoord2f(GLenum target, GLfloat s, GLfloat t)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord2f(context, angle::EntryPoint::GLMultiTexCoord2f, target, s, t));
@@ -9001,7 +9001,7 @@ void GL_APIENTRY GL_MultiTexCoord2fv(GLenum target, const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord2fv(context, angle::EntryPoint::GLMultiTexCoord2fv, target, v));
@@ -9025,7 +9025,7 @@ void GL_APIENTRY GL_MultiTexCoord2i(GLenum target, GLint s, GLint t)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord2i(context, angle::EntryPoint::GLMultiTexCoord2i, target, s, t));
@@ -9049,7 +9049,7 @@ void GL_APIENTRY GL_MultiTexCoord2iv(GLenum target, const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord2iv(context, angle::EntryPoint::GLMultiTexCoord2iv, target, v));
@@ -9073,7 +9073,7 @@ void GL_APIENTRY GL_MultiTexCoord2s(GLenum target, GLshort s, GLshort t)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord2s(context, angle::EntryPoint::GLMultiTexCoord2s, target, s, t));
@@ -9097,7 +9097,7 @@ void GL_APIENTRY GL_MultiTexCoord2sv(GLenum target, const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord2sv(context, angle::EntryPoint::GLMultiTexCoord2sv, target, v));
@@ -9121,7 +9121,7 @@ void GL_APIENTRY GL_MultiTexCoord3d(GLenum target, GLdouble s, GLdouble t, GLdou
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoord3d(context, angle::EntryPoint::GLMultiTexCoord3d,
                                                                                          target, s, t, r));
@@ -9145,7 +9145,7 @@ void GL_APIENTRY GL_MultiTexCoord3dv(GLenum target, const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord3dv(context, angle::EntryPoint::GLMultiTexCoord3dv, target, v));
@@ -9169,7 +9169,7 @@ void GL_APIENTRY GL_MultiTexCoord3f(GLenum target, GLfloat s, GLfloat t, GLfloat
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoord3f(context, angle::EntryPoint::GLMultiTexCoord3f,
                                                                                          target, s, t, r));
@@ -9193,7 +9193,7 @@ void GL_APIENTRY GL_MultiTexCoord3fv(GLenum target, const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord3fv(context, angle::EntryPoint::GLMultiTexCoord3fv, target, v));
@@ -9217,7 +9217,7 @@ void GL_APIENTRY GL_MultiTexCoord3i(GLenum target, GLint s, GLint t, GLint r)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoord3i(context, angle::EntryPoint::GLMultiTexCoord3i,
                                                                                          target, s, t, r));
@@ -9241,7 +9241,7 @@ void GL_APIENTRY GL_MultiTexCoord3iv(GLenum target, const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord3iv(context, angle::EntryPoint::GLMultiTexCoord3iv, target, v));
@@ -9265,7 +9265,7 @@ void GL_APIENTRY GL_MultiTexCoord3s(GLenum target, GLshort s, GLshort t, GLshort
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoord3s(context, angle::EntryPoint::GLMultiTexCoord3s,
                                                                                          target, s, t, r));
@@ -9289,7 +9289,7 @@ void GL_APIENTRY GL_MultiTexCoord3sv(GLenum target, const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord3sv(context, angle::EntryPoint::GLMultiTexCoord3sv, target, v));
@@ -9313,7 +9313,7 @@ void GL_APIENTRY GL_MultiTexCoord4d(GLenum target, GLdouble s, GLdouble t, GLdou
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoord4d(context, angle::EntryPoint::GLMultiTexCoord4d,
                                                                                          target, s, t, r, q));
@@ -9337,7 +9337,7 @@ void GL_APIENTRY GL_MultiTexCoord4dv(GLenum target, const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord4dv(context, angle::EntryPoint::GLMultiTexCoord4dv, target, v));
@@ -9361,7 +9361,7 @@ void GL_APIENTRY GL_MultiTexCoord4f(GLenum target, GLfloat s, GLfloat t, GLfloat
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoord4f(context, angle::EntryPoint::GLMultiTexCoord4f,
                                                                                          target, s, t, r, q));
@@ -9385,7 +9385,7 @@ void GL_APIENTRY GL_MultiTexCoord4fv(GLenum target, const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord4fv(context, angle::EntryPoint::GLMultiTexCoord4fv, target, v));
@@ -9409,7 +9409,7 @@ void GL_APIENTRY GL_MultiTexCoord4i(GLenum target, GLint s, GLint t, GLint r, GL
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoord4i(context, angle::EntryPoint::GLMultiTexCoord4i,
                                                                                          target, s, t, r, q));
@@ -9433,7 +9433,7 @@ void GL_APIENTRY GL_MultiTexCoord4iv(GLenum target, const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord4iv(context, angle::EntryPoint::GLMultiTexCoord4iv, target, v));
@@ -9457,7 +9457,7 @@ void GL_APIENTRY GL_MultiTexCoord4s(GLenum target, GLshort s, GLshort t, GLshort
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiTexCoord4s(context, angle::EntryPoint::GLMultiTexCoord4s,
                                                                                          target, s, t, r, q));
@@ -9481,7 +9481,7 @@ void GL_APIENTRY GL_MultiTexCoord4sv(GLenum target, const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiTexCoord4sv(context, angle::EntryPoint::GLMultiTexCoord4sv, target, v));
@@ -9505,7 +9505,7 @@ void GL_APIENTRY GL_SampleCoverage(GLfloat value, GLboolean invert)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSampleCoverage(context, angle::EntryPoint::GLSampleCoverage, value, invert));
@@ -9530,7 +9530,7 @@ void GL_APIENTRY GL_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlendColor(context, angle::EntryPoint::GLBlendColor, red, green, blue, alpha));
@@ -9554,7 +9554,7 @@ void GL_APIENTRY GL_BlendEquation(GLenum mode)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlendEquation(context, angle::EntryPoint::GLBlendEquation, mode));
@@ -9585,7 +9585,7 @@ void GL_APIENTRY GL_BlendFuncSeparate(GLenum sfactorRGB,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlendFuncSeparate(context, angle::EntryPoint::GLBlendFuncSeparate, sfactorRGB,
@@ -9612,7 +9612,7 @@ void GL_APIENTRY GL_FogCoordPointer(GLenum type, GLsizei stride, const void *poi
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFogCoordPointer(context, angle::EntryPoint::GLFogCoordPointer,
                                                                                          type, stride, pointer));
@@ -9635,7 +9635,7 @@ void GL_APIENTRY GL_FogCoordd(GLdouble coord)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFogCoordd(context, angle::EntryPoint::GLFogCoordd, coord));
         if (isCallValid)
@@ -9658,7 +9658,7 @@ void GL_APIENTRY GL_FogCoorddv(const GLdouble *coord)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFogCoorddv(context, angle::EntryPoint::GLFogCoorddv, coord));
         if (isCallValid)
@@ -9680,7 +9680,7 @@ void GL_APIENTRY GL_FogCoordf(GLfloat coord)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFogCoordf(context, angle::EntryPoint::GLFogCoordf, coord));
         if (isCallValid)
@@ -9703,7 +9703,7 @@ void GL_APIENTRY GL_FogCoordfv(const GLfloat *coord)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFogCoordfv(context, angle::EntryPoint::GLFogCoordfv, coord));
         if (isCallValid)
@@ -9733,7 +9733,7 @@ void GL_APIENTRY GL_MultiDrawArrays(GLenum mode,
     if (context)
     {
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiDrawArrays(context, angle::EntryPoint::GLMultiDrawArrays,
                                                                                          modePacked, first, count, drawcount));
@@ -9767,7 +9767,7 @@ void GL_APIENTRY GL_MultiDrawElements(GLenum mode,
     {
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiDrawElements(context, angle::EntryPoint::GLMultiDrawElements, modePacked,
@@ -9794,7 +9794,7 @@ void GL_APIENTRY GL_PointParameterf(GLenum pname, GLfloat param)
     if (context)
     {
         PointParameter pnamePacked                            = PackParam<PointParameter>(pname);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePointParameterf(context, angle::EntryPoint::GLPointParameterf,
                                                                                          pnamePacked, param));
@@ -9819,7 +9819,7 @@ void GL_APIENTRY GL_PointParameterfv(GLenum pname, const GLfloat *params)
     if (context)
     {
         PointParameter pnamePacked                            = PackParam<PointParameter>(pname);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePointParameterfv(context, angle::EntryPoint::GLPointParameterfv,
                                                                                           pnamePacked, params));
@@ -9843,7 +9843,7 @@ void GL_APIENTRY GL_PointParameteri(GLenum pname, GLint param)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePointParameteri(context, angle::EntryPoint::GLPointParameteri, pname, param));
@@ -9867,7 +9867,7 @@ void GL_APIENTRY GL_PointParameteriv(GLenum pname, const GLint *params)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePointParameteriv(context, angle::EntryPoint::GLPointParameteriv,
                                                                                           pname, params));
@@ -9891,7 +9891,7 @@ void GL_APIENTRY GL_SecondaryColor3b(GLbyte red, GLbyte green, GLbyte blue)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSecondaryColor3b(context, angle::EntryPoint::GLSecondaryColor3b,
                                                                                           red, green, blue));
@@ -9915,7 +9915,7 @@ void GL_APIENTRY GL_SecondaryColor3bv(const GLbyte *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSecondaryColor3bv(context, angle::EntryPoint::GLSecondaryColor3bv, v));
@@ -9939,7 +9939,7 @@ void GL_APIENTRY GL_SecondaryColor3d(GLdouble red, GLdouble green, GLdouble blue
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSecondaryColor3d(context, angle::EntryPoint::GLSecondaryColor3d,
                                                                                           red, green, blue));
@@ -9963,7 +9963,7 @@ void GL_APIENTRY GL_SecondaryColor3dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSecondaryColor3dv(context, angle::EntryPoint::GLSecondaryColor3dv, v));
@@ -9987,7 +9987,7 @@ void GL_APIENTRY GL_SecondaryColor3f(GLfloat red, GLfloat green, GLfloat blue)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSecondaryColor3f(context, angle::EntryPoint::GLSecondaryColor3f,
                                                                                           red, green, blue));
@@ -10011,7 +10011,7 @@ void GL_APIENTRY GL_SecondaryColor3fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSecondaryColor3fv(context, angle::EntryPoint::GLSecondaryColor3fv, v));
@@ -10035,7 +10035,7 @@ void GL_APIENTRY GL_SecondaryColor3i(GLint red, GLint green, GLint blue)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSecondaryColor3i(context, angle::EntryPoint::GLSecondaryColor3i,
                                                                                           red, green, blue));
@@ -10059,7 +10059,7 @@ void GL_APIENTRY GL_SecondaryColor3iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSecondaryColor3iv(context, angle::EntryPoint::GLSecondaryColor3iv, v));
@@ -10083,7 +10083,7 @@ void GL_APIENTRY GL_SecondaryColor3s(GLshort red, GLshort green, GLshort blue)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSecondaryColor3s(context, angle::EntryPoint::GLSecondaryColor3s,
                                                                                           red, green, blue));
@@ -10107,7 +10107,7 @@ void GL_APIENTRY GL_SecondaryColor3sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSecondaryColor3sv(context, angle::EntryPoint::GLSecondaryColor3sv, v));
@@ -10131,7 +10131,7 @@ void GL_APIENTRY GL_SecondaryColor3ub(GLubyte red, GLubyte green, GLubyte blue)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSecondaryColor3ub(
                                                                      context, angle::EntryPoint::GLSecondaryColor3ub, red, green, blue));
@@ -10155,7 +10155,7 @@ void GL_APIENTRY GL_SecondaryColor3ubv(const GLubyte *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSecondaryColor3ubv(context, angle::EntryPoint::GLSecondaryColor3ubv, v));
@@ -10179,7 +10179,7 @@ void GL_APIENTRY GL_SecondaryColor3ui(GLuint red, GLuint green, GLuint blue)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSecondaryColor3ui(
                                                                      context, angle::EntryPoint::GLSecondaryColor3ui, red, green, blue));
@@ -10203,7 +10203,7 @@ void GL_APIENTRY GL_SecondaryColor3uiv(const GLuint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSecondaryColor3uiv(context, angle::EntryPoint::GLSecondaryColor3uiv, v));
@@ -10227,7 +10227,7 @@ void GL_APIENTRY GL_SecondaryColor3us(GLushort red, GLushort green, GLushort blu
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSecondaryColor3us(
                                                                      context, angle::EntryPoint::GLSecondaryColor3us, red, green, blue));
@@ -10251,7 +10251,7 @@ void GL_APIENTRY GL_SecondaryColor3usv(const GLushort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSecondaryColor3usv(context, angle::EntryPoint::GLSecondaryColor3usv, v));
@@ -10280,7 +10280,7 @@ void GL_APIENTRY GL_SecondaryColorPointer(GLint size,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateSecondaryColorPointer(context, angle::EntryPoint::GLSecondaryColorPointer,
@@ -10304,7 +10304,7 @@ void GL_APIENTRY GL_WindowPos2d(GLdouble x, GLdouble y)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateWindowPos2d(context, angle::EntryPoint::GLWindowPos2d, x, y));
         if (isCallValid)
@@ -10327,7 +10327,7 @@ void GL_APIENTRY GL_WindowPos2dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateWindowPos2dv(context, angle::EntryPoint::GLWindowPos2dv, v));
         if (isCallValid)
@@ -10349,7 +10349,7 @@ void GL_APIENTRY GL_WindowPos2f(GLfloat x, GLfloat y)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateWindowPos2f(context, angle::EntryPoint::GLWindowPos2f, x, y));
         if (isCallValid)
@@ -10372,7 +10372,7 @@ void GL_APIENTRY GL_WindowPos2fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateWindowPos2fv(context, angle::EntryPoint::GLWindowPos2fv, v));
         if (isCallValid)
@@ -10394,7 +10394,7 @@ void GL_APIENTRY GL_WindowPos2i(GLint x, GLint y)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateWindowPos2i(context, angle::EntryPoint::GLWindowPos2i, x, y));
         if (isCallValid)
@@ -10417,7 +10417,7 @@ void GL_APIENTRY GL_WindowPos2iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateWindowPos2iv(context, angle::EntryPoint::GLWindowPos2iv, v));
         if (isCallValid)
@@ -10439,7 +10439,7 @@ void GL_APIENTRY GL_WindowPos2s(GLshort x, GLshort y)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateWindowPos2s(context, angle::EntryPoint::GLWindowPos2s, x, y));
         if (isCallValid)
@@ -10462,7 +10462,7 @@ void GL_APIENTRY GL_WindowPos2sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateWindowPos2sv(context, angle::EntryPoint::GLWindowPos2sv, v));
         if (isCallValid)
@@ -10484,7 +10484,7 @@ void GL_APIENTRY GL_WindowPos3d(GLdouble x, GLdouble y, GLdouble z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateWindowPos3d(context, angle::EntryPoint::GLWindowPos3d, x, y, z));
@@ -10508,7 +10508,7 @@ void GL_APIENTRY GL_WindowPos3dv(const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateWindowPos3dv(context, angle::EntryPoint::GLWindowPos3dv, v));
         if (isCallValid)
@@ -10530,7 +10530,7 @@ void GL_APIENTRY GL_WindowPos3f(GLfloat x, GLfloat y, GLfloat z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateWindowPos3f(context, angle::EntryPoint::GLWindowPos3f, x, y, z));
@@ -10554,7 +10554,7 @@ void GL_APIENTRY GL_WindowPos3fv(const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateWindowPos3fv(context, angle::EntryPoint::GLWindowPos3fv, v));
         if (isCallValid)
@@ -10576,7 +10576,7 @@ void GL_APIENTRY GL_WindowPos3i(GLint x, GLint y, GLint z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateWindowPos3i(context, angle::EntryPoint::GLWindowPos3i, x, y, z));
@@ -10600,7 +10600,7 @@ void GL_APIENTRY GL_WindowPos3iv(const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateWindowPos3iv(context, angle::EntryPoint::GLWindowPos3iv, v));
         if (isCallValid)
@@ -10622,7 +10622,7 @@ void GL_APIENTRY GL_WindowPos3s(GLshort x, GLshort y, GLshort z)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateWindowPos3s(context, angle::EntryPoint::GLWindowPos3s, x, y, z));
@@ -10646,7 +10646,7 @@ void GL_APIENTRY GL_WindowPos3sv(const GLshort *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateWindowPos3sv(context, angle::EntryPoint::GLWindowPos3sv, v));
         if (isCallValid)
@@ -10672,7 +10672,7 @@ void GL_APIENTRY GL_BeginQuery(GLenum target, GLuint id)
     {
         QueryType targetPacked                                = PackParam<QueryType>(target);
         QueryID idPacked                                      = PackParam<QueryID>(id);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBeginQuery(context, angle::EntryPoint::GLBeginQuery, targetPacked, idPacked));
@@ -10698,7 +10698,7 @@ void GL_APIENTRY GL_BindBuffer(GLenum target, GLuint buffer)
     {
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindBuffer(context, angle::EntryPoint::GLBindBuffer,
                                                                                     targetPacked, bufferPacked));
@@ -10727,7 +10727,7 @@ void GL_APIENTRY GL_BufferData(GLenum target, GLsizeiptr size, const void *data,
     {
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
         BufferUsage usagePacked                               = PackParam<BufferUsage>(usage);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBufferData(context, angle::EntryPoint::GLBufferData,
                                                                                     targetPacked, size, data, usagePacked));
@@ -10755,7 +10755,7 @@ void GL_APIENTRY GL_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr siz
     if (context)
     {
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBufferSubData(context, angle::EntryPoint::GLBufferSubData,
                                                                                        targetPacked, offset, size, data));
@@ -10780,7 +10780,7 @@ void GL_APIENTRY GL_DeleteBuffers(GLsizei n, const GLuint *buffers)
     if (context)
     {
         const BufferID *buffersPacked = PackParam<const BufferID *>(buffers);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDeleteBuffers(context, angle::EntryPoint::GLDeleteBuffers, n, buffersPacked));
@@ -10805,7 +10805,7 @@ void GL_APIENTRY GL_DeleteQueries(GLsizei n, const GLuint *ids)
     if (context)
     {
         const QueryID *idsPacked                              = PackParam<const QueryID *>(ids);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDeleteQueries(context, angle::EntryPoint::GLDeleteQueries, n, idsPacked));
@@ -10830,7 +10830,7 @@ void GL_APIENTRY GL_EndQuery(GLenum target)
     if (context)
     {
         QueryType targetPacked                                = PackParam<QueryType>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateEndQuery(context, angle::EntryPoint::GLEndQuery, targetPacked));
         if (isCallValid)
@@ -10854,7 +10854,7 @@ void GL_APIENTRY GL_GenBuffers(GLsizei n, GLuint *buffers)
     if (context)
     {
         BufferID *buffersPacked                               = PackParam<BufferID *>(buffers);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGenBuffers(context, angle::EntryPoint::GLGenBuffers, n, buffersPacked));
@@ -10879,7 +10879,7 @@ void GL_APIENTRY GL_GenQueries(GLsizei n, GLuint *ids)
     if (context)
     {
         QueryID *idsPacked                                    = PackParam<QueryID *>(ids);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGenQueries(context, angle::EntryPoint::GLGenQueries, n, idsPacked));
@@ -10906,7 +10906,7 @@ void GL_APIENTRY GL_GetBufferParameteriv(GLenum target, GLenum pname, GLint *par
     if (context)
     {
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetBufferParameteriv(context, angle::EntryPoint::GLGetBufferParameteriv,
@@ -10934,7 +10934,7 @@ void GL_APIENTRY GL_GetBufferPointerv(GLenum target, GLenum pname, void **params
     if (context)
     {
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetBufferPointerv(context, angle::EntryPoint::GLGetBufferPointerv,
@@ -10962,7 +10962,7 @@ void GL_APIENTRY GL_GetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetBufferSubData(context, angle::EntryPoint::GLGetBufferSubData,
                                                                                           target, offset, size, data));
@@ -10988,7 +10988,7 @@ void GL_APIENTRY GL_GetQueryObjectiv(GLuint id, GLenum pname, GLint *params)
     if (context)
     {
         QueryID idPacked                                      = PackParam<QueryID>(id);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryObjectiv(context, angle::EntryPoint::GLGetQueryObjectiv,
                                                                                           idPacked, pname, params));
@@ -11012,7 +11012,7 @@ void GL_APIENTRY GL_GetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params)
     if (context)
     {
         QueryID idPacked                                      = PackParam<QueryID>(id);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetQueryObjectuiv(context, angle::EntryPoint::GLGetQueryObjectuiv, idPacked,
@@ -11040,7 +11040,7 @@ void GL_APIENTRY GL_GetQueryiv(GLenum target, GLenum pname, GLint *params)
     if (context)
     {
         QueryType targetPacked                                = PackParam<QueryType>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryiv(context, angle::EntryPoint::GLGetQueryiv,
                                                                                     targetPacked, pname, params));
@@ -11065,7 +11065,7 @@ GLboolean GL_APIENTRY GL_IsBuffer(GLuint buffer)
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateIsBuffer(context, angle::EntryPoint::GLIsBuffer, bufferPacked));
         if (isCallValid)
@@ -11095,7 +11095,7 @@ GLboolean GL_APIENTRY GL_IsQuery(GLuint id)
     if (context)
     {
         QueryID idPacked                                      = PackParam<QueryID>(id);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateIsQuery(context, angle::EntryPoint::GLIsQuery, idPacked));
         if (isCallValid)
@@ -11127,7 +11127,7 @@ void *GL_APIENTRY GL_MapBuffer(GLenum target, GLenum access)
     if (context)
     {
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMapBuffer(context, angle::EntryPoint::GLMapBuffer, targetPacked, access));
@@ -11159,7 +11159,7 @@ GLboolean GL_APIENTRY GL_UnmapBuffer(GLenum target)
     if (context)
     {
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUnmapBuffer(context, angle::EntryPoint::GLUnmapBuffer, targetPacked));
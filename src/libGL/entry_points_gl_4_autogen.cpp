@@ -39,7 +39,7 @@ void GL_APIENTRY GL_BeginQueryIndexed(GLenum target, GLuint index, GLuint id)
     if (context)
     {
         QueryID idPacked                                      = PackParam<QueryID>(id);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBeginQueryIndexed(context, angle::EntryPoint::GLBeginQueryIndexed, target,
@@ -65,7 +65,7 @@ void GL_APIENTRY GL_BindTransformFeedback(GLenum target, GLuint id)
     if (context)
     {
         TransformFeedbackID idPacked                          = PackParam<TransformFeedbackID>(id);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBindTransformFeedback(context, angle::EntryPoint::GLBindTransformFeedback,
@@ -91,7 +91,7 @@ void GL_APIENTRY GL_BlendEquationSeparatei(GLuint buf, GLenum modeRGB, GLenum mo
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlendEquationSeparatei(context, angle::EntryPoint::GLBlendEquationSeparatei,
@@ -116,7 +116,7 @@ void GL_APIENTRY GL_BlendEquationi(GLuint buf, GLenum mode)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlendEquationi(context, angle::EntryPoint::GLBlendEquationi, buf, mode));
@@ -145,7 +145,7 @@ GL_BlendFuncSeparatei(GLuint buf, GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlendFuncSeparatei(context, angle::EntryPoint::GLBlendFuncSeparatei, buf,
@@ -172,7 +172,7 @@ void GL_APIENTRY GL_BlendFunci(GLuint buf, GLenum src, GLenum dst)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlendFunci(context, angle::EntryPoint::GLBlendFunci, buf, src, dst));
@@ -197,7 +197,7 @@ void GL_APIENTRY GL_DeleteTransformFeedbacks(GLsizei n, const GLuint *ids)
     if (context)
     {
         const TransformFeedbackID *idsPacked = PackParam<const TransformFeedbackID *>(ids);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDeleteTransformFeedbacks(
@@ -223,7 +223,7 @@ void GL_APIENTRY GL_DrawArraysIndirect(GLenum mode, const void *indirect)
     if (context)
     {
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDrawArraysIndirect(context, angle::EntryPoint::GLDrawArraysIndirect,
@@ -252,7 +252,7 @@ void GL_APIENTRY GL_DrawElementsIndirect(GLenum mode, GLenum type, const void *i
     {
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDrawElementsIndirect(context, angle::EntryPoint::GLDrawElementsIndirect,
@@ -279,7 +279,7 @@ void GL_APIENTRY GL_DrawTransformFeedback(GLenum mode, GLuint id)
     if (context)
     {
         TransformFeedbackID idPacked                          = PackParam<TransformFeedbackID>(id);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDrawTransformFeedback(context, angle::EntryPoint::GLDrawTransformFeedback,
@@ -305,7 +305,7 @@ void GL_APIENTRY GL_DrawTransformFeedbackStream(GLenum mode, GLuint id, GLuint s
     if (context)
     {
         TransformFeedbackID idPacked                          = PackParam<TransformFeedbackID>(id);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawTransformFeedbackStream(
                                                                      context, angle::EntryPoint::GLDrawTransformFeedbackStream, mode,
@@ -330,7 +330,7 @@ void GL_APIENTRY GL_EndQueryIndexed(GLenum target, GLuint index)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateEndQueryIndexed(context, angle::EntryPoint::GLEndQueryIndexed, target, index));
@@ -355,7 +355,7 @@ void GL_APIENTRY GL_GenTransformFeedbacks(GLsizei n, GLuint *ids)
     if (context)
     {
         TransformFeedbackID *idsPacked = PackParam<TransformFeedbackID *>(ids);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGenTransformFeedbacks(
                                                                      context, angle::EntryPoint::GLGenTransformFeedbacks, n, idsPacked));
@@ -388,7 +388,7 @@ void GL_APIENTRY GL_GetActiveSubroutineName(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveSubroutineName(
                                                                      context, angle::EntryPoint::GLGetActiveSubroutineName,
@@ -424,7 +424,7 @@ void GL_APIENTRY GL_GetActiveSubroutineUniformName(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveSubroutineUniformName(
                                                                      context, angle::EntryPoint::GLGetActiveSubroutineUniformName,
@@ -459,7 +459,7 @@ void GL_APIENTRY GL_GetActiveSubroutineUniformiv(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveSubroutineUniformiv(
                                                                      context, angle::EntryPoint::GLGetActiveSubroutineUniformiv,
@@ -491,7 +491,7 @@ void GL_APIENTRY GL_GetProgramStageiv(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramStageiv(context, angle::EntryPoint::GLGetProgramStageiv,
@@ -519,7 +519,7 @@ void GL_APIENTRY GL_GetQueryIndexediv(GLenum target, GLuint index, GLenum pname,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetQueryIndexediv(context, angle::EntryPoint::GLGetQueryIndexediv, target,
@@ -547,7 +547,7 @@ GLuint GL_APIENTRY GL_GetSubroutineIndex(GLuint program, GLenum shadertype, cons
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetSubroutineIndex(context, angle::EntryPoint::GLGetSubroutineIndex,
@@ -584,7 +584,7 @@ GLint GL_APIENTRY GL_GetSubroutineUniformLocation(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetSubroutineUniformLocation(
                                                                      context, angle::EntryPoint::GLGetSubroutineUniformLocation,
@@ -619,7 +619,7 @@ void GL_APIENTRY GL_GetUniformSubroutineuiv(GLenum shadertype, GLint location, G
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetUniformSubroutineuiv(context, angle::EntryPoint::GLGetUniformSubroutineuiv,
@@ -648,7 +648,7 @@ void GL_APIENTRY GL_GetUniformdv(GLuint program, GLint location, GLdouble *param
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetUniformdv(context, angle::EntryPoint::GLGetUniformdv,
                                                                                       programPacked, locationPacked, params));
@@ -673,7 +673,7 @@ GLboolean GL_APIENTRY GL_IsTransformFeedback(GLuint id)
     if (context)
     {
         TransformFeedbackID idPacked                          = PackParam<TransformFeedbackID>(id);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateIsTransformFeedback(
                                                                      context, angle::EntryPoint::GLIsTransformFeedback, idPacked));
@@ -703,7 +703,7 @@ void GL_APIENTRY GL_MinSampleShading(GLfloat value)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMinSampleShading(context, angle::EntryPoint::GLMinSampleShading, value));
@@ -727,7 +727,7 @@ void GL_APIENTRY GL_PatchParameterfv(GLenum pname, const GLfloat *values)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePatchParameterfv(context, angle::EntryPoint::GLPatchParameterfv,
                                                                                           pname, values));
@@ -751,7 +751,7 @@ void GL_APIENTRY GL_PatchParameteri(GLenum pname, GLint value)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePatchParameteri(context, angle::EntryPoint::GLPatchParameteri, pname, value));
@@ -774,7 +774,7 @@ void GL_APIENTRY GL_PauseTransformFeedback()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePauseTransformFeedback(context, angle::EntryPoint::GLPauseTransformFeedback));
@@ -797,7 +797,7 @@ void GL_APIENTRY GL_ResumeTransformFeedback()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateResumeTransformFeedback(
                                                                      context, angle::EntryPoint::GLResumeTransformFeedback));
@@ -821,7 +821,7 @@ void GL_APIENTRY GL_Uniform1d(GLint location, GLdouble x)
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniform1d(context, angle::EntryPoint::GLUniform1d, locationPacked, x));
@@ -847,7 +847,7 @@ void GL_APIENTRY GL_Uniform1dv(GLint location, GLsizei count, const GLdouble *va
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform1dv(context, angle::EntryPoint::GLUniform1dv,
                                                                                     locationPacked, count, value));
@@ -872,7 +872,7 @@ void GL_APIENTRY GL_Uniform2d(GLint location, GLdouble x, GLdouble y)
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniform2d(context, angle::EntryPoint::GLUniform2d, locationPacked, x, y));
@@ -898,7 +898,7 @@ void GL_APIENTRY GL_Uniform2dv(GLint location, GLsizei count, const GLdouble *va
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform2dv(context, angle::EntryPoint::GLUniform2dv,
                                                                                     locationPacked, count, value));
@@ -923,7 +923,7 @@ void GL_APIENTRY GL_Uniform3d(GLint location, GLdouble x, GLdouble y, GLdouble z
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniform3d(context, angle::EntryPoint::GLUniform3d, locationPacked, x, y, z));
@@ -949,7 +949,7 @@ void GL_APIENTRY GL_Uniform3dv(GLint location, GLsizei count, const GLdouble *va
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform3dv(context, angle::EntryPoint::GLUniform3dv,
                                                                                     locationPacked, count, value));
@@ -974,7 +974,7 @@ void GL_APIENTRY GL_Uniform4d(GLint location, GLdouble x, GLdouble y, GLdouble z
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() || ValidateUniform4d(context, angle::EntryPoint::GLUniform4d,
                                                             locationPacked, x, y, z, w));
@@ -1000,7 +1000,7 @@ void GL_APIENTRY GL_Uniform4dv(GLint location, GLsizei count, const GLdouble *va
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniform4dv(context, angle::EntryPoint::GLUniform4dv,
                                                                                     locationPacked, count, value));
@@ -1029,7 +1029,7 @@ void GL_APIENTRY GL_UniformMatrix2dv(GLint location,
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniformMatrix2dv(context, angle::EntryPoint::GLUniformMatrix2dv,
                                                                                           locationPacked, count, transpose, value));
@@ -1059,7 +1059,7 @@ void GL_APIENTRY GL_UniformMatrix2x3dv(GLint location,
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix2x3dv(context, angle::EntryPoint::GLUniformMatrix2x3dv,
@@ -1090,7 +1090,7 @@ void GL_APIENTRY GL_UniformMatrix2x4dv(GLint location,
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix2x4dv(context, angle::EntryPoint::GLUniformMatrix2x4dv,
@@ -1121,7 +1121,7 @@ void GL_APIENTRY GL_UniformMatrix3dv(GLint location,
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniformMatrix3dv(context, angle::EntryPoint::GLUniformMatrix3dv,
                                                                                           locationPacked, count, transpose, value));
@@ -1151,7 +1151,7 @@ void GL_APIENTRY GL_UniformMatrix3x2dv(GLint location,
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix3x2dv(context, angle::EntryPoint::GLUniformMatrix3x2dv,
@@ -1182,7 +1182,7 @@ void GL_APIENTRY GL_UniformMatrix3x4dv(GLint location,
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix3x4dv(context, angle::EntryPoint::GLUniformMatrix3x4dv,
@@ -1213,7 +1213,7 @@ void GL_APIENTRY GL_UniformMatrix4dv(GLint location,
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUniformMatrix4dv(context, angle::EntryPoint::GLUniformMatrix4dv,
                                                                                           locationPacked, count, transpose, value));
@@ -1243,7 +1243,7 @@ void GL_APIENTRY GL_UniformMatrix4x2dv(GLint location,
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix4x2dv(context, angle::EntryPoint::GLUniformMatrix4x2dv,
@@ -1274,7 +1274,7 @@ void GL_APIENTRY GL_UniformMatrix4x3dv(GLint location,
     if (context)
     {
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformMatrix4x3dv(context, angle::EntryPoint::GLUniformMatrix4x3dv,
@@ -1301,7 +1301,7 @@ void GL_APIENTRY GL_UniformSubroutinesuiv(GLenum shadertype, GLsizei count, cons
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateUniformSubroutinesuiv(context, angle::EntryPoint::GLUniformSubroutinesuiv,
@@ -1329,7 +1329,7 @@ void GL_APIENTRY GL_ActiveShaderProgram(GLuint pipeline, GLuint program)
     {
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         ShaderProgramID programPacked    = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateActiveShaderProgram(context, angle::EntryPoint::GLActiveShaderProgram,
@@ -1354,7 +1354,7 @@ void GL_APIENTRY GL_BindProgramPipeline(GLuint pipeline)
     if (context)
     {
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindProgramPipeline(
                                                                      context, angle::EntryPoint::GLBindProgramPipeline, pipelinePacked));
@@ -1377,7 +1377,7 @@ void GL_APIENTRY GL_ClearDepthf(GLfloat d)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearDepthf(context, angle::EntryPoint::GLClearDepthf, d));
         if (isCallValid)
@@ -1403,7 +1403,7 @@ GLuint GL_APIENTRY GL_CreateShaderProgramv(GLenum type, GLsizei count, const GLc
     if (context)
     {
         ShaderType typePacked                                 = PackParam<ShaderType>(type);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCreateShaderProgramv(context, angle::EntryPoint::GLCreateShaderProgramv,
@@ -1437,7 +1437,7 @@ void GL_APIENTRY GL_DeleteProgramPipelines(GLsizei n, const GLuint *pipelines)
     if (context)
     {
         const ProgramPipelineID *pipelinesPacked = PackParam<const ProgramPipelineID *>(pipelines);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDeleteProgramPipelines(context, angle::EntryPoint::GLDeleteProgramPipelines, n,
@@ -1463,7 +1463,7 @@ void GL_APIENTRY GL_DepthRangeArrayv(GLuint first, GLsizei count, const GLdouble
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDepthRangeArrayv(context, angle::EntryPoint::GLDepthRangeArrayv,
                                                                                           first, count, v));
@@ -1487,7 +1487,7 @@ void GL_APIENTRY GL_DepthRangeIndexed(GLuint index, GLdouble n, GLdouble f)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDepthRangeIndexed(
                                                                      context, angle::EntryPoint::GLDepthRangeIndexed, index, n, f));
@@ -1510,7 +1510,7 @@ void GL_APIENTRY GL_DepthRangef(GLfloat n, GLfloat f)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDepthRangef(context, angle::EntryPoint::GLDepthRangef, n, f));
         if (isCallValid)
@@ -1534,7 +1534,7 @@ void GL_APIENTRY GL_GenProgramPipelines(GLsizei n, GLuint *pipelines)
     if (context)
     {
         ProgramPipelineID *pipelinesPacked = PackParam<ProgramPipelineID *>(pipelines);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGenProgramPipelines(context, angle::EntryPoint::GLGenProgramPipelines, n,
@@ -1560,7 +1560,7 @@ void GL_APIENTRY GL_GetDoublei_v(GLenum target, GLuint index, GLdouble *data)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetDoublei_v(context, angle::EntryPoint::GLGetDoublei_v, target, index, data));
@@ -1584,7 +1584,7 @@ void GL_APIENTRY GL_GetFloati_v(GLenum target, GLuint index, GLfloat *data)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetFloati_v(context, angle::EntryPoint::GLGetFloati_v, target, index, data));
@@ -1616,7 +1616,7 @@ void GL_APIENTRY GL_GetProgramBinary(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramBinary(context, angle::EntryPoint::GLGetProgramBinary, programPacked,
@@ -1648,7 +1648,7 @@ void GL_APIENTRY GL_GetProgramPipelineInfoLog(GLuint pipeline,
     if (context)
     {
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramPipelineInfoLog(
                                                                      context, angle::EntryPoint::GLGetProgramPipelineInfoLog,
@@ -1676,7 +1676,7 @@ void GL_APIENTRY GL_GetProgramPipelineiv(GLuint pipeline, GLenum pname, GLint *p
     if (context)
     {
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramPipelineiv(context, angle::EntryPoint::GLGetProgramPipelineiv,
@@ -1708,7 +1708,7 @@ void GL_APIENTRY GL_GetShaderPrecisionFormat(GLenum shadertype,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetShaderPrecisionFormat(
                                                                      context, angle::EntryPoint::GLGetShaderPrecisionFormat, shadertype,
@@ -1735,7 +1735,7 @@ void GL_APIENTRY GL_GetVertexAttribLdv(GLuint index, GLenum pname, GLdouble *par
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetVertexAttribLdv(context, angle::EntryPoint::GLGetVertexAttribLdv, index,
@@ -1761,7 +1761,7 @@ GLboolean GL_APIENTRY GL_IsProgramPipeline(GLuint pipeline)
     if (context)
     {
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateIsProgramPipeline(
                                                                      context, angle::EntryPoint::GLIsProgramPipeline, pipelinePacked));
@@ -1798,7 +1798,7 @@ void GL_APIENTRY GL_ProgramBinary(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramBinary(context, angle::EntryPoint::GLProgramBinary,
                                                                                        programPacked, binaryFormat, binary, length));
@@ -1824,7 +1824,7 @@ void GL_APIENTRY GL_ProgramParameteri(GLuint program, GLenum pname, GLint value)
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramParameteri(context, angle::EntryPoint::GLProgramParameteri,
@@ -1851,7 +1851,7 @@ void GL_APIENTRY GL_ProgramUniform1d(GLuint program, GLint location, GLdouble v0
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform1d(context, angle::EntryPoint::GLProgramUniform1d,
                                                                                           programPacked, locationPacked, v0));
@@ -1881,7 +1881,7 @@ void GL_APIENTRY GL_ProgramUniform1dv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1dv(context, angle::EntryPoint::GLProgramUniform1dv,
@@ -1909,7 +1909,7 @@ void GL_APIENTRY GL_ProgramUniform1f(GLuint program, GLint location, GLfloat v0)
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform1f(context, angle::EntryPoint::GLProgramUniform1f,
                                                                                           programPacked, locationPacked, v0));
@@ -1939,7 +1939,7 @@ void GL_APIENTRY GL_ProgramUniform1fv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1fv(context, angle::EntryPoint::GLProgramUniform1fv,
@@ -1967,7 +1967,7 @@ void GL_APIENTRY GL_ProgramUniform1i(GLuint program, GLint location, GLint v0)
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform1i(context, angle::EntryPoint::GLProgramUniform1i,
                                                                                           programPacked, locationPacked, v0));
@@ -1997,7 +1997,7 @@ void GL_APIENTRY GL_ProgramUniform1iv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1iv(context, angle::EntryPoint::GLProgramUniform1iv,
@@ -2025,7 +2025,7 @@ void GL_APIENTRY GL_ProgramUniform1ui(GLuint program, GLint location, GLuint v0)
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1ui(context, angle::EntryPoint::GLProgramUniform1ui,
@@ -2057,7 +2057,7 @@ void GL_APIENTRY GL_ProgramUniform1uiv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform1uiv(context, angle::EntryPoint::GLProgramUniform1uiv,
@@ -2086,7 +2086,7 @@ void GL_APIENTRY GL_ProgramUniform2d(GLuint program, GLint location, GLdouble v0
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform2d(context, angle::EntryPoint::GLProgramUniform2d,
                                                                                           programPacked, locationPacked, v0, v1));
@@ -2117,7 +2117,7 @@ void GL_APIENTRY GL_ProgramUniform2dv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2dv(context, angle::EntryPoint::GLProgramUniform2dv,
@@ -2146,7 +2146,7 @@ void GL_APIENTRY GL_ProgramUniform2f(GLuint program, GLint location, GLfloat v0,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform2f(context, angle::EntryPoint::GLProgramUniform2f,
                                                                                           programPacked, locationPacked, v0, v1));
@@ -2177,7 +2177,7 @@ void GL_APIENTRY GL_ProgramUniform2fv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2fv(context, angle::EntryPoint::GLProgramUniform2fv,
@@ -2206,7 +2206,7 @@ void GL_APIENTRY GL_ProgramUniform2i(GLuint program, GLint location, GLint v0, G
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform2i(context, angle::EntryPoint::GLProgramUniform2i,
                                                                                           programPacked, locationPacked, v0, v1));
@@ -2237,7 +2237,7 @@ void GL_APIENTRY GL_ProgramUniform2iv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2iv(context, angle::EntryPoint::GLProgramUniform2iv,
@@ -2266,7 +2266,7 @@ void GL_APIENTRY GL_ProgramUniform2ui(GLuint program, GLint location, GLuint v0,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2ui(context, angle::EntryPoint::GLProgramUniform2ui,
@@ -2298,7 +2298,7 @@ void GL_APIENTRY GL_ProgramUniform2uiv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform2uiv(context, angle::EntryPoint::GLProgramUniform2uiv,
@@ -2328,7 +2328,7 @@ GL_ProgramUniform3d(GLuint program, GLint location, GLdouble v0, GLdouble v1, GL
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform3d(context, angle::EntryPoint::GLProgramUniform3d,
                                                                                           programPacked, locationPacked, v0, v1, v2));
@@ -2359,7 +2359,7 @@ void GL_APIENTRY GL_ProgramUniform3dv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3dv(context, angle::EntryPoint::GLProgramUniform3dv,
@@ -2389,7 +2389,7 @@ GL_ProgramUniform3f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfl
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform3f(context, angle::EntryPoint::GLProgramUniform3f,
                                                                                           programPacked, locationPacked, v0, v1, v2));
@@ -2420,7 +2420,7 @@ void GL_APIENTRY GL_ProgramUniform3fv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3fv(context, angle::EntryPoint::GLProgramUniform3fv,
@@ -2449,7 +2449,7 @@ void GL_APIENTRY GL_ProgramUniform3i(GLuint program, GLint location, GLint v0, G
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniform3i(context, angle::EntryPoint::GLProgramUniform3i,
                                                                                           programPacked, locationPacked, v0, v1, v2));
@@ -2480,7 +2480,7 @@ void GL_APIENTRY GL_ProgramUniform3iv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3iv(context, angle::EntryPoint::GLProgramUniform3iv,
@@ -2510,7 +2510,7 @@ GL_ProgramUniform3ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuin
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3ui(context, angle::EntryPoint::GLProgramUniform3ui,
@@ -2542,7 +2542,7 @@ void GL_APIENTRY GL_ProgramUniform3uiv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform3uiv(context, angle::EntryPoint::GLProgramUniform3uiv,
@@ -2576,7 +2576,7 @@ void GL_APIENTRY GL_ProgramUniform4d(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4d(context, angle::EntryPoint::GLProgramUniform4d, programPacked,
@@ -2608,7 +2608,7 @@ void GL_APIENTRY GL_ProgramUniform4dv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4dv(context, angle::EntryPoint::GLProgramUniform4dv,
@@ -2638,7 +2638,7 @@ GL_ProgramUniform4f(GLuint program, GLint location, GLfloat v0, GLfloat v1, GLfl
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4f(context, angle::EntryPoint::GLProgramUniform4f, programPacked,
@@ -2670,7 +2670,7 @@ void GL_APIENTRY GL_ProgramUniform4fv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4fv(context, angle::EntryPoint::GLProgramUniform4fv,
@@ -2700,7 +2700,7 @@ GL_ProgramUniform4i(GLuint program, GLint location, GLint v0, GLint v1, GLint v2
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4i(context, angle::EntryPoint::GLProgramUniform4i, programPacked,
@@ -2732,7 +2732,7 @@ void GL_APIENTRY GL_ProgramUniform4iv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4iv(context, angle::EntryPoint::GLProgramUniform4iv,
@@ -2762,7 +2762,7 @@ GL_ProgramUniform4ui(GLuint program, GLint location, GLuint v0, GLuint v1, GLuin
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4ui(context, angle::EntryPoint::GLProgramUniform4ui,
@@ -2794,7 +2794,7 @@ void GL_APIENTRY GL_ProgramUniform4uiv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateProgramUniform4uiv(context, angle::EntryPoint::GLProgramUniform4uiv,
@@ -2828,7 +2828,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2dv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2dv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix2dv,
@@ -2863,7 +2863,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2fv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2fv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix2fv,
@@ -2898,7 +2898,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x3dv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2x3dv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix2x3dv,
@@ -2933,7 +2933,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x3fv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2x3fv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix2x3fv,
@@ -2968,7 +2968,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x4dv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2x4dv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix2x4dv,
@@ -3003,7 +3003,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix2x4fv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix2x4fv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix2x4fv,
@@ -3038,7 +3038,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3dv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3dv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix3dv,
@@ -3073,7 +3073,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3fv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3fv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix3fv,
@@ -3108,7 +3108,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x2dv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3x2dv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix3x2dv,
@@ -3143,7 +3143,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x2fv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3x2fv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix3x2fv,
@@ -3178,7 +3178,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x4dv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3x4dv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix3x4dv,
@@ -3213,7 +3213,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix3x4fv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix3x4fv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix3x4fv,
@@ -3248,7 +3248,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4dv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4dv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix4dv,
@@ -3283,7 +3283,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4fv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4fv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix4fv,
@@ -3318,7 +3318,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x2dv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4x2dv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix4x2dv,
@@ -3353,7 +3353,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x2fv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4x2fv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix4x2fv,
@@ -3388,7 +3388,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3dv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4x3dv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix4x3dv,
@@ -3423,7 +3423,7 @@ void GL_APIENTRY GL_ProgramUniformMatrix4x3fv(GLuint program,
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateProgramUniformMatrix4x3fv(
                                                                      context, angle::EntryPoint::GLProgramUniformMatrix4x3fv,
@@ -3449,7 +3449,7 @@ void GL_APIENTRY GL_ReleaseShaderCompiler()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateReleaseShaderCompiler(context, angle::EntryPoint::GLReleaseShaderCompiler));
@@ -3473,7 +3473,7 @@ void GL_APIENTRY GL_ScissorArrayv(GLuint first, GLsizei count, const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateScissorArrayv(context, angle::EntryPoint::GLScissorArrayv, first, count, v));
@@ -3499,7 +3499,7 @@ GL_ScissorIndexed(GLuint index, GLint left, GLint bottom, GLsizei width, GLsizei
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateScissorIndexed(context, angle::EntryPoint::GLScissorIndexed,
                                                                                         index, left, bottom, width, height));
@@ -3523,7 +3523,7 @@ void GL_APIENTRY GL_ScissorIndexedv(GLuint index, const GLint *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateScissorIndexedv(context, angle::EntryPoint::GLScissorIndexedv, index, v));
@@ -3555,7 +3555,7 @@ void GL_APIENTRY GL_ShaderBinary(GLsizei count,
     if (context)
     {
         const ShaderProgramID *shadersPacked = PackParam<const ShaderProgramID *>(shaders);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateShaderBinary(context, angle::EntryPoint::GLShaderBinary, count,
                                                                                       shadersPacked, binaryformat, binary, length));
@@ -3583,7 +3583,7 @@ void GL_APIENTRY GL_UseProgramStages(GLuint pipeline, GLbitfield stages, GLuint
     {
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
         ShaderProgramID programPacked    = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUseProgramStages(context, angle::EntryPoint::GLUseProgramStages,
                                                                                           pipelinePacked, stages, programPacked));
@@ -3609,7 +3609,7 @@ void GL_APIENTRY GL_ValidateProgramPipeline(GLuint pipeline)
     if (context)
     {
         ProgramPipelineID pipelinePacked = PackParam<ProgramPipelineID>(pipeline);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateValidateProgramPipeline(context, angle::EntryPoint::GLValidateProgramPipeline,
@@ -3633,7 +3633,7 @@ void GL_APIENTRY GL_VertexAttribL1d(GLuint index, GLdouble x)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribL1d(context, angle::EntryPoint::GLVertexAttribL1d, index, x));
@@ -3657,7 +3657,7 @@ void GL_APIENTRY GL_VertexAttribL1dv(GLuint index, const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribL1dv(context, angle::EntryPoint::GLVertexAttribL1dv, index, v));
@@ -3681,7 +3681,7 @@ void GL_APIENTRY GL_VertexAttribL2d(GLuint index, GLdouble x, GLdouble y)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribL2d(context, angle::EntryPoint::GLVertexAttribL2d, index, x, y));
@@ -3705,7 +3705,7 @@ void GL_APIENTRY GL_VertexAttribL2dv(GLuint index, const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribL2dv(context, angle::EntryPoint::GLVertexAttribL2dv, index, v));
@@ -3729,7 +3729,7 @@ void GL_APIENTRY GL_VertexAttribL3d(GLuint index, GLdouble x, GLdouble y, GLdoub
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribL3d(context, angle::EntryPoint::GLVertexAttribL3d,
                                                                                          index, x, y, z));
@@ -3753,7 +3753,7 @@ void GL_APIENTRY GL_VertexAttribL3dv(GLuint index, const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribL3dv(context, angle::EntryPoint::GLVertexAttribL3dv, index, v));
@@ -3777,7 +3777,7 @@ void GL_APIENTRY GL_VertexAttribL4d(GLuint index, GLdouble x, GLdouble y, GLdoub
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexAttribL4d(context, angle::EntryPoint::GLVertexAttribL4d,
                                                                                          index, x, y, z, w));
@@ -3801,7 +3801,7 @@ void GL_APIENTRY GL_VertexAttribL4dv(GLuint index, const GLdouble *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribL4dv(context, angle::EntryPoint::GLVertexAttribL4dv, index, v));
@@ -3829,7 +3829,7 @@ GL_VertexAttribLPointer(GLuint index, GLint size, GLenum type, GLsizei stride, c
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribLPointer(context, angle::EntryPoint::GLVertexAttribLPointer, index,
@@ -3855,7 +3855,7 @@ void GL_APIENTRY GL_ViewportArrayv(GLuint first, GLsizei count, const GLfloat *v
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateViewportArrayv(context, angle::EntryPoint::GLViewportArrayv, first, count, v));
@@ -3879,7 +3879,7 @@ void GL_APIENTRY GL_ViewportIndexedf(GLuint index, GLfloat x, GLfloat y, GLfloat
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateViewportIndexedf(context, angle::EntryPoint::GLViewportIndexedf,
                                                                                           index, x, y, w, h));
@@ -3903,7 +3903,7 @@ void GL_APIENTRY GL_ViewportIndexedfv(GLuint index, const GLfloat *v)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateViewportIndexedfv(context, angle::EntryPoint::GLViewportIndexedfv, index, v));
@@ -3939,7 +3939,7 @@ void GL_APIENTRY GL_BindImageTexture(GLuint unit,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBindImageTexture(context, angle::EntryPoint::GLBindImageTexture, unit,
@@ -3972,7 +3972,7 @@ void GL_APIENTRY GL_DrawArraysInstancedBaseInstance(GLenum mode,
     if (context)
     {
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawArraysInstancedBaseInstance(
                                                                      context, angle::EntryPoint::GLDrawArraysInstancedBaseInstance,
@@ -4008,7 +4008,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseInstance(GLenum mode,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawElementsInstancedBaseInstance(
                                                                      context, angle::EntryPoint::GLDrawElementsInstancedBaseInstance,
@@ -4047,7 +4047,7 @@ void GL_APIENTRY GL_DrawElementsInstancedBaseVertexBaseInstance(GLenum mode,
     {
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDrawElementsInstancedBaseVertexBaseInstance(
@@ -4078,7 +4078,7 @@ void GL_APIENTRY GL_DrawTransformFeedbackInstanced(GLenum mode, GLuint id, GLsiz
     if (context)
     {
         TransformFeedbackID idPacked                          = PackParam<TransformFeedbackID>(id);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawTransformFeedbackInstanced(
                                                                      context, angle::EntryPoint::GLDrawTransformFeedbackInstanced, mode,
@@ -4109,7 +4109,7 @@ void GL_APIENTRY GL_DrawTransformFeedbackStreamInstanced(GLenum mode,
     if (context)
     {
         TransformFeedbackID idPacked                          = PackParam<TransformFeedbackID>(id);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDrawTransformFeedbackStreamInstanced(
                                                                      context, angle::EntryPoint::GLDrawTransformFeedbackStreamInstanced,
@@ -4141,7 +4141,7 @@ void GL_APIENTRY GL_GetActiveAtomicCounterBufferiv(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetActiveAtomicCounterBufferiv(
                                                                      context, angle::EntryPoint::GLGetActiveAtomicCounterBufferiv,
@@ -4175,7 +4175,7 @@ void GL_APIENTRY GL_GetInternalformativ(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetInternalformativ(context, angle::EntryPoint::GLGetInternalformativ, target,
@@ -4201,7 +4201,7 @@ void GL_APIENTRY GL_MemoryBarrier(GLbitfield barriers)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMemoryBarrier(context, angle::EntryPoint::GLMemoryBarrier, barriers));
@@ -4230,7 +4230,7 @@ void GL_APIENTRY GL_TexStorage1D(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexStorage1D(context, angle::EntryPoint::GLTexStorage1D, target,
                                                                                       levels, internalformat, width));
@@ -4258,7 +4258,7 @@ GL_TexStorage2D(GLenum target, GLsizei levels, GLenum internalformat, GLsizei wi
     if (context)
     {
         TextureType targetPacked                              = PackParam<TextureType>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexStorage2D(context, angle::EntryPoint::GLTexStorage2D, targetPacked, levels,
@@ -4293,7 +4293,7 @@ void GL_APIENTRY GL_TexStorage3D(GLenum target,
     if (context)
     {
         TextureType targetPacked                              = PackParam<TextureType>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexStorage3D(context, angle::EntryPoint::GLTexStorage3D, targetPacked, levels,
@@ -4325,7 +4325,7 @@ void GL_APIENTRY GL_BindVertexBuffer(GLuint bindingindex,
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindVertexBuffer(context, angle::EntryPoint::GLBindVertexBuffer,
                                                                                           bindingindex, bufferPacked, offset, stride));
@@ -4359,7 +4359,7 @@ void GL_APIENTRY GL_ClearBufferData(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearBufferData(context, angle::EntryPoint::GLClearBufferData,
                                                                                          target, internalformat, format, type, data));
@@ -4396,7 +4396,7 @@ void GL_APIENTRY GL_ClearBufferSubData(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateClearBufferSubData(context, angle::EntryPoint::GLClearBufferSubData, target,
@@ -4442,7 +4442,7 @@ void GL_APIENTRY GL_CopyImageSubData(GLuint srcName,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCopyImageSubData(context, angle::EntryPoint::GLCopyImageSubData, srcName,
@@ -4473,7 +4473,7 @@ void GL_APIENTRY GL_DebugMessageCallback(GLDEBUGPROC callback, const void *userP
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDebugMessageCallback(context, angle::EntryPoint::GLDebugMessageCallback,
@@ -4508,7 +4508,7 @@ void GL_APIENTRY GL_DebugMessageControl(GLenum source,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDebugMessageControl(context, angle::EntryPoint::GLDebugMessageControl, source,
@@ -4543,7 +4543,7 @@ void GL_APIENTRY GL_DebugMessageInsert(GLenum source,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDebugMessageInsert(context, angle::EntryPoint::GLDebugMessageInsert, source,
@@ -4570,7 +4570,7 @@ void GL_APIENTRY GL_DispatchCompute(GLuint num_groups_x, GLuint num_groups_y, GL
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDispatchCompute(context, angle::EntryPoint::GLDispatchCompute,
                                                                                          num_groups_x, num_groups_y, num_groups_z));
@@ -4595,7 +4595,7 @@ void GL_APIENTRY GL_DispatchComputeIndirect(GLintptr indirect)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateDispatchComputeIndirect(
                                                                      context, angle::EntryPoint::GLDispatchComputeIndirect, indirect));
@@ -4620,7 +4620,7 @@ void GL_APIENTRY GL_FramebufferParameteri(GLenum target, GLenum pname, GLint par
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateFramebufferParameteri(context, angle::EntryPoint::GLFramebufferParameteri,
@@ -4657,7 +4657,7 @@ GLuint GL_APIENTRY GL_GetDebugMessageLog(GLuint count,
     GLuint returnValue;
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetDebugMessageLog(
                                                                      context, angle::EntryPoint::GLGetDebugMessageLog, count, bufSize,
@@ -4693,7 +4693,7 @@ void GL_APIENTRY GL_GetFramebufferParameteriv(GLenum target, GLenum pname, GLint
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetFramebufferParameteriv(
@@ -4726,7 +4726,7 @@ void GL_APIENTRY GL_GetInternalformati64v(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetInternalformati64v(context, angle::EntryPoint::GLGetInternalformati64v,
@@ -4756,7 +4756,7 @@ GL_GetObjectLabel(GLenum identifier, GLuint name, GLsizei bufSize, GLsizei *leng
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetObjectLabel(context, angle::EntryPoint::GLGetObjectLabel,
                                                                                         identifier, name, bufSize, length, label));
@@ -4786,7 +4786,7 @@ void GL_APIENTRY GL_GetObjectPtrLabel(const void *ptr,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetObjectPtrLabel(context, angle::EntryPoint::GLGetObjectPtrLabel, ptr,
@@ -4818,7 +4818,7 @@ void GL_APIENTRY GL_GetProgramInterfaceiv(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramInterfaceiv(context, angle::EntryPoint::GLGetProgramInterfaceiv,
@@ -4850,7 +4850,7 @@ GLuint GL_APIENTRY GL_GetProgramResourceIndex(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramResourceIndex(context, angle::EntryPoint::GLGetProgramResourceIndex,
@@ -4889,7 +4889,7 @@ GLint GL_APIENTRY GL_GetProgramResourceLocation(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramResourceLocation(
                                                                      context, angle::EntryPoint::GLGetProgramResourceLocation,
@@ -4930,7 +4930,7 @@ GLint GL_APIENTRY GL_GetProgramResourceLocationIndex(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramResourceLocationIndex(
                                                                      context, angle::EntryPoint::GLGetProgramResourceLocationIndex,
@@ -4975,7 +4975,7 @@ void GL_APIENTRY GL_GetProgramResourceName(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetProgramResourceName(
                                                                      context, angle::EntryPoint::GLGetProgramResourceName, programPacked,
@@ -5013,7 +5013,7 @@ void GL_APIENTRY GL_GetProgramResourceiv(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetProgramResourceiv(context, angle::EntryPoint::GLGetProgramResourceiv,
@@ -5041,7 +5041,7 @@ void GL_APIENTRY GL_InvalidateBufferData(GLuint buffer)
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateInvalidateBufferData(
                                                                      context, angle::EntryPoint::GLInvalidateBufferData, bufferPacked));
@@ -5067,7 +5067,7 @@ void GL_APIENTRY GL_InvalidateBufferSubData(GLuint buffer, GLintptr offset, GLsi
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateInvalidateBufferSubData(context, angle::EntryPoint::GLInvalidateBufferSubData,
@@ -5097,7 +5097,7 @@ void GL_APIENTRY GL_InvalidateFramebuffer(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateInvalidateFramebuffer(context, angle::EntryPoint::GLInvalidateFramebuffer,
@@ -5132,7 +5132,7 @@ void GL_APIENTRY GL_InvalidateSubFramebuffer(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateInvalidateSubFramebuffer(
                                                                      context, angle::EntryPoint::GLInvalidateSubFramebuffer, target,
@@ -5160,7 +5160,7 @@ void GL_APIENTRY GL_InvalidateTexImage(GLuint texture, GLint level)
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateInvalidateTexImage(context, angle::EntryPoint::GLInvalidateTexImage,
@@ -5195,7 +5195,7 @@ void GL_APIENTRY GL_InvalidateTexSubImage(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateInvalidateTexSubImage(
                                                                      context, angle::EntryPoint::GLInvalidateTexSubImage, texturePacked,
@@ -5228,7 +5228,7 @@ void GL_APIENTRY GL_MultiDrawArraysIndirect(GLenum mode,
     if (context)
     {
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMultiDrawArraysIndirect(context, angle::EntryPoint::GLMultiDrawArraysIndirect,
@@ -5264,7 +5264,7 @@ void GL_APIENTRY GL_MultiDrawElementsIndirect(GLenum mode,
     {
         PrimitiveMode modePacked                              = PackParam<PrimitiveMode>(mode);
         DrawElementsType typePacked                           = PackParam<DrawElementsType>(type);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiDrawElementsIndirect(
                                                                      context, angle::EntryPoint::GLMultiDrawElementsIndirect, modePacked,
@@ -5292,7 +5292,7 @@ void GL_APIENTRY GL_ObjectLabel(GLenum identifier, GLuint name, GLsizei length,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateObjectLabel(context, angle::EntryPoint::GLObjectLabel,
                                                                                      identifier, name, length, label));
@@ -5317,7 +5317,7 @@ void GL_APIENTRY GL_ObjectPtrLabel(const void *ptr, GLsizei length, const GLchar
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateObjectPtrLabel(context, angle::EntryPoint::GLObjectPtrLabel,
                                                                                         ptr, length, label));
@@ -5340,7 +5340,7 @@ void GL_APIENTRY GL_PopDebugGroup()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePopDebugGroup(context, angle::EntryPoint::GLPopDebugGroup));
         if (isCallValid)
@@ -5365,7 +5365,7 @@ void GL_APIENTRY GL_PushDebugGroup(GLenum source, GLuint id, GLsizei length, con
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidatePushDebugGroup(context, angle::EntryPoint::GLPushDebugGroup,
                                                                                         source, id, length, message));
@@ -5393,7 +5393,7 @@ void GL_APIENTRY GL_ShaderStorageBlockBinding(GLuint program,
     if (context)
     {
         ShaderProgramID programPacked                         = PackParam<ShaderProgramID>(program);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateShaderStorageBlockBinding(
                                                                      context, angle::EntryPoint::GLShaderStorageBlockBinding,
@@ -5429,7 +5429,7 @@ void GL_APIENTRY GL_TexBufferRange(GLenum target,
     {
         TextureType targetPacked                              = PackParam<TextureType>(target);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexBufferRange(context, angle::EntryPoint::GLTexBufferRange, targetPacked,
@@ -5465,7 +5465,7 @@ void GL_APIENTRY GL_TexStorage2DMultisample(GLenum target,
     if (context)
     {
         TextureType targetPacked                              = PackParam<TextureType>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTexStorage2DMultisample(
                                                                      context, angle::EntryPoint::GLTexStorage2DMultisample, targetPacked,
@@ -5503,7 +5503,7 @@ void GL_APIENTRY GL_TexStorage3DMultisample(GLenum target,
     if (context)
     {
         TextureType targetPacked                              = PackParam<TextureType>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTexStorage3DMultisample(context, angle::EntryPoint::GLTexStorage3DMultisample,
@@ -5543,7 +5543,7 @@ void GL_APIENTRY GL_TextureView(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTextureView(context, angle::EntryPoint::GLTextureView,
                                                                                      texturePacked, target, origtexture, internalformat,
@@ -5570,7 +5570,7 @@ void GL_APIENTRY GL_VertexAttribBinding(GLuint attribindex, GLuint bindingindex)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribBinding(context, angle::EntryPoint::GLVertexAttribBinding,
@@ -5603,7 +5603,7 @@ void GL_APIENTRY GL_VertexAttribFormat(GLuint attribindex,
     if (context)
     {
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribFormat(context, angle::EntryPoint::GLVertexAttribFormat,
@@ -5634,7 +5634,7 @@ void GL_APIENTRY GL_VertexAttribIFormat(GLuint attribindex,
     if (context)
     {
         VertexAttribType typePacked                           = PackParam<VertexAttribType>(type);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribIFormat(context, angle::EntryPoint::GLVertexAttribIFormat,
@@ -5664,7 +5664,7 @@ void GL_APIENTRY GL_VertexAttribLFormat(GLuint attribindex,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexAttribLFormat(context, angle::EntryPoint::GLVertexAttribLFormat,
@@ -5690,7 +5690,7 @@ void GL_APIENTRY GL_VertexBindingDivisor(GLuint bindingindex, GLuint divisor)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateVertexBindingDivisor(context, angle::EntryPoint::GLVertexBindingDivisor,
@@ -5722,7 +5722,7 @@ void GL_APIENTRY GL_BindBuffersBase(GLenum target,
     if (context)
     {
         const BufferID *buffersPacked = PackParam<const BufferID *>(buffers);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindBuffersBase(context, angle::EntryPoint::GLBindBuffersBase,
                                                                                          target, first, count, buffersPacked));
@@ -5756,7 +5756,7 @@ void GL_APIENTRY GL_BindBuffersRange(GLenum target,
     if (context)
     {
         const BufferID *buffersPacked = PackParam<const BufferID *>(buffers);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBindBuffersRange(context, angle::EntryPoint::GLBindBuffersRange, target, first,
@@ -5783,7 +5783,7 @@ void GL_APIENTRY GL_BindImageTextures(GLuint first, GLsizei count, const GLuint
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBindImageTextures(context, angle::EntryPoint::GLBindImageTextures, first,
@@ -5809,7 +5809,7 @@ void GL_APIENTRY GL_BindSamplers(GLuint first, GLsizei count, const GLuint *samp
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindSamplers(context, angle::EntryPoint::GLBindSamplers, first,
                                                                                       count, samplers));
@@ -5834,7 +5834,7 @@ void GL_APIENTRY GL_BindTextures(GLuint first, GLsizei count, const GLuint *text
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindTextures(context, angle::EntryPoint::GLBindTextures, first,
                                                                                       count, textures));
@@ -5865,7 +5865,7 @@ void GL_APIENTRY GL_BindVertexBuffers(GLuint first,
     if (context)
     {
         const BufferID *buffersPacked = PackParam<const BufferID *>(buffers);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBindVertexBuffers(context, angle::EntryPoint::GLBindVertexBuffers, first,
@@ -5898,7 +5898,7 @@ void GL_APIENTRY GL_BufferStorage(GLenum target,
     if (context)
     {
         BufferBinding targetPacked                            = PackParam<BufferBinding>(target);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBufferStorage(context, angle::EntryPoint::GLBufferStorage,
                                                                                        targetPacked, size, data, flags));
@@ -5927,7 +5927,7 @@ GL_ClearTexImage(GLuint texture, GLint level, GLenum format, GLenum type, const
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearTexImage(context, angle::EntryPoint::GLClearTexImage,
                                                                                        texturePacked, level, format, type, data));
@@ -5967,7 +5967,7 @@ void GL_APIENTRY GL_ClearTexSubImage(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateClearTexSubImage(context, angle::EntryPoint::GLClearTexSubImage, texturePacked,
@@ -5997,7 +5997,7 @@ void GL_APIENTRY GL_BindTextureUnit(GLuint unit, GLuint texture)
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateBindTextureUnit(context, angle::EntryPoint::GLBindTextureUnit,
                                                                                          unit, texturePacked));
@@ -6037,7 +6037,7 @@ void GL_APIENTRY GL_BlitNamedFramebuffer(GLuint readFramebuffer,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateBlitNamedFramebuffer(context, angle::EntryPoint::GLBlitNamedFramebuffer,
@@ -6068,7 +6068,7 @@ GLenum GL_APIENTRY GL_CheckNamedFramebufferStatus(GLuint framebuffer, GLenum tar
     if (context)
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCheckNamedFramebufferStatus(
                                                                      context, angle::EntryPoint::GLCheckNamedFramebufferStatus,
@@ -6111,7 +6111,7 @@ void GL_APIENTRY GL_ClearNamedBufferData(GLuint buffer,
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateClearNamedBufferData(context, angle::EntryPoint::GLClearNamedBufferData,
@@ -6149,7 +6149,7 @@ void GL_APIENTRY GL_ClearNamedBufferSubData(GLuint buffer,
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearNamedBufferSubData(
                                                                      context, angle::EntryPoint::GLClearNamedBufferSubData, bufferPacked,
@@ -6183,7 +6183,7 @@ void GL_APIENTRY GL_ClearNamedFramebufferfi(GLuint framebuffer,
     if (context)
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearNamedFramebufferfi(
                                                                      context, angle::EntryPoint::GLClearNamedFramebufferfi,
@@ -6215,7 +6215,7 @@ void GL_APIENTRY GL_ClearNamedFramebufferfv(GLuint framebuffer,
     if (context)
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateClearNamedFramebufferfv(context, angle::EntryPoint::GLClearNamedFramebufferfv,
@@ -6247,7 +6247,7 @@ void GL_APIENTRY GL_ClearNamedFramebufferiv(GLuint framebuffer,
     if (context)
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateClearNamedFramebufferiv(context, angle::EntryPoint::GLClearNamedFramebufferiv,
@@ -6279,7 +6279,7 @@ void GL_APIENTRY GL_ClearNamedFramebufferuiv(GLuint framebuffer,
     if (context)
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateClearNamedFramebufferuiv(
                                                                      context, angle::EntryPoint::GLClearNamedFramebufferuiv,
@@ -6306,7 +6306,7 @@ void GL_APIENTRY GL_ClipControl(GLenum origin, GLenum depth)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateClipControl(context, angle::EntryPoint::GLClipControl, origin, depth));
@@ -6340,7 +6340,7 @@ void GL_APIENTRY GL_CompressedTextureSubImage1D(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCompressedTextureSubImage1D(
                                                                      context, angle::EntryPoint::GLCompressedTextureSubImage1D,
@@ -6379,7 +6379,7 @@ void GL_APIENTRY GL_CompressedTextureSubImage2D(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCompressedTextureSubImage2D(
@@ -6421,7 +6421,7 @@ void GL_APIENTRY GL_CompressedTextureSubImage3D(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCompressedTextureSubImage3D(
@@ -6456,7 +6456,7 @@ void GL_APIENTRY GL_CopyNamedBufferSubData(GLuint readBuffer,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyNamedBufferSubData(
                                                                      context, angle::EntryPoint::GLCopyNamedBufferSubData, readBuffer,
@@ -6489,7 +6489,7 @@ void GL_APIENTRY GL_CopyTextureSubImage1D(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCopyTextureSubImage1D(context, angle::EntryPoint::GLCopyTextureSubImage1D,
@@ -6525,7 +6525,7 @@ void GL_APIENTRY GL_CopyTextureSubImage2D(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTextureSubImage2D(
                                                                      context, angle::EntryPoint::GLCopyTextureSubImage2D, texturePacked,
@@ -6563,7 +6563,7 @@ void GL_APIENTRY GL_CopyTextureSubImage3D(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCopyTextureSubImage3D(
                                                                      context, angle::EntryPoint::GLCopyTextureSubImage3D, texturePacked,
@@ -6591,7 +6591,7 @@ void GL_APIENTRY GL_CreateBuffers(GLsizei n, GLuint *buffers)
     if (context)
     {
         BufferID *buffersPacked                               = PackParam<BufferID *>(buffers);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCreateBuffers(context, angle::EntryPoint::GLCreateBuffers, n, buffersPacked));
@@ -6615,7 +6615,7 @@ void GL_APIENTRY GL_CreateFramebuffers(GLsizei n, GLuint *framebuffers)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCreateFramebuffers(
                                                                      context, angle::EntryPoint::GLCreateFramebuffers, n, framebuffers));
@@ -6639,7 +6639,7 @@ void GL_APIENTRY GL_CreateProgramPipelines(GLsizei n, GLuint *pipelines)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCreateProgramPipelines(context, angle::EntryPoint::GLCreateProgramPipelines, n,
@@ -6664,7 +6664,7 @@ void GL_APIENTRY GL_CreateQueries(GLenum target, GLsizei n, GLuint *ids)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCreateQueries(context, angle::EntryPoint::GLCreateQueries, target, n, ids));
@@ -6689,7 +6689,7 @@ void GL_APIENTRY GL_CreateRenderbuffers(GLsizei n, GLuint *renderbuffers)
     if (context)
     {
         RenderbufferID *renderbuffersPacked = PackParam<RenderbufferID *>(renderbuffers);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCreateRenderbuffers(context, angle::EntryPoint::GLCreateRenderbuffers, n,
@@ -6714,7 +6714,7 @@ void GL_APIENTRY GL_CreateSamplers(GLsizei n, GLuint *samplers)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateCreateSamplers(context, angle::EntryPoint::GLCreateSamplers, n, samplers));
@@ -6739,7 +6739,7 @@ void GL_APIENTRY GL_CreateTextures(GLenum target, GLsizei n, GLuint *textures)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCreateTextures(context, angle::EntryPoint::GLCreateTextures,
                                                                                         target, n, textures));
@@ -6763,7 +6763,7 @@ void GL_APIENTRY GL_CreateTransformFeedbacks(GLsizei n, GLuint *ids)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCreateTransformFeedbacks(
                                                                      context, angle::EntryPoint::GLCreateTransformFeedbacks, n, ids));
@@ -6788,7 +6788,7 @@ void GL_APIENTRY GL_CreateVertexArrays(GLsizei n, GLuint *arrays)
     if (context)
     {
         VertexArrayID *arraysPacked                           = PackParam<VertexArrayID *>(arrays);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateCreateVertexArrays(
                                                                      context, angle::EntryPoint::GLCreateVertexArrays, n, arraysPacked));
@@ -6813,7 +6813,7 @@ void GL_APIENTRY GL_DisableVertexArrayAttrib(GLuint vaobj, GLuint index)
     if (context)
     {
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateDisableVertexArrayAttrib(
@@ -6839,7 +6839,7 @@ void GL_APIENTRY GL_EnableVertexArrayAttrib(GLuint vaobj, GLuint index)
     if (context)
     {
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateEnableVertexArrayAttrib(context, angle::EntryPoint::GLEnableVertexArrayAttrib,
@@ -6866,7 +6866,7 @@ void GL_APIENTRY GL_FlushMappedNamedBufferRange(GLuint buffer, GLintptr offset,
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateFlushMappedNamedBufferRange(
                                                                      context, angle::EntryPoint::GLFlushMappedNamedBufferRange,
@@ -6892,7 +6892,7 @@ void GL_APIENTRY GL_GenerateTextureMipmap(GLuint texture)
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGenerateTextureMipmap(context, angle::EntryPoint::GLGenerateTextureMipmap,
@@ -6922,7 +6922,7 @@ void GL_APIENTRY GL_GetCompressedTextureImage(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetCompressedTextureImage(
                                                                      context, angle::EntryPoint::GLGetCompressedTextureImage,
@@ -6961,7 +6961,7 @@ void GL_APIENTRY GL_GetCompressedTextureSubImage(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetCompressedTextureSubImage(
@@ -6989,7 +6989,7 @@ GLenum GL_APIENTRY GL_GetGraphicsResetStatus()
     GLenum returnValue;
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetGraphicsResetStatus(context, angle::EntryPoint::GLGetGraphicsResetStatus));
@@ -7022,7 +7022,7 @@ void GL_APIENTRY GL_GetNamedBufferParameteri64v(GLuint buffer, GLenum pname, GLi
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetNamedBufferParameteri64v(
                                                                      context, angle::EntryPoint::GLGetNamedBufferParameteri64v,
@@ -7050,7 +7050,7 @@ void GL_APIENTRY GL_GetNamedBufferParameteriv(GLuint buffer, GLenum pname, GLint
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetNamedBufferParameteriv(
                                                                      context, angle::EntryPoint::GLGetNamedBufferParameteriv,
@@ -7078,7 +7078,7 @@ void GL_APIENTRY GL_GetNamedBufferPointerv(GLuint buffer, GLenum pname, void **p
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetNamedBufferPointerv(context, angle::EntryPoint::GLGetNamedBufferPointerv,
@@ -7109,7 +7109,7 @@ void GL_APIENTRY GL_GetNamedBufferSubData(GLuint buffer,
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetNamedBufferSubData(context, angle::EntryPoint::GLGetNamedBufferSubData,
@@ -7142,7 +7142,7 @@ void GL_APIENTRY GL_GetNamedFramebufferAttachmentParameteriv(GLuint framebuffer,
     if (context)
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetNamedFramebufferAttachmentParameteriv(
@@ -7173,7 +7173,7 @@ void GL_APIENTRY GL_GetNamedFramebufferParameteriv(GLuint framebuffer, GLenum pn
     if (context)
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetNamedFramebufferParameteriv(
                                                                      context, angle::EntryPoint::GLGetNamedFramebufferParameteriv,
@@ -7204,7 +7204,7 @@ void GL_APIENTRY GL_GetNamedRenderbufferParameteriv(GLuint renderbuffer,
     if (context)
     {
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetNamedRenderbufferParameteriv(
                                                                      context, angle::EntryPoint::GLGetNamedRenderbufferParameteriv,
@@ -7236,7 +7236,7 @@ void GL_APIENTRY GL_GetQueryBufferObjecti64v(GLuint id,
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryBufferObjecti64v(
                                                                      context, angle::EntryPoint::GLGetQueryBufferObjecti64v, id,
@@ -7265,7 +7265,7 @@ void GL_APIENTRY GL_GetQueryBufferObjectiv(GLuint id, GLuint buffer, GLenum pnam
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetQueryBufferObjectiv(context, angle::EntryPoint::GLGetQueryBufferObjectiv,
@@ -7297,7 +7297,7 @@ void GL_APIENTRY GL_GetQueryBufferObjectui64v(GLuint id,
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetQueryBufferObjectui64v(
                                                                      context, angle::EntryPoint::GLGetQueryBufferObjectui64v, id,
@@ -7326,7 +7326,7 @@ void GL_APIENTRY GL_GetQueryBufferObjectuiv(GLuint id, GLuint buffer, GLenum pna
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetQueryBufferObjectuiv(context, angle::EntryPoint::GLGetQueryBufferObjectuiv,
@@ -7361,7 +7361,7 @@ void GL_APIENTRY GL_GetTextureImage(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTextureImage(context, angle::EntryPoint::GLGetTextureImage, texturePacked,
@@ -7393,7 +7393,7 @@ void GL_APIENTRY GL_GetTextureLevelParameterfv(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTextureLevelParameterfv(
                                                                      context, angle::EntryPoint::GLGetTextureLevelParameterfv,
@@ -7425,7 +7425,7 @@ void GL_APIENTRY GL_GetTextureLevelParameteriv(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTextureLevelParameteriv(
                                                                      context, angle::EntryPoint::GLGetTextureLevelParameteriv,
@@ -7453,7 +7453,7 @@ void GL_APIENTRY GL_GetTextureParameterIiv(GLuint texture, GLenum pname, GLint *
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTextureParameterIiv(context, angle::EntryPoint::GLGetTextureParameterIiv,
@@ -7481,7 +7481,7 @@ void GL_APIENTRY GL_GetTextureParameterIuiv(GLuint texture, GLenum pname, GLuint
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTextureParameterIuiv(context, angle::EntryPoint::GLGetTextureParameterIuiv,
@@ -7509,7 +7509,7 @@ void GL_APIENTRY GL_GetTextureParameterfv(GLuint texture, GLenum pname, GLfloat
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTextureParameterfv(context, angle::EntryPoint::GLGetTextureParameterfv,
@@ -7536,7 +7536,7 @@ void GL_APIENTRY GL_GetTextureParameteriv(GLuint texture, GLenum pname, GLint *p
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTextureParameteriv(context, angle::EntryPoint::GLGetTextureParameteriv,
@@ -7579,7 +7579,7 @@ void GL_APIENTRY GL_GetTextureSubImage(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTextureSubImage(context, angle::EntryPoint::GLGetTextureSubImage,
@@ -7611,7 +7611,7 @@ void GL_APIENTRY GL_GetTransformFeedbacki64_v(GLuint xfb,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetTransformFeedbacki64_v(
                                                                      context, angle::EntryPoint::GLGetTransformFeedbacki64_v, xfb, pname,
@@ -7637,7 +7637,7 @@ void GL_APIENTRY GL_GetTransformFeedbacki_v(GLuint xfb, GLenum pname, GLuint ind
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTransformFeedbacki_v(context, angle::EntryPoint::GLGetTransformFeedbacki_v,
@@ -7663,7 +7663,7 @@ void GL_APIENTRY GL_GetTransformFeedbackiv(GLuint xfb, GLenum pname, GLint *para
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetTransformFeedbackiv(context, angle::EntryPoint::GLGetTransformFeedbackiv,
@@ -7694,7 +7694,7 @@ void GL_APIENTRY GL_GetVertexArrayIndexed64iv(GLuint vaobj,
     if (context)
     {
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetVertexArrayIndexed64iv(
                                                                      context, angle::EntryPoint::GLGetVertexArrayIndexed64iv,
@@ -7723,7 +7723,7 @@ void GL_APIENTRY GL_GetVertexArrayIndexediv(GLuint vaobj, GLuint index, GLenum p
     if (context)
     {
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetVertexArrayIndexediv(context, angle::EntryPoint::GLGetVertexArrayIndexediv,
@@ -7751,7 +7751,7 @@ void GL_APIENTRY GL_GetVertexArrayiv(GLuint vaobj, GLenum pname, GLint *param)
     if (context)
     {
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetVertexArrayiv(context, angle::EntryPoint::GLGetVertexArrayiv,
                                                                                           vaobjPacked, pname, param));
@@ -7780,7 +7780,7 @@ GL_GetnColorTable(GLenum target, GLenum format, GLenum type, GLsizei bufSize, vo
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnColorTable(context, angle::EntryPoint::GLGetnColorTable,
                                                                                         target, format, type, bufSize, table));
@@ -7807,7 +7807,7 @@ void GL_APIENTRY GL_GetnCompressedTexImage(GLenum target, GLint lod, GLsizei buf
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnCompressedTexImage(context, angle::EntryPoint::GLGetnCompressedTexImage,
@@ -7838,7 +7838,7 @@ GL_GetnConvolutionFilter(GLenum target, GLenum format, GLenum type, GLsizei bufS
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnConvolutionFilter(context, angle::EntryPoint::GLGetnConvolutionFilter,
@@ -7873,7 +7873,7 @@ void GL_APIENTRY GL_GetnHistogram(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnHistogram(context, angle::EntryPoint::GLGetnHistogram,
                                                                                        target, reset, format, type, bufSize, values));
@@ -7900,7 +7900,7 @@ void GL_APIENTRY GL_GetnMapdv(GLenum target, GLenum query, GLsizei bufSize, GLdo
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnMapdv(context, angle::EntryPoint::GLGetnMapdv, target, query, bufSize, v));
@@ -7926,7 +7926,7 @@ void GL_APIENTRY GL_GetnMapfv(GLenum target, GLenum query, GLsizei bufSize, GLfl
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnMapfv(context, angle::EntryPoint::GLGetnMapfv, target, query, bufSize, v));
@@ -7952,7 +7952,7 @@ void GL_APIENTRY GL_GetnMapiv(GLenum target, GLenum query, GLsizei bufSize, GLin
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnMapiv(context, angle::EntryPoint::GLGetnMapiv, target, query, bufSize, v));
@@ -7985,7 +7985,7 @@ void GL_APIENTRY GL_GetnMinmax(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnMinmax(context, angle::EntryPoint::GLGetnMinmax, target,
                                                                                     reset, format, type, bufSize, values));
@@ -8011,7 +8011,7 @@ void GL_APIENTRY GL_GetnPixelMapfv(GLenum map, GLsizei bufSize, GLfloat *values)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnPixelMapfv(context, angle::EntryPoint::GLGetnPixelMapfv,
                                                                                         map, bufSize, values));
@@ -8036,7 +8036,7 @@ void GL_APIENTRY GL_GetnPixelMapuiv(GLenum map, GLsizei bufSize, GLuint *values)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnPixelMapuiv(context, angle::EntryPoint::GLGetnPixelMapuiv,
                                                                                          map, bufSize, values));
@@ -8061,7 +8061,7 @@ void GL_APIENTRY GL_GetnPixelMapusv(GLenum map, GLsizei bufSize, GLushort *value
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnPixelMapusv(context, angle::EntryPoint::GLGetnPixelMapusv,
                                                                                          map, bufSize, values));
@@ -8085,7 +8085,7 @@ void GL_APIENTRY GL_GetnPolygonStipple(GLsizei bufSize, GLubyte *pattern)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateGetnPolygonStipple(context, angle::EntryPoint::GLGetnPolygonStipple, bufSize,
@@ -8122,7 +8122,7 @@ void GL_APIENTRY GL_GetnSeparableFilter(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnSeparableFilter(
                                                                      context, angle::EntryPoint::GLGetnSeparableFilter, target, format,
@@ -8158,7 +8158,7 @@ void GL_APIENTRY GL_GetnTexImage(GLenum target,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnTexImage(context, angle::EntryPoint::GLGetnTexImage, target,
                                                                                       level, format, type, bufSize, pixels));
@@ -8186,7 +8186,7 @@ void GL_APIENTRY GL_GetnUniformdv(GLuint program, GLint location, GLsizei bufSiz
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnUniformdv(context, angle::EntryPoint::GLGetnUniformdv,
                                                                                        programPacked, locationPacked, bufSize, params));
@@ -8214,7 +8214,7 @@ void GL_APIENTRY GL_GetnUniformfv(GLuint program, GLint location, GLsizei bufSiz
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnUniformfv(context, angle::EntryPoint::GLGetnUniformfv,
                                                                                        programPacked, locationPacked, bufSize, params));
@@ -8242,7 +8242,7 @@ void GL_APIENTRY GL_GetnUniformiv(GLuint program, GLint location, GLsizei bufSiz
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnUniformiv(context, angle::EntryPoint::GLGetnUniformiv,
                                                                                        programPacked, locationPacked, bufSize, params));
@@ -8270,7 +8270,7 @@ void GL_APIENTRY GL_GetnUniformuiv(GLuint program, GLint location, GLsizei bufSi
     {
         ShaderProgramID programPacked  = PackParam<ShaderProgramID>(program);
         UniformLocation locationPacked = PackParam<UniformLocation>(location);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateGetnUniformuiv(context, angle::EntryPoint::GLGetnUniformuiv,
                                                                                         programPacked, locationPacked, bufSize, params));
@@ -8299,7 +8299,7 @@ void GL_APIENTRY GL_InvalidateNamedFramebufferData(GLuint framebuffer,
     if (context)
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateInvalidateNamedFramebufferData(
                                                                      context, angle::EntryPoint::GLInvalidateNamedFramebufferData,
@@ -8334,7 +8334,7 @@ void GL_APIENTRY GL_InvalidateNamedFramebufferSubData(GLuint framebuffer,
     if (context)
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateInvalidateNamedFramebufferSubData(
@@ -8364,7 +8364,7 @@ void *GL_APIENTRY GL_MapNamedBuffer(GLuint buffer, GLenum access)
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMapNamedBuffer(context, angle::EntryPoint::GLMapNamedBuffer,
                                                                                         bufferPacked, access));
@@ -8401,7 +8401,7 @@ void *GL_APIENTRY GL_MapNamedBufferRange(GLuint buffer,
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateMapNamedBufferRange(context, angle::EntryPoint::GLMapNamedBufferRange,
@@ -8433,7 +8433,7 @@ void GL_APIENTRY GL_MemoryBarrierByRegion(GLbitfield barriers)
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMemoryBarrierByRegion(
                                                                      context, angle::EntryPoint::GLMemoryBarrierByRegion, barriers));
@@ -8460,7 +8460,7 @@ void GL_APIENTRY GL_NamedBufferData(GLuint buffer, GLsizeiptr size, const void *
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNamedBufferData(context, angle::EntryPoint::GLNamedBufferData,
                                                                                          bufferPacked, size, data, usage));
@@ -8490,7 +8490,7 @@ void GL_APIENTRY GL_NamedBufferStorage(GLuint buffer,
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateNamedBufferStorage(context, angle::EntryPoint::GLNamedBufferStorage,
@@ -8521,7 +8521,7 @@ void GL_APIENTRY GL_NamedBufferSubData(GLuint buffer,
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateNamedBufferSubData(context, angle::EntryPoint::GLNamedBufferSubData,
@@ -8548,7 +8548,7 @@ void GL_APIENTRY GL_NamedFramebufferDrawBuffer(GLuint framebuffer, GLenum buf)
     if (context)
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateNamedFramebufferDrawBuffer(
@@ -8575,7 +8575,7 @@ void GL_APIENTRY GL_NamedFramebufferDrawBuffers(GLuint framebuffer, GLsizei n, c
     if (context)
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNamedFramebufferDrawBuffers(
                                                                      context, angle::EntryPoint::GLNamedFramebufferDrawBuffers,
@@ -8603,7 +8603,7 @@ void GL_APIENTRY GL_NamedFramebufferParameteri(GLuint framebuffer, GLenum pname,
     if (context)
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNamedFramebufferParameteri(
                                                                      context, angle::EntryPoint::GLNamedFramebufferParameteri,
@@ -8630,7 +8630,7 @@ void GL_APIENTRY GL_NamedFramebufferReadBuffer(GLuint framebuffer, GLenum src)
     if (context)
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateNamedFramebufferReadBuffer(
@@ -8663,7 +8663,7 @@ void GL_APIENTRY GL_NamedFramebufferRenderbuffer(GLuint framebuffer,
     {
         FramebufferID framebufferPacked   = PackParam<FramebufferID>(framebuffer);
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateNamedFramebufferRenderbuffer(
@@ -8698,7 +8698,7 @@ void GL_APIENTRY GL_NamedFramebufferTexture(GLuint framebuffer,
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         TextureID texturePacked         = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateNamedFramebufferTexture(context, angle::EntryPoint::GLNamedFramebufferTexture,
@@ -8732,7 +8732,7 @@ void GL_APIENTRY GL_NamedFramebufferTextureLayer(GLuint framebuffer,
     {
         FramebufferID framebufferPacked = PackParam<FramebufferID>(framebuffer);
         TextureID texturePacked         = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNamedFramebufferTextureLayer(
                                                                      context, angle::EntryPoint::GLNamedFramebufferTextureLayer,
@@ -8765,7 +8765,7 @@ void GL_APIENTRY GL_NamedRenderbufferStorage(GLuint renderbuffer,
     if (context)
     {
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNamedRenderbufferStorage(
                                                                      context, angle::EntryPoint::GLNamedRenderbufferStorage,
@@ -8799,7 +8799,7 @@ void GL_APIENTRY GL_NamedRenderbufferStorageMultisample(GLuint renderbuffer,
     if (context)
     {
         RenderbufferID renderbufferPacked = PackParam<RenderbufferID>(renderbuffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateNamedRenderbufferStorageMultisample(
                                                                      context, angle::EntryPoint::GLNamedRenderbufferStorageMultisample,
@@ -8836,7 +8836,7 @@ void GL_APIENTRY GL_ReadnPixels(GLint x,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateReadnPixels(context, angle::EntryPoint::GLReadnPixels, x, y,
                                                                                      width, height, format, type, bufSize, data));
@@ -8860,7 +8860,7 @@ void GL_APIENTRY GL_TextureBarrier()
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTextureBarrier(context, angle::EntryPoint::GLTextureBarrier));
         if (isCallValid)
@@ -8886,7 +8886,7 @@ void GL_APIENTRY GL_TextureBuffer(GLuint texture, GLenum internalformat, GLuint
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTextureBuffer(context, angle::EntryPoint::GLTextureBuffer,
                                                                                        texturePacked, internalformat, bufferPacked));
@@ -8920,7 +8920,7 @@ void GL_APIENTRY GL_TextureBufferRange(GLuint texture,
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureBufferRange(context, angle::EntryPoint::GLTextureBufferRange,
@@ -8948,7 +8948,7 @@ void GL_APIENTRY GL_TextureParameterIiv(GLuint texture, GLenum pname, const GLin
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureParameterIiv(context, angle::EntryPoint::GLTextureParameterIiv,
@@ -8975,7 +8975,7 @@ void GL_APIENTRY GL_TextureParameterIuiv(GLuint texture, GLenum pname, const GLu
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureParameterIuiv(context, angle::EntryPoint::GLTextureParameterIuiv,
@@ -9001,7 +9001,7 @@ void GL_APIENTRY GL_TextureParameterf(GLuint texture, GLenum pname, GLfloat para
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureParameterf(context, angle::EntryPoint::GLTextureParameterf,
@@ -9028,7 +9028,7 @@ void GL_APIENTRY GL_TextureParameterfv(GLuint texture, GLenum pname, const GLflo
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureParameterfv(context, angle::EntryPoint::GLTextureParameterfv,
@@ -9054,7 +9054,7 @@ void GL_APIENTRY GL_TextureParameteri(GLuint texture, GLenum pname, GLint param)
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureParameteri(context, angle::EntryPoint::GLTextureParameteri,
@@ -9081,7 +9081,7 @@ void GL_APIENTRY GL_TextureParameteriv(GLuint texture, GLenum pname, const GLint
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureParameteriv(context, angle::EntryPoint::GLTextureParameteriv,
@@ -9111,7 +9111,7 @@ void GL_APIENTRY GL_TextureStorage1D(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTextureStorage1D(context, angle::EntryPoint::GLTextureStorage1D,
                                                                                           texturePacked, levels, internalformat, width));
@@ -9143,7 +9143,7 @@ void GL_APIENTRY GL_TextureStorage2D(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureStorage2D(context, angle::EntryPoint::GLTextureStorage2D, texturePacked,
@@ -9179,7 +9179,7 @@ void GL_APIENTRY GL_TextureStorage2DMultisample(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureStorage2DMultisample(
@@ -9216,7 +9216,7 @@ void GL_APIENTRY GL_TextureStorage3D(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureStorage3D(context, angle::EntryPoint::GLTextureStorage3D, texturePacked,
@@ -9253,7 +9253,7 @@ void GL_APIENTRY GL_TextureStorage3DMultisample(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureStorage3DMultisample(
@@ -9292,7 +9292,7 @@ void GL_APIENTRY GL_TextureSubImage1D(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureSubImage1D(context, angle::EntryPoint::GLTextureSubImage1D,
@@ -9331,7 +9331,7 @@ void GL_APIENTRY GL_TextureSubImage2D(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTextureSubImage2D(
                                                                      context, angle::EntryPoint::GLTextureSubImage2D, texturePacked,
@@ -9373,7 +9373,7 @@ void GL_APIENTRY GL_TextureSubImage3D(GLuint texture,
     if (context)
     {
         TextureID texturePacked                               = PackParam<TextureID>(texture);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidateTextureSubImage3D(context, angle::EntryPoint::GLTextureSubImage3D,
@@ -9402,7 +9402,7 @@ void GL_APIENTRY GL_TransformFeedbackBufferBase(GLuint xfb, GLuint index, GLuint
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTransformFeedbackBufferBase(
                                                                      context, angle::EntryPoint::GLTransformFeedbackBufferBase, xfb,
@@ -9435,7 +9435,7 @@ void GL_APIENTRY GL_TransformFeedbackBufferRange(GLuint xfb,
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateTransformFeedbackBufferRange(
                                                                      context, angle::EntryPoint::GLTransformFeedbackBufferRange, xfb,
@@ -9462,7 +9462,7 @@ GLboolean GL_APIENTRY GL_UnmapNamedBuffer(GLuint buffer)
     if (context)
     {
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateUnmapNamedBuffer(context, angle::EntryPoint::GLUnmapNamedBuffer,
                                                                                           bufferPacked));
@@ -9494,7 +9494,7 @@ void GL_APIENTRY GL_VertexArrayAttribBinding(GLuint vaobj, GLuint attribindex, G
     if (context)
     {
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexArrayAttribBinding(
                                                                      context, angle::EntryPoint::GLVertexArrayAttribBinding, vaobjPacked,
@@ -9530,7 +9530,7 @@ void GL_APIENTRY GL_VertexArrayAttribFormat(GLuint vaobj,
     if (context)
     {
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexArrayAttribFormat(
                                                                      context, angle::EntryPoint::GLVertexArrayAttribFormat, vaobjPacked,
@@ -9564,7 +9564,7 @@ void GL_APIENTRY GL_VertexArrayAttribIFormat(GLuint vaobj,
     if (context)
     {
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexArrayAttribIFormat(
                                                                      context, angle::EntryPoint::GLVertexArrayAttribIFormat, vaobjPacked,
@@ -9597,7 +9597,7 @@ void GL_APIENTRY GL_VertexArrayAttribLFormat(GLuint vaobj,
     if (context)
     {
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexArrayAttribLFormat(
                                                                      context, angle::EntryPoint::GLVertexArrayAttribLFormat, vaobjPacked,
@@ -9625,7 +9625,7 @@ void GL_APIENTRY GL_VertexArrayBindingDivisor(GLuint vaobj, GLuint bindingindex,
     if (context)
     {
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexArrayBindingDivisor(
                                                                      context, angle::EntryPoint::GLVertexArrayBindingDivisor,
@@ -9653,7 +9653,7 @@ void GL_APIENTRY GL_VertexArrayElementBuffer(GLuint vaobj, GLuint buffer)
     {
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexArrayElementBuffer(
                                                                      context, angle::EntryPoint::GLVertexArrayElementBuffer, vaobjPacked,
@@ -9686,7 +9686,7 @@ void GL_APIENTRY GL_VertexArrayVertexBuffer(GLuint vaobj,
     {
         VertexArrayID vaobjPacked                             = PackParam<VertexArrayID>(vaobj);
         BufferID bufferPacked                                 = PackParam<BufferID>(buffer);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexArrayVertexBuffer(
                                                                      context, angle::EntryPoint::GLVertexArrayVertexBuffer, vaobjPacked,
@@ -9723,7 +9723,7 @@ void GL_APIENTRY GL_VertexArrayVertexBuffers(GLuint vaobj,
     {
         VertexArrayID vaobjPacked     = PackParam<VertexArrayID>(vaobj);
         const BufferID *buffersPacked = PackParam<const BufferID *>(buffers);
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateVertexArrayVertexBuffers(
                                                                      context, angle::EntryPoint::GLVertexArrayVertexBuffers, vaobjPacked,
@@ -9758,7 +9758,7 @@ void GL_APIENTRY GL_MultiDrawArraysIndirectCount(GLenum mode,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiDrawArraysIndirectCount(
                                                                      context, angle::EntryPoint::GLMultiDrawArraysIndirectCount, mode,
@@ -9793,7 +9793,7 @@ void GL_APIENTRY GL_MultiDrawElementsIndirectCount(GLenum mode,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateMultiDrawElementsIndirectCount(
                                                                      context, angle::EntryPoint::GLMultiDrawElementsIndirectCount, mode,
@@ -9820,7 +9820,7 @@ void GL_APIENTRY GL_PolygonOffsetClamp(GLfloat factor, GLfloat units, GLfloat cl
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid =
             (context->skipValidation() ||
              ValidatePolygonOffsetClamp(context, angle::EntryPoint::GLPolygonOffsetClamp, factor,
@@ -9853,7 +9853,7 @@ void GL_APIENTRY GL_SpecializeShader(GLuint shader,
 
     if (context)
     {
-        std::unique_lock<angle::GlobalMutex> shareContextLock = GetContextLock(context);
+        ScopedContextLock shareContextLock = GetContextLock(context);
         bool isCallValid                                      = (context->skipValidation() ||
                             ValidateSpecializeShader(
                                                                      context, angle::EntryPoint::GLSpecializeShader, shader, pEntryPoint,
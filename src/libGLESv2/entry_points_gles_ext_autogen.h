@@ -90,6 +90,12 @@ GL_MultiDrawElementsInstancedBaseVertexBaseInstanceANGLE(GLenum mode,
                                                          const GLuint *baseInstances,
                                                          GLsizei drawcount);
 
+// GL_ANGLE_command_stream
+ANGLE_EXPORT void GL_APIENTRY GL_BeginCommandStreamANGLE(GLuint stream);
+ANGLE_EXPORT void GL_APIENTRY GL_EndCommandStreamANGLE();
+ANGLE_EXPORT void GL_APIENTRY GL_CallCommandStreamANGLE(GLuint stream);
+ANGLE_EXPORT void GL_APIENTRY GL_DeleteCommandStreamANGLE(GLuint stream);
+
 // GL_ANGLE_copy_texture_3d
 ANGLE_EXPORT void GL_APIENTRY GL_CopyTexture3DANGLE(GLuint sourceId,
                                                     GLint sourceLevel,
@@ -121,6 +127,9 @@ ANGLE_EXPORT void GL_APIENTRY GL_CopySubTexture3DANGLE(GLuint sourceId,
 
 // GL_ANGLE_depth_texture
 
+// GL_ANGLE_draw_warm_up
+ANGLE_EXPORT void GL_APIENTRY GL_WarmUpDrawANGLE(GLenum mode);
+
 // GL_ANGLE_framebuffer_blit
 ANGLE_EXPORT void GL_APIENTRY GL_BlitFramebufferANGLE(GLint srcX0,
                                                       GLint srcY0,
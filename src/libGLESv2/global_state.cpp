@@ -11,6 +11,7 @@
 #include "common/debug.h"
 #include "common/platform.h"
 #include "common/system_utils.h"
+#include "libANGLE/Display.h"
 #include "libANGLE/ErrorStrings.h"
 #include "libANGLE/Thread.h"
 #include "libGLESv2/resource.h"
@@ -19,6 +20,71 @@
 #if defined(ANGLE_PLATFORM_APPLE)
 #    include <dispatch/dispatch.h>
 #endif
+
+namespace angle
+{
+GlobalMutex::GlobalMutex() : mOwner(std::thread::id()), mLevel(0), mExclusiveWaiters(0) {}
+
+GlobalMutex::~GlobalMutex()
+{
+    ASSERT(mLevel == 0);
+}
+
+void GlobalMutex::lock()
+{
+    if (isOwnedByCurrentThread())
+    {
+        ++mLevel;
+        return;
+    }
+
+    mExclusiveWaiters.fetch_add(1, std::memory_order_relaxed);
+    mMutex.lock();
+    mExclusiveWaiters.fetch_sub(1, std::memory_order_relaxed);
+
+    mOwner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+    mLevel = 1;
+}
+
+void GlobalMutex::unlock()
+{
+    ASSERT(isOwnedByCurrentThread() && mLevel > 0);
+    if (--mLevel > 0)
+    {
+        return;
+    }
+
+    mOwner.store(std::thread::id(), std::memory_order_relaxed);
+    mMutex.unlock();
+}
+
+void GlobalMutex::lock_shared()
+{
+    if (isOwnedByCurrentThread())
+    {
+        ++mLevel;
+        return;
+    }
+
+    while (mExclusiveWaiters.load(std::memory_order_relaxed) > 0)
+    {
+        std::this_thread::yield();
+    }
+    mMutex.lock_shared();
+}
+
+void GlobalMutex::unlock_shared()
+{
+    if (isOwnedByCurrentThread())
+    {
+        unlock();
+        return;
+    }
+
+    mMutex.unlock_shared();
+}
+}  // namespace angle
+
 namespace egl
 {
 namespace
@@ -200,6 +266,37 @@ void SetContextCurrent(Thread *thread, gl::Context *context)
 #endif
 }
 
+ScopedGlobalMutexLock::ScopedGlobalMutexLock() : mRestoreShared(false)
+{
+    angle::GlobalMutex &globalMutex = GetGlobalMutex();
+
+    if (!globalMutex.isOwnedByCurrentThread())
+    {
+        // A thread only owns the mutex of a share group along with the global mutex, which it
+        // must then own in shared mode.
+        const gl::Context *context = GetCurrentThread()->getContext();
+        mRestoreShared =
+            context != nullptr && context->getShareGroup()->isMutexOwnedByCurrentThread();
+    }
+
+    if (mRestoreShared)
+    {
+        globalMutex.unlock_shared();
+    }
+    globalMutex.lock();
+}
+
+ScopedGlobalMutexLock::~ScopedGlobalMutexLock()
+{
+    angle::GlobalMutex &globalMutex = GetGlobalMutex();
+
+    globalMutex.unlock();
+    if (mRestoreShared)
+    {
+        globalMutex.lock_shared();
+    }
+}
+
 ScopedSyncCurrentContextFromThread::ScopedSyncCurrentContextFromThread(egl::Thread *thread)
     : mThread(thread)
 {
@@ -232,6 +329,72 @@ void GenerateContextLostErrorOnCurrentGlobalContext()
 
     GenerateContextLostErrorOnContext(GetGlobalContext());
 }
+
+void ScopedContextLock::lock(Context *context, bool bindsEGLImage)
+{
+    egl::ShareGroup *shareGroup = context->getShareGroup();
+
+    // The GL call is made from a callback of a GL call of the share group on this thread, which
+    // already holds the global mutex.
+    if (shareGroup->isMutexOwnedByCurrentThread())
+    {
+        mShareGroup = shareGroup;
+        mShareGroup->lockMutex();
+        return;
+    }
+
+    mGlobalMutex = &egl::GetGlobalMutex();
+
+    if (bindsEGLImage)
+    {
+        // The context may not have been shared before, but its objects now are.
+        mGlobalMutex->lock();
+        context->setShared();
+        shareGroup->onEGLImageUsed();
+        return;
+    }
+
+    if (context->usingDisplayTextureShareGroup() || context->usingDisplaySemaphoreShareGroup() ||
+        shareGroup->usesEGLImages())
+    {
+        mGlobalMutex->lock();
+        return;
+    }
+
+    // EGL entry points lock the global mutex exclusively, which excludes the GL entry points of
+    // all shared contexts like before.  The share group's mutex is locked first, so that a thread
+    // waiting for it does not hold the global mutex, which a thread of the share group that calls
+    // an EGL function from a callback needs to lock exclusively.
+    shareGroup->lockMutex();
+    mGlobalMutex->lock_shared();
+
+    // An EGL call may have created an EGLImage from the share group while waiting.
+    if (shareGroup->usesEGLImages())
+    {
+        mGlobalMutex->unlock_shared();
+        shareGroup->unlockMutex();
+        mGlobalMutex->lock();
+        return;
+    }
+
+    mShareGroup = shareGroup;
+}
+
+void ScopedContextLock::unlock()
+{
+    if (mShareGroup != nullptr)
+    {
+        mShareGroup->unlockMutex();
+        if (mGlobalMutex != nullptr)
+        {
+            mGlobalMutex->unlock_shared();
+        }
+    }
+    else
+    {
+        mGlobalMutex->unlock();
+    }
+}
 }  // namespace gl
 
 #if defined(ANGLE_PLATFORM_WINDOWS) && !defined(ANGLE_STATIC)
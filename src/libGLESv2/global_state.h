@@ -18,11 +18,44 @@
 #    include "common/tls.h"
 #endif
 
+#include <atomic>
 #include <mutex>
+#include <shared_mutex>
+#include <thread>
 
 namespace angle
 {
-using GlobalMutex = std::recursive_mutex;
+// The global mutex is locked exclusively by EGL entry points, and recursively so.  GL entry points
+// of contexts that share objects with others lock it in shared mode along with the mutex of their
+// share group, so contexts in different share groups don't serialize with each other.
+class GlobalMutex final : angle::NonCopyable
+{
+  public:
+    GlobalMutex();
+    ~GlobalMutex();
+
+    void lock();
+    void unlock();
+
+    // If the thread already owns the mutex exclusively, it keeps that ownership instead.  Shared
+    // ownership is not recursive.
+    void lock_shared();
+    void unlock_shared();
+
+    bool isOwnedByCurrentThread() const
+    {
+        return mOwner.load(std::memory_order_relaxed) == std::this_thread::get_id();
+    }
+
+  private:
+    std::shared_mutex mMutex;
+    std::atomic<std::thread::id> mOwner;
+    uint32_t mLevel;
+
+    // New shared owners wait for threads that are waiting for exclusive ownership, so that EGL
+    // entry points are not starved by a stream of GL calls from multiple threads.
+    std::atomic<uint32_t> mExclusiveWaiters;
+};
 
 //  - TLS_SLOT_OPENGL and TLS_SLOT_OPENGL_API: These two aren't used by bionic
 //    itself, but allow the graphics code to access TLS directly rather than
@@ -107,6 +140,19 @@ void SetGlobalLastContext(gl::Context *context);
 Thread *GetCurrentThread();
 Debug *GetDebug();
 
+// The lock held by EGL entry points.  If the thread is in a GL call that holds the global mutex in
+// shared mode, for example because a debug message callback calls an EGL function, the shared
+// ownership is exchanged for exclusive ownership until the EGL call returns.
+class ANGLE_NO_DISCARD ScopedGlobalMutexLock final : angle::NonCopyable
+{
+  public:
+    ScopedGlobalMutexLock();
+    ~ScopedGlobalMutexLock();
+
+  private:
+    bool mRestoreShared;
+};
+
 // Sync the current context from Thread to global state.
 class ANGLE_NO_DISCARD ScopedSyncCurrentContextFromThread
 {
@@ -126,33 +172,43 @@ class ANGLE_NO_DISCARD ScopedSyncCurrentContextFromThread
         egl::GetGlobalSurfaceMutex())
 
 #define ANGLE_GLOBAL_LOCK_VAR_NAME globalMutexLock
-#define ANGLE_SCOPED_GLOBAL_LOCK() \
-    std::lock_guard<angle::GlobalMutex> ANGLE_GLOBAL_LOCK_VAR_NAME(egl::GetGlobalMutex())
+#define ANGLE_SCOPED_GLOBAL_LOCK() egl::ScopedGlobalMutexLock ANGLE_GLOBAL_LOCK_VAR_NAME
 
 namespace gl
 {
 ANGLE_INLINE Context *GetGlobalContext()
 {
-#if defined(ANGLE_PLATFORM_ANDROID)
+#if defined(ANGLE_ANDROID_ALWAYS_USE_GL_TLS_SLOT)
+    return static_cast<gl::Context *>(ANGLE_ANDROID_GET_GL_TLS()[angle::kAndroidOpenGLTlsSlot]);
+#else
+#    if defined(ANGLE_PLATFORM_ANDROID)
     // TODO: Replace this branch with a compile time flag (http://anglebug.com/4764)
     if (angle::gUseAndroidOpenGLTlsSlot)
     {
         return static_cast<gl::Context *>(ANGLE_ANDROID_GET_GL_TLS()[angle::kAndroidOpenGLTlsSlot]);
     }
-#endif
+#    endif
 
-#if defined(ANGLE_PLATFORM_APPLE)
+#    if defined(ANGLE_PLATFORM_APPLE)
     egl::Thread *currentThread = egl::GetCurrentThreadTLS();
-#else
+#    else
     egl::Thread *currentThread = egl::gCurrentThread;
-#endif
+#    endif
     ASSERT(currentThread);
     return currentThread->getContext();
+#endif  // defined(ANGLE_ANDROID_ALWAYS_USE_GL_TLS_SLOT)
 }
 
 ANGLE_INLINE Context *GetValidGlobalContext()
 {
-#if defined(ANGLE_PLATFORM_ANDROID)
+#if defined(ANGLE_ANDROID_ALWAYS_USE_GL_TLS_SLOT)
+    // The slot holds the current context even if it's lost, in which case there is no valid
+    // context, same as gCurrentValidContext.
+    Context *context =
+        static_cast<gl::Context *>(ANGLE_ANDROID_GET_GL_TLS()[angle::kAndroidOpenGLTlsSlot]);
+    return context && !context->isContextLost() ? context : nullptr;
+#else
+#    if defined(ANGLE_PLATFORM_ANDROID)
     // TODO: Replace this branch with a compile time flag (http://anglebug.com/4764)
     if (angle::gUseAndroidOpenGLTlsSlot)
     {
@@ -163,13 +219,14 @@ ANGLE_INLINE Context *GetValidGlobalContext()
             return context;
         }
     }
-#endif
+#    endif
 
-#if defined(ANGLE_PLATFORM_APPLE)
+#    if defined(ANGLE_PLATFORM_APPLE)
     return GetCurrentValidContextTLS();
-#else
+#    else
     return gCurrentValidContext;
-#endif
+#    endif
+#endif  // defined(ANGLE_ANDROID_ALWAYS_USE_GL_TLS_SLOT)
 }
 
 // Generate a context lost error on the context if it is non-null and lost.
@@ -190,17 +247,61 @@ static ANGLE_INLINE void DirtyContextIfNeeded(Context *context)
 
 #endif
 
-ANGLE_INLINE std::unique_lock<angle::GlobalMutex> GetContextLock(Context *context)
+// The lock held by GL entry points.  Contexts that don't share objects with other contexts need no
+// lock.  Other contexts lock their share group's mutex and the global mutex in shared mode.
+// Objects of contexts that use the display's texture or semaphore share group, or whose share
+// group has EGLImage siblings, are shared across share groups, so those contexts lock the global
+// mutex exclusively.  So do the entry points that bind EGLImages.
+//
+// A GL call made from a callback of a GL call on the same thread, such as a debug message callback,
+// finds the locks of its share group already held and only locks its share group's mutex again.
+// Making a context of another share group current in such a callback is not supported.
+class ANGLE_NO_DISCARD ScopedContextLock final : angle::NonCopyable
 {
+  public:
+    ANGLE_INLINE ScopedContextLock(Context *context, bool bindsEGLImage)
+        : mGlobalMutex(nullptr), mShareGroup(nullptr)
+    {
 #if defined(ANGLE_FORCE_CONTEXT_CHECK_EVERY_CALL)
-    auto lock = std::unique_lock<angle::GlobalMutex>(egl::GetGlobalMutex());
+        mGlobalMutex = &egl::GetGlobalMutex();
+        mGlobalMutex->lock();
 
-    DirtyContextIfNeeded(context);
-    return lock;
+        DirtyContextIfNeeded(context);
 #else
-    return context->isShared() ? std::unique_lock<angle::GlobalMutex>(egl::GetGlobalMutex())
-                               : std::unique_lock<angle::GlobalMutex>();
+        if (context->isShared() || bindsEGLImage)
+        {
+            lock(context, bindsEGLImage);
+        }
 #endif
+    }
+
+    ANGLE_INLINE ~ScopedContextLock()
+    {
+        if (mGlobalMutex != nullptr || mShareGroup != nullptr)
+        {
+            unlock();
+        }
+    }
+
+  private:
+    void lock(Context *context, bool bindsEGLImage);
+    void unlock();
+
+    // Non-null if the global mutex is locked by this lock, in shared mode if mShareGroup is also
+    // non-null.
+    angle::GlobalMutex *mGlobalMutex;
+    // Non-null if the share group's mutex is locked by this lock.
+    egl::ShareGroup *mShareGroup;
+};
+
+ANGLE_INLINE ScopedContextLock GetContextLock(Context *context)
+{
+    return ScopedContextLock(context, false);
+}
+
+ANGLE_INLINE ScopedContextLock GetContextLockForEGLImage(Context *context)
+{
+    return ScopedContextLock(context, true);
 }
 
 }  // namespace gl
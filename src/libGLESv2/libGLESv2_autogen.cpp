@@ -2841,6 +2841,27 @@ glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE(GLenum mode,
         mode, counts, type, indices, instanceCounts, baseVertices, baseInstances, drawcount);
 }
 
+// GL_ANGLE_command_stream
+void GL_APIENTRY glBeginCommandStreamANGLE(GLuint stream)
+{
+    return GL_BeginCommandStreamANGLE(stream);
+}
+
+void GL_APIENTRY glEndCommandStreamANGLE()
+{
+    return GL_EndCommandStreamANGLE();
+}
+
+void GL_APIENTRY glCallCommandStreamANGLE(GLuint stream)
+{
+    return GL_CallCommandStreamANGLE(stream);
+}
+
+void GL_APIENTRY glDeleteCommandStreamANGLE(GLuint stream)
+{
+    return GL_DeleteCommandStreamANGLE(stream);
+}
+
 // GL_ANGLE_copy_texture_3d
 void GL_APIENTRY glCopyTexture3DANGLE(GLuint sourceId,
                                       GLint sourceLevel,
@@ -2883,6 +2904,12 @@ void GL_APIENTRY glCopySubTexture3DANGLE(GLuint sourceId,
 
 // GL_ANGLE_depth_texture
 
+// GL_ANGLE_draw_warm_up
+void GL_APIENTRY glWarmUpDrawANGLE(GLenum mode)
+{
+    return GL_WarmUpDrawANGLE(mode);
+}
+
 // GL_ANGLE_framebuffer_blit
 void GL_APIENTRY glBlitFramebufferANGLE(GLint srcX0,
                                         GLint srcY0,
@@ -145,6 +145,7 @@ const ProcEntry g_procTable[] = {
     {"glAlphaFunc", P(GL_AlphaFunc)},
     {"glAlphaFuncx", P(GL_AlphaFuncx)},
     {"glAttachShader", P(GL_AttachShader)},
+    {"glBeginCommandStreamANGLE", P(GL_BeginCommandStreamANGLE)},
     {"glBeginPerfMonitorAMD", P(GL_BeginPerfMonitorAMD)},
     {"glBeginQuery", P(GL_BeginQuery)},
     {"glBeginQueryEXT", P(GL_BeginQueryEXT)},
@@ -196,6 +197,7 @@ const ProcEntry g_procTable[] = {
     {"glBufferStorageExternalEXT", P(GL_BufferStorageExternalEXT)},
     {"glBufferStorageMemEXT", P(GL_BufferStorageMemEXT)},
     {"glBufferSubData", P(GL_BufferSubData)},
+    {"glCallCommandStreamANGLE", P(GL_CallCommandStreamANGLE)},
     {"glCheckFramebufferStatus", P(GL_CheckFramebufferStatus)},
     {"glCheckFramebufferStatusOES", P(GL_CheckFramebufferStatusOES)},
     {"glClear", P(GL_Clear)},
@@ -260,6 +262,7 @@ const ProcEntry g_procTable[] = {
     {"glDebugMessageInsert", P(GL_DebugMessageInsert)},
     {"glDebugMessageInsertKHR", P(GL_DebugMessageInsertKHR)},
     {"glDeleteBuffers", P(GL_DeleteBuffers)},
+    {"glDeleteCommandStreamANGLE", P(GL_DeleteCommandStreamANGLE)},
     {"glDeleteFencesNV", P(GL_DeleteFencesNV)},
     {"glDeleteFramebuffers", P(GL_DeleteFramebuffers)},
     {"glDeleteFramebuffersOES", P(GL_DeleteFramebuffersOES)},
@@ -338,6 +341,7 @@ const ProcEntry g_procTable[] = {
     {"glEnablei", P(GL_Enablei)},
     {"glEnableiEXT", P(GL_EnableiEXT)},
     {"glEnableiOES", P(GL_EnableiOES)},
+    {"glEndCommandStreamANGLE", P(GL_EndCommandStreamANGLE)},
     {"glEndPerfMonitorAMD", P(GL_EndPerfMonitorAMD)},
     {"glEndQuery", P(GL_EndQuery)},
     {"glEndQueryEXT", P(GL_EndQueryEXT)},
@@ -945,7 +949,8 @@ const ProcEntry g_procTable[] = {
     {"glViewport", P(GL_Viewport)},
     {"glWaitSemaphoreEXT", P(GL_WaitSemaphoreEXT)},
     {"glWaitSync", P(GL_WaitSync)},
+    {"glWarmUpDrawANGLE", P(GL_WarmUpDrawANGLE)},
     {"glWeightPointerOES", P(GL_WeightPointerOES)}};
 
-const size_t g_numProcs = 914;
+const size_t g_numProcs = 919;
 }  // namespace egl
@@ -44,3 +44,30 @@ TEST(ConstructCompilerTest, InvalidMaxDualSourceDrawBuffers)
                                               SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
     ASSERT_EQ(nullptr, compiler);
 }
+
+// Test that compilers constructed with different resources see their own values of the built-in
+// constants, even though the built-in variables are shared between compilers.
+TEST(ConstructCompilerTest, BuiltInConstantsFollowResources)
+{
+    const char *kShader =
+        "precision mediump float;\n"
+        "float a[gl_MaxDrawBuffers == 4 ? 1 : -1];\n"
+        "void main() { gl_FragColor = vec4(a[0]); }\n";
+
+    for (int maxDrawBuffers : {4, 1, 4})
+    {
+        ShBuiltInResources resources;
+        sh::InitBuiltInResources(&resources);
+        resources.MaxDrawBuffers = maxDrawBuffers;
+
+        for (int compilerIndex = 0; compilerIndex < 2; ++compilerIndex)
+        {
+            ShHandle compiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_GLES2_SPEC,
+                                                      SH_GLSL_COMPATIBILITY_OUTPUT, &resources);
+            ASSERT_NE(nullptr, compiler);
+            EXPECT_EQ(maxDrawBuffers == 4, sh::Compile(compiler, &kShader, 1, SH_OBJECT_CODE))
+                << maxDrawBuffers;
+            sh::Destruct(compiler);
+        }
+    }
+}
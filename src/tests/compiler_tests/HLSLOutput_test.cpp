@@ -33,6 +33,12 @@ class HLSL41VertexOutputTest : public MatchOutputCodeTest
     HLSL41VertexOutputTest() : MatchOutputCodeTest(GL_VERTEX_SHADER, 0, SH_HLSL_4_1_OUTPUT) {}
 };
 
+class HLSL41ComputeOutputTest : public MatchOutputCodeTest
+{
+  public:
+    HLSL41ComputeOutputTest() : MatchOutputCodeTest(GL_COMPUTE_SHADER, 0, SH_HLSL_4_1_OUTPUT) {}
+};
+
 // Test that having dynamic indexing of a vector inside the right hand side of logical or doesn't
 // trigger asserts in HLSL output.
 TEST_F(HLSLOutputTest, DynamicIndexingOfVectorOnRightSideOfLogicalOr)
@@ -275,3 +281,37 @@ void main()
     compile(shaderString);
     EXPECT_FALSE(foundInCode("map_instances"));
 }
+
+// Test that loads of scalars and vectors from shader storage blocks are written in place, and that
+// the other loads still use the wrapper functions.
+TEST_F(HLSL41ComputeOutputTest, InlineShaderStorageBlockLoads)
+{
+    constexpr char shaderString[] = R"(#version 310 es
+layout(local_size_x = 1) in;
+layout(std430, binding = 0) buffer Input
+{
+    float f;
+    vec4 v[4];
+    ivec3 iv;
+    layout(row_major) mat3 rm;
+} inBlock;
+layout(std430, binding = 1) buffer Output
+{
+    vec4 result;
+};
+
+void main()
+{
+    int i = int(inBlock.f);
+    result = inBlock.v[i] + vec4(inBlock.iv, 1) + vec4(inBlock.rm[1], 0.0) + inBlock.v[1].yxzw;
+})";
+
+    compile(shaderString);
+    EXPECT_TRUE(foundInCode("asfloat(_inBlock.Load(0))"));
+    EXPECT_TRUE(foundInCode("asfloat(_inBlock.Load4("));
+    EXPECT_TRUE(foundInCode("asint(_inBlock.Load3(80))"));
+    EXPECT_FALSE(foundInCode("_Load_float_"));
+    EXPECT_FALSE(foundInCode("_Load_float4_std430_cm_xyzw"));
+    EXPECT_TRUE(foundInCode("_Load_float3_std430_rm_xyz"));
+    EXPECT_TRUE(foundInCode("_Load_float4_std430_cm_yxzw"));
+}
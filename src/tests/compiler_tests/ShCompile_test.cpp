@@ -7,7 +7,10 @@
 //   Test the sh::Compile interface with different parameters.
 //
 
+#include <algorithm>
 #include <clocale>
+#include <thread>
+#include <vector>
 #include "GLSLANG/ShaderLang.h"
 #include "angle_gl.h"
 #include "common/angleutils.h"
@@ -223,6 +226,155 @@ TEST_F(ShCompileTest, DecimalSepLocale)
     }
 }
 
+// Test that shaders can be compiled on several threads at the same time, each with compilers of its
+// own, while other threads initialize and finalize the translator.
+TEST_F(ShCompileTest, ConcurrentCompiles)
+{
+    constexpr char kSource[] = R"(precision mediump float;
+uniform vec4 u;
+vec4 f(vec4 v)
+{
+    return v * 2.0 + u;
+}
+void main()
+{
+    gl_FragColor = f(vec4(0.5));
+})";
+    const char *shaderStrings[] = {kSource};
+
+    constexpr ShCompileOptions kOptions = SH_OBJECT_CODE | SH_VARIABLES;
+    ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, kOptions));
+    const std::string referenceOut = sh::GetObjectCode(mCompiler);
+
+    constexpr size_t kThreadCount  = 8;
+    constexpr size_t kCompileCount = 20;
+
+    std::vector<std::string> outputs(kThreadCount);
+    std::vector<std::thread> threads;
+    for (size_t threadIndex = 0; threadIndex < kThreadCount; ++threadIndex)
+    {
+        threads.emplace_back([this, threadIndex, &shaderStrings, &outputs]() {
+            if (!sh::Initialize())
+            {
+                return;
+            }
+
+            ShHandle compiler = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL_SPEC,
+                                                      SH_GLSL_COMPATIBILITY_OUTPUT, &mResources);
+            for (size_t compile = 0; compiler != nullptr && compile < kCompileCount; ++compile)
+            {
+                if (!sh::Compile(compiler, shaderStrings, 1, kOptions))
+                {
+                    outputs[threadIndex].clear();
+                    break;
+                }
+                outputs[threadIndex] = sh::GetObjectCode(compiler);
+            }
+            sh::Destruct(compiler);
+
+            sh::Finalize();
+        });
+    }
+
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const std::string &output : outputs)
+    {
+        EXPECT_EQ(referenceOut, output);
+    }
+}
+
+// Test that SH_REPORT_AST_PASS_TIMES adds the time taken by the AST passes to the info log, and
+// that the passes that have nothing to do in a shader are skipped.
+TEST_F(ShCompileTest, ReportASTPassTimes)
+{
+    constexpr char kSimpleSource[] = R"(precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(1.0);
+})";
+    constexpr char kLoopSource[] = R"(precision mediump float;
+uniform float u;
+void main()
+{
+    float a = 0.0, b = 1.0;
+    for (int i = 0; i < 4; ++i)
+    {
+        a += (b += u, b);
+    }
+    gl_FragColor = vec4(a);
+})";
+
+    constexpr ShCompileOptions kOptions = SH_OBJECT_CODE | SH_REPORT_AST_PASS_TIMES;
+
+    const char *simpleStrings[] = {kSimpleSource};
+    ASSERT_TRUE(sh::Compile(mCompiler, simpleStrings, 1, kOptions));
+    std::string log = sh::GetInfoLog(mCompiler);
+    EXPECT_NE(std::string::npos, log.find("AST pass FindSimplifiableNodes: ")) << log;
+    EXPECT_NE(std::string::npos, log.find("AST pass RemoveUnreferencedVariables: ")) << log;
+    EXPECT_EQ(std::string::npos, log.find("AST pass SimplifyLoopConditions: ")) << log;
+    EXPECT_EQ(std::string::npos, log.find("AST pass SeparateDeclarations: ")) << log;
+    EXPECT_EQ(std::string::npos, log.find("AST pass SplitSequenceOperator: ")) << log;
+
+    const char *loopStrings[] = {kLoopSource};
+    ASSERT_TRUE(sh::Compile(mCompiler, loopStrings, 1, kOptions));
+    log = sh::GetInfoLog(mCompiler);
+    EXPECT_NE(std::string::npos, log.find("AST pass SimplifyLoopConditions: ")) << log;
+    EXPECT_NE(std::string::npos, log.find("AST pass SeparateDeclarations: ")) << log;
+    EXPECT_NE(std::string::npos, log.find("AST pass SplitSequenceOperator: ")) << log;
+
+    // Without the option, the info log stays empty.
+    ASSERT_TRUE(sh::Compile(mCompiler, loopStrings, 1, SH_OBJECT_CODE));
+    EXPECT_EQ("", sh::GetInfoLog(mCompiler));
+}
+
+// Test that the phases of the compilation are timed along with the AST passes, and that they are
+// reported to the compile phase callbacks.
+TEST_F(ShCompileTest, CompilePhases)
+{
+    constexpr char kSource[] = R"(precision mediump float;
+void main()
+{
+    gl_FragColor = vec4(1.0);
+})";
+    const char *shaderStrings[] = {kSource};
+
+    constexpr ShCompileOptions kOptions = SH_OBJECT_CODE | SH_REPORT_AST_PASS_TIMES;
+    ASSERT_TRUE(sh::Compile(mCompiler, shaderStrings, 1, kOptions));
+    const std::string &log = sh::GetInfoLog(mCompiler);
+    EXPECT_NE(std::string::npos, log.find("Compile phase Parse: ")) << log;
+    EXPECT_NE(std::string::npos, log.find("Compile phase CheckAndSimplifyAST: ")) << log;
+    EXPECT_NE(std::string::npos, log.find("Compile phase Translate: ")) << log;
+
+    static std::vector<std::string> phases;
+    phases.clear();
+    sh::SetCompilePhaseCallbacks(
+        [](const char *phaseName) { phases.push_back(std::string("begin ") + phaseName); },
+        [](const char *phaseName) { phases.push_back(std::string("end ") + phaseName); });
+    const bool result = sh::Compile(mCompiler, shaderStrings, 1, SH_OBJECT_CODE);
+    sh::SetCompilePhaseCallbacks(nullptr, nullptr);
+    ASSERT_TRUE(result);
+
+    // The phases are not reported in the info log without SH_REPORT_AST_PASS_TIMES.
+    EXPECT_EQ("", sh::GetInfoLog(mCompiler));
+
+    ASSERT_GE(phases.size(), 6u);
+    EXPECT_EQ("begin Parse", phases[0]);
+    EXPECT_EQ("end Parse", phases[1]);
+    EXPECT_EQ("begin CheckAndSimplifyAST", phases[2]);
+    EXPECT_EQ("end Translate", phases.back());
+
+    // The AST passes are nested in the CheckAndSimplifyAST phase.
+    auto simplifyEnd = std::find(phases.begin(), phases.end(), "end CheckAndSimplifyAST");
+    auto passBegin   = std::find(phases.begin(), phases.end(), "begin RemoveUnreferencedVariables");
+    ASSERT_NE(phases.end(), simplifyEnd);
+    ASSERT_NE(phases.end(), passBegin);
+    EXPECT_LT(passBegin, simplifyEnd);
+}
+
 // Desktop GLSL support is not enabled on Android
 #if !defined(ANGLE_PLATFORM_ANDROID)
 
@@ -0,0 +1,199 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// UnrollConstantLoops_test.cpp:
+//   Tests that loops with constant bounds are unrolled, and that the others are left alone.
+//
+
+#include "GLSLANG/ShaderLang.h"
+#include "angle_gl.h"
+#include "gtest/gtest.h"
+#include "tests/test_utils/compiler_test.h"
+
+using namespace sh;
+
+namespace
+{
+
+class UnrollConstantLoopsTest : public MatchOutputCodeTest
+{
+  public:
+    UnrollConstantLoopsTest()
+        : MatchOutputCodeTest(GL_FRAGMENT_SHADER, SH_UNROLL_CONSTANT_LOOPS, SH_ESSL_OUTPUT)
+    {}
+};
+
+// Test that a loop with constant bounds is unrolled, and that the expressions of the loop index
+// are folded.
+TEST_F(UnrollConstantLoopsTest, Unrolled)
+{
+    const std::string shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform vec4 u[8];
+        out vec4 color;
+        void main()
+        {
+            color = vec4(0);
+            for (int i = 0; i < 4; ++i)
+            {
+                color += u[i * 2 + 1];
+            }
+        })";
+    compile(shaderString);
+
+    EXPECT_TRUE(notFoundInCode("for ("));
+    EXPECT_TRUE(foundInCodeInOrder({"[1]", "[3]", "[5]", "[7]"}));
+}
+
+// Test that the variables declared in the body are duplicated for each iteration.
+TEST_F(UnrollConstantLoopsTest, BodyDeclarations)
+{
+    const std::string shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform vec4 u[3];
+        out vec4 color;
+        void main()
+        {
+            color = vec4(0);
+            for (int i = 2; i >= 0; i--)
+            {
+                vec4 v = u[i];
+                color += v * float(i);
+            }
+        })";
+    compile(shaderString);
+
+    EXPECT_TRUE(notFoundInCode("for ("));
+    EXPECT_TRUE(foundInCodeInOrder({"[2]", "[1]", "[0]"}));
+}
+
+// Test that nested loops are unrolled.
+TEST_F(UnrollConstantLoopsTest, Nested)
+{
+    const std::string shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform vec4 u[4];
+        out vec4 color;
+        void main()
+        {
+            color = vec4(0);
+            for (uint i = 0u; i < 2u; i++)
+            {
+                for (uint j = 0u; j < 2u; j++)
+                {
+                    color += u[i * 2u + j];
+                }
+            }
+        })";
+    compile(shaderString);
+
+    EXPECT_TRUE(notFoundInCode("for ("));
+    EXPECT_TRUE(foundInCodeInOrder({"[0u]", "[1u]", "[2u]", "[3u]"}));
+}
+
+// Test that loops that break, continue or modify their index are not unrolled.
+TEST_F(UnrollConstantLoopsTest, NotUnrolled)
+{
+    const std::string shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform vec4 u[4];
+        uniform float f;
+        out vec4 color;
+        void modify(inout int i)
+        {
+            i++;
+        }
+        void main()
+        {
+            color = vec4(0);
+            for (int i = 0; i < 4; ++i)
+            {
+                if (u[i].x > f)
+                {
+                    break;
+                }
+            }
+            for (int i = 0; i < 4; ++i)
+            {
+                if (u[i].x > f)
+                {
+                    continue;
+                }
+                color += u[i];
+            }
+            for (int i = 0; i < 4; ++i)
+            {
+                modify(i);
+            }
+            for (int i = 0; i < 4; ++i)
+            {
+                i += 1;
+            }
+        })";
+    compile(shaderString);
+
+    EXPECT_TRUE(foundInCode("for (", 4));
+}
+
+// Test that a break out of a switch in the body doesn't prevent unrolling.
+TEST_F(UnrollConstantLoopsTest, BreakOutOfSwitch)
+{
+    const std::string shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform int s;
+        out vec4 color;
+        void main()
+        {
+            color = vec4(0);
+            for (int i = 0; i < 2; ++i)
+            {
+                switch (s)
+                {
+                    case 0:
+                        color.x += 1.0;
+                        break;
+                    default:
+                        color.y += 1.0;
+                        break;
+                }
+            }
+        })";
+    compile(shaderString);
+
+    EXPECT_TRUE(notFoundInCode("for ("));
+    EXPECT_TRUE(foundInCode("switch (", 2));
+}
+
+// Test that loops with too many iterations or that don't terminate are not unrolled.
+TEST_F(UnrollConstantLoopsTest, TooManyIterations)
+{
+    const std::string shaderString =
+        R"(#version 300 es
+        precision mediump float;
+        uniform vec4 u;
+        out vec4 color;
+        void main()
+        {
+            color = vec4(0);
+            for (int i = 0; i < 1000; ++i)
+            {
+                color += u;
+            }
+            for (uint i = 3u; i >= 0u; --i)
+            {
+                color += u;
+            }
+        })";
+    compile(shaderString);
+
+    EXPECT_TRUE(foundInCode("for (", 2));
+}
+
+}  // anonymous namespace
@@ -48,6 +48,7 @@ namespace
 {
 std::map<std::vector<uint8_t>, std::vector<uint8_t>> gApplicationCache;
 CacheOpResult gLastCacheOpResult = CacheOpResult::ValueNotSet;
+size_t gGetSuccessCount          = 0;
 
 void SetBlob(const void *key, EGLsizeiANDROID keySize, const void *value, EGLsizeiANDROID valueSize)
 {
@@ -81,6 +82,7 @@ EGLsizeiANDROID GetBlob(const void *key,
     {
         memcpy(value, entry->second.data(), entry->second.size());
         gLastCacheOpResult = CacheOpResult::GetSuccess;
+        gGetSuccessCount++;
     }
     else
     {
@@ -106,7 +108,11 @@ class EGLBlobCacheTest : public ANGLETest
         mHasBlobCache      = IsEGLDisplayExtensionEnabled(display, kEGLExtName);
     }
 
-    void testTearDown() override { gApplicationCache.clear(); }
+    void testTearDown() override
+    {
+        gApplicationCache.clear();
+        gGetSuccessCount = 0;
+    }
 
     bool programBinaryAvailable() { return IsGLExtensionEnabled("GL_OES_get_program_binary"); }
 
@@ -281,4 +287,112 @@ void main() {
     }
 }
 
+// Tests that compiled shaders are cached, and that shaders loaded from the cache work.
+TEST_P(EGLBlobCacheTest, ShaderCache)
+{
+    // Only the Vulkan backend caches compiled shaders.
+    ANGLE_SKIP_TEST_IF(!IsVulkan() || !programBinaryAvailable());
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+
+    EXPECT_TRUE(mHasBlobCache);
+    eglSetBlobCacheFuncsANDROID(display, SetBlob, GetBlob);
+    ASSERT_EGL_SUCCESS();
+
+    constexpr char kFragmentShaderSrc[] = R"(precision mediump float;
+uniform vec4 color;
+void main()
+{
+    gl_FragColor = color;
+})";
+
+    // Compile a shader so it puts something in the cache.  The shader is cached once its
+    // compilation is resolved, which querying the compile status does.
+    GLShader shader(GL_FRAGMENT_SHADER);
+    const char *source = kFragmentShaderSrc;
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    GLint compileResult = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compileResult);
+    ASSERT_GL_TRUE(compileResult);
+    EXPECT_EQ(CacheOpResult::SetSuccess, gLastCacheOpResult);
+    gLastCacheOpResult = CacheOpResult::ValueNotSet;
+
+    // Compile the same shader again, so it would be retrieved from the cache
+    GLShader cachedShader(GL_FRAGMENT_SHADER);
+    glShaderSource(cachedShader, 1, &source, nullptr);
+    glCompileShader(cachedShader);
+    EXPECT_EQ(CacheOpResult::GetSuccess, gLastCacheOpResult);
+    gLastCacheOpResult = CacheOpResult::ValueNotSet;
+
+    glGetShaderiv(cachedShader, GL_COMPILE_STATUS, &compileResult);
+    ASSERT_GL_TRUE(compileResult);
+
+    // Make sure the cached shader can be linked and used, and that its uniforms were restored.
+    GLuint vertexShader = CompileShader(GL_VERTEX_SHADER, essl1_shaders::vs::Simple());
+    ASSERT_NE(0u, vertexShader);
+
+    GLProgram program;
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, cachedShader);
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+
+    GLint linkResult = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkResult);
+    ASSERT_GL_TRUE(linkResult);
+
+    GLint colorLocation = glGetUniformLocation(program, "color");
+    ASSERT_NE(-1, colorLocation);
+
+    glUseProgram(program);
+    glUniform4f(colorLocation, 0, 1, 0, 1);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
+// Makes sure the D3D11 backend reuses the compiled HLSL of another program.
+TEST_P(EGLBlobCacheTest, D3D11ShaderBinaryCache)
+{
+    ANGLE_SKIP_TEST_IF(!IsD3D11() || !programBinaryAvailable());
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+
+    EXPECT_TRUE(mHasBlobCache);
+    eglSetBlobCacheFuncsANDROID(display, SetBlob, GetBlob);
+    ASSERT_EGL_SUCCESS();
+
+    {
+        ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+        EXPECT_EQ(CacheOpResult::SetSuccess, gLastCacheOpResult);
+    }
+    gGetSuccessCount = 0;
+
+    // Binding an attribute the shaders don't use changes the program's key, but not the HLSL the
+    // program compiles, whose binaries should come from the cache.
+    GLuint vertexShader   = CompileShader(GL_VERTEX_SHADER, essl1_shaders::vs::Simple());
+    GLuint fragmentShader = CompileShader(GL_FRAGMENT_SHADER, essl1_shaders::fs::Green());
+    ASSERT_NE(0u, vertexShader);
+    ASSERT_NE(0u, fragmentShader);
+
+    GLProgram program;
+    glAttachShader(program, vertexShader);
+    glAttachShader(program, fragmentShader);
+    glBindAttribLocation(program, 5, "unused");
+    glLinkProgram(program);
+    glDeleteShader(vertexShader);
+    glDeleteShader(fragmentShader);
+
+    GLint linkResult = 0;
+    glGetProgramiv(program, GL_LINK_STATUS, &linkResult);
+    ASSERT_GL_TRUE(linkResult);
+    EXPECT_GT(gGetSuccessCount, 0u);
+
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(EGLBlobCacheTest);
@@ -261,6 +261,43 @@ TEST_P(EGLProgramCacheControlTest, LinkProgramWithBadShaders)
     glDeleteProgram(program);
 }
 
+// Tests that the cache statistics count cache hits, misses and evictions.
+TEST_P(EGLProgramCacheControlTest, Statistics)
+{
+    ANGLE_SKIP_TEST_IF(!extensionAvailable() || !programBinaryAvailable());
+
+    constexpr char kVS[] = "attribute vec4 position; void main() { gl_Position = position; }";
+    constexpr char kFS[] = "void main() { gl_FragColor = vec4(1, 0, 0, 1); }";
+
+    EGLDisplay display = getEGLWindow()->getDisplay();
+    EGLint hits        = eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_HIT_COUNT_ANGLE);
+    EGLint misses = eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_MISS_COUNT_ANGLE);
+    EGLint evictions =
+        eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_EVICTION_COUNT_ANGLE);
+    ASSERT_EGL_SUCCESS();
+
+    // The first link misses the cache.
+    {
+        ANGLE_GL_PROGRAM(program, kVS, kFS);
+    }
+    EGLint newMisses = eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_MISS_COUNT_ANGLE);
+    EXPECT_GT(newMisses, misses);
+
+    // Linking the same program again hits the cache.
+    {
+        ANGLE_GL_PROGRAM(program, kVS, kFS);
+    }
+    EGLint newHits = eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_HIT_COUNT_ANGLE);
+    EXPECT_GT(newHits, hits);
+
+    // Trimming the cache evicts its entries.
+    eglProgramCacheResizeANGLE(display, 0, EGL_PROGRAM_CACHE_TRIM_ANGLE);
+    EXPECT_EQ(0, eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_SIZE_ANGLE));
+    EXPECT_GT(eglProgramCacheGetAttribANGLE(display, EGL_PROGRAM_CACHE_EVICTION_COUNT_ANGLE),
+              evictions);
+    ASSERT_EGL_SUCCESS();
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLProgramCacheControlTest);
 ANGLE_INSTANTIATE_TEST(EGLProgramCacheControlTest,
                        ES2_D3D9(),
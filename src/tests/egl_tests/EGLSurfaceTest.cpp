@@ -1342,6 +1342,52 @@ TEST_P(EGLSurfaceTestD3D11, CreateSurfaceWithMSAA)
     glDeleteProgram(program);
 }
 
+// Test that a low-latency window surface exposes a frame latency waitable object, and that swaps
+// keep working when the application waits on it.
+TEST_P(EGLSurfaceTestD3D11, FrameLatencyWaitableObject)
+{
+    initializeDisplay();
+    ANGLE_SKIP_TEST_IF(
+        !IsEGLDisplayExtensionEnabled(mDisplay, "EGL_ANGLE_frame_latency_waitable_object"));
+
+    mConfig = chooseDefaultConfig(true);
+    ASSERT_NE(mConfig, nullptr);
+
+    std::vector<EGLint> lowLatencyAttribs = {EGL_LOW_LATENCY_PRESENT_ANGLE, EGL_TRUE};
+    initializeWindowSurfaceWithAttribs(mConfig, lowLatencyAttribs, EGL_SUCCESS);
+    initializeSingleContext(&mContext);
+
+    eglMakeCurrent(mDisplay, mWindowSurface, mWindowSurface, mContext);
+    ASSERT_EGL_SUCCESS();
+
+    // The object is only available if the flip model is, which needs Windows 10.
+    void *waitableObject = nullptr;
+    EXPECT_EGL_TRUE(eglQuerySurfacePointerANGLE(
+        mDisplay, mWindowSurface, EGL_FRAME_LATENCY_WAITABLE_OBJECT_ANGLE, &waitableObject));
+    ASSERT_EGL_SUCCESS();
+
+    ANGLE_GL_PROGRAM(greenProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    for (EGLint swapInterval : {1, 0})
+    {
+        eglSwapInterval(mDisplay, swapInterval);
+        for (int frame = 0; frame < 5; ++frame)
+        {
+            if (waitableObject != nullptr)
+            {
+                EXPECT_EQ(static_cast<DWORD>(WAIT_OBJECT_0),
+                          WaitForSingleObjectEx(waitableObject, 1000, TRUE));
+            }
+
+            // The whole surface is drawn every frame even though the back buffers are discarded.
+            drawQuad(greenProgram, essl1_shaders::PositionAttrib(), 0.5f);
+            EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+            eglSwapBuffers(mDisplay, mWindowSurface);
+            ASSERT_EGL_SUCCESS();
+            EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+        }
+    }
+}
+
 #endif  // ANGLE_ENABLE_D3D11
 
 // Verify bliting between two surfaces works correctly.
@@ -1619,6 +1665,48 @@ TEST_P(EGLSurfaceTest, CreateSurfaceSwapIntervalANGLE)
     }
 }
 
+// Tests the EGL_ANGLE_low_latency_present extension if available.
+TEST_P(EGLSurfaceTest, LowLatencyPresentANGLE)
+{
+    initializeDisplay();
+    ASSERT_NE(mDisplay, EGL_NO_DISPLAY);
+
+    mConfig = chooseDefaultConfig(true);
+    ASSERT_NE(mConfig, nullptr);
+
+    std::vector<EGLint> lowLatencyAttribs = {EGL_LOW_LATENCY_PRESENT_ANGLE, EGL_TRUE};
+    if (!IsEGLDisplayExtensionEnabled(mDisplay, "EGL_ANGLE_low_latency_present"))
+    {
+        // Test extension unavailable error.
+        initializeWindowSurfaceWithAttribs(mConfig, lowLatencyAttribs, EGL_BAD_ATTRIBUTE);
+        return;
+    }
+
+    // Only EGL_TRUE and EGL_FALSE are accepted.
+    std::vector<EGLint> invalidAttribs = {EGL_LOW_LATENCY_PRESENT_ANGLE, 2};
+    initializeWindowSurfaceWithAttribs(mConfig, invalidAttribs, EGL_BAD_ATTRIBUTE);
+
+    initializeWindowSurfaceWithAttribs(mConfig, lowLatencyAttribs, EGL_SUCCESS);
+    initializeSingleContext(&mContext);
+
+    eglMakeCurrent(mDisplay, mWindowSurface, mWindowSurface, mContext);
+    ASSERT_EGL_SUCCESS();
+
+    ANGLE_GL_PROGRAM(greenProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        drawQuad(greenProgram, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+        eglSwapBuffers(mDisplay, mWindowSurface);
+        ASSERT_EGL_SUCCESS();
+    }
+
+    // The latency stays zero if the implementation can't observe when frames are displayed.
+    EGLint latency = -1;
+    EXPECT_EGL_TRUE(eglQuerySurface(mDisplay, mWindowSurface, EGL_PRESENT_LATENCY_ANGLE, &latency));
+    EXPECT_GE(latency, 0);
+}
+
 TEST_P(EGLSingleBufferTest, OnCreateWindowSurface)
 {
     EGLConfig config = EGL_NO_CONFIG_KHR;
@@ -142,6 +142,68 @@ TEST_P(BufferDataTest, RepeatedDrawWithDynamic)
     EXPECT_GL_NO_ERROR();
 }
 
+// Test that updates to a buffer that holds both vertices and indices are seen by draws through
+// both binding points.
+TEST_P(BufferDataTest, VertexAndIndexDataInSameBuffer)
+{
+    struct Vertex
+    {
+        GLfloat position[2];
+        GLfloat attrib;
+    };
+    std::array<Vertex, 4> vertices = {{
+        {{-1.0f, -1.0f}, 1.0f},
+        {{1.0f, -1.0f}, 1.0f},
+        {{1.0f, 1.0f}, 1.0f},
+        {{-1.0f, 1.0f}, 1.0f},
+    }};
+    constexpr std::array<GLushort, 6> kIndices           = {0, 1, 2, 0, 2, 3};
+    constexpr std::array<GLushort, 6> kDegenerateIndices = {};
+    constexpr GLsizeiptr kIndexOffset                    = sizeof(vertices);
+
+    const void *indices = reinterpret_cast<const void *>(kIndexOffset);
+
+    glUseProgram(mProgram);
+    GLint positionLocation = glGetAttribLocation(mProgram, "position");
+    ASSERT_NE(-1, positionLocation);
+
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, kIndexOffset + sizeof(kIndices), nullptr, GL_STATIC_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices.data());
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, kIndexOffset, sizeof(kIndices), kIndices.data());
+
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), nullptr);
+    glVertexAttribPointer(mAttribLocation, 1, GL_FLOAT, GL_FALSE, sizeof(Vertex),
+                          reinterpret_cast<const void *>(offsetof(Vertex, attrib)));
+    glEnableVertexAttribArray(positionLocation);
+    glEnableVertexAttribArray(mAttribLocation);
+
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, indices);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, getWindowHeight() - 1, GLColor::red);
+
+    // Update the vertices through the array buffer binding.
+    for (Vertex &vertex : vertices)
+    {
+        vertex.attrib = 0.0f;
+    }
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices.data());
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, indices);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::black);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, getWindowHeight() - 1, GLColor::black);
+
+    // Update the indices through the element array buffer binding.
+    glClear(GL_COLOR_BUFFER_BIT);
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, kIndexOffset, sizeof(kDegenerateIndices),
+                    kDegenerateIndices.data());
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_SHORT, indices);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::transparentBlack);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, getWindowHeight() - 1, GLColor::transparentBlack);
+
+    ASSERT_GL_NO_ERROR();
+}
+
 // Tests for a bug where vertex attribute translation was not being invalidated when switching to
 // DYNAMIC
 TEST_P(BufferDataTest, RepeatedDrawDynamicBug)
@@ -346,6 +408,43 @@ TEST_P(BufferSubDataTest, SmallVertexDataUpdateAfterDraw)
     EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, 0, GLColor::green);
     EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, getWindowHeight() - 1, GLColor::green);
 }
+
+// Test that a large update of an idle vertex buffer is visible to the draw call that follows.
+// In the Vulkan backend, the copy may be made on a transfer queue.
+TEST_P(BufferSubDataTest, LargeVertexDataUpdateOfIdleBuffer)
+{
+    constexpr std::array<GLfloat, 4> kGreen = {0.0f, 1.0f, 0.0f, 1.0f};
+    constexpr size_t kVertexCount           = 3 * 100000;
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    GLint vPos = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    ASSERT_NE(vPos, -1);
+    glUseProgram(program);
+    GLint colorUniformLocation =
+        glGetUniformLocation(program, angle::essl1_shaders::ColorUniform());
+    ASSERT_NE(colorUniformLocation, -1);
+    glUniform4fv(colorUniformLocation, 1, kGreen.data());
+
+    // Degenerate triangles, followed by two triangles that cover the window.
+    std::vector<GLfloat> vertexData(kVertexCount * 2, 0.0f);
+    const std::array<GLfloat, 12> kQuad = {
+        -1.0f, -1.0f, 1.0f, -1.0f, -1.0f, 1.0f, -1.0f, 1.0f, 1.0f, -1.0f, 1.0f, 1.0f,
+    };
+    std::copy(kQuad.begin(), kQuad.end(), vertexData.end() - kQuad.size());
+
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, vertexData.size() * sizeof(GLfloat), nullptr, GL_STATIC_DRAW);
+    glFinish();
+    glBufferSubData(GL_ARRAY_BUFFER, 0, vertexData.size() * sizeof(GLfloat), vertexData.data());
+
+    glVertexAttribPointer(vPos, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(vPos);
+    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(kVertexCount));
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, getWindowWidth(), getWindowHeight(), GLColor::green);
+}
+
 class IndexedBufferCopyTest : public ANGLETest
 {
   protected:
@@ -1903,11 +2002,13 @@ TEST_P(BufferStorageTestES3Threaded, VertexBuffer)
     ASSERT_GL_NO_ERROR();
 }
 
-ANGLE_INSTANTIATE_TEST_ES2(BufferDataTest);
+ANGLE_INSTANTIATE_TEST_ES2_AND(BufferDataTest,
+                               ES2_D3D11().disable(Feature::CombineBufferBindFlags));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(BufferSubDataTest);
 ANGLE_INSTANTIATE_TEST_ES3_AND(BufferSubDataTest,
-                               ES3_VULKAN().enable(Feature::PreferCPUForBufferSubData));
+                               ES3_VULKAN().enable(Feature::PreferCPUForBufferSubData),
+                               ES3_VULKAN().enable(Feature::UseTransferQueueForUploads));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(BufferDataTestES3);
 ANGLE_INSTANTIATE_TEST_ES3(BufferDataTestES3);
@@ -2941,6 +2941,115 @@ TEST_P(ClearTestES3, MaskedScissoredClearThenFullMaskedClear)
     EXPECT_PIXEL_RECT_EQ(w / 4, h / 4, w / 2, h / 2, GLColor::yellow);
 }
 
+// Test that clearing individual draw buffers followed by scissored clears of several regions works.
+// In the Vulkan backend, the scissored clears are batched with vkCmdClearAttachments.
+TEST_P(ClearTestES3, ClearBuffersThenScissoredClears)
+{
+    constexpr GLsizei kSize             = 16;
+    constexpr uint32_t kAttachmentCount = 2;
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+    GLTexture textures[kAttachmentCount];
+    GLenum drawBuffers[kAttachmentCount];
+    for (uint32_t i = 0; i < kAttachmentCount; ++i)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures[i]);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kSize, kSize);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + i, GL_TEXTURE_2D, textures[i],
+                               0);
+        drawBuffers[i] = GL_COLOR_ATTACHMENT0 + i;
+    }
+    glDrawBuffers(kAttachmentCount, drawBuffers);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    // Clear each draw buffer to a different color.
+    glClearBufferfv(GL_COLOR, 0, GLColor::red.toNormalizedVector().data());
+    glClearBufferfv(GL_COLOR, 1, GLColor::green.toNormalizedVector().data());
+
+    // Clear the left corners of both draw buffers to blue.
+    glEnable(GL_SCISSOR_TEST);
+    glClearColor(0, 0, 1, 1);
+    glScissor(0, 0, kSize / 2, kSize / 4);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glScissor(0, 3 * kSize / 4, kSize / 2, kSize / 4);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Clear the center of the second draw buffer to yellow.
+    glScissor(kSize / 4, kSize / 4, kSize / 2, kSize / 2);
+    glClearBufferfv(GL_COLOR, 1, GLColor::yellow.toNormalizedVector().data());
+    glDisable(GL_SCISSOR_TEST);
+    ASSERT_GL_NO_ERROR();
+
+    const GLColor kCenterColors[kAttachmentCount] = {GLColor::red, GLColor::yellow};
+    const GLColor kClearColors[kAttachmentCount]  = {GLColor::red, GLColor::green};
+    for (uint32_t i = 0; i < kAttachmentCount; ++i)
+    {
+        glReadBuffer(GL_COLOR_ATTACHMENT0 + i);
+        EXPECT_PIXEL_RECT_EQ(0, 0, kSize / 2, kSize / 4, GLColor::blue);
+        EXPECT_PIXEL_RECT_EQ(0, 3 * kSize / 4, kSize / 2, kSize / 4, GLColor::blue);
+        EXPECT_PIXEL_RECT_EQ(kSize / 2, 0, kSize / 2, kSize / 4, kClearColors[i]);
+        EXPECT_PIXEL_RECT_EQ(kSize / 4, kSize / 4, kSize / 2, kSize / 2, kCenterColors[i]);
+        EXPECT_PIXEL_RECT_EQ(3 * kSize / 4, kSize / 4, kSize / 4, kSize / 2, kClearColors[i]);
+    }
+}
+
+// Test that integer clears are exact, both for values that can be cleared directly and for values
+// that can't be represented as floats (such as 2^24 + 1), with and without scissor.
+TEST_P(ClearTestES3, ClearIntegerAttachmentsExactValues)
+{
+    constexpr GLsizei kSize = 16;
+
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+
+    GLTexture uintTexture;
+    glBindTexture(GL_TEXTURE_2D, uintTexture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA32UI, kSize, kSize);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, uintTexture, 0);
+
+    GLTexture intTexture;
+    glBindTexture(GL_TEXTURE_2D, intTexture);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA32I, kSize, kSize);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT1, GL_TEXTURE_2D, intTexture, 0);
+
+    const GLenum drawBuffers[] = {GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1};
+    glDrawBuffers(2, drawBuffers);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    const GLuint kSmallUint[4]  = {1, 2, 1000, 0xFFFFFF};
+    const GLint kSmallInt[4]    = {-1, 2, -1000, -0x800000};
+    const GLuint kLargeUint[4]  = {0x1000001, 0xFFFFFFFF, 0x80000001, 3};
+    const GLint kLargeInt[4]    = {-0x1000001, 0x7FFFFFFF, -0x7FFFFFFF - 1, 3};
+    constexpr GLsizei kScissorX = kSize / 2;
+
+    glClearBufferuiv(GL_COLOR, 0, kSmallUint);
+    glClearBufferiv(GL_COLOR, 1, kSmallInt);
+
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(kScissorX, 0, kSize - kScissorX, kSize);
+    glClearBufferuiv(GL_COLOR, 0, kLargeUint);
+    glClearBufferiv(GL_COLOR, 1, kLargeInt);
+    glDisable(GL_SCISSOR_TEST);
+    ASSERT_GL_NO_ERROR();
+
+    GLuint uintPixel[4] = {};
+    glReadBuffer(GL_COLOR_ATTACHMENT0);
+    glReadPixels(0, 0, 1, 1, GL_RGBA_INTEGER, GL_UNSIGNED_INT, uintPixel);
+    EXPECT_EQ(0, memcmp(uintPixel, kSmallUint, sizeof(uintPixel)));
+    glReadPixels(kSize - 1, kSize - 1, 1, 1, GL_RGBA_INTEGER, GL_UNSIGNED_INT, uintPixel);
+    EXPECT_EQ(0, memcmp(uintPixel, kLargeUint, sizeof(uintPixel)));
+
+    GLint intPixel[4] = {};
+    glReadBuffer(GL_COLOR_ATTACHMENT1);
+    glReadPixels(0, 0, 1, 1, GL_RGBA_INTEGER, GL_INT, intPixel);
+    EXPECT_EQ(0, memcmp(intPixel, kSmallInt, sizeof(intPixel)));
+    glReadPixels(kSize - 1, kSize - 1, 1, 1, GL_RGBA_INTEGER, GL_INT, intPixel);
+    EXPECT_EQ(0, memcmp(intPixel, kLargeInt, sizeof(intPixel)));
+    ASSERT_GL_NO_ERROR();
+}
+
 #ifdef Bool
 // X11 craziness.
 #    undef Bool
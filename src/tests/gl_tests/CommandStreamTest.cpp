@@ -0,0 +1,224 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// CommandStreamTest.cpp : Tests of the GL_ANGLE_command_stream extension.
+
+#include "test_utils/ANGLETest.h"
+
+#include "test_utils/gl_raii.h"
+
+namespace angle
+{
+
+class CommandStreamTest : public ANGLETest
+{
+  protected:
+    CommandStreamTest()
+    {
+        setWindowWidth(16);
+        setWindowHeight(16);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+
+    void testSetUp() override
+    {
+        const std::array<Vector3, 6> &quadVertices = GetQuadVertices();
+        glBindBuffer(GL_ARRAY_BUFFER, mQuadBuffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(quadVertices), quadVertices.data(), GL_STATIC_DRAW);
+        glBindBuffer(GL_ARRAY_BUFFER, 0);
+    }
+
+    // Sets the position attribute of |program| to source the quad buffer.
+    void setupQuadAttrib(GLuint program)
+    {
+        GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+        ASSERT_NE(-1, positionLocation);
+
+        glBindBuffer(GL_ARRAY_BUFFER, mQuadBuffer);
+        glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glEnableVertexAttribArray(positionLocation);
+    }
+
+    GLBuffer mQuadBuffer;
+};
+
+// Test the errors generated by the command stream entry points.
+TEST_P(CommandStreamTest, Validation)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_command_stream"));
+
+    glBeginCommandStreamANGLE(0);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    glCallCommandStreamANGLE(0);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+
+    glEndCommandStreamANGLE();
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glBeginCommandStreamANGLE(1);
+    EXPECT_GL_NO_ERROR();
+
+    // Nesting, calling and deleting streams is not allowed while recording.
+    glBeginCommandStreamANGLE(2);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+    glCallCommandStreamANGLE(1);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+    glDeleteCommandStreamANGLE(1);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glEndCommandStreamANGLE();
+    EXPECT_GL_NO_ERROR();
+
+    // Calling or deleting a stream that was never recorded is not an error.
+    glCallCommandStreamANGLE(3);
+    glDeleteCommandStreamANGLE(3);
+    glDeleteCommandStreamANGLE(1);
+    EXPECT_GL_NO_ERROR();
+}
+
+// Test that recorded commands are executed while recording, and again when the stream is called.
+TEST_P(CommandStreamTest, RecordAndCall)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_command_stream"));
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorLocation);
+    setupQuadAttrib(program);
+
+    glClearColor(0, 0, 0, 0);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    glBeginCommandStreamANGLE(1);
+    glUseProgram(program);
+    glUniform4f(colorLocation, 1, 0, 0, 1);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    glEndCommandStreamANGLE();
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    glUniform4f(colorLocation, 0, 1, 0, 1);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    glUseProgram(0);
+    glCallCommandStreamANGLE(1);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    // The stream leaves its state behind like the calls it recorded.
+    GLint currentProgram = 0;
+    glGetIntegerv(GL_CURRENT_PROGRAM, &currentProgram);
+    EXPECT_EQ(static_cast<GLint>(program.get()), currentProgram);
+}
+
+// Test that uniform data is copied when recorded.
+TEST_P(CommandStreamTest, UniformDataIsCopied)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_command_stream"));
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorLocation);
+    setupQuadAttrib(program);
+    glUseProgram(program);
+
+    GLfloat color[4] = {0, 0, 1, 1};
+    glBeginCommandStreamANGLE(1);
+    glUniform4fv(colorLocation, 1, color);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    glEndCommandStreamANGLE();
+    ASSERT_GL_NO_ERROR();
+
+    color[1] = 1;
+    glUniform4fv(colorLocation, 1, color);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::cyan);
+
+    glCallCommandStreamANGLE(1);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+}
+
+// Test that recording a stream again replaces its commands.
+TEST_P(CommandStreamTest, Rerecord)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_command_stream"));
+
+    glBeginCommandStreamANGLE(1);
+    glEnable(GL_SCISSOR_TEST);
+    glEndCommandStreamANGLE();
+
+    glBeginCommandStreamANGLE(1);
+    glDisable(GL_SCISSOR_TEST);
+    glEndCommandStreamANGLE();
+    ASSERT_GL_NO_ERROR();
+
+    glEnable(GL_SCISSOR_TEST);
+    glCallCommandStreamANGLE(1);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_GL_FALSE(glIsEnabled(GL_SCISSOR_TEST));
+}
+
+// Test that draws that source client memory can't be recorded.
+TEST_P(CommandStreamTest, ClientMemoryDrawIsRejected)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_command_stream"));
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_ANGLE_client_arrays"));
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    setupQuadAttrib(program);
+    glUseProgram(program);
+
+    const GLubyte indices[] = {0, 1, 2, 3, 4, 5};
+
+    glBeginCommandStreamANGLE(1);
+    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_BYTE, indices);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    const std::array<Vector3, 6> &quadVertices = GetQuadVertices();
+    GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, quadVertices.data());
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glEndCommandStreamANGLE();
+    EXPECT_GL_NO_ERROR();
+}
+
+// Test that the recorded commands are validated against the state at the time of the call.
+TEST_P(CommandStreamTest, CallRevalidates)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_command_stream"));
+
+    GLuint program = CompileProgram(essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    ASSERT_NE(0u, program);
+
+    glBeginCommandStreamANGLE(1);
+    glUseProgram(program);
+    glEnable(GL_BLEND);
+    glEndCommandStreamANGLE();
+    ASSERT_GL_NO_ERROR();
+
+    glUseProgram(0);
+    glDeleteProgram(program);
+    glDisable(GL_BLEND);
+
+    // The deleted program generates an error, but the rest of the stream is still executed.
+    glCallCommandStreamANGLE(1);
+    EXPECT_GL_ERROR(GL_INVALID_VALUE);
+    EXPECT_GL_TRUE(glIsEnabled(GL_BLEND));
+}
+
+// Use this to select which configurations (e.g. which renderer, which GLES major version) these
+// tests should be run against.
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(CommandStreamTest);
+}  // namespace angle
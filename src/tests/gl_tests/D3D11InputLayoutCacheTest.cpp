@@ -121,6 +121,79 @@ TEST_P(D3D11InputLayoutCacheTest, StressTest)
     }
 }
 
+// Test that the input layouts saved in the warm-up list are created again by a new warm-up, and
+// that draws using them still render correctly.
+TEST_P(D3D11InputLayoutCacheTest, WarmUp)
+{
+    gl::Context *context       = static_cast<gl::Context *>(getEGLWindow()->getContext());
+    rx::Context11 *context11   = rx::GetImplAs<rx::Context11>(context);
+    rx::Renderer11 *renderer11 = context11->getRenderer();
+    rx::InputLayoutCache *inputLayoutCache = renderer11->getStateManager()->getInputLayoutCache();
+
+    ANGLE_SKIP_TEST_IF(!renderer11->getFeatures().warmUpInputLayoutCache.enabled);
+
+    // Make sure the whole warm-up list fits in the cache.
+    inputLayoutCache->setCacheSize(1024);
+
+    constexpr unsigned int kMaxAttribCount = 4;
+
+    std::vector<GLuint> programs;
+    for (unsigned int attribCount = 1; attribCount <= kMaxAttribCount; ++attribCount)
+    {
+        GLuint program = makeProgramWithAttribCount(attribCount);
+        ASSERT_NE(0u, program);
+        programs.push_back(program);
+    }
+
+    auto drawAll = [&]() {
+        for (unsigned int attribCount = 1; attribCount <= kMaxAttribCount; ++attribCount)
+        {
+            GLuint program = programs[attribCount - 1];
+            glUseProgram(program);
+
+            for (unsigned int attribIndex = 0; attribIndex < attribCount; ++attribIndex)
+            {
+                std::stringstream attribNameStr;
+                attribNameStr << "a" << attribIndex;
+                GLint location = glGetAttribLocation(program, attribNameStr.str().c_str());
+                ASSERT_NE(-1, location);
+                glVertexAttrib1f(location, 1.0f);
+                glDisableVertexAttribArray(location);
+            }
+
+            drawQuad(program, "position", 0.5f);
+            EXPECT_PIXEL_EQ(0, 0, attribCount, 0, 0, 255u);
+        }
+    };
+
+    drawAll();
+    ASSERT_GL_NO_ERROR();
+
+    size_t layoutCount = inputLayoutCache->getCachedLayoutCount();
+    ASSERT_GE(layoutCount, static_cast<size_t>(kMaxAttribCount));
+
+    inputLayoutCache->saveWarmUpList(renderer11);
+    inputLayoutCache->clear();
+    EXPECT_EQ(0u, inputLayoutCache->getCachedLayoutCount());
+
+    // The warm-up list may also contain the input layouts of previous tests using the same
+    // display.
+    EXPECT_EQ(angle::Result::Continue, inputLayoutCache->warmUp(context11));
+    layoutCount = inputLayoutCache->getCachedLayoutCount();
+    EXPECT_GE(layoutCount, static_cast<size_t>(kMaxAttribCount));
+
+    // The draws find all their input layouts in the cache.
+    renderer11->getStateManager()->invalidateInputLayout();
+    drawAll();
+    EXPECT_EQ(layoutCount, inputLayoutCache->getCachedLayoutCount());
+    ASSERT_GL_NO_ERROR();
+
+    for (GLuint program : programs)
+    {
+        glDeleteProgram(program);
+    }
+}
+
 ANGLE_INSTANTIATE_TEST(D3D11InputLayoutCacheTest, ES2_D3D11(), ES3_D3D11(), ES31_D3D11());
 
 }  // anonymous namespace
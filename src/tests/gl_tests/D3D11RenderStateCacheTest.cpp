@@ -0,0 +1,103 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// D3D11RenderStateCacheTest:
+//   Tests the precreation of the D3D11 render states saved in the blob cache.
+//
+
+#include "libANGLE/Context.h"
+#include "libANGLE/renderer/d3d/d3d11/Context11.h"
+#include "libANGLE/renderer/d3d/d3d11/Renderer11.h"
+#include "test_utils/ANGLETest.h"
+#include "test_utils/angle_test_instantiate.h"
+#include "test_utils/gl_raii.h"
+#include "util/EGLWindow.h"
+
+using namespace angle;
+
+namespace
+{
+
+class D3D11RenderStateCacheTest : public ANGLETest
+{
+  protected:
+    D3D11RenderStateCacheTest()
+    {
+        setWindowWidth(64);
+        setWindowHeight(64);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+        setConfigDepthBits(24);
+    }
+};
+
+// Test that the states saved in the profile are created again by a new precreation, and that draws
+// using them still render correctly.
+TEST_P(D3D11RenderStateCacheTest, Precreate)
+{
+    gl::Context *context             = static_cast<gl::Context *>(getEGLWindow()->getContext());
+    rx::Context11 *context11         = rx::GetImplAs<rx::Context11>(context);
+    rx::Renderer11 *renderer11       = context11->getRenderer();
+    rx::RenderStateCache *stateCache = renderer11->getStateCache();
+
+    ANGLE_SKIP_TEST_IF(!renderer11->getFeatures().precreateRenderStates.enabled);
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+    GLint colorLocation = glGetUniformLocation(program, essl1_shaders::ColorUniform());
+    ASSERT_NE(-1, colorLocation);
+    glUniform4f(colorLocation, 0.0f, 1.0f, 0.0f, 1.0f);
+
+    // Each depth function and cull face makes a different depth stencil and rasterizer state.
+    constexpr GLenum kDepthFuncs[] = {GL_ALWAYS, GL_LEQUAL, GL_GEQUAL, GL_NOTEQUAL};
+    constexpr GLenum kCullFaces[]  = {GL_FRONT, GL_BACK};
+
+    auto drawAll = [&]() {
+        glEnable(GL_DEPTH_TEST);
+        glEnable(GL_CULL_FACE);
+        for (GLenum depthFunc : kDepthFuncs)
+        {
+            for (GLenum cullFace : kCullFaces)
+            {
+                glDepthFunc(depthFunc);
+                glCullFace(cullFace);
+                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+            }
+        }
+        glDisable(GL_DEPTH_TEST);
+        glDisable(GL_CULL_FACE);
+
+        // The last draw culls back faces and the quad is front facing.
+        EXPECT_PIXEL_COLOR_EQ(getWindowWidth() / 2, getWindowHeight() / 2, GLColor::green);
+    };
+
+    drawAll();
+    ASSERT_GL_NO_ERROR();
+
+    size_t stateCount = stateCache->getCachedStateCount();
+    ASSERT_GE(stateCount, ArraySize(kDepthFuncs) + ArraySize(kCullFaces));
+
+    stateCache->saveProfile(renderer11);
+    stateCache->clear();
+    EXPECT_EQ(0u, stateCache->getCachedStateCount());
+
+    // The profile may also contain the states of previous tests using the same display.
+    stateCache->precreateStates(context, renderer11);
+    stateCache->waitForPrecreation();
+    stateCount = stateCache->getCachedStateCount();
+    EXPECT_GE(stateCount, ArraySize(kDepthFuncs) + ArraySize(kCullFaces));
+
+    // The draws find all their states in the cache.
+    drawAll();
+    EXPECT_EQ(stateCount, stateCache->getCachedStateCount());
+    ASSERT_GL_NO_ERROR();
+}
+
+ANGLE_INSTANTIATE_TEST(D3D11RenderStateCacheTest, ES2_D3D11(), ES3_D3D11());
+
+}  // anonymous namespace
@@ -0,0 +1,88 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+
+// DrawWarmUpTest.cpp : Tests of the GL_ANGLE_draw_warm_up extension.
+
+#include "test_utils/ANGLETest.h"
+
+#include "test_utils/gl_raii.h"
+
+namespace angle
+{
+
+class DrawWarmUpTest : public ANGLETest
+{
+  protected:
+    DrawWarmUpTest()
+    {
+        setWindowWidth(16);
+        setWindowHeight(16);
+        setConfigRedBits(8);
+        setConfigGreenBits(8);
+        setConfigBlueBits(8);
+        setConfigAlphaBits(8);
+    }
+};
+
+// Test the errors generated by glWarmUpDrawANGLE.
+TEST_P(DrawWarmUpTest, Validation)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_draw_warm_up"));
+
+    // Without a program, like a draw, this does nothing.
+    glWarmUpDrawANGLE(GL_TRIANGLES);
+    EXPECT_GL_NO_ERROR();
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    glUseProgram(program);
+
+    glWarmUpDrawANGLE(GL_TRIANGLES + 100);
+    EXPECT_GL_ERROR(GL_INVALID_ENUM);
+
+    // The state must be valid for a draw.
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glWarmUpDrawANGLE(GL_TRIANGLES);
+    EXPECT_GL_ERROR(GL_INVALID_FRAMEBUFFER_OPERATION);
+}
+
+// Test that draws after warming up their pipelines render correctly.
+TEST_P(DrawWarmUpTest, DrawAfterWarmUp)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_draw_warm_up"));
+
+    ANGLE_GL_PROGRAM(red, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    ANGLE_GL_PROGRAM(green, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+
+    // Warm up both programs, with different topologies and blend state.
+    glUseProgram(red);
+    glWarmUpDrawANGLE(GL_TRIANGLES);
+    glWarmUpDrawANGLE(GL_LINES);
+    glUseProgram(green);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    glWarmUpDrawANGLE(GL_TRIANGLES);
+    glDisable(GL_BLEND);
+    glWarmUpDrawANGLE(GL_TRIANGLES);
+    ASSERT_GL_NO_ERROR();
+
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    drawQuad(red, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_ONE, GL_ONE);
+    drawQuad(green, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::yellow);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Use this to select which configurations (e.g. which renderer, which GLES major version) these
+// tests should be run against.
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(DrawWarmUpTest);
+}  // namespace angle
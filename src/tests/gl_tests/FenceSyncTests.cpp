@@ -343,7 +343,13 @@ TEST_P(FenceSyncTest, MultipleFenceDraw)
     }
 }
 
-ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(FenceNVTest);
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
+    FenceNVTest,
+    ES2_VULKAN().enable(Feature::UseTimelineSemaphoreForQueueSerials),
+    ES3_VULKAN().enable(Feature::UseTimelineSemaphoreForQueueSerials),
+    ES2_D3D11().enable(Feature::RecordCommandsInDeferredContext));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(FenceSyncTest);
-ANGLE_INSTANTIATE_TEST_ES3(FenceSyncTest);
+ANGLE_INSTANTIATE_TEST_ES3_AND(FenceSyncTest,
+                               ES3_VULKAN().enable(Feature::UseTimelineSemaphoreForQueueSerials),
+                               ES3_D3D11().enable(Feature::RecordCommandsInDeferredContext));
@@ -15603,11 +15603,13 @@ ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(GLSLTestNoValidation);
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(GLSLTest_ES3);
 ANGLE_INSTANTIATE_TEST_ES3_AND(GLSLTest_ES3,
-                               ES3_VULKAN().enable(Feature::GenerateSPIRVThroughGlslang));
+                               ES3_VULKAN().enable(Feature::GenerateSPIRVThroughGlslang),
+                               ES3_VULKAN().enable(Feature::OptimizeSpirv));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(GLSLTestLoops);
 ANGLE_INSTANTIATE_TEST_ES3_AND(GLSLTestLoops,
-                               ES3_VULKAN().enable(Feature::GenerateSPIRVThroughGlslang));
+                               ES3_VULKAN().enable(Feature::GenerateSPIRVThroughGlslang),
+                               ES3_VULKAN().enable(Feature::OptimizeSpirv));
 
 ANGLE_INSTANTIATE_TEST_ES2_AND(WebGLGLSLTest,
                                ES2_VULKAN().enable(Feature::GenerateSPIRVThroughGlslang));
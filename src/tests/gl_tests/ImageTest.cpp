@@ -2531,6 +2531,55 @@ TEST_P(ImageTest, SourceAHBTarget2DRetainInitialData)
     destroyAndroidHardwareBuffer(source);
 }
 
+#if defined(ANGLE_AHARDWARE_BUFFER_SUPPORT)
+// Testing EGL images created again and again from a ring of AHBs whose contents are updated in
+// between, like a video decoder would.
+TEST_P(ImageTest, SourceAHBTarget2DRecreateFromRing)
+{
+    ANGLE_SKIP_TEST_IF(!IsAndroid());
+
+    EGLWindow *window = getEGLWindow();
+
+    ANGLE_SKIP_TEST_IF(!hasOESExt() || !hasBaseExt() || !has2DTextureExt());
+    ANGLE_SKIP_TEST_IF(!hasAndroidImageNativeBufferExt() || !hasAndroidHardwareBufferSupport());
+
+    constexpr size_t kRingSize       = 3;
+    constexpr size_t kFrameCount     = 10;
+    GLubyte initialData[4]           = {0, 0, 0, 255};
+    AHardwareBuffer *ring[kRingSize] = {};
+    for (AHardwareBuffer *&buffer : ring)
+    {
+        buffer = createAndroidHardwareBuffer(1, 1, 1, AHARDWAREBUFFER_FORMAT_R8G8B8A8_UNORM,
+                                             kDefaultAHBUsage, {{initialData, 4}});
+        ASSERT_NE(buffer, nullptr);
+    }
+
+    for (size_t frame = 0; frame < kFrameCount; ++frame)
+    {
+        AHardwareBuffer *buffer = ring[frame % kRingSize];
+
+        GLubyte data[4] = {static_cast<GLubyte>(frame * 20), 255, static_cast<GLubyte>(frame), 255};
+        writeAHBData(buffer, 1, 1, 1, false, {{data, 4}});
+
+        EGLImageKHR image = eglCreateImageKHR(
+            window->getDisplay(), EGL_NO_CONTEXT, EGL_NATIVE_BUFFER_ANDROID,
+            angle::android::AHardwareBufferToClientBuffer(buffer), kDefaultAttribs);
+        ASSERT_EGL_SUCCESS();
+
+        GLTexture target;
+        createEGLImageTargetTexture2D(image, target);
+        verifyResults2D(target, data);
+
+        eglDestroyImageKHR(window->getDisplay(), image);
+    }
+
+    for (AHardwareBuffer *buffer : ring)
+    {
+        destroyAndroidHardwareBuffer(buffer);
+    }
+}
+#endif  // defined(ANGLE_AHARDWARE_BUFFER_SUPPORT)
+
 // Testing source AHB EGL image, target 2D array texture
 TEST_P(ImageTest, SourceAHBTarget2DArray)
 {
@@ -5220,7 +5269,9 @@ TEST_P(ImageTest, DeletedImageWithSameSizeAndFormat)
     ASSERT_GL_NO_ERROR();
 }
 
-ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(ImageTest);
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(ImageTest,
+                                   ES2_VULKAN().enable(Feature::ReuseImportedExternalImages),
+                                   ES3_VULKAN().enable(Feature::ReuseImportedExternalImages));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ImageTestES3);
 ANGLE_INSTANTIATE_TEST_ES3(ImageTestES3);
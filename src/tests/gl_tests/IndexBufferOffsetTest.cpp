@@ -572,6 +572,8 @@ TEST_P(IndexBufferOffsetTest, DrawWithDifferentCountsSameOffset)
     EXPECT_GL_NO_ERROR();
 }
 
-ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(IndexBufferOffsetTest);
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
+    IndexBufferOffsetTest,
+    ES2_D3D11().disable(Feature::ConvertStaticBuffersWithComputeShaders));
 
 ANGLE_INSTANTIATE_TEST_ES3(IndexBufferOffsetTestES3);
@@ -305,6 +305,65 @@ TEST_P(LineLoopTestES3, UseAsUBOThenUpdateThenLineLoopUIntIndexBuffer)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
 }
 
+// Test that updating an index buffer between two line loop draws of the same range works.
+TEST_P(LineLoopTestES3, UpdateThenLineLoopUShortIndexBufferAgain)
+{
+    // Disable D3D11 SDK Layers warnings checks, see ANGLE issue 667 for details
+    ignoreD3D11SDKLayersWarnings();
+
+    // Primitive restart makes the whole loop's indices be generated, not only its last segment.
+    glEnable(GL_PRIMITIVE_RESTART_FIXED_INDEX);
+
+    static const GLfloat kZeroPosition[]      = {0.0f, 0.0f};
+    static const GLushort degenerateIndices[] = {0, 0, 0, 0, 0, 0};
+    static const GLushort indices[]           = {0, 7, 6, 9, 8, 0};
+
+    GLBuffer buf;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(degenerateIndices), degenerateIndices,
+                 GL_DYNAMIC_DRAW);
+
+    glUseProgram(mProgram);
+    glEnableVertexAttribArray(mPositionLocation);
+    glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, kZeroPosition);
+    glDrawElements(GL_LINE_LOOP, 4, GL_UNSIGNED_SHORT,
+                   reinterpret_cast<const void *>(sizeof(GLushort)));
+    EXPECT_GL_NO_ERROR();
+
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(indices), indices);
+
+    runTest(GL_UNSIGNED_SHORT, buf, reinterpret_cast<const void *>(sizeof(GLushort)));
+}
+
+// Test that updating an index buffer between line loop draws of the same range works when the
+// indices are copied on the GPU, and that drawing the same line loop again works.
+TEST_P(LineLoopTestES3, UpdateThenLineLoopUIntIndexBufferAgain)
+{
+    // Disable D3D11 SDK Layers warnings checks, see ANGLE issue 667 for details
+    ignoreD3D11SDKLayersWarnings();
+
+    static const GLfloat kZeroPosition[]    = {0.0f, 0.0f};
+    static const GLuint degenerateIndices[] = {0, 0, 0, 0, 0, 0};
+    static const GLuint indices[]           = {0, 7, 6, 9, 8, 0};
+
+    GLBuffer buf;
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(degenerateIndices), degenerateIndices,
+                 GL_DYNAMIC_DRAW);
+
+    glUseProgram(mProgram);
+    glEnableVertexAttribArray(mPositionLocation);
+    glVertexAttribPointer(mPositionLocation, 2, GL_FLOAT, GL_FALSE, 0, kZeroPosition);
+    glDrawElements(GL_LINE_LOOP, 4, GL_UNSIGNED_INT,
+                   reinterpret_cast<const void *>(sizeof(GLuint)));
+    EXPECT_GL_NO_ERROR();
+
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(indices), indices);
+
+    runTest(GL_UNSIGNED_INT, buf, reinterpret_cast<const void *>(sizeof(GLuint)));
+    runTest(GL_UNSIGNED_INT, buf, reinterpret_cast<const void *>(sizeof(GLuint)));
+}
+
 // Tests an edge case with a very large line loop element count.
 // Disabled because it is slow and triggers an internal error.
 TEST_P(LineLoopTest, DISABLED_DrawArraysWithLargeCount)
@@ -1993,6 +1993,59 @@ TEST_P(MipmapTestES3, BaseLevelTextureBug)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
 }
 
+// Test that changing the base and max levels of a mutable texture within its defined levels samples
+// the right levels, including a level that's modified while it's not the base level.
+TEST_P(MipmapTestES3, ChangeBaseAndMaxLevelWithinDefinedLevels)
+{
+    std::vector<GLColor> level0Data(4u * 4u, GLColor::red);
+    std::vector<GLColor> level1Data(2u * 2u, GLColor::green);
+    std::vector<GLColor> level1NewData(2u * 2u, GLColor::yellow);
+    const GLColor level2Data = GLColor::blue;
+
+    glBindTexture(GL_TEXTURE_2D, mTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 4, 4, 0, GL_RGBA, GL_UNSIGNED_BYTE, level0Data.data());
+    glTexImage2D(GL_TEXTURE_2D, 1, GL_RGBA, 2, 2, 0, GL_RGBA, GL_UNSIGNED_BYTE, level1Data.data());
+    glTexImage2D(GL_TEXTURE_2D, 2, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &level2Data);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    ASSERT_GL_NO_ERROR();
+
+    // Sample the base level only.
+    auto drawBaseLevel = [&]() {
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        drawQuad(m2DProgram, "position", 0.5f);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+    };
+
+    // Draw once with the full mip chain so that the image is created with all the levels.
+    clearAndDrawQuad(m2DProgram, 4, 4);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 1);
+    drawBaseLevel();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 2);
+    drawBaseLevel();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+
+    // Modify level 1 while it's out of the range of levels.
+    glTexSubImage2D(GL_TEXTURE_2D, 1, 0, 0, 2, 2, GL_RGBA, GL_UNSIGNED_BYTE, level1NewData.data());
+    drawBaseLevel();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 1);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 1);
+    drawBaseLevel();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::yellow);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 1000);
+    drawBaseLevel();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    ASSERT_GL_NO_ERROR();
+}
+
 TEST_P(MipmapTestES31, MipmapWithMemoryBarrier)
 {
     std::vector<GLColor> pixelsRed(getWindowWidth() * getWindowHeight(), GLColor::red);
@@ -536,6 +536,64 @@ void main()
         mColorLoc    = glGetAttribLocation(mProgram, "aColor");
     }
 
+    // Sets up the buffers, program and vertex format of the glMultiDrawElementsIndirectEXT tests,
+    // which draw four triangles that cover the corners of the framebuffer with one indirect command
+    // each.  |indexType| is the type of the indices, GL_UNSIGNED_INT or GL_UNSIGNED_BYTE.  A vertex
+    // array must be bound.
+    void SetupElementsIndirectTriangles(GLenum indexType)
+    {
+        const std::vector<GLfloat> vertices = {
+            -1, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0,
+        };
+        const std::vector<GLuint> indices = {
+            1, 2, 3, 3, 4, 5, 5, 6, 7, 7, 0, 1,
+        };
+
+        // Set up the vertex and index buffers
+        glGenBuffers(1, &mVertexBuffer);
+        glBindBuffer(GL_ARRAY_BUFFER, mVertexBuffer);
+        glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * vertices.size(), vertices.data(),
+                     GL_STATIC_DRAW);
+
+        glGenBuffers(1, &mIndexBuffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
+        if (indexType == GL_UNSIGNED_BYTE)
+        {
+            const std::vector<GLubyte> byteIndices(indices.begin(), indices.end());
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLubyte) * byteIndices.size(),
+                         byteIndices.data(), GL_STATIC_DRAW);
+        }
+        else
+        {
+            ASSERT_GLENUM_EQ(GL_UNSIGNED_INT, indexType);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * indices.size(), indices.data(),
+                         GL_STATIC_DRAW);
+        }
+        EXPECT_GL_NO_ERROR();
+
+        // Generate program
+        SetupProgramIndirect(false);
+
+        // Set up the vertex array format
+        glEnableVertexAttribArray(mPositionLoc);
+        glVertexAttribPointer(mPositionLoc, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+        EXPECT_GL_NO_ERROR();
+
+        // Set up the indirect data array
+        std::array<DrawElementsIndirectCommand, kIndirectTriangleCount> indirectData;
+        for (auto i = 0; i < kIndirectTriangleCount; i++)
+        {
+            indirectData[i] = DrawElementsIndirectCommand(3, 1, 3 * i, 0, i);
+        }
+
+        glGenBuffers(1, &mIndirectBuffer);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mIndirectBuffer);
+        glBufferData(GL_DRAW_INDIRECT_BUFFER,
+                     sizeof(DrawElementsIndirectCommand) * indirectData.size(),
+                     indirectData.data(), GL_STATIC_DRAW);
+        EXPECT_GL_NO_ERROR();
+    }
+
     void TearDown() override
     {
         if (mVertexBuffer != 0u)
@@ -561,6 +619,8 @@ void main()
         ANGLETestBase::ANGLETestTearDown();
     }
 
+    static constexpr GLsizei kIndirectTriangleCount = 4;
+
     GLint mPositionLoc;
     GLint mColorLoc;
     GLuint mVertexBuffer;
@@ -708,21 +768,18 @@ TEST_P(MultiDrawIndirectTest, MultiDrawArraysIndirect)
     EXPECT_PIXEL_COLOR_EQ(kWidth / 2, kHeight / 2, GLColor::transparentBlack);
 }
 
-// Tests basic functionality of glMultiDrawElementsIndirectEXT
-TEST_P(MultiDrawIndirectTest, MultiDrawElementsIndirect)
+// Tests that an instanced multi-draw, which may be issued as an indirect draw, doesn't affect the
+// draw indirect buffer binding of the following indirect draws.
+TEST_P(MultiDrawIndirectTest, MultiDrawArraysInstancedThenDrawArraysIndirect)
 {
-    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_EXT_multi_draw_indirect"));
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_ANGLE_multi_draw"));
 
-    // Set up the vertex array
     const GLint triangleCount           = 4;
     const std::vector<GLfloat> vertices = {
-        -1, 1, 0, 0, 1, 0, 1, 1, 0, 1, 0, 0, 1, -1, 0, 0, -1, 0, -1, -1, 0, -1, 0, 0,
-    };
-    const std::vector<GLuint> indices = {
-        1, 2, 3, 3, 4, 5, 5, 6, 7, 7, 0, 1,
+        -1, 1,  0, -1, 0, 0, 0, 1,  0, 1, 1,  0, 1, 0,  0, 0, 1, 0,
+        -1, -1, 0, -1, 0, 0, 0, -1, 0, 1, -1, 0, 0, -1, 0, 1, 0, 0,
     };
 
-    // Set up the vertex and index buffers
     GLVertexArray vao;
     glBindVertexArray(vao);
 
@@ -731,34 +788,49 @@ TEST_P(MultiDrawIndirectTest, MultiDrawElementsIndirect)
     glBufferData(GL_ARRAY_BUFFER, sizeof(GLfloat) * vertices.size(), vertices.data(),
                  GL_STATIC_DRAW);
 
-    glGenBuffers(1, &mIndexBuffer);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, mIndexBuffer);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(GLuint) * indices.size(), indices.data(),
-                 GL_STATIC_DRAW);
-    EXPECT_GL_NO_ERROR();
-
-    // Generate program
     SetupProgramIndirect(false);
 
-    // Set up the vertex array format
     glEnableVertexAttribArray(mPositionLoc);
     glVertexAttribPointer(mPositionLoc, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-    EXPECT_GL_NO_ERROR();
-
-    // Set up the indirect data array
-    std::array<DrawElementsIndirectCommand, triangleCount> indirectData;
-    const GLsizei icSize = sizeof(DrawElementsIndirectCommand);
-    for (auto i = 0; i < triangleCount; i++)
-    {
-        indirectData[i] = DrawElementsIndirectCommand(3, 1, 3 * i, 0, i);
-    }
 
+    // The indirect buffer draws the first triangle.
+    const DrawArraysIndirectCommand indirectData(3, 1, 0, 0);
     glGenBuffers(1, &mIndirectBuffer);
     glBindBuffer(GL_DRAW_INDIRECT_BUFFER, mIndirectBuffer);
-    glBufferData(GL_DRAW_INDIRECT_BUFFER, icSize * indirectData.size(), indirectData.data(),
-                 GL_STATIC_DRAW);
+    glBufferData(GL_DRAW_INDIRECT_BUFFER, sizeof(indirectData), &indirectData, GL_STATIC_DRAW);
+    EXPECT_GL_NO_ERROR();
+
+    // The multi-draw draws the other triangles.
+    const std::array<GLint, triangleCount - 1> firsts           = {3, 6, 9};
+    const std::array<GLsizei, triangleCount - 1> counts         = {3, 3, 3};
+    const std::array<GLsizei, triangleCount - 1> instanceCounts = {1, 1, 1};
+
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glMultiDrawArraysInstancedANGLE(GL_TRIANGLES, firsts.data(), counts.data(),
+                                    instanceCounts.data(), triangleCount - 1);
+    glDrawArraysIndirect(GL_TRIANGLES, nullptr);
     EXPECT_GL_NO_ERROR();
 
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::magenta);
+    EXPECT_PIXEL_COLOR_EQ(0, kHeight - 1, GLColor::magenta);
+    EXPECT_PIXEL_COLOR_EQ(kWidth - 1, 0, GLColor::magenta);
+    EXPECT_PIXEL_COLOR_EQ(kWidth - 1, kHeight - 1, GLColor::magenta);
+    EXPECT_PIXEL_COLOR_EQ(kWidth / 2, kHeight / 2, GLColor::transparentBlack);
+}
+
+// Tests basic functionality of glMultiDrawElementsIndirectEXT
+TEST_P(MultiDrawIndirectTest, MultiDrawElementsIndirect)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_EXT_multi_draw_indirect"));
+
+    const GLint triangleCount = kIndirectTriangleCount;
+    const GLsizei icSize      = sizeof(DrawElementsIndirectCommand);
+
+    // Set up the vertex array
+    GLVertexArray vao;
+    glBindVertexArray(vao);
+    SetupElementsIndirectTriangles(GL_UNSIGNED_INT);
+
     // Invalid value check for drawcount and stride
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     glMultiDrawElementsIndirectEXT(GL_TRIANGLES, GL_UNSIGNED_INT, nullptr, 0, 0);
@@ -886,6 +958,29 @@ TEST_P(MultiDrawIndirectTest, MultiDrawElementsIndirectMultipleTriangles)
     EXPECT_PIXEL_COLOR_EQ(kWidth / 2, kHeight / 2, GLColor::transparentBlack);
 }
 
+// Tests glMultiDrawElementsIndirectEXT with multiple draws and unsigned byte indices, which some
+// backends have to convert for every draw.
+TEST_P(MultiDrawIndirectTest, MultiDrawElementsIndirectUnsignedByteIndices)
+{
+    ANGLE_SKIP_TEST_IF(!EnsureGLExtensionEnabled("GL_EXT_multi_draw_indirect"));
+
+    GLVertexArray vao;
+    glBindVertexArray(vao);
+    SetupElementsIndirectTriangles(GL_UNSIGNED_BYTE);
+
+    // Draw all triangles using glMultiDrawElementsIndirect
+    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+    glMultiDrawElementsIndirectEXT(GL_TRIANGLES, GL_UNSIGNED_BYTE, nullptr, kIndirectTriangleCount,
+                                   0);
+    EXPECT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::magenta);
+    EXPECT_PIXEL_COLOR_EQ(0, kHeight - 1, GLColor::magenta);
+    EXPECT_PIXEL_COLOR_EQ(kWidth - 1, 0, GLColor::magenta);
+    EXPECT_PIXEL_COLOR_EQ(kWidth - 1, kHeight - 1, GLColor::magenta);
+    EXPECT_PIXEL_COLOR_EQ(kWidth / 2, kHeight / 2, GLColor::transparentBlack);
+}
+
 // Tests glMultiDrawElementsIndirectEXT with glMultiDrawElementsANGLE to see if the index buffer
 // offset is being reset.
 TEST_P(MultiDrawIndirectTest, MultiDrawElementsIndirectCheckBufferOffset)
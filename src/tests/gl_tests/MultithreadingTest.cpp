@@ -897,6 +897,359 @@ TEST_P(MultithreadingTest, CreateFenceThreadAClientWaitSyncThreadBDelayedFlush)
     ASSERT_NE(currentStep, Step::Abort);
 }
 
+// Test that a sync object created inside a render pass can be waited on by another context of the
+// share group, both on the client and the server.
+TEST_P(MultithreadingTestES3, FenceSyncInRenderPassWaitedOnByOtherContext)
+{
+    ANGLE_SKIP_TEST_IF(!platformSupportsMultithreading());
+
+    EGLWindow *window = getEGLWindow();
+    EGLDisplay dpy    = window->getDisplay();
+    EGLConfig config  = window->getConfig();
+
+    constexpr EGLint kPBufferSize = 256;
+    EGLint pbufferAttributes[]    = {
+        EGL_WIDTH, kPBufferSize, EGL_HEIGHT, kPBufferSize, EGL_NONE, EGL_NONE,
+    };
+
+    EGLSurface surfaces[2];
+    for (EGLSurface &surface : surfaces)
+    {
+        surface = eglCreatePbufferSurface(dpy, config, pbufferAttributes);
+        EXPECT_EGL_SUCCESS();
+    }
+    EGLContext producerContext = createMultithreadedContext(window, EGL_NO_CONTEXT);
+    EXPECT_NE(EGL_NO_CONTEXT, producerContext);
+    EGLContext consumerContext = createMultithreadedContext(window, producerContext);
+    EXPECT_NE(EGL_NO_CONTEXT, consumerContext);
+
+    GLuint texture = 0;
+    GLsync sync    = nullptr;
+
+    // Synchronization tools to ensure the two threads are interleaved as designed by this test.
+    std::mutex mutex;
+    std::condition_variable condVar;
+
+    enum class Step
+    {
+        Start,
+        Thread0CreateFence,
+        Finish,
+        Abort,
+    };
+    Step currentStep = Step::Start;
+
+    std::thread thread0 = std::thread([&]() {
+        ThreadSynchronization<Step> threadSynchronization(&currentStep, &mutex, &condVar);
+
+        ASSERT_TRUE(threadSynchronization.waitForStep(Step::Start));
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, surfaces[0], surfaces[0], producerContext));
+
+        glGenTextures(1, &texture);
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, 1, 1);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+        GLFramebuffer framebuffer;
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, texture, 0);
+        ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+        // Create the sync object while the render pass is open, and flush as required for other
+        // contexts to wait on it.
+        ANGLE_GL_PROGRAM(greenProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+        drawQuad(greenProgram, essl1_shaders::PositionAttrib(), 0.5f);
+        sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        glFlush();
+        ASSERT_GL_NO_ERROR();
+
+        threadSynchronization.nextStep(Step::Thread0CreateFence);
+        ASSERT_TRUE(threadSynchronization.waitForStep(Step::Finish));
+
+        glDeleteTextures(1, &texture);
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+    });
+
+    std::thread thread1 = std::thread([&]() {
+        ThreadSynchronization<Step> threadSynchronization(&currentStep, &mutex, &condVar);
+
+        ASSERT_TRUE(threadSynchronization.waitForStep(Step::Thread0CreateFence));
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, surfaces[1], surfaces[1], consumerContext));
+
+        // The draw must be ordered after the producer's draw.
+        glWaitSync(sync, 0, GL_TIMEOUT_IGNORED);
+        ASSERT_GL_NO_ERROR();
+
+        ANGLE_GL_PROGRAM(textureProgram, essl1_shaders::vs::Texture2D(),
+                         essl1_shaders::fs::Texture2D());
+        glBindTexture(GL_TEXTURE_2D, texture);
+        drawQuad(textureProgram, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+        // The producer's commands are submitted, so the wait must finish.
+        GLenum result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        EXPECT_TRUE(result == GL_CONDITION_SATISFIED || result == GL_ALREADY_SIGNALED);
+        glDeleteSync(sync);
+        ASSERT_GL_NO_ERROR();
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+
+        threadSynchronization.nextStep(Step::Finish);
+    });
+
+    thread0.join();
+    thread1.join();
+
+    // Clean up
+    for (EGLSurface surface : surfaces)
+    {
+        eglDestroySurface(dpy, surface);
+    }
+    eglDestroyContext(dpy, consumerContext);
+    eglDestroyContext(dpy, producerContext);
+
+    ASSERT_NE(currentStep, Step::Abort);
+}
+
+// Test that contexts of different share groups can use an EGLImage at the same time, one updating
+// the image through its source texture and the other drawing with it.
+TEST_P(MultithreadingTest, EGLImageAcrossShareGroups)
+{
+    ANGLE_SKIP_TEST_IF(!platformSupportsMultithreading());
+
+    EGLWindow *window = getEGLWindow();
+    EGLDisplay dpy    = window->getDisplay();
+    EGLConfig config  = window->getConfig();
+    ANGLE_SKIP_TEST_IF(!IsEGLDisplayExtensionEnabled(dpy, "EGL_KHR_image_base") ||
+                       !IsEGLDisplayExtensionEnabled(dpy, "EGL_KHR_gl_texture_2D_image") ||
+                       !IsGLExtensionEnabled("GL_OES_EGL_image"));
+
+    constexpr EGLint kPBufferSize = 256;
+    EGLint pbufferAttributes[]    = {
+        EGL_WIDTH, kPBufferSize, EGL_HEIGHT, kPBufferSize, EGL_NONE, EGL_NONE,
+    };
+
+    // Create a share group of two contexts for each thread, so that the contexts the threads use
+    // are shared.
+    EGLSurface surfaces[2];
+    EGLContext contexts[2];
+    EGLContext shareContexts[2];
+    for (size_t index = 0; index < 2; ++index)
+    {
+        surfaces[index] = eglCreatePbufferSurface(dpy, config, pbufferAttributes);
+        EXPECT_EGL_SUCCESS();
+        contexts[index] = window->createContext(EGL_NO_CONTEXT, nullptr);
+        EXPECT_NE(EGL_NO_CONTEXT, contexts[index]);
+        shareContexts[index] = window->createContext(contexts[index], nullptr);
+        EXPECT_NE(EGL_NO_CONTEXT, shareContexts[index]);
+    }
+
+    EGLImageKHR image = EGL_NO_IMAGE_KHR;
+
+    // Synchronization tools to ensure the two threads are interleaved as designed by this test.
+    std::mutex mutex;
+    std::condition_variable condVar;
+
+    enum class Step
+    {
+        Start,
+        Thread0CreateImage,
+        Thread1BindImage,
+        Thread0UploadGreen,
+        Finish,
+        Abort,
+    };
+    Step currentStep = Step::Start;
+
+    constexpr size_t kIterations = 100;
+
+    std::thread thread0 = std::thread([&]() {
+        ThreadSynchronization<Step> threadSynchronization(&currentStep, &mutex, &condVar);
+
+        ASSERT_TRUE(threadSynchronization.waitForStep(Step::Start));
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, surfaces[0], surfaces[0], contexts[0]));
+
+        GLTexture source;
+        glBindTexture(GL_TEXTURE_2D, source);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     &GLColor::red);
+        ASSERT_GL_NO_ERROR();
+
+        image = eglCreateImageKHR(dpy, contexts[0], EGL_GL_TEXTURE_2D_KHR,
+                                  reinterpret_cast<EGLClientBuffer>(static_cast<uintptr_t>(source)),
+                                  nullptr);
+        ASSERT_EGL_SUCCESS();
+        ASSERT_NE(EGL_NO_IMAGE_KHR, image);
+
+        threadSynchronization.nextStep(Step::Thread0CreateImage);
+        ASSERT_TRUE(threadSynchronization.waitForStep(Step::Thread1BindImage));
+
+        // Update the image while the other thread draws with it.
+        for (size_t iteration = 0; iteration < kIterations; ++iteration)
+        {
+            const GLColor &color = iteration % 2 == 0 ? GLColor::blue : GLColor::red;
+            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &color);
+        }
+
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::green);
+        glFinish();
+        ASSERT_GL_NO_ERROR();
+
+        threadSynchronization.nextStep(Step::Thread0UploadGreen);
+        ASSERT_TRUE(threadSynchronization.waitForStep(Step::Finish));
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+    });
+
+    std::thread thread1 = std::thread([&]() {
+        ThreadSynchronization<Step> threadSynchronization(&currentStep, &mutex, &condVar);
+
+        ASSERT_TRUE(threadSynchronization.waitForStep(Step::Thread0CreateImage));
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, surfaces[1], surfaces[1], contexts[1]));
+
+        GLTexture target;
+        glBindTexture(GL_TEXTURE_2D, target);
+        glEGLImageTargetTexture2DOES(GL_TEXTURE_2D, image);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        ASSERT_GL_NO_ERROR();
+
+        ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+
+        threadSynchronization.nextStep(Step::Thread1BindImage);
+
+        for (size_t iteration = 0; iteration < kIterations; ++iteration)
+        {
+            drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        }
+        ASSERT_GL_NO_ERROR();
+
+        ASSERT_TRUE(threadSynchronization.waitForStep(Step::Thread0UploadGreen));
+
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+
+        threadSynchronization.nextStep(Step::Finish);
+    });
+
+    thread0.join();
+    thread1.join();
+
+    // Clean up
+    if (image != EGL_NO_IMAGE_KHR)
+    {
+        eglDestroyImageKHR(dpy, image);
+    }
+    for (size_t index = 0; index < 2; ++index)
+    {
+        eglDestroySurface(dpy, surfaces[index]);
+        eglDestroyContext(dpy, shareContexts[index]);
+        eglDestroyContext(dpy, contexts[index]);
+    }
+
+    ASSERT_NE(currentStep, Step::Abort);
+}
+
+struct DebugCallbackReentryState
+{
+    EGLContext context;
+    size_t callbackCount;
+};
+
+static void GL_APIENTRY DebugCallbackReentersGLAndEGL(GLenum source,
+                                                      GLenum type,
+                                                      GLuint id,
+                                                      GLenum severity,
+                                                      GLsizei length,
+                                                      const GLchar *message,
+                                                      const void *userParam)
+{
+    DebugCallbackReentryState *state =
+        static_cast<DebugCallbackReentryState *>(const_cast<void *>(userParam));
+
+    // Make a GL call and an EGL call from inside the GL call that generated the message.
+    GLint maxTextureSize = 0;
+    glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize);
+    EXPECT_GT(maxTextureSize, 0);
+    EXPECT_EQ(state->context, eglGetCurrentContext());
+
+    ++state->callbackCount;
+}
+
+// Test that a debug message callback of a shared context can make GL and EGL calls while another
+// thread makes EGL calls.
+TEST_P(MultithreadingTest, DebugCallbackReentry)
+{
+    ANGLE_SKIP_TEST_IF(!platformSupportsMultithreading());
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_KHR_debug"));
+
+    EGLWindow *window = getEGLWindow();
+    EGLDisplay dpy    = window->getDisplay();
+    EGLConfig config  = window->getConfig();
+
+    constexpr EGLint kPBufferSize = 256;
+    EGLint pbufferAttributes[]    = {
+        EGL_WIDTH, kPBufferSize, EGL_HEIGHT, kPBufferSize, EGL_NONE, EGL_NONE,
+    };
+
+    // The context is shared, so that its entry points lock its share group.
+    EGLSurface surface = eglCreatePbufferSurface(dpy, config, pbufferAttributes);
+    EXPECT_EGL_SUCCESS();
+    EGLContext context = window->createContext(EGL_NO_CONTEXT, nullptr);
+    EXPECT_NE(EGL_NO_CONTEXT, context);
+    EGLContext shareContext = window->createContext(context, nullptr);
+    EXPECT_NE(EGL_NO_CONTEXT, shareContext);
+
+    constexpr size_t kIterations = 1000;
+    std::atomic<bool> debugCallbackThreadDone(false);
+    DebugCallbackReentryState state = {context, 0};
+
+    std::thread debugCallbackThread = std::thread([&]() {
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, surface, surface, context));
+
+        glEnable(GL_DEBUG_OUTPUT);
+        glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+        glDebugMessageCallbackKHR(DebugCallbackReentersGLAndEGL, &state);
+
+        for (size_t iteration = 0; iteration < kIterations; ++iteration)
+        {
+            glDebugMessageInsertKHR(GL_DEBUG_SOURCE_APPLICATION, GL_DEBUG_TYPE_OTHER, 1,
+                                    GL_DEBUG_SEVERITY_NOTIFICATION, -1, "reentry");
+        }
+
+        glDebugMessageCallbackKHR(nullptr, nullptr);
+        EXPECT_GL_NO_ERROR();
+
+        EXPECT_EGL_TRUE(eglMakeCurrent(dpy, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+        debugCallbackThreadDone = true;
+    });
+
+    // Keep EGL calls that lock the global mutex exclusively waiting while the callbacks run.
+    std::thread eglThread = std::thread([&]() {
+        while (!debugCallbackThreadDone)
+        {
+            EGLint configID = 0;
+            EXPECT_EGL_TRUE(eglQueryContext(dpy, shareContext, EGL_CONFIG_ID, &configID));
+        }
+    });
+
+    debugCallbackThread.join();
+    eglThread.join();
+
+    EXPECT_EQ(kIterations, state.callbackCount);
+
+    eglDestroySurface(dpy, surface);
+    eglDestroyContext(dpy, shareContext);
+    eglDestroyContext(dpy, context);
+}
+
 // TODO(geofflang): Test sharing a program between multiple shared contexts on multiple threads
 
 ANGLE_INSTANTIATE_TEST(MultithreadingTest,
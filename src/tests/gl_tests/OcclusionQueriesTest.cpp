@@ -910,7 +910,9 @@ TEST_P(OcclusionQueriesNoSurfaceTestES3, SwitchingContextsWithQuery)
     }
 }
 
-ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(OcclusionQueriesTest);
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
+    OcclusionQueriesTest,
+    ES2_D3D11().enable(Feature::RecordCommandsInDeferredContext));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(OcclusionQueriesTestES3);
 ANGLE_INSTANTIATE_TEST_ES3(OcclusionQueriesTestES3);
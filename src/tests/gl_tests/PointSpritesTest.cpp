@@ -391,6 +391,33 @@ void main(void)
     EXPECT_PIXEL_EQ(getWindowWidth() / 2, getWindowHeight() / 2, 255, 0, 0, 255);
 }
 
+// Verify that a large gl_PointSize doesn't move the vertices of non-point draws, which the emulated
+// point sprites expand into quads.
+TEST_P(PointSpritesTest, LargePointSizeWithTriangles)
+{
+    constexpr char kVS[] = R"(attribute highp vec4 position;
+void main(void)
+{
+    gl_PointSize = 16.0;
+    gl_Position  = position;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, essl1_shaders::fs::Red());
+    ASSERT_GL_NO_ERROR();
+
+    glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    drawQuad(program, "position", 0.5f, 1.0f);
+    ASSERT_GL_NO_ERROR();
+
+    // The quad covers the whole window, up to its corners.
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(0, getWindowHeight() - 1, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, getWindowHeight() - 1, GLColor::red);
+}
+
 // Test to cover a bug where the D3D11 rasterizer state would not be update when switching between
 // draw types.  This causes the cull face to potentially be incorrect when drawing emulated point
 // spites.
@@ -528,8 +555,10 @@ TEST_P(PointSpritesTest, PointSizeAboveMaxIsClamped)
 //
 // We test on D3D11 9_3 because the existing D3D11 PointSprite implementation
 // uses Geometry Shaders which are not supported for 9_3.
-// D3D9 and D3D11 are also tested to ensure no regressions.
+// D3D9 and D3D11 are also tested to ensure no regressions. The D3D11 point sprites expanded from
+// the vertex ID don't use geometry shaders either.
 ANGLE_INSTANTIATE_TEST_ES2_AND(PointSpritesTest,
                                ES2_VULKAN().enable(Feature::EmulatedPrerotation90),
                                ES2_VULKAN().enable(Feature::EmulatedPrerotation180),
-                               ES2_VULKAN().enable(Feature::EmulatedPrerotation270));
+                               ES2_VULKAN().enable(Feature::EmulatedPrerotation270),
+                               ES2_D3D11().enable(Feature::ExpandPointSpritesWithVertexId));
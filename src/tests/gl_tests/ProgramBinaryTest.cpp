@@ -272,6 +272,31 @@ TEST_P(ProgramBinaryTest, ZeroSizedUnlinkedBinary)
     ASSERT_EQ(0, length);
 }
 
+// Tests that programs whose shaders only differ in comments, and so translate to the same
+// shaders, can be linked and used one after the other.
+TEST_P(ProgramBinaryTest, RelinkIdenticalTranslatedShaders)
+{
+    const std::string fragmentShader = essl1_shaders::fs::UniformColor();
+    const std::string commentedFragmentShader =
+        "// Comments are stripped by the translator.\n" + fragmentShader;
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), fragmentShader.c_str());
+    ANGLE_GL_PROGRAM(relinkedProgram, essl1_shaders::vs::Simple(),
+                     commentedFragmentShader.c_str());
+
+    glUseProgram(program);
+    glUniform4f(glGetUniformLocation(program, essl1_shaders::ColorUniform()), 1, 0, 0, 1);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    glUseProgram(relinkedProgram);
+    glUniform4f(glGetUniformLocation(relinkedProgram, essl1_shaders::ColorUniform()), 0, 1, 0,
+                1);
+    drawQuad(relinkedProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    ASSERT_GL_NO_ERROR();
+}
+
 // Use this to select which configurations (e.g. which renderer, which GLES major version) these
 // tests should be run against.
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(ProgramBinaryTest);
@@ -1236,6 +1261,81 @@ TEST_P(ProgramBinaryES31Test, ImageTextureBinding)
     ASSERT_GL_NO_ERROR();
 }
 
+// Tests that the buffer variables of a program loaded from a binary can be queried.
+TEST_P(ProgramBinaryES31Test, BufferVariableQueries)
+{
+    ANGLE_SKIP_TEST_IF(getAvailableProgramBinaryFormatCount() == 0);
+
+    const char kComputeShader[] =
+        R"(#version 310 es
+        layout(local_size_x=1, local_size_y=1, local_size_z=1) in;
+        layout(std430, binding = 0) buffer Output
+        {
+            uint first;
+            uvec4 second[2];
+        };
+        void main()
+        {
+            first = 1u;
+            second[1] = uvec4(2u);
+        })";
+
+    ANGLE_GL_COMPUTE_PROGRAM(program, kComputeShader);
+
+    GLint bufferVariableCount = 0;
+    glGetProgramInterfaceiv(program, GL_BUFFER_VARIABLE, GL_ACTIVE_RESOURCES,
+                            &bufferVariableCount);
+    ASSERT_GL_NO_ERROR();
+    ASSERT_EQ(2, bufferVariableCount);
+
+    // Read back the binary.
+    GLint programLength = 0;
+    glGetProgramiv(program.get(), GL_PROGRAM_BINARY_LENGTH, &programLength);
+    ASSERT_GL_NO_ERROR();
+
+    GLsizei readLength  = 0;
+    GLenum binaryFormat = GL_NONE;
+    std::vector<uint8_t> binary(programLength);
+    glGetProgramBinary(program.get(), programLength, &readLength, &binaryFormat, binary.data());
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(static_cast<GLsizei>(programLength), readLength);
+
+    // Load a new program with the binary.
+    ANGLE_GL_BINARY_ES3_PROGRAM(binaryProgram, binary, binaryFormat);
+    ASSERT_GL_NO_ERROR();
+
+    // Dispatch before querying the buffer variables, which are not needed to use the program.
+    GLBuffer buffer;
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, 48, nullptr, GL_STATIC_DRAW);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, buffer);
+
+    glUseProgram(binaryProgram);
+    glDispatchCompute(1, 1, 1);
+    ASSERT_GL_NO_ERROR();
+
+    glGetProgramInterfaceiv(binaryProgram, GL_BUFFER_VARIABLE, GL_ACTIVE_RESOURCES,
+                            &bufferVariableCount);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_EQ(2, bufferVariableCount);
+
+    GLuint index = glGetProgramResourceIndex(binaryProgram, GL_BUFFER_VARIABLE, "second[0]");
+    ASSERT_GL_NO_ERROR();
+    ASSERT_NE(GL_INVALID_INDEX, index);
+
+    constexpr GLenum kProps[] = {GL_TYPE, GL_ARRAY_SIZE, GL_OFFSET};
+    GLint params[ArraySize(kProps)];
+    GLsizei length = 0;
+    glGetProgramResourceiv(binaryProgram, GL_BUFFER_VARIABLE, index, ArraySize(kProps), kProps,
+                           ArraySize(params), &length, params);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_EQ(static_cast<GLsizei>(ArraySize(kProps)), length);
+    EXPECT_GLENUM_EQ(GL_UNSIGNED_INT_VEC4, params[0]);
+    EXPECT_EQ(2, params[1]);
+    EXPECT_EQ(16, params[2]);
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(ProgramBinaryES31Test);
 ANGLE_INSTANTIATE_TEST_ES31_AND(ProgramBinaryES31Test,
                                 ES31_VULKAN().enable(Feature::CreatePipelineDuringLink));
@@ -346,6 +346,40 @@ TEST_P(ReadPixelsPBOTest, Basic)
     EXPECT_GL_NO_ERROR();
 }
 
+// Test that the rows read from the default framebuffer into a PBO are in the right order.
+TEST_P(ReadPixelsPBOTest, DefaultFramebufferRowOrder)
+{
+    const GLsizei width  = getWindowWidth();
+    const GLsizei height = getWindowHeight();
+
+    glClearColor(1.0f, 0.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Make the top half green.
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, height / 2, width, height - height / 2);
+    glClearColor(0.0f, 1.0f, 0.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glDisable(GL_SCISSOR_TEST);
+    EXPECT_GL_NO_ERROR();
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, mPBO);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+
+    void *mappedPtr =
+        glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, 4 * width * height, GL_MAP_READ_BIT);
+    GLColor *dataColor = static_cast<GLColor *>(mappedPtr);
+    EXPECT_GL_NO_ERROR();
+
+    EXPECT_EQ(GLColor::red, dataColor[0]);
+    EXPECT_EQ(GLColor::red, dataColor[width - 1]);
+    EXPECT_EQ(GLColor::green, dataColor[(height - 1) * width]);
+    EXPECT_EQ(GLColor::green, dataColor[height * width - 1]);
+
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    EXPECT_GL_NO_ERROR();
+}
+
 // Test an error is generated when the PBO is too small.
 TEST_P(ReadPixelsPBOTest, PBOTooSmall)
 {
@@ -434,6 +468,42 @@ TEST_P(ReadPixelsPBOTest, ExistingDataPreserved)
     EXPECT_GL_NO_ERROR();
 }
 
+// Test that many readbacks to a PBO before it's read land in the order they were made.
+TEST_P(ReadPixelsPBOTest, ManyReadbacksBeforeMap)
+{
+    const GLColor kColors[] = {GLColor::red,  GLColor::green,   GLColor::blue,
+                               GLColor::cyan, GLColor::magenta, GLColor::yellow};
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, mPBO);
+    for (size_t colorIndex = 0; colorIndex < ArraySize(kColors); ++colorIndex)
+    {
+        const GLColor &color = kColors[colorIndex];
+        glClearColor(color.R / 255.0f, color.G / 255.0f, color.B / 255.0f, color.A / 255.0f);
+        glClear(GL_COLOR_BUFFER_BIT);
+        glReadPixels(0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE,
+                     reinterpret_cast<void *>(colorIndex * sizeof(GLColor)));
+    }
+
+    // The last readback overwrites the first one.
+    glClearColor(1.0f, 1.0f, 1.0f, 1.0f);
+    glClear(GL_COLOR_BUFFER_BIT);
+    glReadPixels(0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    EXPECT_GL_NO_ERROR();
+
+    void *mappedPtr    = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, 32, GL_MAP_READ_BIT);
+    GLColor *dataColor = static_cast<GLColor *>(mappedPtr);
+    EXPECT_GL_NO_ERROR();
+
+    EXPECT_EQ(GLColor::white, dataColor[0]);
+    for (size_t colorIndex = 1; colorIndex < ArraySize(kColors); ++colorIndex)
+    {
+        EXPECT_EQ(kColors[colorIndex], dataColor[colorIndex]);
+    }
+
+    glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+    EXPECT_GL_NO_ERROR();
+}
+
 // Test that calling SubData preserves PBO data.
 TEST_P(ReadPixelsPBOTest, SubDataPreservesContents)
 {
@@ -1356,7 +1356,11 @@ ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
     SimpleOperationTest,
     ES3_METAL().enable(Feature::ForceBufferGPUStorage),
     ES3_METAL().disable(Feature::HasExplicitMemBarrier).disable(Feature::HasCheapRenderPass),
-    ES2_VULKAN().disable(Feature::SupportsNegativeViewport));
+    ES2_VULKAN().disable(Feature::SupportsNegativeViewport),
+    ES2_VULKAN().enable(Feature::AsyncPresent),
+    ES3_VULKAN().enable(Feature::AsyncPresent).enable(Feature::AsyncCommandQueue),
+    ES2_D3D11().enable(Feature::RecordCommandsInDeferredContext),
+    ES3_D3D11().enable(Feature::RecordCommandsInDeferredContext));
 
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
     TriangleFanDrawTest,
@@ -9626,6 +9626,78 @@ TEST_P(StateChangeTestES3, PrimitiveRestart)
 
     ASSERT_GL_NO_ERROR();
 }
+
+// Tests that state is correct throughout a render pass with many draw calls, which may be split
+// and replayed in parallel.
+TEST_P(StateChangeTestES3, ManyDrawsInRenderPass)
+{
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::UniformColor());
+    glUseProgram(program);
+
+    GLint colorLoc = glGetUniformLocation(program, angle::essl1_shaders::ColorUniform());
+    ASSERT_NE(colorLoc, -1);
+
+    constexpr GLsizei kSize = 64;
+    ASSERT_GE(getWindowWidth(), kSize);
+    ASSERT_GE(getWindowHeight(), kSize);
+
+    glClearColor(0, 0, 0, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+
+    // Draw every pixel separately, with the scissor and color changing on every draw call.
+    glEnable(GL_SCISSOR_TEST);
+    for (GLint y = 0; y < kSize; ++y)
+    {
+        for (GLint x = 0; x < kSize; ++x)
+        {
+            const bool isGreen = (x + y) % 2 == 0;
+            glScissor(x, y, 1, 1);
+            glUniform4f(colorLoc, 0, isGreen ? 1 : 0, isGreen ? 0 : 1, 1);
+            drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        }
+    }
+    glDisable(GL_SCISSOR_TEST);
+
+    std::vector<GLColor> pixels(kSize * kSize);
+    glReadPixels(0, 0, kSize, kSize, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+    ASSERT_GL_NO_ERROR();
+
+    for (GLint y = 0; y < kSize; ++y)
+    {
+        for (GLint x = 0; x < kSize; ++x)
+        {
+            const GLColor expect = (x + y) % 2 == 0 ? GLColor::green : GLColor::blue;
+            EXPECT_EQ(pixels[y * kSize + x], expect) << x << ", " << y;
+        }
+    }
+}
+
+// Tests that the OpenGL back-end skips a depth function call that would not change the native
+// state, and reports it in the perf counters.
+TEST_P(StateChangeTestES3, OpenGLSkipsRedundantDepthFunc)
+{
+    ANGLE_SKIP_TEST_IF(!IsOpenGL() && !IsOpenGLES());
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_AMD_performance_monitor"));
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GL_ALWAYS);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    CounterNameToValueMap before = BuildCounterNameToValueMap();
+
+    // Change the depth function and restore it before the next draw.
+    glDepthFunc(GL_NEVER);
+    glDepthFunc(GL_ALWAYS);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    CounterNameToValueMap after = BuildCounterNameToValueMap();
+    EXPECT_EQ(before["depthFuncIssued"], after["depthFuncIssued"]);
+    EXPECT_GT(after["depthFuncSkipped"], before["depthFuncSkipped"]);
+}
 }  // anonymous namespace
 
 ANGLE_INSTANTIATE_TEST_ES2(StateChangeTest);
@@ -9638,7 +9710,9 @@ ANGLE_INSTANTIATE_TEST_ES3_AND(StateChangeTestES3,
                                ES3_VULKAN()
                                    .disable(Feature::SupportsExtendedDynamicState)
                                    .disable(Feature::SupportsExtendedDynamicState2),
-                               ES3_VULKAN().disable(Feature::SupportsExtendedDynamicState2));
+                               ES3_VULKAN().disable(Feature::SupportsExtendedDynamicState2),
+                               ES3_VULKAN().enable(Feature::AsyncGraphicsPipelineCreation),
+                               ES3_VULKAN().enable(Feature::ReplayRenderPassCommandsInParallel));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(StateChangeTestWebGL2);
 ANGLE_INSTANTIATE_TEST_COMBINE_1(StateChangeTestWebGL2,
@@ -471,6 +471,12 @@ class Texture2DTestES3RobustInit : public Texture2DTestES3
     Texture2DTestES3RobustInit() : Texture2DTestES3() { setRobustResourceInit(true); }
 };
 
+class Texture2DDeferredLevelAllocationTestES3 : public Texture2DTestES3
+{
+  protected:
+    Texture2DDeferredLevelAllocationTestES3() : Texture2DTestES3() {}
+};
+
 class Texture2DBaseMaxTestES3 : public ANGLETest
 {
   protected:
@@ -2294,6 +2300,113 @@ TEST_P(Texture2DTest, TexStorage)
     EXPECT_EQ(255, pixel.A);
 }
 
+// Test that many small disjoint glTexSubImage2D updates, as done for glyph atlases, followed by an
+// update that overlaps some of them, are all applied in order.
+TEST_P(Texture2DTest, ManyDisjointSubImageUpdatesThenOverlappingUpdate)
+{
+    constexpr GLsizei kSize     = 32;
+    constexpr GLsizei kTileSize = 4;
+    constexpr GLsizei kTiles    = kSize / kTileSize;
+
+    GLTexture tex2D;
+    glBindTexture(GL_TEXTURE_2D, tex2D);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, kSize, kSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    // Give every tile a distinct color.
+    auto tileColor = [](GLsizei tileX, GLsizei tileY) {
+        return GLColor(static_cast<GLubyte>(tileX * 31), static_cast<GLubyte>(tileY * 31), 128,
+                       255);
+    };
+    for (GLsizei tileY = 0; tileY < kTiles; ++tileY)
+    {
+        for (GLsizei tileX = 0; tileX < kTiles; ++tileX)
+        {
+            std::vector<GLColor> tileData(kTileSize * kTileSize, tileColor(tileX, tileY));
+            glTexSubImage2D(GL_TEXTURE_2D, 0, tileX * kTileSize, tileY * kTileSize, kTileSize,
+                            kTileSize, GL_RGBA, GL_UNSIGNED_BYTE, tileData.data());
+        }
+    }
+
+    // Overwrite a region that straddles four tiles.
+    constexpr GLsizei kOverlapOffset = kTileSize + kTileSize / 2;
+    std::vector<GLColor> overlapData(kTileSize * kTileSize, GLColor::yellow);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, kOverlapOffset, kOverlapOffset, kTileSize, kTileSize,
+                    GL_RGBA, GL_UNSIGNED_BYTE, overlapData.data());
+    EXPECT_GL_NO_ERROR();
+
+    GLFramebuffer fbo;
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, tex2D, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    // Verify the first texel of every tile that is not overwritten.
+    for (GLsizei tileY = 0; tileY < kTiles; ++tileY)
+    {
+        for (GLsizei tileX = 0; tileX < kTiles; ++tileX)
+        {
+            const GLsizei x = tileX * kTileSize;
+            const GLsizei y = tileY * kTileSize;
+            if (x >= kOverlapOffset && x < kOverlapOffset + kTileSize && y >= kOverlapOffset &&
+                y < kOverlapOffset + kTileSize)
+            {
+                continue;
+            }
+            EXPECT_PIXEL_COLOR_EQ(x, y, tileColor(tileX, tileY));
+        }
+    }
+    EXPECT_PIXEL_RECT_EQ(kOverlapOffset, kOverlapOffset, kTileSize, kTileSize, GLColor::yellow);
+    EXPECT_PIXEL_COLOR_EQ(kOverlapOffset - 1, kOverlapOffset - 1, tileColor(1, 1));
+}
+
+// Test that a large RGB upload, which may be expanded to RGBA on the GPU, followed by a sub image
+// update of the same texture is read back correctly.
+TEST_P(Texture2DTest, LargeRGBUploadThenSubImageUpdate)
+{
+    constexpr GLsizei kSize = 256;
+
+    std::vector<GLubyte> rgbData(kSize * kSize * 3);
+    for (GLsizei y = 0; y < kSize; ++y)
+    {
+        for (GLsizei x = 0; x < kSize; ++x)
+        {
+            GLubyte *texel = &rgbData[(y * kSize + x) * 3];
+            texel[0]       = static_cast<GLubyte>(x);
+            texel[1]       = static_cast<GLubyte>(y);
+            texel[2]       = static_cast<GLubyte>(x ^ y);
+        }
+    }
+
+    GLTexture tex2D;
+    glBindTexture(GL_TEXTURE_2D, tex2D);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, kSize, kSize, 0, GL_RGB, GL_UNSIGNED_BYTE,
+                 rgbData.data());
+
+    constexpr GLsizei kSubSize = 4;
+    std::vector<GLubyte> subData(kSubSize * kSubSize * 3, 0);
+    for (GLsizei index = 0; index < kSubSize * kSubSize; ++index)
+    {
+        subData[index * 3 + 1] = 255;
+    }
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kSubSize, kSubSize, GL_RGB, GL_UNSIGNED_BYTE,
+                    subData.data());
+    EXPECT_GL_NO_ERROR();
+
+    GLFramebuffer fbo;
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, tex2D, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, kSubSize, kSubSize, GLColor::green);
+    for (GLsizei y = kSubSize; y < kSize; y += 37)
+    {
+        for (GLsizei x = kSubSize; x < kSize; x += 41)
+        {
+            EXPECT_PIXEL_EQ(x, y, x, y, x ^ y, 255);
+        }
+    }
+}
+
 // Test that glTexSubImage2D combined with a PBO works properly when glTexStorage2DEXT has
 // initialized the image with a default color.
 TEST_P(Texture2DTest, TexStorageWithPBO)
@@ -2477,6 +2590,41 @@ TEST_P(Texture2DTest, PBOWithMultipleDraws)
     EXPECT_EQ(expected, actual);
 }
 
+// Test that a PBO upload to a texture that is not created yet keeps the contents the PBO had at
+// the time of the upload.
+TEST_P(Texture2DTestES3, TexImageWithPBOModifiedBeforeDraw)
+{
+    const GLuint width            = getWindowWidth();
+    const GLuint height           = getWindowHeight();
+    const GLuint windowPixelCount = width * height;
+    std::vector<GLColor> pixelsRed(windowPixelCount, GLColor::red);
+    std::vector<GLColor> pixelsGreen(windowPixelCount, GLColor::green);
+
+    GLBuffer pbo;
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pbo);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, pixelsGreen.size() * 4u, pixelsGreen.data(),
+                 GL_STATIC_DRAW);
+
+    glBindTexture(GL_TEXTURE_2D, mTexture2D);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+    ASSERT_GL_NO_ERROR();
+
+    // Overwrite the PBO before the texture is used.
+    glBufferSubData(GL_PIXEL_UNPACK_BUFFER, 0, pixelsRed.size() * 4u, pixelsRed.data());
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    glUseProgram(mProgram);
+    glUniform1i(mTexture2DUniformLocation, 0);
+    drawQuad(mProgram, "position", 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    std::vector<GLColor> actual(windowPixelCount, GLColor::black);
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, actual.data());
+    EXPECT_EQ(pixelsGreen, actual);
+}
+
 // Test that glTexSubImage2D combined with a PBO works properly. PBO has all pixels as red
 // except the middle one being green.
 TEST_P(Texture2DTest, TexStorageWithPBOMiddlePixelDifferent)
@@ -3868,6 +4016,79 @@ TEST_P(Texture2DTestES3, ChangeTexSizeWithTexStorage)
     EXPECT_PIXEL_RECT_EQ(0, 0, getWindowWidth(), getWindowHeight(), GLColor::green);
 }
 
+// Tests that uploads to an immutable texture are visible to the draws that follow them, whether the
+// texture is idle or still in use by the previous draw.  In Vulkan, uploads to idle textures may be
+// copied on the host.
+TEST_P(Texture2DTestES3, TexSubImageToIdleAndBusyTexture)
+{
+    constexpr GLsizei kSize = 16;
+
+    setUpProgram();
+    glUseProgram(mProgram);
+    glUniform1i(mTexture2DUniformLocation, 0);
+
+    glBindTexture(GL_TEXTURE_2D, mTexture2D);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kSize, kSize);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+
+    std::vector<GLColor> red(kSize * kSize, GLColor::red);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kSize, kSize, GL_RGBA, GL_UNSIGNED_BYTE, red.data());
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_RECT_EQ(0, 0, getWindowWidth(), getWindowHeight(), GLColor::red);
+
+    // Upload to the bottom half of the texture once the GPU is done with it.
+    glFinish();
+    std::vector<GLColor> green(kSize * kSize / 2, GLColor::green);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kSize, kSize / 2, GL_RGBA, GL_UNSIGNED_BYTE,
+                    green.data());
+    drawQuad(mProgram, "position", 0.5f);
+
+    // Upload to the top half while the texture is still in use, from rows that are twice as long.
+    std::vector<GLColor> blue(kSize * kSize, GLColor::blue);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, kSize * 2);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, kSize / 2, kSize, kSize / 2, GL_RGBA, GL_UNSIGNED_BYTE,
+                    blue.data());
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    drawQuad(mProgram, "position", 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    const int halfHeight = getWindowHeight() / 2;
+    EXPECT_PIXEL_RECT_EQ(0, 0, getWindowWidth(), halfHeight, GLColor::green);
+    EXPECT_PIXEL_RECT_EQ(0, halfHeight, getWindowWidth(), getWindowHeight() - halfHeight,
+                         GLColor::blue);
+}
+
+// Tests that large uploads to the levels of new textures are visible to the draw calls that
+// follow.
+TEST_P(Texture2DTestES3, LargeUploadsToNewTextures)
+{
+    constexpr GLsizei kSize = 1024;
+
+    setUpProgram();
+    glUseProgram(mProgram);
+    glUniform1i(mTexture2DUniformLocation, 0);
+
+    const GLColor colors[2] = {GLColor::red, GLColor::green};
+    GLTexture textures[2];
+    for (size_t index = 0; index < 2; ++index)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures[index]);
+        glTexStorage2D(GL_TEXTURE_2D, 2, GL_RGBA8, kSize, kSize);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+
+        std::vector<GLColor> data(kSize * kSize, colors[index]);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kSize, kSize, GL_RGBA, GL_UNSIGNED_BYTE,
+                        data.data());
+        glTexSubImage2D(GL_TEXTURE_2D, 1, 0, 0, kSize / 2, kSize / 2, GL_RGBA, GL_UNSIGNED_BYTE,
+                        data.data());
+        drawQuad(mProgram, "position", 0.5f);
+        EXPECT_PIXEL_RECT_EQ(0, 0, getWindowWidth(), getWindowHeight(), colors[index]);
+    }
+    ASSERT_GL_NO_ERROR();
+}
+
 // Regression test for http://crbug.com/949985 to make sure dirty bits are propagated up from
 // TextureImpl and the texture is synced before being used in a draw call.
 TEST_P(Texture2DTestES3, TextureImplPropogatesDirtyBits)
@@ -6210,6 +6431,41 @@ TEST_P(Texture2DTestES3RobustInit, TextureCOMPRESSEDSRGB8A1ETC2)
     EXPECT_PIXEL_ALPHA_EQ(0, 0, 255);
 }
 
+// Test sampling ASTC textures, which are decoded on upload when the hardware doesn't support them.
+TEST_P(Texture2DTestES3, TextureCOMPRESSEDRGBAASTC4x4Sample)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled("GL_KHR_texture_compression_astc_ldr"));
+
+    // A void-extent block of opaque red.
+    constexpr GLubyte kVoidExtentBlock[16] = {0xFC, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                                              0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF};
+    // A single-partition block with black and white RGB endpoints, the first texel using the black
+    // endpoint and the others the white one.
+    constexpr GLubyte kDirectRGBBlock[16] = {0x53, 0x00, 0x01, 0xFE, 0x01, 0xFE, 0x01, 0xFE,
+                                             0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F};
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, mTexture2D);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    glCompressedTexImage2D(GL_TEXTURE_2D, 0, GL_COMPRESSED_RGBA_ASTC_4x4_KHR, 4, 4, 0,
+                           sizeof(kVoidExtentBlock), kVoidExtentBlock);
+    EXPECT_GL_NO_ERROR();
+
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, getWindowHeight() - 1, GLColor::red);
+
+    glCompressedTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 4, 4, GL_COMPRESSED_RGBA_ASTC_4x4_KHR,
+                              sizeof(kDirectRGBBlock), kDirectRGBBlock);
+    EXPECT_GL_NO_ERROR();
+
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::black);
+    EXPECT_PIXEL_COLOR_EQ(getWindowWidth() - 1, getWindowHeight() - 1, GLColor::white);
+}
+
 // Test that compressed textures ignore the pixel unpack state.
 // (https://crbug.org/1267496)
 TEST_P(Texture2DTestES3, PixelUnpackStateTexImage)
@@ -10664,6 +10920,95 @@ TEST_P(ExtraSamplerCubeShadowUseTest, Basic)
     EXPECT_GL_ERROR(GL_INVALID_OPERATION);
 }
 
+// Test that uploading to the other levels of an immutable texture after it has been sampled from
+// preserves the contents of the levels that were uploaded first.
+TEST_P(Texture2DDeferredLevelAllocationTestES3, UploadToLevelsAfterSampling)
+{
+    constexpr GLsizei kSize   = 16;
+    constexpr GLsizei kLevels = 5;
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, mTexture2D);
+    glTexStorage2D(GL_TEXTURE_2D, kLevels, GL_RGBA8, kSize, kSize);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+
+    // Upload to level 0 only and draw with it.
+    std::vector<GLColor> redColors(kSize * kSize, GLColor::red);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kSize, kSize, GL_RGBA, GL_UNSIGNED_BYTE,
+                    redColors.data());
+
+    glUseProgram(mProgram);
+    glUniform1i(mTexture2DUniformLocation, 0);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    // Upload to the rest of the levels and draw with them.
+    for (GLint level = 1; level < kLevels; ++level)
+    {
+        const GLsizei levelSize = kSize >> level;
+        std::vector<GLColor> greenColors(levelSize * levelSize, GLColor::green);
+        glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, levelSize, levelSize, GL_RGBA,
+                        GL_UNSIGNED_BYTE, greenColors.data());
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 1);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, kLevels - 1);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    // Make sure level 0 has been preserved.
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    ASSERT_GL_NO_ERROR();
+}
+
+// Test that rendering to a level of an immutable texture that has not been uploaded to works after
+// the texture has been sampled from.
+TEST_P(Texture2DDeferredLevelAllocationTestES3, RenderToLevelAfterSampling)
+{
+    constexpr GLsizei kSize   = 16;
+    constexpr GLsizei kLevels = 3;
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, mTexture2D);
+    glTexStorage2D(GL_TEXTURE_2D, kLevels, GL_RGBA8, kSize, kSize);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+
+    std::vector<GLColor> redColors(kSize * kSize, GLColor::red);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, kSize, kSize, GL_RGBA, GL_UNSIGNED_BYTE,
+                    redColors.data());
+
+    glUseProgram(mProgram);
+    glUniform1i(mTexture2DUniformLocation, 0);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    // Clear level 2 through a framebuffer.
+    GLFramebuffer framebuffer;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, mTexture2D, 2);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+    glClearColor(0, 0, 1, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 2);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    drawQuad(mProgram, "position", 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+    ASSERT_GL_NO_ERROR();
+}
+
 // Use this to select which configurations (e.g. which renderer, which GLES major version) these
 // tests should be run against.
 #define ES2_EMULATE_COPY_TEX_IMAGE()                                      \
@@ -10680,12 +11025,23 @@ ANGLE_INSTANTIATE_TEST_ES2(SamplerArrayTest);
 ANGLE_INSTANTIATE_TEST_ES2(SamplerArrayAsFunctionParameterTest);
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Texture2DTestES3);
-ANGLE_INSTANTIATE_TEST_ES3_AND(Texture2DTestES3,
-                               ES3_VULKAN().enable(Feature::AllocateNonZeroMemory));
+ANGLE_INSTANTIATE_TEST_ES3_AND(
+    Texture2DTestES3,
+    ES3_VULKAN().enable(Feature::AllocateNonZeroMemory),
+    ES3_VULKAN().disable(Feature::SupportsHostImageCopy),
+    ES3_VULKAN()
+        .enable(Feature::UseTransferQueueForUploads)
+        .disable(Feature::SupportsHostImageCopy),
+    ES3_OPENGL().enable(Feature::StreamTextureUploadsThroughPixelUnpackBuffer),
+    ES3_OPENGLES().enable(Feature::StreamTextureUploadsThroughPixelUnpackBuffer));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Texture2DTestES3RobustInit);
 ANGLE_INSTANTIATE_TEST_ES3(Texture2DTestES3RobustInit);
 
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Texture2DDeferredLevelAllocationTestES3);
+ANGLE_INSTANTIATE_TEST_ES3_AND(Texture2DDeferredLevelAllocationTestES3,
+                               ES3_VULKAN().enable(Feature::DeferImmutableTextureLevelAllocation));
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(Texture2DTestES31PPO);
 ANGLE_INSTANTIATE_TEST_ES31(Texture2DTestES31PPO);
 
@@ -192,6 +192,72 @@ TEST_P(UniformBufferTest, UniformBufferBindings)
     EXPECT_PIXEL_EQ(px, py, 10, 20, 30, 40);
 }
 
+// Test that a shader linked in a program, recompiled with a different uniform block declaration and
+// linked in another program gets the layout of the new declaration.
+TEST_P(UniformBufferTest, RecompiledShaderBlockLayout)
+{
+    constexpr char kFS1[] = R"(#version 300 es
+precision highp float;
+layout(std140) uniform block { vec4 a; };
+out vec4 color;
+void main()
+{
+    color = a;
+})";
+
+    constexpr char kFS2[] = R"(#version 300 es
+precision highp float;
+layout(std140) uniform block { vec4 a; vec4 b; };
+out vec4 color;
+void main()
+{
+    color = a + b;
+})";
+
+    GLShader vs(GL_VERTEX_SHADER);
+    const char *vsSource = essl3_shaders::vs::Simple();
+    glShaderSource(vs, 1, &vsSource, nullptr);
+    glCompileShader(vs);
+
+    GLShader fs(GL_FRAGMENT_SHADER);
+    GLint blockSizes[2] = {};
+    GLint bOffsets[2]   = {};
+
+    for (int index = 0; index < 2; ++index)
+    {
+        const char *fsSource = index == 0 ? kFS1 : kFS2;
+        glShaderSource(fs, 1, &fsSource, nullptr);
+        glCompileShader(fs);
+
+        GLProgram program;
+        glAttachShader(program, vs);
+        glAttachShader(program, fs);
+        glLinkProgram(program);
+
+        GLint linkStatus = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &linkStatus);
+        ASSERT_GL_TRUE(linkStatus);
+
+        GLuint blockIndex = glGetUniformBlockIndex(program, "block");
+        glGetActiveUniformBlockiv(program, blockIndex, GL_UNIFORM_BLOCK_DATA_SIZE,
+                                  &blockSizes[index]);
+
+        const char *bName = "b";
+        GLuint bIndex     = GL_INVALID_INDEX;
+        glGetUniformIndices(program, 1, &bName, &bIndex);
+        if (bIndex != GL_INVALID_INDEX)
+        {
+            glGetActiveUniformsiv(program, 1, &bIndex, GL_UNIFORM_OFFSET, &bOffsets[index]);
+        }
+        ASSERT_EQ(index == 0, bIndex == GL_INVALID_INDEX);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(16, blockSizes[0]);
+    EXPECT_EQ(32, blockSizes[1]);
+    EXPECT_EQ(16, bOffsets[1]);
+}
+
 // Update a UBO many time and verify that ANGLE uses the latest version of the data.
 // https://code.google.com/p/angleproject/issues/detail?id=965
 TEST_P(UniformBufferTest, UniformBufferManyUpdates)
@@ -1423,6 +1423,63 @@ TEST_P(UniformTest, UniformWithReservedOpenGLName)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::white);
 }
 
+// Test that setting uniforms to the values they already have doesn't lose later updates, both
+// with the program bound and after switching programs.
+TEST_P(UniformTest, RedundantUniformUpdates)
+{
+    constexpr char kFS[] =
+        "precision mediump float;\n"
+        "uniform vec4 color;\n"
+        "uniform mat4 transform;\n"
+        "void main() {\n"
+        "    gl_FragColor = transform * color;\n"
+        "}";
+
+    mProgram = CompileProgram(essl1_shaders::vs::Simple(), kFS);
+    ASSERT_NE(mProgram, 0u);
+
+    ANGLE_GL_PROGRAM(otherProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Blue());
+
+    GLint colorLocation = glGetUniformLocation(mProgram, "color");
+    ASSERT_NE(-1, colorLocation);
+    GLint transformLocation = glGetUniformLocation(mProgram, "transform");
+    ASSERT_NE(-1, transformLocation);
+
+    constexpr GLfloat kIdentity[16] = {1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+    constexpr GLfloat kSwapRG[16]   = {0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1};
+
+    glUseProgram(mProgram);
+    glUniform4f(colorLocation, 1, 0, 0, 1);
+    glUniformMatrix4fv(transformLocation, 1, GL_FALSE, kIdentity);
+    drawQuad(mProgram, essl1_shaders::PositionAttrib(), 0.0f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    // Redundant updates followed by a real one.
+    glUniform4f(colorLocation, 1, 0, 0, 1);
+    glUniformMatrix4fv(transformLocation, 1, GL_FALSE, kIdentity);
+    drawQuad(mProgram, essl1_shaders::PositionAttrib(), 0.0f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    glUniformMatrix4fv(transformLocation, 1, GL_FALSE, kSwapRG);
+    drawQuad(mProgram, essl1_shaders::PositionAttrib(), 0.0f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    // Switch programs, then set the same values again.
+    drawQuad(otherProgram, essl1_shaders::PositionAttrib(), 0.0f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+
+    glUseProgram(mProgram);
+    glUniform4f(colorLocation, 1, 0, 0, 1);
+    glUniformMatrix4fv(transformLocation, 1, GL_FALSE, kSwapRG);
+    drawQuad(mProgram, essl1_shaders::PositionAttrib(), 0.0f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+
+    glUniform4f(colorLocation, 0, 0, 1, 1);
+    drawQuad(mProgram, essl1_shaders::PositionAttrib(), 0.0f);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::blue);
+}
+
 // Test that unused sampler array elements do not corrupt used sampler array elements. Checks for a
 // bug where unused samplers in an array would mark the whole array unused.
 TEST_P(UniformTest, UnusedUniformsInSamplerArray)
@@ -1514,14 +1571,74 @@ void main()
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
 }
 
+// Test that uniforms updated between many draws that alternate between two programs are all
+// seen by their draw, including across the reuse of the memory the uniforms are uploaded to.
+TEST_P(UniformTest, ManyDrawsAlternatingPrograms)
+{
+    constexpr char kVS[] = R"(precision highp float;
+attribute vec4 position;
+uniform vec2 offset;
+void main()
+{
+    gl_Position = vec4(position.xy + offset, 0, 1);
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+uniform vec4 color;
+void main()
+{
+    gl_FragColor = color;
+})";
+
+    constexpr char kFSSwizzled[] = R"(precision mediump float;
+uniform vec4 color;
+void main()
+{
+    gl_FragColor = color.bgra;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    ANGLE_GL_PROGRAM(programSwizzled, kVS, kFSSwizzled);
+
+    constexpr int kDrawCount = 8192;
+    for (int draw = 0; draw < kDrawCount; ++draw)
+    {
+        bool swizzled  = (draw % 2) == 1;
+        GLuint current = swizzled ? programSwizzled : program;
+        glUseProgram(current);
+
+        GLubyte value = static_cast<GLubyte>(draw % 256);
+        glUniform2f(glGetUniformLocation(current, "offset"), 0.0f, 0.0f);
+        glUniform4f(glGetUniformLocation(current, "color"), value / 255.0f, 0.0f, 1.0f, 1.0f);
+        drawQuad(current, "position", 0.5f);
+
+        if (draw % 1000 == 999)
+        {
+            GLColor expected = swizzled ? GLColor(255, 0, value, 255) : GLColor(value, 0, 255, 255);
+            EXPECT_PIXEL_COLOR_NEAR(0, 0, expected, 1);
+        }
+    }
+    ASSERT_GL_NO_ERROR();
+}
+
 // Use this to select which configurations (e.g. which renderer, which GLES major version) these
 // tests should be run against.
-ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(SimpleUniformTest);
-
-ANGLE_INSTANTIATE_TEST_ES2_AND_ES3(UniformTest);
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
+    SimpleUniformTest,
+    ES2_VULKAN().enable(Feature::PromoteDefaultUniformsToPushConstants),
+    ES3_VULKAN().enable(Feature::PromoteDefaultUniformsToPushConstants));
+
+ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
+    UniformTest,
+    ES2_VULKAN().enable(Feature::PromoteDefaultUniformsToPushConstants),
+    ES3_VULKAN().enable(Feature::PromoteDefaultUniformsToPushConstants),
+    ES2_D3D11().disable(Feature::UploadDefaultUniformsThroughConstantBufferRing),
+    ES3_D3D11().disable(Feature::UploadDefaultUniformsThroughConstantBufferRing));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(UniformTestES3);
-ANGLE_INSTANTIATE_TEST_ES3(UniformTestES3);
+ANGLE_INSTANTIATE_TEST_ES3_AND(
+    UniformTestES3,
+    ES3_VULKAN().enable(Feature::PromoteDefaultUniformsToPushConstants));
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(UniformTestES31);
 ANGLE_INSTANTIATE_TEST_ES31(UniformTestES31);
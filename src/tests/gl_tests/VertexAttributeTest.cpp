@@ -30,6 +30,7 @@ GLsizei TypeStride(GLenum attribType)
         case GL_UNSIGNED_INT:
         case GL_INT:
         case GL_FLOAT:
+        case GL_FIXED:
         case GL_UNSIGNED_INT_10_10_10_2_OES:
         case GL_INT_10_10_10_2_OES:
             return 4;
@@ -531,6 +532,21 @@ TEST_P(VertexAttributeTest, ShortNormalized)
 }
 
 // Verify that vertex data is updated correctly when using a float/half-float client memory pointer.
+// Test that fixed point data in a static buffer is converted correctly.
+TEST_P(VertexAttributeTest, FixedBuffer)
+{
+    std::array<GLfixed, kVertexCount> inputData = {
+        {0, 1, 2, 3, -1, -2, -3, -4, 0x10000, -0x10000, 0x18000, -0x18000, 0x7FFF0000}};
+    std::array<GLfloat, kVertexCount> expectedData;
+    for (size_t i = 0; i < kVertexCount; i++)
+    {
+        expectedData[i] = static_cast<GLfloat>(inputData[i]) / 65536.0f;
+    }
+
+    TestData data(GL_FIXED, GL_FALSE, Source::BUFFER, inputData.data(), expectedData.data());
+    runTest(data);
+}
+
 TEST_P(VertexAttributeTest, HalfFloatClientMemoryPointer)
 {
     std::array<GLhalf, kVertexCount> inputData;
@@ -1301,6 +1317,57 @@ TEST_P(VertexAttributeTest, DrawArraysWithBufferOffset)
     EXPECT_GL_NO_ERROR();
 }
 
+// Verify that updating part of a buffer of converted vertex data is visible in the next draw.
+TEST_P(VertexAttributeTest, DrawArraysAfterPartialUpdateOfConvertedData)
+{
+    initBasicProgram();
+    glUseProgram(mProgram);
+
+    std::array<GLfixed, kVertexCount> inputData;
+    std::array<GLfloat, kVertexCount> expectedData;
+    for (size_t count = 0; count < kVertexCount; ++count)
+    {
+        inputData[count]    = static_cast<GLfixed>(count << 16);
+        expectedData[count] = static_cast<GLfloat>(count);
+    }
+
+    GLBuffer quadBuffer;
+    InitQuadVertexBuffer(&quadBuffer);
+
+    GLint positionLocation = glGetAttribLocation(mProgram, "position");
+    ASSERT_NE(-1, positionLocation);
+    glVertexAttribPointer(positionLocation, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(inputData), inputData.data(), GL_STATIC_DRAW);
+    glVertexAttribPointer(mTestAttrib, 1, GL_FIXED, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(mTestAttrib);
+
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glVertexAttribPointer(mExpectedAttrib, 1, GL_FLOAT, GL_FALSE, 0, expectedData.data());
+    glEnableVertexAttribArray(mExpectedAttrib);
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    checkPixels();
+
+    // Update a few vertices in the middle of the quad, and draw again.
+    const std::array<GLfixed, 3> updateData = {{-0x10000, 0x48000, 0x7FFF0000}};
+    for (size_t index = 0; index < updateData.size(); ++index)
+    {
+        expectedData[2 + index] = static_cast<GLfloat>(updateData[index]) / 65536.0f;
+    }
+
+    glBindBuffer(GL_ARRAY_BUFFER, mBuffer);
+    glBufferSubData(GL_ARRAY_BUFFER, 2 * sizeof(GLfixed), sizeof(updateData), updateData.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    checkPixels();
+
+    EXPECT_GL_NO_ERROR();
+}
+
 // Verify that using an unaligned offset doesn't mess up the draw.
 TEST_P(VertexAttributeTest, DrawArraysWithUnalignedBufferOffset)
 {
@@ -1670,6 +1737,86 @@ TEST_P(VertexAttributeTest, DrawWithLargeBufferOffset)
     checkPixels();
 }
 
+// Test that consecutive draws streaming large amounts of client memory each read their own data,
+// even once the streamed data of the previous draws is recycled.
+TEST_P(VertexAttributeTest, ManyDrawsWithLargeClientMemory)
+{
+    constexpr char kVS[] = R"(attribute vec2 a_position;
+attribute vec4 a_color;
+varying vec4 v_color;
+void main()
+{
+    v_color = a_color;
+    gl_Position = vec4(a_position, 0.0, 1.0);
+})";
+
+    constexpr char kFS[] = R"(precision mediump float;
+varying vec4 v_color;
+void main()
+{
+    gl_FragColor = v_color;
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, kFS);
+    glUseProgram(program);
+    GLint positionLocation = glGetAttribLocation(program, "a_position");
+    GLint colorLocation    = glGetAttribLocation(program, "a_color");
+    ASSERT_NE(-1, positionLocation);
+    ASSERT_NE(-1, colorLocation);
+
+    // Each draw fills one column with a quad made of the first and last vertices of the range, so
+    // the whole range of vertices between them is streamed.
+    constexpr GLsizei kDrawCount   = 16;
+    constexpr GLushort kLastVertex = 0xFFFF;
+    constexpr size_t kVertexCount  = kLastVertex + 1;
+    const int kColumnWidth         = getWindowWidth() / kDrawCount;
+
+    constexpr std::array<GLushort, 6> kIndices = {
+        {0, 1, kLastVertex - 1, 0, kLastVertex - 1, kLastVertex}};
+
+    constexpr std::array<GLushort, 4> kCornerVertices = {{0, 1, kLastVertex - 1, kLastVertex}};
+
+    std::vector<GLfloat> positions(2 * kVertexCount, 0.0f);
+    std::vector<GLColor> colors(kVertexCount);
+
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, positions.data());
+    glEnableVertexAttribArray(positionLocation);
+    glVertexAttribPointer(colorLocation, 4, GL_UNSIGNED_BYTE, GL_TRUE, 0, colors.data());
+    glEnableVertexAttribArray(colorLocation);
+
+    auto columnColor = [](GLsizei draw) {
+        return GLColor(static_cast<GLubyte>(draw * 16), static_cast<GLubyte>(255 - draw * 16), 0,
+                       255);
+    };
+
+    for (GLsizei draw = 0; draw < kDrawCount; ++draw)
+    {
+        // The client memory is overwritten right after the previous draw.
+        const GLfloat left  = -1.0f + 2.0f * draw / kDrawCount;
+        const GLfloat right = left + 2.0f / kDrawCount;
+
+        const std::array<std::array<GLfloat, 2>, 4> corners = {
+            {{{left, -1.0f}}, {{left, 1.0f}}, {{right, 1.0f}}, {{right, -1.0f}}}};
+        for (size_t corner = 0; corner < corners.size(); ++corner)
+        {
+            positions[2 * kCornerVertices[corner]]     = corners[corner][0];
+            positions[2 * kCornerVertices[corner] + 1] = corners[corner][1];
+        }
+        std::fill(colors.begin(), colors.end(), columnColor(draw));
+
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(kIndices.size()), GL_UNSIGNED_SHORT,
+                       kIndices.data());
+    }
+    ASSERT_GL_NO_ERROR();
+
+    for (GLsizei draw = 0; draw < kDrawCount; ++draw)
+    {
+        EXPECT_PIXEL_COLOR_EQ(draw * kColumnWidth + kColumnWidth / 2, getWindowHeight() / 2,
+                              columnColor(draw))
+            << "draw " << draw;
+    }
+}
+
 // Test that drawing with large vertex attribute pointer offset and less components than
 // shader expects is OK
 TEST_P(VertexAttributeTest, DrawWithLargeBufferOffsetAndLessComponents)
@@ -4132,6 +4279,7 @@ TEST_P(VertexAttributeTestES3, emptyBuffer)
 
 ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
     VertexAttributeTest,
+    ES2_D3D11().disable(Feature::ConvertStaticBuffersWithComputeShaders),
     ES2_VULKAN().enable(Feature::ForceFallbackFormat),
     ES2_VULKAN_SWIFTSHADER().enable(Feature::ForceFallbackFormat),
     ES3_VULKAN().enable(Feature::ForceFallbackFormat),
@@ -4152,6 +4300,7 @@ ANGLE_INSTANTIATE_TEST_ES2_AND_ES3_AND(
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VertexAttributeTestES3);
 ANGLE_INSTANTIATE_TEST_ES3_AND(
     VertexAttributeTestES3,
+    ES3_D3D11().disable(Feature::ConvertStaticBuffersWithComputeShaders),
     ES3_VULKAN().enable(Feature::ForceFallbackFormat),
     ES3_VULKAN_SWIFTSHADER().enable(Feature::ForceFallbackFormat),
     ES3_METAL().disable(Feature::HasExplicitMemBarrier).disable(Feature::HasCheapRenderPass),
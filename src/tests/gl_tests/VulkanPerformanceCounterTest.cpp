@@ -18,6 +18,7 @@
 #include "test_utils/gl_raii.h"
 #include "util/random_utils.h"
 #include "util/shader_utils.h"
+#include "util/test_utils.h"
 
 using namespace angle;
 
@@ -445,6 +446,12 @@ class VulkanPerformanceCounterTest_SingleBuffer : public VulkanPerformanceCounte
     }
 };
 
+class VulkanPerformanceCounterTest_PipelineWarmUp : public VulkanPerformanceCounterTest
+{};
+
+class VulkanPerformanceCounterTest_AsyncCommandQueue : public VulkanPerformanceCounterTest
+{};
+
 void VulkanPerformanceCounterTest::maskedFramebufferFetchDraw(const GLColor &clearColor,
                                                               GLBuffer &buffer)
 {
@@ -577,6 +584,89 @@ TEST_P(VulkanPerformanceCounterTest, NewTextureDoesNotBreakRenderPass)
     EXPECT_EQ(expectedRenderPassCount, actualRenderPassCount);
 }
 
+// Tests that binding another framebuffer and then back to the original one with nothing in between
+// continues the original render pass.
+TEST_P(VulkanPerformanceCounterTest, RebindFramebufferWithoutCommandsContinuesRenderPass)
+{
+    constexpr GLsizei kSize = 16;
+
+    ANGLE_GL_PROGRAM(drawRed, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    ANGLE_GL_PROGRAM(drawGreen, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+
+    GLTexture textureA;
+    glBindTexture(GL_TEXTURE_2D, textureA);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kSize, kSize);
+    GLFramebuffer framebufferA;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebufferA);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textureA, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    GLTexture textureB;
+    glBindTexture(GL_TEXTURE_2D, textureB);
+    glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, kSize, kSize);
+    GLFramebuffer framebufferB;
+    glBindFramebuffer(GL_FRAMEBUFFER, framebufferB);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, textureB, 0);
+    ASSERT_GL_FRAMEBUFFER_COMPLETE(GL_FRAMEBUFFER);
+
+    const uint64_t expectedRenderPassCount        = getPerfCounters().renderPasses + 1;
+    const uint64_t expectedResumedRenderPassCount = getPerfCounters().resumedRenderPasses + 1;
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebufferA);
+    drawQuad(drawRed, essl1_shaders::PositionAttrib(), 0.5f);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, framebufferB);
+    glBindFramebuffer(GL_FRAMEBUFFER, framebufferA);
+
+    glEnable(GL_SCISSOR_TEST);
+    glScissor(0, 0, kSize / 2, kSize);
+    drawQuad(drawGreen, essl1_shaders::PositionAttrib(), 0.5f);
+    glDisable(GL_SCISSOR_TEST);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expectedRenderPassCount, getPerfCounters().renderPasses);
+    EXPECT_EQ(expectedResumedRenderPassCount, getPerfCounters().resumedRenderPasses);
+
+    EXPECT_PIXEL_RECT_EQ(0, 0, kSize / 2, kSize, GLColor::green);
+    EXPECT_PIXEL_RECT_EQ(kSize / 2, 0, kSize / 2, kSize, GLColor::red);
+}
+
+// Tests that polling for an occlusion query's availability once doesn't break the render pass,
+// while polling repeatedly still makes the result available.
+TEST_P(VulkanPerformanceCounterTest, PollingQueryAvailabilityOnceDoesNotBreakRenderPass)
+{
+    ANGLE_GL_PROGRAM(drawRed, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+
+    const uint64_t expectedRenderPassCount = getPerfCounters().renderPasses + 1;
+
+    GLQuery query;
+    glBeginQuery(GL_ANY_SAMPLES_PASSED, query);
+    drawQuad(drawRed, essl1_shaders::PositionAttrib(), 0.5f);
+    glEndQuery(GL_ANY_SAMPLES_PASSED);
+
+    GLuint available = GL_TRUE;
+    glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+    EXPECT_GL_FALSE(available);
+
+    drawQuad(drawRed, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expectedRenderPassCount, getPerfCounters().renderPasses);
+
+    while (available == GL_FALSE)
+    {
+        angle::Sleep(0);
+        glGetQueryObjectuiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+    }
+
+    GLuint result = GL_FALSE;
+    glGetQueryObjectuiv(query, GL_QUERY_RESULT, &result);
+    EXPECT_GL_TRUE(result);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+}
+
 // Tests that submitting the outside command buffer due to texture upload size does not break the
 // current render pass.
 TEST_P(VulkanPerformanceCounterTest, SubmittingOutsideCommandBufferDoesNotBreakRenderPass)
@@ -4211,6 +4301,35 @@ void main()
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::cyan);
 }
 
+// Test that glBufferSubData writes directly to a host visible buffer that the GPU is done with,
+// instead of staging the update or acquiring a new buffer.
+TEST_P(VulkanPerformanceCounterTest, BufferSubDataOfIdleBufferUpdatesDirectly)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    initANGLEFeatures();
+
+    const std::array<GLColor, 4> kInitialData = {GLColor::red, GLColor::red, GLColor::red,
+                                                 GLColor::red};
+    const std::array<GLColor, 4> kUpdateData  = {GLColor::green, GLColor::green, GLColor::green,
+                                                 GLColor::green};
+
+    GLBuffer buffer;
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kInitialData), kInitialData.data(), GL_DYNAMIC_DRAW);
+    glFinish();
+    ASSERT_GL_NO_ERROR();
+
+    const angle::VulkanPerfCounters countersBefore = getPerfCounters();
+
+    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(kUpdateData), kUpdateData.data());
+    ASSERT_GL_NO_ERROR();
+
+    const angle::VulkanPerfCounters countersAfter = getPerfCounters();
+    EXPECT_EQ(countersAfter.bufferDirectUpdates, countersBefore.bufferDirectUpdates + 1);
+    EXPECT_EQ(countersAfter.bufferStagedUpdates, countersBefore.bufferStagedUpdates);
+    EXPECT_EQ(countersAfter.bufferAcquireAndUpdates, countersBefore.bufferAcquireAndUpdates);
+}
+
 // Verifies that BufferSubData calls don't trigger state updates for non-translated formats.
 TEST_P(VulkanPerformanceCounterTest, BufferSubDataShouldNotTriggerSyncState)
 {
@@ -4847,6 +4966,72 @@ outData = texture(tex, vec2(x, y));
     EXPECT_EQ(expectedRenderPassCount, actualRenderPassCount);
 }
 
+// Verify that glMemoryBarrier after a draw with storage writes doesn't break the render pass if
+// the following draws don't depend on those writes, and that it does once a draw depends on them.
+TEST_P(VulkanPerformanceCounterTest_ES31, MemoryBarrierThenIndependentDrawDoesNotBreakRenderPass)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    initANGLEFeatures();
+
+    GLint maxFragmentShaderStorageBlocks = 0;
+    glGetIntegerv(GL_MAX_FRAGMENT_SHADER_STORAGE_BLOCKS, &maxFragmentShaderStorageBlocks);
+    ANGLE_SKIP_TEST_IF(maxFragmentShaderStorageBlocks == 0);
+
+    constexpr char kFS[] = R"(#version 310 es
+precision highp float;
+layout(std430, binding = 0) buffer Output {
+    vec2 positions[6];
+};
+out vec4 colorOut;
+void main()
+{
+    const vec2 kPositions[6] = vec2[6](vec2(-1, -1), vec2(1, -1), vec2(-1, 1),
+                                       vec2(-1, 1), vec2(1, -1), vec2(1, 1));
+    for (int i = 0; i < 6; ++i)
+    {
+        positions[i] = kPositions[i];
+    }
+    colorOut = vec4(0, 0, 1, 1);
+})";
+
+    constexpr GLsizeiptr kBufferSize = 6 * sizeof(GLfloat[2]);
+    GLBuffer buffer;
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, kBufferSize, nullptr, GL_STATIC_DRAW);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, buffer);
+
+    // Write to the storage buffer in a draw call.
+    ANGLE_GL_PROGRAM(writeProgram, essl31_shaders::vs::Simple(), kFS);
+    drawQuad(writeProgram, essl31_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    uint64_t expectedRenderPassCount = getPerfCounters().renderPasses;
+
+    glMemoryBarrier(GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+
+    // A draw that doesn't use the storage buffer should continue the render pass.
+    ANGLE_GL_PROGRAM(redProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    drawQuad(redProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expectedRenderPassCount, getPerfCounters().renderPasses);
+
+    // A draw that uses the storage buffer as vertex buffer should break it.
+    ANGLE_GL_PROGRAM(greenProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+    glUseProgram(greenProgram);
+    GLint positionLocation = glGetAttribLocation(greenProgram, essl1_shaders::PositionAttrib());
+    ASSERT_NE(-1, positionLocation);
+
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+    glEnableVertexAttribArray(positionLocation);
+    glDrawArrays(GL_TRIANGLES, 0, 6);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expectedRenderPassCount + 1, getPerfCounters().renderPasses);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
 // Verify a mid-render pass clear of a newly enabled attachment uses LOAD_OP_CLEAR.
 TEST_P(VulkanPerformanceCounterTest, DisableThenMidRenderPassClear)
 {
@@ -5393,6 +5578,39 @@ TEST_P(VulkanPerformanceCounterTest, SyncWihtoutCommandsDoesntCauseSubmission)
     EXPECT_EQ(getPerfCounters().vkQueueSubmitCallsTotal, expectedVkQueueSubmitCalls);
 }
 
+// Ensure that glFenceSync inside a render pass doesn't break it, and that waiting on the sync
+// object submits the commands.
+TEST_P(VulkanPerformanceCounterTest, FenceSyncInRenderPassDoesNotBreakRenderPass)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+    // Flushes are not deferred to the end of the render pass on Qualcomm.
+    ANGLE_SKIP_TEST_IF(IsQualcomm());
+
+    ANGLE_GL_PROGRAM(redProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    ANGLE_GL_PROGRAM(greenProgram, essl1_shaders::vs::Simple(), essl1_shaders::fs::Green());
+
+    drawQuad(redProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    uint64_t expectedRenderPassCount = getPerfCounters().renderPasses;
+
+    GLsync sync = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    ASSERT_GL_NO_ERROR();
+
+    // The render pass should continue after the fence.
+    drawQuad(greenProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    ASSERT_GL_NO_ERROR();
+
+    EXPECT_EQ(expectedRenderPassCount, getPerfCounters().renderPasses);
+
+    // Waiting on the sync object should submit the commands and finish.
+    GLenum result = glClientWaitSync(sync, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+    EXPECT_TRUE(result == GL_CONDITION_SATISFIED || result == GL_ALREADY_SIGNALED);
+    glDeleteSync(sync);
+
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+}
+
 // In single-buffer mode, ensure that unnecessary eglSwapBuffers is completely ignored (i.e. doesn't
 // lead to a command queue submission, consuming a submission serial).  Used to verify an
 // optimization that ensures CPU throttling doesn't incur GPU bubbles with unnecessary
@@ -5437,6 +5655,100 @@ TEST_P(VulkanPerformanceCounterTest_SingleBuffer, SwapBuffersAfterFlushIgnored)
     EXPECT_EQ(getPerfCounters().commandQueueSubmitCallsTotal, expectedCommandQueueSubmitCalls);
 }
 
+// Verifies that the pipelines used with a program are created when its binary is loaded, so the
+// first draw with the loaded program doesn't miss in the pipeline cache.
+TEST_P(VulkanPerformanceCounterTest_PipelineWarmUp, ProgramBinaryWarmsUpPipelines)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    GLint binaryFormatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binaryFormatCount);
+    ANGLE_SKIP_TEST_IF(binaryFormatCount == 0);
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    GLint binaryLength = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
+    ASSERT_GT(binaryLength, 0);
+
+    std::vector<uint8_t> binary(binaryLength);
+    GLenum binaryFormat = GL_NONE;
+    glGetProgramBinary(program, binaryLength, nullptr, &binaryFormat, binary.data());
+    ASSERT_GL_NO_ERROR();
+
+    GLProgram binaryProgram;
+    glProgramBinary(binaryProgram, binaryFormat, binary.data(), binaryLength);
+    ASSERT_GL_NO_ERROR();
+
+    GLint linkStatus = GL_FALSE;
+    glGetProgramiv(binaryProgram, GL_LINK_STATUS, &linkStatus);
+    ASSERT_EQ(linkStatus, GL_TRUE);
+
+    const uint64_t expectedMisses = getPerfCounters().graphicsPipelineCacheMissesPerFrame;
+
+    glClearColor(0, 0, 1, 1);
+    glClear(GL_COLOR_BUFFER_BIT);
+    drawQuad(binaryProgram, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    EXPECT_EQ(getPerfCounters().graphicsPipelineCacheMissesPerFrame, expectedMisses);
+}
+
+// Verifies that the latency of submissions through the command processor thread is reported.
+TEST_P(VulkanPerformanceCounterTest_AsyncCommandQueue, SubmitLatencyPercentiles)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    for (int submit = 0; submit < 10; ++submit)
+    {
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        glFinish();
+    }
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    const angle::VulkanPerfCounters counters = getPerfCounters();
+    EXPECT_GT(counters.commandProcessorSubmitLatencyP99Ns, 0u);
+    EXPECT_LE(counters.commandProcessorSubmitLatencyP50Ns,
+              counters.commandProcessorSubmitLatencyP90Ns);
+    EXPECT_LE(counters.commandProcessorSubmitLatencyP90Ns,
+              counters.commandProcessorSubmitLatencyP99Ns);
+}
+
+// Verifies that new texture descriptor sets are written and counted, whether or not they are
+// written with a descriptor update template.
+TEST_P(VulkanPerformanceCounterTest, NewTextureDescriptorSetsAreWritten)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+
+    constexpr GLColor kColors[] = {GLColor::red, GLColor::green, GLColor::blue};
+    GLTexture textures[ArraySize(kColors)];
+    for (size_t index = 0; index < ArraySize(kColors); ++index)
+    {
+        glBindTexture(GL_TEXTURE_2D, textures[index]);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                     &kColors[index]);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+    ASSERT_GL_NO_ERROR();
+
+    for (size_t index = 0; index < ArraySize(kColors); ++index)
+    {
+        uint64_t writeDescriptorSetsBefore = getPerfCounters().writeDescriptorSets;
+
+        glBindTexture(GL_TEXTURE_2D, textures[index]);
+        drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, kColors[index]);
+
+        EXPECT_GT(getPerfCounters().writeDescriptorSets, writeDescriptorSetsBefore);
+    }
+}
+
 // Verifies that we share Texture descriptor sets between programs.
 TEST_P(VulkanPerformanceCounterTest, TextureDescriptorsAreShared)
 {
@@ -5486,6 +5798,94 @@ TEST_P(VulkanPerformanceCounterTest, TextureDescriptorsAreShared)
     EXPECT_EQ(expectedCacheMisses, actualCacheMisses);
 }
 
+// Verifies that Texture descriptor sets are shared between contexts in the same share group.
+TEST_P(VulkanPerformanceCounterTest, TextureDescriptorsAreSharedBetweenContexts)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+
+    GLTexture texture;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &GLColor::red);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    const uint64_t expectedCacheMisses = getPerfCounters().textureDescriptorSetCacheMisses;
+    EXPECT_GT(expectedCacheMisses, 0u);
+
+    EGLWindow *window  = getEGLWindow();
+    EGLDisplay display = window->getDisplay();
+    EGLSurface surface = window->getSurface();
+    EGLContext context = window->getContext();
+
+    EGLint contextAttributes[] = {
+        EGL_CONTEXT_MAJOR_VERSION_KHR,
+        GetParam().majorVersion,
+        EGL_CONTEXT_MINOR_VERSION_KHR,
+        GetParam().minorVersion,
+        EGL_NONE,
+    };
+    EGLContext sharedContext =
+        eglCreateContext(display, window->getConfig(), context, contextAttributes);
+    ASSERT_NE(sharedContext, EGL_NO_CONTEXT);
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, surface, surface, sharedContext));
+
+    // Draw with the same program and texture in the shared context.
+    glBindTexture(GL_TEXTURE_2D, texture);
+    drawQuad(program, essl1_shaders::PositionAttrib(), 0.5f);
+    EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::red);
+
+    EXPECT_EQ(getPerfCounters().textureDescriptorSetCacheMisses, expectedCacheMisses);
+
+    EXPECT_EGL_TRUE(eglMakeCurrent(display, surface, surface, context));
+    EXPECT_EGL_TRUE(eglDestroyContext(display, sharedContext));
+    ASSERT_GL_NO_ERROR();
+}
+
+// Verifies that churning through textures does not keep growing the number of descriptor pools.
+TEST_P(VulkanPerformanceCounterTest, TextureChurnKeepsDescriptorPoolCountBounded)
+{
+    ANGLE_SKIP_TEST_IF(!IsGLExtensionEnabled(kPerfMonitorExtensionName));
+
+    ANGLE_GL_PROGRAM(program, essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+    setupQuadVertexBuffer(0.5f, 1.0f);
+    glUseProgram(program);
+
+    // Every draw uses a new texture, so every draw needs a new descriptor set.
+    auto drawWithNewTextures = [](uint32_t drawCount) {
+        for (uint32_t draw = 0; draw < drawCount; ++draw)
+        {
+            GLTexture texture;
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE,
+                         &GLColor::red);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+            glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+            glDrawArrays(GL_TRIANGLES, 0, 6);
+
+            // Let the GPU finish with the pools regularly so they can be recycled.
+            if (draw % 128 == 127)
+            {
+                glFinish();
+            }
+        }
+    };
+
+    constexpr uint32_t kDrawCount = 4096;
+    drawWithNewTextures(kDrawCount);
+    ASSERT_GL_NO_ERROR();
+    const uint64_t expectedPoolCount = getPerfCounters().descriptorPoolCount;
+    EXPECT_GT(expectedPoolCount, 0u);
+
+    drawWithNewTextures(kDrawCount);
+    ASSERT_GL_NO_ERROR();
+    EXPECT_LE(getPerfCounters().descriptorPoolCount, expectedPoolCount);
+}
+
 // Verifies that we share Uniform Buffer descriptor sets between programs.
 TEST_P(VulkanPerformanceCounterTest, UniformBufferDescriptorsAreShared)
 {
@@ -5715,4 +6115,13 @@ ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_MSAA, ES3_VULKAN(), ES3_VULK
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanPerformanceCounterTest_SingleBuffer);
 ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_SingleBuffer, ES3_VULKAN());
 
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_PipelineWarmUp,
+                       ES3_VULKAN().enable(Feature::WarmUpGraphicsPipelinesOnProgramLoad),
+                       ES3_VULKAN()
+                           .enable(Feature::WarmUpGraphicsPipelinesOnProgramLoad)
+                           .enable(Feature::AsyncGraphicsPipelineCreation));
+
+ANGLE_INSTANTIATE_TEST(VulkanPerformanceCounterTest_AsyncCommandQueue,
+                       ES3_VULKAN().enable(Feature::AsyncCommandQueue));
+
 }  // anonymous namespace
@@ -1729,6 +1729,78 @@ void main()
     ASSERT_GL_NO_ERROR();
 }
 
+// Test the checks for OOB reads in the vertex buffers when switching between vertex arrays, and
+// when the buffers of a vertex array that's not bound change.
+TEST_P(WebGL2CompatibilityTest, DrawArraysBufferOutOfBoundsSwitchingVertexArrays)
+{
+    constexpr char kVS[] =
+        R"(attribute float a_pos;
+void main()
+{
+    gl_Position = vec4(a_pos, a_pos, a_pos, 1.0);
+})";
+
+    ANGLE_GL_PROGRAM(program, kVS, essl1_shaders::fs::Red());
+    GLint posLocation = glGetAttribLocation(program.get(), "a_pos");
+    ASSERT_NE(-1, posLocation);
+    glUseProgram(program.get());
+
+    GLBuffer smallBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, smallBuffer.get());
+    glBufferData(GL_ARRAY_BUFFER, 4, nullptr, GL_STATIC_DRAW);
+
+    GLVertexArray smallVertexArray;
+    glBindVertexArray(smallVertexArray);
+    glEnableVertexAttribArray(posLocation);
+    glVertexAttribPointer(posLocation, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, nullptr);
+
+    GLBuffer largeBuffer;
+    glBindBuffer(GL_ARRAY_BUFFER, largeBuffer.get());
+    glBufferData(GL_ARRAY_BUFFER, 16, nullptr, GL_STATIC_DRAW);
+
+    GLVertexArray largeVertexArray;
+    glBindVertexArray(largeVertexArray);
+    glEnableVertexAttribArray(posLocation);
+    glVertexAttribPointer(posLocation, 1, GL_UNSIGNED_BYTE, GL_FALSE, 0, nullptr);
+
+    glDrawArrays(GL_POINTS, 0, 16);
+    ASSERT_GL_NO_ERROR();
+
+    glBindVertexArray(smallVertexArray);
+    glDrawArrays(GL_POINTS, 0, 4);
+    ASSERT_GL_NO_ERROR();
+    glDrawArrays(GL_POINTS, 0, 16);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    glBindVertexArray(largeVertexArray);
+    glDrawArrays(GL_POINTS, 0, 16);
+    ASSERT_GL_NO_ERROR();
+
+    // Grow the buffer of the vertex array that's not bound.
+    glBindBuffer(GL_ARRAY_BUFFER, smallBuffer.get());
+    glBufferData(GL_ARRAY_BUFFER, 16, nullptr, GL_STATIC_DRAW);
+
+    glBindVertexArray(smallVertexArray);
+    glDrawArrays(GL_POINTS, 0, 16);
+    ASSERT_GL_NO_ERROR();
+
+    // Shrink the buffer of the vertex array that's not bound.
+    glBindVertexArray(largeVertexArray);
+    glBindBuffer(GL_ARRAY_BUFFER, smallBuffer.get());
+    glBufferData(GL_ARRAY_BUFFER, 4, nullptr, GL_STATIC_DRAW);
+
+    glBindVertexArray(smallVertexArray);
+    glDrawArrays(GL_POINTS, 0, 16);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+
+    // Change the divisor of the attribute, which only limits instanced draws.
+    glVertexAttribDivisor(posLocation, 1);
+    glDrawArrays(GL_POINTS, 0, 16);
+    ASSERT_GL_NO_ERROR();
+    glDrawArraysInstanced(GL_POINTS, 0, 1, 16);
+    EXPECT_GL_ERROR(GL_INVALID_OPERATION);
+}
+
 // Test the checks for OOB reads in the vertex buffers, ANGLE_instanced_arrays version
 TEST_P(WebGLCompatibilityTest, DrawArraysBufferOutOfBoundsInstancedANGLE)
 {
@@ -80,6 +80,42 @@ TEST_P(BasicDrawTest, EnableDisableTexture)
     EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
 }
 
+// Checks that draws are right while switching between states, including while the programs of
+// the states that were just used for the first time may still be compiling.
+TEST_P(BasicDrawTest, SwitchBetweenStates)
+{
+    GLTexture tex;
+    glBindTexture(GL_TEXTURE_2D, tex);
+
+    // Green
+    GLubyte texture[] = {
+        0x00,
+        0xff,
+        0x00,
+    };
+
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, 1, 1, 0, GL_RGB, GL_UNSIGNED_BYTE, texture);
+
+    glColor4f(1.0f, 1.0f, 1.0f, 1.0f);
+    glEnableClientState(GL_VERTEX_ARRAY);
+    glVertexPointer(2, GL_FLOAT, 0, mPositions.data());
+
+    for (int iteration = 0; iteration < 8; ++iteration)
+    {
+        glDisable(GL_TEXTURE_2D);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::white);
+
+        // Both modes give the texture color with a white vertex color.
+        glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE,
+                  iteration % 2 == 0 ? GL_MODULATE : GL_REPLACE);
+        glEnable(GL_TEXTURE_2D);
+        glDrawArrays(GL_TRIANGLES, 0, 6);
+        EXPECT_PIXEL_COLOR_EQ(0, 0, GLColor::green);
+    }
+    EXPECT_GL_NO_ERROR();
+}
+
 // Check that glClearColorx, glClearDepthx, glLineWidthx, glPolygonOffsetx can work.
 TEST_P(BasicDrawTest, DepthTest)
 {
@@ -10,6 +10,8 @@
 #include "ANGLEPerfTest.h"
 
 #include "ANGLEPerfTestArgs.h"
+#include "HeapAllocationCounter.h"
+#include "SamplingProfiler.h"
 #include "common/debug.h"
 #include "common/mathutil.h"
 #include "common/platform.h"
@@ -221,6 +223,92 @@ double ComputeMean(const std::vector<double> &values)
     double mean = sum / static_cast<double>(values.size());
     return mean;
 }
+
+struct PerfCounterName
+{
+    std::string group;
+    std::string counter;
+};
+
+// Names of the counters of every perf monitor group, by group and counter index.
+std::map<std::pair<GLuint, GLuint>, PerfCounterName> GetPerfCounterNames()
+{
+    static constexpr size_t kBufSize = 1000;
+
+    std::map<std::pair<GLuint, GLuint>, PerfCounterName> names;
+
+    GLint numGroups = 0;
+    glGetPerfMonitorGroupsAMD(&numGroups, 0, nullptr);
+    std::vector<GLuint> groups(numGroups, 0);
+    glGetPerfMonitorGroupsAMD(nullptr, numGroups, groups.data());
+
+    for (GLuint group : groups)
+    {
+        char groupName[kBufSize] = {};
+        glGetPerfMonitorGroupStringAMD(group, kBufSize, nullptr, groupName);
+
+        GLint numCounters = 0;
+        glGetPerfMonitorCountersAMD(group, &numCounters, nullptr, 0, nullptr);
+        std::vector<GLuint> counters(numCounters, 0);
+        glGetPerfMonitorCountersAMD(group, nullptr, nullptr, numCounters, counters.data());
+
+        for (GLuint counter : counters)
+        {
+            char counterName[kBufSize] = {};
+            glGetPerfMonitorCounterStringAMD(group, counter, kBufSize, nullptr, counterName);
+            names[{group, counter}] = {groupName, counterName};
+        }
+    }
+
+    if (glGetError() != GL_NO_ERROR)
+    {
+        return {};
+    }
+    return names;
+}
+
+// Nearest-rank percentile of sorted values.
+double ComputePercentile(const std::vector<double> &sortedValues, double percentile)
+{
+    ASSERT(!sortedValues.empty());
+    size_t rank = static_cast<size_t>(
+        std::ceil(percentile / 100.0 * static_cast<double>(sortedValues.size())));
+    return sortedValues[std::max<size_t>(rank, 1) - 1];
+}
+
+// Stands in for the window of headless tests, which render to a pbuffer of the window size.
+class HeadlessWindow final : public OSWindow
+{
+  public:
+    void destroy() override {}
+    void disableErrorMessageDialog() override {}
+    void resetNativeWindow() override {}
+    EGLNativeWindowType getNativeWindow() const override { return EGLNativeWindowType(); }
+    EGLNativeDisplayType getNativeDisplay() const override { return EGL_DEFAULT_DISPLAY; }
+    void messageLoop() override {}
+    void setMousePosition(int x, int y) override {}
+    bool setOrientation(int width, int height) override { return true; }
+    bool setPosition(int x, int y) override { return true; }
+    bool resize(int width, int height) override
+    {
+        mWidth  = width;
+        mHeight = height;
+        return true;
+    }
+    void setVisible(bool isVisible) override {}
+    void signalTestEvent() override
+    {
+        Event event;
+        event.Type = Event::EVENT_TEST;
+        pushEvent(event);
+    }
+
+  private:
+    bool initializeImpl(const std::string &name, int width, int height) override
+    {
+        return resize(width, height);
+    }
+};
 }  // anonymous namespace
 
 TraceEvent::TraceEvent(char phaseIn,
@@ -265,6 +353,17 @@ ANGLEPerfTest::ANGLEPerfTest(const std::string &name,
     mReporter->RegisterFyiMetric(".trial_steps", "count");
     mReporter->RegisterFyiMetric(".total_steps", "count");
     mReporter->RegisterFyiMetric(".steps_to_run", "count");
+    mReporter->RegisterFyiMetric(".step_time_p50", "ms");
+    mReporter->RegisterFyiMetric(".step_time_p95", "ms");
+    mReporter->RegisterFyiMetric(".step_time_p99", "ms");
+    mReporter->RegisterFyiMetric(".step_time_max", "ms");
+    mReporter->RegisterFyiMetric(".steps_over_16ms", "count");
+    mReporter->RegisterFyiMetric(".steps_over_33ms", "count");
+    if (IsHeapAllocationCounterAvailable())
+    {
+        mReporter->RegisterFyiMetric(".heap_allocations_per_step_median", "count");
+        mReporter->RegisterFyiMetric(".heap_allocations_per_step_max", "count");
+    }
 }
 
 ANGLEPerfTest::~ANGLEPerfTest() {}
@@ -291,9 +390,17 @@ void ANGLEPerfTest::run()
         printf("Test Trials: %d\n", static_cast<int>(numTrials));
     }
 
+    // Only the measured trials are sampled, not the calibration and warm-up loops.
+    SamplingProfiler profiler;
+
     for (uint32_t trial = 0; trial < numTrials; ++trial)
     {
+        bool profiling = gEnableSamplingProfiler && profiler.start();
         doRunLoop(gMaxTrialTimeSeconds, mStepsToRun, RunLoopPolicy::RunContinuously);
+        if (profiling)
+        {
+            profiler.stop("trial_" + std::to_string(trial + 1));
+        }
         processResults();
         if (gVerboseLogging)
         {
@@ -306,6 +413,11 @@ void ANGLEPerfTest::run()
         }
     }
 
+    if (gEnableSamplingProfiler)
+    {
+        profiler.writeCollapsedStacks(gSamplingProfileFile);
+    }
+
     if (gVerboseLogging && !mTestTrialResults.empty())
     {
         double numResults = static_cast<double>(mTestTrialResults.size());
@@ -339,6 +451,8 @@ void ANGLEPerfTest::doRunLoop(double maxRunTime, int maxStepsToRun, RunLoopPolic
     mTrialNumStepsPerformed = 0;
     mRunning                = true;
     mGPUTimeNs              = 0;
+    mStepWallTimesMs.clear();
+    mStepHeapAllocationCounts.clear();
     mTimer.start();
     startTest();
 
@@ -362,6 +476,9 @@ void ANGLEPerfTest::doRunLoop(double maxRunTime, int maxStepsToRun, RunLoopPolic
         }
         else
         {
+            double stepStartTime            = mTimer.getElapsedWallClockTime();
+            uint64_t stepStartAllocationCount = GetHeapAllocationCount();
+
             step();
 
             if (runPolicy == RunLoopPolicy::FinishEveryStep)
@@ -369,10 +486,19 @@ void ANGLEPerfTest::doRunLoop(double maxRunTime, int maxStepsToRun, RunLoopPolic
                 glFinish();
             }
 
+            // Read before the results are recorded, which may allocate.
+            uint64_t stepAllocationCount = GetHeapAllocationCount() - stepStartAllocationCount;
+
             if (mRunning)
             {
                 mTrialNumStepsPerformed++;
                 mTotalNumStepsPerformed++;
+                mStepWallTimesMs.push_back(
+                    (mTimer.getElapsedWallClockTime() - stepStartTime) * kMilliSecondsPerSecond);
+                if (IsHeapAllocationCounterAvailable())
+                {
+                    mStepHeapAllocationCounts.push_back(stepAllocationCount);
+                }
             }
 
             if ((mTotalNumStepsPerformed % kNumberOfStepsPerformedToComputeGPUTime) == 0)
@@ -417,6 +543,9 @@ void ANGLEPerfTest::processResults()
         mReporter->AddResult(".total_steps", static_cast<size_t>(mTotalNumStepsPerformed));
     }
 
+    processStepTimeResults();
+    processHeapAllocationResults();
+
     if (!mProcessMemoryUsageKBSamples.empty())
     {
         std::sort(mProcessMemoryUsageKBSamples.begin(), mProcessMemoryUsageKBSamples.end());
@@ -521,6 +650,70 @@ void ANGLEPerfTest::processClockResult(const char *metric, double resultSeconds)
                                                  "msBestFitFormat_smallerIsBetter");
 }
 
+void ANGLEPerfTest::processStepTimeResults()
+{
+    if (mStepWallTimesMs.empty())
+    {
+        return;
+    }
+
+    // Means hide the occasional long step, like a frame stalled on a pipeline compile, so report
+    // the distribution of the step wall times as well.
+    std::vector<double> sortedTimesMs = mStepWallTimesMs;
+    std::sort(sortedTimesMs.begin(), sortedTimesMs.end());
+
+    const std::pair<const char *, double> kPercentiles[] = {
+        {".step_time_p50", 50.0}, {".step_time_p95", 95.0}, {".step_time_p99", 99.0}};
+    for (const auto &percentile : kPercentiles)
+    {
+        double resultMs = ComputePercentile(sortedTimesMs, percentile.second);
+        mReporter->AddResult(percentile.first, resultMs);
+        TestSuite::GetInstance()->addHistogramSample(mName + mBackend + percentile.first, mStory,
+                                                     resultMs, "msBestFitFormat_smallerIsBetter");
+    }
+
+    double maxMs = sortedTimesMs.back();
+    mReporter->AddResult(".step_time_max", maxMs);
+    TestSuite::GetInstance()->addHistogramSample(mName + mBackend + ".step_time_max", mStory,
+                                                 maxMs, "msBestFitFormat_smallerIsBetter");
+
+    // Steps that miss a 60 or 30 fps frame budget.
+    const std::pair<const char *, double> kBudgets[] = {{".steps_over_16ms", 1000.0 / 60.0},
+                                                        {".steps_over_33ms", 1000.0 / 30.0}};
+    for (const auto &budget : kBudgets)
+    {
+        size_t count = static_cast<size_t>(
+            sortedTimesMs.end() -
+            std::upper_bound(sortedTimesMs.begin(), sortedTimesMs.end(), budget.second));
+        mReporter->AddResult(budget.first, count);
+        TestSuite::GetInstance()->addHistogramSample(mName + mBackend + budget.first, mStory,
+                                                     static_cast<double>(count), "count");
+    }
+}
+
+void ANGLEPerfTest::processHeapAllocationResults()
+{
+    if (mStepHeapAllocationCounts.empty())
+    {
+        return;
+    }
+
+    // A well behaved draw path allocates nothing in the steady state, so any increase of the
+    // median is a regression.
+    std::vector<uint64_t> sortedCounts = mStepHeapAllocationCounts;
+    std::sort(sortedCounts.begin(), sortedCounts.end());
+
+    const std::pair<const char *, uint64_t> kResults[] = {
+        {".heap_allocations_per_step_median", sortedCounts[sortedCounts.size() / 2]},
+        {".heap_allocations_per_step_max", sortedCounts.back()}};
+    for (const auto &result : kResults)
+    {
+        mReporter->AddResult(result.first, static_cast<size_t>(result.second));
+        TestSuite::GetInstance()->addHistogramSample(mName + mBackend + result.first, mStory,
+                                                     static_cast<double>(result.second), "count");
+    }
+}
+
 void ANGLEPerfTest::processMemoryResult(const char *metric, uint64_t resultKB)
 {
     perf_test::MetricInfo metricInfo;
@@ -687,6 +880,9 @@ std::string RenderTestParams::story() const
         case SurfaceType::Offscreen:
             strstr << "_offscreen";
             break;
+        case SurfaceType::Headless:
+            strstr << "_headless";
+            break;
         default:
             UNREACHABLE();
             return "";
@@ -780,7 +976,20 @@ void ANGLERenderTest::SetUp()
     // Set a consistent CPU core affinity and high priority.
     StabilizeCPUForBenchmarking();
 
-    mOSWindow = OSWindow::New();
+    // Headless tests don't need a display, so they also run on machines without one.
+    if (mTestParams.surfaceType == SurfaceType::Headless)
+    {
+        if (mTestParams.driver == GLESDriverType::SystemWGL)
+        {
+            skipTest("Headless surfaces are not implemented with WGL.");
+            return;
+        }
+        mOSWindow = new HeadlessWindow();
+    }
+    else
+    {
+        mOSWindow = OSWindow::New();
+    }
 
     if (!mGLWindow)
     {
@@ -806,17 +1015,26 @@ void ANGLERenderTest::SetUp()
     // Override platform method parameter.
     EGLPlatformParameters withMethods = mTestParams.eglParameters;
     withMethods.platformMethods       = &mPlatformMethods;
+#if defined(ANGLE_PLATFORM_LINUX)
+    if (mTestParams.surfaceType == SurfaceType::Headless &&
+        withMethods.renderer == EGL_PLATFORM_ANGLE_TYPE_VULKAN_ANGLE)
+    {
+        // Otherwise the Vulkan back-end connects to the X11 or Wayland display.
+        withMethods.nativePlatformType = EGL_PLATFORM_VULKAN_DISPLAY_MODE_HEADLESS_ANGLE;
+    }
+#endif  // defined(ANGLE_PLATFORM_LINUX)
 
     // Request a common framebuffer config
-    mConfigParams.redBits     = 8;
-    mConfigParams.greenBits   = 8;
-    mConfigParams.blueBits    = 8;
-    mConfigParams.alphaBits   = 8;
-    mConfigParams.depthBits   = 24;
-    mConfigParams.stencilBits = 8;
-    mConfigParams.colorSpace  = mTestParams.colorSpace;
-    mConfigParams.multisample = mTestParams.multisample;
-    mConfigParams.samples     = mTestParams.samples;
+    mConfigParams.redBits        = 8;
+    mConfigParams.greenBits      = 8;
+    mConfigParams.blueBits       = 8;
+    mConfigParams.alphaBits      = 8;
+    mConfigParams.depthBits      = 24;
+    mConfigParams.stencilBits    = 8;
+    mConfigParams.colorSpace     = mTestParams.colorSpace;
+    mConfigParams.multisample    = mTestParams.multisample;
+    mConfigParams.samples        = mTestParams.samples;
+    mConfigParams.pbufferSurface = mTestParams.surfaceType == SurfaceType::Headless;
     if (mTestParams.surfaceType != SurfaceType::WindowWithVSync)
     {
         mConfigParams.swapInterval = 0;
@@ -951,7 +1169,7 @@ void ANGLERenderTest::initPerfCounters()
         return;
     }
 
-    CounterNameToIndexMap indexMap = BuildCounterNameToIndexMap();
+    std::map<std::pair<GLuint, GLuint>, PerfCounterName> counterNames = GetPerfCounterNames();
 
     std::vector<std::string> counters =
         angle::SplitString(gPerfCounters, ":", angle::WhitespaceHandling::TRIM_WHITESPACE,
@@ -960,34 +1178,39 @@ void ANGLERenderTest::initPerfCounters()
     {
         bool found = false;
 
-        for (const auto &indexMapIter : indexMap)
+        // Counters can be selected in a single group with "group/counter", or in every group
+        // with just the counter name.
+        bool matchGroupName = counter.find('/') != std::string::npos;
+
+        for (const auto &counterNameIter : counterNames)
         {
-            const std::string &indexMapName = indexMapIter.first;
-            if (NamesMatchWithWildcard(counter.c_str(), indexMapName.c_str()))
+            const std::string &groupName   = counterNameIter.second.group;
+            const std::string &counterName = counterNameIter.second.counter;
+            std::string matchedName = matchGroupName ? groupName + "/" + counterName : counterName;
+            if (NamesMatchWithWildcard(counter.c_str(), matchedName.c_str()))
             {
                 {
                     std::stringstream medianStr;
-                    medianStr << '.' << indexMapName << "_median";
+                    medianStr << '.' << counterName << "_median";
                     std::string medianName = medianStr.str();
                     mReporter->RegisterImportantMetric(medianName, "count");
                 }
 
                 {
                     std::stringstream maxStr;
-                    maxStr << '.' << indexMapName << "_max";
+                    maxStr << '.' << counterName << "_max";
                     std::string maxName = maxStr.str();
                     mReporter->RegisterImportantMetric(maxName, "count");
                 }
 
                 {
                     std::stringstream sumStr;
-                    sumStr << '.' << indexMapName << "_sum";
+                    sumStr << '.' << counterName << "_sum";
                     std::string sumName = sumStr.str();
                     mReporter->RegisterImportantMetric(sumName, "count");
                 }
 
-                GLuint index            = indexMapIter.second;
-                mPerfCounterInfo[index] = {indexMapName, {}};
+                mPerfCounterInfo[counterNameIter.first] = {counterName, {}};
 
                 found = true;
             }
@@ -1010,11 +1233,13 @@ void ANGLERenderTest::updatePerfCounters()
     std::vector<PerfMonitorTriplet> perfData = GetPerfMonitorTriplets();
     ASSERT(!perfData.empty());
 
-    for (auto &iter : mPerfCounterInfo)
+    for (const PerfMonitorTriplet &triplet : perfData)
     {
-        uint32_t counter               = iter.first;
-        std::vector<GLuint64> &samples = iter.second.samples;
-        samples.push_back(perfData[counter].value);
+        auto iter = mPerfCounterInfo.find({triplet.group, triplet.counter});
+        if (iter != mPerfCounterInfo.end())
+        {
+            iter->second.samples.push_back(triplet.value);
+        }
     }
 }
 
@@ -1087,7 +1312,7 @@ void ANGLERenderTest::step()
         if (mSwapEnabled)
         {
             updatePerfCounters();
-            mGLWindow->swap();
+            swap();
         }
         mOSWindow->messageLoop();
 
@@ -1109,6 +1334,19 @@ void ANGLERenderTest::step()
     endInternalTraceEvent("step");
 }
 
+void ANGLERenderTest::swap()
+{
+    // Swapping a pbuffer does nothing, but the work of the frame must still be submitted.
+    if (mTestParams.surfaceType == SurfaceType::Headless)
+    {
+        glFlush();
+    }
+    else
+    {
+        mGLWindow->swap();
+    }
+}
+
 void ANGLERenderTest::startGpuTimer()
 {
     if (mTestParams.trackGpuTime && mIsTimestampQueryAvailable)
@@ -1212,6 +1450,11 @@ void ANGLERenderTest::setRobustResourceInit(bool enabled)
     mConfigParams.robustResourceInit = enabled;
 }
 
+void ANGLERenderTest::setNoErrorEnabled(bool enabled)
+{
+    mConfigParams.noError = enabled;
+}
+
 std::vector<TraceEvent> &ANGLERenderTest::getTraceEventBuffer()
 {
     return mTraceEventBuffer;
@@ -111,6 +111,8 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
 
     void processResults();
     void processClockResult(const char *metric, double resultSeconds);
+    void processStepTimeResults();
+    void processHeapAllocationResults();
     void processMemoryResult(const char *metric, uint64_t resultKB);
 
     void skipTest(const std::string &reason)
@@ -139,13 +141,18 @@ class ANGLEPerfTest : public testing::Test, angle::NonCopyable
     int mIterationsPerStep;
     bool mRunning;
     std::vector<double> mTestTrialResults;
+    // Wall time of each step of the current trial.
+    std::vector<double> mStepWallTimesMs;
+    // Heap allocations made by each step of the current trial, if they can be counted.
+    std::vector<uint64_t> mStepHeapAllocationCounts;
 
     struct CounterInfo
     {
         std::string name;
         std::vector<GLuint64> samples;
     };
-    std::map<GLuint, CounterInfo> mPerfCounterInfo;
+    // Keyed by perf monitor group and counter index.
+    std::map<std::pair<GLuint, GLuint>, CounterInfo> mPerfCounterInfo;
     std::vector<uint64_t> mProcessMemoryUsageKBSamples;
 };
 
@@ -154,6 +161,8 @@ enum class SurfaceType
     Window,
     WindowWithVSync,
     Offscreen,
+    // Renders to a pbuffer without a window, and flushes instead of swapping.
+    Headless,
 };
 
 struct RenderTestParams : public angle::PlatformParameters
@@ -207,6 +216,7 @@ class ANGLERenderTest : public ANGLEPerfTest
 
     void setWebGLCompatibilityEnabled(bool webglCompatibility);
     void setRobustResourceInit(bool enabled);
+    void setNoErrorEnabled(bool enabled);
 
     void startGpuTimer();
     void stopGpuTimer();
@@ -217,6 +227,8 @@ class ANGLERenderTest : public ANGLEPerfTest
     void endGLTraceEvent(const char *name, double hostTimeSec);
 
     void disableTestHarnessSwap() { mSwapEnabled = false; }
+    // Only flushes with headless surfaces, which have nothing to present.
+    void swap();
     void updatePerfCounters();
 
     bool mIsTimestampQueryAvailable;
@@ -271,6 +283,14 @@ ParamsT Offscreen(const ParamsT &input)
     return output;
 }
 
+template <typename ParamsT>
+ParamsT Headless(const ParamsT &input)
+{
+    ParamsT output     = input;
+    output.surfaceType = SurfaceType::Headless;
+    return output;
+}
+
 template <typename ParamsT>
 ParamsT NullDevice(const ParamsT &input)
 {
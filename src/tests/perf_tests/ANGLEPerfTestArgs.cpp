@@ -13,23 +13,28 @@
 
 namespace angle
 {
-bool gCalibration              = false;
-int gStepsPerTrial             = 0;
-int gMaxStepsPerformed         = 0;
-bool gEnableTrace              = false;
-const char *gTraceFile         = "ANGLETrace.json";
-const char *gScreenShotDir     = nullptr;
-int gScreenShotFrame           = 1;
-bool gVerboseLogging           = false;
-double gCalibrationTimeSeconds = 1.0;
-double gMaxTrialTimeSeconds    = 10.0;
-int gTestTrials                = 3;
-bool gNoFinish                 = false;
-bool gEnableAllTraceTests      = false;
-bool gRetraceMode              = false;
-bool gMinimizeGPUWork          = false;
-bool gTraceTestValidation      = false;
-const char *gPerfCounters      = nullptr;
+bool gCalibration                = false;
+int gStepsPerTrial               = 0;
+int gMaxStepsPerformed           = 0;
+bool gEnableTrace                = false;
+const char *gTraceFile           = "ANGLETrace.json";
+bool gEnableSamplingProfiler     = false;
+const char *gSamplingProfileFile = "ANGLEProfile.txt";
+const char *gScreenShotDir       = nullptr;
+int gScreenShotFrame             = 1;
+bool gVerboseLogging             = false;
+double gCalibrationTimeSeconds   = 1.0;
+double gMaxTrialTimeSeconds      = 10.0;
+int gTestTrials                  = 3;
+bool gNoFinish                   = false;
+bool gEnableAllTraceTests        = false;
+bool gRetraceMode                = false;
+bool gMinimizeGPUWork            = false;
+bool gTraceTestValidation        = false;
+const char *gPerfCounters        = nullptr;
+const char *gShaderCorpus        = nullptr;
+int gOffscreenFramebufferCount   = 2;
+const char *gTraceFrameTimesFile = nullptr;
 
 // Default to three warmup loops. There's no science to this. More than two loops was experimentally
 // helpful on a Windows NVIDIA setup when testing with Vulkan and native trace tests.
@@ -74,6 +79,16 @@ void ANGLEProcessPerfTestArgs(int *argc, char **argv)
             // Skip an additional argument.
             argIndex++;
         }
+        else if (strcmp("--enable-sampling-profiler", argv[argIndex]) == 0)
+        {
+            gEnableSamplingProfiler = true;
+        }
+        else if (strcmp("--sampling-profile-file", argv[argIndex]) == 0 && argIndex < *argc - 1)
+        {
+            gSamplingProfileFile = argv[argIndex + 1];
+            // Skip an additional argument.
+            argIndex++;
+        }
         else if (strcmp("--calibration", argv[argIndex]) == 0)
         {
             gCalibration = true;
@@ -184,5 +199,24 @@ void ANGLEProcessPerfTestArgs(int *argc, char **argv)
             gPerfCounters = argv[argIndex + 1];
             argIndex++;
         }
+        else if (strcmp("--shader-corpus", argv[argIndex]) == 0 && argIndex < *argc - 1)
+        {
+            gShaderCorpus = argv[argIndex + 1];
+            // Skip an additional argument.
+            argIndex++;
+        }
+        else if (strcmp("--offscreen-framebuffer-count", argv[argIndex]) == 0 &&
+                 argIndex < *argc - 1)
+        {
+            gOffscreenFramebufferCount = ReadIntArgument(argv[argIndex + 1]);
+            // Skip an additional argument.
+            argIndex++;
+        }
+        else if (strcmp("--trace-frame-times-file", argv[argIndex]) == 0 && argIndex < *argc - 1)
+        {
+            gTraceFrameTimesFile = argv[argIndex + 1];
+            // Skip an additional argument.
+            argIndex++;
+        }
     }
 }
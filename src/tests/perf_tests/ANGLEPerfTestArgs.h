@@ -19,6 +19,8 @@ extern int gStepsPerTrial;
 extern int gMaxStepsPerformed;
 extern bool gEnableTrace;
 extern const char *gTraceFile;
+extern bool gEnableSamplingProfiler;
+extern const char *gSamplingProfileFile;
 extern const char *gScreenShotDir;
 extern int gScreenShotFrame;
 extern bool gVerboseLogging;
@@ -33,6 +35,9 @@ extern bool gRetraceMode;
 extern bool gMinimizeGPUWork;
 extern bool gTraceTestValidation;
 extern const char *gPerfCounters;
+extern const char *gShaderCorpus;
+extern int gOffscreenFramebufferCount;
+extern const char *gTraceFrameTimesFile;
 
 inline bool OneFrame()
 {
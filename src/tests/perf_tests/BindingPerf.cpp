@@ -9,6 +9,7 @@
 
 #include "ANGLEPerfTest.h"
 
+#include <algorithm>
 #include <iostream>
 #include <random>
 #include <sstream>
@@ -21,11 +22,15 @@ namespace angle
 namespace
 {
 constexpr unsigned int kIterationsPerStep = 128;
+// The number of texture units rebound before each draw in TestMode::Textures.
+constexpr GLint kTextureUnitCount = 16;
 
 enum TestMode
 {
     VertexArray,
     MultipleBindings,
+    // Rebinds a texture to every unit before each draw, like UI frameworks do.
+    Textures,
 };
 
 enum AllocationStyle
@@ -71,6 +76,10 @@ std::string BindingsParams::story() const
     {
         strstr << "_vertexarray";
     }
+    else if (testMode == TestMode::Textures)
+    {
+        strstr << "_" << numObjects << "_textures";
+    }
     else
     {
         strstr << "_" << numObjects << "_objects";
@@ -103,10 +112,16 @@ class BindingsBenchmark : public ANGLERenderTest,
     void drawBenchmark() override;
 
   private:
-    // TODO: Test binding perf of more than just buffers
+    void initializeTextures();
+    void drawTextures();
+
     std::vector<GLuint> mBuffers;
     std::vector<GLenum> mBindingPoints;
     GLuint mMaxVertexAttribs = 0;
+
+    std::vector<GLuint> mTextures;
+    GLuint mProgram     = 0;
+    GLint mTextureUnits = 0;
 };
 
 BindingsBenchmark::BindingsBenchmark() : ANGLERenderTest("Bindings", GetParam())
@@ -121,6 +136,12 @@ void BindingsBenchmark::initializeBenchmark()
 {
     const BindingsParams &params = GetParam();
 
+    if (params.testMode == TestMode::Textures)
+    {
+        initializeTextures();
+        return;
+    }
+
     mBuffers.resize(params.numObjects, 0);
     if (params.allocationStyle == AT_INITIALIZATION)
     {
@@ -161,19 +182,103 @@ void BindingsBenchmark::initializeBenchmark()
     glGetIntegerv(GL_MAX_VERTEX_ATTRIBS, reinterpret_cast<GLint *>(&mMaxVertexAttribs));
 }
 
+void BindingsBenchmark::initializeTextures()
+{
+    const BindingsParams &params = GetParam();
+
+    glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &mTextureUnits);
+    mTextureUnits = std::min(mTextureUnits, kTextureUnitCount);
+
+    // Sample every unit so that all of them are active in the program.
+    std::stringstream fs;
+    fs << "precision mediump float;\n"
+       << "uniform sampler2D u_textures[" << mTextureUnits << "];\n"
+       << "void main()\n"
+       << "{\n"
+       << "    vec4 color = vec4(0);\n";
+    for (GLint unit = 0; unit < mTextureUnits; ++unit)
+    {
+        fs << "    color += texture2D(u_textures[" << unit << "], vec2(0.5));\n";
+    }
+    fs << "    gl_FragColor = color;\n"
+       << "}\n";
+
+    constexpr char kVS[] = R"(void main()
+{
+    gl_Position  = vec4(0, 0, 0, 1);
+    gl_PointSize = 1.0;
+})";
+
+    mProgram = CompileProgram(kVS, fs.str().c_str());
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    std::vector<GLint> units(mTextureUnits);
+    for (GLint unit = 0; unit < mTextureUnits; ++unit)
+    {
+        units[unit] = unit;
+    }
+    glUniform1iv(glGetUniformLocation(mProgram, "u_textures"), mTextureUnits, units.data());
+
+    constexpr GLubyte kWhite[4] = {255, 255, 255, 255};
+    mTextures.resize(params.numObjects);
+    glGenTextures(static_cast<GLsizei>(mTextures.size()), mTextures.data());
+    for (GLuint texture : mTextures)
+    {
+        glBindTexture(GL_TEXTURE_2D, texture);
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, kWhite);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
 void BindingsBenchmark::destroyBenchmark()
 {
     const BindingsParams &params = GetParam();
+    if (params.testMode == TestMode::Textures)
+    {
+        glDeleteTextures(static_cast<GLsizei>(mTextures.size()), mTextures.data());
+        glDeleteProgram(mProgram);
+        return;
+    }
+
     if (params.allocationStyle == AT_INITIALIZATION)
     {
         glDeleteBuffers(static_cast<GLsizei>(mBuffers.size()), mBuffers.data());
     }
 }
 
+void BindingsBenchmark::drawTextures()
+{
+    const BindingsParams &params = GetParam();
+    const size_t textureCount    = mTextures.size();
+
+    for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
+    {
+        // Bind a different texture to every unit for each draw.
+        for (GLint unit = 0; unit < mTextureUnits; ++unit)
+        {
+            glActiveTexture(GL_TEXTURE0 + unit);
+            glBindTexture(GL_TEXTURE_2D, mTextures[(it + unit) % textureCount]);
+        }
+        glDrawArrays(GL_POINTS, 0, 1);
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
 void BindingsBenchmark::drawBenchmark()
 {
     const BindingsParams &params = GetParam();
 
+    if (params.testMode == TestMode::Textures)
+    {
+        drawTextures();
+        return;
+    }
+
     for (unsigned int it = 0; it < params.iterationsPerStep; ++it)
     {
         // Generate a buffer (if needed) and bind it to a "random" binding point
@@ -242,6 +347,16 @@ BindingsParams VulkanParams(AllocationStyle allocationStyle, TestMode testMode)
     return params;
 }
 
+BindingsParams VulkanTexturesParams()
+{
+    BindingsParams params;
+    params.eglParameters   = egl_platform::VULKAN_NULL();
+    params.allocationStyle = AT_INITIALIZATION;
+    params.testMode        = TestMode::Textures;
+    params.numObjects      = 64;
+    return params;
+}
+
 TEST_P(BindingsBenchmark, Run)
 {
     run();
@@ -255,6 +370,7 @@ ANGLE_INSTANTIATE_TEST(BindingsBenchmark,
                        OpenGLOrGLESParams(AT_INITIALIZATION),
                        VulkanParams(EVERY_ITERATION, TestMode::MultipleBindings),
                        VulkanParams(AT_INITIALIZATION, TestMode::MultipleBindings),
-                       VulkanParams(AT_INITIALIZATION, TestMode::VertexArray));
+                       VulkanParams(AT_INITIALIZATION, TestMode::VertexArray),
+                       VulkanTexturesParams());
 
 }  // namespace angle
@@ -11,6 +11,8 @@
 
 #include <gmock/gmock.h>
 
+#include <array>
+
 #include "common/bitset_utils.h"
 
 using namespace testing;
@@ -46,6 +48,29 @@ void BitSetIteratorPerfTest<T>::step()
     mBits.reset();
 }
 
+// Same as BitSetIteratorPerfTest, with the set bits gathered before they are visited.
+template <typename T>
+class BitSetGatherPerfTest : public BitSetIteratorPerfTest<T>
+{
+  public:
+    void step() override;
+};
+
+template <typename T>
+void BitSetGatherPerfTest<T>::step()
+{
+    this->mBits.flip();
+
+    std::array<size_t, T().size()> indices;
+    size_t count = this->mBits.gatherSetBits(indices.data());
+    for (size_t index = 0; index < count; ++index)
+    {
+        ANGLE_UNUSED_VARIABLE(indices[index]);
+    }
+
+    this->mBits.reset();
+}
+
 using TestTypes = Types<angle::BitSet32<32>,
                         angle::BitSet64<32>,
                         angle::BitSet64<64>,
@@ -72,4 +97,11 @@ TYPED_TEST(BitSetIteratorPerfTest, Run)
     this->run();
 }
 
+TYPED_TEST_SUITE(BitSetGatherPerfTest, TestTypes, BitSetIteratorTypeNames);
+
+TYPED_TEST(BitSetGatherPerfTest, Run)
+{
+    this->run();
+}
+
 }  // anonymous namespace
@@ -21,7 +21,8 @@ enum class BufferType
     COLOR,
     DEPTH,
     STENCIL,
-    DEPTH_STENCIL
+    DEPTH_STENCIL,
+    SRGB_COLOR_TEXTURE
 };
 
 const char *BufferTypeString(BufferType type)
@@ -36,6 +37,8 @@ const char *BufferTypeString(BufferType type)
             return "stencil";
         case BufferType::DEPTH_STENCIL:
             return "depth_stencil";
+        case BufferType::SRGB_COLOR_TEXTURE:
+            return "srgb_color_texture";
         default:
             return "error";
     }
@@ -46,6 +49,7 @@ GLbitfield BufferTypeMask(BufferType type)
     switch (type)
     {
         case BufferType::COLOR:
+        case BufferType::SRGB_COLOR_TEXTURE:
             return GL_COLOR_BUFFER_BIT;
         case BufferType::DEPTH:
             return GL_DEPTH_BUFFER_BIT;
@@ -70,6 +74,8 @@ GLenum BufferTypeFormat(BufferType type)
             return GL_STENCIL_INDEX8;
         case BufferType::DEPTH_STENCIL:
             return GL_DEPTH24_STENCIL8;
+        case BufferType::SRGB_COLOR_TEXTURE:
+            return GL_SRGB8_ALPHA8;
         default:
             return GL_NONE;
     }
@@ -80,6 +86,7 @@ GLenum BufferTypeAttachment(BufferType type)
     switch (type)
     {
         case BufferType::COLOR:
+        case BufferType::SRGB_COLOR_TEXTURE:
             return GL_COLOR_ATTACHMENT0;
         case BufferType::DEPTH:
             return GL_DEPTH_ATTACHMENT;
@@ -141,6 +148,8 @@ class BlitFramebufferPerf : public ANGLERenderTest,
     GLuint mReadRenderbuffer = 0;
     GLuint mDrawFramebuffer  = 0;
     GLuint mDrawRenderbuffer = 0;
+    GLuint mReadTexture      = 0;
+    GLuint mDrawTexture      = 0;
 };
 
 void BlitFramebufferPerf::initializeBenchmark()
@@ -163,6 +172,27 @@ void BlitFramebufferPerf::initializeBenchmark()
     GLuint size       = param.framebufferSize;
     GLenum attachment = BufferTypeAttachment(param.type);
 
+    // Texture attachments of the same format can be blitted with a copy on some backends.
+    if (param.type == BufferType::SRGB_COLOR_TEXTURE)
+    {
+        ASSERT_EQ(0u, param.samples);
+
+        glGenTextures(1, &mReadTexture);
+        glBindTexture(GL_TEXTURE_2D, mReadTexture);
+        glTexStorage2D(GL_TEXTURE_2D, 1, format, size, size);
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, attachment, GL_TEXTURE_2D, mReadTexture, 0);
+        ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_READ_FRAMEBUFFER));
+
+        glGenTextures(1, &mDrawTexture);
+        glBindTexture(GL_TEXTURE_2D, mDrawTexture);
+        glTexStorage2D(GL_TEXTURE_2D, 1, format, size, size);
+        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, attachment, GL_TEXTURE_2D, mDrawTexture, 0);
+        ASSERT_GLENUM_EQ(GL_FRAMEBUFFER_COMPLETE, glCheckFramebufferStatus(GL_DRAW_FRAMEBUFFER));
+
+        ASSERT_GL_NO_ERROR();
+        return;
+    }
+
     glBindRenderbuffer(GL_RENDERBUFFER, mReadRenderbuffer);
     glRenderbufferStorageMultisample(GL_RENDERBUFFER, param.samples, format, size, size);
     glFramebufferRenderbuffer(GL_READ_FRAMEBUFFER, attachment, GL_RENDERBUFFER, mReadRenderbuffer);
@@ -182,6 +212,8 @@ void BlitFramebufferPerf::destroyBenchmark()
     glDeleteRenderbuffers(1, &mReadRenderbuffer);
     glDeleteFramebuffers(1, &mDrawFramebuffer);
     glDeleteRenderbuffers(1, &mDrawRenderbuffer);
+    glDeleteTextures(1, &mReadTexture);
+    glDeleteTextures(1, &mDrawTexture);
 }
 
 void BlitFramebufferPerf::drawBenchmark()
@@ -197,6 +229,7 @@ void BlitFramebufferPerf::drawBenchmark()
     switch (param.type)
     {
         case BufferType::COLOR:
+        case BufferType::SRGB_COLOR_TEXTURE:
         {
             GLfloat clearValues[4] = {1.0f, 0.0f, 0.0f, 1.0f};
             glClearBufferfv(GL_COLOR, 0, clearValues);
@@ -238,6 +271,15 @@ BlitFramebufferParams D3D11(BufferType type, unsigned int samples)
     params.samples       = samples;
     return params;
 }
+
+BlitFramebufferParams OpenGL(BufferType type, unsigned int samples)
+{
+    BlitFramebufferParams params;
+    params.eglParameters = angle::egl_platform::OPENGL();
+    params.type          = type;
+    params.samples       = samples;
+    return params;
+}
 }  // anonymous namespace
 
 // TODO(jmadill): Programatically generate these combinations.
@@ -249,7 +291,9 @@ ANGLE_INSTANTIATE_TEST(BlitFramebufferPerf,
                        D3D11(BufferType::COLOR, 2),
                        D3D11(BufferType::DEPTH, 2),
                        D3D11(BufferType::STENCIL, 2),
-                       D3D11(BufferType::DEPTH_STENCIL, 2));
+                       D3D11(BufferType::DEPTH_STENCIL, 2),
+                       OpenGL(BufferType::COLOR, 0),
+                       OpenGL(BufferType::SRGB_COLOR_TEXTURE, 0));
 
 // This test suite is not instantiated on some OSes.
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(BlitFramebufferPerf);
@@ -36,6 +36,7 @@ struct ClearParams final : public RenderTestParams
         internalFormat = GL_RGBA8;
 
         scissoredClear = false;
+        clearBuffers   = false;
     }
 
     std::string story() const override;
@@ -46,6 +47,9 @@ struct ClearParams final : public RenderTestParams
     GLenum internalFormat;
 
     bool scissoredClear;
+    // Clear each draw buffer of a multiple render target framebuffer individually, then clear a
+    // few scissored regions of them.
+    bool clearBuffers;
 };
 
 std::ostream &operator<<(std::ostream &os, const ClearParams &params)
@@ -70,6 +74,11 @@ std::string ClearParams::story() const
         strstr << "_scissoredClear";
     }
 
+    if (clearBuffers)
+    {
+        strstr << "_clearBuffers";
+    }
+
     return strstr.str();
 }
 
@@ -84,6 +93,7 @@ class ClearBenchmark : public ANGLERenderTest, public ::testing::WithParamInterf
 
   private:
     void initShaders();
+    void drawClearBuffersBenchmark();
 
     std::vector<GLuint> mTextures;
 
@@ -138,6 +148,12 @@ void ClearBenchmark::drawBenchmark()
 {
     const auto &params = GetParam();
 
+    if (params.clearBuffers)
+    {
+        drawClearBuffersBenchmark();
+        return;
+    }
+
     GLRenderbuffer colorRbo;
     glBindRenderbuffer(GL_RENDERBUFFER, colorRbo);
     glRenderbufferStorage(GL_RENDERBUFFER, params.internalFormat, params.fboSize, params.fboSize);
@@ -192,6 +208,61 @@ void ClearBenchmark::drawBenchmark()
     ASSERT_GL_NO_ERROR();
 }
 
+void ClearBenchmark::drawClearBuffersBenchmark()
+{
+    const auto &params = GetParam();
+
+    constexpr GLuint kDrawBufferCount = 4;
+
+    GLRenderbuffer colorRbos[kDrawBufferCount];
+    GLFramebuffer fbo;
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+
+    GLenum drawBuffers[kDrawBufferCount];
+    for (GLuint index = 0; index < kDrawBufferCount; ++index)
+    {
+        glBindRenderbuffer(GL_RENDERBUFFER, colorRbos[index]);
+        glRenderbufferStorage(GL_RENDERBUFFER, params.internalFormat, params.fboSize,
+                              params.fboSize);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0 + index, GL_RENDERBUFFER,
+                                  colorRbos[index]);
+        drawBuffers[index] = GL_COLOR_ATTACHMENT0 + index;
+    }
+    glDrawBuffers(kDrawBufferCount, drawBuffers);
+
+    glViewport(0, 0, params.fboSize, params.fboSize);
+
+    startGpuTimer();
+
+    const GLsizei tileSize = params.fboSize / 4;
+    for (size_t it = 0; it < params.iterationsPerStep; ++it)
+    {
+        glDisable(GL_SCISSOR_TEST);
+        for (GLuint index = 0; index < kDrawBufferCount; ++index)
+        {
+            const float clearValue[4] = {(it % 2) * 0.5f, index * 0.25f, 0.0f, 1.0f};
+            glClearBufferfv(GL_COLOR, index, clearValue);
+        }
+
+        // Clear the diagonal tiles of all draw buffers to the same color.
+        glEnable(GL_SCISSOR_TEST);
+        glClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+        for (GLsizei tile = 0; tile < 4; ++tile)
+        {
+            glScissor(tile * tileSize, tile * tileSize, tileSize, tileSize);
+            glClear(GL_COLOR_BUFFER_BIT);
+        }
+
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+
+    stopGpuTimer();
+
+    glDisable(GL_SCISSOR_TEST);
+
+    ASSERT_GL_NO_ERROR();
+}
+
 ClearParams D3D11Params()
 {
     ClearParams params;
@@ -218,6 +289,15 @@ ClearParams VulkanParams(bool emulatedFormat, bool scissoredClear)
     return params;
 }
 
+ClearParams VulkanClearBuffersParams()
+{
+    ClearParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    params.majorVersion  = 3;
+    params.clearBuffers  = true;
+    return params;
+}
+
 }  // anonymous namespace
 
 TEST_P(ClearBenchmark, Run)
@@ -230,4 +310,5 @@ ANGLE_INSTANTIATE_TEST(ClearBenchmark,
                        OpenGLOrGLESParams(),
                        VulkanParams(false, false),
                        VulkanParams(true, false),
-                       VulkanParams(false, true));
+                       VulkanParams(false, true),
+                       VulkanClearBuffersParams());
@@ -11,6 +11,8 @@
 
 #include "ANGLEPerfTest.h"
 
+#include <sstream>
+
 #include "GLSLANG/ShaderLang.h"
 #include "compiler/translator/Compiler.h"
 #include "compiler/translator/InitializeGlobals.h"
@@ -162,13 +164,48 @@ void main()
 
 const char *kTrickyESSL300Id = "TrickyESSL300";
 
+// Uber-shaders often define a large number of macros, many of which take arguments.  The time
+// spent compiling this shader is dominated by preprocessing.
+const char *GetMacroHeavyESSL300FragSource()
+{
+    static const std::string source = [] {
+        constexpr int kMacroCount = 1000;
+
+        std::ostringstream stream;
+        stream << "#version 300 es\n"
+                  "precision highp float;\n"
+                  "out vec4 outColor;\n"
+                  "#define ADD(a, b) ((a) + (b))\n"
+                  "#define SCALE(a, s) ADD((a) * (s), 0.0)\n";
+        for (int macro = 0; macro < kMacroCount; ++macro)
+        {
+            stream << "#define VALUE_" << macro << " SCALE(" << macro << ".0, 0.001)\n";
+        }
+        stream << "void main()\n"
+                  "{\n"
+                  "    float v = 0.0;\n";
+        for (int macro = 0; macro < kMacroCount; macro += 10)
+        {
+            stream << "    v = ADD(v, VALUE_" << macro << ");\n";
+        }
+        stream << "    outColor = vec4(v);\n"
+                  "}\n";
+        return stream.str();
+    }();
+    return source.c_str();
+}
+
+const char *kMacroHeavyESSL300Id = "MacroHeavyESSL300";
+
 constexpr int kNumIterationsPerStep = 4;
 
 struct CompilerParameters
 {
-    CompilerParameters() { output = SH_HLSL_4_1_OUTPUT; }
+    CompilerParameters() : output(SH_HLSL_4_1_OUTPUT), compileOptions(0) {}
 
-    CompilerParameters(ShShaderOutput output) : output(output) {}
+    CompilerParameters(ShShaderOutput output, ShCompileOptions compileOptions = 0)
+        : output(output), compileOptions(compileOptions)
+    {}
 
     const char *str() const
     {
@@ -180,6 +217,9 @@ struct CompilerParameters
                 return "GLSL_4_50";
             case SH_ESSL_OUTPUT:
                 return "ESSL";
+            case SH_SPIRV_VULKAN_OUTPUT:
+                return (compileOptions & SH_GENERATE_SPIRV_THROUGH_GLSLANG) != 0 ? "SPIRV_glslang"
+                                                                                 : "SPIRV";
             default:
                 UNREACHABLE();
                 return "unk";
@@ -187,6 +227,7 @@ struct CompilerParameters
     }
 
     ShShaderOutput output;
+    ShCompileOptions compileOptions;
 };
 
 bool IsPlatformAvailable(const CompilerParameters &param)
@@ -195,6 +236,7 @@ bool IsPlatformAvailable(const CompilerParameters &param)
     {
         case SH_HLSL_4_1_OUTPUT:
         case SH_HLSL_3_0_OUTPUT:
+        case SH_SPIRV_VULKAN_OUTPUT:
         {
             angle::PoolAllocator allocator;
             InitializePoolIndex();
@@ -224,8 +266,9 @@ struct CompilerPerfParameters final : public CompilerParameters
 {
     CompilerPerfParameters(ShShaderOutput output,
                            const char *shaderSource,
-                           const char *shaderSourceId)
-        : CompilerParameters(output), shaderSource(shaderSource)
+                           const char *shaderSourceId,
+                           ShCompileOptions compileOptions = 0)
+        : CompilerParameters(output, compileOptions), shaderSource(shaderSource)
     {
         testId = shaderSourceId;
         testId += "_";
@@ -278,6 +321,11 @@ void CompilerPerfTest::SetUp()
 
     const auto &params = GetParam();
 
+    if ((params.compileOptions & SH_GENERATE_SPIRV_THROUGH_GLSLANG) != 0)
+    {
+        sh::InitializeGlslang();
+    }
+
     mTranslator = sh::ConstructCompiler(GL_FRAGMENT_SHADER, SH_WEBGL2_SPEC, params.output);
     sh::InitBuiltInResources(&mResources);
     mResources.FragmentPrecisionHigh = true;
@@ -291,8 +339,18 @@ void CompilerPerfTest::SetUp()
 
 void CompilerPerfTest::TearDown()
 {
+    if (mTranslator)
+    {
+        processMemoryResult(".peak_pool_allocator_size",
+                            mTranslator->getPeakPoolAllocatorBytes() / 1024);
+    }
     SafeDelete(mTranslator);
 
+    if ((GetParam().compileOptions & SH_GENERATE_SPIRV_THROUGH_GLSLANG) != 0)
+    {
+        sh::FinalizeGlslang();
+    }
+
     SetGlobalPoolAllocator(nullptr);
     mAllocator.pop();
 
@@ -307,6 +365,7 @@ void CompilerPerfTest::step()
 
     ShCompileOptions compileOptions = SH_OBJECT_CODE | SH_VARIABLES |
                                       SH_INITIALIZE_UNINITIALIZED_LOCALS | SH_INIT_OUTPUT_VARIABLES;
+    compileOptions |= GetParam().compileOptions;
 
 #if !defined(NDEBUG)
     // Make sure that compilation succeeds and print the info log if it doesn't in debug mode.
@@ -343,6 +402,42 @@ ANGLE_INSTANTIATE_TEST(
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
     CompilerPerfParameters(SH_ESSL_OUTPUT, kRealWorldESSL100FragSource, kRealWorldESSL100Id),
-    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+    CompilerPerfParameters(SH_ESSL_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id),
+    CompilerPerfParameters(SH_ESSL_OUTPUT, GetMacroHeavyESSL300FragSource(), kMacroHeavyESSL300Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT, kSimpleESSL100FragSource, kSimpleESSL100Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT, kSimpleESSL300FragSource, kSimpleESSL300Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                           kRealWorldESSL100FragSource,
+                           kRealWorldESSL100Id),
+    CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT, kTrickyESSL300FragSource, kTrickyESSL300Id));
+
+#if defined(ANGLE_ENABLE_SPIRV_GENERATION_THROUGH_GLSLANG)
+// Generates SPIR-V by translating to GLSL and compiling it with glslang, to compare with the direct
+// SPIR-V generation above.
+using CompilerPerfThroughGlslangTest = CompilerPerfTest;
+
+TEST_P(CompilerPerfThroughGlslangTest, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(CompilerPerfThroughGlslangTest,
+                       CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                                              kSimpleESSL100FragSource,
+                                              kSimpleESSL100Id,
+                                              SH_GENERATE_SPIRV_THROUGH_GLSLANG),
+                       CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                                              kSimpleESSL300FragSource,
+                                              kSimpleESSL300Id,
+                                              SH_GENERATE_SPIRV_THROUGH_GLSLANG),
+                       CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                                              kRealWorldESSL100FragSource,
+                                              kRealWorldESSL100Id,
+                                              SH_GENERATE_SPIRV_THROUGH_GLSLANG),
+                       CompilerPerfParameters(SH_SPIRV_VULKAN_OUTPUT,
+                                              kTrickyESSL300FragSource,
+                                              kTrickyESSL300Id,
+                                              SH_GENERATE_SPIRV_THROUGH_GLSLANG));
+#endif  // defined(ANGLE_ENABLE_SPIRV_GENERATION_THROUGH_GLSLANG)
 
 }  // anonymous namespace
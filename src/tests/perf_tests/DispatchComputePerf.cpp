@@ -29,6 +29,8 @@ struct DispatchComputePerfParams final : public RenderTestParams
     unsigned int localSizeY    = 16;
     unsigned int textureWidth  = 32;
     unsigned int textureHeight = 32;
+    // Draw with a graphics program between the dispatches.
+    bool interleaveDraws = false;
 };
 
 std::string DispatchComputePerfParams::story() const
@@ -40,6 +42,10 @@ std::string DispatchComputePerfParams::story() const
     {
         storyStr << "_null";
     }
+    if (interleaveDraws)
+    {
+        storyStr << "_interleaved_draws";
+    }
     return storyStr.str();
 }
 
@@ -61,9 +67,11 @@ class DispatchComputePerfBenchmark : public ANGLERenderTest,
 
   private:
     void initComputeShader();
+    void initDrawProgram();
     void initTextures();
 
     GLuint mProgram      = 0;
+    GLuint mDrawProgram  = 0;
     GLuint mReadTexture  = 0;
     GLuint mWriteTexture = 0;
     GLuint mDispatchX    = 0;
@@ -80,6 +88,10 @@ void DispatchComputePerfBenchmark::initializeBenchmark()
 
     initComputeShader();
     initTextures();
+    if (params.interleaveDraws)
+    {
+        initDrawProgram();
+    }
 
     glUseProgram(mProgram);
     glActiveTexture(GL_TEXTURE0);
@@ -112,6 +124,12 @@ void main() {
     ASSERT_NE(0u, mProgram);
 }
 
+void DispatchComputePerfBenchmark::initDrawProgram()
+{
+    mDrawProgram = CompileProgram(essl1_shaders::vs::Simple(), essl1_shaders::fs::Red());
+    ASSERT_NE(0u, mDrawProgram);
+}
+
 void DispatchComputePerfBenchmark::initTextures()
 {
     const auto &params = GetParam();
@@ -140,6 +158,7 @@ void DispatchComputePerfBenchmark::initTextures()
 void DispatchComputePerfBenchmark::destroyBenchmark()
 {
     glDeleteProgram(mProgram);
+    glDeleteProgram(mDrawProgram);
     glDeleteTextures(1, &mReadTexture);
     glDeleteTextures(1, &mWriteTexture);
 }
@@ -151,15 +170,33 @@ void DispatchComputePerfBenchmark::drawBenchmark()
     {
         glDispatchCompute(mDispatchX, mDispatchY, 1);
         glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+
+        if (params.interleaveDraws)
+        {
+            glUseProgram(mDrawProgram);
+            glDrawArrays(GL_TRIANGLES, 0, 3);
+            glUseProgram(mProgram);
+        }
     }
     ASSERT_GL_NO_ERROR();
 }
 
-DispatchComputePerfParams DispatchComputePerfOpenGLOrGLESParams(bool useNullDevice)
+DispatchComputePerfParams DispatchComputePerfOpenGLOrGLESParams(bool useNullDevice,
+                                                                bool interleaveDraws)
+{
+    DispatchComputePerfParams params;
+    params.eglParameters   = useNullDevice ? angle::egl_platform::OPENGL_OR_GLES_NULL()
+                                           : angle::egl_platform::OPENGL_OR_GLES();
+    params.interleaveDraws = interleaveDraws;
+    return params;
+}
+
+DispatchComputePerfParams DispatchComputePerfVulkanParams(bool useNullDevice, bool interleaveDraws)
 {
     DispatchComputePerfParams params;
-    params.eglParameters = useNullDevice ? angle::egl_platform::OPENGL_OR_GLES_NULL()
-                                         : angle::egl_platform::OPENGL_OR_GLES();
+    params.eglParameters =
+        useNullDevice ? angle::egl_platform::VULKAN_NULL() : angle::egl_platform::VULKAN();
+    params.interleaveDraws = interleaveDraws;
     return params;
 }
 
@@ -170,7 +207,12 @@ TEST_P(DispatchComputePerfBenchmark, Run)
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(DispatchComputePerfBenchmark);
 ANGLE_INSTANTIATE_TEST(DispatchComputePerfBenchmark,
-                       DispatchComputePerfOpenGLOrGLESParams(true),
-                       DispatchComputePerfOpenGLOrGLESParams(false));
+                       DispatchComputePerfOpenGLOrGLESParams(true, false),
+                       DispatchComputePerfOpenGLOrGLESParams(false, false),
+                       DispatchComputePerfOpenGLOrGLESParams(false, true),
+                       DispatchComputePerfVulkanParams(true, false),
+                       DispatchComputePerfVulkanParams(false, false),
+                       DispatchComputePerfVulkanParams(true, true),
+                       DispatchComputePerfVulkanParams(false, true));
 
 }  // namespace
@@ -42,6 +42,7 @@ struct DrawArraysPerfParams : public DrawCallPerfParams
     std::string story() const override;
 
     StateChange stateChange = StateChange::NoChange;
+    bool noError            = false;
 };
 
 std::string DrawArraysPerfParams::story() const
@@ -83,6 +84,11 @@ std::string DrawArraysPerfParams::story() const
             break;
     }
 
+    if (noError)
+    {
+        strstr << "_no_error";
+    }
+
     return strstr.str();
 }
 
@@ -146,7 +152,10 @@ class DrawCallPerfBenchmark : public ANGLERenderTest,
     size_t mCurrentVBO = 0;
 };
 
-DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf", GetParam()) {}
+DrawCallPerfBenchmark::DrawCallPerfBenchmark() : ANGLERenderTest("DrawCallPerf", GetParam())
+{
+    setNoErrorEnabled(GetParam().noError);
+}
 
 void DrawCallPerfBenchmark::initializeBenchmark()
 {
@@ -642,14 +651,23 @@ DrawArraysPerfParams CombineStateChange(const DrawArraysPerfParams &in, StateCha
     return out;
 }
 
+DrawArraysPerfParams CombineNoError(const DrawArraysPerfParams &in, bool noError)
+{
+    DrawArraysPerfParams out = in;
+    out.noError              = noError;
+    return out;
+}
+
 using P = DrawArraysPerfParams;
 
 std::vector<P> gTestsWithStateChange =
     CombineWithValues({P()}, angle::AllEnums<StateChange>(), CombineStateChange);
+std::vector<P> gTestsWithNoError =
+    CombineWithValues(gTestsWithStateChange, {false, true}, CombineNoError);
 std::vector<P> gTestsWithRenderer =
-    CombineWithFuncs(gTestsWithStateChange, {D3D11<P>, GL<P>, Vulkan<P>, WGL<P>});
-std::vector<P> gTestsWithDevice =
-    CombineWithFuncs(gTestsWithRenderer, {Passthrough<P>, Offscreen<P>, NullDevice<P>});
+    CombineWithFuncs(gTestsWithNoError, {D3D11<P>, GL<P>, Vulkan<P>, WGL<P>});
+std::vector<P> gTestsWithDevice = CombineWithFuncs(
+    gTestsWithRenderer, {Passthrough<P>, Offscreen<P>, Headless<P>, NullDevice<P>});
 
 ANGLE_INSTANTIATE_TEST_ARRAY(DrawCallPerfBenchmark, gTestsWithDevice);
 
@@ -24,28 +24,44 @@ class EGLMakeCurrentPerfTest : public ANGLEPerfTest,
                                public WithParamInterface<angle::PlatformParameters>
 {
   public:
-    EGLMakeCurrentPerfTest();
+    EGLMakeCurrentPerfTest() : EGLMakeCurrentPerfTest("_run", 2, false) {}
 
     void step() override;
     void SetUp() override;
     void TearDown() override;
 
+  protected:
+    // With |drawBetweenSwitches|, the contexts are in the same share group and each clears the
+    // surface before switching to the next one, like applications that render with several
+    // contexts every frame.
+    EGLMakeCurrentPerfTest(const char *story, size_t contextCount, bool drawBetweenSwitches);
+
   private:
     OSWindow *mOSWindow;
     EGLDisplay mDisplay;
     EGLSurface mSurface;
     EGLConfig mConfig;
-    std::array<EGLContext, 2> mContexts;
+    std::vector<EGLContext> mContexts;
+    bool mDrawBetweenSwitches;
     std::unique_ptr<angle::Library> mEGLLibrary;
 };
 
-EGLMakeCurrentPerfTest::EGLMakeCurrentPerfTest()
-    : ANGLEPerfTest("EGLMakeCurrent", "", "_run", ITERATIONS),
+class EGLMakeCurrentShareGroupPerfTest : public EGLMakeCurrentPerfTest
+{
+  public:
+    EGLMakeCurrentShareGroupPerfTest() : EGLMakeCurrentPerfTest("_share_group_clear", 4, true) {}
+};
+
+EGLMakeCurrentPerfTest::EGLMakeCurrentPerfTest(const char *story,
+                                               size_t contextCount,
+                                               bool drawBetweenSwitches)
+    : ANGLEPerfTest("EGLMakeCurrent", "", story, ITERATIONS),
       mOSWindow(nullptr),
       mDisplay(EGL_NO_DISPLAY),
       mSurface(EGL_NO_SURFACE),
       mConfig(nullptr),
-      mContexts({})
+      mContexts(contextCount, EGL_NO_CONTEXT),
+      mDrawBetweenSwitches(drawBetweenSwitches)
 {
     auto platform = GetParam().eglParameters;
 
@@ -76,6 +92,7 @@ EGLMakeCurrentPerfTest::EGLMakeCurrentPerfTest()
     else
     {
         angle::LoadEGL(getProc);
+        angle::LoadGLES(getProc);
 
         if (!eglGetPlatformDisplayEXT)
         {
@@ -111,10 +128,12 @@ void EGLMakeCurrentPerfTest::SetUp()
 
     ASSERT_TRUE(eglChooseConfig(mDisplay, configAttrs, &mConfig, 1, &numConfigs));
 
-    mContexts[0] = eglCreateContext(mDisplay, mConfig, EGL_NO_CONTEXT, nullptr);
-    ASSERT_NE(EGL_NO_CONTEXT, mContexts[0]);
-    mContexts[1] = eglCreateContext(mDisplay, mConfig, EGL_NO_CONTEXT, nullptr);
-    ASSERT_NE(EGL_NO_CONTEXT, mContexts[1]);
+    for (EGLContext &context : mContexts)
+    {
+        EGLContext shareContext = mDrawBetweenSwitches ? mContexts[0] : EGL_NO_CONTEXT;
+        context                 = eglCreateContext(mDisplay, mConfig, shareContext, nullptr);
+        ASSERT_NE(EGL_NO_CONTEXT, context);
+    }
 
     mSurface = eglCreateWindowSurface(mDisplay, mConfig, mOSWindow->getNativeWindow(), nullptr);
     ASSERT_NE(EGL_NO_SURFACE, mSurface);
@@ -126,8 +145,10 @@ void EGLMakeCurrentPerfTest::TearDown()
     ANGLEPerfTest::TearDown();
     eglMakeCurrent(mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
     eglDestroySurface(mDisplay, mSurface);
-    eglDestroyContext(mDisplay, mContexts[0]);
-    eglDestroyContext(mDisplay, mContexts[1]);
+    for (EGLContext context : mContexts)
+    {
+        eglDestroyContext(mDisplay, context);
+    }
 }
 
 void EGLMakeCurrentPerfTest::step()
@@ -135,6 +156,12 @@ void EGLMakeCurrentPerfTest::step()
     int mCurrContext = 0;
     for (int x = 0; x < ITERATIONS; x++)
     {
+        if (mDrawBetweenSwitches)
+        {
+            glClearColor(static_cast<float>(mCurrContext) / mContexts.size(), 0, 0, 1);
+            glClear(GL_COLOR_BUFFER_BIT);
+        }
+
         mCurrContext = (mCurrContext + 1) % mContexts.size();
         eglMakeCurrent(mDisplay, mSurface, mSurface, mContexts[mCurrContext]);
     }
@@ -145,7 +172,13 @@ TEST_P(EGLMakeCurrentPerfTest, Run)
     run();
 }
 
+TEST_P(EGLMakeCurrentShareGroupPerfTest, Run)
+{
+    run();
+}
+
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLMakeCurrentPerfTest);
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(EGLMakeCurrentShareGroupPerfTest);
 // We want to run this test on GL(ES) and Vulkan everywhere except Android
 #if !defined(ANGLE_PLATFORM_ANDROID)
 ANGLE_INSTANTIATE_TEST(EGLMakeCurrentPerfTest,
@@ -154,6 +187,12 @@ ANGLE_INSTANTIATE_TEST(EGLMakeCurrentPerfTest,
                        angle::ES2_OPENGL(),
                        angle::ES2_OPENGLES(),
                        angle::ES2_VULKAN());
+ANGLE_INSTANTIATE_TEST(EGLMakeCurrentShareGroupPerfTest,
+                       angle::ES2_D3D11(),
+                       angle::ES2_METAL(),
+                       angle::ES2_OPENGL(),
+                       angle::ES2_OPENGLES(),
+                       angle::ES2_VULKAN());
 #endif
 
 }  // namespace
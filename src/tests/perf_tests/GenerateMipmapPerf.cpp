@@ -34,7 +34,8 @@ struct GenerateMipmapParams final : public RenderTestParams
 
         internalFormat = GL_RGBA;
 
-        webgl = false;
+        webgl     = false;
+        forceBlit = false;
     }
 
     std::string story() const override;
@@ -45,6 +46,9 @@ struct GenerateMipmapParams final : public RenderTestParams
     GLenum internalFormat;
 
     bool webgl;
+
+    // Vulkan only: disable the compute path to compare it against the blit path.
+    bool forceBlit;
 };
 
 std::ostream &operator<<(std::ostream &os, const GenerateMipmapParams &params)
@@ -68,6 +72,11 @@ std::string GenerateMipmapParams::story() const
         strstr << "_rgb";
     }
 
+    if (forceBlit)
+    {
+        strstr << "_blit";
+    }
+
     return strstr.str();
 }
 
@@ -300,17 +309,25 @@ GenerateMipmapParams OpenGLOrGLESParams(bool webglCompat, bool singleIteration)
     return params;
 }
 
-GenerateMipmapParams VulkanParams(bool webglCompat, bool singleIteration, bool emulatedFormat)
+GenerateMipmapParams VulkanParams(bool webglCompat,
+                                  bool singleIteration,
+                                  bool emulatedFormat,
+                                  bool forceBlit)
 {
     GenerateMipmapParams params;
     params.eglParameters = egl_platform::VULKAN();
     params.majorVersion  = 3;
     params.minorVersion  = 0;
     params.webgl         = webglCompat;
+    params.forceBlit     = forceBlit;
     if (emulatedFormat)
     {
         params.internalFormat = GL_RGB;
     }
+    if (forceBlit)
+    {
+        params.eglParameters.disable(Feature::AllowGenerateMipmapWithCompute);
+    }
     if (singleIteration)
     {
         params.iterationsPerStep = 1;
@@ -337,17 +354,21 @@ ANGLE_INSTANTIATE_TEST(GenerateMipmapBenchmark,
                        D3D11Params(true, false),
                        OpenGLOrGLESParams(false, false),
                        OpenGLOrGLESParams(true, false),
-                       VulkanParams(false, false, false),
-                       VulkanParams(true, false, false),
-                       VulkanParams(false, false, true),
-                       VulkanParams(true, false, true));
+                       VulkanParams(false, false, false, false),
+                       VulkanParams(true, false, false, false),
+                       VulkanParams(false, false, true, false),
+                       VulkanParams(true, false, true, false),
+                       VulkanParams(false, false, false, true),
+                       VulkanParams(false, false, true, true));
 
 ANGLE_INSTANTIATE_TEST(GenerateMipmapWithRedefineBenchmark,
                        D3D11Params(false, true),
                        D3D11Params(true, true),
                        OpenGLOrGLESParams(false, true),
                        OpenGLOrGLESParams(true, true),
-                       VulkanParams(false, true, false),
-                       VulkanParams(true, true, false),
-                       VulkanParams(false, true, true),
-                       VulkanParams(true, true, true));
+                       VulkanParams(false, true, false, false),
+                       VulkanParams(true, true, false, false),
+                       VulkanParams(false, true, true, false),
+                       VulkanParams(true, true, true, false),
+                       VulkanParams(false, true, false, true),
+                       VulkanParams(false, true, true, true));
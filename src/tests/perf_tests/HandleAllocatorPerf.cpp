@@ -0,0 +1,103 @@
+//
+// Copyright 2022 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HandleAllocatorPerf:
+//   Performance test for allocating many handles at once, such as with glGenTextures, either one
+//   handle at a time or in ranges.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include "libANGLE/HandleAllocator.h"
+#include "libANGLE/ResourceMap.h"
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 10;
+constexpr GLuint kHandleCount             = 10000;
+
+class HandleAllocatorPerfTest : public ANGLEPerfTest, public ::testing::WithParamInterface<bool>
+{
+  public:
+    HandleAllocatorPerfTest();
+    void step() override;
+
+  private:
+    void allocateOneByOne();
+    void allocateRanges();
+    void freeHandles();
+
+    gl::HandleAllocator mHandleAllocator;
+    gl::ResourceMap<GLuint, GLuint> mResourceMap;
+    std::vector<GLuint> mHandles;
+};
+
+HandleAllocatorPerfTest::HandleAllocatorPerfTest()
+    : ANGLEPerfTest("HandleAllocatorPerf",
+                    "",
+                    GetParam() ? "_ranges" : "_one_by_one",
+                    kIterationsPerStep),
+      mHandles(kHandleCount)
+{}
+
+void HandleAllocatorPerfTest::allocateOneByOne()
+{
+    for (GLuint &handle : mHandles)
+    {
+        handle = mHandleAllocator.allocate();
+        mResourceMap.assign(handle, nullptr);
+    }
+}
+
+void HandleAllocatorPerfTest::allocateRanges()
+{
+    GLuint *handlesOut = mHandles.data();
+    GLuint remaining   = kHandleCount;
+    while (remaining > 0)
+    {
+        GLuint count       = 0;
+        GLuint firstHandle = mHandleAllocator.allocateRange(remaining, &count);
+        mResourceMap.assignRange(firstHandle, count, nullptr);
+        for (GLuint index = 0; index < count; ++index)
+        {
+            *handlesOut++ = firstHandle + index;
+        }
+        remaining -= count;
+    }
+}
+
+void HandleAllocatorPerfTest::freeHandles()
+{
+    for (GLuint handle : mHandles)
+    {
+        GLuint *resource = nullptr;
+        mResourceMap.erase(handle, &resource);
+    }
+    mHandleAllocator.reset();
+}
+
+void HandleAllocatorPerfTest::step()
+{
+    for (unsigned int iteration = 0; iteration < kIterationsPerStep; ++iteration)
+    {
+        if (GetParam())
+        {
+            allocateRanges();
+        }
+        else
+        {
+            allocateOneByOne();
+        }
+        freeHandles();
+    }
+}
+
+TEST_P(HandleAllocatorPerfTest, Run)
+{
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(, HandleAllocatorPerfTest, ::testing::Bool());
+}  // anonymous namespace
@@ -0,0 +1,68 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HeapAllocationCounter.cpp:
+//   Implements the heap allocation counter by interposing the glibc allocator.
+//
+
+#include "HeapAllocationCounter.h"
+
+#include <atomic>
+#include <cstddef>
+
+#if defined(ANGLE_PERF_TEST_COUNT_HEAP_ALLOCATIONS)
+namespace
+{
+// Constant initialized, since allocations can happen before any static initializer runs.
+std::atomic<uint64_t> gHeapAllocationCount(0);
+}  // anonymous namespace
+
+// The definitions in the executable take precedence over the ones of libc, including for the calls
+// from the ANGLE libraries.  The other allocation functions and free are left to libc, which is
+// why only counting is possible.
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+
+void *malloc(size_t size)
+{
+    gHeapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size)
+{
+    gHeapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    gHeapAllocationCount.fetch_add(1, std::memory_order_relaxed);
+    return __libc_realloc(ptr, size);
+}
+}  // extern "C"
+
+bool IsHeapAllocationCounterAvailable()
+{
+    return true;
+}
+
+uint64_t GetHeapAllocationCount()
+{
+    return gHeapAllocationCount.load(std::memory_order_relaxed);
+}
+#else
+bool IsHeapAllocationCounterAvailable()
+{
+    return false;
+}
+
+uint64_t GetHeapAllocationCount()
+{
+    return 0;
+}
+#endif  // defined(ANGLE_PERF_TEST_COUNT_HEAP_ALLOCATIONS)
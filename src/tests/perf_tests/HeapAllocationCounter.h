@@ -0,0 +1,22 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// HeapAllocationCounter.h:
+//   Counts the heap allocations of the perf test process, to catch allocations on the draw path.
+//
+
+#ifndef TESTS_PERF_TESTS_HEAP_ALLOCATION_COUNTER_H_
+#define TESTS_PERF_TESTS_HEAP_ALLOCATION_COUNTER_H_
+
+#include <cstdint>
+
+// Only implemented in builds defining ANGLE_PERF_TEST_COUNT_HEAP_ALLOCATIONS, where the perf test
+// executable interposes malloc, calloc and realloc of glibc.  See src/tests/BUILD.gn.
+bool IsHeapAllocationCounterAvailable();
+
+// Returns the number of allocations made by all threads since the process started.
+uint64_t GetHeapAllocationCount();
+
+#endif  // TESTS_PERF_TESTS_HEAP_ALLOCATION_COUNTER_H_
@@ -27,6 +27,11 @@ struct IndexConversionPerfParams final : public RenderTestParams
             strstr << "_index_range";
         }
 
+        if (subDataUpdate)
+        {
+            strstr << "_sub_data_update";
+        }
+
         strstr << RenderTestParams::story();
 
         return strstr.str();
@@ -36,6 +41,10 @@ struct IndexConversionPerfParams final : public RenderTestParams
 
     // A second test, which covers using index ranges with an offset.
     unsigned int indexRangeOffset;
+
+    // A third test, which updates a small part of a large index buffer before each draw. Only the
+    // index range of the updated part of the buffer should need to be recomputed.
+    bool subDataUpdate;
 };
 
 // Provide a custom gtest parameter name function for IndexConversionPerfParams.
@@ -59,6 +68,7 @@ class IndexConversionPerfTest : public ANGLERenderTest,
     void updateBufferData();
     void drawConversion();
     void drawIndexRange();
+    void drawSubDataUpdate();
 
     GLuint mProgram;
     GLuint mVertexBuffer;
@@ -96,7 +106,7 @@ void IndexConversionPerfTest::initializeBenchmark()
     for (unsigned int triIndex = 0; triIndex < params.numIndexTris; ++triIndex)
     {
         // Handle two different types of tests, one with index conversion triggered by a -1 index.
-        if (params.indexRangeOffset == 0)
+        if (params.indexRangeOffset == 0 && !params.subDataUpdate)
         {
             mIndexData.push_back(std::numeric_limits<GLushort>::max());
         }
@@ -136,7 +146,11 @@ void IndexConversionPerfTest::drawBenchmark()
 {
     const auto &params = GetParam();
 
-    if (params.indexRangeOffset == 0)
+    if (params.subDataUpdate)
+    {
+        drawSubDataUpdate();
+    }
+    else if (params.indexRangeOffset == 0)
     {
         drawConversion();
     }
@@ -183,6 +197,26 @@ void IndexConversionPerfTest::drawIndexRange()
     ASSERT_GL_NO_ERROR();
 }
 
+void IndexConversionPerfTest::drawSubDataUpdate()
+{
+    const auto &params = GetParam();
+
+    const size_t triCount      = params.numIndexTris;
+    const size_t triIndexBytes = 3 * sizeof(mIndexData[0]);
+
+    for (unsigned int it = 0; it < params.iterationsPerStep; it++)
+    {
+        // Touch a different triangle each iteration, so the whole buffer is eventually updated.
+        size_t triIndex = (getNumStepsPerformed() * params.iterationsPerStep + it) % triCount;
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, triIndex * triIndexBytes, triIndexBytes,
+                        &mIndexData[triIndex * 3]);
+        glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(triCount * 3), GL_UNSIGNED_SHORT,
+                       reinterpret_cast<void *>(0));
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
 IndexConversionPerfParams IndexConversionPerfD3D11Params()
 {
     IndexConversionPerfParams params;
@@ -194,6 +228,7 @@ IndexConversionPerfParams IndexConversionPerfD3D11Params()
     params.iterationsPerStep = 225;
     params.numIndexTris      = 3000;
     params.indexRangeOffset  = 0;
+    params.subDataUpdate     = false;
     return params;
 }
 
@@ -208,6 +243,22 @@ IndexConversionPerfParams IndexRangeOffsetPerfD3D11Params()
     params.iterationsPerStep = 16;
     params.numIndexTris      = 50000;
     params.indexRangeOffset  = 64;
+    params.subDataUpdate     = false;
+    return params;
+}
+
+IndexConversionPerfParams IndexRangeSubDataPerfD3D11Params()
+{
+    IndexConversionPerfParams params;
+    params.eglParameters     = egl_platform::D3D11_NULL();
+    params.majorVersion      = 2;
+    params.minorVersion      = 0;
+    params.windowWidth       = 256;
+    params.windowHeight      = 256;
+    params.iterationsPerStep = 16;
+    params.numIndexTris      = 300000;
+    params.indexRangeOffset  = 0;
+    params.subDataUpdate     = true;
     return params;
 }
 
@@ -218,7 +269,8 @@ TEST_P(IndexConversionPerfTest, Run)
 
 ANGLE_INSTANTIATE_TEST(IndexConversionPerfTest,
                        IndexConversionPerfD3D11Params(),
-                       IndexRangeOffsetPerfD3D11Params());
+                       IndexRangeOffsetPerfD3D11Params(),
+                       IndexRangeSubDataPerfD3D11Params());
 
 // This test suite is not instantiated on some OSes.
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(IndexConversionPerfTest);
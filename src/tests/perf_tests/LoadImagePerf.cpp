@@ -0,0 +1,144 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// LoadImagePerf:
+//   Performance test for the pixel loaders of image_util, which convert the pixels of texture
+//   uploads to the format of the texture.  Reports the throughput of each loader in GB/s.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <vector>
+
+#include "image_util/loadimage.h"
+
+namespace
+{
+constexpr size_t kImageWidth  = 1024;
+constexpr size_t kImageHeight = 1024;
+
+using LoadFunction = void (*)(size_t width,
+                              size_t height,
+                              size_t depth,
+                              const uint8_t *input,
+                              size_t inputRowPitch,
+                              size_t inputDepthPitch,
+                              uint8_t *output,
+                              size_t outputRowPitch,
+                              size_t outputDepthPitch);
+
+struct LoadImageParams
+{
+    const char *name;
+    LoadFunction loadFunction;
+    size_t inputPixelBytes;
+    size_t outputPixelBytes;
+};
+
+std::ostream &operator<<(std::ostream &os, const LoadImageParams &params)
+{
+    os << params.name;
+    return os;
+}
+
+class LoadImagePerfTest : public ANGLEPerfTest,
+                          public ::testing::WithParamInterface<LoadImageParams>
+{
+  public:
+    LoadImagePerfTest();
+
+    void SetUp() override;
+    void TearDown() override;
+    void startTest() override;
+    void step() override;
+
+  private:
+    std::vector<uint8_t> mInput;
+    std::vector<uint8_t> mOutput;
+    Timer mLoadTimer;
+    double mLoadSeconds = 0;
+    size_t mLoadCount   = 0;
+};
+
+LoadImagePerfTest::LoadImagePerfTest()
+    : ANGLEPerfTest("LoadImagePerf", "", std::string("_") + GetParam().name, 1)
+{
+    mReporter->RegisterImportantMetric(".throughput", "GB/s");
+}
+
+void LoadImagePerfTest::SetUp()
+{
+    const LoadImageParams &params = GetParam();
+    mInput.resize(kImageWidth * kImageHeight * params.inputPixelBytes);
+    mOutput.resize(kImageWidth * kImageHeight * params.outputPixelBytes);
+
+    for (size_t index = 0; index < mInput.size(); ++index)
+    {
+        mInput[index] = static_cast<uint8_t>(index * 7);
+    }
+
+    ANGLEPerfTest::SetUp();
+}
+
+void LoadImagePerfTest::TearDown()
+{
+    if (mLoadSeconds > 0)
+    {
+        // Both the bytes read and written count towards the throughput.
+        const double bytesPerLoad = static_cast<double>(mInput.size() + mOutput.size());
+        mReporter->AddResult(".throughput",
+                             bytesPerLoad * static_cast<double>(mLoadCount) / mLoadSeconds * 1e-9);
+    }
+
+    ANGLEPerfTest::TearDown();
+}
+
+void LoadImagePerfTest::startTest()
+{
+    mLoadSeconds = 0;
+    mLoadCount   = 0;
+}
+
+void LoadImagePerfTest::step()
+{
+    const LoadImageParams &params = GetParam();
+
+    mLoadTimer.start();
+    params.loadFunction(kImageWidth, kImageHeight, 1, mInput.data(),
+                        kImageWidth * params.inputPixelBytes, 0, mOutput.data(),
+                        kImageWidth * params.outputPixelBytes, 0);
+    mLoadTimer.stop();
+
+    mLoadSeconds += mLoadTimer.getElapsedWallClockTime();
+    ++mLoadCount;
+}
+
+TEST_P(LoadImagePerfTest, Run)
+{
+    run();
+}
+
+const LoadImageParams kLoadImageParams[] = {
+    {"A8ToRGBA8", angle::LoadA8ToRGBA8, 1, 4},
+    {"L8ToRGBA8", angle::LoadL8ToRGBA8, 1, 4},
+    {"LA8ToRGBA8", angle::LoadLA8ToRGBA8, 2, 4},
+    {"RGB8ToBGRX8", angle::LoadRGB8ToBGRX8, 3, 4},
+    {"RGBA8ToBGRA8", angle::LoadRGBA8ToBGRA8, 4, 4},
+    {"RGBA4ToRGBA8", angle::LoadRGBA4ToRGBA8, 2, 4},
+    {"R5G6B5ToRGBA8", angle::LoadR5G6B5ToRGBA8, 2, 4},
+    {"RGB5A1ToRGBA8", angle::LoadRGB5A1ToRGBA8, 2, 4},
+    {"RGB8ToRGBA8", angle::LoadToNative3To4<uint8_t, 0xFF>, 3, 4},
+    {"RGBA8ToRGBA8", angle::LoadToNative<uint8_t, 4>, 4, 4},
+    {"L16FToRGBA16F", angle::LoadL16FToRGBA16F, 2, 8},
+    {"RGB32FToRGBA16F", angle::LoadRGB32FToRGBA16F, 12, 8},
+};
+
+INSTANTIATE_TEST_SUITE_P(,
+                         LoadImagePerfTest,
+                         ::testing::ValuesIn(kLoadImageParams),
+                         [](const ::testing::TestParamInfo<LoadImageParams> &info) {
+                             return std::string(info.param.name);
+                         });
+}  // anonymous namespace
@@ -0,0 +1,386 @@
+//
+// Copyright 2022 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// MultithreadedContextsPerf:
+//   Performance test for GL calls made concurrently from multiple threads, each with its own
+//   context.  The contexts are either all in a single share group, or each thread has a share group
+//   of its own.  The threads either make state changes or draw, optionally all using the same
+//   buffer, texture and program to measure the contention on shared objects.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include "test_utils/ANGLETest.h"
+#include "test_utils/gl_raii.h"
+#include "util/EGLWindow.h"
+#include "util/shader_utils.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 10;
+constexpr unsigned int kCallsPerIteration = 100;
+constexpr GLsizei kFramebufferSize        = 16;
+
+enum class Workload
+{
+    // A mix of calls that only change context state and calls that modify objects.
+    StateChanges,
+    // Draw calls to a framebuffer of the thread's own.
+    Draws,
+};
+
+struct MultithreadedContextsParams final : public RenderTestParams
+{
+    MultithreadedContextsParams(uint32_t threads,
+                                bool sameShareGroup,
+                                Workload workloadIn,
+                                bool sameObjects)
+        : threadCount(threads),
+          singleShareGroup(sameShareGroup),
+          workload(workloadIn),
+          sharedObjects(sameObjects)
+    {
+        // Objects can only be used by all threads if their contexts share them.
+        ASSERT(!sharedObjects || singleShareGroup);
+
+        iterationsPerStep = kIterationsPerStep;
+
+        eglParameters = angle::egl_platform::VULKAN();
+        majorVersion  = 3;
+        minorVersion  = 0;
+        windowWidth   = 64;
+        windowHeight  = 64;
+    }
+
+    std::string story() const override
+    {
+        std::ostringstream sout;
+
+        sout << RenderTestParams::story() << "_" << threadCount << "_threads"
+             << (singleShareGroup ? "_single_share_group" : "_share_group_per_thread");
+        if (workload == Workload::Draws)
+        {
+            sout << "_draws";
+        }
+        if (sharedObjects)
+        {
+            sout << "_shared_objects";
+        }
+
+        return sout.str();
+    }
+
+    uint32_t threadCount;
+    bool singleShareGroup;
+    Workload workload;
+    bool sharedObjects;
+};
+
+std::ostream &operator<<(std::ostream &os, const MultithreadedContextsParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+void InitializeObjects(GLuint buffer, GLuint texture)
+{
+    // A triangle covering the framebuffer.
+    const GLfloat kVertices[] = {-1.0f, -1.0f, 3.0f, -1.0f, -1.0f, 3.0f};
+    glBindBuffer(GL_ARRAY_BUFFER, buffer);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(kVertices), kVertices, GL_DYNAMIC_DRAW);
+
+    const GLColor kTextureData = GLColor::red;
+    glBindTexture(GL_TEXTURE_2D, texture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 1, 1, 0, GL_RGBA, GL_UNSIGNED_BYTE, &kTextureData);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+}
+
+GLuint CompileTextureProgram()
+{
+    return CompileProgram(essl1_shaders::vs::Texture2D(), essl1_shaders::fs::Texture2D());
+}
+
+class MultithreadedContextsBenchmark
+    : public ANGLERenderTest,
+      public ::testing::WithParamInterface<MultithreadedContextsParams>
+{
+  public:
+    MultithreadedContextsBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    void threadMain(uint32_t threadIndex);
+    void runStateChangesIteration();
+    void runDrawsIteration(GLuint program);
+
+    struct ThreadContexts
+    {
+        // The context the thread uses.
+        EGLContext context = EGL_NO_CONTEXT;
+        // A context created in the thread's share group so that |context| is considered shared.
+        EGLContext sharingContext = EGL_NO_CONTEXT;
+    };
+
+    std::vector<ThreadContexts> mThreadContexts;
+    std::vector<std::thread> mThreads;
+
+    // The objects used by all threads with |sharedObjects|, created in the window's context.
+    GLBuffer mSharedBuffer;
+    GLTexture mSharedTexture;
+    GLuint mSharedProgram;
+
+    std::mutex mMutex;
+    std::condition_variable mStartCondition;
+    std::condition_variable mDoneCondition;
+    uint64_t mStep;
+    uint32_t mThreadsDone;
+    bool mExit;
+};
+
+MultithreadedContextsBenchmark::MultithreadedContextsBenchmark()
+    : ANGLERenderTest("MultithreadedContexts", GetParam()),
+      mSharedProgram(0),
+      mStep(0),
+      mThreadsDone(0),
+      mExit(false)
+{}
+
+void MultithreadedContextsBenchmark::initializeBenchmark()
+{
+    const MultithreadedContextsParams &params = GetParam();
+
+    EGLWindow *window = static_cast<EGLWindow *>(getGLWindow());
+    if (!IsEGLDisplayExtensionEnabled(window->getDisplay(), "EGL_KHR_surfaceless_context"))
+    {
+        skipTest("EGL_KHR_surfaceless_context is not supported");
+        return;
+    }
+
+    mThreadContexts.resize(params.threadCount);
+    for (ThreadContexts &contexts : mThreadContexts)
+    {
+        EGLContext share = params.singleShareGroup ? window->getContext() : EGL_NO_CONTEXT;
+        contexts.context = window->createContext(share, nullptr);
+        ASSERT_NE(contexts.context, EGL_NO_CONTEXT);
+
+        if (!params.singleShareGroup)
+        {
+            contexts.sharingContext = window->createContext(contexts.context, nullptr);
+            ASSERT_NE(contexts.sharingContext, EGL_NO_CONTEXT);
+        }
+    }
+
+    if (params.sharedObjects)
+    {
+        InitializeObjects(mSharedBuffer, mSharedTexture);
+        mSharedProgram = CompileTextureProgram();
+        ASSERT_NE(mSharedProgram, 0u);
+        // Make sure the threads see the objects complete.
+        glFinish();
+    }
+
+    for (uint32_t threadIndex = 0; threadIndex < params.threadCount; ++threadIndex)
+    {
+        mThreads.emplace_back(&MultithreadedContextsBenchmark::threadMain, this, threadIndex);
+    }
+}
+
+void MultithreadedContextsBenchmark::destroyBenchmark()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mExit = true;
+    }
+    mStartCondition.notify_all();
+
+    for (std::thread &thread : mThreads)
+    {
+        thread.join();
+    }
+    mThreads.clear();
+
+    mSharedBuffer.reset();
+    mSharedTexture.reset();
+    glDeleteProgram(mSharedProgram);
+    mSharedProgram = 0;
+
+    EGLDisplay display = static_cast<EGLWindow *>(getGLWindow())->getDisplay();
+    for (ThreadContexts &contexts : mThreadContexts)
+    {
+        eglDestroyContext(display, contexts.context);
+        if (contexts.sharingContext != EGL_NO_CONTEXT)
+        {
+            eglDestroyContext(display, contexts.sharingContext);
+        }
+    }
+    mThreadContexts.clear();
+}
+
+void MultithreadedContextsBenchmark::threadMain(uint32_t threadIndex)
+{
+    EGLDisplay display = static_cast<EGLWindow *>(getGLWindow())->getDisplay();
+    EGLContext context = mThreadContexts[threadIndex].context;
+    EXPECT_TRUE(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context));
+
+    const MultithreadedContextsParams &params = GetParam();
+
+    GLBuffer buffer;
+    GLTexture texture;
+    GLuint program = mSharedProgram;
+    if (params.sharedObjects)
+    {
+        glBindBuffer(GL_ARRAY_BUFFER, mSharedBuffer);
+        glBindTexture(GL_TEXTURE_2D, mSharedTexture);
+    }
+    else
+    {
+        InitializeObjects(buffer, texture);
+        if (params.workload == Workload::Draws)
+        {
+            program = CompileTextureProgram();
+            EXPECT_NE(program, 0u);
+        }
+    }
+
+    // Framebuffers and vertex arrays are never shared, so each thread draws to its own.
+    GLFramebuffer framebuffer;
+    GLRenderbuffer renderbuffer;
+    if (params.workload == Workload::Draws)
+    {
+        glBindRenderbuffer(GL_RENDERBUFFER, renderbuffer);
+        glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, kFramebufferSize, kFramebufferSize);
+        glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+        glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER,
+                                  renderbuffer);
+        glViewport(0, 0, kFramebufferSize, kFramebufferSize);
+
+        GLint positionLocation = glGetAttribLocation(program, essl1_shaders::PositionAttrib());
+        glVertexAttribPointer(positionLocation, 2, GL_FLOAT, GL_FALSE, 0, nullptr);
+        glEnableVertexAttribArray(positionLocation);
+    }
+
+    uint64_t lastStep = 0;
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mStartCondition.wait(lock, [this, lastStep]() { return mExit || mStep != lastStep; });
+            if (mExit)
+            {
+                break;
+            }
+            lastStep = mStep;
+        }
+
+        for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+        {
+            if (params.workload == Workload::Draws)
+            {
+                runDrawsIteration(program);
+            }
+            else
+            {
+                runStateChangesIteration();
+            }
+        }
+        glFlush();
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            ++mThreadsDone;
+        }
+        mDoneCondition.notify_one();
+    }
+
+    // Make sure the objects are deleted while the context is current.
+    buffer.reset();
+    texture.reset();
+    framebuffer.reset();
+    renderbuffer.reset();
+    if (program != mSharedProgram)
+    {
+        glDeleteProgram(program);
+    }
+
+    EXPECT_TRUE(eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT));
+}
+
+void MultithreadedContextsBenchmark::runStateChangesIteration()
+{
+    const GLfloat data[4] = {};
+
+    // A mix of calls that only change context state and calls that modify objects.  With shared
+    // objects, the modified objects are the same in all threads.
+    for (unsigned int call = 0; call < kCallsPerIteration; ++call)
+    {
+        glEnable(GL_BLEND);
+        glBlendFunc(GL_ONE, GL_ONE);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (call & 1) ? GL_NEAREST : GL_LINEAR);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(data), data);
+        glDisable(GL_BLEND);
+    }
+}
+
+void MultithreadedContextsBenchmark::runDrawsIteration(GLuint program)
+{
+    for (unsigned int call = 0; call < kCallsPerIteration; ++call)
+    {
+        glUseProgram(program);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+    }
+}
+
+void MultithreadedContextsBenchmark::drawBenchmark()
+{
+    std::unique_lock<std::mutex> lock(mMutex);
+
+    mThreadsDone = 0;
+    ++mStep;
+    mStartCondition.notify_all();
+
+    mDoneCondition.wait(lock, [this]() { return mThreadsDone == mThreads.size(); });
+}
+
+MultithreadedContextsParams Params(uint32_t threadCount,
+                                   bool singleShareGroup,
+                                   Workload workload = Workload::StateChanges,
+                                   bool sharedObjects = false)
+{
+    return MultithreadedContextsParams(threadCount, singleShareGroup, workload, sharedObjects);
+}
+}  // anonymous namespace
+
+TEST_P(MultithreadedContextsBenchmark, Run)
+{
+    run();
+}
+
+GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(MultithreadedContextsBenchmark);
+ANGLE_INSTANTIATE_TEST(MultithreadedContextsBenchmark,
+                       Params(1, true),
+                       Params(2, true),
+                       Params(4, true),
+                       Params(8, true),
+                       Params(1, false),
+                       Params(2, false),
+                       Params(4, false),
+                       Params(8, false),
+                       Params(4, true, Workload::StateChanges, true),
+                       Params(8, true, Workload::StateChanges, true),
+                       Params(1, true, Workload::Draws),
+                       Params(4, true, Workload::Draws),
+                       Params(8, true, Workload::Draws),
+                       Params(4, false, Workload::Draws),
+                       Params(8, false, Workload::Draws),
+                       Params(4, true, Workload::Draws, true),
+                       Params(8, true, Workload::Draws, true));
@@ -35,6 +35,7 @@ struct PointSpritesParams final : public RenderTestParams
         count        = 10;
         size         = 3.0f;
         numVaryings  = 3;
+        vertexId     = false;
     }
 
     std::string story() const override;
@@ -42,6 +43,9 @@ struct PointSpritesParams final : public RenderTestParams
     unsigned int count;
     float size;
     unsigned int numVaryings;
+
+    // Whether the D3D11 point sprites are expanded from the vertex ID.
+    bool vertexId;
 };
 
 std::ostream &operator<<(std::ostream &os, const PointSpritesParams &params)
@@ -73,6 +77,11 @@ std::string PointSpritesParams::story() const
     strstr << RenderTestParams::story() << "_" << count << "_" << size << "px"
            << "_" << numVaryings << "vars";
 
+    if (vertexId)
+    {
+        strstr << "_vertex_id";
+    }
+
     return strstr.str();
 }
 
@@ -201,6 +210,15 @@ PointSpritesParams D3D11Params()
     return params;
 }
 
+PointSpritesParams D3D11VertexIdParams()
+{
+    PointSpritesParams params;
+    params.eglParameters = egl_platform::D3D11();
+    params.eglParameters.enable(Feature::ExpandPointSpritesWithVertexId);
+    params.vertexId = true;
+    return params;
+}
+
 PointSpritesParams OpenGLOrGLESParams()
 {
     PointSpritesParams params;
@@ -222,4 +240,8 @@ TEST_P(PointSpritesBenchmark, Run)
     run();
 }
 
-ANGLE_INSTANTIATE_TEST(PointSpritesBenchmark, D3D11Params(), OpenGLOrGLESParams(), VulkanParams());
+ANGLE_INSTANTIATE_TEST(PointSpritesBenchmark,
+                       D3D11Params(),
+                       D3D11VertexIdParams(),
+                       OpenGLOrGLESParams(),
+                       VulkanParams());
@@ -0,0 +1,261 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SamplingProfiler.cpp:
+//   Implements SamplingProfiler with perf_event_open.
+//
+
+#include "SamplingProfiler.h"
+
+#include <algorithm>
+#include <fstream>
+
+#include "common/debug.h"
+
+#if defined(ANGLE_PLATFORM_LINUX) || defined(ANGLE_PLATFORM_ANDROID)
+#    include <cxxabi.h>
+#    include <dlfcn.h>
+#    include <errno.h>
+#    include <linux/perf_event.h>
+#    include <string.h>
+#    include <sys/ioctl.h>
+#    include <sys/mman.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+
+#    include <cstdlib>
+#    include <sstream>
+#    include <vector>
+#endif  // defined(ANGLE_PLATFORM_LINUX) || defined(ANGLE_PLATFORM_ANDROID)
+
+#if defined(ANGLE_PLATFORM_LINUX) || defined(ANGLE_PLATFORM_ANDROID)
+namespace
+{
+constexpr uint64_t kSampleFrequencyHz = 1000;
+// The ring buffer is read when sampling stops, so it has to hold the samples of a whole trial.  The
+// number of data pages must be a power of two.  Unprivileged users may only lock a smaller buffer,
+// and lose the samples that don't fit.
+constexpr size_t kMaxRingBufferDataPages = 4096;
+
+int PerfEventOpen(perf_event_attr *attr)
+{
+    // Sample the calling thread on any CPU.
+    return static_cast<int>(syscall(__NR_perf_event_open, attr, 0, -1, -1, 0));
+}
+
+// Copies data out of the ring buffer, where records can wrap around the end.
+void CopyFromRingBuffer(const uint8_t *ringData,
+                        uint64_t ringSize,
+                        uint64_t position,
+                        size_t size,
+                        void *dest)
+{
+    uint8_t *destBytes = static_cast<uint8_t *>(dest);
+    size_t offset      = static_cast<size_t>(position % ringSize);
+    size_t firstSize   = std::min(size, static_cast<size_t>(ringSize) - offset);
+    memcpy(destBytes, ringData + offset, firstSize);
+    memcpy(destBytes + firstSize, ringData, size - firstSize);
+}
+}  // anonymous namespace
+#endif  // defined(ANGLE_PLATFORM_LINUX) || defined(ANGLE_PLATFORM_ANDROID)
+
+SamplingProfiler::SamplingProfiler() = default;
+
+SamplingProfiler::~SamplingProfiler()
+{
+#if defined(ANGLE_PLATFORM_LINUX) || defined(ANGLE_PLATFORM_ANDROID)
+    ASSERT(mEventFd < 0);
+#endif  // defined(ANGLE_PLATFORM_LINUX) || defined(ANGLE_PLATFORM_ANDROID)
+}
+
+#if defined(ANGLE_PLATFORM_LINUX) || defined(ANGLE_PLATFORM_ANDROID)
+bool SamplingProfiler::start()
+{
+    ASSERT(mEventFd < 0);
+
+    perf_event_attr attr = {};
+    attr.size            = sizeof(attr);
+    attr.type            = PERF_TYPE_SOFTWARE;
+    attr.config          = PERF_COUNT_SW_TASK_CLOCK;
+    attr.freq            = 1;
+    attr.sample_freq     = kSampleFrequencyHz;
+    attr.sample_type     = PERF_SAMPLE_CALLCHAIN;
+    attr.disabled        = 1;
+    attr.exclude_kernel  = 1;
+    attr.exclude_hv      = 1;
+
+    mEventFd = PerfEventOpen(&attr);
+    if (mEventFd < 0)
+    {
+        WARN() << "Could not open the sampling perf event, perf_event_paranoid may be too high: "
+               << strerror(errno);
+        return false;
+    }
+
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    mRingBuffer           = MAP_FAILED;
+    for (size_t dataPages = kMaxRingBufferDataPages; dataPages > 0 && mRingBuffer == MAP_FAILED;
+         dataPages /= 2)
+    {
+        // The first page holds the metadata.
+        mRingBufferSize = (dataPages + 1) * pageSize;
+        mRingBuffer =
+            mmap(nullptr, mRingBufferSize, PROT_READ | PROT_WRITE, MAP_SHARED, mEventFd, 0);
+    }
+    if (mRingBuffer == MAP_FAILED)
+    {
+        WARN() << "Could not map the sampling ring buffer: " << strerror(errno);
+        mRingBuffer = nullptr;
+        close(mEventFd);
+        mEventFd = -1;
+        return false;
+    }
+
+    ioctl(mEventFd, PERF_EVENT_IOC_RESET, 0);
+    ioctl(mEventFd, PERF_EVENT_IOC_ENABLE, 0);
+    return true;
+}
+
+void SamplingProfiler::stop(const std::string &rootFrame)
+{
+    if (mEventFd < 0)
+    {
+        return;
+    }
+
+    ioctl(mEventFd, PERF_EVENT_IOC_DISABLE, 0);
+    readSamples(rootFrame);
+
+    munmap(mRingBuffer, mRingBufferSize);
+    mRingBuffer = nullptr;
+    close(mEventFd);
+    mEventFd = -1;
+}
+
+void SamplingProfiler::readSamples(const std::string &rootFrame)
+{
+    perf_event_mmap_page *metadata = static_cast<perf_event_mmap_page *>(mRingBuffer);
+    const uint8_t *ringData = static_cast<const uint8_t *>(mRingBuffer) + metadata->data_offset;
+    const uint64_t ringSize = metadata->data_size;
+
+    const uint64_t head = __atomic_load_n(&metadata->data_head, __ATOMIC_ACQUIRE);
+    uint64_t tail       = metadata->data_tail;
+
+    std::vector<uint64_t> recordData;
+    while (tail < head)
+    {
+        perf_event_header header;
+        CopyFromRingBuffer(ringData, ringSize, tail, sizeof(header), &header);
+        if (header.size < sizeof(header))
+        {
+            break;
+        }
+
+        size_t recordSize = header.size - sizeof(header);
+        recordData.resize((recordSize + sizeof(uint64_t) - 1) / sizeof(uint64_t));
+        CopyFromRingBuffer(ringData, ringSize, tail + sizeof(header), recordSize,
+                           recordData.data());
+        tail += header.size;
+
+        if (header.type == PERF_RECORD_SAMPLE && !recordData.empty())
+        {
+            // The call chain starts at the sampled instruction, and collapsed stacks at the root.
+            uint64_t frameCount = std::min<uint64_t>(recordData[0], recordData.size() - 1);
+            std::string stack   = rootFrame;
+            for (uint64_t frame = frameCount; frame > 0; --frame)
+            {
+                uint64_t address = recordData[frame];
+                // Skip the markers of the user and kernel parts of the chain.
+                if (address >= PERF_CONTEXT_MAX)
+                {
+                    continue;
+                }
+                stack += ';';
+                stack += getFrameName(address);
+            }
+            mStackCounts[stack]++;
+        }
+        else if (header.type == PERF_RECORD_LOST && recordData.size() >= 2)
+        {
+            // The record holds the event id followed by the number of samples lost.
+            mLostSamples += recordData[1];
+        }
+    }
+
+    __atomic_store_n(&metadata->data_tail, tail, __ATOMIC_RELEASE);
+}
+
+const std::string &SamplingProfiler::getFrameName(uint64_t address)
+{
+    auto iter = mFrameNames.find(address);
+    if (iter != mFrameNames.end())
+    {
+        return iter->second;
+    }
+
+    std::string name;
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void *>(address), &info) != 0)
+    {
+        if (info.dli_sname)
+        {
+            int status      = 0;
+            char *demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+            name            = status == 0 ? demangled : info.dli_sname;
+            free(demangled);
+        }
+        else if (info.dli_fname)
+        {
+            // Symbols of static functions are not exported, so at least show the module.
+            const char *baseName = strrchr(info.dli_fname, '/');
+            name                 = baseName ? baseName + 1 : info.dli_fname;
+        }
+    }
+
+    if (name.empty())
+    {
+        std::stringstream addressStream;
+        addressStream << "0x" << std::hex << address;
+        name = addressStream.str();
+    }
+
+    return mFrameNames.emplace(address, std::move(name)).first->second;
+}
+#else
+bool SamplingProfiler::start()
+{
+    WARN() << "The sampling profiler is not available on this platform.";
+    return false;
+}
+
+void SamplingProfiler::stop(const std::string &rootFrame) {}
+#endif  // defined(ANGLE_PLATFORM_LINUX) || defined(ANGLE_PLATFORM_ANDROID)
+
+void SamplingProfiler::writeCollapsedStacks(const char *fileName) const
+{
+#if defined(ANGLE_PLATFORM_LINUX) || defined(ANGLE_PLATFORM_ANDROID)
+    if (mLostSamples > 0)
+    {
+        WARN() << "The sampling profiler lost " << mLostSamples << " samples.";
+    }
+#endif  // defined(ANGLE_PLATFORM_LINUX) || defined(ANGLE_PLATFORM_ANDROID)
+
+    if (mStackCounts.empty())
+    {
+        return;
+    }
+
+    std::ofstream outFile(fileName);
+    if (!outFile)
+    {
+        WARN() << "Could not open " << fileName << " to write the sampled stacks.";
+        return;
+    }
+
+    for (const auto &stackCount : mStackCounts)
+    {
+        outFile << stackCount.first << " " << stackCount.second << "\n";
+    }
+}
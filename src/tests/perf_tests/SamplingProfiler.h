@@ -0,0 +1,53 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// SamplingProfiler.h:
+//   Samples the call stacks of the thread running a perf test, and writes them in the collapsed
+//   stack format read by flame graph tools.
+//
+
+#ifndef TESTS_PERF_TESTS_SAMPLING_PROFILER_H_
+#define TESTS_PERF_TESTS_SAMPLING_PROFILER_H_
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include "common/angleutils.h"
+#include "common/platform.h"
+
+// Only implemented with perf_event_open on Linux and Android.  The stacks are unwound by the
+// kernel with frame pointers, so builds without them only show the sampled function.
+class SamplingProfiler final : angle::NonCopyable
+{
+  public:
+    SamplingProfiler();
+    ~SamplingProfiler();
+
+    // Starts sampling the calling thread.  Returns false if sampling is not available.
+    bool start();
+    // Stops sampling, and adds the stacks sampled since start() under the given root frame.
+    void stop(const std::string &rootFrame);
+
+    // Writes one line per distinct stack, with its frames separated by ';' and its sample count.
+    void writeCollapsedStacks(const char *fileName) const;
+
+  private:
+#if defined(ANGLE_PLATFORM_LINUX) || defined(ANGLE_PLATFORM_ANDROID)
+    void readSamples(const std::string &rootFrame);
+    const std::string &getFrameName(uint64_t address);
+
+    int mEventFd           = -1;
+    void *mRingBuffer      = nullptr;
+    size_t mRingBufferSize = 0;
+    uint64_t mLostSamples  = 0;
+    std::unordered_map<uint64_t, std::string> mFrameNames;
+#endif  // defined(ANGLE_PLATFORM_LINUX) || defined(ANGLE_PLATFORM_ANDROID)
+
+    std::map<std::string, uint64_t> mStackCounts;
+};
+
+#endif  // TESTS_PERF_TESTS_SAMPLING_PROFILER_H_
@@ -0,0 +1,314 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// ShaderCorpusPerf:
+//   Performance test compiling, linking and drawing with the shaders of a corpus, such as the
+//   shaders extracted from traces.  The corpus is a list file given with --shader-corpus, where
+//   each line names a pair of shaders <name>.vert and <name>.frag relative to the list file.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include "ANGLEPerfTestArgs.h"
+#include "common/string_utils.h"
+#include "util/Timer.h"
+#include "util/shader_utils.h"
+
+#include <sstream>
+
+using namespace angle;
+
+namespace
+{
+enum class CacheOption
+{
+    // The sources are made unique in every step, so the caches of the shaders and programs of
+    // ANGLE and of the driver miss.
+    Cold,
+    // The same sources are used in every step, so after the first step the caches hit.
+    Warm,
+};
+
+struct ShaderCorpusParams final : public RenderTestParams
+{
+    ShaderCorpusParams(CacheOption cacheOptionIn) : cacheOption(cacheOptionIn)
+    {
+        iterationsPerStep = 1;
+
+        majorVersion = 3;
+        minorVersion = 0;
+        windowWidth  = 64;
+        windowHeight = 64;
+    }
+
+    std::string story() const override
+    {
+        std::stringstream strstr;
+        strstr << RenderTestParams::story()
+               << (cacheOption == CacheOption::Cold ? "_cold_cache" : "_warm_cache");
+        return strstr.str();
+    }
+
+    CacheOption cacheOption;
+};
+
+std::ostream &operator<<(std::ostream &os, const ShaderCorpusParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+// Metric names can't contain the path separators of the shader names.
+std::string GetMetricName(const std::string &shaderName)
+{
+    std::string metricName = "." + shaderName;
+    ReplaceAllSubstrings(&metricName, "/", "_");
+    ReplaceAllSubstrings(&metricName, "\\", "_");
+    return metricName;
+}
+
+struct CorpusEntry
+{
+    std::string name;
+    std::string vertexSource;
+    std::string fragmentSource;
+
+    // Time spent in each stage during the current run loop.
+    double compileSeconds = 0;
+    double linkSeconds    = 0;
+    double drawSeconds    = 0;
+};
+
+class ShaderCorpusBenchmark : public ANGLERenderTest,
+                              public ::testing::WithParamInterface<ShaderCorpusParams>
+{
+  public:
+    ShaderCorpusBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+    void startTest() override;
+
+  private:
+    bool loadCorpus();
+    GLuint compileShader(GLenum type, const std::string &source);
+
+    std::vector<CorpusEntry> mCorpus;
+    uint64_t mStepIndex   = 0;
+    uint32_t mStepsInLoop = 0;
+};
+
+ShaderCorpusBenchmark::ShaderCorpusBenchmark() : ANGLERenderTest("ShaderCorpus", GetParam()) {}
+
+bool ShaderCorpusBenchmark::loadCorpus()
+{
+    std::string list;
+    if (!ReadFileToString(gShaderCorpus, &list))
+    {
+        failTest(std::string("Could not read the shader corpus ") + gShaderCorpus);
+        return false;
+    }
+
+    std::string corpusDir = gShaderCorpus;
+    size_t lastSeparator  = corpusDir.find_last_of("/\\");
+    corpusDir = lastSeparator == std::string::npos ? "" : corpusDir.substr(0, lastSeparator + 1);
+
+    for (const std::string &name : SplitString(list, "\n", WhitespaceHandling::TRIM_WHITESPACE,
+                                               SplitResult::SPLIT_WANT_NONEMPTY))
+    {
+        CorpusEntry entry;
+        entry.name = name;
+        if (!ReadFileToString(corpusDir + name + ".vert", &entry.vertexSource) ||
+            !ReadFileToString(corpusDir + name + ".frag", &entry.fragmentSource))
+        {
+            failTest("Could not read the shaders of " + name);
+            return false;
+        }
+        mCorpus.push_back(std::move(entry));
+    }
+
+    if (mCorpus.empty())
+    {
+        failTest(std::string("The shader corpus is empty: ") + gShaderCorpus);
+        return false;
+    }
+    return true;
+}
+
+void ShaderCorpusBenchmark::initializeBenchmark()
+{
+    if (gShaderCorpus == nullptr)
+    {
+        skipTest("Needs a shader corpus, given with --shader-corpus");
+        return;
+    }
+
+    if (!loadCorpus())
+    {
+        return;
+    }
+
+    for (const CorpusEntry &entry : mCorpus)
+    {
+        std::string metricName = GetMetricName(entry.name);
+        for (const char *stage : {"_compile", "_link", "_draw"})
+        {
+            mReporter->RegisterFyiMetric(metricName + stage, "ms");
+        }
+    }
+}
+
+void ShaderCorpusBenchmark::destroyBenchmark()
+{
+    if (mStepsInLoop == 0)
+    {
+        return;
+    }
+
+    // The time of each stage per shader, averaged over the steps of the last run loop.
+    double millisecondsPerStep = 1000.0 / static_cast<double>(mStepsInLoop);
+    for (const CorpusEntry &entry : mCorpus)
+    {
+        std::string metricName = GetMetricName(entry.name);
+        mReporter->AddResult(metricName + "_compile", entry.compileSeconds * millisecondsPerStep);
+        mReporter->AddResult(metricName + "_link", entry.linkSeconds * millisecondsPerStep);
+        mReporter->AddResult(metricName + "_draw", entry.drawSeconds * millisecondsPerStep);
+    }
+}
+
+void ShaderCorpusBenchmark::startTest()
+{
+    mStepsInLoop = 0;
+    for (CorpusEntry &entry : mCorpus)
+    {
+        entry.compileSeconds = 0;
+        entry.linkSeconds    = 0;
+        entry.drawSeconds    = 0;
+    }
+}
+
+GLuint ShaderCorpusBenchmark::compileShader(GLenum type, const std::string &source)
+{
+    std::string uniqueSource;
+    const char *sourceString = source.c_str();
+    if (GetParam().cacheOption == CacheOption::Cold)
+    {
+        // A comment is enough to change the hash the caches are keyed with.
+        std::stringstream strstr;
+        strstr << source << "\n// step " << mStepIndex << "\n";
+        uniqueSource = strstr.str();
+        sourceString = uniqueSource.c_str();
+    }
+
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &sourceString, nullptr);
+    glCompileShader(shader);
+
+    // Querying the status waits for the compilation to finish, in case it is done in parallel.
+    GLint compileResult = 0;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compileResult);
+    if (compileResult == 0)
+    {
+        glDeleteShader(shader);
+        return 0;
+    }
+    return shader;
+}
+
+void ShaderCorpusBenchmark::drawBenchmark()
+{
+    Timer timer;
+
+    for (CorpusEntry &entry : mCorpus)
+    {
+        timer.start();
+        GLuint vs = compileShader(GL_VERTEX_SHADER, entry.vertexSource);
+        GLuint fs = compileShader(GL_FRAGMENT_SHADER, entry.fragmentSource);
+        timer.stop();
+        entry.compileSeconds += timer.getElapsedWallClockTime();
+
+        if (vs == 0 || fs == 0)
+        {
+            glDeleteShader(vs);
+            glDeleteShader(fs);
+            failTest("Could not compile the shaders of " + entry.name);
+            abortTest();
+            return;
+        }
+
+        timer.start();
+        GLuint program = glCreateProgram();
+        glAttachShader(program, vs);
+        glAttachShader(program, fs);
+        glLinkProgram(program);
+        GLint linkResult = 0;
+        glGetProgramiv(program, GL_LINK_STATUS, &linkResult);
+        timer.stop();
+        entry.linkSeconds += timer.getElapsedWallClockTime();
+
+        glDeleteShader(vs);
+        glDeleteShader(fs);
+
+        if (linkResult == 0)
+        {
+            glDeleteProgram(program);
+            failTest("Could not link the program of " + entry.name);
+            abortTest();
+            return;
+        }
+
+        // The first draw creates the pipeline in back ends that create them lazily.  The
+        // attributes are left disabled, since their names differ in every shader.
+        timer.start();
+        glUseProgram(program);
+        glDrawArrays(GL_TRIANGLES, 0, 3);
+        timer.stop();
+        entry.drawSeconds += timer.getElapsedWallClockTime();
+
+        glDeleteProgram(program);
+    }
+
+    ++mStepIndex;
+    ++mStepsInLoop;
+}
+
+using namespace egl_platform;
+
+ShaderCorpusParams ShaderCorpusD3D11Params(CacheOption cacheOption)
+{
+    ShaderCorpusParams params(cacheOption);
+    params.eglParameters = D3D11();
+    return params;
+}
+
+ShaderCorpusParams ShaderCorpusOpenGLOrGLESParams(CacheOption cacheOption)
+{
+    ShaderCorpusParams params(cacheOption);
+    params.eglParameters = OPENGL_OR_GLES();
+    return params;
+}
+
+ShaderCorpusParams ShaderCorpusVulkanParams(CacheOption cacheOption)
+{
+    ShaderCorpusParams params(cacheOption);
+    params.eglParameters = VULKAN();
+    return params;
+}
+
+TEST_P(ShaderCorpusBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(ShaderCorpusBenchmark,
+                       ShaderCorpusD3D11Params(CacheOption::Cold),
+                       ShaderCorpusOpenGLOrGLESParams(CacheOption::Cold),
+                       ShaderCorpusVulkanParams(CacheOption::Cold),
+                       ShaderCorpusD3D11Params(CacheOption::Warm),
+                       ShaderCorpusOpenGLOrGLESParams(CacheOption::Warm),
+                       ShaderCorpusVulkanParams(CacheOption::Warm));
+
+}  // anonymous namespace
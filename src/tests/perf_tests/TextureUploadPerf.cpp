@@ -32,7 +32,8 @@ struct TextureUploadParams final : public RenderTestParams
         baseSize     = 1024;
         subImageSize = 64;
 
-        webgl = false;
+        webgl                          = false;
+        streamThroughPixelUnpackBuffer = false;
     }
 
     std::string story() const override;
@@ -41,6 +42,7 @@ struct TextureUploadParams final : public RenderTestParams
     GLsizei subImageSize;
 
     bool webgl;
+    bool streamThroughPixelUnpackBuffer;
 };
 
 std::ostream &operator<<(std::ostream &os, const TextureUploadParams &params)
@@ -60,6 +62,11 @@ std::string TextureUploadParams::story() const
         strstr << "_webgl";
     }
 
+    if (streamThroughPixelUnpackBuffer)
+    {
+        strstr << "_streaming_pbo";
+    }
+
     return strstr.str();
 }
 
@@ -347,6 +354,16 @@ TextureUploadParams OpenGLOrGLESParams(bool webglCompat)
     return params;
 }
 
+TextureUploadParams OpenGLStreamingPBOParams(bool webglCompat)
+{
+    TextureUploadParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES();
+    params.eglParameters.enable(Feature::StreamTextureUploadsThroughPixelUnpackBuffer);
+    params.webgl                          = webglCompat;
+    params.streamThroughPixelUnpackBuffer = true;
+    return params;
+}
+
 TextureUploadParams VulkanParams(bool webglCompat)
 {
     TextureUploadParams params;
@@ -408,6 +425,8 @@ ANGLE_INSTANTIATE_TEST(TextureUploadSubImageBenchmark,
                        D3D11Params(true),
                        OpenGLOrGLESParams(false),
                        OpenGLOrGLESParams(true),
+                       OpenGLStreamingPBOParams(false),
+                       OpenGLStreamingPBOParams(true),
                        VulkanParams(false),
                        NullDevice(VulkanParams(false)),
                        VulkanParams(true));
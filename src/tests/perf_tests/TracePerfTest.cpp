@@ -23,6 +23,7 @@
 #include <rapidjson/document.h>
 #include <rapidjson/istreamwrapper.h>
 
+#include <algorithm>
 #include <cassert>
 #include <fstream>
 #include <functional>
@@ -81,6 +82,7 @@ class TracePerfTest : public ANGLERenderTest
     void initializeBenchmark() override;
     void destroyBenchmark() override;
     void drawBenchmark() override;
+    void startTest() override;
 
     // TODO(http://www.anglebug.com/5878): Add support for creating EGLSurface:
     // - eglCreatePbufferSurface()
@@ -124,6 +126,16 @@ class TracePerfTest : public ANGLERenderTest
     void validateSerializedState(const char *serializedState, const char *fileName, uint32_t line);
 
     bool isDefaultFramebuffer(GLenum target) const;
+    // Whether the default framebuffer of the trace is replaced by the offscreen framebuffers.
+    bool usesOffscreenFramebuffers() const
+    {
+        return mParams.surfaceType == SurfaceType::Offscreen ||
+               mParams.surfaceType == SurfaceType::Headless;
+    }
+    GLuint getCurrentOffscreenFramebuffer() const
+    {
+        return mOffscreenFramebuffers[mTotalFrameCount % mOffscreenFramebuffers.size()];
+    }
 
     double getHostTimeFromGLTime(GLint64 glTime);
 
@@ -163,6 +175,7 @@ class TracePerfTest : public ANGLERenderTest
     void sampleTime();
     void saveScreenshot(const std::string &screenshotName) override;
     void swap();
+    void writeFrameTimes();
 
     const TracePerfParams mParams;
 
@@ -175,20 +188,24 @@ class TracePerfTest : public ANGLERenderTest
     std::vector<TimeSample> mTimeline;
 
     std::string mStartingDirectory;
-    bool mUseTimestampQueries                                           = false;
-    static constexpr int mMaxOffscreenBufferCount                       = 2;
-    std::array<GLuint, mMaxOffscreenBufferCount> mOffscreenFramebuffers = {0, 0};
-    std::array<GLuint, mMaxOffscreenBufferCount> mOffscreenTextures     = {0, 0};
-    GLuint mOffscreenDepthStencil                                       = 0;
-    int mWindowWidth                                                    = 0;
-    int mWindowHeight                                                   = 0;
-    GLuint mDrawFramebufferBinding                                      = 0;
-    GLuint mReadFramebufferBinding                                      = 0;
-    uint32_t mCurrentFrame                                              = 0;
-    uint32_t mCurrentIteration                                          = 0;
-    uint32_t mOffscreenFrameCount                                       = 0;
-    uint32_t mTotalFrameCount                                           = 0;
-    bool mScreenshotSaved                                               = false;
+    bool mUseTimestampQueries = false;
+    // Sized by --offscreen-framebuffer-count.
+    std::vector<GLuint> mOffscreenFramebuffers;
+    std::vector<GLuint> mOffscreenTextures;
+    // Wall time of each frame of the trace during the current run loop, indexed from the start
+    // frame.  Only sampled with --trace-frame-times-file.
+    std::vector<double> mFrameWallTimeSumsMs;
+    std::vector<uint32_t> mFrameWallTimeCounts;
+    GLuint mOffscreenDepthStencil  = 0;
+    int mWindowWidth               = 0;
+    int mWindowHeight              = 0;
+    GLuint mDrawFramebufferBinding = 0;
+    GLuint mReadFramebufferBinding = 0;
+    uint32_t mCurrentFrame         = 0;
+    uint32_t mCurrentIteration     = 0;
+    uint32_t mOffscreenFrameCount  = 0;
+    uint32_t mTotalFrameCount      = 0;
+    bool mScreenshotSaved          = false;
     std::unique_ptr<TraceLibrary> mTraceLibrary;
 };
 
@@ -1296,6 +1313,11 @@ void TracePerfTest::initializeBenchmark()
 
     mStartFrame = traceInfo.frameStart;
     mEndFrame   = traceInfo.frameEnd;
+    if (gTraceFrameTimesFile != nullptr && mEndFrame >= mStartFrame)
+    {
+        mFrameWallTimeSumsMs.resize(mEndFrame - mStartFrame + 1, 0);
+        mFrameWallTimeCounts.resize(mEndFrame - mStartFrame + 1, 0);
+    }
     mTraceLibrary->setBinaryDataDecompressCallback(DecompressBinaryData);
 
     mTraceLibrary->setValidateSerializedStateCallback(ValidateSerializedState);
@@ -1330,9 +1352,9 @@ void TracePerfTest::initializeBenchmark()
     }
 
     // If we're rendering offscreen we set up a default back buffer.
-    if (mParams.surfaceType == SurfaceType::Offscreen)
+    if (usesOffscreenFramebuffers())
     {
-        if (!IsAndroid())
+        if (mParams.surfaceType == SurfaceType::Offscreen && !IsAndroid())
         {
             mWindowWidth *= 4;
             mWindowHeight *= 4;
@@ -1343,9 +1365,13 @@ void TracePerfTest::initializeBenchmark()
         glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, mWindowWidth, mWindowHeight);
         glBindRenderbuffer(GL_RENDERBUFFER, 0);
 
-        glGenFramebuffers(mMaxOffscreenBufferCount, mOffscreenFramebuffers.data());
-        glGenTextures(mMaxOffscreenBufferCount, mOffscreenTextures.data());
-        for (int i = 0; i < mMaxOffscreenBufferCount; i++)
+        size_t framebufferCount = static_cast<size_t>(std::max(gOffscreenFramebufferCount, 1));
+        mOffscreenFramebuffers.resize(framebufferCount);
+        mOffscreenTextures.resize(framebufferCount);
+        glGenFramebuffers(static_cast<GLsizei>(mOffscreenFramebuffers.size()),
+                          mOffscreenFramebuffers.data());
+        glGenTextures(static_cast<GLsizei>(mOffscreenTextures.size()), mOffscreenTextures.data());
+        for (size_t i = 0; i < mOffscreenFramebuffers.size(); i++)
         {
             glBindFramebuffer(GL_FRAMEBUFFER, mOffscreenFramebuffers[i]);
 
@@ -1386,16 +1412,20 @@ void TracePerfTest::initializeBenchmark()
 
 void TracePerfTest::destroyBenchmark()
 {
-    if (mParams.surfaceType == SurfaceType::Offscreen)
+    writeFrameTimes();
+
+    if (usesOffscreenFramebuffers())
     {
-        glDeleteTextures(mMaxOffscreenBufferCount, mOffscreenTextures.data());
-        mOffscreenTextures.fill(0);
+        glDeleteTextures(static_cast<GLsizei>(mOffscreenTextures.size()),
+                         mOffscreenTextures.data());
+        mOffscreenTextures.clear();
 
         glDeleteRenderbuffers(1, &mOffscreenDepthStencil);
         mOffscreenDepthStencil = 0;
 
-        glDeleteFramebuffers(mMaxOffscreenBufferCount, mOffscreenFramebuffers.data());
-        mOffscreenFramebuffers.fill(0);
+        glDeleteFramebuffers(static_cast<GLsizei>(mOffscreenFramebuffers.size()),
+                             mOffscreenFramebuffers.data());
+        mOffscreenFramebuffers.clear();
     }
 
     mTraceLibrary->finishReplay();
@@ -1405,6 +1435,39 @@ void TracePerfTest::destroyBenchmark()
     angle::SetCWD(mStartingDirectory.c_str());
 }
 
+void TracePerfTest::startTest()
+{
+    std::fill(mFrameWallTimeSumsMs.begin(), mFrameWallTimeSumsMs.end(), 0);
+    std::fill(mFrameWallTimeCounts.begin(), mFrameWallTimeCounts.end(), 0);
+}
+
+void TracePerfTest::writeFrameTimes()
+{
+    if (mFrameWallTimeCounts.empty())
+    {
+        return;
+    }
+
+    // Appended to, so that all the tests run by a process can share the file.  Only the last run
+    // loop, the last measured trial, is written.
+    std::ofstream outFile(gTraceFrameTimesFile, std::ios::app);
+    if (!outFile)
+    {
+        WARN() << "Could not open " << gTraceFrameTimesFile << " to write the frame times.";
+        return;
+    }
+
+    for (size_t frameIndex = 0; frameIndex < mFrameWallTimeCounts.size(); ++frameIndex)
+    {
+        uint32_t count = mFrameWallTimeCounts[frameIndex];
+        if (count > 0)
+        {
+            outFile << mName << mBackend << mStory << "," << mStartFrame + frameIndex << ","
+                    << mFrameWallTimeSumsMs[frameIndex] / count << "," << count << "\n";
+        }
+    }
+}
+
 void TracePerfTest::sampleTime()
 {
     if (mUseTimestampQueries)
@@ -1448,29 +1511,36 @@ void TracePerfTest::drawBenchmark()
         sampleTime();
     }
 
-    if (mParams.surfaceType == SurfaceType::Offscreen)
+    if (usesOffscreenFramebuffers())
     {
         // Some driver (ARM and ANGLE) try to nop or defer the glFlush if it is called within the
         // renderpass to avoid breaking renderpass (performance reason). For app traces that does
         // not use any FBO, when we run in the offscreen mode, there is no frame boundary and
         // glFlush call we issued at end of frame will get skipped. To overcome this (and also
-        // matches what onscreen double buffering behavior as well), we use two offscreen FBOs and
-        // ping pong between them for each frame.
-        glBindFramebuffer(GL_FRAMEBUFFER,
-                          mOffscreenFramebuffers[mTotalFrameCount % mMaxOffscreenBufferCount]);
+        // matches what onscreen double buffering behavior as well), we use several offscreen FBOs
+        // (two by default) and cycle through them for each frame.
+        glBindFramebuffer(GL_FRAMEBUFFER, getCurrentOffscreenFramebuffer());
     }
 
     char frameName[32];
     sprintf(frameName, "Frame %u", mCurrentFrame);
     beginInternalTraceEvent(frameName);
 
+    double frameStartTime = mFrameWallTimeCounts.empty() ? 0 : GetHostTimeSeconds();
+
     startGpuTimer();
     mTraceLibrary->replayFrame(mCurrentFrame);
     stopGpuTimer();
 
     updatePerfCounters();
 
-    if (mParams.surfaceType == SurfaceType::Offscreen)
+    if (mParams.surfaceType == SurfaceType::Headless)
+    {
+        // There is no window to show the frames in.
+        glFlush();
+        mTotalFrameCount++;
+    }
+    else if (mParams.surfaceType == SurfaceType::Offscreen)
     {
         if (gMinimizeGPUWork)
         {
@@ -1487,7 +1557,7 @@ void TracePerfTest::drawBenchmark()
             glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
             glBindFramebuffer(
                 GL_READ_FRAMEBUFFER,
-                mOffscreenFramebuffers[mOffscreenFrameCount % mMaxOffscreenBufferCount]);
+                mOffscreenFramebuffers[mOffscreenFrameCount % mOffscreenFramebuffers.size()]);
 
             uint32_t frameX  = (mOffscreenFrameCount % kFramesPerXY) % kFramesPerX;
             uint32_t frameY  = (mOffscreenFrameCount % kFramesPerXY) / kFramesPerX;
@@ -1536,6 +1606,13 @@ void TracePerfTest::drawBenchmark()
 
     endInternalTraceEvent(frameName);
 
+    if (!mFrameWallTimeCounts.empty())
+    {
+        size_t frameIndex = mCurrentFrame - mStartFrame;
+        mFrameWallTimeSumsMs[frameIndex] += (GetHostTimeSeconds() - frameStartTime) * 1000.0;
+        mFrameWallTimeCounts[frameIndex]++;
+    }
+
     if (mCurrentFrame == mEndFrame)
     {
         mTraceLibrary->resetReplay();
@@ -1683,10 +1760,9 @@ EGLBoolean TracePerfTest::onEglDestroyImageKHR(EGLDisplay display, EGLImage imag
 // Triggered when the replay calls glBindFramebuffer.
 void TracePerfTest::onReplayFramebufferChange(GLenum target, GLuint framebuffer)
 {
-    if (framebuffer == 0 && mParams.surfaceType == SurfaceType::Offscreen)
+    if (framebuffer == 0 && usesOffscreenFramebuffers())
     {
-        glBindFramebuffer(target,
-                          mOffscreenFramebuffers[mTotalFrameCount % mMaxOffscreenBufferCount]);
+        glBindFramebuffer(target, getCurrentOffscreenFramebuffer());
     }
     else
     {
@@ -1874,7 +1950,7 @@ void TracePerfTest::onReplayInvalidateFramebuffer(GLenum target,
                                                   GLsizei numAttachments,
                                                   const GLenum *attachments)
 {
-    if (mParams.surfaceType != SurfaceType::Offscreen || !isDefaultFramebuffer(target))
+    if (!usesOffscreenFramebuffers() || !isDefaultFramebuffer(target))
     {
         glInvalidateFramebuffer(target, numAttachments, attachments);
     }
@@ -1894,7 +1970,7 @@ void TracePerfTest::onReplayInvalidateSubFramebuffer(GLenum target,
                                                      GLsizei width,
                                                      GLsizei height)
 {
-    if (mParams.surfaceType != SurfaceType::Offscreen || !isDefaultFramebuffer(target))
+    if (!usesOffscreenFramebuffers() || !isDefaultFramebuffer(target))
     {
         glInvalidateSubFramebuffer(target, numAttachments, attachments, x, y, width, height);
     }
@@ -1909,7 +1985,7 @@ void TracePerfTest::onReplayInvalidateSubFramebuffer(GLenum target,
 
 void TracePerfTest::onReplayDrawBuffers(GLsizei n, const GLenum *bufs)
 {
-    if (mParams.surfaceType != SurfaceType::Offscreen || !isDefaultFramebuffer(GL_DRAW_FRAMEBUFFER))
+    if (!usesOffscreenFramebuffers() || !isDefaultFramebuffer(GL_DRAW_FRAMEBUFFER))
     {
         glDrawBuffers(n, bufs);
     }
@@ -1922,7 +1998,7 @@ void TracePerfTest::onReplayDrawBuffers(GLsizei n, const GLenum *bufs)
 
 void TracePerfTest::onReplayReadBuffer(GLenum src)
 {
-    if (mParams.surfaceType != SurfaceType::Offscreen || !isDefaultFramebuffer(GL_READ_FRAMEBUFFER))
+    if (!usesOffscreenFramebuffers() || !isDefaultFramebuffer(GL_READ_FRAMEBUFFER))
     {
         glReadBuffer(src);
     }
@@ -1937,7 +2013,7 @@ void TracePerfTest::onReplayDiscardFramebufferEXT(GLenum target,
                                                   GLsizei numAttachments,
                                                   const GLenum *attachments)
 {
-    if (mParams.surfaceType != SurfaceType::Offscreen || !isDefaultFramebuffer(target))
+    if (!usesOffscreenFramebuffers() || !isDefaultFramebuffer(target))
     {
         glDiscardFramebufferEXT(target, numAttachments, attachments);
     }
@@ -1972,7 +2048,7 @@ void TracePerfTest::swap()
         mScreenshotSaved = true;
     }
 
-    getGLWindow()->swap();
+    ANGLERenderTest::swap();
 }
 
 void TracePerfTest::saveScreenshot(const std::string &screenshotName)
@@ -2106,6 +2182,7 @@ void RegisterTraceTests()
     {
         surfaceTypes.push_back(SurfaceType::Offscreen);
         surfaceTypes.push_back(SurfaceType::WindowWithVSync);
+        surfaceTypes.push_back(SurfaceType::Headless);
     }
 
     std::vector<ModifierFunc<P>> renderers = {Vulkan<P>, Native<P>};
@@ -0,0 +1,233 @@
+//
+// Copyright 2026 The ANGLE Project Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// TransformFeedbackPerf:
+//   Performance test for transform feedback capture, in the style of a particle simulation that
+//   updates the particles of one buffer into another.  The capture can be split in consecutive
+//   draw calls of ranges of the particles.
+//
+
+#include "ANGLEPerfTest.h"
+
+#include <sstream>
+#include <vector>
+
+#include "util/random_utils.h"
+#include "util/shader_utils.h"
+
+using namespace angle;
+
+namespace
+{
+constexpr unsigned int kIterationsPerStep = 100;
+
+struct TransformFeedbackParams final : public RenderTestParams
+{
+    TransformFeedbackParams()
+    {
+        iterationsPerStep = kIterationsPerStep;
+
+        majorVersion  = 3;
+        minorVersion  = 0;
+        windowWidth   = 256;
+        windowHeight  = 256;
+        particleCount = 10000;
+        drawCount     = 1;
+        emulated      = false;
+    }
+
+    std::string story() const override;
+
+    unsigned int particleCount;
+    // The number of draw calls the particles are captured with.
+    unsigned int drawCount;
+    // Whether transform feedback is emulated in the vertex shader on Vulkan.
+    bool emulated;
+};
+
+std::ostream &operator<<(std::ostream &os, const TransformFeedbackParams &params)
+{
+    os << params.backendAndStory().substr(1);
+    return os;
+}
+
+std::string TransformFeedbackParams::story() const
+{
+    std::stringstream strstr;
+
+    strstr << RenderTestParams::story() << "_" << particleCount << "_particles_" << drawCount
+           << "_draws";
+
+    if (emulated)
+    {
+        strstr << "_emulated";
+    }
+
+    return strstr.str();
+}
+
+class TransformFeedbackBenchmark : public ANGLERenderTest,
+                                   public ::testing::WithParamInterface<TransformFeedbackParams>
+{
+  public:
+    TransformFeedbackBenchmark();
+
+    void initializeBenchmark() override;
+    void destroyBenchmark() override;
+    void drawBenchmark() override;
+
+  private:
+    GLuint mProgram           = 0;
+    GLuint mBuffers[2]        = {};
+    GLuint mVertexArrays[2]   = {};
+    GLuint mTransformFeedback = 0;
+    size_t mCurrentBuffer     = 0;
+};
+
+TransformFeedbackBenchmark::TransformFeedbackBenchmark()
+    : ANGLERenderTest("TransformFeedback", GetParam())
+{}
+
+void TransformFeedbackBenchmark::initializeBenchmark()
+{
+    const TransformFeedbackParams &params = GetParam();
+
+    constexpr char kVS[] = R"(#version 300 es
+in vec4 inPosition;
+in vec4 inVelocity;
+out vec4 outPosition;
+out vec4 outVelocity;
+void main()
+{
+    vec4 velocity = inVelocity - vec4(0.0, 0.001, 0.0, 0.0);
+    outPosition   = vec4(clamp(inPosition.xyz + velocity.xyz * 0.01, -1.0, 1.0), 1.0);
+    outVelocity   = velocity * 0.999;
+})";
+
+    constexpr char kFS[] = R"(#version 300 es
+precision mediump float;
+out vec4 color;
+void main()
+{
+    color = vec4(1.0);
+})";
+
+    const std::vector<std::string> varyings = {"outPosition", "outVelocity"};
+    mProgram = CompileProgramWithTransformFeedback(kVS, kFS, varyings, GL_INTERLEAVED_ATTRIBS);
+    ASSERT_NE(0u, mProgram);
+    glUseProgram(mProgram);
+
+    GLint positionLocation = glGetAttribLocation(mProgram, "inPosition");
+    GLint velocityLocation = glGetAttribLocation(mProgram, "inVelocity");
+    ASSERT_NE(-1, positionLocation);
+    ASSERT_NE(-1, velocityLocation);
+
+    // Interleaved position and velocity of each particle.
+    RNG rng(1);
+    std::vector<float> particles(params.particleCount * 8);
+    for (float &value : particles)
+    {
+        value = rng.randomNegativeOneToOne();
+    }
+
+    constexpr GLsizei kStride = 8 * sizeof(float);
+
+    glGenBuffers(2, mBuffers);
+    glGenVertexArrays(2, mVertexArrays);
+    for (size_t index = 0; index < 2; ++index)
+    {
+        glBindVertexArray(mVertexArrays[index]);
+        glBindBuffer(GL_ARRAY_BUFFER, mBuffers[index]);
+        glBufferData(GL_ARRAY_BUFFER, particles.size() * sizeof(float), particles.data(),
+                     GL_DYNAMIC_COPY);
+
+        glVertexAttribPointer(positionLocation, 4, GL_FLOAT, GL_FALSE, kStride, nullptr);
+        glVertexAttribPointer(velocityLocation, 4, GL_FLOAT, GL_FALSE, kStride,
+                              reinterpret_cast<const void *>(4 * sizeof(float)));
+        glEnableVertexAttribArray(positionLocation);
+        glEnableVertexAttribArray(velocityLocation);
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glGenTransformFeedbacks(1, &mTransformFeedback);
+    glEnable(GL_RASTERIZER_DISCARD);
+
+    ASSERT_GL_NO_ERROR();
+}
+
+void TransformFeedbackBenchmark::destroyBenchmark()
+{
+    glDeleteProgram(mProgram);
+    glDeleteBuffers(2, mBuffers);
+    glDeleteVertexArrays(2, mVertexArrays);
+    glDeleteTransformFeedbacks(1, &mTransformFeedback);
+}
+
+void TransformFeedbackBenchmark::drawBenchmark()
+{
+    const TransformFeedbackParams &params = GetParam();
+
+    const GLsizei particlesPerDraw = static_cast<GLsizei>(params.particleCount / params.drawCount);
+
+    glBindTransformFeedback(GL_TRANSFORM_FEEDBACK, mTransformFeedback);
+    for (unsigned int iteration = 0; iteration < params.iterationsPerStep; ++iteration)
+    {
+        // Read the particles from one buffer and capture the updated ones into the other.
+        glBindVertexArray(mVertexArrays[mCurrentBuffer]);
+        glBindBufferBase(GL_TRANSFORM_FEEDBACK_BUFFER, 0, mBuffers[1 - mCurrentBuffer]);
+
+        glBeginTransformFeedback(GL_POINTS);
+        for (unsigned int drawIndex = 0; drawIndex < params.drawCount; ++drawIndex)
+        {
+            glDrawArrays(GL_POINTS, static_cast<GLint>(drawIndex * particlesPerDraw),
+                         particlesPerDraw);
+        }
+        glEndTransformFeedback();
+
+        mCurrentBuffer = 1 - mCurrentBuffer;
+    }
+
+    ASSERT_GL_NO_ERROR();
+}
+
+TransformFeedbackParams OpenGLOrGLESParams(unsigned int drawCount)
+{
+    TransformFeedbackParams params;
+    params.eglParameters = egl_platform::OPENGL_OR_GLES();
+    params.drawCount     = drawCount;
+    return params;
+}
+
+TransformFeedbackParams VulkanParams(unsigned int drawCount)
+{
+    TransformFeedbackParams params;
+    params.eglParameters = egl_platform::VULKAN();
+    params.drawCount     = drawCount;
+    return params;
+}
+
+TransformFeedbackParams VulkanEmulatedParams(unsigned int drawCount)
+{
+    TransformFeedbackParams params = VulkanParams(drawCount);
+    params.eglParameters.disable(Feature::SupportsTransformFeedbackExtension);
+    params.eglParameters.disable(Feature::SupportsGeometryStreamsCapability);
+    params.eglParameters.enable(Feature::EmulateTransformFeedback);
+    params.emulated = true;
+    return params;
+}
+}  // anonymous namespace
+
+TEST_P(TransformFeedbackBenchmark, Run)
+{
+    run();
+}
+
+ANGLE_INSTANTIATE_TEST(TransformFeedbackBenchmark,
+                       OpenGLOrGLESParams(1),
+                       OpenGLOrGLESParams(16),
+                       VulkanParams(1),
+                       VulkanParams(16),
+                       VulkanEmulatedParams(1),
+                       VulkanEmulatedParams(16));
@@ -24,11 +24,13 @@ namespace
 {
 constexpr unsigned int kIterationsPerStep = 4;
 
-// Controls when we call glUniform, if the data is the same as last frame.
+// Controls when we call glUniform, if the data is the same as last frame.  In SPARSE mode, all
+// uniforms are set every frame but only one of them changes value.
 enum DataMode
 {
     UPDATE,
     REPEAT,
+    SPARSE,
 };
 
 // TODO(jmadill): Use an ANGLE enum for this?
@@ -120,6 +122,10 @@ std::string UniformsParams::story() const
     {
         strstr << "_repeating";
     }
+    else if (dataMode == DataMode::SPARSE)
+    {
+        strstr << "_sparse";
+    }
 
     return strstr.str();
 }
@@ -399,6 +405,15 @@ void UniformsBenchmark::drawLoop(const SetUniformFunc &setUniformsFunc)
                 setUniformsFunc(mUniformLocations, mMatrixData, uniform, frameIndex);
             }
         }
+        else if (params.dataMode == DataMode::SPARSE)
+        {
+            // Only the first uniform gets a different value from the previous draw.
+            for (size_t uniform = 0; uniform < mUniformLocations.size(); ++uniform)
+            {
+                setUniformsFunc(mUniformLocations, mMatrixData, uniform,
+                                uniform == 0 ? frameIndex : 0);
+            }
+        }
         glDrawArrays(GL_TRIANGLES, 0, 3);
     }
 }
@@ -448,7 +463,7 @@ void UniformsBenchmark::drawBenchmark()
         {
             auto setFunc = [](const std::vector<GLuint> &locations, const MatrixData &matrixData,
                               size_t uniform, size_t frameIndex) {
-                float value = static_cast<float>(uniform);
+                float value = static_cast<float>(uniform + frameIndex);
                 glUniform4f(locations[uniform], value, value, value, value);
             };
 
@@ -530,4 +545,9 @@ ANGLE_INSTANTIATE_TEST(
     MatrixUniforms(VULKAN(), DataMode::REPEAT, DataType::MAT4x4, MatrixLayout::NO_TRANSPOSE),
     MatrixUniforms(VULKAN(), DataMode::UPDATE, DataType::MAT3x3, MatrixLayout::NO_TRANSPOSE),
     MatrixUniforms(VULKAN(), DataMode::REPEAT, DataType::MAT3x3, MatrixLayout::NO_TRANSPOSE),
-    VectorUniforms(D3D11_NULL(), DataMode::REPEAT, ProgramMode::MULTIPLE));
+    VectorUniforms(VULKAN(), DataMode::UPDATE),
+    VectorUniforms(VULKAN(), DataMode::SPARSE),
+    VectorUniforms(VULKAN_NULL(), DataMode::SPARSE),
+    MatrixUniforms(VULKAN(), DataMode::SPARSE, DataType::MAT4x4, MatrixLayout::NO_TRANSPOSE),
+    VectorUniforms(D3D11_NULL(), DataMode::REPEAT, ProgramMode::MULTIPLE),
+    VectorUniforms(D3D11(), DataMode::UPDATE, ProgramMode::MULTIPLE));
@@ -21,7 +21,7 @@ constexpr unsigned int kIterationsPerStep = 10;
 
 struct VulkanBarriersPerfParams final : public RenderTestParams
 {
-    VulkanBarriersPerfParams(bool bufferCopy, bool largeTransfers, bool slowFS)
+    VulkanBarriersPerfParams(bool bufferCopy, bool largeTransfers, bool slowFS, bool imageCopies)
     {
         iterationsPerStep = kIterationsPerStep;
 
@@ -36,6 +36,7 @@ struct VulkanBarriersPerfParams final : public RenderTestParams
         doBufferCopy          = bufferCopy;
         doLargeTransfers      = largeTransfers;
         doSlowFragmentShaders = slowFS;
+        doImageCopies         = imageCopies;
     }
 
     std::string story() const override;
@@ -47,6 +48,7 @@ struct VulkanBarriersPerfParams final : public RenderTestParams
     bool doBufferCopy;
     bool doLargeTransfers;
     bool doSlowFragmentShaders;
+    bool doImageCopies;
 };
 
 constexpr int VulkanBarriersPerfParams::kImageSizes[];
@@ -92,6 +94,10 @@ class VulkanBarriersPerfBenchmark : public ANGLERenderTest,
     // Framebuffer handles
     GLFramebuffer mFbos[2];
 
+    // Textures copied between with glCopyImageSubDataEXT.  The first one is the source of the
+    // copies.
+    GLTexture mCopyTextures[5];
+
     // Buffer handle
     GLBuffer mVertexBuffer;
     GLBuffer mIndexBuffer;
@@ -130,6 +136,10 @@ std::string VulkanBarriersPerfParams::story() const
     {
         sout << "_slowfs";
     }
+    if (doImageCopies)
+    {
+        sout << "_image_copy";
+    }
 
     return sout.str();
 }
@@ -268,10 +278,26 @@ void VulkanBarriersPerfBenchmark::createResources()
         createTexture(kTransferTexture1Index, kHugeSizeIndex, true);
         createTexture(kTransferTexture2Index, kHugeSizeIndex, true);
     }
+
+    if (params.doImageCopies)
+    {
+        for (GLTexture &texture : mCopyTextures)
+        {
+            glBindTexture(GL_TEXTURE_2D, texture);
+            glTexStorage2D(GL_TEXTURE_2D, 1, GL_RGBA8, params.kImageSizes[kSmallSizeIndex],
+                           params.kImageSizes[kSmallSizeIndex]);
+        }
+    }
 }
 
 void VulkanBarriersPerfBenchmark::initializeBenchmark()
 {
+    if (GetParam().doImageCopies && !IsGLExtensionEnabled("GL_EXT_copy_image"))
+    {
+        skipTest("GL_EXT_copy_image is not supported");
+        return;
+    }
+
     createResources();
 
     glClearColor(0.0f, 0.0f, 0.0f, 0.0f);
@@ -316,6 +342,9 @@ void VulkanBarriersPerfBenchmark::drawBenchmark()
      * texture 1 into texture 2 and back.  This would use the transfer layouts in the transfer
      * stage.
      *
+     * - Copy one texture into a few others.  These copies are independent, so the barriers they
+     * need can be batched together.
+     *
      * Once compute shader support is added, another independent set of operations could be a few
      * dispatches.  This would use the general and shader read-only layouts in the compute stage.
      *
@@ -373,6 +402,17 @@ void VulkanBarriersPerfBenchmark::drawBenchmark()
                                 params.kBufferSize);
         }
 
+        if (params.doImageCopies)
+        {
+            const GLsizei copySize = params.kImageSizes[kSmallSizeIndex];
+            for (size_t dstIndex = 1; dstIndex < ArraySize(mCopyTextures); ++dstIndex)
+            {
+                glCopyImageSubDataEXT(mCopyTextures[0], GL_TEXTURE_2D, 0, 0, 0, 0,
+                                      mCopyTextures[dstIndex], GL_TEXTURE_2D, 0, 0, 0, 0, copySize,
+                                      copySize, 1);
+            }
+        }
+
         // Bind the framebuffer
         glBindFramebuffer(GL_FRAMEBUFFER, mFbos[fboDestIndex]);
 
@@ -405,7 +445,8 @@ TEST_P(VulkanBarriersPerfBenchmark, Run)
 
 GTEST_ALLOW_UNINSTANTIATED_PARAMETERIZED_TEST(VulkanBarriersPerfBenchmark);
 ANGLE_INSTANTIATE_TEST(VulkanBarriersPerfBenchmark,
-                       VulkanBarriersPerfParams(false, false, false),
-                       VulkanBarriersPerfParams(true, false, false),
-                       VulkanBarriersPerfParams(false, true, false),
-                       VulkanBarriersPerfParams(false, true, true));
+                       VulkanBarriersPerfParams(false, false, false, false),
+                       VulkanBarriersPerfParams(true, false, false, false),
+                       VulkanBarriersPerfParams(false, true, false, false),
+                       VulkanBarriersPerfParams(false, true, true, false),
+                       VulkanBarriersPerfParams(false, false, false, true));
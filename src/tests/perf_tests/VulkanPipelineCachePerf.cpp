@@ -13,6 +13,8 @@
 #include "libANGLE/renderer/vulkan/vk_helpers.h"
 #include "util/random_utils.h"
 
+#include <unordered_set>
+
 using namespace rx;
 
 namespace
@@ -26,6 +28,7 @@ class VulkanPipelineCachePerfTest : public ANGLEPerfTest
     ~VulkanPipelineCachePerfTest();
 
     void SetUp() override;
+    void TearDown() override;
     void step() override;
 
     GraphicsPipelineCache mCache;
@@ -35,15 +38,23 @@ class VulkanPipelineCachePerfTest : public ANGLEPerfTest
     std::vector<vk::GraphicsPipelineDesc> mCacheMisses;
     size_t mMissIndex = 0;
 
+    // The descriptions a single program goes through as the application toggles state between
+    // draw calls, and how many pipelines they map to.
+    std::vector<vk::GraphicsPipelineDesc> mStateChanges;
+    size_t mStateChangePipelineCount = 0;
+
     bool mWithDynamicState;
 
   private:
     void randomizeDesc(vk::GraphicsPipelineDesc *desc);
+    void generateStateChanges();
 };
 
 VulkanPipelineCachePerfTest::VulkanPipelineCachePerfTest()
     : ANGLEPerfTest("VulkanPipelineCachePerf", "", "", kIterationsPerStep), mWithDynamicState(false)
-{}
+{
+    mReporter->RegisterFyiMetric(".pipeline_count", "count");
+}
 
 VulkanPipelineCachePerfTest::~VulkanPipelineCachePerfTest()
 {
@@ -72,6 +83,23 @@ void VulkanPipelineCachePerfTest::SetUp()
         randomizeDesc(&desc);
         mCacheMisses.push_back(desc);
     }
+
+    generateStateChanges();
+    std::unordered_set<vk::GraphicsPipelineDesc> uniqueDescs;
+    for (const vk::GraphicsPipelineDesc &desc : mStateChanges)
+    {
+        if (uniqueDescs.insert(desc).second)
+        {
+            mCache.populate(desc, vk::Pipeline());
+        }
+    }
+    mStateChangePipelineCount = uniqueDescs.size();
+}
+
+void VulkanPipelineCachePerfTest::TearDown()
+{
+    ANGLEPerfTest::TearDown();
+    mReporter->AddResult(".pipeline_count", mStateChangePipelineCount);
 }
 
 void VulkanPipelineCachePerfTest::randomizeDesc(vk::GraphicsPipelineDesc *desc)
@@ -83,6 +111,51 @@ void VulkanPipelineCachePerfTest::randomizeDesc(vk::GraphicsPipelineDesc *desc)
     desc->setSupportsDynamicStateForTest(mWithDynamicState);
 }
 
+void VulkanPipelineCachePerfTest::generateStateChanges()
+{
+    constexpr gl::PrimitiveMode kModes[] = {
+        gl::PrimitiveMode::Triangles, gl::PrimitiveMode::TriangleStrip,
+        gl::PrimitiveMode::TriangleFan, gl::PrimitiveMode::Lines, gl::PrimitiveMode::LineStrip,
+    };
+    constexpr VkCompareOp kDepthFuncs[] = {VK_COMPARE_OP_LESS, VK_COMPARE_OP_LESS_OR_EQUAL};
+
+    vk::GraphicsPipelineTransitionBits transition;
+    gl::RasterizerState rasterState;
+
+    vk::GraphicsPipelineDesc desc;
+    desc.setSupportsDynamicStateForTest(mWithDynamicState);
+
+    for (gl::PrimitiveMode mode : kModes)
+    {
+        desc.setTopology(mode);
+        for (bool cullFace : {false, true})
+        {
+            for (GLenum frontFace : {GL_CCW, GL_CW})
+            {
+                for (bool depthTest : {false, true})
+                {
+                    for (VkCompareOp depthFunc : kDepthFuncs)
+                    {
+                        // Like ContextVk, leave the dynamic state out of the description when
+                        // the extensions are supported.
+                        if (!mWithDynamicState)
+                        {
+                            rasterState.cullFace  = cullFace;
+                            rasterState.cullMode  = gl::CullFaceMode::Back;
+                            rasterState.frontFace = frontFace;
+                            desc.updateCullMode(&transition, rasterState);
+                            desc.updateFrontFace(&transition, rasterState, false);
+                            desc.setDepthTestEnabled(depthTest);
+                            desc.setDepthFunc(depthFunc);
+                        }
+                        mStateChanges.push_back(desc);
+                    }
+                }
+            }
+        }
+    }
+}
+
 void VulkanPipelineCachePerfTest::step()
 {
     vk::RenderPass rp;
@@ -121,6 +194,12 @@ void VulkanPipelineCachePerfTest::step()
         }
     }
 
+    for (const auto &stateChange : mStateChanges)
+    {
+        (void)mCache.getPipeline(VK_NULL_HANDLE, &spc, rp, pl, am, ctm, dbm, ssm, defaultSpecConsts,
+                                 PipelineSource::Draw, stateChange, &desc, &result);
+    }
+
     for (int missCount = 0; missCount < 20 && mMissIndex < mCacheMisses.size();
          ++missCount, ++mMissIndex)
     {
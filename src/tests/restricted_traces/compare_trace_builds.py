@@ -0,0 +1,251 @@
+#! /usr/bin/env python3
+#
+# Copyright 2026 The ANGLE Project Authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+#
+'''
+Compares the performance of a trace between two builds of angle_perftests, for example to bisect a
+regression.  The runs of the two builds are interleaved, in ABBA order, so that drifts of the
+device such as thermal throttling affect both builds alike.  Both builds run the same number of
+steps, calibrated once with the baseline.
+
+The wall time of the runs of both builds is compared with a Mann-Whitney U test, and so is the wall
+time of each frame of the trace, to point at the frames that regressed.
+
+Example:
+
+  python3 compare_trace_builds.py out/Baseline out/Test TracePerfTest.Run/vulkan_manhattan_10 \\
+      --runs 10
+
+Arguments not known to this script are passed to angle_perftests.
+'''
+
+import argparse
+import csv
+import logging
+import math
+import os
+import re
+import statistics
+import subprocess
+import sys
+import tempfile
+
+from collections import defaultdict
+
+DEFAULT_TEST_SUITE = 'angle_perftests'
+DEFAULT_METRIC = 'wall_time'
+DEFAULT_RUNS = 10
+DEFAULT_ALPHA = 0.05
+DEFAULT_MIN_CHANGE_PERCENT = 2.0
+DEFAULT_LOG_LEVEL = 'info'
+
+
+def mann_whitney_u(a, b):
+    '''Returns the two-sided p-value of the Mann-Whitney U test, with the normal approximation and
+    the tie correction.  The approximation is fair from about eight samples per group.'''
+    n1 = len(a)
+    n2 = len(b)
+    if n1 == 0 or n2 == 0:
+        return 1.0
+
+    values = sorted([(value, 0) for value in a] + [(value, 1) for value in b])
+    ranks = [0.0] * len(values)
+    tie_term = 0.0
+    i = 0
+    while i < len(values):
+        j = i
+        while j + 1 < len(values) and values[j + 1][0] == values[i][0]:
+            j += 1
+        # Tied values share the mean of their ranks, which start at 1.
+        for k in range(i, j + 1):
+            ranks[k] = (i + j) / 2.0 + 1.0
+        tie_count = j - i + 1
+        tie_term += tie_count**3 - tie_count
+        i = j + 1
+
+    rank_sum_a = sum(rank for rank, (_, group) in zip(ranks, values) if group == 0)
+    u = rank_sum_a - n1 * (n1 + 1) / 2.0
+    n = n1 + n2
+    variance = n1 * n2 / 12.0 * ((n + 1) - tie_term / (n * (n - 1)))
+    if variance <= 0:
+        return 1.0
+
+    # Continuity corrected.
+    z = (abs(u - n1 * n2 / 2.0) - 0.5) / math.sqrt(variance)
+    return min(1.0, 2.0 * (1.0 - statistics.NormalDist().cdf(max(z, 0.0))))
+
+
+def change_percent(baseline, test):
+    baseline_median = statistics.median(baseline)
+    if baseline_median == 0:
+        return 0.0
+    return (statistics.median(test) - baseline_median) * 100.0 / baseline_median
+
+
+def find_suite(build_dir, suite):
+    if sys.platform == 'win32':
+        suite += '.exe'
+    path = os.path.join(build_dir, suite)
+    if not os.path.exists(path):
+        raise Exception('Cannot find %s' % path)
+    return path
+
+
+def run_test(binary, test_name, metric, extra_args, frame_times_file=None):
+    '''Runs the test once, and returns the reported values of the metric.'''
+    run = [binary, '--gtest_filter=%s' % test_name] + extra_args
+    if frame_times_file:
+        run += ['--trace-frame-times-file', frame_times_file]
+    logging.debug('Running %s' % run)
+    process = subprocess.Popen(run, stdout=subprocess.PIPE, stderr=subprocess.PIPE, encoding='utf8')
+    output, _ = process.communicate()
+
+    m = re.search(r'Running (\d+) tests', output)
+    if m and int(m.group(1)) > 1:
+        print(output)
+        raise Exception('Found more than one test result in output')
+
+    # Results are reported in the format:
+    # name_backend.metric: story= value units.
+    values = re.findall(r'\.' + metric + r':.*= ([0-9.]+)', output)
+    if not values:
+        print(output)
+        raise Exception('Did not find the metric "%s" in the output of %s' % (metric, binary))
+    return [float(value) for value in values]
+
+
+def read_frame_times(frame_times_file):
+    '''Returns the mean wall time of each frame of a run, keyed by frame.'''
+    frame_times = {}
+    if not os.path.exists(frame_times_file):
+        return frame_times
+    with open(frame_times_file) as f:
+        for row in csv.reader(f):
+            if len(row) == 4:
+                frame_times[int(row[1])] = float(row[2])
+    return frame_times
+
+
+def main(raw_args):
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('baseline', help='Build directory of the baseline.')
+    parser.add_argument('test', help='Build directory of the build to compare to the baseline.')
+    parser.add_argument('test_name', help='Test to run, e.g. TracePerfTest.Run/vulkan_manhattan_10')
+    parser.add_argument(
+        '--suite',
+        help='Test suite binary. Default is "%s".' % DEFAULT_TEST_SUITE,
+        default=DEFAULT_TEST_SUITE)
+    parser.add_argument(
+        '-m',
+        '--metric',
+        help='Test metric. Default is "%s".' % DEFAULT_METRIC,
+        default=DEFAULT_METRIC)
+    parser.add_argument(
+        '--runs',
+        help='Number of runs of each build. Default is %d.' % DEFAULT_RUNS,
+        default=DEFAULT_RUNS,
+        type=int)
+    parser.add_argument(
+        '--alpha',
+        help='Significance level of the tests. Default is %.2f.' % DEFAULT_ALPHA,
+        default=DEFAULT_ALPHA,
+        type=float)
+    parser.add_argument(
+        '--min-change',
+        help='Smallest change of the median in percent to report. Default is %.1f.' %
+        DEFAULT_MIN_CHANGE_PERCENT,
+        default=DEFAULT_MIN_CHANGE_PERCENT,
+        type=float)
+    parser.add_argument(
+        '--no-frames', help='Skip the comparison of each frame.', action='store_true')
+    parser.add_argument(
+        '-l', '--log', help='Logging level. Default is %s.' % DEFAULT_LOG_LEVEL,
+        default=DEFAULT_LOG_LEVEL)
+    args, extra_args = parser.parse_known_args(raw_args)
+
+    logging.basicConfig(level=args.log.upper())
+
+    binaries = [find_suite(args.baseline, args.suite), find_suite(args.test, args.suite)]
+    names = ['baseline', 'test']
+
+    # Calibrate the number of steps once, so that both builds do the same work.
+    steps = int(run_test(binaries[0], args.test_name, 'steps_to_run', ['--calibration'] +
+                         extra_args)[0])
+    logging.info('Running with %d steps.' % steps)
+    run_args = ['--steps-per-trial', str(steps), '--trials', '1'] + extra_args
+
+    scores = [[], []]
+    frame_times = [defaultdict(list), defaultdict(list)]
+    with tempfile.TemporaryDirectory() as temp_dir:
+        for run in range(args.runs):
+            # ABBA order: the build that runs first alternates.
+            order = [0, 1] if run % 2 == 0 else [1, 0]
+            for build in order:
+                frame_times_file = None
+                if not args.no_frames:
+                    frame_times_file = os.path.join(temp_dir, '%s_%d.csv' % (names[build], run))
+                scores[build] += run_test(binaries[build], args.test_name, args.metric, run_args,
+                                          frame_times_file)
+                logging.info('Run %d %s: %s %.4f' % (run, names[build], args.metric,
+                                                     scores[build][-1]))
+
+                if frame_times_file:
+                    for frame, time_ms in read_frame_times(frame_times_file).items():
+                        frame_times[build][frame].append(time_ms)
+
+    p_value = mann_whitney_u(scores[0], scores[1])
+    change = change_percent(scores[0], scores[1])
+    print('%s median: baseline %.4f, test %.4f, change %+.2f%%, p-value %.4f' %
+          (args.metric, statistics.median(scores[0]), statistics.median(scores[1]), change,
+           p_value))
+
+    regressed = p_value < args.alpha and change >= args.min_change
+    if p_value >= args.alpha:
+        print('No significant difference.')
+    else:
+        print('The test build is %s.' % ('slower' if change > 0 else 'faster'))
+
+    if args.no_frames:
+        return 1 if regressed else 0
+
+    # Every frame is a separate test, so the Benjamini-Hochberg procedure keeps the share of frames
+    # flagged by chance under alpha.
+    frames = sorted(set(frame_times[0]) & set(frame_times[1]))
+    frame_results = []
+    for frame in frames:
+        baseline_times = frame_times[0][frame]
+        test_times = frame_times[1][frame]
+        frame_results.append((frame, statistics.median(baseline_times),
+                              statistics.median(test_times),
+                              change_percent(baseline_times, test_times),
+                              mann_whitney_u(baseline_times, test_times)))
+
+    max_p_value = 0.0
+    for rank, result in enumerate(sorted(frame_results, key=lambda result: result[4]), 1):
+        if result[4] <= args.alpha * rank / len(frame_results):
+            max_p_value = result[4]
+    regressed_frames = [
+        result for result in frame_results
+        if max_p_value > 0 and result[4] <= max_p_value and result[3] >= args.min_change
+    ]
+
+    if not frames:
+        print('No frame times were recorded, is %s a trace test?' % args.test_name)
+    elif not regressed_frames:
+        print('No frame regressed.')
+    else:
+        print('Regressed frames:')
+        print('%8s %14s %14s %10s %10s' % ('frame', 'baseline (ms)', 'test (ms)', 'change',
+                                          'p-value'))
+        for frame, baseline_ms, test_ms, frame_change, frame_p_value in regressed_frames:
+            print('%8d %14.4f %14.4f %+9.2f%% %10.2g' % (frame, baseline_ms, test_ms,
+                                                         frame_change, frame_p_value))
+
+    return 1 if regressed or regressed_frames else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
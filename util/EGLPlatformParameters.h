@@ -64,7 +64,8 @@ struct EGLPlatformParameters
     {
         return std::tie(renderer, majorVersion, minorVersion, deviceType, presentPath,
                         debugLayersEnabled, robustness, displayPowerPreference,
-                        disabledFeatureOverrides, enabledFeatureOverrides, platformMethods);
+                        nativePlatformType, disabledFeatureOverrides, enabledFeatureOverrides,
+                        platformMethods);
     }
 
     // Helpers to enable and disable ANGLE features.  Expects a kFeature* value from
@@ -88,6 +89,7 @@ struct EGLPlatformParameters
     EGLint debugLayersEnabled     = EGL_DONT_CARE;
     EGLint robustness             = EGL_DONT_CARE;
     EGLint displayPowerPreference = EGL_DONT_CARE;
+    EGLint nativePlatformType     = EGL_DONT_CARE;
 
     std::vector<angle::Feature> enabledFeatureOverrides;
     std::vector<angle::Feature> disabledFeatureOverrides;
@@ -40,7 +40,8 @@ ConfigParameters::ConfigParameters()
       samples(-1),
       resetStrategy(EGL_NO_RESET_NOTIFICATION_EXT),
       colorSpace(EGL_COLORSPACE_LINEAR),
-      swapInterval(kDefaultSwapInterval)
+      swapInterval(kDefaultSwapInterval),
+      pbufferSurface(false)
 {}
 
 ConfigParameters::~ConfigParameters() = default;
@@ -203,6 +204,12 @@ bool EGLWindow::initializeDisplay(OSWindow *osWindow,
         displayAttributes.push_back(params.displayPowerPreference);
     }
 
+    if (params.nativePlatformType != EGL_DONT_CARE)
+    {
+        displayAttributes.push_back(EGL_PLATFORM_ANGLE_NATIVE_PLATFORM_TYPE_ANGLE);
+        displayAttributes.push_back(params.nativePlatformType);
+    }
+
     std::vector<const char *> enabledFeatureOverrides;
     std::vector<const char *> disabledFeatureOverrides;
 
@@ -295,9 +302,16 @@ GLWindowResult EGLWindow::initializeSurface(OSWindow *osWindow,
         return GLWindowResult::NoMutableRenderBufferSupport;
     }
 
+    EGLint surfaceType =
+        EGL_WINDOW_BIT | (params.mutableRenderBuffer ? EGL_MUTABLE_RENDER_BUFFER_BIT_KHR : 0);
+    if (params.pbufferSurface)
+    {
+        surfaceType = EGL_PBUFFER_BIT;
+    }
+
     std::vector<EGLint> configAttributes = {
         EGL_SURFACE_TYPE,
-        EGL_WINDOW_BIT | (params.mutableRenderBuffer ? EGL_MUTABLE_RENDER_BUFFER_BIT_KHR : 0),
+        surfaceType,
         EGL_RED_SIZE,
         (mConfigParams.redBits >= 0) ? mConfigParams.redBits : EGL_DONT_CARE,
         EGL_GREEN_SIZE,
@@ -349,7 +363,14 @@ GLWindowResult EGLWindow::initializeSurface(OSWindow *osWindow,
     eglGetConfigAttrib(mDisplay, mConfig, EGL_SAMPLES, &mConfigParams.samples);
 
     std::vector<EGLint> surfaceAttributes;
-    if (strstr(displayExtensions, "EGL_NV_post_sub_buffer") != nullptr)
+    if (mConfigParams.pbufferSurface)
+    {
+        surfaceAttributes.push_back(EGL_WIDTH);
+        surfaceAttributes.push_back(osWindow->getWidth());
+        surfaceAttributes.push_back(EGL_HEIGHT);
+        surfaceAttributes.push_back(osWindow->getHeight());
+    }
+    else if (strstr(displayExtensions, "EGL_NV_post_sub_buffer") != nullptr)
     {
         surfaceAttributes.push_back(EGL_POST_SUB_BUFFER_SUPPORTED_NV);
         surfaceAttributes.push_back(EGL_TRUE);
@@ -379,7 +400,8 @@ GLWindowResult EGLWindow::initializeSurface(OSWindow *osWindow,
 
     bool hasCreateSurfaceSwapInterval =
         strstr(displayExtensions, "EGL_ANGLE_create_surface_swap_interval") != nullptr;
-    if (hasCreateSurfaceSwapInterval && mConfigParams.swapInterval != kDefaultSwapInterval)
+    if (hasCreateSurfaceSwapInterval && !mConfigParams.pbufferSurface &&
+        mConfigParams.swapInterval != kDefaultSwapInterval)
     {
         surfaceAttributes.push_back(EGL_SWAP_INTERVAL_ANGLE);
         surfaceAttributes.push_back(mConfigParams.swapInterval);
@@ -387,15 +409,28 @@ GLWindowResult EGLWindow::initializeSurface(OSWindow *osWindow,
 
     surfaceAttributes.push_back(EGL_NONE);
 
-    osWindow->resetNativeWindow();
-
-    mSurface = eglCreateWindowSurface(mDisplay, mConfig, osWindow->getNativeWindow(),
-                                      &surfaceAttributes[0]);
-    if (eglGetError() != EGL_SUCCESS || (mSurface == EGL_NO_SURFACE))
+    if (mConfigParams.pbufferSurface)
     {
-        fprintf(stderr, "eglCreateWindowSurface failed: 0x%X\n", eglGetError());
-        destroyGL();
-        return GLWindowResult::Error;
+        mSurface = eglCreatePbufferSurface(mDisplay, mConfig, &surfaceAttributes[0]);
+        if (eglGetError() != EGL_SUCCESS || (mSurface == EGL_NO_SURFACE))
+        {
+            fprintf(stderr, "eglCreatePbufferSurface failed: 0x%X\n", eglGetError());
+            destroyGL();
+            return GLWindowResult::Error;
+        }
+    }
+    else
+    {
+        osWindow->resetNativeWindow();
+
+        mSurface = eglCreateWindowSurface(mDisplay, mConfig, osWindow->getNativeWindow(),
+                                          &surfaceAttributes[0]);
+        if (eglGetError() != EGL_SUCCESS || (mSurface == EGL_NO_SURFACE))
+        {
+            fprintf(stderr, "eglCreateWindowSurface failed: 0x%X\n", eglGetError());
+            destroyGL();
+            return GLWindowResult::Error;
+        }
     }
 
 #if defined(ANGLE_USE_UTIL_LOADER)
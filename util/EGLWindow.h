@@ -60,6 +60,8 @@ struct ANGLE_UTIL_EXPORT ConfigParameters
     EGLenum resetStrategy;
     EGLenum colorSpace;
     EGLint swapInterval;
+    // Creates a pbuffer of the size of the OSWindow instead of a window surface.
+    bool pbufferSurface;
 };
 
 using GLWindowContext = struct GLWindowHandleContext_T *;
@@ -39,6 +39,8 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::AlwaysCallUseProgramAfterLink, "alwaysCallUseProgramAfterLink"},
     {Feature::AlwaysUnbindFramebufferTexture2D, "alwaysUnbindFramebufferTexture2D"},
     {Feature::AsyncCommandQueue, "asyncCommandQueue"},
+    {Feature::AsyncGraphicsPipelineCreation, "asyncGraphicsPipelineCreation"},
+    {Feature::AsyncPresent, "asyncPresent"},
     {Feature::Avoid1BitAlphaTextureFormats, "avoid1BitAlphaTextureFormats"},
     {Feature::BasicGLLineRasterization, "basicGLLineRasterization"},
     {Feature::BindEmptyForUnusedDescriptorSets, "bindEmptyForUnusedDescriptorSets"},
@@ -46,6 +48,10 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
      "bindTransformFeedbackBufferBeforeBindBufferRange"},
     {Feature::BottomLeftOriginPresentRegionRectangles, "bottomLeftOriginPresentRegionRectangles"},
     {Feature::BresenhamLineRasterization, "bresenhamLineRasterization"},
+    {Feature::CacheCompiledShader, "cacheCompiledShader"},
+    {Feature::CacheCompiledShaderBinaries, "cacheCompiledShaderBinaries"},
+    {Feature::CacheNativeProgramBinaries, "cacheNativeProgramBinaries"},
+    {Feature::CacheTransformedSpirv, "cacheTransformedSpirv"},
     {Feature::CallClearTwice, "callClearTwice"},
     {Feature::ClampArrayAccess, "clampArrayAccess"},
     {Feature::ClampFragDepth, "clampFragDepth"},
@@ -53,13 +59,18 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ClampPointSize, "clampPointSize"},
     {Feature::ClearToZeroOrOneBroken, "clearToZeroOrOneBroken"},
     {Feature::ClipSrcRegionForBlitFramebuffer, "clipSrcRegionForBlitFramebuffer"},
+    {Feature::CombineBufferBindFlags, "combineBufferBindFlags"},
     {Feature::CompressVertexData, "compressVertexData"},
+    {Feature::ConvertRgbTextureUploadsWithCompute, "convertRgbTextureUploadsWithCompute"},
+    {Feature::ConvertStaticBuffersWithComputeShaders, "convertStaticBuffersWithComputeShaders"},
     {Feature::CopyIOSurfaceToNonIOSurfaceForReadOptimization,
      "copyIOSurfaceToNonIOSurfaceForReadOptimization"},
     {Feature::CopyTextureToBufferForReadOptimization, "copyTextureToBufferForReadOptimization"},
     {Feature::CreatePipelineDuringLink, "createPipelineDuringLink"},
+    {Feature::CreateRenderPipelinesAsynchronously, "createRenderPipelinesAsynchronously"},
     {Feature::DecodeEncodeSRGBForGenerateMipmap, "decodeEncodeSRGBForGenerateMipmap"},
     {Feature::DeferFlushUntilEndRenderPass, "deferFlushUntilEndRenderPass"},
+    {Feature::DeferImmutableTextureLevelAllocation, "deferImmutableTextureLevelAllocation"},
     {Feature::DepthClamping, "depthClamping"},
     {Feature::DepthStencilBlitExtraCopy, "depthStencilBlitExtraCopy"},
     {Feature::DirectMetalGeneration, "directMetalGeneration"},
@@ -105,11 +116,15 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::EnableCaptureLimits, "enableCaptureLimits"},
     {Feature::EnableCompressingPipelineCacheInThreadPool,
      "enableCompressingPipelineCacheInThreadPool"},
+    {Feature::EnableCompressingProgramCacheInThreadPool,
+     "enableCompressingProgramCacheInThreadPool"},
     {Feature::EnableMultisampledRenderToTexture, "enableMultisampledRenderToTexture"},
     {Feature::EnablePrecisionQualifiers, "enablePrecisionQualifiers"},
     {Feature::EnablePreRotateSurfaces, "enablePreRotateSurfaces"},
     {Feature::EnableProgramBinaryForCapture, "enableProgramBinaryForCapture"},
+    {Feature::EncodeRenderPassesInParallel, "encodeRenderPassesInParallel"},
     {Feature::ExpandIntegerPowExpressions, "expandIntegerPowExpressions"},
+    {Feature::ExpandPointSpritesWithVertexId, "expandPointSpritesWithVertexId"},
     {Feature::ExplicitlyEnablePerSampleShading, "explicitlyEnablePerSampleShading"},
     {Feature::ExposeNonConformantExtensionsAndVersions, "exposeNonConformantExtensionsAndVersions"},
     {Feature::FinishDoesNotCauseQueriesToBeAvailable, "finishDoesNotCauseQueriesToBeAvailable"},
@@ -158,12 +173,14 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::LimitMaxDrawBuffersForTesting, "limitMaxDrawBuffersForTesting"},
     {Feature::LimitMaxMSAASamplesTo4, "limitMaxMSAASamplesTo4"},
     {Feature::LimitMaxTextureSizeTo4096, "limitMaxTextureSizeTo4096"},
+    {Feature::LoadTextureDataInParallel, "loadTextureDataInParallel"},
     {Feature::LogMemoryReportCallbacks, "logMemoryReportCallbacks"},
     {Feature::LogMemoryReportStats, "logMemoryReportStats"},
     {Feature::LoseContextOnOutOfMemory, "loseContextOnOutOfMemory"},
     {Feature::MrtPerfWorkaround, "mrtPerfWorkaround"},
     {Feature::MultisampleColorFormatShaderReadWorkaround,
      "multisampleColorFormatShaderReadWorkaround"},
+    {Feature::OptimizeSpirv, "optimizeSpirv"},
     {Feature::OverrideSurfaceFormatRGB8ToRGBA8, "overrideSurfaceFormatRGB8ToRGBA8"},
     {Feature::PackLastRowSeparatelyForPaddingInclusion, "packLastRowSeparatelyForPaddingInclusion"},
     {Feature::PackOverlappingRowsSeparatelyPackBuffer, "packOverlappingRowsSeparatelyPackBuffer"},
@@ -171,6 +188,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::PerFrameWindowSizeQuery, "perFrameWindowSizeQuery"},
     {Feature::PersistentlyMappedBuffers, "persistentlyMappedBuffers"},
     {Feature::PreAddTexelFetchOffsets, "preAddTexelFetchOffsets"},
+    {Feature::PrecreateRenderStates, "precreateRenderStates"},
     {Feature::PreferAggregateBarrierCalls, "preferAggregateBarrierCalls"},
     {Feature::PreferCPUForBufferSubData, "preferCPUForBufferSubData"},
     {Feature::PreferDeviceLocalMemoryHostVisible, "preferDeviceLocalMemoryHostVisible"},
@@ -179,6 +197,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::PreferSkippingInvalidateForEmulatedFormats,
      "preferSkippingInvalidateForEmulatedFormats"},
     {Feature::PreferSubmitAtFBOBoundary, "preferSubmitAtFBOBoundary"},
+    {Feature::PromoteDefaultUniformsToPushConstants, "promoteDefaultUniformsToPushConstants"},
     {Feature::PromotePackedFormatsTo8BitPerChannel, "promotePackedFormatsTo8BitPerChannel"},
     {Feature::ProvokingVertex, "provokingVertex"},
     {Feature::QueryCounterBitsGeneratesErrors, "queryCounterBitsGeneratesErrors"},
@@ -186,11 +205,14 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
      "readPixelsUsingImplementationColorReadFormatForNorm16"},
     {Feature::ReapplyUBOBindingsAfterUsingBinaryProgram,
      "reapplyUBOBindingsAfterUsingBinaryProgram"},
+    {Feature::RecordCommandsInDeferredContext, "recordCommandsInDeferredContext"},
     {Feature::RegenerateStructNames, "regenerateStructNames"},
     {Feature::RemoveDynamicIndexingOfSwizzledVector, "removeDynamicIndexingOfSwizzledVector"},
     {Feature::RemoveInvariantAndCentroidForESSL3, "removeInvariantAndCentroidForESSL3"},
+    {Feature::ReplayRenderPassCommandsInParallel, "replayRenderPassCommandsInParallel"},
     {Feature::ResetTexImage2DBaseLevel, "resetTexImage2DBaseLevel"},
     {Feature::RetainSPIRVDebugInfo, "retainSPIRVDebugInfo"},
+    {Feature::ReuseImportedExternalImages, "reuseImportedExternalImages"},
     {Feature::RewriteFloatUnaryMinusOperator, "rewriteFloatUnaryMinusOperator"},
     {Feature::RewriteRepeatedAssignToSwizzled, "rewriteRepeatedAssignToSwizzled"},
     {Feature::RewriteRowMajorMatrices, "rewriteRowMajorMatrices"},
@@ -208,12 +230,16 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::ShadowBuffers, "shadowBuffers"},
     {Feature::ShiftInstancedArrayDataWithOffset, "shiftInstancedArrayDataWithOffset"},
     {Feature::SkipVSConstantRegisterZero, "skipVSConstantRegisterZero"},
+    {Feature::StreamTextureUploadsThroughPixelUnpackBuffer,
+     "streamTextureUploadsThroughPixelUnpackBuffer"},
     {Feature::SupportsAndroidHardwareBuffer, "supportsAndroidHardwareBuffer"},
     {Feature::SupportsAndroidNativeFenceSync, "supportsAndroidNativeFenceSync"},
     {Feature::SupportsBlendOperationAdvanced, "supportsBlendOperationAdvanced"},
+    {Feature::SupportsCalibratedTimestamps, "supportsCalibratedTimestamps"},
     {Feature::SupportsCustomBorderColor, "supportsCustomBorderColor"},
     {Feature::SupportsDepthClipControl, "supportsDepthClipControl"},
     {Feature::SupportsDepthStencilResolve, "supportsDepthStencilResolve"},
+    {Feature::SupportsDescriptorUpdateTemplate, "supportsDescriptorUpdateTemplate"},
     {Feature::SupportsExtendedDynamicState, "supportsExtendedDynamicState"},
     {Feature::SupportsExtendedDynamicState2, "supportsExtendedDynamicState2"},
     {Feature::SupportsExternalFenceCapabilities, "supportsExternalFenceCapabilities"},
@@ -229,13 +255,16 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SupportsFragmentShadingRate, "supportsFragmentShadingRate"},
     {Feature::SupportsGeometryStreamsCapability, "supportsGeometryStreamsCapability"},
     {Feature::SupportsGGPFrameToken, "supportsGGPFrameToken"},
+    {Feature::SupportsHostImageCopy, "supportsHostImageCopy"},
     {Feature::SupportsHostQueryReset, "supportsHostQueryReset"},
     {Feature::SupportsImage2dViewOf3d, "supportsImage2dViewOf3d"},
     {Feature::SupportsImageCubeArray, "supportsImageCubeArray"},
     {Feature::SupportsImageFormatList, "supportsImageFormatList"},
+    {Feature::SupportsImagelessFramebuffer, "supportsImagelessFramebuffer"},
     {Feature::SupportsIncrementalPresent, "supportsIncrementalPresent"},
     {Feature::SupportsIndexTypeUint8, "supportsIndexTypeUint8"},
     {Feature::SupportsLockSurfaceExtension, "supportsLockSurfaceExtension"},
+    {Feature::SupportsMemoryBudget, "supportsMemoryBudget"},
     {Feature::SupportsMultiDrawIndirect, "supportsMultiDrawIndirect"},
     {Feature::SupportsMultisampledRenderToSingleSampled,
      "supportsMultisampledRenderToSingleSampled"},
@@ -244,6 +273,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SupportsPipelineCreationCacheControl, "supportsPipelineCreationCacheControl"},
     {Feature::SupportsPipelineCreationFeedback, "supportsPipelineCreationFeedback"},
     {Feature::SupportsPipelineStatisticsQuery, "supportsPipelineStatisticsQuery"},
+    {Feature::SupportsPresentWait, "supportsPresentWait"},
     {Feature::SupportsProtectedMemory, "supportsProtectedMemory"},
     {Feature::SupportsRenderpass2, "supportsRenderpass2"},
     {Feature::SupportsRenderPassLoadStoreOpNone, "supportsRenderPassLoadStoreOpNone"},
@@ -259,6 +289,7 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
     {Feature::SupportsSurfaceProtectedCapabilitiesExtension,
      "supportsSurfaceProtectedCapabilitiesExtension"},
     {Feature::SupportsSurfaceProtectedSwapchains, "supportsSurfaceProtectedSwapchains"},
+    {Feature::SupportsTimelineSemaphore, "supportsTimelineSemaphore"},
     {Feature::SupportsTransformFeedbackExtension, "supportsTransformFeedbackExtension"},
     {Feature::SupportsYUVSamplerConversion, "supportsYUVSamplerConversion"},
     {Feature::SwapbuffersOnFlushOrFinishWithSingleBuffer,
@@ -270,15 +301,28 @@ constexpr PackedEnumMap<Feature, const char *> kFeatureNames = {{
      "unpackLastRowSeparatelyForPaddingInclusion"},
     {Feature::UnpackOverlappingRowsSeparatelyUnpackBuffer,
      "unpackOverlappingRowsSeparatelyUnpackBuffer"},
+    {Feature::UnrollConstantLoops, "unrollConstantLoops"},
     {Feature::UnsizedSRGBReadPixelsDoesntTransform, "unsizedSRGBReadPixelsDoesntTransform"},
+    {Feature::UploadDefaultUniformsThroughConstantBufferRing,
+     "uploadDefaultUniformsThroughConstantBufferRing"},
     {Feature::UploadTextureDataInChunks, "uploadTextureDataInChunks"},
+    {Feature::UseBinaryArchiveForRenderPipelines, "useBinaryArchiveForRenderPipelines"},
+    {Feature::UseDynamicPrimitiveTopology, "useDynamicPrimitiveTopology"},
+    {Feature::UseFlipDiscardSwapChain, "useFlipDiscardSwapChain"},
+    {Feature::UseHostAllocationCallbacks, "useHostAllocationCallbacks"},
     {Feature::UseInstancedPointSpriteEmulation, "useInstancedPointSpriteEmulation"},
+    {Feature::UseMemorylessTransientAttachments, "useMemorylessTransientAttachments"},
     {Feature::UseMultipleDescriptorsForExternalFormats, "useMultipleDescriptorsForExternalFormats"},
+    {Feature::UsePersistentMappedStreamingBuffers, "usePersistentMappedStreamingBuffers"},
     {Feature::UseSystemMemoryForConstantBuffers, "useSystemMemoryForConstantBuffers"},
+    {Feature::UseTimelineSemaphoreForQueueSerials, "useTimelineSemaphoreForQueueSerials"},
+    {Feature::UseTransferQueueForUploads, "useTransferQueueForUploads"},
     {Feature::UseUnusedBlocksWithStandardOrSharedLayout,
      "useUnusedBlocksWithStandardOrSharedLayout"},
     {Feature::VertexIDDoesNotIncludeBaseVertex, "vertexIDDoesNotIncludeBaseVertex"},
     {Feature::WaitIdleBeforeSwapchainRecreation, "waitIdleBeforeSwapchainRecreation"},
+    {Feature::WarmUpGraphicsPipelinesOnProgramLoad, "warmUpGraphicsPipelinesOnProgramLoad"},
+    {Feature::WarmUpInputLayoutCache, "warmUpInputLayoutCache"},
     {Feature::ZeroMaxLodWorkaround, "zeroMaxLodWorkaround"},
 }};
 }  // anonymous namespace
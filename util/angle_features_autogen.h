@@ -38,12 +38,18 @@ enum class Feature
     AlwaysCallUseProgramAfterLink,
     AlwaysUnbindFramebufferTexture2D,
     AsyncCommandQueue,
+    AsyncGraphicsPipelineCreation,
+    AsyncPresent,
     Avoid1BitAlphaTextureFormats,
     BasicGLLineRasterization,
     BindEmptyForUnusedDescriptorSets,
     BindTransformFeedbackBufferBeforeBindBufferRange,
     BottomLeftOriginPresentRegionRectangles,
     BresenhamLineRasterization,
+    CacheCompiledShader,
+    CacheCompiledShaderBinaries,
+    CacheNativeProgramBinaries,
+    CacheTransformedSpirv,
     CallClearTwice,
     ClampArrayAccess,
     ClampFragDepth,
@@ -51,12 +57,17 @@ enum class Feature
     ClampPointSize,
     ClearToZeroOrOneBroken,
     ClipSrcRegionForBlitFramebuffer,
+    CombineBufferBindFlags,
     CompressVertexData,
+    ConvertRgbTextureUploadsWithCompute,
+    ConvertStaticBuffersWithComputeShaders,
     CopyIOSurfaceToNonIOSurfaceForReadOptimization,
     CopyTextureToBufferForReadOptimization,
     CreatePipelineDuringLink,
+    CreateRenderPipelinesAsynchronously,
     DecodeEncodeSRGBForGenerateMipmap,
     DeferFlushUntilEndRenderPass,
+    DeferImmutableTextureLevelAllocation,
     DepthClamping,
     DepthStencilBlitExtraCopy,
     DirectMetalGeneration,
@@ -99,11 +110,14 @@ enum class Feature
     EmulateTransformFeedback,
     EnableCaptureLimits,
     EnableCompressingPipelineCacheInThreadPool,
+    EnableCompressingProgramCacheInThreadPool,
     EnableMultisampledRenderToTexture,
     EnablePrecisionQualifiers,
     EnablePreRotateSurfaces,
     EnableProgramBinaryForCapture,
+    EncodeRenderPassesInParallel,
     ExpandIntegerPowExpressions,
+    ExpandPointSpritesWithVertexId,
     ExplicitlyEnablePerSampleShading,
     ExposeNonConformantExtensionsAndVersions,
     FinishDoesNotCauseQueriesToBeAvailable,
@@ -151,11 +165,13 @@ enum class Feature
     LimitMaxDrawBuffersForTesting,
     LimitMaxMSAASamplesTo4,
     LimitMaxTextureSizeTo4096,
+    LoadTextureDataInParallel,
     LogMemoryReportCallbacks,
     LogMemoryReportStats,
     LoseContextOnOutOfMemory,
     MrtPerfWorkaround,
     MultisampleColorFormatShaderReadWorkaround,
+    OptimizeSpirv,
     OverrideSurfaceFormatRGB8ToRGBA8,
     PackLastRowSeparatelyForPaddingInclusion,
     PackOverlappingRowsSeparatelyPackBuffer,
@@ -163,6 +179,7 @@ enum class Feature
     PerFrameWindowSizeQuery,
     PersistentlyMappedBuffers,
     PreAddTexelFetchOffsets,
+    PrecreateRenderStates,
     PreferAggregateBarrierCalls,
     PreferCPUForBufferSubData,
     PreferDeviceLocalMemoryHostVisible,
@@ -170,16 +187,20 @@ enum class Feature
     PreferLinearFilterForYUV,
     PreferSkippingInvalidateForEmulatedFormats,
     PreferSubmitAtFBOBoundary,
+    PromoteDefaultUniformsToPushConstants,
     PromotePackedFormatsTo8BitPerChannel,
     ProvokingVertex,
     QueryCounterBitsGeneratesErrors,
     ReadPixelsUsingImplementationColorReadFormatForNorm16,
     ReapplyUBOBindingsAfterUsingBinaryProgram,
+    RecordCommandsInDeferredContext,
     RegenerateStructNames,
     RemoveDynamicIndexingOfSwizzledVector,
     RemoveInvariantAndCentroidForESSL3,
+    ReplayRenderPassCommandsInParallel,
     ResetTexImage2DBaseLevel,
     RetainSPIRVDebugInfo,
+    ReuseImportedExternalImages,
     RewriteFloatUnaryMinusOperator,
     RewriteRepeatedAssignToSwizzled,
     RewriteRowMajorMatrices,
@@ -196,12 +217,15 @@ enum class Feature
     ShadowBuffers,
     ShiftInstancedArrayDataWithOffset,
     SkipVSConstantRegisterZero,
+    StreamTextureUploadsThroughPixelUnpackBuffer,
     SupportsAndroidHardwareBuffer,
     SupportsAndroidNativeFenceSync,
     SupportsBlendOperationAdvanced,
+    SupportsCalibratedTimestamps,
     SupportsCustomBorderColor,
     SupportsDepthClipControl,
     SupportsDepthStencilResolve,
+    SupportsDescriptorUpdateTemplate,
     SupportsExtendedDynamicState,
     SupportsExtendedDynamicState2,
     SupportsExternalFenceCapabilities,
@@ -217,13 +241,16 @@ enum class Feature
     SupportsFragmentShadingRate,
     SupportsGeometryStreamsCapability,
     SupportsGGPFrameToken,
+    SupportsHostImageCopy,
     SupportsHostQueryReset,
     SupportsImage2dViewOf3d,
     SupportsImageCubeArray,
     SupportsImageFormatList,
+    SupportsImagelessFramebuffer,
     SupportsIncrementalPresent,
     SupportsIndexTypeUint8,
     SupportsLockSurfaceExtension,
+    SupportsMemoryBudget,
     SupportsMultiDrawIndirect,
     SupportsMultisampledRenderToSingleSampled,
     SupportsMultiview,
@@ -231,6 +258,7 @@ enum class Feature
     SupportsPipelineCreationCacheControl,
     SupportsPipelineCreationFeedback,
     SupportsPipelineStatisticsQuery,
+    SupportsPresentWait,
     SupportsProtectedMemory,
     SupportsRenderpass2,
     SupportsRenderPassLoadStoreOpNone,
@@ -244,6 +272,7 @@ enum class Feature
     SupportsSurfacelessQueryExtension,
     SupportsSurfaceProtectedCapabilitiesExtension,
     SupportsSurfaceProtectedSwapchains,
+    SupportsTimelineSemaphore,
     SupportsTransformFeedbackExtension,
     SupportsYUVSamplerConversion,
     SwapbuffersOnFlushOrFinishWithSingleBuffer,
@@ -252,14 +281,26 @@ enum class Feature
     UnfoldShortCircuits,
     UnpackLastRowSeparatelyForPaddingInclusion,
     UnpackOverlappingRowsSeparatelyUnpackBuffer,
+    UnrollConstantLoops,
     UnsizedSRGBReadPixelsDoesntTransform,
+    UploadDefaultUniformsThroughConstantBufferRing,
     UploadTextureDataInChunks,
+    UseBinaryArchiveForRenderPipelines,
+    UseDynamicPrimitiveTopology,
+    UseFlipDiscardSwapChain,
+    UseHostAllocationCallbacks,
     UseInstancedPointSpriteEmulation,
+    UseMemorylessTransientAttachments,
     UseMultipleDescriptorsForExternalFormats,
+    UsePersistentMappedStreamingBuffers,
     UseSystemMemoryForConstantBuffers,
+    UseTimelineSemaphoreForQueueSerials,
+    UseTransferQueueForUploads,
     UseUnusedBlocksWithStandardOrSharedLayout,
     VertexIDDoesNotIncludeBaseVertex,
     WaitIdleBeforeSwapchainRecreation,
+    WarmUpGraphicsPipelinesOnProgramLoad,
+    WarmUpInputLayoutCache,
     ZeroMaxLodWorkaround,
 
     InvalidEnum,
@@ -476,8 +476,13 @@ ANGLE_TRACE_LOADER_EXPORT PFNGLMULTIDRAWARRAYSINSTANCEDBASEINSTANCEANGLEPROC
     t_glMultiDrawArraysInstancedBaseInstanceANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLMULTIDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEANGLEPROC
     t_glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE;
+ANGLE_TRACE_LOADER_EXPORT PFNGLBEGINCOMMANDSTREAMANGLEPROC t_glBeginCommandStreamANGLE;
+ANGLE_TRACE_LOADER_EXPORT PFNGLCALLCOMMANDSTREAMANGLEPROC t_glCallCommandStreamANGLE;
+ANGLE_TRACE_LOADER_EXPORT PFNGLDELETECOMMANDSTREAMANGLEPROC t_glDeleteCommandStreamANGLE;
+ANGLE_TRACE_LOADER_EXPORT PFNGLENDCOMMANDSTREAMANGLEPROC t_glEndCommandStreamANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLCOPYSUBTEXTURE3DANGLEPROC t_glCopySubTexture3DANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLCOPYTEXTURE3DANGLEPROC t_glCopyTexture3DANGLE;
+ANGLE_TRACE_LOADER_EXPORT PFNGLWARMUPDRAWANGLEPROC t_glWarmUpDrawANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLBLITFRAMEBUFFERANGLEPROC t_glBlitFramebufferANGLE;
 ANGLE_TRACE_LOADER_EXPORT PFNGLRENDERBUFFERSTORAGEMULTISAMPLEANGLEPROC
     t_glRenderbufferStorageMultisampleANGLE;
@@ -1538,10 +1543,20 @@ void LoadGLES(LoadProc loadProc)
     t_glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE =
         reinterpret_cast<PFNGLMULTIDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEANGLEPROC>(
             loadProc("glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE"));
+    t_glBeginCommandStreamANGLE =
+        reinterpret_cast<PFNGLBEGINCOMMANDSTREAMANGLEPROC>(loadProc("glBeginCommandStreamANGLE"));
+    t_glCallCommandStreamANGLE =
+        reinterpret_cast<PFNGLCALLCOMMANDSTREAMANGLEPROC>(loadProc("glCallCommandStreamANGLE"));
+    t_glDeleteCommandStreamANGLE =
+        reinterpret_cast<PFNGLDELETECOMMANDSTREAMANGLEPROC>(loadProc("glDeleteCommandStreamANGLE"));
+    t_glEndCommandStreamANGLE =
+        reinterpret_cast<PFNGLENDCOMMANDSTREAMANGLEPROC>(loadProc("glEndCommandStreamANGLE"));
     t_glCopySubTexture3DANGLE =
         reinterpret_cast<PFNGLCOPYSUBTEXTURE3DANGLEPROC>(loadProc("glCopySubTexture3DANGLE"));
     t_glCopyTexture3DANGLE =
         reinterpret_cast<PFNGLCOPYTEXTURE3DANGLEPROC>(loadProc("glCopyTexture3DANGLE"));
+    t_glWarmUpDrawANGLE =
+        reinterpret_cast<PFNGLWARMUPDRAWANGLEPROC>(loadProc("glWarmUpDrawANGLE"));
     t_glBlitFramebufferANGLE =
         reinterpret_cast<PFNGLBLITFRAMEBUFFERANGLEPROC>(loadProc("glBlitFramebufferANGLE"));
     t_glRenderbufferStorageMultisampleANGLE =
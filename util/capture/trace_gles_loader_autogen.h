@@ -478,8 +478,13 @@
 #define glMultiDrawArraysInstancedBaseInstanceANGLE t_glMultiDrawArraysInstancedBaseInstanceANGLE
 #define glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE \
     t_glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE
+#define glBeginCommandStreamANGLE t_glBeginCommandStreamANGLE
+#define glCallCommandStreamANGLE t_glCallCommandStreamANGLE
+#define glDeleteCommandStreamANGLE t_glDeleteCommandStreamANGLE
+#define glEndCommandStreamANGLE t_glEndCommandStreamANGLE
 #define glCopySubTexture3DANGLE t_glCopySubTexture3DANGLE
 #define glCopyTexture3DANGLE t_glCopyTexture3DANGLE
+#define glWarmUpDrawANGLE t_glWarmUpDrawANGLE
 #define glBlitFramebufferANGLE t_glBlitFramebufferANGLE
 #define glRenderbufferStorageMultisampleANGLE t_glRenderbufferStorageMultisampleANGLE
 #define glGetCompressedTexImageANGLE t_glGetCompressedTexImageANGLE
@@ -1297,8 +1302,13 @@ ANGLE_TRACE_LOADER_EXPORT extern PFNGLMULTIDRAWARRAYSINSTANCEDBASEINSTANCEANGLEP
     t_glMultiDrawArraysInstancedBaseInstanceANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLMULTIDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEANGLEPROC
     t_glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLBEGINCOMMANDSTREAMANGLEPROC t_glBeginCommandStreamANGLE;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLCALLCOMMANDSTREAMANGLEPROC t_glCallCommandStreamANGLE;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLDELETECOMMANDSTREAMANGLEPROC t_glDeleteCommandStreamANGLE;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLENDCOMMANDSTREAMANGLEPROC t_glEndCommandStreamANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLCOPYSUBTEXTURE3DANGLEPROC t_glCopySubTexture3DANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLCOPYTEXTURE3DANGLEPROC t_glCopyTexture3DANGLE;
+ANGLE_TRACE_LOADER_EXPORT extern PFNGLWARMUPDRAWANGLEPROC t_glWarmUpDrawANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLBLITFRAMEBUFFERANGLEPROC t_glBlitFramebufferANGLE;
 ANGLE_TRACE_LOADER_EXPORT extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLEANGLEPROC
     t_glRenderbufferStorageMultisampleANGLE;
@@ -473,8 +473,13 @@ ANGLE_UTIL_EXPORT PFNGLMULTIDRAWARRAYSINSTANCEDBASEINSTANCEANGLEPROC
     l_glMultiDrawArraysInstancedBaseInstanceANGLE;
 ANGLE_UTIL_EXPORT PFNGLMULTIDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEANGLEPROC
     l_glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE;
+ANGLE_UTIL_EXPORT PFNGLBEGINCOMMANDSTREAMANGLEPROC l_glBeginCommandStreamANGLE;
+ANGLE_UTIL_EXPORT PFNGLCALLCOMMANDSTREAMANGLEPROC l_glCallCommandStreamANGLE;
+ANGLE_UTIL_EXPORT PFNGLDELETECOMMANDSTREAMANGLEPROC l_glDeleteCommandStreamANGLE;
+ANGLE_UTIL_EXPORT PFNGLENDCOMMANDSTREAMANGLEPROC l_glEndCommandStreamANGLE;
 ANGLE_UTIL_EXPORT PFNGLCOPYSUBTEXTURE3DANGLEPROC l_glCopySubTexture3DANGLE;
 ANGLE_UTIL_EXPORT PFNGLCOPYTEXTURE3DANGLEPROC l_glCopyTexture3DANGLE;
+ANGLE_UTIL_EXPORT PFNGLWARMUPDRAWANGLEPROC l_glWarmUpDrawANGLE;
 ANGLE_UTIL_EXPORT PFNGLBLITFRAMEBUFFERANGLEPROC l_glBlitFramebufferANGLE;
 ANGLE_UTIL_EXPORT PFNGLRENDERBUFFERSTORAGEMULTISAMPLEANGLEPROC
     l_glRenderbufferStorageMultisampleANGLE;
@@ -1507,10 +1512,20 @@ void LoadGLES(LoadProc loadProc)
     l_glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE =
         reinterpret_cast<PFNGLMULTIDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEANGLEPROC>(
             loadProc("glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE"));
+    l_glBeginCommandStreamANGLE =
+        reinterpret_cast<PFNGLBEGINCOMMANDSTREAMANGLEPROC>(loadProc("glBeginCommandStreamANGLE"));
+    l_glCallCommandStreamANGLE =
+        reinterpret_cast<PFNGLCALLCOMMANDSTREAMANGLEPROC>(loadProc("glCallCommandStreamANGLE"));
+    l_glDeleteCommandStreamANGLE =
+        reinterpret_cast<PFNGLDELETECOMMANDSTREAMANGLEPROC>(loadProc("glDeleteCommandStreamANGLE"));
+    l_glEndCommandStreamANGLE =
+        reinterpret_cast<PFNGLENDCOMMANDSTREAMANGLEPROC>(loadProc("glEndCommandStreamANGLE"));
     l_glCopySubTexture3DANGLE =
         reinterpret_cast<PFNGLCOPYSUBTEXTURE3DANGLEPROC>(loadProc("glCopySubTexture3DANGLE"));
     l_glCopyTexture3DANGLE =
         reinterpret_cast<PFNGLCOPYTEXTURE3DANGLEPROC>(loadProc("glCopyTexture3DANGLE"));
+    l_glWarmUpDrawANGLE =
+        reinterpret_cast<PFNGLWARMUPDRAWANGLEPROC>(loadProc("glWarmUpDrawANGLE"));
     l_glBlitFramebufferANGLE =
         reinterpret_cast<PFNGLBLITFRAMEBUFFERANGLEPROC>(loadProc("glBlitFramebufferANGLE"));
     l_glRenderbufferStorageMultisampleANGLE =
@@ -478,8 +478,13 @@
 #define glMultiDrawArraysInstancedBaseInstanceANGLE l_glMultiDrawArraysInstancedBaseInstanceANGLE
 #define glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE \
     l_glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE
+#define glBeginCommandStreamANGLE l_glBeginCommandStreamANGLE
+#define glCallCommandStreamANGLE l_glCallCommandStreamANGLE
+#define glDeleteCommandStreamANGLE l_glDeleteCommandStreamANGLE
+#define glEndCommandStreamANGLE l_glEndCommandStreamANGLE
 #define glCopySubTexture3DANGLE l_glCopySubTexture3DANGLE
 #define glCopyTexture3DANGLE l_glCopyTexture3DANGLE
+#define glWarmUpDrawANGLE l_glWarmUpDrawANGLE
 #define glBlitFramebufferANGLE l_glBlitFramebufferANGLE
 #define glRenderbufferStorageMultisampleANGLE l_glRenderbufferStorageMultisampleANGLE
 #define glGetCompressedTexImageANGLE l_glGetCompressedTexImageANGLE
@@ -1289,8 +1294,13 @@ ANGLE_UTIL_EXPORT extern PFNGLMULTIDRAWARRAYSINSTANCEDBASEINSTANCEANGLEPROC
     l_glMultiDrawArraysInstancedBaseInstanceANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLMULTIDRAWELEMENTSINSTANCEDBASEVERTEXBASEINSTANCEANGLEPROC
     l_glMultiDrawElementsInstancedBaseVertexBaseInstanceANGLE;
+ANGLE_UTIL_EXPORT extern PFNGLBEGINCOMMANDSTREAMANGLEPROC l_glBeginCommandStreamANGLE;
+ANGLE_UTIL_EXPORT extern PFNGLCALLCOMMANDSTREAMANGLEPROC l_glCallCommandStreamANGLE;
+ANGLE_UTIL_EXPORT extern PFNGLDELETECOMMANDSTREAMANGLEPROC l_glDeleteCommandStreamANGLE;
+ANGLE_UTIL_EXPORT extern PFNGLENDCOMMANDSTREAMANGLEPROC l_glEndCommandStreamANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLCOPYSUBTEXTURE3DANGLEPROC l_glCopySubTexture3DANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLCOPYTEXTURE3DANGLEPROC l_glCopyTexture3DANGLE;
+ANGLE_UTIL_EXPORT extern PFNGLWARMUPDRAWANGLEPROC l_glWarmUpDrawANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLBLITFRAMEBUFFERANGLEPROC l_glBlitFramebufferANGLE;
 ANGLE_UTIL_EXPORT extern PFNGLRENDERBUFFERSTORAGEMULTISAMPLEANGLEPROC
     l_glRenderbufferStorageMultisampleANGLE;